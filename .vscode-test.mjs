@@ -0,0 +1,18 @@
+import { defineConfig } from '@vscode/test-cli';
+
+export default defineConfig([
+	{
+		label: 'unitTests',
+		files: 'out/test/**/*.test.js',
+	},
+	{
+		// Ctrl+Space → 구조 후보 전달 지연 벤치마크 (npm run bench:latency)
+		label: 'latency',
+		files: 'out/test/latency/**/*.bench.js',
+		workspaceFolder: './bench/fixtures',
+		mocha: {
+			ui: 'tdd',
+			timeout: 600000,
+		},
+	},
+]);
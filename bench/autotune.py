@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""
+언어별 엔진 튜닝 프로파일 생성기 (resources/<lang>/tuning.json).
+
+문법마다 상태 수, 외부 스캐너 비용, 깨진 코드에서의 복구 양상이 달라 전역 기본값 하나가 맞지 않는다.
+빌드된 <lang>_engine_bench(C ABI)를 bench/fixtures로 돌리며 엔진 파라미터를 훑고, 언어마다 가장 나은 값을 고른다.
+
+  1) 오류 복구 상한 (recoveryLimit.maxVersions / maxCost, 모드 0)
+     --fuzz 변형(커서 앞을 깨뜨린 소스)에서 상한 없는 컨버전 대비 p99가 가장 많이 줄어든 조합.
+     상한에 걸린 비율(첫 오류 직전 경로로 대체된 컨버전)이 --max-capped 이하인 조합만 본다.
+  2) lookahead 창 (lookaheadBytes, 모드 2)
+     창 없이 얻은 상태 경로와 하나도 다르지 않은 창 중 컨버전 p95가 가장 낮은 것.
+어느 쪽이든 기준(상한 없음 / 창 없음)보다 --min-gain 이상 빠르지 않으면 0(끔)으로 둔다.
+측정값은 "measured"에 함께 남긴다 (엔진은 읽지 않음).
+
+확장은 CompletionService 생성 시 addon.loadTuning으로 프로파일을 적용한다 (native/src/engine_tuning.h).
+completion.recoveryLimit.* 설정이 0이 아니면 설정이 우선한다.
+
+사용법: python3 bench/autotune.py [--build-dir build/Release] [--languages python,java]
+                                 [--iterations N] [--fuzz N] [--seed S]
+                                 [--max-capped 0.1] [--min-gain 0.05] [--dry-run]
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+# ============================================================
+# 설정
+# ============================================================
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.dirname(BENCH_DIR)
+MANIFEST = os.path.join(BENCH_DIR, "fixtures", "manifest.json")
+
+RECOVERY_VERSIONS = [0, 2, 3, 4]
+RECOVERY_COSTS = [0, 1000, 2000, 4000]
+LOOKAHEAD_WINDOWS = [64, 256, 1024, 4096]
+
+ROW_RE = re.compile(r"^\(all\)\s+(\S+)\s+n=(\d+)\s+p50=\s*([\d.]+)\s+p95=\s*([\d.]+)\s+p99=\s*([\d.]+)\s+max=\s*([\d.]+)")
+CAPPED_RE = re.compile(r"capped (\d+)/(\d+) fuzz conversions")
+MISMATCH_RE = re.compile(r"state path mismatches (\d+)/(\d+) positions")
+
+
+# ============================================================
+# engine_bench 실행 + 출력 해석
+# ============================================================
+def run_bench(binary, args):
+    proc = subprocess.run([binary, "--manifest", MANIFEST] + args, cwd=ROOT_DIR,
+                          capture_output=True, text=True)
+    if proc.returncode != 0:
+        raise RuntimeError(f"{os.path.basename(binary)} {' '.join(args)} 실패:\n{proc.stderr.strip()}")
+    rows = {}
+    for line in proc.stdout.splitlines():
+        m = ROW_RE.match(line)
+        if m:
+            rows[m.group(1)] = {"p95": float(m.group(4)), "p99": float(m.group(5))}
+    result = {"rows": rows}
+    m = CAPPED_RE.search(proc.stderr)
+    if m:
+        result["capped"] = (int(m.group(1)), int(m.group(2)))
+    m = MISMATCH_RE.search(proc.stderr)
+    if m:
+        result["mismatches"] = (int(m.group(1)), int(m.group(2)))
+    return result
+
+
+def tune_recovery(binary, opt):
+    # 한 실행 안에서 상한 없음(fuzz) / 상한(fuzz+cap)을 번갈아 재므로 실행 간 잡음과 무관하게 비율로 비교
+    common = ["--mode", "0", "--iterations", str(opt.iterations), "--fuzz", str(opt.fuzz), "--seed", str(opt.seed)]
+    best = {"maxVersions": 0, "maxCost": 0, "ratio": 1.0}
+    for versions in RECOVERY_VERSIONS:
+        for cost in RECOVERY_COSTS:
+            if versions == 0 and cost == 0:
+                continue
+            result = run_bench(binary, common + ["--recovery", f"{versions}:{cost}"])
+            uncapped = result["rows"].get("fuzz", {}).get("p99", 0.0)
+            capped = result["rows"].get("fuzz+cap", {}).get("p99", 0.0)
+            hits, total = result.get("capped", (0, 0))
+            capped_share = hits / total if total else 0.0
+            ratio = capped / uncapped if uncapped > 0 else 1.0
+            print(f"  recovery {versions}:{cost}  p99 {uncapped:.1f} -> {capped:.1f}us  capped {capped_share:.1%}")
+            if capped_share <= opt.max_capped and ratio < best["ratio"]:
+                best = {"maxVersions": versions, "maxCost": cost, "ratio": ratio,
+                        "fuzzP99Us": {"uncapped": uncapped, "capped": capped}, "cappedShare": capped_share}
+    if best["ratio"] > 1.0 - opt.min_gain:
+        return {"maxVersions": 0, "maxCost": 0, "ratio": 1.0}
+    return best
+
+
+def tune_lookahead(binary, opt):
+    common = ["--mode", "2", "--iterations", str(opt.iterations)]
+    baseline = run_bench(binary, common)["rows"].get("convert", {}).get("p95", 0.0)
+    print(f"  lookahead full  p95 {baseline:.1f}us")
+    best = {"lookaheadBytes": 0, "convertP95Us": baseline}
+    for window in LOOKAHEAD_WINDOWS:
+        result = run_bench(binary, common + ["--lookahead", str(window)])
+        p95 = result["rows"].get("convert", {}).get("p95", 0.0)
+        mismatches, positions = result.get("mismatches", (0, 0))
+        print(f"  lookahead {window}  p95 {p95:.1f}us  mismatches {mismatches}/{positions}")
+        if mismatches == 0 and p95 < best["convertP95Us"]:
+            best = {"lookaheadBytes": window, "convertP95Us": p95}
+    if baseline <= 0 or best["convertP95Us"] > baseline * (1.0 - opt.min_gain):
+        return {"lookaheadBytes": 0, "convertP95Us": baseline, "baselineP95Us": baseline}
+    best["baselineP95Us"] = baseline
+    return best
+
+
+# ============================================================
+# 메인
+# ============================================================
+def manifest_languages():
+    with open(MANIFEST, encoding="utf-8") as f:
+        manifest = json.load(f)
+    return sorted({entry["languageId"] for entry in manifest["fixtures"]})
+
+
+def main():
+    parser = argparse.ArgumentParser(description="언어별 엔진 튜닝 프로파일 생성")
+    parser.add_argument("--build-dir", default=os.path.join("build", "Release"))
+    parser.add_argument("--languages", help="쉼표로 구분 (기본: manifest의 모든 언어)")
+    parser.add_argument("--iterations", type=int, default=10)
+    parser.add_argument("--fuzz", type=int, default=4)
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--max-capped", type=float, default=0.1, help="상한에 걸려도 되는 fuzz 컨버전 비율")
+    parser.add_argument("--min-gain", type=float, default=0.05, help="기준 대비 이만큼 빨라야 채택")
+    parser.add_argument("--dry-run", action="store_true", help="tuning.json을 쓰지 않고 결과만 출력")
+    opt = parser.parse_args()
+
+    languages = opt.languages.split(",") if opt.languages else manifest_languages()
+    written = 0
+    for lang in languages:
+        binary = os.path.join(ROOT_DIR, opt.build_dir, f"{lang}_engine_bench")
+        if not os.path.exists(binary):
+            print(f"[Warning] {lang}: {binary} 없음 (npx node-gyp rebuild 후 다시 실행)", file=sys.stderr)
+            continue
+        print(f"[Info] {lang}")
+        try:
+            recovery = tune_recovery(binary, opt)
+            lookahead = tune_lookahead(binary, opt)
+        except RuntimeError as e:
+            print(f"[Error] {e}", file=sys.stderr)
+            continue
+
+        profile = {
+            "formatVersion": 1,
+            "languageId": lang,
+            "generatedBy": "bench/autotune.py",
+            "recoveryLimit": {"maxVersions": recovery["maxVersions"], "maxCost": recovery["maxCost"]},
+            "lookaheadBytes": lookahead["lookaheadBytes"],
+            "measured": {
+                "iterations": opt.iterations,
+                "fuzz": opt.fuzz,
+                "seed": opt.seed,
+                "fuzzP99Us": recovery.get("fuzzP99Us"),
+                "cappedShare": recovery.get("cappedShare", 0.0),
+                "mode2ConvertP95Us": {"full": lookahead["baselineP95Us"], "tuned": lookahead["convertP95Us"]},
+            },
+        }
+        print(f"  -> recovery {recovery['maxVersions']}:{recovery['maxCost']}, lookahead {lookahead['lookaheadBytes']}")
+        if opt.dry_run:
+            continue
+        path = os.path.join(ROOT_DIR, "resources", lang, "tuning.json")
+        if not os.path.isdir(os.path.dirname(path)):
+            print(f"[Warning] {lang}: resources/{lang}/ 없음, 건너뜀", file=sys.stderr)
+            continue
+        with open(path, "w", encoding="utf-8") as f:
+            json.dump(profile, f, indent=2)
+            f.write("\n")
+        written += 1
+
+    print(f"[Info] tuning.json {written}개 작성" if not opt.dry_run else "[Info] dry run")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,5147 @@
+#include <stdio.h>
+
+// step0: generated
+int step0(int a) {
+    int x = a + a;
+    int y = 14;
+    if (y > 47) {
+        for (int i2 = 0; i2 < 38; i2++) {
+            if (y == 68) {
+                for (int i4 = 0; i4 < 90; i4++) {
+                    i4 = y;
+                }
+                y = 89 - 97;
+                if (i2 > 31) {
+                    // step 14
+                    a = x + y;
+                } else {
+                    y = 73 - y;
+                }
+            }
+            y = 19 - a;
+        }
+        a = 43 + x;
+        x = x * x - x;
+    }
+    a = y;
+    if (a == 85) {
+        for (int i2 = 0; i2 < 55; i2++) {
+            for (int i3 = 0; i3 < 84; i3++) {
+                i2 = i3 * y;
+            }
+            if (i2 < 32) {
+                for (int i4 = 0; i4 < 86; i4++) {
+                    // step 33
+                    i2 = 22;
+                }
+                x = x;
+                i2 = i2 * x;
+            } else {
+                a = x + x;
+            }
+            i2 = y * x;
+        }
+        if (y < 70) {
+            x = a;
+            if (a == 66) {
+                if (a == 84) {
+                    // step 47
+                    y = 68 * 93 * a;
+                } else {
+                    // step 50
+                    x = x * 32 + y;
+                    y = x + y + 34;
+                }
+                if (x < 66) {
+                    y = x * y * a;
+                } else {
+                    // step 57
+                    a = x - 9 + x;
+                }
+            } else {
+                y = 22;
+                for (int i4 = 0; i4 < 95; i4++) {
+                    // step 63
+                    i4 = 67;
+                }
+            }
+            if (a < 37) {
+                x = 31 - 63;
+            }
+            if (a < 61) {
+                if (a < 88) {
+                    x = y + y * a;
+                } else {
+                    // step 74
+                    y = 22 + a;
+                    x = a + y;
+                }
+            }
+        }
+        x = 80 + 90;
+    } else {
+        x = 97 - x;
+    }
+    for (int i1 = 0; i1 < 63; i1++) {
+        a = x + a - 67;
+        i1 = a - 63;
+        a = 98 * 55 + 21;
+    }
+    x = a - a + 61;
+    return x + y + a;
+}
+
+// step1: generated
+int step1(int a, int b) {
+    int x = 48;
+    int y = 42;
+    // step 97
+    b = 99 * a;
+    b = b;
+    if (a < 4) {
+        step0(y);
+    } else {
+        for (int i2 = 0; i2 < 77; i2++) {
+            x = 36;
+        }
+        // step 106
+        y = 57 - a + b;
+    }
+    x = b;
+    y = 26;
+    step0(x);
+    for (int i1 = 0; i1 < 48; i1++) {
+        step0(x);
+    }
+    y = x - b - 84;
+    return y * 59;
+}
+
+// step2: generated
+int step2(int a, int b) {
+    int x = a - b - 1;
+    int y = 12;
+    a = 4 * 35 - step0(x);
+    a = 60;
+    if (x == 44) {
+        if (y == 85) {
+            if (y == 2) {
+                for (int i4 = 0; i4 < 50; i4++) {
+                    step1(b, i4);
+                }
+                if (y > 96) {
+                    // step 132
+                    x = x - step1(x, x);
+                    // step 134
+                    b = b * x;
+                    // step 136
+                    b = a - b;
+                }
+            }
+        }
+        step0(x);
+        for (int i2 = 0; i2 < 46; i2++) {
+            if (x < 7) {
+                b = 11 + 55 * b;
+            }
+        }
+        step0(x);
+    }
+    return a + x * y;
+}
+
+// step3: generated
+int step3(int a) {
+    int x = a - a;
+    int y = 6;
+    a = 50 * 97 - 8;
+    for (int i1 = 0; i1 < 63; i1++) {
+        step0(y);
+        step1(a, a);
+        y = x;
+    }
+    if (x > 34) {
+        if (a < 27) {
+            if (x < 46) {
+                if (a < 11) {
+                    step0(a);
+                }
+                // step 168
+                x = x;
+            }
+            step1(a, y);
+            if (x > 4) {
+                if (x > 29) {
+                    x = 94 + y + y;
+                    y = x;
+                    // step 176
+                    x = x + y * 56;
+                }
+            }
+        }
+    }
+    y = x * x;
+    x = a - 28 + 23;
+    return 7 * y * 13;
+}
+
+// step4: generated
+int step4(int a, int b) {
+    int x = b * 9 + b;
+    int y = 41;
+    if (y < 9) {
+        y = x;
+        b = x + step2(a, a) - step2(y, a);
+        step3(y);
+        for (int i2 = 0; i2 < 51; i2++) {
+            if (b > 54) {
+                x = 91;
+            } else {
+                for (int i4 = 0; i4 < 19; i4++) {
+                    b = y - b;
+                    step2(x, b);
+                    // step 202
+                    a = 77;
+                }
+            }
+            // step 206
+            y = i2;
+            if (b == 24) {
+                for (int i4 = 0; i4 < 58; i4++) {
+                    // step 210
+                    a = 71;
+                    i4 = 43 + 96;
+                }
+                x = 51 - 59 + step0(y);
+                step1(y, x);
+            } else {
+                if (b > 37) {
+                    // step 218
+                    a = y - 36 * step3(a);
+                }
+            }
+        }
+    } else {
+        if (a < 0) {
+            for (int i3 = 0; i3 < 22; i3++) {
+                step0(i3);
+            }
+        } else {
+            step1(b, a);
+            for (int i3 = 0; i3 < 65; i3++) {
+                a = b * 12 - b;
+            }
+            for (int i3 = 0; i3 < 1; i3++) {
+                step3(y);
+            }
+        }
+    }
+    for (int i1 = 0; i1 < 12; i1++) {
+        step0(b);
+    }
+    x = a * step3(b);
+    y = step1(b, b);
+    b = 13 + 73 + step2(x, b);
+    step3(x);
+    return y;
+}
+
+// step5: generated
+int step5(int a, int b) {
+    int x = 76;
+    int y = 8;
+    b = step4(y, a) - a;
+    step0(y);
+    x = 97;
+    // step 255
+    y = a;
+    if (a == 62) {
+        if (x < 71) {
+            b = 72 + step0(y) + 90;
+            y = y;
+        } else {
+            if (b == 58) {
+                b = 20 + 12;
+            } else {
+                step0(b);
+                a = x + 91;
+                a = b;
+            }
+            if (a < 64) {
+                b = 88 * 19 - step2(x, b);
+            } else {
+                y = step3(a) * 91 - 93;
+            }
+            for (int i3 = 0; i3 < 8; i3++) {
+                a = y;
+            }
+            step1(a, y);
+        }
+        if (x == 24) {
+            x = a - 99;
+        } else {
+            for (int i3 = 0; i3 < 65; i3++) {
+                step3(x);
+            }
+        }
+        if (y == 25) {
+            if (b < 43) {
+                for (int i4 = 0; i4 < 5; i4++) {
+                    a = i4 + a * x;
+                    y = x - 51 * 67;
+                    // step 291
+                    a = 4 - b * b;
+                }
+            }
+            if (a == 6) {
+                step2(a, y);
+                for (int i4 = 0; i4 < 1; i4++) {
+                    // step 298
+                    a = y;
+                }
+            }
+        }
+        if (a > 77) {
+            step3(a);
+            if (x < 51) {
+                b = a * 84;
+                if (x < 69) {
+                    // step 308
+                    b = b + b;
+                } else {
+                    // step 311
+                    x = step4(y, a) * b;
+                    // step 313
+                    x = b + a;
+                    step0(x);
+                }
+            } else {
+                step0(y);
+            }
+        } else {
+            step0(b);
+            if (b == 7) {
+                step1(a, x);
+                for (int i4 = 0; i4 < 12; i4++) {
+                    step3(b);
+                    y = x - step3(i4);
+                }
+            }
+            if (b == 82) {
+                step4(a, y);
+                if (a == 71) {
+                    b = 92;
+                } else {
+                    step1(a, b);
+                    y = x;
+                    a = b + b;
+                }
+            }
+        }
+    } else {
+        if (x < 65) {
+            // step 342
+            x = b - 28;
+            b = y - b;
+        }
+        // step 346
+        b = x - step4(x, x) + 70;
+        if (y == 75) {
+            if (y < 69) {
+                if (b == 30) {
+                    // step 351
+                    y = y;
+                }
+                y = a * y * 92;
+                for (int i4 = 0; i4 < 85; i4++) {
+                    // step 356
+                    b = b;
+                }
+            } else {
+                if (y < 13) {
+                    // step 361
+                    x = a * a * b;
+                    // step 363
+                    a = 65;
+                } else {
+                    a = x + b * b;
+                    // step 367
+                    a = b + step4(b, x);
+                }
+            }
+        }
+        for (int i2 = 0; i2 < 46; i2++) {
+            i2 = step0(a) + 50 + i2;
+            for (int i3 = 0; i3 < 22; i3++) {
+                if (i2 < 42) {
+                    // step 376
+                    i2 = x - x;
+                }
+            }
+            x = i2;
+        }
+    }
+    step1(a, x);
+    // step 384
+    x = 17 - a + y;
+    if (y < 77) {
+        step3(b);
+        for (int i2 = 0; i2 < 49; i2++) {
+            // step 389
+            b = a;
+            for (int i3 = 0; i3 < 67; i3++) {
+                y = step3(b) + 65;
+                for (int i4 = 0; i4 < 1; i4++) {
+                    // step 394
+                    i2 = y;
+                }
+            }
+            step3(y);
+        }
+    }
+    return x - y;
+}
+
+// step6: generated
+int step6(int a) {
+    int x = a * 68;
+    int y = 92;
+    // step 408
+    x = 60 + y;
+    step5(x, x);
+    for (int i1 = 0; i1 < 61; i1++) {
+        y = 84 * 58 + 22;
+        if (a == 30) {
+            if (y > 58) {
+                // step 415
+                i1 = a + i1;
+                for (int i4 = 0; i4 < 47; i4++) {
+                    i4 = x + 91 - i4;
+                }
+                if (x < 58) {
+                    step3(x);
+                }
+            }
+            for (int i3 = 0; i3 < 81; i3++) {
+                for (int i4 = 0; i4 < 83; i4++) {
+                    // step 426
+                    i1 = step1(i1, i3);
+                }
+            }
+            step4(a, y);
+            // step 431
+            a = x;
+        } else {
+            i1 = i1;
+            i1 = step1(i1, x);
+            x = 79;
+        }
+        step3(y);
+    }
+    if (y > 69) {
+        if (a < 80) {
+            step3(y);
+            // step 443
+            x = x * 6 * 63;
+        }
+        if (a > 94) {
+            step2(x, y);
+            if (x < 97) {
+                if (x > 53) {
+                    // step 450
+                    x = step0(x);
+                    y = 70;
+                }
+                step2(a, y);
+                y = 86 - 95 * step2(y, a);
+            }
+        }
+        a = x;
+    }
+    return x * step3(a) + step1(y, y);
+}
+
+// step7: generated
+int step7(int a, int b) {
+    int x = 9 * 49 * 65;
+    int y = 6;
+    if (y == 96) {
+        for (int i2 = 0; i2 < 93; i2++) {
+            // step 469
+            a = y + x;
+            if (a < 38) {
+                step1(y, a);
+            }
+            for (int i3 = 0; i3 < 15; i3++) {
+                if (i3 == 93) {
+                    // step 476
+                    x = a;
+                    // step 478
+                    x = x * i2 - y;
+                    // step 480
+                    y = b;
+                } else {
+                    // step 483
+                    i3 = a;
+                    // step 485
+                    i2 = a * step6(x) * 8;
+                    step2(i2, i3);
+                }
+                // step 489
+                x = 15 + 45 + 66;
+                if (y == 23) {
+                    i2 = a;
+                    y = y;
+                }
+            }
+        }
+    }
+    for (int i1 = 0; i1 < 85; i1++) {
+        step6(y);
+        if (a > 14) {
+            for (int i3 = 0; i3 < 13; i3++) {
+                for (int i4 = 0; i4 < 26; i4++) {
+                    // step 503
+                    i3 = x;
+                    // step 505
+                    y = 45 - 19 + i3;
+                    // step 507
+                    a = i4;
+                }
+            }
+            if (y == 73) {
+                step2(b, i1);
+            } else {
+                if (x > 16) {
+                    step4(b, b);
+                    // step 516
+                    y = y - y * 58;
+                }
+            }
+        }
+        b = y;
+        i1 = i1 * y;
+    }
+    // step 524
+    y = y * x * step3(x);
+    if (a < 16) {
+        y = y - a - y;
+        if (b > 99) {
+            step4(y, a);
+        }
+        // step 531
+        a = x - 62 - 56;
+        if (a == 85) {
+            if (x < 60) {
+                b = 19 + b - 36;
+                x = x * b;
+                y = a;
+            }
+            step1(a, a);
+            if (b == 66) {
+                step1(a, a);
+                b = 26 * x * 58;
+                for (int i4 = 0; i4 < 64; i4++) {
+                    // step 544
+                    a = 44;
+                    // step 546
+                    x = x;
+                }
+            } else {
+                y = y + 59;
+            }
+        } else {
+            step6(b);
+        }
+    } else {
+        x = a;
+        x = step5(a, a) - a;
+    }
+    x = step0(a) * x;
+    for (int i1 = 0; i1 < 77; i1++) {
+        step4(i1, i1);
+    }
+    return x * b + step4(a, a);
+}
+
+// step8: generated
+int step8(int a, int b) {
+    int x = a + a - a;
+    int y = 79;
+    step0(a);
+    for (int i1 = 0; i1 < 19; i1++) {
+        y = 81;
+        step7(x, a);
+        step7(i1, x);
+        if (x == 4) {
+            x = 87;
+        }
+    }
+    a = x;
+    if (y < 60) {
+        step6(x);
+        step4(a, x);
+        if (x > 61) {
+            y = y - 96 - b;
+        } else {
+            for (int i3 = 0; i3 < 26; i3++) {
+                if (b > 94) {
+                    // step 588
+                    y = a - step4(x, x);
+                } else {
+                    // step 591
+                    x = y;
+                }
+            }
+            // step 595
+            a = step7(b, a) - step5(x, x) + b;
+            for (int i3 = 0; i3 < 91; i3++) {
+                for (int i4 = 0; i4 < 82; i4++) {
+                    // step 599
+                    x = 47 - x + 42;
+                }
+                i3 = step1(y, x) - b;
+                x = 59 * 33 - a;
+            }
+            b = b * step1(x, a) + y;
+        }
+        // step 607
+        a = b * x;
+    }
+    b = y;
+    for (int i1 = 0; i1 < 54; i1++) {
+        a = 38;
+        a = i1 * 61;
+        y = a * 57 + x;
+    }
+    a = b * 71;
+    y = step0(y) * a;
+    return 47 * b + b;
+}
+
+// step9: generated
+int step9(int a) {
+    int x = 14 * a - a;
+    int y = 67;
+    if (a == 29) {
+        a = 84 + 80;
+    } else {
+        if (x > 60) {
+            // step 629
+            x = step0(y) - 82;
+            // step 631
+            a = y - x - x;
+            a = a * y * y;
+        } else {
+            if (x < 47) {
+                y = step8(y, x) - 38 + 2;
+                x = a;
+            }
+        }
+    }
+    for (int i1 = 0; i1 < 91; i1++) {
+        for (int i2 = 0; i2 < 6; i2++) {
+            if (x == 99) {
+                i1 = 74 * 96;
+            } else {
+                for (int i4 = 0; i4 < 86; i4++) {
+                    x = 28 + a * 53;
+                    i1 = 85 - i4;
+                    // step 649
+                    y = i2 * step7(i2, i4);
+                }
+                for (int i4 = 0; i4 < 18; i4++) {
+                    i4 = 76 * 5;
+                }
+            }
+            x = 77 - step3(i2) * step7(i1, y);
+            a = a;
+        }
+        i1 = 90;
+    }
+    x = x;
+    if (a > 50) {
+        x = 15 * x;
+    }
+    return a + a;
+}
+
+// step10: generated
+int step10(int a, int b) {
+    int x = b;
+    int y = 3;
+    x = a - 67;
+    for (int i1 = 0; i1 < 52; i1++) {
+        // step 674
+        b = b;
+        b = a - 85 * i1;
+        b = step3(a) - a - a;
+    }
+    step1(y, y);
+    // step 680
+    y = 1;
+    if (b < 72) {
+        if (y == 11) {
+            step4(x, x);
+            // step 685
+            y = step1(y, b) - x + y;
+            if (y > 92) {
+                step2(a, a);
+                x = step2(y, b);
+            }
+            // step 691
+            a = a * y;
+        } else {
+            x = a + y;
+            a = 38 * 43;
+            step3(a);
+        }
+        if (b > 80) {
+            a = step5(x, b) - b + 36;
+            if (y > 75) {
+                if (a < 58) {
+                    // step 702
+                    a = 63 + x;
+                }
+            } else {
+                if (b > 16) {
+                    // step 707
+                    y = step1(y, y);
+                    // step 709
+                    x = x;
+                    // step 711
+                    x = 89 + x;
+                }
+                if (x > 67) {
+                    // step 715
+                    y = b * step8(a, x) * b;
+                    // step 717
+                    b = 8 - y;
+                } else {
+                    // step 720
+                    y = step8(b, y);
+                }
+            }
+            step0(x);
+            if (y < 23) {
+                if (y < 9) {
+                    // step 727
+                    b = step8(a, y);
+                } else {
+                    // step 730
+                    y = x * step1(x, x);
+                    // step 732
+                    y = x;
+                    // step 734
+                    x = y + 37 - 95;
+                }
+            } else {
+                step9(x);
+            }
+        } else {
+            b = y + 16 * b;
+            for (int i3 = 0; i3 < 32; i3++) {
+                if (i3 == 82) {
+                    // step 744
+                    i3 = a;
+                    // step 746
+                    b = 19 - y;
+                }
+            }
+            step3(y);
+        }
+    } else {
+        x = step1(b, x);
+        y = b + b;
+        // step 755
+        a = b * x - 49;
+        if (b < 16) {
+            y = step9(x);
+        } else {
+            if (x > 46) {
+                step4(y, a);
+                // step 762
+                b = step2(y, b) - step2(b, x) - step7(b, x);
+                x = y + x + y;
+            }
+            // step 766
+            x = b * step5(b, y) + x;
+            y = 70;
+            step9(a);
+        }
+    }
+    if (a > 64) {
+        if (a < 27) {
+            step3(y);
+        }
+        b = b + 50;
+        // step 777
+        x = step0(x) - x;
+        x = x * y;
+    } else {
+        if (y < 94) {
+            // step 782
+            x = step0(a) + x;
+            y = 67;
+            x = a;
+        } else {
+            for (int i3 = 0; i3 < 15; i3++) {
+                step5(x, x);
+            }
+            x = step8(y, x) + 92;
+        }
+    }
+    if (b == 30) {
+        if (x > 21) {
+            x = x + a + step8(x, y);
+            for (int i3 = 0; i3 < 23; i3++) {
+                if (y == 14) {
+                    step6(y);
+                    i3 = a + b;
+                    y = 6;
+                } else {
+                    // step 802
+                    y = step9(b) * step4(b, b) * y;
+                }
+            }
+            y = 56 + b;
+        } else {
+            x = a * 81;
+            if (y < 52) {
+                // step 810
+                b = step8(a, y) + a;
+            } else {
+                if (a == 74) {
+                    step5(a, x);
+                }
+            }
+            if (b < 63) {
+                step0(b);
+            } else {
+                if (x > 8) {
+                    y = 41 + a - a;
+                }
+                x = b;
+                x = x - x;
+            }
+        }
+    }
+    a = 74 + y;
+    return 33 * step5(a, y);
+}
+
+// step11: generated
+int step11(int a, int b) {
+    int x = 18 - 62;
+    int y = 63;
+    step7(y, x);
+    x = y * y - y;
+    for (int i1 = 0; i1 < 9; i1++) {
+        if (y > 41) {
+            if (y == 78) {
+                b = 36 - x;
+                for (int i4 = 0; i4 < 23; i4++) {
+                    // step 843
+                    i4 = a * 15;
+                }
+            }
+            for (int i3 = 0; i3 < 79; i3++) {
+                if (i1 > 48) {
+                    // step 849
+                    a = step6(y) * step0(a);
+                    // step 851
+                    i1 = i1 + 53 - 35;
+                    a = 91;
+                } else {
+                    // step 855
+                    i1 = 82;
+                }
+            }
+            if (a == 92) {
+                y = i1 * a + 1;
+            } else {
+                // step 862
+                y = step10(i1, b) * a * 64;
+            }
+            if (i1 > 5) {
+                a = i1 * 45;
+                if (a > 93) {
+                    step9(i1);
+                    // step 869
+                    b = 32;
+                    y = step1(a, a) * step6(y) + 34;
+                } else {
+                    // step 873
+                    i1 = i1;
+                }
+            } else {
+                for (int i4 = 0; i4 < 29; i4++) {
+                    i1 = 3 + i1;
+                }
+            }
+        }
+        step10(y, b);
+        for (int i2 = 0; i2 < 36; i2++) {
+            // step 884
+            i1 = 99;
+            if (i2 < 71) {
+                y = 6 * i2;
+            }
+        }
+        for (int i2 = 0; i2 < 19; i2++) {
+            for (int i3 = 0; i3 < 0; i3++) {
+                a = step7(i3, a);
+                step2(i1, b);
+            }
+        }
+    }
+    for (int i1 = 0; i1 < 93; i1++) {
+        x = i1 + 99 * y;
+        step1(i1, x);
+        y = 84 - 39;
+        x = i1;
+    }
+    return a - step9(b);
+}
+
+// step12: generated
+int step12(int a) {
+    int x = 62;
+    int y = 97;
+    if (y < 91) {
+        step11(y, y);
+        if (a < 85) {
+            step1(a, y);
+            for (int i3 = 0; i3 < 93; i3++) {
+                y = 51;
+                // step 916
+                y = a * step1(y, a);
+                for (int i4 = 0; i4 < 40; i4++) {
+                    // step 919
+                    i4 = 39 + x;
+                    // step 921
+                    x = 47 * 85 + i3;
+                }
+            }
+            x = y + y * a;
+            x = step7(x, y) * x;
+        } else {
+            step9(y);
+            for (int i3 = 0; i3 < 86; i3++) {
+                a = 74 - step8(x, i3);
+                if (y < 92) {
+                    // step 932
+                    i3 = y * 48;
+                    // step 934
+                    a = y * 5;
+                    step4(x, y);
+                }
+            }
+            if (y > 11) {
+                // step 940
+                a = 56;
+                x = x * 79;
+            } else {
+                x = 39 + y * 45;
+            }
+            // step 946
+            x = a;
+        }
+    } else {
+        // step 950
+        a = step2(y, y) + x;
+        if (x > 85) {
+            step3(y);
+            y = 10 - a;
+        }
+        for (int i2 = 0; i2 < 94; i2++) {
+            // step 957
+            a = y * i2;
+            y = 28 + i2;
+        }
+    }
+    for (int i1 = 0; i1 < 89; i1++) {
+        x = step9(i1);
+        i1 = 58 + x;
+        for (int i2 = 0; i2 < 61; i2++) {
+            step9(y);
+            a = a * i2;
+        }
+    }
+    if (a < 74) {
+        step9(x);
+        y = 21 + step7(a, x);
+        if (x > 98) {
+            for (int i3 = 0; i3 < 87; i3++) {
+                y = step5(y, i3) * 50;
+            }
+        }
+        for (int i2 = 0; i2 < 62; i2++) {
+            if (i2 > 76) {
+                if (y == 37) {
+                    step7(y, x);
+                }
+            } else {
+                x = step5(a, x) - 1;
+            }
+            if (a > 80) {
+                step7(i2, a);
+                x = 90 + 94 + 82;
+                if (x == 47) {
+                    step1(y, y);
+                }
+            }
+            if (i2 == 37) {
+                x = step5(y, a) + step7(x, x);
+                for (int i4 = 0; i4 < 29; i4++) {
+                    y = 18;
+                    // step 997
+                    y = i4 + i2 + step9(i4);
+                }
+                i2 = x;
+            }
+        }
+    }
+    step0(y);
+    step3(x);
+    return step7(y, a);
+}
+
+// step13: generated
+int step13(int a, int b) {
+    int x = b + 47 + b;
+    int y = 61;
+    if (a < 51) {
+        step10(b, x);
+        step0(a);
+        if (b < 88) {
+            if (a == 82) {
+                // step 1018
+                a = 12 - b;
+                y = 10;
+            }
+            x = b;
+            step1(a, y);
+        } else {
+            step5(x, x);
+            b = y + 25;
+        }
+    }
+    if (a == 29) {
+        if (a > 75) {
+            if (b < 38) {
+                if (x > 90) {
+                    // step 1033
+                    b = step11(y, a) + 93 + y;
+                    // step 1035
+                    b = 74 + x;
+                    // step 1037
+                    y = a - b + 25;
+                }
+                if (b < 72) {
+                    // step 1041
+                    y = a + 43;
+                    // step 1043
+                    b = 85 * step4(y, b);
+                    y = 21 * a;
+                }
+                for (int i4 = 0; i4 < 6; i4++) {
+                    x = step12(a) + 81 - y;
+                }
+            } else {
+                if (x < 19) {
+                    // step 1052
+                    y = b - step6(b);
+                } else {
+                    // step 1055
+                    b = b * 35 * x;
+                    // step 1057
+                    a = y - 76;
+                    step0(a);
+                }
+            }
+        }
+        step4(a, b);
+        if (x == 76) {
+            if (a < 64) {
+                b = 33 - x * x;
+            } else {
+                if (b < 47) {
+                    step1(a, x);
+                    // step 1070
+                    y = 72 * 22;
+                }
+                a = a * b - b;
+            }
+            if (y > 87) {
+                if (y == 54) {
+                    // step 1077
+                    a = b - 19 - a;
+                } else {
+                    // step 1080
+                    b = b * b;
+                }
+            }
+            // step 1084
+            a = b + 22;
+        }
+    } else {
+        step6(y);
+        y = 46 * x;
+    }
+    for (int i1 = 0; i1 < 13; i1++) {
+        step4(y, b);
+        step8(i1, b);
+        if (i1 < 26) {
+            for (int i3 = 0; i3 < 5; i3++) {
+                if (a == 35) {
+                    // step 1097
+                    i1 = 42;
+                    // step 1099
+                    i1 = i3;
+                    y = i3;
+                }
+                step8(b, b);
+            }
+            if (a > 96) {
+                y = b - i1;
+                if (x > 88) {
+                    i1 = step9(i1);
+                } else {
+                    b = 73;
+                }
+            } else {
+                if (a < 97) {
+                    // step 1114
+                    i1 = i1 - 37;
+                } else {
+                    // step 1117
+                    x = 34 - 32 + b;
+                    x = 41 + x + step10(i1, a);
+                }
+            }
+        } else {
+            step12(x);
+            if (a > 22) {
+                if (x < 33) {
+                    // step 1126
+                    y = 85 * 17 - a;
+                    // step 1128
+                    x = b * x * step4(x, y);
+                }
+                x = x;
+                if (x > 35) {
+                    step4(i1, i1);
+                    step1(b, x);
+                    // step 1135
+                    i1 = 23 - y * a;
+                }
+            }
+            for (int i3 = 0; i3 < 66; i3++) {
+                i1 = 24;
+                if (a > 15) {
+                    // step 1142
+                    y = y - x;
+                    // step 1144
+                    b = 86;
+                    // step 1146
+                    y = x * 65 - 89;
+                }
+                // step 1149
+                a = a * b;
+            }
+        }
+    }
+    if (x < 62) {
+        for (int i2 = 0; i2 < 27; i2++) {
+            i2 = 29 + x - x;
+            if (x > 66) {
+                for (int i4 = 0; i4 < 95; i4++) {
+                    // step 1159
+                    i4 = step5(x, b) - step2(i4, x);
+                    // step 1161
+                    b = 81 - b - 73;
+                }
+                if (b > 11) {
+                    x = b;
+                } else {
+                    // step 1167
+                    b = i2 * y * step8(i2, x);
+                }
+            }
+        }
+        if (y > 31) {
+            step11(a, a);
+            // step 1174
+            y = b;
+            y = 67 - step2(a, b) * a;
+            x = x - b + b;
+        }
+        if (y > 27) {
+            x = step3(b) - b;
+        }
+    } else {
+        if (a == 77) {
+            if (x > 15) {
+                // step 1185
+                y = 12 - step4(a, b) - 56;
+                for (int i4 = 0; i4 < 91; i4++) {
+                    x = x - 86;
+                }
+                a = 68 - 69 * 20;
+            }
+            for (int i3 = 0; i3 < 0; i3++) {
+                if (i3 < 55) {
+                    // step 1194
+                    y = i3 - x + b;
+                }
+                if (i3 > 34) {
+                    // step 1198
+                    i3 = step1(y, x) + 73 * x;
+                }
+                b = 59;
+            }
+            step3(x);
+            if (y < 68) {
+                if (a == 52) {
+                    a = 13 + 75 * 74;
+                    step0(a);
+                    y = step10(b, b) * b + a;
+                }
+            }
+        } else {
+            a = b - 35 * y;
+            step0(y);
+        }
+        b = step2(x, a) * 39;
+        b = 62 * x;
+        b = y + a - step8(x, x);
+    }
+    b = a * a;
+    b = 0;
+    if (a == 10) {
+        // step 1222
+        a = x - 28 + x;
+        for (int i2 = 0; i2 < 57; i2++) {
+            // step 1225
+            x = 78 + i2 - step4(b, a);
+        }
+        if (a < 18) {
+            if (a > 1) {
+                step1(a, b);
+                b = step9(b) - 33 * 65;
+            }
+            y = a - b - y;
+        } else {
+            a = step10(a, x) - 33;
+            // step 1236
+            x = 30;
+            y = step12(y);
+            if (b == 26) {
+                for (int i4 = 0; i4 < 49; i4++) {
+                    step11(x, b);
+                    // step 1242
+                    y = 47;
+                    // step 1244
+                    i4 = x;
+                }
+                step4(x, x);
+            } else {
+                step4(x, b);
+                if (x < 39) {
+                    step6(a);
+                    y = b * 27 + 38;
+                    x = x + 16;
+                } else {
+                    // step 1255
+                    b = 0 * y;
+                    // step 1257
+                    y = x - step4(y, a);
+                }
+                if (a < 8) {
+                    // step 1261
+                    y = 74 * a;
+                }
+            }
+        }
+        for (int i2 = 0; i2 < 58; i2++) {
+            step12(i2);
+            // step 1268
+            x = 33;
+            if (y > 23) {
+                // step 1271
+                b = x;
+            }
+        }
+    } else {
+        step10(a, x);
+        if (a < 43) {
+            if (b > 97) {
+                y = 24 - a;
+            }
+        } else {
+            step3(b);
+            for (int i3 = 0; i3 < 49; i3++) {
+                if (y == 87) {
+                    // step 1285
+                    i3 = step7(b, y) * step0(x);
+                    // step 1287
+                    x = a - a;
+                    // step 1289
+                    x = y + b;
+                }
+                for (int i4 = 0; i4 < 33; i4++) {
+                    // step 1293
+                    i4 = 89;
+                }
+            }
+            if (y == 50) {
+                for (int i4 = 0; i4 < 2; i4++) {
+                    // step 1299
+                    i4 = b * a;
+                    // step 1301
+                    a = y;
+                }
+                x = 14 * step3(y);
+            } else {
+                for (int i4 = 0; i4 < 8; i4++) {
+                    step4(b, y);
+                    // step 1308
+                    x = x + a;
+                }
+            }
+            a = 41 * 58 - step1(a, y);
+        }
+    }
+    x = 51;
+    return x - 6 * step4(y, x);
+}
+
+// step14: generated
+int step14(int a, int b) {
+    int x = a - a - b;
+    int y = 27;
+    step4(y, b);
+    // step 1324
+    a = 51;
+    for (int i1 = 0; i1 < 60; i1++) {
+        step1(i1, a);
+        step7(i1, y);
+    }
+    if (y > 70) {
+        step13(a, y);
+        if (a < 43) {
+            if (a > 19) {
+                b = step0(x);
+            } else {
+                if (x == 27) {
+                    y = b * step4(b, b) * step1(y, b);
+                }
+            }
+            for (int i3 = 0; i3 < 22; i3++) {
+                step9(y);
+                i3 = step7(x, i3);
+                if (x < 15) {
+                    a = b * 97 - x;
+                    // step 1345
+                    i3 = 28 + i3 * 94;
+                }
+            }
+            b = step3(y) * b - y;
+        }
+        if (x > 74) {
+            step13(b, b);
+        }
+        if (y > 11) {
+            a = y + b - 58;
+            step10(a, x);
+            b = x + step1(b, b) * a;
+            for (int i3 = 0; i3 < 88; i3++) {
+                // step 1359
+                y = a + y;
+                b = step1(a, a) * 76 + x;
+                x = 4;
+            }
+        } else {
+            // step 1365
+            b = b;
+        }
+    }
+    if (a > 63) {
+        if (y > 82) {
+            step11(b, y);
+            y = y - 11;
+        } else {
+            y = 23 + 62;
+            step8(x, y);
+        }
+        for (int i2 = 0; i2 < 53; i2++) {
+            step11(a, b);
+            for (int i3 = 0; i3 < 48; i3++) {
+                if (a == 50) {
+                    x = 42;
+                    b = i3 - 80 - i2;
+                    // step 1383
+                    b = y * b;
+                } else {
+                    b = i3;
+                    a = 67;
+                }
+            }
+            step5(y, x);
+        }
+    }
+    for (int i1 = 0; i1 < 48; i1++) {
+        if (a < 88) {
+            if (i1 < 76) {
+                i1 = x * y * 64;
+            }
+        } else {
+            b = i1;
+        }
+    }
+    return b - b + step9(b);
+}
+
+// step15: generated
+int step15(int a) {
+    int x = a;
+    int y = 8;
+    for (int i1 = 0; i1 < 45; i1++) {
+        y = i1;
+        if (x == 92) {
+            a = x - i1;
+            y = 82 + x;
+            a = step10(i1, a) + 32;
+            i1 = step14(x, i1);
+        }
+        y = 77 - 63;
+        if (y > 19) {
+            a = step11(i1, i1);
+            x = 14;
+            // step 1421
+            i1 = 36 - a - 63;
+        }
+    }
+    step1(a, a);
+    a = 29 - y * x;
+    if (a > 99) {
+        if (a < 14) {
+            // step 1429
+            y = a * step3(y) * 35;
+            if (x == 21) {
+                a = x + 31 - 72;
+            } else {
+                if (x > 71) {
+                    // step 1435
+                    a = 48;
+                    // step 1437
+                    x = step13(a, x) + step2(x, y);
+                    step4(y, x);
+                }
+                for (int i4 = 0; i4 < 86; i4++) {
+                    // step 1442
+                    x = y;
+                    y = step7(x, i4);
+                }
+                step1(a, a);
+            }
+        }
+        if (a > 93) {
+            // step 1450
+            x = 13 * 40;
+        }
+        step8(y, a);
+        // step 1454
+        y = step4(x, a) - 36;
+    }
+    for (int i1 = 0; i1 < 96; i1++) {
+        if (y == 8) {
+            x = y + x - y;
+        } else {
+            for (int i3 = 0; i3 < 58; i3++) {
+                step8(x, i3);
+                step9(i1);
+            }
+            if (a < 68) {
+                step9(y);
+            } else {
+                if (x == 56) {
+                    i1 = 74 * step9(x);
+                }
+            }
+            i1 = step11(i1, i1) + x + i1;
+            if (i1 > 17) {
+                a = 3 - 16;
+                i1 = y + 11;
+                if (x > 33) {
+                    i1 = 66 + 41 * y;
+                } else {
+                    // step 1479
+                    a = 62 + x;
+                    y = y + x - 90;
+                }
+            }
+        }
+        if (a == 95) {
+            step1(i1, x);
+            step9(i1);
+        }
+        if (x < 15) {
+            step11(a, i1);
+            step12(y);
+        }
+        for (int i2 = 0; i2 < 31; i2++) {
+            a = a - step4(a, i1) * 79;
+            if (x == 2) {
+                i2 = step10(i2, a) * i1;
+            }
+        }
+    }
+    if (a == 59) {
+        x = 24;
+        y = y - a - x;
+        y = a;
+        if (a == 94) {
+            if (x < 28) {
+                for (int i4 = 0; i4 < 15; i4++) {
+                    // step 1507
+                    i4 = step13(a, i4);
+                }
+            }
+        } else {
+            a = 8;
+            if (y > 80) {
+                a = x + step2(a, x) * y;
+                step8(x, y);
+            } else {
+                for (int i4 = 0; i4 < 55; i4++) {
+                    step6(a);
+                    i4 = 88 * i4 + 63;
+                }
+                if (a < 68) {
+                    step2(a, x);
+                    // step 1523
+                    a = 68 * step8(y, x) - x;
+                }
+                for (int i4 = 0; i4 < 54; i4++) {
+                    step6(a);
+                    // step 1528
+                    y = 64 * x;
+                    step9(i4);
+                }
+            }
+            for (int i3 = 0; i3 < 45; i3++) {
+                if (a < 93) {
+                    // step 1535
+                    i3 = step13(y, a) - 8 * x;
+                    // step 1537
+                    a = 95;
+                }
+            }
+        }
+    }
+    if (y > 74) {
+        if (y > 37) {
+            // step 1545
+            y = 46 * 26 - y;
+            if (a > 47) {
+                // step 1548
+                a = x + 66 + a;
+            } else {
+                if (x == 69) {
+                    y = y * a * x;
+                    x = 83 + a;
+                }
+                step0(y);
+            }
+            y = step5(a, a) + y;
+            for (int i3 = 0; i3 < 90; i3++) {
+                if (i3 > 29) {
+                    a = step3(x);
+                }
+            }
+        }
+    } else {
+        if (a > 27) {
+            if (a == 45) {
+                if (y == 4) {
+                    step13(y, a);
+                } else {
+                    y = a + 17;
+                }
+                a = step0(y) + a + step4(x, x);
+                for (int i4 = 0; i4 < 37; i4++) {
+                    // step 1574
+                    a = 5 - x;
+                }
+            } else {
+                for (int i4 = 0; i4 < 58; i4++) {
+                    x = 22 + 94 - a;
+                }
+            }
+            for (int i3 = 0; i3 < 45; i3++) {
+                step12(y);
+                step2(y, i3);
+                for (int i4 = 0; i4 < 28; i4++) {
+                    // step 1586
+                    y = 11 - step12(i3);
+                    step2(i4, y);
+                }
+            }
+            y = 8 * x;
+        }
+        step6(y);
+        a = x + x;
+        x = step3(x) + a;
+    }
+    for (int i1 = 0; i1 < 71; i1++) {
+        // step 1598
+        i1 = 28 + 39;
+        a = i1;
+    }
+    return a - x;
+}
+
+// step16: generated
+int step16(int a, int b) {
+    int x = b;
+    int y = 55;
+    if (b < 32) {
+        b = step3(x);
+        for (int i2 = 0; i2 < 93; i2++) {
+            step1(a, a);
+            step2(b, b);
+        }
+        b = b;
+    }
+    x = step12(a);
+    if (x == 1) {
+        a = x - 48;
+        if (y == 32) {
+            x = a;
+            x = y * b * b;
+        } else {
+            a = 15 - x;
+        }
+    }
+    step3(x);
+    for (int i1 = 0; i1 < 33; i1++) {
+        if (x == 27) {
+            b = 58;
+        }
+    }
+    step9(x);
+    if (a > 25) {
+        if (y < 38) {
+            step5(y, x);
+            step5(b, y);
+            b = 47 + y + b;
+        }
+        step5(y, y);
+        if (y < 1) {
+            if (a < 48) {
+                if (y < 36) {
+                    // step 1644
+                    y = x;
+                    a = step6(b);
+                    step1(a, a);
+                } else {
+                    // step 1649
+                    a = step6(a);
+                    step12(a);
+                }
+            } else {
+                y = y - y;
+            }
+        } else {
+            for (int i3 = 0; i3 < 85; i3++) {
+                // step 1658
+                b = step15(y) * step14(b, x) + x;
+                for (int i4 = 0; i4 < 17; i4++) {
+                    step12(a);
+                    x = 43 * i3;
+                }
+            }
+            step4(b, b);
+            x = 64 - a - step5(x, y);
+            a = step9(x) + a;
+        }
+        b = x + b + x;
+    } else {
+        for (int i2 = 0; i2 < 69; i2++) {
+            y = x * 98 - y;
+            if (x == 40) {
+                x = 94 * 71 + 18;
+                if (y < 69) {
+                    // step 1676
+                    a = i2 - b - step15(b);
+                }
+                b = a + 7 * step4(b, b);
+            } else {
+                if (a > 2) {
+                    i2 = i2 - 85;
+                    step9(i2);
+                    // step 1684
+                    y = step9(i2) + x;
+                } else {
+                    step15(a);
+                }
+                i2 = 92;
+            }
+            i2 = x * i2 - y;
+            for (int i3 = 0; i3 < 29; i3++) {
+                y = 23 + i3;
+            }
+        }
+        y = a;
+        step10(y, b);
+    }
+    if (y > 50) {
+        b = step12(b);
+        if (x < 21) {
+            for (int i3 = 0; i3 < 81; i3++) {
+                y = 69 - 98;
+                for (int i4 = 0; i4 < 52; i4++) {
+                    step14(i4, y);
+                }
+            }
+            x = 53 - step10(a, b) * step3(x);
+        }
+        // step 1710
+        b = b;
+    } else {
+        step12(a);
+    }
+    return step0(y) * b - 25;
+}
+
+// step17: generated
+int step17(int a, int b) {
+    int x = a - a;
+    int y = 14;
+    a = y + x - b;
+    y = b + b + a;
+    if (x == 76) {
+        if (x > 48) {
+            for (int i3 = 0; i3 < 4; i3++) {
+                step0(x);
+                for (int i4 = 0; i4 < 81; i4++) {
+                    // step 1729
+                    a = 94 + y;
+                    x = step1(i3, a) + a;
+                }
+            }
+            if (b == 14) {
+                if (b < 14) {
+                    // step 1736
+                    a = b + 69 + 13;
+                }
+                if (b < 56) {
+                    // step 1740
+                    b = 95 + b;
+                    b = 33 + 85 - 14;
+                } else {
+                    y = 29 * a * 24;
+                }
+                b = b * 79;
+            }
+            b = step6(b) - 49 + x;
+        }
+        if (a > 18) {
+            // step 1751
+            a = step9(b) - 83;
+            if (a < 79) {
+                if (y > 68) {
+                    // step 1755
+                    b = 18 + 61;
+                }
+            }
+        } else {
+            step6(a);
+            x = a - 56;
+        }
+    } else {
+        step16(x, x);
+        x = y;
+        for (int i2 = 0; i2 < 14; i2++) {
+            for (int i3 = 0; i3 < 78; i3++) {
+                if (y < 62) {
+                    // step 1769
+                    a = y;
+                    i2 = b - 87;
+                } else {
+                    // step 1773
+                    b = 96 - a + x;
+                    // step 1775
+                    i2 = x * a + 19;
+                    // step 1777
+                    b = 57;
+                }
+            }
+            x = 56 + 30 - step13(y, y);
+            y = 65;
+        }
+    }
+    for (int i1 = 0; i1 < 91; i1++) {
+        if (i1 < 95) {
+            if (b > 11) {
+                x = 73 * b + b;
+                if (b < 78) {
+                    i1 = 1;
+                    // step 1791
+                    x = 85;
+                } else {
+                    // step 1794
+                    x = i1;
+                    // step 1796
+                    b = step4(b, a) + x - 7;
+                    // step 1798
+                    a = i1 * step3(x);
+                }
+                if (i1 == 31) {
+                    step14(y, x);
+                    // step 1803
+                    b = y + step6(a) * 29;
+                }
+            } else {
+                for (int i4 = 0; i4 < 93; i4++) {
+                    step4(i4, i4);
+                }
+            }
+            if (a == 90) {
+                x = 24 + x;
+            } else {
+                for (int i4 = 0; i4 < 48; i4++) {
+                    // step 1815
+                    x = y;
+                }
+                for (int i4 = 0; i4 < 19; i4++) {
+                    step8(i1, b);
+                }
+            }
+            for (int i3 = 0; i3 < 2; i3++) {
+                a = step10(i3, b) - step6(i1) * 63;
+                for (int i4 = 0; i4 < 68; i4++) {
+                    b = i3 + step6(i1) - b;
+                    // step 1826
+                    b = step12(a) * b + i3;
+                }
+                if (y > 97) {
+                    // step 1830
+                    a = x + y * 32;
+                    // step 1832
+                    a = 92 - step4(y, b) + 58;
+                }
+            }
+        } else {
+            if (b < 56) {
+                if (a < 67) {
+                    i1 = i1 - 39;
+                }
+                i1 = 82;
+            } else {
+                // step 1843
+                x = 83;
+                for (int i4 = 0; i4 < 93; i4++) {
+                    // step 1846
+                    x = 18 - 56;
+                }
+                i1 = b - a;
+            }
+            if (x == 41) {
+                y = a + x - i1;
+            } else {
+                if (a == 39) {
+                    step7(a, a);
+                }
+            }
+            step14(x, a);
+            if (b > 2) {
+                for (int i4 = 0; i4 < 98; i4++) {
+                    step15(b);
+                    step1(y, b);
+                    // step 1863
+                    x = b * 42;
+                }
+            } else {
+                y = i1;
+                x = y - y + a;
+                x = step4(b, y) * step3(a) + 4;
+            }
+        }
+        if (i1 == 22) {
+            if (x == 92) {
+                step12(a);
+            }
+            if (y == 6) {
+                b = b - x;
+                step0(b);
+            } else {
+                step8(b, i1);
+                if (b < 19) {
+                    // step 1882
+                    a = i1 * y;
+                }
+                for (int i4 = 0; i4 < 43; i4++) {
+                    // step 1886
+                    x = 41 * b - x;
+                    step11(b, a);
+                    // step 1889
+                    x = 90;
+                }
+            }
+            a = step15(x) * b;
+        }
+    }
+    if (y == 78) {
+        step5(y, y);
+        step10(y, y);
+        if (y == 62) {
+            b = x;
+            if (b > 5) {
+                if (b < 66) {
+                    // step 1903
+                    y = step7(x, x) - a + b;
+                    // step 1905
+                    a = step6(x) - 96;
+                }
+            }
+            a = x - y - b;
+            if (b == 89) {
+                y = 47 + x * 63;
+            } else {
+                step13(x, b);
+                if (a > 96) {
+                    // step 1915
+                    b = a * b + 77;
+                } else {
+                    x = 24 + x;
+                }
+                x = x - 76 - a;
+            }
+        } else {
+            if (y < 76) {
+                for (int i4 = 0; i4 < 63; i4++) {
+                    // step 1925
+                    i4 = y;
+                }
+            }
+            x = 56 - 97;
+            step15(a);
+        }
+        if (y == 14) {
+            for (int i3 = 0; i3 < 51; i3++) {
+                for (int i4 = 0; i4 < 9; i4++) {
+                    // step 1935
+                    i3 = step6(a) + 2 + y;
+                    // step 1937
+                    b = i4 * 82;
+                }
+                if (y > 16) {
+                    // step 1941
+                    a = 38;
+                    step15(i3);
+                    // step 1944
+                    a = a * y - a;
+                } else {
+                    i3 = b + 87 + 17;
+                }
+                i3 = 59 + a * x;
+            }
+            step2(a, y);
+            step3(x);
+        } else {
+            if (a == 2) {
+                step3(x);
+            }
+            x = b - 7;
+            if (b > 39) {
+                step13(a, a);
+            } else {
+                step1(x, x);
+                for (int i4 = 0; i4 < 88; i4++) {
+                    // step 1963
+                    x = x - 80 - 94;
+                    // step 1965
+                    x = b + y - 60;
+                }
+                // step 1968
+                y = a;
+            }
+            // step 1971
+            x = y;
+        }
+    } else {
+        if (a == 71) {
+            a = x;
+            if (b < 1) {
+                for (int i4 = 0; i4 < 9; i4++) {
+                    // step 1979
+                    b = y + i4;
+                }
+                // step 1982
+                a = step13(b, a);
+            }
+            if (b > 10) {
+                for (int i4 = 0; i4 < 88; i4++) {
+                    // step 1987
+                    i4 = i4 * 23;
+                    // step 1989
+                    i4 = a;
+                    // step 1991
+                    y = 6 - 55;
+                }
+            } else {
+                if (b < 44) {
+                    x = b * x * y;
+                }
+            }
+            if (b > 28) {
+                step13(y, a);
+            }
+        }
+    }
+    return step3(b) * y - 94;
+}
+
+// step18: generated
+int step18(int a) {
+    int x = a + 39 * a;
+    int y = 33;
+    // step 2011
+    x = a;
+    for (int i1 = 0; i1 < 89; i1++) {
+        if (i1 > 67) {
+            step2(x, y);
+            y = x - a * 49;
+            step6(x);
+            for (int i3 = 0; i3 < 16; i3++) {
+                y = step1(x, i3) * step15(a) - 50;
+                if (x > 72) {
+                    i1 = step13(x, i3) - x * i3;
+                } else {
+                    y = 73 * x - a;
+                }
+                for (int i4 = 0; i4 < 30; i4++) {
+                    // step 2026
+                    i3 = step3(i3) - 74 * 65;
+                }
+            }
+        } else {
+            step13(a, x);
+        }
+    }
+    if (x == 71) {
+        for (int i2 = 0; i2 < 34; i2++) {
+            if (i2 < 74) {
+                // step 2037
+                y = a + x;
+                step0(a);
+                y = 49 * step0(y) - x;
+            }
+            if (i2 == 77) {
+                if (x == 47) {
+                    i2 = y + 59;
+                    y = step11(y, a);
+                } else {
+                    // step 2047
+                    x = 12;
+                    // step 2049
+                    y = x * 47;
+                    step2(x, y);
+                }
+                if (a > 17) {
+                    // step 2054
+                    i2 = a * x;
+                    // step 2056
+                    a = x * i2 + 47;
+                }
+            }
+            if (i2 == 11) {
+                // step 2061
+                a = 95 - i2 * a;
+            }
+            a = 18;
+        }
+        a = step12(a) + 40 * y;
+        x = y;
+        for (int i2 = 0; i2 < 39; i2++) {
+            if (y < 60) {
+                i2 = step12(x) * 36;
+                // step 2071
+                a = x;
+            } else {
+                x = a + 29;
+            }
+            for (int i3 = 0; i3 < 11; i3++) {
+                if (i2 < 68) {
+                    y = x;
+                    // step 2079
+                    i3 = 10 - step5(a, y) - i2;
+                    step15(i3);
+                }
+                if (a > 90) {
+                    // step 2084
+                    i2 = step14(i3, a);
+                    // step 2086
+                    i3 = a + 87 - 8;
+                }
+            }
+            for (int i3 = 0; i3 < 0; i3++) {
+                if (i2 == 23) {
+                    // step 2092
+                    a = 15 - 30;
+                }
+                i3 = i2 - 45;
+                y = 56;
+            }
+        }
+    } else {
+        step6(x);
+        y = 18;
+        step6(a);
+    }
+    step7(x, x);
+    if (y == 18) {
+        y = step2(x, a) - a * 33;
+        if (x < 97) {
+            for (int i3 = 0; i3 < 24; i3++) {
+                a = y * a;
+                step9(i3);
+            }
+            y = x + 60 - a;
+            step16(a, x);
+        } else {
+            // step 2115
+            a = y * 11;
+            y = x + 25 + 37;
+            step0(x);
+            if (x > 62) {
+                if (a == 67) {
+                    step7(y, y);
+                }
+                for (int i4 = 0; i4 < 38; i4++) {
+                    // step 2124
+                    i4 = y - 49 - a;
+                }
+                x = 42;
+            }
+        }
+        if (a == 34) {
+            y = step7(y, x);
+            x = x * a;
+            for (int i3 = 0; i3 < 35; i3++) {
+                step7(y, y);
+                if (a > 91) {
+                    x = a;
+                    // step 2137
+                    i3 = i3 + 55;
+                }
+                step3(x);
+            }
+        }
+    } else {
+        step1(y, x);
+    }
+    return x - step12(a);
+}
+
+// step19: generated
+int step19(int a, int b) {
+    int x = a;
+    int y = 9;
+    b = y * x;
+    a = 66 - 71;
+    y = b - a - step11(a, b);
+    for (int i1 = 0; i1 < 15; i1++) {
+        b = b - step2(x, i1) - y;
+        a = 14 + x;
+        if (i1 < 92) {
+            step11(i1, i1);
+            a = 48;
+        }
+    }
+    b = b;
+    if (x == 93) {
+        if (b < 29) {
+            // step 2167
+            x = a;
+        }
+    } else {
+        // step 2171
+        x = step4(a, x) - b;
+        // step 2173
+        x = x - step12(y);
+        a = 34 * 70 - 66;
+        // step 2176
+        b = 35 * step10(x, a);
+    }
+    b = 22 + 52;
+    // step 2180
+    x = y * 27 + b;
+    return step16(x, a) + 51 - y;
+}
+
+// step20: generated
+int step20(int a, int b) {
+    int x = b;
+    int y = 28;
+    // step 2189
+    b = 12 - b * x;
+    step6(b);
+    y = 93 + 33;
+    return step14(x, a) * 22;
+}
+
+// step21: generated
+int step21(int a) {
+    int x = a + 73 - a;
+    int y = 92;
+    y = 57;
+    x = 82;
+    if (x == 75) {
+        if (x < 17) {
+            step12(x);
+        } else {
+            a = 85;
+            if (x > 71) {
+                y = 97 + 24;
+            } else {
+                step1(y, y);
+            }
+            for (int i3 = 0; i3 < 10; i3++) {
+                x = step9(a);
+            }
+        }
+        for (int i2 = 0; i2 < 76; i2++) {
+            for (int i3 = 0; i3 < 54; i3++) {
+                i3 = i3;
+            }
+            if (a < 53) {
+                // step 2221
+                x = 9;
+            } else {
+                for (int i4 = 0; i4 < 49; i4++) {
+                    // step 2225
+                    a = a * 70;
+                }
+            }
+        }
+    } else {
+        if (y == 92) {
+            step11(x, a);
+            step5(a, a);
+            y = 21;
+            y = x * step15(x);
+        } else {
+            y = a - 82 - 24;
+            step20(x, y);
+            // step 2239
+            x = y;
+        }
+        for (int i2 = 0; i2 < 69; i2++) {
+            if (a < 3) {
+                // step 2244
+                y = step14(i2, i2) * 5 * 30;
+                step6(a);
+                y = 7 * step11(y, i2) + i2;
+            } else {
+                y = 63 * x * y;
+            }
+            if (i2 == 58) {
+                if (x > 16) {
+                    // step 2253
+                    a = step17(y, y);
+                } else {
+                    // step 2256
+                    a = y;
+                }
+            }
+        }
+        // step 2261
+        x = y - step13(x, x);
+        // step 2263
+        y = a - 54;
+    }
+    if (y > 59) {
+        for (int i2 = 0; i2 < 96; i2++) {
+            if (i2 < 98) {
+                for (int i4 = 0; i4 < 60; i4++) {
+                    // step 2270
+                    x = i2 - y;
+                }
+                if (i2 > 30) {
+                    // step 2274
+                    i2 = x - step7(x, i2) * x;
+                    step9(a);
+                }
+                y = y * 54 * step3(a);
+            }
+            y = step6(x) * step7(a, y) + 20;
+            i2 = step0(x) + a * a;
+        }
+        if (a > 11) {
+            y = x - a - step11(a, a);
+            a = 99;
+            x = 52 - a * x;
+        }
+        for (int i2 = 0; i2 < 37; i2++) {
+            for (int i3 = 0; i3 < 5; i3++) {
+                for (int i4 = 0; i4 < 27; i4++) {
+                    a = 23 * a;
+                    i4 = i2 * 42 + 71;
+                }
+                step12(x);
+                a = y - 24;
+            }
+        }
+        if (y > 51) {
+            // step 2299
+            a = x;
+        } else {
+            step13(y, a);
+        }
+    }
+    step1(x, a);
+    x = 26 - y * x;
+    // step 2307
+    x = 10 - a * y;
+    // step 2309
+    x = 52 + a * a;
+    return 44;
+}
+
+// step22: generated
+int step22(int a, int b) {
+    int x = b - a;
+    int y = 41;
+    if (b < 12) {
+        if (a == 54) {
+            // step 2320
+            b = 68 - 77;
+            step1(y, a);
+            step7(b, b);
+            if (b > 69) {
+                a = 40 * 82;
+            }
+        } else {
+            y = 56 - b;
+        }
+    } else {
+        if (b == 78) {
+            if (a == 56) {
+                step20(b, x);
+                if (y > 97) {
+                    step15(x);
+                    // step 2336
+                    b = step20(x, a) + 3 + 32;
+                    // step 2338
+                    b = a;
+                }
+            }
+        } else {
+            for (int i3 = 0; i3 < 12; i3++) {
+                // step 2344
+                x = 25;
+            }
+            if (a == 14) {
+                if (a == 36) {
+                    step11(x, y);
+                    // step 2350
+                    x = a * x;
+                }
+                b = step10(x, a);
+                step16(y, a);
+            }
+            a = y + 25 + y;
+            step5(x, b);
+        }
+    }
+    step19(a, a);
+    a = x + 46 - step20(a, x);
+    step11(a, x);
+    return x - b - y;
+}
+
+// step23: generated
+int step23(int a, int b) {
+    int x = b + b;
+    int y = 6;
+    x = a - x * a;
+    // step 2371
+    a = step1(y, b);
+    x = b + a;
+    a = y + 21 * x;
+    step5(b, y);
+    return a;
+}
+
+// step24: generated
+int step24(int a) {
+    int x = 95;
+    int y = 30;
+    for (int i1 = 0; i1 < 26; i1++) {
+        step1(x, i1);
+        if (a > 70) {
+            step7(i1, i1);
+        }
+    }
+    a = y + a - x;
+    y = step12(y) * 32 + step20(a, x);
+    if (x == 37) {
+        if (a == 58) {
+            a = step1(a, x) + a - 97;
+            if (a > 48) {
+                step9(x);
+                if (a > 28) {
+                    // step 2397
+                    x = y * a + 25;
+                } else {
+                    x = a + x;
+                }
+                for (int i4 = 0; i4 < 96; i4++) {
+                    y = x * step2(a, x);
+                }
+            } else {
+                if (y > 46) {
+                    // step 2407
+                    x = a - y;
+                } else {
+                    step19(a, a);
+                }
+            }
+            step2(a, a);
+            step23(a, y);
+        }
+        for (int i2 = 0; i2 < 35; i2++) {
+            // step 2417
+            y = x;
+            i2 = 79 * 54;
+            if (i2 == 76) {
+                for (int i4 = 0; i4 < 98; i4++) {
+                    a = a;
+                }
+            } else {
+                for (int i4 = 0; i4 < 61; i4++) {
+                    step18(y);
+                    // step 2427
+                    x = i4 * 87 * step14(y, a);
+                }
+                for (int i4 = 0; i4 < 93; i4++) {
+                    // step 2431
+                    i4 = step17(i2, i2);
+                }
+            }
+            for (int i3 = 0; i3 < 59; i3++) {
+                // step 2436
+                y = a;
+            }
+        }
+    } else {
+        a = y;
+        a = step9(x);
+        if (a == 70) {
+            y = 16;
+            if (x > 46) {
+                step10(x, y);
+                if (y == 47) {
+                    // step 2448
+                    a = a * x - 49;
+                    a = 13 - 76;
+                    y = 22;
+                }
+            }
+            x = 52 - 17 - y;
+            // step 2455
+            y = 84;
+        } else {
+            if (x == 96) {
+                y = step21(y);
+                step7(y, y);
+            } else {
+                y = 97 * x - a;
+            }
+            x = y - step2(x, y);
+            for (int i3 = 0; i3 < 79; i3++) {
+                x = x + step19(a, i3);
+            }
+        }
+        for (int i2 = 0; i2 < 6; i2++) {
+            i2 = 16 * x * x;
+            if (x == 35) {
+                y = 86 - y + 89;
+            } else {
+                for (int i4 = 0; i4 < 51; i4++) {
+                    a = step22(x, a) - 73;
+                }
+                if (y < 71) {
+                    // step 2478
+                    i2 = y * a;
+                    step5(a, a);
+                }
+                if (y < 69) {
+                    step12(a);
+                    a = 60 - 49;
+                    x = x * step1(x, i2);
+                }
+            }
+            if (x > 84) {
+                // step 2489
+                i2 = 58;
+            } else {
+                for (int i4 = 0; i4 < 29; i4++) {
+                    // step 2493
+                    y = x;
+                }
+                step1(i2, a);
+            }
+            step12(i2);
+        }
+    }
+    // step 2501
+    x = 27 + x;
+    step14(x, x);
+    step20(a, y);
+    return a - 99 * y;
+}
+
+// step25: generated
+int step25(int a, int b) {
+    int x = b - a + a;
+    int y = 44;
+    a = y * step8(y, y) * y;
+    b = y * y * y;
+    if (a < 17) {
+        if (y < 71) {
+            if (a < 75) {
+                for (int i4 = 0; i4 < 42; i4++) {
+                    // step 2518
+                    x = x * y * step6(i4);
+                }
+            } else {
+                y = 32 * step11(y, y);
+                x = y - step18(b);
+            }
+            y = step0(y) + b;
+            for (int i3 = 0; i3 < 41; i3++) {
+                // step 2527
+                y = 54 + i3 + 6;
+            }
+        }
+    }
+    a = 16;
+    if (b < 38) {
+        // step 2534
+        y = b + a * a;
+        if (x == 43) {
+            step8(y, a);
+            a = 75 * y;
+            x = a * 69;
+        } else {
+            for (int i3 = 0; i3 < 86; i3++) {
+                if (y < 18) {
+                    // step 2543
+                    x = 97;
+                }
+                for (int i4 = 0; i4 < 8; i4++) {
+                    // step 2547
+                    x = 93 + 38;
+                }
+            }
+            // step 2551
+            y = y + 13 * x;
+            if (x < 28) {
+                a = step12(y) * 48 + 19;
+            } else {
+                if (y == 34) {
+                    a = 76 * step24(b) - x;
+                    step1(y, x);
+                    x = x - 94 - 11;
+                } else {
+                    // step 2561
+                    x = a * b;
+                    // step 2563
+                    b = b * b;
+                    x = y;
+                }
+                if (x == 21) {
+                    x = 19 - step22(b, a) + step5(b, y);
+                } else {
+                    a = step22(b, y) + 14;
+                }
+            }
+            for (int i3 = 0; i3 < 4; i3++) {
+                step4(a, b);
+                step1(y, a);
+                y = 93;
+            }
+        }
+    }
+    x = 18 - 81;
+    // step 2581
+    x = 98 - 70;
+    return 40 * step23(a, b) + y;
+}
+
+// step26: generated
+int step26(int a, int b) {
+    int x = a;
+    int y = 38;
+    y = 60 + step14(a, y);
+    if (y > 27) {
+        step9(a);
+    } else {
+        if (y == 73) {
+            a = step15(b) - 35;
+        }
+        if (b == 18) {
+            if (y < 53) {
+                for (int i4 = 0; i4 < 3; i4++) {
+                    b = 25;
+                }
+            } else {
+                step14(x, b);
+                if (b > 97) {
+                    // step 2605
+                    y = step8(x, b) + 80;
+                    // step 2607
+                    b = 12 + 41 - a;
+                    a = step24(a) - y;
+                } else {
+                    b = 34 - x - 33;
+                }
+                y = x - 11;
+            }
+        } else {
+            a = y;
+            // step 2617
+            y = 60 - step12(b);
+            // step 2619
+            a = 84 - 88 + 98;
+        }
+        y = step3(b) - 52;
+    }
+    if (y > 99) {
+        if (x < 77) {
+            step18(a);
+            // step 2627
+            b = x - a;
+        } else {
+            if (y > 37) {
+                x = x + step14(x, a) * 7;
+            } else {
+                if (b < 0) {
+                    // step 2634
+                    x = b + step17(y, x) - a;
+                } else {
+                    // step 2637
+                    a = 15;
+                }
+                a = a;
+            }
+            for (int i3 = 0; i3 < 53; i3++) {
+                if (y > 69) {
+                    // step 2644
+                    y = i3 * b;
+                    y = 76 + 20 * y;
+                    a = 86;
+                }
+                for (int i4 = 0; i4 < 3; i4++) {
+                    // step 2650
+                    x = step20(y, a) * 68 * step15(x);
+                    y = 38 * 49;
+                    step19(x, b);
+                }
+                step16(b, x);
+            }
+            y = x;
+            // step 2658
+            b = y + 20;
+        }
+    } else {
+        for (int i2 = 0; i2 < 76; i2++) {
+            if (x == 99) {
+                if (y < 27) {
+                    y = 80 * 45;
+                    // step 2666
+                    x = i2 - 35;
+                } else {
+                    x = y;
+                }
+                step17(a, b);
+            } else {
+                // step 2673
+                i2 = 45;
+            }
+            x = y - step8(b, b);
+        }
+        // step 2678
+        a = y * 72;
+        y = x;
+        if (b == 14) {
+            step8(a, a);
+        } else {
+            for (int i3 = 0; i3 < 82; i3++) {
+                a = y;
+            }
+            a = y;
+        }
+    }
+    b = a + 52;
+    return 73;
+}
+
+// step27: generated
+int step27(int a) {
+    int x = 44 - a;
+    int y = 79;
+    a = x * y;
+    for (int i1 = 0; i1 < 95; i1++) {
+        // step 2700
+        y = 34;
+        i1 = step0(x) * i1;
+        a = x;
+    }
+    a = a;
+    x = 45 * x;
+    return step1(x, a) * y;
+}
+
+// step28: generated
+int step28(int a, int b) {
+    int x = a - 50 * b;
+    int y = 33;
+    y = 43 + 48;
+    if (y > 48) {
+        for (int i2 = 0; i2 < 79; i2++) {
+            step11(i2, i2);
+        }
+        // step 2719
+        x = 87 + 86;
+    }
+    step7(b, y);
+    // step 2723
+    a = b * step8(b, y);
+    step20(b, x);
+    b = 11 * b;
+    step20(a, b);
+    return step14(a, x);
+}
+
+// step29: generated
+int step29(int a, int b) {
+    int x = a;
+    int y = 7;
+    if (y > 4) {
+        // step 2736
+        a = 49 * 34;
+        if (y < 53) {
+            if (a < 78) {
+                // step 2740
+                y = x;
+                for (int i4 = 0; i4 < 77; i4++) {
+                    b = step6(b) - a - x;
+                    step5(a, a);
+                }
+                x = 87 + 55 * b;
+            } else {
+                a = 61 + 29 * 75;
+            }
+            if (a > 77) {
+                // step 2751
+                a = a + step14(a, x) * 24;
+            }
+            step6(y);
+        }
+        if (b < 39) {
+            y = y * b - 98;
+            x = y;
+            // step 2759
+            x = 36 * 7;
+            x = b + a - y;
+        }
+        y = x * a - a;
+    }
+    x = b;
+    if (a == 23) {
+        step17(a, y);
+        y = 63 - 50 * y;
+        b = 22 - step8(x, b);
+    } else {
+        if (a == 93) {
+            for (int i3 = 0; i3 < 55; i3++) {
+                step1(a, x);
+            }
+            if (y == 21) {
+                for (int i4 = 0; i4 < 34; i4++) {
+                    // step 2777
+                    b = b;
+                    step15(b);
+                }
+                if (b < 50) {
+                    // step 2782
+                    x = y * 28 + a;
+                    y = a + 32 * x;
+                    // step 2785
+                    y = x;
+                } else {
+                    // step 2788
+                    b = 91 - 1;
+                    step25(y, b);
+                    // step 2791
+                    a = step22(a, x);
+                }
+                if (a > 84) {
+                    // step 2795
+                    x = y * a;
+                }
+            }
+            if (b > 15) {
+                y = 10 + 0;
+                for (int i4 = 0; i4 < 45; i4++) {
+                    y = 24 * 30;
+                    b = i4 + b * 6;
+                    step10(a, a);
+                }
+            }
+        }
+        // step 2808
+        y = 23 + b * 97;
+        // step 2810
+        y = 94;
+        if (y < 32) {
+            for (int i3 = 0; i3 < 77; i3++) {
+                if (x == 47) {
+                    // step 2815
+                    b = 51 + b;
+                }
+                for (int i4 = 0; i4 < 0; i4++) {
+                    // step 2819
+                    a = i3 * 30 * 1;
+                }
+                if (b > 71) {
+                    // step 2823
+                    b = x * a * x;
+                } else {
+                    // step 2826
+                    i3 = step17(i3, y);
+                    // step 2828
+                    x = 53 + 69 + 57;
+                }
+            }
+            // step 2832
+            b = a + 89;
+        } else {
+            a = y - step7(x, x);
+            // step 2836
+            y = y * 69 + x;
+            a = 11;
+        }
+    }
+    return 70;
+}
+
+// step30: generated
+int step30(int a) {
+    int x = a;
+    int y = 3;
+    // step 2848
+    a = y - a;
+    if (a < 15) {
+        if (a > 76) {
+            a = 29;
+            if (y < 26) {
+                if (a > 35) {
+                    // step 2855
+                    y = 72 + step28(a, y) + step21(a);
+                    a = x;
+                }
+            }
+        }
+        if (y > 45) {
+            a = step29(y, a) + y;
+            // step 2863
+            y = y;
+        } else {
+            step4(x, y);
+            x = 84 * 8 * y;
+            // step 2868
+            x = x - 23;
+        }
+        if (y == 63) {
+            for (int i3 = 0; i3 < 6; i3++) {
+                x = 32;
+                for (int i4 = 0; i4 < 33; i4++) {
+                    // step 2875
+                    a = step7(y, y) * 71 - y;
+                }
+                for (int i4 = 0; i4 < 24; i4++) {
+                    // step 2879
+                    i3 = 87 + step15(i4) - 48;
+                    // step 2881
+                    i4 = x;
+                    step13(a, i4);
+                }
+            }
+            if (a > 60) {
+                for (int i4 = 0; i4 < 22; i4++) {
+                    step21(x);
+                    i4 = 50 - 83;
+                    // step 2890
+                    y = a - i4 - step6(i4);
+                }
+                x = x;
+            }
+        }
+    } else {
+        for (int i2 = 0; i2 < 29; i2++) {
+            a = 94 - a * 47;
+            // step 2899
+            y = 92 * 55;
+            step12(y);
+        }
+        // step 2903
+        a = 49 * 13;
+        if (a < 15) {
+            y = step19(x, x) - 86 - y;
+            for (int i3 = 0; i3 < 8; i3++) {
+                if (i3 == 63) {
+                    // step 2909
+                    i3 = 80 + a;
+                    i3 = 81 - y * 95;
+                }
+            }
+            x = step14(y, y) - a - a;
+        } else {
+            x = x - 73 + step20(a, y);
+            y = 32 + a;
+        }
+    }
+    step7(a, y);
+    if (y == 91) {
+        for (int i2 = 0; i2 < 13; i2++) {
+            for (int i3 = 0; i3 < 44; i3++) {
+                i2 = y - step0(i3) - step1(y, i2);
+                if (y == 29) {
+                    step20(i3, a);
+                    // step 2927
+                    a = x;
+                    // step 2929
+                    i2 = 7 * i3 + 85;
+                }
+                i2 = a;
+            }
+            for (int i3 = 0; i3 < 44; i3++) {
+                if (i3 == 36) {
+                    // step 2936
+                    a = a;
+                    y = i3;
+                    // step 2939
+                    y = y;
+                } else {
+                    step20(a, i3);
+                    // step 2943
+                    x = 61;
+                    // step 2945
+                    y = 27;
+                }
+            }
+        }
+        if (x < 91) {
+            y = y * 72;
+            step13(a, a);
+        }
+        y = x - 68;
+    } else {
+        if (x == 30) {
+            if (y > 40) {
+                a = 8 + y;
+            }
+            if (x < 48) {
+                if (y < 34) {
+                    x = 28 * y * 43;
+                    y = x * 60;
+                }
+                for (int i4 = 0; i4 < 94; i4++) {
+                    a = 26 - 0;
+                    a = 94 * x * y;
+                }
+            } else {
+                step12(x);
+                if (y > 35) {
+                    // step 2972
+                    y = y;
+                    x = y;
+                    // step 2975
+                    y = x;
+                }
+            }
+            step28(x, a);
+            if (y > 84) {
+                if (x < 39) {
+                    // step 2982
+                    a = 56 - x;
+                    // step 2984
+                    a = 18 + a + x;
+                } else {
+                    // step 2987
+                    y = step20(y, x);
+                }
+            }
+        }
+        for (int i2 = 0; i2 < 52; i2++) {
+            x = step18(a) * 10;
+            if (x < 64) {
+                // step 2995
+                a = step4(x, x);
+            } else {
+                for (int i4 = 0; i4 < 55; i4++) {
+                    i4 = 99 - 9;
+                }
+            }
+        }
+        // step 3003
+        a = x + 70 + step19(x, a);
+        a = 60 - 77;
+    }
+    if (x == 29) {
+        // step 3008
+        y = 22 * x;
+    } else {
+        x = a;
+        step20(a, y);
+        for (int i2 = 0; i2 < 63; i2++) {
+            step9(a);
+            for (int i3 = 0; i3 < 62; i3++) {
+                // step 3016
+                a = 63 + i3;
+                if (i2 < 87) {
+                    step9(x);
+                    // step 3020
+                    i2 = i3;
+                }
+                step15(x);
+            }
+        }
+        if (a < 54) {
+            step25(a, a);
+            a = 85;
+        }
+    }
+    // step 3031
+    x = 37 + x;
+    return step22(a, a) + 60 + a;
+}
+
+// step31: generated
+int step31(int a, int b) {
+    int x = b * b;
+    int y = 23;
+    x = 89;
+    if (y < 54) {
+        if (x == 72) {
+            x = x * 93 * a;
+        } else {
+            for (int i3 = 0; i3 < 33; i3++) {
+                if (b == 76) {
+                    step3(x);
+                } else {
+                    y = i3 + 30;
+                    // step 3050
+                    i3 = step6(a) * step26(b, y) - y;
+                    // step 3052
+                    b = step8(i3, y) * step13(a, x);
+                }
+                if (i3 == 76) {
+                    b = step13(y, i3) - 4 + 53;
+                    // step 3057
+                    a = 75 * x;
+                    // step 3059
+                    b = 95 - y;
+                }
+            }
+            y = a;
+        }
+    } else {
+        for (int i2 = 0; i2 < 23; i2++) {
+            // step 3067
+            a = i2;
+            // step 3069
+            a = 71;
+        }
+        step30(y);
+    }
+    a = x + y;
+    step27(x);
+    return a + b;
+}
+
+// step32: generated
+int step32(int a, int b) {
+    int x = 75 + 41 + b;
+    int y = 14;
+    if (a > 35) {
+        // step 3084
+        b = 92 - 90 - b;
+        step26(x, y);
+    } else {
+        for (int i2 = 0; i2 < 71; i2++) {
+            if (a < 91) {
+                // step 3090
+                a = 78 + y - step12(y);
+            } else {
+                if (a > 97) {
+                    y = a * 82;
+                    i2 = 1 + 36 + b;
+                    // step 3096
+                    x = 47 + 0;
+                }
+            }
+            if (i2 > 4) {
+                if (i2 > 55) {
+                    x = x * 54 + a;
+                    a = 36;
+                    // step 3104
+                    a = b - step27(b);
+                }
+            } else {
+                a = x - b;
+            }
+            i2 = y * a;
+            i2 = 13 - b - y;
+        }
+        step12(b);
+        step1(x, x);
+    }
+    y = step0(a) + step0(a);
+    if (a > 19) {
+        step23(x, x);
+        for (int i2 = 0; i2 < 54; i2++) {
+            // step 3120
+            b = b;
+            x = a + x + b;
+        }
+        if (x < 73) {
+            // step 3125
+            b = x - step9(x);
+            a = b - x;
+            step31(x, y);
+        }
+    }
+    // step 3131
+    b = b * x + step8(b, y);
+    if (a == 51) {
+        step10(x, x);
+    }
+    x = x * 87 + 13;
+    return b + 9;
+}
+
+// step33: generated
+int step33(int a) {
+    int x = 68;
+    int y = 85;
+    if (y < 25) {
+        step2(a, y);
+        step10(x, x);
+        if (a == 85) {
+            for (int i3 = 0; i3 < 77; i3++) {
+                if (y < 40) {
+                    // step 3150
+                    x = i3 * a;
+                    i3 = i3 + 71 + x;
+                } else {
+                    // step 3154
+                    x = i3;
+                    // step 3156
+                    x = 75 - 14 - y;
+                }
+            }
+            for (int i3 = 0; i3 < 74; i3++) {
+                if (y < 70) {
+                    // step 3162
+                    i3 = step23(x, a) - step26(a, x);
+                } else {
+                    step25(a, i3);
+                    i3 = step8(x, a);
+                    i3 = y - x - step6(x);
+                }
+            }
+        }
+        for (int i2 = 0; i2 < 46; i2++) {
+            // step 3172
+            y = 39 - y + step26(y, x);
+        }
+    }
+    y = a;
+    for (int i1 = 0; i1 < 5; i1++) {
+        i1 = x;
+    }
+    y = a * y - 68;
+    step30(x);
+    return step15(y) * a * y;
+}
+
+// step34: generated
+int step34(int a, int b) {
+    int x = 5;
+    int y = 34;
+    for (int i1 = 0; i1 < 52; i1++) {
+        // step 3190
+        a = b * x * 7;
+        i1 = b * step6(i1);
+    }
+    for (int i1 = 0; i1 < 7; i1++) {
+        i1 = 3;
+    }
+    x = 15 * a * y;
+    x = step17(x, y);
+    for (int i1 = 0; i1 < 3; i1++) {
+        x = 68;
+        b = step19(i1, b);
+    }
+    return y - x;
+}
+
+// step35: generated
+int step35(int a, int b) {
+    int x = a;
+    int y = 47;
+    y = 4 * 75;
+    b = 50 + y;
+    step3(x);
+    if (b == 33) {
+        for (int i2 = 0; i2 < 75; i2++) {
+            x = i2 - i2 * b;
+        }
+        if (a > 18) {
+            b = 59 - step29(a, a);
+        }
+    } else {
+        if (b < 41) {
+            if (x == 59) {
+                if (y < 17) {
+                    step30(x);
+                } else {
+                    b = y + y;
+                    // step 3227
+                    b = 50 - 4 * x;
+                    // step 3229
+                    y = 85;
+                }
+            }
+            y = a;
+            x = step4(x, a);
+        } else {
+            if (a == 44) {
+                for (int i4 = 0; i4 < 56; i4++) {
+                    x = 25 * x + step14(a, y);
+                    // step 3239
+                    a = 20 * 97 - y;
+                    // step 3241
+                    i4 = 92 * step16(i4, x) + 79;
+                }
+                b = step27(y) + b - step6(y);
+                y = y * 83 * step9(a);
+            } else {
+                if (x == 5) {
+                    x = y;
+                }
+                step13(a, y);
+            }
+            if (b > 12) {
+                if (a > 35) {
+                    // step 3254
+                    x = a + x + b;
+                } else {
+                    a = x * step20(x, a);
+                    y = a * a;
+                }
+                step5(b, x);
+            }
+            step9(a);
+        }
+        if (y < 47) {
+            if (x < 18) {
+                for (int i4 = 0; i4 < 6; i4++) {
+                    i4 = step23(x, i4) - 4;
+                    // step 3268
+                    i4 = x + i4 * y;
+                    // step 3270
+                    i4 = 6;
+                }
+            } else {
+                if (x < 41) {
+                    // step 3275
+                    x = 5 + step29(b, b);
+                }
+                step5(b, a);
+            }
+            y = step13(b, x) + x;
+        }
+    }
+    // step 3283
+    a = b;
+    // step 3285
+    b = b * 19 - y;
+    if (a == 14) {
+        b = 10 + step4(b, a) - a;
+        b = step34(x, y) - 70 + b;
+        step11(x, y);
+        step32(b, a);
+    } else {
+        for (int i2 = 0; i2 < 61; i2++) {
+            step6(x);
+        }
+    }
+    return b;
+}
+
+// step36: generated
+int step36(int a) {
+    int x = 25 * a;
+    int y = 53;
+    if (x < 19) {
+        if (x < 94) {
+            a = y;
+            if (x == 48) {
+                a = y - 39 + step18(y);
+                if (y == 82) {
+                    // step 3310
+                    y = 62 - a;
+                }
+                // step 3313
+                x = 23;
+            }
+            for (int i3 = 0; i3 < 84; i3++) {
+                if (x < 62) {
+                    // step 3318
+                    y = x - 47;
+                    step33(a);
+                    // step 3321
+                    x = i3 * 62 * x;
+                } else {
+                    x = 80;
+                }
+                // step 3326
+                x = y - i3;
+            }
+        } else {
+            if (a < 88) {
+                step11(y, x);
+            }
+            for (int i3 = 0; i3 < 0; i3++) {
+                step15(a);
+                for (int i4 = 0; i4 < 70; i4++) {
+                    // step 3336
+                    i4 = step10(y, i4) * step7(i3, i4);
+                    // step 3338
+                    x = a + 20 * 19;
+                    // step 3340
+                    i4 = i3 * step30(x) - i4;
+                }
+            }
+        }
+        step4(y, y);
+    }
+    if (a > 13) {
+        if (y < 47) {
+            // step 3349
+            y = 69;
+        }
+        if (y == 98) {
+            for (int i3 = 0; i3 < 74; i3++) {
+                if (x < 14) {
+                    i3 = a - x;
+                    step1(i3, y);
+                    // step 3357
+                    y = step19(y, x);
+                } else {
+                    // step 3360
+                    i3 = 95 * 38 - 32;
+                }
+            }
+            step0(y);
+        } else {
+            if (x > 88) {
+                y = y;
+                if (a > 28) {
+                    // step 3369
+                    a = 36 * step12(x);
+                } else {
+                    y = 45;
+                }
+            }
+            // step 3375
+            x = x - 38;
+            step8(x, x);
+            y = 98 * a * a;
+        }
+        for (int i2 = 0; i2 < 21; i2++) {
+            for (int i3 = 0; i3 < 10; i3++) {
+                if (a == 93) {
+                    step8(a, i3);
+                    // step 3384
+                    x = step11(y, i3);
+                    // step 3386
+                    i3 = y + i2;
+                } else {
+                    // step 3389
+                    a = i3 - y;
+                    // step 3391
+                    y = y * i3;
+                    y = 20;
+                }
+                if (a == 28) {
+                    // step 3396
+                    a = y * i3 * 21;
+                } else {
+                    a = step23(i3, x) * 96 + 20;
+                    step26(a, y);
+                }
+            }
+        }
+    }
+    step35(x, y);
+    a = 77;
+    step0(x);
+    x = y;
+    return x * a - 40;
+}
+
+// step37: generated
+int step37(int a, int b) {
+    int x = b;
+    int y = 65;
+    if (a < 3) {
+        x = step0(a);
+        for (int i2 = 0; i2 < 86; i2++) {
+            if (i2 > 65) {
+                if (a == 74) {
+                    // step 3421
+                    a = b * x;
+                    // step 3423
+                    x = b - x;
+                    // step 3425
+                    b = 33 * step2(y, a) + y;
+                } else {
+                    b = i2 - 80;
+                    y = i2;
+                }
+                x = b - 13 * 47;
+            } else {
+                step7(i2, y);
+            }
+            for (int i3 = 0; i3 < 22; i3++) {
+                x = a - step13(x, i3);
+                if (y > 83) {
+                    // step 3438
+                    b = 49 * i2 + y;
+                    // step 3440
+                    y = step34(y, i2) * i3;
+                } else {
+                    step25(y, i2);
+                    // step 3444
+                    i2 = 0 - x * a;
+                    // step 3446
+                    x = x + step15(a);
+                }
+            }
+            if (a > 72) {
+                step6(b);
+                x = step16(x, a) * step7(y, b);
+            }
+        }
+        y = x + x;
+        if (b == 32) {
+            if (a == 2) {
+                // step 3458
+                b = y * a;
+            } else {
+                a = step22(a, x);
+            }
+            if (y > 98) {
+                // step 3464
+                x = 59 - y;
+            } else {
+                if (x == 39) {
+                    // step 3468
+                    a = step9(x);
+                    // step 3470
+                    y = step32(a, a) * b + 1;
+                    step19(b, x);
+                } else {
+                    y = x - x + y;
+                }
+            }
+            b = x;
+        }
+    }
+    if (b == 66) {
+        step1(x, x);
+        x = 76;
+        y = y - 37;
+    }
+    a = b;
+    a = x;
+    step26(y, b);
+    step12(b);
+    b = x - 62 * step14(x, a);
+    if (a < 62) {
+        // step 3491
+        x = x;
+        step16(a, y);
+        for (int i2 = 0; i2 < 1; i2++) {
+            // step 3495
+            y = i2 * x;
+        }
+        if (a < 65) {
+            y = x + b;
+            y = b * y + x;
+        } else {
+            step29(y, x);
+            if (b < 95) {
+                for (int i4 = 0; i4 < 45; i4++) {
+                    // step 3505
+                    a = x - y;
+                    // step 3507
+                    a = x + 64 + y;
+                }
+            } else {
+                if (b == 50) {
+                    x = 95;
+                }
+            }
+        }
+    }
+    return x + 8;
+}
+
+// step38: generated
+int step38(int a, int b) {
+    int x = a + 49;
+    int y = 88;
+    if (a < 77) {
+        // step 3525
+        x = 71 + step20(y, x) + 25;
+        if (a == 17) {
+            for (int i3 = 0; i3 < 23; i3++) {
+                b = x + 88;
+            }
+            // step 3531
+            x = step36(x) + b;
+        }
+        if (b < 83) {
+            b = b * x;
+            if (b > 50) {
+                if (y > 13) {
+                    // step 3538
+                    y = x;
+                    // step 3540
+                    x = y * step0(x) + x;
+                } else {
+                    step23(y, b);
+                }
+            }
+            a = 34 * b;
+        }
+        if (a < 13) {
+            step24(x);
+            if (b == 36) {
+                for (int i4 = 0; i4 < 72; i4++) {
+                    // step 3552
+                    b = 43 * a;
+                }
+            } else {
+                y = step28(a, a) * a + x;
+                if (x == 28) {
+                    // step 3558
+                    y = b - x;
+                } else {
+                    // step 3561
+                    x = 79 - step19(b, b);
+                }
+                if (a < 11) {
+                    // step 3565
+                    x = a;
+                    // step 3567
+                    b = step11(b, b);
+                } else {
+                    x = step4(b, x) * y + 30;
+                    // step 3571
+                    y = step14(x, y) + x + b;
+                    y = 22 - b;
+                }
+            }
+        }
+    }
+    b = a + a;
+    step26(a, b);
+    if (y < 25) {
+        b = 57 + x + a;
+        if (y > 84) {
+            for (int i3 = 0; i3 < 72; i3++) {
+                if (x == 2) {
+                    a = y - step35(y, b);
+                }
+                // step 3587
+                a = x;
+            }
+            if (b < 20) {
+                x = y;
+                for (int i4 = 0; i4 < 39; i4++) {
+                    // step 3593
+                    a = step34(i4, b);
+                }
+            } else {
+                y = y;
+                if (x == 71) {
+                    // step 3599
+                    x = x - 39 + step36(a);
+                    step11(y, y);
+                }
+            }
+            if (a > 52) {
+                if (a > 22) {
+                    y = b * 76 + x;
+                    // step 3607
+                    x = a * 36 + 28;
+                } else {
+                    // step 3610
+                    x = x + b * step27(b);
+                }
+            }
+            if (x > 10) {
+                b = a;
+                for (int i4 = 0; i4 < 35; i4++) {
+                    // step 3617
+                    a = a * b + 97;
+                    // step 3619
+                    x = b - 54;
+                }
+                step3(y);
+            } else {
+                for (int i4 = 0; i4 < 5; i4++) {
+                    y = 46 * 72;
+                }
+                b = x + 59;
+            }
+        } else {
+            if (b > 1) {
+                y = 51;
+                if (b < 62) {
+                    step7(b, a);
+                } else {
+                    // step 3635
+                    x = step1(x, a);
+                    b = 30;
+                    // step 3638
+                    x = y * y + x;
+                }
+            }
+            if (y < 25) {
+                step0(b);
+            }
+            if (a > 0) {
+                y = 20;
+                if (x > 38) {
+                    // step 3648
+                    y = x * b;
+                    // step 3650
+                    b = 80 + a + a;
+                    step2(x, y);
+                } else {
+                    // step 3654
+                    x = step23(x, a) - a * 42;
+                }
+                x = x * step23(x, y) * y;
+            } else {
+                if (x == 80) {
+                    a = y;
+                    step20(a, b);
+                } else {
+                    step5(b, b);
+                }
+            }
+            if (y == 11) {
+                // step 3667
+                y = 78 + 33;
+                a = b;
+                for (int i4 = 0; i4 < 97; i4++) {
+                    // step 3671
+                    b = step23(b, y) - 10;
+                }
+            } else {
+                step0(y);
+            }
+        }
+        // step 3678
+        y = a;
+    }
+    step19(b, b);
+    for (int i1 = 0; i1 < 73; i1++) {
+        for (int i2 = 0; i2 < 25; i2++) {
+            x = 36 + a + 34;
+            if (i1 < 19) {
+                step31(y, i1);
+            } else {
+                b = step3(i1) * y;
+                step15(y);
+                step14(a, x);
+            }
+            // step 3692
+            y = i1;
+        }
+        step28(x, y);
+        if (b > 18) {
+            // step 3697
+            x = step29(x, x) * a + a;
+            step33(y);
+        }
+    }
+    step23(x, y);
+    return y * y;
+}
+
+// step39: generated
+int step39(int a) {
+    int x = a;
+    int y = 48;
+    if (a > 63) {
+        // step 3711
+        x = a * a - 25;
+    }
+    if (x == 11) {
+        for (int i2 = 0; i2 < 61; i2++) {
+            x = 51 - 55;
+            step29(i2, a);
+            y = x - 89 + x;
+            step37(y, y);
+        }
+        if (x < 61) {
+            for (int i3 = 0; i3 < 81; i3++) {
+                for (int i4 = 0; i4 < 22; i4++) {
+                    y = a * x + i4;
+                    step13(i4, i4);
+                }
+                y = 90 + i3;
+                a = y + step6(y) + i3;
+            }
+            x = 17 * 25 + x;
+        } else {
+            step19(x, y);
+            for (int i3 = 0; i3 < 79; i3++) {
+                for (int i4 = 0; i4 < 85; i4++) {
+                    // step 3735
+                    a = y - step33(y);
+                    // step 3737
+                    x = step5(i3, y) - step30(i3);
+                    // step 3739
+                    i3 = 9 - i4 - i4;
+                }
+                for (int i4 = 0; i4 < 3; i4++) {
+                    i3 = step32(a, i4) * 68;
+                    // step 3744
+                    i3 = 91 + 11 - step29(a, a);
+                    // step 3746
+                    a = i3 * i3 * y;
+                }
+            }
+            y = 18 * 37 - 63;
+            // step 3751
+            a = 47 - step28(y, y) + a;
+        }
+        if (a > 47) {
+            // step 3755
+            y = 24 - step18(a);
+            for (int i3 = 0; i3 < 66; i3++) {
+                // step 3758
+                a = i3 - x - 9;
+            }
+            a = y + 63 + x;
+            if (a > 37) {
+                // step 3763
+                y = 32 * step0(x);
+                if (x > 38) {
+                    // step 3766
+                    a = 64 - 56 * x;
+                } else {
+                    a = a * a;
+                    // step 3770
+                    y = 14 + a - 89;
+                }
+            }
+        } else {
+            x = step9(y) - step18(x) + 83;
+            step3(y);
+            a = y;
+        }
+        if (a < 34) {
+            if (a < 71) {
+                y = a * 50 + step22(y, x);
+                if (x < 3) {
+                    step26(y, y);
+                    a = y * x;
+                    // step 3785
+                    a = x;
+                }
+                x = y - step28(x, x);
+            }
+            for (int i3 = 0; i3 < 20; i3++) {
+                step37(i3, a);
+                if (i3 == 2) {
+                    // step 3793
+                    i3 = step37(x, a) + 40;
+                }
+            }
+            step37(y, x);
+        } else {
+            x = y;
+            for (int i3 = 0; i3 < 41; i3++) {
+                for (int i4 = 0; i4 < 9; i4++) {
+                    x = 78;
+                    x = i4 * 94 - i3;
+                }
+            }
+        }
+    }
+    if (y > 45) {
+        y = step33(a);
+    } else {
+        // step 3811
+        x = a - y;
+    }
+    if (a < 57) {
+        a = y - 38 + a;
+    }
+    if (a > 28) {
+        step23(y, a);
+        if (x == 55) {
+            if (y == 10) {
+                if (a < 2) {
+                    y = 66;
+                    // step 3823
+                    x = step37(a, a) + y;
+                }
+                y = 79;
+                // step 3827
+                y = x - a;
+            } else {
+                if (y == 83) {
+                    // step 3831
+                    x = 31 * y;
+                    // step 3833
+                    y = a;
+                    // step 3835
+                    a = step16(a, a) + 73;
+                }
+            }
+            // step 3839
+            a = x * a * 94;
+            step2(x, x);
+            if (y > 40) {
+                step19(y, x);
+                y = x * 96;
+            }
+        } else {
+            if (x < 79) {
+                x = step38(x, a) * 11;
+            }
+        }
+        if (y < 76) {
+            if (a > 52) {
+                a = x - 77 * 26;
+            } else {
+                step4(a, a);
+                y = x;
+            }
+        }
+    } else {
+        y = y - x;
+        step15(x);
+        x = step6(a);
+    }
+    return step1(x, y) - 94 * 33;
+}
+
+// step40: generated
+int step40(int a, int b) {
+    int x = a + a * b;
+    int y = 11;
+    if (b == 44) {
+        for (int i2 = 0; i2 < 5; i2++) {
+            if (a < 85) {
+                for (int i4 = 0; i4 < 36; i4++) {
+                    x = a - 44;
+                }
+            } else {
+                if (b > 71) {
+                    // step 3879
+                    x = 64 - 91 - 65;
+                    // step 3881
+                    x = b * b;
+                }
+                x = x - x - 93;
+            }
+            x = step15(i2) + step23(x, y);
+            x = 89 * a;
+        }
+        y = 47 - 47 - y;
+    }
+    for (int i1 = 0; i1 < 93; i1++) {
+        b = y;
+        y = b - a;
+        i1 = x * 20 - 96;
+        if (i1 > 89) {
+            for (int i3 = 0; i3 < 72; i3++) {
+                if (i3 < 24) {
+                    // step 3898
+                    a = 85 + 44;
+                    // step 3900
+                    a = step13(i1, b) + b;
+                }
+                // step 3903
+                b = 91;
+            }
+            for (int i3 = 0; i3 < 56; i3++) {
+                step27(x);
+                if (b == 61) {
+                    b = step15(x) - a * b;
+                }
+                if (x == 67) {
+                    i3 = step28(i1, b);
+                    // step 3913
+                    x = x;
+                }
+            }
+            step38(a, x);
+        } else {
+            if (x > 96) {
+                step5(y, y);
+            } else {
+                for (int i4 = 0; i4 < 90; i4++) {
+                    // step 3923
+                    y = y * x;
+                }
+                // step 3926
+                y = 14 + b;
+            }
+            // step 3929
+            b = step7(y, b) * a;
+        }
+    }
+    x = x - step22(x, a);
+    // step 3934
+    b = y * 44 * 12;
+    for (int i1 = 0; i1 < 23; i1++) {
+        a = x + b;
+    }
+    return step11(a, a) - y * y;
+}
+
+// step41: generated
+int step41(int a, int b) {
+    int x = b;
+    int y = 63;
+    if (y < 48) {
+        for (int i2 = 0; i2 < 81; i2++) {
+            i2 = y;
+        }
+    } else {
+        // step 3951
+        x = a * x;
+        y = 0 + b * a;
+        y = 81 - a - step35(y, b);
+    }
+    for (int i1 = 0; i1 < 18; i1++) {
+        for (int i2 = 0; i2 < 13; i2++) {
+            // step 3958
+            i2 = step32(b, a);
+        }
+        if (y == 94) {
+            i1 = step14(y, i1) - step27(i1);
+            if (x < 30) {
+                if (a == 89) {
+                    // step 3965
+                    a = 83 + i1;
+                } else {
+                    // step 3968
+                    x = 91 - x - y;
+                }
+                b = 6 - i1;
+                y = 52;
+            }
+            step37(b, b);
+            for (int i3 = 0; i3 < 60; i3++) {
+                y = 94;
+                if (x > 41) {
+                    a = 42 + step23(y, i3) * 26;
+                    y = 8 + 70;
+                    x = y - i3;
+                }
+                if (x < 86) {
+                    // step 3983
+                    i3 = i3 * i3;
+                    step17(x, a);
+                }
+            }
+        }
+        if (x == 44) {
+            // step 3990
+            x = 76 - 35 + y;
+        } else {
+            step17(b, x);
+            for (int i3 = 0; i3 < 34; i3++) {
+                for (int i4 = 0; i4 < 76; i4++) {
+                    b = b + i1;
+                }
+                for (int i4 = 0; i4 < 10; i4++) {
+                    i3 = 18 * 6;
+                    y = b - i4;
+                }
+                step19(i3, x);
+            }
+            b = i1 * a;
+            step9(i1);
+        }
+    }
+    if (a > 33) {
+        for (int i2 = 0; i2 < 31; i2++) {
+            for (int i3 = 0; i3 < 74; i3++) {
+                if (b > 81) {
+                    // step 4012
+                    x = i3;
+                }
+            }
+        }
+        a = 10 * 51;
+        // step 4018
+        a = step16(y, b);
+        if (x == 18) {
+            for (int i3 = 0; i3 < 82; i3++) {
+                step17(x, i3);
+                x = 93 + y;
+            }
+            for (int i3 = 0; i3 < 73; i3++) {
+                x = 72 + y;
+            }
+            if (y < 6) {
+                for (int i4 = 0; i4 < 40; i4++) {
+                    // step 4030
+                    y = 99 + y;
+                }
+                step28(b, a);
+                for (int i4 = 0; i4 < 62; i4++) {
+                    // step 4035
+                    i4 = y;
+                    // step 4037
+                    a = 14;
+                }
+            }
+        }
+    }
+    b = a - b;
+    x = 61 + 72;
+    return b;
+}
+
+// step42: generated
+int step42(int a) {
+    int x = a * 89 - 10;
+    int y = 52;
+    step38(y, a);
+    if (a == 40) {
+        if (a == 16) {
+            if (y > 88) {
+                y = a - step8(y, a);
+                y = y;
+                if (a < 2) {
+                    y = x;
+                } else {
+                    y = 32 + y;
+                }
+            } else {
+                if (x > 67) {
+                    x = 79 + y;
+                    step33(x);
+                }
+                if (y < 3) {
+                    step38(y, x);
+                    // step 4070
+                    y = step11(y, x) + 96;
+                    x = a * y * y;
+                } else {
+                    // step 4074
+                    x = step40(a, y);
+                    // step 4076
+                    x = 37;
+                    x = 20;
+                }
+                x = a;
+            }
+            if (x < 46) {
+                if (y < 79) {
+                    // step 4084
+                    y = step26(y, a);
+                    // step 4086
+                    x = step41(x, x) + step22(x, y);
+                    step13(y, y);
+                } else {
+                    // step 4090
+                    a = x;
+                    // step 4092
+                    a = 14 - x;
+                    // step 4094
+                    a = 41 + x;
+                }
+            } else {
+                y = y * step7(y, x);
+            }
+            // step 4100
+            a = 25;
+        } else {
+            step20(x, y);
+            for (int i3 = 0; i3 < 37; i3++) {
+                if (a > 21) {
+                    // step 4106
+                    i3 = 37 * step20(a, x) - step29(i3, y);
+                } else {
+                    step18(y);
+                    // step 4110
+                    a = i3;
+                }
+            }
+            step25(y, x);
+            for (int i3 = 0; i3 < 19; i3++) {
+                for (int i4 = 0; i4 < 25; i4++) {
+                    // step 4117
+                    a = a + x;
+                    // step 4119
+                    x = i4 + 93 * 50;
+                }
+                step13(a, i3);
+                if (i3 > 79) {
+                    x = 87;
+                }
+            }
+        }
+        y = a * step25(a, x) + step38(x, x);
+        if (y > 66) {
+            if (a < 18) {
+                for (int i4 = 0; i4 < 65; i4++) {
+                    step15(x);
+                    // step 4133
+                    y = x + a;
+                }
+            } else {
+                for (int i4 = 0; i4 < 83; i4++) {
+                    // step 4138
+                    a = 12 - 42 + a;
+                }
+            }
+            if (y > 3) {
+                a = x;
+                // step 4144
+                x = x * 70;
+                if (x > 66) {
+                    y = 17 - 46;
+                    // step 4148
+                    y = a;
+                }
+            }
+            y = 81 + x;
+        } else {
+            // step 4154
+            x = 34 - a + 87;
+            if (a < 93) {
+                a = 89;
+                step30(a);
+            }
+            step18(y);
+            for (int i3 = 0; i3 < 64; i3++) {
+                step6(y);
+            }
+        }
+    } else {
+        if (x == 52) {
+            step1(y, y);
+            if (x < 48) {
+                y = a + 84 * 39;
+                step8(y, a);
+            }
+            if (a == 24) {
+                if (a == 37) {
+                    // step 4174
+                    y = y;
+                } else {
+                    // step 4177
+                    y = step15(y);
+                    a = 25 - x - x;
+                }
+            } else {
+                step39(a);
+                a = y;
+            }
+            step13(a, x);
+        } else {
+            y = y * 75 - 85;
+            a = y * a;
+            y = y + 70;
+        }
+        y = x;
+    }
+    if (x == 81) {
+        a = 9 - 65;
+        for (int i2 = 0; i2 < 67; i2++) {
+            a = i2 - x;
+            i2 = 22;
+            if (i2 == 79) {
+                if (y == 50) {
+                    // step 4200
+                    i2 = 77;
+                    // step 4202
+                    y = 53 * a;
+                    // step 4204
+                    i2 = i2 * a;
+                } else {
+                    // step 4207
+                    x = y - y;
+                }
+                step11(i2, i2);
+            } else {
+                y = 65 - i2 + 45;
+                if (y < 0) {
+                    step19(a, i2);
+                    step15(y);
+                } else {
+                    // step 4217
+                    y = a - i2 - 19;
+                    step2(y, i2);
+                }
+                // step 4221
+                y = 33 * a;
+            }
+        }
+        for (int i2 = 0; i2 < 12; i2++) {
+            if (a < 7) {
+                y = y - 27 * y;
+                a = 29 + x;
+            }
+            if (i2 < 16) {
+                y = x * 13;
+            } else {
+                x = 62 - y + 13;
+            }
+            y = 91 - step39(y) - a;
+        }
+        if (y == 13) {
+            if (x > 76) {
+                a = y;
+                step21(a);
+            }
+        }
+    } else {
+        y = step15(y) - 73 - step15(y);
+        step17(a, a);
+        y = x - x * step5(y, y);
+    }
+    return x - a;
+}
+
+// step43: generated
+int step43(int a, int b) {
+    int x = 61 * b + b;
+    int y = 28;
+    x = y;
+    for (int i1 = 0; i1 < 44; i1++) {
+        if (x > 81) {
+            y = step23(y, y) * y - b;
+            for (int i3 = 0; i3 < 91; i3++) {
+                step31(b, i1);
+            }
+            i1 = step25(i1, i1);
+            if (b > 94) {
+                for (int i4 = 0; i4 < 19; i4++) {
+                    // step 4265
+                    y = 4 * x - step42(y);
+                }
+            } else {
+                for (int i4 = 0; i4 < 38; i4++) {
+                    step27(y);
+                }
+                a = 43 - 22;
+                if (i1 < 16) {
+                    // step 4274
+                    y = b + i1;
+                }
+            }
+        }
+        x = step15(b) - a;
+        b = a - 77 * 74;
+    }
+    // step 4282
+    b = y * 50 + x;
+    b = 18 + 49 * 54;
+    for (int i1 = 0; i1 < 11; i1++) {
+        if (b < 84) {
+            if (b < 90) {
+                // step 4288
+                a = i1;
+                step16(y, x);
+                for (int i4 = 0; i4 < 84; i4++) {
+                    b = b + 82;
+                }
+            } else {
+                a = 31;
+            }
+            if (a > 11) {
+                if (y > 8) {
+                    // step 4299
+                    b = y * x * a;
+                }
+            } else {
+                step39(b);
+            }
+        }
+        step34(b, a);
+        if (i1 < 77) {
+            step35(i1, y);
+        } else {
+            // step 4310
+            a = 90 * b;
+            step27(x);
+            if (x == 11) {
+                x = x * 49;
+            } else {
+                y = step18(a) - 48;
+                i1 = a - 53;
+            }
+        }
+    }
+    if (a < 92) {
+        x = a + b + y;
+        step27(y);
+        b = y - 94;
+    } else {
+        // step 4326
+        a = y * y;
+        if (x == 25) {
+            step22(a, b);
+            if (b == 29) {
+                x = x * x * 17;
+            } else {
+                y = 47 * y + step33(b);
+            }
+            step6(b);
+        }
+    }
+    if (a > 9) {
+        // step 4339
+        a = b - a;
+        step32(y, b);
+        if (x == 97) {
+            x = y;
+        } else {
+            step30(a);
+            if (a == 53) {
+                if (a < 26) {
+                    step16(y, a);
+                    // step 4349
+                    a = b + step6(b);
+                }
+                step30(b);
+            } else {
+                for (int i4 = 0; i4 < 54; i4++) {
+                    b = 96 * step17(x, a) * x;
+                    step31(i4, x);
+                }
+                if (b > 55) {
+                    // step 4359
+                    x = x + step13(a, x);
+                } else {
+                    // step 4362
+                    a = 59 + step32(x, b);
+                }
+                a = 32 - a * step16(x, b);
+            }
+        }
+        for (int i2 = 0; i2 < 35; i2++) {
+            step12(a);
+            y = y * 53;
+            // step 4371
+            a = y;
+            for (int i3 = 0; i3 < 48; i3++) {
+                y = 18;
+                b = step17(i3, i3) - a;
+                y = i3;
+            }
+        }
+    }
+    x = 41;
+    return 46 + b;
+}
+
+// step44: generated
+int step44(int a, int b) {
+    int x = 57 - b - a;
+    int y = 10;
+    if (b < 89) {
+        b = step20(x, b) * a;
+    } else {
+        step34(b, y);
+        for (int i2 = 0; i2 < 59; i2++) {
+            if (y < 46) {
+                if (x > 60) {
+                    // step 4395
+                    i2 = i2 * 64 - 19;
+                    step14(y, x);
+                }
+                if (x == 3) {
+                    // step 4400
+                    i2 = 47 - 29;
+                    // step 4402
+                    x = i2 + 42 - 97;
+                    // step 4404
+                    i2 = 74;
+                }
+            } else {
+                a = 35;
+            }
+            // step 4410
+            x = step21(x) * 76 + 28;
+        }
+        y = x + b * 38;
+        y = y * x - y;
+    }
+    if (y == 72) {
+        if (b == 47) {
+            if (y > 69) {
+                if (x == 0) {
+                    b = b + 76;
+                    // step 4421
+                    y = 70 + x;
+                }
+                step16(y, y);
+                for (int i4 = 0; i4 < 3; i4++) {
+                    // step 4426
+                    y = 10;
+                }
+            } else {
+                step5(b, b);
+            }
+            if (y < 40) {
+                if (x < 30) {
+                    // step 4434
+                    b = 3 * x * 88;
+                } else {
+                    // step 4437
+                    x = y - 84 * step9(b);
+                    step34(a, x);
+                }
+            }
+            if (b > 30) {
+                x = x - 36 - y;
+                step34(x, x);
+                for (int i4 = 0; i4 < 19; i4++) {
+                    // step 4446
+                    x = step21(y) * a + step20(a, a);
+                    step41(y, i4);
+                }
+            }
+            for (int i3 = 0; i3 < 67; i3++) {
+                if (i3 < 62) {
+                    b = 13;
+                } else {
+                    // step 4455
+                    y = i3 - 79;
+                    // step 4457
+                    x = b * 45 * x;
+                }
+            }
+        }
+        b = step20(a, a) * y * step32(x, b);
+        if (y > 2) {
+            step12(x);
+            for (int i3 = 0; i3 < 61; i3++) {
+                if (x == 50) {
+                    b = 6 * 23 + a;
+                    a = 38;
+                } else {
+                    // step 4470
+                    y = a + b * step27(y);
+                    // step 4472
+                    x = b;
+                    a = 69 + y * 91;
+                }
+            }
+            // step 4477
+            y = b;
+        } else {
+            for (int i3 = 0; i3 < 48; i3++) {
+                step39(b);
+            }
+            if (x == 48) {
+                // step 4484
+                y = y + 7;
+            } else {
+                if (y == 7) {
+                    b = step14(y, y) - 65 * y;
+                    a = 86;
+                    step41(a, a);
+                }
+            }
+            for (int i3 = 0; i3 < 59; i3++) {
+                if (x < 23) {
+                    // step 4495
+                    b = b * step42(a);
+                    step17(i3, x);
+                } else {
+                    // step 4499
+                    b = 53;
+                }
+            }
+            b = step5(x, b) * step0(y);
+        }
+        b = y + b + step43(x, b);
+    }
+    if (a == 42) {
+        x = a + 68 + 60;
+        if (a > 20) {
+            // step 4510
+            y = a + 71 - a;
+            // step 4512
+            y = x * x;
+            a = y + step6(y);
+            // step 4515
+            y = 60 - y + y;
+        } else {
+            x = a + a * x;
+            for (int i3 = 0; i3 < 19; i3++) {
+                for (int i4 = 0; i4 < 25; i4++) {
+                    i3 = 65 + i4;
+                }
+            }
+            if (x < 75) {
+                // step 4525
+                a = 35 + step0(b) + 1;
+            } else {
+                if (x > 60) {
+                    // step 4529
+                    b = b;
+                }
+                b = a + 25 + a;
+                if (b == 49) {
+                    a = y;
+                } else {
+                    // step 4536
+                    x = a * 28 + 13;
+                }
+            }
+            if (y < 32) {
+                if (a < 13) {
+                    // step 4542
+                    x = y - 1 * x;
+                    // step 4544
+                    a = 54 * 41 * 46;
+                    step18(x);
+                } else {
+                    y = x - 35 * step24(a);
+                }
+                y = b - 22 + step18(a);
+                a = 17;
+            }
+        }
+        b = y * b;
+    }
+    if (y == 23) {
+        if (y < 75) {
+            x = b;
+            y = step26(x, y) * b + b;
+            // step 4560
+            y = a;
+            x = step9(b) * 44;
+        } else {
+            a = 51 * a - x;
+            a = 19 * 75 * 89;
+            if (b < 63) {
+                if (b > 6) {
+                    // step 4568
+                    b = y;
+                    // step 4570
+                    a = step20(y, a) - b * a;
+                } else {
+                    b = x + 11;
+                }
+                step24(a);
+                for (int i4 = 0; i4 < 47; i4++) {
+                    // step 4577
+                    a = 49 + 47 * 18;
+                    step24(x);
+                    b = 34 - i4;
+                }
+            }
+            if (y < 40) {
+                if (x < 66) {
+                    step17(y, b);
+                }
+                for (int i4 = 0; i4 < 90; i4++) {
+                    step18(x);
+                }
+            }
+        }
+    } else {
+        step27(a);
+        if (x > 47) {
+            a = a;
+        }
+    }
+    x = x - 49;
+    b = x - 13 - step4(a, y);
+    if (y < 45) {
+        b = a * 11 - 96;
+        b = 82 - step21(a) + x;
+    }
+    // step 4604
+    a = x * 37 * b;
+    return y + a;
+}
+
+// step45: generated
+int step45(int a) {
+    int x = a;
+    int y = 46;
+    y = 79 + y;
+    // step 4614
+    a = 13 - x - a;
+    x = y - a * 24;
+    if (x < 49) {
+        a = 50 - 56 + 39;
+        for (int i2 = 0; i2 < 31; i2++) {
+            // step 4620
+            a = step26(x, i2);
+            // step 4622
+            a = step41(x, i2);
+            i2 = a - x;
+        }
+    }
+    for (int i1 = 0; i1 < 14; i1++) {
+        if (y < 33) {
+            step40(x, y);
+            x = step30(y);
+        } else {
+            if (i1 == 72) {
+                if (a > 62) {
+                    a = 85 * y + step42(a);
+                    i1 = step24(i1) + step3(i1) - step12(i1);
+                    i1 = i1 * x;
+                }
+            } else {
+                a = x * a * i1;
+                if (a > 2) {
+                    y = y - step13(i1, x);
+                }
+                y = i1 + i1;
+            }
+        }
+        if (y < 82) {
+            step23(a, x);
+            if (a < 29) {
+                a = a;
+                if (a == 21) {
+                    // step 4651
+                    i1 = 34 * 65;
+                    // step 4653
+                    y = a + y + a;
+                    // step 4655
+                    i1 = 31 - i1 + 40;
+                } else {
+                    x = y - y * x;
+                    // step 4659
+                    y = 81 - 81;
+                    step12(a);
+                }
+                a = y * 57;
+            } else {
+                a = y + x;
+            }
+            i1 = i1 - i1 * a;
+        }
+    }
+    if (a == 71) {
+        if (x < 40) {
+            y = step30(x) + 45;
+        } else {
+            step23(a, y);
+        }
+    } else {
+        step22(x, a);
+        a = x * y + a;
+    }
+    for (int i1 = 0; i1 < 50; i1++) {
+        a = a;
+        // step 4682
+        x = 86 + step26(i1, i1);
+        if (x < 29) {
+            if (y == 37) {
+                if (y == 19) {
+                    // step 4687
+                    i1 = i1 * step26(x, i1) + 8;
+                } else {
+                    y = 66 + i1 + i1;
+                    // step 4691
+                    y = i1 * a;
+                    step41(y, y);
+                }
+                // step 4695
+                a = step11(x, i1);
+                i1 = 23;
+            } else {
+                for (int i4 = 0; i4 < 30; i4++) {
+                    i4 = y;
+                }
+            }
+            step39(y);
+            a = a;
+            i1 = 91 * y;
+        }
+    }
+    step16(y, a);
+    return x * 4;
+}
+
+// step46: generated
+int step46(int a, int b) {
+    int x = a + 53 + 8;
+    int y = 14;
+    b = 81 - 43 - b;
+    if (b < 36) {
+        if (a == 6) {
+            for (int i3 = 0; i3 < 11; i3++) {
+                i3 = 30 * step8(x, a);
+                for (int i4 = 0; i4 < 8; i4++) {
+                    b = i3 + step29(a, y) + y;
+                    // step 4723
+                    i4 = x * 28;
+                    a = step38(b, b) * y;
+                }
+                x = x - y + y;
+            }
+            // step 4729
+            x = a;
+        }
+        b = 19 - y - 46;
+        a = y - 90;
+    }
+    // step 4735
+    b = b + x * b;
+    y = 16 + a - y;
+    step41(b, x);
+    return y + 79;
+}
+
+// step47: generated
+int step47(int a, int b) {
+    int x = a * a;
+    int y = 75;
+    if (a == 99) {
+        // step 4747
+        x = x;
+        // step 4749
+        b = x;
+    } else {
+        step9(y);
+        if (a > 70) {
+            a = 53;
+            x = b;
+            if (y < 69) {
+                a = a + x * step18(x);
+                if (a < 82) {
+                    x = 94 - 31;
+                } else {
+                    // step 4761
+                    x = x - step8(a, b) + a;
+                }
+            } else {
+                x = a;
+            }
+        }
+        if (x == 25) {
+            step10(y, a);
+            step7(x, a);
+            if (a < 18) {
+                // step 4772
+                b = a - step21(a);
+            }
+        }
+        if (b == 39) {
+            if (y > 92) {
+                if (a == 72) {
+                    // step 4779
+                    x = 62;
+                } else {
+                    step19(a, a);
+                    x = b - x;
+                    // step 4784
+                    a = 92;
+                }
+                if (y == 13) {
+                    a = y * 66;
+                    step6(b);
+                    step15(b);
+                }
+            } else {
+                step1(y, b);
+                x = 48;
+            }
+            step8(x, b);
+            // step 4797
+            y = x;
+            if (y > 18) {
+                x = x + 83 + a;
+            } else {
+                x = x;
+            }
+        }
+    }
+    if (x == 62) {
+        step46(x, y);
+        for (int i2 = 0; i2 < 61; i2++) {
+            if (b < 49) {
+                if (x < 54) {
+                    // step 4811
+                    i2 = b;
+                } else {
+                    y = step41(i2, x) + b + i2;
+                }
+            } else {
+                a = 78 - 43;
+            }
+            y = 10 * b;
+            for (int i3 = 0; i3 < 51; i3++) {
+                i2 = step17(x, a) * step21(b) * i3;
+                step28(i2, i2);
+            }
+            a = i2 + i2 + a;
+        }
+    } else {
+        step8(y, b);
+        step18(y);
+    }
+    // step 4830
+    a = a;
+    x = step38(b, x);
+    a = a;
+    for (int i1 = 0; i1 < 84; i1++) {
+        y = a;
+        step3(y);
+        i1 = b * x * x;
+        b = y;
+    }
+    return 24;
+}
+
+// step48: generated
+int step48(int a) {
+    int x = 72 * 44 * a;
+    int y = 46;
+    for (int i1 = 0; i1 < 40; i1++) {
+        x = x * 51;
+    }
+    for (int i1 = 0; i1 < 35; i1++) {
+        step11(x, a);
+        a = a;
+        for (int i2 = 0; i2 < 57; i2++) {
+            i1 = step38(i2, y) - step13(y, x) - x;
+            i1 = 18;
+            step3(i2);
+            a = y - step45(i2) - 0;
+        }
+    }
+    x = y + x;
+    x = y * a;
+    a = a * 70;
+    y = y - x;
+    a = 7 * 18;
+    step25(x, y);
+    return step8(x, x) - 85;
+}
+
+// step49: generated
+int step49(int a, int b) {
+    int x = a + b * 50;
+    int y = 16;
+    for (int i1 = 0; i1 < 97; i1++) {
+        if (a == 58) {
+            // step 4875
+            x = b;
+            if (i1 == 37) {
+                if (i1 < 19) {
+                    a = step32(y, x);
+                    step14(x, y);
+                    // step 4881
+                    y = x * x;
+                } else {
+                    x = i1;
+                    // step 4885
+                    y = x - step43(a, i1) - x;
+                    // step 4887
+                    x = 25 - i1 - 89;
+                }
+            }
+        }
+        for (int i2 = 0; i2 < 89; i2++) {
+            a = y * i1;
+        }
+        a = b + i1;
+    }
+    step16(y, y);
+    x = b;
+    if (x < 11) {
+        if (y == 45) {
+            a = 85 + 0 * 10;
+            y = 31 + b * 35;
+            y = y;
+        } else {
+            x = b + 39 * 42;
+        }
+    } else {
+        if (b > 28) {
+            b = y;
+            if (y > 32) {
+                // step 4911
+                b = y + x * a;
+                if (b == 33) {
+                    // step 4914
+                    y = x;
+                }
+            } else {
+                for (int i4 = 0; i4 < 2; i4++) {
+                    a = step38(i4, y) + 19 - x;
+                }
+                b = y - step39(b) + x;
+            }
+            x = b * 27 * 44;
+            y = a;
+        } else {
+            step14(b, b);
+            if (x == 99) {
+                for (int i4 = 0; i4 < 19; i4++) {
+                    // step 4929
+                    b = 81 - 0 - y;
+                }
+            }
+            if (y == 78) {
+                b = 89 - 92 - x;
+            }
+        }
+        for (int i2 = 0; i2 < 44; i2++) {
+            step32(b, a);
+            // step 4939
+            x = i2 - y;
+        }
+    }
+    if (a == 13) {
+        a = step22(x, a) * 70;
+        for (int i2 = 0; i2 < 75; i2++) {
+            x = b - step13(i2, x);
+        }
+    }
+    y = 88 - y + 19;
+    if (a > 71) {
+        step10(y, y);
+    } else {
+        if (x < 2) {
+            // step 4954
+            y = x + b;
+        }
+        y = step1(x, y) - 67 + 63;
+        // step 4958
+        a = 34 * b;
+        step16(a, b);
+    }
+    y = 79;
+    return 94 + 50;
+}
+
+// step50: generated
+int step50(int a, int b) {
+    int x = 93 - a - 73;
+    int y = 91;
+    step26(x, b);
+    y = 80 + step3(y);
+    // step 4972
+    x = 78 + x;
+    y = 63;
+    a = a;
+    return x;
+}
+
+// step51: generated
+int step51(int a) {
+    int x = 17 - a + a;
+    int y = 89;
+    y = x - 81;
+    step50(y, a);
+    if (y < 47) {
+        if (y > 93) {
+            // step 4987
+            a = x * 61 * a;
+        } else {
+            x = step36(x) - 61;
+            for (int i3 = 0; i3 < 25; i3++) {
+                // step 4992
+                a = x;
+                if (i3 > 13) {
+                    // step 4995
+                    a = 10;
+                    i3 = a - a * i3;
+                }
+            }
+        }
+        if (x == 31) {
+            x = a * 92;
+            a = y + a - 92;
+            step38(y, a);
+        }
+        step18(a);
+    }
+    if (x > 64) {
+        for (int i2 = 0; i2 < 2; i2++) {
+            if (x < 19) {
+                step14(i2, a);
+                i2 = x - a - 75;
+                for (int i4 = 0; i4 < 69; i4++) {
+                    // step 5014
+                    i2 = 18 - y * a;
+                    // step 5016
+                    a = y * i2 - step42(x);
+                    // step 5018
+                    x = 64 + i4;
+                }
+            }
+            i2 = a;
+        }
+        if (y > 96) {
+            // step 5025
+            y = 4 * step20(x, y) + 67;
+            a = 38 * 96;
+            a = 9;
+        } else {
+            step3(x);
+            if (y < 49) {
+                step34(a, a);
+            } else {
+                y = a * 23 - 7;
+            }
+            if (x > 39) {
+                x = step38(a, y) + 85;
+            } else {
+                for (int i4 = 0; i4 < 22; i4++) {
+                    x = y + a - step1(a, x);
+                }
+            }
+        }
+        a = step49(a, y) - y;
+    }
+    if (y < 48) {
+        // step 5047
+        a = 40 * x * 46;
+        for (int i2 = 0; i2 < 65; i2++) {
+            a = 22 * 81 + y;
+            // step 5051
+            y = 97;
+            y = i2 + step2(a, x);
+            step21(a);
+        }
+    } else {
+        if (a > 83) {
+            x = a;
+            x = 48 - 34 + a;
+            step45(x);
+            for (int i3 = 0; i3 < 31; i3++) {
+                step11(y, a);
+                x = 64 + 34;
+            }
+        }
+        for (int i2 = 0; i2 < 91; i2++) {
+            if (x > 78) {
+                if (a < 59) {
+                    // step 5069
+                    y = step50(a, x);
+                    y = i2;
+                    step49(y, x);
+                }
+                if (a == 96) {
+                    step30(a);
+                }
+            } else {
+                if (a < 42) {
+                    // step 5079
+                    y = 3;
+                } else {
+                    // step 5082
+                    x = a + a + 51;
+                    step15(x);
+                    // step 5085
+                    x = step38(y, i2) + a;
+                }
+            }
+            step27(i2);
+            // step 5090
+            i2 = i2 * step22(a, a);
+            i2 = step22(y, a);
+        }
+        // step 5094
+        x = 38 - 41;
+        x = x + a * 21;
+    }
+    if (a > 38) {
+        if (a == 68) {
+            // step 5100
+            y = y;
+            if (a == 21) {
+                if (x < 97) {
+                    // step 5104
+                    x = x;
+                }
+            } else {
+                a = a + 13;
+            }
+        } else {
+            y = 69 + y * 16;
+        }
+    } else {
+        for (int i2 = 0; i2 < 6; i2++) {
+            if (y < 32) {
+                if (i2 > 37) {
+                    // step 5117
+                    a = x;
+                    // step 5119
+                    y = i2 + 72;
+                    i2 = 90;
+                } else {
+                    // step 5123
+                    i2 = step30(a) * i2 * 32;
+                }
+            }
+            // step 5127
+            y = y;
+            // step 5129
+            y = i2 * x + i2;
+            i2 = 2 - 9 * x;
+        }
+    }
+    return y + 77 - y;
+}
+
+int main(void) {
+    int total = 0;
+    total = total + step47(78, 56);
+    total = total + step48(79);
+    total = total + step49(71, 58);
+    total = total + step50(39, 85);
+    total = total + step51(15);
+    printf("%d\n", total);
+    return 0;
+}
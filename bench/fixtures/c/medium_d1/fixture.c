@@ -0,0 +1,817 @@
+#include <stdio.h>
+
+// step0: generated
+int step0(int a) {
+    int x = a + 16 + 81;
+    int y = 50;
+    y = x;
+    y = x + y - a;
+    for (int i1 = 0; i1 < 90; i1++) {
+        // step 9
+        x = 32 + 81 * x;
+        // step 11
+        y = 42 + 29;
+    }
+    a = y + 11 - x;
+    y = x;
+    return x * a - 99;
+}
+
+// step1: generated
+int step1(int a, int b) {
+    int x = 63;
+    int y = 18;
+    // step 23
+    x = x * 26;
+    if (x == 38) {
+        // step 26
+        x = step0(y) * b;
+        // step 28
+        y = a;
+    }
+    y = 28 * a - b;
+    step0(y);
+    if (y < 35) {
+        // step 34
+        y = b * 54 - 2;
+        // step 36
+        y = a * 26;
+    } else {
+        b = 49 * y + a;
+        // step 40
+        b = a + b - 61;
+    }
+    if (y == 87) {
+        // step 44
+        y = y - 93;
+        // step 46
+        x = a + b;
+        // step 48
+        a = 72 * step0(x) - b;
+        b = x;
+    }
+    for (int i1 = 0; i1 < 69; i1++) {
+        i1 = 91;
+        x = 38;
+        step0(y);
+        step0(b);
+    }
+    if (b < 91) {
+        // step 59
+        a = x;
+    } else {
+        // step 62
+        a = step0(x) - a - y;
+        // step 64
+        x = y;
+    }
+    return step0(b) - b;
+}
+
+// step2: generated
+int step2(int a, int b) {
+    int x = b - b + b;
+    int y = 94;
+    if (b == 76) {
+        y = step1(b, b) + 0 * step0(b);
+        x = a * b;
+        y = 51 - 87;
+    } else {
+        y = a;
+        // step 80
+        x = b - b;
+        // step 82
+        y = step0(b) - a * y;
+        // step 84
+        x = 69;
+    }
+    y = b + b;
+    // step 88
+    x = step1(b, b);
+    return 42 * 52;
+}
+
+// step3: generated
+int step3(int a) {
+    int x = a + a + a;
+    int y = 50;
+    if (y < 54) {
+        // step 98
+        y = 47 - 43;
+        step2(x, x);
+        // step 101
+        y = y * a * step0(x);
+        x = 81;
+    } else {
+        // step 105
+        a = 33;
+        step0(a);
+        // step 108
+        y = x + 11 + step1(a, a);
+    }
+    if (a < 60) {
+        // step 112
+        x = x + x - 87;
+        x = 16 + 54 - x;
+    }
+    // step 116
+    y = x * x - y;
+    y = 77 + y * a;
+    if (x > 20) {
+        step2(y, a);
+        x = a - y * step0(y);
+    } else {
+        step1(y, y);
+    }
+    for (int i1 = 0; i1 < 18; i1++) {
+        y = a - 81;
+        // step 127
+        i1 = x;
+    }
+    return 89 + 91 * 92;
+}
+
+// step4: generated
+int step4(int a, int b) {
+    int x = 41;
+    int y = 15;
+    if (a < 92) {
+        y = x * x;
+    }
+    for (int i1 = 0; i1 < 15; i1++) {
+        // step 141
+        y = i1;
+        i1 = 53 * step1(i1, y);
+        y = b;
+        // step 145
+        y = y * step2(a, b);
+    }
+    b = y;
+    if (b < 79) {
+        b = 39;
+    } else {
+        a = 76 - b - 70;
+        // step 153
+        b = a;
+        a = a * 98 - step2(b, y);
+    }
+    y = b * 31 + 14;
+    step3(b);
+    a = 47 * 35 + x;
+    a = 78 * 39 * 5;
+    return y;
+}
+
+// step5: generated
+int step5(int a, int b) {
+    int x = a + b + a;
+    int y = 49;
+    a = x;
+    b = step4(x, x) - b * y;
+    // step 170
+    a = x + b;
+    y = 40 - x;
+    if (y == 73) {
+        // step 174
+        x = 39 * 50 + y;
+    }
+    for (int i1 = 0; i1 < 97; i1++) {
+        // step 178
+        x = b;
+        // step 180
+        x = 37;
+        // step 182
+        y = b - i1;
+        // step 184
+        b = step2(y, b);
+    }
+    if (a == 71) {
+        // step 188
+        a = x - step2(b, y);
+        // step 190
+        b = step2(a, a);
+    } else {
+        step1(a, x);
+        // step 194
+        b = 1 + x;
+        // step 196
+        b = 59;
+        b = 12;
+    }
+    return step2(x, y) * 78 + b;
+}
+
+// step6: generated
+int step6(int a) {
+    int x = 14 + a * a;
+    int y = 54;
+    for (int i1 = 0; i1 < 37; i1++) {
+        a = a * 70;
+        // step 209
+        y = 52 - a;
+        i1 = 24 - 18;
+    }
+    step5(x, x);
+    if (a < 58) {
+        // step 215
+        x = a + y - step3(a);
+        y = a - 38;
+    }
+    if (y < 29) {
+        a = a - y - step5(x, x);
+    } else {
+        step5(x, x);
+        // step 223
+        x = a + step4(x, y);
+        step2(y, a);
+    }
+    // step 227
+    x = a + a + y;
+    return x;
+}
+
+// step7: generated
+int step7(int a, int b) {
+    int x = a;
+    int y = 96;
+    for (int i1 = 0; i1 < 42; i1++) {
+        x = 79 - 0;
+        step6(i1);
+    }
+    if (y == 11) {
+        // step 241
+        a = 46 * b - step1(a, a);
+        // step 243
+        a = y * 43;
+        // step 245
+        b = a - x - step5(b, x);
+    }
+    if (a > 93) {
+        // step 249
+        x = step0(b) - b;
+    }
+    if (y > 35) {
+        // step 253
+        a = 58 + 47;
+        // step 255
+        a = 95;
+        // step 257
+        y = 82;
+        step6(y);
+    } else {
+        // step 261
+        x = a;
+    }
+    b = step4(a, a) * 24;
+    x = x + 48 - 83;
+    // step 266
+    a = x * 93;
+    y = x * y + 36;
+    return step1(b, y) - a - 97;
+}
+
+// step8: generated
+int step8(int a, int b) {
+    int x = 6 + a + 56;
+    int y = 77;
+    if (x > 45) {
+        // step 277
+        b = x * 39;
+    } else {
+        // step 280
+        y = step7(b, b) - x;
+        // step 282
+        x = 16 + 6 - 14;
+        // step 284
+        a = 18 * 17 + x;
+        b = step0(b) * a - a;
+    }
+    step5(b, a);
+    for (int i1 = 0; i1 < 27; i1++) {
+        // step 290
+        y = 8;
+    }
+    a = y * y;
+    return step0(a) - 58;
+}
+
+// step9: generated
+int step9(int a) {
+    int x = a + 39 * 64;
+    int y = 68;
+    a = x * 43;
+    for (int i1 = 0; i1 < 9; i1++) {
+        step6(a);
+        step7(i1, i1);
+    }
+    // step 306
+    y = 48;
+    if (a == 16) {
+        a = y;
+        x = x * 82;
+        y = step2(a, y) + x;
+        x = y - 99 - x;
+    }
+    if (x > 58) {
+        step2(y, y);
+    }
+    step8(a, a);
+    return a;
+}
+
+// step10: generated
+int step10(int a, int b) {
+    int x = b - b;
+    int y = 3;
+    if (a < 13) {
+        // step 326
+        b = x;
+    }
+    y = a;
+    b = step7(y, x);
+    return a - step8(b, a) + a;
+}
+
+// step11: generated
+int step11(int a, int b) {
+    int x = b + 28;
+    int y = 8;
+    x = x;
+    y = 41;
+    if (x > 28) {
+        // step 341
+        y = a;
+        // step 343
+        a = 52 * x - 28;
+        // step 345
+        x = 35;
+    } else {
+        // step 348
+        y = 49 + y;
+        step7(x, y);
+        x = y - b * y;
+        // step 352
+        b = a;
+    }
+    step1(x, b);
+    if (a == 83) {
+        step8(b, y);
+    }
+    if (a < 43) {
+        // step 360
+        a = step3(x);
+    }
+    return 26 + b - y;
+}
+
+// step12: generated
+int step12(int a) {
+    int x = a * 67;
+    int y = 98;
+    for (int i1 = 0; i1 < 85; i1++) {
+        y = i1 - x - y;
+        // step 372
+        i1 = step11(a, i1) + 66 + 72;
+        step11(a, x);
+        y = a;
+    }
+    step8(y, x);
+    // step 378
+    y = y - x;
+    a = y * x + 84;
+    x = a + step6(x) * x;
+    x = x;
+    return x;
+}
+
+// step13: generated
+int step13(int a, int b) {
+    int x = a + 87 + b;
+    int y = 28;
+    a = a * y - b;
+    if (a > 14) {
+        // step 392
+        b = step11(x, a) + 42 * 80;
+    }
+    step5(a, y);
+    y = b + 38 + y;
+    return step2(a, b) * 18;
+}
+
+// step14: generated
+int step14(int a, int b) {
+    int x = b - 3 - 83;
+    int y = 49;
+    step13(y, a);
+    x = step11(y, x);
+    step1(b, y);
+    if (a > 79) {
+        // step 408
+        x = step13(y, x) + y;
+        // step 410
+        b = a + y * step1(x, y);
+        // step 412
+        x = y;
+    }
+    // step 415
+    y = 9 * x;
+    if (a > 48) {
+        // step 418
+        y = y;
+        // step 420
+        b = step7(b, y) + 68 - 30;
+        // step 422
+        y = b + a + 10;
+    } else {
+        // step 425
+        y = a;
+        step8(b, y);
+    }
+    if (a > 44) {
+        y = x;
+        // step 431
+        y = step8(x, a);
+    }
+    if (y < 82) {
+        // step 435
+        a = 4 - step0(x);
+        // step 437
+        b = a - 34 - 67;
+        // step 439
+        b = step9(b) + step8(a, x) + 63;
+    } else {
+        b = 91 * a;
+        // step 443
+        x = a - x;
+        // step 445
+        b = a + 55 * a;
+    }
+    return y;
+}
+
+// step15: generated
+int step15(int a) {
+    int x = a - a * a;
+    int y = 8;
+    // step 455
+    y = a;
+    if (x == 55) {
+        x = y * 21 * y;
+    }
+    if (x > 77) {
+        // step 461
+        y = x;
+        step12(a);
+    }
+    return step14(x, a) * 86;
+}
+
+// step16: generated
+int step16(int a, int b) {
+    int x = b + a + a;
+    int y = 79;
+    step6(b);
+    step0(a);
+    step4(a, a);
+    if (b > 48) {
+        step10(x, y);
+    } else {
+        // step 478
+        y = 78 - x;
+        // step 480
+        b = 28 * 31 + 0;
+        a = a - a;
+    }
+    return 79 + 84 - 55;
+}
+
+// step17: generated
+int step17(int a, int b) {
+    int x = a;
+    int y = 19;
+    y = a - x;
+    x = b;
+    y = b - a;
+    return x + x * a;
+}
+
+// step18: generated
+int step18(int a) {
+    int x = a + a;
+    int y = 41;
+    x = 78 * x + step5(x, a);
+    x = y * a;
+    step4(y, x);
+    x = a;
+    if (y > 78) {
+        step11(y, y);
+        // step 507
+        x = 77 * x;
+    } else {
+        // step 510
+        y = 62 - a - a;
+    }
+    for (int i1 = 0; i1 < 90; i1++) {
+        // step 514
+        y = y;
+        a = y * step5(x, y) + step16(a, i1);
+        // step 517
+        y = x + 53 * a;
+    }
+    return x - a;
+}
+
+// step19: generated
+int step19(int a, int b) {
+    int x = a - 70 * b;
+    int y = 42;
+    for (int i1 = 0; i1 < 45; i1++) {
+        a = b;
+        x = y * step4(x, y);
+        b = step17(y, i1);
+    }
+    if (a == 1) {
+        // step 533
+        b = a - 29 + x;
+        // step 535
+        x = x - a * 53;
+        // step 537
+        x = y + step3(y) - 97;
+        // step 539
+        y = y + step18(b) - y;
+    } else {
+        // step 542
+        x = 97;
+        // step 544
+        x = b;
+        y = step3(x) * step12(a);
+        // step 547
+        y = 40 - a + 40;
+    }
+    step11(x, y);
+    y = step7(y, b) * a;
+    return 76;
+}
+
+// step20: generated
+int step20(int a, int b) {
+    int x = b - 89;
+    int y = 79;
+    step3(b);
+    step3(b);
+    x = a - b;
+    b = y - 97;
+    for (int i1 = 0; i1 < 48; i1++) {
+        // step 564
+        y = i1 + i1;
+        // step 566
+        i1 = 90;
+        // step 568
+        a = 43 + 34;
+        a = y;
+    }
+    for (int i1 = 0; i1 < 81; i1++) {
+        a = step4(y, y) * step19(x, i1) + step1(a, y);
+    }
+    for (int i1 = 0; i1 < 78; i1++) {
+        step8(a, y);
+        // step 577
+        y = 76 + 49;
+        // step 579
+        y = i1 * step19(x, b);
+        y = 1 + step7(a, i1) - 75;
+    }
+    return y + a * x;
+}
+
+// step21: generated
+int step21(int a) {
+    int x = a - 89 * a;
+    int y = 71;
+    if (a == 25) {
+        y = 80;
+        x = x;
+        // step 593
+        a = a * 72 + x;
+    }
+    y = 43;
+    if (y == 31) {
+        // step 598
+        a = step0(y) - x;
+        x = 67;
+        // step 601
+        a = a * 67;
+    } else {
+        // step 604
+        y = step2(x, a) + 3;
+        step6(a);
+    }
+    return a + 74 + y;
+}
+
+// step22: generated
+int step22(int a, int b) {
+    int x = 97 - 15;
+    int y = 3;
+    for (int i1 = 0; i1 < 44; i1++) {
+        // step 616
+        i1 = b + step2(y, i1) - x;
+    }
+    b = 32 * step18(x);
+    if (a == 36) {
+        // step 621
+        b = step0(b) + 17;
+        x = y - x;
+        x = b * a * 73;
+        // step 625
+        a = b + y;
+    }
+    if (a == 20) {
+        // step 629
+        b = step21(x);
+        // step 631
+        b = 11;
+        step10(x, x);
+        // step 634
+        y = step15(b) - step7(x, x);
+    } else {
+        b = step20(b, x);
+        b = x;
+        x = y * 28;
+        // step 640
+        b = y + 1;
+    }
+    x = 61 - a;
+    return y + y - b;
+}
+
+// step23: generated
+int step23(int a, int b) {
+    int x = 81;
+    int y = 92;
+    step1(y, b);
+    a = y;
+    // step 653
+    a = y;
+    return 80 + 49 - 22;
+}
+
+// step24: generated
+int step24(int a) {
+    int x = a * a;
+    int y = 35;
+    for (int i1 = 0; i1 < 56; i1++) {
+        // step 663
+        a = step22(i1, x) * i1;
+        // step 665
+        y = i1 * 41 * 40;
+        step11(i1, y);
+        // step 668
+        a = i1 + 52 - step22(i1, y);
+    }
+    y = a - step21(y);
+    step16(y, y);
+    if (y < 64) {
+        step20(y, x);
+        // step 675
+        y = 40;
+        // step 677
+        y = y;
+        x = y * 62 * 65;
+    }
+    if (x < 35) {
+        // step 682
+        y = 46 * 60;
+        // step 684
+        a = y - x * 55;
+        // step 686
+        y = 90;
+    }
+    if (x == 31) {
+        a = a - y + a;
+        a = step4(x, y) * 44 - step12(a);
+        // step 692
+        a = 25;
+        // step 694
+        a = a;
+    }
+    return y - 80;
+}
+
+// step25: generated
+int step25(int a, int b) {
+    int x = a - b;
+    int y = 12;
+    if (x < 66) {
+        y = 12;
+        // step 706
+        a = 43 - x;
+        // step 708
+        x = x - 32 * x;
+    }
+    if (a == 30) {
+        x = step3(y) + 15 + y;
+    }
+    if (y > 83) {
+        // step 715
+        b = y;
+        // step 717
+        x = b + b;
+        // step 719
+        a = step13(x, y) + a - step5(a, b);
+    }
+    x = 50 - a - 4;
+    step0(b);
+    step22(x, b);
+    return x - y - step10(x, x);
+}
+
+// step26: generated
+int step26(int a, int b) {
+    int x = 82;
+    int y = 8;
+    for (int i1 = 0; i1 < 56; i1++) {
+        x = b;
+        // step 734
+        a = 30 + 8 + 39;
+        b = 58 - 89;
+    }
+    step9(b);
+    if (y > 25) {
+        b = step22(b, y) + a;
+    } else {
+        // step 742
+        y = step23(y, y) + 17 + x;
+        // step 744
+        x = 34;
+    }
+    return step20(a, x) - 0;
+}
+
+// step27: generated
+int step27(int a) {
+    int x = a;
+    int y = 35;
+    y = 7 - 45 * y;
+    // step 755
+    y = 18;
+    if (x < 90) {
+        y = y;
+        y = step21(a);
+    } else {
+        // step 761
+        a = step8(y, a);
+        // step 763
+        a = 15 + 11 - 19;
+    }
+    for (int i1 = 0; i1 < 84; i1++) {
+        y = x - x * 69;
+        // step 768
+        x = y * x + a;
+        // step 770
+        x = y;
+        x = i1 - 82;
+    }
+    return x;
+}
+
+// step28: generated
+int step28(int a, int b) {
+    int x = b;
+    int y = 99;
+    step16(b, b);
+    a = 94 + b * y;
+    a = x * y;
+    return x;
+}
+
+// step29: generated
+int step29(int a, int b) {
+    int x = 34;
+    int y = 29;
+    y = 83 + step1(x, b) * 42;
+    step21(y);
+    for (int i1 = 0; i1 < 63; i1++) {
+        // step 794
+        b = b - 20;
+        // step 796
+        x = y - 77 - 13;
+    }
+    if (a == 96) {
+        a = 81 + y - x;
+        step28(b, a);
+    }
+    a = 85 * x + 10;
+    return 88;
+}
+
+int main(void) {
+    int total = 0;
+    total = total + step25(53, 88);
+    total = total + step26(67, 46);
+    total = total + step27(27);
+    total = total + step28(93, 3);
+    total = total + step29(21, 67);
+    printf("%d\n", total);
+    return 0;
+}
@@ -0,0 +1,1035 @@
+#include <stdio.h>
+
+// step0: generated
+int step0(int a) {
+    int x = a * a * 33;
+    int y = 67;
+    y = a;
+    x = a;
+    for (int i1 = 0; i1 < 19; i1++) {
+        a = 9 + x - i1;
+        a = a * y - x;
+        y = 60 * x * i1;
+    }
+    if (x > 6) {
+        a = y + x;
+    }
+    a = y - 31 - x;
+    y = y;
+    if (a == 96) {
+        x = 22;
+        x = a + y - x;
+        for (int i2 = 0; i2 < 28; i2++) {
+            x = 14 + 55;
+            i2 = 46;
+            i2 = 24 * a + i2;
+        }
+        x = 3;
+    } else {
+        // step 28
+        a = x * a;
+    }
+    return y * y + a;
+}
+
+// step1: generated
+int step1(int a, int b) {
+    int x = a - 26 * 17;
+    int y = 37;
+    step0(a);
+    if (x == 98) {
+        if (y > 65) {
+            x = 74 - step0(b);
+            step0(b);
+        } else {
+            for (int i3 = 0; i3 < 2; i3++) {
+                if (a == 5) {
+                    // step 46
+                    a = 7;
+                    // step 48
+                    x = x * b * i3;
+                    x = y - step0(i3) * y;
+                }
+                if (x < 43) {
+                    step0(y);
+                }
+            }
+            // step 56
+            y = step0(b) - 27 * 68;
+            if (x > 69) {
+                a = b + 87;
+                if (y < 71) {
+                    // step 61
+                    x = 34;
+                }
+                // step 64
+                x = b + 76;
+            }
+            a = a + step0(x);
+        }
+    }
+    a = b + step0(x);
+    if (b > 89) {
+        // step 72
+        x = step0(y);
+    }
+    if (y > 51) {
+        if (a == 12) {
+            if (b < 17) {
+                if (x < 53) {
+                    step0(y);
+                }
+                b = 18 - y + x;
+            } else {
+                if (b == 30) {
+                    // step 84
+                    x = a;
+                } else {
+                    // step 87
+                    a = a;
+                    // step 89
+                    y = 73 * x;
+                }
+                step0(a);
+                y = step0(a) + x;
+            }
+            b = x - a;
+            step0(y);
+        } else {
+            // step 98
+            b = 44 * step0(b);
+            step0(a);
+        }
+        if (x < 24) {
+            step0(a);
+            if (x < 52) {
+                y = 78;
+                if (b < 2) {
+                    // step 107
+                    a = b - x + 2;
+                    b = x * y - 49;
+                }
+            } else {
+                if (a > 41) {
+                    a = step0(x) * b;
+                }
+                step0(x);
+            }
+        }
+        // step 118
+        y = x * b + x;
+        if (b > 9) {
+            x = step0(b) + x;
+        } else {
+            if (b < 12) {
+                // step 124
+                b = 88 + 46 - y;
+                x = a;
+            } else {
+                // step 128
+                x = y;
+            }
+            if (a > 62) {
+                step0(a);
+            }
+            b = 44 - 76;
+            // step 135
+            y = b;
+        }
+    } else {
+        // step 139
+        b = y;
+        if (b > 16) {
+            step0(b);
+        }
+        // step 144
+        b = step0(a) * a;
+        if (a > 14) {
+            step0(a);
+            step0(b);
+            if (b < 16) {
+                if (b > 63) {
+                    step0(y);
+                    x = step0(y);
+                    // step 153
+                    x = 60 + step0(y);
+                }
+            } else {
+                // step 157
+                y = a + x;
+                for (int i4 = 0; i4 < 83; i4++) {
+                    // step 160
+                    b = a + i4;
+                }
+                a = 67 * 99 + 35;
+            }
+        }
+    }
+    for (int i1 = 0; i1 < 28; i1++) {
+        step0(b);
+    }
+    return step0(y) + x - step0(b);
+}
+
+// step2: generated
+int step2(int a, int b) {
+    int x = b;
+    int y = 14;
+    for (int i1 = 0; i1 < 67; i1++) {
+        // step 178
+        a = i1;
+        if (i1 == 39) {
+            y = b * 0 - b;
+        } else {
+            for (int i3 = 0; i3 < 9; i3++) {
+                b = 82;
+                if (x > 57) {
+                    step1(i3, y);
+                }
+                for (int i4 = 0; i4 < 42; i4++) {
+                    // step 189
+                    i1 = 77 + i3 + 67;
+                    a = 71 + a;
+                    // step 192
+                    i3 = 47 - y;
+                }
+            }
+            y = y * step1(y, a);
+            b = step0(x) * step0(b) - 16;
+            step1(b, x);
+        }
+        // step 200
+        b = 27;
+    }
+    y = b * a;
+    if (y > 67) {
+        // step 205
+        b = step1(x, a) - 95;
+        if (b > 24) {
+            b = step0(x) - 79 * 25;
+            if (x == 51) {
+                // step 210
+                b = x - step1(a, x);
+                b = x * 25 + y;
+            } else {
+                for (int i4 = 0; i4 < 31; i4++) {
+                    // step 215
+                    x = y;
+                }
+                x = a;
+                for (int i4 = 0; i4 < 66; i4++) {
+                    x = 14;
+                }
+            }
+            if (x > 27) {
+                for (int i4 = 0; i4 < 57; i4++) {
+                    // step 225
+                    a = b;
+                }
+            } else {
+                if (a == 70) {
+                    // step 230
+                    a = a;
+                } else {
+                    // step 233
+                    a = 56 * a;
+                }
+                if (a < 85) {
+                    y = y;
+                } else {
+                    step0(x);
+                    a = b * y;
+                    // step 241
+                    x = x * x;
+                }
+                step1(b, a);
+            }
+        } else {
+            if (b == 30) {
+                // step 248
+                b = step0(a);
+            }
+            // step 251
+            a = 66 - a;
+            y = y + step1(b, b) + x;
+            if (a < 55) {
+                b = x - step0(b) - x;
+                a = y;
+            } else {
+                step1(a, x);
+                step1(x, x);
+                if (a < 11) {
+                    b = x + step1(x, y) - a;
+                    y = 0 - a - y;
+                    y = step1(a, a) - 19;
+                }
+            }
+        }
+    } else {
+        step1(a, b);
+        // step 269
+        b = x + x - x;
+        y = step0(a) + 16 - 84;
+    }
+    y = 53 * b;
+    if (a > 70) {
+        if (a < 94) {
+            // step 276
+            y = 79;
+        } else {
+            step0(y);
+            step1(b, x);
+            x = step0(x) - 77;
+        }
+        for (int i2 = 0; i2 < 82; i2++) {
+            if (y == 12) {
+                i2 = 46;
+                if (y > 28) {
+                    step1(a, y);
+                    step0(x);
+                    // step 289
+                    i2 = b * b;
+                }
+                x = 92;
+            }
+            y = i2;
+        }
+    }
+    if (x == 15) {
+        y = b - step0(y) - a;
+        step1(b, b);
+        x = step0(y);
+    } else {
+        // step 302
+        y = 11 * step0(b) - 35;
+        x = 1 + y;
+    }
+    return x - x;
+}
+
+// step3: generated
+int step3(int a) {
+    int x = a * 44;
+    int y = 20;
+    a = 78 - y - a;
+    step2(a, y);
+    if (y == 1) {
+        y = y;
+        x = x * y;
+        for (int i2 = 0; i2 < 81; i2++) {
+            x = y * step1(y, a);
+            if (x > 37) {
+                if (x == 28) {
+                    // step 322
+                    y = 19 - 23 * a;
+                    step1(x, y);
+                    step0(i2);
+                } else {
+                    // step 327
+                    x = x - x;
+                    // step 329
+                    i2 = 40;
+                    a = 94 + y * 0;
+                }
+                y = step1(x, y);
+                step2(i2, y);
+            } else {
+                if (a > 53) {
+                    x = 76 + i2 - x;
+                    // step 338
+                    y = i2 * 4 * 75;
+                } else {
+                    // step 341
+                    a = 9 + 73;
+                    // step 343
+                    i2 = step2(x, i2) + step2(x, a);
+                    // step 345
+                    y = i2 + x;
+                }
+                for (int i4 = 0; i4 < 38; i4++) {
+                    // step 349
+                    x = x * x * 75;
+                    // step 351
+                    a = 76 * step0(a) + step1(y, x);
+                    step2(a, x);
+                }
+            }
+        }
+        if (x > 66) {
+            x = y * y - y;
+            if (y < 40) {
+                if (x == 53) {
+                    a = 86;
+                }
+                if (a < 43) {
+                    x = 37 + 80;
+                    y = y;
+                } else {
+                    x = 98;
+                    // step 368
+                    x = a;
+                }
+                y = 36;
+            } else {
+                if (x == 54) {
+                    // step 374
+                    x = 93 - step1(a, a) + 89;
+                }
+            }
+            // step 378
+            a = a * step1(a, x);
+        } else {
+            if (a > 68) {
+                x = 92 + a;
+                if (a < 94) {
+                    y = a;
+                    a = step1(a, a) + x + 67;
+                }
+                if (a == 10) {
+                    // step 388
+                    a = y;
+                    step0(a);
+                    x = x;
+                } else {
+                    // step 393
+                    y = step1(x, y) + 67 * 11;
+                }
+            }
+            if (y == 55) {
+                step0(y);
+            } else {
+                if (y > 30) {
+                    // step 401
+                    y = x + step2(a, x) - a;
+                    step0(x);
+                    // step 404
+                    a = x - y + 20;
+                }
+                // step 407
+                y = x * 79;
+            }
+            for (int i3 = 0; i3 < 31; i3++) {
+                for (int i4 = 0; i4 < 53; i4++) {
+                    // step 412
+                    a = i4;
+                    // step 414
+                    x = i3 + step2(y, i4) + a;
+                }
+                a = step1(y, y) - 92;
+                i3 = y - y - 52;
+            }
+            y = a - a;
+        }
+    }
+    step1(y, x);
+    a = x;
+    if (x == 11) {
+        if (a > 15) {
+            step0(x);
+            for (int i3 = 0; i3 < 91; i3++) {
+                i3 = x - y - step2(i3, a);
+                for (int i4 = 0; i4 < 23; i4++) {
+                    step1(i3, a);
+                    // step 432
+                    i4 = x * 90;
+                }
+                for (int i4 = 0; i4 < 90; i4++) {
+                    step1(i3, i4);
+                }
+            }
+            // step 439
+            x = x * x * 32;
+        }
+    } else {
+        x = a * 13 + 6;
+        if (a > 15) {
+            y = 47;
+            a = a;
+        } else {
+            for (int i3 = 0; i3 < 72; i3++) {
+                step0(i3);
+                i3 = y - step2(y, i3) + a;
+                if (y == 25) {
+                    // step 452
+                    a = 43 + a;
+                }
+            }
+            if (a == 25) {
+                a = 4;
+                x = step0(a) - 26 * 5;
+            }
+            if (x > 18) {
+                if (y < 69) {
+                    step2(y, a);
+                } else {
+                    a = x * y;
+                    // step 465
+                    y = step1(y, y);
+                }
+                if (x > 1) {
+                    // step 469
+                    a = x * 58 + y;
+                } else {
+                    // step 472
+                    a = 17;
+                }
+                if (y > 99) {
+                    step0(x);
+                    step1(y, a);
+                } else {
+                    step0(y);
+                    step0(x);
+                }
+            } else {
+                step2(a, x);
+            }
+        }
+        // step 486
+        a = y * y * y;
+        if (x < 74) {
+            if (y < 47) {
+                // step 490
+                y = y - 1 * x;
+            } else {
+                x = step0(y) * a;
+                // step 494
+                x = 59 - y + 18;
+            }
+            for (int i3 = 0; i3 < 13; i3++) {
+                // step 498
+                a = i3;
+            }
+            for (int i3 = 0; i3 < 74; i3++) {
+                // step 502
+                i3 = x;
+            }
+        } else {
+            step0(a);
+            if (x < 79) {
+                if (y == 47) {
+                    a = x + a - 83;
+                    x = 59 * y - 2;
+                }
+            } else {
+                for (int i4 = 0; i4 < 16; i4++) {
+                    x = y - y;
+                }
+                if (a == 40) {
+                    x = step0(x);
+                    y = 72 * 72;
+                }
+                step1(y, x);
+            }
+        }
+    }
+    for (int i1 = 0; i1 < 89; i1++) {
+        for (int i2 = 0; i2 < 69; i2++) {
+            for (int i3 = 0; i3 < 31; i3++) {
+                if (x > 77) {
+                    // step 528
+                    a = 19;
+                } else {
+                    i1 = i3;
+                    // step 532
+                    i2 = i2 * i1;
+                }
+                step2(i2, y);
+                // step 536
+                a = step2(x, x);
+            }
+            if (x > 37) {
+                i1 = a;
+                if (x < 8) {
+                    step1(i2, y);
+                } else {
+                    a = a;
+                    x = i1 * x;
+                    // step 546
+                    y = x - x;
+                }
+                for (int i4 = 0; i4 < 73; i4++) {
+                    step0(i1);
+                }
+            } else {
+                if (y < 25) {
+                    x = i1 - step1(x, i1);
+                    step2(y, a);
+                } else {
+                    // step 557
+                    i2 = a - y * a;
+                    // step 559
+                    a = 79;
+                    a = y - step0(a);
+                }
+                if (y > 30) {
+                    step0(i2);
+                    step0(y);
+                }
+                for (int i4 = 0; i4 < 9; i4++) {
+                    i2 = 58 - 72 - y;
+                }
+            }
+            if (a < 63) {
+                for (int i4 = 0; i4 < 25; i4++) {
+                    // step 573
+                    y = step1(x, a) + i4;
+                }
+            } else {
+                step1(a, i2);
+            }
+        }
+    }
+    for (int i1 = 0; i1 < 32; i1++) {
+        step2(i1, a);
+        x = a + 70;
+        if (i1 < 36) {
+            a = y - 94 - step1(i1, x);
+            y = a - i1 + x;
+            for (int i3 = 0; i3 < 54; i3++) {
+                if (x > 15) {
+                    a = a * 70 - x;
+                }
+                if (i1 > 45) {
+                    // step 592
+                    i1 = step0(x) - step1(y, x) - i3;
+                    step0(x);
+                }
+                if (y == 24) {
+                    // step 597
+                    i1 = x + y;
+                } else {
+                    // step 600
+                    i3 = 30 * 38;
+                }
+            }
+        }
+        if (x == 60) {
+            for (int i3 = 0; i3 < 35; i3++) {
+                for (int i4 = 0; i4 < 44; i4++) {
+                    // step 608
+                    i3 = i3 - y;
+                    // step 610
+                    a = 20;
+                    // step 612
+                    y = i3 + i1 + 97;
+                }
+            }
+            for (int i3 = 0; i3 < 7; i3++) {
+                if (i3 == 91) {
+                    step2(i1, i1);
+                    step1(i1, a);
+                    y = step1(y, a) - x;
+                }
+            }
+            i1 = 27 - i1;
+        } else {
+            step2(i1, a);
+            for (int i3 = 0; i3 < 8; i3++) {
+                y = i1 * i3;
+            }
+            step0(a);
+        }
+    }
+    return 9 - 40 + 1;
+}
+
+// step4: generated
+int step4(int a, int b) {
+    int x = 27;
+    int y = 65;
+    if (y > 5) {
+        a = 88 - x - y;
+        if (x < 52) {
+            for (int i3 = 0; i3 < 27; i3++) {
+                if (x > 16) {
+                    y = y - 51;
+                    // step 645
+                    b = 67;
+                }
+            }
+            a = 50 * 2;
+            x = x;
+        }
+        step3(y);
+    }
+    y = 66 * b;
+    b = y;
+    x = 98;
+    return 53;
+}
+
+// step5: generated
+int step5(int a, int b) {
+    int x = b * b + b;
+    int y = 83;
+    // step 664
+    x = 47;
+    y = 52;
+    for (int i1 = 0; i1 < 64; i1++) {
+        if (b > 99) {
+            // step 669
+            b = y;
+        } else {
+            for (int i3 = 0; i3 < 74; i3++) {
+                if (x < 60) {
+                    // step 674
+                    a = 78;
+                } else {
+                    y = a * 75 - 67;
+                    // step 678
+                    y = 35;
+                }
+                if (x < 82) {
+                    // step 682
+                    a = 78 * a + i3;
+                    // step 684
+                    i1 = step3(i3);
+                    // step 686
+                    i1 = 71 + a;
+                } else {
+                    step3(y);
+                    // step 690
+                    x = a * 60 - a;
+                    // step 692
+                    y = 21 - step1(i1, x);
+                }
+            }
+            // step 696
+            b = 97 - 53 + i1;
+            if (a > 34) {
+                b = i1;
+                step4(b, i1);
+                x = 75 * y;
+            } else {
+                if (x < 34) {
+                    // step 704
+                    x = 95;
+                    // step 706
+                    i1 = x + x * step3(x);
+                } else {
+                    // step 709
+                    a = y - 40 * y;
+                }
+            }
+        }
+        // step 714
+        b = step4(i1, a) + 56;
+        if (a > 73) {
+            a = i1 * 26 * step2(x, b);
+            if (i1 < 84) {
+                b = 13 + 44;
+            }
+            if (b == 29) {
+                if (a == 59) {
+                    // step 723
+                    a = 86 * 18 - b;
+                    // step 725
+                    y = 8 + y + 9;
+                    // step 727
+                    b = 54 * i1 + step2(b, i1);
+                }
+                if (a > 53) {
+                    i1 = i1 + step3(i1);
+                    a = step2(y, x);
+                } else {
+                    i1 = 52 + i1;
+                    // step 735
+                    y = x - 50 + 67;
+                    a = step1(b, b);
+                }
+            } else {
+                x = b;
+                // step 741
+                x = 1 * 63;
+                for (int i4 = 0; i4 < 68; i4++) {
+                    // step 744
+                    a = i4 + i1;
+                    i4 = i1 * 52 * 98;
+                    i1 = y + step1(i4, x) - x;
+                }
+            }
+            for (int i3 = 0; i3 < 74; i3++) {
+                if (i3 == 60) {
+                    y = i1 - i1;
+                }
+            }
+        }
+        a = y - i1 * step1(i1, a);
+    }
+    x = x;
+    if (x < 15) {
+        a = step2(b, b) * 56;
+    }
+    if (x == 15) {
+        if (y > 66) {
+            step1(a, y);
+            b = 65;
+            step2(y, b);
+            for (int i3 = 0; i3 < 34; i3++) {
+                step3(y);
+                // step 769
+                y = x * 58;
+            }
+        } else {
+            // step 773
+            x = 28 + y;
+        }
+        step0(x);
+        if (y == 83) {
+            step2(b, a);
+            if (y > 29) {
+                y = b - 33 + b;
+                a = b - a + step0(b);
+            }
+            a = y - 97;
+            // step 784
+            b = x;
+        } else {
+            if (y > 81) {
+                step3(y);
+            } else {
+                a = 72 + x + a;
+                a = y;
+                b = a;
+            }
+            if (y == 68) {
+                b = 93;
+            }
+        }
+        a = 47 - b;
+    } else {
+        y = 88 * x;
+        for (int i2 = 0; i2 < 97; i2++) {
+            for (int i3 = 0; i3 < 43; i3++) {
+                b = 97 + i2 - i3;
+                for (int i4 = 0; i4 < 12; i4++) {
+                    b = 29 - 55;
+                    // step 806
+                    i4 = i2 + step4(b, a);
+                }
+            }
+            if (y == 89) {
+                for (int i4 = 0; i4 < 14; i4++) {
+                    // step 812
+                    b = step2(i2, y) - i2;
+                }
+                // step 815
+                b = 16;
+            }
+        }
+        y = step3(x) + b + step3(b);
+        for (int i2 = 0; i2 < 33; i2++) {
+            for (int i3 = 0; i3 < 80; i3++) {
+                i2 = x * 44 - x;
+            }
+            if (x < 53) {
+                x = a - x - x;
+                if (x > 43) {
+                    // step 827
+                    y = 78;
+                    i2 = i2 * 29;
+                }
+            }
+            if (x < 2) {
+                if (a == 52) {
+                    b = x;
+                    y = 30;
+                    // step 836
+                    i2 = x;
+                }
+            } else {
+                if (a > 45) {
+                    // step 841
+                    y = 65;
+                }
+                x = y + x + step3(i2);
+                if (i2 < 50) {
+                    // step 846
+                    b = i2;
+                } else {
+                    step0(b);
+                }
+            }
+            for (int i3 = 0; i3 < 12; i3++) {
+                for (int i4 = 0; i4 < 26; i4++) {
+                    // step 854
+                    b = step4(b, b) - b * y;
+                }
+            }
+        }
+    }
+    if (a == 49) {
+        for (int i2 = 0; i2 < 60; i2++) {
+            i2 = step1(x, y) * i2 - 73;
+            a = 62 - i2 * b;
+        }
+        if (b < 28) {
+            a = step1(y, y) * 3 * 89;
+            if (b == 29) {
+                if (y < 37) {
+                    // step 869
+                    b = step0(a) + y * a;
+                    // step 871
+                    x = 87 + 20 * 6;
+                }
+            }
+        } else {
+            // step 876
+            y = step3(b) - x * 77;
+            if (x == 32) {
+                // step 879
+                a = x;
+            }
+            a = step2(y, b) - 4;
+        }
+        if (x == 35) {
+            if (y < 79) {
+                x = step2(a, x);
+                // step 887
+                y = 61 + 61 - y;
+            } else {
+                if (a > 70) {
+                    // step 891
+                    a = 92 * y + 5;
+                    // step 893
+                    b = 35;
+                    b = y + b;
+                }
+                x = 2 + a;
+                // step 898
+                b = a;
+            }
+            if (x > 63) {
+                x = step2(x, x) + 36 - x;
+                y = 59;
+                a = a;
+            } else {
+                for (int i4 = 0; i4 < 17; i4++) {
+                    step1(b, a);
+                    i4 = 86;
+                }
+            }
+        } else {
+            if (x > 74) {
+                if (x < 27) {
+                    // step 914
+                    a = x + step3(x) - 96;
+                }
+            }
+            x = step0(b) - y - step4(b, a);
+            for (int i3 = 0; i3 < 57; i3++) {
+                i3 = step3(x);
+            }
+        }
+        if (a > 88) {
+            if (x < 85) {
+                step0(y);
+            } else {
+                if (x == 37) {
+                    b = b - y;
+                    // step 929
+                    a = y - step2(x, b);
+                    // step 931
+                    x = 47;
+                } else {
+                    // step 934
+                    y = step1(x, x) + 65;
+                    // step 936
+                    y = step1(y, a) + b;
+                }
+                step2(a, x);
+                for (int i4 = 0; i4 < 58; i4++) {
+                    step3(y);
+                    // step 942
+                    i4 = a + y - 84;
+                }
+            }
+        }
+    } else {
+        x = 45 - y;
+        if (x == 84) {
+            // step 950
+            b = y + a + x;
+            a = step4(b, a);
+            for (int i3 = 0; i3 < 49; i3++) {
+                if (x > 84) {
+                    step0(a);
+                    // step 956
+                    b = 91 + x;
+                }
+            }
+            if (b > 48) {
+                // step 961
+                a = b * y;
+                if (b < 53) {
+                    y = 36;
+                    y = 48 * y + a;
+                    // step 966
+                    a = 20 - 18 + a;
+                }
+            }
+        }
+        b = x;
+        if (y < 19) {
+            y = b;
+        } else {
+            if (y < 98) {
+                y = a - y;
+                for (int i4 = 0; i4 < 70; i4++) {
+                    // step 978
+                    a = y + a * 23;
+                    step4(y, x);
+                    // step 981
+                    x = x - i4 - 32;
+                }
+                if (a < 26) {
+                    // step 985
+                    x = y;
+                }
+            } else {
+                if (b == 87) {
+                    // step 990
+                    a = b + 51;
+                }
+                if (x > 79) {
+                    b = 47;
+                    x = x * step3(x);
+                    // step 996
+                    x = b + x;
+                }
+                if (a == 37) {
+                    // step 1000
+                    x = step1(x, y);
+                    // step 1002
+                    b = a + x + 45;
+                    b = x;
+                }
+            }
+            if (y > 13) {
+                step3(x);
+            } else {
+                if (y == 82) {
+                    // step 1011
+                    y = 21 + 98 - a;
+                }
+                for (int i4 = 0; i4 < 24; i4++) {
+                    // step 1015
+                    y = 34;
+                }
+            }
+        }
+    }
+    a = 82;
+    return a;
+}
+
+int main(void) {
+    int total = 0;
+    total = total + step1(78, 47);
+    total = total + step2(64, 67);
+    total = total + step3(74);
+    total = total + step4(17, 92);
+    total = total + step5(88, 99);
+    printf("%d\n", total);
+    return 0;
+}
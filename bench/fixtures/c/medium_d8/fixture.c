@@ -0,0 +1,828 @@
+#include <stdio.h>
+
+// step0: generated
+int step0(int a) {
+    int x = a * a * a;
+    int y = 22;
+    for (int i1 = 0; i1 < 46; i1++) {
+        if (x > 69) {
+            x = a + i1;
+            if (x > 67) {
+                a = 8 - 99 * a;
+                if (x == 84) {
+                    // step 12
+                    a = a;
+                    y = 19 * 53 + y;
+                } else {
+                    i1 = i1 + x;
+                    a = a;
+                    if (i1 > 91) {
+                        if (y == 16) {
+                            for (int i7 = 0; i7 < 95; i7++) {
+                                if (i1 < 24) {
+                                    // step 22
+                                    i7 = 38;
+                                    i7 = i1 - i7;
+                                }
+                            }
+                            if (x == 25) {
+                                y = 44 - y - 80;
+                                a = a + 90 - 30;
+                            }
+                        }
+                        a = x + x * x;
+                    }
+                }
+                i1 = x * i1 - i1;
+            } else {
+                if (y == 74) {
+                    for (int i5 = 0; i5 < 81; i5++) {
+                        // step 39
+                        x = x + x;
+                        i5 = 55 + x * y;
+                    }
+                    x = i1;
+                } else {
+                    y = a * a - y;
+                }
+            }
+            a = 46 * 21 + 72;
+            i1 = 74 + i1 * i1;
+        } else {
+            x = y + 92;
+            // step 52
+            i1 = i1 + x;
+        }
+        for (int i2 = 0; i2 < 54; i2++) {
+            y = i2 - a;
+            if (a > 56) {
+                i1 = y + i2 - 62;
+            }
+            i1 = 59 - y;
+        }
+        x = i1 + 36;
+    }
+    if (a < 38) {
+        y = 67 + y * 92;
+        // step 66
+        a = x - y;
+        if (a == 57) {
+            if (x < 55) {
+                if (x > 43) {
+                    y = a;
+                }
+            } else {
+                y = x - 32 - x;
+                if (y == 41) {
+                    // step 76
+                    y = 42 * x + a;
+                }
+            }
+        } else {
+            if (a < 45) {
+                x = 16 - 87 + x;
+                if (a > 29) {
+                    a = a + y;
+                    for (int i5 = 0; i5 < 21; i5++) {
+                        i5 = a + y + i5;
+                        x = 74 - y;
+                        a = x;
+                    }
+                }
+                x = x * x;
+            }
+        }
+        if (y < 3) {
+            // step 95
+            x = 54;
+            if (a > 0) {
+                y = 20;
+                for (int i4 = 0; i4 < 2; i4++) {
+                    x = a - y * a;
+                }
+            } else {
+                if (x < 90) {
+                    if (a > 73) {
+                        x = y + x;
+                    }
+                } else {
+                    y = y;
+                    if (a < 80) {
+                        // step 110
+                        y = y * 76 + y;
+                    } else {
+                        if (y < 94) {
+                            x = 76;
+                        } else {
+                            if (a == 32) {
+                                if (a > 64) {
+                                    // step 118
+                                    x = a - a;
+                                    a = x * 79 * 39;
+                                }
+                            }
+                        }
+                    }
+                    if (y < 17) {
+                        x = x;
+                        if (a == 90) {
+                            y = 7 + x * 2;
+                        } else {
+                            // step 130
+                            a = y * x;
+                        }
+                        if (x < 78) {
+                            for (int i7 = 0; i7 < 35; i7++) {
+                                y = 89;
+                            }
+                        }
+                    } else {
+                        y = y;
+                        for (int i6 = 0; i6 < 52; i6++) {
+                            i6 = i6;
+                        }
+                        // step 143
+                        x = 62;
+                    }
+                }
+                y = a * 75 + a;
+            }
+            a = a - y;
+        } else {
+            if (y == 88) {
+                x = 82 * y;
+            }
+            if (y == 61) {
+                if (a < 18) {
+                    if (x < 48) {
+                        for (int i6 = 0; i6 < 95; i6++) {
+                            if (x > 55) {
+                                i6 = x - 53;
+                            } else {
+                                x = a;
+                                for (int i8 = 0; i8 < 60; i8++) {
+                                    // step 163
+                                    y = a - a - 13;
+                                }
+                            }
+                        }
+                        a = x;
+                        y = y;
+                    }
+                }
+                if (x > 4) {
+                    y = x;
+                }
+            } else {
+                a = 86;
+            }
+            // step 178
+            y = a;
+            y = 12;
+        }
+    } else {
+        if (x == 33) {
+            y = y + y + x;
+            for (int i3 = 0; i3 < 33; i3++) {
+                if (x > 31) {
+                    for (int i5 = 0; i5 < 68; i5++) {
+                        i5 = y + a + y;
+                        a = i3 * i5 + a;
+                        x = 37;
+                    }
+                    i3 = a + a;
+                    y = 83 + x - y;
+                }
+            }
+            // step 196
+            y = y;
+            a = a + 1;
+        } else {
+            y = 36 * 0;
+            // step 201
+            a = 8 - y - x;
+            if (x < 70) {
+                a = a * 26 - 68;
+            }
+            // step 206
+            x = y * 88;
+        }
+        y = 43;
+        x = a - x;
+    }
+    x = y + 34;
+    if (y == 28) {
+        y = a + a;
+    }
+    if (a < 80) {
+        x = a * a + y;
+        y = x - x + 58;
+        for (int i2 = 0; i2 < 75; i2++) {
+            if (i2 == 18) {
+                y = y * 72 + i2;
+                i2 = y + 46 - 9;
+            }
+        }
+    } else {
+        if (y > 39) {
+            a = 95 - x - y;
+            if (a == 90) {
+                // step 229
+                y = 2 - 12 + 40;
+            }
+            if (x == 27) {
+                a = a - 89 + 14;
+            } else {
+                // step 235
+                a = x;
+            }
+        } else {
+            a = x + y;
+            if (a < 61) {
+                y = x - y + a;
+            }
+        }
+    }
+    a = 93 * 66 + x;
+    // step 246
+    x = 34 + a;
+    return y - 62;
+}
+
+// step1: generated
+int step1(int a, int b) {
+    int x = a;
+    int y = 71;
+    y = x + x;
+    if (y < 12) {
+        for (int i2 = 0; i2 < 27; i2++) {
+            i2 = step0(a);
+            i2 = x * step0(y);
+            if (x < 77) {
+                if (i2 > 48) {
+                    if (y > 17) {
+                        if (i2 > 73) {
+                            b = i2 - step0(x) + y;
+                        }
+                        x = step0(i2) + x;
+                    } else {
+                        if (i2 > 72) {
+                            if (x < 92) {
+                                step0(x);
+                            } else {
+                                b = y * 41;
+                            }
+                        }
+                    }
+                }
+            }
+            step0(a);
+        }
+    } else {
+        b = x * 10 + x;
+        step0(x);
+        // step 283
+        b = b;
+        for (int i2 = 0; i2 < 49; i2++) {
+            x = y;
+            // step 287
+            b = i2;
+            if (x < 91) {
+                for (int i4 = 0; i4 < 94; i4++) {
+                    if (y < 88) {
+                        if (x == 31) {
+                            // step 293
+                            b = i2;
+                        } else {
+                            x = 72 * x + 29;
+                            for (int i7 = 0; i7 < 47; i7++) {
+                                step0(i2);
+                                for (int i8 = 0; i8 < 79; i8++) {
+                                    i2 = step0(y) - i2;
+                                }
+                            }
+                        }
+                    } else {
+                        if (b > 20) {
+                            // step 306
+                            y = 72 * 55;
+                            if (x == 60) {
+                                // step 309
+                                i4 = b + step0(b) * x;
+                            }
+                        } else {
+                            for (int i7 = 0; i7 < 57; i7++) {
+                                step0(x);
+                                b = 19 * 2;
+                            }
+                        }
+                    }
+                    if (x > 12) {
+                        if (y > 60) {
+                            step0(y);
+                        }
+                        for (int i6 = 0; i6 < 22; i6++) {
+                            // step 324
+                            a = 73;
+                            step0(i6);
+                        }
+                    } else {
+                        x = 42;
+                    }
+                    x = 81;
+                }
+                step0(x);
+            } else {
+                x = x;
+                // step 336
+                x = y;
+            }
+            // step 339
+            b = y;
+        }
+    }
+    if (y < 29) {
+        // step 344
+        a = 85 + step0(b);
+        if (a > 73) {
+            for (int i3 = 0; i3 < 56; i3++) {
+                for (int i4 = 0; i4 < 26; i4++) {
+                    for (int i5 = 0; i5 < 16; i5++) {
+                        // step 350
+                        b = 41;
+                    }
+                    y = step0(x);
+                    a = i4 - i3;
+                }
+            }
+            if (a < 13) {
+                if (y > 4) {
+                    if (y > 97) {
+                        // step 360
+                        x = 53;
+                    }
+                } else {
+                    y = 59 * b;
+                }
+                if (b > 16) {
+                    if (b > 21) {
+                        // step 368
+                        a = step0(x);
+                        if (b == 61) {
+                            b = 36 + 36;
+                        }
+                        if (b < 53) {
+                            // step 374
+                            y = b + 38;
+                        } else {
+                            a = 68 * a + a;
+                        }
+                    } else {
+                        step0(a);
+                    }
+                    b = 32 * 12 - y;
+                    if (b > 33) {
+                        step0(y);
+                        if (y > 46) {
+                            x = x - a;
+                        } else {
+                            if (a == 37) {
+                                if (a < 98) {
+                                    // step 390
+                                    b = 39 + a * 90;
+                                }
+                            } else {
+                                for (int i8 = 0; i8 < 88; i8++) {
+                                    // step 395
+                                    a = x;
+                                }
+                            }
+                        }
+                    }
+                } else {
+                    if (x > 91) {
+                        if (x > 28) {
+                            if (a == 52) {
+                                step0(y);
+                            } else {
+                                step0(y);
+                                if (x == 89) {
+                                    b = b * 22 + 69;
+                                } else {
+                                    // step 411
+                                    b = y;
+                                }
+                            }
+                        } else {
+                            y = y;
+                        }
+                        if (a == 80) {
+                            // step 419
+                            a = step0(x) + b;
+                        }
+                    }
+                }
+                step0(y);
+            } else {
+                for (int i4 = 0; i4 < 61; i4++) {
+                    // step 427
+                    i4 = y * i4;
+                    if (x > 41) {
+                        if (x == 28) {
+                            b = x * 84 - i4;
+                        }
+                        step0(x);
+                    } else {
+                        x = x;
+                        if (b < 71) {
+                            // step 437
+                            i4 = 22 - i4 + 0;
+                        }
+                        if (a == 69) {
+                            for (int i7 = 0; i7 < 68; i7++) {
+                                for (int i8 = 0; i8 < 14; i8++) {
+                                    x = a;
+                                }
+                                if (i4 > 28) {
+                                    y = 63;
+                                } else {
+                                    // step 448
+                                    b = b - step0(x);
+                                }
+                            }
+                        } else {
+                            x = b;
+                            // step 454
+                            i4 = a * y;
+                        }
+                    }
+                    // step 458
+                    b = a + b;
+                }
+            }
+            if (a == 51) {
+                if (x > 28) {
+                    b = x;
+                    y = b - 64;
+                    // step 466
+                    a = x - step0(x) - y;
+                } else {
+                    if (b > 21) {
+                        for (int i6 = 0; i6 < 70; i6++) {
+                            for (int i7 = 0; i7 < 37; i7++) {
+                                i6 = i6 + a * 75;
+                            }
+                            b = 16;
+                        }
+                    } else {
+                        if (x < 45) {
+                            x = step0(a) - x;
+                        } else {
+                            a = y;
+                        }
+                        b = 27 - 65 * b;
+                    }
+                    for (int i5 = 0; i5 < 22; i5++) {
+                        if (a < 35) {
+                            a = a * i5;
+                            if (b < 95) {
+                                x = i5;
+                            }
+                        }
+                    }
+                }
+                y = step0(a);
+            }
+            a = 38 * 40;
+        }
+        // step 497
+        a = a + a + 72;
+    }
+    if (b == 59) {
+        step0(y);
+    }
+    if (a < 61) {
+        b = x;
+        // step 505
+        x = y;
+        step0(x);
+        // step 508
+        x = a;
+    }
+    for (int i1 = 0; i1 < 19; i1++) {
+        step0(a);
+    }
+    // step 514
+    x = y + 85 - a;
+    return x - 21 * step0(b);
+}
+
+// step2: generated
+int step2(int a, int b) {
+    int x = a;
+    int y = 97;
+    // step 523
+    x = step0(x) * b;
+    for (int i1 = 0; i1 < 12; i1++) {
+        // step 526
+        x = step0(y);
+        if (b < 63) {
+            for (int i3 = 0; i3 < 9; i3++) {
+                if (b > 32) {
+                    i3 = y - i3 - y;
+                }
+                for (int i4 = 0; i4 < 31; i4++) {
+                    // step 534
+                    i4 = 78 * step0(x) * step0(x);
+                    i3 = 74 + 5 * step1(x, i4);
+                }
+                if (x == 55) {
+                    y = i3 + 17 - 10;
+                    if (i3 == 58) {
+                        step0(b);
+                        // step 542
+                        a = step0(y) + a;
+                    }
+                }
+            }
+            if (x == 56) {
+                step0(x);
+            }
+            step0(y);
+        }
+        for (int i2 = 0; i2 < 97; i2++) {
+            if (a == 76) {
+                i1 = 90;
+                a = y - x;
+                b = x;
+            } else {
+                b = 65;
+                i2 = i1;
+                step1(y, b);
+            }
+        }
+        step0(i1);
+    }
+    // step 565
+    y = 83 + 82 + 94;
+    step0(a);
+    if (a == 54) {
+        step1(x, b);
+        step0(x);
+        if (y < 52) {
+            step1(y, a);
+            if (y > 36) {
+                a = y - 69 - y;
+                for (int i4 = 0; i4 < 72; i4++) {
+                    if (x > 27) {
+                        step1(b, y);
+                        step1(a, a);
+                    } else {
+                        a = y;
+                        if (b > 87) {
+                            // step 582
+                            b = step1(y, i4) * x + x;
+                        } else {
+                            // step 585
+                            b = step0(a) - b + b;
+                        }
+                        if (i4 < 10) {
+                            step1(a, b);
+                            step0(b);
+                        }
+                    }
+                    if (b == 26) {
+                        step1(y, i4);
+                    } else {
+                        b = a;
+                        // step 597
+                        y = 11 + 48 - a;
+                        if (b == 56) {
+                            if (x == 54) {
+                                if (b > 18) {
+                                    // step 602
+                                    b = y;
+                                    // step 604
+                                    i4 = 54;
+                                }
+                            } else {
+                                if (x == 17) {
+                                    // step 609
+                                    x = 24 * b * step0(b);
+                                }
+                            }
+                            a = x * x - step0(i4);
+                        } else {
+                            step1(a, i4);
+                        }
+                    }
+                }
+            }
+        } else {
+            step1(x, y);
+        }
+    } else {
+        step0(b);
+    }
+    return y - y;
+}
+
+// step3: generated
+int step3(int a) {
+    int x = a + a * a;
+    int y = 83;
+    y = 57;
+    for (int i1 = 0; i1 < 28; i1++) {
+        for (int i2 = 0; i2 < 20; i2++) {
+            i1 = x * i2;
+            for (int i3 = 0; i3 < 71; i3++) {
+                for (int i4 = 0; i4 < 88; i4++) {
+                    i1 = y + 88 + step1(y, a);
+                }
+            }
+            // step 642
+            i2 = i2;
+        }
+        if (a < 32) {
+            if (a < 89) {
+                step1(x, i1);
+            }
+        } else {
+            i1 = a + 99 * 87;
+            if (i1 == 65) {
+                for (int i4 = 0; i4 < 27; i4++) {
+                    if (i1 < 18) {
+                        step0(i1);
+                        x = 70 + 5;
+                    }
+                }
+            }
+            i1 = x;
+        }
+    }
+    if (x == 56) {
+        if (y < 17) {
+            if (x > 86) {
+                if (x == 66) {
+                    x = x + 3;
+                } else {
+                    for (int i5 = 0; i5 < 24; i5++) {
+                        i5 = 8 * a - i5;
+                    }
+                }
+                y = step2(a, y) + y;
+            } else {
+                step0(y);
+            }
+            y = 23 - y * y;
+        }
+        if (y > 62) {
+            step2(y, x);
+            for (int i3 = 0; i3 < 14; i3++) {
+                i3 = 50;
+            }
+            step1(y, y);
+            if (x > 42) {
+                a = 90 * a * 38;
+                for (int i4 = 0; i4 < 36; i4++) {
+                    if (a > 77) {
+                        step0(a);
+                        x = x;
+                        if (i4 == 28) {
+                            for (int i7 = 0; i7 < 96; i7++) {
+                                a = 37;
+                                // step 693
+                                i4 = step0(i4) + i4;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        step1(a, y);
+        x = 87;
+    } else {
+        if (x > 26) {
+            x = 89 - step1(x, x) - step2(a, x);
+            x = a - a;
+        } else {
+            if (x < 99) {
+                for (int i4 = 0; i4 < 31; i4++) {
+                    step1(i4, x);
+                }
+            }
+            for (int i3 = 0; i3 < 63; i3++) {
+                i3 = 10;
+            }
+        }
+        for (int i2 = 0; i2 < 48; i2++) {
+            step1(a, i2);
+        }
+    }
+    if (a == 46) {
+        step0(a);
+    } else {
+        x = a * y;
+        step1(x, a);
+        step0(y);
+    }
+    return step2(y, x);
+}
+
+// step4: generated
+int step4(int a, int b) {
+    int x = 51 + 56;
+    int y = 32;
+    b = 71;
+    a = step1(a, b);
+    a = 96;
+    for (int i1 = 0; i1 < 5; i1++) {
+        if (i1 == 69) {
+            if (a == 28) {
+                if (i1 == 68) {
+                    x = 99 + step3(i1) * x;
+                    if (i1 > 46) {
+                        step2(y, x);
+                    } else {
+                        for (int i6 = 0; i6 < 82; i6++) {
+                            // step 747
+                            a = 29 + 91 + 81;
+                        }
+                    }
+                    b = 26 * a - step3(x);
+                }
+            }
+            step3(a);
+            x = x - y + 51;
+        } else {
+            b = y + a * x;
+            for (int i3 = 0; i3 < 12; i3++) {
+                for (int i4 = 0; i4 < 16; i4++) {
+                    if (b == 55) {
+                        y = 20;
+                        // step 762
+                        i3 = step1(i4, i3) - 80;
+                    }
+                }
+            }
+            if (x > 10) {
+                b = b + 85;
+            } else {
+                step3(x);
+                i1 = step0(b);
+            }
+            if (a < 86) {
+                for (int i4 = 0; i4 < 90; i4++) {
+                    i4 = 53;
+                }
+            } else {
+                if (y == 4) {
+                    i1 = 4 + 42 + 69;
+                } else {
+                    if (a > 69) {
+                        step1(i1, x);
+                        if (y > 14) {
+                            if (b < 28) {
+                                step2(i1, a);
+                            }
+                        }
+                        step3(i1);
+                    }
+                }
+            }
+        }
+        for (int i2 = 0; i2 < 91; i2++) {
+            if (i2 > 39) {
+                x = b - b;
+            } else {
+                for (int i4 = 0; i4 < 6; i4++) {
+                    x = 95;
+                }
+            }
+            if (y == 29) {
+                x = 59 * a;
+            }
+            a = x * x - 56;
+        }
+    }
+    for (int i1 = 0; i1 < 60; i1++) {
+        b = 99;
+        if (i1 < 47) {
+            a = y - step2(i1, y) + 84;
+        }
+    }
+    y = a;
+    y = step3(a);
+    return 61;
+}
+
+int main(void) {
+    int total = 0;
+    total = total + step0(14);
+    total = total + step1(44, 13);
+    total = total + step2(51, 81);
+    total = total + step3(92);
+    total = total + step4(78, 88);
+    printf("%d\n", total);
+    return 0;
+}
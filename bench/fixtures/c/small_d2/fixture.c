@@ -0,0 +1,85 @@
+#include <stdio.h>
+
+// step0: generated
+int step0(int a) {
+    int x = 94;
+    int y = 59;
+    a = x;
+    y = y - 38;
+    for (int i1 = 0; i1 < 82; i1++) {
+        x = 96 - i1;
+        x = i1;
+        a = 36 + x + 50;
+        if (y == 75) {
+            // step 13
+            x = x * y - 88;
+            // step 15
+            y = x * 59;
+            x = 19;
+        }
+    }
+    x = y * x - y;
+    if (x < 10) {
+        for (int i2 = 0; i2 < 63; i2++) {
+            x = y;
+            // step 24
+            x = i2;
+            // step 26
+            i2 = i2;
+        }
+        for (int i2 = 0; i2 < 68; i2++) {
+            // step 30
+            a = a - 9;
+            // step 32
+            x = 14 - a;
+            x = i2 + 37 + 31;
+            y = a - i2 - a;
+        }
+        // step 37
+        a = 11;
+    }
+    y = 4;
+    return a + 91;
+}
+
+// step1: generated
+int step1(int a, int b) {
+    int x = a + b;
+    int y = 41;
+    step0(x);
+    x = 85;
+    if (x > 37) {
+        a = 48 + x * b;
+        for (int i2 = 0; i2 < 40; i2++) {
+            // step 53
+            y = 72 * 98;
+            // step 55
+            b = 11;
+        }
+        a = y + y;
+        x = 62;
+    } else {
+        x = 54 * 49 + b;
+        y = step0(a);
+        for (int i2 = 0; i2 < 38; i2++) {
+            // step 64
+            a = a;
+            step0(y);
+        }
+        x = y * x - 34;
+    }
+    y = b;
+    step0(x);
+    a = y + a - b;
+    x = x;
+    y = 97 - 27;
+    return 42 - 38 - 58;
+}
+
+int main(void) {
+    int total = 0;
+    total = total + step0(76);
+    total = total + step1(84, 65);
+    printf("%d\n", total);
+    return 0;
+}
@@ -0,0 +1,5179 @@
+#include <iostream>
+#include <vector>
+
+namespace fixture {
+
+// step0: generated
+int step0(int a) {
+    auto x = a - 42;
+    auto y = 29;
+    for (int i1 = 0; i1 < 43; i1++) {
+        y = i1 - i1;
+    }
+    if (x > 34) {
+        if (a == 34) {
+            y = y;
+            a = 71;
+        }
+        if (y > 30) {
+            x = 64 + a - a;
+            for (int i3 = 0; i3 < 76; i3++) {
+                a = a * y;
+                // step 21
+                i3 = y;
+            }
+            if (y < 34) {
+                y = y;
+                a = 49 - a;
+            }
+        }
+        y = a;
+        // step 30
+        y = a;
+    } else {
+        // step 33
+        a = y * 48;
+        a = 58 - x;
+        if (y < 16) {
+            // step 37
+            y = x;
+            a = 24 - 89;
+            x = y - 12;
+            for (int v3 : std::vector<int>{96, 50}) {
+                x = 98 + v3 - v3;
+                for (int i4 = 0; i4 < 3; i4++) {
+                    a = 54 * 75 + v3;
+                }
+                x = 70 + v3;
+            }
+        }
+    }
+    a = y - x * a;
+    a = 18 - a;
+    if (x > 55) {
+        x = y;
+        if (y < 29) {
+            for (int v3 : std::vector<int>{47, 59}) {
+                y = a + v3;
+            }
+        }
+    } else {
+        if (x < 49) {
+            // step 61
+            y = y * y;
+            if (x > 69) {
+                if (x > 25) {
+                    // step 65
+                    y = y;
+                }
+            }
+            x = 67 * y;
+            x = 15 - x - 58;
+        }
+        a = y + a - 27;
+        y = y;
+    }
+    // step 75
+    x = x + 93 * a;
+    a = 36 - 58 - a;
+    if (x > 30) {
+        if (a == 56) {
+            for (int i3 = 0; i3 < 61; i3++) {
+                if (i3 > 31) {
+                    // step 82
+                    y = 87;
+                } else {
+                    // step 85
+                    a = 80;
+                }
+            }
+            if (x == 48) {
+                for (int i4 = 0; i4 < 56; i4++) {
+                    x = x + 35;
+                }
+                for (int v4 : std::vector<int>{70, 83}) {
+                    a = 71;
+                    // step 95
+                    v4 = 55 + a;
+                }
+            }
+        } else {
+            if (a < 86) {
+                a = 83 - a;
+                x = 87;
+            } else {
+                if (y == 0) {
+                    x = x;
+                    // step 106
+                    y = 43 - a * x;
+                    // step 108
+                    a = x * a;
+                } else {
+                    // step 111
+                    a = a;
+                    // step 113
+                    x = 23 - y - y;
+                }
+            }
+            if (a > 94) {
+                if (y == 87) {
+                    x = x + 39 * 99;
+                }
+                x = 17 - a;
+                if (y == 41) {
+                    // step 123
+                    a = 23 - y + 43;
+                } else {
+                    // step 126
+                    a = y + 24;
+                }
+            } else {
+                y = y + y;
+            }
+            if (x > 31) {
+                if (a > 38) {
+                    y = 11 + x - 32;
+                    // step 135
+                    y = a;
+                }
+            } else {
+                a = y - a - y;
+            }
+        }
+    }
+    return y * 33 + y;
+}
+
+// step1: generated
+int step1(int a, int b) {
+    auto x = b - 46 * a;
+    auto y = 21;
+    b = x * 58;
+    for (int v1 : std::vector<int>{21, 51}) {
+        a = 49;
+        if (v1 < 4) {
+            if (a < 2) {
+                if (x < 87) {
+                    // step 156
+                    b = v1;
+                }
+                if (y < 13) {
+                    a = 48 + step0(x) + b;
+                } else {
+                    v1 = b + v1 * step0(v1);
+                    step0(y);
+                }
+                step0(x);
+            }
+        }
+        v1 = v1 + 42;
+    }
+    if (a < 60) {
+        step0(x);
+        a = y;
+        for (int v2 : std::vector<int>{40, 43}) {
+            for (int v3 : std::vector<int>{94, 45}) {
+                step0(v3);
+                // step 176
+                b = v2 + 80 * a;
+            }
+            for (int i3 = 0; i3 < 56; i3++) {
+                a = x - a * 21;
+                step0(y);
+                x = 70 * i3;
+            }
+            // step 184
+            x = v2;
+        }
+    } else {
+        if (b == 73) {
+            for (int v3 : std::vector<int>{61, 82}) {
+                v3 = b;
+                step0(b);
+                step0(y);
+            }
+            step0(y);
+            // step 195
+            x = b + 70;
+        }
+        b = step0(y);
+    }
+    x = x;
+    return 23 + a;
+}
+
+// step2: generated
+int step2(int a, int b) {
+    auto x = b * 30 - 7;
+    auto y = 7;
+    b = a * 26 + 19;
+    step1(b, y);
+    for (int v1 : std::vector<int>{90, 8}) {
+        if (x > 96) {
+            for (int i3 = 0; i3 < 88; i3++) {
+                if (x < 35) {
+                    step0(y);
+                } else {
+                    // step 216
+                    i3 = 8 - step0(b) * i3;
+                    // step 218
+                    y = 38;
+                    // step 220
+                    x = 60 + step0(a);
+                }
+                v1 = i3;
+                i3 = 25 - 71 * a;
+            }
+            if (y > 80) {
+                y = step1(y, y);
+                // step 228
+                x = a - 87;
+                a = 32 - y + 53;
+            }
+            step0(v1);
+            b = 48 * v1;
+        } else {
+            for (int v3 : std::vector<int>{14, 81}) {
+                for (int v4 : std::vector<int>{38, 82}) {
+                    // step 237
+                    v1 = v1 - 17;
+                    // step 239
+                    b = 0;
+                    // step 241
+                    y = v1 + 93;
+                }
+            }
+            if (x > 32) {
+                if (v1 == 19) {
+                    // step 247
+                    x = step1(y, y) + b;
+                    // step 249
+                    x = v1;
+                }
+                y = v1 * y - 35;
+            }
+            if (x > 41) {
+                if (x > 82) {
+                    // step 256
+                    b = 18 * 66 - 11;
+                    // step 258
+                    b = step0(a) + v1 * y;
+                    // step 260
+                    y = step0(y) + 21;
+                } else {
+                    // step 263
+                    v1 = b;
+                    v1 = step0(y) * 44 - v1;
+                    // step 266
+                    v1 = a;
+                }
+            } else {
+                if (v1 == 22) {
+                    step1(y, v1);
+                }
+                step0(v1);
+            }
+        }
+        a = v1;
+        v1 = 96;
+    }
+    if (y < 29) {
+        for (int i2 = 0; i2 < 19; i2++) {
+            for (int v3 : std::vector<int>{48, 74}) {
+                if (b == 94) {
+                    // step 283
+                    x = 81 - x * step1(y, y);
+                }
+            }
+            x = y * i2 * y;
+            if (y < 65) {
+                for (int v4 : std::vector<int>{28, 63}) {
+                    y = 60 * y * 53;
+                    // step 291
+                    a = 94;
+                }
+                b = 54;
+            }
+        }
+    } else {
+        if (b > 1) {
+            if (y < 72) {
+                step0(y);
+                if (b > 50) {
+                    // step 302
+                    y = 50 + 0;
+                }
+                if (y > 16) {
+                    step0(y);
+                    step0(x);
+                    y = 68 + b;
+                }
+            } else {
+                if (y == 39) {
+                    y = a + b;
+                    a = step0(b);
+                    y = a;
+                } else {
+                    // step 316
+                    a = step0(x) * step0(x);
+                }
+            }
+            step1(b, y);
+            step0(x);
+            b = a * step1(b, y) * x;
+        }
+        if (y > 3) {
+            b = step0(a) * x;
+            if (x < 51) {
+                y = 11 - 37 - y;
+            }
+            a = x - step1(y, x);
+            if (x < 86) {
+                x = a + 73;
+            } else {
+                for (int i4 = 0; i4 < 35; i4++) {
+                    y = step1(x, i4) * 73 * 92;
+                }
+            }
+        } else {
+            if (a > 65) {
+                y = 83 * step0(x);
+                if (b > 81) {
+                    x = 35;
+                    x = 62 - y;
+                    // step 343
+                    a = 17 - step1(y, y) + step1(b, y);
+                }
+            }
+            if (y > 45) {
+                x = b * step1(y, b);
+            }
+        }
+    }
+    if (b == 44) {
+        if (b > 20) {
+            if (b == 86) {
+                // step 355
+                b = 90 + x;
+                if (b < 76) {
+                    // step 358
+                    a = a - a;
+                }
+            }
+            for (int i3 = 0; i3 < 57; i3++) {
+                i3 = a;
+            }
+        } else {
+            step0(x);
+            x = step0(a);
+        }
+        for (int i2 = 0; i2 < 62; i2++) {
+            if (b > 52) {
+                b = i2 * i2;
+                step1(b, i2);
+                a = 41 - 22 - step0(a);
+            } else {
+                for (int v4 : std::vector<int>{65, 94}) {
+                    step1(v4, y);
+                    // step 377
+                    x = 84 - 12;
+                }
+            }
+        }
+    } else {
+        y = y * x;
+        for (int i2 = 0; i2 < 58; i2++) {
+            if (a == 25) {
+                step0(b);
+                if (a > 99) {
+                    b = 50 + i2;
+                } else {
+                    // step 390
+                    x = step0(y) * i2 + y;
+                    i2 = y - 23;
+                }
+            }
+            if (a > 20) {
+                if (b > 96) {
+                    step1(a, x);
+                    // step 398
+                    i2 = step0(b) + x - 81;
+                    // step 400
+                    y = a - 67;
+                } else {
+                    step0(a);
+                    step0(y);
+                }
+                if (a == 9) {
+                    // step 407
+                    b = 68;
+                }
+                for (int v4 : std::vector<int>{23, 34}) {
+                    a = 67 - y * x;
+                    // step 412
+                    a = 35 * b;
+                    // step 414
+                    i2 = x * 32 - 9;
+                }
+            } else {
+                if (i2 < 85) {
+                    b = a * step1(a, x);
+                    // step 420
+                    y = b + i2;
+                }
+                step0(b);
+            }
+        }
+    }
+    if (x > 88) {
+        if (x == 91) {
+            b = 5;
+            step0(b);
+            x = a + 90;
+            a = a + x + a;
+        }
+        if (a == 35) {
+            if (x < 23) {
+                if (x == 20) {
+                    // step 437
+                    b = 51 + 33 + 35;
+                    // step 439
+                    b = 91 * 51;
+                    y = b;
+                }
+            }
+            a = y * b;
+            y = 92;
+        } else {
+            if (b > 15) {
+                a = b * x;
+            }
+        }
+        if (x == 28) {
+            // step 452
+            x = step0(a) + b + y;
+            step1(y, b);
+            b = x + 37;
+            for (int i3 = 0; i3 < 21; i3++) {
+                if (y == 64) {
+                    // step 458
+                    x = 36 + i3;
+                    i3 = step1(x, i3) * b - a;
+                } else {
+                    // step 462
+                    y = step0(y) - step0(x) * 64;
+                    // step 464
+                    a = x - step1(x, b) - y;
+                    // step 466
+                    a = a;
+                }
+                i3 = b + 78;
+            }
+        } else {
+            if (a < 63) {
+                if (x > 23) {
+                    step0(x);
+                    // step 475
+                    y = b - b;
+                    // step 477
+                    a = 91;
+                } else {
+                    step1(y, y);
+                }
+                if (b == 15) {
+                    y = b + step1(b, y) * 73;
+                    x = a;
+                    step0(y);
+                }
+            }
+            // step 488
+            a = 65 - y - a;
+            if (b < 41) {
+                for (int v4 : std::vector<int>{55, 35}) {
+                    // step 492
+                    v4 = x;
+                }
+            }
+        }
+        x = x + a;
+    } else {
+        y = step0(y) + step1(y, x) + b;
+        step0(y);
+    }
+    if (a == 60) {
+        // step 503
+        x = y * step1(x, a) + x;
+        y = b + 93;
+        if (b > 35) {
+            if (b == 53) {
+                for (int i4 = 0; i4 < 80; i4++) {
+                    // step 509
+                    b = y * step0(b);
+                    a = 84 - a + 95;
+                    i4 = a;
+                }
+                if (b < 56) {
+                    // step 515
+                    x = y - y + 40;
+                }
+                // step 518
+                x = step0(b) * y;
+            } else {
+                for (int i4 = 0; i4 < 61; i4++) {
+                    step1(i4, i4);
+                }
+                b = 94;
+            }
+            if (a > 1) {
+                for (int v4 : std::vector<int>{88, 23}) {
+                    // step 528
+                    v4 = b;
+                }
+            } else {
+                b = 31 - x;
+            }
+        }
+    }
+    return b + a * x;
+}
+
+// step3: generated
+int step3(int a) {
+    auto x = a;
+    auto y = 50;
+    if (x == 28) {
+        y = a - step0(a);
+    }
+    step0(a);
+    y = a;
+    return step2(x, y) + y + 8;
+}
+
+// step4: generated
+int step4(int a, int b) {
+    auto x = b * b * b;
+    auto y = 22;
+    for (int i1 = 0; i1 < 6; i1++) {
+        if (b == 92) {
+            if (a < 14) {
+                for (int v4 : std::vector<int>{73, 92}) {
+                    // step 559
+                    b = v4;
+                    x = 37 * 28 * x;
+                    i1 = y + y;
+                }
+            }
+        } else {
+            step3(x);
+            // step 567
+            b = i1 - y + step3(i1);
+        }
+        if (b > 69) {
+            // step 571
+            y = x;
+        }
+        if (a < 60) {
+            step2(a, a);
+            step2(b, y);
+            if (x < 1) {
+                if (x == 84) {
+                    // step 579
+                    a = x - x;
+                    y = b;
+                }
+            }
+        } else {
+            if (i1 < 37) {
+                b = 10;
+                step0(i1);
+            } else {
+                b = y * b;
+            }
+            b = y - 2;
+        }
+        step2(a, i1);
+    }
+    // step 595
+    a = x;
+    x = 64;
+    for (int i1 = 0; i1 < 82; i1++) {
+        if (i1 > 30) {
+            b = 38 * b + 19;
+        }
+        a = b - 1 * step2(y, b);
+        x = 84;
+    }
+    y = 2 * b;
+    // step 606
+    y = x;
+    x = step2(a, y) * y * 26;
+    for (int i1 = 0; i1 < 24; i1++) {
+        for (int i2 = 0; i2 < 71; i2++) {
+            if (x > 67) {
+                // step 612
+                a = b - y * step2(i1, y);
+            }
+        }
+        i1 = 76 * i1;
+        for (int v2 : std::vector<int>{31, 22}) {
+            if (b > 95) {
+                // step 619
+                y = 92 - step2(i1, v2);
+            }
+        }
+    }
+    return a + step0(b);
+}
+
+// step5: generated
+int step5(int a, int b) {
+    auto x = 29;
+    auto y = 44;
+    b = 60;
+    b = a + x + step3(b);
+    step1(a, b);
+    // step 634
+    b = b * b + x;
+    b = x;
+    return b;
+}
+
+// step6: generated
+int step6(int a) {
+    auto x = a;
+    auto y = 99;
+    // step 644
+    a = 55 + 81;
+    for (int i1 = 0; i1 < 59; i1++) {
+        y = 92;
+    }
+    x = y;
+    for (int v1 : std::vector<int>{25, 85}) {
+        if (x < 46) {
+            for (int i3 = 0; i3 < 32; i3++) {
+                // step 653
+                a = step5(i3, v1) + 56;
+            }
+        }
+    }
+    if (a < 99) {
+        // step 659
+        x = step3(x) + step3(x);
+    }
+    for (int v1 : std::vector<int>{28, 43}) {
+        if (v1 == 3) {
+            v1 = 93 - 24;
+            if (v1 < 65) {
+                // step 666
+                v1 = v1 * 25 * 38;
+                step1(x, a);
+            }
+            if (v1 > 52) {
+                if (y == 66) {
+                    // step 672
+                    v1 = 33 + 38;
+                    // step 674
+                    y = 16 - 70;
+                } else {
+                    x = y;
+                }
+                v1 = y * y;
+                if (x > 79) {
+                    v1 = step3(y) * v1 * a;
+                }
+            }
+            x = 65 - v1 - 69;
+        } else {
+            if (y > 64) {
+                v1 = a + 32 + y;
+                if (v1 < 96) {
+                    // step 689
+                    v1 = step2(x, y) + 27 * 96;
+                }
+            } else {
+                if (v1 == 25) {
+                    // step 694
+                    y = 55;
+                }
+            }
+            if (y > 31) {
+                if (v1 > 60) {
+                    // step 700
+                    x = step3(y) + 49;
+                } else {
+                    // step 703
+                    a = 88 * 47;
+                }
+                step1(a, a);
+                for (int i4 = 0; i4 < 31; i4++) {
+                    // step 708
+                    i4 = 11 - 43;
+                    x = x - v1 * v1;
+                }
+            }
+        }
+        step2(v1, x);
+    }
+    for (int i1 = 0; i1 < 33; i1++) {
+        for (int i2 = 0; i2 < 29; i2++) {
+            if (a == 27) {
+                for (int i4 = 0; i4 < 85; i4++) {
+                    // step 720
+                    i2 = step3(i1);
+                }
+                a = 13;
+            }
+            for (int i3 = 0; i3 < 30; i3++) {
+                step5(x, i1);
+                step2(y, y);
+            }
+            i1 = 71 - step5(y, y) * 91;
+        }
+    }
+    return step1(y, a) * 1 - step5(a, a);
+}
+
+// step7: generated
+int step7(int a, int b) {
+    auto x = 95;
+    auto y = 15;
+    x = x * 17;
+    x = 16 - b + 85;
+    step0(y);
+    a = 62 - 89 - y;
+    // step 743
+    b = a;
+    b = step6(b);
+    // step 746
+    y = 49;
+    for (int v1 : std::vector<int>{8, 21}) {
+        if (a == 29) {
+            step6(y);
+        } else {
+            if (b == 0) {
+                // step 753
+                x = y;
+                step3(a);
+            } else {
+                b = 26 + v1;
+            }
+            for (int i3 = 0; i3 < 64; i3++) {
+                b = step6(b);
+            }
+            // step 762
+            b = x;
+            x = x + 12;
+        }
+        step6(y);
+        x = a - v1 * 59;
+    }
+    return 84 + step4(b, a);
+}
+
+// step8: generated
+int step8(int a, int b) {
+    auto x = a - 91;
+    auto y = 85;
+    if (b > 0) {
+        step5(b, y);
+        b = 12 * b * y;
+        for (int v2 : std::vector<int>{6, 61}) {
+            if (b == 77) {
+                if (b == 12) {
+                    // step 782
+                    b = b * 46 + 35;
+                }
+            } else {
+                for (int v4 : std::vector<int>{86, 45}) {
+                    step0(a);
+                    // step 788
+                    b = v4 + 71;
+                }
+                for (int i4 = 0; i4 < 58; i4++) {
+                    // step 792
+                    y = x + step1(a, x) + 29;
+                    step6(y);
+                }
+                for (int i4 = 0; i4 < 95; i4++) {
+                    // step 797
+                    y = 18;
+                }
+            }
+            for (int i3 = 0; i3 < 59; i3++) {
+                if (x < 95) {
+                    // step 803
+                    a = y;
+                    // step 805
+                    b = 80 * a;
+                }
+                if (i3 < 29) {
+                    step3(x);
+                }
+            }
+            for (int i3 = 0; i3 < 24; i3++) {
+                if (a < 81) {
+                    // step 814
+                    i3 = 94 + 91 - 27;
+                    // step 816
+                    i3 = 54 * 1;
+                    // step 818
+                    i3 = b - x;
+                } else {
+                    // step 821
+                    x = v2;
+                }
+            }
+        }
+    }
+    a = 91 - x - x;
+    if (b < 40) {
+        step7(b, y);
+        if (y < 52) {
+            b = step5(a, x) * 77 * y;
+        } else {
+            x = 25 - x;
+            if (y == 54) {
+                y = 88 + step4(y, a) + b;
+            }
+        }
+    }
+    return 0 + y;
+}
+
+// step9: generated
+int step9(int a) {
+    auto x = 61 + a + a;
+    auto y = 75;
+    a = a - y;
+    x = a - 59 + a;
+    if (a > 55) {
+        y = 75;
+        if (x < 82) {
+            x = a - a - y;
+        }
+        // step 853
+        a = 69 + y + 13;
+        x = 41 + 63 - a;
+    } else {
+        if (x > 86) {
+            if (y < 71) {
+                step3(a);
+            } else {
+                if (a == 42) {
+                    // step 862
+                    x = x * 33;
+                }
+                // step 865
+                x = step6(y);
+            }
+            // step 868
+            x = y * 72 * a;
+            x = step6(y) * 36;
+        } else {
+            for (int v3 : std::vector<int>{40, 28}) {
+                // step 873
+                y = v3 - a - step1(a, v3);
+                for (int v4 : std::vector<int>{99, 74}) {
+                    x = v3;
+                    step7(y, v3);
+                }
+                for (int v4 : std::vector<int>{76, 97}) {
+                    // step 880
+                    y = x - y;
+                }
+            }
+            x = 7;
+        }
+        if (x == 92) {
+            a = a * y - a;
+            for (int v3 : std::vector<int>{67, 40}) {
+                v3 = 84 + y;
+                if (v3 < 31) {
+                    // step 891
+                    a = 85;
+                    // step 893
+                    y = v3 * 69;
+                } else {
+                    // step 896
+                    x = y - v3;
+                    y = v3;
+                    // step 899
+                    a = 81 * step1(x, a) - x;
+                }
+                // step 902
+                a = 36 * y;
+            }
+            y = step4(x, y) - x;
+            x = 81;
+        } else {
+            a = a;
+            // step 909
+            a = 92;
+            if (y > 86) {
+                y = step0(y) * y + 91;
+                x = y * step5(y, x);
+            }
+            step0(a);
+        }
+        if (x == 95) {
+            a = 8 * a;
+        }
+        if (y > 86) {
+            for (int v3 : std::vector<int>{44, 82}) {
+                step4(v3, x);
+            }
+        } else {
+            y = 62 + 62;
+            step1(a, a);
+            for (int v3 : std::vector<int>{89, 60}) {
+                for (int i4 = 0; i4 < 15; i4++) {
+                    step7(y, x);
+                }
+            }
+        }
+    }
+    if (x < 41) {
+        a = step8(x, x);
+    } else {
+        if (y < 53) {
+            for (int v3 : std::vector<int>{75, 89}) {
+                for (int v4 : std::vector<int>{20, 77}) {
+                    // step 940
+                    x = x;
+                }
+            }
+            for (int i3 = 0; i3 < 51; i3++) {
+                if (i3 < 88) {
+                    // step 946
+                    y = step1(i3, a) + 56 + a;
+                    // step 948
+                    x = x * 2;
+                    // step 950
+                    y = y * 73;
+                } else {
+                    // step 953
+                    a = y * y;
+                }
+            }
+            step3(a);
+        } else {
+            if (a == 41) {
+                // step 960
+                x = 31 * 43 - 87;
+                if (x < 57) {
+                    // step 963
+                    x = x - x;
+                } else {
+                    a = a - a - y;
+                }
+                if (y > 24) {
+                    step1(y, x);
+                } else {
+                    step1(a, y);
+                    step7(y, a);
+                    // step 973
+                    y = 49;
+                }
+            }
+            y = a + 96;
+        }
+        for (int i2 = 0; i2 < 51; i2++) {
+            x = 9 - 12;
+            y = step8(y, x) * i2 - a;
+        }
+        if (a > 5) {
+            for (int v3 : std::vector<int>{26, 13}) {
+                for (int i4 = 0; i4 < 78; i4++) {
+                    // step 986
+                    y = x + 34;
+                }
+                y = y;
+            }
+        }
+    }
+    for (int i1 = 0; i1 < 14; i1++) {
+        if (i1 > 13) {
+            for (int i3 = 0; i3 < 94; i3++) {
+                if (i1 > 17) {
+                    // step 997
+                    i1 = 56;
+                    a = x * 88 * 30;
+                } else {
+                    // step 1001
+                    a = x;
+                }
+            }
+            step4(i1, a);
+        } else {
+            step1(i1, x);
+            if (a > 28) {
+                step4(i1, y);
+            }
+            if (x > 5) {
+                x = step6(a) - a - a;
+            }
+        }
+    }
+    if (a < 11) {
+        // step 1017
+        a = 35 - 27 * step7(a, x);
+    } else {
+        if (y == 30) {
+            step2(a, y);
+            if (a == 46) {
+                if (a < 76) {
+                    step1(x, x);
+                }
+            }
+            a = 99;
+        }
+        // step 1029
+        y = step2(a, a) + step7(y, y);
+    }
+    return 47 + x * 77;
+}
+
+// step10: generated
+int step10(int a, int b) {
+    auto x = b + a;
+    auto y = 31;
+    if (y == 49) {
+        for (int i2 = 0; i2 < 76; i2++) {
+            y = x + 29 * y;
+            if (x < 39) {
+                i2 = step6(i2);
+            }
+        }
+        a = 64;
+        x = x * 2 + b;
+        step1(x, x);
+    } else {
+        if (a > 87) {
+            if (b == 43) {
+                y = step0(y) + x;
+            }
+            if (a < 38) {
+                x = 87 + step0(x) + 0;
+            }
+            x = a;
+            if (x < 95) {
+                // step 1059
+                b = y + 49 - step4(y, y);
+                step3(a);
+            } else {
+                for (int i4 = 0; i4 < 15; i4++) {
+                    // step 1064
+                    y = 68 + b - x;
+                    i4 = a;
+                    a = 88 * a + 77;
+                }
+                if (y < 48) {
+                    // step 1070
+                    x = x - step4(a, y);
+                    // step 1072
+                    x = y + x + 26;
+                    // step 1074
+                    a = x + x;
+                }
+                step8(b, y);
+            }
+        }
+        b = 1 - 22 * a;
+        if (y == 44) {
+            a = a;
+            if (b == 28) {
+                b = 38 - x - a;
+                if (x > 28) {
+                    // step 1086
+                    a = b + a + a;
+                    step5(b, a);
+                    // step 1089
+                    x = b;
+                } else {
+                    // step 1092
+                    a = 99 * y + y;
+                }
+                step1(a, b);
+            }
+            // step 1097
+            b = b;
+        }
+        a = y;
+    }
+    step1(x, b);
+    if (b > 13) {
+        y = 2 + b + step9(b);
+        y = x;
+        if (x == 91) {
+            y = y;
+            // step 1108
+            b = b - y;
+            if (y == 1) {
+                for (int v4 : std::vector<int>{3, 97}) {
+                    v4 = step5(x, v4) - y * a;
+                    // step 1113
+                    a = b * 89;
+                    // step 1115
+                    b = y * x;
+                }
+                for (int i4 = 0; i4 < 91; i4++) {
+                    // step 1119
+                    y = step7(b, b);
+                }
+            }
+            b = x;
+        } else {
+            step5(x, b);
+            // step 1126
+            y = y;
+            y = step2(b, y);
+        }
+        if (x > 72) {
+            // step 1131
+            a = a * 19 * 81;
+            for (int v3 : std::vector<int>{49, 33}) {
+                b = v3 - b + 93;
+                if (y == 87) {
+                    y = b;
+                    x = step5(y, b) - v3;
+                } else {
+                    x = 93 * y;
+                }
+            }
+        }
+    } else {
+        step7(a, x);
+        if (a == 96) {
+            x = step9(y) + a * step9(b);
+            x = a;
+            for (int v3 : std::vector<int>{37, 22}) {
+                if (b < 65) {
+                    v3 = step2(v3, y) * b - x;
+                } else {
+                    // step 1152
+                    b = 5;
+                }
+            }
+            step1(y, x);
+        } else {
+            for (int i3 = 0; i3 < 85; i3++) {
+                for (int i4 = 0; i4 < 76; i4++) {
+                    b = step7(i4, i3);
+                }
+                b = y * step4(b, x);
+            }
+            step2(a, a);
+            for (int i3 = 0; i3 < 44; i3++) {
+                b = y * 1;
+            }
+            a = b + y;
+        }
+        for (int i2 = 0; i2 < 90; i2++) {
+            y = a + b;
+        }
+        if (y < 78) {
+            for (int v3 : std::vector<int>{61, 59}) {
+                for (int i4 = 0; i4 < 6; i4++) {
+                    y = a * a;
+                    // step 1177
+                    i4 = 40;
+                }
+                for (int v4 : std::vector<int>{65, 34}) {
+                    step1(x, v3);
+                }
+            }
+            y = 16;
+            if (y > 24) {
+                for (int v4 : std::vector<int>{30, 46}) {
+                    // step 1187
+                    y = 1 - 82;
+                    x = x * a - v4;
+                    // step 1190
+                    x = 16 + a;
+                }
+            } else {
+                step2(b, y);
+            }
+        }
+    }
+    return b + 82 * 36;
+}
+
+// step11: generated
+int step11(int a, int b) {
+    auto x = a - a;
+    auto y = 65;
+    for (int i1 = 0; i1 < 80; i1++) {
+        y = i1;
+    }
+    a = 60 + step9(b);
+    step6(y);
+    b = y + x;
+    if (b > 37) {
+        for (int v2 : std::vector<int>{8, 28}) {
+            y = 65;
+            for (int v3 : std::vector<int>{43, 17}) {
+                // step 1215
+                b = a;
+                b = 71 * 74 + x;
+            }
+        }
+        if (a > 80) {
+            if (b > 61) {
+                a = 79;
+                if (x < 0) {
+                    // step 1224
+                    b = y * a - 50;
+                }
+            }
+        }
+        y = 85 - y;
+        step7(y, a);
+    } else {
+        if (b > 0) {
+            step10(a, a);
+            x = x - y - x;
+        } else {
+            if (b == 52) {
+                a = step7(x, y) * 84;
+            } else {
+                for (int v4 : std::vector<int>{48, 69}) {
+                    b = v4 - step9(y) + a;
+                    // step 1241
+                    a = 16;
+                }
+            }
+        }
+        if (b > 43) {
+            x = y;
+            if (x < 67) {
+                a = 94 * 9;
+                if (x > 1) {
+                    b = a;
+                    // step 1252
+                    a = b;
+                    // step 1254
+                    x = 8 - y;
+                } else {
+                    // step 1257
+                    a = b * 43 - b;
+                    b = y;
+                }
+                if (b == 42) {
+                    // step 1262
+                    x = step10(y, b);
+                    // step 1264
+                    x = 10;
+                } else {
+                    a = a + 72 * 54;
+                    // step 1268
+                    x = step10(y, y) * y;
+                    y = step2(y, x) * x;
+                }
+            } else {
+                for (int v4 : std::vector<int>{36, 22}) {
+                    b = step0(v4) * x - 64;
+                }
+            }
+        } else {
+            b = step7(a, a);
+            for (int i3 = 0; i3 < 7; i3++) {
+                step5(y, a);
+            }
+        }
+        y = 22;
+    }
+    return x;
+}
+
+// step12: generated
+int step12(int a) {
+    auto x = a - a;
+    auto y = 32;
+    for (int v1 : std::vector<int>{29, 41}) {
+        y = 48 - x - a;
+    }
+    // step 1295
+    a = x;
+    for (int i1 = 0; i1 < 29; i1++) {
+        for (int i2 = 0; i2 < 36; i2++) {
+            if (x < 81) {
+                i2 = y - 48 + step2(x, x);
+                a = i2 - y - step7(a, i1);
+            }
+            x = 82;
+        }
+        for (int v2 : std::vector<int>{12, 56}) {
+            if (a == 15) {
+                y = y;
+                for (int v4 : std::vector<int>{83, 86}) {
+                    y = step10(v2, x);
+                }
+                y = v2 * step9(y) - step7(x, v2);
+            }
+            i1 = step4(a, a) + y * 98;
+            if (x > 25) {
+                for (int i4 = 0; i4 < 59; i4++) {
+                    x = a * a + i1;
+                    // step 1317
+                    x = i1 + 94;
+                    // step 1319
+                    i4 = 10;
+                }
+                i1 = i1 * v2;
+                for (int v4 : std::vector<int>{56, 36}) {
+                    // step 1324
+                    x = 49 - y;
+                }
+            }
+        }
+        y = 49;
+    }
+    for (int i1 = 0; i1 < 48; i1++) {
+        i1 = x + a;
+    }
+    a = 58 - a * x;
+    return step1(a, x);
+}
+
+// step13: generated
+int step13(int a, int b) {
+    auto x = b;
+    auto y = 54;
+    b = y * x;
+    if (b == 48) {
+        b = a - b;
+        b = 87 * a + step10(b, b);
+        step6(y);
+        if (y == 77) {
+            y = a - 63;
+            if (b > 59) {
+                y = b;
+            }
+            for (int i3 = 0; i3 < 5; i3++) {
+                if (x > 8) {
+                    // step 1354
+                    x = x * 24 + y;
+                }
+            }
+            // step 1358
+            a = step6(b) + 15 * x;
+        } else {
+            if (a == 77) {
+                step2(x, b);
+                y = b;
+                step5(y, x);
+            }
+            if (a > 40) {
+                step12(y);
+                y = step9(a);
+            }
+            x = 87 * x;
+        }
+    }
+    x = step6(y);
+    return 71;
+}
+
+// step14: generated
+int step14(int a, int b) {
+    auto x = b * b - b;
+    auto y = 1;
+    step10(y, x);
+    a = a;
+    step4(y, b);
+    a = step9(b) * 24 + b;
+    step6(x);
+    return step13(x, x) + 44 + x;
+}
+
+// step15: generated
+int step15(int a) {
+    auto x = 83 + a * a;
+    auto y = 4;
+    for (int i1 = 0; i1 < 34; i1++) {
+        x = step5(a, a);
+        if (a > 20) {
+            if (i1 == 92) {
+                x = 12;
+                y = 8;
+            } else {
+                a = a;
+                for (int v4 : std::vector<int>{62, 70}) {
+                    // step 1402
+                    i1 = step0(x) - step10(y, a) - v4;
+                }
+                if (x < 87) {
+                    a = i1;
+                } else {
+                    i1 = 33 + 79 * 46;
+                }
+            }
+            for (int v3 : std::vector<int>{86, 67}) {
+                y = a - v3;
+                x = step8(x, i1);
+                // step 1414
+                a = a;
+            }
+            for (int v3 : std::vector<int>{59, 27}) {
+                for (int i4 = 0; i4 < 92; i4++) {
+                    // step 1419
+                    a = a + 58 * y;
+                    a = x;
+                    y = 29 - y;
+                }
+                x = step3(v3) - step1(y, x) - 21;
+            }
+        }
+        // step 1427
+        x = x - a * 76;
+        y = step8(y, y);
+    }
+    if (y == 54) {
+        y = a;
+        a = 33 + step4(y, x) * 48;
+        x = a - 10;
+    } else {
+        x = a;
+        x = y * step5(a, y);
+        x = a;
+    }
+    a = 99 - x * step1(x, x);
+    x = y + x * y;
+    if (a < 96) {
+        x = step8(x, y) - x + y;
+    }
+    if (x == 12) {
+        // step 1446
+        x = 7 * step12(x) - a;
+    } else {
+        if (y < 26) {
+            if (x > 9) {
+                y = a;
+            }
+            if (a < 64) {
+                step7(x, x);
+            } else {
+                // step 1456
+                y = a;
+                a = 71;
+            }
+            if (x == 23) {
+                if (y == 83) {
+                    // step 1462
+                    y = 89 * 5;
+                } else {
+                    a = a - x - 47;
+                    // step 1466
+                    y = 55;
+                    // step 1468
+                    a = y - y * 15;
+                }
+                step0(a);
+                a = a * x * 46;
+            }
+        } else {
+            if (x < 33) {
+                y = step3(y) - y;
+            } else {
+                x = 57 - y;
+            }
+            a = 28 + 72 - 69;
+            step8(y, a);
+        }
+        a = x;
+        if (x == 92) {
+            if (x == 39) {
+                y = step5(a, x) - 69 * a;
+            }
+            step9(y);
+            x = 67 + x;
+        } else {
+            // step 1491
+            y = 55 + 2;
+            if (y > 82) {
+                a = x;
+                step13(y, x);
+                step12(a);
+            } else {
+                // step 1498
+                x = 63 * 63;
+                if (y == 85) {
+                    y = x * y;
+                }
+                y = x - step4(a, x);
+            }
+            if (y > 58) {
+                a = step6(a) + y;
+                for (int i4 = 0; i4 < 87; i4++) {
+                    // step 1508
+                    i4 = step7(y, a);
+                }
+            } else {
+                if (x < 88) {
+                    a = 78;
+                }
+                if (y == 97) {
+                    // step 1516
+                    y = y;
+                    // step 1518
+                    y = step11(x, y) + a + step5(x, y);
+                } else {
+                    // step 1521
+                    x = y;
+                    // step 1523
+                    x = 84 + step6(x);
+                }
+            }
+        }
+        step6(y);
+    }
+    if (y < 74) {
+        if (y < 72) {
+            a = 8 - a * 24;
+            if (x < 53) {
+                for (int i4 = 0; i4 < 21; i4++) {
+                    i4 = y;
+                }
+            } else {
+                step3(x);
+            }
+            if (a < 97) {
+                step1(y, y);
+            }
+        } else {
+            // step 1544
+            x = x + step13(y, x) - x;
+            a = 20 + 97 * a;
+        }
+        a = 43;
+        step3(a);
+        if (a > 6) {
+            step8(a, a);
+            if (x > 2) {
+                a = x + step12(x) + a;
+                if (y > 70) {
+                    a = y - y + step2(y, a);
+                }
+                x = x + y + step7(x, x);
+            }
+            // step 1559
+            y = 33 + 11 * a;
+        } else {
+            step3(x);
+        }
+    } else {
+        if (y == 26) {
+            a = 96 * a + a;
+            step5(a, y);
+        }
+        if (x > 31) {
+            step8(y, y);
+            y = y + 23;
+            y = step8(x, y);
+        }
+        if (y == 73) {
+            y = x;
+            step9(a);
+            y = x + 79 + 59;
+        }
+    }
+    for (int v1 : std::vector<int>{20, 73}) {
+        x = v1 + a * x;
+    }
+    return 97 + a;
+}
+
+// step16: generated
+int step16(int a, int b) {
+    auto x = b + 83 - a;
+    auto y = 79;
+    // step 1590
+    y = 64;
+    // step 1592
+    a = a;
+    a = y + b;
+    a = y * 47;
+    for (int i1 = 0; i1 < 72; i1++) {
+        if (y == 94) {
+            step7(a, y);
+            if (x < 13) {
+                y = 6 * y * 20;
+            }
+            // step 1602
+            x = b * x * x;
+        }
+        for (int i2 = 0; i2 < 24; i2++) {
+            step15(i2);
+            // step 1607
+            x = 50 + x - step2(b, a);
+            if (y == 30) {
+                step10(i1, y);
+                y = y + step0(i1);
+            } else {
+                step0(x);
+                if (a == 21) {
+                    // step 1615
+                    y = 6 - step7(i1, x) + step10(x, a);
+                    // step 1617
+                    b = x - 46;
+                    // step 1619
+                    a = a * 70;
+                } else {
+                    // step 1622
+                    b = 91 * 8;
+                    y = 65;
+                    // step 1625
+                    b = i2 - i1 - y;
+                }
+                i2 = i1 - i2;
+            }
+        }
+    }
+    step5(a, x);
+    for (int v1 : std::vector<int>{89, 25}) {
+        a = y - 70 * 39;
+    }
+    // step 1636
+    b = step4(y, b) + x;
+    return 39 * b;
+}
+
+// step17: generated
+int step17(int a, int b) {
+    auto x = 76 - 42 + b;
+    auto y = 75;
+    step3(b);
+    if (b > 53) {
+        step7(a, x);
+        step6(y);
+        if (a == 65) {
+            for (int v3 : std::vector<int>{2, 52}) {
+                a = 5 * 79 + y;
+            }
+            // step 1653
+            y = x - step11(y, y);
+            if (a > 40) {
+                step3(y);
+            }
+        }
+        y = x;
+    }
+    step0(b);
+    return 77;
+}
+
+// step18: generated
+int step18(int a) {
+    auto x = a;
+    auto y = 52;
+    a = step6(y) * x;
+    if (x == 79) {
+        // step 1671
+        x = step4(x, y) - a - 25;
+        x = y - step15(a);
+    } else {
+        a = a - y;
+        for (int i2 = 0; i2 < 32; i2++) {
+            a = 54 + 57;
+            for (int i3 = 0; i3 < 85; i3++) {
+                i2 = i2 + i3 * 86;
+                for (int v4 : std::vector<int>{40, 79}) {
+                    // step 1681
+                    a = 34 + i2;
+                    step14(i2, x);
+                }
+            }
+            for (int i3 = 0; i3 < 13; i3++) {
+                // step 1687
+                x = i2;
+            }
+            a = 89 - 46;
+        }
+        if (a > 43) {
+            step6(a);
+        }
+    }
+    if (y > 58) {
+        for (int i2 = 0; i2 < 22; i2++) {
+            if (i2 > 71) {
+                x = step6(y);
+                i2 = i2 + 65 * y;
+                // step 1701
+                y = step15(x);
+            }
+            y = a + a - a;
+            x = a + 49 + x;
+        }
+        for (int i2 = 0; i2 < 30; i2++) {
+            step12(a);
+            if (a == 85) {
+                i2 = i2 + 83 + 22;
+            }
+            for (int i3 = 0; i3 < 14; i3++) {
+                if (i2 < 14) {
+                    // step 1714
+                    x = x + 38;
+                    step4(a, a);
+                    // step 1717
+                    x = i3 - 41;
+                } else {
+                    i2 = 86;
+                }
+            }
+            if (a == 46) {
+                step5(y, i2);
+            }
+        }
+        step4(a, a);
+    }
+    a = 11 * y - 66;
+    y = a - a * step16(a, x);
+    step8(x, a);
+    return 52 + step5(a, x) - a;
+}
+
+// step19: generated
+int step19(int a, int b) {
+    auto x = a * 34;
+    auto y = 52;
+    step1(a, a);
+    for (int i1 = 0; i1 < 31; i1++) {
+        if (a < 85) {
+            for (int i3 = 0; i3 < 76; i3++) {
+                x = 18 - i1 * i3;
+            }
+            a = 7 - step6(i1) + i1;
+            // step 1746
+            i1 = 95 + step5(y, x);
+        }
+        step1(a, a);
+    }
+    // step 1751
+    b = 83 + 48 * y;
+    y = x + 51 * 92;
+    step9(y);
+    return 70 * 7;
+}
+
+// step20: generated
+int step20(int a, int b) {
+    auto x = a + a - 88;
+    auto y = 11;
+    step15(a);
+    for (int v1 : std::vector<int>{13, 59}) {
+        for (int i2 = 0; i2 < 93; i2++) {
+            if (b > 0) {
+                if (b < 47) {
+                    step9(y);
+                } else {
+                    // step 1769
+                    v1 = i2;
+                    // step 1771
+                    i2 = 19;
+                    // step 1773
+                    i2 = 10 - x;
+                }
+            } else {
+                for (int i4 = 0; i4 < 56; i4++) {
+                    // step 1778
+                    b = step12(x) * step10(y, y);
+                    // step 1780
+                    y = 42;
+                    i2 = i4;
+                }
+                x = v1 - x + step14(v1, b);
+                y = x + x;
+            }
+        }
+        v1 = 50 - 34;
+    }
+    for (int v1 : std::vector<int>{54, 91}) {
+        if (x < 51) {
+            // step 1792
+            x = 44 - step11(x, x) + 40;
+            // step 1794
+            v1 = x * 53 - y;
+            for (int v3 : std::vector<int>{19, 14}) {
+                if (x > 79) {
+                    v3 = v3 * step5(b, b);
+                }
+            }
+            b = step1(v1, b);
+        } else {
+            step14(x, x);
+            for (int i3 = 0; i3 < 16; i3++) {
+                if (v1 < 74) {
+                    i3 = 40 - y;
+                    // step 1807
+                    y = 81;
+                    y = x - 61 * 80;
+                }
+                for (int v4 : std::vector<int>{79, 56}) {
+                    // step 1812
+                    y = step2(a, i3);
+                    // step 1814
+                    a = v1;
+                    step4(v4, v1);
+                }
+                for (int v4 : std::vector<int>{22, 47}) {
+                    step13(i3, v4);
+                    a = step19(b, i3) + v1;
+                }
+            }
+            v1 = 14;
+            if (v1 == 78) {
+                y = step17(a, v1);
+                a = y + a;
+                if (b == 8) {
+                    v1 = 38 + 99 + 88;
+                    // step 1829
+                    a = x - 83 * b;
+                } else {
+                    b = step3(v1);
+                }
+            } else {
+                for (int v4 : std::vector<int>{34, 91}) {
+                    // step 1836
+                    a = v4 - v1;
+                }
+            }
+        }
+        if (x < 68) {
+            v1 = 76 * a;
+        } else {
+            if (a < 76) {
+                // step 1845
+                v1 = 94;
+            }
+            step5(v1, x);
+            for (int i3 = 0; i3 < 42; i3++) {
+                for (int i4 = 0; i4 < 43; i4++) {
+                    // step 1851
+                    b = y - y * b;
+                }
+            }
+            a = x + x;
+        }
+        for (int v2 : std::vector<int>{81, 45}) {
+            step4(x, y);
+        }
+    }
+    b = 42;
+    b = b * b;
+    return b * 83 * y;
+}
+
+// step21: generated
+int step21(int a) {
+    auto x = 18;
+    auto y = 68;
+    y = 63 * y;
+    if (y < 63) {
+        x = step5(y, x);
+        step17(a, a);
+    }
+    y = x + y - x;
+    for (int i1 = 0; i1 < 62; i1++) {
+        step4(y, y);
+        // step 1878
+        x = i1;
+        if (i1 == 25) {
+            i1 = a * y * a;
+            a = 73 + a;
+            i1 = y - x + i1;
+        } else {
+            if (x > 37) {
+                step2(y, y);
+                a = 53 - 60;
+            } else {
+                // step 1889
+                y = i1 * step16(i1, i1) * y;
+                if (i1 > 16) {
+                    // step 1892
+                    y = a - x - a;
+                    // step 1894
+                    a = step18(x) + 52;
+                } else {
+                    i1 = 35;
+                    // step 1898
+                    x = 91 + a * a;
+                    step7(x, a);
+                }
+                if (a > 43) {
+                    // step 1903
+                    x = 10 + 20 * x;
+                }
+            }
+            i1 = i1;
+        }
+    }
+    // step 1910
+    a = a - step14(y, a);
+    step3(a);
+    step12(x);
+    return a * 64;
+}
+
+// step22: generated
+int step22(int a, int b) {
+    auto x = a * a;
+    auto y = 82;
+    // step 1921
+    b = y - x;
+    if (y > 71) {
+        for (int i2 = 0; i2 < 12; i2++) {
+            if (b < 9) {
+                b = 92;
+            } else {
+                for (int i4 = 0; i4 < 97; i4++) {
+                    step8(a, y);
+                }
+                for (int v4 : std::vector<int>{28, 81}) {
+                    // step 1932
+                    b = 91 - step12(a) - y;
+                    // step 1934
+                    b = 43 * step2(b, x);
+                    // step 1936
+                    a = 45;
+                }
+            }
+            i2 = 55;
+            x = 65 - 14 * 85;
+        }
+        for (int v2 : std::vector<int>{31, 9}) {
+            if (v2 < 99) {
+                y = step16(x, y);
+                if (y == 19) {
+                    b = a + 87;
+                    b = y * step19(y, b) + a;
+                }
+                for (int i4 = 0; i4 < 46; i4++) {
+                    // step 1951
+                    i4 = step5(i4, x);
+                }
+            } else {
+                y = 44 * y;
+                if (a == 8) {
+                    // step 1957
+                    x = step17(y, y) - b;
+                    v2 = 25 + b;
+                    // step 1960
+                    v2 = x * a;
+                } else {
+                    step5(b, y);
+                }
+            }
+            for (int i3 = 0; i3 < 96; i3++) {
+                step1(i3, b);
+            }
+            b = step0(a) - a;
+            for (int i3 = 0; i3 < 89; i3++) {
+                if (v2 < 78) {
+                    // step 1972
+                    b = 40 + x;
+                } else {
+                    x = x;
+                }
+            }
+        }
+    }
+    for (int v1 : std::vector<int>{47, 22}) {
+        if (b == 96) {
+            if (y == 88) {
+                if (b > 71) {
+                    // step 1984
+                    a = b - y;
+                }
+            }
+        }
+        // step 1989
+        v1 = x;
+    }
+    y = 43 - step8(y, x) + 1;
+    return y - 73 * a;
+}
+
+// step23: generated
+int step23(int a, int b) {
+    auto x = a - a;
+    auto y = 72;
+    step0(b);
+    x = 98 - y + y;
+    for (int v1 : std::vector<int>{82, 37}) {
+        if (v1 > 69) {
+            if (a > 12) {
+                step5(y, v1);
+                step13(a, b);
+            }
+        }
+    }
+    if (a > 13) {
+        // step 2011
+        x = x * 66;
+    }
+    x = a + 37 + 57;
+    if (a == 58) {
+        // step 2016
+        y = 82 * y;
+        // step 2018
+        y = step3(a) - a + 64;
+        x = 22 * 36 + a;
+        a = y + y;
+    } else {
+        if (a < 58) {
+            // step 2024
+            y = x - 34 + step6(a);
+            step13(b, b);
+        }
+        // step 2028
+        b = y - step14(x, a) + a;
+        step7(y, a);
+        x = step1(x, b) * 0;
+    }
+    return 61 * x;
+}
+
+// step24: generated
+int step24(int a) {
+    auto x = a;
+    auto y = 32;
+    if (y > 39) {
+        y = 54 + step14(y, y) + y;
+        a = 11 + x;
+    }
+    step3(x);
+    for (int i1 = 0; i1 < 37; i1++) {
+        if (i1 > 13) {
+            step8(a, i1);
+            if (y < 46) {
+                step22(y, i1);
+            }
+        }
+    }
+    return y - step16(y, x);
+}
+
+// step25: generated
+int step25(int a, int b) {
+    auto x = a * b;
+    auto y = 68;
+    a = b - a * 49;
+    step19(b, x);
+    b = b;
+    x = a;
+    if (a > 66) {
+        step9(y);
+        for (int i2 = 0; i2 < 11; i2++) {
+            step6(y);
+            x = 78 * y;
+            a = y * step2(i2, b) * 42;
+            step0(b);
+        }
+    } else {
+        step15(x);
+    }
+    return step6(x) + step11(x, a) + 88;
+}
+
+// step26: generated
+int step26(int a, int b) {
+    auto x = a * 93;
+    auto y = 80;
+    if (a < 8) {
+        for (int i2 = 0; i2 < 88; i2++) {
+            for (int v3 : std::vector<int>{42, 25}) {
+                a = step13(i2, y) + 37;
+                x = x;
+            }
+            if (b < 57) {
+                if (b > 76) {
+                    b = 42;
+                    step13(i2, i2);
+                    i2 = b + y;
+                } else {
+                    // step 2094
+                    i2 = step2(i2, b) + i2;
+                    // step 2096
+                    x = 12;
+                    a = step14(i2, y) * b;
+                }
+                i2 = step13(a, y) * 14;
+                a = step5(x, a);
+            } else {
+                i2 = i2 + step3(i2);
+                step9(i2);
+            }
+        }
+        // step 2107
+        a = step12(a) * a;
+        if (b > 80) {
+            if (b > 46) {
+                if (y == 7) {
+                    // step 2112
+                    a = 12 * a;
+                    // step 2114
+                    x = y + x;
+                }
+                if (a < 20) {
+                    // step 2118
+                    b = y - 91;
+                } else {
+                    b = 71 - y + x;
+                }
+            }
+            for (int v3 : std::vector<int>{4, 4}) {
+                a = 37;
+                v3 = 89 + x;
+            }
+        }
+    } else {
+        if (b > 51) {
+            y = b - 66;
+            step0(x);
+            x = y;
+        } else {
+            y = a * a;
+        }
+        step2(b, x);
+        x = y * x;
+        x = y + y + 1;
+    }
+    if (b > 90) {
+        if (y == 14) {
+            for (int i3 = 0; i3 < 24; i3++) {
+                y = step7(b, y) + 38 + step22(i3, b);
+            }
+            for (int v3 : std::vector<int>{96, 88}) {
+                if (a == 12) {
+                    // step 2148
+                    b = x * 85;
+                    // step 2150
+                    y = a + b;
+                    // step 2152
+                    a = y * step0(x);
+                }
+            }
+            if (b == 29) {
+                if (b < 64) {
+                    a = step12(x);
+                    step15(b);
+                    // step 2160
+                    x = 9 - y * 0;
+                } else {
+                    step19(b, b);
+                }
+                if (y < 9) {
+                    // step 2166
+                    b = y;
+                }
+            } else {
+                b = a - 11 + 37;
+            }
+        }
+        y = b * 97 - 96;
+    }
+    a = b * b;
+    // step 2176
+    x = 68 * y;
+    return y - step7(b, b);
+}
+
+// step27: generated
+int step27(int a) {
+    auto x = 63;
+    auto y = 25;
+    step13(y, a);
+    for (int i1 = 0; i1 < 6; i1++) {
+        i1 = 74 + a;
+        x = step13(a, a) - 89;
+        step11(i1, a);
+        y = step23(x, i1);
+    }
+    if (y < 27) {
+        for (int v2 : std::vector<int>{1, 54}) {
+            x = 17 - y + v2;
+            v2 = a + y + 70;
+            step20(a, x);
+        }
+        x = a + x * x;
+        // step 2199
+        y = x - y;
+        x = y;
+    } else {
+        x = a * a;
+        a = a - 88;
+        // step 2205
+        x = a * a * step6(x);
+        if (x < 41) {
+            for (int v3 : std::vector<int>{38, 77}) {
+                for (int v4 : std::vector<int>{63, 61}) {
+                    x = a - v3;
+                    // step 2211
+                    x = 68 + 96 - 32;
+                    v3 = 23 * x;
+                }
+                a = step9(x);
+            }
+            // step 2217
+            x = a * 75;
+            a = 28 + y;
+        }
+    }
+    if (a < 56) {
+        a = 85 * y + step18(y);
+    } else {
+        y = 33;
+        step10(a, y);
+        for (int v2 : std::vector<int>{67, 69}) {
+            if (y > 36) {
+                v2 = 91 - x + v2;
+            } else {
+                x = x;
+                if (v2 < 33) {
+                    // step 2233
+                    a = x + a;
+                    // step 2235
+                    v2 = y * y * 69;
+                    // step 2237
+                    v2 = v2 + x * step3(y);
+                } else {
+                    a = y * a;
+                    // step 2241
+                    v2 = 8;
+                    // step 2243
+                    x = x + step10(x, y);
+                }
+            }
+            if (a == 77) {
+                if (a < 97) {
+                    // step 2249
+                    v2 = v2 - 87 - y;
+                    // step 2251
+                    a = x - 22 - y;
+                }
+            }
+        }
+    }
+    a = y * x;
+    return a + x - a;
+}
+
+// step28: generated
+int step28(int a, int b) {
+    auto x = 37 - b - b;
+    auto y = 43;
+    if (a > 73) {
+        step16(y, x);
+        a = a;
+        if (b > 87) {
+            if (y < 61) {
+                if (a == 58) {
+                    // step 2271
+                    a = y;
+                }
+            }
+        } else {
+            a = x - a;
+            for (int v3 : std::vector<int>{49, 74}) {
+                // step 2278
+                v3 = 81 * 51;
+            }
+            step27(b);
+        }
+        a = step11(a, a) - step13(y, a);
+    } else {
+        b = a * step12(a) - 6;
+        for (int v2 : std::vector<int>{5, 41}) {
+            x = step5(a, y) + v2 + b;
+        }
+        if (x == 82) {
+            for (int v3 : std::vector<int>{89, 76}) {
+                // step 2291
+                y = 44 - 30 - v3;
+                step23(b, v3);
+            }
+            b = y * 14 * x;
+            if (a < 42) {
+                if (x == 92) {
+                    a = 12;
+                    // step 2299
+                    y = b * 48;
+                    // step 2301
+                    y = y;
+                } else {
+                    // step 2304
+                    x = x - 41 - b;
+                    // step 2306
+                    a = step10(b, a) - 64;
+                    step1(y, a);
+                }
+                step18(a);
+                if (x > 86) {
+                    // step 2312
+                    x = x - y - 53;
+                    b = a;
+                }
+            }
+            // step 2317
+            a = b + a;
+        } else {
+            if (a < 11) {
+                step24(a);
+                if (x > 5) {
+                    // step 2323
+                    y = b;
+                    // step 2325
+                    a = a + y - 59;
+                }
+                if (a < 36) {
+                    // step 2329
+                    a = step0(b) * 86 * 49;
+                    y = y + y;
+                } else {
+                    // step 2333
+                    y = b * 17 - step9(b);
+                    // step 2335
+                    a = y;
+                }
+            } else {
+                b = 74;
+            }
+            x = 75 * b;
+        }
+        a = step6(b) * b;
+    }
+    if (b == 13) {
+        if (a == 20) {
+            // step 2347
+            b = step19(x, a);
+            step0(a);
+            a = b;
+        } else {
+            y = a;
+        }
+        if (b > 28) {
+            for (int v3 : std::vector<int>{50, 51}) {
+                v3 = 39 * b;
+                if (x == 99) {
+                    // step 2358
+                    v3 = 39 - v3;
+                }
+            }
+            if (y > 42) {
+                // step 2363
+                b = 17;
+                if (y > 62) {
+                    b = b * step6(x) - b;
+                    // step 2367
+                    x = 26 * 96;
+                } else {
+                    y = y * 52;
+                    // step 2371
+                    b = step13(a, a);
+                }
+            }
+            if (a > 19) {
+                if (a < 54) {
+                    b = step22(y, y) * step0(b) + x;
+                } else {
+                    // step 2379
+                    x = step5(a, b) - a * 54;
+                }
+            } else {
+                x = 3 + 19 + 40;
+                b = step23(x, x) + 44 + y;
+            }
+            for (int v3 : std::vector<int>{99, 91}) {
+                if (y == 16) {
+                    // step 2388
+                    b = 90 * b + step3(y);
+                }
+                if (v3 > 29) {
+                    x = step0(v3) * a - 27;
+                }
+                // step 2394
+                x = y * y;
+            }
+        } else {
+            for (int i3 = 0; i3 < 38; i3++) {
+                x = x - y * i3;
+            }
+            if (y > 20) {
+                if (y < 29) {
+                    step6(b);
+                }
+                step18(y);
+                // step 2406
+                y = y * 13 + step7(y, a);
+            }
+            if (x < 9) {
+                x = x - a;
+                a = 80;
+            }
+            // step 2413
+            a = step2(b, y);
+        }
+        if (a > 60) {
+            x = step23(a, x) + b * 19;
+            for (int v3 : std::vector<int>{73, 88}) {
+                if (b == 64) {
+                    // step 2420
+                    a = step3(a) + a;
+                }
+            }
+            if (b == 0) {
+                // step 2425
+                y = a - x * a;
+                // step 2427
+                x = step14(a, b) - 81;
+                b = 20 * b;
+            } else {
+                if (b < 52) {
+                    // step 2432
+                    y = step0(b) * 42;
+                    // step 2434
+                    b = a;
+                    // step 2436
+                    b = 80 - step3(a);
+                }
+            }
+            b = a + step19(y, y) + x;
+        }
+        step24(x);
+    }
+    // step 2444
+    a = 10 + step16(a, x);
+    step1(b, y);
+    step9(a);
+    if (x < 45) {
+        y = b - x - 20;
+        b = b - a + 21;
+        y = step2(x, b);
+        for (int i2 = 0; i2 < 78; i2++) {
+            b = 28 - 92 - 49;
+            for (int v3 : std::vector<int>{80, 13}) {
+                i2 = step9(b) - i2 + b;
+            }
+        }
+    }
+    step13(a, x);
+    y = 55 * y * 76;
+    return a * step14(x, x);
+}
+
+// step29: generated
+int step29(int a, int b) {
+    auto x = a - a;
+    auto y = 90;
+    // step 2468
+    b = 3 * 7;
+    if (x < 50) {
+        for (int i2 = 0; i2 < 42; i2++) {
+            for (int v3 : std::vector<int>{70, 54}) {
+                // step 2473
+                b = y + 20;
+            }
+        }
+        b = x - step12(a) - a;
+    }
+    for (int v1 : std::vector<int>{43, 77}) {
+        if (b > 34) {
+            a = 62 * 44 - v1;
+            b = 23;
+        }
+        if (y > 48) {
+            step8(v1, v1);
+            for (int i3 = 0; i3 < 48; i3++) {
+                b = 31 - i3;
+                step25(y, a);
+            }
+        }
+        v1 = step12(y) + 20;
+        for (int v2 : std::vector<int>{79, 71}) {
+            if (y < 29) {
+                if (v2 < 33) {
+                    // step 2495
+                    a = x * v1;
+                } else {
+                    y = 11 - b;
+                }
+                for (int v4 : std::vector<int>{59, 25}) {
+                    // step 2501
+                    a = x;
+                    // step 2503
+                    v2 = v2;
+                    // step 2505
+                    y = 58 - 7;
+                }
+                if (y == 60) {
+                    step26(y, v1);
+                    // step 2510
+                    v2 = step10(v2, b) * a * v1;
+                }
+            }
+            v2 = x + 38;
+        }
+    }
+    if (a < 36) {
+        if (x < 89) {
+            x = step13(y, y);
+            // step 2520
+            b = a * y;
+            if (y < 40) {
+                for (int i4 = 0; i4 < 1; i4++) {
+                    // step 2524
+                    a = x;
+                    // step 2526
+                    y = a - 67;
+                }
+            }
+            if (a > 82) {
+                a = y;
+                for (int v4 : std::vector<int>{30, 64}) {
+                    // step 2533
+                    a = step16(x, v4) * a;
+                }
+                for (int v4 : std::vector<int>{87, 27}) {
+                    // step 2537
+                    y = step18(v4) * 65;
+                    a = b - 30 * 12;
+                }
+            }
+        } else {
+            step26(a, b);
+            if (x < 61) {
+                x = b;
+            }
+        }
+    }
+    // step 2549
+    x = 88 * 44;
+    step8(x, a);
+    step8(y, a);
+    return step27(x);
+}
+
+// step30: generated
+int step30(int a) {
+    auto x = a;
+    auto y = 46;
+    // step 2560
+    a = 36;
+    step8(x, a);
+    if (a == 43) {
+        for (int i2 = 0; i2 < 98; i2++) {
+            for (int i3 = 0; i3 < 64; i3++) {
+                i3 = a * a;
+                i3 = x * 85;
+            }
+            y = i2 - 18;
+            a = 54 - y * step22(x, y);
+            if (i2 < 24) {
+                // step 2572
+                a = step11(a, y) * 25;
+            } else {
+                i2 = a + 16 - i2;
+            }
+        }
+    } else {
+        a = a * 19 * step0(x);
+        y = step27(a) * step21(a);
+        if (a > 12) {
+            if (x < 61) {
+                for (int i4 = 0; i4 < 26; i4++) {
+                    // step 2584
+                    y = 90 - 77 + step26(i4, a);
+                }
+            } else {
+                step4(y, y);
+            }
+            step29(x, x);
+            if (x > 5) {
+                for (int i4 = 0; i4 < 88; i4++) {
+                    step0(x);
+                }
+            }
+        } else {
+            if (x == 49) {
+                y = x;
+                for (int i4 = 0; i4 < 64; i4++) {
+                    step1(x, i4);
+                }
+                if (y > 54) {
+                    y = y * 45 - a;
+                }
+            } else {
+                step20(y, x);
+            }
+        }
+    }
+    step14(x, a);
+    x = x + step25(a, a);
+    if (a > 56) {
+        if (x > 57) {
+            for (int v3 : std::vector<int>{3, 56}) {
+                if (a > 28) {
+                    // step 2616
+                    y = step20(x, a);
+                    // step 2618
+                    y = 97 - 41;
+                    // step 2620
+                    v3 = y - 5 * a;
+                }
+                x = step26(y, v3);
+                a = 86 * v3 + y;
+            }
+            if (a > 47) {
+                a = x;
+            } else {
+                step17(x, x);
+                for (int v4 : std::vector<int>{94, 83}) {
+                    x = step5(x, y) * x - 51;
+                    step24(y);
+                }
+            }
+        }
+    }
+    x = step17(y, y);
+    step24(x);
+    return y + a * a;
+}
+
+// step31: generated
+int step31(int a, int b) {
+    auto x = b;
+    auto y = 33;
+    if (y < 82) {
+        if (y == 62) {
+            if (a > 23) {
+                y = 87;
+            } else {
+                if (b > 69) {
+                    y = 87 * step20(x, y) + x;
+                }
+            }
+            if (a > 3) {
+                step4(a, a);
+                if (a == 65) {
+                    // step 2658
+                    b = y;
+                } else {
+                    b = 88 - 9 * b;
+                    a = 75 + y;
+                }
+            }
+            y = a * y * 39;
+        }
+        // step 2667
+        y = 55;
+        step18(y);
+        step9(x);
+    } else {
+        step21(x);
+        if (b < 86) {
+            if (y == 43) {
+                step28(a, y);
+                b = step14(b, y) - step7(x, a) - 57;
+            } else {
+                b = b + y;
+                a = 47 + y;
+            }
+        } else {
+            if (b < 66) {
+                for (int i4 = 0; i4 < 41; i4++) {
+                    step6(x);
+                    i4 = 77 * b;
+                }
+                a = 87 - a;
+            } else {
+                if (b == 46) {
+                    b = b;
+                    // step 2691
+                    a = x - 63;
+                }
+                // step 2694
+                a = x;
+                step22(y, y);
+            }
+            if (y < 71) {
+                // step 2699
+                y = y;
+                if (x > 95) {
+                    // step 2702
+                    x = x - x + 72;
+                    // step 2704
+                    x = step26(b, y) - b;
+                    // step 2706
+                    x = 24;
+                }
+                for (int i4 = 0; i4 < 63; i4++) {
+                    a = a + a;
+                }
+            } else {
+                step1(a, a);
+                x = 21;
+            }
+            // step 2716
+            x = y * a - y;
+            b = 86 * 38 + a;
+        }
+    }
+    for (int i1 = 0; i1 < 16; i1++) {
+        if (a > 20) {
+            i1 = a * step20(y, y) + y;
+            step24(b);
+            // step 2725
+            a = 49;
+        }
+        x = b + a + 85;
+    }
+    // step 2730
+    b = b - step13(y, y) * 43;
+    step30(a);
+    step4(y, a);
+    for (int v1 : std::vector<int>{40, 21}) {
+        step13(y, y);
+    }
+    return step7(a, x) - y - step25(b, y);
+}
+
+// step32: generated
+int step32(int a, int b) {
+    auto x = 86;
+    auto y = 34;
+    y = 2;
+    if (x == 60) {
+        step3(x);
+        if (y == 51) {
+            step24(b);
+        } else {
+            x = 10;
+        }
+        if (y < 16) {
+            step29(a, a);
+        }
+    }
+    if (x == 60) {
+        y = a;
+        step0(x);
+    }
+    step6(y);
+    return 11 + a;
+}
+
+// step33: generated
+int step33(int a) {
+    auto x = a;
+    auto y = 15;
+    a = 42 + 11;
+    step29(x, y);
+    x = x - a;
+    step22(y, x);
+    a = y * step10(x, a);
+    if (a > 3) {
+        step32(y, x);
+        if (a == 87) {
+            x = x + step21(y);
+        }
+        a = 40;
+    } else {
+        step16(a, x);
+        for (int i2 = 0; i2 < 68; i2++) {
+            if (x > 3) {
+                step14(x, a);
+                for (int v4 : std::vector<int>{80, 25}) {
+                    y = 77 * 50 * 21;
+                    step24(i2);
+                    // step 2787
+                    y = a + y;
+                }
+            } else {
+                if (y > 11) {
+                    // step 2792
+                    y = y + 77 - 52;
+                }
+            }
+            y = y + y - x;
+            step14(x, x);
+        }
+        if (a < 86) {
+            x = a + step32(y, x) * x;
+        } else {
+            if (a > 88) {
+                y = step2(y, a) * y + 77;
+            }
+            if (a < 76) {
+                a = 54 * x - step11(x, y);
+            } else {
+                if (y == 57) {
+                    // step 2809
+                    y = a * 68;
+                } else {
+                    // step 2812
+                    x = y;
+                    step16(x, y);
+                    step27(y);
+                }
+            }
+            x = 63 + step0(a) * 90;
+            // step 2819
+            x = x + x;
+        }
+    }
+    if (a > 62) {
+        a = 29;
+        for (int v2 : std::vector<int>{49, 11}) {
+            y = 64 + 72 + x;
+        }
+        x = 96;
+    } else {
+        for (int v2 : std::vector<int>{81, 8}) {
+            // step 2831
+            x = step7(y, a) + step32(y, a);
+        }
+        y = a;
+        if (a == 28) {
+            for (int v3 : std::vector<int>{38, 6}) {
+                if (y == 97) {
+                    y = a - a;
+                } else {
+                    x = y * y * 17;
+                    // step 2841
+                    y = a * step8(y, v3);
+                }
+            }
+            y = x;
+            for (int v3 : std::vector<int>{3, 72}) {
+                if (v3 == 36) {
+                    // step 2848
+                    v3 = 18;
+                } else {
+                    // step 2851
+                    v3 = 36 + 31 + 58;
+                }
+                step14(v3, v3);
+            }
+        }
+        for (int i2 = 0; i2 < 35; i2++) {
+            step28(x, a);
+            x = 59 * 2;
+            if (x > 45) {
+                if (i2 > 65) {
+                    i2 = x + x - y;
+                }
+                // step 2864
+                x = step2(a, x);
+                i2 = y;
+            }
+        }
+    }
+    return 95 - y;
+}
+
+// step34: generated
+int step34(int a, int b) {
+    auto x = a + 25 - b;
+    auto y = 71;
+    step12(y);
+    // step 2878
+    a = 31 + y;
+    // step 2880
+    a = 78;
+    if (x < 6) {
+        step7(a, x);
+        x = 4 + 43;
+    } else {
+        for (int i2 = 0; i2 < 6; i2++) {
+            for (int v3 : std::vector<int>{64, 63}) {
+                for (int i4 = 0; i4 < 76; i4++) {
+                    x = step32(a, y) - step6(y);
+                    // step 2890
+                    i2 = step4(a, y) - a + v3;
+                }
+            }
+            for (int v3 : std::vector<int>{44, 43}) {
+                y = 66 * y - v3;
+                step13(v3, a);
+            }
+            y = 27;
+            i2 = 68 - b;
+        }
+        if (b < 1) {
+            y = y * 95 * 77;
+            for (int i3 = 0; i3 < 69; i3++) {
+                if (b < 88) {
+                    step28(a, b);
+                } else {
+                    x = y * i3;
+                    b = 62 + y * step17(b, a);
+                    x = step21(i3) - i3;
+                }
+            }
+            if (x > 69) {
+                if (x == 24) {
+                    // step 2914
+                    a = b * a - a;
+                    step22(y, a);
+                } else {
+                    a = 75 - b - x;
+                    // step 2919
+                    y = 85 + y;
+                    x = a * 34 - b;
+                }
+                // step 2923
+                y = b - 83;
+            }
+        }
+        for (int i2 = 0; i2 < 6; i2++) {
+            if (i2 == 10) {
+                if (b < 43) {
+                    a = 71;
+                }
+            }
+            i2 = 61;
+        }
+        if (b == 64) {
+            if (y < 52) {
+                step4(a, b);
+                // step 2938
+                x = 55;
+                step28(b, x);
+            } else {
+                y = y;
+            }
+            // step 2944
+            y = 54 + 49 + 42;
+        }
+    }
+    x = x * 7;
+    for (int i1 = 0; i1 < 83; i1++) {
+        if (a == 25) {
+            // step 2951
+            x = 14;
+            if (a == 3) {
+                for (int v4 : std::vector<int>{55, 4}) {
+                    // step 2955
+                    a = v4;
+                    i1 = 42 * y;
+                    step18(b);
+                }
+            }
+            if (b > 67) {
+                // step 2962
+                a = a;
+            } else {
+                b = a * 28 + b;
+            }
+        }
+        for (int v2 : std::vector<int>{90, 18}) {
+            x = step14(a, a) - 40;
+        }
+        a = a + x + y;
+    }
+    return x * b;
+}
+
+// step35: generated
+int step35(int a, int b) {
+    auto x = 65 * a;
+    auto y = 63;
+    // step 2980
+    b = x * step6(b);
+    for (int i1 = 0; i1 < 72; i1++) {
+        // step 2983
+        y = a - i1 * y;
+        // step 2985
+        y = i1;
+        a = 32 - 28 - 3;
+        a = 18 + b;
+    }
+    if (x == 88) {
+        y = x - 82;
+        if (a > 56) {
+            for (int i3 = 0; i3 < 47; i3++) {
+                step9(i3);
+                b = 57 + 7 + step23(y, i3);
+            }
+        } else {
+            if (a < 20) {
+                for (int v4 : std::vector<int>{90, 19}) {
+                    // step 3000
+                    a = b;
+                    // step 3002
+                    y = b - y - v4;
+                }
+            } else {
+                a = step13(y, x);
+                if (x < 58) {
+                    y = step10(a, x);
+                    step33(x);
+                } else {
+                    step5(y, b);
+                }
+            }
+        }
+    }
+    x = y;
+    return 47 - x;
+}
+
+// step36: generated
+int step36(int a) {
+    auto x = a;
+    auto y = 15;
+    x = y + y * step1(x, x);
+    a = step6(x);
+    // step 3026
+    a = x;
+    for (int v1 : std::vector<int>{11, 28}) {
+        for (int v2 : std::vector<int>{88, 70}) {
+            if (y == 30) {
+                step30(v2);
+                v1 = v1 + 1;
+                v1 = y - v1;
+            } else {
+                if (v2 < 29) {
+                    // step 3036
+                    v1 = step32(a, a);
+                    y = v2 + 11 - 28;
+                }
+            }
+            step6(v2);
+        }
+        if (a < 72) {
+            v1 = step14(a, a) - x + 21;
+        } else {
+            step6(a);
+            if (y < 69) {
+                y = step15(x) + y;
+            } else {
+                v1 = a;
+                a = a * x;
+            }
+            if (x == 23) {
+                step0(x);
+            }
+        }
+        if (y > 36) {
+            step16(a, y);
+            if (v1 < 64) {
+                if (y > 50) {
+                    a = y;
+                }
+            } else {
+                // step 3064
+                x = step32(y, x) - 27 - y;
+                if (v1 == 97) {
+                    // step 3067
+                    v1 = a;
+                }
+                step32(y, a);
+            }
+            // step 3072
+            x = 11;
+        } else {
+            if (a == 3) {
+                for (int i4 = 0; i4 < 75; i4++) {
+                    // step 3077
+                    y = i4 - step32(a, i4) + 29;
+                    // step 3079
+                    y = y - v1;
+                    // step 3081
+                    i4 = 60;
+                }
+                x = step12(x) - v1 + a;
+            } else {
+                if (x == 90) {
+                    a = y - step17(v1, v1);
+                } else {
+                    step1(y, y);
+                    step21(v1);
+                    // step 3091
+                    x = 88;
+                }
+                if (x < 44) {
+                    a = v1 * x;
+                }
+                step17(a, y);
+            }
+        }
+    }
+    a = a - x + y;
+    return a;
+}
+
+// step37: generated
+int step37(int a, int b) {
+    auto x = b * 1;
+    auto y = 75;
+    for (int i1 = 0; i1 < 23; i1++) {
+        x = 69;
+    }
+    x = x;
+    if (b < 56) {
+        for (int v2 : std::vector<int>{48, 54}) {
+            v2 = b;
+            if (a == 81) {
+                if (v2 < 70) {
+                    // step 3118
+                    x = 7 + 99;
+                }
+                // step 3121
+                v2 = step10(v2, b) - 88;
+            }
+        }
+    } else {
+        for (int v2 : std::vector<int>{33, 5}) {
+            b = 35 + y + y;
+            x = y;
+            if (v2 > 13) {
+                for (int i4 = 0; i4 < 85; i4++) {
+                    // step 3131
+                    x = a;
+                }
+            }
+        }
+    }
+    return 44;
+}
+
+// step38: generated
+int step38(int a, int b) {
+    auto x = a + 30 + a;
+    auto y = 49;
+    for (int v1 : std::vector<int>{45, 23}) {
+        if (b == 28) {
+            step6(a);
+            if (b == 50) {
+                if (a > 16) {
+                    // step 3149
+                    a = 85 + y - a;
+                } else {
+                    // step 3152
+                    x = y + step37(b, b) * step2(a, v1);
+                    // step 3154
+                    b = b * 70;
+                }
+            } else {
+                if (v1 > 78) {
+                    step13(v1, a);
+                    // step 3160
+                    b = 78 - 0;
+                }
+                if (y == 20) {
+                    v1 = step24(v1);
+                } else {
+                    // step 3166
+                    y = 22;
+                    step33(v1);
+                }
+                b = 84;
+            }
+        }
+        if (v1 > 84) {
+            y = step3(v1) * y + b;
+        }
+    }
+    if (a == 23) {
+        step32(b, y);
+    } else {
+        step11(y, b);
+    }
+    for (int v1 : std::vector<int>{70, 70}) {
+        for (int i2 = 0; i2 < 98; i2++) {
+            if (x == 8) {
+                y = step8(y, a) * y + x;
+                if (b == 38) {
+                    // step 3187
+                    v1 = 42 - step28(a, x) - x;
+                } else {
+                    // step 3190
+                    x = a;
+                    v1 = i2;
+                    // step 3193
+                    b = b;
+                }
+            } else {
+                // step 3197
+                y = y - x;
+                // step 3199
+                v1 = step28(i2, x) + x + 47;
+                step15(y);
+            }
+            y = v1 * 89 - 77;
+        }
+        if (v1 < 72) {
+            a = b - y;
+            if (x == 72) {
+                a = 53 - 86 * a;
+            }
+        } else {
+            a = 91;
+            step1(x, a);
+        }
+    }
+    a = x + 17 + y;
+    step17(y, y);
+    if (y < 70) {
+        if (y > 81) {
+            // step 3219
+            x = 55 - a + 3;
+        } else {
+            if (b > 43) {
+                if (a > 7) {
+                    // step 3224
+                    x = b * 86 + 88;
+                }
+            }
+        }
+        b = step19(y, y) * 13;
+        if (a < 72) {
+            for (int i3 = 0; i3 < 93; i3++) {
+                step31(x, y);
+                if (a == 99) {
+                    // step 3234
+                    a = step32(y, y);
+                } else {
+                    // step 3237
+                    x = b * a;
+                    // step 3239
+                    b = 48 * i3;
+                }
+                if (b == 9) {
+                    // step 3243
+                    a = x * x;
+                    // step 3245
+                    b = b + step17(b, a);
+                }
+            }
+            x = 38;
+            y = 94 * 49;
+        } else {
+            a = 82 * b;
+            for (int v3 : std::vector<int>{71, 33}) {
+                if (v3 == 50) {
+                    v3 = 10 - y;
+                }
+            }
+            if (y > 61) {
+                if (y < 15) {
+                    // step 3260
+                    x = b;
+                }
+                for (int i4 = 0; i4 < 83; i4++) {
+                    // step 3264
+                    y = a + 32;
+                    x = b + 69 - 87;
+                    // step 3267
+                    b = 62 * step19(x, x);
+                }
+                if (b == 89) {
+                    step20(b, a);
+                    // step 3272
+                    b = y - x;
+                    // step 3274
+                    a = step34(x, y);
+                } else {
+                    y = 84 * b;
+                    // step 3278
+                    x = b;
+                    step17(y, a);
+                }
+            } else {
+                if (b == 95) {
+                    // step 3284
+                    a = 13 * 74 + a;
+                }
+                y = 64;
+            }
+        }
+    }
+    y = x - 47;
+    return 37 - 10 * b;
+}
+
+// step39: generated
+int step39(int a) {
+    auto x = a;
+    auto y = 64;
+    y = step2(a, x) + 90 * step15(a);
+    if (y == 53) {
+        if (y == 22) {
+            x = 76 * y;
+            y = x * 59;
+            if (x < 73) {
+                step24(a);
+            } else {
+                y = x;
+            }
+        }
+    }
+    // step 3311
+    x = 14 * a - 71;
+    step28(y, x);
+    return 84;
+}
+
+// step40: generated
+int step40(int a, int b) {
+    auto x = a * b;
+    auto y = 63;
+    step34(b, b);
+    b = step7(y, x);
+    if (y == 17) {
+        if (x == 67) {
+            a = step33(x);
+            // step 3326
+            y = step15(a) + a;
+            if (a < 3) {
+                step19(x, y);
+                if (x < 34) {
+                    step30(b);
+                    b = a - a + b;
+                    // step 3333
+                    a = step19(b, y);
+                }
+                if (a < 90) {
+                    // step 3337
+                    b = 60 * 43;
+                    // step 3339
+                    y = step11(b, x);
+                } else {
+                    x = y - y;
+                }
+            } else {
+                if (b < 92) {
+                    // step 3346
+                    a = x - 91 + y;
+                } else {
+                    // step 3349
+                    x = step0(x) * 57;
+                    step30(x);
+                }
+                x = x * y;
+                step31(a, y);
+            }
+            x = a - y;
+        }
+        for (int i2 = 0; i2 < 1; i2++) {
+            if (x > 5) {
+                if (b > 12) {
+                    // step 3361
+                    a = step22(y, b) - i2 + y;
+                    // step 3363
+                    y = 10 + step8(b, b) - b;
+                    // step 3365
+                    i2 = y - 14;
+                } else {
+                    // step 3368
+                    i2 = 43 * x - x;
+                    b = y - i2;
+                    // step 3371
+                    i2 = step23(a, b) * i2;
+                }
+                if (a < 67) {
+                    // step 3375
+                    x = i2 + step13(y, i2) * 40;
+                }
+                // step 3378
+                a = x;
+            } else {
+                step20(a, i2);
+            }
+            if (i2 == 85) {
+                if (b > 10) {
+                    x = x;
+                } else {
+                    i2 = 59;
+                }
+                if (b > 63) {
+                    // step 3390
+                    b = i2;
+                } else {
+                    y = 42 * 78 * a;
+                    step28(a, x);
+                }
+                if (i2 == 80) {
+                    b = step34(b, i2);
+                    // step 3398
+                    y = i2;
+                }
+            } else {
+                if (y < 7) {
+                    step20(y, b);
+                }
+            }
+            step0(i2);
+        }
+        step20(y, y);
+    }
+    for (int i1 = 0; i1 < 47; i1++) {
+        x = step5(i1, x) * x * y;
+        step19(y, a);
+        if (x < 42) {
+            for (int i3 = 0; i3 < 89; i3++) {
+                a = i3 + x;
+                for (int i4 = 0; i4 < 36; i4++) {
+                    // step 3417
+                    i1 = 72;
+                }
+                // step 3420
+                x = 6 + step36(a);
+            }
+            step1(y, b);
+        }
+    }
+    x = a;
+    b = a * b * x;
+    step38(y, x);
+    return 69;
+}
+
+// step41: generated
+int step41(int a, int b) {
+    auto x = a - b;
+    auto y = 34;
+    a = x;
+    for (int v1 : std::vector<int>{21, 55}) {
+        if (y > 44) {
+            v1 = 16 * step3(a) - step8(y, v1);
+            for (int i3 = 0; i3 < 26; i3++) {
+                step25(y, v1);
+                for (int i4 = 0; i4 < 72; i4++) {
+                    // step 3443
+                    v1 = 64;
+                    // step 3445
+                    i4 = i4 * 20;
+                    // step 3447
+                    y = i3;
+                }
+            }
+            // step 3451
+            v1 = step22(y, b) - 72;
+        }
+        v1 = a * 36 - x;
+        if (b > 3) {
+            if (x < 69) {
+                if (x < 66) {
+                    b = step11(y, y);
+                }
+                v1 = x - a * x;
+                if (x < 89) {
+                    // step 3462
+                    v1 = 1 * a * y;
+                } else {
+                    // step 3465
+                    y = 59 - 14;
+                    b = b + v1;
+                    // step 3468
+                    x = y * 27 + 27;
+                }
+            } else {
+                v1 = b;
+                if (x > 28) {
+                    // step 3474
+                    b = v1;
+                    // step 3476
+                    b = b * 51;
+                } else {
+                    // step 3479
+                    b = y * 66;
+                }
+            }
+            v1 = y + 79;
+            y = b * b + y;
+            // step 3485
+            b = step2(a, x) * b - b;
+        }
+        a = 5 * a + step32(x, v1);
+    }
+    for (int i1 = 0; i1 < 93; i1++) {
+        // step 3491
+        x = 7 - i1;
+        b = i1;
+    }
+    if (a == 17) {
+        step25(y, x);
+    }
+    step18(a);
+    b = x - b * 64;
+    if (b > 27) {
+        x = 37 * 29 * step34(b, b);
+        step40(a, a);
+    }
+    b = 56 - y + 40;
+    return y;
+}
+
+// step42: generated
+int step42(int a) {
+    auto x = 93 + 35;
+    auto y = 11;
+    x = step21(a);
+    // step 3513
+    a = a;
+    a = 62 * a - a;
+    // step 3516
+    y = 97;
+    for (int v1 : std::vector<int>{42, 48}) {
+        if (a < 78) {
+            // step 3520
+            v1 = v1;
+            step40(v1, a);
+            for (int v3 : std::vector<int>{55, 31}) {
+                x = v3;
+            }
+            // step 3526
+            a = 77;
+        } else {
+            if (x < 39) {
+                if (x == 14) {
+                    y = 96 * y;
+                } else {
+                    // step 3533
+                    a = step0(x) + 98 + y;
+                    // step 3535
+                    a = step27(y) - 35 * step6(v1);
+                }
+            }
+        }
+        v1 = 67;
+    }
+    for (int i1 = 0; i1 < 54; i1++) {
+        for (int v2 : std::vector<int>{70, 47}) {
+            step40(y, i1);
+            a = a + v2;
+        }
+    }
+    step27(x);
+    return y + x;
+}
+
+// step43: generated
+int step43(int a, int b) {
+    auto x = b + a * a;
+    auto y = 21;
+    // step 3556
+    y = y;
+    step13(a, y);
+    x = a * a * step22(a, y);
+    a = x - y * b;
+    b = b * b * step15(x);
+    if (x < 93) {
+        step27(a);
+        // step 3564
+        x = 47 * x * 20;
+        step13(a, b);
+    } else {
+        x = 56 * a;
+    }
+    if (b == 49) {
+        if (y == 29) {
+            for (int i3 = 0; i3 < 71; i3++) {
+                for (int i4 = 0; i4 < 63; i4++) {
+                    // step 3574
+                    b = x - i4;
+                }
+            }
+            // step 3578
+            y = step4(y, x) - 97;
+        } else {
+            if (b == 17) {
+                if (x > 32) {
+                    // step 3583
+                    x = 9;
+                    // step 3585
+                    y = 76 + x;
+                } else {
+                    // step 3588
+                    y = b + 80;
+                    // step 3590
+                    x = step21(y);
+                }
+            } else {
+                if (a < 91) {
+                    a = y + x;
+                }
+                if (y == 62) {
+                    step41(b, x);
+                }
+                b = a;
+            }
+        }
+        if (a > 4) {
+            for (int v3 : std::vector<int>{75, 73}) {
+                if (b > 60) {
+                    // step 3606
+                    a = v3 * y;
+                }
+                step20(y, x);
+            }
+            if (x < 68) {
+                a = 11;
+                for (int v4 : std::vector<int>{25, 9}) {
+                    b = 83;
+                    x = step1(x, x) - v4 * b;
+                }
+            } else {
+                if (y > 32) {
+                    step22(a, y);
+                    a = 19 * 67 * 43;
+                    // step 3621
+                    x = 89 * y;
+                } else {
+                    b = x * 48 + x;
+                    a = step4(x, a) - a - 64;
+                }
+                if (b == 89) {
+                    // step 3628
+                    x = x;
+                }
+            }
+            if (x > 48) {
+                b = step14(x, a);
+            }
+        }
+        if (a == 77) {
+            step17(b, a);
+            if (b < 18) {
+                if (y > 50) {
+                    // step 3640
+                    x = y;
+                    a = 19 * 17;
+                } else {
+                    x = x;
+                }
+                for (int i4 = 0; i4 < 63; i4++) {
+                    // step 3647
+                    y = i4 + a + step9(x);
+                }
+                y = 90;
+            } else {
+                y = step29(x, a) - step7(x, y) - 31;
+            }
+            b = 34 - b + y;
+        }
+    }
+    return 12;
+}
+
+// step44: generated
+int step44(int a, int b) {
+    auto x = b;
+    auto y = 21;
+    // step 3664
+    a = x * step20(x, a) + 33;
+    if (b > 17) {
+        if (x == 79) {
+            y = 91 * a;
+            for (int v3 : std::vector<int>{66, 43}) {
+                step20(y, v3);
+                if (x < 90) {
+                    v3 = a;
+                    v3 = v3 - v3 * a;
+                }
+                a = 82;
+            }
+            x = 81 * x;
+            step9(x);
+        }
+        b = step13(a, b) + 93 * step10(x, a);
+        if (a < 84) {
+            for (int i3 = 0; i3 < 80; i3++) {
+                step22(y, i3);
+                if (x > 88) {
+                    // step 3685
+                    x = 84 * a - 99;
+                } else {
+                    // step 3688
+                    b = a - 37 + step36(b);
+                }
+                x = b - x + 35;
+            }
+            for (int v3 : std::vector<int>{85, 86}) {
+                step18(b);
+            }
+            if (a > 50) {
+                if (y > 67) {
+                    step11(b, a);
+                } else {
+                    step40(b, x);
+                }
+            }
+            if (a == 38) {
+                // step 3704
+                a = b + step0(a);
+            }
+        }
+        y = a;
+    }
+    if (y == 93) {
+        for (int i2 = 0; i2 < 59; i2++) {
+            for (int v3 : std::vector<int>{1, 1}) {
+                if (b < 69) {
+                    v3 = step23(a, a) - y + b;
+                    // step 3715
+                    y = v3;
+                    // step 3717
+                    a = 96;
+                } else {
+                    // step 3720
+                    i2 = 19 * x * 30;
+                    step19(x, i2);
+                    step23(x, a);
+                }
+            }
+            i2 = step26(a, y);
+            y = x - a + a;
+            if (b == 79) {
+                b = i2 + 18 - i2;
+                y = y * 18 * 72;
+            } else {
+                a = a;
+            }
+        }
+        y = 52;
+        step15(x);
+    } else {
+        for (int v2 : std::vector<int>{33, 21}) {
+            step3(y);
+            for (int i3 = 0; i3 < 93; i3++) {
+                if (b > 91) {
+                    // step 3742
+                    v2 = y;
+                }
+            }
+            if (a > 25) {
+                x = 88;
+                step23(x, a);
+                if (a == 48) {
+                    // step 3750
+                    b = step11(b, a) * v2 - y;
+                } else {
+                    x = 50;
+                }
+            } else {
+                for (int i4 = 0; i4 < 15; i4++) {
+                    a = 69 + 63;
+                }
+                b = b;
+            }
+            // step 3761
+            a = step42(a);
+        }
+        // step 3764
+        y = a - y;
+        y = step2(y, b);
+        step29(a, b);
+    }
+    b = 25 + y * step29(x, b);
+    x = 52;
+    return 26;
+}
+
+// step45: generated
+int step45(int a) {
+    auto x = a + a + 92;
+    auto y = 12;
+    a = 54 * step44(y, x) + 42;
+    x = x - a - a;
+    for (int v1 : std::vector<int>{92, 76}) {
+        y = v1 * x;
+        if (x < 21) {
+            a = step4(a, x) - v1;
+            for (int i3 = 0; i3 < 57; i3++) {
+                if (y == 13) {
+                    // step 3786
+                    x = a + i3 * v1;
+                    // step 3788
+                    i3 = 41 + v1 + 76;
+                }
+                y = i3;
+                for (int v4 : std::vector<int>{29, 71}) {
+                    i3 = v4 * a;
+                }
+            }
+            for (int i3 = 0; i3 < 23; i3++) {
+                // step 3797
+                y = x + a + y;
+                if (i3 > 30) {
+                    step16(y, i3);
+                    // step 3801
+                    v1 = i3;
+                    // step 3803
+                    y = x;
+                } else {
+                    // step 3806
+                    a = x + a + step37(x, a);
+                    y = 64 * 77;
+                    step20(a, x);
+                }
+                for (int i4 = 0; i4 < 20; i4++) {
+                    // step 3812
+                    a = v1 + step28(v1, i4) + v1;
+                }
+            }
+        }
+        // step 3817
+        y = 4 * a;
+        a = 76;
+    }
+    // step 3821
+    y = 83 - a;
+    return y * x;
+}
+
+// step46: generated
+int step46(int a, int b) {
+    auto x = a;
+    auto y = 27;
+    if (x < 1) {
+        if (x > 93) {
+            if (x > 40) {
+                if (a < 41) {
+                    // step 3834
+                    a = step33(b) * x;
+                    y = 16 - 18 * x;
+                    // step 3837
+                    y = 20;
+                } else {
+                    // step 3840
+                    b = step10(b, x) * 34;
+                }
+                for (int i4 = 0; i4 < 82; i4++) {
+                    // step 3844
+                    y = 81 - step6(x) * y;
+                    y = y - 7;
+                }
+            } else {
+                if (x == 3) {
+                    // step 3850
+                    a = b + x;
+                    b = b + step9(y) * y;
+                } else {
+                    // step 3854
+                    b = 26;
+                }
+                y = a * b + y;
+                if (y == 63) {
+                    // step 3859
+                    x = 7;
+                }
+            }
+            if (b == 40) {
+                if (x > 47) {
+                    y = 34 - 8;
+                } else {
+                    // step 3867
+                    a = 65 - 86 - 28;
+                }
+                x = b;
+            } else {
+                step25(b, a);
+                if (x == 98) {
+                    // step 3874
+                    b = b + 40;
+                    step42(a);
+                    // step 3877
+                    x = step3(y) + 45;
+                } else {
+                    b = b + 90;
+                }
+            }
+            for (int v3 : std::vector<int>{98, 37}) {
+                if (v3 > 89) {
+                    // step 3885
+                    y = 68 * v3 - b;
+                } else {
+                    // step 3888
+                    y = v3;
+                }
+                for (int v4 : std::vector<int>{9, 26}) {
+                    // step 3892
+                    b = a - v4 - v3;
+                    // step 3894
+                    v3 = 37;
+                }
+            }
+        }
+        y = x - 34 * x;
+    }
+    b = step35(a, x) + step6(y);
+    y = 71 - 94 - step3(x);
+    for (int v1 : std::vector<int>{99, 50}) {
+        v1 = a;
+    }
+    for (int i1 = 0; i1 < 5; i1++) {
+        y = i1;
+        if (x == 67) {
+            if (x < 60) {
+                if (b > 86) {
+                    a = 86 + step25(a, b) - i1;
+                    step29(b, x);
+                    y = 33;
+                }
+                // step 3915
+                b = a + 72 - i1;
+                y = b + y + b;
+            }
+            y = a;
+        } else {
+            b = y - a;
+            step8(x, y);
+            // step 3923
+            a = 66 - 17;
+        }
+        step7(i1, i1);
+        for (int i2 = 0; i2 < 90; i2++) {
+            for (int i3 = 0; i3 < 39; i3++) {
+                b = x + 99;
+            }
+        }
+    }
+    y = 96;
+    return 85 + 29 - step35(y, y);
+}
+
+// step47: generated
+int step47(int a, int b) {
+    auto x = a + b + b;
+    auto y = 82;
+    x = x + 30;
+    step28(a, y);
+    y = 29;
+    if (a > 98) {
+        if (b > 44) {
+            a = step32(y, b) - b;
+            a = y;
+        } else {
+            step39(a);
+            // step 3950
+            x = 6 * x - b;
+        }
+    }
+    a = y - x;
+    return a + a;
+}
+
+// step48: generated
+int step48(int a) {
+    auto x = a + 22 - 5;
+    auto y = 84;
+    if (x < 92) {
+        for (int v2 : std::vector<int>{44, 94}) {
+            x = 27 + 50;
+            if (x > 80) {
+                step46(a, a);
+            } else {
+                y = a - 38 * 95;
+                if (x < 89) {
+                    step33(x);
+                    step42(y);
+                }
+            }
+        }
+    } else {
+        a = x + step40(x, a) - x;
+        // step 3977
+        x = x;
+        step26(y, a);
+        step9(a);
+    }
+    // step 3982
+    y = step40(y, x) * a;
+    if (y == 40) {
+        if (y == 58) {
+            // step 3986
+            x = a * 27 * step27(x);
+            for (int v3 : std::vector<int>{60, 26}) {
+                for (int v4 : std::vector<int>{53, 80}) {
+                    // step 3990
+                    v3 = 84 * 17 * 45;
+                }
+                y = 42 - v3;
+            }
+            a = a;
+            step34(y, y);
+        } else {
+            a = 74;
+            if (y > 30) {
+                for (int v4 : std::vector<int>{43, 41}) {
+                    // step 4001
+                    y = 20 * step42(x) + a;
+                    // step 4003
+                    x = 13;
+                    step44(y, v4);
+                }
+                for (int v4 : std::vector<int>{13, 22}) {
+                    v4 = 52 - 4 * v4;
+                }
+                // step 4010
+                x = 19;
+            }
+            if (y == 58) {
+                if (a < 0) {
+                    // step 4015
+                    y = 7 + 97 + step47(y, x);
+                    a = y * y - 97;
+                    step38(a, y);
+                }
+            }
+            for (int i3 = 0; i3 < 25; i3++) {
+                if (a == 33) {
+                    // step 4023
+                    x = step5(i3, i3) * x * 67;
+                    i3 = i3;
+                    // step 4026
+                    y = a - a * x;
+                }
+            }
+        }
+        if (a == 44) {
+            for (int v3 : std::vector<int>{87, 0}) {
+                for (int v4 : std::vector<int>{13, 2}) {
+                    // step 4034
+                    v4 = a;
+                }
+                for (int i4 = 0; i4 < 53; i4++) {
+                    // step 4038
+                    x = i4 + 1;
+                }
+                // step 4041
+                y = v3 * y;
+            }
+            step35(x, x);
+            // step 4045
+            y = 23 * 73 + y;
+            step18(a);
+        } else {
+            step22(y, x);
+            step10(x, a);
+            a = 60 * a;
+        }
+    }
+    x = step42(a);
+    return y * step15(a);
+}
+
+// step49: generated
+int step49(int a, int b) {
+    auto x = 79 - 17;
+    auto y = 13;
+    y = 6 + 1;
+    if (b == 77) {
+        b = 36 + x;
+        step13(b, x);
+        step23(a, b);
+    } else {
+        // step 4068
+        b = 8;
+        if (a < 39) {
+            b = step26(x, a) * x + y;
+            if (y == 87) {
+                y = 69 + x + 42;
+            }
+            if (a == 79) {
+                // step 4076
+                b = y;
+                if (y < 40) {
+                    // step 4079
+                    b = 66 * 15 + b;
+                } else {
+                    // step 4082
+                    x = y * 34 - 8;
+                    // step 4084
+                    a = 5 + a - 9;
+                    // step 4086
+                    y = step19(a, x) * b;
+                }
+                y = x - 99;
+            }
+            // step 4091
+            x = a * x;
+        }
+        for (int v2 : std::vector<int>{35, 45}) {
+            x = 75 + step17(y, b) + y;
+            if (x < 3) {
+                v2 = step23(y, v2);
+            }
+            for (int i3 = 0; i3 < 74; i3++) {
+                // step 4100
+                b = 36;
+                for (int i4 = 0; i4 < 97; i4++) {
+                    // step 4103
+                    i4 = i4;
+                }
+                for (int v4 : std::vector<int>{99, 63}) {
+                    // step 4107
+                    a = 28 - x + x;
+                }
+            }
+        }
+    }
+    if (a < 68) {
+        if (a == 20) {
+            if (b == 21) {
+                x = 54 + 51;
+                y = x * 39;
+            } else {
+                x = y;
+            }
+            for (int i3 = 0; i3 < 55; i3++) {
+                for (int i4 = 0; i4 < 47; i4++) {
+                    // step 4123
+                    x = 3 + x;
+                }
+                if (a == 34) {
+                    i3 = step13(x, i3) * 6;
+                } else {
+                    // step 4129
+                    y = 86;
+                }
+                step10(y, x);
+            }
+        } else {
+            if (b < 67) {
+                if (a > 71) {
+                    step30(b);
+                }
+                if (b < 38) {
+                    x = 41 * a - 51;
+                }
+            } else {
+                // step 4143
+                b = step24(y) - step11(a, b) * 54;
+                x = y;
+                // step 4146
+                a = b - b - x;
+            }
+        }
+    }
+    if (b == 7) {
+        // step 4152
+        b = 10;
+        a = a;
+        a = 94 - 57 - a;
+    } else {
+        if (x == 80) {
+            for (int v3 : std::vector<int>{2, 70}) {
+                if (x == 42) {
+                    // step 4160
+                    b = step15(a) - 72;
+                } else {
+                    a = 62;
+                    // step 4164
+                    b = b;
+                }
+            }
+            for (int v3 : std::vector<int>{59, 25}) {
+                if (v3 == 60) {
+                    // step 4170
+                    a = a;
+                    step27(b);
+                    x = 80 * step8(b, y) * 29;
+                }
+                v3 = 96 * v3;
+            }
+            if (y > 60) {
+                if (x == 99) {
+                    // step 4179
+                    a = y + 56;
+                    // step 4181
+                    x = 55;
+                }
+                if (x == 12) {
+                    step14(y, y);
+                    b = b;
+                    // step 4187
+                    a = 56 + y;
+                }
+            } else {
+                step31(a, x);
+                // step 4192
+                b = 49 + y;
+                if (b < 55) {
+                    // step 4195
+                    a = b - b;
+                } else {
+                    y = a - step21(b) * b;
+                    // step 4199
+                    a = 64;
+                }
+            }
+        }
+        b = step37(b, y);
+        if (y < 53) {
+            if (a < 88) {
+                y = 45 * a;
+                step18(b);
+            }
+            // step 4210
+            y = y * y + step26(y, y);
+        }
+    }
+    step5(x, b);
+    // step 4215
+    b = 48 * a * 63;
+    if (a < 31) {
+        if (x == 7) {
+            a = y;
+            for (int v3 : std::vector<int>{77, 30}) {
+                b = x;
+                v3 = a;
+            }
+            for (int i3 = 0; i3 < 36; i3++) {
+                if (i3 == 10) {
+                    x = 64 * 94 + x;
+                    // step 4227
+                    i3 = x - a;
+                    b = x + 68;
+                } else {
+                    // step 4231
+                    x = 96 + x;
+                }
+            }
+        } else {
+            for (int v3 : std::vector<int>{40, 83}) {
+                // step 4237
+                x = 53 - x;
+            }
+        }
+        if (x > 52) {
+            if (a == 57) {
+                for (int v4 : std::vector<int>{20, 53}) {
+                    x = step33(a) + 26;
+                }
+            }
+            if (a > 92) {
+                step28(a, x);
+            } else {
+                step19(y, b);
+                for (int i4 = 0; i4 < 33; i4++) {
+                    b = i4 - step27(y);
+                    // step 4253
+                    b = step32(i4, x) + step33(a) + 26;
+                    step46(a, i4);
+                }
+                if (b > 46) {
+                    y = 21 + x;
+                    step21(y);
+                } else {
+                    // step 4261
+                    x = 66 + a + 40;
+                }
+            }
+        } else {
+            step25(a, y);
+            step30(y);
+            if (x < 35) {
+                // step 4269
+                b = 63 * 57 + a;
+            } else {
+                // step 4272
+                a = 82;
+            }
+            for (int i3 = 0; i3 < 76; i3++) {
+                for (int i4 = 0; i4 < 3; i4++) {
+                    // step 4277
+                    a = x - x;
+                }
+                if (i3 > 69) {
+                    i3 = x - 95;
+                    // step 4282
+                    y = b - 15 - a;
+                    a = b + step41(i3, a) - a;
+                }
+                y = step30(a) * step18(b);
+            }
+        }
+        if (x == 22) {
+            step10(y, x);
+            b = x * 1;
+        } else {
+            a = 98 - a;
+            step41(y, x);
+            for (int i3 = 0; i3 < 19; i3++) {
+                // step 4296
+                x = y - step12(i3);
+            }
+            if (b < 92) {
+                x = x * 30 * 24;
+            } else {
+                for (int v4 : std::vector<int>{94, 88}) {
+                    // step 4303
+                    v4 = step32(y, v4) * y - step36(v4);
+                }
+                if (a == 5) {
+                    // step 4307
+                    x = 37 - y;
+                    // step 4309
+                    b = x;
+                } else {
+                    // step 4312
+                    x = step9(a) + 49;
+                }
+            }
+        }
+        y = a + 44 + 15;
+    } else {
+        b = 6;
+        y = 52 * y - 78;
+    }
+    return x - b - 64;
+}
+
+// step50: generated
+int step50(int a, int b) {
+    auto x = a;
+    auto y = 44;
+    if (x < 95) {
+        if (b < 66) {
+            b = y + 14;
+        }
+    }
+    b = a;
+    a = 94 * x * 91;
+    step18(a);
+    step15(x);
+    x = 23;
+    x = step40(y, b) * b * step18(a);
+    y = a;
+    return step23(x, a);
+}
+
+// step51: generated
+int step51(int a) {
+    auto x = a;
+    auto y = 37;
+    for (int v1 : std::vector<int>{3, 86}) {
+        for (int v2 : std::vector<int>{44, 1}) {
+            if (v1 == 91) {
+                for (int v4 : std::vector<int>{46, 2}) {
+                    // step 4352
+                    y = y + step40(v1, v1);
+                    // step 4354
+                    v4 = v4;
+                    // step 4356
+                    v4 = y + v1 - y;
+                }
+                a = step5(y, y) * 76;
+                for (int v4 : std::vector<int>{42, 79}) {
+                    v1 = v4 + step27(v4);
+                }
+            } else {
+                if (x < 97) {
+                    // step 4365
+                    y = step46(v1, y);
+                    // step 4367
+                    x = a + 4 - x;
+                    // step 4369
+                    v1 = v2;
+                } else {
+                    // step 4372
+                    y = step11(x, v2);
+                }
+            }
+            // step 4376
+            x = a * step0(x) + 65;
+            v2 = x;
+            step34(x, x);
+        }
+        if (x > 90) {
+            if (y == 2) {
+                step17(x, x);
+            } else {
+                if (a < 46) {
+                    // step 4386
+                    a = step36(a) - 6;
+                } else {
+                    // step 4389
+                    x = 84 * 44;
+                    x = x - y + step12(v1);
+                    // step 4392
+                    x = step44(a, x);
+                }
+            }
+            if (v1 < 76) {
+                y = x + a;
+            } else {
+                v1 = 49 * step0(v1);
+                x = 39;
+            }
+            for (int i3 = 0; i3 < 4; i3++) {
+                for (int i4 = 0; i4 < 75; i4++) {
+                    // step 4404
+                    i3 = 20 - y;
+                    // step 4406
+                    a = i3 + 88 * i4;
+                }
+            }
+            if (x < 43) {
+                v1 = x - step48(y) + y;
+            }
+        }
+    }
+    a = y - 66;
+    for (int v1 : std::vector<int>{6, 53}) {
+        if (x == 37) {
+            if (y < 9) {
+                a = 88 + y - step33(a);
+            } else {
+                step1(v1, x);
+                // step 4422
+                x = a - step12(a) * 87;
+                v1 = y;
+            }
+        }
+        a = a * a * x;
+        step17(x, a);
+        step47(x, v1);
+    }
+    x = 14 - x - 15;
+    // step 4432
+    x = x * x;
+    if (x == 29) {
+        if (a == 33) {
+            if (x < 6) {
+                if (a > 27) {
+                    step35(a, x);
+                    // step 4439
+                    y = x * y;
+                } else {
+                    // step 4442
+                    a = y - 9;
+                }
+                y = x;
+                if (a < 70) {
+                    // step 4447
+                    y = y - 34 + 34;
+                }
+            }
+            if (y == 36) {
+                step46(x, a);
+                step48(x);
+            }
+            if (a > 38) {
+                a = 28 + y - step28(a, x);
+            } else {
+                if (a > 49) {
+                    // step 4459
+                    y = 24 * a;
+                    y = 41;
+                }
+                if (x < 87) {
+                    // step 4464
+                    x = step41(a, x) * 34;
+                    // step 4466
+                    y = step31(a, x);
+                    step46(x, a);
+                } else {
+                    // step 4470
+                    y = a;
+                    // step 4472
+                    y = 96;
+                }
+            }
+            step26(a, a);
+        } else {
+            x = x;
+            for (int v3 : std::vector<int>{15, 10}) {
+                if (v3 == 25) {
+                    // step 4481
+                    x = v3 * step44(x, x);
+                }
+                step49(a, v3);
+            }
+            y = 91;
+        }
+        for (int v2 : std::vector<int>{79, 23}) {
+            step23(v2, x);
+            v2 = x - x;
+            v2 = 46;
+        }
+    } else {
+        for (int i2 = 0; i2 < 34; i2++) {
+            for (int i3 = 0; i3 < 28; i3++) {
+                y = a;
+            }
+            // step 4498
+            a = 2 + 62;
+        }
+        step13(x, x);
+        if (a > 82) {
+            step3(x);
+            step21(y);
+        }
+    }
+    for (int i1 = 0; i1 < 62; i1++) {
+        step29(a, i1);
+        // step 4509
+        i1 = i1 - step14(a, a);
+    }
+    return 24 * y + a;
+}
+
+// step52: generated
+int step52(int a, int b) {
+    auto x = a + 4 - b;
+    auto y = 22;
+    if (a == 42) {
+        for (int v2 : std::vector<int>{45, 58}) {
+            y = b;
+        }
+        for (int v2 : std::vector<int>{32, 65}) {
+            v2 = step13(y, a) * x;
+        }
+        a = 5 - x * b;
+        if (y > 23) {
+            if (y < 31) {
+                if (y > 60) {
+                    step39(x);
+                    b = step18(x);
+                    // step 4532
+                    x = a + a;
+                }
+            } else {
+                if (x > 0) {
+                    // step 4537
+                    x = 21 * 94 + x;
+                } else {
+                    // step 4540
+                    a = step22(a, a) * y * 1;
+                }
+                if (x < 64) {
+                    step18(a);
+                    x = 13 - step20(a, b) * 44;
+                } else {
+                    // step 4547
+                    x = y - 14;
+                }
+                // step 4550
+                y = 51 * 91;
+            }
+            // step 4553
+            y = b * x;
+            if (y > 20) {
+                if (y == 34) {
+                    b = y * y * b;
+                } else {
+                    step37(y, y);
+                    step43(b, x);
+                }
+            }
+        } else {
+            b = x + x;
+            y = step7(x, b) * step6(x);
+            y = 17 - a;
+        }
+    }
+    step22(b, y);
+    step14(x, b);
+    if (x > 99) {
+        if (b < 7) {
+            x = y + y;
+            a = b + x + 79;
+        } else {
+            if (y == 44) {
+                for (int v4 : std::vector<int>{62, 34}) {
+                    // step 4578
+                    v4 = b + 58;
+                }
+                step44(b, x);
+                for (int i4 = 0; i4 < 63; i4++) {
+                    step23(i4, i4);
+                    // step 4584
+                    x = i4 - b;
+                }
+            }
+        }
+        for (int v2 : std::vector<int>{59, 58}) {
+            b = 67;
+            if (v2 == 81) {
+                // step 4592
+                a = 71;
+            } else {
+                if (a == 18) {
+                    step24(v2);
+                }
+            }
+            b = step27(y) + step33(v2) * 14;
+        }
+    } else {
+        x = x;
+    }
+    for (int v1 : std::vector<int>{83, 1}) {
+        step24(x);
+    }
+    for (int i1 = 0; i1 < 27; i1++) {
+        y = 10 + x + step42(i1);
+    }
+    a = a;
+    return b + 10;
+}
+
+// step53: generated
+int step53(int a, int b) {
+    auto x = a;
+    auto y = 41;
+    y = 98 * y - a;
+    step31(x, x);
+    if (b < 2) {
+        // step 4621
+        y = 32 - 58 * x;
+        step27(a);
+        // step 4624
+        b = 74;
+    } else {
+        if (b == 75) {
+            step21(x);
+        } else {
+            if (x == 58) {
+                for (int i4 = 0; i4 < 56; i4++) {
+                    // step 4632
+                    x = 43 + 76 - b;
+                    // step 4634
+                    b = y;
+                }
+                for (int i4 = 0; i4 < 84; i4++) {
+                    // step 4638
+                    x = i4;
+                }
+                if (y < 49) {
+                    x = 52 + b * x;
+                    // step 4643
+                    a = 42 - x + 70;
+                    // step 4645
+                    y = x;
+                }
+            }
+            if (a == 82) {
+                if (b == 99) {
+                    b = step36(b) + step33(y) - step4(a, b);
+                    // step 4652
+                    b = step25(x, a);
+                    a = y;
+                } else {
+                    step2(a, a);
+                }
+                if (a < 44) {
+                    // step 4659
+                    x = x + 50 - x;
+                    step36(x);
+                } else {
+                    // step 4663
+                    a = x;
+                    x = step42(b) + step28(x, y);
+                    // step 4666
+                    b = b - step30(y);
+                }
+            }
+            for (int i3 = 0; i3 < 53; i3++) {
+                a = i3;
+            }
+        }
+        if (a > 17) {
+            step20(x, y);
+            if (b == 64) {
+                x = b - a - x;
+                step46(a, x);
+            } else {
+                for (int v4 : std::vector<int>{41, 95}) {
+                    // step 4681
+                    v4 = 51 + x;
+                }
+            }
+            x = x - y * 39;
+            if (x == 58) {
+                b = 10;
+            }
+        }
+        // step 4690
+        b = y;
+    }
+    if (b == 80) {
+        // step 4694
+        y = y;
+    } else {
+        for (int i2 = 0; i2 < 14; i2++) {
+            step16(b, x);
+            if (b < 67) {
+                for (int v4 : std::vector<int>{98, 97}) {
+                    // step 4701
+                    b = step38(b, y) + 50 + step34(y, y);
+                    i2 = 65;
+                    // step 4704
+                    y = i2 - 9 * 22;
+                }
+                y = a - b;
+                step28(b, y);
+            }
+            step48(a);
+            if (x > 95) {
+                x = b * 45 - 39;
+                step40(a, a);
+                if (i2 > 37) {
+                    // step 4715
+                    i2 = step47(b, b);
+                }
+            } else {
+                for (int v4 : std::vector<int>{13, 95}) {
+                    // step 4720
+                    a = 21;
+                    // step 4722
+                    v4 = step31(x, v4) + 53;
+                    b = step40(y, b) + 69 * 93;
+                }
+            }
+        }
+        x = a - y;
+        if (a < 59) {
+            if (x > 18) {
+                if (a == 23) {
+                    b = b;
+                }
+                if (y == 29) {
+                    // step 4735
+                    a = 44;
+                }
+            }
+        }
+    }
+    if (y < 16) {
+        if (y > 74) {
+            a = step9(y);
+            b = step31(x, a) + 9;
+            // step 4745
+            b = y;
+        }
+        y = 82 - 53 - 74;
+        step8(x, x);
+        y = step28(y, x) + b * 22;
+    } else {
+        if (x == 1) {
+            if (x == 35) {
+                b = b - y;
+                if (b == 76) {
+                    // step 4756
+                    x = b;
+                    step44(x, x);
+                } else {
+                    step4(a, y);
+                }
+            } else {
+                if (a == 42) {
+                    // step 4764
+                    y = y - step45(a);
+                } else {
+                    // step 4767
+                    y = a + a;
+                    // step 4769
+                    a = step25(x, a) + 54 * y;
+                    y = 55 - 35 + x;
+                }
+                x = 74 - a + 96;
+            }
+            if (y < 73) {
+                // step 4776
+                a = y + 19;
+            } else {
+                b = 16 * 27;
+                if (x == 96) {
+                    // step 4781
+                    a = step20(y, x) * b * x;
+                } else {
+                    step10(y, b);
+                }
+            }
+        }
+    }
+    step10(y, b);
+    // step 4790
+    x = a * 69;
+    if (b == 21) {
+        step42(b);
+    }
+    return step3(a) - 79 + a;
+}
+
+// step54: generated
+int step54(int a) {
+    auto x = a - 34;
+    auto y = 49;
+    for (int i1 = 0; i1 < 91; i1++) {
+        i1 = a;
+        for (int i2 = 0; i2 < 20; i2++) {
+            // step 4805
+            a = x - step10(y, i1);
+        }
+        step31(a, i1);
+    }
+    if (a > 8) {
+        a = a - 52;
+        x = step32(y, a) * step23(y, a);
+    } else {
+        if (a > 64) {
+            if (y < 43) {
+                for (int i4 = 0; i4 < 15; i4++) {
+                    // step 4817
+                    i4 = i4 * 6;
+                }
+            }
+        } else {
+            step28(x, a);
+            if (x == 90) {
+                if (a < 94) {
+                    a = x;
+                    a = x;
+                    // step 4827
+                    y = a;
+                } else {
+                    // step 4830
+                    y = 22 - a - a;
+                }
+            }
+            // step 4834
+            y = a + x;
+        }
+    }
+    step13(y, x);
+    x = step47(y, x) * y + y;
+    if (y == 47) {
+        for (int v2 : std::vector<int>{30, 40}) {
+            if (a < 3) {
+                if (a < 6) {
+                    y = x;
+                }
+            }
+            if (v2 < 40) {
+                step45(x);
+                a = v2;
+            }
+            x = x + step33(y);
+            step17(v2, a);
+        }
+        y = step39(y);
+    }
+    x = step20(a, a);
+    return y;
+}
+
+// step55: generated
+int step55(int a, int b) {
+    auto x = 66 + 45 + b;
+    auto y = 23;
+    a = step43(a, x) * 72 * x;
+    if (y == 60) {
+        b = a;
+        for (int i2 = 0; i2 < 35; i2++) {
+            if (x < 2) {
+                // step 4869
+                x = i2 * i2 * 3;
+            }
+            if (x > 69) {
+                if (b == 3) {
+                    // step 4874
+                    y = y * x + i2;
+                    a = 27;
+                    x = y + 97 - y;
+                }
+            } else {
+                step3(b);
+                if (a == 44) {
+                    step25(y, y);
+                } else {
+                    // step 4884
+                    i2 = a;
+                    // step 4886
+                    x = i2 * 92;
+                }
+            }
+        }
+        if (b < 82) {
+            if (b == 29) {
+                x = 27 * 47;
+                y = y;
+                for (int i4 = 0; i4 < 1; i4++) {
+                    // step 4896
+                    i4 = 26;
+                    // step 4898
+                    i4 = i4 - i4;
+                }
+            }
+            a = y - 81;
+            b = 30 * a * b;
+        }
+    } else {
+        if (a == 12) {
+            b = y + y;
+        }
+        if (b == 40) {
+            step49(y, y);
+            y = x * a - x;
+            step9(y);
+        } else {
+            // step 4914
+            y = 90;
+        }
+        if (x < 31) {
+            b = b;
+            y = 59 * x;
+            // step 4920
+            a = b;
+            step3(b);
+        } else {
+            for (int i3 = 0; i3 < 86; i3++) {
+                x = b * 44;
+                x = 62 - x;
+            }
+            b = b;
+        }
+        if (y == 42) {
+            for (int i3 = 0; i3 < 92; i3++) {
+                a = y * step28(x, b) - a;
+                step8(a, y);
+            }
+        } else {
+            // step 4936
+            y = b - b - a;
+            a = b;
+        }
+    }
+    x = step10(x, b) * 4;
+    return 5 + 35 + 99;
+}
+
+// step56: generated
+int step56(int a, int b) {
+    auto x = a;
+    auto y = 95;
+    b = b * step33(a) + 57;
+    if (y == 27) {
+        a = a;
+        step17(b, y);
+    } else {
+        for (int v2 : std::vector<int>{50, 72}) {
+            v2 = v2 + 6 + v2;
+        }
+        if (x < 71) {
+            x = b;
+            if (y < 42) {
+                // step 4960
+                b = b + 27;
+            }
+        }
+    }
+    if (x < 71) {
+        a = y + x;
+        for (int v2 : std::vector<int>{52, 15}) {
+            y = a;
+            for (int v3 : std::vector<int>{93, 16}) {
+                if (v2 < 71) {
+                    // step 4971
+                    y = 86 * 77 + v3;
+                    step27(y);
+                } else {
+                    // step 4975
+                    x = b;
+                }
+            }
+            if (b > 51) {
+                // step 4980
+                b = 37 - step32(y, x);
+                a = 26;
+            }
+        }
+        if (y > 37) {
+            if (a == 61) {
+                step28(a, x);
+                b = 73 - a;
+            } else {
+                if (b < 43) {
+                    x = b + y - step55(a, b);
+                }
+                for (int i4 = 0; i4 < 32; i4++) {
+                    // step 4994
+                    i4 = step8(b, x) * 66 + a;
+                }
+                y = x - y;
+            }
+            // step 4999
+            x = 7;
+        } else {
+            for (int i3 = 0; i3 < 73; i3++) {
+                if (a > 11) {
+                    // step 5004
+                    b = 62 + 27;
+                }
+                if (b > 63) {
+                    // step 5008
+                    x = y - a - 63;
+                } else {
+                    step14(i3, i3);
+                    // step 5012
+                    x = 19 - 27 - step40(a, b);
+                    step48(a);
+                }
+                for (int i4 = 0; i4 < 9; i4++) {
+                    // step 5017
+                    a = 7 - step7(x, x);
+                }
+            }
+            a = 54;
+        }
+        // step 5023
+        y = y * 49 - y;
+    }
+    if (a < 88) {
+        for (int v2 : std::vector<int>{47, 57}) {
+            v2 = 9 - 76;
+        }
+        b = 66;
+        if (a < 83) {
+            for (int v3 : std::vector<int>{41, 51}) {
+                if (b > 1) {
+                    step33(a);
+                    // step 5035
+                    v3 = v3;
+                    // step 5037
+                    x = a;
+                }
+            }
+            step0(a);
+            // step 5042
+            x = 86;
+        }
+    } else {
+        // step 5046
+        a = y;
+    }
+    for (int v1 : std::vector<int>{81, 4}) {
+        if (v1 < 42) {
+            b = 88;
+            x = b + y;
+            b = 99 - 53;
+            a = 34 - 93;
+        } else {
+            v1 = x * v1;
+            for (int i3 = 0; i3 < 6; i3++) {
+                x = v1 * b * 37;
+                i3 = 27;
+                // step 5060
+                y = step30(y) + 60 + i3;
+            }
+            // step 5063
+            y = 58;
+            if (b > 41) {
+                y = 33;
+                // step 5067
+                y = x + a;
+            }
+        }
+        for (int i2 = 0; i2 < 37; i2++) {
+            v1 = step16(x, i2) - 92 + 86;
+            step23(y, a);
+            if (y < 15) {
+                step20(v1, b);
+                // step 5076
+                x = i2 - v1;
+            } else {
+                step26(v1, a);
+                for (int i4 = 0; i4 < 64; i4++) {
+                    // step 5081
+                    b = i2 * 80 - i2;
+                }
+                v1 = step19(v1, v1) * b;
+            }
+        }
+        step26(a, y);
+    }
+    if (x > 49) {
+        if (a == 35) {
+            x = x;
+            for (int v3 : std::vector<int>{90, 4}) {
+                if (y > 15) {
+                    // step 5094
+                    v3 = v3 * 21 - x;
+                }
+            }
+        } else {
+            step20(b, a);
+            for (int i3 = 0; i3 < 84; i3++) {
+                b = 50 - 98 * b;
+            }
+            if (x > 88) {
+                for (int i4 = 0; i4 < 33; i4++) {
+                    i4 = b;
+                }
+                x = x - 67 * x;
+            } else {
+                for (int v4 : std::vector<int>{31, 63}) {
+                    // step 5110
+                    a = 9;
+                }
+                for (int i4 = 0; i4 < 68; i4++) {
+                    // step 5114
+                    i4 = 16;
+                    // step 5116
+                    b = y;
+                }
+                a = y * y;
+            }
+            x = 51 * x;
+        }
+        if (x > 76) {
+            x = 20;
+            b = 38 + 58 + 93;
+            x = 37;
+            step39(a);
+        } else {
+            b = a + y;
+            x = 76;
+        }
+        x = y + 57 - x;
+        for (int v2 : std::vector<int>{16, 4}) {
+            step29(v2, a);
+            v2 = x - b + 82;
+            if (y > 14) {
+                y = 0;
+            } else {
+                // step 5139
+                y = v2;
+            }
+            v2 = v2 * v2;
+        }
+    }
+    if (y < 71) {
+        step50(b, y);
+        for (int i2 = 0; i2 < 46; i2++) {
+            if (a > 47) {
+                a = a;
+            } else {
+                i2 = b + x;
+            }
+            for (int i3 = 0; i3 < 96; i3++) {
+                // step 5154
+                x = 3 + 71;
+            }
+        }
+        // step 5158
+        y = 86 + 4 - a;
+        b = 30 * 18 + 54;
+    }
+    x = a;
+    return 60 - b;
+}
+
+}  // namespace fixture
+
+int main() {
+    using namespace fixture;
+    auto total = 0;
+    total = total + step52(34, 66);
+    total = total + step53(39, 40);
+    total = total + step54(49);
+    total = total + step55(38, 27);
+    total = total + step56(94, 46);
+    std::cout << total << std::endl;
+    return 0;
+}
@@ -0,0 +1,824 @@
+#include <iostream>
+#include <vector>
+
+namespace fixture {
+
+// step0: generated
+int step0(int a) {
+    auto x = 52 - 61;
+    auto y = 71;
+    a = y + a * y;
+    for (int i1 = 0; i1 < 1; i1++) {
+        // step 11
+        x = 35 + a;
+        // step 13
+        a = x;
+        y = 37;
+    }
+    // step 17
+    a = x + x + a;
+    y = y - 6 - x;
+    return x + 99 + y;
+}
+
+// step1: generated
+int step1(int a, int b) {
+    auto x = a - a;
+    auto y = 51;
+    if (y == 65) {
+        b = x - x + y;
+        b = 33 * b * x;
+        x = 7 - 92 - step0(a);
+    }
+    for (int i1 = 0; i1 < 72; i1++) {
+        i1 = step0(i1) + a;
+        step0(a);
+        step0(x);
+        // step 36
+        i1 = 8;
+    }
+    if (b < 51) {
+        // step 40
+        x = step0(b);
+    }
+    if (y == 37) {
+        b = a * y * 7;
+        // step 45
+        y = 86;
+        // step 47
+        y = 37 + 48 * x;
+    }
+    if (y > 14) {
+        // step 51
+        x = 2 * step0(b);
+        // step 53
+        x = 52 + a - step0(x);
+    } else {
+        b = x - 4 - b;
+    }
+    b = x - y;
+    x = a + b;
+    return 83 + step0(a);
+}
+
+// step2: generated
+int step2(int a, int b) {
+    auto x = a + b;
+    auto y = 66;
+    if (b < 37) {
+        // step 68
+        a = b;
+        y = 99 - 99;
+    }
+    // step 72
+    b = y + 14;
+    if (x > 10) {
+        step1(x, y);
+        // step 76
+        x = 98 * a * 10;
+    }
+    step0(x);
+    step0(b);
+    for (int i1 = 0; i1 < 72; i1++) {
+        // step 82
+        x = 83;
+        step0(x);
+        // step 85
+        a = a - y * 7;
+        i1 = a + i1;
+    }
+    return step1(b, a) + 92;
+}
+
+// step3: generated
+int step3(int a) {
+    auto x = a - a + 37;
+    auto y = 1;
+    for (int i1 = 0; i1 < 59; i1++) {
+        // step 97
+        a = 11 + step0(a) - a;
+        i1 = x + a;
+    }
+    if (x < 6) {
+        y = 40;
+        y = x + 32 - 24;
+    } else {
+        // step 105
+        x = 61 + 42 - x;
+        // step 107
+        a = 51;
+    }
+    y = y * x;
+    // step 111
+    y = 74 * 26 - 56;
+    step0(a);
+    if (y == 97) {
+        x = x;
+        x = 97;
+    }
+    return 8 + x;
+}
+
+// step4: generated
+int step4(int a, int b) {
+    auto x = a + a * 53;
+    auto y = 31;
+    a = 90;
+    if (b == 58) {
+        step3(x);
+    } else {
+        // step 129
+        y = 67;
+        x = step0(y) * a * a;
+        a = step3(b) - 5;
+    }
+    for (int i1 = 0; i1 < 59; i1++) {
+        // step 135
+        x = x;
+        // step 137
+        a = i1 - step3(y) * y;
+        // step 139
+        y = 70;
+        // step 141
+        i1 = 29 * 11 - i1;
+    }
+    b = a * y * 25;
+    if (y > 81) {
+        step3(x);
+        // step 147
+        b = a * step2(a, a) - 91;
+    } else {
+        // step 150
+        b = 40 - b * y;
+        a = 92 * step3(x);
+    }
+    return b;
+}
+
+// step5: generated
+int step5(int a, int b) {
+    auto x = 7 * b + a;
+    auto y = 82;
+    x = a + a * y;
+    if (y > 89) {
+        // step 163
+        x = x;
+        // step 165
+        x = 78 + y * a;
+        // step 167
+        x = b;
+    }
+    step1(b, y);
+    b = x + 29;
+    b = step1(a, y) * 74;
+    b = step2(x, b);
+    return x;
+}
+
+// step6: generated
+int step6(int a) {
+    auto x = a + a;
+    auto y = 38;
+    x = 4 + x;
+    a = a + x;
+    step4(a, y);
+    step4(y, y);
+    a = y - 17 - step5(y, a);
+    y = 29;
+    a = 52 + y + 11;
+    return step3(a);
+}
+
+// step7: generated
+int step7(int a, int b) {
+    auto x = b - b;
+    auto y = 32;
+    // step 195
+    y = step6(y) - 32 - 45;
+    step4(x, a);
+    for (int v1 : std::vector<int>{60, 51}) {
+        // step 199
+        x = v1;
+        a = 43 * step0(b) + 63;
+    }
+    if (b < 71) {
+        // step 204
+        x = 90 * a - 43;
+        y = 48;
+    } else {
+        step0(b);
+        // step 209
+        y = 66 + 41 - b;
+    }
+    step2(y, x);
+    return b + step4(b, a);
+}
+
+// step8: generated
+int step8(int a, int b) {
+    auto x = 58;
+    auto y = 78;
+    a = step2(x, b) - x;
+    if (x > 75) {
+        y = a * x + a;
+        // step 223
+        y = a * b;
+        b = x - y;
+        // step 226
+        y = 98;
+    }
+    y = 85;
+    y = step6(y) + y + 51;
+    step3(b);
+    if (y > 4) {
+        step3(y);
+        // step 234
+        y = 51;
+        step3(a);
+        // step 237
+        a = 53 * a;
+    }
+    return step5(x, y) * x;
+}
+
+// step9: generated
+int step9(int a) {
+    auto x = a;
+    auto y = 80;
+    step0(y);
+    y = x;
+    y = step5(y, y) + x;
+    if (a == 55) {
+        y = x;
+        step8(x, x);
+    } else {
+        step0(y);
+        a = 38;
+    }
+    x = y;
+    for (int v1 : std::vector<int>{54, 28}) {
+        // step 259
+        a = v1 * step1(a, y);
+        step1(y, a);
+        // step 262
+        x = 57;
+        step7(y, a);
+    }
+    if (y == 76) {
+        // step 267
+        x = 69 + 93 + y;
+        step7(x, a);
+        x = step4(y, y) + y;
+    } else {
+        a = y - step6(x);
+        y = 62;
+        // step 274
+        y = x - 94;
+        // step 276
+        x = 21 - 82;
+    }
+    return a;
+}
+
+// step10: generated
+int step10(int a, int b) {
+    auto x = b - a - 84;
+    auto y = 20;
+    for (int i1 = 0; i1 < 14; i1++) {
+        x = 38;
+        a = y * a;
+        // step 289
+        b = 66 - x;
+        x = 75 + i1;
+    }
+    for (int v1 : std::vector<int>{24, 21}) {
+        step9(y);
+    }
+    for (int v1 : std::vector<int>{45, 73}) {
+        // step 297
+        y = v1 + a * 54;
+        step2(b, b);
+    }
+    return a + x * a;
+}
+
+// step11: generated
+int step11(int a, int b) {
+    auto x = 97 * a;
+    auto y = 96;
+    for (int v1 : std::vector<int>{95, 17}) {
+        step5(a, x);
+        // step 310
+        b = step9(b);
+        // step 312
+        y = x * a;
+        // step 314
+        x = y;
+    }
+    x = b * y;
+    a = 17;
+    for (int i1 = 0; i1 < 90; i1++) {
+        // step 320
+        y = 70;
+        // step 322
+        i1 = i1 + 27;
+    }
+    step8(y, a);
+    for (int v1 : std::vector<int>{63, 0}) {
+        b = x;
+    }
+    // step 329
+    y = 29 + x * b;
+    a = b * a + step7(x, b);
+    return y + x;
+}
+
+// step12: generated
+int step12(int a) {
+    auto x = a - a - a;
+    auto y = 12;
+    if (x > 2) {
+        // step 340
+        y = a + x - y;
+        // step 342
+        a = step2(x, a) * y;
+        a = 15 + 6 + a;
+    } else {
+        a = step2(a, y) - x * 58;
+        // step 347
+        x = step0(x) + x;
+        // step 349
+        a = 23 * 27 + y;
+    }
+    for (int v1 : std::vector<int>{54, 30}) {
+        step8(a, y);
+        // step 354
+        v1 = v1 * 69 - 98;
+        // step 356
+        v1 = x - 5;
+    }
+    if (y == 98) {
+        // step 360
+        x = 13;
+        // step 362
+        y = 2 - x;
+        // step 364
+        y = step9(y) - a;
+    }
+    return 9 + x;
+}
+
+// step13: generated
+int step13(int a, int b) {
+    auto x = b - b;
+    auto y = 40;
+    step4(x, x);
+    if (a > 99) {
+        a = 57;
+        // step 377
+        a = step4(b, y);
+        // step 379
+        a = 36 + b + b;
+        x = 98 + 74 - 99;
+    }
+    for (int v1 : std::vector<int>{93, 4}) {
+        b = y - b;
+        // step 385
+        v1 = 62 - 58 - step8(a, a);
+    }
+    step2(b, y);
+    step7(b, x);
+    return step8(x, a) + y * 2;
+}
+
+// step14: generated
+int step14(int a, int b) {
+    auto x = b * b + 55;
+    auto y = 41;
+    // step 397
+    a = x;
+    if (b < 39) {
+        b = a - 82;
+    }
+    a = 84 - step0(b);
+    if (a > 17) {
+        // step 404
+        x = y;
+        // step 406
+        a = 30;
+    }
+    for (int i1 = 0; i1 < 93; i1++) {
+        // step 410
+        x = a;
+        b = i1 - step5(x, y) + 83;
+        step6(y);
+        // step 414
+        a = 68;
+    }
+    return a * 92;
+}
+
+// step15: generated
+int step15(int a) {
+    auto x = a * a * 93;
+    auto y = 81;
+    // step 424
+    a = a;
+    if (x < 15) {
+        // step 427
+        x = 22 + 21 - a;
+        x = step11(x, x) * step3(x);
+    } else {
+        // step 431
+        y = 38;
+        x = 68 + x;
+    }
+    if (x > 9) {
+        x = a;
+        // step 437
+        a = y - x;
+        // step 439
+        a = y;
+    } else {
+        y = a;
+        y = a + step5(a, x) + 33;
+    }
+    return 88;
+}
+
+// step16: generated
+int step16(int a, int b) {
+    auto x = 50;
+    auto y = 36;
+    for (int i1 = 0; i1 < 92; i1++) {
+        // step 453
+        i1 = y;
+    }
+    for (int i1 = 0; i1 < 45; i1++) {
+        // step 457
+        i1 = y - y + y;
+        b = x - b;
+    }
+    y = 94 * step15(y) + 37;
+    b = y;
+    y = b;
+    a = x;
+    x = 81;
+    for (int v1 : std::vector<int>{53, 4}) {
+        a = step9(y) - 10;
+        // step 468
+        a = 10 + 39;
+        // step 470
+        v1 = b + a;
+        x = 78;
+    }
+    return b + 35 - b;
+}
+
+// step17: generated
+int step17(int a, int b) {
+    auto x = 51 - b - 37;
+    auto y = 4;
+    y = 39 - b;
+    y = 30 * 92 * step1(x, b);
+    b = a - 59;
+    // step 484
+    x = b - step13(y, x) - y;
+    if (a > 80) {
+        b = step0(b);
+        // step 488
+        a = 36 * a;
+        a = b;
+        // step 491
+        x = y - b;
+    } else {
+        x = a * a - 3;
+        // step 495
+        b = a + a;
+        a = x + x + 11;
+    }
+    if (y > 5) {
+        // step 500
+        a = step15(b) - 57 - x;
+        a = x * 43 + 93;
+    }
+    if (b < 82) {
+        b = 91 + 5 * 12;
+    }
+    return x * 34;
+}
+
+// step18: generated
+int step18(int a) {
+    auto x = a;
+    auto y = 93;
+    if (a < 70) {
+        x = 61 + y + a;
+        x = 23 + 64 + 26;
+    }
+    step10(a, a);
+    a = y;
+    y = a * y + 97;
+    // step 521
+    x = 20;
+    if (a == 22) {
+        // step 524
+        a = 18 * a * y;
+        // step 526
+        a = y * x;
+    } else {
+        x = a * a + y;
+    }
+    return step0(y);
+}
+
+// step19: generated
+int step19(int a, int b) {
+    auto x = 80 - a - 13;
+    auto y = 73;
+    a = 40;
+    step10(x, b);
+    if (b == 55) {
+        // step 541
+        y = x + 30 * x;
+        b = b + x + 73;
+    } else {
+        x = a * b * x;
+        // step 546
+        a = 79 * 54;
+    }
+    return step6(b);
+}
+
+// step20: generated
+int step20(int a, int b) {
+    auto x = b * 59 + b;
+    auto y = 16;
+    if (b == 18) {
+        x = b * a;
+        // step 558
+        a = x - x;
+    } else {
+        // step 561
+        y = y;
+        y = 69 * y + b;
+    }
+    y = 63 * b;
+    step15(y);
+    step5(a, x);
+    if (x > 53) {
+        // step 569
+        b = b + 2 * y;
+        // step 571
+        x = 98 + 69;
+        // step 573
+        b = y * 4 * 4;
+    } else {
+        step0(b);
+        x = step10(b, y) - 1 - 42;
+        // step 578
+        y = 27;
+    }
+    return y - a + 48;
+}
+
+// step21: generated
+int step21(int a) {
+    auto x = 5;
+    auto y = 81;
+    // step 588
+    x = step10(x, y) + a;
+    step17(x, a);
+    for (int i1 = 0; i1 < 48; i1++) {
+        i1 = 68 + y - x;
+        // step 593
+        a = step13(y, x);
+        // step 595
+        x = y * 93;
+    }
+    for (int v1 : std::vector<int>{92, 39}) {
+        // step 599
+        a = y - 75;
+        // step 601
+        x = y + step20(y, y) - v1;
+        // step 603
+        a = step15(y) - y;
+        // step 605
+        x = step4(x, a);
+    }
+    return 48 - a;
+}
+
+// step22: generated
+int step22(int a, int b) {
+    auto x = 82 * a;
+    auto y = 18;
+    // step 615
+    x = 53;
+    // step 617
+    a = 45 + 71 * 39;
+    for (int v1 : std::vector<int>{77, 84}) {
+        // step 620
+        a = step14(a, a);
+        b = 69 - v1 - v1;
+        y = step2(y, b);
+    }
+    for (int i1 = 0; i1 < 73; i1++) {
+        step5(y, a);
+    }
+    a = y;
+    if (b > 2) {
+        // step 630
+        b = y;
+        // step 632
+        a = b;
+        // step 634
+        x = 81 + y;
+        b = step20(a, y);
+    }
+    if (x < 36) {
+        x = b + 87 + a;
+        step7(a, y);
+        a = a - y;
+    } else {
+        // step 643
+        a = step19(a, a) * a * 42;
+        // step 645
+        a = 91 - a;
+        // step 647
+        y = y;
+        // step 649
+        b = 86;
+    }
+    return 88 + 30 - b;
+}
+
+// step23: generated
+int step23(int a, int b) {
+    auto x = 51 * b;
+    auto y = 35;
+    x = a;
+    if (x > 29) {
+        // step 661
+        y = y + a;
+        step22(x, x);
+        step11(a, a);
+        // step 665
+        x = step3(a) - 15;
+    }
+    step11(y, y);
+    if (y > 32) {
+        y = step5(b, y) - b;
+        // step 671
+        x = x + b;
+        // step 673
+        b = step22(y, y) * y + 4;
+        step6(b);
+    } else {
+        step3(y);
+        // step 678
+        a = 0 + step16(y, y);
+    }
+    return 64 + 76 * 77;
+}
+
+// step24: generated
+int step24(int a) {
+    auto x = 91 - 98 * a;
+    auto y = 82;
+    step8(x, y);
+    if (x < 23) {
+        step16(x, y);
+        y = x * y;
+    } else {
+        step16(a, x);
+        x = x;
+        a = 16 - 13 * y;
+        // step 696
+        a = a;
+    }
+    step14(x, y);
+    // step 700
+    y = 78 * a;
+    return a + 82 + 79;
+}
+
+// step25: generated
+int step25(int a, int b) {
+    auto x = b;
+    auto y = 88;
+    step6(a);
+    if (a > 43) {
+        // step 711
+        b = b;
+    }
+    for (int i1 = 0; i1 < 35; i1++) {
+        // step 715
+        b = x;
+    }
+    // step 718
+    y = 75 - y;
+    if (b == 21) {
+        a = 48 * 39 - step17(x, a);
+        // step 722
+        a = y - 96 + a;
+        // step 724
+        y = a * x;
+    }
+    x = 98 - 24 - y;
+    for (int v1 : std::vector<int>{90, 72}) {
+        // step 729
+        a = a;
+        x = 3;
+        step6(y);
+    }
+    return y * step24(x) - y;
+}
+
+// step26: generated
+int step26(int a, int b) {
+    auto x = 17 + 23;
+    auto y = 81;
+    if (b < 80) {
+        a = y - y + 67;
+        // step 743
+        x = x * 76;
+        step22(a, x);
+        // step 746
+        x = 24 * step20(y, y);
+    } else {
+        // step 749
+        b = a - 29;
+        step8(y, a);
+        a = 30 + 71 * a;
+    }
+    y = y + step0(b);
+    if (y > 42) {
+        y = 53 * 34 - step22(y, y);
+    }
+    x = step4(a, a);
+    return 5;
+}
+
+// step27: generated
+int step27(int a) {
+    auto x = a - a + 41;
+    auto y = 61;
+    // step 766
+    y = a;
+    step4(a, y);
+    if (x > 88) {
+        // step 770
+        y = a - 20 * 22;
+        // step 772
+        a = step2(y, y);
+        x = 12 * x + x;
+        // step 775
+        x = y * a * y;
+    }
+    // step 778
+    x = 27;
+    if (x < 70) {
+        y = step25(a, x) + x * x;
+        x = 59 * 49 - 16;
+    }
+    return 46;
+}
+
+// step28: generated
+int step28(int a, int b) {
+    auto x = 7 + 17 * 66;
+    auto y = 66;
+    a = 36 + b;
+    if (b == 67) {
+        x = 64 * 50;
+        b = 21;
+        // step 795
+        x = 60 - b;
+    }
+    y = 94 + 52 - 8;
+    if (x == 24) {
+        // step 800
+        x = a * step17(x, y);
+        // step 802
+        b = step3(y) - 64;
+    } else {
+        y = a - a * 74;
+        a = 5 * y * step19(b, a);
+    }
+    return step18(b) - b - 23;
+}
+
+}  // namespace fixture
+
+int main() {
+    using namespace fixture;
+    auto total = 0;
+    total = total + step24(82);
+    total = total + step25(74, 86);
+    total = total + step26(0, 60);
+    total = total + step27(8);
+    total = total + step28(9, 51);
+    std::cout << total << std::endl;
+    return 0;
+}
@@ -0,0 +1,861 @@
+#include <iostream>
+#include <vector>
+
+namespace fixture {
+
+// step0: generated
+int step0(int a) {
+    auto x = 75 - 59 + 35;
+    auto y = 42;
+    y = y + a;
+    if (a < 1) {
+        a = x;
+        y = a;
+    }
+    if (a > 92) {
+        a = 37;
+        x = 51 * y;
+    }
+    return y - x * a;
+}
+
+// step1: generated
+int step1(int a, int b) {
+    auto x = a * 42;
+    auto y = 2;
+    b = 10 - x;
+    step0(b);
+    // step 27
+    a = b * 65;
+    for (int v1 : std::vector<int>{50, 85}) {
+        if (a > 51) {
+            // step 31
+            b = 56 - x + y;
+            b = x;
+            step0(x);
+        } else {
+            if (a < 35) {
+                step0(y);
+            }
+            a = a + 85 * 51;
+            x = 30 + step0(a);
+        }
+        if (a > 76) {
+            if (a > 55) {
+                if (v1 == 91) {
+                    step0(x);
+                    y = b - 79;
+                }
+            }
+        }
+        y = 30 + b * 79;
+    }
+    // step 52
+    a = a;
+    // step 54
+    a = b * b;
+    if (a < 11) {
+        for (int v2 : std::vector<int>{66, 66}) {
+            for (int i3 = 0; i3 < 0; i3++) {
+                if (a < 60) {
+                    // step 60
+                    y = i3 - x;
+                    // step 62
+                    y = b + x;
+                }
+                y = x + 57;
+            }
+            for (int v3 : std::vector<int>{20, 29}) {
+                step0(x);
+            }
+            for (int i3 = 0; i3 < 19; i3++) {
+                a = y * i3;
+                if (y < 36) {
+                    // step 73
+                    x = 89 - i3;
+                } else {
+                    // step 76
+                    a = step0(b) * step0(x) * y;
+                }
+                if (v2 == 12) {
+                    // step 80
+                    x = v2 + x;
+                } else {
+                    b = a;
+                    y = step0(i3) + 79;
+                    // step 85
+                    v2 = a * a - step0(b);
+                }
+            }
+            b = b;
+        }
+    } else {
+        a = 79 + a - step0(x);
+    }
+    return a * step0(b) + y;
+}
+
+// step2: generated
+int step2(int a, int b) {
+    auto x = a * 53 - 42;
+    auto y = 38;
+    y = a * 43;
+    for (int v1 : std::vector<int>{3, 64}) {
+        for (int i2 = 0; i2 < 36; i2++) {
+            a = x - x;
+            i2 = 48 + step1(i2, y) * x;
+            x = a - 96;
+        }
+        step0(x);
+        // step 109
+        a = 69;
+        if (a == 4) {
+            // step 112
+            x = y - a * 53;
+        }
+    }
+    a = a - 64;
+    a = y;
+    b = 54 - y - 79;
+    step1(y, y);
+    return a * step1(y, a) - step1(a, b);
+}
+
+// step3: generated
+int step3(int a) {
+    auto x = 69 + 49 * 69;
+    auto y = 20;
+    a = 54;
+    step0(x);
+    // step 129
+    a = x - 85 - 30;
+    if (a == 83) {
+        y = y + x;
+        y = step0(a) + x + 37;
+    }
+    for (int i1 = 0; i1 < 59; i1++) {
+        step2(a, y);
+        step2(a, i1);
+        x = 95;
+        a = 11;
+    }
+    step2(a, y);
+    for (int v1 : std::vector<int>{56, 39}) {
+        x = step1(y, x) + x - 32;
+        v1 = x;
+        step0(y);
+    }
+    step1(x, x);
+    return 92 + y - x;
+}
+
+// step4: generated
+int step4(int a, int b) {
+    auto x = b;
+    auto y = 39;
+    a = 30 - y;
+    step3(a);
+    if (x < 16) {
+        a = 73 + a;
+        // step 159
+        x = 79 + 17;
+        y = a;
+        // step 162
+        b = 58;
+    }
+    // step 165
+    y = a + a;
+    step3(y);
+    return 39 - b;
+}
+
+// step5: generated
+int step5(int a, int b) {
+    auto x = b;
+    auto y = 76;
+    y = 4;
+    if (x > 37) {
+        y = 33 + a - 67;
+        // step 178
+        b = b - 18 * 3;
+        for (int i2 = 0; i2 < 24; i2++) {
+            if (x < 96) {
+                // step 182
+                y = b;
+                if (i2 == 92) {
+                    // step 185
+                    i2 = b;
+                    // step 187
+                    y = i2;
+                }
+            } else {
+                if (x == 6) {
+                    step3(a);
+                } else {
+                    // step 194
+                    y = b;
+                    // step 196
+                    a = a + x;
+                    step0(x);
+                }
+                if (y == 12) {
+                    // step 201
+                    x = b * 79;
+                    y = 84 - x - y;
+                } else {
+                    // step 205
+                    b = 95;
+                    // step 207
+                    b = x + 73 + x;
+                    // step 209
+                    y = x + y;
+                }
+                if (b > 54) {
+                    // step 213
+                    a = 30 * i2;
+                    y = a - a + x;
+                    step0(y);
+                } else {
+                    // step 218
+                    i2 = b * 71 * a;
+                }
+            }
+            step1(i2, y);
+            i2 = 98;
+        }
+    } else {
+        a = x - 95 + 85;
+    }
+    if (b > 66) {
+        a = 96;
+        for (int v2 : std::vector<int>{27, 50}) {
+            step3(x);
+            a = y * b + 61;
+            v2 = v2 + 66 - v2;
+        }
+        if (y < 74) {
+            x = step0(x) - 21;
+            if (a > 60) {
+                for (int v4 : std::vector<int>{98, 98}) {
+                    // step 239
+                    a = step1(a, x) - v4;
+                }
+            } else {
+                if (x == 8) {
+                    b = 74 * b;
+                } else {
+                    a = x * 70;
+                    x = b - a - y;
+                    // step 248
+                    x = 35;
+                }
+                if (a == 37) {
+                    // step 252
+                    x = a + 26;
+                    a = b;
+                    // step 255
+                    a = 32;
+                } else {
+                    // step 258
+                    y = x;
+                }
+            }
+            x = a + y + x;
+        } else {
+            step4(a, x);
+        }
+        if (y == 91) {
+            a = step4(b, a);
+            b = x;
+        } else {
+            x = b * 85;
+            for (int i3 = 0; i3 < 41; i3++) {
+                b = 23 + y - i3;
+                if (i3 == 95) {
+                    // step 274
+                    i3 = step2(i3, y);
+                    step1(a, x);
+                    // step 277
+                    b = 61 * a;
+                }
+            }
+            a = step3(a);
+            if (x == 26) {
+                y = 73 - y * b;
+            }
+        }
+    } else {
+        for (int v2 : std::vector<int>{61, 58}) {
+            for (int v3 : std::vector<int>{59, 20}) {
+                step2(v2, v3);
+            }
+            v2 = v2;
+        }
+    }
+    if (a == 50) {
+        step4(a, y);
+        for (int v2 : std::vector<int>{28, 46}) {
+            if (a > 63) {
+                step4(x, x);
+            } else {
+                if (x > 44) {
+                    b = y + 95;
+                } else {
+                    // step 303
+                    b = step3(x);
+                }
+            }
+            // step 307
+            y = a;
+            for (int i3 = 0; i3 < 7; i3++) {
+                if (y < 17) {
+                    x = x + y + x;
+                    // step 312
+                    i3 = step2(x, b) - i3 - i3;
+                    x = b;
+                }
+                // step 316
+                x = i3;
+                for (int v4 : std::vector<int>{88, 88}) {
+                    step2(v2, v4);
+                    // step 320
+                    v4 = 4 * y;
+                    // step 322
+                    v4 = v4;
+                }
+            }
+            x = b + x * step3(a);
+        }
+        step1(a, y);
+        x = a * 33 + 1;
+    }
+    return step3(a) * 61;
+}
+
+// step6: generated
+int step6(int a) {
+    auto x = a;
+    auto y = 45;
+    // step 338
+    x = 81 * a;
+    step0(y);
+    y = a;
+    if (a > 5) {
+        if (x < 50) {
+            for (int i3 = 0; i3 < 3; i3++) {
+                if (i3 == 60) {
+                    step0(i3);
+                    // step 347
+                    a = i3 + x - 1;
+                } else {
+                    // step 350
+                    i3 = y * step1(i3, a) + 8;
+                    a = i3;
+                    step4(a, y);
+                }
+            }
+            for (int i3 = 0; i3 < 76; i3++) {
+                for (int v4 : std::vector<int>{29, 89}) {
+                    // step 358
+                    y = 41 + x + step4(a, y);
+                    // step 360
+                    y = x + 6;
+                }
+                i3 = y + 61;
+            }
+        } else {
+            a = a;
+            for (int v3 : std::vector<int>{6, 93}) {
+                // step 368
+                y = v3;
+                for (int v4 : std::vector<int>{81, 22}) {
+                    // step 371
+                    a = 88 - v4;
+                    step0(v4);
+                    // step 374
+                    v3 = 62 + y;
+                }
+                for (int v4 : std::vector<int>{23, 9}) {
+                    v4 = x * step5(v4, y);
+                    // step 379
+                    a = v3 - 33;
+                }
+            }
+        }
+        for (int v2 : std::vector<int>{66, 76}) {
+            x = v2 - v2 + step5(y, a);
+        }
+    } else {
+        for (int v2 : std::vector<int>{0, 16}) {
+            if (v2 < 62) {
+                if (y > 63) {
+                    // step 391
+                    a = a * a;
+                } else {
+                    x = v2;
+                    step2(y, x);
+                }
+                if (x < 52) {
+                    // step 398
+                    x = step2(y, y);
+                    // step 400
+                    v2 = y;
+                }
+                if (a < 39) {
+                    // step 404
+                    a = 12 * 0;
+                }
+            } else {
+                step3(x);
+                v2 = 40 * 91 * v2;
+                v2 = 92;
+            }
+        }
+        step5(x, a);
+        if (x > 58) {
+            if (x > 9) {
+                if (y == 13) {
+                    step1(a, a);
+                    // step 418
+                    a = 97 * step3(a);
+                    a = a - 35;
+                } else {
+                    // step 422
+                    x = step2(y, a) - y;
+                }
+            } else {
+                // step 426
+                a = x - y;
+                a = y + 78;
+                for (int v4 : std::vector<int>{90, 85}) {
+                    a = y + step0(a) + v4;
+                    // step 431
+                    a = a + step0(x) + 90;
+                }
+            }
+        } else {
+            if (a > 34) {
+                // step 437
+                x = step5(x, x) * 51 + a;
+            }
+            if (a > 69) {
+                x = y;
+                if (a < 25) {
+                    // step 443
+                    x = a - step5(y, y) - 14;
+                } else {
+                    step1(x, y);
+                    // step 447
+                    x = step0(y) * x * x;
+                }
+            } else {
+                y = step5(x, x) + a;
+            }
+            x = step0(y) + 26 + 62;
+        }
+    }
+    // step 456
+    a = 1 - step4(y, y) - step0(x);
+    return y * 94;
+}
+
+// step7: generated
+int step7(int a, int b) {
+    auto x = 51 + 42;
+    auto y = 97;
+    if (x > 91) {
+        for (int i2 = 0; i2 < 88; i2++) {
+            if (i2 == 7) {
+                if (y > 91) {
+                    // step 469
+                    y = 37 + x;
+                    i2 = b + a - step2(i2, x);
+                    b = 19 + x;
+                }
+                step2(i2, a);
+            }
+            step0(b);
+            // step 477
+            a = 78;
+        }
+        if (b > 87) {
+            a = b + x;
+        } else {
+            for (int v3 : std::vector<int>{19, 49}) {
+                step5(a, v3);
+            }
+            step3(b);
+            if (y == 78) {
+                x = 14 - a - a;
+            }
+            y = 81 - step2(b, b) - step4(y, y);
+        }
+        b = 48 - 34;
+    } else {
+        if (a > 53) {
+            for (int i3 = 0; i3 < 18; i3++) {
+                i3 = 34;
+            }
+            x = a;
+        } else {
+            // step 500
+            a = step5(y, b) + x;
+            // step 502
+            a = 83 - y;
+            a = a;
+        }
+        // step 506
+        b = 38 - x + 4;
+        if (y == 58) {
+            y = 0;
+            if (a < 90) {
+                for (int v4 : std::vector<int>{54, 31}) {
+                    // step 512
+                    a = 87 + 40;
+                    step6(x);
+                    // step 515
+                    v4 = step4(b, a) - y;
+                }
+                step4(x, y);
+            } else {
+                for (int v4 : std::vector<int>{19, 1}) {
+                    b = v4 - 79 * x;
+                }
+                for (int v4 : std::vector<int>{13, 94}) {
+                    // step 524
+                    v4 = 23 * step0(b);
+                }
+                y = x - 66;
+            }
+            step1(b, y);
+        } else {
+            if (y > 80) {
+                if (y < 44) {
+                    step3(y);
+                }
+                step1(x, y);
+                for (int i4 = 0; i4 < 46; i4++) {
+                    // step 537
+                    b = step6(i4) + 96 + 42;
+                    b = i4;
+                    step6(a);
+                }
+            } else {
+                if (b > 5) {
+                    // step 544
+                    y = x + x;
+                } else {
+                    y = a * 98 + step5(b, x);
+                }
+                x = step2(y, x) + y;
+            }
+            step3(x);
+        }
+        if (y < 49) {
+            if (x < 79) {
+                a = 80 - a * b;
+            }
+            a = y * x;
+            y = x - 17 + a;
+            if (a < 41) {
+                // step 560
+                b = y;
+                if (x < 32) {
+                    // step 563
+                    b = 38;
+                    a = 76;
+                } else {
+                    // step 567
+                    a = b * step5(a, x);
+                    // step 569
+                    a = 57 + y;
+                }
+                a = x + 53 - step1(b, x);
+            }
+        }
+    }
+    // step 576
+    y = 71;
+    // step 578
+    a = 28 * 32 * step2(b, x);
+    return step3(y) - x + b;
+}
+
+// step8: generated
+int step8(int a, int b) {
+    auto x = 0 - a;
+    auto y = 26;
+    step0(b);
+    y = x - y * a;
+    if (x > 13) {
+        step4(x, a);
+        if (x == 70) {
+            if (x > 53) {
+                if (x == 60) {
+                    // step 594
+                    b = b + step3(a) - b;
+                    a = 30;
+                    b = step5(a, b) * 8 + a;
+                } else {
+                    y = 25 * 29 - b;
+                }
+                if (y == 55) {
+                    // step 602
+                    y = b + 32;
+                } else {
+                    // step 605
+                    a = a * 77 - b;
+                    a = x - 45;
+                }
+            } else {
+                step2(y, b);
+            }
+            if (a > 13) {
+                y = b - b;
+                for (int i4 = 0; i4 < 38; i4++) {
+                    // step 615
+                    x = b;
+                    b = x + 8 - 85;
+                }
+                a = y + y - step3(x);
+            } else {
+                y = 8;
+                b = 87 * step5(b, y);
+                if (b > 86) {
+                    step7(b, x);
+                    y = b + 79;
+                    // step 626
+                    y = y;
+                }
+            }
+            y = b - 4 - x;
+        } else {
+            if (y > 56) {
+                for (int i4 = 0; i4 < 68; i4++) {
+                    y = i4 + 70 - step4(y, i4);
+                    x = step7(a, i4);
+                    // step 636
+                    b = 47 * step1(b, b);
+                }
+            }
+            step7(b, y);
+            if (a > 4) {
+                x = 7;
+            } else {
+                b = 65 - y + 34;
+            }
+            if (a > 54) {
+                for (int i4 = 0; i4 < 90; i4++) {
+                    x = b;
+                    y = 15 - step5(y, y);
+                    step7(x, i4);
+                }
+            } else {
+                if (y > 8) {
+                    step2(b, b);
+                } else {
+                    a = 60 + 91;
+                    x = y - 23 - 51;
+                    step5(x, b);
+                }
+            }
+        }
+        // step 662
+        a = a + 77;
+        if (y > 0) {
+            a = 50 - 72;
+            for (int i3 = 0; i3 < 23; i3++) {
+                y = step0(a);
+                step5(i3, a);
+            }
+            if (x == 87) {
+                if (b > 34) {
+                    step7(a, x);
+                } else {
+                    y = step7(x, y);
+                    // step 675
+                    b = b - b;
+                    a = y;
+                }
+            } else {
+                for (int v4 : std::vector<int>{9, 42}) {
+                    // step 681
+                    x = x;
+                    // step 683
+                    a = a + step3(a) - b;
+                    // step 685
+                    b = 14;
+                }
+            }
+        } else {
+            if (y > 92) {
+                if (y > 65) {
+                    // step 692
+                    b = y * b;
+                    a = 88;
+                    // step 695
+                    x = b * 93;
+                }
+                if (x > 7) {
+                    b = y;
+                    a = step4(a, x);
+                    // step 701
+                    b = 33 * 90;
+                }
+                // step 704
+                a = 29;
+            }
+        }
+    } else {
+        // step 709
+        a = a;
+        a = y;
+        step7(a, a);
+        if (x == 50) {
+            if (a == 69) {
+                step5(a, y);
+            }
+        }
+    }
+    b = 83 - 60;
+    for (int i1 = 0; i1 < 83; i1++) {
+        x = a + a;
+        if (i1 < 38) {
+            x = b;
+            // step 724
+            x = 86 - step4(i1, y) + i1;
+        }
+        for (int v2 : std::vector<int>{88, 80}) {
+            if (v2 < 72) {
+                y = 52 * 80 + step2(b, a);
+            } else {
+                i1 = b + 80;
+            }
+            // step 733
+            v2 = x;
+        }
+    }
+    a = a;
+    if (b == 55) {
+        if (b == 83) {
+            // step 740
+            a = y * x;
+            if (b == 6) {
+                for (int i4 = 0; i4 < 68; i4++) {
+                    step7(b, y);
+                    // step 745
+                    b = x - 16;
+                    y = 42 * i4 * b;
+                }
+                y = step4(a, y) * y;
+                if (a > 18) {
+                    // step 751
+                    x = y - x - 12;
+                    // step 753
+                    a = 91 * y;
+                } else {
+                    step5(a, x);
+                }
+            } else {
+                if (x < 30) {
+                    b = a;
+                    // step 761
+                    y = 14 - step6(a);
+                }
+                x = step7(y, x) + 80;
+                if (y > 88) {
+                    a = y - b + step6(b);
+                    // step 767
+                    a = 92;
+                } else {
+                    // step 770
+                    a = a - 82;
+                    y = 79 * 92;
+                    // step 773
+                    x = 79 * a - y;
+                }
+            }
+            a = x * 9;
+            if (b == 12) {
+                if (x < 77) {
+                    // step 780
+                    a = 14 * a + 28;
+                }
+            } else {
+                if (x < 1) {
+                    // step 785
+                    y = x;
+                }
+                if (a < 27) {
+                    x = a + a * step5(x, y);
+                    b = x - a;
+                }
+                step7(b, x);
+            }
+        }
+        y = step7(y, x) * step0(b) * a;
+        if (y > 13) {
+            step6(b);
+        }
+    } else {
+        step1(y, a);
+        if (y > 19) {
+            for (int v3 : std::vector<int>{6, 37}) {
+                if (a == 50) {
+                    // step 804
+                    x = step1(a, b) + 81;
+                    y = 88 + a - b;
+                    // step 807
+                    x = y - y;
+                } else {
+                    x = y;
+                    // step 811
+                    v3 = 39 + 51;
+                }
+            }
+        } else {
+            if (a > 92) {
+                x = x - step5(b, y) + 68;
+            }
+            if (x < 20) {
+                if (y == 63) {
+                    y = a + 46;
+                    step3(b);
+                    // step 823
+                    b = x - y;
+                } else {
+                    // step 826
+                    b = 69 * y - y;
+                }
+            } else {
+                // step 830
+                b = y - 13 + 85;
+            }
+        }
+        if (b < 27) {
+            a = a * a + 96;
+            // step 836
+            a = step7(b, y) - x + step0(x);
+        } else {
+            a = a - 12 * y;
+            step2(y, a);
+        }
+        y = step3(x) - x;
+    }
+    x = x;
+    return b - b - x;
+}
+
+}  // namespace fixture
+
+int main() {
+    using namespace fixture;
+    auto total = 0;
+    total = total + step4(74, 35);
+    total = total + step5(21, 98);
+    total = total + step6(71);
+    total = total + step7(63, 80);
+    total = total + step8(24, 90);
+    std::cout << total << std::endl;
+    return 0;
+}
@@ -0,0 +1,945 @@
+#include <iostream>
+#include <vector>
+
+namespace fixture {
+
+// step0: generated
+int step0(int a) {
+    auto x = 38;
+    auto y = 37;
+    // step 9
+    x = x + x;
+    // step 11
+    y = x - x * 24;
+    a = 40 + x - y;
+    if (x == 17) {
+        for (int v2 : std::vector<int>{48, 8}) {
+            a = y + x * v2;
+        }
+        if (y > 25) {
+            a = x + y - x;
+            x = 56 + y;
+            if (x == 76) {
+                x = y;
+                // step 23
+                x = 5 * 97;
+                y = y + 91;
+            }
+            a = x - 39 * 44;
+        }
+    } else {
+        if (x < 38) {
+            y = x - 17 * a;
+            y = x;
+            if (a == 30) {
+                for (int i4 = 0; i4 < 98; i4++) {
+                    x = 67 - 45 * a;
+                }
+                if (y > 80) {
+                    if (x == 50) {
+                        // step 39
+                        a = y + 84;
+                    }
+                    a = y - a;
+                    if (a == 3) {
+                        if (x > 45) {
+                            // step 45
+                            y = a + y - x;
+                        }
+                        y = a - x;
+                    }
+                } else {
+                    if (a < 78) {
+                        if (y < 15) {
+                            if (a == 43) {
+                                if (y < 95) {
+                                    // step 55
+                                    x = 58 + y * y;
+                                } else {
+                                    x = y;
+                                }
+                            } else {
+                                y = x;
+                            }
+                        } else {
+                            if (a > 26) {
+                                y = a + 56 - a;
+                            }
+                            x = y;
+                        }
+                    } else {
+                        y = y * a - y;
+                        // step 71
+                        y = x - 82;
+                    }
+                }
+                y = x - 71;
+            } else {
+                x = y + y;
+                // step 78
+                y = 96 * y;
+                if (a < 66) {
+                    y = 51 + y + y;
+                    a = a;
+                    if (y > 38) {
+                        y = x - y;
+                    }
+                }
+            }
+            if (x < 37) {
+                y = 65 - y + x;
+                for (int i4 = 0; i4 < 66; i4++) {
+                    for (int i5 = 0; i5 < 2; i5++) {
+                        y = y + i5;
+                        a = i5 + 90 - 26;
+                        if (x == 63) {
+                            y = a - y;
+                        } else {
+                            for (int v7 : std::vector<int>{21, 78}) {
+                                y = 51 * i4;
+                            }
+                        }
+                    }
+                }
+                y = x * 0 * 91;
+            } else {
+                a = y;
+                if (y == 48) {
+                    for (int v5 : std::vector<int>{34, 0}) {
+                        for (int v6 : std::vector<int>{50, 8}) {
+                            if (v6 > 75) {
+                                v6 = 13;
+                                for (int v8 : std::vector<int>{9, 49}) {
+                                    // step 112
+                                    y = v8 + 17 * v6;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        } else {
+            x = a - x;
+        }
+        for (int v2 : std::vector<int>{99, 60}) {
+            if (y == 1) {
+                if (x > 5) {
+                    v2 = 53;
+                    x = v2 * y;
+                    x = 69 * y + y;
+                }
+            } else {
+                if (a < 59) {
+                    a = 32;
+                } else {
+                    y = 47 * a;
+                }
+                if (x > 63) {
+                    for (int v5 : std::vector<int>{92, 31}) {
+                        v5 = 86 * v5;
+                    }
+                } else {
+                    y = a;
+                }
+                if (x == 80) {
+                    for (int i5 = 0; i5 < 37; i5++) {
+                        i5 = a + i5 - v2;
+                        x = 2 - 19 * a;
+                        i5 = 41 - 92 * i5;
+                    }
+                    for (int v5 : std::vector<int>{72, 55}) {
+                        x = y + 19;
+                        if (a < 80) {
+                            if (a > 47) {
+                                y = 26;
+                                if (y == 1) {
+                                    v2 = 44;
+                                } else {
+                                    a = v5 + 20 - 62;
+                                }
+                            }
+                        } else {
+                            for (int i7 = 0; i7 < 46; i7++) {
+                                x = 77 * 97 + 33;
+                            }
+                            a = x - x - x;
+                        }
+                        v5 = x - 27 + v5;
+                    }
+                } else {
+                    if (x == 70) {
+                        y = v2;
+                    } else {
+                        a = a - x * 29;
+                        for (int i6 = 0; i6 < 92; i6++) {
+                            for (int v7 : std::vector<int>{50, 9}) {
+                                // step 175
+                                i6 = 7 * y - 61;
+                            }
+                            if (i6 > 60) {
+                                x = v2;
+                            }
+                        }
+                    }
+                }
+            }
+            for (int v3 : std::vector<int>{85, 16}) {
+                for (int i4 = 0; i4 < 74; i4++) {
+                    if (a > 67) {
+                        i4 = 63 + 21 + 18;
+                    } else {
+                        v2 = 39 - x - x;
+                    }
+                    v2 = 11 - x * 95;
+                    i4 = v2 - x - v2;
+                }
+            }
+            if (a == 82) {
+                if (y > 68) {
+                    if (x > 95) {
+                        // step 199
+                        v2 = v2 - 99;
+                    }
+                }
+            } else {
+                if (a > 76) {
+                    y = y - 80;
+                } else {
+                    if (v2 > 94) {
+                        if (v2 == 87) {
+                            for (int v7 : std::vector<int>{75, 58}) {
+                                v7 = y;
+                            }
+                        }
+                        x = x - x;
+                    }
+                }
+            }
+        }
+        for (int v2 : std::vector<int>{81, 61}) {
+            if (v2 == 43) {
+                if (a < 83) {
+                    if (y < 58) {
+                        if (a > 71) {
+                            y = a;
+                        }
+                        // step 225
+                        x = x - a;
+                    } else {
+                        // step 228
+                        y = 35 - y * x;
+                    }
+                    if (a == 29) {
+                        y = 5 + y + y;
+                        v2 = x;
+                    }
+                    a = x - a - 91;
+                } else {
+                    if (y > 25) {
+                        a = 98;
+                    }
+                }
+                // step 241
+                v2 = 97 * v2;
+            }
+            v2 = a;
+            if (y > 17) {
+                // step 246
+                y = a * 60;
+            } else {
+                a = 7 - a * 74;
+                for (int i4 = 0; i4 < 97; i4++) {
+                    if (a == 26) {
+                        i4 = 39 - y;
+                    } else {
+                        v2 = 5;
+                        a = a - x + i4;
+                        // step 256
+                        i4 = x + 71 - i4;
+                    }
+                    y = 90 - 44;
+                    if (v2 < 91) {
+                        i4 = x;
+                    }
+                }
+            }
+        }
+        if (x == 22) {
+            if (x > 38) {
+                y = y + a;
+            }
+        }
+    }
+    if (a == 48) {
+        if (x == 24) {
+            y = a + y + a;
+            x = y + y;
+            x = y;
+            for (int v3 : std::vector<int>{79, 75}) {
+                v3 = 78;
+            }
+        }
+        y = x * x;
+        y = a * y;
+        // step 283
+        y = a - 53 + 18;
+    } else {
+        if (a < 96) {
+            for (int i3 = 0; i3 < 84; i3++) {
+                for (int i4 = 0; i4 < 31; i4++) {
+                    for (int i5 = 0; i5 < 62; i5++) {
+                        y = 96 + 57 * i5;
+                        if (i5 == 79) {
+                            for (int v7 : std::vector<int>{42, 14}) {
+                                y = i5 + 62;
+                            }
+                            y = a;
+                        } else {
+                            x = i5 + y * i5;
+                        }
+                        for (int i6 = 0; i6 < 37; i6++) {
+                            i3 = i5;
+                            for (int v7 : std::vector<int>{70, 21}) {
+                                if (i5 < 78) {
+                                    i3 = v7 * i4 + 85;
+                                } else {
+                                    // step 305
+                                    i5 = i6;
+                                    // step 307
+                                    a = y - 18;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+            for (int v3 : std::vector<int>{71, 28}) {
+                v3 = a + x + x;
+                if (x < 79) {
+                    for (int v5 : std::vector<int>{96, 75}) {
+                        for (int v6 : std::vector<int>{67, 3}) {
+                            if (v6 < 46) {
+                                // step 321
+                                v3 = v3 * v6 * v3;
+                            } else {
+                                v3 = v5 * 37 - 33;
+                            }
+                        }
+                        if (y == 69) {
+                            if (x < 82) {
+                                for (int v8 : std::vector<int>{51, 57}) {
+                                    // step 330
+                                    v5 = 73;
+                                }
+                            } else {
+                                x = 78 * y - y;
+                            }
+                        }
+                    }
+                } else {
+                    if (x < 91) {
+                        if (x == 20) {
+                            v3 = a + a;
+                            y = x * x - 3;
+                        } else {
+                            if (x < 55) {
+                                x = 21 + y - 26;
+                                a = x;
+                            }
+                        }
+                        x = v3;
+                    } else {
+                        if (a > 51) {
+                            y = a;
+                        }
+                        for (int i6 = 0; i6 < 61; i6++) {
+                            for (int v7 : std::vector<int>{96, 53}) {
+                                a = v3;
+                            }
+                        }
+                    }
+                    x = 69;
+                    for (int i5 = 0; i5 < 34; i5++) {
+                        if (i5 > 52) {
+                            if (v3 < 46) {
+                                v3 = 30;
+                            } else {
+                                v3 = 57;
+                                if (x > 21) {
+                                    // step 368
+                                    a = y - v3;
+                                }
+                            }
+                            x = i5 + i5;
+                        } else {
+                            v3 = i5 * v3 + a;
+                        }
+                        i5 = i5;
+                    }
+                }
+                x = x;
+            }
+            x = 73 * x - y;
+        } else {
+            y = a;
+        }
+    }
+    if (a == 16) {
+        // step 387
+        y = a * a;
+    } else {
+        if (x < 77) {
+            y = a;
+            x = 61 + x;
+            // step 393
+            x = 6 * y + y;
+            for (int i3 = 0; i3 < 29; i3++) {
+                if (x > 31) {
+                    if (a == 94) {
+                        i3 = y * i3;
+                        x = y * y - x;
+                    }
+                } else {
+                    a = a;
+                    a = 50 * 42;
+                    for (int v5 : std::vector<int>{79, 58}) {
+                        if (a == 39) {
+                            if (y == 30) {
+                                if (a > 71) {
+                                    v5 = 47;
+                                    i3 = x;
+                                }
+                            }
+                            if (y < 50) {
+                                i3 = i3 + v5 + i3;
+                            }
+                        } else {
+                            // step 416
+                            v5 = i3 * v5 + 34;
+                        }
+                    }
+                }
+                x = x;
+            }
+        }
+    }
+    for (int v1 : std::vector<int>{44, 41}) {
+        if (v1 > 27) {
+            y = x - a + y;
+            // step 428
+            a = y * v1;
+            x = 3;
+            if (v1 == 32) {
+                for (int v4 : std::vector<int>{9, 38}) {
+                    if (a == 87) {
+                        // step 434
+                        y = a * 89 + a;
+                    } else {
+                        y = v4 * v1;
+                    }
+                    a = v4 - v1;
+                }
+                x = 78 * x * a;
+            } else {
+                if (a < 15) {
+                    v1 = x;
+                    for (int i5 = 0; i5 < 64; i5++) {
+                        for (int v6 : std::vector<int>{53, 80}) {
+                            if (x < 83) {
+                                if (v6 > 38) {
+                                    x = 24 + v6;
+                                }
+                                a = 14;
+                            }
+                            if (v6 == 7) {
+                                if (x < 99) {
+                                    // step 455
+                                    v6 = 11;
+                                }
+                            } else {
+                                if (v6 == 97) {
+                                    v1 = 39;
+                                } else {
+                                    // step 462
+                                    v1 = 12;
+                                }
+                            }
+                        }
+                        x = i5;
+                    }
+                }
+                y = 40;
+                a = x * 81;
+            }
+        }
+        // step 474
+        y = v1;
+        y = 27;
+        if (v1 == 22) {
+            v1 = 88;
+            a = a - a;
+            if (a > 13) {
+                if (a > 39) {
+                    if (a == 52) {
+                        if (x > 86) {
+                            // step 484
+                            x = x * 74;
+                            v1 = v1 - a + a;
+                        } else {
+                            a = v1 - a;
+                        }
+                        for (int i6 = 0; i6 < 89; i6++) {
+                            x = 14 + 80;
+                            y = a;
+                        }
+                        y = v1 - x * y;
+                    }
+                } else {
+                    if (x == 15) {
+                        v1 = a + a;
+                    } else {
+                        if (y < 1) {
+                            if (v1 < 34) {
+                                // step 502
+                                y = y - v1 - x;
+                            } else {
+                                if (x == 17) {
+                                    y = y * x * 24;
+                                } else {
+                                    y = a * 57 * 38;
+                                }
+                                // step 510
+                                x = v1;
+                            }
+                        }
+                        for (int v6 : std::vector<int>{9, 42}) {
+                            if (v1 > 23) {
+                                a = a + x;
+                                // step 517
+                                y = a * 62;
+                            } else {
+                                v1 = 45 + x - v1;
+                            }
+                        }
+                    }
+                    for (int i5 = 0; i5 < 83; i5++) {
+                        v1 = 66 - y * x;
+                    }
+                }
+            } else {
+                x = a - 53;
+                // step 530
+                x = v1 * a;
+                // step 532
+                a = a * 78 - 33;
+            }
+        } else {
+            y = 29 - a - y;
+            if (v1 == 76) {
+                if (v1 == 34) {
+                    a = a - x + x;
+                    a = a - 0 - 15;
+                    if (v1 < 38) {
+                        if (v1 > 79) {
+                            if (a == 14) {
+                                v1 = 74;
+                                if (a == 80) {
+                                    // step 546
+                                    y = 75;
+                                } else {
+                                    // step 549
+                                    a = v1;
+                                }
+                            }
+                        } else {
+                            for (int i7 = 0; i7 < 76; i7++) {
+                                i7 = a + 16 - 34;
+                            }
+                            v1 = v1;
+                        }
+                    } else {
+                        for (int v6 : std::vector<int>{14, 36}) {
+                            v6 = 48 - v1;
+                            v6 = y;
+                        }
+                    }
+                }
+            }
+            // step 567
+            v1 = y - a;
+        }
+    }
+    for (int v1 : std::vector<int>{27, 54}) {
+        a = 23 * a;
+        if (a == 84) {
+            a = a * y;
+            if (x < 34) {
+                x = 70 * a * 3;
+                y = x + y * 38;
+            }
+        } else {
+            for (int v3 : std::vector<int>{57, 76}) {
+                for (int i4 = 0; i4 < 43; i4++) {
+                    v3 = 71;
+                    y = y * 55;
+                    a = v1;
+                }
+            }
+            x = x + x;
+            for (int v3 : std::vector<int>{25, 64}) {
+                v1 = v3 * a - 4;
+                if (a > 38) {
+                    if (v3 > 9) {
+                        for (int i6 = 0; i6 < 24; i6++) {
+                            if (v1 < 13) {
+                                a = i6 * i6;
+                            }
+                        }
+                    } else {
+                        if (v3 == 38) {
+                            v1 = y;
+                        } else {
+                            for (int v7 : std::vector<int>{0, 15}) {
+                                if (v3 < 72) {
+                                    // step 603
+                                    x = 28;
+                                } else {
+                                    // step 606
+                                    v1 = v3 + x;
+                                }
+                            }
+                        }
+                        y = x * 71 - v1;
+                        a = 40;
+                    }
+                    v1 = 57 * 23;
+                    a = 38 - v3;
+                }
+            }
+            if (y < 96) {
+                if (y > 70) {
+                    y = a * y + 63;
+                } else {
+                    // step 622
+                    a = v1 + 78 - 40;
+                }
+                a = a * 29;
+                if (a > 76) {
+                    x = a - 95;
+                    if (v1 < 85) {
+                        if (y < 43) {
+                            if (x < 69) {
+                                if (y > 92) {
+                                    x = y * 43;
+                                } else {
+                                    y = x - 95 + 26;
+                                }
+                            }
+                        }
+                    } else {
+                        if (x > 23) {
+                            if (v1 == 30) {
+                                // step 641
+                                a = a;
+                            }
+                        }
+                        y = v1 - a;
+                    }
+                    if (y < 62) {
+                        for (int i6 = 0; i6 < 77; i6++) {
+                            y = v1;
+                            i6 = v1 - a;
+                        }
+                        for (int v6 : std::vector<int>{41, 95}) {
+                            v1 = x - 9 - y;
+                        }
+                        a = 1;
+                    } else {
+                        x = x;
+                    }
+                } else {
+                    y = x;
+                }
+            }
+        }
+        for (int i2 = 0; i2 < 56; i2++) {
+            i2 = 33 * i2;
+            if (a < 68) {
+                y = v1 * i2;
+                // step 668
+                v1 = a;
+                a = 40 + 22 - x;
+            }
+        }
+        x = 96;
+    }
+    return 84 - a;
+}
+
+// step1: generated
+int step1(int a, int b) {
+    auto x = 39 + b * 48;
+    auto y = 71;
+    step0(b);
+    step0(y);
+    if (a > 81) {
+        // step 685
+        a = 4 * 53 - 17;
+        for (int v2 : std::vector<int>{95, 97}) {
+            if (a > 83) {
+                // step 689
+                y = 6;
+            } else {
+                if (y == 90) {
+                    if (v2 > 30) {
+                        v2 = b - b + a;
+                        for (int v6 : std::vector<int>{82, 89}) {
+                            step0(x);
+                        }
+                    } else {
+                        if (a == 27) {
+                            if (v2 > 49) {
+                                step0(x);
+                            } else {
+                                v2 = step0(x) - x * b;
+                            }
+                        }
+                    }
+                    if (x > 24) {
+                        step0(b);
+                    }
+                } else {
+                    if (a < 65) {
+                        x = b * y * 72;
+                    } else {
+                        // step 714
+                        v2 = v2;
+                        x = v2 + 63 - 2;
+                    }
+                    y = 49 * step0(x);
+                    // step 719
+                    a = step0(a) + a - v2;
+                }
+            }
+            for (int v3 : std::vector<int>{95, 13}) {
+                step0(a);
+                a = 95 - 68 + 29;
+                for (int v4 : std::vector<int>{95, 22}) {
+                    v3 = step0(x);
+                }
+            }
+        }
+    }
+    step0(y);
+    step0(y);
+    return y - 24;
+}
+
+// step2: generated
+int step2(int a, int b) {
+    auto x = b * a;
+    auto y = 12;
+    x = y;
+    if (y < 88) {
+        if (a > 72) {
+            a = x - b - y;
+            step1(b, x);
+        }
+    } else {
+        step0(x);
+        if (x > 4) {
+            if (y > 39) {
+                if (x == 24) {
+                    y = y * a + 98;
+                    if (a == 2) {
+                        step1(b, a);
+                    }
+                } else {
+                    x = a + 26 - 90;
+                    if (b == 67) {
+                        step1(b, y);
+                    }
+                    y = b;
+                }
+            } else {
+                // step 764
+                y = b * y * 86;
+            }
+            step1(x, x);
+            for (int i3 = 0; i3 < 40; i3++) {
+                if (b > 9) {
+                    if (a == 76) {
+                        x = step0(i3) * 2 * b;
+                    }
+                    i3 = b;
+                    if (y < 99) {
+                        if (i3 == 82) {
+                            step0(i3);
+                        }
+                    } else {
+                        b = x + 41;
+                    }
+                } else {
+                    b = y;
+                    x = 53;
+                    if (a == 36) {
+                        step1(b, x);
+                        for (int v6 : std::vector<int>{28, 86}) {
+                            if (x > 2) {
+                                a = x - 89 + i3;
+                            }
+                        }
+                    } else {
+                        i3 = 16 * step0(a);
+                    }
+                }
+                if (x == 22) {
+                    if (y < 23) {
+                        i3 = y + step1(i3, y) * 4;
+                        i3 = x;
+                    } else {
+                        for (int v6 : std::vector<int>{68, 73}) {
+                            if (a == 68) {
+                                b = 17 - v6;
+                            }
+                        }
+                        if (x == 15) {
+                            if (y == 68) {
+                                if (x > 95) {
+                                    step1(x, a);
+                                    step1(i3, b);
+                                } else {
+                                    // step 811
+                                    a = 45;
+                                }
+                            } else {
+                                b = a * y - b;
+                            }
+                        }
+                    }
+                    for (int i5 = 0; i5 < 59; i5++) {
+                        if (y < 30) {
+                            if (b < 39) {
+                                step1(y, x);
+                            }
+                        } else {
+                            step1(i3, a);
+                        }
+                    }
+                    step1(b, b);
+                }
+            }
+            b = a;
+        } else {
+            for (int v3 : std::vector<int>{66, 79}) {
+                if (a == 20) {
+                    x = 18 + x + x;
+                } else {
+                    for (int i5 = 0; i5 < 36; i5++) {
+                        // step 838
+                        v3 = i5 - x;
+                    }
+                }
+                if (b < 66) {
+                    y = a + a - y;
+                } else {
+                    for (int v5 : std::vector<int>{87, 17}) {
+                        a = 27 + y * a;
+                    }
+                }
+            }
+        }
+        for (int i2 = 0; i2 < 79; i2++) {
+            if (a < 69) {
+                y = i2 + b;
+            }
+        }
+        for (int i2 = 0; i2 < 55; i2++) {
+            y = 86 * 50 + y;
+            b = y - 43 * step1(y, b);
+            i2 = 25;
+            for (int v3 : std::vector<int>{41, 45}) {
+                if (v3 == 24) {
+                    if (a > 1) {
+                        if (b < 44) {
+                            for (int i7 = 0; i7 < 51; i7++) {
+                                a = x;
+                                step0(a);
+                            }
+                        }
+                    } else {
+                        for (int v6 : std::vector<int>{82, 5}) {
+                            v3 = y - x;
+                        }
+                        b = a - step1(y, b);
+                        i2 = 69 - i2;
+                    }
+                    step0(i2);
+                }
+                if (x == 49) {
+                    if (y < 67) {
+                        i2 = i2 * x - 10;
+                    }
+                } else {
+                    for (int i5 = 0; i5 < 97; i5++) {
+                        // step 884
+                        a = i2 * 48 + 70;
+                    }
+                    if (y < 49) {
+                        y = step0(v3) * v3;
+                    }
+                    // step 890
+                    v3 = b;
+                }
+                if (v3 < 75) {
+                    if (y == 95) {
+                        // step 895
+                        x = i2;
+                        step0(b);
+                        step1(i2, x);
+                    } else {
+                        step0(v3);
+                        step0(x);
+                        if (b < 0) {
+                            y = 96 * step0(y) + step1(x, a);
+                        } else {
+                            i2 = 78 - i2 + 96;
+                        }
+                    }
+                    for (int v5 : std::vector<int>{78, 11}) {
+                        if (a < 71) {
+                            if (v3 > 37) {
+                                if (y < 70) {
+                                    // step 912
+                                    v5 = x;
+                                }
+                            }
+                        } else {
+                            for (int i7 = 0; i7 < 93; i7++) {
+                                // step 918
+                                x = step0(i7) - 1 + 65;
+                                v5 = step1(b, v5);
+                            }
+                        }
+                    }
+                    i2 = v3 + step0(i2) - v3;
+                }
+            }
+        }
+    }
+    x = b + 24 + step1(b, a);
+    step1(x, a);
+    return a - 37;
+}
+
+}  // namespace fixture
+
+int main() {
+    using namespace fixture;
+    auto total = 0;
+    total = total + step0(58);
+    total = total + step1(7, 33);
+    total = total + step2(24, 26);
+    std::cout << total << std::endl;
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <iostream>
+#include <vector>
+
+namespace fixture {
+
+// step0: generated
+int step0(int a) {
+    auto x = 46 - a + a;
+    auto y = 15;
+    x = x;
+    if (y > 62) {
+        x = a + 8 + 36;
+        if (a < 35) {
+            a = x;
+        } else {
+            // step 15
+            y = y * 47;
+        }
+        a = y * 11;
+    }
+    a = 7 - 14 + y;
+    // step 21
+    a = 78 + a;
+    return 83;
+}
+
+// step1: generated
+int step1(int a, int b) {
+    auto x = b - b;
+    auto y = 22;
+    a = b + x + 29;
+    if (a > 95) {
+        if (x == 18) {
+            x = b * a + 5;
+            y = 38;
+            // step 35
+            a = a * 18;
+            x = y - 93;
+        }
+    }
+    x = 24 + 88 - y;
+    // step 41
+    b = b + step0(b);
+    a = b;
+    step0(x);
+    return 26 + a + 72;
+}
+
+// step2: generated
+int step2(int a, int b) {
+    auto x = b - a;
+    auto y = 26;
+    // step 52
+    y = 27;
+    y = a + b;
+    // step 55
+    x = a;
+    return y;
+}
+
+}  // namespace fixture
+
+int main() {
+    using namespace fixture;
+    auto total = 0;
+    total = total + step0(14);
+    total = total + step1(81, 83);
+    total = total + step2(81, 53);
+    std::cout << total << std::endl;
+    return 0;
+}
@@ -0,0 +1,5017 @@
+module Main where
+
+-- step0: generated
+step0 :: Int -> Int
+step0 a =
+  case a `mod` 3 of
+    0 ->
+      let v1 = a - 42
+      in
+        if v1 > 23
+          then
+            let v2 = a
+            in
+              let v3 = v1 - v1 - v1
+              in
+                v3
+          else
+            80 - a
+    _ ->
+      if a > 32
+        then
+          21 * a
+        else
+          90 + 91 + 59
+
+-- step1: generated
+step1 :: Int -> Int -> Int
+step1 a b =
+  case a `mod` 3 of
+    0 ->
+      if a > 47
+        then
+          let v2 = 13 + 50 + a
+          in
+            if v2 == 23
+              then
+                if b > 34
+                  then
+                    b + v2
+                  else
+                    (step0 v2) - b
+              else
+                70 + a * (step0 v2)
+        else
+          case b `mod` 3 of
+            0 ->
+              if a > 84
+                then
+                  b * b * 59
+                else
+                  if b == 59
+                    then
+                      53 * a + 91
+                    else
+                      b
+            _ ->
+              case b `mod` 3 of
+                0 ->
+                  let v2 = (step0 b)
+                  in
+                    v2 * b
+                _ ->
+                  (step0 a)
+    _ ->
+      case b `mod` 3 of
+        0 ->
+          case b `mod` 3 of
+            0 ->
+              64 * b
+            _ ->
+              (step0 a) * 11 - (step0 a)
+        _ ->
+          b + 19
+
+-- step2: generated
+step2 :: Int -> Int -> Int
+step2 a b =
+  case b `mod` 3 of
+    0 ->
+      if a < 72
+        then
+          let v2 = (step1 a a) - 89
+          in
+            v2 - v2
+        else
+          if a < 99
+            then
+              let v2 = a * a - b
+              in
+                let v3 = 35 + 43
+                in
+                  b
+            else
+              b
+    _ ->
+      a * 95
+
+-- step3: generated
+step3 :: Int -> Int
+step3 a =
+  let v1 = 96 + a
+  in
+    let v2 = 6 + 20 + v1
+    in
+      let v3 = 17 - v1
+      in
+        let v4 = (step0 v1) + 56 + (step0 a)
+        in
+          75
+
+-- step4: generated
+step4 :: Int -> Int -> Int
+step4 a b =
+  if b > 2
+    then
+      if b > 14
+        then
+          (step3 b) - b * a
+        else
+          if b == 86
+            then
+              let v2 = 16 * (step1 b b)
+              in
+                9
+            else
+              case a `mod` 3 of
+                0 ->
+                  let v2 = a * (step2 b a)
+                  in
+                    a
+                _ ->
+                  (step3 b) * 58
+    else
+      a - (step1 b a) - 51
+
+-- step5: generated
+step5 :: Int -> Int -> Int
+step5 a b =
+  case b `mod` 3 of
+    0 ->
+      case b `mod` 3 of
+        0 ->
+          if a < 97
+            then
+              case b `mod` 3 of
+                0 ->
+                  20 - 35
+                _ ->
+                  let v2 = a * 80 - (step1 a a)
+                  in
+                    b - 69
+            else
+              if b == 60
+                then
+                  case b `mod` 3 of
+                    0 ->
+                      b
+                    _ ->
+                      85
+                else
+                  case a `mod` 3 of
+                    0 ->
+                      a
+                    _ ->
+                      5
+        _ ->
+          case b `mod` 3 of
+            0 ->
+              34 + b - 1
+            _ ->
+              if b > 62
+                then
+                  case a `mod` 3 of
+                    0 ->
+                      a * b
+                    _ ->
+                      a
+                else
+                  case b `mod` 3 of
+                    0 ->
+                      b - 73 - 68
+                    _ ->
+                      (step0 a)
+    _ ->
+      let v2 = (step2 a a)
+      in
+        case v2 `mod` 3 of
+          0 ->
+            a - (step1 v2 b) * (step1 a v2)
+          _ ->
+            if b > 68
+              then
+                if v2 < 14
+                  then
+                    v2 * 69
+                  else
+                    (step3 b) * 87 * (step1 a b)
+              else
+                let v3 = a * b
+                in
+                  34
+
+-- step6: generated
+step6 :: Int -> Int
+step6 a =
+  let v1 = 16
+  in
+    case v1 `mod` 3 of
+      0 ->
+        if a < 35
+          then
+            let v2 = a + a * (step2 a v1)
+            in
+              case v2 `mod` 3 of
+                0 ->
+                  74 - v2
+                _ ->
+                  94 + 13 * 59
+          else
+            let v2 = v1
+            in
+              if v1 == 48
+                then
+                  84 * 80
+                else
+                  v1 + v2
+      _ ->
+        if v1 < 89
+          then
+            let v2 = a * (step2 v1 a) - a
+            in
+              let v3 = a * a
+              in
+                26 - 19
+          else
+            let v2 = a
+            in
+              v2 - (step1 a v1) - 61
+
+-- step7: generated
+step7 :: Int -> Int -> Int
+step7 a b =
+  let v2 = 42 - 46
+  in
+    case a `mod` 3 of
+      0 ->
+        (step3 v2)
+      _ ->
+        case b `mod` 3 of
+          0 ->
+            if a == 7
+              then
+                a
+              else
+                let v3 = b * (step1 a b)
+                in
+                  30 * 88 * b
+          _ ->
+            let v3 = v2 - 39
+            in
+              9 + 9
+
+-- step8: generated
+step8 :: Int -> Int -> Int
+step8 a b =
+  a - 17
+
+-- step9: generated
+step9 :: Int -> Int
+step9 a =
+  case a `mod` 3 of
+    0 ->
+      if a > 47
+        then
+          if a > 32
+            then
+              a - (step1 a a) - a
+            else
+              case a `mod` 3 of
+                0 ->
+                  if a > 2
+                    then
+                      75
+                    else
+                      a
+                _ ->
+                  a - 40
+        else
+          if a < 41
+            then
+              case a `mod` 3 of
+                0 ->
+                  a * 30 + 16
+                _ ->
+                  case a `mod` 3 of
+                    0 ->
+                      (step7 a a)
+                    _ ->
+                      a
+            else
+              if a > 41
+                then
+                  if a > 93
+                    then
+                      70
+                    else
+                      a + a
+                else
+                  4 + a * a
+    _ ->
+      let v1 = a
+      in
+        case a `mod` 3 of
+          0 ->
+            if a > 83
+              then
+                case v1 `mod` 3 of
+                  0 ->
+                    a
+                  _ ->
+                    v1 - 58
+              else
+                if v1 > 7
+                  then
+                    a - a
+                  else
+                    a
+          _ ->
+            let v2 = 53 * 82 + a
+            in
+              if v2 > 49
+                then
+                  10
+                else
+                  v1
+
+-- step10: generated
+step10 :: Int -> Int -> Int
+step10 a b =
+  a
+
+-- step11: generated
+step11 :: Int -> Int -> Int
+step11 a b =
+  case a `mod` 3 of
+    0 ->
+      if a > 89
+        then
+          let v2 = b - 10 - 26
+          in
+            (step9 a)
+        else
+          if a == 39
+            then
+              86
+            else
+              case a `mod` 3 of
+                0 ->
+                  b
+                _ ->
+                  if a < 72
+                    then
+                      a - b
+                    else
+                      b + a
+    _ ->
+      if a > 30
+        then
+          case a `mod` 3 of
+            0 ->
+              if b > 33
+                then
+                  let v2 = a * 56 * b
+                  in
+                    b - a
+                else
+                  if b > 53
+                    then
+                      28 - a - 4
+                    else
+                      b + 73 + (step1 a a)
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  let v2 = 21 - b + 41
+                  in
+                    b - a * 47
+                _ ->
+                  let v2 = a
+                  in
+                    72 - 6
+        else
+          87
+
+-- step12: generated
+step12 :: Int -> Int
+step12 a =
+  if a == 57
+    then
+      case a `mod` 3 of
+        0 ->
+          if a == 76
+            then
+              let v1 = 65 * (step8 a a) * a
+              in
+                if v1 == 49
+                  then
+                    a
+                  else
+                    (step5 v1 a)
+            else
+              a + 46 - (step5 a a)
+        _ ->
+          (step0 a) * 93 + a
+    else
+      case a `mod` 3 of
+        0 ->
+          76 * a + a
+        _ ->
+          if a > 58
+            then
+              case a `mod` 3 of
+                0 ->
+                  let v1 = 43
+                  in
+                    76
+                _ ->
+                  let v1 = 73
+                  in
+                    33
+            else
+              case a `mod` 3 of
+                0 ->
+                  case a `mod` 3 of
+                    0 ->
+                      (step8 a a)
+                    _ ->
+                      (step8 a a) - a * 94
+                _ ->
+                  case a `mod` 3 of
+                    0 ->
+                      87 + a
+                    _ ->
+                      46 * (step5 a a) - 64
+
+-- step13: generated
+step13 :: Int -> Int -> Int
+step13 a b =
+  let v2 = 25 * 30 + a
+  in
+    case v2 `mod` 3 of
+      0 ->
+        a * 58
+      _ ->
+        57 * 68
+
+-- step14: generated
+step14 :: Int -> Int -> Int
+step14 a b =
+  a - 70
+
+-- step15: generated
+step15 :: Int -> Int
+step15 a =
+  case a `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          if a > 6
+            then
+              let v1 = 27 + a + (step7 a a)
+              in
+                case v1 `mod` 3 of
+                  0 ->
+                    58 + a
+                  _ ->
+                    (step9 v1) * 66 + 92
+            else
+              case a `mod` 3 of
+                0 ->
+                  a + a
+                _ ->
+                  let v1 = a + a * a
+                  in
+                    v1 + 48 - 97
+        _ ->
+          77 - a + (step11 a a)
+    _ ->
+      let v1 = 64
+      in
+        if a < 68
+          then
+            if v1 > 53
+              then
+                49
+              else
+                if v1 == 93
+                  then
+                    41 + v1 + a
+                  else
+                    (step9 a) - (step6 a)
+          else
+            (step9 a)
+
+-- step16: generated
+step16 :: Int -> Int -> Int
+step16 a b =
+  case a `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          b + 89
+        _ ->
+          if a < 14
+            then
+              case a `mod` 3 of
+                0 ->
+                  a
+                _ ->
+                  67 - a
+            else
+              case a `mod` 3 of
+                0 ->
+                  case b `mod` 3 of
+                    0 ->
+                      b * a
+                    _ ->
+                      b
+                _ ->
+                  a * 25 + b
+    _ ->
+      b
+
+-- step17: generated
+step17 :: Int -> Int -> Int
+step17 a b =
+  if a < 46
+    then
+      if b < 51
+        then
+          if a > 24
+            then
+              let v2 = 3 * 54
+              in
+                57
+            else
+              if a < 68
+                then
+                  if a > 43
+                    then
+                      41 * 75
+                    else
+                      a
+                else
+                  if b == 89
+                    then
+                      29
+                    else
+                      (step12 b)
+        else
+          case b `mod` 3 of
+            0 ->
+              if a < 45
+                then
+                  let v2 = 62
+                  in
+                    5 + v2
+                else
+                  let v2 = b + b - 76
+                  in
+                    9
+            _ ->
+              case b `mod` 3 of
+                0 ->
+                  (step6 b) - 52
+                _ ->
+                  let v2 = 32 + b * 54
+                  in
+                    72 - a - (step2 v2 v2)
+    else
+      let v2 = a * b
+      in
+        a
+
+-- step18: generated
+step18 :: Int -> Int
+step18 a =
+  let v1 = a * (step8 a a) * a
+  in
+    if v1 < 70
+      then
+        (step10 v1 v1) * v1 * (step15 a)
+      else
+        case v1 `mod` 3 of
+          0 ->
+            if v1 == 89
+              then
+                98
+              else
+                let v2 = 54 + 32
+                in
+                  a
+          _ ->
+            case v1 `mod` 3 of
+              0 ->
+                if a < 21
+                  then
+                    a * (step0 v1)
+                  else
+                    (step6 a)
+              _ ->
+                let v2 = 54 * v1
+                in
+                  a + 39 - v1
+
+-- step19: generated
+step19 :: Int -> Int -> Int
+step19 a b =
+  let v2 = 84 * a + (step9 b)
+  in
+    (step3 v2) + b + (step0 b)
+
+-- step20: generated
+step20 :: Int -> Int -> Int
+step20 a b =
+  case a `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          case a `mod` 3 of
+            0 ->
+              case a `mod` 3 of
+                0 ->
+                  if a > 29
+                    then
+                      b * a + 15
+                    else
+                      b + b
+                _ ->
+                  a
+            _ ->
+              let v2 = b * a - a
+              in
+                case v2 `mod` 3 of
+                  0 ->
+                    7 * 52
+                  _ ->
+                    18 * v2
+        _ ->
+          case b `mod` 3 of
+            0 ->
+              b - b
+            _ ->
+              if b < 66
+                then
+                  a * b + a
+                else
+                  a
+    _ ->
+      let v2 = (step9 b) * 60
+      in
+        case a `mod` 3 of
+          0 ->
+            case a `mod` 3 of
+              0 ->
+                (step14 a a)
+              _ ->
+                if v2 > 57
+                  then
+                    26 + v2
+                  else
+                    a - b
+          _ ->
+            a * v2
+
+-- step21: generated
+step21 :: Int -> Int
+step21 a =
+  let v1 = 18 + 53 + (step8 a a)
+  in
+    case v1 `mod` 3 of
+      0 ->
+        if v1 == 4
+          then
+            let v2 = 20 + a + (step15 v1)
+            in
+              a + 22
+          else
+            if v1 == 68
+              then
+                case a `mod` 3 of
+                  0 ->
+                    a - v1 * 55
+                  _ ->
+                    v1 + 19
+              else
+                case v1 `mod` 3 of
+                  0 ->
+                    v1
+                  _ ->
+                    a
+      _ ->
+        if a < 99
+          then
+            if a < 27
+              then
+                v1
+              else
+                case a `mod` 3 of
+                  0 ->
+                    a
+                  _ ->
+                    a
+          else
+            case a `mod` 3 of
+              0 ->
+                case v1 `mod` 3 of
+                  0 ->
+                    90 + a
+                  _ ->
+                    a * a
+              _ ->
+                18
+
+-- step22: generated
+step22 :: Int -> Int -> Int
+step22 a b =
+  case a `mod` 3 of
+    0 ->
+      let v2 = (step16 b b) + a
+      in
+        if v2 < 20
+          then
+            let v3 = b * 97 * (step13 v2 v2)
+            in
+              if a == 70
+                then
+                  65
+                else
+                  (step12 v2)
+          else
+            30 - b
+    _ ->
+      if a > 94
+        then
+          let v2 = a
+          in
+            if b > 31
+              then
+                if a > 17
+                  then
+                    68 - v2 * (step8 b b)
+                  else
+                    a
+              else
+                if v2 > 56
+                  then
+                    b
+                  else
+                    v2
+        else
+          if a < 63
+            then
+              if b == 34
+                then
+                  case b `mod` 3 of
+                    0 ->
+                      (step2 a a)
+                    _ ->
+                      b + b
+                else
+                  48 - a * a
+            else
+              if b == 94
+                then
+                  case a `mod` 3 of
+                    0 ->
+                      b * (step6 a)
+                    _ ->
+                      89 * a * (step9 b)
+                else
+                  case b `mod` 3 of
+                    0 ->
+                      (step2 a a)
+                    _ ->
+                      a + a + (step6 b)
+
+-- step23: generated
+step23 :: Int -> Int -> Int
+step23 a b =
+  case b `mod` 3 of
+    0 ->
+      if b == 52
+        then
+          let v2 = 28
+          in
+            if a > 89
+              then
+                case b `mod` 3 of
+                  0 ->
+                    48 * b
+                  _ ->
+                    91 * b - b
+              else
+                if v2 > 30
+                  then
+                    18
+                  else
+                    a * 70
+        else
+          if a < 86
+            then
+              let v2 = b
+              in
+                if b < 19
+                  then
+                    b
+                  else
+                    71
+            else
+              let v2 = a
+              in
+                let v3 = b + v2
+                in
+                  94
+    _ ->
+      a - (step12 a)
+
+-- step24: generated
+step24 :: Int -> Int
+step24 a =
+  case a `mod` 3 of
+    0 ->
+      40 * a - a
+    _ ->
+      if a == 34
+        then
+          case a `mod` 3 of
+            0 ->
+              95 * a
+            _ ->
+              if a > 13
+                then
+                  80
+                else
+                  case a `mod` 3 of
+                    0 ->
+                      (step23 a a) * 83
+                    _ ->
+                      a
+        else
+          if a > 44
+            then
+              if a < 91
+                then
+                  a
+                else
+                  a + 89 * a
+            else
+              a + a - (step0 a)
+
+-- step25: generated
+step25 :: Int -> Int -> Int
+step25 a b =
+  let v2 = 64 * 93 + 97
+  in
+    case b `mod` 3 of
+      0 ->
+        if b < 3
+          then
+            if a == 86
+              then
+                if b < 71
+                  then
+                    b * 92 + b
+                  else
+                    (step6 v2) - (step19 a b)
+              else
+                let v3 = v2 + (step22 v2 a)
+                in
+                  13 + v3 * b
+          else
+            case a `mod` 3 of
+              0 ->
+                case a `mod` 3 of
+                  0 ->
+                    77 - 45 - (step22 v2 v2)
+                  _ ->
+                    a - (step10 v2 a)
+              _ ->
+                if v2 > 87
+                  then
+                    a
+                  else
+                    19 + a - (step5 v2 a)
+      _ ->
+        case b `mod` 3 of
+          0 ->
+            b
+          _ ->
+            let v3 = v2 - 53 - a
+            in
+              if b == 15
+                then
+                  47 - a * b
+                else
+                  (step17 b b) + (step13 a b) * b
+
+-- step26: generated
+step26 :: Int -> Int -> Int
+step26 a b =
+  case b `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          let v2 = a + b - a
+          in
+            99
+        _ ->
+          case a `mod` 3 of
+            0 ->
+              case b `mod` 3 of
+                0 ->
+                  let v2 = 75 * 36 - 26
+                  in
+                    22 * 65
+                _ ->
+                  let v2 = 44
+                  in
+                    v2 * b
+            _ ->
+              39
+    _ ->
+      a + 38 - (step10 a b)
+
+-- step27: generated
+step27 :: Int -> Int
+step27 a =
+  25 - (step13 a a)
+
+-- step28: generated
+step28 :: Int -> Int -> Int
+step28 a b =
+  34 - a + 40
+
+-- step29: generated
+step29 :: Int -> Int -> Int
+step29 a b =
+  4 - 31 - (step1 b b)
+
+-- step30: generated
+step30 :: Int -> Int
+step30 a =
+  case a `mod` 3 of
+    0 ->
+      let v1 = (step22 a a) + a
+      in
+        if v1 == 8
+          then
+            case a `mod` 3 of
+              0 ->
+                if a == 82
+                  then
+                    v1 * 1 + 96
+                  else
+                    a - 13
+              _ ->
+                case a `mod` 3 of
+                  0 ->
+                    25 - v1
+                  _ ->
+                    a
+          else
+            if a == 7
+              then
+                case v1 `mod` 3 of
+                  0 ->
+                    68
+                  _ ->
+                    44 - (step18 a) * 59
+              else
+                case v1 `mod` 3 of
+                  0 ->
+                    a - 85 * 77
+                  _ ->
+                    (step25 v1 v1) + 73
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          a
+        _ ->
+          let v1 = 43 - a
+          in
+            let v2 = v1 + v1
+            in
+              case v1 `mod` 3 of
+                0 ->
+                  v1
+                _ ->
+                  47
+
+-- step31: generated
+step31 :: Int -> Int -> Int
+step31 a b =
+  b * a + 22
+
+-- step32: generated
+step32 :: Int -> Int -> Int
+step32 a b =
+  if a < 73
+    then
+      b - b + b
+    else
+      if b < 80
+        then
+          case a `mod` 3 of
+            0 ->
+              if a == 95
+                then
+                  let v2 = (step3 b) + a
+                  in
+                    b
+                else
+                  b + b
+            _ ->
+              if a < 31
+                then
+                  if b == 52
+                    then
+                      a
+                    else
+                      45 * (step25 a a) + a
+                else
+                  13 + 13
+        else
+          20 - a
+
+-- step33: generated
+step33 :: Int -> Int
+step33 a =
+  case a `mod` 3 of
+    0 ->
+      let v1 = a
+      in
+        case v1 `mod` 3 of
+          0 ->
+            case a `mod` 3 of
+              0 ->
+                let v2 = 89
+                in
+                  v1 - v2
+              _ ->
+                if a < 38
+                  then
+                    v1 - 44 - 26
+                  else
+                    a
+          _ ->
+            let v2 = a
+            in
+              v2 + a + 41
+    _ ->
+      if a < 10
+        then
+          a + a
+        else
+          a - 24
+
+-- step34: generated
+step34 :: Int -> Int -> Int
+step34 a b =
+  if a < 28
+    then
+      if b < 4
+        then
+          if b == 40
+            then
+              a
+            else
+              let v2 = (step16 a a)
+              in
+                (step6 v2) - 82 - 75
+        else
+          let v2 = (step14 b a) - b - 93
+          in
+            if b == 27
+              then
+                case a `mod` 3 of
+                  0 ->
+                    43 + a
+                  _ ->
+                    (step4 b v2) * (step14 a a) + b
+              else
+                a
+    else
+      let v2 = 26
+      in
+        let v3 = 1
+        in
+          if v2 < 76
+            then
+              if v2 < 63
+                then
+                  v2 * 32
+                else
+                  47 + v2 * v3
+            else
+              case a `mod` 3 of
+                0 ->
+                  99 + 15 * 99
+                _ ->
+                  67 * v2 - 24
+
+-- step35: generated
+step35 :: Int -> Int -> Int
+step35 a b =
+  a * (step30 a) - b
+
+-- step36: generated
+step36 :: Int -> Int
+step36 a =
+  case a `mod` 3 of
+    0 ->
+      let v1 = a + (step24 a) - a
+      in
+        case a `mod` 3 of
+          0 ->
+            21 * 19
+          _ ->
+            case v1 `mod` 3 of
+              0 ->
+                let v2 = 81
+                in
+                  95
+              _ ->
+                (step21 v1) * 40 * a
+    _ ->
+      if a < 37
+        then
+          47 - 2 + a
+        else
+          39 * a - a
+
+-- step37: generated
+step37 :: Int -> Int -> Int
+step37 a b =
+  b
+
+-- step38: generated
+step38 :: Int -> Int -> Int
+step38 a b =
+  51 - 56 * 79
+
+-- step39: generated
+step39 :: Int -> Int
+step39 a =
+  let v1 = a - a
+  in
+    let v2 = 36
+    in
+      (step24 a) + v2
+
+-- step40: generated
+step40 :: Int -> Int -> Int
+step40 a b =
+  let v2 = a - 5 + (step18 b)
+  in
+    case v2 `mod` 3 of
+      0 ->
+        case b `mod` 3 of
+          0 ->
+            let v3 = v2 + 79 + v2
+            in
+              let v4 = (step28 b b)
+              in
+                68 + v2
+          _ ->
+            v2 * 40 + v2
+      _ ->
+        let v3 = 85 + 6
+        in
+          case v2 `mod` 3 of
+            0 ->
+              if a > 13
+                then
+                  23 - v3 * 17
+                else
+                  v2 * b
+            _ ->
+              b * v2
+
+-- step41: generated
+step41 :: Int -> Int -> Int
+step41 a b =
+  if a == 50
+    then
+      a
+    else
+      74
+
+-- step42: generated
+step42 :: Int -> Int
+step42 a =
+  let v1 = a - a * a
+  in
+    if a == 27
+      then
+        (step3 a) * v1
+      else
+        let v2 = 16
+        in
+          v1
+
+-- step43: generated
+step43 :: Int -> Int -> Int
+step43 a b =
+  a - 35
+
+-- step44: generated
+step44 :: Int -> Int -> Int
+step44 a b =
+  case b `mod` 3 of
+    0 ->
+      let v2 = a + b
+      in
+        if v2 > 70
+          then
+            if b < 68
+              then
+                let v3 = a * a - (step8 v2 b)
+                in
+                  a + 5 * (step37 b b)
+              else
+                if b < 11
+                  then
+                    55
+                  else
+                    v2 * 21 + (step16 a a)
+          else
+            if a > 68
+              then
+                case b `mod` 3 of
+                  0 ->
+                    47
+                  _ ->
+                    a
+              else
+                let v3 = (step33 v2) - 91
+                in
+                  65 - (step27 v2)
+    _ ->
+      if b == 86
+        then
+          99 * 45
+        else
+          if b < 46
+            then
+              if b > 40
+                then
+                  let v2 = a * (step26 a b)
+                  in
+                    (step28 b v2) - v2
+                else
+                  let v2 = 42 - b
+                  in
+                    b * (step40 a a) - b
+            else
+              case a `mod` 3 of
+                0 ->
+                  if b < 61
+                    then
+                      38
+                    else
+                      42
+                _ ->
+                  let v2 = b * b
+                  in
+                    69 * 33 + 49
+
+-- step45: generated
+step45 :: Int -> Int
+step45 a =
+  let v1 = a + 98 + (step44 a a)
+  in
+    let v2 = (step39 v1) + 70 - a
+    in
+      if a == 43
+        then
+          let v3 = 30 - v1 * (step35 v2 a)
+          in
+            v2
+        else
+          if v1 < 89
+            then
+              let v3 = a + a
+              in
+                8 + 10 * v2
+            else
+              let v3 = a
+              in
+                (step15 v3)
+
+-- step46: generated
+step46 :: Int -> Int -> Int
+step46 a b =
+  61
+
+-- step47: generated
+step47 :: Int -> Int -> Int
+step47 a b =
+  let v2 = 87
+  in
+    21
+
+-- step48: generated
+step48 :: Int -> Int
+step48 a =
+  case a `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          4 + 32 * 78
+        _ ->
+          if a > 12
+            then
+              let v1 = (step7 a a) + a
+              in
+                67 - v1 - a
+            else
+              if a < 20
+                then
+                  if a > 38
+                    then
+                      42 * a + a
+                    else
+                      a + a + a
+                else
+                  47 - 21 - (step18 a)
+    _ ->
+      (step24 a) * 74 * 18
+
+-- step49: generated
+step49 :: Int -> Int -> Int
+step49 a b =
+  case b `mod` 3 of
+    0 ->
+      55 - b
+    _ ->
+      case b `mod` 3 of
+        0 ->
+          17 + 59
+        _ ->
+          case a `mod` 3 of
+            0 ->
+              let v2 = b + a - b
+              in
+                if a < 76
+                  then
+                    47 - b
+                  else
+                    10
+            _ ->
+              let v2 = b
+              in
+                case v2 `mod` 3 of
+                  0 ->
+                    (step31 v2 v2) - 4
+                  _ ->
+                    a
+
+-- step50: generated
+step50 :: Int -> Int -> Int
+step50 a b =
+  case b `mod` 3 of
+    0 ->
+      (step36 b)
+    _ ->
+      case b `mod` 3 of
+        0 ->
+          let v2 = (step25 b b)
+          in
+            case v2 `mod` 3 of
+              0 ->
+                let v3 = a - 76
+                in
+                  (step9 b) + v2 + b
+              _ ->
+                let v3 = 85
+                in
+                  v3 + 63 * a
+        _ ->
+          if a == 19
+            then
+              33 - b + b
+            else
+              let v2 = b + b
+              in
+                case a `mod` 3 of
+                  0 ->
+                    99
+                  _ ->
+                    b * 55
+
+-- step51: generated
+step51 :: Int -> Int
+step51 a =
+  a * a - 20
+
+-- step52: generated
+step52 :: Int -> Int -> Int
+step52 a b =
+  case b `mod` 3 of
+    0 ->
+      a * b
+    _ ->
+      let v2 = 88
+      in
+        let v3 = v2
+        in
+          if b < 49
+            then
+              if a > 95
+                then
+                  v2
+                else
+                  66
+            else
+              v2 * (step48 b)
+
+-- step53: generated
+step53 :: Int -> Int -> Int
+step53 a b =
+  let v2 = 37
+  in
+    a - 77 + b
+
+-- step54: generated
+step54 :: Int -> Int
+step54 a =
+  let v1 = 51 + (step48 a)
+  in
+    if v1 == 33
+      then
+        let v2 = 3 * 98
+        in
+          if v2 < 70
+            then
+              let v3 = v1 + (step43 v2 v2) * v1
+              in
+                (step20 a v1) - 49
+            else
+              let v3 = 13 * 98 + 50
+              in
+                v1
+      else
+        if v1 < 1
+          then
+            case v1 `mod` 3 of
+              0 ->
+                if a < 66
+                  then
+                    87 - (step24 v1)
+                  else
+                    18 * (step32 v1 v1)
+              _ ->
+                if v1 < 87
+                  then
+                    a - a
+                  else
+                    62
+          else
+            let v2 = a - 2 * v1
+            in
+              if a > 67
+                then
+                  (step50 v1 a)
+                else
+                  4 + v1 - 52
+
+-- step55: generated
+step55 :: Int -> Int -> Int
+step55 a b =
+  58 + 67
+
+-- step56: generated
+step56 :: Int -> Int -> Int
+step56 a b =
+  let v2 = b * a
+  in
+    v2 * 68
+
+-- step57: generated
+step57 :: Int -> Int
+step57 a =
+  if a > 43
+    then
+      if a > 64
+        then
+          a - 64 - (step27 a)
+        else
+          case a `mod` 3 of
+            0 ->
+              let v1 = 97 + (step40 a a) * a
+              in
+                case a `mod` 3 of
+                  0 ->
+                    (step29 a a)
+                  _ ->
+                    v1
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  a + a
+                _ ->
+                  52
+    else
+      let v1 = 73 - 85 - a
+      in
+        if v1 > 22
+          then
+            if a < 14
+              then
+                let v2 = a
+                in
+                  v2
+              else
+                (step42 v1)
+          else
+            case a `mod` 3 of
+              0 ->
+                50 + 93 * (step11 a a)
+              _ ->
+                a
+
+-- step58: generated
+step58 :: Int -> Int -> Int
+step58 a b =
+  (step47 a a)
+
+-- step59: generated
+step59 :: Int -> Int -> Int
+step59 a b =
+  let v2 = 49 + a - a
+  in
+    case v2 `mod` 3 of
+      0 ->
+        if b > 42
+          then
+            if v2 < 35
+              then
+                let v3 = 89 - 22 + 19
+                in
+                  23
+              else
+                case b `mod` 3 of
+                  0 ->
+                    14
+                  _ ->
+                    76 - v2 - b
+          else
+            let v3 = v2 * v2 - 12
+            in
+              if b == 68
+                then
+                  29 * v3
+                else
+                  v3 * 2 - v3
+      _ ->
+        if v2 > 20
+          then
+            a
+          else
+            case a `mod` 3 of
+              0 ->
+                case v2 `mod` 3 of
+                  0 ->
+                    (step47 a v2) * (step33 a)
+                  _ ->
+                    62
+              _ ->
+                let v3 = v2 - b - v2
+                in
+                  27 - v2 * a
+
+-- step60: generated
+step60 :: Int -> Int
+step60 a =
+  let v1 = a
+  in
+    case v1 `mod` 3 of
+      0 ->
+        if a < 95
+          then
+            25 - 85 - 30
+          else
+            case v1 `mod` 3 of
+              0 ->
+                a
+              _ ->
+                55
+      _ ->
+        case v1 `mod` 3 of
+          0 ->
+            if a > 66
+              then
+                a + (step22 v1 a)
+              else
+                case a `mod` 3 of
+                  0 ->
+                    54 * v1
+                  _ ->
+                    v1 - v1 - 65
+          _ ->
+            case a `mod` 3 of
+              0 ->
+                82
+              _ ->
+                let v2 = 58 - 46 * 78
+                in
+                  a * v1
+
+-- step61: generated
+step61 :: Int -> Int -> Int
+step61 a b =
+  let v2 = (step40 b a) - (step50 a b) - b
+  in
+    case b `mod` 3 of
+      0 ->
+        case b `mod` 3 of
+          0 ->
+            case b `mod` 3 of
+              0 ->
+                a * (step0 b)
+              _ ->
+                let v3 = b
+                in
+                  a - (step35 v3 v3)
+          _ ->
+            let v3 = b
+            in
+              let v4 = b
+              in
+                v3 * 33
+      _ ->
+        case b `mod` 3 of
+          0 ->
+            80
+          _ ->
+            let v3 = 84
+            in
+              let v4 = 96 * v2
+              in
+                v2
+
+-- step62: generated
+step62 :: Int -> Int -> Int
+step62 a b =
+  if b == 71
+    then
+      let v2 = b + b
+      in
+        (step48 v2) * b
+    else
+      let v2 = (step9 a) * a * a
+      in
+        if v2 == 2
+          then
+            case a `mod` 3 of
+              0 ->
+                let v3 = (step27 a) - b * b
+                in
+                  b - 22 * b
+              _ ->
+                let v3 = 85 * b
+                in
+                  b * (step11 v2 v2) - 71
+          else
+            if b == 31
+              then
+                let v3 = a + 99
+                in
+                  (step34 a v3)
+              else
+                case v2 `mod` 3 of
+                  0 ->
+                    a - a
+                  _ ->
+                    60 + 70
+
+-- step63: generated
+step63 :: Int -> Int
+step63 a =
+  if a == 14
+    then
+      if a < 16
+        then
+          a
+        else
+          if a < 44
+            then
+              let v1 = 34
+              in
+                if v1 < 40
+                  then
+                    41 - v1
+                  else
+                    (step15 a)
+            else
+              21
+    else
+      a - a - a
+
+-- step64: generated
+step64 :: Int -> Int -> Int
+step64 a b =
+  if a == 0
+    then
+      case b `mod` 3 of
+        0 ->
+          if a > 46
+            then
+              let v2 = 11
+              in
+                case b `mod` 3 of
+                  0 ->
+                    15 * 7 + 99
+                  _ ->
+                    39
+            else
+              if b == 17
+                then
+                  case b `mod` 3 of
+                    0 ->
+                      65 - b
+                    _ ->
+                      a - (step17 a a) + 96
+                else
+                  b
+        _ ->
+          case b `mod` 3 of
+            0 ->
+              40
+            _ ->
+              let v2 = a
+              in
+                a * 64 - 10
+    else
+      case b `mod` 3 of
+        0 ->
+          case b `mod` 3 of
+            0 ->
+              if a == 59
+                then
+                  case b `mod` 3 of
+                    0 ->
+                      17 + b
+                    _ ->
+                      b * b
+                else
+                  (step49 b b) * a
+            _ ->
+              let v2 = a
+              in
+                b + (step42 a) + b
+        _ ->
+          let v2 = a + b * (step1 a b)
+          in
+            if a < 36
+              then
+                (step36 v2) - 36 + v2
+              else
+                let v3 = v2
+                in
+                  b
+
+-- step65: generated
+step65 :: Int -> Int -> Int
+step65 a b =
+  if a < 91
+    then
+      if a < 62
+        then
+          case a `mod` 3 of
+            0 ->
+              b
+            _ ->
+              let v2 = a - 0
+              in
+                if v2 < 5
+                  then
+                    a * 82 * b
+                  else
+                    18 * 61 * v2
+        else
+          let v2 = b * a + (step0 b)
+          in
+            if v2 < 63
+              then
+                let v3 = a
+                in
+                  37 * 14
+              else
+                let v3 = b - a + 7
+                in
+                  21 * v2
+    else
+      case b `mod` 3 of
+        0 ->
+          let v2 = b
+          in
+            let v3 = b + v2
+            in
+              case v3 `mod` 3 of
+                0 ->
+                  v3 + v3 - v2
+                _ ->
+                  a
+        _ ->
+          case a `mod` 3 of
+            0 ->
+              if a < 76
+                then
+                  let v2 = 41
+                  in
+                    99 + b - v2
+                else
+                  39 * (step58 b b) - a
+            _ ->
+              (step63 a)
+
+-- step66: generated
+step66 :: Int -> Int
+step66 a =
+  if a < 59
+    then
+      a
+    else
+      let v1 = 53 * a
+      in
+        case a `mod` 3 of
+          0 ->
+            if a < 26
+              then
+                a * a
+              else
+                case v1 `mod` 3 of
+                  0 ->
+                    (step34 v1 v1) - a
+                  _ ->
+                    3 - v1 - v1
+          _ ->
+            case a `mod` 3 of
+              0 ->
+                if v1 < 68
+                  then
+                    96
+                  else
+                    33 * a
+              _ ->
+                if a < 30
+                  then
+                    95 * 52 - a
+                  else
+                    a
+
+-- step67: generated
+step67 :: Int -> Int -> Int
+step67 a b =
+  if a < 9
+    then
+      let v2 = 56 - 73
+      in
+        let v3 = b
+        in
+          let v4 = 34 * b * a
+          in
+            case b `mod` 3 of
+              0 ->
+                v2
+              _ ->
+                v3 - 25
+    else
+      case a `mod` 3 of
+        0 ->
+          if b == 4
+            then
+              let v2 = b
+              in
+                let v3 = b - v2 * b
+                in
+                  46 * v3 - v2
+            else
+              if a < 98
+                then
+                  74 * b
+                else
+                  let v2 = 46 - a + a
+                  in
+                    83
+        _ ->
+          let v2 = b + a
+          in
+            let v3 = a
+            in
+              case v2 `mod` 3 of
+                0 ->
+                  v2
+                _ ->
+                  v3 - 98 + v3
+
+-- step68: generated
+step68 :: Int -> Int -> Int
+step68 a b =
+  let v2 = b - b
+  in
+    case b `mod` 3 of
+      0 ->
+        34 + 73
+      _ ->
+        let v3 = 58
+        in
+          let v4 = 70 * v2 - (step55 a v3)
+          in
+            let v5 = 40 + a - v2
+            in
+              53 - v4 + v5
+
+-- step69: generated
+step69 :: Int -> Int
+step69 a =
+  40 + (step11 a a) + a
+
+-- step70: generated
+step70 :: Int -> Int -> Int
+step70 a b =
+  if a == 1
+    then
+      let v2 = a - 0 + 90
+      in
+        if b == 17
+          then
+            if v2 == 49
+              then
+                9
+              else
+                case b `mod` 3 of
+                  0 ->
+                    1 * (step67 a b) + v2
+                  _ ->
+                    a - (step1 a b)
+          else
+            let v3 = 79 - v2 * 39
+            in
+              let v4 = 98
+              in
+                32
+    else
+      let v2 = 10 * b + 18
+      in
+        18
+
+-- step71: generated
+step71 :: Int -> Int -> Int
+step71 a b =
+  if b < 2
+    then
+      if a > 10
+        then
+          let v2 = b - b - 91
+          in
+            case a `mod` 3 of
+              0 ->
+                let v3 = 35
+                in
+                  v3 + 90
+              _ ->
+                v2
+        else
+          if a < 30
+            then
+              if b < 4
+                then
+                  b
+                else
+                  if a == 51
+                    then
+                      a + 30 + (step70 a a)
+                    else
+                      (step49 a b) * b * b
+            else
+              let v2 = 25
+              in
+                let v3 = b
+                in
+                  (step50 v2 b) - (step70 v2 b)
+    else
+      case b `mod` 3 of
+        0 ->
+          case a `mod` 3 of
+            0 ->
+              a * a
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  let v2 = a
+                  in
+                    57 * a
+                _ ->
+                  if a > 72
+                    then
+                      (step0 a)
+                    else
+                      b * a
+        _ ->
+          54 - a
+
+-- step72: generated
+step72 :: Int -> Int
+step72 a =
+  if a == 35
+    then
+      let v1 = a * (step65 a a)
+      in
+        99 * v1
+    else
+      a - 71
+
+-- step73: generated
+step73 :: Int -> Int -> Int
+step73 a b =
+  if a > 95
+    then
+      case b `mod` 3 of
+        0 ->
+          case a `mod` 3 of
+            0 ->
+              let v2 = 28
+              in
+                if a > 90
+                  then
+                    v2 + 23
+                  else
+                    46 + b
+            _ ->
+              case b `mod` 3 of
+                0 ->
+                  b
+                _ ->
+                  case a `mod` 3 of
+                    0 ->
+                      a
+                    _ ->
+                      a - a + 67
+        _ ->
+          (step56 a a) + 54
+    else
+      if a == 55
+        then
+          case a `mod` 3 of
+            0 ->
+              let v2 = b + (step24 a) + (step34 a a)
+              in
+                case b `mod` 3 of
+                  0 ->
+                    (step49 b b) * b
+                  _ ->
+                    90
+            _ ->
+              if a > 12
+                then
+                  a
+                else
+                  if b < 20
+                    then
+                      b + a - 49
+                    else
+                      80
+        else
+          case b `mod` 3 of
+            0 ->
+              case a `mod` 3 of
+                0 ->
+                  case a `mod` 3 of
+                    0 ->
+                      64
+                    _ ->
+                      14 - a - b
+                _ ->
+                  if b > 96
+                    then
+                      b + b
+                    else
+                      77 * 87
+            _ ->
+              case b `mod` 3 of
+                0 ->
+                  if a < 79
+                    then
+                      b + a - 84
+                    else
+                      85
+                _ ->
+                  91
+
+-- step74: generated
+step74 :: Int -> Int -> Int
+step74 a b =
+  if b < 98
+    then
+      case b `mod` 3 of
+        0 ->
+          case b `mod` 3 of
+            0 ->
+              let v2 = 90 - a
+              in
+                b - 93
+            _ ->
+              let v2 = a * a * 35
+              in
+                case b `mod` 3 of
+                  0 ->
+                    88
+                  _ ->
+                    a + 51
+        _ ->
+          case b `mod` 3 of
+            0 ->
+              let v2 = a - 71
+              in
+                if a > 41
+                  then
+                    59 - (step29 a v2)
+                  else
+                    a - b * 10
+            _ ->
+              if b < 87
+                then
+                  a
+                else
+                  case b `mod` 3 of
+                    0 ->
+                      61 - b - (step35 b a)
+                    _ ->
+                      69 - a + a
+    else
+      let v2 = (step67 b a) - 29 - b
+      in
+        case v2 `mod` 3 of
+          0 ->
+            if v2 < 19
+              then
+                if b < 53
+                  then
+                    a
+                  else
+                    b
+              else
+                (step52 a v2) * 45
+          _ ->
+            let v3 = v2
+            in
+              let v4 = b
+              in
+                (step63 a)
+
+-- step75: generated
+step75 :: Int -> Int
+step75 a =
+  case a `mod` 3 of
+    0 ->
+      (step57 a)
+    _ ->
+      let v1 = a - a
+      in
+        case v1 `mod` 3 of
+          0 ->
+            let v2 = v1 - a
+            in
+              let v3 = (step14 v2 v2)
+              in
+                a
+          _ ->
+            case v1 `mod` 3 of
+              0 ->
+                case a `mod` 3 of
+                  0 ->
+                    90
+                  _ ->
+                    58 + v1
+              _ ->
+                let v2 = 8 - (step4 a a) - 82
+                in
+                  v2
+
+-- step76: generated
+step76 :: Int -> Int -> Int
+step76 a b =
+  if a < 69
+    then
+      let v2 = b * 60 + b
+      in
+        case b `mod` 3 of
+          0 ->
+            if a == 76
+              then
+                case v2 `mod` 3 of
+                  0 ->
+                    (step26 b b) + (step33 b) - (step52 b b)
+                  _ ->
+                    b
+              else
+                let v3 = 73 - b
+                in
+                  66
+          _ ->
+            16
+    else
+      let v2 = 55
+      in
+        case b `mod` 3 of
+          0 ->
+            case v2 `mod` 3 of
+              0 ->
+                if b == 45
+                  then
+                    56 - 11 - a
+                  else
+                    13
+              _ ->
+                let v3 = a
+                in
+                  b + 27
+          _ ->
+            case b `mod` 3 of
+              0 ->
+                let v3 = a
+                in
+                  b * 7 * v3
+              _ ->
+                let v3 = b + v2 + 93
+                in
+                  73
+
+-- step77: generated
+step77 :: Int -> Int -> Int
+step77 a b =
+  case a `mod` 3 of
+    0 ->
+      let v2 = (step11 b b) - (step47 a b) * a
+      in
+        if a < 83
+          then
+            let v3 = v2
+            in
+              let v4 = 5
+              in
+                v4
+          else
+            case v2 `mod` 3 of
+              0 ->
+                if a < 70
+                  then
+                    b - 86
+                  else
+                    a + b + a
+              _ ->
+                case b `mod` 3 of
+                  0 ->
+                    98
+                  _ ->
+                    b
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          a * 71
+        _ ->
+          case a `mod` 3 of
+            0 ->
+              (step9 b)
+            _ ->
+              case b `mod` 3 of
+                0 ->
+                  a
+                _ ->
+                  let v2 = b
+                  in
+                    a + v2 * 37
+
+-- step78: generated
+step78 :: Int -> Int
+step78 a =
+  a + a - 97
+
+-- step79: generated
+step79 :: Int -> Int -> Int
+step79 a b =
+  (step38 b b) - a - a
+
+-- step80: generated
+step80 :: Int -> Int -> Int
+step80 a b =
+  case b `mod` 3 of
+    0 ->
+      let v2 = 18
+      in
+        let v3 = a * 0
+        in
+          case a `mod` 3 of
+            0 ->
+              case v2 `mod` 3 of
+                0 ->
+                  (step17 v2 a) - b - (step35 v3 v2)
+                _ ->
+                  53
+            _ ->
+              let v4 = (step22 a b) * b
+              in
+                b
+    _ ->
+      b + 90
+
+-- step81: generated
+step81 :: Int -> Int
+step81 a =
+  let v1 = a * 85 - a
+  in
+    if v1 < 11
+      then
+        v1 * a
+      else
+        let v2 = (step13 a a) - 31
+        in
+          let v3 = 45 - 82 * a
+          in
+            let v4 = v1 - 16
+            in
+              27
+
+-- step82: generated
+step82 :: Int -> Int -> Int
+step82 a b =
+  let v2 = a * 96 - a
+  in
+    1 + a - 51
+
+-- step83: generated
+step83 :: Int -> Int -> Int
+step83 a b =
+  22
+
+-- step84: generated
+step84 :: Int -> Int
+step84 a =
+  let v1 = a
+  in
+    if v1 == 13
+      then
+        case v1 `mod` 3 of
+          0 ->
+            case a `mod` 3 of
+              0 ->
+                let v2 = a - (step80 a v1) - a
+                in
+                  49
+              _ ->
+                78 + 10 - 55
+          _ ->
+            v1
+      else
+        if v1 == 95
+          then
+            case a `mod` 3 of
+              0 ->
+                case a `mod` 3 of
+                  0 ->
+                    a
+                  _ ->
+                    v1 - v1 - (step80 a a)
+              _ ->
+                v1 + (step32 v1 v1)
+          else
+            let v2 = v1
+            in
+              if v2 == 99
+                then
+                  (step42 a)
+                else
+                  (step45 v2)
+
+-- step85: generated
+step85 :: Int -> Int -> Int
+step85 a b =
+  case a `mod` 3 of
+    0 ->
+      case b `mod` 3 of
+        0 ->
+          case b `mod` 3 of
+            0 ->
+              let v2 = 4 * (step35 b b)
+              in
+                let v3 = b + 98
+                in
+                  b
+            _ ->
+              a + 97
+        _ ->
+          if b > 36
+            then
+              26
+            else
+              b + a - b
+    _ ->
+      b * a
+
+-- step86: generated
+step86 :: Int -> Int -> Int
+step86 a b =
+  (step24 b) + a * b
+
+-- step87: generated
+step87 :: Int -> Int
+step87 a =
+  36
+
+-- step88: generated
+step88 :: Int -> Int -> Int
+step88 a b =
+  a
+
+-- step89: generated
+step89 :: Int -> Int -> Int
+step89 a b =
+  a
+
+-- step90: generated
+step90 :: Int -> Int
+step90 a =
+  case a `mod` 3 of
+    0 ->
+      let v1 = a
+      in
+        35 * a
+    _ ->
+      if a < 83
+        then
+          let v1 = 7 + (step81 a) * a
+          in
+            let v2 = a + v1
+            in
+              let v3 = 19
+              in
+                95 * v2 + v3
+        else
+          55 + a
+
+-- step91: generated
+step91 :: Int -> Int -> Int
+step91 a b =
+  case a `mod` 3 of
+    0 ->
+      if b == 52
+        then
+          let v2 = b
+          in
+            case a `mod` 3 of
+              0 ->
+                v2
+              _ ->
+                v2
+        else
+          case b `mod` 3 of
+            0 ->
+              if b > 70
+                then
+                  let v2 = (step29 a b) + a + b
+                  in
+                    36 * 79 - v2
+                else
+                  case b `mod` 3 of
+                    0 ->
+                      a
+                    _ ->
+                      a * 32
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  27 * b
+                _ ->
+                  18 - b + 49
+    _ ->
+      a
+
+-- step92: generated
+step92 :: Int -> Int -> Int
+step92 a b =
+  a
+
+-- step93: generated
+step93 :: Int -> Int
+step93 a =
+  let v1 = 71 + 61
+  in
+    if a == 8
+      then
+        case v1 `mod` 3 of
+          0 ->
+            v1 - (step34 a v1) + 69
+          _ ->
+            (step34 v1 v1) + a * v1
+      else
+        if v1 < 53
+          then
+            let v2 = v1
+            in
+              v2 + 66 - (step54 v1)
+          else
+            if v1 == 89
+              then
+                (step6 v1) + 57 - a
+              else
+                case a `mod` 3 of
+                  0 ->
+                    15
+                  _ ->
+                    a
+
+-- step94: generated
+step94 :: Int -> Int -> Int
+step94 a b =
+  if b > 26
+    then
+      a + b
+    else
+      let v2 = b + a - a
+      in
+        if v2 < 7
+          then
+            if b < 69
+              then
+                case a `mod` 3 of
+                  0 ->
+                    72
+                  _ ->
+                    (step77 b a)
+              else
+                let v3 = b * 32
+                in
+                  (step73 a v2) - 6
+          else
+            a - (step67 v2 a) - 3
+
+-- step95: generated
+step95 :: Int -> Int -> Int
+step95 a b =
+  let v2 = a + 42
+  in
+    if b > 85
+      then
+        if b < 10
+          then
+            let v3 = (step3 v2) + 93
+            in
+              if v3 > 86
+                then
+                  8 + (step59 b a)
+                else
+                  18 - v2 + v3
+          else
+            case b `mod` 3 of
+              0 ->
+                let v3 = a + a - v2
+                in
+                  b + a * 73
+              _ ->
+                (step56 v2 b) * 94 - (step36 v2)
+      else
+        case v2 `mod` 3 of
+          0 ->
+            a + 71
+          _ ->
+            case a `mod` 3 of
+              0 ->
+                if a == 37
+                  then
+                    1 * (step5 a b) + a
+                  else
+                    v2
+              _ ->
+                (step79 a b)
+
+-- step96: generated
+step96 :: Int -> Int
+step96 a =
+  let v1 = a
+  in
+    let v2 = v1
+    in
+      if v2 > 99
+        then
+          v1 + v1 * a
+        else
+          a
+
+-- step97: generated
+step97 :: Int -> Int -> Int
+step97 a b =
+  31 + b
+
+-- step98: generated
+step98 :: Int -> Int -> Int
+step98 a b =
+  if b < 28
+    then
+      let v2 = 79 - b
+      in
+        case a `mod` 3 of
+          0 ->
+            case a `mod` 3 of
+              0 ->
+                29 * 28 - v2
+              _ ->
+                case b `mod` 3 of
+                  0 ->
+                    b * 81
+                  _ ->
+                    38 - v2 + (step94 b b)
+          _ ->
+            if a == 55
+              then
+                let v3 = v2
+                in
+                  25 - v2
+              else
+                v2
+    else
+      b
+
+-- step99: generated
+step99 :: Int -> Int
+step99 a =
+  let v1 = 83
+  in
+    case v1 `mod` 3 of
+      0 ->
+        case v1 `mod` 3 of
+          0 ->
+            let v2 = v1 - a + v1
+            in
+              v1 * 97
+          _ ->
+            2 * (step62 v1 a)
+      _ ->
+        65 * (step28 v1 v1)
+
+-- step100: generated
+step100 :: Int -> Int -> Int
+step100 a b =
+  case b `mod` 3 of
+    0 ->
+      let v2 = a * b
+      in
+        let v3 = a - b + v2
+        in
+          36 - (step76 a v3) - 12
+    _ ->
+      75
+
+-- step101: generated
+step101 :: Int -> Int -> Int
+step101 a b =
+  if a < 80
+    then
+      b * 27
+    else
+      if a > 68
+        then
+          59 + 54 + 6
+        else
+          84 + 86 - a
+
+-- step102: generated
+step102 :: Int -> Int
+step102 a =
+  if a < 94
+    then
+      if a > 91
+        then
+          if a == 67
+            then
+              let v1 = 41
+              in
+                if v1 > 69
+                  then
+                    62 - 10
+                  else
+                    v1 + 93
+            else
+              let v1 = (step44 a a) - 65 + 76
+              in
+                let v2 = v1 * (step57 a)
+                in
+                  (step47 v2 v2) * v1 - v1
+        else
+          case a `mod` 3 of
+            0 ->
+              if a < 57
+                then
+                  let v1 = 14 * a
+                  in
+                    3 + v1 + 88
+                else
+                  case a `mod` 3 of
+                    0 ->
+                      7
+                    _ ->
+                      71 - 52 - (step16 a a)
+            _ ->
+              let v1 = (step86 a a) + a * a
+              in
+                if v1 > 97
+                  then
+                    a - a
+                  else
+                    10 - (step72 v1) + (step75 v1)
+    else
+      case a `mod` 3 of
+        0 ->
+          (step83 a a) * (step35 a a) - 50
+        _ ->
+          if a > 61
+            then
+              if a < 18
+                then
+                  if a > 15
+                    then
+                      a * a
+                    else
+                      78 - a * 28
+                else
+                  if a == 34
+                    then
+                      a
+                    else
+                      6
+            else
+              let v1 = a * a * 24
+              in
+                let v2 = a * a * a
+                in
+                  93 * (step61 v2 v1)
+
+-- step103: generated
+step103 :: Int -> Int -> Int
+step103 a b =
+  let v2 = (step5 b b) * a
+  in
+    if a == 4
+      then
+        if b > 26
+          then
+            let v3 = 78 - b + (step100 a v2)
+            in
+              let v4 = a - 90 + v3
+              in
+                37 + (step23 v4 v2)
+          else
+            let v3 = b + b - (step33 b)
+            in
+              let v4 = v2 - a
+              in
+                19 * (step91 v3 a)
+      else
+        let v3 = b + v2
+        in
+          if v2 < 55
+            then
+              let v4 = a + (step65 v2 v3)
+              in
+                a
+            else
+              case b `mod` 3 of
+                0 ->
+                  42 - 76 - v3
+                _ ->
+                  50
+
+-- step104: generated
+step104 :: Int -> Int -> Int
+step104 a b =
+  40 - a - (step11 a b)
+
+-- step105: generated
+step105 :: Int -> Int
+step105 a =
+  25 + 2 * 9
+
+-- step106: generated
+step106 :: Int -> Int -> Int
+step106 a b =
+  case b `mod` 3 of
+    0 ->
+      a
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          if a < 76
+            then
+              if b > 35
+                then
+                  let v2 = a + 33
+                  in
+                    44 * b
+                else
+                  let v2 = a
+                  in
+                    v2 + (step38 b a)
+            else
+              let v2 = b + 86 * b
+              in
+                let v3 = (step50 b a)
+                in
+                  b * 34
+        _ ->
+          b + a * 23
+
+-- step107: generated
+step107 :: Int -> Int -> Int
+step107 a b =
+  (step36 b)
+
+-- step108: generated
+step108 :: Int -> Int
+step108 a =
+  if a > 39
+    then
+      let v1 = (step91 a a) * a
+      in
+        let v2 = 80 - (step59 v1 a)
+        in
+          case v2 `mod` 3 of
+            0 ->
+              let v3 = v1
+              in
+                74
+            _ ->
+              96 - a
+    else
+      case a `mod` 3 of
+        0 ->
+          case a `mod` 3 of
+            0 ->
+              case a `mod` 3 of
+                0 ->
+                  case a `mod` 3 of
+                    0 ->
+                      a + a + (step79 a a)
+                    _ ->
+                      a
+                _ ->
+                  if a == 39
+                    then
+                      48
+                    else
+                      18 + a + 26
+            _ ->
+              let v1 = 95
+              in
+                case v1 `mod` 3 of
+                  0 ->
+                    v1 - v1 - (step6 a)
+                  _ ->
+                    77 * a
+        _ ->
+          let v1 = 30
+          in
+            if v1 < 12
+              then
+                case a `mod` 3 of
+                  0 ->
+                    a
+                  _ ->
+                    a + v1
+              else
+                a + 3
+
+-- step109: generated
+step109 :: Int -> Int -> Int
+step109 a b =
+  if b < 28
+    then
+      if a < 23
+        then
+          case a `mod` 3 of
+            0 ->
+              b + 8 + a
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  (step31 a b) - (step26 a a) - a
+                _ ->
+                  case a `mod` 3 of
+                    0 ->
+                      b + (step10 b a)
+                    _ ->
+                      b - b + 70
+        else
+          99 * a
+    else
+      87 - 97 * 18
+
+-- step110: generated
+step110 :: Int -> Int -> Int
+step110 a b =
+  if a == 77
+    then
+      if b < 78
+        then
+          let v2 = 75 - b * 63
+          in
+            case b `mod` 3 of
+              0 ->
+                if v2 == 9
+                  then
+                    a + v2 - b
+                  else
+                    a * a
+              _ ->
+                let v3 = a + v2 - 80
+                in
+                  62
+        else
+          if a > 10
+            then
+              34
+            else
+              case a `mod` 3 of
+                0 ->
+                  let v2 = a - a
+                  in
+                    v2 + a
+                _ ->
+                  case b `mod` 3 of
+                    0 ->
+                      35 - b - (step57 b)
+                    _ ->
+                      11
+    else
+      b
+
+-- step111: generated
+step111 :: Int -> Int
+step111 a =
+  if a < 91
+    then
+      let v1 = a - a - a
+      in
+        if v1 < 17
+          then
+            v1
+          else
+            62
+    else
+      case a `mod` 3 of
+        0 ->
+          if a == 5
+            then
+              case a `mod` 3 of
+                0 ->
+                  (step60 a) + a * 16
+                _ ->
+                  if a > 44
+                    then
+                      (step30 a) - a
+                    else
+                      17
+            else
+              let v1 = a
+              in
+                case a `mod` 3 of
+                  0 ->
+                    55 + a * 18
+                  _ ->
+                    a * 12
+        _ ->
+          case a `mod` 3 of
+            0 ->
+              a
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  if a == 59
+                    then
+                      53 + 46 - a
+                    else
+                      a + 49
+                _ ->
+                  if a < 60
+                    then
+                      a
+                    else
+                      (step7 a a)
+
+-- step112: generated
+step112 :: Int -> Int -> Int
+step112 a b =
+  let v2 = a + 63
+  in
+    let v3 = b * 25
+    in
+      let v4 = b
+      in
+        if a == 29
+          then
+            v3 * a + a
+          else
+            if v4 > 34
+              then
+                v3 * (step102 a) - a
+              else
+                25 + 17
+
+-- step113: generated
+step113 :: Int -> Int -> Int
+step113 a b =
+  43 - b - a
+
+-- step114: generated
+step114 :: Int -> Int
+step114 a =
+  a + a - 93
+
+-- step115: generated
+step115 :: Int -> Int -> Int
+step115 a b =
+  (step61 a b) - 49 + a
+
+-- step116: generated
+step116 :: Int -> Int -> Int
+step116 a b =
+  (step107 a b) * b
+
+-- step117: generated
+step117 :: Int -> Int
+step117 a =
+  let v1 = a * (step111 a) + a
+  in
+    case a `mod` 3 of
+      0 ->
+        let v2 = v1 - a + 52
+        in
+          let v3 = (step25 v2 a) - (step16 a v2) * 84
+          in
+            case v1 `mod` 3 of
+              0 ->
+                v2 - 3
+              _ ->
+                v1 * 81 - (step74 a v2)
+      _ ->
+        14
+
+-- step118: generated
+step118 :: Int -> Int -> Int
+step118 a b =
+  let v2 = a * 18 + 3
+  in
+    b
+
+-- step119: generated
+step119 :: Int -> Int -> Int
+step119 a b =
+  case b `mod` 3 of
+    0 ->
+      case b `mod` 3 of
+        0 ->
+          let v2 = a - 39
+          in
+            if b > 18
+              then
+                let v3 = 48 * (step99 v2) - a
+                in
+                  (step57 v2) - v2 * 51
+              else
+                let v3 = 38
+                in
+                  v3 * b
+        _ ->
+          0 + (step87 a) - 41
+    _ ->
+      let v2 = 2 - 64
+      in
+        case b `mod` 3 of
+          0 ->
+            if b < 83
+              then
+                let v3 = b + 50 + (step9 a)
+                in
+                  v3 + v2 * b
+              else
+                (step49 a a)
+          _ ->
+            let v3 = 7 - (step65 b v2) + (step1 a b)
+            in
+              let v4 = v2
+              in
+                b - 67
+
+-- step120: generated
+step120 :: Int -> Int
+step120 a =
+  a
+
+-- step121: generated
+step121 :: Int -> Int -> Int
+step121 a b =
+  case b `mod` 3 of
+    0 ->
+      let v2 = (step31 a b)
+      in
+        (step27 v2)
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          case b `mod` 3 of
+            0 ->
+              case b `mod` 3 of
+                0 ->
+                  if a == 21
+                    then
+                      70 * b
+                    else
+                      25 * 36 * 40
+                _ ->
+                  39
+            _ ->
+              let v2 = 18 * 48 * 10
+              in
+                a
+        _ ->
+          case a `mod` 3 of
+            0 ->
+              case a `mod` 3 of
+                0 ->
+                  let v2 = 60 - 48 * (step75 a)
+                  in
+                    a * 68 * a
+                _ ->
+                  if a == 1
+                    then
+                      a
+                    else
+                      a + (step69 a)
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  let v2 = a
+                  in
+                    84
+                _ ->
+                  case b `mod` 3 of
+                    0 ->
+                      15 + (step54 a)
+                    _ ->
+                      33 - b
+
+-- step122: generated
+step122 :: Int -> Int -> Int
+step122 a b =
+  94 * b * 1
+
+-- step123: generated
+step123 :: Int -> Int
+step123 a =
+  let v1 = a * a + a
+  in
+    let v2 = a * v1 - 80
+    in
+      52 * (step65 v1 v2) + (step30 v2)
+
+-- step124: generated
+step124 :: Int -> Int -> Int
+step124 a b =
+  case b `mod` 3 of
+    0 ->
+      let v2 = 1 - 38 * (step48 b)
+      in
+        (step68 b b)
+    _ ->
+      case b `mod` 3 of
+        0 ->
+          case b `mod` 3 of
+            0 ->
+              if a < 20
+                then
+                  if b < 17
+                    then
+                      b - 13
+                    else
+                      84 * b
+                else
+                  if b == 28
+                    then
+                      28
+                    else
+                      a + 34
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  if b == 57
+                    then
+                      b
+                    else
+                      b + 22 + a
+                _ ->
+                  let v2 = (step88 a b)
+                  in
+                    44 + b
+        _ ->
+          a
+
+-- step125: generated
+step125 :: Int -> Int -> Int
+step125 a b =
+  if a > 76
+    then
+      case b `mod` 3 of
+        0 ->
+          25
+        _ ->
+          if a < 7
+            then
+              let v2 = 36 * a - a
+              in
+                if a < 31
+                  then
+                    b
+                  else
+                    (step113 a v2)
+            else
+              let v2 = (step21 a)
+              in
+                case v2 `mod` 3 of
+                  0 ->
+                    v2
+                  _ ->
+                    b * v2 + 50
+    else
+      if b > 78
+        then
+          if b < 74
+            then
+              case a `mod` 3 of
+                0 ->
+                  76 * 14 + (step98 b b)
+                _ ->
+                  91 + 66 + b
+            else
+              if a > 38
+                then
+                  let v2 = (step19 a a) * b * 93
+                  in
+                    b - (step9 a) + b
+                else
+                  if a < 28
+                    then
+                      b * (step37 b a) - (step37 b b)
+                    else
+                      (step76 a b)
+        else
+          case a `mod` 3 of
+            0 ->
+              8
+            _ ->
+              if a < 10
+                then
+                  if b < 96
+                    then
+                      59 + 92
+                    else
+                      a + 62
+                else
+                  case a `mod` 3 of
+                    0 ->
+                      65 * b
+                    _ ->
+                      a
+
+-- step126: generated
+step126 :: Int -> Int
+step126 a =
+  case a `mod` 3 of
+    0 ->
+      a * a - (step21 a)
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          let v1 = a - 22 * a
+          in
+            (step14 a a)
+        _ ->
+          case a `mod` 3 of
+            0 ->
+              26 - a
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  case a `mod` 3 of
+                    0 ->
+                      a - a + a
+                    _ ->
+                      52 - 6 - a
+                _ ->
+                  case a `mod` 3 of
+                    0 ->
+                      19 * 68
+                    _ ->
+                      a - a
+
+-- step127: generated
+step127 :: Int -> Int -> Int
+step127 a b =
+  let v2 = 47
+  in
+    let v3 = a - b + 49
+    in
+      v2 - b
+
+-- step128: generated
+step128 :: Int -> Int -> Int
+step128 a b =
+  (step20 a b) - 32 + (step91 b b)
+
+-- step129: generated
+step129 :: Int -> Int
+step129 a =
+  a
+
+-- step130: generated
+step130 :: Int -> Int -> Int
+step130 a b =
+  if a > 58
+    then
+      case b `mod` 3 of
+        0 ->
+          case a `mod` 3 of
+            0 ->
+              case a `mod` 3 of
+                0 ->
+                  if b < 30
+                    then
+                      (step90 a) - b + a
+                    else
+                      64
+                _ ->
+                  95
+            _ ->
+              if b == 86
+                then
+                  case b `mod` 3 of
+                    0 ->
+                      a * b + b
+                    _ ->
+                      b
+                else
+                  case b `mod` 3 of
+                    0 ->
+                      39
+                    _ ->
+                      b
+        _ ->
+          if a == 90
+            then
+              let v2 = (step89 a b)
+              in
+                case v2 `mod` 3 of
+                  0 ->
+                    v2
+                  _ ->
+                    12
+            else
+              (step88 a a) * b - a
+    else
+      if a > 44
+        then
+          if a < 32
+            then
+              57
+            else
+              let v2 = 30
+              in
+                v2
+        else
+          let v2 = 11 - (step123 a)
+          in
+            let v3 = 47
+            in
+              if b == 59
+                then
+                  81 - v3 * 66
+                else
+                  v3 * 25 + 38
+
+-- step131: generated
+step131 :: Int -> Int -> Int
+step131 a b =
+  let v2 = (step8 b b)
+  in
+    if b == 87
+      then
+        case v2 `mod` 3 of
+          0 ->
+            let v3 = v2
+            in
+              let v4 = (step42 b)
+              in
+                52
+          _ ->
+            if b > 76
+              then
+                let v3 = 24 - v2 - b
+                in
+                  (step28 v3 a) - a
+              else
+                let v3 = b
+                in
+                  (step39 a)
+      else
+        let v3 = 65 * v2
+        in
+          if v3 < 8
+            then
+              a + 15
+            else
+              if b > 83
+                then
+                  a + 63 * 13
+                else
+                  42 * b - v2
+
+-- step132: generated
+step132 :: Int -> Int
+step132 a =
+  let v1 = 88 - (step126 a)
+  in
+    52
+
+-- step133: generated
+step133 :: Int -> Int -> Int
+step133 a b =
+  case b `mod` 3 of
+    0 ->
+      if b > 51
+        then
+          11 - a
+        else
+          if a == 73
+            then
+              let v2 = (step100 b a) * a * a
+              in
+                b + b
+            else
+              if b == 54
+                then
+                  74
+                else
+                  let v2 = 99
+                  in
+                    70 * 96 - v2
+    _ ->
+      11 + (step55 b a)
+
+-- step134: generated
+step134 :: Int -> Int -> Int
+step134 a b =
+  let v2 = 17 - 26 - 61
+  in
+    case a `mod` 3 of
+      0 ->
+        b - v2 - (step68 v2 a)
+      _ ->
+        case b `mod` 3 of
+          0 ->
+            let v3 = b * v2
+            in
+              let v4 = a
+              in
+                95 + v3
+          _ ->
+            let v3 = b * 69 * (step116 a v2)
+            in
+              if v2 > 31
+                then
+                  a - 56 + b
+                else
+                  (step121 v2 a) * a + b
+
+-- step135: generated
+step135 :: Int -> Int
+step135 a =
+  if a < 91
+    then
+      30 + 80
+    else
+      if a < 48
+        then
+          if a < 8
+            then
+              case a `mod` 3 of
+                0 ->
+                  36
+                _ ->
+                  if a < 49
+                    then
+                      a + a + (step75 a)
+                    else
+                      a - 62
+            else
+              let v1 = (step105 a) * 1 * (step71 a a)
+              in
+                let v2 = 94 - a + (step16 a v1)
+                in
+                  v1
+        else
+          let v1 = a + a + 31
+          in
+            if v1 == 18
+              then
+                let v2 = (step95 a a) + v1
+                in
+                  v2 * v2 + 8
+              else
+                if a < 74
+                  then
+                    v1
+                  else
+                    v1 - 16 - v1
+
+-- step136: generated
+step136 :: Int -> Int -> Int
+step136 a b =
+  a + 79
+
+-- step137: generated
+step137 :: Int -> Int -> Int
+step137 a b =
+  let v2 = 46
+  in
+    case v2 `mod` 3 of
+      0 ->
+        5
+      _ ->
+        if b > 60
+          then
+            let v3 = a - a
+            in
+              case v3 `mod` 3 of
+                0 ->
+                  (step36 b) - v3 * a
+                _ ->
+                  41 + 28 + 92
+          else
+            case a `mod` 3 of
+              0 ->
+                97 + 23
+              _ ->
+                v2 * v2
+
+-- step138: generated
+step138 :: Int -> Int
+step138 a =
+  let v1 = a
+  in
+    if a < 29
+      then
+        a
+      else
+        (step44 v1 a) * a * v1
+
+-- step139: generated
+step139 :: Int -> Int -> Int
+step139 a b =
+  case a `mod` 3 of
+    0 ->
+      3
+    _ ->
+      if b > 71
+        then
+          let v2 = b
+          in
+            case b `mod` 3 of
+              0 ->
+                48
+              _ ->
+                let v3 = v2 + a - 23
+                in
+                  v3 + a - 74
+        else
+          let v2 = a - 47 - 55
+          in
+            let v3 = b + 96 * 51
+            in
+              let v4 = (step26 v2 b) - v3
+              in
+                a * 14 - a
+
+-- step140: generated
+step140 :: Int -> Int -> Int
+step140 a b =
+  case b `mod` 3 of
+    0 ->
+      if b == 52
+        then
+          case a `mod` 3 of
+            0 ->
+              if a == 44
+                then
+                  a - b - b
+                else
+                  b - a
+            _ ->
+              1 - 2
+        else
+          case a `mod` 3 of
+            0 ->
+              if b > 46
+                then
+                  97 - (step10 b a) + a
+                else
+                  a
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  case b `mod` 3 of
+                    0 ->
+                      a * (step19 a b)
+                    _ ->
+                      b
+                _ ->
+                  if b == 41
+                    then
+                      a * 43
+                    else
+                      78 * (step98 b b)
+    _ ->
+      81 * a
+
+-- step141: generated
+step141 :: Int -> Int
+step141 a =
+  let v1 = a
+  in
+    64
+
+-- step142: generated
+step142 :: Int -> Int -> Int
+step142 a b =
+  let v2 = a + b
+  in
+    case b `mod` 3 of
+      0 ->
+        case v2 `mod` 3 of
+          0 ->
+            if v2 < 33
+              then
+                let v3 = 97
+                in
+                  v2 - b
+              else
+                let v3 = 67 + b + 5
+                in
+                  10 * (step44 b a) - v3
+          _ ->
+            if b > 50
+              then
+                if a == 90
+                  then
+                    b - a
+                  else
+                    v2 * (step44 b v2)
+              else
+                let v3 = 29 + a
+                in
+                  15 * v3
+      _ ->
+        case b `mod` 3 of
+          0 ->
+            case a `mod` 3 of
+              0 ->
+                let v3 = v2 - (step66 b) - (step128 v2 v2)
+                in
+                  60 + 58
+              _ ->
+                if b > 10
+                  then
+                    a
+                  else
+                    27 + (step38 a b)
+          _ ->
+            if v2 > 40
+              then
+                if v2 == 16
+                  then
+                    15
+                  else
+                    (step31 v2 v2)
+              else
+                let v3 = a + 60 + v2
+                in
+                  (step18 v3)
+
+-- step143: generated
+step143 :: Int -> Int -> Int
+step143 a b =
+  if a == 36
+    then
+      if b < 73
+        then
+          let v2 = b + 93 + a
+          in
+            if a < 50
+              then
+                case a `mod` 3 of
+                  0 ->
+                    b
+                  _ ->
+                    91 * 65
+              else
+                if b == 29
+                  then
+                    31 + a + 16
+                  else
+                    a - a
+        else
+          if a == 56
+            then
+              case b `mod` 3 of
+                0 ->
+                  case a `mod` 3 of
+                    0 ->
+                      47
+                    _ ->
+                      (step20 a a) * 74 + 97
+                _ ->
+                  let v2 = a
+                  in
+                    v2 - v2 + b
+            else
+              13 + 73 * 59
+    else
+      b + a - b
+
+-- step144: generated
+step144 :: Int -> Int
+step144 a =
+  case a `mod` 3 of
+    0 ->
+      if a > 27
+        then
+          a + 69
+        else
+          let v1 = a
+          in
+            v1 - a + v1
+    _ ->
+      if a > 73
+        then
+          if a < 95
+            then
+              if a > 83
+                then
+                  let v1 = 92 - a - a
+                  in
+                    (step125 v1 a)
+                else
+                  case a `mod` 3 of
+                    0 ->
+                      a * a + 56
+                    _ ->
+                      0
+            else
+              if a > 94
+                then
+                  a * a * a
+                else
+                  53
+        else
+          if a < 80
+            then
+              if a == 66
+                then
+                  87
+                else
+                  if a == 50
+                    then
+                      99
+                    else
+                      a
+            else
+              let v1 = 47 - a - 12
+              in
+                v1 + 79
+
+-- step145: generated
+step145 :: Int -> Int -> Int
+step145 a b =
+  let v2 = a - a + 18
+  in
+    v2 + b - v2
+
+-- step146: generated
+step146 :: Int -> Int -> Int
+step146 a b =
+  if b == 91
+    then
+      (step14 a b) + a - 54
+    else
+      case b `mod` 3 of
+        0 ->
+          if a < 45
+            then
+              if a < 47
+                then
+                  case b `mod` 3 of
+                    0 ->
+                      a
+                    _ ->
+                      b - b + b
+                else
+                  if b == 73
+                    then
+                      a
+                    else
+                      (step13 b a)
+            else
+              case b `mod` 3 of
+                0 ->
+                  if a > 65
+                    then
+                      b
+                    else
+                      22
+                _ ->
+                  let v2 = a * (step59 a b) + (step114 a)
+                  in
+                    (step22 a b) + 18 + 32
+        _ ->
+          let v2 = 14 + 54 - a
+          in
+            if a < 22
+              then
+                case a `mod` 3 of
+                  0 ->
+                    (step54 a) - 82
+                  _ ->
+                    b - 67
+              else
+                case b `mod` 3 of
+                  0 ->
+                    v2 - b + b
+                  _ ->
+                    a + a * 74
+
+-- step147: generated
+step147 :: Int -> Int
+step147 a =
+  let v1 = 28 + 71
+  in
+    case a `mod` 3 of
+      0 ->
+        23 + v1 + 61
+      _ ->
+        if v1 < 0
+          then
+            a * 67
+          else
+            (step74 a v1)
+
+-- step148: generated
+step148 :: Int -> Int -> Int
+step148 a b =
+  case a `mod` 3 of
+    0 ->
+      a
+    _ ->
+      case b `mod` 3 of
+        0 ->
+          let v2 = a + 35 * 55
+          in
+            v2 * a
+        _ ->
+          if b == 30
+            then
+              b - b
+            else
+              58 + (step97 b a) * 69
+
+-- step149: generated
+step149 :: Int -> Int -> Int
+step149 a b =
+  (step79 a b)
+
+-- step150: generated
+step150 :: Int -> Int
+step150 a =
+  39
+
+-- step151: generated
+step151 :: Int -> Int -> Int
+step151 a b =
+  if b < 4
+    then
+      if b > 91
+        then
+          case a `mod` 3 of
+            0 ->
+              if b > 21
+                then
+                  let v2 = a + 8
+                  in
+                    b - a * v2
+                else
+                  let v2 = b
+                  in
+                    (step113 a v2)
+            _ ->
+              64 + a
+        else
+          let v2 = 64 * (step63 b)
+          in
+            case v2 `mod` 3 of
+              0 ->
+                let v3 = a - (step144 b)
+                in
+                  v2
+              _ ->
+                let v3 = v2 + a
+                in
+                  (step124 a v3)
+    else
+      let v2 = b
+      in
+        b * a
+
+-- step152: generated
+step152 :: Int -> Int -> Int
+step152 a b =
+  (step127 b b) * 85 * 88
+
+-- step153: generated
+step153 :: Int -> Int
+step153 a =
+  if a < 93
+    then
+      let v1 = 19 * 31
+      in
+        case v1 `mod` 3 of
+          0 ->
+            (step81 a)
+          _ ->
+            let v2 = v1 * 35 - 36
+            in
+              case v1 `mod` 3 of
+                0 ->
+                  v2 + 73
+                _ ->
+                  v2 + v2 * v2
+    else
+      if a > 63
+        then
+          case a `mod` 3 of
+            0 ->
+              let v1 = a
+              in
+                (step61 a a)
+            _ ->
+              0
+        else
+          a + 38
+
+-- step154: generated
+step154 :: Int -> Int -> Int
+step154 a b =
+  let v2 = b * a
+  in
+    case b `mod` 3 of
+      0 ->
+        let v3 = b * (step125 v2 a) * (step12 b)
+        in
+          90 * b - a
+      _ ->
+        let v3 = (step66 a)
+        in
+          case a `mod` 3 of
+            0 ->
+              if a > 19
+                then
+                  v3 + (step102 b)
+                else
+                  v2 - v2 - v2
+            _ ->
+              if b == 11
+                then
+                  v2
+                else
+                  10 + v3 + v2
+
+-- step155: generated
+step155 :: Int -> Int -> Int
+step155 a b =
+  37 - b * a
+
+-- step156: generated
+step156 :: Int -> Int
+step156 a =
+  let v1 = 19 * 80
+  in
+    let v2 = v1 * 56 + a
+    in
+      v1 + 52
+
+-- step157: generated
+step157 :: Int -> Int -> Int
+step157 a b =
+  if b == 36
+    then
+      case a `mod` 3 of
+        0 ->
+          a * b
+        _ ->
+          a + (step110 a b)
+    else
+      let v2 = (step80 a a) + 70
+      in
+        54 * b + a
+
+-- step158: generated
+step158 :: Int -> Int -> Int
+step158 a b =
+  let v2 = 92 + a
+  in
+    case a `mod` 3 of
+      0 ->
+        case a `mod` 3 of
+          0 ->
+            2 - (step118 b v2)
+          _ ->
+            let v3 = v2 - a - a
+            in
+              98 - b
+      _ ->
+        case a `mod` 3 of
+          0 ->
+            let v3 = a + a
+            in
+              let v4 = b - b
+              in
+                85 - b
+          _ ->
+            let v3 = a - 91
+            in
+              case a `mod` 3 of
+                0 ->
+                  v2 + 8
+                _ ->
+                  (step74 v3 b) + b
+
+-- step159: generated
+step159 :: Int -> Int
+step159 a =
+  let v1 = a
+  in
+    case v1 `mod` 3 of
+      0 ->
+        let v2 = a * v1
+        in
+          19
+      _ ->
+        case v1 `mod` 3 of
+          0 ->
+            case v1 `mod` 3 of
+              0 ->
+                if a < 46
+                  then
+                    30
+                  else
+                    a
+              _ ->
+                let v2 = 54 + v1 * 26
+                in
+                  a
+          _ ->
+            let v2 = a * 0 * 30
+            in
+              let v3 = v2 * (step118 v2 v1)
+              in
+                85 * v2
+
+-- step160: generated
+step160 :: Int -> Int -> Int
+step160 a b =
+  let v2 = a - a + b
+  in
+    let v3 = 71 + 70 - (step17 a b)
+    in
+      case b `mod` 3 of
+        0 ->
+          case v3 `mod` 3 of
+            0 ->
+              case v3 `mod` 3 of
+                0 ->
+                  v2
+                _ ->
+                  b + 52 - v2
+            _ ->
+              let v4 = v3 + b * 21
+              in
+                (step124 b b) - 94 + b
+        _ ->
+          let v4 = a * 93
+          in
+            case b `mod` 3 of
+              0 ->
+                b
+              _ ->
+                v3 - b
+
+-- step161: generated
+step161 :: Int -> Int -> Int
+step161 a b =
+  if b > 48
+    then
+      (step9 b) * a + a
+    else
+      if a == 50
+        then
+          if a < 45
+            then
+              a
+            else
+              let v2 = b * a
+              in
+                if b == 95
+                  then
+                    24 * v2 + 26
+                  else
+                    v2 + (step58 v2 a)
+        else
+          case a `mod` 3 of
+            0 ->
+              case b `mod` 3 of
+                0 ->
+                  b
+                _ ->
+                  let v2 = 88 + a
+                  in
+                    a + b - a
+            _ ->
+              let v2 = 42 + (step38 b a) * (step52 b b)
+              in
+                a + 88
+
+-- step162: generated
+step162 :: Int -> Int
+step162 a =
+  let v1 = a - (step160 a a) - 31
+  in
+    case a `mod` 3 of
+      0 ->
+        20
+      _ ->
+        let v2 = v1 - 52
+        in
+          61 + 49 - 94
+
+-- step163: generated
+step163 :: Int -> Int -> Int
+step163 a b =
+  case a `mod` 3 of
+    0 ->
+      case b `mod` 3 of
+        0 ->
+          case b `mod` 3 of
+            0 ->
+              if a > 19
+                then
+                  if b > 78
+                    then
+                      50
+                    else
+                      a + a * 80
+                else
+                  let v2 = 81 + 12 - a
+                  in
+                    74 * 53
+            _ ->
+              let v2 = b - a
+              in
+                let v3 = v2 + b - v2
+                in
+                  94
+        _ ->
+          let v2 = b + b - a
+          in
+            let v3 = 90
+            in
+              v3
+    _ ->
+      a * 97
+
+-- step164: generated
+step164 :: Int -> Int -> Int
+step164 a b =
+  let v2 = (step24 b) - 98 * 1
+  in
+    (step136 b b) * 64 * 82
+
+-- step165: generated
+step165 :: Int -> Int
+step165 a =
+  a - a - (step55 a a)
+
+-- step166: generated
+step166 :: Int -> Int -> Int
+step166 a b =
+  case b `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          let v2 = 81 * a
+          in
+            if v2 < 59
+              then
+                18
+              else
+                (step42 b)
+        _ ->
+          case b `mod` 3 of
+            0 ->
+              if b > 60
+                then
+                  56
+                else
+                  case b `mod` 3 of
+                    0 ->
+                      6 - a * (step17 a b)
+                    _ ->
+                      74 * a * 9
+            _ ->
+              let v2 = a
+              in
+                if v2 == 40
+                  then
+                    (step44 b b) * 97
+                  else
+                    b - a
+    _ ->
+      b + 97 + 30
+
+-- step167: generated
+step167 :: Int -> Int -> Int
+step167 a b =
+  case b `mod` 3 of
+    0 ->
+      if a > 58
+        then
+          b * (step11 b b) - (step161 a a)
+        else
+          case a `mod` 3 of
+            0 ->
+              b
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  case b `mod` 3 of
+                    0 ->
+                      b * b + a
+                    _ ->
+                      a * a + 83
+                _ ->
+                  if b == 79
+                    then
+                      46
+                    else
+                      50
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          case a `mod` 3 of
+            0 ->
+              case a `mod` 3 of
+                0 ->
+                  56 - 89
+                _ ->
+                  case b `mod` 3 of
+                    0 ->
+                      b * a
+                    _ ->
+                      b
+            _ ->
+              let v2 = b + b * (step133 b a)
+              in
+                if v2 > 21
+                  then
+                    a
+                  else
+                    v2 - v2 - (step38 a a)
+        _ ->
+          if b > 88
+            then
+              let v2 = a * a + 98
+              in
+                let v3 = 23 * (step1 b v2)
+                in
+                  v3 + 23
+            else
+              let v2 = b
+              in
+                if a < 35
+                  then
+                    b * b
+                  else
+                    a * 19
+
+-- step168: generated
+step168 :: Int -> Int
+step168 a =
+  3
+
+-- step169: generated
+step169 :: Int -> Int -> Int
+step169 a b =
+  if a < 6
+    then
+      let v2 = (step159 a)
+      in
+        case a `mod` 3 of
+          0 ->
+            if b == 1
+              then
+                if a > 57
+                  then
+                    v2 + (step68 b a) + v2
+                  else
+                    (step142 a v2) - a
+              else
+                case b `mod` 3 of
+                  0 ->
+                    v2 + a
+                  _ ->
+                    3 - a + (step82 v2 v2)
+          _ ->
+            let v3 = (step142 v2 a)
+            in
+              a
+    else
+      let v2 = 60 * 77
+      in
+        88
+
+-- step170: generated
+step170 :: Int -> Int -> Int
+step170 a b =
+  let v2 = 36 + a
+  in
+    if v2 > 93
+      then
+        if a > 59
+          then
+            a * v2
+          else
+            let v3 = 28 + 3
+            in
+              if v2 > 68
+                then
+                  (step89 v2 b) - 10
+                else
+                  v3 * v3 * a
+      else
+        case b `mod` 3 of
+          0 ->
+            let v3 = 92 - b
+            in
+              40 + v3 + 15
+          _ ->
+            let v3 = 28
+            in
+              47 * 37 - 10
+
+-- step171: generated
+step171 :: Int -> Int
+step171 a =
+  case a `mod` 3 of
+    0 ->
+      let v1 = a + a
+      in
+        a * v1 + (step56 v1 a)
+    _ ->
+      (step32 a a) + a
+
+-- step172: generated
+step172 :: Int -> Int -> Int
+step172 a b =
+  if a == 70
+    then
+      b + a * b
+    else
+      a * a - 66
+
+-- step173: generated
+step173 :: Int -> Int -> Int
+step173 a b =
+  let v2 = 85 + b
+  in
+    case b `mod` 3 of
+      0 ->
+        a - (step96 b)
+      _ ->
+        if v2 == 0
+          then
+            let v3 = 67 * 98
+            in
+              let v4 = 76
+              in
+                (step154 v3 v4)
+          else
+            case a `mod` 3 of
+              0 ->
+                case v2 `mod` 3 of
+                  0 ->
+                    a
+                  _ ->
+                    (step111 b)
+              _ ->
+                if v2 == 34
+                  then
+                    b - 93 + a
+                  else
+                    v2 + a * a
+
+-- step174: generated
+step174 :: Int -> Int
+step174 a =
+  let v1 = a - a - 20
+  in
+    case a `mod` 3 of
+      0 ->
+        case v1 `mod` 3 of
+          0 ->
+            let v2 = a - v1
+            in
+              let v3 = v2
+              in
+                92
+          _ ->
+            let v2 = v1 * v1
+            in
+              let v3 = v2
+              in
+                68 + v3 - (step116 v2 v1)
+      _ ->
+        let v2 = 45 * 9
+        in
+          case v1 `mod` 3 of
+            0 ->
+              if v1 < 66
+                then
+                  60 * 83
+                else
+                  16
+            _ ->
+              let v3 = v1
+              in
+                34 + v3
+
+-- step175: generated
+step175 :: Int -> Int -> Int
+step175 a b =
+  case b `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          let v2 = 81 * 13
+          in
+            a * a
+        _ ->
+          let v2 = 88 + a
+          in
+            if a == 48
+              then
+                if b < 40
+                  then
+                    b * 29 + 52
+                  else
+                    57 + 91
+              else
+                68 + v2
+    _ ->
+      if b > 11
+        then
+          if b > 4
+            then
+              84
+            else
+              let v2 = (step52 a a)
+              in
+                let v3 = a * a - v2
+                in
+                  v3
+        else
+          case b `mod` 3 of
+            0 ->
+              case b `mod` 3 of
+                0 ->
+                  case b `mod` 3 of
+                    0 ->
+                      43 * (step161 a a) + b
+                    _ ->
+                      a
+                _ ->
+                  b
+            _ ->
+              95 - 32
+
+-- step176: generated
+step176 :: Int -> Int -> Int
+step176 a b =
+  let v2 = b - 50 + 77
+  in
+    71
+
+-- step177: generated
+step177 :: Int -> Int
+step177 a =
+  case a `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          let v1 = 58 * a + 94
+          in
+            a - a * a
+        _ ->
+          let v1 = 29 + a * 71
+          in
+            v1 - a
+    _ ->
+      a * a * a
+
+-- step178: generated
+step178 :: Int -> Int -> Int
+step178 a b =
+  if b < 10
+    then
+      if a > 64
+        then
+          81
+        else
+          case b `mod` 3 of
+            0 ->
+              b
+            _ ->
+              39 - a
+    else
+      let v2 = 26 - a * a
+      in
+        let v3 = v2
+        in
+          v3 * v2 + (step37 a v3)
+
+-- step179: generated
+step179 :: Int -> Int -> Int
+step179 a b =
+  let v2 = b
+  in
+    if b < 52
+      then
+        (step34 a b) - a
+      else
+        v2
+
+-- step180: generated
+step180 :: Int -> Int
+step180 a =
+  76 + 95 + a
+
+-- step181: generated
+step181 :: Int -> Int -> Int
+step181 a b =
+  if a < 79
+    then
+      case a `mod` 3 of
+        0 ->
+          59 - b + 49
+        _ ->
+          a * b
+    else
+      if b > 57
+        then
+          let v2 = b
+          in
+            let v3 = v2 * 1 * a
+            in
+              let v4 = (step10 v3 v2) - (step3 v3) * (step74 v3 v2)
+              in
+                55
+        else
+          if b == 50
+            then
+              if b == 22
+                then
+                  let v2 = a + 93 * 67
+                  in
+                    94 - 2
+                else
+                  if a > 43
+                    then
+                      a - b
+                    else
+                      a
+            else
+              let v2 = 39
+              in
+                case v2 `mod` 3 of
+                  0 ->
+                    30 + a
+                  _ ->
+                    24
+
+-- step182: generated
+step182 :: Int -> Int -> Int
+step182 a b =
+  35
+
+-- step183: generated
+step183 :: Int -> Int
+step183 a =
+  65
+
+-- step184: generated
+step184 :: Int -> Int -> Int
+step184 a b =
+  a * (step148 b b) * a
+
+-- step185: generated
+step185 :: Int -> Int -> Int
+step185 a b =
+  let v2 = 21 - b
+  in
+    let v3 = (step40 v2 b) - a
+    in
+      b - (step141 b)
+
+-- step186: generated
+step186 :: Int -> Int
+step186 a =
+  case a `mod` 3 of
+    0 ->
+      if a == 94
+        then
+          case a `mod` 3 of
+            0 ->
+              case a `mod` 3 of
+                0 ->
+                  case a `mod` 3 of
+                    0 ->
+                      a + a + a
+                    _ ->
+                      (step60 a) - 78 + a
+                _ ->
+                  a
+            _ ->
+              a
+        else
+          (step16 a a) - (step163 a a)
+    _ ->
+      if a == 80
+        then
+          a * a
+        else
+          case a `mod` 3 of
+            0 ->
+              if a < 90
+                then
+                  let v1 = 31
+                  in
+                    (step140 v1 v1) - v1 + (step138 v1)
+                else
+                  let v1 = a
+                  in
+                    v1
+            _ ->
+              let v1 = 99 - 23
+              in
+                case v1 `mod` 3 of
+                  0 ->
+                    a - (step90 a) * v1
+                  _ ->
+                    v1 - 69 - v1
+
+-- step187: generated
+step187 :: Int -> Int -> Int
+step187 a b =
+  let v2 = a
+  in
+    (step56 b b)
+
+-- step188: generated
+step188 :: Int -> Int -> Int
+step188 a b =
+  let v2 = a
+  in
+    if v2 > 76
+      then
+        let v3 = 37
+        in
+          let v4 = a - (step43 v3 b) + (step76 a a)
+          in
+            let v5 = (step128 v2 b) - v3 + 88
+            in
+              v4 - 96 + 11
+      else
+        let v3 = 6 * v2
+        in
+          case a `mod` 3 of
+            0 ->
+              let v4 = v3 + 35
+              in
+                b - v4
+            _ ->
+              if a == 15
+                then
+                  (step18 a) - 85
+                else
+                  a - b - (step67 b v2)
+
+-- step189: generated
+step189 :: Int -> Int
+step189 a =
+  a - (step137 a a)
+
+-- step190: generated
+step190 :: Int -> Int -> Int
+step190 a b =
+  case b `mod` 3 of
+    0 ->
+      let v2 = 5 - (step109 a b)
+      in
+        let v3 = 20 - v2 * 72
+        in
+          case a `mod` 3 of
+            0 ->
+              case b `mod` 3 of
+                0 ->
+                  89 - v2 + a
+                _ ->
+                  v2 - (step182 v3 a) - b
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  (step175 v2 a) + (step43 b v2)
+                _ ->
+                  v2 - (step7 v2 b) - v3
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          case a `mod` 3 of
+            0 ->
+              let v2 = a
+              in
+                let v3 = b * 33 + b
+                in
+                  94 + b
+            _ ->
+              if b > 95
+                then
+                  a + (step22 a b) * 1
+                else
+                  if b == 95
+                    then
+                      53 + 80
+                    else
+                      a + a - 55
+        _ ->
+          let v2 = 79 + (step127 b b) + a
+          in
+            let v3 = v2 * v2 + (step13 a b)
+            in
+              case v2 `mod` 3 of
+                0 ->
+                  19 - 53 - 33
+                _ ->
+                  (step93 b) - v3 + 23
+
+-- step191: generated
+step191 :: Int -> Int -> Int
+step191 a b =
+  if b > 17
+    then
+      let v2 = a
+      in
+        let v3 = 89 * v2
+        in
+          if v2 < 60
+            then
+              b - a
+            else
+              let v4 = 20
+              in
+                v4 * v3 - v3
+    else
+      30
+
+-- step192: generated
+step192 :: Int -> Int
+step192 a =
+  let v1 = 26 * a
+  in
+    if v1 > 67
+      then
+        case a `mod` 3 of
+          0 ->
+            if a > 83
+              then
+                let v2 = v1
+                in
+                  (step144 a) * a * a
+              else
+                v1 * 79 - a
+          _ ->
+            a + a
+      else
+        case a `mod` 3 of
+          0 ->
+            let v2 = 64 + a
+            in
+              let v3 = v1
+              in
+                a * 41 - 28
+          _ ->
+            case a `mod` 3 of
+              0 ->
+                (step44 a v1) * 9
+              _ ->
+                let v2 = a - a + v1
+                in
+                  v1 - (step184 v1 a) * a
+
+-- step193: generated
+step193 :: Int -> Int -> Int
+step193 a b =
+  case b `mod` 3 of
+    0 ->
+      let v2 = a
+      in
+        let v3 = (step46 v2 v2) * b
+        in
+          case b `mod` 3 of
+            0 ->
+              if a > 10
+                then
+                  v2
+                else
+                  65 + v2 + 52
+            _ ->
+              let v4 = (step39 a)
+              in
+                v3 + b
+    _ ->
+      (step56 a b) + (step187 a b) - 27
+
+-- step194: generated
+step194 :: Int -> Int -> Int
+step194 a b =
+  let v2 = b - (step22 b b) + b
+  in
+    (step47 v2 b) * 16 - 43
+
+-- step195: generated
+step195 :: Int -> Int
+step195 a =
+  22 * a + a
+
+-- step196: generated
+step196 :: Int -> Int -> Int
+step196 a b =
+  case b `mod` 3 of
+    0 ->
+      if b > 50
+        then
+          let v2 = a
+          in
+            27
+        else
+          if b > 67
+            then
+              let v2 = 81
+              in
+                let v3 = b
+                in
+                  v3 - (step48 a)
+            else
+              let v2 = b - a
+              in
+                (step146 b b) - v2 - 3
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          a - a
+        _ ->
+          if a == 48
+            then
+              if b < 19
+                then
+                  case b `mod` 3 of
+                    0 ->
+                      41 - 55 + (step96 a)
+                    _ ->
+                      a - a * b
+                else
+                  let v2 = a * 42
+                  in
+                    v2 - 41
+            else
+              let v2 = a
+              in
+                let v3 = (step143 v2 b)
+                in
+                  v2 + (step168 b)
+
+-- step197: generated
+step197 :: Int -> Int -> Int
+step197 a b =
+  if b < 46
+    then
+      91
+    else
+      a
+
+-- step198: generated
+step198 :: Int -> Int
+step198 a =
+  let v1 = a + a * a
+  in
+    case v1 `mod` 3 of
+      0 ->
+        case v1 `mod` 3 of
+          0 ->
+            let v2 = a
+            in
+              let v3 = v2 * 0 - (step92 v1 a)
+              in
+                44 * (step161 v2 a) - 57
+          _ ->
+            v1
+      _ ->
+        case v1 `mod` 3 of
+          0 ->
+            case a `mod` 3 of
+              0 ->
+                let v2 = v1 + v1 + v1
+                in
+                  (step117 v1) * 64 * v1
+              _ ->
+                let v2 = v1 + a
+                in
+                  65 - a
+          _ ->
+            case a `mod` 3 of
+              0 ->
+                if a > 12
+                  then
+                    a
+                  else
+                    a * (step40 v1 v1)
+              _ ->
+                let v2 = 66 - 40 + a
+                in
+                  79 - v2
+
+-- step199: generated
+step199 :: Int -> Int -> Int
+step199 a b =
+  if b > 53
+    then
+      let v2 = (step35 a b) + b * a
+      in
+        case v2 `mod` 3 of
+          0 ->
+            if b > 61
+              then
+                let v3 = 76
+                in
+                  a - a
+              else
+                if v2 == 84
+                  then
+                    (step89 v2 v2)
+                  else
+                    b
+          _ ->
+            if v2 < 99
+              then
+                case a `mod` 3 of
+                  0 ->
+                    b * b
+                  _ ->
+                    b + b + 39
+              else
+                76 + v2 + a
+    else
+      (step99 b) - (step21 b)
+
+main :: IO ()
+main = do
+  print (step195 65)
+  print (step196 58 73)
+  print (step197 70 10)
+  print (step198 25)
+  print (step199 42 56)
@@ -0,0 +1,807 @@
+module Main where
+
+-- step0: generated
+step0 :: Int -> Int
+step0 a =
+  let v1 = a
+  in
+    let v2 = 98 * 29 - 50
+    in
+      85 - 10 + v1
+
+-- step1: generated
+step1 :: Int -> Int -> Int
+step1 a b =
+  let v2 = (step0 a) - b * b
+  in
+    let v3 = a - v2 - (step0 b)
+    in
+      a + v3 - 10
+
+-- step2: generated
+step2 :: Int -> Int -> Int
+step2 a b =
+  if b == 74
+    then
+      case b `mod` 3 of
+        0 ->
+          34 + a
+        _ ->
+          a * 46 + b
+    else
+      60 + a * 40
+
+-- step3: generated
+step3 :: Int -> Int
+step3 a =
+  if a == 31
+    then
+      let v1 = a - a
+      in
+        (step0 v1) + 92 - a
+    else
+      72 * (step2 a a) * a
+
+-- step4: generated
+step4 :: Int -> Int -> Int
+step4 a b =
+  a
+
+-- step5: generated
+step5 :: Int -> Int -> Int
+step5 a b =
+  if a < 52
+    then
+      let v2 = (step1 a a) + 91 * b
+      in
+        a - 93
+    else
+      if a < 93
+        then
+          13 * 34
+        else
+          b - 73
+
+-- step6: generated
+step6 :: Int -> Int
+step6 a =
+  let v1 = a * a * a
+  in
+    39 - a - 51
+
+-- step7: generated
+step7 :: Int -> Int -> Int
+step7 a b =
+  case b `mod` 3 of
+    0 ->
+      a
+    _ ->
+      let v2 = b * (step1 a a)
+      in
+        (step4 b v2) * a * v2
+
+-- step8: generated
+step8 :: Int -> Int -> Int
+step8 a b =
+  let v2 = b - a * (step2 b b)
+  in
+    let v3 = a * b + 56
+    in
+      (step6 a) + v2
+
+-- step9: generated
+step9 :: Int -> Int
+step9 a =
+  if a < 6
+    then
+      if a < 59
+        then
+          76 * a - a
+        else
+          (step6 a) - a
+    else
+      23
+
+-- step10: generated
+step10 :: Int -> Int -> Int
+step10 a b =
+  let v2 = 28 - (step0 b)
+  in
+    6
+
+-- step11: generated
+step11 :: Int -> Int -> Int
+step11 a b =
+  if b == 61
+    then
+      if b > 79
+        then
+          43 - b
+        else
+          a
+    else
+      (step3 b) + b
+
+-- step12: generated
+step12 :: Int -> Int
+step12 a =
+  case a `mod` 3 of
+    0 ->
+      if a < 15
+        then
+          a
+        else
+          (step9 a)
+    _ ->
+      if a < 48
+        then
+          33
+        else
+          a - a - 19
+
+-- step13: generated
+step13 :: Int -> Int -> Int
+step13 a b =
+  let v2 = a + b + b
+  in
+    case a `mod` 3 of
+      0 ->
+        55
+      _ ->
+        55
+
+-- step14: generated
+step14 :: Int -> Int -> Int
+step14 a b =
+  b - 59
+
+-- step15: generated
+step15 :: Int -> Int
+step15 a =
+  case a `mod` 3 of
+    0 ->
+      let v1 = a + 72
+      in
+        v1 + v1
+    _ ->
+      if a == 8
+        then
+          25 - a
+        else
+          (step13 a a) + a
+
+-- step16: generated
+step16 :: Int -> Int -> Int
+step16 a b =
+  let v2 = 7 - 29
+  in
+    a * v2
+
+-- step17: generated
+step17 :: Int -> Int -> Int
+step17 a b =
+  if b == 52
+    then
+      a - a + b
+    else
+      let v2 = a - 69
+      in
+        54
+
+-- step18: generated
+step18 :: Int -> Int
+step18 a =
+  let v1 = a * (step8 a a) + a
+  in
+    case a `mod` 3 of
+      0 ->
+        v1 + 95 - 24
+      _ ->
+        25
+
+-- step19: generated
+step19 :: Int -> Int -> Int
+step19 a b =
+  case a `mod` 3 of
+    0 ->
+      (step14 a b) * (step2 a a)
+    _ ->
+      let v2 = a + a
+      in
+        a + 26
+
+-- step20: generated
+step20 :: Int -> Int -> Int
+step20 a b =
+  case b `mod` 3 of
+    0 ->
+      (step14 a b) + a
+    _ ->
+      case b `mod` 3 of
+        0 ->
+          (step0 a) + a
+        _ ->
+          b
+
+-- step21: generated
+step21 :: Int -> Int
+step21 a =
+  case a `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          a + 56
+        _ ->
+          (step2 a a) * 1
+    _ ->
+      let v1 = 82 - a
+      in
+        v1 - v1 + a
+
+-- step22: generated
+step22 :: Int -> Int -> Int
+step22 a b =
+  40 + a
+
+-- step23: generated
+step23 :: Int -> Int -> Int
+step23 a b =
+  case a `mod` 3 of
+    0 ->
+      let v2 = a
+      in
+        9 * b
+    _ ->
+      let v2 = 64 + b
+      in
+        a - 30
+
+-- step24: generated
+step24 :: Int -> Int
+step24 a =
+  if a == 75
+    then
+      if a == 33
+        then
+          42 + a
+        else
+          a * (step7 a a)
+    else
+      if a < 18
+        then
+          a
+        else
+          63 - 48 - a
+
+-- step25: generated
+step25 :: Int -> Int -> Int
+step25 a b =
+  67 * b + b
+
+-- step26: generated
+step26 :: Int -> Int -> Int
+step26 a b =
+  92
+
+-- step27: generated
+step27 :: Int -> Int
+step27 a =
+  a + (step17 a a)
+
+-- step28: generated
+step28 :: Int -> Int -> Int
+step28 a b =
+  51 * a
+
+-- step29: generated
+step29 :: Int -> Int -> Int
+step29 a b =
+  (step13 b a)
+
+-- step30: generated
+step30 :: Int -> Int
+step30 a =
+  a + (step29 a a)
+
+-- step31: generated
+step31 :: Int -> Int -> Int
+step31 a b =
+  66 * b
+
+-- step32: generated
+step32 :: Int -> Int -> Int
+step32 a b =
+  if a < 15
+    then
+      let v2 = b * a * b
+      in
+        b
+    else
+      let v2 = (step5 b a)
+      in
+        v2 - v2 + 36
+
+-- step33: generated
+step33 :: Int -> Int
+step33 a =
+  99
+
+-- step34: generated
+step34 :: Int -> Int -> Int
+step34 a b =
+  case a `mod` 3 of
+    0 ->
+      if b == 59
+        then
+          (step20 a b) * 28
+        else
+          b
+    _ ->
+      let v2 = b
+      in
+        a
+
+-- step35: generated
+step35 :: Int -> Int -> Int
+step35 a b =
+  if b == 81
+    then
+      68 - b + 36
+    else
+      let v2 = a - a
+      in
+        b
+
+-- step36: generated
+step36 :: Int -> Int
+step36 a =
+  if a > 52
+    then
+      if a == 12
+        then
+          62
+        else
+          a
+    else
+      case a `mod` 3 of
+        0 ->
+          a + 84 + 11
+        _ ->
+          a
+
+-- step37: generated
+step37 :: Int -> Int -> Int
+step37 a b =
+  case a `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          22
+        _ ->
+          (step13 a a) - b
+    _ ->
+      43 + a
+
+-- step38: generated
+step38 :: Int -> Int -> Int
+step38 a b =
+  72 + a - a
+
+-- step39: generated
+step39 :: Int -> Int
+step39 a =
+  let v1 = (step35 a a) - a * 30
+  in
+    v1 - 88 + a
+
+-- step40: generated
+step40 :: Int -> Int -> Int
+step40 a b =
+  if b < 50
+    then
+      14 + a
+    else
+      if a < 81
+        then
+          (step35 b b)
+        else
+          84 + b + a
+
+-- step41: generated
+step41 :: Int -> Int -> Int
+step41 a b =
+  (step29 a b) * a
+
+-- step42: generated
+step42 :: Int -> Int
+step42 a =
+  a
+
+-- step43: generated
+step43 :: Int -> Int -> Int
+step43 a b =
+  let v2 = 41
+  in
+    let v3 = (step23 b b)
+    in
+      25
+
+-- step44: generated
+step44 :: Int -> Int -> Int
+step44 a b =
+  19 - 28 - b
+
+-- step45: generated
+step45 :: Int -> Int
+step45 a =
+  case a `mod` 3 of
+    0 ->
+      let v1 = 92 - a
+      in
+        a
+    _ ->
+      40
+
+-- step46: generated
+step46 :: Int -> Int -> Int
+step46 a b =
+  if b > 24
+    then
+      if b == 48
+        then
+          a * (step12 a) * 8
+        else
+          74
+    else
+      a * 70 * a
+
+-- step47: generated
+step47 :: Int -> Int -> Int
+step47 a b =
+  case b `mod` 3 of
+    0 ->
+      let v2 = a * 21
+      in
+        64 * a + 51
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          82 - (step5 b a)
+        _ ->
+          69
+
+-- step48: generated
+step48 :: Int -> Int
+step48 a =
+  let v1 = (step37 a a) + a + a
+  in
+    case v1 `mod` 3 of
+      0 ->
+        v1 * a - (step21 a)
+      _ ->
+        17 * v1
+
+-- step49: generated
+step49 :: Int -> Int -> Int
+step49 a b =
+  case b `mod` 3 of
+    0 ->
+      let v2 = b * a * a
+      in
+        (step37 a b)
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          b + b
+        _ ->
+          b + b
+
+-- step50: generated
+step50 :: Int -> Int -> Int
+step50 a b =
+  if a > 41
+    then
+      case b `mod` 3 of
+        0 ->
+          b
+        _ ->
+          b * 72 * 69
+    else
+      b
+
+-- step51: generated
+step51 :: Int -> Int
+step51 a =
+  let v1 = 86
+  in
+    case v1 `mod` 3 of
+      0 ->
+        v1 - 61
+      _ ->
+        a * a
+
+-- step52: generated
+step52 :: Int -> Int -> Int
+step52 a b =
+  case a `mod` 3 of
+    0 ->
+      let v2 = a - (step15 b)
+      in
+        v2
+    _ ->
+      let v2 = a
+      in
+        b * 33
+
+-- step53: generated
+step53 :: Int -> Int -> Int
+step53 a b =
+  case a `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          24 + b * 6
+        _ ->
+          a + b
+    _ ->
+      let v2 = b * (step30 b) + 31
+      in
+        (step42 v2) + (step38 v2 b)
+
+-- step54: generated
+step54 :: Int -> Int
+step54 a =
+  case a `mod` 3 of
+    0 ->
+      let v1 = a * a + a
+      in
+        v1 * v1
+    _ ->
+      let v1 = (step10 a a)
+      in
+        55 - 92
+
+-- step55: generated
+step55 :: Int -> Int -> Int
+step55 a b =
+  let v2 = 22 - a - (step32 b b)
+  in
+    let v3 = (step9 v2) - b
+    in
+      95
+
+-- step56: generated
+step56 :: Int -> Int -> Int
+step56 a b =
+  b
+
+-- step57: generated
+step57 :: Int -> Int
+step57 a =
+  case a `mod` 3 of
+    0 ->
+      let v1 = a
+      in
+        v1 - (step38 v1 v1)
+    _ ->
+      let v1 = (step42 a) - a - (step21 a)
+      in
+        a
+
+-- step58: generated
+step58 :: Int -> Int -> Int
+step58 a b =
+  85
+
+-- step59: generated
+step59 :: Int -> Int -> Int
+step59 a b =
+  if b > 1
+    then
+      if b < 55
+        then
+          b
+        else
+          77 - (step23 a a)
+    else
+      case b `mod` 3 of
+        0 ->
+          33
+        _ ->
+          b * b - (step34 b b)
+
+-- step60: generated
+step60 :: Int -> Int
+step60 a =
+  a + a
+
+-- step61: generated
+step61 :: Int -> Int -> Int
+step61 a b =
+  if a > 99
+    then
+      b + (step31 a b) + b
+    else
+      b
+
+-- step62: generated
+step62 :: Int -> Int -> Int
+step62 a b =
+  if b > 3
+    then
+      if a == 93
+        then
+          (step19 a b) - (step31 a a) + (step23 b b)
+        else
+          b + b
+    else
+      b
+
+-- step63: generated
+step63 :: Int -> Int
+step63 a =
+  a
+
+-- step64: generated
+step64 :: Int -> Int -> Int
+step64 a b =
+  a * 7
+
+-- step65: generated
+step65 :: Int -> Int -> Int
+step65 a b =
+  case a `mod` 3 of
+    0 ->
+      case b `mod` 3 of
+        0 ->
+          67
+        _ ->
+          5 * 70 - a
+    _ ->
+      a * 93 - a
+
+-- step66: generated
+step66 :: Int -> Int
+step66 a =
+  if a == 5
+    then
+      80 - (step16 a a)
+    else
+      let v1 = a + 88
+      in
+        a * a
+
+-- step67: generated
+step67 :: Int -> Int -> Int
+step67 a b =
+  case a `mod` 3 of
+    0 ->
+      let v2 = 20
+      in
+        b
+    _ ->
+      if b > 97
+        then
+          b * (step11 b b)
+        else
+          a
+
+-- step68: generated
+step68 :: Int -> Int -> Int
+step68 a b =
+  a - b - 80
+
+-- step69: generated
+step69 :: Int -> Int
+step69 a =
+  a + a
+
+-- step70: generated
+step70 :: Int -> Int -> Int
+step70 a b =
+  a * 15
+
+-- step71: generated
+step71 :: Int -> Int -> Int
+step71 a b =
+  73 - 8 + 20
+
+-- step72: generated
+step72 :: Int -> Int
+step72 a =
+  let v1 = a - 5
+  in
+    if v1 == 14
+      then
+        23
+      else
+        a + v1 + a
+
+-- step73: generated
+step73 :: Int -> Int -> Int
+step73 a b =
+  if b < 78
+    then
+      let v2 = 31 + 87 * (step30 a)
+      in
+        60 + v2 + 31
+    else
+      let v2 = (step26 b a) + (step13 a a)
+      in
+        43
+
+-- step74: generated
+step74 :: Int -> Int -> Int
+step74 a b =
+  case b `mod` 3 of
+    0 ->
+      let v2 = b * (step4 b b) + a
+      in
+        97 - b * a
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          38 - (step46 a b) + 21
+        _ ->
+          a
+
+-- step75: generated
+step75 :: Int -> Int
+step75 a =
+  let v1 = 47
+  in
+    case v1 `mod` 3 of
+      0 ->
+        v1 * a
+      _ ->
+        v1 * (step18 a) * v1
+
+-- step76: generated
+step76 :: Int -> Int -> Int
+step76 a b =
+  if b < 63
+    then
+      a * 54
+    else
+      b
+
+-- step77: generated
+step77 :: Int -> Int -> Int
+step77 a b =
+  case a `mod` 3 of
+    0 ->
+      let v2 = b - 85
+      in
+        35
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          b + a
+        _ ->
+          40
+
+-- step78: generated
+step78 :: Int -> Int
+step78 a =
+  let v1 = 65 + a
+  in
+    a * v1
+
+-- step79: generated
+step79 :: Int -> Int -> Int
+step79 a b =
+  if b < 95
+    then
+      99
+    else
+      let v2 = a
+      in
+        63 * 9 + 3
+
+main :: IO ()
+main = do
+  print (step75 77)
+  print (step76 3 49)
+  print (step77 82 11)
+  print (step78 36)
+  print (step79 69 27)
@@ -0,0 +1,816 @@
+module Main where
+
+-- step0: generated
+step0 :: Int -> Int
+step0 a =
+  45
+
+-- step1: generated
+step1 :: Int -> Int -> Int
+step1 a b =
+  case a `mod` 3 of
+    0 ->
+      if b > 25
+        then
+          if a == 86
+            then
+              if a > 66
+                then
+                  (step0 a) * a
+                else
+                  case a `mod` 3 of
+                    0 ->
+                      a + 0
+                    _ ->
+                      63
+            else
+              case b `mod` 3 of
+                0 ->
+                  if a < 94
+                    then
+                      (step0 b) * a + a
+                    else
+                      a + (step0 b) + 77
+                _ ->
+                  b - a + 27
+        else
+          case b `mod` 3 of
+            0 ->
+              25 + b
+            _ ->
+              39
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          if a == 36
+            then
+              13
+            else
+              let v2 = 30 * (step0 a)
+              in
+                a * (step0 b)
+        _ ->
+          b * a
+
+-- step2: generated
+step2 :: Int -> Int -> Int
+step2 a b =
+  (step1 a b) + (step0 a) - b
+
+-- step3: generated
+step3 :: Int -> Int
+step3 a =
+  (step2 a a) * a
+
+-- step4: generated
+step4 :: Int -> Int -> Int
+step4 a b =
+  (step1 b b) + b - 1
+
+-- step5: generated
+step5 :: Int -> Int -> Int
+step5 a b =
+  case a `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          let v2 = 59 - 23
+          in
+            case a `mod` 3 of
+              0 ->
+                a * v2 * 56
+              _ ->
+                if b == 85
+                  then
+                    18
+                  else
+                    (step4 a a) + 94 * v2
+        _ ->
+          (step3 b) + a
+    _ ->
+      let v2 = a * b + (step0 a)
+      in
+        let v3 = (step1 b a) - 3 + a
+        in
+          a + a
+
+-- step6: generated
+step6 :: Int -> Int
+step6 a =
+  if a == 28
+    then
+      a
+    else
+      case a `mod` 3 of
+        0 ->
+          a * 5 - (step5 a a)
+        _ ->
+          a * (step4 a a) + (step0 a)
+
+-- step7: generated
+step7 :: Int -> Int -> Int
+step7 a b =
+  case a `mod` 3 of
+    0 ->
+      if b == 26
+        then
+          case b `mod` 3 of
+            0 ->
+              28 - 81 * (step0 b)
+            _ ->
+              let v2 = 1 * b
+              in
+                if a > 81
+                  then
+                    73 - a - 67
+                  else
+                    (step1 v2 v2) - 97 - b
+        else
+          if b < 35
+            then
+              case b `mod` 3 of
+                0 ->
+                  b - (step2 a a)
+                _ ->
+                  33
+            else
+              (step6 a)
+    _ ->
+      (step6 b) * a
+
+-- step8: generated
+step8 :: Int -> Int -> Int
+step8 a b =
+  13 * b * 57
+
+-- step9: generated
+step9 :: Int -> Int
+step9 a =
+  a - 49 - 38
+
+-- step10: generated
+step10 :: Int -> Int -> Int
+step10 a b =
+  case a `mod` 3 of
+    0 ->
+      if a > 87
+        then
+          if b == 46
+            then
+              case b `mod` 3 of
+                0 ->
+                  let v2 = 49
+                  in
+                    35 - (step4 v2 a)
+                _ ->
+                  let v2 = (step5 b a)
+                  in
+                    (step1 a a)
+            else
+              let v2 = 61
+              in
+                case v2 `mod` 3 of
+                  0 ->
+                    b
+                  _ ->
+                    (step8 b v2) * (step5 v2 v2)
+        else
+          if a < 83
+            then
+              if a == 40
+                then
+                  let v2 = b
+                  in
+                    46 + 63
+                else
+                  let v2 = a * b + b
+                  in
+                    v2 + v2 - v2
+            else
+              if b == 39
+                then
+                  (step5 b a)
+                else
+                  if b > 5
+                    then
+                      a + 91
+                    else
+                      b
+    _ ->
+      let v2 = 75
+      in
+        case a `mod` 3 of
+          0 ->
+            a * v2
+          _ ->
+            let v3 = b + (step8 a v2) - a
+            in
+              b
+
+-- step11: generated
+step11 :: Int -> Int -> Int
+step11 a b =
+  b
+
+-- step12: generated
+step12 :: Int -> Int
+step12 a =
+  if a > 70
+    then
+      case a `mod` 3 of
+        0 ->
+          case a `mod` 3 of
+            0 ->
+              if a > 24
+                then
+                  a + 4 + 84
+                else
+                  (step2 a a) - (step4 a a)
+            _ ->
+              case a `mod` 3 of
+                0 ->
+                  let v1 = 35 - 23
+                  in
+                    (step5 v1 v1) - a - 31
+                _ ->
+                  let v1 = (step8 a a) - a
+                  in
+                    v1 * 24 + v1
+        _ ->
+          let v1 = 5 + (step8 a a)
+          in
+            if a == 30
+              then
+                case v1 `mod` 3 of
+                  0 ->
+                    v1 * v1 * 65
+                  _ ->
+                    v1 - 75
+              else
+                v1 - 2
+    else
+      a + (step2 a a) + a
+
+-- step13: generated
+step13 :: Int -> Int -> Int
+step13 a b =
+  case b `mod` 3 of
+    0 ->
+      case a `mod` 3 of
+        0 ->
+          b
+        _ ->
+          let v2 = 33 * 20
+          in
+            let v3 = 63 - (step8 v2 v2)
+            in
+              case a `mod` 3 of
+                0 ->
+                  (step3 b) * v2
+                _ ->
+                  (step3 v2) * (step1 a b)
+    _ ->
+      let v2 = b + (step10 b a)
+      in
+        let v3 = v2
+        in
+          let v4 = (step0 v2)
+          in
+            if b == 62
+              then
+                13 - 21
+              else
+                b - v4
+
+-- step14: generated
+step14 :: Int -> Int -> Int
+step14 a b =
+  if a == 50
+    then
+      32 * (step7 b b) - (step4 b a)
+    else
+      case b `mod` 3 of
+        0 ->
+          if a > 7
+            then
+              b + (step3 b)
+            else
+              b * 50
+        _ ->
+          (step3 b)
+
+-- step15: generated
+step15 :: Int -> Int
+step15 a =
+  let v1 = (step6 a) - a * 54
+  in
+    case v1 `mod` 3 of
+      0 ->
+        case v1 `mod` 3 of
+          0 ->
+            a
+          _ ->
+            case v1 `mod` 3 of
+              0 ->
+                v1
+              _ ->
+                let v2 = v1
+                in
+                  v2
+      _ ->
+        let v2 = (step7 a a) + a * 25
+        in
+          if v1 < 6
+            then
+              if v2 < 41
+                then
+                  a * a * v2
+                else
+                  v1 * v2 * v2
+            else
+              case v1 `mod` 3 of
+                0 ->
+                  (step1 a a) - v2 + (step9 v1)
+                _ ->
+                  v2 * a
+
+-- step16: generated
+step16 :: Int -> Int -> Int
+step16 a b =
+  let v2 = (step10 a b)
+  in
+    (step13 b v2) * 7 * (step10 a a)
+
+-- step17: generated
+step17 :: Int -> Int -> Int
+step17 a b =
+  let v2 = b + 8
+  in
+    (step9 v2)
+
+-- step18: generated
+step18 :: Int -> Int
+step18 a =
+  case a `mod` 3 of
+    0 ->
+      if a < 98
+        then
+          let v1 = 33 * (step3 a) * 97
+          in
+            let v2 = 60
+            in
+              v1 + 68
+        else
+          case a `mod` 3 of
+            0 ->
+              48 * 68
+            _ ->
+              if a == 71
+                then
+                  case a `mod` 3 of
+                    0 ->
+                      a
+                    _ ->
+                      a * a
+                else
+                  let v1 = a
+                  in
+                    11 + a * (step16 a v1)
+    _ ->
+      94
+
+-- step19: generated
+step19 :: Int -> Int -> Int
+step19 a b =
+  let v2 = 26 + 21 + b
+  in
+    case v2 `mod` 3 of
+      0 ->
+        let v3 = b + a - a
+        in
+          if b < 53
+            then
+              let v4 = 70
+              in
+                55
+            else
+              if v2 > 13
+                then
+                  b
+                else
+                  68 - v3
+      _ ->
+        26 - b
+
+-- step20: generated
+step20 :: Int -> Int -> Int
+step20 a b =
+  case a `mod` 3 of
+    0 ->
+      if b == 96
+        then
+          a + 20 + a
+        else
+          let v2 = 25
+          in
+            let v3 = a
+            in
+              let v4 = 84 + (step13 v3 a) * 65
+              in
+                74
+    _ ->
+      case b `mod` 3 of
+        0 ->
+          case a `mod` 3 of
+            0 ->
+              let v2 = a
+              in
+                let v3 = (step9 a) * b
+                in
+                  a + (step19 v2 v2) + a
+            _ ->
+              let v2 = a * 38
+              in
+                if b < 66
+                  then
+                    a - a + 13
+                  else
+                    b
+        _ ->
+          65
+
+-- step21: generated
+step21 :: Int -> Int
+step21 a =
+  if a > 91
+    then
+      if a < 25
+        then
+          a
+        else
+          if a < 86
+            then
+              13 + 38 + a
+            else
+              let v1 = a - a
+              in
+                let v2 = v1 + 7 * 2
+                in
+                  a + v1
+    else
+      a
+
+-- step22: generated
+step22 :: Int -> Int -> Int
+step22 a b =
+  b * (step20 b a) + a
+
+-- step23: generated
+step23 :: Int -> Int -> Int
+step23 a b =
+  4 * b
+
+-- step24: generated
+step24 :: Int -> Int
+step24 a =
+  case a `mod` 3 of
+    0 ->
+      a - 79
+    _ ->
+      let v1 = 29 * a
+      in
+        a
+
+-- step25: generated
+step25 :: Int -> Int -> Int
+step25 a b =
+  if a == 96
+    then
+      case a `mod` 3 of
+        0 ->
+          24
+        _ ->
+          if b < 5
+            then
+              let v2 = a + a + 58
+              in
+                if b > 24
+                  then
+                    61
+                  else
+                    (step8 v2 a) * (step15 b)
+            else
+              let v2 = 17 + a
+              in
+                v2
+    else
+      59 - (step1 a b)
+
+-- step26: generated
+step26 :: Int -> Int -> Int
+step26 a b =
+  let v2 = a * (step19 b b)
+  in
+    case v2 `mod` 3 of
+      0 ->
+        let v3 = 79
+        in
+          case v3 `mod` 3 of
+            0 ->
+              case v3 `mod` 3 of
+                0 ->
+                  84
+                _ ->
+                  29
+            _ ->
+              case v3 `mod` 3 of
+                0 ->
+                  v2
+                _ ->
+                  94
+      _ ->
+        let v3 = b * 50
+        in
+          let v4 = (step13 a b) + 68
+          in
+            if a < 69
+              then
+                a
+              else
+                v2 * (step9 b)
+
+-- step27: generated
+step27 :: Int -> Int
+step27 a =
+  case a `mod` 3 of
+    0 ->
+      let v1 = 30 + a * 20
+      in
+        if a > 20
+          then
+            if v1 < 67
+              then
+                let v2 = v1 * a
+                in
+                  v1 - v1
+              else
+                if v1 > 97
+                  then
+                    (step0 v1) + (step15 v1) * 53
+                  else
+                    a
+          else
+            a
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          let v1 = a + a + (step13 a a)
+          in
+            case a `mod` 3 of
+              0 ->
+                if v1 > 70
+                  then
+                    v1
+                  else
+                    v1
+              _ ->
+                v1
+        _ ->
+          47 * a * a
+
+-- step28: generated
+step28 :: Int -> Int -> Int
+step28 a b =
+  if b == 51
+    then
+      b * a
+    else
+      case b `mod` 3 of
+        0 ->
+          case b `mod` 3 of
+            0 ->
+              let v2 = 79
+              in
+                let v3 = b
+                in
+                  (step15 v2) - a
+            _ ->
+              let v2 = a * b * 63
+              in
+                case v2 `mod` 3 of
+                  0 ->
+                    b * v2 * 22
+                  _ ->
+                    a
+        _ ->
+          let v2 = (step24 b) * (step11 b a) + a
+          in
+            if v2 > 82
+              then
+                if v2 < 54
+                  then
+                    v2 * b
+                  else
+                    (step13 v2 v2) + a - 71
+              else
+                78 - a + b
+
+-- step29: generated
+step29 :: Int -> Int -> Int
+step29 a b =
+  a - (step17 b b) - b
+
+-- step30: generated
+step30 :: Int -> Int
+step30 a =
+  if a == 87
+    then
+      56
+    else
+      a
+
+-- step31: generated
+step31 :: Int -> Int -> Int
+step31 a b =
+  case a `mod` 3 of
+    0 ->
+      a + 29 + b
+    _ ->
+      case a `mod` 3 of
+        0 ->
+          let v2 = (step21 a)
+          in
+            if v2 == 67
+              then
+                let v3 = 10 * (step28 a a)
+                in
+                  v3 - 66
+              else
+                if b < 30
+                  then
+                    v2
+                  else
+                    a - a * 0
+        _ ->
+          a + 27
+
+-- step32: generated
+step32 :: Int -> Int -> Int
+step32 a b =
+  if a > 92
+    then
+      if a > 88
+        then
+          case a `mod` 3 of
+            0 ->
+              if a == 80
+                then
+                  if b == 45
+                    then
+                      (step23 b a)
+                    else
+                      a
+                else
+                  if a == 97
+                    then
+                      4 - a
+                    else
+                      80
+            _ ->
+              if b > 91
+                then
+                  let v2 = b + a + 84
+                  in
+                    b * v2 - 11
+                else
+                  if a > 45
+                    then
+                      b - (step17 a b) - (step18 a)
+                    else
+                      b
+        else
+          let v2 = 1
+          in
+            let v3 = 70
+            in
+              case a `mod` 3 of
+                0 ->
+                  v3
+                _ ->
+                  50 - 45
+    else
+      let v2 = a * a
+      in
+        (step7 a a) * v2 + v2
+
+-- step33: generated
+step33 :: Int -> Int
+step33 a =
+  a * a
+
+-- step34: generated
+step34 :: Int -> Int -> Int
+step34 a b =
+  case a `mod` 3 of
+    0 ->
+      22
+    _ ->
+      let v2 = b
+      in
+        case a `mod` 3 of
+          0 ->
+            if v2 > 64
+              then
+                v2 * 27
+              else
+                if a > 38
+                  then
+                    b * 38
+                  else
+                    99 * v2 + 12
+          _ ->
+            let v3 = 70 * 42
+            in
+              case v2 `mod` 3 of
+                0 ->
+                  97 * 70
+                _ ->
+                  a
+
+-- step35: generated
+step35 :: Int -> Int -> Int
+step35 a b =
+  let v2 = a - b + b
+  in
+    let v3 = 20
+    in
+      v2 + 9
+
+-- step36: generated
+step36 :: Int -> Int
+step36 a =
+  a
+
+-- step37: generated
+step37 :: Int -> Int -> Int
+step37 a b =
+  let v2 = b
+  in
+    82 - a * 99
+
+-- step38: generated
+step38 :: Int -> Int -> Int
+step38 a b =
+  case a `mod` 3 of
+    0 ->
+      82 * b
+    _ ->
+      case b `mod` 3 of
+        0 ->
+          let v2 = 40 * b * (step19 b a)
+          in
+            case b `mod` 3 of
+              0 ->
+                case a `mod` 3 of
+                  0 ->
+                    b * (step11 b v2)
+                  _ ->
+                    a + 77 + 48
+              _ ->
+                b
+        _ ->
+          case b `mod` 3 of
+            0 ->
+              case b `mod` 3 of
+                0 ->
+                  let v2 = 99 + 22 * 92
+                  in
+                    b
+                _ ->
+                  if b == 37
+                    then
+                      b
+                    else
+                      57 * (step37 a a) + (step15 a)
+            _ ->
+              if a == 36
+                then
+                  case a `mod` 3 of
+                    0 ->
+                      b * b
+                    _ ->
+                      a - b
+                else
+                  case b `mod` 3 of
+                    0 ->
+                      a + a + a
+                    _ ->
+                      (step31 b b) * (step2 a b)
+
+main :: IO ()
+main = do
+  print (step34 46 72)
+  print (step35 11 73)
+  print (step36 26)
+  print (step37 78 14)
+  print (step38 20 46)
@@ -0,0 +1,925 @@
+module Main where
+
+-- step0: generated
+step0 :: Int -> Int
+step0 a =
+  let v1 = 8 + a - a
+  in
+    case a `mod` 3 of
+      0 ->
+        if v1 > 73
+          then
+            let v2 = v1
+            in
+              if v2 < 60
+                then
+                  case a `mod` 3 of
+                    0 ->
+                      a
+                    _ ->
+                      case v1 `mod` 3 of
+                        0 ->
+                          let v3 = 68
+                          in
+                            v1 + 96
+                        _ ->
+                          case a `mod` 3 of
+                            0 ->
+                              let v3 = v1
+                              in
+                                v1 * v2
+                            _ ->
+                              if v1 > 80
+                                then
+                                  42 * 85 * v1
+                                else
+                                  v2
+                else
+                  v2 + v1 - a
+          else
+            case a `mod` 3 of
+              0 ->
+                case a `mod` 3 of
+                  0 ->
+                    73
+                  _ ->
+                    if v1 < 1
+                      then
+                        case a `mod` 3 of
+                          0 ->
+                            case a `mod` 3 of
+                              0 ->
+                                if a < 32
+                                  then
+                                    v1 * a
+                                  else
+                                    16
+                              _ ->
+                                v1 * 30
+                          _ ->
+                            let v2 = 17 + 80 * 34
+                            in
+                              if v2 < 78
+                                then
+                                  v2 - a * v1
+                                else
+                                  a - a
+                      else
+                        8 * 45
+              _ ->
+                if a > 24
+                  then
+                    case v1 `mod` 3 of
+                      0 ->
+                        v1 + a * 46
+                      _ ->
+                        let v2 = v1 - a
+                        in
+                          if a == 13
+                            then
+                              let v3 = 34 + 54
+                              in
+                                71 - v1 - 84
+                            else
+                              case a `mod` 3 of
+                                0 ->
+                                  v1 + a * v1
+                                _ ->
+                                  56 + 81
+                  else
+                    case v1 `mod` 3 of
+                      0 ->
+                        if a > 53
+                          then
+                            case a `mod` 3 of
+                              0 ->
+                                if v1 == 12
+                                  then
+                                    v1
+                                  else
+                                    a * v1
+                              _ ->
+                                let v2 = v1
+                                in
+                                  a
+                          else
+                            if v1 < 43
+                              then
+                                if a > 11
+                                  then
+                                    v1 - 42
+                                  else
+                                    v1 + 72 * 78
+                              else
+                                case v1 `mod` 3 of
+                                  0 ->
+                                    77 - a
+                                  _ ->
+                                    v1
+                      _ ->
+                        a
+      _ ->
+        a - 72 - 75
+
+-- step1: generated
+step1 :: Int -> Int -> Int
+step1 a b =
+  b * 24
+
+-- step2: generated
+step2 :: Int -> Int -> Int
+step2 a b =
+  if a < 17
+    then
+      case a `mod` 3 of
+        0 ->
+          1
+        _ ->
+          42 - a
+    else
+      case b `mod` 3 of
+        0 ->
+          (step1 b a) + 75
+        _ ->
+          a + b * 7
+
+-- step3: generated
+step3 :: Int -> Int
+step3 a =
+  case a `mod` 3 of
+    0 ->
+      if a > 28
+        then
+          (step0 a)
+        else
+          (step2 a a) * a
+    _ ->
+      let v1 = (step1 a a) * 67
+      in
+        if a > 85
+          then
+            case v1 `mod` 3 of
+              0 ->
+                let v2 = 23 * 45
+                in
+                  case v1 `mod` 3 of
+                    0 ->
+                      a * (step1 v2 v2)
+                    _ ->
+                      if v2 == 41
+                        then
+                          let v3 = 5 + 46
+                          in
+                            v2
+                        else
+                          let v3 = v1 - a + 96
+                          in
+                            v1 - v3 + (step0 v2)
+              _ ->
+                v1 + 80 * v1
+          else
+            if a < 68
+              then
+                let v2 = (step0 v1)
+                in
+                  v2 * v2 + a
+              else
+                (step2 v1 a)
+
+-- step4: generated
+step4 :: Int -> Int -> Int
+step4 a b =
+  let v2 = a - (step0 a)
+  in
+    b * a + b
+
+-- step5: generated
+step5 :: Int -> Int -> Int
+step5 a b =
+  if a > 50
+    then
+      let v2 = b + (step1 a b)
+      in
+        let v3 = a
+        in
+          let v4 = 82 - 81 * v2
+          in
+            case b `mod` 3 of
+              0 ->
+                let v5 = 91 + a
+                in
+                  v2 + b
+              _ ->
+                a
+    else
+      case a `mod` 3 of
+        0 ->
+          let v2 = b
+          in
+            let v3 = v2
+            in
+              v3 - (step2 a b) * a
+        _ ->
+          case b `mod` 3 of
+            0 ->
+              case b `mod` 3 of
+                0 ->
+                  b
+                _ ->
+                  a - a
+            _ ->
+              73 * (step1 b a)
+
+-- step6: generated
+step6 :: Int -> Int
+step6 a =
+  if a == 95
+    then
+      case a `mod` 3 of
+        0 ->
+          case a `mod` 3 of
+            0 ->
+              if a == 18
+                then
+                  let v1 = a + a * a
+                  in
+                    if a == 68
+                      then
+                        if v1 < 14
+                          then
+                            let v2 = 59 - v1
+                            in
+                              case a `mod` 3 of
+                                0 ->
+                                  63
+                                _ ->
+                                  v1 - (step3 v2)
+                          else
+                            case a `mod` 3 of
+                              0 ->
+                                if v1 == 31
+                                  then
+                                    24
+                                  else
+                                    (step4 a v1) + a + (step2 v1 a)
+                              _ ->
+                                case v1 `mod` 3 of
+                                  0 ->
+                                    60 - v1
+                                  _ ->
+                                    39 - 24
+                      else
+                        let v2 = (step3 v1) - a
+                        in
+                          case v1 `mod` 3 of
+                            0 ->
+                              v1 - v2
+                            _ ->
+                              if v1 > 75
+                                then
+                                  4
+                                else
+                                  65 - (step0 v2)
+                else
+                  (step1 a a)
+            _ ->
+              if a < 84
+                then
+                  if a == 6
+                    then
+                      (step4 a a) - a + a
+                    else
+                      a + 35
+                else
+                  if a == 76
+                    then
+                      if a == 10
+                        then
+                          case a `mod` 3 of
+                            0 ->
+                              if a > 51
+                                then
+                                  case a `mod` 3 of
+                                    0 ->
+                                      5
+                                    _ ->
+                                      a
+                                else
+                                  (step5 a a) * a
+                            _ ->
+                              (step2 a a) + a
+                        else
+                          a - 56 * 89
+                    else
+                      case a `mod` 3 of
+                        0 ->
+                          if a == 89
+                            then
+                              if a < 5
+                                then
+                                  case a `mod` 3 of
+                                    0 ->
+                                      a + 13 + a
+                                    _ ->
+                                      26 * a - 0
+                                else
+                                  91
+                            else
+                              let v1 = 71
+                              in
+                                if a == 65
+                                  then
+                                    v1 + 64 * 20
+                                  else
+                                    a - 33
+                        _ ->
+                          let v1 = (step1 a a)
+                          in
+                            let v2 = 42 + a
+                            in
+                              if v2 > 74
+                                then
+                                  v1 - 90 - v2
+                                else
+                                  v2
+        _ ->
+          if a == 44
+            then
+              if a == 58
+                then
+                  let v1 = a - 90
+                  in
+                    let v2 = 91 + a - (step1 v1 a)
+                    in
+                      if a == 69
+                        then
+                          (step1 v2 a)
+                        else
+                          v1 * 55 * a
+                else
+                  68
+            else
+              if a == 35
+                then
+                  if a > 71
+                    then
+                      11 + a
+                    else
+                      case a `mod` 3 of
+                        0 ->
+                          a + 74
+                        _ ->
+                          case a `mod` 3 of
+                            0 ->
+                              let v1 = (step4 a a)
+                              in
+                                case v1 `mod` 3 of
+                                  0 ->
+                                    13
+                                  _ ->
+                                    v1 + 70 * a
+                            _ ->
+                              case a `mod` 3 of
+                                0 ->
+                                  let v1 = (step1 a a)
+                                  in
+                                    a - a - 77
+                                _ ->
+                                  case a `mod` 3 of
+                                    0 ->
+                                      60 - a
+                                    _ ->
+                                      a + a
+                else
+                  case a `mod` 3 of
+                    0 ->
+                      if a > 16
+                        then
+                          82 - a + a
+                        else
+                          let v1 = a
+                          in
+                            v1 - v1 * a
+                    _ ->
+                      if a < 20
+                        then
+                          (step2 a a)
+                        else
+                          case a `mod` 3 of
+                            0 ->
+                              a * 21 * a
+                            _ ->
+                              let v1 = 25 - (step3 a) * a
+                              in
+                                let v2 = (step5 v1 a) - a + 92
+                                in
+                                  v1 - 1
+    else
+      a * (step2 a a)
+
+-- step7: generated
+step7 :: Int -> Int -> Int
+step7 a b =
+  97 + a
+
+-- step8: generated
+step8 :: Int -> Int -> Int
+step8 a b =
+  let v2 = 30 - 20
+  in
+    if b > 35
+      then
+        a
+      else
+        let v3 = (step1 a v2) - 79 + 82
+        in
+          if v3 > 23
+            then
+              case v2 `mod` 3 of
+                0 ->
+                  a
+                _ ->
+                  if b < 91
+                    then
+                      case a `mod` 3 of
+                        0 ->
+                          if v3 > 49
+                            then
+                              let v4 = v2 + a
+                              in
+                                v2
+                            else
+                              if a < 87
+                                then
+                                  v3 * 81 * 98
+                                else
+                                  22 * 82
+                        _ ->
+                          let v4 = a * 7
+                          in
+                            a
+                    else
+                      v2 * v2
+            else
+              if b == 60
+                then
+                  let v4 = v3
+                  in
+                    let v5 = 58 - (step5 b v4)
+                    in
+                      case a `mod` 3 of
+                        0 ->
+                          if a < 14
+                            then
+                              50 + v4
+                            else
+                              61 + b
+                        _ ->
+                          v4 + a - v3
+                else
+                  if a > 35
+                    then
+                      if v3 < 50
+                        then
+                          let v4 = a
+                          in
+                            let v5 = (step7 a v4) - a
+                            in
+                              a * v3 + v2
+                        else
+                          a * 32 * 69
+                    else
+                      if b == 97
+                        then
+                          let v4 = b * 46 - 3
+                          in
+                            (step7 b v3) * a - 98
+                        else
+                          if v2 == 63
+                            then
+                              if a > 64
+                                then
+                                  24 * a * 65
+                                else
+                                  15
+                            else
+                              67 - 46
+
+-- step9: generated
+step9 :: Int -> Int
+step9 a =
+  a + a
+
+-- step10: generated
+step10 :: Int -> Int -> Int
+step10 a b =
+  if b < 92
+    then
+      if a == 41
+        then
+          let v2 = 34 + 2 + b
+          in
+            b * 35
+        else
+          let v2 = a * b
+          in
+            v2
+    else
+      case a `mod` 3 of
+        0 ->
+          case b `mod` 3 of
+            0 ->
+              if b == 54
+                then
+                  case a `mod` 3 of
+                    0 ->
+                      if b > 0
+                        then
+                          b * (step4 a b)
+                        else
+                          let v2 = b
+                          in
+                            if b == 33
+                              then
+                                if a > 2
+                                  then
+                                    a + (step7 a a) - b
+                                  else
+                                    a + a
+                              else
+                                let v3 = v2
+                                in
+                                  a
+                    _ ->
+                      case a `mod` 3 of
+                        0 ->
+                          if a < 86
+                            then
+                              case b `mod` 3 of
+                                0 ->
+                                  if b == 19
+                                    then
+                                      86 + b * b
+                                    else
+                                      69 * 63 - 12
+                                _ ->
+                                  a - a
+                            else
+                              if b < 95
+                                then
+                                  if b < 53
+                                    then
+                                      13 + b * a
+                                    else
+                                      91 + 92 * 70
+                                else
+                                  case a `mod` 3 of
+                                    0 ->
+                                      b + b
+                                    _ ->
+                                      (step3 a)
+                        _ ->
+                          b + (step0 b) * 40
+                else
+                  b - b - 0
+            _ ->
+              if a == 56
+                then
+                  let v2 = a - b
+                  in
+                    if a == 78
+                      then
+                        b * 60
+                      else
+                        let v3 = v2 * 24
+                        in
+                          let v4 = 20 * 92 - v2
+                          in
+                            if v2 > 24
+                              then
+                                v2 + b + (step7 v3 a)
+                              else
+                                v3 * (step4 a v2) - (step5 v2 b)
+                else
+                  if a > 70
+                    then
+                      if a > 25
+                        then
+                          let v2 = b
+                          in
+                            case a `mod` 3 of
+                              0 ->
+                                if v2 < 10
+                                  then
+                                    57
+                                  else
+                                    a * 88
+                              _ ->
+                                v2
+                        else
+                          let v2 = (step2 b a)
+                          in
+                            a
+                    else
+                      if a < 63
+                        then
+                          let v2 = 65 * b + a
+                          in
+                            v2 - b
+                        else
+                          68 * b
+        _ ->
+          if a > 29
+            then
+              case b `mod` 3 of
+                0 ->
+                  if a < 15
+                    then
+                      let v2 = a - a
+                      in
+                        case b `mod` 3 of
+                          0 ->
+                            let v3 = (step1 b v2)
+                            in
+                              let v4 = 61
+                              in
+                                v3 - a + 70
+                          _ ->
+                            a * (step8 b a)
+                    else
+                      a * a + 58
+                _ ->
+                  94 - 43 - b
+            else
+              if a < 58
+                then
+                  let v2 = (step5 b b) + 86
+                  in
+                    case b `mod` 3 of
+                      0 ->
+                        if v2 > 61
+                          then
+                            case b `mod` 3 of
+                              0 ->
+                                (step6 v2)
+                              _ ->
+                                let v3 = 74 * v2 * a
+                                in
+                                  (step8 b b) * v2
+                          else
+                            if v2 < 52
+                              then
+                                case a `mod` 3 of
+                                  0 ->
+                                    a
+                                  _ ->
+                                    v2 + (step8 a a)
+                              else
+                                case v2 `mod` 3 of
+                                  0 ->
+                                    29 * a
+                                  _ ->
+                                    (step7 v2 b) * 85 + a
+                      _ ->
+                        5
+                else
+                  if a > 8
+                    then
+                      if b == 52
+                        then
+                          b + a * b
+                        else
+                          if b > 80
+                            then
+                              let v2 = 59 + a
+                              in
+                                52
+                            else
+                              let v2 = 84 * 60
+                              in
+                                if v2 > 13
+                                  then
+                                    64 + 55 - (step2 v2 v2)
+                                  else
+                                    v2 * (step2 b a)
+                    else
+                      case a `mod` 3 of
+                        0 ->
+                          case a `mod` 3 of
+                            0 ->
+                              case b `mod` 3 of
+                                0 ->
+                                  let v2 = b + a * 68
+                                  in
+                                    83 * (step5 v2 b)
+                                _ ->
+                                  if b == 68
+                                    then
+                                      81 - 48
+                                    else
+                                      32 - 69 * 43
+                            _ ->
+                              let v2 = b - a
+                              in
+                                if v2 < 23
+                                  then
+                                    a + 58 + b
+                                  else
+                                    77
+                        _ ->
+                          let v2 = 78 * 24
+                          in
+                            a - 12 + 19
+
+-- step11: generated
+step11 :: Int -> Int -> Int
+step11 a b =
+  case b `mod` 3 of
+    0 ->
+      if a == 82
+        then
+          if b > 38
+            then
+              case a `mod` 3 of
+                0 ->
+                  let v2 = b
+                  in
+                    b
+                _ ->
+                  let v2 = 29 - 40
+                  in
+                    b - 57 * 25
+            else
+              let v2 = a
+              in
+                let v3 = v2 * a * (step9 v2)
+                in
+                  case b `mod` 3 of
+                    0 ->
+                      case v2 `mod` 3 of
+                        0 ->
+                          case a `mod` 3 of
+                            0 ->
+                              let v4 = b + v3 + b
+                              in
+                                v4 - 61 - a
+                            _ ->
+                              2
+                        _ ->
+                          if a < 93
+                            then
+                              if v2 == 87
+                                then
+                                  (step4 a v2)
+                                else
+                                  a + 42
+                            else
+                              case v2 `mod` 3 of
+                                0 ->
+                                  b + 35 * v3
+                                _ ->
+                                  b
+                    _ ->
+                      (step6 v2) + 44 + (step6 v2)
+        else
+          case a `mod` 3 of
+            0 ->
+              case b `mod` 3 of
+                0 ->
+                  b * 44
+                _ ->
+                  a * 64
+            _ ->
+              if b < 99
+                then
+                  case b `mod` 3 of
+                    0 ->
+                      case a `mod` 3 of
+                        0 ->
+                          case a `mod` 3 of
+                            0 ->
+                              let v2 = b - a + (step1 b a)
+                              in
+                                (step4 v2 b)
+                            _ ->
+                              20
+                        _ ->
+                          let v2 = b * a
+                          in
+                            case v2 `mod` 3 of
+                              0 ->
+                                (step8 v2 a) - (step4 v2 a)
+                              _ ->
+                                let v3 = v2
+                                in
+                                  48
+                    _ ->
+                      if b < 69
+                        then
+                          if b == 68
+                            then
+                              case b `mod` 3 of
+                                0 ->
+                                  if b < 60
+                                    then
+                                      49 - b + a
+                                    else
+                                      a + 74 + a
+                                _ ->
+                                  40
+                            else
+                              case a `mod` 3 of
+                                0 ->
+                                  (step7 b a)
+                                _ ->
+                                  23
+                        else
+                          if a > 76
+                            then
+                              if a == 87
+                                then
+                                  if b < 87
+                                    then
+                                      31
+                                    else
+                                      b + 20 + b
+                                else
+                                  a + (step10 a b)
+                            else
+                              case b `mod` 3 of
+                                0 ->
+                                  b + a - 65
+                                _ ->
+                                  if a > 32
+                                    then
+                                      83 - b * a
+                                    else
+                                      (step10 b b)
+                else
+                  if a < 22
+                    then
+                      case b `mod` 3 of
+                        0 ->
+                          if a > 33
+                            then
+                              case b `mod` 3 of
+                                0 ->
+                                  87
+                                _ ->
+                                  case b `mod` 3 of
+                                    0 ->
+                                      44
+                                    _ ->
+                                      b + b - b
+                            else
+                              2 * (step0 b)
+                        _ ->
+                          let v2 = b
+                          in
+                            if b < 36
+                              then
+                                case v2 `mod` 3 of
+                                  0 ->
+                                    a
+                                  _ ->
+                                    (step5 a v2)
+                              else
+                                b
+                    else
+                      if a == 43
+                        then
+                          66
+                        else
+                          let v2 = b
+                          in
+                            let v3 = a * b
+                            in
+                              case v3 `mod` 3 of
+                                0 ->
+                                  24 + a
+                                _ ->
+                                  a - b
+    _ ->
+      if b > 86
+        then
+          b + 89
+        else
+          case b `mod` 3 of
+            0 ->
+              6 * b
+            _ ->
+              case b `mod` 3 of
+                0 ->
+                  93 * 52
+                _ ->
+                  let v2 = b + b + 92
+                  in
+                    v2
+
+main :: IO ()
+main = do
+  print (step7 34 21)
+  print (step8 78 93)
+  print (step9 2)
+  print (step10 75 70)
+  print (step11 13 54)
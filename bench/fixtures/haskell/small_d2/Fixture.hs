@@ -0,0 +1,70 @@
+module Main where
+
+-- step0: generated
+step0 :: Int -> Int
+step0 a =
+  if a == 19
+    then
+      case a `mod` 3 of
+        0 ->
+          case a `mod` 3 of
+            0 ->
+              a + 95 - 44
+            _ ->
+              53 * a
+        _ ->
+          if a > 39
+            then
+              a - 90 - a
+            else
+              a * 26 * a
+    else
+      let v1 = 46 + a
+      in
+        case v1 `mod` 3 of
+          0 ->
+            v1 - v1 + v1
+          _ ->
+            36 + 24
+
+-- step1: generated
+step1 :: Int -> Int -> Int
+step1 a b =
+  let v2 = b * 97 + 5
+  in
+    if v2 > 76
+      then
+        case a `mod` 3 of
+          0 ->
+            (step0 b)
+          _ ->
+            57
+      else
+        let v3 = v2
+        in
+          (step0 v2)
+
+-- step2: generated
+step2 :: Int -> Int -> Int
+step2 a b =
+  if b > 78
+    then
+      52 + a * 7
+    else
+      if b > 68
+        then
+          if a < 4
+            then
+              b + 32 * a
+            else
+              a * b
+        else
+          let v2 = a * a
+          in
+            (step1 v2 v2)
+
+main :: IO ()
+main = do
+  print (step0 47)
+  print (step1 91 80)
+  print (step2 75 96)
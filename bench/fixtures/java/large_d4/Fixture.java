@@ -0,0 +1,5024 @@
+public class Fixture {
+
+    // step0: generated
+    static int step0(int a) {
+        int x = a - a;
+        int y = 45;
+        y = 27;
+        for (int i2 = 0; i2 < 65; i2++) {
+            y = i2;
+        }
+        a = x * y + 92;
+        a = 83 * x + a;
+        // step 12
+        a = 0 - 52 + 68;
+        y = a - a + x;
+        return x;
+    }
+    
+    // step1: generated
+    static int step1(int a, int b) {
+        int x = 59;
+        int y = 76;
+        y = b;
+        for (int i2 = 0; i2 < 88; i2++) {
+            y = 96 + 69 - x;
+            if (y < 31) {
+                step0(i2);
+                // step 27
+                a = 65;
+            }
+            // step 30
+            a = step0(x);
+            if (y > 52) {
+                for (int i4 = 0; i4 < 22; i4++) {
+                    // step 34
+                    y = a * 57;
+                }
+            } else {
+                x = 32 + i2 + b;
+            }
+        }
+        if (b == 51) {
+            a = y * step0(b);
+            b = step0(x) - b;
+            for (int i3 = 0; i3 < 78; i3++) {
+                if (y == 71) {
+                    a = a * x * y;
+                    for (int i5 = 0; i5 < 41; i5++) {
+                        // step 48
+                        y = 3 + step0(a) * 29;
+                    }
+                    y = 68;
+                }
+                i3 = x - x * i3;
+            }
+            if (a == 39) {
+                step0(b);
+            }
+        }
+        // step 59
+        y = 80 * 21;
+        step0(a);
+        return step0(y);
+    }
+    
+    // step2: generated
+    static int step2(int a, int b) {
+        int x = b + 32 - a;
+        int y = 80;
+        y = b * step0(x) + y;
+        if (b == 35) {
+            // step 71
+            b = step1(a, a) + 87;
+            if (y < 4) {
+                if (x < 85) {
+                    // step 75
+                    x = a * 52 - a;
+                    y = 41 * x - b;
+                } else {
+                    if (b > 26) {
+                        x = b - b;
+                    }
+                }
+            }
+        } else {
+            step0(a);
+            for (int i3 = 0; i3 < 65; i3++) {
+                if (i3 < 12) {
+                    if (i3 < 48) {
+                        step0(b);
+                        // step 90
+                        i3 = b;
+                    }
+                }
+                step1(b, x);
+                i3 = i3 + b;
+            }
+            x = b - x * 18;
+        }
+        if (b < 39) {
+            if (a == 82) {
+                if (b < 57) {
+                    if (y < 52) {
+                        // step 103
+                        a = step1(y, y) - step0(x);
+                    }
+                    if (a == 73) {
+                        step0(a);
+                        // step 108
+                        a = 6;
+                        // step 110
+                        x = step1(b, b);
+                    }
+                    if (x == 18) {
+                        // step 114
+                        b = a - y + x;
+                        // step 116
+                        x = 28 + 5;
+                        // step 118
+                        a = 20 * b + a;
+                    }
+                } else {
+                    step1(b, x);
+                }
+                for (int i4 = 0; i4 < 86; i4++) {
+                    i4 = 18 - b;
+                }
+            } else {
+                if (b > 3) {
+                    a = 51 * y;
+                    a = x + x + 34;
+                    b = 71 * 86 - x;
+                } else {
+                    if (a > 90) {
+                        // step 134
+                        a = y;
+                    } else {
+                        a = 45;
+                    }
+                    if (y > 87) {
+                        // step 140
+                        x = b;
+                        y = 76 * step1(a, x);
+                    }
+                }
+                if (a > 10) {
+                    step0(x);
+                } else {
+                    x = 27;
+                }
+            }
+        }
+        if (x < 17) {
+            step1(a, b);
+            y = b - 28;
+        } else {
+            if (a < 17) {
+                if (x < 96) {
+                    a = y - 42;
+                    x = 36;
+                    if (y == 78) {
+                        // step 161
+                        x = step1(y, x) - b;
+                        b = step0(y) + y;
+                    }
+                }
+            }
+            if (a > 0) {
+                for (int i4 = 0; i4 < 56; i4++) {
+                    // step 169
+                    b = step0(i4) - a + step1(b, i4);
+                }
+            }
+            a = 77 * step1(y, y) - x;
+            a = y;
+        }
+        // step 176
+        y = 30;
+        for (int i2 = 0; i2 < 69; i2++) {
+            // step 179
+            i2 = 83 * b - x;
+            if (i2 < 36) {
+                for (int i4 = 0; i4 < 67; i4++) {
+                    for (int i5 = 0; i5 < 1; i5++) {
+                        // step 184
+                        a = 35 + i4 + step0(i4);
+                    }
+                    y = step1(b, b);
+                }
+            } else {
+                x = i2;
+            }
+            if (b == 67) {
+                // step 193
+                y = 72 + 78;
+            }
+            step0(i2);
+        }
+        return b - y - 33;
+    }
+    
+    // step3: generated
+    static int step3(int a) {
+        int x = a - a + a;
+        int y = 87;
+        // step 205
+        x = y;
+        for (int i2 = 0; i2 < 4; i2++) {
+            if (y > 44) {
+                for (int i4 = 0; i4 < 30; i4++) {
+                    i2 = a * a;
+                    for (int i5 = 0; i5 < 4; i5++) {
+                        y = i5;
+                        // step 213
+                        y = x;
+                        i5 = x - y;
+                    }
+                }
+                if (y == 7) {
+                    // step 219
+                    x = x * 25 + y;
+                } else {
+                    step2(a, x);
+                }
+                a = step0(i2) + x;
+            }
+        }
+        x = 10 * step0(y) + x;
+        return a + x;
+    }
+    
+    // step4: generated
+    static int step4(int a, int b) {
+        int x = b + 44 - a;
+        int y = 73;
+        y = 19;
+        step2(x, b);
+        // step 237
+        x = 32 + 40 + y;
+        return b;
+    }
+    
+    // step5: generated
+    static int step5(int a, int b) {
+        int x = a;
+        int y = 56;
+        // step 246
+        b = 39;
+        for (int i2 = 0; i2 < 25; i2++) {
+            x = a;
+            // step 250
+            x = y;
+        }
+        if (a < 92) {
+            if (a == 0) {
+                if (y == 24) {
+                    step4(x, x);
+                } else {
+                    if (a < 37) {
+                        // step 259
+                        x = 48;
+                        x = 74;
+                    }
+                }
+            } else {
+                y = a;
+            }
+            // step 267
+            x = a - step4(b, x) + x;
+            for (int i3 = 0; i3 < 62; i3++) {
+                for (int i4 = 0; i4 < 44; i4++) {
+                    i3 = a + y;
+                }
+            }
+            if (b < 60) {
+                step4(x, a);
+                // step 276
+                a = x + 47;
+            } else {
+                x = 73;
+            }
+        }
+        return 26 - a + step1(x, a);
+    }
+    
+    // step6: generated
+    static int step6(int a) {
+        int x = a;
+        int y = 58;
+        if (x > 49) {
+            a = a + step3(y);
+        }
+        if (a < 32) {
+            step1(a, x);
+            a = step4(y, x);
+        }
+        // step 296
+        y = y;
+        if (x == 22) {
+            if (a < 39) {
+                if (a > 33) {
+                    for (int i5 = 0; i5 < 90; i5++) {
+                        // step 302
+                        i5 = step1(y, i5) - x;
+                    }
+                    if (y < 60) {
+                        // step 306
+                        x = a * step1(a, a);
+                    } else {
+                        x = step5(x, a) + x + x;
+                        // step 310
+                        y = 87;
+                    }
+                    if (a == 88) {
+                        y = y + 13 * 47;
+                        // step 315
+                        y = y - a * x;
+                        // step 317
+                        y = step4(a, a) - 87 + step2(a, x);
+                    } else {
+                        step5(y, x);
+                        y = y + x - y;
+                    }
+                }
+            }
+        } else {
+            x = y * 75 * 62;
+            for (int i3 = 0; i3 < 66; i3++) {
+                for (int i4 = 0; i4 < 89; i4++) {
+                    for (int i5 = 0; i5 < 94; i5++) {
+                        // step 330
+                        a = 18 + x + 12;
+                    }
+                }
+            }
+            if (x < 57) {
+                if (a < 69) {
+                    a = a - a + 44;
+                } else {
+                    x = a * 35 * a;
+                    step4(a, y);
+                    step3(a);
+                }
+            }
+            y = y;
+        }
+        if (y > 43) {
+            for (int i3 = 0; i3 < 67; i3++) {
+                for (int i4 = 0; i4 < 90; i4++) {
+                    for (int i5 = 0; i5 < 10; i5++) {
+                        // step 350
+                        i4 = x;
+                        // step 352
+                        x = i5 - 12;
+                        // step 354
+                        i3 = x * x + i3;
+                    }
+                    for (int i5 = 0; i5 < 45; i5++) {
+                        i3 = x * i4;
+                        // step 359
+                        i4 = 46 + i3;
+                    }
+                    if (i3 == 23) {
+                        // step 363
+                        y = i3 + step3(i3);
+                    } else {
+                        // step 366
+                        a = 33 + i3;
+                        // step 368
+                        a = 90 * step5(i4, a) + 74;
+                    }
+                }
+                a = x * 91;
+            }
+            if (x == 56) {
+                step2(y, a);
+                y = 88 + x + y;
+                y = a;
+            }
+            step2(y, x);
+            if (x < 33) {
+                for (int i4 = 0; i4 < 58; i4++) {
+                    y = 8;
+                }
+                step4(a, x);
+                if (x == 32) {
+                    y = 59 * x;
+                    for (int i5 = 0; i5 < 17; i5++) {
+                        x = x * step5(y, x);
+                    }
+                }
+            } else {
+                if (x < 94) {
+                    y = a + 20;
+                    // step 394
+                    y = step0(y);
+                }
+                // step 397
+                y = a - 41;
+                for (int i4 = 0; i4 < 73; i4++) {
+                    a = a * a * 87;
+                }
+            }
+        }
+        return y;
+    }
+    
+    // step7: generated
+    static int step7(int a, int b) {
+        int x = b - b * b;
+        int y = 93;
+        b = b + a + step0(y);
+        if (y < 37) {
+            a = 78;
+            x = y - step5(b, x);
+            step6(x);
+            for (int i3 = 0; i3 < 90; i3++) {
+                for (int i4 = 0; i4 < 48; i4++) {
+                    for (int i5 = 0; i5 < 96; i5++) {
+                        i3 = step6(i5) * i3;
+                        i5 = 66;
+                    }
+                }
+            }
+        }
+        if (b < 67) {
+            if (y == 89) {
+                x = 21 * x;
+                y = y + b + 17;
+            } else {
+                for (int i4 = 0; i4 < 95; i4++) {
+                    step2(x, b);
+                    step5(y, i4);
+                    step1(a, b);
+                }
+                if (a == 61) {
+                    // step 436
+                    b = b;
+                    y = 55 * 95 * a;
+                }
+            }
+        }
+        return step6(a) + 23;
+    }
+    
+    // step8: generated
+    static int step8(int a, int b) {
+        int x = b - a;
+        int y = 43;
+        a = x * y;
+        for (int i2 = 0; i2 < 59; i2++) {
+            if (x == 37) {
+                // step 452
+                x = 61;
+                a = a * 23;
+                y = 36 + a * 60;
+            } else {
+                step7(x, x);
+            }
+            if (b == 44) {
+                y = a + a;
+                step2(y, y);
+            } else {
+                for (int i4 = 0; i4 < 51; i4++) {
+                    for (int i5 = 0; i5 < 44; i5++) {
+                        // step 465
+                        i5 = 94 - 36;
+                    }
+                    x = step2(i2, x) + i2 + 35;
+                }
+            }
+        }
+        step5(x, y);
+        x = step3(a);
+        for (int i2 = 0; i2 < 51; i2++) {
+            if (a < 78) {
+                for (int i4 = 0; i4 < 96; i4++) {
+                    // step 477
+                    a = step5(i4, y) * y * x;
+                    step6(x);
+                    if (x > 69) {
+                        a = y - step0(b) - 95;
+                        i4 = y + 28 * 28;
+                    }
+                }
+            } else {
+                if (a == 89) {
+                    for (int i5 = 0; i5 < 84; i5++) {
+                        // step 488
+                        a = step6(b) - a * x;
+                        a = y;
+                    }
+                    step3(a);
+                    x = 1 + 3;
+                }
+            }
+            y = 37 + 47;
+            // step 497
+            x = 54 - step4(b, i2) * 18;
+            b = 59 * b - i2;
+        }
+        step5(a, x);
+        for (int i2 = 0; i2 < 55; i2++) {
+            if (x > 31) {
+                if (i2 > 7) {
+                    a = b - b;
+                    for (int i5 = 0; i5 < 96; i5++) {
+                        y = 4 * i5 * 73;
+                    }
+                    for (int i5 = 0; i5 < 16; i5++) {
+                        i5 = i5 * i5 + 82;
+                    }
+                }
+                for (int i4 = 0; i4 < 81; i4++) {
+                    x = b - 99 * step2(i2, x);
+                }
+            } else {
+                b = x;
+            }
+            step2(a, i2);
+            if (b > 63) {
+                y = 64;
+                // step 522
+                b = 79;
+            }
+            step3(i2);
+        }
+        return 19;
+    }
+    
+    // step9: generated
+    static int step9(int a) {
+        int x = 89 + 62 - 51;
+        int y = 53;
+        if (y == 79) {
+            // step 535
+            x = step8(x, y);
+            if (a > 58) {
+                if (y == 35) {
+                    x = x;
+                } else {
+                    for (int i5 = 0; i5 < 63; i5++) {
+                        // step 542
+                        i5 = 93 + step7(y, i5);
+                    }
+                }
+                // step 546
+                y = 22 + y * 29;
+            }
+        }
+        for (int i2 = 0; i2 < 40; i2++) {
+            if (x > 93) {
+                a = 42 - i2 + x;
+            } else {
+                i2 = 82 + a + a;
+            }
+        }
+        for (int i2 = 0; i2 < 71; i2++) {
+            y = 64 * step8(x, y) - step6(x);
+            if (i2 == 68) {
+                step8(x, x);
+            }
+            for (int i3 = 0; i3 < 68; i3++) {
+                y = x + x * step3(y);
+                if (x < 55) {
+                    for (int i5 = 0; i5 < 33; i5++) {
+                        // step 566
+                        i5 = 22 - x;
+                    }
+                }
+                y = step6(y) + i2;
+            }
+        }
+        if (x > 72) {
+            if (y > 95) {
+                if (a > 70) {
+                    if (a < 92) {
+                        // step 577
+                        a = x - y;
+                    }
+                }
+                if (x < 10) {
+                    a = x;
+                    for (int i5 = 0; i5 < 44; i5++) {
+                        y = step4(y, i5) + a + x;
+                        a = step6(y) + x * 57;
+                    }
+                }
+            }
+            y = x * 96 * a;
+            step7(x, a);
+            x = step3(a);
+        } else {
+            step3(a);
+            if (y < 9) {
+                if (y < 1) {
+                    if (a > 77) {
+                        // step 597
+                        x = x;
+                    }
+                }
+            } else {
+                if (a == 18) {
+                    // step 603
+                    x = a + y;
+                }
+            }
+            if (a < 82) {
+                step3(x);
+                step0(a);
+                if (a > 60) {
+                    if (y > 84) {
+                        // step 612
+                        x = 29 - 45 - y;
+                    } else {
+                        // step 615
+                        x = 12 + 67;
+                    }
+                } else {
+                    a = step1(y, a);
+                }
+            }
+        }
+        for (int i2 = 0; i2 < 79; i2++) {
+            step3(y);
+            if (a > 96) {
+                step4(x, y);
+            }
+            i2 = 17 + 17 - y;
+            for (int i3 = 0; i3 < 63; i3++) {
+                step6(i3);
+                for (int i4 = 0; i4 < 68; i4++) {
+                    a = 25;
+                    if (a < 95) {
+                        x = i4 - step1(y, a);
+                        i2 = 61;
+                    }
+                    // step 637
+                    i4 = i3 + 60;
+                }
+            }
+        }
+        return 75 - y;
+    }
+    
+    // step10: generated
+    static int step10(int a, int b) {
+        int x = 29 + 1 + b;
+        int y = 0;
+        a = 51 - 89 * b;
+        y = x;
+        step5(x, x);
+        return 39;
+    }
+    
+    // step11: generated
+    static int step11(int a, int b) {
+        int x = b + a;
+        int y = 21;
+        // step 659
+        x = 58;
+        a = b;
+        y = 69 + step2(a, b);
+        return 87 - 13 * step9(a);
+    }
+    
+    // step12: generated
+    static int step12(int a) {
+        int x = a * a + 18;
+        int y = 90;
+        step11(y, a);
+        if (y < 94) {
+            y = 67 + step10(a, a);
+        }
+        if (a > 75) {
+            for (int i3 = 0; i3 < 41; i3++) {
+                if (a == 96) {
+                    step0(a);
+                    step9(x);
+                    if (i3 < 38) {
+                        step2(a, a);
+                        i3 = y * 62;
+                        // step 682
+                        x = step2(a, y) * 94 + step11(a, y);
+                    }
+                } else {
+                    // step 686
+                    y = 36;
+                    a = x;
+                }
+            }
+            for (int i3 = 0; i3 < 96; i3++) {
+                y = step3(a) * step9(x);
+            }
+            y = y * step11(x, x);
+        }
+        return 79 - 92;
+    }
+    
+    // step13: generated
+    static int step13(int a, int b) {
+        int x = b * b * 52;
+        int y = 67;
+        step12(b);
+        step2(a, a);
+        // step 705
+        a = 41 + b;
+        // step 707
+        b = 61 + step5(b, x);
+        y = y + b - b;
+        if (a < 33) {
+            if (x > 98) {
+                // step 712
+                b = 77;
+                x = 33 + 93 - b;
+                step9(x);
+            }
+            y = 97;
+            if (b < 89) {
+                x = 63 * step12(b);
+            }
+            x = step7(x, y) * b;
+        }
+        x = 32 * x - b;
+        x = x * a;
+        return b - 19;
+    }
+    
+    // step14: generated
+    static int step14(int a, int b) {
+        int x = 7 - a + b;
+        int y = 82;
+        if (x == 92) {
+            step13(a, b);
+            if (a == 15) {
+                a = step11(y, x) - 63 * x;
+                for (int i4 = 0; i4 < 17; i4++) {
+                    a = y;
+                }
+            } else {
+                if (y > 55) {
+                    if (x > 85) {
+                        // step 742
+                        x = a + 72;
+                    } else {
+                        step6(y);
+                        // step 746
+                        y = a * 10;
+                    }
+                } else {
+                    step12(y);
+                    a = a + 23 - 39;
+                    // step 752
+                    b = y - step1(a, a) * b;
+                }
+            }
+            // step 756
+            y = b - x;
+        }
+        step6(x);
+        a = 64 - 86 * a;
+        step11(x, x);
+        x = 89 * step2(a, x) - 15;
+        if (y > 83) {
+            if (b > 44) {
+                // step 765
+                y = 1;
+            }
+        } else {
+            a = x + 63;
+            step4(a, y);
+            step10(y, a);
+        }
+        return y - 17;
+    }
+    
+    // step15: generated
+    static int step15(int a) {
+        int x = a + a + a;
+        int y = 20;
+        for (int i2 = 0; i2 < 38; i2++) {
+            step2(i2, i2);
+            step14(a, a);
+            if (a == 76) {
+                step7(y, x);
+            }
+            if (y == 90) {
+                step0(x);
+            }
+        }
+        if (x == 86) {
+            step13(a, a);
+        }
+        for (int i2 = 0; i2 < 94; i2++) {
+            y = a - i2;
+            a = y - a;
+            for (int i3 = 0; i3 < 87; i3++) {
+                y = 88 + 85 - step6(i3);
+                if (i3 < 23) {
+                    x = 39 - x;
+                    a = 11 * x;
+                    if (y > 15) {
+                        // step 802
+                        a = 57 * x - step7(i3, i3);
+                        // step 804
+                        x = i2 * 50;
+                    }
+                } else {
+                    a = 38 - 67 + step11(y, x);
+                }
+            }
+            for (int i3 = 0; i3 < 38; i3++) {
+                for (int i4 = 0; i4 < 9; i4++) {
+                    step2(a, i2);
+                    i2 = step2(i2, i2);
+                }
+                if (y < 90) {
+                    step8(i3, i2);
+                    i3 = a;
+                    i3 = 63 * step0(x) - i2;
+                } else {
+                    // step 821
+                    x = 50 + 16 * i2;
+                }
+                for (int i4 = 0; i4 < 58; i4++) {
+                    if (y > 87) {
+                        // step 826
+                        i3 = 8 - step8(a, i4);
+                        // step 828
+                        y = step0(a);
+                    }
+                }
+            }
+        }
+        if (x > 75) {
+            x = step11(a, x);
+            if (a > 60) {
+                y = a;
+            } else {
+                y = x * a - 29;
+            }
+            if (y < 64) {
+                a = a * y;
+            } else {
+                if (x > 63) {
+                    step0(a);
+                    y = step2(y, y) + y;
+                    step4(a, x);
+                } else {
+                    for (int i5 = 0; i5 < 69; i5++) {
+                        // step 850
+                        a = step5(a, i5) - 68 - x;
+                    }
+                    if (x > 56) {
+                        // step 854
+                        x = a;
+                    } else {
+                        y = 36 - step12(a) + step1(a, a);
+                    }
+                    if (a == 52) {
+                        // step 860
+                        x = x;
+                    } else {
+                        // step 863
+                        y = x;
+                        step9(y);
+                    }
+                }
+                if (a == 50) {
+                    step11(x, x);
+                    step11(x, x);
+                    if (x > 99) {
+                        x = step4(y, a) + x;
+                    } else {
+                        // step 874
+                        y = 97 + step14(a, y) - 53;
+                    }
+                }
+                a = 56;
+            }
+        }
+        a = 8;
+        a = 51;
+        a = step7(y, y) - 36 - 46;
+        return a + a + x;
+    }
+    
+    // step16: generated
+    static int step16(int a, int b) {
+        int x = a;
+        int y = 57;
+        if (x > 69) {
+            if (b < 21) {
+                y = x * 74 * 84;
+                if (b == 61) {
+                    if (b > 13) {
+                        x = step13(x, y);
+                    } else {
+                        // step 898
+                        x = b;
+                        // step 900
+                        x = a - 76;
+                        y = 18;
+                    }
+                    x = 0 - 17;
+                }
+                a = x - b + x;
+            } else {
+                a = x;
+            }
+            y = y * step9(x);
+            step4(y, x);
+        }
+        for (int i2 = 0; i2 < 20; i2++) {
+            if (x == 46) {
+                step15(y);
+                if (i2 > 24) {
+                    if (x < 46) {
+                        // step 918
+                        x = 14 * i2;
+                    }
+                    if (i2 > 63) {
+                        // step 922
+                        i2 = 96 * i2 - b;
+                        // step 924
+                        a = 68;
+                    }
+                }
+                for (int i4 = 0; i4 < 71; i4++) {
+                    if (a > 37) {
+                        step11(a, i2);
+                    }
+                    i4 = 14 + i4;
+                }
+            } else {
+                step0(x);
+                for (int i4 = 0; i4 < 72; i4++) {
+                    a = 70;
+                }
+                if (x < 45) {
+                    b = step1(x, i2) * y * y;
+                    if (i2 < 5) {
+                        y = x + x * i2;
+                        step13(i2, b);
+                    } else {
+                        // step 945
+                        y = a;
+                        // step 947
+                        x = a;
+                        // step 949
+                        y = x - step1(x, b);
+                    }
+                } else {
+                    if (i2 > 1) {
+                        // step 954
+                        b = 58;
+                        step4(a, a);
+                        step1(i2, b);
+                    }
+                }
+            }
+        }
+        if (a < 97) {
+            if (y == 62) {
+                // step 964
+                x = b + b;
+            }
+        }
+        for (int i2 = 0; i2 < 67; i2++) {
+            step2(i2, b);
+        }
+        // step 971
+        x = 13;
+        if (a == 89) {
+            if (x > 19) {
+                if (b > 89) {
+                    if (b < 3) {
+                        y = 86 + a;
+                        x = y * y * b;
+                        // step 979
+                        a = y + step5(x, y);
+                    } else {
+                        // step 982
+                        a = 16 - y;
+                        // step 984
+                        a = a + y;
+                    }
+                } else {
+                    for (int i5 = 0; i5 < 84; i5++) {
+                        // step 989
+                        b = step7(b, x) + y;
+                    }
+                }
+            }
+        } else {
+            step1(x, x);
+            for (int i3 = 0; i3 < 68; i3++) {
+                step15(x);
+                x = x + a - 30;
+            }
+            x = 23;
+            step7(y, a);
+        }
+        b = step11(b, y) + b * 90;
+        return 40 * 4 - 43;
+    }
+    
+    // step17: generated
+    static int step17(int a, int b) {
+        int x = 65 + b;
+        int y = 93;
+        b = a - 71 - 69;
+        step13(y, a);
+        y = a - a + step1(b, y);
+        return 89;
+    }
+    
+    // step18: generated
+    static int step18(int a) {
+        int x = 87 - 93 * a;
+        int y = 4;
+        // step 1021
+        y = x;
+        x = 9 + 44 - x;
+        step0(y);
+        if (x == 65) {
+            y = a;
+            for (int i3 = 0; i3 < 51; i3++) {
+                step16(a, a);
+            }
+        }
+        if (y < 23) {
+            for (int i3 = 0; i3 < 86; i3++) {
+                y = 79;
+                if (i3 == 62) {
+                    a = step17(i3, x);
+                } else {
+                    for (int i5 = 0; i5 < 46; i5++) {
+                        y = 23;
+                    }
+                    // step 1040
+                    y = step12(x) * step14(x, i3);
+                    if (x < 67) {
+                        // step 1043
+                        y = y - 18 * step17(y, i3);
+                    }
+                }
+            }
+            x = step14(y, y);
+            for (int i3 = 0; i3 < 16; i3++) {
+                step14(i3, i3);
+            }
+        } else {
+            a = step4(y, x);
+            x = a * 90 + 82;
+        }
+        return 20 - 56;
+    }
+    
+    // step19: generated
+    static int step19(int a, int b) {
+        int x = b - b * b;
+        int y = 9;
+        if (b == 45) {
+            step6(b);
+            // step 1065
+            b = 94 * b;
+            a = 47 - step10(a, x);
+            if (x == 14) {
+                y = 10 * y * y;
+                step17(x, a);
+                a = 12;
+            }
+        }
+        for (int i2 = 0; i2 < 27; i2++) {
+            if (y < 81) {
+                for (int i4 = 0; i4 < 72; i4++) {
+                    if (y < 26) {
+                        b = 30 * x;
+                        // step 1079
+                        a = step16(y, b);
+                        step12(i2);
+                    } else {
+                        // step 1083
+                        a = step10(a, i2) + 1;
+                        i2 = 17 * 74 - i2;
+                        // step 1086
+                        i4 = b + 14 + step4(b, i4);
+                    }
+                }
+                y = y;
+            } else {
+                if (x > 90) {
+                    y = 3 - 69;
+                }
+                y = step16(y, i2) - y;
+            }
+            step16(y, y);
+            if (a < 16) {
+                step17(i2, b);
+            }
+            if (a > 91) {
+                for (int i4 = 0; i4 < 96; i4++) {
+                    x = i2 + 55 + step18(i4);
+                    for (int i5 = 0; i5 < 61; i5++) {
+                        y = step15(y) * i5 + i5;
+                    }
+                    y = x + x;
+                }
+                if (y < 53) {
+                    x = i2 * i2;
+                    for (int i5 = 0; i5 < 66; i5++) {
+                        i5 = x * 62;
+                        // step 1113
+                        i5 = x;
+                        // step 1115
+                        a = a;
+                    }
+                }
+            }
+        }
+        if (y < 26) {
+            if (b < 50) {
+                x = b;
+                x = x;
+                y = a + x - 29;
+            } else {
+                if (b == 22) {
+                    x = b - y;
+                } else {
+                    for (int i5 = 0; i5 < 50; i5++) {
+                        // step 1131
+                        b = 33;
+                        // step 1133
+                        a = x;
+                        // step 1135
+                        x = a;
+                    }
+                    for (int i5 = 0; i5 < 0; i5++) {
+                        // step 1139
+                        y = x - y;
+                    }
+                    if (b == 21) {
+                        b = x * 26 * 0;
+                        // step 1144
+                        y = a + b * 1;
+                    }
+                }
+                if (x > 49) {
+                    if (b > 30) {
+                        a = 46 * 86;
+                        // step 1151
+                        x = a;
+                    } else {
+                        // step 1154
+                        x = step4(y, x) + a + 77;
+                    }
+                } else {
+                    // step 1158
+                    y = 15 + step2(a, a);
+                    if (y == 86) {
+                        // step 1161
+                        b = x - 92;
+                        // step 1163
+                        a = 58;
+                        y = b * step2(a, b);
+                    }
+                    if (b < 99) {
+                        // step 1168
+                        a = step1(b, a);
+                        step1(y, a);
+                        // step 1171
+                        b = 11 + 55 + 16;
+                    }
+                }
+            }
+        }
+        if (b < 43) {
+            x = a * b * y;
+            x = b - 98;
+            if (b == 54) {
+                if (b == 38) {
+                    for (int i5 = 0; i5 < 30; i5++) {
+                        y = a + i5;
+                        // step 1184
+                        b = b * 90 + 34;
+                    }
+                }
+                for (int i4 = 0; i4 < 6; i4++) {
+                    if (b > 42) {
+                        step1(a, a);
+                    }
+                    if (b < 0) {
+                        b = 97;
+                        x = step3(y) + i4;
+                    } else {
+                        // step 1196
+                        x = 53 - y * i4;
+                        // step 1198
+                        a = 33 - 11 - a;
+                    }
+                    if (x > 29) {
+                        step15(a);
+                    } else {
+                        b = a;
+                    }
+                }
+                y = y;
+            } else {
+                if (x < 90) {
+                    y = b + b * a;
+                    if (x > 9) {
+                        // step 1212
+                        y = y;
+                        step18(b);
+                        // step 1215
+                        b = 35 * x;
+                    }
+                    if (x == 0) {
+                        b = 6 * step13(x, y) - a;
+                    }
+                }
+                step12(a);
+                y = a;
+            }
+            a = b - step15(b) + y;
+        }
+        if (y > 49) {
+            b = a - 76 * 11;
+            if (b > 52) {
+                // step 1230
+                b = 12 * step17(a, y) + 15;
+                if (a < 11) {
+                    x = y + 81;
+                }
+            }
+        } else {
+            y = a * y;
+            // step 1238
+            b = 27 - 71;
+            step4(x, x);
+            // step 1241
+            y = x;
+        }
+        a = x + y;
+        return y - b;
+    }
+    
+    // step20: generated
+    static int step20(int a, int b) {
+        int x = 77 - 81 - a;
+        int y = 80;
+        if (x == 19) {
+            a = y;
+            if (x < 58) {
+                step7(a, a);
+                if (x < 86) {
+                    x = b * 66;
+                    if (x == 69) {
+                        step15(b);
+                    }
+                }
+            } else {
+                y = 64 - step13(y, y) - b;
+            }
+            y = x - y - x;
+            for (int i3 = 0; i3 < 69; i3++) {
+                b = b;
+                if (y > 82) {
+                    if (i3 == 9) {
+                        step5(i3, a);
+                    } else {
+                        // step 1272
+                        y = step14(b, y);
+                        // step 1274
+                        b = 88 + x + a;
+                    }
+                }
+            }
+        }
+        for (int i2 = 0; i2 < 14; i2++) {
+            if (b == 0) {
+                b = x + i2 * y;
+            } else {
+                if (a == 73) {
+                    a = a - 34 - y;
+                }
+                step15(b);
+            }
+            b = i2 * a;
+        }
+        x = step10(y, b);
+        return y + b - a;
+    }
+    
+    // step21: generated
+    static int step21(int a) {
+        int x = a + 85 * a;
+        int y = 93;
+        if (x == 64) {
+            if (y < 95) {
+                // step 1301
+                y = step6(x);
+            }
+        }
+        y = a - x - step9(x);
+        step9(a);
+        for (int i2 = 0; i2 < 30; i2++) {
+            if (y < 10) {
+                y = 67 * 12;
+                step5(a, a);
+                i2 = i2 - 42;
+            } else {
+                if (a > 13) {
+                    for (int i5 = 0; i5 < 91; i5++) {
+                        // step 1315
+                        y = 11 * i5 + step20(i2, y);
+                    }
+                    a = x;
+                } else {
+                    y = i2 + y;
+                }
+            }
+            if (a == 54) {
+                // step 1324
+                a = x - step12(y);
+            }
+            a = x;
+        }
+        a = y - a + x;
+        if (x < 54) {
+            if (y > 33) {
+                a = y + a;
+                x = x;
+            } else {
+                if (x > 31) {
+                    for (int i5 = 0; i5 < 69; i5++) {
+                        // step 1337
+                        y = i5 + 4 * step3(x);
+                        x = 82 + a + i5;
+                    }
+                    a = x - a;
+                    step16(y, a);
+                } else {
+                    // step 1344
+                    x = a;
+                    if (x == 44) {
+                        step20(a, x);
+                    }
+                    y = a * x;
+                }
+            }
+            if (x < 75) {
+                a = 85 * x + 13;
+            }
+            step16(a, y);
+            // step 1356
+            a = 71 - 99;
+        } else {
+            if (a == 69) {
+                step3(a);
+            } else {
+                if (a == 99) {
+                    y = x - step19(x, y);
+                    x = 78 + y;
+                    step3(x);
+                }
+                a = x;
+                step3(a);
+            }
+            if (y > 78) {
+                x = y;
+            } else {
+                if (x == 63) {
+                    y = step8(a, x);
+                }
+                if (a < 72) {
+                    if (y == 30) {
+                        // step 1378
+                        x = y * 75;
+                    }
+                }
+            }
+            // step 1383
+            a = 52 - y;
+        }
+        y = x;
+        // step 1387
+        x = 97;
+        return y + 4 + 39;
+    }
+    
+    // step22: generated
+    static int step22(int a, int b) {
+        int x = a + a + a;
+        int y = 87;
+        y = 74 + step13(a, x) + a;
+        if (x < 42) {
+            if (a == 47) {
+                step0(b);
+            }
+            if (b < 27) {
+                if (a == 39) {
+                    step16(a, y);
+                } else {
+                    x = 54;
+                }
+                y = step17(a, b);
+                b = 95 * 86 * b;
+            }
+            if (b == 34) {
+                y = a;
+            }
+        } else {
+            if (a < 19) {
+                if (y > 70) {
+                    step0(b);
+                    // step 1417
+                    a = step0(y) - b;
+                }
+                a = y;
+                a = x + x;
+            } else {
+                if (b > 83) {
+                    if (y == 5) {
+                        // step 1425
+                        y = x * 27 + b;
+                        y = y;
+                    } else {
+                        b = y;
+                    }
+                }
+            }
+            for (int i3 = 0; i3 < 88; i3++) {
+                step6(i3);
+            }
+            b = x;
+        }
+        if (a < 14) {
+            x = x;
+            x = y - a;
+            if (a > 9) {
+                for (int i4 = 0; i4 < 44; i4++) {
+                    y = i4 * 21;
+                    y = 35;
+                }
+            }
+            b = b + y + x;
+        } else {
+            if (x > 51) {
+                // step 1450
+                x = a;
+            }
+            if (a < 83) {
+                if (x > 80) {
+                    if (a > 30) {
+                        // step 1456
+                        a = y;
+                        // step 1458
+                        y = step1(b, y) + 82;
+                    } else {
+                        a = 33 - y;
+                    }
+                    if (y < 57) {
+                        // step 1464
+                        a = 60;
+                        // step 1466
+                        x = x - 64;
+                    } else {
+                        b = 94;
+                    }
+                    b = x;
+                }
+                for (int i4 = 0; i4 < 70; i4++) {
+                    // step 1474
+                    y = a - step9(a);
+                }
+                for (int i4 = 0; i4 < 12; i4++) {
+                    if (b < 10) {
+                        // step 1479
+                        a = b + step3(a);
+                    } else {
+                        // step 1482
+                        x = step1(x, a);
+                        step9(a);
+                        // step 1485
+                        x = 0 - step2(x, b);
+                    }
+                }
+            } else {
+                if (a > 58) {
+                    step15(x);
+                    if (b == 73) {
+                        // step 1493
+                        y = a;
+                    } else {
+                        // step 1496
+                        a = 28;
+                    }
+                } else {
+                    x = a;
+                }
+                x = x * x + 61;
+                x = 51;
+            }
+        }
+        a = 17 - a;
+        step4(b, a);
+        if (x == 90) {
+            // step 1509
+            a = step10(y, y) + 48 * a;
+            for (int i3 = 0; i3 < 87; i3++) {
+                for (int i4 = 0; i4 < 8; i4++) {
+                    i4 = i4 - 13;
+                }
+            }
+            for (int i3 = 0; i3 < 30; i3++) {
+                a = 47 - 70;
+                for (int i4 = 0; i4 < 12; i4++) {
+                    for (int i5 = 0; i5 < 47; i5++) {
+                        x = i3 + i3;
+                    }
+                }
+                x = 75 - y - y;
+            }
+        }
+        return 54 * 1;
+    }
+    
+    // step23: generated
+    static int step23(int a, int b) {
+        int x = 35;
+        int y = 80;
+        if (a == 33) {
+            step8(x, b);
+        }
+        y = a + 4 + b;
+        if (x < 59) {
+            for (int i3 = 0; i3 < 41; i3++) {
+                for (int i4 = 0; i4 < 93; i4++) {
+                    i3 = x;
+                }
+                if (y == 90) {
+                    if (i3 > 48) {
+                        // step 1544
+                        y = step7(i3, i3) * a;
+                    }
+                } else {
+                    b = i3;
+                    a = b;
+                    step9(x);
+                }
+            }
+            x = 0 - 63 - b;
+        } else {
+            b = 12 * step2(b, x);
+            step2(b, a);
+        }
+        return 6;
+    }
+    
+    // step24: generated
+    static int step24(int a) {
+        int x = a;
+        int y = 54;
+        x = a - step11(x, x);
+        a = 21 + 97;
+        if (y < 89) {
+            for (int i3 = 0; i3 < 63; i3++) {
+                i3 = x - y * y;
+                x = i3 - step5(y, y);
+                i3 = y + step12(a) + i3;
+            }
+            if (x > 2) {
+                for (int i4 = 0; i4 < 50; i4++) {
+                    if (a < 76) {
+                        // step 1576
+                        y = i4 * step5(y, i4) - 38;
+                        // step 1578
+                        i4 = x - a + 18;
+                        i4 = y * x;
+                    }
+                }
+                step10(x, x);
+            }
+        }
+        return 47 + x;
+    }
+    
+    // step25: generated
+    static int step25(int a, int b) {
+        int x = 16 - b;
+        int y = 95;
+        for (int i2 = 0; i2 < 98; i2++) {
+            b = y + x;
+        }
+        // step 1596
+        x = a + 17 * x;
+        for (int i2 = 0; i2 < 40; i2++) {
+            for (int i3 = 0; i3 < 43; i3++) {
+                a = y * step23(i3, i2);
+            }
+            step2(b, a);
+            for (int i3 = 0; i3 < 51; i3++) {
+                i2 = step4(i2, b) + step8(i3, b);
+                if (i2 < 30) {
+                    i3 = 3;
+                    if (x == 42) {
+                        // step 1608
+                        x = a + 20;
+                        // step 1610
+                        y = x - step7(x, a);
+                    }
+                    b = i3 + 41;
+                } else {
+                    for (int i5 = 0; i5 < 62; i5++) {
+                        // step 1616
+                        a = 91 * i5 - i5;
+                        step21(a);
+                    }
+                }
+            }
+        }
+        return a - step24(a) * 2;
+    }
+    
+    // step26: generated
+    static int step26(int a, int b) {
+        int x = b;
+        int y = 46;
+        y = y - 81 + y;
+        if (b == 97) {
+            if (y == 67) {
+                if (x > 75) {
+                    if (b > 87) {
+                        // step 1635
+                        b = 63 * b * 40;
+                        step21(a);
+                        // step 1638
+                        x = 61 * a * 54;
+                    } else {
+                        // step 1641
+                        x = y - a;
+                        // step 1643
+                        a = x;
+                        step8(x, x);
+                    }
+                    for (int i5 = 0; i5 < 45; i5++) {
+                        x = i5 * step24(y);
+                    }
+                }
+            } else {
+                step21(a);
+            }
+            if (b > 3) {
+                if (a < 23) {
+                    step7(x, y);
+                    if (a == 17) {
+                        a = b;
+                        // step 1659
+                        b = 5;
+                        // step 1661
+                        a = y * b + x;
+                    }
+                    a = a - 47 - step1(x, b);
+                }
+                if (x < 42) {
+                    step4(b, x);
+                    if (x < 33) {
+                        // step 1669
+                        b = 7;
+                    } else {
+                        // step 1672
+                        a = a + x * step11(y, x);
+                    }
+                } else {
+                    if (b < 39) {
+                        // step 1677
+                        a = y * y + x;
+                    }
+                    if (x > 54) {
+                        // step 1681
+                        y = a - 97;
+                    }
+                }
+                if (y < 2) {
+                    // step 1686
+                    a = 4;
+                }
+            } else {
+                if (y == 30) {
+                    y = 42 - step12(x) - step13(a, x);
+                }
+                if (b > 11) {
+                    for (int i5 = 0; i5 < 57; i5++) {
+                        // step 1695
+                        x = i5 * b + a;
+                    }
+                    for (int i5 = 0; i5 < 41; i5++) {
+                        step12(i5);
+                    }
+                    step19(b, b);
+                }
+            }
+            step7(x, b);
+        }
+        if (x < 73) {
+            step18(a);
+        }
+        if (x < 27) {
+            a = a;
+            for (int i3 = 0; i3 < 76; i3++) {
+                a = 8;
+            }
+            if (x == 93) {
+                if (x < 90) {
+                    if (b == 55) {
+                        y = 48;
+                        // step 1718
+                        a = x;
+                    } else {
+                        // step 1721
+                        b = 90 - y;
+                        step14(x, b);
+                    }
+                }
+                a = 51;
+                b = 46 + x;
+            } else {
+                if (y == 42) {
+                    if (a < 66) {
+                        // step 1731
+                        b = 21 + x;
+                        step2(b, x);
+                        // step 1734
+                        b = b + b;
+                    } else {
+                        a = a - x;
+                    }
+                    if (y > 56) {
+                        // step 1740
+                        b = 42;
+                        // step 1742
+                        b = a + step8(x, a);
+                    }
+                } else {
+                    x = step15(a);
+                }
+            }
+        } else {
+            if (b > 5) {
+                // step 1751
+                y = y + 30 + 72;
+                step23(x, y);
+            } else {
+                // step 1755
+                a = 15 - x;
+                for (int i4 = 0; i4 < 65; i4++) {
+                    if (y < 30) {
+                        step17(a, i4);
+                        // step 1760
+                        i4 = x * step10(a, b) * b;
+                    } else {
+                        // step 1763
+                        b = 14 - step25(b, b);
+                    }
+                }
+            }
+            for (int i3 = 0; i3 < 9; i3++) {
+                step5(i3, x);
+                if (i3 == 65) {
+                    step14(i3, y);
+                    if (y > 95) {
+                        // step 1773
+                        y = step25(b, b) + y * x;
+                    }
+                    a = step2(i3, a) * a;
+                } else {
+                    x = step3(i3);
+                    for (int i5 = 0; i5 < 77; i5++) {
+                        step9(x);
+                        b = i5 - a - x;
+                    }
+                }
+                step23(y, x);
+            }
+        }
+        // step 1787
+        a = 46 - 12 + b;
+        if (x == 84) {
+            b = 12;
+        } else {
+            a = x + x;
+            step7(b, b);
+        }
+        a = 47;
+        step21(y);
+        return x;
+    }
+    
+    // step27: generated
+    static int step27(int a) {
+        int x = a + 17 * 2;
+        int y = 21;
+        y = 43 + 4 + 86;
+        x = 4 * a - x;
+        for (int i2 = 0; i2 < 3; i2++) {
+            // step 1807
+            i2 = step7(i2, x) - y * a;
+        }
+        if (y < 84) {
+            y = x * 77;
+            // step 1812
+            y = 36 - x - step23(x, x);
+            if (x > 87) {
+                step20(y, a);
+                if (y > 65) {
+                    y = x;
+                } else {
+                    if (a == 38) {
+                        // step 1820
+                        y = y + 5;
+                    } else {
+                        // step 1823
+                        y = 21 - 15 + 94;
+                    }
+                    if (a < 9) {
+                        // step 1827
+                        y = step21(x) * a;
+                    }
+                    y = x + y;
+                }
+            } else {
+                if (x == 87) {
+                    x = x;
+                    if (y < 41) {
+                        // step 1836
+                        a = step20(a, a) * 96;
+                        // step 1838
+                        y = 52;
+                        y = 88 - 12;
+                    }
+                    a = 33 * y;
+                }
+                x = step8(a, a);
+            }
+            a = a + 79 * a;
+        } else {
+            step19(a, a);
+            a = y * step1(y, y) * x;
+            for (int i3 = 0; i3 < 11; i3++) {
+                step5(y, i3);
+                if (x > 2) {
+                    a = i3 * 81;
+                    x = x * 17;
+                } else {
+                    i3 = a + 79 + i3;
+                }
+            }
+        }
+        a = step12(y) + 39 - 64;
+        return 72;
+    }
+    
+    // step28: generated
+    static int step28(int a, int b) {
+        int x = 86 - a;
+        int y = 36;
+        // step 1868
+        b = step17(b, a);
+        x = 32 + 22 * 24;
+        for (int i2 = 0; i2 < 95; i2++) {
+            if (y < 3) {
+                if (a == 87) {
+                    for (int i5 = 0; i5 < 25; i5++) {
+                        // step 1875
+                        i5 = 5 - 67 - i2;
+                    }
+                }
+            }
+            if (y < 99) {
+                if (a < 81) {
+                    if (x < 99) {
+                        // step 1883
+                        x = step26(y, x) + b;
+                    }
+                }
+            }
+        }
+        // step 1889
+        a = step14(y, b);
+        return a + b;
+    }
+    
+    // step29: generated
+    static int step29(int a, int b) {
+        int x = b;
+        int y = 5;
+        b = step8(x, x);
+        if (a == 26) {
+            x = b - 41 + x;
+            step19(y, x);
+        } else {
+            x = 62 - step7(b, a) - x;
+            a = step12(y) + 70;
+            a = a;
+        }
+        for (int i2 = 0; i2 < 88; i2++) {
+            step16(b, a);
+        }
+        y = b - a;
+        // step 1911
+        a = 57 - y;
+        return 24 * 57;
+    }
+    
+    // step30: generated
+    static int step30(int a) {
+        int x = a - a * a;
+        int y = 2;
+        x = 51 * 59 - 88;
+        x = 83;
+        x = y + x;
+        step29(y, y);
+        return y * 2;
+    }
+    
+    // step31: generated
+    static int step31(int a, int b) {
+        int x = 83;
+        int y = 91;
+        if (y > 1) {
+            y = a;
+            step20(y, a);
+            x = b - step13(b, b);
+            y = 69 * a - 40;
+        }
+        if (x > 84) {
+            b = x;
+            if (b > 60) {
+                x = 78;
+                step28(y, a);
+            } else {
+                x = 73;
+                if (b < 58) {
+                    step29(a, x);
+                } else {
+                    a = y;
+                }
+                for (int i4 = 0; i4 < 76; i4++) {
+                    x = b + 8;
+                }
+            }
+            for (int i3 = 0; i3 < 56; i3++) {
+                i3 = step21(x) * step30(y) - b;
+            }
+            if (y > 56) {
+                step6(a);
+                // step 1958
+                x = 30;
+                if (b < 6) {
+                    // step 1961
+                    y = x * 65 + b;
+                } else {
+                    if (b == 92) {
+                        y = a * y;
+                        // step 1966
+                        x = 49 - b;
+                    } else {
+                        // step 1969
+                        a = x + 45 * b;
+                    }
+                    // step 1972
+                    x = a;
+                }
+            }
+        }
+        step0(y);
+        return 76;
+    }
+    
+    // step32: generated
+    static int step32(int a, int b) {
+        int x = 2 * b + b;
+        int y = 65;
+        a = x + b;
+        step8(b, a);
+        x = x + b;
+        return step19(b, y);
+    }
+    
+    // step33: generated
+    static int step33(int a) {
+        int x = a;
+        int y = 6;
+        for (int i2 = 0; i2 < 22; i2++) {
+            a = a * 48 - y;
+            x = i2;
+            // step 1998
+            y = i2 - 7;
+        }
+        for (int i2 = 0; i2 < 42; i2++) {
+            for (int i3 = 0; i3 < 12; i3++) {
+                if (y > 64) {
+                    // step 2004
+                    i2 = 31 * i2;
+                }
+            }
+        }
+        // step 2009
+        a = x + y * x;
+        return x + 83;
+    }
+    
+    // step34: generated
+    static int step34(int a, int b) {
+        int x = a;
+        int y = 33;
+        step23(x, a);
+        step30(b);
+        if (y == 36) {
+            // step 2021
+            a = x;
+            // step 2023
+            y = 89;
+            for (int i3 = 0; i3 < 87; i3++) {
+                a = 16;
+                // step 2027
+                y = 14 - step23(y, i3) * b;
+            }
+            // step 2030
+            a = 51 * b;
+        }
+        x = step17(y, a) * step17(a, y) + 90;
+        if (b > 78) {
+            a = a;
+            for (int i3 = 0; i3 < 43; i3++) {
+                // step 2037
+                y = b;
+                i3 = 28;
+                i3 = b - 33;
+            }
+            if (y > 26) {
+                x = 35 + 93;
+            } else {
+                // step 2045
+                x = step33(b);
+                step31(b, a);
+                step33(y);
+            }
+            if (y == 77) {
+                b = 94 + 95;
+                for (int i4 = 0; i4 < 27; i4++) {
+                    a = y + step30(y);
+                    for (int i5 = 0; i5 < 50; i5++) {
+                        a = step18(x) + i5;
+                        y = 66 - x;
+                    }
+                    if (b < 43) {
+                        // step 2059
+                        a = i4 - 10;
+                    }
+                }
+                if (b > 81) {
+                    if (b < 86) {
+                        // step 2065
+                        x = 18 + 61 + x;
+                        x = step10(b, a);
+                        // step 2068
+                        x = y + y + 24;
+                    }
+                } else {
+                    step30(y);
+                }
+            }
+        } else {
+            // step 2076
+            x = 85;
+            if (b < 28) {
+                step12(y);
+                if (a > 30) {
+                    for (int i5 = 0; i5 < 37; i5++) {
+                        step6(y);
+                    }
+                } else {
+                    // step 2085
+                    b = 77 - b;
+                    y = 83;
+                }
+                step25(a, a);
+            } else {
+                step18(x);
+                for (int i4 = 0; i4 < 96; i4++) {
+                    if (i4 == 5) {
+                        x = 49 + b + y;
+                        // step 2095
+                        i4 = step21(b);
+                    }
+                }
+            }
+        }
+        return 24 - 61 * y;
+    }
+    
+    // step35: generated
+    static int step35(int a, int b) {
+        int x = b * b;
+        int y = 46;
+        for (int i2 = 0; i2 < 85; i2++) {
+            for (int i3 = 0; i3 < 67; i3++) {
+                y = b - i2 * 21;
+                if (i3 < 35) {
+                    for (int i5 = 0; i5 < 97; i5++) {
+                        // step 2113
+                        i5 = i3;
+                        b = 49;
+                    }
+                }
+            }
+            if (i2 < 4) {
+                if (x > 23) {
+                    if (i2 < 43) {
+                        // step 2122
+                        a = 98 - b - i2;
+                        // step 2124
+                        y = step30(x) * step9(x) * step10(b, x);
+                        b = a * step21(y) + a;
+                    } else {
+                        y = y;
+                    }
+                    if (b < 87) {
+                        // step 2131
+                        y = x - y + i2;
+                        a = x - 13 * 70;
+                    }
+                } else {
+                    b = a;
+                    i2 = a - x;
+                }
+                step1(i2, y);
+            } else {
+                step32(i2, i2);
+            }
+            if (a < 45) {
+                if (x > 67) {
+                    if (i2 > 14) {
+                        // step 2146
+                        b = step4(a, a) * 67 - 54;
+                    } else {
+                        // step 2149
+                        x = i2;
+                    }
+                }
+            } else {
+                a = 45 + step16(b, a) * x;
+                y = a - i2;
+            }
+            if (i2 == 44) {
+                for (int i4 = 0; i4 < 9; i4++) {
+                    a = i4 + 29 - 37;
+                    // step 2160
+                    y = b - 73;
+                    b = 69;
+                }
+                b = y - a + 80;
+            } else {
+                step26(y, a);
+            }
+        }
+        x = y;
+        if (y < 15) {
+            // step 2171
+            y = step20(b, a) - 67;
+        } else {
+            x = y + x;
+            x = 6;
+        }
+        // step 2177
+        y = 42;
+        for (int i2 = 0; i2 < 38; i2++) {
+            if (x == 69) {
+                b = i2;
+            }
+            for (int i3 = 0; i3 < 55; i3++) {
+                y = i2 - step28(x, i3) * i3;
+                if (i2 == 34) {
+                    for (int i5 = 0; i5 < 4; i5++) {
+                        // step 2187
+                        b = i5 + i3 + i3;
+                        // step 2189
+                        i3 = a + i3;
+                    }
+                    if (b > 3) {
+                        // step 2193
+                        i2 = i2 - 97;
+                        a = 23 - 82;
+                        // step 2196
+                        a = y;
+                    } else {
+                        b = b - step12(i2);
+                        // step 2200
+                        a = step27(i2) + 86 + i2;
+                    }
+                    if (i3 == 84) {
+                        // step 2204
+                        x = y + x + 27;
+                        i3 = x + 63 * x;
+                    } else {
+                        // step 2208
+                        b = y;
+                        y = x;
+                    }
+                } else {
+                    for (int i5 = 0; i5 < 99; i5++) {
+                        // step 2214
+                        y = step2(a, i3) - x - 98;
+                    }
+                }
+            }
+            y = 47 * 13 + a;
+        }
+        if (x > 17) {
+            step25(b, a);
+            a = y * x;
+            if (x == 38) {
+                x = 26 - b - 92;
+            } else {
+                if (a == 22) {
+                    // step 2228
+                    y = y * b + step28(x, a);
+                }
+                step1(a, y);
+            }
+            if (b < 14) {
+                // step 2234
+                y = 42;
+                b = step6(b) + a;
+            }
+        }
+        return y;
+    }
+    
+    // step36: generated
+    static int step36(int a) {
+        int x = 91 - a;
+        int y = 15;
+        if (x < 24) {
+            for (int i3 = 0; i3 < 55; i3++) {
+                if (a < 92) {
+                    if (i3 < 10) {
+                        i3 = y + step14(a, y);
+                    }
+                    if (x > 40) {
+                        // step 2253
+                        x = y * a;
+                    } else {
+                        // step 2256
+                        x = i3;
+                        // step 2258
+                        i3 = 99 - i3 + step11(a, y);
+                    }
+                } else {
+                    a = step20(i3, a) - a + step25(i3, x);
+                }
+            }
+            a = y + 58 * step5(x, x);
+            // step 2266
+            y = a + x;
+            x = y;
+        }
+        if (x == 39) {
+            step10(y, y);
+            if (y == 94) {
+                step8(y, x);
+            } else {
+                step17(y, a);
+            }
+            if (y < 35) {
+                x = x - a + 20;
+                x = step25(a, x);
+            } else {
+                for (int i4 = 0; i4 < 99; i4++) {
+                    y = 66;
+                }
+                if (y > 35) {
+                    for (int i5 = 0; i5 < 20; i5++) {
+                        // step 2286
+                        i5 = 30 + i5 - step6(y);
+                        step25(x, a);
+                    }
+                } else {
+                    x = 80 - 49 * 84;
+                    if (a == 8) {
+                        // step 2293
+                        a = x;
+                        // step 2295
+                        a = step24(y) - 25;
+                    }
+                    if (y == 38) {
+                        // step 2299
+                        a = x * y * step35(y, x);
+                        // step 2301
+                        x = a - x * a;
+                    }
+                }
+            }
+            step16(a, x);
+        } else {
+            if (y == 63) {
+                if (a > 60) {
+                    if (x > 82) {
+                        step11(y, y);
+                        // step 2312
+                        x = x * step7(a, x);
+                    }
+                    if (a < 62) {
+                        y = 80 - a * step3(x);
+                        step2(a, y);
+                        x = 81 + x + 14;
+                    }
+                }
+                if (a == 71) {
+                    for (int i5 = 0; i5 < 0; i5++) {
+                        // step 2323
+                        x = a - x;
+                        // step 2325
+                        a = step1(a, a) + a;
+                    }
+                    if (x < 91) {
+                        // step 2329
+                        a = y * y;
+                    } else {
+                        // step 2332
+                        y = 3;
+                    }
+                    if (y == 20) {
+                        // step 2336
+                        a = a - 72;
+                    } else {
+                        // step 2339
+                        a = 11;
+                    }
+                } else {
+                    if (y < 11) {
+                        a = 37;
+                        // step 2345
+                        a = 25 - 91 - step15(x);
+                        y = a;
+                    }
+                }
+                y = y + 14 - 38;
+            }
+            a = step17(y, y);
+        }
+        if (x > 59) {
+            y = a + step21(x) * y;
+            step8(x, y);
+            x = 33 + a;
+            a = 88;
+        }
+        if (y < 21) {
+            if (a == 84) {
+                if (x < 66) {
+                    for (int i5 = 0; i5 < 37; i5++) {
+                        i5 = a;
+                        step10(a, x);
+                        // step 2366
+                        i5 = step7(y, y) + x - a;
+                    }
+                    for (int i5 = 0; i5 < 30; i5++) {
+                        a = a;
+                        y = a - a - y;
+                        // step 2372
+                        x = 54;
+                    }
+                }
+                for (int i4 = 0; i4 < 73; i4++) {
+                    for (int i5 = 0; i5 < 13; i5++) {
+                        // step 2378
+                        i5 = step12(x) * a;
+                    }
+                }
+                if (y > 2) {
+                    for (int i5 = 0; i5 < 47; i5++) {
+                        // step 2384
+                        a = i5;
+                        // step 2386
+                        i5 = 68 * y - 5;
+                        // step 2388
+                        a = step10(a, y) + y;
+                    }
+                    step32(a, y);
+                    x = 86 * 58 - 41;
+                }
+            } else {
+                if (x < 63) {
+                    for (int i5 = 0; i5 < 72; i5++) {
+                        y = y;
+                    }
+                    for (int i5 = 0; i5 < 10; i5++) {
+                        a = step17(i5, x) - 68;
+                        // step 2401
+                        i5 = a;
+                    }
+                    // step 2404
+                    y = 0 + 43;
+                } else {
+                    a = x * step31(y, x) + 2;
+                }
+            }
+            if (a > 71) {
+                for (int i4 = 0; i4 < 80; i4++) {
+                    // step 2412
+                    i4 = step0(i4) + y;
+                }
+                if (a < 66) {
+                    if (a < 25) {
+                        step31(a, x);
+                    }
+                    x = step31(y, y);
+                    step16(y, a);
+                } else {
+                    for (int i5 = 0; i5 < 86; i5++) {
+                        // step 2423
+                        i5 = 84;
+                    }
+                    if (x == 69) {
+                        // step 2427
+                        y = 27 - 30;
+                        // step 2429
+                        a = x + x;
+                    } else {
+                        // step 2432
+                        y = step34(x, a) * step8(a, a) * 5;
+                        // step 2434
+                        a = x + y;
+                        // step 2436
+                        x = step28(a, x) + 32;
+                    }
+                    y = a - a;
+                }
+            }
+            step31(x, a);
+        }
+        return 10 * step31(y, y) + step21(y);
+    }
+    
+    // step37: generated
+    static int step37(int a, int b) {
+        int x = b * a;
+        int y = 33;
+        b = step12(b);
+        b = a + a;
+        step11(x, y);
+        y = a - x;
+        // step 2455
+        y = 90 * x;
+        if (b < 77) {
+            y = a - y + 46;
+        } else {
+            if (a == 31) {
+                if (y < 56) {
+                    y = 24;
+                    // step 2463
+                    b = 85;
+                    x = 97 * step35(x, x);
+                } else {
+                    a = y + y + b;
+                    // step 2468
+                    x = step5(b, a) - 38;
+                    x = b * x - x;
+                }
+            } else {
+                b = x + x + y;
+                a = 87;
+                b = a + 19 + step36(y);
+            }
+            step5(a, b);
+            a = x;
+        }
+        b = 1 + a;
+        return step16(x, b) * y * y;
+    }
+    
+    // step38: generated
+    static int step38(int a, int b) {
+        int x = 90;
+        int y = 73;
+        if (x > 26) {
+            if (b > 60) {
+                // step 2490
+                y = a + 49;
+            }
+            a = y - 15;
+            if (x == 26) {
+                x = 77;
+                if (x < 69) {
+                    a = step1(x, y);
+                    a = b * 20;
+                } else {
+                    step17(x, b);
+                    y = a * y + y;
+                    if (a < 85) {
+                        // step 2503
+                        b = 91;
+                    } else {
+                        a = 18 - y * 86;
+                    }
+                }
+                if (x > 14) {
+                    step21(b);
+                    for (int i5 = 0; i5 < 34; i5++) {
+                        y = b;
+                    }
+                    if (y < 66) {
+                        // step 2515
+                        b = 13 - 40 - 59;
+                    }
+                }
+            }
+            step7(b, b);
+        }
+        if (a == 52) {
+            for (int i3 = 0; i3 < 0; i3++) {
+                if (i3 == 13) {
+                    step2(i3, a);
+                    if (y > 73) {
+                        // step 2527
+                        b = y - 22;
+                        i3 = 54 - x * 23;
+                        step13(a, b);
+                    }
+                }
+            }
+            if (a < 48) {
+                for (int i4 = 0; i4 < 10; i4++) {
+                    // step 2536
+                    a = 52;
+                }
+            }
+            y = step37(a, a) + step27(x);
+            for (int i3 = 0; i3 < 89; i3++) {
+                if (b < 84) {
+                    b = b + x - i3;
+                }
+            }
+        } else {
+            step20(a, b);
+            step24(y);
+        }
+        step26(a, b);
+        step34(x, a);
+        // step 2552
+        a = 24 + 58 * y;
+        if (y < 59) {
+            if (b == 97) {
+                for (int i4 = 0; i4 < 43; i4++) {
+                    if (b < 61) {
+                        // step 2558
+                        x = i4 + y;
+                        step0(b);
+                    }
+                    for (int i5 = 0; i5 < 46; i5++) {
+                        i4 = i4 + a + a;
+                    }
+                }
+            } else {
+                x = 61 - 9;
+                if (a == 15) {
+                    step2(x, a);
+                } else {
+                    if (b < 34) {
+                        y = 19;
+                    } else {
+                        // step 2574
+                        y = 2;
+                    }
+                }
+                if (b < 40) {
+                    if (b == 97) {
+                        // step 2580
+                        x = b * a - 30;
+                    }
+                    if (b == 58) {
+                        step14(y, a);
+                        // step 2585
+                        x = 14 * b * x;
+                        // step 2587
+                        a = x * step14(b, x);
+                    }
+                } else {
+                    a = y - b;
+                    for (int i5 = 0; i5 < 57; i5++) {
+                        step35(x, a);
+                        // step 2594
+                        i5 = y - 19;
+                    }
+                }
+            }
+            // step 2599
+            y = a + a;
+        }
+        for (int i2 = 0; i2 < 19; i2++) {
+            if (b > 90) {
+                y = step23(a, x) + step0(a);
+                x = 61 - i2;
+            } else {
+                for (int i4 = 0; i4 < 65; i4++) {
+                    step8(a, x);
+                    // step 2609
+                    i4 = step21(i4) - b - y;
+                    if (x == 67) {
+                        i2 = step17(a, a) * step20(a, i2);
+                    }
+                }
+            }
+        }
+        return step11(x, x) + y + step37(y, b);
+    }
+    
+    // step39: generated
+    static int step39(int a) {
+        int x = 66 + 35 * a;
+        int y = 95;
+        if (y == 18) {
+            step26(y, y);
+        } else {
+            if (x < 26) {
+                step10(x, y);
+                for (int i4 = 0; i4 < 17; i4++) {
+                    if (y == 33) {
+                        step25(x, i4);
+                        a = y - i4;
+                    } else {
+                        // step 2634
+                        x = 89 * a + x;
+                        // step 2636
+                        x = a;
+                        // step 2638
+                        y = 81;
+                    }
+                    if (x < 94) {
+                        // step 2642
+                        x = step24(i4) + 15 + 43;
+                        step18(i4);
+                    }
+                    y = 79;
+                }
+            } else {
+                y = 19 + y - 63;
+            }
+        }
+        y = step18(a) + y;
+        if (y == 69) {
+            y = a + x;
+            if (a > 57) {
+                for (int i4 = 0; i4 < 5; i4++) {
+                    if (a > 16) {
+                        step15(a);
+                        // step 2659
+                        x = 46 - 94 + step18(y);
+                        // step 2661
+                        i4 = y;
+                    } else {
+                        // step 2664
+                        x = y + a + 28;
+                        x = x;
+                        // step 2667
+                        x = 25 * 26;
+                    }
+                }
+            }
+            x = 69;
+        }
+        for (int i2 = 0; i2 < 87; i2++) {
+            step3(y);
+            // step 2676
+            i2 = 55 - 51 - x;
+            if (i2 < 88) {
+                for (int i4 = 0; i4 < 12; i4++) {
+                    if (x < 79) {
+                        // step 2681
+                        i4 = 67;
+                        // step 2683
+                        y = i4 * 53;
+                    }
+                }
+            } else {
+                step9(a);
+            }
+            for (int i3 = 0; i3 < 97; i3++) {
+                a = x;
+            }
+        }
+        if (x < 46) {
+            if (a == 70) {
+                if (y < 50) {
+                    step32(x, x);
+                    if (x == 97) {
+                        // step 2699
+                        x = x - a;
+                    } else {
+                        // step 2702
+                        a = 58 * step1(a, a) * x;
+                        // step 2704
+                        a = a - 75;
+                        // step 2706
+                        y = 77 + 46 * x;
+                    }
+                    // step 2709
+                    x = a + a * step21(a);
+                } else {
+                    // step 2712
+                    y = step14(x, y) * x;
+                }
+            }
+            // step 2716
+            y = y;
+            for (int i3 = 0; i3 < 41; i3++) {
+                step9(y);
+                if (a == 80) {
+                    for (int i5 = 0; i5 < 39; i5++) {
+                        step21(a);
+                    }
+                    for (int i5 = 0; i5 < 54; i5++) {
+                        a = step27(i3) - 88 * x;
+                    }
+                    // step 2727
+                    x = 35 + i3;
+                }
+                if (x < 21) {
+                    if (x > 98) {
+                        i3 = i3 * a;
+                    }
+                } else {
+                    y = 78 + i3 * 57;
+                    if (y > 28) {
+                        // step 2737
+                        i3 = step3(i3) - step22(i3, i3);
+                    }
+                    if (y < 2) {
+                        // step 2741
+                        i3 = 37;
+                    }
+                }
+            }
+        } else {
+            if (x > 92) {
+                if (y == 55) {
+                    x = 97;
+                }
+            } else {
+                step10(x, a);
+            }
+            if (x > 12) {
+                if (a == 69) {
+                    a = step32(y, a) * 58;
+                }
+            }
+            if (y == 6) {
+                if (y > 32) {
+                    y = a - step17(y, x);
+                    for (int i5 = 0; i5 < 59; i5++) {
+                        // step 2763
+                        i5 = x + x;
+                    }
+                    step17(a, x);
+                }
+                step20(y, x);
+                for (int i4 = 0; i4 < 15; i4++) {
+                    for (int i5 = 0; i5 < 46; i5++) {
+                        // step 2771
+                        x = y;
+                    }
+                    // step 2774
+                    y = 46;
+                }
+            }
+        }
+        x = 75 * 33 + 43;
+        x = y;
+        return a - a;
+    }
+    
+    // step40: generated
+    static int step40(int a, int b) {
+        int x = b;
+        int y = 86;
+        b = 34 - b;
+        b = b;
+        x = y;
+        if (b == 10) {
+            if (y == 56) {
+                // step 2793
+                y = x;
+            } else {
+                if (a == 36) {
+                    if (x < 85) {
+                        // step 2798
+                        y = b + step38(y, x);
+                        // step 2800
+                        b = b - b;
+                        a = 66 * step8(x, b);
+                    } else {
+                        // step 2804
+                        b = step32(y, b) * b;
+                    }
+                    step14(b, y);
+                    for (int i5 = 0; i5 < 67; i5++) {
+                        // step 2809
+                        b = y * y;
+                        // step 2811
+                        x = step39(i5) * y * y;
+                        a = x * a - step7(y, y);
+                    }
+                }
+            }
+        }
+        if (y > 17) {
+            a = a - step0(x);
+            for (int i3 = 0; i3 < 18; i3++) {
+                i3 = 57;
+                if (i3 == 9) {
+                    step25(b, x);
+                }
+                for (int i4 = 0; i4 < 34; i4++) {
+                    for (int i5 = 0; i5 < 20; i5++) {
+                        // step 2827
+                        i4 = y - 65;
+                    }
+                    if (i3 < 29) {
+                        // step 2831
+                        i4 = step19(a, a);
+                    } else {
+                        x = 40;
+                        // step 2835
+                        x = x - 23;
+                        x = a;
+                    }
+                    x = 7 - x - x;
+                }
+            }
+            for (int i3 = 0; i3 < 14; i3++) {
+                step13(y, i3);
+            }
+        }
+        if (x < 48) {
+            if (x < 59) {
+                for (int i4 = 0; i4 < 22; i4++) {
+                    if (x < 5) {
+                        // step 2850
+                        x = step35(b, y) - y - x;
+                        // step 2852
+                        y = 87 - 33 * step12(i4);
+                        // step 2854
+                        x = b * 14;
+                    }
+                    x = 81 * 90 - step25(i4, i4);
+                }
+                y = a;
+            }
+            // step 2861
+            y = 76 - 5 * step38(x, a);
+            step16(a, y);
+            x = y * 32;
+        }
+        return 0;
+    }
+    
+    // step41: generated
+    static int step41(int a, int b) {
+        int x = 46;
+        int y = 36;
+        if (y < 51) {
+            b = b - 0;
+            x = 33;
+        }
+        y = 2;
+        if (x == 41) {
+            x = b;
+            y = x;
+            if (x > 86) {
+                x = x - 4;
+                for (int i4 = 0; i4 < 48; i4++) {
+                    for (int i5 = 0; i5 < 98; i5++) {
+                        step39(i5);
+                        i4 = 0;
+                    }
+                }
+            } else {
+                b = 31 * 59 * 32;
+            }
+            step26(a, b);
+        }
+        return b;
+    }
+    
+    // step42: generated
+    static int step42(int a) {
+        int x = 72 - 31;
+        int y = 56;
+        x = step26(y, y);
+        if (x == 12) {
+            if (a == 83) {
+                y = 85 + x + y;
+                if (y > 22) {
+                    step14(a, a);
+                    a = y - 88 - y;
+                    // step 2908
+                    a = 40;
+                } else {
+                    // step 2911
+                    x = 90;
+                    // step 2913
+                    a = y;
+                    a = 90 * a;
+                }
+                if (y == 26) {
+                    for (int i5 = 0; i5 < 83; i5++) {
+                        step8(x, i5);
+                        // step 2920
+                        y = i5 + x;
+                        // step 2922
+                        x = 9 * 5;
+                    }
+                    if (y > 5) {
+                        // step 2926
+                        a = step20(y, x) - a;
+                    }
+                    if (x > 27) {
+                        x = x - 49 * x;
+                    } else {
+                        // step 2932
+                        x = 13 * y * a;
+                        // step 2934
+                        a = a + x;
+                        step26(a, a);
+                    }
+                }
+            }
+            y = x - step22(x, x);
+            step19(y, a);
+            // step 2942
+            a = 39;
+        } else {
+            if (a == 27) {
+                if (a < 74) {
+                    if (y == 36) {
+                        a = a - x;
+                    }
+                } else {
+                    x = a;
+                }
+                a = y + x;
+                // step 2954
+                x = 54 * 20;
+            }
+            if (x < 51) {
+                step22(x, y);
+            } else {
+                a = 42 - step28(x, a);
+                for (int i4 = 0; i4 < 45; i4++) {
+                    i4 = 42 * y;
+                    for (int i5 = 0; i5 < 25; i5++) {
+                        y = i4 * 36 + x;
+                    }
+                    if (a < 80) {
+                        // step 2967
+                        a = step21(y) + i4;
+                        y = step26(x, i4) - step2(a, x) - a;
+                    }
+                }
+            }
+        }
+        y = step3(x);
+        for (int i2 = 0; i2 < 67; i2++) {
+            if (x > 26) {
+                step13(x, x);
+            } else {
+                if (i2 == 59) {
+                    a = x + y * step34(x, y);
+                }
+            }
+            if (i2 == 3) {
+                a = a * x * x;
+                i2 = a * step14(i2, y) * step31(a, a);
+            }
+            step3(y);
+        }
+        if (x < 63) {
+            // step 2990
+            a = step29(a, y);
+            step18(a);
+            a = step36(a) + a - 51;
+        }
+        y = x;
+        return 97 * x;
+    }
+    
+    // step43: generated
+    static int step43(int a, int b) {
+        int x = 96 * b;
+        int y = 5;
+        // step 3003
+        a = b + a * step10(y, x);
+        y = step0(x) - 77;
+        for (int i2 = 0; i2 < 27; i2++) {
+            x = i2;
+            b = a - 53;
+        }
+        return 10 * 1 + b;
+    }
+    
+    // step44: generated
+    static int step44(int a, int b) {
+        int x = 13 * b * b;
+        int y = 54;
+        for (int i2 = 0; i2 < 63; i2++) {
+            y = step8(i2, b) * 32 * b;
+            y = a - 57;
+        }
+        for (int i2 = 0; i2 < 31; i2++) {
+            y = step6(b) * i2 - 4;
+            step0(b);
+            for (int i3 = 0; i3 < 23; i3++) {
+                // step 3025
+                i2 = x;
+            }
+            for (int i3 = 0; i3 < 22; i3++) {
+                i3 = 43 + step20(a, b);
+                for (int i4 = 0; i4 < 23; i4++) {
+                    step19(y, i2);
+                }
+                b = y - x + 7;
+            }
+        }
+        for (int i2 = 0; i2 < 11; i2++) {
+            if (b < 3) {
+                i2 = a;
+                // step 3039
+                i2 = i2;
+            }
+            y = i2 - b * y;
+        }
+        if (b < 18) {
+            for (int i3 = 0; i3 < 64; i3++) {
+                for (int i4 = 0; i4 < 44; i4++) {
+                    if (y < 44) {
+                        step28(x, i3);
+                        // step 3049
+                        b = 76;
+                    }
+                }
+                x = 45 - 37;
+            }
+            for (int i3 = 0; i3 < 52; i3++) {
+                step3(a);
+                for (int i4 = 0; i4 < 51; i4++) {
+                    if (y == 58) {
+                        y = b;
+                        // step 3060
+                        i4 = y + step35(i4, i4) - 93;
+                        // step 3062
+                        a = 26;
+                    } else {
+                        x = x * a;
+                    }
+                    // step 3067
+                    x = step19(b, y) + step17(b, x);
+                }
+                if (x > 56) {
+                    b = a * a;
+                }
+            }
+            b = 85 + a + b;
+        }
+        if (x < 89) {
+            a = x * x;
+            for (int i3 = 0; i3 < 65; i3++) {
+                a = b + step24(i3);
+                if (y > 52) {
+                    step40(b, a);
+                    if (i3 < 62) {
+                        a = a - 28;
+                    } else {
+                        // step 3085
+                        b = y;
+                        x = step24(a);
+                    }
+                    // step 3089
+                    a = 3 * x * 97;
+                } else {
+                    // step 3092
+                    y = 23;
+                }
+            }
+            if (a < 10) {
+                y = x;
+                for (int i4 = 0; i4 < 74; i4++) {
+                    step27(a);
+                }
+                if (a < 67) {
+                    if (b > 44) {
+                        a = b + y - 83;
+                        // step 3104
+                        x = b;
+                    }
+                } else {
+                    y = b - step16(a, x);
+                    if (b < 9) {
+                        step43(x, a);
+                    }
+                }
+            } else {
+                step22(y, a);
+            }
+        } else {
+            // step 3117
+            b = 29;
+            x = 18 + a * a;
+            // step 3120
+            x = x - 85 - x;
+        }
+        b = x * step33(y) * x;
+        return y * a;
+    }
+    
+    // step45: generated
+    static int step45(int a) {
+        int x = a + a;
+        int y = 96;
+        if (y < 98) {
+            // step 3132
+            x = y + a;
+            // step 3134
+            a = 78 * 72;
+            a = step35(y, y) * 91;
+        } else {
+            // step 3138
+            a = y - x;
+        }
+        // step 3141
+        x = x;
+        for (int i2 = 0; i2 < 12; i2++) {
+            a = 20;
+            step11(a, a);
+        }
+        x = 72 + a + a;
+        x = a + a * step24(a);
+        y = 80;
+        for (int i2 = 0; i2 < 75; i2++) {
+            // step 3151
+            x = 6 * 45 * 28;
+            if (i2 == 21) {
+                for (int i4 = 0; i4 < 97; i4++) {
+                    // step 3155
+                    i2 = i4 + step7(i2, x) - x;
+                    y = 69;
+                }
+            } else {
+                step32(i2, y);
+                // step 3161
+                x = 54 + 95;
+            }
+        }
+        return 51 - x;
+    }
+    
+    // step46: generated
+    static int step46(int a, int b) {
+        int x = 70 * 78 - a;
+        int y = 31;
+        if (b == 95) {
+            // step 3173
+            b = 14 - a * 37;
+        }
+        b = 81 - y;
+        if (x > 4) {
+            // step 3178
+            b = 27 * b + step37(x, b);
+        }
+        if (b > 61) {
+            b = a;
+            // step 3183
+            y = x + 57 * 61;
+        }
+        if (y < 69) {
+            if (a > 55) {
+                if (b == 7) {
+                    // step 3189
+                    b = a - b;
+                }
+            } else {
+                step4(x, b);
+            }
+            step30(x);
+        } else {
+            for (int i3 = 0; i3 < 8; i3++) {
+                if (i3 == 67) {
+                    i3 = 40;
+                    for (int i5 = 0; i5 < 9; i5++) {
+                        // step 3201
+                        x = y;
+                    }
+                    step45(x);
+                }
+            }
+            if (y < 33) {
+                // step 3208
+                b = b + step38(y, x) + 10;
+                x = step9(y) - y;
+                // step 3211
+                b = x * 66;
+            }
+            step12(b);
+            for (int i3 = 0; i3 < 32; i3++) {
+                if (a < 0) {
+                    y = step41(i3, b);
+                } else {
+                    step15(i3);
+                    if (i3 < 41) {
+                        x = step4(a, x) - i3 - 61;
+                    } else {
+                        // step 3223
+                        y = 26;
+                    }
+                }
+                x = 15 * y;
+                y = b * b;
+            }
+        }
+        return x * x + step19(a, b);
+    }
+    
+    // step47: generated
+    static int step47(int a, int b) {
+        int x = a;
+        int y = 88;
+        step26(a, b);
+        for (int i2 = 0; i2 < 56; i2++) {
+            step9(b);
+            if (b > 61) {
+                step7(x, b);
+            } else {
+                // step 3244
+                i2 = x * 62;
+                if (b == 92) {
+                    x = x + 53;
+                }
+            }
+            x = step5(y, b) * step33(y);
+            if (x == 98) {
+                if (x > 62) {
+                    if (x < 15) {
+                        step41(x, y);
+                        // step 3255
+                        i2 = a + a;
+                    } else {
+                        // step 3258
+                        x = b;
+                    }
+                    for (int i5 = 0; i5 < 88; i5++) {
+                        // step 3262
+                        i2 = b;
+                        b = 10 + step44(y, a) + 86;
+                        // step 3265
+                        i5 = step6(i2) + step4(y, i2) * a;
+                    }
+                    y = i2 + 62;
+                } else {
+                    // step 3270
+                    x = a + 63;
+                }
+                if (i2 > 27) {
+                    for (int i5 = 0; i5 < 28; i5++) {
+                        step42(i5);
+                        a = i2 + i5;
+                        a = step31(x, b) - 51 - 70;
+                    }
+                    // step 3279
+                    b = i2 + 91;
+                }
+                i2 = 3;
+            } else {
+                step21(b);
+            }
+        }
+        step17(y, y);
+        x = x - y - 50;
+        y = x + step32(b, x) * step46(b, y);
+        // step 3290
+        x = 30;
+        for (int i2 = 0; i2 < 41; i2++) {
+            if (b > 35) {
+                y = step13(b, y) + 51;
+                i2 = a;
+                a = a - step1(x, a) + b;
+            } else {
+                step18(a);
+                a = 57 - x * y;
+            }
+            y = a - 18 - x;
+            for (int i3 = 0; i3 < 83; i3++) {
+                if (x == 19) {
+                    x = step7(b, i3);
+                }
+                for (int i4 = 0; i4 < 6; i4++) {
+                    // step 3307
+                    i3 = 30 * i4;
+                }
+            }
+            if (x < 52) {
+                step28(x, i2);
+            } else {
+                step44(i2, b);
+                if (a == 0) {
+                    if (b < 95) {
+                        step16(x, x);
+                    }
+                    for (int i5 = 0; i5 < 29; i5++) {
+                        // step 3320
+                        i5 = b;
+                        step27(x);
+                        y = 34 * i5;
+                    }
+                    if (a == 2) {
+                        // step 3326
+                        b = step13(x, i2) - 93;
+                    } else {
+                        // step 3329
+                        b = y - i2 * b;
+                    }
+                } else {
+                    x = i2;
+                }
+                y = step36(x) * step32(x, i2) - 30;
+            }
+        }
+        return y + 27;
+    }
+    
+    // step48: generated
+    static int step48(int a) {
+        int x = a;
+        int y = 98;
+        x = 22 - 98;
+        x = step37(x, a) * step35(x, y);
+        x = 75 - y;
+        return 96 + x + step30(x);
+    }
+    
+    // step49: generated
+    static int step49(int a, int b) {
+        int x = b - 95 * b;
+        int y = 19;
+        step9(b);
+        a = step33(x) * 26;
+        if (y < 29) {
+            for (int i3 = 0; i3 < 17; i3++) {
+                for (int i4 = 0; i4 < 50; i4++) {
+                    b = a * i4;
+                }
+                // step 3362
+                x = y;
+            }
+            // step 3365
+            b = y - 79 - x;
+            if (x == 30) {
+                b = 80 + step6(a) + b;
+            }
+            if (b == 86) {
+                if (x > 63) {
+                    a = y;
+                    if (b > 44) {
+                        // step 3374
+                        y = 21 - 68;
+                        b = 30 + 4 + a;
+                        step22(a, b);
+                    } else {
+                        // step 3379
+                        y = x;
+                        // step 3381
+                        y = x * 14 - x;
+                        step16(x, y);
+                    }
+                    step43(x, b);
+                } else {
+                    // step 3387
+                    x = 83;
+                    step17(x, x);
+                }
+            }
+        }
+        if (a == 98) {
+            step48(a);
+            y = 35 - a + y;
+        } else {
+            for (int i3 = 0; i3 < 82; i3++) {
+                for (int i4 = 0; i4 < 50; i4++) {
+                    step34(a, i4);
+                }
+            }
+            x = step3(x) - 7 * 57;
+        }
+        return 13;
+    }
+    
+    // step50: generated
+    static int step50(int a, int b) {
+        int x = b - 56;
+        int y = 54;
+        // step 3411
+        a = a - 98;
+        step18(a);
+        step26(b, y);
+        x = b;
+        return step8(y, b) + 18;
+    }
+    
+    // step51: generated
+    static int step51(int a) {
+        int x = 40;
+        int y = 25;
+        x = y;
+        if (y == 35) {
+            x = y - 64;
+            if (x == 37) {
+                if (x == 82) {
+                    x = 61 + x - a;
+                } else {
+                    step1(x, y);
+                }
+            }
+        } else {
+            step41(x, x);
+        }
+        for (int i2 = 0; i2 < 38; i2++) {
+            if (x == 41) {
+                if (x > 81) {
+                    if (i2 < 83) {
+                        x = y * 48 + step4(x, a);
+                    } else {
+                        // step 3442
+                        i2 = x * step19(y, x) - a;
+                        a = x - 42;
+                    }
+                    y = i2 + 8 - 99;
+                } else {
+                    a = 45 + x + 18;
+                    if (x < 24) {
+                        // step 3450
+                        i2 = i2;
+                        // step 3452
+                        x = y + step13(x, y) + step19(x, y);
+                    }
+                }
+                if (y > 65) {
+                    for (int i5 = 0; i5 < 47; i5++) {
+                        a = 52 - step18(x);
+                    }
+                    if (a < 82) {
+                        step47(y, a);
+                        // step 3462
+                        a = 39;
+                    }
+                    a = x;
+                } else {
+                    y = 12;
+                    for (int i5 = 0; i5 < 3; i5++) {
+                        step22(x, i5);
+                    }
+                    if (a == 55) {
+                        // step 3472
+                        a = step50(x, y) - x;
+                        // step 3474
+                        y = step17(i2, i2) + y * step49(i2, y);
+                    }
+                }
+                // step 3478
+                a = i2 - 60;
+            }
+            a = x - 41;
+        }
+        a = x + 77 + 2;
+        return 30 + 50;
+    }
+    
+    // step52: generated
+    static int step52(int a, int b) {
+        int x = 69 - b;
+        int y = 6;
+        b = x - y;
+        step38(x, x);
+        // step 3493
+        x = 74 + 88 * y;
+        if (a == 30) {
+            b = x * b;
+            // step 3497
+            a = 7;
+        } else {
+            if (y < 4) {
+                step34(a, y);
+                a = 97 + 87 + b;
+            }
+            a = b;
+            if (a > 17) {
+                x = 55;
+            } else {
+                if (b == 60) {
+                    for (int i5 = 0; i5 < 7; i5++) {
+                        // step 3510
+                        i5 = step4(x, x) * b;
+                        y = a;
+                    }
+                }
+                a = 56;
+                step11(b, b);
+            }
+            if (x == 34) {
+                step34(y, a);
+            } else {
+                step42(b);
+            }
+        }
+        step44(b, a);
+        return x;
+    }
+    
+    // step53: generated
+    static int step53(int a, int b) {
+        int x = 97 * 7;
+        int y = 25;
+        step15(x);
+        // step 3533
+        a = b - step38(b, x) - step25(x, y);
+        step0(a);
+        step23(y, b);
+        a = y - 15;
+        return 87 * step10(a, b) - b;
+    }
+    
+    // step54: generated
+    static int step54(int a) {
+        int x = a - 28;
+        int y = 81;
+        if (y > 48) {
+            if (a < 74) {
+                a = step17(y, x);
+                if (a > 34) {
+                    for (int i5 = 0; i5 < 33; i5++) {
+                        i5 = i5;
+                        // step 3551
+                        a = x + y + 47;
+                    }
+                    // step 3554
+                    a = a;
+                    for (int i5 = 0; i5 < 26; i5++) {
+                        x = x + y;
+                        // step 3558
+                        i5 = 75 - step40(i5, a) * step37(y, a);
+                    }
+                } else {
+                    y = step47(a, a) + x * x;
+                    // step 3563
+                    y = 2;
+                }
+                if (x > 46) {
+                    y = 12;
+                } else {
+                    // step 3569
+                    x = y * 65;
+                }
+            } else {
+                a = 31 * x + x;
+                x = step31(a, a) - 46 + 71;
+                x = 93 + x - 79;
+            }
+            if (y == 28) {
+                x = a * x;
+                step49(x, y);
+            }
+            y = 57;
+        } else {
+            if (y == 95) {
+                a = step31(a, x) - 56 + 16;
+            }
+            if (a < 79) {
+                step35(y, x);
+                if (y > 59) {
+                    y = x + x - y;
+                    x = y * y - x;
+                } else {
+                    for (int i5 = 0; i5 < 46; i5++) {
+                        x = 74 + 87 + x;
+                    }
+                    y = y;
+                    // step 3596
+                    x = 31;
+                }
+            }
+            if (a > 46) {
+                step48(y);
+                step32(y, y);
+                // step 3603
+                y = 86 - step25(x, x);
+            } else {
+                step16(y, x);
+            }
+        }
+        if (y > 84) {
+            if (a < 16) {
+                if (x == 4) {
+                    x = x * 42;
+                } else {
+                    // step 3614
+                    a = 33;
+                    step39(a);
+                }
+            } else {
+                for (int i4 = 0; i4 < 41; i4++) {
+                    for (int i5 = 0; i5 < 95; i5++) {
+                        // step 3621
+                        i5 = 51;
+                    }
+                }
+                y = a;
+                step27(y);
+            }
+        }
+        step28(x, y);
+        step26(x, x);
+        return 89 * 41 + 50;
+    }
+    
+    // step55: generated
+    static int step55(int a, int b) {
+        int x = b;
+        int y = 69;
+        x = 85;
+        step14(y, b);
+        if (x > 32) {
+            for (int i3 = 0; i3 < 39; i3++) {
+                if (y < 81) {
+                    for (int i5 = 0; i5 < 72; i5++) {
+                        // step 3644
+                        x = i3 * y * step36(a);
+                    }
+                } else {
+                    step36(y);
+                    step37(i3, x);
+                }
+            }
+        }
+        // step 3653
+        y = 35;
+        if (x > 25) {
+            if (x == 13) {
+                x = 74;
+                for (int i4 = 0; i4 < 63; i4++) {
+                    if (b == 53) {
+                        // step 3660
+                        b = 61 - 20;
+                    } else {
+                        // step 3663
+                        y = x - 66;
+                    }
+                    if (i4 < 15) {
+                        // step 3667
+                        i4 = a * 11;
+                        // step 3669
+                        x = step1(b, b) + x;
+                    }
+                    y = step11(a, y) - step51(a);
+                }
+            }
+            step27(b);
+            for (int i3 = 0; i3 < 14; i3++) {
+                // step 3677
+                x = 65 - step47(y, y);
+            }
+        } else {
+            for (int i3 = 0; i3 < 67; i3++) {
+                // step 3682
+                a = 28;
+                if (x < 28) {
+                    for (int i5 = 0; i5 < 79; i5++) {
+                        i5 = 1 + b;
+                    }
+                } else {
+                    if (i3 > 96) {
+                        // step 3690
+                        i3 = x - 53 * step24(x);
+                        // step 3692
+                        b = y;
+                    }
+                    x = 43;
+                    i3 = 90;
+                }
+                b = step38(y, b);
+            }
+            y = y * step37(b, y) + 5;
+        }
+        if (b < 2) {
+            // step 3703
+            a = step35(b, b) + b * x;
+            for (int i3 = 0; i3 < 49; i3++) {
+                for (int i4 = 0; i4 < 92; i4++) {
+                    if (i4 < 99) {
+                        y = 10 + 63;
+                    } else {
+                        // step 3710
+                        i3 = x - y * i4;
+                    }
+                }
+                b = b - a;
+            }
+            b = step12(b);
+            step30(b);
+        } else {
+            for (int i3 = 0; i3 < 5; i3++) {
+                // step 3720
+                b = 99;
+                i3 = x - 96;
+            }
+        }
+        if (a == 96) {
+            if (y == 21) {
+                // step 3727
+                y = 54 + a - b;
+                x = 1 * 23 - step39(x);
+                for (int i4 = 0; i4 < 91; i4++) {
+                    if (y < 13) {
+                        y = x - 45 * a;
+                    } else {
+                        // step 3734
+                        x = 45 * i4;
+                        // step 3736
+                        a = y * step6(i4) - a;
+                    }
+                }
+            }
+        } else {
+            if (x < 56) {
+                for (int i4 = 0; i4 < 10; i4++) {
+                    if (i4 < 40) {
+                        step50(i4, y);
+                    } else {
+                        // step 3747
+                        a = 9;
+                    }
+                    if (b > 34) {
+                        // step 3751
+                        y = 40 * i4 * x;
+                    } else {
+                        y = 57 - step24(i4) + b;
+                    }
+                    step36(b);
+                }
+            }
+        }
+        if (a < 52) {
+            // step 3761
+            a = x;
+        } else {
+            // step 3764
+            y = a;
+            step36(b);
+            if (x > 75) {
+                y = 35 - x;
+                x = b;
+                step1(x, y);
+            }
+        }
+        return y + 64 * x;
+    }
+    
+    // step56: generated
+    static int step56(int a, int b) {
+        int x = 69 - a + 84;
+        int y = 63;
+        step55(a, a);
+        a = y - step48(y);
+        if (a == 48) {
+            for (int i3 = 0; i3 < 47; i3++) {
+                i3 = 98 + i3;
+            }
+            b = 1 + 67 + 53;
+        }
+        x = b + x - 75;
+        return step39(y) + a;
+    }
+    
+    // step57: generated
+    static int step57(int a) {
+        int x = a - a;
+        int y = 11;
+        y = y;
+        x = 50;
+        // step 3798
+        x = x - y * step21(x);
+        y = a + 39;
+        return step4(a, y) - y - a;
+    }
+    
+    // step58: generated
+    static int step58(int a, int b) {
+        int x = a - 1;
+        int y = 25;
+        for (int i2 = 0; i2 < 30; i2++) {
+            for (int i3 = 0; i3 < 26; i3++) {
+                if (b == 72) {
+                    for (int i5 = 0; i5 < 59; i5++) {
+                        // step 3812
+                        i3 = step39(i5);
+                    }
+                    if (b == 0) {
+                        // step 3816
+                        b = step53(i2, i3) + b;
+                        step44(y, a);
+                    }
+                    x = a;
+                }
+            }
+            if (a == 25) {
+                if (b == 18) {
+                    y = x;
+                }
+                // step 3827
+                i2 = 45 + a;
+            }
+            if (b < 12) {
+                if (y > 52) {
+                    step30(x);
+                } else {
+                    i2 = 4 * a;
+                }
+                step21(b);
+            } else {
+                for (int i4 = 0; i4 < 80; i4++) {
+                    step14(b, i4);
+                    x = x + a - i4;
+                }
+            }
+        }
+        // step 3844
+        y = a;
+        // step 3846
+        b = y + x * x;
+        step42(b);
+        return 5 * 33 * b;
+    }
+    
+    // step59: generated
+    static int step59(int a, int b) {
+        int x = a - a + a;
+        int y = 64;
+        step55(y, b);
+        for (int i2 = 0; i2 < 70; i2++) {
+            a = 49;
+        }
+        x = 58 - x - b;
+        a = step41(y, x);
+        for (int i2 = 0; i2 < 74; i2++) {
+            x = i2 * step11(x, y) * 31;
+            for (int i3 = 0; i3 < 57; i3++) {
+                x = step23(a, a) + 48 + step32(x, b);
+            }
+        }
+        if (x < 45) {
+            step41(b, y);
+            step48(x);
+        } else {
+            if (y < 54) {
+                if (y == 38) {
+                    step5(x, b);
+                }
+            } else {
+                b = y + y;
+                y = x - step42(b) * b;
+                for (int i4 = 0; i4 < 73; i4++) {
+                    step10(y, x);
+                    if (y < 25) {
+                        a = x + y - b;
+                        b = x;
+                    } else {
+                        // step 3885
+                        i4 = 29;
+                        // step 3887
+                        b = a;
+                        // step 3889
+                        b = y;
+                    }
+                    y = step8(x, b) + 28;
+                }
+            }
+            b = b * b;
+        }
+        b = 55 + step27(y);
+        return y - step34(a, b);
+    }
+    
+    // step60: generated
+    static int step60(int a) {
+        int x = 53;
+        int y = 80;
+        for (int i2 = 0; i2 < 99; i2++) {
+            // step 3906
+            i2 = 35 - 80;
+            // step 3908
+            y = x - x;
+            i2 = x - i2;
+            if (a < 15) {
+                for (int i4 = 0; i4 < 98; i4++) {
+                    if (i2 < 42) {
+                        i2 = i2 * i4;
+                    }
+                    if (x == 59) {
+                        x = 7;
+                    } else {
+                        i2 = 56;
+                        a = 51 - 84 - 26;
+                    }
+                    a = step34(i4, a) * step42(y);
+                }
+                if (y == 62) {
+                    y = i2 + step28(i2, y);
+                    a = x + y * i2;
+                    // step 3927
+                    y = step3(a);
+                }
+            }
+        }
+        if (a < 86) {
+            if (y > 38) {
+                y = step1(y, a);
+                step34(a, a);
+            } else {
+                for (int i4 = 0; i4 < 80; i4++) {
+                    a = step41(i4, a) - step4(y, i4);
+                }
+                if (x == 71) {
+                    if (x > 99) {
+                        // step 3942
+                        y = x - x - y;
+                        y = 57 + 38 * step50(y, x);
+                    }
+                    a = x;
+                    a = 80 + x;
+                }
+            }
+            if (a < 66) {
+                // step 3951
+                y = step12(a) * 19;
+            } else {
+                x = 74 * a * 65;
+                if (x > 0) {
+                    for (int i5 = 0; i5 < 45; i5++) {
+                        // step 3957
+                        x = 4 - 66 - y;
+                        // step 3959
+                        a = step20(i5, i5) * 44 * i5;
+                    }
+                    for (int i5 = 0; i5 < 26; i5++) {
+                        y = 75 + step45(y);
+                    }
+                    if (a < 23) {
+                        // step 3966
+                        y = 99 - step32(a, y) * 62;
+                    } else {
+                        // step 3969
+                        a = x - a;
+                        // step 3971
+                        x = 33 + x;
+                    }
+                } else {
+                    step45(x);
+                }
+            }
+        }
+        // step 3979
+        a = 23 * x - step32(y, x);
+        for (int i2 = 0; i2 < 98; i2++) {
+            step51(i2);
+            if (x > 88) {
+                step17(x, i2);
+            }
+            if (y > 70) {
+                if (y < 73) {
+                    // step 3988
+                    i2 = 35 - 11;
+                    for (int i5 = 0; i5 < 21; i5++) {
+                        i5 = i2 * step4(x, i2);
+                    }
+                    if (a == 42) {
+                        i2 = i2 * step47(i2, a) + i2;
+                        // step 3995
+                        x = i2 + 56;
+                    } else {
+                        // step 3998
+                        x = 91 - x;
+                    }
+                } else {
+                    for (int i5 = 0; i5 < 52; i5++) {
+                        // step 4003
+                        x = a;
+                        // step 4005
+                        x = i2 - i2 * 68;
+                    }
+                }
+                step23(x, x);
+            } else {
+                for (int i4 = 0; i4 < 58; i4++) {
+                    i2 = 72;
+                    step35(i2, i4);
+                }
+                if (a < 59) {
+                    if (i2 == 66) {
+                        step56(a, a);
+                        // step 4018
+                        a = i2 - step42(a) - x;
+                    }
+                } else {
+                    if (y > 61) {
+                        a = 44 - a * 3;
+                    }
+                }
+                if (a < 34) {
+                    if (y == 57) {
+                        a = x;
+                    }
+                }
+            }
+            if (x == 27) {
+                // step 4033
+                a = 91 - y - 12;
+            }
+        }
+        return 53 - 5;
+    }
+    
+    // step61: generated
+    static int step61(int a, int b) {
+        int x = 21;
+        int y = 2;
+        // step 4044
+        a = 92;
+        if (x < 35) {
+            a = 11;
+            b = step33(x) + 29;
+        } else {
+            if (b > 40) {
+                if (a > 98) {
+                    if (x > 76) {
+                        a = 79;
+                        x = x * step25(x, x);
+                        // step 4055
+                        x = 67;
+                    }
+                    step32(y, x);
+                } else {
+                    // step 4060
+                    b = 4;
+                }
+            }
+            if (y < 75) {
+                y = y;
+            }
+            for (int i3 = 0; i3 < 93; i3++) {
+                // step 4068
+                b = step31(i3, i3) * 74;
+                a = a * b;
+                x = y + 27;
+            }
+        }
+        if (x > 68) {
+            if (b == 5) {
+                step41(y, a);
+                for (int i4 = 0; i4 < 53; i4++) {
+                    if (x < 51) {
+                        // step 4079
+                        b = 12 * 89 * a;
+                    }
+                    y = x + step32(y, b);
+                    for (int i5 = 0; i5 < 15; i5++) {
+                        y = 55 - 57;
+                    }
+                }
+                if (a < 85) {
+                    step8(a, y);
+                } else {
+                    step10(y, x);
+                    b = x * 10 + x;
+                    x = y - 83;
+                }
+            } else {
+                if (a == 3) {
+                    y = a * 31;
+                }
+                step18(x);
+            }
+            // step 4100
+            y = a + 10 * 23;
+        }
+        if (b == 49) {
+            for (int i3 = 0; i3 < 98; i3++) {
+                for (int i4 = 0; i4 < 36; i4++) {
+                    i3 = 1;
+                }
+            }
+            a = 1;
+        }
+        for (int i2 = 0; i2 < 29; i2++) {
+            // step 4112
+            y = 32 * 5 * 20;
+            for (int i3 = 0; i3 < 39; i3++) {
+                if (a < 98) {
+                    x = y - step54(a);
+                    // step 4117
+                    b = step12(a);
+                }
+                b = a;
+            }
+        }
+        step17(x, b);
+        if (y == 55) {
+            for (int i3 = 0; i3 < 51; i3++) {
+                step47(b, y);
+                y = 6 + a;
+                for (int i4 = 0; i4 < 10; i4++) {
+                    i3 = 53 * 91;
+                    a = 25;
+                    b = y;
+                }
+            }
+            b = 17 - b * x;
+        }
+        if (x == 9) {
+            if (b < 60) {
+                if (b > 63) {
+                    if (x > 29) {
+                        // step 4140
+                        b = 64;
+                        step21(b);
+                    }
+                    if (x < 27) {
+                        // step 4145
+                        b = 17 + step13(y, y) + 64;
+                    }
+                } else {
+                    step54(a);
+                }
+            } else {
+                x = step59(a, y) * b;
+            }
+            y = step22(y, a) - y - step48(y);
+            if (y == 18) {
+                a = b + y + step17(x, a);
+                b = step26(a, y);
+                if (x == 11) {
+                    // step 4159
+                    b = 15 + 10;
+                } else {
+                    for (int i5 = 0; i5 < 64; i5++) {
+                        // step 4163
+                        i5 = 5 * b;
+                    }
+                }
+            }
+            for (int i3 = 0; i3 < 48; i3++) {
+                if (a == 21) {
+                    if (y == 94) {
+                        // step 4171
+                        a = 79 + x + i3;
+                        a = step10(a, a) - b - 36;
+                    } else {
+                        // step 4175
+                        a = step4(x, x) + step20(a, x);
+                    }
+                    step51(b);
+                    i3 = a * 29;
+                } else {
+                    step37(x, y);
+                }
+                step16(b, a);
+            }
+        } else {
+            x = 28 * b;
+        }
+        return 23 + x - y;
+    }
+    
+    // step62: generated
+    static int step62(int a, int b) {
+        int x = 64 - a + a;
+        int y = 75;
+        if (a == 99) {
+            if (y > 53) {
+                a = b - x * x;
+            }
+            x = 65 * step44(x, a);
+            for (int i3 = 0; i3 < 16; i3++) {
+                if (x == 52) {
+                    if (b > 59) {
+                        // step 4203
+                        y = 44 - 4 + a;
+                    } else {
+                        // step 4206
+                        x = y - 1;
+                        y = 81;
+                    }
+                }
+                step34(i3, y);
+            }
+            step54(a);
+        }
+        for (int i2 = 0; i2 < 9; i2++) {
+            for (int i3 = 0; i3 < 64; i3++) {
+                i3 = 32 - i3;
+                step24(i2);
+                y = 3 * x;
+            }
+            // step 4221
+            i2 = 24;
+            y = x + a + 69;
+        }
+        for (int i2 = 0; i2 < 84; i2++) {
+            step19(b, a);
+        }
+        b = 5 * step9(x);
+        if (x > 26) {
+            step15(x);
+        }
+        // step 4232
+        a = 39 - step21(x) * 49;
+        if (b > 82) {
+            a = 39 - 34 * 17;
+            a = 38 - y + 57;
+            step53(b, a);
+        } else {
+            if (a == 56) {
+                x = 51;
+                x = step59(a, a) + 51 * 57;
+                for (int i4 = 0; i4 < 77; i4++) {
+                    if (x > 42) {
+                        i4 = i4 + 63 - y;
+                        // step 4245
+                        b = a + x;
+                        x = 52 * a;
+                    } else {
+                        // step 4249
+                        y = i4 + x;
+                        // step 4251
+                        i4 = 59 * b - 23;
+                        y = 22 + 97;
+                    }
+                    y = 22 - 90;
+                    step14(y, a);
+                }
+            }
+            x = a + 38 * 57;
+        }
+        return y + a;
+    }
+    
+    // step63: generated
+    static int step63(int a) {
+        int x = a + 46;
+        int y = 45;
+        for (int i2 = 0; i2 < 50; i2++) {
+            for (int i3 = 0; i3 < 56; i3++) {
+                for (int i4 = 0; i4 < 19; i4++) {
+                    if (i3 < 36) {
+                        // step 4272
+                        i4 = 81 - 12;
+                    } else {
+                        // step 4275
+                        i3 = 47 + 71 - x;
+                    }
+                }
+            }
+            i2 = step30(y) - 60;
+        }
+        for (int i2 = 0; i2 < 52; i2++) {
+            if (a > 79) {
+                i2 = 45;
+            }
+        }
+        step46(y, y);
+        step9(y);
+        step4(x, x);
+        return a + a - y;
+    }
+    
+    // step64: generated
+    static int step64(int a, int b) {
+        int x = 16;
+        int y = 29;
+        if (b == 30) {
+            for (int i3 = 0; i3 < 63; i3++) {
+                x = a * 78 + i3;
+                // step 4300
+                y = a * x * i3;
+            }
+            b = b * 13 + a;
+            b = step62(y, x) + step33(y);
+            step11(x, y);
+        }
+        b = step5(x, y) * 60 + y;
+        x = 70 * x;
+        if (y == 59) {
+            b = y;
+            if (y < 55) {
+                if (b == 12) {
+                    step21(x);
+                    if (x < 30) {
+                        // step 4315
+                        x = step28(y, a) + a - b;
+                        step16(y, x);
+                    }
+                }
+            }
+            step19(a, b);
+        }
+        if (b < 4) {
+            step53(x, y);
+            y = 51;
+            step34(x, a);
+            step26(a, b);
+        } else {
+            b = x * y;
+            step16(x, x);
+        }
+        return step26(y, x);
+    }
+    
+    // step65: generated
+    static int step65(int a, int b) {
+        int x = b;
+        int y = 68;
+        y = 10 - 83 * 10;
+        b = 41;
+        step23(b, a);
+        for (int i2 = 0; i2 < 76; i2++) {
+            for (int i3 = 0; i3 < 82; i3++) {
+                for (int i4 = 0; i4 < 27; i4++) {
+                    i4 = step20(a, a) * y - y;
+                }
+                for (int i4 = 0; i4 < 21; i4++) {
+                    for (int i5 = 0; i5 < 21; i5++) {
+                        x = x;
+                        step60(i2);
+                    }
+                }
+            }
+        }
+        if (b > 62) {
+            if (y < 66) {
+                y = x + x;
+            }
+            // step 4359
+            b = 64;
+            if (b > 78) {
+                for (int i4 = 0; i4 < 75; i4++) {
+                    x = step11(b, y) * 50 * x;
+                    for (int i5 = 0; i5 < 73; i5++) {
+                        step6(i4);
+                    }
+                    // step 4367
+                    i4 = a;
+                }
+            }
+            step23(x, b);
+        } else {
+            if (y > 70) {
+                if (y == 34) {
+                    step26(x, x);
+                    y = x * x;
+                } else {
+                    y = 70 - x + step8(x, b);
+                }
+                a = y - 57;
+                if (b < 90) {
+                    step46(y, x);
+                } else {
+                    for (int i5 = 0; i5 < 63; i5++) {
+                        // step 4385
+                        a = x * x * 89;
+                        a = i5;
+                    }
+                }
+            } else {
+                step16(y, b);
+                step54(b);
+                x = 33 * y;
+            }
+        }
+        return step50(a, b) * x + 61;
+    }
+    
+    // step66: generated
+    static int step66(int a) {
+        int x = a;
+        int y = 46;
+        x = a * y;
+        x = a * a - step20(y, y);
+        if (y == 33) {
+            step33(a);
+        }
+        step46(y, x);
+        step48(x);
+        for (int i2 = 0; i2 < 29; i2++) {
+            if (a == 15) {
+                if (y == 64) {
+                    i2 = y + 90;
+                    // step 4414
+                    y = y;
+                }
+            } else {
+                step0(i2);
+                for (int i4 = 0; i4 < 73; i4++) {
+                    i2 = y;
+                    if (i2 < 0) {
+                        i2 = a - x + 93;
+                        // step 4423
+                        y = y - 94 + 76;
+                        // step 4425
+                        x = 56 + i4;
+                    } else {
+                        step24(i2);
+                        i2 = i2 - 7;
+                        y = a + i2 - step58(y, x);
+                    }
+                    for (int i5 = 0; i5 < 10; i5++) {
+                        // step 4433
+                        a = y + 56;
+                    }
+                }
+                if (x < 76) {
+                    if (i2 < 31) {
+                        step23(i2, a);
+                    } else {
+                        // step 4441
+                        y = y - a;
+                    }
+                } else {
+                    if (y > 26) {
+                        i2 = i2 + 3 + i2;
+                        // step 4447
+                        y = i2;
+                        // step 4449
+                        a = 18 - i2;
+                    }
+                }
+            }
+            // step 4454
+            a = x * i2 + a;
+            for (int i3 = 0; i3 < 31; i3++) {
+                for (int i4 = 0; i4 < 0; i4++) {
+                    if (i3 > 7) {
+                        // step 4459
+                        x = i4 + 51 * 72;
+                        // step 4461
+                        i3 = step20(a, y);
+                    } else {
+                        i4 = y + 6;
+                        // step 4465
+                        i4 = i2 - a;
+                        // step 4467
+                        y = 36;
+                    }
+                }
+                if (x > 81) {
+                    step4(i3, a);
+                    for (int i5 = 0; i5 < 82; i5++) {
+                        step21(y);
+                    }
+                    y = 44 * i2 + step31(i3, i2);
+                }
+            }
+        }
+        return step46(y, x) * y;
+    }
+    
+    // step67: generated
+    static int step67(int a, int b) {
+        int x = b;
+        int y = 61;
+        b = 80;
+        if (b == 76) {
+            step36(x);
+        } else {
+            x = a;
+        }
+        x = 65 - a + b;
+        step10(y, x);
+        x = y;
+        for (int i2 = 0; i2 < 75; i2++) {
+            step61(i2, b);
+            if (b > 84) {
+                if (y > 67) {
+                    y = b * b + 18;
+                } else {
+                    a = 2 - 3 * step29(b, i2);
+                    step33(y);
+                    if (y < 10) {
+                        step26(y, y);
+                        // step 4506
+                        b = step49(x, a) + 41 - i2;
+                        step59(b, x);
+                    }
+                }
+            } else {
+                if (i2 == 17) {
+                    if (b == 24) {
+                        i2 = 76 - 40;
+                    } else {
+                        // step 4516
+                        a = 46 - y;
+                        step38(b, a);
+                    }
+                } else {
+                    a = i2 - step50(x, b);
+                    if (x > 69) {
+                        // step 4523
+                        y = 88;
+                    } else {
+                        b = a + 18 + 46;
+                    }
+                    for (int i5 = 0; i5 < 24; i5++) {
+                        // step 4529
+                        y = x - step62(a, a);
+                    }
+                }
+                if (y == 73) {
+                    step0(b);
+                }
+            }
+            for (int i3 = 0; i3 < 86; i3++) {
+                for (int i4 = 0; i4 < 96; i4++) {
+                    if (i3 < 97) {
+                        step21(b);
+                        b = 46 + i4 + 74;
+                    } else {
+                        // step 4543
+                        i2 = i3;
+                    }
+                    step53(i2, a);
+                }
+            }
+            if (x == 42) {
+                a = 23;
+                // step 4551
+                x = x;
+            } else {
+                if (b > 75) {
+                    if (x < 1) {
+                        // step 4556
+                        a = step16(i2, i2) - step52(a, i2);
+                        // step 4558
+                        y = 64 - a;
+                        // step 4560
+                        b = 54 * x - a;
+                    }
+                } else {
+                    if (i2 < 9) {
+                        step42(a);
+                    }
+                }
+                y = 5 + 51 - 79;
+                for (int i4 = 0; i4 < 97; i4++) {
+                    if (i2 < 20) {
+                        // step 4571
+                        y = 52;
+                        // step 4573
+                        x = 76;
+                    } else {
+                        b = x;
+                        i4 = a - a - step62(a, i4);
+                    }
+                }
+            }
+        }
+        return step14(y, y);
+    }
+    
+    // step68: generated
+    static int step68(int a, int b) {
+        int x = b + a;
+        int y = 41;
+        step33(y);
+        for (int i2 = 0; i2 < 72; i2++) {
+            if (y == 29) {
+                b = step45(i2);
+                if (x < 85) {
+                    i2 = 37;
+                    for (int i5 = 0; i5 < 99; i5++) {
+                        b = 99;
+                        // step 4597
+                        y = 30 + b + step6(i2);
+                    }
+                }
+            } else {
+                step4(b, b);
+            }
+            step41(x, i2);
+            for (int i3 = 0; i3 < 56; i3++) {
+                if (a > 51) {
+                    if (x > 52) {
+                        // step 4608
+                        a = b * step15(a);
+                    } else {
+                        i3 = 44;
+                    }
+                } else {
+                    for (int i5 = 0; i5 < 63; i5++) {
+                        // step 4615
+                        a = 43;
+                        i2 = i2 - i2 - a;
+                        // step 4618
+                        x = y;
+                    }
+                }
+                y = 83 * b + step48(i3);
+            }
+            i2 = step45(y) - 22 * y;
+        }
+        for (int i2 = 0; i2 < 20; i2++) {
+            // step 4627
+            x = 12 + i2 + x;
+        }
+        return a * step66(a);
+    }
+    
+    // step69: generated
+    static int step69(int a) {
+        int x = 22 * 15;
+        int y = 66;
+        if (a < 73) {
+            if (x < 68) {
+                a = a * 3 + a;
+                for (int i4 = 0; i4 < 23; i4++) {
+                    step21(x);
+                }
+                for (int i4 = 0; i4 < 70; i4++) {
+                    if (x == 91) {
+                        i4 = 68 - step1(a, x) + x;
+                        step57(i4);
+                    } else {
+                        // step 4648
+                        x = a - 37 - x;
+                        // step 4650
+                        x = a - a + 95;
+                    }
+                }
+            } else {
+                a = a + 83;
+            }
+            if (y < 66) {
+                if (x < 14) {
+                    x = 44 - step32(a, y) + 14;
+                } else {
+                    for (int i5 = 0; i5 < 46; i5++) {
+                        // step 4662
+                        y = 93 - step63(a) + a;
+                    }
+                    x = y * x;
+                }
+            }
+        } else {
+            // step 4669
+            y = 34;
+            y = x + 87 - x;
+            for (int i3 = 0; i3 < 76; i3++) {
+                if (a > 95) {
+                    step40(a, y);
+                    a = step65(i3, y) + i3 + 9;
+                    for (int i5 = 0; i5 < 52; i5++) {
+                        step65(a, x);
+                        a = x - a;
+                        // step 4679
+                        a = 66;
+                    }
+                }
+            }
+        }
+        if (x > 45) {
+            if (y < 69) {
+                for (int i4 = 0; i4 < 4; i4++) {
+                    a = a;
+                    if (x == 61) {
+                        // step 4690
+                        y = i4 + x;
+                        // step 4692
+                        y = y;
+                        a = x + x;
+                    } else {
+                        step29(y, x);
+                        // step 4697
+                        y = 45;
+                        // step 4699
+                        x = y * y * x;
+                    }
+                    step10(a, a);
+                }
+            }
+            y = step22(x, x);
+            step49(x, y);
+            for (int i3 = 0; i3 < 61; i3++) {
+                if (i3 == 65) {
+                    step50(i3, i3);
+                    // step 4710
+                    x = step36(x);
+                }
+            }
+        }
+        a = y;
+        a = y;
+        if (y == 35) {
+            if (x == 74) {
+                for (int i4 = 0; i4 < 71; i4++) {
+                    if (i4 < 9) {
+                        // step 4721
+                        y = step18(x) * 45 - 17;
+                    } else {
+                        a = x;
+                        // step 4725
+                        i4 = a - y * a;
+                    }
+                }
+            }
+            y = 77 - 11 + x;
+            x = 4 * a * x;
+            // step 4732
+            a = 57;
+        }
+        for (int i2 = 0; i2 < 76; i2++) {
+            // step 4736
+            i2 = i2;
+            if (y > 30) {
+                if (x > 83) {
+                    i2 = y * 22;
+                    for (int i5 = 0; i5 < 55; i5++) {
+                        i2 = 93;
+                    }
+                }
+                // step 4745
+                y = 91 * i2 - y;
+                if (x > 71) {
+                    if (i2 == 35) {
+                        x = step6(i2) - 46 - i2;
+                        i2 = 0;
+                        // step 4751
+                        x = i2 + i2 * 89;
+                    } else {
+                        // step 4754
+                        x = step67(a, y) * 35 - 81;
+                    }
+                } else {
+                    if (i2 == 42) {
+                        // step 4759
+                        x = 75 * i2 - step18(x);
+                        step65(a, a);
+                    }
+                }
+            } else {
+                x = a * step64(x, y) * a;
+                step24(i2);
+            }
+            if (x == 86) {
+                for (int i4 = 0; i4 < 17; i4++) {
+                    step58(y, i2);
+                    if (i4 < 29) {
+                        y = step27(i2);
+                    }
+                    if (x > 75) {
+                        // step 4775
+                        y = y;
+                    } else {
+                        a = y;
+                    }
+                }
+            }
+            if (y < 93) {
+                if (i2 == 98) {
+                    for (int i5 = 0; i5 < 75; i5++) {
+                        // step 4785
+                        i5 = y + x;
+                    }
+                    if (a > 95) {
+                        // step 4789
+                        a = i2 - 11 - step30(a);
+                    }
+                }
+                step31(y, x);
+                if (a < 75) {
+                    // step 4795
+                    y = i2 * 49 * 85;
+                } else {
+                    if (y < 87) {
+                        a = x;
+                    } else {
+                        step28(a, y);
+                        step68(i2, a);
+                        // step 4803
+                        y = y * x;
+                    }
+                    if (x == 90) {
+                        // step 4807
+                        i2 = y;
+                        // step 4809
+                        a = x;
+                    }
+                    // step 4812
+                    a = step26(i2, i2) + y - i2;
+                }
+            }
+        }
+        a = 11 + 12 + 38;
+        return step66(a) + 23 * 61;
+    }
+    
+    // step70: generated
+    static int step70(int a, int b) {
+        int x = a;
+        int y = 35;
+        step14(y, x);
+        x = 95;
+        // step 4827
+        a = b * b;
+        if (x == 71) {
+            if (y < 22) {
+                if (x == 86) {
+                    if (x > 86) {
+                        x = 57;
+                        b = 99 - 87 + b;
+                    } else {
+                        // step 4836
+                        b = b + b - 18;
+                    }
+                } else {
+                    b = 61 * x * 13;
+                }
+                if (x == 92) {
+                    step64(y, y);
+                    for (int i5 = 0; i5 < 21; i5++) {
+                        // step 4845
+                        y = b + step68(b, i5) + a;
+                        // step 4847
+                        i5 = x;
+                    }
+                } else {
+                    if (b > 61) {
+                        y = a - 93 * y;
+                    } else {
+                        // step 4854
+                        a = 10 - step69(a) - 94;
+                        // step 4856
+                        x = x;
+                        a = a;
+                    }
+                    if (b < 14) {
+                        // step 4861
+                        x = 64 * y;
+                    }
+                    y = step31(a, a) + 89;
+                }
+            } else {
+                if (b < 59) {
+                    if (a < 31) {
+                        // step 4869
+                        b = x + 53;
+                    } else {
+                        a = step23(x, x) * step57(y) + step0(x);
+                        // step 4873
+                        b = a + 47;
+                        // step 4875
+                        x = b + y;
+                    }
+                }
+                step68(b, a);
+                b = y * y + step48(x);
+            }
+        } else {
+            if (b == 81) {
+                // step 4884
+                x = a - a - 3;
+                step66(b);
+                for (int i4 = 0; i4 < 64; i4++) {
+                    // step 4888
+                    i4 = a * 15;
+                    step38(y, a);
+                    for (int i5 = 0; i5 < 16; i5++) {
+                        b = step36(y) * step33(i5) + b;
+                    }
+                }
+            } else {
+                b = a * y;
+            }
+            x = 74 * 84 - x;
+            if (b < 72) {
+                if (x > 16) {
+                    for (int i5 = 0; i5 < 90; i5++) {
+                        y = 12 * 32;
+                        // step 4903
+                        i5 = y;
+                    }
+                    if (y == 47) {
+                        // step 4907
+                        a = a;
+                        step21(y);
+                    } else {
+                        // step 4911
+                        x = step33(a);
+                        // step 4913
+                        a = x * b - y;
+                    }
+                } else {
+                    step59(x, y);
+                    for (int i5 = 0; i5 < 3; i5++) {
+                        // step 4919
+                        i5 = x + a * step2(i5, y);
+                        // step 4921
+                        i5 = y + 40;
+                        b = y;
+                    }
+                }
+            } else {
+                if (b == 46) {
+                    step22(b, b);
+                    if (x < 38) {
+                        step40(y, x);
+                        // step 4931
+                        y = y;
+                    }
+                    if (x == 69) {
+                        // step 4935
+                        y = x * step40(x, y) + b;
+                    } else {
+                        // step 4938
+                        x = x + 40;
+                        // step 4940
+                        x = 3;
+                        // step 4942
+                        a = 59;
+                    }
+                } else {
+                    if (b < 91) {
+                        x = 80;
+                        step43(b, x);
+                    }
+                }
+            }
+        }
+        return 11 * 82 * a;
+    }
+    
+    // step71: generated
+    static int step71(int a, int b) {
+        int x = a;
+        int y = 47;
+        if (y > 84) {
+            step38(a, a);
+            y = a;
+        } else {
+            if (b == 98) {
+                x = step69(x) - 49 * 33;
+            } else {
+                a = 59;
+                step35(x, x);
+            }
+        }
+        // step 4971
+        a = x;
+        step41(b, y);
+        if (x == 56) {
+            y = a * y - 97;
+            x = 20;
+            step48(y);
+        } else {
+            a = 61 * b;
+            b = y;
+            for (int i3 = 0; i3 < 66; i3++) {
+                if (x < 8) {
+                    i3 = 80;
+                    if (b == 62) {
+                        i3 = x - y * i3;
+                    }
+                    if (b < 31) {
+                        x = y;
+                        step35(a, x);
+                        // step 4990
+                        b = x;
+                    } else {
+                        // step 4993
+                        i3 = x * 37 + step34(i3, a);
+                    }
+                } else {
+                    if (y < 20) {
+                        y = step49(y, x) * step45(x);
+                    } else {
+                        // step 5000
+                        a = 4 + y;
+                        a = 5;
+                        // step 5003
+                        b = 93 * 51 * step69(y);
+                    }
+                    a = 58;
+                }
+            }
+            a = b + y - b;
+        }
+        return a - y;
+    }
+    
+    public static void main(String[] args) {
+        int total = 0;
+        total = total + step67(98, 51);
+        total = total + step68(17, 57);
+        total = total + step69(74);
+        total = total + step70(99, 75);
+        total = total + step71(95, 38);
+        System.out.println(total);
+    }
+}
@@ -0,0 +1,818 @@
+public class Fixture {
+
+    // step0: generated
+    static int step0(int a) {
+        int x = 11 + a;
+        int y = 2;
+        x = 79 - y - a;
+        if (y < 47) {
+            // step 8
+            a = a - x;
+            // step 10
+            x = x * x;
+            a = 90 + 40 + a;
+            a = a + y * 72;
+        } else {
+            // step 15
+            a = y * y;
+            // step 17
+            x = 66 - x;
+            x = a;
+            // step 20
+            x = a;
+        }
+        if (a < 82) {
+            x = 51 - 89 + 19;
+            // step 25
+            y = x;
+            a = x * y - 84;
+            // step 28
+            a = x;
+        } else {
+            // step 31
+            a = 15 * 84;
+            // step 33
+            x = x - a;
+        }
+        x = x;
+        for (int i2 = 0; i2 < 34; i2++) {
+            // step 38
+            i2 = 50;
+            // step 40
+            x = y;
+            // step 42
+            y = a * x;
+        }
+        if (a == 72) {
+            y = y;
+        }
+        return 57 * a;
+    }
+    
+    // step1: generated
+    static int step1(int a, int b) {
+        int x = a - 34;
+        int y = 4;
+        if (y == 61) {
+            y = 27 * y * y;
+            // step 57
+            a = x;
+            // step 59
+            b = step0(y);
+        } else {
+            y = 85 - 33;
+        }
+        if (a == 77) {
+            // step 65
+            x = a - 50 - x;
+            // step 67
+            b = b;
+        } else {
+            // step 70
+            b = y - y;
+            step0(b);
+            a = x;
+            // step 74
+            x = 67 + a + 27;
+        }
+        y = y;
+        if (a < 21) {
+            a = a + step0(x) - 86;
+            // step 80
+            b = 49 * x;
+            // step 82
+            a = step0(y);
+            step0(b);
+        }
+        return 70 * 63 * 4;
+    }
+    
+    // step2: generated
+    static int step2(int a, int b) {
+        int x = 61 * b * b;
+        int y = 27;
+        // step 93
+        a = x * x;
+        for (int i2 = 0; i2 < 8; i2++) {
+            // step 96
+            x = i2;
+            step0(i2);
+        }
+        if (b == 80) {
+            // step 101
+            a = y;
+            x = step0(x);
+            // step 104
+            a = 86 + a * b;
+        } else {
+            // step 107
+            y = step1(a, y) * 48;
+        }
+        step1(a, a);
+        if (a < 44) {
+            // step 112
+            a = step0(b) - 84;
+            // step 114
+            a = 47 - b;
+            y = step0(x) * a - x;
+        } else {
+            a = y;
+            a = x - step1(a, a) * b;
+            b = x + a * 22;
+            y = 32 * y - y;
+        }
+        if (x == 97) {
+            // step 124
+            x = step1(b, b) + a;
+        }
+        y = x - 56;
+        return 28 * x;
+    }
+    
+    // step3: generated
+    static int step3(int a) {
+        int x = 98;
+        int y = 15;
+        if (a < 31) {
+            x = a * a;
+            step1(x, x);
+            // step 138
+            x = a + step1(a, y);
+        }
+        if (x > 87) {
+            step1(y, a);
+            // step 143
+            x = a * y + 8;
+            x = 47;
+            // step 146
+            y = y;
+        }
+        x = x;
+        return x;
+    }
+    
+    // step4: generated
+    static int step4(int a, int b) {
+        int x = b + b - b;
+        int y = 77;
+        if (x > 48) {
+            y = 36 - 93;
+            step2(a, x);
+            b = b + 24 + b;
+            // step 161
+            a = 22 * b - a;
+        }
+        if (x < 52) {
+            // step 165
+            y = x * 91 * a;
+            // step 167
+            x = x;
+            step2(b, x);
+            // step 170
+            b = 48 + b * b;
+        } else {
+            step1(y, y);
+            // step 174
+            b = b;
+        }
+        for (int i2 = 0; i2 < 64; i2++) {
+            // step 178
+            x = 55 - x + b;
+            // step 180
+            x = 6 + 11 + i2;
+            // step 182
+            b = 81;
+            a = b + i2 - 68;
+        }
+        if (a > 96) {
+            // step 187
+            a = 73 - 81 + 68;
+            // step 189
+            y = step3(b);
+        }
+        y = y;
+        a = 78 - step1(x, a);
+        return b;
+    }
+    
+    // step5: generated
+    static int step5(int a, int b) {
+        int x = 58;
+        int y = 82;
+        // step 201
+        y = 69 * b + a;
+        if (x < 22) {
+            x = step0(x) + 23;
+            y = 60 * y - 45;
+            // step 206
+            a = b - b;
+        }
+        step2(b, y);
+        for (int i2 = 0; i2 < 0; i2++) {
+            y = 91 + step2(y, a);
+            step0(i2);
+            y = i2 - 37 * b;
+            step2(a, y);
+        }
+        if (b > 43) {
+            x = 29;
+        } else {
+            // step 219
+            x = 12 * a;
+            // step 221
+            a = b - b;
+            // step 223
+            x = x;
+            // step 225
+            a = x * y;
+        }
+        for (int i2 = 0; i2 < 12; i2++) {
+            // step 229
+            b = x * step3(i2);
+            // step 231
+            y = x;
+        }
+        for (int i2 = 0; i2 < 86; i2++) {
+            // step 235
+            b = 94 + i2 * b;
+            step2(b, i2);
+            step0(x);
+        }
+        return a * step4(y, a) * 77;
+    }
+    
+    // step6: generated
+    static int step6(int a) {
+        int x = a * a;
+        int y = 85;
+        a = x - a;
+        step2(x, a);
+        // step 249
+        y = a + step5(y, x) + x;
+        // step 251
+        y = a;
+        a = 11;
+        if (a < 82) {
+            y = x;
+            // step 256
+            a = y;
+        }
+        step1(a, y);
+        step1(y, x);
+        return 24 * a * 8;
+    }
+    
+    // step7: generated
+    static int step7(int a, int b) {
+        int x = a + 7 - 46;
+        int y = 36;
+        x = x;
+        if (x < 5) {
+            a = 43;
+            b = a * 44 * 96;
+        } else {
+            y = a;
+            step5(b, b);
+        }
+        // step 276
+        a = x + step0(y);
+        if (a < 13) {
+            // step 279
+            y = 89;
+            // step 281
+            b = a - 44;
+            x = b;
+        }
+        for (int i2 = 0; i2 < 12; i2++) {
+            b = 88 - b * step3(i2);
+            step5(a, i2);
+            // step 288
+            y = 53;
+        }
+        // step 291
+        y = b;
+        step0(b);
+        return a;
+    }
+    
+    // step8: generated
+    static int step8(int a, int b) {
+        int x = b * 39;
+        int y = 91;
+        // step 301
+        b = b + 6 - a;
+        // step 303
+        y = step2(y, b) - 25 * b;
+        // step 305
+        y = y;
+        for (int i2 = 0; i2 < 73; i2++) {
+            // step 308
+            a = 52 * 51 * x;
+            // step 310
+            i2 = x - 70;
+        }
+        a = 69 + 12;
+        for (int i2 = 0; i2 < 10; i2++) {
+            i2 = b * 26 * 95;
+            step7(x, y);
+            // step 317
+            y = step3(i2) + 15 + 72;
+        }
+        for (int i2 = 0; i2 < 9; i2++) {
+            // step 321
+            x = 62 - 12;
+            // step 323
+            i2 = step6(y);
+        }
+        return 3 * b * b;
+    }
+    
+    // step9: generated
+    static int step9(int a) {
+        int x = a + a;
+        int y = 67;
+        for (int i2 = 0; i2 < 86; i2++) {
+            // step 334
+            i2 = 21 * step6(x) - 43;
+        }
+        // step 337
+        y = step3(a);
+        // step 339
+        x = 51;
+        step1(x, x);
+        x = 93 * y;
+        y = 16 - 10 * 29;
+        // step 344
+        y = x;
+        if (y > 73) {
+            // step 347
+            a = a;
+            x = 2 - 47;
+        }
+        return y + y;
+    }
+    
+    // step10: generated
+    static int step10(int a, int b) {
+        int x = 45 + 3;
+        int y = 40;
+        step1(b, a);
+        // step 359
+        x = y * step4(a, b) * 7;
+        // step 361
+        b = 49 + 4 * x;
+        step4(y, x);
+        return step2(a, y) * a;
+    }
+    
+    // step11: generated
+    static int step11(int a, int b) {
+        int x = b;
+        int y = 6;
+        x = x;
+        if (y < 25) {
+            x = y + b + x;
+        }
+        // step 375
+        b = step8(y, a);
+        for (int i2 = 0; i2 < 36; i2++) {
+            // step 378
+            b = 92 + 77 - 34;
+            x = x + step3(b);
+            b = step10(y, x) * 96 - step3(a);
+            // step 382
+            b = x;
+        }
+        // step 385
+        b = step4(y, y) - 0 * 94;
+        x = x + x * 39;
+        if (y < 12) {
+            // step 389
+            a = step2(x, x) + step9(a);
+            b = step9(b) * 83 * a;
+        } else {
+            // step 393
+            x = 58;
+            b = 73;
+            step4(y, y);
+            // step 397
+            a = step1(a, a);
+        }
+        y = y * y - y;
+        return y;
+    }
+    
+    // step12: generated
+    static int step12(int a) {
+        int x = a;
+        int y = 6;
+        a = 31 + y - x;
+        a = y - y;
+        for (int i2 = 0; i2 < 26; i2++) {
+            i2 = step6(y) + a + 95;
+            // step 412
+            x = step7(x, a) * x;
+        }
+        a = step1(y, y) * 72 + 13;
+        step7(a, a);
+        a = y;
+        y = a;
+        for (int i2 = 0; i2 < 76; i2++) {
+            i2 = 55 * step11(y, i2) + 49;
+            step2(i2, x);
+            step0(y);
+        }
+        return x - 31 - y;
+    }
+    
+    // step13: generated
+    static int step13(int a, int b) {
+        int x = b;
+        int y = 32;
+        b = 36 * y - step7(a, a);
+        y = 23 * a - a;
+        step4(b, b);
+        a = 62;
+        if (b > 61) {
+            // step 436
+            b = 3 + step4(y, b) + y;
+            // step 438
+            x = 68 * y;
+        } else {
+            // step 441
+            y = x;
+            // step 443
+            x = step5(x, a) - 72 * x;
+            step4(x, a);
+        }
+        return 50;
+    }
+    
+    // step14: generated
+    static int step14(int a, int b) {
+        int x = 23 - a;
+        int y = 63;
+        step0(y);
+        y = x;
+        if (b == 60) {
+            a = step13(x, x) * b;
+            // step 458
+            y = step0(y) + y + a;
+            // step 460
+            y = x;
+        }
+        b = a * b;
+        b = 25 - step1(a, a) * 60;
+        if (b == 11) {
+            y = 94 * 78;
+        }
+        return 24;
+    }
+    
+    // step15: generated
+    static int step15(int a) {
+        int x = 23;
+        int y = 96;
+        a = 89 * 47;
+        for (int i2 = 0; i2 < 70; i2++) {
+            // step 477
+            y = y;
+        }
+        if (x > 36) {
+            // step 481
+            a = x * step12(x) * step9(y);
+        } else {
+            a = 89 * step7(a, y);
+            step3(y);
+            step14(y, x);
+            x = x + 17;
+        }
+        for (int i2 = 0; i2 < 33; i2++) {
+            // step 490
+            x = 85 * i2;
+            a = 31 - 70 - x;
+            // step 493
+            x = i2;
+        }
+        return step12(x) - 66 * y;
+    }
+    
+    // step16: generated
+    static int step16(int a, int b) {
+        int x = a + b * b;
+        int y = 37;
+        a = x - x;
+        if (x < 25) {
+            y = y - y + x;
+            a = a + y;
+            step8(b, y);
+        } else {
+            // step 509
+            b = b;
+            step5(x, a);
+        }
+        a = x + x;
+        return a * 35;
+    }
+    
+    // step17: generated
+    static int step17(int a, int b) {
+        int x = a + b * 61;
+        int y = 7;
+        a = b;
+        for (int i2 = 0; i2 < 76; i2++) {
+            x = i2 - x;
+        }
+        // step 525
+        x = step3(a) * 50;
+        y = y + 56;
+        if (y == 93) {
+            step12(y);
+            b = b + 72;
+            step7(b, b);
+        } else {
+            // step 533
+            a = y + 78 * a;
+        }
+        // step 536
+        x = 18 * 80;
+        if (x > 11) {
+            x = b;
+            // step 540
+            x = step4(b, x);
+            // step 542
+            y = 42 * step8(a, b);
+            b = x;
+        }
+        y = b - 42;
+        return x - y * 86;
+    }
+    
+    // step18: generated
+    static int step18(int a) {
+        int x = a - a;
+        int y = 3;
+        if (a > 17) {
+            y = x + step3(a) * a;
+            step15(a);
+        }
+        a = a * 44 + x;
+        for (int i2 = 0; i2 < 56; i2++) {
+            step5(i2, y);
+            // step 561
+            y = i2 - 56;
+            // step 563
+            a = 9 - step14(y, y) + i2;
+        }
+        x = a + a;
+        // step 567
+        y = x - step3(a) + 78;
+        if (x < 68) {
+            x = a;
+            // step 571
+            x = a * 92;
+        }
+        if (x > 85) {
+            x = a;
+            // step 576
+            y = 75 * 25;
+            // step 578
+            y = step8(a, x) + 49;
+        }
+        return 95 * y + a;
+    }
+    
+    // step19: generated
+    static int step19(int a, int b) {
+        int x = a * 2 * 44;
+        int y = 93;
+        if (b == 24) {
+            // step 589
+            b = 78 + 66;
+            step8(y, a);
+            y = y;
+            // step 593
+            b = x - step10(y, y) + 95;
+        }
+        if (a == 49) {
+            y = 18;
+            // step 598
+            x = 70;
+            step15(y);
+        }
+        if (b < 42) {
+            y = y;
+            step15(x);
+            // step 605
+            x = 81 - y;
+        } else {
+            // step 608
+            y = y - x - 0;
+            b = x * x;
+            // step 611
+            a = step11(b, y) * step8(a, b);
+        }
+        if (a > 54) {
+            // step 615
+            y = y * step16(a, a) + y;
+            // step 617
+            a = x;
+        } else {
+            x = b + b * y;
+            // step 621
+            a = y;
+        }
+        if (y == 32) {
+            step1(x, x);
+            // step 626
+            x = 51 - 25;
+        }
+        if (x == 91) {
+            // step 630
+            y = a;
+            // step 632
+            x = b - a - step15(x);
+        }
+        return 67 + step5(x, x);
+    }
+    
+    // step20: generated
+    static int step20(int a, int b) {
+        int x = 28 + b;
+        int y = 40;
+        for (int i2 = 0; i2 < 98; i2++) {
+            // step 643
+            i2 = step2(i2, a) * 93;
+            // step 645
+            y = 91 + x * y;
+            // step 647
+            y = a - a;
+            i2 = x * x;
+        }
+        for (int i2 = 0; i2 < 75; i2++) {
+            // step 652
+            i2 = b;
+            // step 654
+            x = 12 + a + 25;
+            // step 656
+            y = y + 38 - step6(y);
+            // step 658
+            x = i2 - 75 + x;
+        }
+        if (a == 18) {
+            y = a + 44 - x;
+            step13(y, b);
+        }
+        x = b * y - 49;
+        return x;
+    }
+    
+    // step21: generated
+    static int step21(int a) {
+        int x = 37 * 71 * a;
+        int y = 46;
+        for (int i2 = 0; i2 < 27; i2++) {
+            // step 674
+            i2 = i2 - 50 * 60;
+            // step 676
+            y = 5;
+            // step 678
+            y = x;
+        }
+        if (a == 40) {
+            // step 682
+            y = y * step4(y, a) * y;
+        } else {
+            // step 685
+            y = 60;
+        }
+        // step 688
+        a = x * 84 - 47;
+        step17(x, y);
+        step0(y);
+        if (y < 20) {
+            // step 693
+            x = 93 * 27 * 26;
+            step3(x);
+        } else {
+            // step 697
+            a = step14(y, x) - x - 8;
+        }
+        return 96 + 82;
+    }
+    
+    // step22: generated
+    static int step22(int a, int b) {
+        int x = 44 - b;
+        int y = 60;
+        if (a == 4) {
+            // step 708
+            y = y;
+            // step 710
+            y = step5(b, b) + step11(a, b);
+            // step 712
+            a = step13(x, x);
+            // step 714
+            x = x + 94;
+        }
+        if (y > 31) {
+            // step 718
+            x = 64;
+            a = step21(x) - a + a;
+            step15(a);
+        } else {
+            // step 723
+            x = b;
+            a = y;
+            x = 42 * x;
+            // step 727
+            x = a;
+        }
+        a = 12 - 88 * step14(a, a);
+        for (int i2 = 0; i2 < 93; i2++) {
+            y = step18(x);
+            i2 = x - 6 - y;
+            step14(y, i2);
+            b = i2 + 40 + i2;
+        }
+        if (x < 72) {
+            // step 738
+            b = x - 80 - 90;
+        }
+        return b - x - 4;
+    }
+    
+    // step23: generated
+    static int step23(int a, int b) {
+        int x = 1 - 21 - 4;
+        int y = 51;
+        if (y < 32) {
+            // step 749
+            x = step19(b, a) + b * 36;
+            step11(b, a);
+            y = 74 - 32;
+        } else {
+            step13(x, y);
+            y = 13;
+            step11(x, b);
+        }
+        step4(y, b);
+        // step 759
+        a = 66;
+        return 60;
+    }
+    
+    // step24: generated
+    static int step24(int a) {
+        int x = 90;
+        int y = 66;
+        x = y - step23(y, a) - x;
+        for (int i2 = 0; i2 < 60; i2++) {
+            x = 46 * y;
+        }
+        if (y == 70) {
+            // step 773
+            y = 18 * a;
+            // step 775
+            x = step6(y);
+        } else {
+            // step 778
+            y = 15;
+        }
+        y = 39 + 84 + x;
+        for (int i2 = 0; i2 < 59; i2++) {
+            i2 = i2;
+            x = 51;
+        }
+        if (a > 6) {
+            // step 787
+            a = a * x * step6(y);
+            // step 789
+            y = a;
+        } else {
+            // step 792
+            x = step22(x, y);
+            // step 794
+            a = 63 - y;
+            // step 796
+            y = step14(x, x) + y;
+            y = x;
+        }
+        a = 74 - 11;
+        for (int i2 = 0; i2 < 79; i2++) {
+            i2 = step4(i2, x) + i2 - a;
+            step18(x);
+        }
+        return 79;
+    }
+    
+    public static void main(String[] args) {
+        int total = 0;
+        total = total + step20(8, 61);
+        total = total + step21(15);
+        total = total + step22(27, 4);
+        total = total + step23(77, 53);
+        total = total + step24(17);
+        System.out.println(total);
+    }
+}
@@ -0,0 +1,869 @@
+public class Fixture {
+
+    // step0: generated
+    static int step0(int a) {
+        int x = a - a;
+        int y = 94;
+        if (x > 16) {
+            if (x > 18) {
+                if (y == 44) {
+                    if (a > 66) {
+                        y = 97;
+                    }
+                }
+                a = 84 - x + a;
+            }
+            if (a > 21) {
+                for (int i4 = 0; i4 < 42; i4++) {
+                    i4 = 11;
+                    if (y < 92) {
+                        // step 19
+                        a = 15 * 31 + 68;
+                    } else {
+                        i4 = y * a - a;
+                    }
+                    y = 10 + a * 36;
+                }
+            } else {
+                // step 27
+                a = 3 - 55 - 97;
+            }
+            for (int i3 = 0; i3 < 42; i3++) {
+                if (x == 81) {
+                    a = x * 59;
+                    // step 33
+                    i3 = 37 * y;
+                    a = y * i3 - y;
+                }
+                for (int i4 = 0; i4 < 34; i4++) {
+                    if (i4 > 13) {
+                        // step 39
+                        i4 = x;
+                        i3 = a;
+                    }
+                    if (i4 < 56) {
+                        // step 44
+                        y = 11 + i4 + i3;
+                        a = 46 - i3 * 40;
+                    } else {
+                        // step 48
+                        a = 98 * i4 - i4;
+                    }
+                    i3 = x + a * y;
+                }
+            }
+            y = 62 + 10;
+        } else {
+            if (y == 33) {
+                x = 29 + x + 95;
+            }
+            y = 13;
+            for (int i3 = 0; i3 < 88; i3++) {
+                // step 61
+                i3 = a + 25 * a;
+                for (int i4 = 0; i4 < 52; i4++) {
+                    a = 38 * 4;
+                    if (i3 < 86) {
+                        y = a;
+                    }
+                    x = i4 - x - a;
+                }
+            }
+        }
+        for (int i2 = 0; i2 < 85; i2++) {
+            if (x < 3) {
+                if (a > 37) {
+                    a = i2 * i2;
+                    i2 = a - y + i2;
+                    i2 = 42 - y * y;
+                }
+            } else {
+                i2 = x + x;
+                if (x < 84) {
+                    a = a - y * 30;
+                }
+                if (a < 36) {
+                    if (x > 55) {
+                        // step 86
+                        i2 = y * x - 99;
+                    } else {
+                        // step 89
+                        x = x + y;
+                    }
+                } else {
+                    i2 = 79 - y + 62;
+                }
+            }
+            i2 = a;
+        }
+        for (int i2 = 0; i2 < 77; i2++) {
+            for (int i3 = 0; i3 < 98; i3++) {
+                if (i3 < 34) {
+                    // step 101
+                    x = 60 - i3 - y;
+                } else {
+                    // step 104
+                    i3 = 73 - 25 * i2;
+                    for (int i5 = 0; i5 < 9; i5++) {
+                        i3 = 21;
+                        // step 108
+                        i5 = 64 + y - i2;
+                        i2 = i2 - i2 + y;
+                    }
+                }
+            }
+            if (i2 == 24) {
+                i2 = a + 68 * y;
+                // step 116
+                x = i2;
+            } else {
+                if (a < 12) {
+                    for (int i5 = 0; i5 < 18; i5++) {
+                        // step 121
+                        i5 = 89 - x - y;
+                    }
+                    a = 76 - y + i2;
+                    a = y * i2;
+                } else {
+                    a = y + a;
+                }
+                for (int i4 = 0; i4 < 67; i4++) {
+                    i2 = a * a;
+                    if (a < 74) {
+                        // step 132
+                        i4 = 19;
+                        // step 134
+                        i4 = i4 * 71 * a;
+                        i2 = 33 * 0;
+                    }
+                }
+                a = a;
+            }
+            x = y;
+        }
+        // step 143
+        a = a + y;
+        // step 145
+        a = 53 - 75;
+        if (y < 51) {
+            x = a - 35;
+            a = a;
+            for (int i3 = 0; i3 < 54; i3++) {
+                // step 151
+                i3 = 44;
+            }
+            y = y * x - 17;
+        }
+        return 78;
+    }
+    
+    // step1: generated
+    static int step1(int a, int b) {
+        int x = 78;
+        int y = 66;
+        b = 47 + 92;
+        if (b > 49) {
+            a = b;
+            if (y > 16) {
+                b = 87;
+                step0(x);
+            }
+            if (x < 93) {
+                x = 5 + step0(y) + 52;
+                x = x;
+                if (b > 12) {
+                    if (y > 44) {
+                        b = y + 48;
+                    } else {
+                        a = a - step0(a) + y;
+                        // step 178
+                        a = x - 6;
+                    }
+                    // step 181
+                    y = y - y + x;
+                }
+            }
+            if (y < 89) {
+                if (a == 11) {
+                    step0(y);
+                    // step 188
+                    a = step0(x) + a;
+                    if (y > 49) {
+                        // step 191
+                        b = y;
+                        x = 24 + 62 + step0(a);
+                        // step 194
+                        a = 53 - step0(y);
+                    }
+                } else {
+                    for (int i5 = 0; i5 < 90; i5++) {
+                        step0(y);
+                    }
+                    step0(a);
+                }
+                // step 203
+                b = 73 * b - b;
+            } else {
+                step0(y);
+            }
+        }
+        if (a < 95) {
+            for (int i3 = 0; i3 < 92; i3++) {
+                for (int i4 = 0; i4 < 44; i4++) {
+                    if (x == 39) {
+                        // step 213
+                        i3 = step0(y) - step0(a) * a;
+                        // step 215
+                        b = y + b;
+                        step0(y);
+                    }
+                    // step 219
+                    i3 = 60 - i3 + 26;
+                    if (y == 57) {
+                        // step 222
+                        y = step0(y) - a;
+                        // step 224
+                        i4 = b + step0(a) * 76;
+                    } else {
+                        // step 227
+                        x = i4 + a * y;
+                    }
+                }
+                step0(a);
+            }
+            step0(a);
+            step0(x);
+        } else {
+            // step 236
+            y = step0(x);
+            if (a == 67) {
+                for (int i4 = 0; i4 < 89; i4++) {
+                    step0(a);
+                    if (a == 74) {
+                        a = b + x * y;
+                        // step 243
+                        y = a;
+                        step0(a);
+                    } else {
+                        // step 247
+                        x = x + y + y;
+                        // step 249
+                        b = a;
+                    }
+                    for (int i5 = 0; i5 < 46; i5++) {
+                        i5 = step0(i4);
+                    }
+                }
+                x = y;
+                a = 23 - 76;
+            } else {
+                if (a == 51) {
+                    for (int i5 = 0; i5 < 21; i5++) {
+                        a = 65 - 18 * 54;
+                    }
+                }
+                if (b < 36) {
+                    y = 14;
+                } else {
+                    // step 267
+                    a = 72 - b * 25;
+                }
+                if (b > 69) {
+                    step0(x);
+                }
+            }
+        }
+        return a * 43 - y;
+    }
+    
+    // step2: generated
+    static int step2(int a, int b) {
+        int x = a - 7;
+        int y = 39;
+        if (b == 75) {
+            if (y > 35) {
+                y = 42 - a;
+            } else {
+                if (x == 40) {
+                    step0(b);
+                    if (a > 60) {
+                        step1(x, b);
+                    }
+                    b = x;
+                } else {
+                    a = 3;
+                }
+            }
+            b = a + y - a;
+            x = x;
+            // step 298
+            b = 1 + step1(y, b) + y;
+        } else {
+            step0(x);
+        }
+        if (a > 12) {
+            if (a > 74) {
+                // step 305
+                y = step1(y, y);
+                if (a < 90) {
+                    if (a == 79) {
+                        b = x;
+                        // step 310
+                        b = b * y + y;
+                        // step 312
+                        x = step1(a, b) * 76 - a;
+                    }
+                    // step 315
+                    x = 99;
+                    y = b * step1(b, x) * 55;
+                } else {
+                    y = 74 - a;
+                }
+            }
+            for (int i3 = 0; i3 < 32; i3++) {
+                if (a < 19) {
+                    step0(b);
+                }
+                // step 326
+                a = x - i3 * 43;
+                i3 = 33 - x;
+            }
+        }
+        // step 331
+        y = y - a - step0(b);
+        if (x == 74) {
+            if (x == 79) {
+                y = b - a * 22;
+                step0(x);
+                x = b;
+            } else {
+                step1(x, b);
+                // step 340
+                b = x - 70 - 86;
+            }
+            if (x == 45) {
+                if (x < 78) {
+                    b = y * step1(a, b) + 73;
+                } else {
+                    step0(y);
+                    for (int i5 = 0; i5 < 10; i5++) {
+                        // step 349
+                        b = x * 32;
+                        // step 351
+                        y = 29;
+                    }
+                }
+                step0(x);
+                if (y == 54) {
+                    for (int i5 = 0; i5 < 25; i5++) {
+                        // step 358
+                        i5 = i5;
+                        y = 68 * 55 - 63;
+                        step0(y);
+                    }
+                }
+            }
+            if (x == 43) {
+                if (b < 4) {
+                    step0(y);
+                    if (x < 53) {
+                        x = 33 * 14;
+                        a = b + 52 - 98;
+                    }
+                } else {
+                    y = 55;
+                    a = y;
+                    b = y * step0(b);
+                }
+            }
+            step0(b);
+        }
+        x = x + step0(a);
+        if (a == 42) {
+            if (b == 81) {
+                x = step0(a) + 96;
+            }
+        } else {
+            b = 58 - 31;
+            step0(x);
+        }
+        step0(y);
+        b = y * a;
+        return 5 - b;
+    }
+    
+    // step3: generated
+    static int step3(int a) {
+        int x = a;
+        int y = 68;
+        if (x > 88) {
+            if (y < 18) {
+                y = x + 39;
+                if (y < 67) {
+                    step1(y, y);
+                    x = 79 * x - x;
+                    for (int i5 = 0; i5 < 19; i5++) {
+                        step0(a);
+                        // step 406
+                        x = y;
+                    }
+                } else {
+                    if (x < 0) {
+                        // step 411
+                        a = a;
+                        // step 413
+                        y = step1(x, y);
+                    } else {
+                        a = 88;
+                    }
+                }
+            }
+            a = 47;
+        }
+        for (int i2 = 0; i2 < 61; i2++) {
+            if (a < 73) {
+                if (y > 79) {
+                    x = y - x;
+                }
+                // step 427
+                x = a;
+            } else {
+                step1(x, a);
+                if (a < 50) {
+                    if (a > 34) {
+                        x = i2;
+                        // step 434
+                        a = step0(i2) + 45 + 78;
+                    } else {
+                        // step 437
+                        x = 7 - a;
+                    }
+                    i2 = step2(i2, x);
+                    if (y < 57) {
+                        a = step1(x, y);
+                    }
+                } else {
+                    step1(i2, x);
+                    if (y > 60) {
+                        step2(a, i2);
+                        step2(a, y);
+                        // step 449
+                        i2 = i2;
+                    }
+                }
+            }
+            step1(a, i2);
+        }
+        for (int i2 = 0; i2 < 28; i2++) {
+            if (x == 93) {
+                i2 = x;
+                step0(x);
+                if (y > 81) {
+                    x = x - 17 - 44;
+                }
+            }
+            i2 = 46 * 48 - y;
+            for (int i3 = 0; i3 < 84; i3++) {
+                if (x < 47) {
+                    i2 = x + x;
+                    x = 53 + i2 * a;
+                } else {
+                    if (i2 == 63) {
+                        // step 471
+                        a = i3 * 12;
+                        // step 473
+                        i3 = i2 * y;
+                        // step 475
+                        i3 = 58 * 87 + a;
+                    }
+                    step2(i2, i3);
+                }
+                if (i3 > 89) {
+                    step2(i2, y);
+                    step2(i3, i2);
+                }
+                if (a > 49) {
+                    step1(a, i3);
+                }
+            }
+            for (int i3 = 0; i3 < 21; i3++) {
+                for (int i4 = 0; i4 < 80; i4++) {
+                    // step 490
+                    i4 = 15 + step1(a, x) - 2;
+                }
+                for (int i4 = 0; i4 < 22; i4++) {
+                    i2 = 21 * 94;
+                }
+            }
+        }
+        return y;
+    }
+    
+    // step4: generated
+    static int step4(int a, int b) {
+        int x = a - 47 * 73;
+        int y = 32;
+        y = a * b;
+        if (y < 14) {
+            if (a == 69) {
+                y = 79 - x + a;
+            } else {
+                for (int i4 = 0; i4 < 9; i4++) {
+                    // step 511
+                    i4 = a + y;
+                    if (a == 92) {
+                        // step 514
+                        i4 = 18 * a * y;
+                        a = 1;
+                        step2(i4, b);
+                    } else {
+                        // step 519
+                        x = b - 34;
+                        a = 98 + step3(y);
+                        y = 6;
+                    }
+                    step1(i4, i4);
+                }
+                y = 87 * 34 * 21;
+                if (y < 75) {
+                    y = a;
+                } else {
+                    if (b > 1) {
+                        // step 531
+                        b = a + y - 36;
+                    } else {
+                        // step 534
+                        a = 14 - b;
+                    }
+                    for (int i5 = 0; i5 < 23; i5++) {
+                        // step 538
+                        a = step3(y);
+                        // step 540
+                        b = step1(i5, b) - a;
+                        // step 542
+                        a = a - step2(a, b) * y;
+                    }
+                }
+            }
+            if (y == 25) {
+                if (a > 37) {
+                    if (y == 28) {
+                        b = step1(a, a) - a;
+                    } else {
+                        x = y * b;
+                    }
+                }
+            }
+        } else {
+            for (int i3 = 0; i3 < 80; i3++) {
+                a = x * step2(i3, a);
+                if (y < 12) {
+                    if (a > 41) {
+                        b = step0(a) + 70;
+                    }
+                    // step 563
+                    a = y * b;
+                } else {
+                    if (x > 7) {
+                        step3(i3);
+                    } else {
+                        i3 = 26 * i3 + 12;
+                    }
+                    if (i3 < 87) {
+                        step1(y, x);
+                    } else {
+                        i3 = step0(x);
+                    }
+                }
+            }
+            y = 48;
+            if (x < 55) {
+                a = y;
+                step2(x, b);
+            }
+            if (b == 73) {
+                // step 584
+                x = 64 * step1(x, y) * b;
+                a = b;
+            } else {
+                x = step2(y, b) * step1(b, x) + a;
+            }
+        }
+        if (b > 1) {
+            // step 592
+            y = step3(b);
+            for (int i3 = 0; i3 < 98; i3++) {
+                b = b + i3 - x;
+            }
+        }
+        b = b - 89 + 85;
+        if (x < 84) {
+            y = 90;
+            step0(y);
+            if (x > 15) {
+                // step 603
+                a = 62 + a + a;
+                if (y > 12) {
+                    a = 92 - 37;
+                    if (a > 78) {
+                        step2(y, x);
+                    } else {
+                        // step 610
+                        b = x;
+                        // step 612
+                        b = 54 + 82 - step2(a, x);
+                    }
+                    y = 14;
+                } else {
+                    b = 48 * step1(b, y);
+                }
+            }
+        }
+        // step 621
+        y = 28 - b;
+        return 82;
+    }
+    
+    // step5: generated
+    static int step5(int a, int b) {
+        int x = a;
+        int y = 21;
+        step2(y, x);
+        x = 33;
+        x = a;
+        a = 31 + a;
+        if (a > 62) {
+            for (int i3 = 0; i3 < 38; i3++) {
+                // step 636
+                i3 = a - 90;
+                if (y < 58) {
+                    // step 639
+                    i3 = 79 + 71;
+                }
+            }
+            if (y == 54) {
+                for (int i4 = 0; i4 < 7; i4++) {
+                    if (b > 19) {
+                        b = y * x;
+                    } else {
+                        step4(b, a);
+                        i4 = step4(a, i4) - y;
+                    }
+                }
+                if (b < 6) {
+                    if (y < 70) {
+                        // step 654
+                        y = a * a;
+                    }
+                } else {
+                    if (a < 58) {
+                        x = 89 + y;
+                    } else {
+                        a = y * 43 - 16;
+                    }
+                    step0(y);
+                }
+                step3(y);
+            } else {
+                for (int i4 = 0; i4 < 72; i4++) {
+                    for (int i5 = 0; i5 < 3; i5++) {
+                        x = a;
+                    }
+                }
+            }
+            // step 673
+            x = y + b * 40;
+            y = x;
+        } else {
+            // step 677
+            b = 90 - x;
+            for (int i3 = 0; i3 < 4; i3++) {
+                y = 64 * step3(y);
+            }
+            for (int i3 = 0; i3 < 36; i3++) {
+                for (int i4 = 0; i4 < 21; i4++) {
+                    i3 = x;
+                }
+            }
+        }
+        step1(y, y);
+        // step 689
+        y = a * 73;
+        return step4(y, a) * x;
+    }
+    
+    // step6: generated
+    static int step6(int a) {
+        int x = 1 + a - a;
+        int y = 4;
+        for (int i2 = 0; i2 < 58; i2++) {
+            if (a == 98) {
+                // step 700
+                i2 = 20 * 92;
+                if (a < 90) {
+                    // step 703
+                    a = a;
+                }
+                // step 706
+                x = 95 + x;
+            } else {
+                // step 709
+                x = step4(i2, x) - a - 8;
+            }
+            if (y == 98) {
+                // step 713
+                x = step2(y, y) - i2;
+            }
+            step3(i2);
+        }
+        if (a == 37) {
+            x = y;
+            if (y > 44) {
+                if (y == 76) {
+                    a = step0(x) + y + 49;
+                } else {
+                    step5(y, x);
+                    // step 725
+                    a = x + 53;
+                }
+                if (x < 15) {
+                    if (x < 86) {
+                        // step 730
+                        x = x * 27 + y;
+                        // step 732
+                        x = x * 75;
+                    }
+                } else {
+                    if (a > 74) {
+                        // step 737
+                        y = 0 + x + x;
+                        // step 739
+                        y = 63 - x * x;
+                        // step 741
+                        x = step4(y, y) - a;
+                    } else {
+                        // step 744
+                        x = x;
+                        // step 746
+                        a = x + 29;
+                    }
+                }
+            } else {
+                a = step5(y, x);
+                a = y;
+                if (y == 60) {
+                    x = 24;
+                    step1(a, y);
+                }
+            }
+        } else {
+            x = x * x;
+            step4(x, a);
+            // step 761
+            x = 85;
+            x = a + a;
+        }
+        // step 765
+        a = 73 * x + 33;
+        if (y == 76) {
+            // step 768
+            x = 69 * y;
+            for (int i3 = 0; i3 < 52; i3++) {
+                i3 = i3;
+            }
+            // step 773
+            a = x;
+        }
+        return y - step5(a, y) * 89;
+    }
+    
+    // step7: generated
+    static int step7(int a, int b) {
+        int x = a;
+        int y = 47;
+        if (x == 80) {
+            if (a < 18) {
+                // step 785
+                x = 44 - step3(b) - 23;
+            }
+            step3(y);
+            // step 789
+            x = step1(y, b) + step1(x, x) + 34;
+        }
+        b = 89 - 30;
+        if (y < 98) {
+            for (int i3 = 0; i3 < 17; i3++) {
+                step4(b, i3);
+                // step 796
+                y = 65;
+                a = b;
+            }
+        }
+        if (a == 98) {
+            if (x < 8) {
+                if (y == 27) {
+                    a = b * b;
+                } else {
+                    x = y - y;
+                    for (int i5 = 0; i5 < 19; i5++) {
+                        // step 808
+                        x = a * b;
+                        x = 4;
+                        // step 811
+                        a = step6(a) - 49;
+                    }
+                    for (int i5 = 0; i5 < 56; i5++) {
+                        step1(b, y);
+                    }
+                }
+            }
+            if (x > 20) {
+                if (x < 74) {
+                    // step 821
+                    a = 61 * 21;
+                    // step 823
+                    a = step4(a, a);
+                } else {
+                    a = b + a;
+                    // step 827
+                    y = step0(a);
+                }
+            }
+            if (y < 38) {
+                x = a;
+                if (y == 50) {
+                    for (int i5 = 0; i5 < 84; i5++) {
+                        b = y + x * x;
+                        // step 836
+                        a = 62;
+                    }
+                }
+            }
+            if (y == 75) {
+                if (b == 42) {
+                    for (int i5 = 0; i5 < 79; i5++) {
+                        step0(i5);
+                        step6(b);
+                    }
+                    x = a;
+                } else {
+                    step3(b);
+                    b = x * b - y;
+                    x = 64;
+                }
+            }
+        }
+        y = 87;
+        return 72;
+    }
+    
+    public static void main(String[] args) {
+        int total = 0;
+        total = total + step3(80);
+        total = total + step4(36, 97);
+        total = total + step5(56, 65);
+        total = total + step6(75);
+        total = total + step7(36, 66);
+        System.out.println(total);
+    }
+}
@@ -0,0 +1,860 @@
+public class Fixture {
+
+    // step0: generated
+    static int step0(int a) {
+        int x = a + a;
+        int y = 53;
+        for (int i2 = 0; i2 < 66; i2++) {
+            i2 = 34 + a - i2;
+            if (y < 41) {
+                x = 1 * 2 + y;
+                a = 28 - i2 - 87;
+            } else {
+                if (x > 22) {
+                    if (i2 < 47) {
+                        for (int i6 = 0; i6 < 37; i6++) {
+                            i2 = i2 + i6;
+                        }
+                    }
+                } else {
+                    if (x == 81) {
+                        x = 31;
+                    }
+                    for (int i5 = 0; i5 < 54; i5++) {
+                        for (int i6 = 0; i6 < 52; i6++) {
+                            if (i2 > 6) {
+                                // step 25
+                                x = 42 - y;
+                                // step 27
+                                i5 = 81 + y + i6;
+                            }
+                            x = 46 + i6;
+                        }
+                        if (i2 < 84) {
+                            if (i2 < 22) {
+                                if (i2 == 79) {
+                                    x = 16;
+                                } else {
+                                    for (int i9 = 0; i9 < 31; i9++) {
+                                        a = a * 14 + a;
+                                    }
+                                    y = i2 - a;
+                                }
+                            } else {
+                                if (i5 == 60) {
+                                    if (i2 > 83) {
+                                        i2 = i5 + x;
+                                    }
+                                } else {
+                                    // step 48
+                                    y = y;
+                                }
+                            }
+                        } else {
+                            if (i2 < 55) {
+                                if (x == 39) {
+                                    if (i5 == 67) {
+                                        a = i2 - i5;
+                                    } else {
+                                        // step 58
+                                        a = a;
+                                    }
+                                }
+                            } else {
+                                if (a == 96) {
+                                    i5 = x * 1;
+                                } else {
+                                    a = a + i5 - 39;
+                                }
+                            }
+                        }
+                    }
+                    a = 84;
+                }
+                if (x < 83) {
+                    a = x + i2;
+                } else {
+                    for (int i5 = 0; i5 < 16; i5++) {
+                        if (i5 < 51) {
+                            if (i5 == 63) {
+                                x = y + x * 10;
+                            } else {
+                                i5 = a * x;
+                            }
+                        }
+                        if (a > 57) {
+                            i2 = i2 + i5 * y;
+                        } else {
+                            y = i2;
+                        }
+                    }
+                }
+                if (a > 39) {
+                    a = 63 - x - x;
+                }
+            }
+        }
+        x = y - y - 11;
+        a = y * 15 * 82;
+        if (a < 74) {
+            for (int i3 = 0; i3 < 73; i3++) {
+                x = 74 * i3;
+                if (y == 77) {
+                    if (i3 < 72) {
+                        if (x > 46) {
+                            x = a * x + i3;
+                        } else {
+                            x = 48 * i3;
+                        }
+                    } else {
+                        if (x < 9) {
+                            x = y * i3;
+                            if (x < 47) {
+                                // step 112
+                                a = 7;
+                                x = y * y - 44;
+                            } else {
+                                // step 116
+                                i3 = a * 39;
+                                i3 = a;
+                            }
+                        } else {
+                            if (a == 14) {
+                                for (int i8 = 0; i8 < 15; i8++) {
+                                    if (y < 15) {
+                                        i8 = 86 * i3;
+                                    } else {
+                                        // step 126
+                                        y = 10 - i8 + 32;
+                                    }
+                                }
+                                if (i3 > 48) {
+                                    for (int i9 = 0; i9 < 4; i9++) {
+                                        i9 = i3 - i3;
+                                    }
+                                } else {
+                                    if (i3 == 35) {
+                                        x = i3 * x;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+            a = x - 69 + 5;
+            x = x * y;
+        } else {
+            x = x + 71 + 32;
+            if (x > 15) {
+                x = y - x - y;
+            } else {
+                a = y + 62;
+                if (a > 74) {
+                    if (a == 2) {
+                        // step 154
+                        y = 83;
+                    } else {
+                        a = 66 * a * y;
+                        y = x - y;
+                        y = 26 + x + 90;
+                    }
+                } else {
+                    a = x - a + y;
+                }
+                if (y < 86) {
+                    if (x > 39) {
+                        // step 166
+                        y = 56;
+                    } else {
+                        if (a == 37) {
+                            for (int i7 = 0; i7 < 24; i7++) {
+                                if (y < 64) {
+                                    // step 172
+                                    x = x * 35;
+                                } else {
+                                    y = a - 10;
+                                }
+                            }
+                            if (y > 86) {
+                                y = 37;
+                            }
+                        } else {
+                            a = 80 * a;
+                        }
+                    }
+                    x = 74 - x;
+                    if (x == 85) {
+                        if (a < 37) {
+                            for (int i7 = 0; i7 < 96; i7++) {
+                                y = a - 21 - a;
+                            }
+                            // step 191
+                            x = x - a;
+                        }
+                        // step 194
+                        y = a;
+                    } else {
+                        for (int i6 = 0; i6 < 73; i6++) {
+                            if (a == 31) {
+                                i6 = i6;
+                                for (int i8 = 0; i8 < 66; i8++) {
+                                    if (x > 3) {
+                                        // step 202
+                                        y = a - 83 + 36;
+                                    }
+                                }
+                            }
+                        }
+                        if (x == 99) {
+                            if (x > 81) {
+                                for (int i8 = 0; i8 < 80; i8++) {
+                                    if (y < 1) {
+                                        i8 = 7 * 90;
+                                    } else {
+                                        // step 214
+                                        i8 = y - 77;
+                                    }
+                                }
+                                // step 218
+                                y = x;
+                            } else {
+                                // step 221
+                                y = x - a;
+                            }
+                        } else {
+                            if (a > 11) {
+                                if (y > 65) {
+                                    if (x < 97) {
+                                        x = a - x;
+                                    } else {
+                                        // step 230
+                                        a = 71;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                } else {
+                    y = a;
+                }
+            }
+            if (a < 13) {
+                x = 40 + a - y;
+            } else {
+                a = x;
+            }
+            y = 66;
+        }
+        if (y > 39) {
+            if (y == 93) {
+                if (x == 78) {
+                    x = 20 * 56 - x;
+                    x = x + y + x;
+                    if (y > 18) {
+                        if (y == 15) {
+                            a = 29 - y;
+                        } else {
+                            if (a > 77) {
+                                y = x + x;
+                            }
+                        }
+                    }
+                }
+                a = x;
+            } else {
+                if (x > 44) {
+                    y = 66 - a;
+                    x = 27;
+                }
+                y = 18 * y;
+            }
+        } else {
+            // step 272
+            x = 21 * y;
+            y = y * a;
+        }
+        for (int i2 = 0; i2 < 23; i2++) {
+            if (y > 39) {
+                if (y < 48) {
+                    if (i2 < 34) {
+                        if (i2 == 68) {
+                            a = y + y + i2;
+                        }
+                    } else {
+                        i2 = 81;
+                    }
+                    y = 71 * x + i2;
+                    for (int i5 = 0; i5 < 39; i5++) {
+                        a = a + y;
+                    }
+                }
+                if (a == 68) {
+                    y = x;
+                } else {
+                    y = y;
+                    for (int i5 = 0; i5 < 50; i5++) {
+                        if (x < 20) {
+                            if (x < 92) {
+                                if (a == 40) {
+                                    for (int i9 = 0; i9 < 58; i9++) {
+                                        i5 = a * a;
+                                    }
+                                }
+                            } else {
+                                if (i5 < 46) {
+                                    if (i2 > 9) {
+                                        i5 = i5 - y;
+                                    } else {
+                                        i2 = 33 * i2;
+                                    }
+                                }
+                            }
+                        } else {
+                            // step 313
+                            i5 = i5 * i2;
+                        }
+                        for (int i6 = 0; i6 < 85; i6++) {
+                            for (int i7 = 0; i7 < 71; i7++) {
+                                y = 73;
+                            }
+                            i6 = 42 + 43;
+                        }
+                        if (i2 == 2) {
+                            // step 323
+                            i5 = a;
+                        }
+                    }
+                    i2 = y + 58 + 5;
+                }
+                i2 = y;
+            } else {
+                if (y < 58) {
+                    // step 332
+                    y = y;
+                } else {
+                    for (int i5 = 0; i5 < 44; i5++) {
+                        // step 336
+                        a = 26 - y;
+                    }
+                }
+            }
+            i2 = x * x - 41;
+        }
+        x = x;
+        a = y;
+        return 84 + 86 - 63;
+    }
+    
+    // step1: generated
+    static int step1(int a, int b) {
+        int x = 54 - b - a;
+        int y = 28;
+        b = 67 + 35;
+        y = b;
+        // step 354
+        a = y + step0(a) + b;
+        for (int i2 = 0; i2 < 10; i2++) {
+            for (int i3 = 0; i3 < 74; i3++) {
+                if (b == 34) {
+                    if (y > 28) {
+                        x = 85 * 13 - a;
+                    } else {
+                        step0(x);
+                    }
+                } else {
+                    if (i3 == 29) {
+                        // step 366
+                        x = step0(a);
+                    } else {
+                        step0(a);
+                        i3 = 42 + step0(a) - y;
+                        if (i3 < 75) {
+                            i2 = y * x - step0(i2);
+                            if (x == 74) {
+                                if (i2 == 63) {
+                                    if (i3 == 63) {
+                                        step0(a);
+                                    } else {
+                                        // step 378
+                                        a = 74 - a * y;
+                                    }
+                                    x = step0(i3) * 24;
+                                }
+                            } else {
+                                if (i2 < 4) {
+                                    // step 385
+                                    i2 = 9 * step0(y) + x;
+                                    step0(b);
+                                } else {
+                                    a = 93 - a * step0(a);
+                                }
+                                for (int i8 = 0; i8 < 38; i8++) {
+                                    step0(x);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return 47;
+    }
+    
+    // step2: generated
+    static int step2(int a, int b) {
+        int x = b + a * b;
+        int y = 36;
+        x = 78 - step0(y);
+        a = a + 40;
+        a = y;
+        if (b == 63) {
+            if (a > 35) {
+                b = x + y * 37;
+            }
+        } else {
+            step1(x, x);
+        }
+        step0(y);
+        if (b < 93) {
+            if (y == 57) {
+                b = 61 + 52 + a;
+            } else {
+                // step 422
+                b = y * a;
+                y = b * y;
+                if (y == 85) {
+                    b = 12;
+                    step0(y);
+                    if (a == 51) {
+                        if (b > 4) {
+                            x = 34 * x;
+                            y = 30 * b - step0(b);
+                        } else {
+                            a = 33 + 0 + y;
+                        }
+                    }
+                } else {
+                    a = 11 * x * 77;
+                    if (b < 70) {
+                        if (x == 69) {
+                            if (b > 59) {
+                                x = b;
+                            } else {
+                                y = b - 55 - step1(y, a);
+                            }
+                        } else {
+                            step0(a);
+                        }
+                    } else {
+                        step1(x, y);
+                        b = b;
+                    }
+                    if (x > 86) {
+                        step1(y, y);
+                        if (a > 15) {
+                            step0(x);
+                        } else {
+                            // step 457
+                            x = b - x;
+                        }
+                    } else {
+                        if (y < 25) {
+                            if (x < 9) {
+                                y = a - x;
+                            }
+                        } else {
+                            step0(a);
+                        }
+                        if (b > 93) {
+                            y = 66;
+                        } else {
+                            for (int i7 = 0; i7 < 91; i7++) {
+                                if (a < 6) {
+                                    step0(b);
+                                } else {
+                                    if (y == 53) {
+                                        b = 76 + 64;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+            for (int i3 = 0; i3 < 34; i3++) {
+                x = 16 + 91;
+            }
+            step1(x, y);
+            if (a == 92) {
+                x = 45;
+                step1(x, b);
+            } else {
+                a = step0(x) - a + 65;
+                x = step1(y, a) - b * x;
+            }
+        }
+        return b + x;
+    }
+    
+    // step3: generated
+    static int step3(int a) {
+        int x = 10 + 13;
+        int y = 73;
+        step2(a, y);
+        // step 504
+        a = 45 * x;
+        y = x;
+        x = 93;
+        y = x * a - y;
+        // step 509
+        a = 0 - y + x;
+        x = y;
+        return 84;
+    }
+    
+    // step4: generated
+    static int step4(int a, int b) {
+        int x = 71;
+        int y = 58;
+        if (b < 33) {
+            if (x == 49) {
+                x = a;
+            }
+        } else {
+            if (b > 50) {
+                step0(x);
+                // step 526
+                y = 14;
+            } else {
+                if (a > 33) {
+                    for (int i5 = 0; i5 < 72; i5++) {
+                        if (y > 94) {
+                            if (b == 26) {
+                                a = step0(a);
+                            }
+                        }
+                        if (x == 65) {
+                            for (int i7 = 0; i7 < 62; i7++) {
+                                step1(i7, i7);
+                            }
+                        }
+                        if (i5 < 99) {
+                            for (int i7 = 0; i7 < 20; i7++) {
+                                step2(i7, i7);
+                            }
+                            for (int i7 = 0; i7 < 19; i7++) {
+                                step3(y);
+                                x = b;
+                            }
+                        } else {
+                            // step 550
+                            b = 89;
+                        }
+                    }
+                    x = step1(b, y);
+                } else {
+                    y = 11;
+                    if (y == 12) {
+                        for (int i6 = 0; i6 < 70; i6++) {
+                            for (int i7 = 0; i7 < 67; i7++) {
+                                y = y;
+                            }
+                            step1(y, i6);
+                        }
+                    } else {
+                        for (int i6 = 0; i6 < 42; i6++) {
+                            for (int i7 = 0; i7 < 13; i7++) {
+                                step3(y);
+                            }
+                        }
+                        if (x == 77) {
+                            a = 44 - b + y;
+                        } else {
+                            if (b == 1) {
+                                step0(y);
+                            }
+                        }
+                        if (x == 15) {
+                            a = 91;
+                        }
+                    }
+                    if (b == 34) {
+                        step2(b, b);
+                        // step 583
+                        b = x;
+                    }
+                }
+            }
+            if (y == 47) {
+                b = b + b;
+            }
+            b = b * x * b;
+        }
+        y = step0(x);
+        b = step3(x);
+        a = 80 * 72 * step1(x, y);
+        y = 64 * a;
+        return 10;
+    }
+    
+    // step5: generated
+    static int step5(int a, int b) {
+        int x = a - 29;
+        int y = 61;
+        if (y > 12) {
+            if (y > 72) {
+                x = 98 - b - 36;
+            }
+            b = y + x * 19;
+        }
+        for (int i2 = 0; i2 < 97; i2++) {
+            if (a < 31) {
+                for (int i4 = 0; i4 < 84; i4++) {
+                    step1(i2, x);
+                }
+                a = a + step1(x, i2);
+                for (int i4 = 0; i4 < 67; i4++) {
+                    if (i2 > 98) {
+                        // step 618
+                        i4 = i4 - step3(b) * step4(i2, i2);
+                    } else {
+                        if (y == 77) {
+                            if (y > 78) {
+                                step3(i2);
+                                // step 624
+                                y = step1(a, b);
+                            } else {
+                                if (b > 21) {
+                                    step0(b);
+                                }
+                            }
+                            if (i2 > 27) {
+                                if (x > 99) {
+                                    if (i2 == 73) {
+                                        y = b + 32 - 29;
+                                    } else {
+                                        // step 636
+                                        y = a + a;
+                                    }
+                                } else {
+                                    if (i2 > 13) {
+                                        step3(b);
+                                    } else {
+                                        // step 643
+                                        i4 = y;
+                                    }
+                                    for (int i9 = 0; i9 < 97; i9++) {
+                                        // step 647
+                                        a = i2;
+                                    }
+                                }
+                                x = b;
+                            }
+                        } else {
+                            // step 654
+                            y = step1(i4, a) + i4 + i4;
+                            y = y - 55;
+                        }
+                    }
+                }
+            } else {
+                step1(a, x);
+                for (int i4 = 0; i4 < 82; i4++) {
+                    if (b > 53) {
+                        step4(i2, x);
+                    }
+                    if (i2 > 72) {
+                        step1(a, i4);
+                        i2 = 73;
+                    } else {
+                        step3(y);
+                    }
+                    step1(i2, a);
+                }
+                if (x > 85) {
+                    i2 = step4(x, i2) + x;
+                } else {
+                    i2 = y * 27 * a;
+                }
+            }
+            x = 68;
+            i2 = step2(b, i2) + b;
+        }
+        if (a > 87) {
+            step1(b, b);
+            x = 86 + y * 82;
+            y = 64 - y;
+            // step 687
+            x = 85 * a;
+        }
+        step3(a);
+        y = 22 - b;
+        for (int i2 = 0; i2 < 75; i2++) {
+            y = 89 - 73;
+            y = step1(y, i2);
+            for (int i3 = 0; i3 < 64; i3++) {
+                if (i2 < 79) {
+                    if (b > 27) {
+                        for (int i6 = 0; i6 < 51; i6++) {
+                            for (int i7 = 0; i7 < 95; i7++) {
+                                step2(y, y);
+                                step4(i7, y);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return step3(b) * b;
+    }
+    
+    // step6: generated
+    static int step6(int a) {
+        int x = a + a;
+        int y = 59;
+        for (int i2 = 0; i2 < 23; i2++) {
+            if (x > 79) {
+                if (y == 93) {
+                    x = 11;
+                }
+                if (y < 12) {
+                    y = 87 * step2(x, a);
+                }
+                step3(x);
+            } else {
+                i2 = 96 * 6;
+            }
+            // step 727
+            i2 = 56;
+            step5(y, x);
+        }
+        // step 731
+        a = 9 - 29 * a;
+        if (y > 30) {
+            // step 734
+            x = 78 - y * x;
+        } else {
+            x = y;
+        }
+        a = 97;
+        return 67;
+    }
+    
+    // step7: generated
+    static int step7(int a, int b) {
+        int x = b + a;
+        int y = 51;
+        if (b < 20) {
+            if (x < 85) {
+                for (int i4 = 0; i4 < 58; i4++) {
+                    if (b == 83) {
+                        b = b;
+                        if (a > 78) {
+                            for (int i7 = 0; i7 < 95; i7++) {
+                                if (a < 29) {
+                                    i4 = 42 + 57 - a;
+                                }
+                            }
+                        } else {
+                            if (a == 52) {
+                                if (y < 82) {
+                                    for (int i9 = 0; i9 < 67; i9++) {
+                                        // step 762
+                                        y = 77;
+                                    }
+                                } else {
+                                    a = b + 26;
+                                }
+                            } else {
+                                // step 769
+                                y = 56 * x;
+                            }
+                        }
+                    }
+                    // step 774
+                    y = 72;
+                }
+            }
+        } else {
+            if (b < 54) {
+                for (int i4 = 0; i4 < 78; i4++) {
+                    if (x == 91) {
+                        // step 782
+                        a = 52 * step3(x);
+                        y = 12;
+                    } else {
+                        i4 = 0;
+                        if (x > 72) {
+                            y = 25 * b - b;
+                        } else {
+                            y = 45;
+                        }
+                        step0(y);
+                    }
+                    step2(b, i4);
+                    if (b == 81) {
+                        for (int i6 = 0; i6 < 78; i6++) {
+                            for (int i7 = 0; i7 < 50; i7++) {
+                                // step 798
+                                a = i7 - 13;
+                            }
+                            // step 801
+                            a = a;
+                        }
+                    } else {
+                        step1(x, y);
+                    }
+                }
+                step4(a, a);
+            } else {
+                if (a > 44) {
+                    y = 55 * 71;
+                }
+                x = y * a;
+                for (int i4 = 0; i4 < 87; i4++) {
+                    step6(x);
+                }
+            }
+        }
+        for (int i2 = 0; i2 < 91; i2++) {
+            a = 31;
+            step6(b);
+            if (y > 66) {
+                for (int i4 = 0; i4 < 53; i4++) {
+                    // step 824
+                    x = 46 * 79 + i4;
+                    if (i4 < 97) {
+                        step1(a, x);
+                        step2(b, y);
+                    }
+                }
+                if (i2 == 34) {
+                    // step 832
+                    a = a;
+                    // step 834
+                    b = step4(b, x) - i2;
+                }
+            }
+            if (a == 85) {
+                x = 32 + a * y;
+            }
+        }
+        if (y < 44) {
+            if (x > 46) {
+                y = a + 57;
+            }
+        }
+        return 51 - x - a;
+    }
+    
+    public static void main(String[] args) {
+        int total = 0;
+        total = total + step3(1);
+        total = total + step4(33, 37);
+        total = total + step5(36, 95);
+        total = total + step6(82);
+        total = total + step7(31, 22);
+        System.out.println(total);
+    }
+}
@@ -0,0 +1,77 @@
+public class Fixture {
+
+    // step0: generated
+    static int step0(int a) {
+        int x = 30;
+        int y = 34;
+        a = 77 * y + 39;
+        // step 7
+        y = 27 + x * y;
+        x = 24;
+        if (x > 80) {
+            for (int i3 = 0; i3 < 32; i3++) {
+                // step 12
+                y = x;
+                // step 14
+                x = x;
+                i3 = y - 66 * i3;
+            }
+            x = x - y + a;
+            if (y > 60) {
+                a = a - 57 + a;
+            } else {
+                // step 22
+                x = x - 73;
+            }
+        }
+        for (int i2 = 0; i2 < 17; i2++) {
+            for (int i3 = 0; i3 < 11; i3++) {
+                // step 28
+                x = x - x;
+                i3 = x * 26;
+                // step 31
+                a = y * 57 - x;
+            }
+            a = y + 7 * a;
+        }
+        y = 97 + a;
+        return x - 89 - a;
+    }
+    
+    // step1: generated
+    static int step1(int a, int b) {
+        int x = a;
+        int y = 92;
+        // step 44
+        a = 27 - x;
+        x = x * x + 87;
+        if (y > 4) {
+            x = x + x - x;
+            if (y < 24) {
+                // step 50
+                b = a - 99;
+            }
+            a = 57 + 36;
+            y = a + x - step0(x);
+        } else {
+            b = 68 - 28 + 99;
+            for (int i3 = 0; i3 < 2; i3++) {
+                // step 58
+                y = 17 * i3;
+                // step 60
+                b = 43 * i3 - 99;
+            }
+            for (int i3 = 0; i3 < 92; i3++) {
+                a = 97 * a;
+            }
+        }
+        return step0(y);
+    }
+    
+    public static void main(String[] args) {
+        int total = 0;
+        total = total + step0(59);
+        total = total + step1(91, 51);
+        System.out.println(total);
+    }
+}
@@ -0,0 +1,5095 @@
+// step0: generated
+function step0(a) {
+    let x = a;
+    let y = 29;
+    y = x;
+    x = 36 - 53;
+    x = y * 90 + x;
+    return 71;
+}
+
+// step1: generated
+function step1(a, b) {
+    let x = 28;
+    let y = 99;
+    if (a < 19) {
+        b = 35 - x;
+        step0(a);
+    } else {
+        b = step0(b);
+        x = 60 * 62;
+    }
+    step0(x);
+    // step 22
+    a = y;
+    a = 13 - x;
+    if (x > 54) {
+        a = a * step0(b);
+        a = 50;
+    }
+    for (let i1 = 0; i1 < 31; i1++) {
+        step0(x);
+        step0(x);
+    }
+    for (let i1 = 0; i1 < 10; i1++) {
+        if (x === 53) {
+            x = 62;
+            b = 13 - 82 + 90;
+            a = step0(i1) * step0(y);
+            if (b < 29) {
+                for (let i4 = 0; i4 < 30; i4++) {
+                    // step 40
+                    a = step0(y);
+                }
+                x = 68 * 30 * 71;
+            } else {
+                for (let i4 = 0; i4 < 91; i4++) {
+                    // step 46
+                    i4 = i4 + i4 - a;
+                    b = 51;
+                }
+            }
+        }
+        // step 52
+        i1 = i1 + 83 - 24;
+        b = b;
+        if (i1 < 72) {
+            x = 66 * i1;
+            if (x === 78) {
+                x = step0(a) + x;
+                if (a === 55) {
+                    i1 = a + i1 * i1;
+                    // step 61
+                    x = b - a;
+                    // step 63
+                    y = 30;
+                } else {
+                    // step 66
+                    y = 51 + step0(b);
+                }
+            } else {
+                i1 = step0(i1);
+                step0(a);
+            }
+            y = step0(b) - 82;
+        } else {
+            if (y < 5) {
+                a = y;
+            }
+            if (b === 51) {
+                b = x - a - 58;
+                step0(i1);
+                step0(a);
+            }
+            step0(i1);
+        }
+    }
+    x = x;
+    return 95 - y + y;
+}
+
+// step2: generated
+function step2(a, b) {
+    let x = b + a;
+    let y = 95;
+    for (let i1 = 0; i1 < 23; i1++) {
+        // step 95
+        b = a - 7;
+        if (x > 52) {
+            if (b < 74) {
+                a = x;
+                for (let i4 = 0; i4 < 53; i4++) {
+                    // step 101
+                    i4 = y * a * b;
+                }
+            }
+        } else {
+            b = 30 + y;
+            if (i1 === 13) {
+                b = b;
+            }
+        }
+        step0(i1);
+    }
+    if (x === 42) {
+        x = step0(a) * a;
+        y = x * 37 + 82;
+        // step 116
+        b = step1(b, a);
+    } else {
+        if (y < 81) {
+            if (a === 36) {
+                if (x === 83) {
+                    // step 122
+                    a = 5;
+                } else {
+                    // step 125
+                    y = step1(y, a) - 59;
+                }
+            }
+            if (a === 0) {
+                // step 130
+                b = 3;
+                if (y < 0) {
+                    // step 133
+                    b = y * step1(y, x) + y;
+                    // step 135
+                    y = step0(b);
+                }
+            } else {
+                b = 15 - step1(y, b);
+            }
+            // step 141
+            a = step1(x, a);
+        }
+        step0(a);
+    }
+    for (let i1 = 0; i1 < 12; i1++) {
+        step1(b, i1);
+        for (let i2 = 0; i2 < 45; i2++) {
+            if (i1 < 88) {
+                a = step1(y, y);
+            } else {
+                // step 152
+                i1 = 68 * 3;
+                if (a < 32) {
+                    // step 155
+                    x = 97 + y + 51;
+                    // step 157
+                    a = x - i1;
+                    // step 159
+                    i1 = b * a - y;
+                } else {
+                    x = 59;
+                }
+                i1 = step0(x);
+            }
+            i2 = x + i2 - b;
+            if (b === 42) {
+                if (x > 8) {
+                    // step 169
+                    x = y + y;
+                    // step 171
+                    i1 = 62;
+                    i1 = 58;
+                }
+            } else {
+                if (i1 < 34) {
+                    // step 177
+                    y = 36;
+                    // step 179
+                    x = b;
+                    // step 181
+                    b = 46 * x * y;
+                }
+            }
+        }
+    }
+    step1(y, a);
+    return a;
+}
+
+// step3: generated
+function step3(a) {
+    let x = a - 62;
+    let y = 46;
+    x = a - a;
+    y = 41 + a + y;
+    if (a < 86) {
+        if (x < 35) {
+            if (x === 34) {
+                a = x + a;
+                for (let i4 = 0; i4 < 49; i4++) {
+                    step0(x);
+                    i4 = step2(a, y) + x;
+                }
+                if (y < 66) {
+                    y = a * 59 * a;
+                    // step 207
+                    x = 14;
+                    // step 209
+                    a = y;
+                } else {
+                    // step 212
+                    x = x;
+                }
+            }
+            y = 50 - x;
+        } else {
+            x = step0(y) + 0;
+            y = 94 - x - x;
+            for (let i3 = 0; i3 < 75; i3++) {
+                if (x > 84) {
+                    step1(i3, a);
+                    y = 68;
+                } else {
+                    // step 225
+                    a = a;
+                    step1(i3, i3);
+                }
+                if (a < 7) {
+                    // step 230
+                    x = i3 + a * a;
+                    // step 232
+                    a = x + step2(y, i3) * 29;
+                    // step 234
+                    y = a + a - step2(x, y);
+                }
+                // step 237
+                y = 20;
+            }
+        }
+    } else {
+        x = x - step2(x, y);
+        if (x > 34) {
+            a = 74 * y * y;
+        }
+        for (let i2 = 0; i2 < 60; i2++) {
+            // step 247
+            x = y;
+            y = 28 * step0(y);
+        }
+    }
+    y = y;
+    return 32 - a - x;
+}
+
+// step4: generated
+function step4(a, b) {
+    let x = b * 73 - a;
+    let y = 36;
+    b = 83 + b - y;
+    step1(y, x);
+    x = 98;
+    step0(x);
+    step0(x);
+    // step 265
+    x = a;
+    if (x > 51) {
+        if (y > 52) {
+            for (let i3 = 0; i3 < 85; i3++) {
+                y = 58 * y + a;
+                x = i3;
+                if (b === 70) {
+                    // step 273
+                    x = i3 + x;
+                    b = 69 * step1(x, b);
+                    i3 = step3(i3) * b - 73;
+                }
+            }
+            x = 93;
+            step3(y);
+        }
+    } else {
+        step3(y);
+        y = y + x - y;
+        // step 285
+        a = step1(a, b) + b * 50;
+        for (let i2 = 0; i2 < 33; i2++) {
+            y = 67 - b + step1(i2, b);
+            if (i2 > 17) {
+                if (y < 47) {
+                    step0(x);
+                }
+            }
+            for (let i3 = 0; i3 < 9; i3++) {
+                step2(x, a);
+            }
+            i2 = 69;
+        }
+    }
+    step1(x, a);
+    return 60 * 3 - x;
+}
+
+// step5: generated
+function step5(a, b) {
+    let x = b;
+    let y = 21;
+    // step 308
+    a = 14;
+    if (x === 43) {
+        a = 25 * step1(x, x);
+        for (let i2 = 0; i2 < 25; i2++) {
+            for (let i3 = 0; i3 < 48; i3++) {
+                if (y === 19) {
+                    a = i3 * x;
+                    x = i2 - i2 * step4(b, x);
+                } else {
+                    // step 318
+                    i3 = x;
+                    // step 320
+                    y = 67 + i3 * y;
+                }
+                for (let i4 = 0; i4 < 81; i4++) {
+                    // step 324
+                    a = a + 79 - 61;
+                    // step 326
+                    i4 = b + b + step1(i4, y);
+                }
+            }
+            for (let i3 = 0; i3 < 26; i3++) {
+                i3 = 10 + 92;
+                for (let i4 = 0; i4 < 71; i4++) {
+                    i2 = i2;
+                    // step 334
+                    i4 = 90 + 15;
+                }
+            }
+        }
+        y = 62 - step2(y, b);
+    }
+    a = 48 + 3 + 31;
+    for (let i1 = 0; i1 < 89; i1++) {
+        for (let i2 = 0; i2 < 68; i2++) {
+            b = b - 44 - step3(i2);
+        }
+        if (x > 14) {
+            step2(i1, x);
+            if (i1 > 56) {
+                for (let i4 = 0; i4 < 37; i4++) {
+                    i1 = 11 - step3(a);
+                    // step 351
+                    i1 = a + x;
+                    b = a * i4;
+                }
+                y = 22 - i1;
+            }
+            if (x > 39) {
+                for (let i4 = 0; i4 < 60; i4++) {
+                    i4 = 32;
+                }
+                if (b === 67) {
+                    // step 362
+                    a = step1(y, y) * i1 - x;
+                } else {
+                    // step 365
+                    x = a;
+                }
+                if (x < 61) {
+                    // step 369
+                    i1 = a * x - 57;
+                    // step 371
+                    i1 = y;
+                } else {
+                    // step 374
+                    i1 = 73 - 46 + a;
+                    // step 376
+                    x = 6;
+                }
+            } else {
+                i1 = 35 * step2(a, b);
+            }
+        } else {
+            for (let i3 = 0; i3 < 47; i3++) {
+                b = y + step4(a, a) + i3;
+            }
+            x = step3(a);
+            for (let i3 = 0; i3 < 67; i3++) {
+                if (b === 79) {
+                    // step 389
+                    i3 = y + i3;
+                }
+            }
+        }
+        i1 = step4(y, i1) + i1 - i1;
+        for (let i2 = 0; i2 < 31; i2++) {
+            for (let i3 = 0; i3 < 18; i3++) {
+                // step 397
+                i2 = y * 80 * b;
+                step2(i1, i1);
+            }
+            step2(y, x);
+            for (let i3 = 0; i3 < 62; i3++) {
+                if (i3 > 25) {
+                    step0(a);
+                }
+            }
+            step0(b);
+        }
+    }
+    return 98 * 57;
+}
+
+// step6: generated
+function step6(a) {
+    let x = a * a * a;
+    let y = 55;
+    step0(a);
+    step5(x, a);
+    y = a * 95 - 81;
+    a = 33 + y;
+    step2(y, y);
+    step3(x);
+    return 70 * a - a;
+}
+
+// step7: generated
+function step7(a, b) {
+    let x = a * b + 61;
+    let y = 76;
+    if (x > 21) {
+        for (let i2 = 0; i2 < 48; i2++) {
+            y = x;
+        }
+        step4(a, b);
+        if (x > 49) {
+            b = x - b * 8;
+        }
+    } else {
+        if (b > 16) {
+            if (x === 25) {
+                for (let i4 = 0; i4 < 7; i4++) {
+                    // step 442
+                    x = y + 60;
+                }
+                x = y * 94;
+                if (y === 89) {
+                    b = 34;
+                }
+            }
+            if (a < 19) {
+                x = a - a;
+            } else {
+                if (x > 88) {
+                    x = 54 - b + x;
+                    // step 455
+                    b = 37 + 84 - y;
+                }
+                // step 458
+                a = x * x - y;
+            }
+            x = 98 - x;
+        } else {
+            y = y - y;
+            step0(b);
+            x = step5(b, a) - x;
+        }
+        step0(y);
+    }
+    y = a - 85;
+    if (b === 39) {
+        for (let i2 = 0; i2 < 10; i2++) {
+            // step 472
+            b = b - a * step3(b);
+            if (x > 49) {
+                step6(i2);
+            } else {
+                b = 41 * y;
+                step4(x, a);
+                if (y > 93) {
+                    step6(i2);
+                } else {
+                    step3(a);
+                    // step 483
+                    y = b;
+                    // step 485
+                    b = y + 79;
+                }
+            }
+            step4(b, i2);
+        }
+        for (let i2 = 0; i2 < 98; i2++) {
+            for (let i3 = 0; i3 < 42; i3++) {
+                b = x * step1(i2, x) + y;
+            }
+            step3(i2);
+            b = b;
+        }
+        if (a < 98) {
+            if (a === 60) {
+                a = 96;
+                x = b;
+                y = step0(y) + step3(b) * x;
+            }
+            step3(x);
+            // step 505
+            a = y - x;
+        }
+        if (x > 38) {
+            if (b === 16) {
+                y = x + a + 24;
+                b = a - 79 - step6(x);
+            }
+            step0(b);
+            if (a === 74) {
+                for (let i4 = 0; i4 < 84; i4++) {
+                    // step 516
+                    b = a - x * 18;
+                }
+            } else {
+                a = 27;
+                // step 521
+                a = 42 * 66 + 3;
+            }
+            b = a - y + x;
+        }
+    } else {
+        // step 527
+        a = y * 26;
+        if (x < 40) {
+            // step 530
+            y = 71 * 31;
+            step0(y);
+        } else {
+            if (y < 23) {
+                if (b < 71) {
+                    // step 536
+                    a = a + b + 51;
+                }
+            } else {
+                a = b - 3;
+                // step 541
+                x = x;
+                if (a > 22) {
+                    // step 544
+                    b = y;
+                }
+            }
+            a = 70;
+            if (x > 24) {
+                y = 12 - step3(a);
+            } else {
+                if (b > 73) {
+                    // step 553
+                    a = 58 - b;
+                    // step 555
+                    b = 18;
+                } else {
+                    // step 558
+                    a = 94 + 8;
+                    y = x;
+                }
+                step0(b);
+            }
+            if (b === 54) {
+                if (b > 15) {
+                    // step 566
+                    y = a;
+                    // step 568
+                    b = 18 + 46 * 86;
+                    // step 570
+                    x = y - y * step0(a);
+                } else {
+                    // step 573
+                    y = 83 - 27 - b;
+                }
+            }
+        }
+    }
+    return y + step2(x, x) * 79;
+}
+
+// step8: generated
+function step8(a, b) {
+    let x = 63;
+    let y = 55;
+    if (y < 79) {
+        if (b < 60) {
+            for (let i3 = 0; i3 < 37; i3++) {
+                // step 589
+                x = x + i3 - b;
+            }
+        } else {
+            for (let i3 = 0; i3 < 37; i3++) {
+                if (i3 > 70) {
+                    // step 595
+                    y = 88 * 3 - 5;
+                    y = 57 + y + 74;
+                    b = 92;
+                }
+                step4(y, y);
+                for (let i4 = 0; i4 < 46; i4++) {
+                    i3 = 25 + 60;
+                    // step 603
+                    i3 = x - i3 + 29;
+                    // step 605
+                    i4 = i3;
+                }
+            }
+            b = a - b;
+        }
+        step7(a, x);
+        // step 612
+        b = 70 * 51 - step1(y, b);
+    } else {
+        if (x < 81) {
+            step1(a, x);
+            x = x - a;
+            step3(x);
+            step7(b, x);
+        } else {
+            if (y === 24) {
+                step3(x);
+                for (let i4 = 0; i4 < 36; i4++) {
+                    // step 624
+                    y = step4(b, a) + 5;
+                    // step 626
+                    b = step2(x, b);
+                }
+                step2(y, y);
+            } else {
+                x = 76 * x;
+                step4(x, x);
+                if (x === 95) {
+                    x = step7(y, b) * 74;
+                    // step 635
+                    b = step7(x, x) - y;
+                    b = 99 * x * x;
+                } else {
+                    // step 639
+                    b = b;
+                    // step 641
+                    a = 75 * x * step6(a);
+                    // step 643
+                    y = a;
+                }
+            }
+        }
+    }
+    y = 56 + b;
+    step0(y);
+    // step 651
+    b = y - y;
+    for (let i1 = 0; i1 < 35; i1++) {
+        for (let i2 = 0; i2 < 40; i2++) {
+            for (let i3 = 0; i3 < 71; i3++) {
+                for (let i4 = 0; i4 < 27; i4++) {
+                    step3(a);
+                }
+            }
+            if (y === 27) {
+                if (b === 88) {
+                    x = i2 + 4;
+                }
+                step2(a, x);
+                // step 665
+                i1 = i2;
+            }
+            y = b - 12 - 83;
+        }
+        x = a;
+        y = 63;
+        a = a * 30 * 32;
+    }
+    return b + y;
+}
+
+// step9: generated
+function step9(a) {
+    let x = a + 52 + a;
+    let y = 88;
+    for (let i1 = 0; i1 < 79; i1++) {
+        if (y > 89) {
+            if (y === 24) {
+                if (a === 87) {
+                    step2(y, a);
+                }
+            } else {
+                if (x === 91) {
+                    // step 689
+                    i1 = x + 53;
+                } else {
+                    step8(i1, x);
+                }
+                x = step2(i1, i1) + a;
+                if (y === 89) {
+                    // step 696
+                    y = 48;
+                    x = 94 * step1(x, i1);
+                    // step 699
+                    a = i1 + y * a;
+                }
+            }
+        } else {
+            if (i1 > 82) {
+                if (i1 > 81) {
+                    // step 706
+                    a = 64 + 0;
+                    // step 708
+                    x = y;
+                } else {
+                    // step 711
+                    i1 = x + step2(y, x);
+                }
+                a = 95 + x + step1(i1, i1);
+                if (a < 19) {
+                    step0(a);
+                }
+            }
+        }
+        if (i1 === 23) {
+            if (a < 74) {
+                i1 = step4(y, y) - 92;
+            }
+            for (let i3 = 0; i3 < 55; i3++) {
+                i1 = step7(a, i1) + i1;
+                for (let i4 = 0; i4 < 1; i4++) {
+                    // step 727
+                    i4 = step0(i4);
+                    x = 28;
+                    // step 730
+                    i1 = 60;
+                }
+                a = 45 * i1 + 55;
+            }
+            // step 735
+            x = step3(x) - a + x;
+        } else {
+            for (let i3 = 0; i3 < 56; i3++) {
+                step3(x);
+                if (x > 92) {
+                    // step 741
+                    x = x;
+                }
+            }
+            for (let i3 = 0; i3 < 66; i3++) {
+                step6(x);
+                y = 7 - i3;
+            }
+        }
+    }
+    step0(y);
+    y = 85 + 90;
+    y = 28 - step5(y, a) - 4;
+    return x + 36;
+}
+
+// step10: generated
+function step10(a, b) {
+    let x = a + b - 74;
+    let y = 28;
+    if (y < 82) {
+        step6(b);
+    } else {
+        // step 764
+        a = b - 76 * a;
+        if (a > 85) {
+            y = y + 16 + step9(y);
+        } else {
+            if (b > 70) {
+                b = y + y * 46;
+                x = x + a;
+                // step 772
+                x = 31;
+            }
+            if (b > 80) {
+                // step 776
+                b = 40;
+                x = 17;
+                if (b > 28) {
+                    step0(a);
+                } else {
+                    // step 782
+                    x = 34 + step2(y, a);
+                    y = 41;
+                }
+            }
+            for (let i3 = 0; i3 < 40; i3++) {
+                step0(i3);
+                // step 789
+                y = 69 * x + 84;
+                if (y === 98) {
+                    // step 792
+                    a = 64;
+                    // step 794
+                    i3 = step8(i3, a) + y + b;
+                }
+            }
+        }
+        x = 4 + x;
+        step1(x, x);
+    }
+    step1(a, a);
+    if (y === 88) {
+        if (b < 24) {
+            // step 805
+            y = step0(x);
+            if (b < 41) {
+                if (b < 56) {
+                    // step 809
+                    b = step2(a, b) * a;
+                }
+                for (let i4 = 0; i4 < 21; i4++) {
+                    y = i4;
+                }
+                step0(a);
+            }
+            for (let i3 = 0; i3 < 52; i3++) {
+                if (x < 62) {
+                    y = step7(i3, i3) * step8(y, y);
+                } else {
+                    // step 821
+                    a = 58;
+                }
+                x = a * y;
+            }
+            step1(y, x);
+        }
+        for (let i2 = 0; i2 < 70; i2++) {
+            b = a + 90;
+            if (x === 32) {
+                if (x > 43) {
+                    b = x * 88 * i2;
+                    y = step7(b, y) - x;
+                } else {
+                    // step 835
+                    i2 = 47;
+                    // step 837
+                    b = 80 - i2;
+                    b = 36;
+                }
+                if (a > 43) {
+                    // step 842
+                    x = step3(i2);
+                }
+            } else {
+                y = 10 * y - step0(y);
+            }
+            b = a;
+        }
+    }
+    return 29;
+}
+
+// step11: generated
+function step11(a, b) {
+    let x = 48 + 9;
+    let y = 80;
+    if (a < 44) {
+        b = step7(y, y);
+        if (x > 9) {
+            if (x === 95) {
+                if (x === 76) {
+                    a = a;
+                } else {
+                    // step 865
+                    a = step4(x, a);
+                    step7(y, a);
+                }
+            }
+            a = 92 - x * 48;
+            y = x;
+        }
+        if (x > 99) {
+            step4(a, y);
+        }
+    }
+    b = step0(a) * step10(x, b);
+    for (let i1 = 0; i1 < 57; i1++) {
+        a = a * y;
+        if (a > 38) {
+            a = a * 62;
+            if (b === 35) {
+                x = 64 - 5;
+                y = 19 - 86 - b;
+                if (i1 < 30) {
+                    step10(b, x);
+                    b = step0(a);
+                }
+            } else {
+                if (y > 98) {
+                    // step 891
+                    y = i1 - step8(i1, x);
+                    // step 893
+                    a = y - i1;
+                } else {
+                    a = 71 - 4;
+                    // step 897
+                    i1 = 25 - 63;
+                    // step 899
+                    x = b;
+                }
+            }
+            step8(x, x);
+            i1 = y + 4;
+        }
+        i1 = a;
+    }
+    for (let i1 = 0; i1 < 39; i1++) {
+        // step 909
+        a = 86 - i1 - y;
+    }
+    y = x - x * y;
+    a = step8(b, y);
+    x = 11 - step3(y) + a;
+    return a - 51;
+}
+
+// step12: generated
+function step12(a) {
+    let x = a;
+    let y = 2;
+    a = y + y - 70;
+    for (let i1 = 0; i1 < 92; i1++) {
+        step10(i1, x);
+        step8(i1, i1);
+        step10(i1, i1);
+    }
+    step6(x);
+    a = step10(a, x) + x + 32;
+    for (let i1 = 0; i1 < 89; i1++) {
+        y = step2(a, i1) * a;
+        step0(a);
+    }
+    if (x > 42) {
+        y = 65;
+        if (a < 77) {
+            x = a;
+            x = step11(x, a) + x;
+            y = step6(a);
+        } else {
+            for (let i3 = 0; i3 < 69; i3++) {
+                i3 = step7(x, a);
+                step9(a);
+            }
+        }
+    } else {
+        for (let i2 = 0; i2 < 62; i2++) {
+            // step 948
+            a = a * 69;
+        }
+        step2(a, y);
+    }
+    return y - 19 * y;
+}
+
+// step13: generated
+function step13(a, b) {
+    let x = 63 * 84 - 96;
+    let y = 61;
+    b = a * y - 98;
+    for (let i1 = 0; i1 < 78; i1++) {
+        for (let i2 = 0; i2 < 74; i2++) {
+            a = 89 * a;
+            for (let i3 = 0; i3 < 64; i3++) {
+                if (i3 < 87) {
+                    y = step0(y);
+                    step0(i2);
+                    // step 968
+                    i2 = 28 - step8(i2, y);
+                } else {
+                    // step 971
+                    b = y - step9(i3);
+                    i3 = i1 * i2;
+                    // step 974
+                    x = 28 - 72;
+                }
+                i1 = i2;
+                if (a === 7) {
+                    step11(y, x);
+                    // step 980
+                    i3 = 21;
+                } else {
+                    // step 983
+                    x = x - step12(a) + step5(i2, i2);
+                    // step 985
+                    a = 17 + 67;
+                    // step 987
+                    a = x;
+                }
+            }
+        }
+        if (i1 > 35) {
+            a = a - step11(i1, y) - 81;
+            for (let i3 = 0; i3 < 88; i3++) {
+                i1 = b;
+            }
+            i1 = step8(x, a);
+            if (y > 16) {
+                a = 40;
+            }
+        } else {
+            a = y + b;
+            if (x === 93) {
+                if (i1 === 8) {
+                    // step 1005
+                    i1 = a - 61 - a;
+                    step11(x, b);
+                    // step 1008
+                    y = 20 - 46;
+                } else {
+                    // step 1011
+                    b = y + i1;
+                }
+                a = 67 - b;
+                step4(b, y);
+            } else {
+                a = y + 36;
+            }
+        }
+    }
+    y = a * 13 - step11(y, x);
+    x = x;
+    return a * a;
+}
+
+// step14: generated
+function step14(a, b) {
+    let x = b + a;
+    let y = 24;
+    if (y > 61) {
+        if (y < 16) {
+            y = y;
+            if (b === 81) {
+                if (x === 67) {
+                    // step 1035
+                    b = 10 - x;
+                    // step 1037
+                    y = 33;
+                }
+            } else {
+                if (x > 40) {
+                    // step 1042
+                    x = 56 + x;
+                    // step 1044
+                    b = 95;
+                }
+            }
+            for (let i3 = 0; i3 < 29; i3++) {
+                for (let i4 = 0; i4 < 47; i4++) {
+                    step10(a, a);
+                }
+            }
+            if (a < 53) {
+                y = b;
+            } else {
+                if (a > 57) {
+                    x = 88;
+                    b = step5(a, b);
+                } else {
+                    // step 1060
+                    b = 73 * y;
+                }
+                if (a === 14) {
+                    y = 1;
+                } else {
+                    step11(x, b);
+                    step7(x, y);
+                    // step 1068
+                    x = x + step11(y, x) + 19;
+                }
+                if (a < 52) {
+                    x = b + 3 - a;
+                    a = 81 * x;
+                }
+            }
+        }
+        for (let i2 = 0; i2 < 31; i2++) {
+            i2 = 27;
+        }
+        if (a < 88) {
+            x = 27 - b - 82;
+            if (b < 59) {
+                x = x;
+                if (y < 53) {
+                    // step 1085
+                    x = 62 + step7(b, b);
+                } else {
+                    // step 1088
+                    y = 91 * y;
+                }
+                for (let i4 = 0; i4 < 77; i4++) {
+                    // step 1092
+                    b = 18 + 68 + 10;
+                }
+            }
+            if (x > 43) {
+                if (y === 79) {
+                    // step 1098
+                    x = y - x;
+                }
+                if (y < 46) {
+                    step6(a);
+                }
+                step10(y, a);
+            }
+            a = 18;
+        }
+    }
+    // step 1109
+    b = 12 - y + 28;
+    b = 71;
+    step6(a);
+    a = y;
+    b = b - a + 60;
+    x = x + x + 65;
+    return x * 20 - b;
+}
+
+// step15: generated
+function step15(a) {
+    let x = 60;
+    let y = 23;
+    y = y;
+    if (a === 71) {
+        for (let i2 = 0; i2 < 96; i2++) {
+            y = i2 - 24 - y;
+            step4(a, x);
+            // step 1128
+            i2 = step4(i2, x) + 45;
+            if (y > 96) {
+                a = 42 - i2 - i2;
+                step2(i2, i2);
+            } else {
+                if (a === 92) {
+                    // step 1135
+                    i2 = 72 + 27;
+                }
+                // step 1138
+                x = y + i2;
+            }
+        }
+        if (a > 46) {
+            for (let i3 = 0; i3 < 97; i3++) {
+                if (a < 3) {
+                    a = i3 * y;
+                    a = 43 + a * 93;
+                    x = i3;
+                } else {
+                    // step 1149
+                    y = 48;
+                }
+            }
+        }
+        a = x;
+        if (y > 22) {
+            // step 1156
+            x = x * 45;
+        }
+    }
+    // step 1160
+    a = step0(x) - a - 34;
+    // step 1162
+    a = a * 47;
+    a = x + y;
+    return 15;
+}
+
+// step16: generated
+function step16(a, b) {
+    let x = 77;
+    let y = 67;
+    step11(y, y);
+    // step 1173
+    b = step5(a, x) * a + 71;
+    if (x > 23) {
+        if (a === 11) {
+            for (let i3 = 0; i3 < 61; i3++) {
+                i3 = step9(i3);
+            }
+        }
+        // step 1181
+        b = 13;
+    } else {
+        y = y * 48;
+    }
+    if (a > 6) {
+        for (let i2 = 0; i2 < 29; i2++) {
+            if (x === 0) {
+                if (i2 > 55) {
+                    y = step7(x, y) + y + 66;
+                    // step 1191
+                    a = i2 * 68 + x;
+                } else {
+                    a = i2;
+                    y = a;
+                    // step 1196
+                    x = b * 48;
+                }
+                step13(a, b);
+                b = 18 * 57;
+            } else {
+                b = 80;
+                if (y < 99) {
+                    // step 1204
+                    y = 94 * 71;
+                }
+                x = y * b;
+            }
+            if (y === 75) {
+                if (i2 > 85) {
+                    x = a - step2(x, i2) - step1(x, i2);
+                    // step 1212
+                    b = 34;
+                    // step 1214
+                    a = y;
+                } else {
+                    // step 1217
+                    y = x - b + x;
+                }
+                if (i2 > 63) {
+                    b = a - b;
+                } else {
+                    y = b * step10(i2, a) + y;
+                }
+                if (i2 > 55) {
+                    // step 1226
+                    a = 22 + 37 + 72;
+                } else {
+                    // step 1229
+                    y = b;
+                    // step 1231
+                    x = y;
+                }
+            }
+        }
+    } else {
+        b = y + y;
+        // step 1238
+        y = a + 86;
+        y = 7 * x;
+    }
+    // step 1242
+    y = step11(y, y) + 55;
+    return 6 - 17;
+}
+
+// step17: generated
+function step17(a, b) {
+    let x = b;
+    let y = 96;
+    for (let i1 = 0; i1 < 66; i1++) {
+        if (i1 === 99) {
+            step3(x);
+            for (let i3 = 0; i3 < 50; i3++) {
+                i3 = step1(y, b);
+            }
+            // step 1257
+            a = 23 - b;
+            i1 = 32 - 50 * 20;
+        }
+        step7(y, y);
+        i1 = 23 - i1;
+        y = 13;
+    }
+    if (b > 27) {
+        if (a < 36) {
+            if (b > 73) {
+                a = x + 42 * y;
+                for (let i4 = 0; i4 < 46; i4++) {
+                    // step 1270
+                    a = y;
+                    a = 56;
+                    b = a + a;
+                }
+                b = y * x;
+            }
+            y = step7(y, a) - 98;
+            step10(b, y);
+            if (y > 26) {
+                step10(y, a);
+                if (b > 32) {
+                    // step 1282
+                    b = step5(x, x) - x - b;
+                } else {
+                    a = 14 * y;
+                }
+                if (y === 59) {
+                    // step 1288
+                    a = step1(x, x) - 25;
+                    // step 1290
+                    b = step8(y, a) * x;
+                }
+            }
+        }
+        b = 28;
+    } else {
+        // step 1297
+        b = step1(b, b) + x * 63;
+        if (y === 22) {
+            // step 1300
+            a = step14(b, x) + x;
+        }
+        x = 93 + 57;
+    }
+    // step 1305
+    y = b;
+    if (b < 28) {
+        if (x > 88) {
+            for (let i3 = 0; i3 < 9; i3++) {
+                y = 95;
+                step16(a, a);
+            }
+            for (let i3 = 0; i3 < 85; i3++) {
+                if (a === 32) {
+                    // step 1315
+                    a = step6(y) * i3 + i3;
+                } else {
+                    // step 1318
+                    i3 = step5(y, i3) - 94 + 64;
+                }
+            }
+            for (let i3 = 0; i3 < 18; i3++) {
+                // step 1323
+                b = 42 + x + a;
+            }
+            y = step2(a, a);
+        }
+        for (let i2 = 0; i2 < 91; i2++) {
+            b = b + step10(x, x);
+            if (b < 30) {
+                if (y > 64) {
+                    // step 1332
+                    b = b * b * step16(a, y);
+                } else {
+                    // step 1335
+                    a = y + a - 57;
+                    // step 1337
+                    a = 34 * x;
+                    // step 1339
+                    i2 = a;
+                }
+            } else {
+                a = x + step0(y) + i2;
+            }
+            if (a < 2) {
+                a = y;
+            } else {
+                if (y === 99) {
+                    // step 1349
+                    a = 34 + a;
+                    step1(i2, y);
+                } else {
+                    // step 1353
+                    x = y + 52 - a;
+                    // step 1355
+                    y = 87 * 92 + 85;
+                }
+            }
+            step10(i2, y);
+        }
+    }
+    b = 10 * 1;
+    if (a === 76) {
+        b = 24 - 19;
+        for (let i2 = 0; i2 < 96; i2++) {
+            x = x - x;
+        }
+        step15(a);
+        // step 1369
+        x = y;
+    } else {
+        for (let i2 = 0; i2 < 79; i2++) {
+            a = y;
+            a = b;
+        }
+        x = y + x * b;
+        for (let i2 = 0; i2 < 23; i2++) {
+            if (x === 81) {
+                step4(i2, i2);
+                b = y * i2 - i2;
+                b = step14(y, i2);
+            }
+            for (let i3 = 0; i3 < 53; i3++) {
+                i2 = a * 74;
+                a = 41;
+                if (i3 < 63) {
+                    // step 1387
+                    b = i2 * x;
+                } else {
+                    // step 1390
+                    y = a;
+                }
+            }
+            x = 65 - a - step6(b);
+            for (let i3 = 0; i3 < 37; i3++) {
+                y = a;
+                if (a > 36) {
+                    y = 71 * 92 + b;
+                    // step 1399
+                    i3 = step7(x, y) * 20 * y;
+                    b = x;
+                } else {
+                    // step 1403
+                    b = i2 + a;
+                    // step 1405
+                    x = step15(x) - 12;
+                }
+            }
+        }
+        if (a > 45) {
+            for (let i3 = 0; i3 < 98; i3++) {
+                // step 1412
+                a = 7 + x;
+                if (y === 44) {
+                    // step 1415
+                    a = 3;
+                } else {
+                    x = 50 * y + step14(b, y);
+                    i3 = 80 + step12(i3) + x;
+                    // step 1420
+                    i3 = b * 75;
+                }
+            }
+            if (a > 23) {
+                step12(b);
+                if (x === 18) {
+                    // step 1427
+                    a = y + step16(y, y) * a;
+                    x = b + 57 - y;
+                }
+            } else {
+                if (a > 24) {
+                    // step 1433
+                    a = x * y;
+                }
+                y = b;
+            }
+            x = a;
+        }
+    }
+    step11(y, a);
+    if (a < 49) {
+        if (b > 48) {
+            if (y > 50) {
+                // step 1445
+                a = 59 * x - 89;
+                step5(x, b);
+                for (let i4 = 0; i4 < 71; i4++) {
+                    // step 1449
+                    a = 42;
+                    x = step1(i4, i4);
+                    y = a;
+                }
+            } else {
+                // step 1455
+                a = b;
+                for (let i4 = 0; i4 < 53; i4++) {
+                    step7(a, i4);
+                }
+            }
+        }
+    } else {
+        x = 90 - x - 7;
+        if (a === 81) {
+            step2(a, y);
+            b = b;
+            for (let i3 = 0; i3 < 49; i3++) {
+                step13(b, i3);
+            }
+            if (a < 29) {
+                x = 83;
+            }
+        } else {
+            step7(x, y);
+            if (a < 61) {
+                if (y > 29) {
+                    // step 1477
+                    b = a * x * a;
+                    x = step4(x, y);
+                }
+            }
+            a = a + 93;
+        }
+        step15(x);
+    }
+    return x * a - step4(a, y);
+}
+
+// step18: generated
+function step18(a) {
+    let x = a - a * 16;
+    let y = 80;
+    step9(y);
+    x = step3(y) * x - 2;
+    for (let i1 = 0; i1 < 75; i1++) {
+        if (x > 45) {
+            step16(a, i1);
+            step0(i1);
+            if (x < 11) {
+                if (a === 65) {
+                    x = y + a + i1;
+                }
+            } else {
+                a = 90 - x;
+            }
+            i1 = a + x;
+        } else {
+            if (i1 < 44) {
+                a = step16(x, y) - x;
+                for (let i4 = 0; i4 < 73; i4++) {
+                    // step 1511
+                    a = i1 - 91 - step13(i4, y);
+                    step4(y, y);
+                }
+            } else {
+                a = 97 - step14(x, y);
+                step8(i1, y);
+            }
+            y = y + 50 * 62;
+            // step 1520
+            y = 28;
+            step1(a, i1);
+        }
+    }
+    if (a === 16) {
+        a = 91 - x;
+    } else {
+        if (a === 68) {
+            step9(x);
+            if (x === 15) {
+                if (y === 92) {
+                    // step 1532
+                    a = x + step11(y, y);
+                }
+            } else {
+                x = 11;
+            }
+            if (a < 91) {
+                for (let i4 = 0; i4 < 24; i4++) {
+                    x = 69 - a * i4;
+                    // step 1541
+                    i4 = 58 + 71;
+                    // step 1543
+                    a = step9(x) * a + step6(i4);
+                }
+                if (y < 18) {
+                    step9(x);
+                    // step 1548
+                    y = y;
+                    step5(x, y);
+                }
+            }
+        }
+        step10(x, a);
+        step9(x);
+        for (let i2 = 0; i2 < 53; i2++) {
+            if (i2 > 1) {
+                // step 1558
+                y = 0;
+                for (let i4 = 0; i4 < 9; i4++) {
+                    // step 1561
+                    y = 26;
+                    y = i2 * a;
+                }
+            } else {
+                a = x * step3(a);
+            }
+            if (i2 === 84) {
+                for (let i4 = 0; i4 < 53; i4++) {
+                    step17(a, y);
+                }
+                if (a < 55) {
+                    y = x;
+                }
+                x = x - y - 26;
+            }
+        }
+    }
+    if (x > 74) {
+        for (let i2 = 0; i2 < 0; i2++) {
+            if (y === 88) {
+                for (let i4 = 0; i4 < 24; i4++) {
+                    a = 87;
+                }
+                x = y - x * x;
+            } else {
+                for (let i4 = 0; i4 < 76; i4++) {
+                    step0(x);
+                }
+            }
+            if (i2 === 94) {
+                step11(y, a);
+            } else {
+                x = y + a - x;
+                if (i2 > 5) {
+                    y = a;
+                    step13(x, y);
+                    // step 1598
+                    a = step8(i2, x) - a;
+                }
+            }
+            a = x;
+            for (let i3 = 0; i3 < 74; i3++) {
+                if (i2 < 18) {
+                    y = 98 + 16;
+                    // step 1606
+                    y = a * 3 + y;
+                    y = i2 * x;
+                }
+            }
+        }
+        y = 78 * y - y;
+        if (y === 57) {
+            x = x * a - y;
+            if (y > 92) {
+                if (a === 34) {
+                    // step 1617
+                    a = 54;
+                    // step 1619
+                    a = step11(y, x) + 68 + x;
+                } else {
+                    // step 1622
+                    a = step6(a) * 38 * y;
+                    x = x;
+                    step13(x, a);
+                }
+                if (x === 69) {
+                    // step 1628
+                    x = y;
+                    // step 1630
+                    y = 45 * 95;
+                    a = y * 5;
+                } else {
+                    a = x;
+                    step1(y, x);
+                    // step 1636
+                    a = x;
+                }
+                // step 1639
+                a = x - 46;
+            } else {
+                for (let i4 = 0; i4 < 72; i4++) {
+                    // step 1643
+                    a = x - 45 - i4;
+                    // step 1645
+                    i4 = y + 56 + 47;
+                }
+            }
+            // step 1649
+            x = a + 35;
+            x = a * 50 * y;
+        }
+    }
+    x = 72 + x - step17(a, x);
+    for (let i1 = 0; i1 < 61; i1++) {
+        y = 93 - y;
+        if (a < 76) {
+            step16(y, x);
+            i1 = i1;
+        }
+    }
+    return 82;
+}
+
+// step19: generated
+function step19(a, b) {
+    let x = a - 11 - a;
+    let y = 86;
+    // step 1669
+    a = y - 71;
+    x = step15(x);
+    // step 1672
+    b = 91;
+    if (b === 96) {
+        if (y > 33) {
+            // step 1676
+            x = b * 37;
+            step17(b, b);
+        } else {
+            if (a > 73) {
+                b = step7(a, y) * y;
+            } else {
+                for (let i4 = 0; i4 < 4; i4++) {
+                    // step 1684
+                    y = a + i4;
+                }
+            }
+            b = b * x;
+            if (x > 46) {
+                x = 14;
+            } else {
+                x = 63 + y;
+                if (b === 85) {
+                    // step 1694
+                    x = b - step8(x, x) * 57;
+                    b = x;
+                    a = step18(a) + 95 + y;
+                } else {
+                    step16(x, a);
+                }
+                for (let i4 = 0; i4 < 61; i4++) {
+                    // step 1702
+                    i4 = 19 * step1(x, a);
+                }
+            }
+            for (let i3 = 0; i3 < 83; i3++) {
+                step2(a, b);
+                i3 = 18 + a + b;
+                if (b === 84) {
+                    // step 1710
+                    i3 = 78 - 3 * a;
+                    // step 1712
+                    a = 56 * i3 - step8(x, x);
+                }
+            }
+        }
+        // step 1717
+        b = 87;
+        step11(y, b);
+    }
+    return 62;
+}
+
+// step20: generated
+function step20(a, b) {
+    let x = 27 * b;
+    let y = 51;
+    // step 1728
+    y = y * 61 + 70;
+    x = b - step0(x);
+    if (b > 10) {
+        step6(a);
+        step9(a);
+    } else {
+        for (let i2 = 0; i2 < 91; i2++) {
+            y = 39 + 79;
+        }
+        // step 1738
+        x = y;
+    }
+    step0(a);
+    for (let i1 = 0; i1 < 55; i1++) {
+        if (b > 28) {
+            step14(x, i1);
+            step4(x, y);
+            if (x === 51) {
+                b = b;
+            }
+            step16(i1, x);
+        }
+    }
+    return x * b;
+}
+
+// step21: generated
+function step21(a) {
+    let x = 62;
+    let y = 17;
+    x = x * y;
+    for (let i1 = 0; i1 < 58; i1++) {
+        x = y - a * 88;
+        x = step4(x, x) * x;
+        if (y < 24) {
+            i1 = 67;
+            if (i1 > 11) {
+                step5(x, x);
+            } else {
+                x = 96 * y;
+            }
+            x = 8 + step1(a, i1);
+        }
+    }
+    y = 36 + step1(y, x);
+    if (x === 8) {
+        step12(a);
+    }
+    if (a < 5) {
+        for (let i2 = 0; i2 < 47; i2++) {
+            if (x < 69) {
+                if (i2 < 65) {
+                    // step 1781
+                    x = step10(i2, i2) + 42;
+                    i2 = 65;
+                    // step 1784
+                    y = y + a + y;
+                } else {
+                    // step 1787
+                    i2 = 45 + 35;
+                    a = step15(y);
+                    step18(x);
+                }
+            } else {
+                if (x < 26) {
+                    // step 1794
+                    a = 95 + y;
+                    step8(a, y);
+                } else {
+                    a = 82 * y;
+                    step3(i2);
+                    // step 1800
+                    i2 = i2 + a * a;
+                }
+            }
+        }
+    }
+    for (let i1 = 0; i1 < 68; i1++) {
+        a = 85 - x * step8(i1, i1);
+        a = 69;
+        a = 54;
+        if (x === 87) {
+            if (i1 < 23) {
+                step11(i1, y);
+            } else {
+                if (x < 61) {
+                    step11(a, a);
+                    // step 1816
+                    y = 35 - 45 * step1(i1, a);
+                }
+            }
+            a = x - 79;
+            a = step15(a);
+            step18(y);
+        } else {
+            if (x > 87) {
+                y = 99;
+            }
+            a = x * 42;
+            step6(y);
+            if (x === 69) {
+                // step 1830
+                a = step10(a, y);
+            } else {
+                x = step6(x) + 72;
+                for (let i4 = 0; i4 < 8; i4++) {
+                    // step 1835
+                    y = step5(i4, i4) * x;
+                    y = step14(x, i4) * 54;
+                    x = x * i1 * 90;
+                }
+                if (a === 61) {
+                    step0(i1);
+                } else {
+                    // step 1843
+                    y = step15(x) * i1;
+                    step5(a, i1);
+                }
+            }
+        }
+    }
+    a = 30 + a;
+    step5(y, a);
+    return 10 + 13;
+}
+
+// step22: generated
+function step22(a, b) {
+    let x = 53;
+    let y = 77;
+    for (let i1 = 0; i1 < 23; i1++) {
+        if (i1 === 46) {
+            step16(x, i1);
+        } else {
+            for (let i3 = 0; i3 < 16; i3++) {
+                i1 = x;
+            }
+            for (let i3 = 0; i3 < 9; i3++) {
+                step2(b, i3);
+                i3 = 73;
+                step19(y, i3);
+            }
+        }
+    }
+    if (y === 78) {
+        if (x === 91) {
+            b = a;
+        }
+    } else {
+        step7(x, y);
+        x = 65 - 22 - 32;
+        if (a === 52) {
+            if (x < 67) {
+                if (b > 18) {
+                    x = a;
+                    // step 1884
+                    x = 96;
+                    // step 1886
+                    a = 46;
+                } else {
+                    a = 0;
+                    step1(y, x);
+                }
+                for (let i4 = 0; i4 < 98; i4++) {
+                    // step 1893
+                    a = i4;
+                }
+            }
+        }
+    }
+    if (a === 91) {
+        if (a > 34) {
+            if (x === 8) {
+                step10(a, x);
+            } else {
+                y = y;
+            }
+            step16(b, x);
+            step3(b);
+            for (let i3 = 0; i3 < 4; i3++) {
+                if (b < 51) {
+                    x = step3(y);
+                    // step 1911
+                    i3 = 57 * step13(a, a) * a;
+                    i3 = 94;
+                }
+            }
+        } else {
+            step8(y, x);
+            if (y < 1) {
+                a = step20(x, a) - x;
+            } else {
+                y = step1(a, b) - 98;
+                step6(a);
+            }
+            for (let i3 = 0; i3 < 51; i3++) {
+                if (a < 48) {
+                    x = y;
+                }
+            }
+            // step 1929
+            b = x;
+        }
+        x = 51 + step3(y);
+        // step 1933
+        b = step6(b);
+        step13(x, a);
+    } else {
+        step0(x);
+        for (let i2 = 0; i2 < 72; i2++) {
+            x = 24;
+            // step 1940
+            x = b;
+            step9(a);
+            if (a === 50) {
+                step5(a, y);
+            } else {
+                if (b > 89) {
+                    step5(x, b);
+                }
+            }
+        }
+        b = x + x + b;
+    }
+    if (y > 15) {
+        if (x > 25) {
+            if (x > 15) {
+                step18(b);
+                if (y === 31) {
+                    step0(b);
+                }
+                for (let i4 = 0; i4 < 92; i4++) {
+                    a = b - 48;
+                }
+            }
+            x = step6(x) - step14(x, b) * b;
+            a = x;
+        } else {
+            step3(b);
+            step21(y);
+        }
+        if (b < 86) {
+            if (b < 99) {
+                step19(x, b);
+            }
+            // step 1974
+            a = 27 - y;
+            b = y + b * y;
+            if (y > 66) {
+                // step 1978
+                x = step15(y) * x;
+                a = x - 44 - 42;
+            }
+        } else {
+            x = b + x * 21;
+        }
+        y = b + step14(x, x);
+        if (y < 51) {
+            // step 1987
+            b = y - x;
+            y = 59 + b;
+            if (a === 85) {
+                b = b + a - b;
+                // step 1992
+                b = 91;
+            } else {
+                step20(y, y);
+            }
+            // step 1997
+            x = y;
+        } else {
+            y = 43;
+            if (b > 0) {
+                step0(b);
+            }
+            if (x === 65) {
+                if (x < 41) {
+                    // step 2006
+                    a = x - b - y;
+                    // step 2008
+                    y = step20(b, b) - step8(y, a) + 41;
+                } else {
+                    step18(a);
+                }
+                if (a === 2) {
+                    // step 2014
+                    a = b - 0 - a;
+                }
+                if (y === 76) {
+                    step9(x);
+                    a = 65;
+                    a = a * step5(a, x);
+                }
+            } else {
+                // step 2023
+                a = b;
+            }
+            b = 35 - x;
+        }
+    } else {
+        y = x + 51 + y;
+    }
+    if (a < 9) {
+        step10(b, x);
+        y = b + y;
+    } else {
+        step8(y, b);
+        if (b > 15) {
+            y = y - a;
+            if (x < 33) {
+                y = 45 - 28 * y;
+            } else {
+                for (let i4 = 0; i4 < 7; i4++) {
+                    // step 2042
+                    b = i4 - step6(y);
+                    // step 2044
+                    i4 = x * i4 - 46;
+                }
+                step15(b);
+                for (let i4 = 0; i4 < 94; i4++) {
+                    step18(b);
+                }
+            }
+        } else {
+            step13(a, y);
+        }
+    }
+    b = 43 * 97;
+    return 32;
+}
+
+// step23: generated
+function step23(a, b) {
+    let x = 90 + a + a;
+    let y = 55;
+    if (x === 95) {
+        for (let i2 = 0; i2 < 93; i2++) {
+            if (i2 < 55) {
+                i2 = step13(b, b) + 4;
+            } else {
+                x = step15(y) * step22(b, y) + y;
+                step14(y, i2);
+            }
+            for (let i3 = 0; i3 < 59; i3++) {
+                if (i2 > 19) {
+                    step11(x, i3);
+                }
+            }
+            a = b;
+            if (b < 89) {
+                for (let i4 = 0; i4 < 87; i4++) {
+                    // step 2080
+                    i4 = step5(a, a) - 66;
+                    // step 2082
+                    i2 = i4 + x;
+                }
+                if (x < 67) {
+                    // step 2086
+                    b = step12(b) + 73 - 19;
+                } else {
+                    // step 2089
+                    x = 41 + 90 - i2;
+                    // step 2091
+                    x = y * 87;
+                    // step 2093
+                    x = b - step6(i2);
+                }
+            }
+        }
+        for (let i2 = 0; i2 < 27; i2++) {
+            for (let i3 = 0; i3 < 34; i3++) {
+                if (i3 < 10) {
+                    step13(x, i2);
+                    step5(x, y);
+                } else {
+                    // step 2104
+                    b = i2 + 50 * 6;
+                    // step 2106
+                    y = b;
+                }
+            }
+        }
+        if (b === 65) {
+            x = y + step6(b);
+            if (b === 45) {
+                if (y > 6) {
+                    step2(y, b);
+                    // step 2116
+                    b = 32 * x + a;
+                } else {
+                    y = y - y * x;
+                    // step 2120
+                    a = step12(x);
+                    // step 2122
+                    y = a;
+                }
+            }
+        }
+    }
+    if (a < 74) {
+        if (x > 44) {
+            // step 2130
+            b = 37 - b * 23;
+            step7(a, a);
+            if (y > 45) {
+                if (x === 52) {
+                    // step 2135
+                    x = step9(y);
+                }
+            }
+        } else {
+            if (y > 82) {
+                a = step21(x) + b;
+            } else {
+                if (a < 33) {
+                    // step 2144
+                    a = step6(x);
+                    b = b - b;
+                } else {
+                    a = a;
+                    // step 2149
+                    y = b - step16(b, b) - b;
+                }
+                step20(a, a);
+            }
+            b = b - step2(a, y);
+            for (let i3 = 0; i3 < 21; i3++) {
+                for (let i4 = 0; i4 < 78; i4++) {
+                    // step 2157
+                    y = a * y + step18(x);
+                }
+            }
+        }
+        step13(y, a);
+        step7(y, b);
+    } else {
+        for (let i2 = 0; i2 < 25; i2++) {
+            if (a === 82) {
+                if (a < 95) {
+                    step4(a, x);
+                    // step 2169
+                    x = 3 * 33;
+                }
+            } else {
+                step2(a, x);
+                step21(b);
+                y = step21(i2) + y;
+            }
+            if (a > 75) {
+                if (b > 0) {
+                    b = y * i2 + b;
+                }
+            }
+            if (i2 < 36) {
+                x = 19 * 94 + 2;
+                if (x > 88) {
+                    // step 2185
+                    b = 73 - 5;
+                } else {
+                    x = y;
+                    i2 = step18(a) + x;
+                    step1(i2, y);
+                }
+                i2 = 47 - 59 - x;
+            } else {
+                x = 5;
+                y = step9(b) * y + a;
+                y = b;
+            }
+            if (a > 60) {
+                if (b < 49) {
+                    // step 2200
+                    a = i2 * step6(b) * step2(x, b);
+                    // step 2202
+                    b = b * 20;
+                    step18(i2);
+                }
+            }
+        }
+        step17(b, y);
+    }
+    if (y < 61) {
+        if (a < 29) {
+            y = b - 49 * 71;
+            a = y * x;
+            step14(x, b);
+            x = 18 + step21(a) + b;
+        } else {
+            for (let i3 = 0; i3 < 16; i3++) {
+                step12(a);
+                for (let i4 = 0; i4 < 40; i4++) {
+                    // step 2220
+                    x = step1(i4, x) - x;
+                }
+            }
+            // step 2224
+            a = y;
+        }
+        if (b === 54) {
+            for (let i3 = 0; i3 < 62; i3++) {
+                step8(y, x);
+                for (let i4 = 0; i4 < 41; i4++) {
+                    x = 53 * b;
+                    i4 = step7(x, y) + 8;
+                }
+            }
+            if (b === 60) {
+                for (let i4 = 0; i4 < 52; i4++) {
+                    step12(x);
+                    y = 68 * 13 * step4(i4, x);
+                    step17(i4, i4);
+                }
+                step17(a, a);
+            }
+        }
+        if (b > 97) {
+            for (let i3 = 0; i3 < 28; i3++) {
+                for (let i4 = 0; i4 < 69; i4++) {
+                    // step 2247
+                    a = i4 - 32;
+                }
+                x = i3 * i3;
+            }
+            if (y > 20) {
+                // step 2253
+                b = 46 * step19(b, y) + 65;
+            } else {
+                // step 2256
+                y = x + 12 + a;
+                x = a;
+            }
+        }
+        if (y > 43) {
+            for (let i3 = 0; i3 < 56; i3++) {
+                for (let i4 = 0; i4 < 98; i4++) {
+                    // step 2264
+                    i4 = step6(b);
+                    step8(x, y);
+                }
+            }
+            b = b;
+        } else {
+            if (a > 63) {
+                a = a;
+                step17(x, y);
+            } else {
+                a = b;
+            }
+            a = b;
+            b = a + step22(y, y) * b;
+            a = step4(a, x) - a;
+        }
+    } else {
+        a = b;
+        if (a === 90) {
+            step20(y, b);
+            for (let i3 = 0; i3 < 46; i3++) {
+                if (x === 66) {
+                    // step 2287
+                    a = 61;
+                    // step 2289
+                    a = 5 - 63;
+                } else {
+                    // step 2292
+                    b = y + b + i3;
+                }
+                if (i3 === 9) {
+                    // step 2296
+                    i3 = 34;
+                }
+                y = b;
+            }
+            if (y === 97) {
+                b = step20(b, a);
+                a = b - x;
+                // step 2304
+                a = x;
+            } else {
+                for (let i4 = 0; i4 < 68; i4++) {
+                    // step 2308
+                    b = step0(i4) + step5(a, x) - y;
+                }
+                for (let i4 = 0; i4 < 67; i4++) {
+                    a = step14(x, x);
+                    b = 81 + 39;
+                    // step 2314
+                    b = a;
+                }
+            }
+        } else {
+            for (let i3 = 0; i3 < 76; i3++) {
+                // step 2320
+                x = 91;
+            }
+            step14(x, a);
+            for (let i3 = 0; i3 < 57; i3++) {
+                if (a < 24) {
+                    // step 2326
+                    a = 57 + b;
+                } else {
+                    step22(x, b);
+                    // step 2330
+                    a = 33 + step1(a, a);
+                    // step 2332
+                    b = step8(b, i3) - 1 - 6;
+                }
+                y = step22(i3, a) * step21(a);
+            }
+            b = x + x;
+        }
+        step4(a, y);
+    }
+    if (y < 54) {
+        for (let i2 = 0; i2 < 2; i2++) {
+            a = 19;
+            step19(b, y);
+            if (a < 61) {
+                for (let i4 = 0; i4 < 1; i4++) {
+                    // step 2347
+                    i4 = i4 * b;
+                    // step 2349
+                    i2 = b * x;
+                }
+            } else {
+                x = i2 + y * 54;
+            }
+            i2 = x - step21(a) - y;
+        }
+        a = 71 * y * x;
+        y = 85;
+        x = 92;
+    }
+    for (let i1 = 0; i1 < 68; i1++) {
+        if (i1 < 56) {
+            if (x > 72) {
+                if (b < 88) {
+                    // step 2365
+                    a = i1 + i1;
+                    step13(x, y);
+                } else {
+                    // step 2369
+                    y = step9(b);
+                }
+                if (y > 37) {
+                    i1 = 68 * a;
+                }
+                if (x === 10) {
+                    y = i1 - i1 * 2;
+                }
+            } else {
+                step1(x, x);
+                if (i1 < 75) {
+                    a = y - a + 37;
+                    // step 2382
+                    y = i1 + x;
+                }
+                step11(i1, y);
+            }
+            step0(a);
+        } else {
+            y = b;
+            // step 2390
+            y = step14(b, i1) + 17;
+            step5(y, i1);
+            if (y > 7) {
+                for (let i4 = 0; i4 < 69; i4++) {
+                    b = x - y;
+                    // step 2396
+                    x = step5(b, b);
+                }
+            } else {
+                step10(y, b);
+            }
+        }
+        if (i1 > 20) {
+            for (let i3 = 0; i3 < 1; i3++) {
+                if (x < 11) {
+                    i1 = step10(i3, x) * i1;
+                } else {
+                    a = i3;
+                    // step 2409
+                    b = 23;
+                    step0(y);
+                }
+            }
+            step20(x, i1);
+        } else {
+            if (i1 > 17) {
+                for (let i4 = 0; i4 < 40; i4++) {
+                    x = 26 - i1 - 95;
+                }
+            }
+        }
+    }
+    b = b * y;
+    if (b < 17) {
+        b = 68 + y;
+        step7(x, y);
+        step4(x, y);
+    }
+    if (b > 85) {
+        y = 6 * step1(y, x);
+    } else {
+        if (x < 23) {
+            if (x < 62) {
+                if (y === 79) {
+                    // step 2435
+                    y = step9(y) - 28;
+                    // step 2437
+                    a = step18(y) - x;
+                    // step 2439
+                    y = step13(b, b) - 32;
+                } else {
+                    // step 2442
+                    b = x - 88;
+                    step5(a, b);
+                }
+                if (y < 25) {
+                    // step 2447
+                    b = step1(b, y) - a;
+                } else {
+                    x = 60 - x - 87;
+                    // step 2451
+                    a = b;
+                }
+                a = x + b * x;
+            }
+        } else {
+            step2(a, a);
+        }
+        x = 31 * 28;
+        b = 61 + 12 - step2(y, y);
+    }
+    return 71 * 25;
+}
+
+// step24: generated
+function step24(a) {
+    let x = a * a + a;
+    let y = 51;
+    step17(a, y);
+    for (let i1 = 0; i1 < 8; i1++) {
+        step7(x, x);
+        step11(x, y);
+    }
+    step4(y, x);
+    y = a - 54 - a;
+    if (x > 83) {
+        step18(x);
+    }
+    for (let i1 = 0; i1 < 85; i1++) {
+        for (let i2 = 0; i2 < 85; i2++) {
+            // step 2481
+            y = i1 * 75;
+            if (i2 < 79) {
+                a = a;
+            }
+            step4(a, x);
+            i2 = 67 - i2;
+        }
+        i1 = step7(x, a);
+        for (let i2 = 0; i2 < 52; i2++) {
+            i2 = i1 - 55;
+            if (a < 31) {
+                if (i2 < 46) {
+                    x = x * step14(i1, i2);
+                    // step 2495
+                    x = i1 - i2 + x;
+                    // step 2497
+                    i2 = 79 * x;
+                }
+                if (x < 2) {
+                    step6(y);
+                    i2 = i1;
+                } else {
+                    // step 2504
+                    i1 = i1;
+                }
+                // step 2507
+                x = step7(x, a) - y * 0;
+            }
+        }
+    }
+    if (a < 52) {
+        // step 2513
+        a = 38 - 60 - 92;
+    } else {
+        if (x > 88) {
+            for (let i3 = 0; i3 < 0; i3++) {
+                for (let i4 = 0; i4 < 4; i4++) {
+                    y = a - x - y;
+                    // step 2520
+                    x = step2(y, x) * a;
+                    // step 2522
+                    a = i3 - x + step4(x, i3);
+                }
+                if (y < 65) {
+                    // step 2526
+                    y = x + 58 * x;
+                }
+            }
+            x = x;
+            if (x > 61) {
+                x = x * step17(a, y) + x;
+            }
+            x = a - 57;
+        } else {
+            for (let i3 = 0; i3 < 59; i3++) {
+                // step 2537
+                i3 = a - x;
+                y = y;
+            }
+            if (y === 0) {
+                for (let i4 = 0; i4 < 16; i4++) {
+                    x = i4;
+                    // step 2544
+                    a = x - i4;
+                    // step 2546
+                    a = 75;
+                }
+            }
+        }
+        step0(y);
+        y = y * y * step6(x);
+        for (let i2 = 0; i2 < 59; i2++) {
+            for (let i3 = 0; i3 < 69; i3++) {
+                if (x < 1) {
+                    // step 2556
+                    x = i2;
+                    // step 2558
+                    i2 = 91 - i3 * i2;
+                }
+            }
+        }
+    }
+    x = x - step11(a, a);
+    return a * 39;
+}
+
+// step25: generated
+function step25(a, b) {
+    let x = 34 * a;
+    let y = 70;
+    if (a > 32) {
+        step7(b, y);
+        for (let i2 = 0; i2 < 15; i2++) {
+            // step 2575
+            a = 29;
+        }
+        if (x === 42) {
+            y = b + x - 63;
+            if (x > 16) {
+                if (a > 91) {
+                    // step 2582
+                    a = step12(y) + 98 - b;
+                    step4(a, x);
+                }
+            } else {
+                if (y === 36) {
+                    step20(b, x);
+                }
+                y = y + y;
+            }
+            for (let i3 = 0; i3 < 96; i3++) {
+                x = 60 * a;
+                for (let i4 = 0; i4 < 70; i4++) {
+                    // step 2595
+                    i3 = 48;
+                    y = i3 * 75;
+                }
+                for (let i4 = 0; i4 < 54; i4++) {
+                    // step 2600
+                    a = 43 * y + step11(i4, i4);
+                }
+            }
+            if (b > 99) {
+                if (b > 94) {
+                    x = y - step20(a, x);
+                } else {
+                    // step 2608
+                    a = a * x;
+                }
+            } else {
+                if (y === 33) {
+                    a = b + y * 41;
+                    // step 2614
+                    a = y + y + x;
+                } else {
+                    x = x + a - y;
+                }
+            }
+        } else {
+            y = y + 16 - y;
+        }
+        for (let i2 = 0; i2 < 37; i2++) {
+            if (x < 13) {
+                y = i2;
+                for (let i4 = 0; i4 < 9; i4++) {
+                    // step 2627
+                    b = b * a;
+                    b = step18(i4) * a + y;
+                }
+                y = 77;
+            }
+            if (x === 75) {
+                // step 2634
+                y = 8 * step10(y, b);
+            } else {
+                if (b < 79) {
+                    // step 2638
+                    x = a - step3(b) * 68;
+                    // step 2640
+                    y = 53;
+                    a = step5(i2, i2) - 76 * 20;
+                }
+                // step 2644
+                b = i2 * y - b;
+            }
+            step19(a, y);
+            for (let i3 = 0; i3 < 89; i3++) {
+                // step 2649
+                b = x + i3;
+                for (let i4 = 0; i4 < 89; i4++) {
+                    step18(y);
+                }
+            }
+        }
+    }
+    if (y > 91) {
+        // step 2658
+        a = y * step13(b, y);
+        if (b < 38) {
+            step10(a, a);
+            a = y * step17(a, a);
+            // step 2663
+            x = step24(y) - step22(a, y) - 79;
+            step19(y, x);
+        }
+    } else {
+        if (x > 50) {
+            y = 8 * a;
+        } else {
+            if (a < 87) {
+                if (a === 67) {
+                    // step 2673
+                    y = b * y;
+                    y = 2 - 6 + 27;
+                    b = y;
+                }
+            } else {
+                a = 30 + a + step0(a);
+                if (a === 45) {
+                    y = 30 * b - step8(a, x);
+                } else {
+                    // step 2683
+                    a = step14(x, y) - 36 * a;
+                    x = 81;
+                }
+                y = y + x;
+            }
+            step24(y);
+        }
+        b = a - 38 - a;
+    }
+    for (let i1 = 0; i1 < 81; i1++) {
+        for (let i2 = 0; i2 < 84; i2++) {
+            b = x - y - 62;
+            x = b + b;
+        }
+        for (let i2 = 0; i2 < 5; i2++) {
+            if (i2 < 16) {
+                if (x === 98) {
+                    step2(i2, x);
+                    // step 2702
+                    y = step3(i1);
+                }
+            } else {
+                b = i1;
+            }
+            if (a < 3) {
+                if (i2 === 72) {
+                    y = i2;
+                    // step 2711
+                    x = step10(b, x) - step11(a, i1) * i1;
+                } else {
+                    step2(b, b);
+                }
+            } else {
+                i2 = b + 79 + y;
+                // step 2718
+                x = b * 76 * b;
+                i2 = 1;
+            }
+            y = i1 - y;
+        }
+    }
+    step23(x, x);
+    for (let i1 = 0; i1 < 3; i1++) {
+        // step 2727
+        i1 = y;
+        b = step15(y) * y;
+    }
+    b = 0 - 42;
+    a = 30 * 63 - 81;
+    for (let i1 = 0; i1 < 74; i1++) {
+        if (x < 39) {
+            b = 64 * x;
+        }
+    }
+    return 13 - 21;
+}
+
+// step26: generated
+function step26(a, b) {
+    let x = 71 + b;
+    let y = 64;
+    a = b - b;
+    for (let i1 = 0; i1 < 4; i1++) {
+        // step 2747
+        x = x;
+        y = i1 - step14(x, a) * x;
+        for (let i2 = 0; i2 < 20; i2++) {
+            i1 = i1 - 14;
+            b = i2;
+            step24(b);
+            // step 2754
+            i2 = 78 - 33 + i1;
+        }
+        a = b - i1 * 72;
+    }
+    if (a === 36) {
+        if (y === 62) {
+            y = x;
+            x = step16(x, a);
+        } else {
+            if (b === 41) {
+                if (y < 62) {
+                    // step 2766
+                    y = x;
+                    // step 2768
+                    b = x;
+                    // step 2770
+                    y = x * 29 - b;
+                } else {
+                    b = a;
+                }
+            } else {
+                step20(y, y);
+                for (let i4 = 0; i4 < 42; i4++) {
+                    a = step20(y, a);
+                    // step 2779
+                    y = step5(x, i4);
+                    // step 2781
+                    b = b * x + 88;
+                }
+                if (y === 73) {
+                    b = 49 - x + 1;
+                    // step 2786
+                    x = step2(b, b) * y;
+                    // step 2788
+                    x = step9(a) + a;
+                } else {
+                    // step 2791
+                    b = 41 - a - x;
+                    x = 5 + x;
+                }
+            }
+            step3(y);
+            if (y > 75) {
+                for (let i4 = 0; i4 < 79; i4++) {
+                    step3(i4);
+                    // step 2800
+                    a = x + 3;
+                    // step 2802
+                    y = i4;
+                }
+                b = 67;
+                b = b + x;
+            }
+        }
+        y = 67 + 35;
+        b = 61 + step9(a) - 67;
+    } else {
+        y = x;
+        if (b < 36) {
+            if (b < 7) {
+                step14(b, b);
+            }
+        }
+    }
+    if (b === 34) {
+        b = b;
+        x = step3(b) - 61;
+    } else {
+        // step 2823
+        a = 91;
+        for (let i2 = 0; i2 < 76; i2++) {
+            for (let i3 = 0; i3 < 83; i3++) {
+                step18(y);
+            }
+        }
+        step13(a, b);
+        if (x > 52) {
+            step0(x);
+        } else {
+            a = x - 23;
+        }
+    }
+    for (let i1 = 0; i1 < 30; i1++) {
+        x = step7(b, i1) + 69;
+    }
+    y = 42 - x - 85;
+    return b + 22 * y;
+}
+
+// step27: generated
+function step27(a) {
+    let x = a - a - a;
+    let y = 67;
+    if (y < 18) {
+        for (let i2 = 0; i2 < 45; i2++) {
+            x = y;
+        }
+        // step 2852
+        x = 94 - y;
+    }
+    step21(x);
+    x = x * 87 + x;
+    if (a > 68) {
+        x = 73;
+        for (let i2 = 0; i2 < 17; i2++) {
+            if (y === 55) {
+                for (let i4 = 0; i4 < 62; i4++) {
+                    // step 2862
+                    y = i2 + y;
+                }
+                if (x < 48) {
+                    // step 2866
+                    y = 17;
+                    // step 2868
+                    i2 = y + 73;
+                }
+            } else {
+                i2 = 0 - 40 * 90;
+            }
+            step2(i2, i2);
+            a = step4(x, i2);
+        }
+        a = a + 43 * 60;
+        // step 2878
+        a = step2(a, y);
+    } else {
+        step11(y, y);
+    }
+    // step 2883
+    a = x - step4(a, y);
+    y = 43 - a - a;
+    return y - 36;
+}
+
+// step28: generated
+function step28(a, b) {
+    let x = b - 93 + 29;
+    let y = 75;
+    a = y;
+    step24(b);
+    x = 89 - x;
+    if (b > 4) {
+        step27(y);
+        if (b < 9) {
+            b = step22(y, b) - 81 + step10(b, b);
+            if (x > 35) {
+                // step 2901
+                x = b;
+                y = x - a * x;
+            } else {
+                for (let i4 = 0; i4 < 20; i4++) {
+                    // step 2906
+                    y = 67 - b * b;
+                }
+            }
+        } else {
+            if (b < 66) {
+                b = step18(y);
+            } else {
+                a = step10(y, y) + a;
+                if (a < 10) {
+                    a = b + 1;
+                }
+            }
+        }
+    } else {
+        if (a < 30) {
+            step18(x);
+            x = a;
+        } else {
+            for (let i3 = 0; i3 < 89; i3++) {
+                // step 2926
+                i3 = a;
+                if (y === 39) {
+                    // step 2929
+                    i3 = 9;
+                } else {
+                    a = a + a;
+                    i3 = 13;
+                    step19(x, y);
+                }
+            }
+        }
+    }
+    for (let i1 = 0; i1 < 89; i1++) {
+        y = x - b + y;
+    }
+    if (a === 49) {
+        y = step12(a);
+        if (y < 15) {
+            for (let i3 = 0; i3 < 66; i3++) {
+                for (let i4 = 0; i4 < 9; i4++) {
+                    // step 2947
+                    i3 = 73 * y;
+                    y = 26 + a;
+                }
+            }
+            // step 2952
+            b = 54 + step19(y, b) + step4(b, x);
+        }
+        for (let i2 = 0; i2 < 55; i2++) {
+            for (let i3 = 0; i3 < 43; i3++) {
+                for (let i4 = 0; i4 < 41; i4++) {
+                    i3 = 40 + 41 + x;
+                    // step 2959
+                    x = i3;
+                }
+                // step 2962
+                y = x + step5(a, i3) * x;
+                y = 82 - 80 + 24;
+            }
+            for (let i3 = 0; i3 < 45; i3++) {
+                y = i3 + x;
+                for (let i4 = 0; i4 < 6; i4++) {
+                    step4(i3, i2);
+                }
+                y = y * step24(a) - step3(x);
+            }
+            if (a > 24) {
+                step27(y);
+            }
+            y = b - x;
+        }
+    }
+    return 7;
+}
+
+// step29: generated
+function step29(a, b) {
+    let x = a * b * b;
+    let y = 70;
+    if (x < 23) {
+        if (b > 6) {
+            // step 2988
+            a = 58 + step26(a, a);
+            for (let i3 = 0; i3 < 65; i3++) {
+                for (let i4 = 0; i4 < 18; i4++) {
+                    step21(i3);
+                }
+            }
+        }
+    }
+    y = 85 - step20(x, x) - 22;
+    a = step1(x, b);
+    a = b;
+    if (y === 76) {
+        if (y < 12) {
+            step18(x);
+            step22(a, y);
+            if (a < 46) {
+                for (let i4 = 0; i4 < 60; i4++) {
+                    y = 68;
+                }
+                step26(x, b);
+                y = step20(x, y);
+            }
+        } else {
+            for (let i3 = 0; i3 < 61; i3++) {
+                // step 3013
+                i3 = y;
+                step24(x);
+                if (y < 9) {
+                    b = step2(b, a);
+                }
+            }
+        }
+        for (let i2 = 0; i2 < 35; i2++) {
+            x = x;
+        }
+    } else {
+        if (y > 11) {
+            if (b > 76) {
+                if (a < 94) {
+                    a = x - 22 * 60;
+                    // step 3029
+                    b = 9 + step9(y) - step2(y, a);
+                } else {
+                    // step 3032
+                    a = a;
+                }
+                step7(y, b);
+                if (x === 94) {
+                    // step 3037
+                    y = a + y;
+                    // step 3039
+                    a = y - y;
+                }
+            } else {
+                a = y + 8 * x;
+                if (y === 42) {
+                    a = 99 * step24(x);
+                }
+                if (y > 72) {
+                    // step 3048
+                    a = 58 * 59 + 67;
+                }
+            }
+        } else {
+            b = step22(x, x) - 87;
+            for (let i3 = 0; i3 < 63; i3++) {
+                step8(b, b);
+                for (let i4 = 0; i4 < 90; i4++) {
+                    a = i3 * step22(x, b) + step27(i3);
+                    i4 = y;
+                }
+            }
+        }
+        if (a < 61) {
+            step17(a, b);
+            x = step27(y) + y * step19(y, a);
+            for (let i3 = 0; i3 < 59; i3++) {
+                for (let i4 = 0; i4 < 46; i4++) {
+                    // step 3067
+                    b = step12(i4);
+                }
+            }
+            step7(x, x);
+        } else {
+            if (y < 42) {
+                y = step5(a, a) * 29;
+            } else {
+                if (y < 20) {
+                    step16(a, y);
+                    x = y * 3;
+                    // step 3079
+                    y = 13 + step27(b);
+                } else {
+                    y = 86 - step6(y) * b;
+                }
+                if (b < 66) {
+                    // step 3085
+                    a = a + step19(x, b);
+                }
+            }
+            step5(b, a);
+            for (let i3 = 0; i3 < 68; i3++) {
+                if (i3 === 48) {
+                    step24(a);
+                }
+                // step 3094
+                x = a + 47;
+            }
+            b = x - 36 * a;
+        }
+    }
+    if (x > 75) {
+        // step 3101
+        b = step25(b, a) + step25(x, b);
+    }
+    y = x + b;
+    if (a > 5) {
+        if (x > 31) {
+            for (let i3 = 0; i3 < 73; i3++) {
+                // step 3108
+                x = step13(b, y);
+            }
+            if (y > 99) {
+                if (y < 65) {
+                    a = y - x - step16(y, a);
+                } else {
+                    x = step5(y, x);
+                    // step 3116
+                    b = 72;
+                }
+            }
+            b = step10(y, y) + a;
+            if (b < 49) {
+                a = b;
+                for (let i4 = 0; i4 < 37; i4++) {
+                    // step 3124
+                    a = 66;
+                    // step 3126
+                    x = 73 * a;
+                    y = 66;
+                }
+            }
+        }
+        for (let i2 = 0; i2 < 13; i2++) {
+            if (b > 87) {
+                step28(a, x);
+                i2 = 36 + x + 91;
+                if (x > 45) {
+                    // step 3137
+                    b = 68;
+                }
+            } else {
+                x = i2 * 22;
+            }
+            // step 3143
+            x = 33 - step7(b, x) * step0(a);
+        }
+        if (y === 7) {
+            if (x === 59) {
+                b = y;
+                if (x > 75) {
+                    step28(x, y);
+                    // step 3151
+                    y = a;
+                } else {
+                    // step 3154
+                    x = 9 - b;
+                }
+                b = y;
+            }
+        } else {
+            // step 3160
+            b = 94 + y + 18;
+            step4(a, b);
+        }
+        b = x * 80;
+    } else {
+        b = x;
+    }
+    return step8(y, a);
+}
+
+// step30: generated
+function step30(a) {
+    let x = 40 * a - 20;
+    let y = 10;
+    for (let i1 = 0; i1 < 78; i1++) {
+        step4(i1, y);
+        // step 3177
+        i1 = i1;
+        i1 = y * 93 - a;
+    }
+    for (let i1 = 0; i1 < 38; i1++) {
+        y = 45 + a - y;
+    }
+    a = x - y;
+    return 65;
+}
+
+// step31: generated
+function step31(a, b) {
+    let x = b * b;
+    let y = 26;
+    b = a * y;
+    b = step24(x);
+    for (let i1 = 0; i1 < 70; i1++) {
+        // step 3195
+        a = i1;
+        // step 3197
+        a = b;
+        for (let i2 = 0; i2 < 31; i2++) {
+            for (let i3 = 0; i3 < 62; i3++) {
+                for (let i4 = 0; i4 < 77; i4++) {
+                    // step 3202
+                    i4 = 47;
+                }
+                // step 3205
+                y = 54 + i1 + 2;
+            }
+            if (i1 > 50) {
+                if (i2 === 32) {
+                    step19(b, x);
+                    // step 3211
+                    y = step21(i1) - 13 + step4(x, b);
+                } else {
+                    i1 = step28(b, a);
+                    // step 3215
+                    i1 = 25;
+                }
+            }
+            // step 3219
+            b = 9 + a * 28;
+        }
+        if (i1 === 47) {
+            step25(a, a);
+            a = step25(b, b);
+        }
+    }
+    step16(y, y);
+    step20(b, b);
+    return 92;
+}
+
+// step32: generated
+function step32(a, b) {
+    let x = a;
+    let y = 15;
+    x = b - b + x;
+    for (let i1 = 0; i1 < 97; i1++) {
+        step20(b, b);
+        x = step10(y, a) + i1;
+    }
+    if (a > 15) {
+        step15(y);
+        step26(x, b);
+        if (y < 34) {
+            step1(b, x);
+            step5(b, x);
+            step20(y, b);
+            if (y < 82) {
+                // step 3249
+                x = 94;
+                if (y === 33) {
+                    a = 10 * x;
+                }
+                b = a;
+            }
+        }
+    }
+    for (let i1 = 0; i1 < 53; i1++) {
+        // step 3259
+        y = x;
+        for (let i2 = 0; i2 < 49; i2++) {
+            if (i2 < 22) {
+                y = y;
+            }
+            for (let i3 = 0; i3 < 30; i3++) {
+                for (let i4 = 0; i4 < 86; i4++) {
+                    step12(a);
+                }
+                i1 = i3 + i1;
+                // step 3270
+                i2 = 74 + i3 + i2;
+            }
+            if (i2 === 97) {
+                for (let i4 = 0; i4 < 17; i4++) {
+                    // step 3275
+                    b = x;
+                    // step 3277
+                    i1 = x * 87 * y;
+                    step26(i4, i4);
+                }
+                if (y === 3) {
+                    step22(x, a);
+                    // step 3283
+                    y = 20 + 57 * 57;
+                    // step 3285
+                    x = 5 + step22(i2, i2);
+                }
+                i1 = step28(i2, y) * i2;
+            } else {
+                if (i1 > 8) {
+                    i2 = i2;
+                    step26(b, b);
+                } else {
+                    // step 3294
+                    x = step2(a, x);
+                    i2 = i2 * 34;
+                    // step 3297
+                    i2 = 71;
+                }
+            }
+            a = 55 - step24(a);
+        }
+        if (a === 35) {
+            step24(a);
+        }
+    }
+    y = x * step28(y, x) * x;
+    return x * 52 + 20;
+}
+
+// step33: generated
+function step33(a) {
+    let x = a;
+    let y = 79;
+    // step 3315
+    x = step15(a) + x - 52;
+    if (y < 89) {
+        if (y < 32) {
+            if (x < 30) {
+                for (let i4 = 0; i4 < 41; i4++) {
+                    y = step32(a, y) * a + y;
+                    // step 3322
+                    a = i4;
+                }
+            } else {
+                // step 3326
+                a = a + 53;
+                a = 74;
+            }
+        }
+        step1(x, a);
+    }
+    step29(y, x);
+    for (let i1 = 0; i1 < 71; i1++) {
+        i1 = x + i1;
+        for (let i2 = 0; i2 < 70; i2++) {
+            i2 = step27(i1) - y;
+            i2 = i2 * a;
+            step20(x, a);
+        }
+        if (i1 < 75) {
+            for (let i3 = 0; i3 < 5; i3++) {
+                step18(a);
+            }
+            // step 3345
+            y = i1 + step18(y);
+        } else {
+            if (y < 28) {
+                for (let i4 = 0; i4 < 70; i4++) {
+                    // step 3350
+                    x = 95 + i4 - 4;
+                }
+            }
+            x = a - y * y;
+            for (let i3 = 0; i3 < 22; i3++) {
+                i1 = 73 + a;
+                if (i3 < 37) {
+                    y = 58 * i1;
+                }
+            }
+        }
+        // step 3362
+        y = step32(a, i1) + y;
+    }
+    if (a > 56) {
+        if (a === 72) {
+            for (let i3 = 0; i3 < 42; i3++) {
+                a = i3 - i3;
+                y = 61 * step7(y, x) * step13(i3, x);
+            }
+            if (a > 86) {
+                if (a === 71) {
+                    // step 3373
+                    a = 59 + 65;
+                } else {
+                    // step 3376
+                    x = y - x;
+                }
+                a = x + step16(a, y) * 96;
+                x = a * a;
+            }
+            y = a;
+            if (a < 28) {
+                if (x > 1) {
+                    // step 3385
+                    y = y + 29;
+                    y = 35 - y * step17(y, y);
+                    y = 8;
+                } else {
+                    y = y;
+                }
+            }
+        } else {
+            if (a < 65) {
+                a = step20(x, x) + 87;
+            }
+            y = 90 + x * x;
+        }
+    } else {
+        // step 3400
+        y = a + a;
+    }
+    return step29(y, x) * x - x;
+}
+
+// step34: generated
+function step34(a, b) {
+    let x = 35 - b - a;
+    let y = 17;
+    step24(b);
+    if (y === 37) {
+        if (b === 22) {
+            // step 3413
+            a = 91 * 82 + x;
+            for (let i3 = 0; i3 < 79; i3++) {
+                a = i3;
+                for (let i4 = 0; i4 < 73; i4++) {
+                    step9(i4);
+                    x = 10 - 80 + 32;
+                    // step 3420
+                    i4 = step18(a) - 3;
+                }
+                if (b > 1) {
+                    step11(x, y);
+                    y = 66 * y;
+                } else {
+                    a = 35 - 43;
+                }
+            }
+        } else {
+            for (let i3 = 0; i3 < 85; i3++) {
+                for (let i4 = 0; i4 < 65; i4++) {
+                    // step 3433
+                    i3 = y;
+                    // step 3435
+                    x = 39;
+                    // step 3437
+                    a = i3 - b;
+                }
+                if (y < 60) {
+                    // step 3441
+                    y = a;
+                } else {
+                    b = 31;
+                    // step 3445
+                    x = x;
+                }
+                b = 77 * step30(y) - b;
+            }
+            step13(x, a);
+            y = x * a - 8;
+            b = y;
+        }
+        x = 38 + a - step5(b, b);
+        step25(y, y);
+    } else {
+        // step 3457
+        x = y;
+        if (x === 74) {
+            x = a * 56 * b;
+            for (let i3 = 0; i3 < 26; i3++) {
+                if (b === 85) {
+                    // step 3463
+                    b = 81;
+                } else {
+                    // step 3466
+                    y = i3 + x * 92;
+                }
+                if (x < 23) {
+                    // step 3470
+                    a = step6(a);
+                    a = i3;
+                    // step 3473
+                    x = i3 - 3 * step21(b);
+                } else {
+                    a = i3;
+                }
+                for (let i4 = 0; i4 < 26; i4++) {
+                    // step 3479
+                    x = a;
+                    // step 3481
+                    i3 = step6(y) + step31(i3, y);
+                    i3 = i4;
+                }
+            }
+        } else {
+            if (y < 76) {
+                x = a + x;
+            } else {
+                if (a === 51) {
+                    // step 3491
+                    x = b;
+                    step1(b, y);
+                } else {
+                    a = 99 - y * 30;
+                }
+            }
+            if (y === 18) {
+                for (let i4 = 0; i4 < 33; i4++) {
+                    i4 = x * a;
+                }
+            }
+            step2(a, x);
+            for (let i3 = 0; i3 < 63; i3++) {
+                // step 3505
+                b = 54;
+                step22(b, a);
+            }
+        }
+    }
+    y = y - y - 29;
+    a = y + 18;
+    if (b === 21) {
+        for (let i2 = 0; i2 < 68; i2++) {
+            for (let i3 = 0; i3 < 57; i3++) {
+                for (let i4 = 0; i4 < 31; i4++) {
+                    step6(i3);
+                }
+                if (i2 < 36) {
+                    step4(i2, i2);
+                    // step 3521
+                    i3 = i2 - y + x;
+                    // step 3523
+                    a = 4 - 75 - i3;
+                } else {
+                    // step 3526
+                    x = i2 + i3 * i3;
+                }
+                if (y > 97) {
+                    // step 3530
+                    y = i3 + b;
+                    // step 3532
+                    b = step6(i3) * b * step1(i3, a);
+                    // step 3534
+                    i2 = i3 - step11(i2, i3) + a;
+                }
+            }
+            b = y - step3(y) + y;
+            step13(b, y);
+            // step 3540
+            y = 15;
+        }
+    } else {
+        x = 76 + 19;
+        a = a - a;
+    }
+    b = 45 - 80;
+    b = x * b + 57;
+    return 20;
+}
+
+// step35: generated
+function step35(a, b) {
+    let x = 63;
+    let y = 85;
+    step21(x);
+    // step 3557
+    b = y * b;
+    step28(a, b);
+    y = b * 26;
+    if (b === 39) {
+        if (b > 72) {
+            for (let i3 = 0; i3 < 20; i3++) {
+                for (let i4 = 0; i4 < 67; i4++) {
+                    step19(b, b);
+                    // step 3566
+                    a = i3;
+                    // step 3568
+                    b = 42;
+                }
+            }
+        } else {
+            y = a - a;
+            x = 37 * 89;
+        }
+    } else {
+        for (let i2 = 0; i2 < 98; i2++) {
+            if (a < 76) {
+                step6(b);
+                step27(a);
+                x = b + x * x;
+            } else {
+                if (y < 56) {
+                    // step 3584
+                    y = b - 82;
+                    // step 3586
+                    a = 79 - i2 - step1(y, i2);
+                    // step 3588
+                    a = i2 * 40 * b;
+                }
+                x = a * i2 + b;
+            }
+        }
+    }
+    b = 48;
+    return 30;
+}
+
+// step36: generated
+function step36(a) {
+    let x = a - 73;
+    let y = 7;
+    // step 3603
+    y = step22(a, a);
+    x = a;
+    for (let i1 = 0; i1 < 95; i1++) {
+        // step 3607
+        x = step3(a);
+    }
+    y = 54;
+    a = a - 74 + 80;
+    return 22 + a * x;
+}
+
+// step37: generated
+function step37(a, b) {
+    let x = b * 14;
+    let y = 41;
+    if (b === 38) {
+        if (x === 46) {
+            // step 3621
+            y = 89;
+        } else {
+            x = 14 * 30;
+        }
+        if (a > 26) {
+            // step 3627
+            x = x - y + 17;
+            step22(x, x);
+            for (let i3 = 0; i3 < 28; i3++) {
+                // step 3631
+                a = 72;
+            }
+        }
+        x = 13 * 70 + b;
+        for (let i2 = 0; i2 < 7; i2++) {
+            // step 3637
+            y = step4(y, b) + b;
+            if (x < 2) {
+                for (let i4 = 0; i4 < 82; i4++) {
+                    // step 3641
+                    x = y + 91;
+                }
+            } else {
+                step31(b, b);
+                x = 4;
+                for (let i4 = 0; i4 < 78; i4++) {
+                    step8(i2, a);
+                }
+            }
+            i2 = y;
+        }
+    } else {
+        for (let i2 = 0; i2 < 28; i2++) {
+            for (let i3 = 0; i3 < 75; i3++) {
+                for (let i4 = 0; i4 < 87; i4++) {
+                    i3 = b + b + a;
+                    x = i3 - 7 - 13;
+                    step35(i4, x);
+                }
+                if (i3 > 3) {
+                    // step 3662
+                    y = 38 + 42;
+                } else {
+                    // step 3665
+                    y = b + b;
+                    i3 = 27 - step13(b, b) - 87;
+                }
+            }
+            i2 = y + step7(y, a);
+            if (x < 28) {
+                a = b + i2 * b;
+            } else {
+                if (i2 === 70) {
+                    i2 = y - 44;
+                    // step 3676
+                    x = x;
+                } else {
+                    a = a + a;
+                }
+                y = 41 * x;
+            }
+            // step 3683
+            a = x;
+        }
+    }
+    for (let i1 = 0; i1 < 76; i1++) {
+        x = 13 - i1 + step2(b, a);
+        if (x < 74) {
+            y = y + 8;
+            b = step19(a, a);
+        } else {
+            if (b < 42) {
+                a = 64;
+            } else {
+                a = a;
+                for (let i4 = 0; i4 < 81; i4++) {
+                    // step 3698
+                    b = 95 + 90;
+                }
+            }
+        }
+    }
+    // step 3704
+    x = 32;
+    for (let i1 = 0; i1 < 41; i1++) {
+        if (a > 25) {
+            y = y - 27 + 87;
+            for (let i3 = 0; i3 < 45; i3++) {
+                step3(i3);
+            }
+            step22(i1, a);
+            if (a === 95) {
+                if (x < 91) {
+                    // step 3715
+                    x = 87;
+                    step14(y, b);
+                    // step 3718
+                    b = step34(i1, y) + 39;
+                }
+            }
+        } else {
+            for (let i3 = 0; i3 < 59; i3++) {
+                for (let i4 = 0; i4 < 27; i4++) {
+                    // step 3725
+                    x = y * i4 - 62;
+                }
+                step26(a, b);
+                if (x === 81) {
+                    // step 3730
+                    y = y - 93 - 20;
+                } else {
+                    i1 = step29(y, b);
+                }
+            }
+        }
+        step17(b, y);
+        // step 3738
+        x = i1 - x;
+        if (x > 38) {
+            if (x === 96) {
+                // step 3742
+                a = 50;
+            } else {
+                // step 3745
+                i1 = 73 - 89;
+            }
+            step23(i1, b);
+        }
+    }
+    return a;
+}
+
+// step38: generated
+function step38(a, b) {
+    let x = b - a * a;
+    let y = 77;
+    b = b * a * b;
+    if (y > 32) {
+        // step 3760
+        a = a - a + x;
+        step25(x, a);
+    } else {
+        // step 3764
+        y = 55 + a;
+        step25(a, x);
+    }
+    step6(y);
+    step30(x);
+    if (y === 72) {
+        if (a > 98) {
+            b = step37(y, y) - y;
+            y = a;
+            if (y > 79) {
+                x = a - 17;
+                for (let i4 = 0; i4 < 26; i4++) {
+                    a = b * 41 - i4;
+                    i4 = 56 - b * i4;
+                    // step 3779
+                    y = 13 * b;
+                }
+                a = 91;
+            }
+        } else {
+            if (x > 7) {
+                if (y < 30) {
+                    x = y - a;
+                }
+            }
+            a = b + step25(a, b) + step30(y);
+            y = 8 * 49;
+            y = 64 * step0(a) * 16;
+        }
+        // step 3794
+        y = 12 + b * a;
+        if (b > 39) {
+            a = y * x - step2(a, b);
+        }
+    } else {
+        for (let i2 = 0; i2 < 71; i2++) {
+            for (let i3 = 0; i3 < 68; i3++) {
+                a = i2 * 38;
+                a = 12 + 67 - 37;
+                a = i3 * step26(a, i3) + x;
+            }
+            step35(x, x);
+            a = x - b + 88;
+        }
+        step32(a, a);
+    }
+    return 13;
+}
+
+// step39: generated
+function step39(a) {
+    let x = a;
+    let y = 89;
+    y = 11 * step19(a, y);
+    for (let i1 = 0; i1 < 3; i1++) {
+        x = step38(i1, x) + 14;
+        if (y === 84) {
+            a = a;
+            step36(a);
+            y = 22 + 14 * a;
+            y = 35 + i1;
+        }
+    }
+    y = a * y;
+    y = step29(x, y);
+    x = a;
+    for (let i1 = 0; i1 < 65; i1++) {
+        step11(x, x);
+        step11(i1, y);
+    }
+    for (let i1 = 0; i1 < 34; i1++) {
+        step34(x, i1);
+        for (let i2 = 0; i2 < 57; i2++) {
+            i2 = a;
+            x = 3 - i1 * x;
+        }
+        i1 = a - 89;
+        if (i1 < 14) {
+            step29(x, a);
+        }
+    }
+    return 19 - a - step10(y, x);
+}
+
+// step40: generated
+function step40(a, b) {
+    let x = 57 + b + b;
+    let y = 2;
+    // step 3853
+    x = 50 - y - y;
+    if (x < 1) {
+        a = 22 + 79;
+    }
+    x = 59 - b + a;
+    if (b > 95) {
+        x = a;
+        step26(a, a);
+    } else {
+        step39(x);
+    }
+    if (x > 38) {
+        if (y > 82) {
+            for (let i3 = 0; i3 < 63; i3++) {
+                for (let i4 = 0; i4 < 42; i4++) {
+                    step36(i4);
+                }
+            }
+            if (b === 88) {
+                y = step3(y) + y;
+                y = 85;
+                // step 3875
+                a = a * y - 61;
+            }
+            if (x === 29) {
+                // step 3879
+                b = step34(b, y) - 34;
+            }
+            x = y * step4(y, a) * b;
+        }
+        a = a - x - y;
+        // step 3885
+        y = x * a;
+        if (y < 27) {
+            a = 39 - 56;
+            for (let i3 = 0; i3 < 91; i3++) {
+                if (x < 74) {
+                    // step 3891
+                    b = i3 + b + 64;
+                }
+                if (b === 67) {
+                    b = y * step35(x, y);
+                }
+                i3 = 13 - 27 * a;
+            }
+            b = x - b + y;
+        } else {
+            step5(b, b);
+        }
+    } else {
+        step10(b, x);
+        for (let i2 = 0; i2 < 91; i2++) {
+            if (x < 90) {
+                y = 26;
+            }
+            if (b < 94) {
+                x = 51 + i2;
+                x = 93;
+            } else {
+                step1(a, x);
+                if (i2 < 22) {
+                    // step 3915
+                    x = 27 + 63 * 84;
+                } else {
+                    y = 10;
+                }
+            }
+            if (y < 32) {
+                b = 9 - b * i2;
+                for (let i4 = 0; i4 < 94; i4++) {
+                    y = i4 * a;
+                }
+            }
+            if (b === 56) {
+                // step 3928
+                a = 31 + 63;
+                if (a > 24) {
+                    // step 3931
+                    a = step7(a, b);
+                    // step 3933
+                    i2 = i2 - 61 * i2;
+                } else {
+                    // step 3936
+                    y = 7;
+                }
+                if (i2 === 80) {
+                    a = 79 + a;
+                } else {
+                    step22(a, b);
+                }
+            }
+        }
+    }
+    if (a > 27) {
+        b = a * 59 * b;
+        if (y < 46) {
+            a = a + x;
+            if (x < 11) {
+                step13(a, b);
+            } else {
+                if (y === 49) {
+                    // step 3955
+                    b = step23(x, b) - y;
+                }
+            }
+            y = y * step36(a);
+        } else {
+            for (let i3 = 0; i3 < 64; i3++) {
+                step14(i3, b);
+                i3 = b * 71 - y;
+            }
+        }
+        step0(b);
+    } else {
+        step14(b, y);
+        y = 12;
+        b = 35 * 83 - 83;
+        b = step39(b) + 0 * step15(b);
+    }
+    if (a === 16) {
+        step19(a, x);
+        y = 95 - 97;
+        if (a > 36) {
+            b = step12(x) + step31(x, x) - step16(a, y);
+        } else {
+            y = a + x * 1;
+            if (b < 27) {
+                y = step33(y);
+            }
+        }
+    }
+    return y * b * x;
+}
+
+// step41: generated
+function step41(a, b) {
+    let x = b;
+    let y = 72;
+    for (let i1 = 0; i1 < 95; i1++) {
+        i1 = x * a * 23;
+    }
+    for (let i1 = 0; i1 < 54; i1++) {
+        b = i1 + step11(a, b);
+        step5(i1, b);
+    }
+    y = y * x;
+    return 78;
+}
+
+// step42: generated
+function step42(a) {
+    let x = a;
+    let y = 69;
+    for (let i1 = 0; i1 < 37; i1++) {
+        // step 4008
+        a = step32(i1, y) + i1;
+    }
+    step36(y);
+    y = 46 * 66;
+    for (let i1 = 0; i1 < 67; i1++) {
+        a = 61 * i1;
+    }
+    a = 94 - a;
+    // step 4017
+    x = step36(a) - 10 * 87;
+    for (let i1 = 0; i1 < 3; i1++) {
+        for (let i2 = 0; i2 < 82; i2++) {
+            if (a < 30) {
+                if (x > 77) {
+                    a = 90;
+                    // step 4024
+                    y = x;
+                }
+            }
+        }
+        step15(i1);
+    }
+    step2(a, y);
+    return 98 + step23(y, y);
+}
+
+// step43: generated
+function step43(a, b) {
+    let x = 42 + 61;
+    let y = 13;
+    b = 55 - x;
+    for (let i1 = 0; i1 < 28; i1++) {
+        a = step30(a) * b + b;
+        x = step33(a) + 1;
+        if (b < 49) {
+            y = b + 64 - 55;
+        }
+    }
+    b = 7;
+    for (let i1 = 0; i1 < 84; i1++) {
+        if (y > 97) {
+            a = step42(b) + step42(y) - i1;
+            if (a < 42) {
+                for (let i4 = 0; i4 < 50; i4++) {
+                    a = i1;
+                }
+                step35(i1, b);
+                a = step10(a, i1) * x;
+            } else {
+                step21(b);
+            }
+            b = b;
+            // step 4061
+            a = 40 - 39 + 12;
+        } else {
+            // step 4064
+            b = 67 - 32;
+            if (y < 67) {
+                a = a * a * step14(x, i1);
+            } else {
+                step2(y, i1);
+            }
+            x = a;
+            for (let i3 = 0; i3 < 54; i3++) {
+                if (a === 71) {
+                    b = b - step37(a, y);
+                } else {
+                    // step 4076
+                    i1 = a;
+                    // step 4078
+                    a = a + 60 * b;
+                }
+            }
+        }
+    }
+    b = a - b;
+    // step 4085
+    x = step9(b) * x;
+    return 35 * b * 20;
+}
+
+// step44: generated
+function step44(a, b) {
+    let x = b;
+    let y = 8;
+    // step 4094
+    b = y + 84 - 55;
+    for (let i1 = 0; i1 < 6; i1++) {
+        for (let i2 = 0; i2 < 45; i2++) {
+            y = step37(x, x) + i1;
+        }
+        if (x > 50) {
+            a = 12 + 52;
+            step43(b, b);
+        }
+    }
+    x = a * 45;
+    // step 4106
+    a = step43(y, a) - 88;
+    step2(a, a);
+    step1(x, y);
+    step8(x, y);
+    return 82 - 97 - 15;
+}
+
+// step45: generated
+function step45(a) {
+    let x = 87 + a;
+    let y = 12;
+    for (let i1 = 0; i1 < 16; i1++) {
+        if (i1 < 87) {
+            if (a < 55) {
+                i1 = 49 * y - step19(i1, i1);
+                // step 4122
+                a = y - 48 - step30(a);
+                step37(x, y);
+            } else {
+                for (let i4 = 0; i4 < 98; i4++) {
+                    i1 = i4 + 47 - i1;
+                    // step 4128
+                    x = 94;
+                }
+            }
+            step41(y, i1);
+            if (x > 25) {
+                y = step12(i1);
+                for (let i4 = 0; i4 < 75; i4++) {
+                    a = 86 * step11(i4, y) + step12(x);
+                }
+                y = i1 * step34(y, x) + step7(y, i1);
+            }
+        }
+    }
+    if (y > 89) {
+        if (a < 55) {
+            a = a + a;
+            if (x === 57) {
+                if (x === 91) {
+                    // step 4147
+                    x = 44 + 91 + step2(y, a);
+                } else {
+                    // step 4150
+                    y = a;
+                }
+                a = 90 + x;
+            } else {
+                if (y > 97) {
+                    y = a;
+                } else {
+                    x = a * x - x;
+                    step38(y, a);
+                    // step 4160
+                    a = step42(x) * 46;
+                }
+                if (y === 25) {
+                    y = a;
+                } else {
+                    // step 4166
+                    a = 98 + 51;
+                    step29(y, x);
+                    // step 4169
+                    a = x * 63;
+                }
+                x = a - step8(x, x);
+            }
+        } else {
+            a = 89;
+        }
+    } else {
+        if (a < 2) {
+            for (let i3 = 0; i3 < 57; i3++) {
+                if (a > 76) {
+                    i3 = step5(x, x) + y + a;
+                } else {
+                    step11(i3, x);
+                }
+            }
+            if (a < 20) {
+                y = step24(x);
+            }
+            if (x > 62) {
+                for (let i4 = 0; i4 < 33; i4++) {
+                    // step 4191
+                    a = 70 * y;
+                    i4 = i4 * x;
+                    // step 4194
+                    i4 = y;
+                }
+            } else {
+                for (let i4 = 0; i4 < 91; i4++) {
+                    y = a;
+                }
+            }
+        } else {
+            if (a === 18) {
+                a = step21(a) * y;
+            } else {
+                x = a * step35(x, y) - a;
+            }
+            // step 4208
+            x = a * step20(x, x) * y;
+            step25(a, y);
+            y = 17 * 18 * step37(a, a);
+        }
+    }
+    a = y * x * 80;
+    return x * x - 69;
+}
+
+// step46: generated
+function step46(a, b) {
+    let x = b + 54;
+    let y = 94;
+    if (a === 87) {
+        // step 4223
+        b = x;
+        if (x < 83) {
+            x = a;
+            if (y < 9) {
+                // step 4228
+                a = a;
+            } else {
+                if (b > 11) {
+                    a = b - a - 96;
+                    a = a * x * y;
+                } else {
+                    b = 42;
+                    // step 4236
+                    b = 85 * b + y;
+                }
+            }
+            step20(b, x);
+            step32(y, x);
+        }
+        for (let i2 = 0; i2 < 63; i2++) {
+            // step 4244
+            i2 = y * a;
+            b = b + 61 * b;
+            step32(b, b);
+        }
+    } else {
+        step29(y, x);
+        for (let i2 = 0; i2 < 88; i2++) {
+            b = a;
+        }
+    }
+    a = b - step43(a, b) - 89;
+    if (x === 39) {
+        if (x < 45) {
+            if (y > 56) {
+                if (y > 58) {
+                    // step 4260
+                    y = step16(y, x) - x * a;
+                    // step 4262
+                    y = 20;
+                    // step 4264
+                    x = 2 * step26(a, b);
+                }
+            } else {
+                step5(y, y);
+            }
+            step37(y, x);
+            x = 65;
+        }
+        // step 4273
+        a = b - step31(a, a);
+    }
+    for (let i1 = 0; i1 < 86; i1++) {
+        i1 = x;
+        if (x < 76) {
+            a = 14 + y;
+        }
+        if (i1 === 96) {
+            if (a < 88) {
+                // step 4283
+                y = a;
+                if (x > 23) {
+                    step43(b, y);
+                }
+            }
+        }
+        for (let i2 = 0; i2 < 17; i2++) {
+            i1 = b - y;
+            if (y < 18) {
+                i1 = 40 * i2 * i2;
+                b = a;
+                i2 = 34 + x - y;
+            } else {
+                step7(i2, i2);
+                i2 = a;
+            }
+            step11(i2, i1);
+            b = i1 * 12;
+        }
+    }
+    if (a === 95) {
+        step40(b, a);
+        if (y === 95) {
+            for (let i3 = 0; i3 < 25; i3++) {
+                for (let i4 = 0; i4 < 72; i4++) {
+                    // step 4309
+                    a = i4 + 43;
+                }
+            }
+            x = 92 - y + step2(x, a);
+            y = x;
+        } else {
+            if (a < 55) {
+                if (b === 84) {
+                    // step 4318
+                    y = 11 - a;
+                }
+                a = x * b;
+            }
+            b = 12;
+        }
+    }
+    for (let i1 = 0; i1 < 13; i1++) {
+        // step 4327
+        b = step29(a, x) * 50;
+        step26(x, i1);
+    }
+    for (let i1 = 0; i1 < 46; i1++) {
+        i1 = a * step29(i1, a);
+        i1 = x;
+        i1 = a * step40(y, x);
+        y = a + b;
+    }
+    step21(x);
+    return 67 * step22(b, a) + y;
+}
+
+// step47: generated
+function step47(a, b) {
+    let x = a + b - 34;
+    let y = 17;
+    a = y * step23(a, b) - y;
+    // step 4346
+    a = 66 - step46(y, b);
+    // step 4348
+    y = x + 28 - 48;
+    b = y * 85;
+    a = x - x + b;
+    if (b > 33) {
+        x = step5(y, a) - 49;
+    } else {
+        b = 50 - x;
+        a = a - 66 - 95;
+    }
+    // step 4358
+    a = x - step41(a, y) - a;
+    return 77 - x;
+}
+
+// step48: generated
+function step48(a) {
+    let x = 60;
+    let y = 14;
+    y = y;
+    if (a === 35) {
+        if (y === 9) {
+            a = a - x - 28;
+        } else {
+            if (a === 34) {
+                x = 93 - step47(y, x);
+                y = 14 - y - 79;
+                // step 4375
+                a = 27;
+            } else {
+                a = step9(x) - x;
+            }
+            step12(y);
+        }
+        step32(a, y);
+        if (a < 35) {
+            for (let i3 = 0; i3 < 49; i3++) {
+                y = 46;
+            }
+            if (x < 71) {
+                if (a > 78) {
+                    // step 4389
+                    y = 12 + 14;
+                    step3(a);
+                    // step 4392
+                    a = 68;
+                } else {
+                    // step 4395
+                    x = step18(a);
+                }
+                x = x * 77;
+            }
+            // step 4400
+            x = 91;
+            // step 4402
+            a = y * x + step28(y, y);
+        }
+        step24(y);
+    } else {
+        for (let i2 = 0; i2 < 34; i2++) {
+            y = i2 * step27(i2) + a;
+            if (i2 === 11) {
+                step14(i2, y);
+                for (let i4 = 0; i4 < 34; i4++) {
+                    // step 4412
+                    y = 55 + step24(i2) - i4;
+                    // step 4414
+                    i2 = step8(i2, x) + x - i2;
+                    // step 4416
+                    y = i2 + i4;
+                }
+            } else {
+                if (a < 23) {
+                    step21(x);
+                } else {
+                    // step 4423
+                    x = 63;
+                }
+            }
+            for (let i3 = 0; i3 < 38; i3++) {
+                i3 = 72 - i3 - a;
+            }
+            // step 4430
+            x = i2 * a;
+        }
+        if (x > 77) {
+            for (let i3 = 0; i3 < 8; i3++) {
+                for (let i4 = 0; i4 < 86; i4++) {
+                    a = step11(i3, i4) + step15(y);
+                }
+                for (let i4 = 0; i4 < 92; i4++) {
+                    y = y * 67;
+                }
+            }
+            y = 39 * a;
+            a = 88 + 47;
+            if (x > 63) {
+                step18(a);
+                if (x < 49) {
+                    // step 4447
+                    y = a - x - x;
+                } else {
+                    step45(x);
+                    a = x - 40;
+                    // step 4452
+                    a = 53;
+                }
+                if (y === 23) {
+                    // step 4456
+                    x = 35 * x * 34;
+                    // step 4458
+                    y = 89 + a * y;
+                }
+            } else {
+                y = x * step41(y, a);
+                x = 35 + x * x;
+                for (let i4 = 0; i4 < 94; i4++) {
+                    step4(y, a);
+                    // step 4466
+                    x = step21(a) - y + x;
+                    // step 4468
+                    x = i4;
+                }
+            }
+        } else {
+            if (a > 74) {
+                for (let i4 = 0; i4 < 17; i4++) {
+                    a = y + 22;
+                    // step 4476
+                    x = i4 - 68;
+                }
+            }
+            if (a === 88) {
+                if (a > 20) {
+                    a = 49;
+                } else {
+                    a = step32(x, a);
+                }
+            }
+            for (let i3 = 0; i3 < 37; i3++) {
+                for (let i4 = 0; i4 < 75; i4++) {
+                    // step 4489
+                    a = 0 * step47(y, x);
+                    // step 4491
+                    y = i4;
+                    // step 4493
+                    a = step47(i4, i4) - i3;
+                }
+                step4(a, a);
+            }
+            if (a < 65) {
+                for (let i4 = 0; i4 < 2; i4++) {
+                    // step 4500
+                    a = 57 * 89;
+                }
+                for (let i4 = 0; i4 < 19; i4++) {
+                    // step 4504
+                    y = x - 54 - 74;
+                }
+            }
+        }
+        if (y < 83) {
+            a = y + a;
+        }
+        if (y > 75) {
+            a = a + a;
+            if (x > 1) {
+                step6(a);
+                if (y < 88) {
+                    a = step27(y) - 36 - x;
+                }
+            } else {
+                y = 2 - x + step20(a, y);
+            }
+            step30(y);
+        }
+    }
+    if (x < 19) {
+        x = 24 + y;
+        x = 28;
+    } else {
+        for (let i2 = 0; i2 < 7; i2++) {
+            x = 61 - x - i2;
+            step33(i2);
+        }
+        a = y * y;
+    }
+    return y - 52;
+}
+
+// step49: generated
+function step49(a, b) {
+    let x = b - 39 * b;
+    let y = 61;
+    a = y - step13(b, x) + x;
+    a = step32(y, y) * step23(a, y) * 6;
+    if (x > 61) {
+        a = step25(x, b) * 17 * step16(x, y);
+        if (y === 37) {
+            if (a === 94) {
+                a = x - a;
+            }
+            // step 4550
+            b = a - x;
+        }
+    } else {
+        for (let i2 = 0; i2 < 99; i2++) {
+            i2 = 9 - 98;
+            b = a * 75;
+        }
+        step17(b, b);
+        for (let i2 = 0; i2 < 16; i2++) {
+            x = 65 - step2(b, a);
+            if (y < 42) {
+                a = b - step19(i2, y);
+                if (y === 35) {
+                    b = y + b + 61;
+                }
+            }
+            // step 4567
+            a = x + a * y;
+        }
+    }
+    if (x > 32) {
+        if (a < 8) {
+            x = y;
+            for (let i3 = 0; i3 < 74; i3++) {
+                if (a === 39) {
+                    y = 1 + step42(x);
+                    b = b;
+                }
+                // step 4579
+                a = 62;
+            }
+        }
+        x = 92 * x;
+    } else {
+        if (y < 61) {
+            for (let i3 = 0; i3 < 63; i3++) {
+                for (let i4 = 0; i4 < 44; i4++) {
+                    b = 16;
+                }
+            }
+            if (a < 53) {
+                y = a + step44(x, x);
+                if (b < 0) {
+                    // step 4594
+                    a = b;
+                } else {
+                    // step 4597
+                    a = b * x;
+                }
+                a = 70 + a + 62;
+            }
+        } else {
+            step40(y, b);
+            step38(y, b);
+            if (b > 68) {
+                step15(x);
+                if (a === 57) {
+                    // step 4608
+                    a = step47(x, y);
+                    x = b + x;
+                    // step 4611
+                    a = step5(y, a) + 38;
+                } else {
+                    b = y;
+                }
+            }
+        }
+        b = a + step45(a) - a;
+    }
+    if (a < 79) {
+        y = y;
+        if (x > 9) {
+            x = 85 + y;
+            if (a > 70) {
+                for (let i4 = 0; i4 < 63; i4++) {
+                    y = b * i4 + 22;
+                }
+            }
+            if (x < 25) {
+                // step 4630
+                x = y + y;
+                a = b;
+                a = step43(b, y) * y;
+            } else {
+                b = step15(x);
+                step23(y, x);
+                if (y === 53) {
+                    x = step44(y, y);
+                }
+            }
+            a = b * x;
+        } else {
+            if (x < 59) {
+                x = 77 + x;
+            } else {
+                step3(b);
+            }
+            for (let i3 = 0; i3 < 9; i3++) {
+                step47(i3, a);
+                step34(a, i3);
+                for (let i4 = 0; i4 < 96; i4++) {
+                    // step 4652
+                    i3 = step10(b, x) - i4;
+                }
+            }
+            if (b === 70) {
+                a = y;
+            }
+            if (y < 45) {
+                step22(a, x);
+            } else {
+                if (x === 92) {
+                    // step 4663
+                    x = a * a - step37(b, b);
+                    b = step38(b, y) + 68 + b;
+                    step32(a, b);
+                }
+            }
+        }
+    }
+    if (a < 48) {
+        // step 4672
+        a = a - 52;
+        for (let i2 = 0; i2 < 1; i2++) {
+            y = i2;
+            if (b < 46) {
+                if (x > 46) {
+                    x = step25(a, x);
+                }
+            }
+            if (y > 64) {
+                i2 = 61;
+                b = 74 + 5 * step22(i2, i2);
+                x = a + y;
+            } else {
+                step2(a, b);
+            }
+        }
+        x = 11;
+        // step 4690
+        y = b + 75 * step2(y, x);
+    }
+    a = y - 63 * b;
+    y = step7(x, b);
+    return 9 * step33(y);
+}
+
+// step50: generated
+function step50(a, b) {
+    let x = 5 * b;
+    let y = 19;
+    for (let i1 = 0; i1 < 11; i1++) {
+        step18(b);
+    }
+    // step 4705
+    x = step38(y, y) + step9(a);
+    if (b === 66) {
+        for (let i2 = 0; i2 < 56; i2++) {
+            b = y * i2;
+        }
+        step4(b, b);
+    } else {
+        for (let i2 = 0; i2 < 2; i2++) {
+            y = 19 - 28;
+            x = 93 - x;
+        }
+    }
+    x = 12 + a + x;
+    return step39(b);
+}
+
+// step51: generated
+function step51(a) {
+    let x = 72;
+    let y = 43;
+    for (let i1 = 0; i1 < 7; i1++) {
+        if (y === 41) {
+            step28(x, x);
+            step50(i1, x);
+            a = i1;
+            if (y < 52) {
+                if (a < 92) {
+                    step40(i1, y);
+                    // step 4734
+                    a = a;
+                    // step 4736
+                    y = a - y;
+                } else {
+                    // step 4739
+                    a = 43 - a;
+                }
+            }
+        } else {
+            step49(x, a);
+            if (y < 2) {
+                for (let i4 = 0; i4 < 12; i4++) {
+                    // step 4747
+                    x = a;
+                    // step 4749
+                    x = 48 * i4;
+                    step5(y, y);
+                }
+            }
+            if (a < 54) {
+                if (x < 20) {
+                    x = 97 - y * 80;
+                }
+            }
+            if (y === 89) {
+                if (a === 38) {
+                    // step 4761
+                    i1 = 21;
+                    step41(x, a);
+                } else {
+                    // step 4765
+                    y = x + step23(i1, x);
+                    // step 4767
+                    a = 12 * 84 + i1;
+                }
+            } else {
+                step25(i1, y);
+                x = a + 61 - 35;
+            }
+        }
+        a = 0 * 14;
+    }
+    a = 91;
+    // step 4778
+    a = a + 94 - y;
+    for (let i1 = 0; i1 < 61; i1++) {
+        for (let i2 = 0; i2 < 58; i2++) {
+            for (let i3 = 0; i3 < 29; i3++) {
+                for (let i4 = 0; i4 < 20; i4++) {
+                    // step 4784
+                    i2 = step31(i3, i4) + 71 * i3;
+                    step27(i2);
+                    // step 4787
+                    i2 = x + 80 - 73;
+                }
+                if (i1 > 0) {
+                    a = 30 - i2 + step24(i1);
+                    // step 4792
+                    y = 43 * x;
+                    y = i3 + a - step1(y, i1);
+                }
+                // step 4796
+                x = i3 * 79 - step44(i1, x);
+            }
+            if (y < 25) {
+                for (let i4 = 0; i4 < 43; i4++) {
+                    // step 4801
+                    a = y - x * a;
+                    // step 4803
+                    i4 = y * step29(x, x) * step4(x, y);
+                }
+            } else {
+                a = i2 - 4 + 80;
+            }
+            step6(a);
+            step18(y);
+        }
+        for (let i2 = 0; i2 < 84; i2++) {
+            for (let i3 = 0; i3 < 26; i3++) {
+                i3 = y;
+                if (i1 < 61) {
+                    // step 4816
+                    a = step19(y, a);
+                }
+            }
+        }
+    }
+    return x;
+}
+
+// step52: generated
+function step52(a, b) {
+    let x = 35 - b + b;
+    let y = 66;
+    // step 4829
+    x = a * b * 41;
+    step21(a);
+    step23(a, x);
+    step46(y, x);
+    if (x < 91) {
+        y = b + y - b;
+        b = step0(x) * b;
+        for (let i2 = 0; i2 < 96; i2++) {
+            y = 87 * y + 59;
+            for (let i3 = 0; i3 < 53; i3++) {
+                if (b < 21) {
+                    // step 4841
+                    b = y * step44(i2, i3);
+                    // step 4843
+                    a = 28 - x;
+                    i2 = 92 - a;
+                } else {
+                    // step 4847
+                    x = 73;
+                }
+            }
+            if (b === 88) {
+                i2 = 39 * x + y;
+            } else {
+                b = 73 * 42;
+                i2 = 67 + b + 20;
+                y = x - 35;
+            }
+        }
+    } else {
+        step6(a);
+        if (y > 31) {
+            a = y * 0;
+        }
+    }
+    // step 4865
+    x = a;
+    for (let i1 = 0; i1 < 70; i1++) {
+        for (let i2 = 0; i2 < 98; i2++) {
+            for (let i3 = 0; i3 < 25; i3++) {
+                step41(i3, b);
+            }
+        }
+        if (y < 17) {
+            if (b < 37) {
+                x = 41 + step22(y, y) - step17(i1, a);
+            }
+            i1 = step6(a);
+            for (let i3 = 0; i3 < 17; i3++) {
+                step24(i3);
+            }
+        }
+        i1 = a + step36(b) - b;
+        step50(i1, b);
+    }
+    step26(b, b);
+    return b;
+}
+
+// step53: generated
+function step53(a, b) {
+    let x = 6 - b;
+    let y = 47;
+    for (let i1 = 0; i1 < 37; i1++) {
+        for (let i2 = 0; i2 < 76; i2++) {
+            step25(x, i1);
+        }
+        a = 65;
+        a = 93 * 70;
+    }
+    for (let i1 = 0; i1 < 4; i1++) {
+        if (a > 12) {
+            step3(a);
+        } else {
+            // step 4904
+            i1 = a + a * x;
+            b = b + i1 * step32(b, y);
+        }
+        step34(x, y);
+    }
+    // step 4910
+    y = x * 45;
+    y = b;
+    if (y > 81) {
+        step23(b, a);
+        step32(b, a);
+        for (let i2 = 0; i2 < 21; i2++) {
+            if (y === 90) {
+                a = a;
+                y = a - a + step27(b);
+            } else {
+                b = step22(y, x) + 80 + x;
+            }
+            x = i2 * x * 66;
+            if (y === 16) {
+                for (let i4 = 0; i4 < 50; i4++) {
+                    b = i2 + i2 * i2;
+                }
+            }
+        }
+        step11(b, x);
+    } else {
+        if (y > 42) {
+            a = b + step17(a, y) * 70;
+            step19(x, x);
+            if (y === 95) {
+                x = a * 72 - step27(x);
+            } else {
+                a = 10 - b - y;
+            }
+            x = x * 59;
+        } else {
+            y = step48(y) - 85;
+            b = 93 * b * y;
+            for (let i3 = 0; i3 < 25; i3++) {
+                b = x * b;
+            }
+        }
+        if (b < 37) {
+            if (y < 83) {
+                // step 4950
+                a = a;
+                // step 4952
+                x = 19 - 84 - y;
+            } else {
+                if (b > 35) {
+                    b = step15(b) - x + x;
+                    b = 66 * a;
+                }
+            }
+        }
+        // step 4961
+        b = 85;
+        if (b > 76) {
+            if (y === 25) {
+                if (b > 89) {
+                    // step 4966
+                    b = x + 70;
+                }
+                b = a;
+            }
+            step44(x, b);
+            if (a < 18) {
+                step7(b, y);
+                for (let i4 = 0; i4 < 43; i4++) {
+                    x = 83 + step48(b) * 36;
+                    x = step3(i4) - x;
+                    // step 4977
+                    a = 34;
+                }
+            } else {
+                if (y > 66) {
+                    // step 4982
+                    x = 43 * b;
+                }
+                if (y > 21) {
+                    step31(x, y);
+                }
+            }
+        } else {
+            // step 4990
+            a = 91;
+            if (a > 43) {
+                step33(y);
+            } else {
+                a = 15 + 47;
+                y = x + 28 * 67;
+                for (let i4 = 0; i4 < 4; i4++) {
+                    // step 4998
+                    x = a;
+                    // step 5000
+                    b = x;
+                }
+            }
+            for (let i3 = 0; i3 < 73; i3++) {
+                step41(b, a);
+                for (let i4 = 0; i4 < 5; i4++) {
+                    // step 5007
+                    x = x;
+                    // step 5009
+                    y = 41;
+                }
+                if (y === 7) {
+                    // step 5013
+                    b = i3 - 5;
+                    a = b;
+                    a = x * step13(b, b);
+                }
+            }
+        }
+    }
+    step12(y);
+    if (y > 46) {
+        if (b > 79) {
+            for (let i3 = 0; i3 < 58; i3++) {
+                i3 = 39 * 54;
+                for (let i4 = 0; i4 < 2; i4++) {
+                    // step 5027
+                    b = b + i3;
+                    // step 5029
+                    b = b - 68;
+                    // step 5031
+                    x = step12(a);
+                }
+                if (b > 60) {
+                    // step 5035
+                    y = 47;
+                } else {
+                    a = 40 * a + y;
+                }
+            }
+        } else {
+            if (x < 3) {
+                a = 71;
+                y = 3;
+            } else {
+                y = step44(a, b) * b;
+                a = b + 33;
+            }
+            for (let i3 = 0; i3 < 55; i3++) {
+                if (x < 59) {
+                    i3 = a + 54;
+                    i3 = 42;
+                    // step 5053
+                    y = b * y + 66;
+                } else {
+                    // step 5056
+                    a = x * y;
+                    // step 5058
+                    i3 = 62 * a;
+                    step38(a, i3);
+                }
+                if (x < 11) {
+                    a = 90 * y;
+                    step48(i3);
+                    // step 5065
+                    x = b;
+                }
+            }
+            x = x + b;
+        }
+        x = 10 * y + 99;
+        // step 5072
+        a = y;
+        a = 0 - y;
+    } else {
+        b = 3 - step8(x, b) - 80;
+        if (x < 52) {
+            a = 3 + x;
+            y = y + 13;
+            x = b;
+            x = 68;
+        }
+    }
+    b = step21(b) + 54 * b;
+    return 34;
+}
+
+let total = 0;
+total = total + step49(63, 13);
+total = total + step50(72, 84);
+total = total + step51(1);
+total = total + step52(49, 64);
+total = total + step53(27, 67);
+console.log(total);
@@ -0,0 +1,812 @@
+// step0: generated
+function step0(a) {
+    let x = 26 * a * a;
+    let y = 82;
+    y = x;
+    if (y < 27) {
+        // step 6
+        y = a;
+        // step 8
+        a = a;
+        // step 10
+        a = 61 - y;
+    } else {
+        x = 31 - 16 - 0;
+        // step 14
+        a = y;
+    }
+    a = y;
+    return x - y + 91;
+}
+
+// step1: generated
+function step1(a, b) {
+    let x = b;
+    let y = 33;
+    step0(b);
+    if (b < 5) {
+        // step 27
+        b = a;
+    } else {
+        a = x - 80 - x;
+    }
+    b = a - a * 94;
+    a = a - y;
+    return 24 + a;
+}
+
+// step2: generated
+function step2(a, b) {
+    let x = 83 - 71;
+    let y = 1;
+    // step 41
+    y = 90 * a * y;
+    if (x === 23) {
+        // step 44
+        a = a;
+        // step 46
+        a = step0(a) + step0(x);
+        // step 48
+        b = 27 - step0(a);
+    } else {
+        x = 80 + b - 14;
+        // step 52
+        a = 98;
+    }
+    for (let i1 = 0; i1 < 83; i1++) {
+        // step 56
+        i1 = a;
+        step0(y);
+        // step 59
+        i1 = b - 26 * 14;
+        b = 74 - b;
+    }
+    if (b < 10) {
+        step0(x);
+        // step 65
+        b = step0(b);
+        b = b + x;
+    }
+    if (y > 26) {
+        a = 25 - x;
+        step1(b, x);
+        step1(b, a);
+        // step 73
+        y = step0(x) + b * y;
+    } else {
+        // step 76
+        a = a - step0(y) - 62;
+        y = 28;
+        a = 49 + b;
+        a = y * y * step1(b, b);
+    }
+    for (let i1 = 0; i1 < 42; i1++) {
+        // step 83
+        b = x - y;
+        // step 85
+        i1 = a + 38 + 1;
+        // step 87
+        y = i1 * step0(a);
+        // step 89
+        i1 = x;
+    }
+    a = a * 76 - x;
+    step1(a, a);
+    return a;
+}
+
+// step3: generated
+function step3(a) {
+    let x = 21;
+    let y = 12;
+    y = 40 + 53 + x;
+    a = 8;
+    a = a - y;
+    if (a < 51) {
+        // step 105
+        x = a - y;
+        step0(x);
+    } else {
+        // step 109
+        a = a + a;
+        a = 75 + a;
+        // step 112
+        x = y;
+        // step 114
+        y = 12;
+    }
+    for (let i1 = 0; i1 < 75; i1++) {
+        // step 118
+        i1 = 15 - y;
+    }
+    y = x + 77 * 92;
+    return step1(y, x) - y;
+}
+
+// step4: generated
+function step4(a, b) {
+    let x = 17;
+    let y = 60;
+    if (y < 41) {
+        step3(x);
+        // step 131
+        y = 44;
+        step0(a);
+        // step 134
+        b = 6 + b * step3(x);
+    } else {
+        // step 137
+        a = x + y + 15;
+        // step 139
+        y = 92;
+        b = 44 * a;
+        y = a + 9;
+    }
+    step2(a, b);
+    b = 53;
+    y = b + step1(a, a) * 4;
+    a = y + a;
+    for (let i1 = 0; i1 < 88; i1++) {
+        // step 149
+        y = b * 87 + step1(a, b);
+        step3(x);
+        // step 152
+        x = 92 - i1 + y;
+        // step 154
+        b = 79 - 75 + i1;
+    }
+    a = a + y + step1(y, a);
+    b = 18 - step0(y) * step1(x, y);
+    return b * x + y;
+}
+
+// step5: generated
+function step5(a, b) {
+    let x = b - a;
+    let y = 32;
+    step0(x);
+    if (a > 86) {
+        // step 168
+        b = 64 + 60 - step1(b, y);
+    }
+    if (x === 25) {
+        // step 172
+        y = a;
+        step4(y, y);
+        x = x;
+        // step 176
+        y = x - y + 36;
+    }
+    // step 179
+    y = 73 - 47 * 61;
+    a = x + 49;
+    return 54;
+}
+
+// step6: generated
+function step6(a) {
+    let x = 28 * a;
+    let y = 1;
+    step3(a);
+    for (let i1 = 0; i1 < 89; i1++) {
+        // step 191
+        x = i1 * x;
+        i1 = i1;
+    }
+    x = 32 - a;
+    step4(x, y);
+    step3(y);
+    if (y < 11) {
+        // step 199
+        y = step2(y, y) * a;
+        step3(y);
+        // step 202
+        x = y;
+    } else {
+        a = a * a;
+        // step 206
+        a = x - x;
+        step2(a, x);
+        // step 209
+        y = x;
+    }
+    step5(x, y);
+    y = a + 45;
+    return x - 25 - 64;
+}
+
+// step7: generated
+function step7(a, b) {
+    let x = b - a * 55;
+    let y = 70;
+    step4(y, x);
+    if (b > 77) {
+        b = 25;
+        a = 71 - 80;
+    } else {
+        // step 226
+        a = step3(y) * step0(y);
+        // step 228
+        a = step6(x) - 52;
+        // step 230
+        x = 53 * 93 + step3(x);
+        // step 232
+        a = a;
+    }
+    for (let i1 = 0; i1 < 81; i1++) {
+        y = x + 31;
+        // step 237
+        a = i1;
+        i1 = 81;
+        // step 240
+        x = i1 + step1(a, b) * a;
+    }
+    step0(x);
+    step5(x, x);
+    b = x * step3(x);
+    if (a < 52) {
+        // step 247
+        b = a;
+        // step 249
+        a = 37;
+    } else {
+        // step 252
+        b = b - 2;
+        b = x + x;
+        step1(b, a);
+    }
+    if (a > 20) {
+        y = step5(b, b);
+        y = 29 + x;
+    } else {
+        // step 261
+        b = 47 - 36 - step2(y, b);
+        step6(b);
+        // step 264
+        x = 73 * step0(y);
+        // step 266
+        b = a - y;
+    }
+    return 83 * b;
+}
+
+// step8: generated
+function step8(a, b) {
+    let x = b * 89 * 79;
+    let y = 66;
+    step1(a, y);
+    // step 277
+    b = step0(a) - a - 17;
+    for (let i1 = 0; i1 < 96; i1++) {
+        // step 280
+        y = 20 + b * b;
+        // step 282
+        x = i1 + step1(y, b);
+        // step 284
+        a = 57;
+    }
+    if (b === 87) {
+        a = y + a;
+        // step 289
+        x = 14;
+        x = step1(a, a) - x;
+    }
+    for (let i1 = 0; i1 < 65; i1++) {
+        // step 294
+        i1 = step5(i1, i1) + 24 - x;
+        // step 296
+        b = i1 + a;
+        // step 298
+        x = b - a * 1;
+        // step 300
+        y = 9 - i1;
+    }
+    a = step6(b) - x - 30;
+    return y;
+}
+
+// step9: generated
+function step9(a) {
+    let x = a * 57 + a;
+    let y = 20;
+    if (y > 33) {
+        // step 312
+        a = x - 7 * a;
+        // step 314
+        x = x + 39;
+    }
+    step4(a, y);
+    // step 318
+    y = step4(x, y) + y * a;
+    return y - 1 + 74;
+}
+
+// step10: generated
+function step10(a, b) {
+    let x = a + b;
+    let y = 71;
+    y = step5(b, y) - 9;
+    for (let i1 = 0; i1 < 84; i1++) {
+        // step 329
+        a = 44 + 88;
+        a = y;
+        // step 332
+        i1 = 21;
+        // step 334
+        b = a + 20 * y;
+    }
+    for (let i1 = 0; i1 < 47; i1++) {
+        // step 338
+        b = 93 * step8(i1, x);
+    }
+    x = y * b - b;
+    return step9(x) * 41 - b;
+}
+
+// step11: generated
+function step11(a, b) {
+    let x = b;
+    let y = 59;
+    y = y + 91 - x;
+    if (y < 29) {
+        // step 351
+        x = x * 6;
+        b = 71 - y - x;
+    } else {
+        // step 355
+        x = 74;
+        step2(y, a);
+        x = b;
+    }
+    // step 360
+    b = x * 50 * b;
+    if (b > 15) {
+        // step 363
+        x = step2(y, y);
+        step0(a);
+        // step 366
+        a = 22 + x;
+    }
+    for (let i1 = 0; i1 < 20; i1++) {
+        y = step3(x) * step4(y, y);
+        // step 371
+        b = 35 - 38;
+        // step 373
+        y = b - y + y;
+        i1 = step5(x, y);
+    }
+    a = a;
+    return 55;
+}
+
+// step12: generated
+function step12(a) {
+    let x = 29;
+    let y = 9;
+    if (y === 36) {
+        a = step7(x, a);
+    }
+    step0(y);
+    a = y + 25;
+    y = y - 22 - a;
+    if (y > 98) {
+        a = 11 + y;
+    } else {
+        // step 394
+        x = y;
+        // step 396
+        y = a * a - y;
+        // step 398
+        x = y * y + x;
+    }
+    a = 67;
+    // step 402
+    a = step9(a) + x * a;
+    return 52 - y;
+}
+
+// step13: generated
+function step13(a, b) {
+    let x = 31 - b;
+    let y = 37;
+    x = y;
+    if (y === 97) {
+        step9(a);
+    }
+    for (let i1 = 0; i1 < 0; i1++) {
+        x = x;
+        x = b * 9 - b;
+    }
+    // step 419
+    a = x * y - 39;
+    step2(y, b);
+    return 99 * 0 + a;
+}
+
+// step14: generated
+function step14(a, b) {
+    let x = b - 65 - 98;
+    let y = 5;
+    b = step2(x, y);
+    // step 430
+    y = x + step9(a) - 13;
+    if (b === 70) {
+        // step 433
+        a = a * a * 25;
+    } else {
+        // step 436
+        b = step8(y, y) * 29;
+        // step 438
+        y = y * 5;
+        y = 81 + b;
+    }
+    if (a === 66) {
+        b = 56 * b;
+        // step 444
+        x = 50 - step5(b, y);
+    }
+    // step 447
+    x = 72;
+    if (y === 36) {
+        // step 450
+        b = b + a + b;
+        a = 29 * x + 31;
+    }
+    return a;
+}
+
+// step15: generated
+function step15(a) {
+    let x = a * a * 34;
+    let y = 62;
+    for (let i1 = 0; i1 < 76; i1++) {
+        // step 462
+        i1 = 41 + a - a;
+        step10(a, y);
+        // step 465
+        a = 79 + x;
+        // step 467
+        i1 = i1 - step8(y, i1);
+    }
+    step3(x);
+    if (y === 11) {
+        a = a;
+        x = 83 + a - x;
+    } else {
+        // step 475
+        y = 39 - step13(x, a);
+        x = a - 26;
+        y = a * step11(x, a) * 48;
+    }
+    y = 51 - x;
+    return x * x - step14(a, y);
+}
+
+// step16: generated
+function step16(a, b) {
+    let x = b * 34;
+    let y = 85;
+    b = y * 29;
+    a = y - x;
+    // step 490
+    a = y - y;
+    if (y === 58) {
+        // step 493
+        x = y;
+        step5(y, x);
+    }
+    step9(x);
+    return 2 - 56;
+}
+
+// step17: generated
+function step17(a, b) {
+    let x = 47 * a;
+    let y = 65;
+    // step 505
+    y = b;
+    step4(a, x);
+    for (let i1 = 0; i1 < 99; i1++) {
+        step14(a, a);
+    }
+    return 22 * 70 * step14(b, b);
+}
+
+// step18: generated
+function step18(a) {
+    let x = a * 35 + a;
+    let y = 27;
+    if (x > 51) {
+        // step 519
+        a = 94 - 42;
+        step12(x);
+        // step 522
+        y = step14(x, a);
+        a = 49 + 53;
+    }
+    if (x < 35) {
+        // step 527
+        y = x * 29 - y;
+        // step 529
+        x = 88 + y + a;
+        step16(a, a);
+    } else {
+        y = x;
+    }
+    x = 75 * step1(y, y) * a;
+    y = 20 + 25 * a;
+    a = 84 - a + a;
+    return 97 * x;
+}
+
+// step19: generated
+function step19(a, b) {
+    let x = a * 61;
+    let y = 8;
+    a = 42 + a;
+    // step 546
+    b = step4(a, b) - x + y;
+    for (let i1 = 0; i1 < 90; i1++) {
+        step5(y, x);
+    }
+    if (b < 24) {
+        step18(x);
+        // step 553
+        x = 44 * a;
+        b = a - a;
+    } else {
+        // step 557
+        y = x + a - step12(a);
+        b = y;
+        // step 560
+        y = a + a;
+    }
+    return x;
+}
+
+// step20: generated
+function step20(a, b) {
+    let x = 25 + a;
+    let y = 46;
+    step16(a, b);
+    if (b > 5) {
+        b = a * 46 * step18(x);
+        y = b;
+    } else {
+        a = 58 * y;
+        b = b + 41 - b;
+    }
+    if (b === 88) {
+        x = step6(a) - b * x;
+        // step 580
+        y = x * 58 + y;
+    } else {
+        // step 583
+        b = 89 * y * 1;
+        a = 0;
+    }
+    if (a < 54) {
+        y = 58;
+        step11(x, a);
+    } else {
+        // step 591
+        y = b + 13 * a;
+    }
+    // step 594
+    x = step1(y, b);
+    return 23 * 50 + step4(x, a);
+}
+
+// step21: generated
+function step21(a) {
+    let x = a;
+    let y = 78;
+    for (let i1 = 0; i1 < 19; i1++) {
+        // step 604
+        x = 65;
+    }
+    a = step5(a, a);
+    if (y > 51) {
+        step19(x, y);
+    }
+    if (y < 67) {
+        y = a * 46 + x;
+        // step 613
+        a = step13(a, y) * a + a;
+    } else {
+        // step 616
+        a = step3(x) - x;
+    }
+    a = 94 - x;
+    // step 620
+    y = a + 97 + 18;
+    return a - a * 61;
+}
+
+// step22: generated
+function step22(a, b) {
+    let x = b;
+    let y = 45;
+    step6(x);
+    for (let i1 = 0; i1 < 57; i1++) {
+        step16(y, a);
+        a = x - 83;
+        // step 633
+        i1 = a;
+        // step 635
+        a = y - b - y;
+    }
+    y = 10;
+    a = a * y;
+    for (let i1 = 0; i1 < 91; i1++) {
+        step14(b, a);
+        i1 = y - y - i1;
+    }
+    step1(a, b);
+    a = 19 * step3(x) - step5(a, y);
+    return step13(y, x) + 88 + x;
+}
+
+// step23: generated
+function step23(a, b) {
+    let x = a * a - a;
+    let y = 82;
+    // step 653
+    a = b + step22(a, a);
+    if (a < 22) {
+        // step 656
+        a = 66;
+        // step 658
+        a = 74 * step2(y, b);
+        b = a;
+        step0(x);
+    }
+    a = y + x * 75;
+    return 44 * 63 - x;
+}
+
+// step24: generated
+function step24(a) {
+    let x = a;
+    let y = 93;
+    y = 47 * x - 88;
+    step15(x);
+    a = x * 43;
+    if (y < 63) {
+        // step 675
+        a = y * x - x;
+        // step 677
+        a = 70;
+        y = 16 - a;
+    }
+    x = 40;
+    return x - a;
+}
+
+// step25: generated
+function step25(a, b) {
+    let x = b - 93 + 13;
+    let y = 4;
+    // step 689
+    b = x;
+    if (a < 31) {
+        // step 692
+        a = 98;
+        // step 694
+        x = step10(y, x) + 38 * 87;
+    } else {
+        step9(a);
+        // step 698
+        b = step20(y, a) * 74 * 82;
+        step1(b, b);
+    }
+    if (a === 60) {
+        b = 75 + x;
+    }
+    if (b === 86) {
+        // step 706
+        a = a - x * 51;
+        step13(a, x);
+        // step 709
+        a = b;
+        // step 711
+        a = b;
+    } else {
+        // step 714
+        y = 50;
+        b = b - 73;
+        b = 73 * b;
+        // step 718
+        a = x + x * x;
+    }
+    return x;
+}
+
+// step26: generated
+function step26(a, b) {
+    let x = b;
+    let y = 24;
+    b = x;
+    step17(x, y);
+    a = a;
+    y = 58 - step14(x, y) - 66;
+    if (x === 53) {
+        b = 83;
+        b = x - 72;
+        // step 735
+        b = a;
+    } else {
+        // step 738
+        a = 61 + b * 43;
+        // step 740
+        a = 70 - a;
+        step25(y, a);
+    }
+    a = step5(y, y) + step6(a) + a;
+    return y;
+}
+
+// step27: generated
+function step27(a) {
+    let x = 8 - a * a;
+    let y = 15;
+    if (x > 58) {
+        a = 47;
+    } else {
+        step6(y);
+        // step 756
+        x = step1(x, x) - 98 - step0(y);
+        // step 758
+        x = y * a;
+    }
+    x = 67 - a;
+    if (a < 49) {
+        // step 763
+        x = 86 + a;
+        // step 765
+        a = step10(y, a) - step11(y, y);
+        a = step1(y, a) + x * 78;
+        // step 768
+        y = x;
+    } else {
+        step2(a, y);
+        // step 772
+        y = 18 * y;
+        step26(x, y);
+    }
+    y = step18(y) + x;
+    return 43 - step12(x);
+}
+
+// step28: generated
+function step28(a, b) {
+    let x = a;
+    let y = 67;
+    if (y < 64) {
+        y = y - a;
+        y = b - x * 72;
+        y = 5 + y - b;
+        // step 788
+        a = step4(x, x) + step16(x, y);
+    } else {
+        // step 791
+        y = step12(x);
+        a = 3;
+        // step 794
+        y = a + y + b;
+        a = 46 - 81 - 7;
+    }
+    y = a;
+    y = 79;
+    // step 800
+    b = 81;
+    return x * b;
+}
+
+let total = 0;
+total = total + step24(43);
+total = total + step25(46, 51);
+total = total + step26(91, 70);
+total = total + step27(78);
+total = total + step28(89, 99);
+console.log(total);
@@ -0,0 +1,1010 @@
+// step0: generated
+function step0(a) {
+    let x = a + a + 98;
+    let y = 84;
+    x = a - 23;
+    // step 5
+    y = 81 - x;
+    for (let i1 = 0; i1 < 35; i1++) {
+        a = y;
+        if (a < 75) {
+            a = y * 81 + a;
+            if (x === 63) {
+                if (x === 55) {
+                    x = y + y * x;
+                    a = y - a;
+                } else {
+                    // step 16
+                    i1 = y;
+                    // step 18
+                    x = a + x;
+                }
+            } else {
+                x = 70 * 8;
+            }
+            if (x === 83) {
+                for (let i4 = 0; i4 < 51; i4++) {
+                    i4 = a + 4 * y;
+                }
+            } else {
+                if (x < 21) {
+                    // step 30
+                    a = a * 17 + 9;
+                }
+            }
+        }
+        if (x === 23) {
+            i1 = 67;
+            y = y;
+        } else {
+            for (let i3 = 0; i3 < 76; i3++) {
+                a = a + x;
+            }
+            if (i1 > 36) {
+                if (i1 === 80) {
+                    // step 44
+                    x = a + a * i1;
+                    x = 48 + 53;
+                } else {
+                    // step 48
+                    a = 71 - y + 25;
+                }
+                i1 = 94 + 2 + y;
+            }
+            y = x - 2;
+        }
+    }
+    a = x - 66;
+    if (x > 23) {
+        // step 58
+        y = 53 + y - 90;
+        x = a - y;
+        for (let i2 = 0; i2 < 16; i2++) {
+            a = a;
+            y = 60 - i2 * y;
+        }
+        y = a - 32;
+    }
+    a = y;
+    return 60 - y;
+}
+
+// step1: generated
+function step1(a, b) {
+    let x = a + a * 69;
+    let y = 45;
+    for (let i1 = 0; i1 < 32; i1++) {
+        if (a > 6) {
+            // step 77
+            a = step0(b) * 27;
+        } else {
+            step0(a);
+            step0(x);
+            step0(i1);
+            if (a === 35) {
+                step0(i1);
+            } else {
+                i1 = 23 - 13 * i1;
+                if (b < 59) {
+                    // step 88
+                    y = step0(b);
+                    step0(i1);
+                }
+            }
+        }
+        i1 = 73 + 79 * x;
+        for (let i2 = 0; i2 < 14; i2++) {
+            if (b > 37) {
+                for (let i4 = 0; i4 < 40; i4++) {
+                    // step 98
+                    b = step0(x);
+                }
+            } else {
+                if (i1 > 24) {
+                    step0(x);
+                    i2 = step0(x) * i2;
+                }
+                b = 81 + b * step0(y);
+            }
+        }
+        i1 = y;
+    }
+    if (a === 47) {
+        b = b;
+        if (x > 35) {
+            if (a === 76) {
+                for (let i4 = 0; i4 < 34; i4++) {
+                    // step 116
+                    i4 = x * 43 * x;
+                    i4 = i4 + x * x;
+                }
+                if (b < 78) {
+                    step0(x);
+                } else {
+                    // step 123
+                    b = 84 + y;
+                }
+                a = y * 39 - 42;
+            }
+            step0(a);
+        } else {
+            x = a * step0(x) - step0(b);
+            if (b > 77) {
+                b = 94;
+            }
+            if (a === 13) {
+                step0(y);
+            } else {
+                // step 137
+                y = x + x;
+            }
+            // step 140
+            x = a + 57 * 74;
+        }
+        // step 143
+        a = 57 - x - y;
+    } else {
+        step0(y);
+        for (let i2 = 0; i2 < 12; i2++) {
+            step0(y);
+        }
+    }
+    for (let i1 = 0; i1 < 9; i1++) {
+        step0(i1);
+        b = y * step0(i1);
+        for (let i2 = 0; i2 < 9; i2++) {
+            if (x === 19) {
+                for (let i4 = 0; i4 < 39; i4++) {
+                    i1 = i4 * 98;
+                }
+                // step 159
+                i2 = a + 34 - i1;
+            } else {
+                if (i1 < 44) {
+                    // step 163
+                    a = a;
+                    i2 = 70;
+                    b = a * a;
+                } else {
+                    // step 168
+                    b = i1;
+                }
+                y = 32 + a * 37;
+            }
+        }
+        for (let i2 = 0; i2 < 37; i2++) {
+            if (a > 71) {
+                if (i1 === 25) {
+                    y = 62;
+                    step0(i2);
+                    // step 179
+                    x = step0(x) * a;
+                } else {
+                    step0(x);
+                }
+            } else {
+                step0(y);
+                step0(i2);
+            }
+            y = i1 - 52 * y;
+        }
+    }
+    if (b > 64) {
+        if (a < 45) {
+            for (let i3 = 0; i3 < 27; i3++) {
+                // step 194
+                y = 93 - 63 - step0(i3);
+            }
+        }
+        // step 198
+        y = 58 - 52;
+        a = a + 43;
+    }
+    if (x === 11) {
+        // step 203
+        a = 57 - x;
+        step0(y);
+    }
+    step0(x);
+    b = step0(x) + 75;
+    y = x * 55 - y;
+    return y * b * b;
+}
+
+// step2: generated
+function step2(a, b) {
+    let x = 21;
+    let y = 50;
+    if (b === 63) {
+        a = 75;
+        if (x === 32) {
+            step1(b, x);
+            step0(b);
+        } else {
+            // step 223
+            a = 62 - 29 * y;
+            x = y * a;
+            y = b * 75;
+            if (x < 18) {
+                if (y < 44) {
+                    step0(x);
+                }
+            } else {
+                if (b > 35) {
+                    step0(x);
+                    b = 88 * x;
+                } else {
+                    step1(a, b);
+                    step1(y, b);
+                }
+            }
+        }
+    } else {
+        for (let i2 = 0; i2 < 24; i2++) {
+            for (let i3 = 0; i3 < 16; i3++) {
+                // step 244
+                y = step0(a) * 68;
+                if (b === 39) {
+                    // step 247
+                    i3 = 3 + i2 - x;
+                    // step 249
+                    x = 93 - step1(a, i3);
+                    // step 251
+                    a = 62 - i2;
+                }
+            }
+            for (let i3 = 0; i3 < 91; i3++) {
+                for (let i4 = 0; i4 < 62; i4++) {
+                    // step 257
+                    i3 = i4 + i2;
+                }
+                for (let i4 = 0; i4 < 40; i4++) {
+                    // step 261
+                    b = 49 - i2 - x;
+                    // step 263
+                    i3 = i3 - y - x;
+                }
+            }
+            if (x === 91) {
+                // step 268
+                y = 28 + 59 * y;
+                // step 270
+                b = 96;
+            }
+            // step 273
+            y = 17 + step1(x, a);
+        }
+    }
+    if (x < 54) {
+        if (b < 2) {
+            for (let i3 = 0; i3 < 79; i3++) {
+                i3 = x - 33;
+            }
+            x = 91 + x;
+            if (y > 62) {
+                if (x < 56) {
+                    b = x + b * 84;
+                    step1(x, b);
+                }
+                x = 41 * x;
+            } else {
+                b = b + x;
+                y = x + a;
+            }
+            for (let i3 = 0; i3 < 46; i3++) {
+                if (b > 28) {
+                    y = i3 + x - 35;
+                }
+            }
+        } else {
+            for (let i3 = 0; i3 < 45; i3++) {
+                if (i3 > 57) {
+                    // step 301
+                    y = 84;
+                } else {
+                    // step 304
+                    a = a * 13;
+                    // step 306
+                    i3 = 58;
+                    b = b;
+                }
+            }
+        }
+        if (b < 24) {
+            b = 24 * y - 71;
+            if (a > 97) {
+                // step 315
+                b = a;
+            } else {
+                a = 43 - y;
+                if (b < 51) {
+                    // step 320
+                    a = 10 * b + a;
+                    x = b;
+                } else {
+                    // step 324
+                    b = 17 * b;
+                }
+            }
+            for (let i3 = 0; i3 < 39; i3++) {
+                for (let i4 = 0; i4 < 80; i4++) {
+                    // step 330
+                    i3 = a + x + step1(x, i4);
+                }
+            }
+            y = y;
+        }
+        x = 93 - step1(b, a) + a;
+        b = 77 + 17;
+    }
+    if (a === 97) {
+        if (a === 71) {
+            x = a + 61;
+            if (x === 29) {
+                a = 5 * y;
+                if (a < 68) {
+                    // step 345
+                    a = 75 + b;
+                }
+            } else {
+                if (x < 42) {
+                    // step 350
+                    a = y + step1(b, y) * step0(b);
+                    y = 9;
+                    // step 353
+                    x = 3 * b;
+                }
+                step0(a);
+                a = step0(x) + b + b;
+            }
+        }
+        x = y - 60;
+        step0(a);
+    }
+    b = x * a * step1(y, x);
+    step0(a);
+    // step 365
+    x = y;
+    b = step1(b, x) + b - 35;
+    b = 20;
+    return 53;
+}
+
+// step3: generated
+function step3(a) {
+    let x = a * 17 + 22;
+    let y = 90;
+    x = y;
+    for (let i1 = 0; i1 < 82; i1++) {
+        for (let i2 = 0; i2 < 8; i2++) {
+            for (let i3 = 0; i3 < 60; i3++) {
+                // step 380
+                i3 = 31;
+                i3 = x;
+            }
+            step1(i2, i1);
+            // step 385
+            i2 = 49;
+        }
+        if (i1 < 88) {
+            if (a === 56) {
+                // step 390
+                x = step1(x, y);
+            } else {
+                if (i1 > 82) {
+                    // step 394
+                    a = y - i1 - y;
+                }
+                for (let i4 = 0; i4 < 39; i4++) {
+                    y = 4 + a;
+                }
+            }
+            if (a < 75) {
+                if (a > 34) {
+                    // step 403
+                    x = 74 * i1;
+                    // step 405
+                    a = 6 * y;
+                    // step 407
+                    y = 63;
+                } else {
+                    // step 410
+                    y = 13 - a;
+                }
+            } else {
+                for (let i4 = 0; i4 < 62; i4++) {
+                    // step 415
+                    x = i1;
+                }
+                if (y < 3) {
+                    a = a - 71 + step1(i1, y);
+                    step2(a, x);
+                    step2(x, y);
+                }
+                step0(i1);
+            }
+            if (x > 46) {
+                x = i1;
+                for (let i4 = 0; i4 < 2; i4++) {
+                    // step 428
+                    y = step0(i1);
+                    step0(a);
+                }
+            } else {
+                y = 40 + 25 - 87;
+            }
+            y = 13;
+        } else {
+            if (a > 97) {
+                step0(y);
+                if (y > 21) {
+                    // step 440
+                    i1 = y * 84;
+                } else {
+                    x = step1(x, i1) + x;
+                }
+                step1(a, a);
+            } else {
+                // step 447
+                y = 24 + x + 32;
+                if (y > 87) {
+                    // step 450
+                    x = step0(a);
+                    step0(i1);
+                    // step 453
+                    y = x - i1 * 93;
+                }
+                step1(a, x);
+            }
+            // step 458
+            a = a;
+            step2(i1, a);
+        }
+        // step 462
+        y = x - 87 * 25;
+    }
+    y = a;
+    return step2(x, y) * y - x;
+}
+
+// step4: generated
+function step4(a, b) {
+    let x = a + b;
+    let y = 51;
+    a = a;
+    for (let i1 = 0; i1 < 34; i1++) {
+        // step 475
+        a = 63;
+    }
+    a = 77 + y;
+    for (let i1 = 0; i1 < 79; i1++) {
+        step0(y);
+    }
+    if (b === 88) {
+        if (y > 78) {
+            for (let i3 = 0; i3 < 93; i3++) {
+                step3(x);
+                y = i3;
+            }
+        }
+        if (x < 76) {
+            if (b < 34) {
+                a = 87 + 96;
+            } else {
+                if (b === 18) {
+                    // step 494
+                    y = 37 + y;
+                }
+            }
+        }
+        step3(b);
+    } else {
+        for (let i2 = 0; i2 < 6; i2++) {
+            x = 62 + x - a;
+            x = 80 + step2(x, x) - 9;
+            if (y > 53) {
+                for (let i4 = 0; i4 < 64; i4++) {
+                    step2(i2, y);
+                    step0(y);
+                    y = 37 * 39;
+                }
+                a = b * 80 * step0(b);
+            }
+        }
+    }
+    y = step0(y) + 34 + x;
+    if (b < 76) {
+        for (let i2 = 0; i2 < 36; i2++) {
+            step1(a, x);
+        }
+        for (let i2 = 0; i2 < 26; i2++) {
+            // step 520
+            x = x;
+            if (b === 84) {
+                for (let i4 = 0; i4 < 78; i4++) {
+                    // step 524
+                    x = y * 21 + i4;
+                    b = y - y;
+                }
+            } else {
+                // step 529
+                x = x * step0(b) + 42;
+            }
+            for (let i3 = 0; i3 < 33; i3++) {
+                for (let i4 = 0; i4 < 55; i4++) {
+                    // step 534
+                    b = y + 39;
+                }
+            }
+            step2(b, x);
+        }
+        step0(a);
+        b = y;
+    }
+    y = 62;
+    return b;
+}
+
+// step5: generated
+function step5(a, b) {
+    let x = b + a;
+    let y = 2;
+    step0(a);
+    // step 552
+    y = a;
+    // step 554
+    a = x * y;
+    // step 556
+    y = 29 - y + 32;
+    step0(y);
+    step0(a);
+    return b + 26;
+}
+
+// step6: generated
+function step6(a) {
+    let x = a + a + 67;
+    let y = 27;
+    if (x === 58) {
+        a = x * a;
+        for (let i2 = 0; i2 < 84; i2++) {
+            for (let i3 = 0; i3 < 5; i3++) {
+                // step 571
+                i3 = i3 * 34 - 44;
+            }
+            if (a < 83) {
+                a = i2 * i2;
+            }
+            // step 577
+            i2 = i2 + y * x;
+        }
+        a = 76 + a + a;
+        if (a > 10) {
+            step0(y);
+            y = 76 + a + step0(y);
+            if (x < 14) {
+                if (a < 86) {
+                    step4(a, y);
+                } else {
+                    // step 588
+                    x = 46 - y;
+                    step1(x, a);
+                }
+                x = 77;
+                if (x < 90) {
+                    // step 594
+                    x = a + 87;
+                } else {
+                    x = step0(y);
+                }
+            } else {
+                x = step3(x) + step5(y, a);
+                step0(a);
+                x = x + 43;
+            }
+            if (x > 8) {
+                y = 93;
+            }
+        }
+    } else {
+        // step 609
+        a = x - 42;
+    }
+    if (a === 20) {
+        if (y > 56) {
+            y = 9 + 64 - 79;
+            x = a;
+            for (let i3 = 0; i3 < 89; i3++) {
+                a = 20;
+            }
+            a = a;
+        } else {
+            if (a < 67) {
+                step5(x, y);
+            }
+            for (let i3 = 0; i3 < 66; i3++) {
+                step5(y, y);
+                step5(i3, y);
+            }
+            for (let i3 = 0; i3 < 76; i3++) {
+                if (a === 44) {
+                    step1(i3, y);
+                }
+            }
+            if (a === 21) {
+                // step 634
+                a = x;
+            } else {
+                y = step1(x, x) - 56;
+            }
+        }
+        y = y * 91 - x;
+        step2(a, x);
+        if (x === 90) {
+            if (x > 19) {
+                if (x < 16) {
+                    step0(y);
+                } else {
+                    // step 647
+                    y = 32 - 37 - x;
+                    // step 649
+                    a = x - step4(x, a);
+                }
+                step5(a, a);
+            } else {
+                for (let i4 = 0; i4 < 27; i4++) {
+                    // step 655
+                    y = 31 + i4;
+                    i4 = 2;
+                    // step 658
+                    a = x - a * 7;
+                }
+            }
+            for (let i3 = 0; i3 < 32; i3++) {
+                for (let i4 = 0; i4 < 15; i4++) {
+                    // step 664
+                    x = step4(i3, i4);
+                }
+                if (y > 10) {
+                    // step 668
+                    i3 = y * 76 - x;
+                } else {
+                    y = 27;
+                }
+            }
+        } else {
+            step5(x, a);
+        }
+    }
+    x = a - 0 - step3(x);
+    step3(a);
+    x = y;
+    if (a > 76) {
+        y = 32 - a;
+    } else {
+        // step 684
+        y = x;
+        if (x < 9) {
+            x = x * a;
+            a = 68 * x - a;
+            y = y + a;
+            if (y < 72) {
+                step2(x, a);
+            }
+        } else {
+            for (let i3 = 0; i3 < 64; i3++) {
+                if (a < 85) {
+                    // step 696
+                    y = x;
+                }
+            }
+            a = y - x - y;
+        }
+        for (let i2 = 0; i2 < 30; i2++) {
+            // step 703
+            a = 83 + 67;
+            for (let i3 = 0; i3 < 3; i3++) {
+                for (let i4 = 0; i4 < 24; i4++) {
+                    i4 = 23;
+                }
+                for (let i4 = 0; i4 < 9; i4++) {
+                    x = step3(i3);
+                }
+            }
+            step0(x);
+            if (x > 43) {
+                x = a;
+            }
+        }
+    }
+    return a;
+}
+
+// step7: generated
+function step7(a, b) {
+    let x = 4;
+    let y = 68;
+    for (let i1 = 0; i1 < 77; i1++) {
+        step6(a);
+    }
+    b = 71 + 97 + 11;
+    if (y > 83) {
+        if (y > 0) {
+            for (let i3 = 0; i3 < 55; i3++) {
+                if (y < 18) {
+                    // step 734
+                    b = a - i3 - y;
+                }
+            }
+            for (let i3 = 0; i3 < 63; i3++) {
+                step1(y, b);
+                i3 = i3;
+            }
+            x = x;
+        }
+        a = y;
+        if (b < 36) {
+            step1(a, x);
+        } else {
+            if (x < 31) {
+                if (a === 66) {
+                    // step 750
+                    x = a;
+                    a = a - a;
+                    b = y - x;
+                }
+            }
+            x = 18 - a;
+        }
+    } else {
+        a = a;
+        // step 760
+        y = y;
+        if (x > 29) {
+            // step 763
+            y = b;
+            y = b;
+            if (x > 33) {
+                step3(b);
+            } else {
+                if (y === 35) {
+                    // step 770
+                    b = y * 62 * b;
+                    y = 72;
+                    b = x + b + 66;
+                } else {
+                    a = x + y - b;
+                }
+            }
+            // step 778
+            y = 21;
+        }
+    }
+    x = a;
+    step3(b);
+    return x + b;
+}
+
+// step8: generated
+function step8(a, b) {
+    let x = 51 - 88 - a;
+    let y = 19;
+    for (let i1 = 0; i1 < 55; i1++) {
+        step3(i1);
+        if (b === 16) {
+            for (let i3 = 0; i3 < 54; i3++) {
+                if (b > 97) {
+                    // step 796
+                    a = x - x + 60;
+                    step3(i3);
+                } else {
+                    step4(i3, i3);
+                }
+            }
+            step3(i1);
+            step0(x);
+            step4(x, i1);
+        } else {
+            if (y === 17) {
+                a = step4(a, x) - step1(b, b);
+                // step 809
+                i1 = step1(b, x);
+            }
+        }
+        // step 813
+        b = 2 + step4(x, b) - 84;
+        a = 83 - a;
+    }
+    if (y < 98) {
+        step4(a, a);
+    } else {
+        y = 36 * a + step5(b, x);
+        step2(b, x);
+    }
+    a = x - x;
+    for (let i1 = 0; i1 < 5; i1++) {
+        if (b === 30) {
+            i1 = b - step4(a, y);
+            // step 827
+            b = a * 90 - 68;
+            x = step3(a) - y;
+            for (let i3 = 0; i3 < 79; i3++) {
+                if (i3 > 99) {
+                    b = 78 + step3(y);
+                    // step 833
+                    a = 36 + a;
+                }
+                for (let i4 = 0; i4 < 57; i4++) {
+                    // step 837
+                    b = 69 - i1;
+                    // step 839
+                    i4 = a * i3 - 30;
+                }
+                x = x * y;
+            }
+        } else {
+            step5(i1, a);
+        }
+        if (b < 48) {
+            step6(i1);
+        } else {
+            if (y < 8) {
+                if (a < 53) {
+                    // step 852
+                    b = x;
+                    // step 854
+                    x = i1;
+                    // step 856
+                    y = step3(x);
+                } else {
+                    step3(x);
+                }
+                if (x > 71) {
+                    // step 862
+                    b = x * x * 54;
+                    y = i1 * a;
+                    a = 26;
+                }
+            }
+            if (x < 69) {
+                step0(y);
+            }
+        }
+    }
+    for (let i1 = 0; i1 < 82; i1++) {
+        for (let i2 = 0; i2 < 16; i2++) {
+            a = 54 * a * 32;
+            y = step2(x, a);
+            a = step6(i1) + y - step3(x);
+            if (y > 60) {
+                i2 = 91 + 24;
+                a = b + 20;
+                for (let i4 = 0; i4 < 31; i4++) {
+                    // step 882
+                    x = i1 * step2(a, x) + a;
+                    // step 884
+                    i4 = a - 57;
+                    // step 886
+                    y = 99 + b;
+                }
+            }
+        }
+        if (y === 98) {
+            step0(a);
+            a = x + step4(x, a);
+            i1 = 28 * y;
+        } else {
+            step1(i1, a);
+        }
+        if (y < 55) {
+            // step 899
+            b = x + step3(x);
+        } else {
+            for (let i3 = 0; i3 < 48; i3++) {
+                step1(x, i3);
+                for (let i4 = 0; i4 < 22; i4++) {
+                    // step 905
+                    a = i4 - 88;
+                }
+                for (let i4 = 0; i4 < 29; i4++) {
+                    i4 = i3;
+                }
+            }
+            for (let i3 = 0; i3 < 48; i3++) {
+                if (x < 63) {
+                    a = b - y;
+                    // step 915
+                    y = 34 + b;
+                    // step 917
+                    i1 = 9;
+                }
+            }
+            if (i1 < 44) {
+                y = 30 + i1;
+            }
+            step6(x);
+        }
+    }
+    if (b === 10) {
+        if (b > 72) {
+            x = 46;
+        } else {
+            y = x + 41 - 77;
+            a = x;
+            if (a === 77) {
+                y = y - a;
+            } else {
+                for (let i4 = 0; i4 < 43; i4++) {
+                    y = i4 + x;
+                    y = step1(b, i4);
+                    x = 97;
+                }
+            }
+        }
+        if (b > 15) {
+            for (let i3 = 0; i3 < 59; i3++) {
+                for (let i4 = 0; i4 < 91; i4++) {
+                    step4(i4, x);
+                    x = 59;
+                }
+            }
+            step0(x);
+        } else {
+            for (let i3 = 0; i3 < 94; i3++) {
+                if (y === 5) {
+                    // step 954
+                    y = i3 + b + 37;
+                    // step 956
+                    b = x + x;
+                    step4(x, a);
+                } else {
+                    // step 960
+                    y = 40 * x;
+                }
+                step3(b);
+                step5(a, i3);
+            }
+            b = y;
+        }
+        for (let i2 = 0; i2 < 10; i2++) {
+            if (x > 95) {
+                // step 970
+                b = 75 + step3(a) * x;
+            }
+            if (x < 62) {
+                step2(b, i2);
+                y = 14;
+            } else {
+                i2 = x - x - 3;
+                step5(x, b);
+                b = b;
+            }
+            step3(y);
+            if (x > 68) {
+                for (let i4 = 0; i4 < 5; i4++) {
+                    x = i4 - i2;
+                }
+            } else {
+                if (i2 < 65) {
+                    // step 988
+                    a = a * y - i2;
+                    // step 990
+                    y = 32;
+                    // step 992
+                    y = a * a;
+                }
+            }
+        }
+    }
+    // step 998
+    y = 51 + y;
+    return 98 - x;
+}
+
+let total = 0;
+total = total + step4(31, 28);
+total = total + step5(90, 83);
+total = total + step6(91);
+total = total + step7(9, 88);
+total = total + step8(54, 78);
+console.log(total);
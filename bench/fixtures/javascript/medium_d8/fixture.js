@@ -0,0 +1,847 @@
+// step0: generated
+function step0(a) {
+    let x = 23;
+    let y = 70;
+    a = y;
+    if (x > 61) {
+        a = a + x;
+    } else {
+        a = 10 - a;
+        y = y;
+        // step 10
+        x = 40 + 75 - a;
+        // step 12
+        a = 7 + y - x;
+    }
+    if (a < 21) {
+        for (let i2 = 0; i2 < 4; i2++) {
+            a = x + i2;
+            i2 = y - 39;
+            x = a * a;
+            i2 = i2;
+        }
+        // step 22
+        y = 47 * a + 73;
+    } else {
+        a = 52 * 85 + x;
+    }
+    if (x > 70) {
+        x = y + 24 * x;
+        if (a > 45) {
+            if (a < 57) {
+                a = x + x * x;
+                for (let i4 = 0; i4 < 36; i4++) {
+                    x = 38;
+                    y = 25 - a;
+                    if (x === 68) {
+                        if (a > 59) {
+                            i4 = x * i4;
+                        } else {
+                            if (i4 === 8) {
+                                i4 = a;
+                                for (let i8 = 0; i8 < 14; i8++) {
+                                    y = 60 - 63 * i8;
+                                }
+                            }
+                            if (i4 === 86) {
+                                i4 = x + i4;
+                            } else {
+                                if (a > 89) {
+                                    // step 49
+                                    y = 37;
+                                    // step 51
+                                    y = y * i4;
+                                } else {
+                                    i4 = a;
+                                }
+                            }
+                        }
+                        // step 58
+                        y = i4;
+                    }
+                }
+            }
+            x = a - 34;
+        }
+        for (let i2 = 0; i2 < 66; i2++) {
+            x = i2;
+            for (let i3 = 0; i3 < 11; i3++) {
+                if (y < 24) {
+                    if (x < 98) {
+                        y = 39 * y;
+                    }
+                } else {
+                    if (x === 1) {
+                        x = i3 * y;
+                    } else {
+                        for (let i6 = 0; i6 < 86; i6++) {
+                            for (let i7 = 0; i7 < 82; i7++) {
+                                a = i6 + a;
+                            }
+                        }
+                    }
+                }
+            }
+            x = 15 - a * i2;
+            x = x;
+        }
+        if (y > 13) {
+            a = x - a;
+            y = a - 32 + a;
+            a = 43 * a;
+            a = x;
+        }
+    } else {
+        if (x > 40) {
+            // step 95
+            a = a + 60;
+        }
+    }
+    x = 9 * 60;
+    for (let i1 = 0; i1 < 59; i1++) {
+        for (let i2 = 0; i2 < 32; i2++) {
+            y = a + a * x;
+            if (i2 < 80) {
+                y = i1;
+                if (y === 41) {
+                    for (let i5 = 0; i5 < 12; i5++) {
+                        i1 = 92 - y;
+                    }
+                } else {
+                    y = i1 + a * 20;
+                }
+                x = a + a;
+            } else {
+                a = i2 - 23 - a;
+                if (i1 > 89) {
+                    // step 116
+                    i1 = 92;
+                }
+                for (let i4 = 0; i4 < 62; i4++) {
+                    i1 = 6;
+                    if (i4 < 88) {
+                        i1 = a;
+                        i4 = 3 * 33 - i2;
+                        x = i4 * y - 67;
+                    }
+                }
+            }
+            i1 = 23 * x;
+        }
+        y = a;
+    }
+    return y - y - y;
+}
+
+// step1: generated
+function step1(a, b) {
+    let x = a - a;
+    let y = 96;
+    b = x;
+    x = a;
+    if (x < 49) {
+        for (let i2 = 0; i2 < 9; i2++) {
+            i2 = 40 + 25;
+            b = i2;
+        }
+        // step 146
+        b = b;
+        if (y === 34) {
+            if (b < 22) {
+                for (let i4 = 0; i4 < 89; i4++) {
+                    for (let i5 = 0; i5 < 85; i5++) {
+                        step0(i4);
+                        step0(i5);
+                    }
+                }
+            } else {
+                // step 157
+                b = 29 - 60;
+                a = 19;
+                step0(b);
+            }
+            for (let i3 = 0; i3 < 19; i3++) {
+                // step 163
+                x = b * x;
+            }
+        } else {
+            b = 87;
+            a = x * y;
+            for (let i3 = 0; i3 < 52; i3++) {
+                y = i3 * b + b;
+                if (x > 97) {
+                    if (i3 < 5) {
+                        if (y === 24) {
+                            for (let i7 = 0; i7 < 59; i7++) {
+                                if (b > 10) {
+                                    step0(a);
+                                }
+                            }
+                        } else {
+                            for (let i7 = 0; i7 < 17; i7++) {
+                                for (let i8 = 0; i8 < 34; i8++) {
+                                    i8 = i8;
+                                }
+                            }
+                        }
+                    }
+                } else {
+                    step0(b);
+                }
+            }
+        }
+        step0(b);
+    }
+    x = step0(x) - step0(y);
+    x = step0(b) - step0(b) - step0(b);
+    // step 196
+    y = 13 + 3;
+    if (b < 87) {
+        if (b < 80) {
+            if (a === 5) {
+                if (b > 46) {
+                    for (let i5 = 0; i5 < 59; i5++) {
+                        if (x === 22) {
+                            step0(a);
+                            a = 60 - a;
+                        }
+                        for (let i6 = 0; i6 < 65; i6++) {
+                            for (let i7 = 0; i7 < 57; i7++) {
+                                if (y > 68) {
+                                    // step 210
+                                    a = a - i5 - a;
+                                } else {
+                                    y = b;
+                                }
+                            }
+                        }
+                        if (y === 97) {
+                            for (let i7 = 0; i7 < 98; i7++) {
+                                a = 79 * 55 - b;
+                                for (let i8 = 0; i8 < 23; i8++) {
+                                    // step 221
+                                    x = step0(b) - step0(i8);
+                                }
+                            }
+                        }
+                    }
+                    if (y < 14) {
+                        // step 228
+                        x = 57 - b * 22;
+                        a = y;
+                    }
+                    if (b < 89) {
+                        if (b > 14) {
+                            y = 91;
+                        } else {
+                            x = step0(y) * y;
+                            if (x > 99) {
+                                if (a === 84) {
+                                    y = step0(b);
+                                    x = b + step0(b) * x;
+                                }
+                                step0(a);
+                            }
+                        }
+                    } else {
+                        // step 246
+                        a = step0(x) + a * step0(a);
+                        y = y + 16;
+                        if (x > 16) {
+                            a = b + b;
+                        } else {
+                            if (b < 97) {
+                                step0(b);
+                            } else {
+                                step0(y);
+                            }
+                            if (y > 74) {
+                                // step 258
+                                x = step0(x) - 28 * x;
+                            }
+                        }
+                    }
+                } else {
+                    x = 99 - x;
+                    a = 48 - 43 + 81;
+                }
+            }
+            for (let i3 = 0; i3 < 61; i3++) {
+                step0(y);
+            }
+        }
+        y = a - x;
+    } else {
+        if (b < 65) {
+            y = 36 - 80 + a;
+            step0(b);
+            a = a - a;
+        } else {
+            a = x;
+            for (let i3 = 0; i3 < 54; i3++) {
+                y = step0(x) - x;
+                if (i3 === 97) {
+                    i3 = b * y;
+                }
+                if (x === 11) {
+                    if (x === 10) {
+                        y = a + step0(x) - y;
+                    }
+                }
+            }
+        }
+        // step 292
+        b = 66 - a;
+        step0(b);
+        if (b < 70) {
+            if (x > 25) {
+                for (let i4 = 0; i4 < 23; i4++) {
+                    // step 298
+                    b = i4;
+                }
+                y = step0(a);
+                for (let i4 = 0; i4 < 72; i4++) {
+                    step0(y);
+                    i4 = y;
+                }
+            }
+            step0(b);
+            b = a;
+        } else {
+            if (x > 85) {
+                x = 58 - 77;
+            }
+            step0(b);
+            y = 22 * step0(a);
+        }
+    }
+    return step0(x);
+}
+
+// step2: generated
+function step2(a, b) {
+    let x = a - b - a;
+    let y = 33;
+    if (a > 57) {
+        a = x;
+        for (let i2 = 0; i2 < 44; i2++) {
+            step1(i2, b);
+            a = i2 + 95;
+            // step 329
+            i2 = step1(b, x);
+            for (let i3 = 0; i3 < 35; i3++) {
+                for (let i4 = 0; i4 < 7; i4++) {
+                    step0(a);
+                    a = i4 * i3 - 35;
+                }
+            }
+        }
+    } else {
+        a = x + b;
+        if (x < 95) {
+            // step 341
+            y = step0(b);
+            // step 343
+            b = b + step1(b, a);
+        }
+    }
+    if (y > 39) {
+        step0(a);
+    }
+    a = 27 - x;
+    step0(a);
+    for (let i1 = 0; i1 < 27; i1++) {
+        step0(x);
+        if (b === 57) {
+            i1 = 72 * 83 - step1(a, b);
+            for (let i3 = 0; i3 < 31; i3++) {
+                // step 357
+                i1 = i1 * 12 - 70;
+                // step 359
+                x = step0(x) * 85 * i1;
+            }
+        } else {
+            step1(y, i1);
+            if (b < 57) {
+                if (i1 > 62) {
+                    // step 366
+                    b = y - x * i1;
+                    i1 = a * 59;
+                    if (x > 4) {
+                        b = b - b;
+                        i1 = step1(b, y) - a + 37;
+                    }
+                }
+            }
+            a = 43;
+            for (let i3 = 0; i3 < 37; i3++) {
+                x = a;
+            }
+        }
+    }
+    y = 24;
+    return step1(x, a) + y - b;
+}
+
+// step3: generated
+function step3(a) {
+    let x = a + a;
+    let y = 69;
+    // step 389
+    y = step2(y, x) + a;
+    if (x > 12) {
+        if (x === 6) {
+            if (x < 20) {
+                a = a * 24;
+                // step 395
+                a = y - a * a;
+                if (a === 71) {
+                    // step 398
+                    y = step1(x, x);
+                    step1(a, x);
+                } else {
+                    x = 87 - a + a;
+                    x = a;
+                    y = step2(a, x) - step1(x, y);
+                }
+            }
+            a = 83 - x * a;
+        }
+        if (a < 16) {
+            step2(y, a);
+            if (a > 18) {
+                y = step0(y) + y;
+                // step 413
+                a = y;
+                if (a < 76) {
+                    if (x > 44) {
+                        step1(x, a);
+                    }
+                }
+            } else {
+                // step 421
+                x = x + a;
+            }
+        }
+        for (let i2 = 0; i2 < 76; i2++) {
+            if (y < 35) {
+                x = a - y + i2;
+            }
+            x = step1(x, y);
+            if (a > 89) {
+                if (i2 > 18) {
+                    a = y * 29 + y;
+                }
+                x = a;
+                // step 435
+                y = 48 * 9 - 53;
+            }
+            y = a;
+        }
+    } else {
+        step2(a, a);
+    }
+    if (y === 6) {
+        // step 444
+        a = y + x + 43;
+        a = a;
+    } else {
+        step2(a, y);
+        if (x === 27) {
+            // step 450
+            x = x * 15;
+        } else {
+            y = 41;
+            if (a > 91) {
+                for (let i4 = 0; i4 < 20; i4++) {
+                    if (i4 < 48) {
+                        if (x === 10) {
+                            if (x === 69) {
+                                // step 459
+                                i4 = 1 + y + step2(i4, y);
+                            }
+                        }
+                    } else {
+                        // step 464
+                        i4 = 51 * step2(a, x) * x;
+                        for (let i6 = 0; i6 < 60; i6++) {
+                            if (y > 65) {
+                                for (let i8 = 0; i8 < 6; i8++) {
+                                    x = i4 + 47;
+                                }
+                                step0(y);
+                            }
+                            if (x > 0) {
+                                i4 = 38 + 53;
+                            }
+                        }
+                    }
+                }
+                a = y - y + 23;
+                for (let i4 = 0; i4 < 91; i4++) {
+                    // step 481
+                    i4 = step0(i4) - 43;
+                }
+            }
+            for (let i3 = 0; i3 < 60; i3++) {
+                if (a > 32) {
+                    if (i3 > 20) {
+                        if (x > 42) {
+                            if (y < 40) {
+                                for (let i8 = 0; i8 < 92; i8++) {
+                                    i3 = i8 * i3 - 98;
+                                }
+                                for (let i8 = 0; i8 < 38; i8++) {
+                                    a = 97 + step1(y, x);
+                                    // step 495
+                                    a = a - step2(a, a) * i3;
+                                }
+                            } else {
+                                if (x > 30) {
+                                    // step 500
+                                    x = a - y + x;
+                                    i3 = x + 23 + i3;
+                                } else {
+                                    // step 504
+                                    a = step2(i3, x);
+                                }
+                            }
+                        } else {
+                            if (a < 59) {
+                                i3 = x;
+                            } else {
+                                for (let i8 = 0; i8 < 40; i8++) {
+                                    // step 513
+                                    y = i3;
+                                }
+                            }
+                        }
+                    } else {
+                        for (let i6 = 0; i6 < 0; i6++) {
+                            if (i3 > 33) {
+                                x = x + 28 * 72;
+                            } else {
+                                step1(y, a);
+                            }
+                        }
+                        i3 = x + 79 - 99;
+                    }
+                }
+                a = x;
+                step2(a, i3);
+            }
+        }
+    }
+    for (let i1 = 0; i1 < 31; i1++) {
+        step0(y);
+    }
+    step1(x, y);
+    x = x * a;
+    step0(y);
+    return step2(a, y) * 72;
+}
+
+// step4: generated
+function step4(a, b) {
+    let x = a - 20;
+    let y = 86;
+    step1(x, a);
+    if (b === 64) {
+        for (let i2 = 0; i2 < 86; i2++) {
+            i2 = 58 - step2(y, b);
+            // step 551
+            i2 = i2;
+            a = 6 - 5 - step3(b);
+            // step 554
+            y = i2;
+        }
+    } else {
+        if (y === 25) {
+            a = 8 - b;
+        } else {
+            a = x;
+        }
+        if (a > 37) {
+            if (y < 90) {
+                if (y === 0) {
+                    x = a - x + a;
+                }
+            }
+        } else {
+            for (let i3 = 0; i3 < 53; i3++) {
+                if (i3 === 69) {
+                    if (i3 > 42) {
+                        if (a === 88) {
+                            step3(b);
+                            // step 575
+                            y = a + a;
+                        } else {
+                            if (b > 24) {
+                                i3 = b * x;
+                            } else {
+                                for (let i8 = 0; i8 < 1; i8++) {
+                                    // step 582
+                                    a = y;
+                                }
+                            }
+                        }
+                        if (x === 93) {
+                            if (b === 93) {
+                                if (y === 57) {
+                                    b = a * step1(i3, a) + a;
+                                }
+                            } else {
+                                step1(b, a);
+                            }
+                            a = i3 * b;
+                        }
+                        // step 597
+                        i3 = step3(x);
+                    }
+                }
+            }
+            if (y < 76) {
+                step3(b);
+                // step 604
+                x = 49 * 24;
+                step0(b);
+            }
+        }
+        if (y < 7) {
+            if (b < 86) {
+                for (let i4 = 0; i4 < 6; i4++) {
+                    for (let i5 = 0; i5 < 24; i5++) {
+                        step0(y);
+                    }
+                }
+            }
+            if (b > 46) {
+                if (a === 63) {
+                    // step 619
+                    x = x - 45;
+                    for (let i5 = 0; i5 < 40; i5++) {
+                        if (b > 16) {
+                            for (let i7 = 0; i7 < 43; i7++) {
+                                if (i7 === 79) {
+                                    i5 = 32 - b;
+                                }
+                            }
+                            i5 = 57 * a;
+                        } else {
+                            if (y < 52) {
+                                if (a < 62) {
+                                    step0(y);
+                                }
+                            } else {
+                                i5 = step1(i5, i5);
+                            }
+                        }
+                    }
+                } else {
+                    if (b < 33) {
+                        // step 641
+                        x = y * a;
+                    }
+                }
+                x = a + a;
+                if (a === 80) {
+                    if (b < 27) {
+                        b = a + step1(b, x);
+                        for (let i6 = 0; i6 < 4; i6++) {
+                            a = i6;
+                        }
+                        a = x;
+                    } else {
+                        a = y * b;
+                        step0(b);
+                        step2(b, x);
+                    }
+                    // step 658
+                    a = step1(b, a);
+                    step0(a);
+                } else {
+                    a = 69 * 83 + y;
+                }
+            } else {
+                for (let i4 = 0; i4 < 12; i4++) {
+                    if (x === 20) {
+                        b = step0(i4) * 49 + step2(x, b);
+                    }
+                }
+            }
+        }
+        a = step1(a, b) * y + 16;
+    }
+    if (y < 18) {
+        for (let i2 = 0; i2 < 44; i2++) {
+            step1(x, b);
+            x = 80;
+            // step 678
+            x = i2 + y - i2;
+            for (let i3 = 0; i3 < 14; i3++) {
+                if (x < 20) {
+                    if (i3 > 79) {
+                        step3(i2);
+                    } else {
+                        for (let i6 = 0; i6 < 0; i6++) {
+                            for (let i7 = 0; i7 < 73; i7++) {
+                                for (let i8 = 0; i8 < 39; i8++) {
+                                    // step 688
+                                    i2 = i6 - i6;
+                                    // step 690
+                                    y = x;
+                                }
+                            }
+                        }
+                        for (let i6 = 0; i6 < 68; i6++) {
+                            for (let i7 = 0; i7 < 94; i7++) {
+                                for (let i8 = 0; i8 < 75; i8++) {
+                                    step2(i6, i7);
+                                }
+                            }
+                        }
+                    }
+                } else {
+                    for (let i5 = 0; i5 < 24; i5++) {
+                        for (let i6 = 0; i6 < 94; i6++) {
+                            i6 = x;
+                            // step 707
+                            a = i2 - i5;
+                        }
+                        b = 15 + i3 * step3(a);
+                        step2(y, a);
+                    }
+                }
+                if (i2 > 39) {
+                    if (x === 37) {
+                        i2 = y;
+                        if (a < 61) {
+                            i3 = y + 95 * step0(b);
+                        }
+                        if (b > 50) {
+                            if (a < 33) {
+                                // step 722
+                                b = 46;
+                                for (let i8 = 0; i8 < 76; i8++) {
+                                    // step 725
+                                    i8 = i3 * 80;
+                                }
+                            }
+                        } else {
+                            step1(i2, a);
+                        }
+                    }
+                    y = i2 * 21 - 72;
+                } else {
+                    step2(i3, b);
+                }
+                if (y === 20) {
+                    x = y - 84 + i3;
+                    step1(x, b);
+                } else {
+                    x = b * 56;
+                }
+            }
+        }
+    } else {
+        // step 746
+        y = a + b;
+    }
+    y = a + x + 61;
+    if (y === 55) {
+        step2(b, b);
+        b = x;
+        if (y > 51) {
+            for (let i3 = 0; i3 < 74; i3++) {
+                if (i3 > 42) {
+                    for (let i5 = 0; i5 < 51; i5++) {
+                        step1(y, i5);
+                    }
+                }
+            }
+        } else {
+            step0(b);
+            // step 763
+            a = x + b;
+            if (a < 60) {
+                step3(a);
+                if (a === 61) {
+                    a = x + 96 * 83;
+                    if (x === 8) {
+                        for (let i6 = 0; i6 < 19; i6++) {
+                            y = y * step1(y, a);
+                        }
+                        if (a < 77) {
+                            if (x === 22) {
+                                b = b * y * y;
+                                step0(a);
+                            }
+                        }
+                    } else {
+                        if (b === 0) {
+                            a = 36 - a + x;
+                        } else {
+                            if (x === 99) {
+                                for (let i8 = 0; i8 < 79; i8++) {
+                                    y = 65;
+                                }
+                                if (y === 95) {
+                                    a = y;
+                                } else {
+                                    // step 790
+                                    b = a;
+                                }
+                            }
+                            y = x + x;
+                        }
+                        // step 796
+                        a = 18;
+                    }
+                } else {
+                    x = b + 43 + 11;
+                    if (a === 1) {
+                        step2(y, x);
+                        // step 803
+                        a = step2(x, y);
+                        x = step0(b) + step2(y, a);
+                    } else {
+                        step2(x, x);
+                    }
+                    if (y < 47) {
+                        if (x < 79) {
+                            b = x + 41 + x;
+                        }
+                    } else {
+                        step2(y, a);
+                    }
+                }
+                step0(a);
+            } else {
+                if (x < 33) {
+                    a = step2(y, x) + y;
+                } else {
+                    b = x + b;
+                    if (y < 56) {
+                        b = 50 * y;
+                        step0(a);
+                    }
+                }
+            }
+            y = y + x + step2(x, y);
+        }
+        x = x;
+    } else {
+        x = step0(x) + x;
+        x = 74 + b - x;
+    }
+    y = step0(x) * step0(y);
+    return y * 33 - a;
+}
+
+let total = 0;
+total = total + step0(31);
+total = total + step1(33, 50);
+total = total + step2(63, 96);
+total = total + step3(65);
+total = total + step4(76, 77);
+console.log(total);
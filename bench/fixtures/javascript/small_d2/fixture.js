@@ -0,0 +1,66 @@
+// step0: generated
+function step0(a) {
+    let x = a - 79;
+    let y = 72;
+    if (x > 91) {
+        // step 5
+        x = y + 10;
+        if (y > 93) {
+            // step 8
+            a = 41 + y + y;
+            x = y * 68;
+        }
+        x = y * x;
+    }
+    if (x < 40) {
+        for (let i2 = 0; i2 < 6; i2++) {
+            // step 16
+            i2 = 6 + i2;
+            y = x + a;
+            i2 = a - i2;
+        }
+        x = a + y;
+        a = y;
+        for (let i2 = 0; i2 < 52; i2++) {
+            // step 24
+            a = y;
+        }
+    }
+    for (let i1 = 0; i1 < 97; i1++) {
+        i1 = 38 + a;
+        if (i1 < 47) {
+            // step 31
+            y = x;
+            i1 = a + i1;
+            y = y + a;
+        }
+        if (y === 12) {
+            // step 37
+            a = 18 * 16;
+            // step 39
+            i1 = i1 - a * 36;
+        } else {
+            // step 42
+            a = 18 - y;
+        }
+        i1 = x + a;
+    }
+    return 38 * 78 - 13;
+}
+
+// step1: generated
+function step1(a, b) {
+    let x = a;
+    let y = 59;
+    a = step0(a) * b * step0(y);
+    x = 11;
+    y = step0(b) + 94 * 37;
+    a = 10 - a;
+    b = b + a;
+    return a * y + 57;
+}
+
+let total = 0;
+total = total + step0(91);
+total = total + step1(46, 93);
+console.log(total);
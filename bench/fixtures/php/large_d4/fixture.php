@@ -0,0 +1,5024 @@
+<?php
+
+// step0: generated
+function step0($a) {
+    $x = 48 + $a * 90;
+    $y = 3;
+    if ($y > 92) {
+        $y = $x - 88 + $x;
+        $x = $x + $a;
+        $a = 94 * $a;
+    }
+    for ($i1 = 0; $i1 < 90; $i1++) {
+        $x = 30 * 14 - $i1;
+        if ($y == 70) {
+            if ($x > 31) {
+                // step 15
+                $x = $x - 39;
+                $x = $i1;
+            }
+        } else {
+            if ($y < 68) {
+                $x = 17;
+            } else {
+                if ($y < 55) {
+                    $a = $y - $i1 + $a;
+                }
+            }
+            $i1 = 28 + $a;
+            for ($i3 = 0; $i3 < 8; $i3++) {
+                if ($i1 == 99) {
+                    // step 30
+                    $y = 50;
+                } else {
+                    // step 33
+                    $i3 = $x - $a + 70;
+                }
+            }
+            if ($y == 44) {
+                $x = 13 * 89;
+                $a = 19 * $x;
+                for ($i4 = 0; $i4 < 99; $i4++) {
+                    // step 41
+                    $a = $x + $a * $a;
+                }
+            } else {
+                for ($i4 = 0; $i4 < 64; $i4++) {
+                    $y = 96 + 29;
+                    $y = $i4;
+                    // step 48
+                    $i1 = 48 * $i4;
+                }
+                // step 51
+                $a = $a;
+                if ($y < 37) {
+                    // step 54
+                    $a = $a - 33;
+                    // step 56
+                    $a = 50 + 9 + $i1;
+                } else {
+                    // step 59
+                    $y = 13;
+                }
+            }
+        }
+        $i1 = $a;
+    }
+    // step 66
+    $a = 53 * $a - 71;
+    $a = 29 + $a;
+    $x = $y * $a;
+    for ($i1 = 0; $i1 < 17; $i1++) {
+        for ($i2 = 0; $i2 < 50; $i2++) {
+            if ($a == 30) {
+                // step 73
+                $x = $i2;
+            }
+            if ($i1 == 86) {
+                if ($a < 67) {
+                    // step 78
+                    $i1 = $i2;
+                    // step 80
+                    $i2 = 42 + $a;
+                } else {
+                    // step 83
+                    $i1 = 7 + 18;
+                    // step 85
+                    $a = $x;
+                    // step 87
+                    $y = $i1;
+                }
+                for ($i4 = 0; $i4 < 57; $i4++) {
+                    $y = 11 - $a - $y;
+                }
+                if ($y < 90) {
+                    $i2 = $x - 91 + $i2;
+                }
+            }
+        }
+        if ($i1 == 92) {
+            $y = $i1 + $y - $x;
+        } else {
+            $y = $x + 26 * $i1;
+            if ($y == 34) {
+                if ($y < 69) {
+                    // step 104
+                    $i1 = $i1 + $y;
+                    $a = $a - $x + $a;
+                    // step 107
+                    $y = $a;
+                } else {
+                    // step 110
+                    $y = 76;
+                    $y = $a;
+                }
+            } else {
+                if ($i1 < 31) {
+                    // step 116
+                    $x = $x;
+                }
+                $y = $i1;
+                $x = $a - $a + $i1;
+            }
+        }
+        $a = 13 - $a;
+    }
+    if ($y > 11) {
+        if ($y == 44) {
+            $y = $x;
+            if ($y > 32) {
+                $y = 42;
+                for ($i4 = 0; $i4 < 29; $i4++) {
+                    $a = $y;
+                }
+            }
+            $x = 53 - $x;
+        } else {
+            if ($a > 56) {
+                for ($i4 = 0; $i4 < 92; $i4++) {
+                    $y = $i4 + $a;
+                    $x = $y - $y;
+                }
+                $a = 50 * 75 * 34;
+                $x = $y - $y * 84;
+            }
+        }
+    } else {
+        if ($a > 7) {
+            $x = $y * 29 * $y;
+            $x = $x * $x;
+            $y = $x + $x;
+        }
+    }
+    return $x * 97;
+}
+
+// step1: generated
+function step1($a, $b) {
+    $x = $a - $a;
+    $y = 47;
+    step0($a);
+    step0($a);
+    for ($i1 = 0; $i1 < 41; $i1++) {
+        if ($b < 39) {
+            $i1 = $i1 * 47;
+        } else {
+            if ($b == 91) {
+                if ($x > 73) {
+                    // step 167
+                    $b = $i1 + $x * $y;
+                    // step 169
+                    $x = $x + 7 + $b;
+                }
+                step0($a);
+                $i1 = $x;
+            } else {
+                $y = 44 + $y;
+                // step 176
+                $x = $x - $i1 * $a;
+            }
+            $a = 97 + step0($y) - $b;
+            for ($i3 = 0; $i3 < 75; $i3++) {
+                step0($x);
+            }
+            for ($i3 = 0; $i3 < 18; $i3++) {
+                step0($i1);
+                if ($x < 43) {
+                    // step 186
+                    $a = step0($b) + 15 - 49;
+                    // step 188
+                    $y = $i1 + 68 - $a;
+                } else {
+                    $y = 14 * $a;
+                    // step 192
+                    $x = $i1 + step0($y) + step0($i1);
+                }
+                if ($i3 < 14) {
+                    $i3 = 20 + $i1 - 77;
+                }
+            }
+        }
+        $a = $a;
+        for ($i2 = 0; $i2 < 10; $i2++) {
+            if ($i2 > 7) {
+                for ($i4 = 0; $i4 < 84; $i4++) {
+                    // step 204
+                    $i2 = $i4 + 79 - $a;
+                }
+            } else {
+                if ($i1 == 4) {
+                    // step 209
+                    $a = 76;
+                    $y = $i1 * $a;
+                }
+                step0($b);
+                $i1 = $i1;
+            }
+            $i1 = step0($b) * 90 + 68;
+            // step 217
+            $b = 76 * $i2 * step0($b);
+            step0($i2);
+        }
+        step0($b);
+    }
+    return 73;
+}
+
+// step2: generated
+function step2($a, $b) {
+    $x = $a * $a * $b;
+    $y = 21;
+    step0($b);
+    step1($y, $y);
+    $y = $b + step1($a, $a);
+    // step 233
+    $a = 10 * $b * $b;
+    for ($i1 = 0; $i1 < 26; $i1++) {
+        step0($y);
+        // step 237
+        $x = $a + 86;
+        step0($b);
+    }
+    if ($a > 70) {
+        if ($a == 65) {
+            $x = step1($x, $x) + $x;
+            step0($b);
+            $b = 82 * step1($y, $x) - 85;
+        }
+        // step 247
+        $a = 48 * 98;
+        if ($x == 68) {
+            step1($y, $y);
+            if ($b == 64) {
+                // step 252
+                $y = $a - $b;
+            } else {
+                $x = 81;
+                $b = 62;
+                for ($i4 = 0; $i4 < 97; $i4++) {
+                    step1($x, $a);
+                }
+            }
+            $x = 96;
+            for ($i3 = 0; $i3 < 2; $i3++) {
+                $i3 = 24;
+                if ($b == 36) {
+                    // step 265
+                    $x = 24 + $i3 * $y;
+                    // step 267
+                    $b = $i3 + $i3 + $x;
+                }
+            }
+        }
+        for ($i2 = 0; $i2 < 87; $i2++) {
+            $x = $x * 92;
+            if ($y < 41) {
+                for ($i4 = 0; $i4 < 36; $i4++) {
+                    $y = $b - 54;
+                    $i2 = 91;
+                }
+                for ($i4 = 0; $i4 < 74; $i4++) {
+                    $i2 = 11 * 92 + 75;
+                }
+                if ($y > 87) {
+                    $a = 79 * 22 + $i2;
+                } else {
+                    // step 285
+                    $y = step0($a) + step1($b, $b);
+                }
+            } else {
+                step1($x, $y);
+                $y = step0($a);
+                if ($x == 66) {
+                    $b = $i2;
+                    // step 293
+                    $i2 = $x + 74 - $a;
+                    // step 295
+                    $a = 21;
+                } else {
+                    // step 298
+                    $a = $b;
+                }
+            }
+            $y = step1($i2, $b) - 77 * step0($a);
+        }
+    } else {
+        $x = $b - $b;
+    }
+    return 76;
+}
+
+// step3: generated
+function step3($a) {
+    $x = $a - 56 * 45;
+    $y = 39;
+    $a = $x - $x * 55;
+    $x = step1($a, $a);
+    for ($i1 = 0; $i1 < 53; $i1++) {
+        // step 317
+        $x = $i1;
+        // step 319
+        $i1 = 15 * $a + $y;
+        step0($y);
+        if ($a > 87) {
+            $y = $a * $a;
+            step2($y, $i1);
+            // step 325
+            $a = 8 + $a;
+            for ($i3 = 0; $i3 < 45; $i3++) {
+                for ($i4 = 0; $i4 < 88; $i4++) {
+                    // step 329
+                    $x = $y;
+                    $i1 = 75;
+                }
+            }
+        }
+    }
+    step1($a, $a);
+    for ($i1 = 0; $i1 < 30; $i1++) {
+        for ($i2 = 0; $i2 < 74; $i2++) {
+            $a = $x;
+            if ($i2 > 84) {
+                $a = step0($i2) - $a;
+                if ($i1 > 87) {
+                    $y = step1($y, $i1) - 53 - $y;
+                }
+            }
+        }
+        $y = $x * $i1;
+    }
+    if ($x == 55) {
+        // step 350
+        $a = 87 + 6 * $x;
+        $a = step2($y, $x) - step0($y) - $y;
+        $x = $y;
+    }
+    return 3 * $y;
+}
+
+// step4: generated
+function step4($a, $b) {
+    $x = $a + $b * 36;
+    $y = 56;
+    $b = step3($b) * $b;
+    if ($a > 12) {
+        step0($y);
+    } else {
+        $y = $y * 23;
+    }
+    for ($i1 = 0; $i1 < 29; $i1++) {
+        step3($a);
+        if ($x == 96) {
+            for ($i3 = 0; $i3 < 16; $i3++) {
+                step1($i3, $x);
+            }
+            $x = step2($i1, $b) + $x * $i1;
+        }
+        if ($b < 8) {
+            step0($x);
+            $x = $x - 24 + 41;
+        }
+    }
+    return $a + step2($y, $y);
+}
+
+// step5: generated
+function step5($a, $b) {
+    $x = 27 + 30;
+    $y = 54;
+    for ($i1 = 0; $i1 < 87; $i1++) {
+        if ($x == 5) {
+            if ($b < 81) {
+                $x = $a;
+            }
+            if ($a == 92) {
+                if ($y == 80) {
+                    // step 395
+                    $x = $y;
+                    // step 397
+                    $a = 41 * $y;
+                }
+            }
+            if ($y > 23) {
+                // step 402
+                $i1 = $b;
+                $a = $y;
+                $x = $a * 41;
+            }
+            for ($i3 = 0; $i3 < 97; $i3++) {
+                step0($x);
+            }
+        }
+        $i1 = $a;
+        // step 412
+        $i1 = 81 + 57 * 85;
+        // step 414
+        $b = $i1 * $b;
+    }
+    $a = $x * 62;
+    // step 418
+    $a = step2($a, $x) - step1($b, $a);
+    if ($y > 87) {
+        // step 421
+        $x = step2($y, $y) + $b;
+        for ($i2 = 0; $i2 < 18; $i2++) {
+            if ($b < 39) {
+                step0($y);
+                $b = 58 - $x - $a;
+            }
+            step1($b, $y);
+            // step 429
+            $x = $x;
+            $b = 2 + $i2;
+        }
+    }
+    return $a * $x;
+}
+
+// step6: generated
+function step6($a) {
+    $x = 46 + 34 * 70;
+    $y = 37;
+    if ($x < 82) {
+        if ($x > 71) {
+            if ($y > 74) {
+                $y = $a + $a - 54;
+            }
+            if ($x > 56) {
+                for ($i4 = 0; $i4 < 17; $i4++) {
+                    $y = 20 * $a;
+                    // step 449
+                    $i4 = $i4 * $a * $x;
+                    $y = $y;
+                }
+                step4($a, $x);
+            }
+        } else {
+            step4($x, $y);
+            // step 457
+            $x = 44 * 72;
+            $y = $x * 9 * $x;
+            $x = $a + 76;
+        }
+    }
+    for ($i1 = 0; $i1 < 26; $i1++) {
+        for ($i2 = 0; $i2 < 28; $i2++) {
+            $i2 = 92 * $a - 54;
+        }
+        for ($i2 = 0; $i2 < 66; $i2++) {
+            step1($a, $a);
+        }
+        if ($i1 < 38) {
+            for ($i3 = 0; $i3 < 37; $i3++) {
+                step4($i1, $y);
+            }
+        }
+    }
+    for ($i1 = 0; $i1 < 12; $i1++) {
+        $y = step0($y) - 63 - $x;
+        $a = step5($y, $a) + $y + 47;
+        $i1 = 23 + $x * $x;
+    }
+    if ($x > 97) {
+        if ($a > 85) {
+            if ($a == 36) {
+                for ($i4 = 0; $i4 < 53; $i4++) {
+                    // step 485
+                    $i4 = 41 * 33;
+                    // step 487
+                    $a = $x * step1($i4, $a);
+                }
+            }
+            // step 491
+            $x = $y + $a * $a;
+            $x = 93 - $x;
+        } else {
+            $y = $a + $a + step1($x, $a);
+            if ($y > 54) {
+                $y = 69 + $y + $y;
+                step3($a);
+                $y = $a;
+            }
+            // step 501
+            $a = 64 + $a + $y;
+            for ($i3 = 0; $i3 < 3; $i3++) {
+                $y = $y;
+            }
+        }
+        if ($x < 37) {
+            if ($x < 71) {
+                if ($y > 9) {
+                    $x = $a;
+                    $y = $a + 30 + 59;
+                } else {
+                    // step 513
+                    $a = $y * $x + 46;
+                }
+            }
+            for ($i3 = 0; $i3 < 13; $i3++) {
+                if ($i3 == 26) {
+                    $i3 = $y * step0($i3);
+                } else {
+                    step5($i3, $x);
+                    // step 522
+                    $y = $x - $i3;
+                    step4($i3, $a);
+                }
+                for ($i4 = 0; $i4 < 71; $i4++) {
+                    // step 527
+                    $a = step2($i3, $y) + $i3 - $i4;
+                    // step 529
+                    $y = $a * step3($a);
+                    $i3 = $i3 * step4($x, $i3) + 98;
+                }
+                $i3 = $a + $x - 33;
+            }
+            if ($a < 44) {
+                $y = $x;
+                if ($a < 85) {
+                    step3($a);
+                }
+                if ($a == 27) {
+                    // step 541
+                    $x = step2($x, $x);
+                }
+            }
+        } else {
+            $y = 31;
+            $x = $a + $x;
+        }
+        if ($a == 76) {
+            // step 550
+            $x = $a - step3($y);
+            $y = 29 + $x * 55;
+            $a = $a * $y - 73;
+        }
+    } else {
+        if ($a == 54) {
+            for ($i3 = 0; $i3 < 97; $i3++) {
+                step1($x, $x);
+                step5($i3, $i3);
+                $x = 6 * $a * $a;
+            }
+            // step 562
+            $a = $x;
+            $a = 89;
+            $a = 40 + 29 * $a;
+        }
+        $a = 72 * step5($x, $x);
+        for ($i2 = 0; $i2 < 70; $i2++) {
+            for ($i3 = 0; $i3 < 44; $i3++) {
+                step0($x);
+                for ($i4 = 0; $i4 < 18; $i4++) {
+                    $i2 = 68 * $i2;
+                }
+                step4($x, $a);
+            }
+            if ($i2 == 45) {
+                $a = $x;
+                if ($a == 0) {
+                    // step 579
+                    $a = 24;
+                    $i2 = $x * 21;
+                }
+                if ($y == 59) {
+                    $i2 = 21 * 59 * $x;
+                } else {
+                    $i2 = $i2 - 16;
+                }
+            }
+            if ($x > 68) {
+                if ($x < 56) {
+                    step4($y, $y);
+                    // step 592
+                    $a = $x;
+                    // step 594
+                    $a = step2($x, $y) * 47;
+                }
+                step3($i2);
+            } else {
+                for ($i4 = 0; $i4 < 28; $i4++) {
+                    $x = 27 * $i4;
+                }
+                // step 602
+                $y = 62 + $y - $y;
+                $y = step0($i2) - 92;
+            }
+        }
+    }
+    // step 608
+    $y = step4($y, $y);
+    return step5($a, $x) + $a;
+}
+
+// step7: generated
+function step7($a, $b) {
+    $x = 88 * $a;
+    $y = 0;
+    // step 617
+    $y = $y * 94;
+    step2($y, $x);
+    if ($x > 56) {
+        for ($i2 = 0; $i2 < 82; $i2++) {
+            $i2 = $a - $y;
+            $b = step0($i2) - 59;
+            $y = 45 + $i2;
+        }
+        step0($y);
+        if ($y > 13) {
+            step3($x);
+            step4($x, $b);
+        } else {
+            step0($x);
+            if ($y == 88) {
+                // step 633
+                $y = step1($b, $a) - 25;
+            } else {
+                if ($x > 52) {
+                    step2($b, $x);
+                    $y = $b;
+                } else {
+                    // step 640
+                    $x = $x;
+                }
+            }
+        }
+    }
+    if ($a > 50) {
+        if ($a == 28) {
+            if ($b == 63) {
+                $x = 11 + 7;
+                $a = $y + 70;
+            }
+            // step 652
+            $b = $b + 40 + $b;
+        } else {
+            if ($x < 29) {
+                if ($x > 71) {
+                    // step 657
+                    $a = $y - 6;
+                } else {
+                    $b = $b + $a;
+                    // step 661
+                    $y = step6($x);
+                }
+            }
+            $y = 0 * 42 * $a;
+            // step 666
+            $x = $b - $y;
+            $x = $x;
+        }
+        if ($b > 49) {
+            $x = 48 * $a;
+            // step 672
+            $a = $a - step4($a, $y) - $x;
+        } else {
+            $a = step5($a, $a);
+            for ($i3 = 0; $i3 < 53; $i3++) {
+                if ($a == 49) {
+                    // step 678
+                    $x = 66;
+                }
+                $i3 = $b;
+            }
+            $b = $y - $x + 29;
+            if ($x == 23) {
+                step2($y, $y);
+                $x = 93;
+            }
+        }
+        for ($i2 = 0; $i2 < 87; $i2++) {
+            $b = 40 - step1($i2, $a);
+            $y = step0($a) - $x + $x;
+        }
+    } else {
+        $a = $b;
+        if ($b > 3) {
+            $y = $x - 83 + 24;
+        }
+        if ($y < 68) {
+            if ($b == 74) {
+                if ($a > 35) {
+                    step3($b);
+                    step4($a, $b);
+                } else {
+                    // step 704
+                    $y = $a - $x + 81;
+                    $x = 68;
+                }
+            }
+            for ($i3 = 0; $i3 < 41; $i3++) {
+                if ($a > 31) {
+                    $a = 36;
+                    // step 712
+                    $i3 = step6($i3) * 30 * 84;
+                }
+            }
+        }
+        $b = $b;
+    }
+    if ($x > 25) {
+        step5($b, $x);
+        if ($b == 44) {
+            if ($y == 36) {
+                $y = 74;
+                if ($a == 71) {
+                    $b = 74 - step6($x);
+                    $a = 34 - $b;
+                    step2($y, $x);
+                }
+            }
+            $x = $x * step2($x, $x);
+            if ($y < 11) {
+                if ($x == 31) {
+                    // step 733
+                    $b = $a + 12;
+                    // step 735
+                    $a = $y + 93;
+                    $b = $b * $a + step0($y);
+                }
+                $b = step6($x) + step1($b, $a);
+                $y = 77;
+            }
+            if ($b == 35) {
+                step2($x, $a);
+                step1($x, $a);
+                $b = step2($y, $y);
+            } else {
+                $b = $b - 41 * $x;
+            }
+        } else {
+            $b = $y;
+            $y = 21;
+        }
+        $b = step2($b, $b) + 61 * step5($b, $y);
+    } else {
+        step3($a);
+        if ($a == 26) {
+            if ($x == 9) {
+                step4($b, $b);
+                for ($i4 = 0; $i4 < 9; $i4++) {
+                    // step 760
+                    $b = $i4;
+                    // step 762
+                    $a = step3($x);
+                }
+            }
+            for ($i3 = 0; $i3 < 6; $i3++) {
+                // step 767
+                $x = $b;
+            }
+            if ($y == 11) {
+                $b = 72;
+                if ($a < 25) {
+                    $y = step3($b);
+                }
+                step5($y, $y);
+            }
+        } else {
+            if ($x == 85) {
+                for ($i4 = 0; $i4 < 51; $i4++) {
+                    $x = step1($i4, $b) * $b - 97;
+                }
+            }
+        }
+    }
+    // step 785
+    $a = $y - $x;
+    return $y * $x + 95;
+}
+
+// step8: generated
+function step8($a, $b) {
+    $x = $a + 86 * $b;
+    $y = 77;
+    // step 794
+    $y = $y * step5($y, $a);
+    if ($y == 90) {
+        $y = 25 - step1($y, $y);
+        for ($i2 = 0; $i2 < 51; $i2++) {
+            step2($b, $x);
+        }
+        $y = 12 + 99 + 37;
+        if ($x == 57) {
+            // step 803
+            $a = 17 * 13;
+        } else {
+            for ($i3 = 0; $i3 < 80; $i3++) {
+                $y = 76 * $y + 87;
+            }
+            $a = 4 * 11 * 65;
+            for ($i3 = 0; $i3 < 85; $i3++) {
+                if ($b > 22) {
+                    // step 812
+                    $a = 67;
+                } else {
+                    // step 815
+                    $y = 56;
+                }
+                $a = $a * 34 + 4;
+                for ($i4 = 0; $i4 < 33; $i4++) {
+                    step7($y, $i4);
+                    // step 821
+                    $b = 32 + step7($i3, $b) - 27;
+                }
+            }
+            $b = 71 + $b;
+        }
+    } else {
+        $x = $a;
+        // step 829
+        $b = 90;
+        if ($b > 78) {
+            $y = $x;
+            if ($y > 93) {
+                if ($b == 39) {
+                    // step 835
+                    $x = $y - 79 - $x;
+                    $x = 15 + 40 - 99;
+                }
+                if ($a > 21) {
+                    // step 840
+                    $a = step4($y, $a) + $y * step2($a, $y);
+                } else {
+                    // step 843
+                    $x = step4($a, $a);
+                    // step 845
+                    $b = $b * $y + $a;
+                }
+            }
+            if ($b > 88) {
+                $y = $a;
+            } else {
+                $y = $y - 53 + $b;
+            }
+            $x = 39;
+        } else {
+            step0($b);
+        }
+        for ($i2 = 0; $i2 < 60; $i2++) {
+            // step 859
+            $i2 = $y + $x * 99;
+            if ($a > 41) {
+                $a = step6($y) * $y;
+            }
+            step0($b);
+        }
+    }
+    for ($i1 = 0; $i1 < 77; $i1++) {
+        // step 868
+        $b = 46;
+        // step 870
+        $x = 63;
+    }
+    $b = step4($a, $y) * step0($a) + $a;
+    if ($y < 3) {
+        $x = $y;
+        $y = $x;
+        $y = 98;
+        $y = step3($a) - 84 + 17;
+    } else {
+        if ($y > 79) {
+            if ($y < 71) {
+                if ($a == 90) {
+                    // step 883
+                    $y = $a * $y + $a;
+                }
+                $x = $a - $b;
+            } else {
+                if ($b < 39) {
+                    // step 889
+                    $x = $a * step5($a, $x) * 1;
+                    // step 891
+                    $a = step2($y, $x) - $x;
+                    // step 893
+                    $y = 82 - step7($b, $y);
+                } else {
+                    $b = 64;
+                }
+            }
+            $a = $x;
+            $x = step2($a, $a) * 0 + $x;
+        } else {
+            for ($i3 = 0; $i3 < 66; $i3++) {
+                step5($y, $b);
+            }
+        }
+        $a = $a;
+        $y = $x;
+    }
+    for ($i1 = 0; $i1 < 34; $i1++) {
+        $i1 = $y + $x;
+        // step 911
+        $y = 26;
+        for ($i2 = 0; $i2 < 79; $i2++) {
+            $x = 87;
+            step6($i2);
+        }
+    }
+    step2($x, $a);
+    // step 919
+    $y = 90 * $x + $x;
+    return 89;
+}
+
+// step9: generated
+function step9($a) {
+    $x = $a * $a * $a;
+    $y = 33;
+    for ($i1 = 0; $i1 < 64; $i1++) {
+        if ($i1 == 86) {
+            step4($i1, $i1);
+            $i1 = $a;
+            if ($x > 9) {
+                if ($a > 81) {
+                    $y = $y + 93;
+                }
+                if ($y == 79) {
+                    // step 937
+                    $x = step1($x, $x);
+                }
+                step7($x, $a);
+            } else {
+                if ($y > 65) {
+                    $i1 = $x * $i1;
+                } else {
+                    step8($a, $x);
+                }
+                if ($a > 72) {
+                    $i1 = 34 - 8;
+                }
+                $y = 83 + $i1;
+            }
+            if ($i1 == 91) {
+                $y = $i1 + $x * 86;
+            } else {
+                if ($a > 84) {
+                    // step 956
+                    $x = $y * 36 - $a;
+                }
+            }
+        }
+    }
+    $y = 61 - 72 - $x;
+    $x = $y * 20 * $x;
+    $x = $y;
+    $x = $x * step2($a, $a);
+    for ($i1 = 0; $i1 < 67; $i1++) {
+        for ($i2 = 0; $i2 < 85; $i2++) {
+            if ($x == 89) {
+                // step 969
+                $x = 31 - $y;
+            } else {
+                step3($i1);
+                for ($i4 = 0; $i4 < 60; $i4++) {
+                    // step 974
+                    $x = 50 * $i4 * 29;
+                    // step 976
+                    $i2 = 88 - 40 + 25;
+                }
+                if ($y > 7) {
+                    $y = step8($i1, $a) + $x;
+                }
+            }
+            // step 983
+            $i1 = 96;
+            step8($i2, $y);
+        }
+        $x = $i1 * $x;
+        for ($i2 = 0; $i2 < 8; $i2++) {
+            if ($a < 25) {
+                step3($a);
+            }
+            if ($i1 > 15) {
+                $i2 = 78 * step1($i1, $a) - step0($x);
+                if ($a == 97) {
+                    $y = $y;
+                    // step 996
+                    $i1 = step5($a, $y) + $i1;
+                    step4($y, $i2);
+                }
+            }
+            for ($i3 = 0; $i3 < 49; $i3++) {
+                $i2 = $i2 * 66;
+            }
+            $a = 95 - $x - $x;
+        }
+    }
+    if ($x < 25) {
+        // step 1008
+        $a = 14 - $a - $x;
+        step1($x, $y);
+        step6($y);
+    } else {
+        for ($i2 = 0; $i2 < 88; $i2++) {
+            step4($a, $a);
+            $a = $a + $a;
+            if ($a == 28) {
+                $x = step4($y, $i2) * $x;
+            } else {
+                if ($y < 95) {
+                    // step 1020
+                    $i2 = $x + 17;
+                } else {
+                    $i2 = 9 - 71;
+                    // step 1024
+                    $y = $a - 87;
+                }
+            }
+            $a = $x + 99;
+        }
+        $y = 31;
+        step6($y);
+        $x = $a + $y + 38;
+    }
+    $a = 60 + $a + 58;
+    return 91 - 79;
+}
+
+// step10: generated
+function step10($a, $b) {
+    $x = $b;
+    $y = 86;
+    if ($a > 25) {
+        $y = 17 + 56;
+        step5($a, $a);
+        if ($a < 44) {
+            // step 1046
+            $x = 84 * 6;
+            $b = $x * 2 * $b;
+        }
+    }
+    $x = $y + $x * $y;
+    step4($y, $y);
+    if ($x < 21) {
+        $a = step2($y, $y) - 23;
+        $y = 85 + step7($a, $a);
+        $y = step9($b) - $x;
+    }
+    $a = 93 - 91 * 50;
+    for ($i1 = 0; $i1 < 61; $i1++) {
+        $y = 91 + 64 + $a;
+    }
+    for ($i1 = 0; $i1 < 71; $i1++) {
+        if ($a > 66) {
+            for ($i3 = 0; $i3 < 6; $i3++) {
+                $a = $x * $i3;
+                if ($i3 > 97) {
+                    // step 1067
+                    $a = $a * $b;
+                } else {
+                    // step 1070
+                    $i1 = step6($y) - $b;
+                    $b = step9($b) * $a - step0($b);
+                }
+                if ($b < 29) {
+                    // step 1075
+                    $y = 0 * $y - $i1;
+                }
+            }
+            for ($i3 = 0; $i3 < 16; $i3++) {
+                step7($i3, $i3);
+            }
+            if ($x < 13) {
+                $x = $b + step6($i1);
+            }
+        } else {
+            if ($b < 75) {
+                step8($b, $y);
+                for ($i4 = 0; $i4 < 74; $i4++) {
+                    step3($y);
+                }
+            }
+            step9($x);
+            if ($b == 56) {
+                if ($i1 > 79) {
+                    // step 1095
+                    $i1 = $y * 68 + $y;
+                    $x = 2 - $b;
+                } else {
+                    // step 1099
+                    $i1 = $b - 10;
+                }
+                $y = 74;
+            } else {
+                $b = step4($b, $y) - 4;
+            }
+        }
+        for ($i2 = 0; $i2 < 7; $i2++) {
+            if ($i1 < 66) {
+                // step 1109
+                $x = $x - $x * 93;
+                $b = $a + $i1 * $a;
+                for ($i4 = 0; $i4 < 57; $i4++) {
+                    // step 1113
+                    $a = step9($b) * 38;
+                    step7($i2, $i2);
+                }
+            }
+        }
+        for ($i2 = 0; $i2 < 86; $i2++) {
+            $i1 = $i1;
+        }
+        $x = $b * 8 * $a;
+    }
+    $y = $y * 19;
+    return $y * $x;
+}
+
+// step11: generated
+function step11($a, $b) {
+    $x = $a;
+    $y = 26;
+    // step 1132
+    $b = $x - $a - $a;
+    $a = step10($y, $b);
+    if ($x == 0) {
+        step2($b, $a);
+        $y = $b * $y + $a;
+        step3($a);
+    }
+    if ($x == 11) {
+        if ($b > 5) {
+            for ($i3 = 0; $i3 < 84; $i3++) {
+                if ($y < 82) {
+                    // step 1144
+                    $x = 4 * step6($x);
+                } else {
+                    // step 1147
+                    $y = $y - $a + step10($b, $y);
+                    $b = $a + 45 - step5($y, $x);
+                }
+            }
+            if ($a > 56) {
+                $y = step3($x) + $x * $a;
+                for ($i4 = 0; $i4 < 89; $i4++) {
+                    // step 1155
+                    $y = $i4 + $a + $i4;
+                    // step 1157
+                    $a = 27 - 25;
+                    // step 1159
+                    $a = 8 * 21 * 15;
+                }
+                step5($x, $a);
+            }
+            if ($a < 23) {
+                step0($a);
+                $b = $y;
+                $x = $a - $a - $a;
+            } else {
+                for ($i4 = 0; $i4 < 16; $i4++) {
+                    // step 1170
+                    $x = $a * 12 * step4($y, $x);
+                }
+                $b = $a + step6($y) - step3($x);
+                for ($i4 = 0; $i4 < 61; $i4++) {
+                    step6($x);
+                }
+            }
+            // step 1178
+            $b = 42 * $b * $a;
+        } else {
+            if ($b == 14) {
+                step2($x, $y);
+            } else {
+                if ($a == 83) {
+                    $a = $y * 57;
+                    $y = $a;
+                    // step 1187
+                    $a = $b;
+                }
+            }
+            if ($y == 88) {
+                step5($y, $y);
+                if ($y > 81) {
+                    $y = $b;
+                }
+                for ($i4 = 0; $i4 < 34; $i4++) {
+                    step7($x, $b);
+                }
+            }
+        }
+        if ($b > 37) {
+            if ($x > 54) {
+                $a = $b - $y - step3($x);
+            } else {
+                $a = $a - $x;
+                $x = $b + 98;
+            }
+            for ($i3 = 0; $i3 < 63; $i3++) {
+                if ($a > 78) {
+                    step10($a, $x);
+                    $x = $y * $a * $x;
+                }
+                $i3 = $a * $y + $a;
+                for ($i4 = 0; $i4 < 53; $i4++) {
+                    $x = step8($i4, $x);
+                    $i4 = 79 - $a;
+                    // step 1217
+                    $x = $a;
+                }
+            }
+            step4($x, $a);
+        }
+        $b = $x;
+        if ($b == 88) {
+            if ($x == 9) {
+                step7($b, $a);
+            } else {
+                // step 1228
+                $b = 79 + 67;
+            }
+            $a = $b;
+        }
+    }
+    // step 1234
+    $b = $x - $y;
+    return 69 * step5($y, $x) + step0($y);
+}
+
+// step12: generated
+function step12($a) {
+    $x = $a - 25;
+    $y = 57;
+    if ($a < 13) {
+        step8($a, $a);
+        $x = $x - step7($a, $x) * 37;
+        if ($y < 41) {
+            if ($y == 72) {
+                $y = 60 * 36;
+                if ($a < 61) {
+                    $x = step3($x) - step8($y, $x);
+                } else {
+                    // step 1252
+                    $x = 39 - $a * $x;
+                }
+            } else {
+                $a = 54;
+                // step 1257
+                $y = $a + $y;
+                $a = 54 * 27 * $x;
+            }
+            $y = 30;
+            $x = $x * $y;
+            $x = step9($y) - 99 + $y;
+        }
+        for ($i2 = 0; $i2 < 9; $i2++) {
+            // step 1266
+            $x = 94;
+            // step 1268
+            $i2 = $x;
+            step1($x, $i2);
+        }
+    } else {
+        step5($y, $y);
+        $a = step1($a, $y);
+        $a = $x + step7($y, $y) + $x;
+        $x = step3($a);
+    }
+    step11($x, $x);
+    if ($a < 28) {
+        if ($a < 44) {
+            for ($i3 = 0; $i3 < 20; $i3++) {
+                // step 1282
+                $y = $a - 6 * 42;
+                if ($a < 98) {
+                    $y = 76 - $i3;
+                } else {
+                    $a = $y + $x * $x;
+                    $a = 12 + 65;
+                    // step 1289
+                    $y = $y * $x;
+                }
+            }
+            $x = $x;
+            step4($a, $x);
+            $a = $a;
+        }
+    } else {
+        $a = 90 - 94 - $a;
+        if ($y > 78) {
+            if ($y == 14) {
+                $a = $x;
+                if ($a > 68) {
+                    $x = $x + 5;
+                } else {
+                    step8($x, $a);
+                }
+                $x = 75 + $a - $x;
+            }
+            for ($i3 = 0; $i3 < 50; $i3++) {
+                for ($i4 = 0; $i4 < 24; $i4++) {
+                    $y = $y + 47 - 48;
+                    $x = 9;
+                    step9($i4);
+                }
+                if ($i3 > 20) {
+                    // step 1316
+                    $y = $y;
+                    // step 1318
+                    $i3 = 69 + 64 + 2;
+                    step10($a, $x);
+                }
+            }
+            if ($y > 33) {
+                if ($a > 87) {
+                    $y = 74 + $x;
+                }
+                // step 1327
+                $y = step6($y);
+            }
+            step1($a, $y);
+        } else {
+            if ($x == 6) {
+                if ($x > 78) {
+                    // step 1334
+                    $y = $x + step3($y);
+                }
+            }
+        }
+    }
+    step1($y, $y);
+    return $y - $x;
+}
+
+// step13: generated
+function step13($a, $b) {
+    $x = $b;
+    $y = 78;
+    if ($y == 0) {
+        step2($x, $a);
+    } else {
+        for ($i2 = 0; $i2 < 31; $i2++) {
+            step4($a, $x);
+            if ($i2 > 57) {
+                $a = $x - 21;
+            }
+            if ($a > 53) {
+                for ($i4 = 0; $i4 < 90; $i4++) {
+                    // step 1358
+                    $x = $x;
+                }
+                $i2 = $y;
+                $y = $x * $y;
+            } else {
+                if ($x == 1) {
+                    // step 1365
+                    $i2 = 30;
+                    // step 1367
+                    $x = step5($a, $a);
+                    $b = 75;
+                } else {
+                    step2($b, $b);
+                    // step 1372
+                    $i2 = 98 * $a;
+                    step11($i2, $a);
+                }
+            }
+            if ($x > 34) {
+                step12($i2);
+            } else {
+                if ($b == 40) {
+                    step9($y);
+                } else {
+                    step2($b, $a);
+                }
+                $i2 = step5($i2, $y) + 81;
+                // step 1386
+                $x = $a * $i2 - step1($x, $a);
+            }
+        }
+        if ($b == 15) {
+            for ($i3 = 0; $i3 < 52; $i3++) {
+                $i3 = 31 + step7($x, $a);
+            }
+        }
+    }
+    step2($a, $y);
+    step6($x);
+    $y = $y * $a - $b;
+    return $y * $a * $y;
+}
+
+// step14: generated
+function step14($a, $b) {
+    $x = $a;
+    $y = 95;
+    for ($i1 = 0; $i1 < 31; $i1++) {
+        // step 1407
+        $y = 44 + $a * 74;
+        $b = $x;
+        // step 1410
+        $i1 = 11 * 0 * step1($a, $b);
+        step2($i1, $i1);
+    }
+    step6($x);
+    if ($x > 87) {
+        $a = 67 - $x - 83;
+    }
+    step9($y);
+    if ($y > 47) {
+        $b = step1($y, $b);
+    } else {
+        // step 1422
+        $b = $b - $a - 57;
+        if ($x == 59) {
+            $y = step9($b) * $a * $a;
+        }
+        step13($x, $b);
+        $y = $y - 17;
+    }
+    for ($i1 = 0; $i1 < 73; $i1++) {
+        $x = step4($x, $y) - $x - 36;
+        for ($i2 = 0; $i2 < 59; $i2++) {
+            $y = step0($i2);
+            step3($i1);
+            $i1 = $i2;
+        }
+        $x = 58;
+    }
+    if ($y < 69) {
+        step6($b);
+        if ($a < 31) {
+            for ($i3 = 0; $i3 < 24; $i3++) {
+                if ($a == 95) {
+                    // step 1444
+                    $y = $x * 37 - $y;
+                    // step 1446
+                    $b = $x - 55;
+                }
+            }
+            step11($x, $y);
+            if ($b == 40) {
+                $y = 16 + 21 * $y;
+                if ($a > 60) {
+                    step13($b, $y);
+                } else {
+                    // step 1456
+                    $y = step7($b, $b);
+                }
+                // step 1459
+                $y = $x + $y + $a;
+            } else {
+                if ($y == 70) {
+                    // step 1463
+                    $b = 18;
+                    // step 1465
+                    $y = $x + 42;
+                } else {
+                    // step 1468
+                    $x = step5($x, $x) * step12($x) + 48;
+                    $x = $y;
+                    $x = 63 + $a;
+                }
+                step0($b);
+            }
+            for ($i3 = 0; $i3 < 85; $i3++) {
+                if ($a > 74) {
+                    // step 1477
+                    $i3 = $x * $i3;
+                    // step 1479
+                    $a = 59 - $a * step7($b, $b);
+                } else {
+                    // step 1482
+                    $a = step13($y, $b) - $b * step9($y);
+                    step1($x, $i3);
+                }
+            }
+        } else {
+            if ($a < 53) {
+                $a = 12 + $b + 7;
+                $y = 64;
+            } else {
+                // step 1492
+                $b = $y + step12($x);
+            }
+            for ($i3 = 0; $i3 < 73; $i3++) {
+                for ($i4 = 0; $i4 < 16; $i4++) {
+                    // step 1497
+                    $x = 35;
+                }
+            }
+        }
+        $x = $x * $y;
+    } else {
+        $a = 55;
+    }
+    return 7;
+}
+
+// step15: generated
+function step15($a) {
+    $x = 87 - 74;
+    $y = 22;
+    $x = 84 * $x - 18;
+    if ($a > 1) {
+        $x = $x - $y + 71;
+        // step 1516
+        $y = $x;
+    } else {
+        if ($x < 87) {
+            $a = 39 - 68 * 84;
+            if ($x > 33) {
+                $a = 86 - $x - step12($x);
+            }
+            if ($y > 73) {
+                if ($y < 9) {
+                    $y = 19;
+                }
+                // step 1528
+                $a = step7($y, $a);
+                step12($x);
+            }
+            step2($a, $a);
+        } else {
+            if ($a > 41) {
+                if ($a < 37) {
+                    $a = 70;
+                    // step 1537
+                    $a = 28 - $y * $x;
+                }
+            } else {
+                step4($x, $y);
+                if ($y > 68) {
+                    // step 1543
+                    $a = $a * $a * step14($a, $x);
+                } else {
+                    $y = 78;
+                }
+                for ($i4 = 0; $i4 < 17; $i4++) {
+                    // step 1549
+                    $y = 72;
+                }
+            }
+        }
+        step5($x, $y);
+        if ($a == 52) {
+            if ($y > 37) {
+                for ($i4 = 0; $i4 < 36; $i4++) {
+                    $y = 22;
+                    // step 1559
+                    $i4 = $a + $x;
+                }
+                $x = 0 - $y;
+                step1($x, $a);
+            } else {
+                for ($i4 = 0; $i4 < 62; $i4++) {
+                    $x = 77;
+                    // step 1567
+                    $y = step0($y) * $x;
+                }
+            }
+            $y = $x * $y - 44;
+            $y = $a * $a + 55;
+            if ($y > 76) {
+                if ($x == 96) {
+                    $a = $y * 93;
+                } else {
+                    $a = $y - $y * 92;
+                }
+            }
+        }
+        $x = $x - 56;
+    }
+    step14($x, $y);
+    $y = 61;
+    $y = 36 * step2($x, $x);
+    return step10($a, $x) + 32;
+}
+
+// step16: generated
+function step16($a, $b) {
+    $x = $a - 58 - $b;
+    $y = 33;
+    if ($y == 44) {
+        // step 1594
+        $x = $a * $y;
+        if ($a == 35) {
+            $x = 66 * step3($y);
+        } else {
+            $x = $b;
+        }
+        $a = $a + $b;
+        $a = 6 + 8;
+    }
+    if ($x > 50) {
+        for ($i2 = 0; $i2 < 74; $i2++) {
+            $a = step11($x, $a) * $x + $y;
+            // step 1607
+            $b = 50;
+            $i2 = 46 + $y - $x;
+            for ($i3 = 0; $i3 < 84; $i3++) {
+                if ($i3 == 66) {
+                    step14($i2, $y);
+                    $b = 68 - $a;
+                    $a = step8($y, $x) + step8($b, $i3);
+                }
+            }
+        }
+        for ($i2 = 0; $i2 < 12; $i2++) {
+            if ($b > 25) {
+                $i2 = 54 + $y;
+            } else {
+                if ($x == 84) {
+                    step3($b);
+                }
+                for ($i4 = 0; $i4 < 10; $i4++) {
+                    $x = step12($b) * $y - $y;
+                    $i2 = $y * $x - 43;
+                    $y = $i2 * step14($i2, $x) - 46;
+                }
+            }
+            if ($y < 87) {
+                if ($i2 == 99) {
+                    // step 1633
+                    $b = 85 - step11($b, $i2) * 26;
+                } else {
+                    // step 1636
+                    $i2 = $i2;
+                    // step 1638
+                    $x = $a;
+                }
+            }
+        }
+        if ($y < 84) {
+            $a = $x + $b * 83;
+            $y = $b + 90;
+            for ($i3 = 0; $i3 < 99; $i3++) {
+                step2($y, $b);
+            }
+            $x = 37 - $y + $y;
+        }
+        $x = 93 * $x * $a;
+    }
+    step10($y, $x);
+    if ($b == 92) {
+        $y = $x;
+        $x = $a;
+        $a = $a;
+    } else {
+        for ($i2 = 0; $i2 < 13; $i2++) {
+            step13($i2, $y);
+        }
+        if ($x < 22) {
+            step13($y, $b);
+        }
+    }
+    step4($a, $a);
+    $a = 66 + $x - $x;
+    $b = 20 - $b + $x;
+    for ($i1 = 0; $i1 < 83; $i1++) {
+        for ($i2 = 0; $i2 < 29; $i2++) {
+            step10($x, $b);
+            for ($i3 = 0; $i3 < 50; $i3++) {
+                step11($i1, $b);
+            }
+            step4($x, $x);
+            for ($i3 = 0; $i3 < 28; $i3++) {
+                $b = step7($x, $x);
+                for ($i4 = 0; $i4 < 76; $i4++) {
+                    $i4 = 71;
+                }
+            }
+        }
+        for ($i2 = 0; $i2 < 51; $i2++) {
+            for ($i3 = 0; $i3 < 50; $i3++) {
+                if ($y < 8) {
+                    $x = 94;
+                } else {
+                    $i1 = $i2 * $y;
+                }
+                if ($i2 == 42) {
+                    step6($x);
+                }
+                $y = $i3 + $i1 * $i2;
+            }
+            step5($i1, $a);
+            if ($b < 28) {
+                // step 1697
+                $x = 24 + 8 * $i1;
+            }
+        }
+        if ($y < 34) {
+            // step 1702
+            $x = 27 + 29 * $a;
+            if ($b == 27) {
+                if ($y < 23) {
+                    // step 1706
+                    $b = $i1;
+                }
+            }
+            // step 1710
+            $i1 = $i1 - step9($a);
+            // step 1712
+            $i1 = 89;
+        } else {
+            for ($i3 = 0; $i3 < 61; $i3++) {
+                $i1 = $i1 + $y * $b;
+                $b = 45 + $y;
+            }
+        }
+    }
+    return $a - $y;
+}
+
+// step17: generated
+function step17($a, $b) {
+    $x = $a * 23 + 78;
+    $y = 82;
+    if ($y == 90) {
+        // step 1729
+        $x = $b;
+    }
+    if ($y > 43) {
+        if ($y > 84) {
+            step12($a);
+            if ($y > 83) {
+                // step 1736
+                $b = 1 - 99 - 58;
+                if ($a < 35) {
+                    step7($y, $b);
+                }
+            } else {
+                $b = 10 * 87 - $x;
+            }
+            for ($i3 = 0; $i3 < 45; $i3++) {
+                if ($a > 87) {
+                    // step 1746
+                    $i3 = $a - 4 * $a;
+                } else {
+                    $x = $a;
+                }
+                for ($i4 = 0; $i4 < 55; $i4++) {
+                    // step 1752
+                    $a = $x * $b - $a;
+                }
+            }
+            for ($i3 = 0; $i3 < 10; $i3++) {
+                if ($y < 77) {
+                    // step 1758
+                    $i3 = $i3 - $x + $b;
+                }
+            }
+        }
+        if ($b > 56) {
+            for ($i3 = 0; $i3 < 41; $i3++) {
+                step8($i3, $y);
+            }
+            for ($i3 = 0; $i3 < 44; $i3++) {
+                $i3 = step8($x, $a) * $y;
+            }
+            $y = $a + step9($a);
+        }
+        if ($x > 47) {
+            $y = $x * $y;
+            $x = step11($y, $y) * $y;
+            step1($b, $y);
+        } else {
+            step0($x);
+            $x = $x;
+        }
+        // step 1780
+        $y = 60 * 22;
+    } else {
+        for ($i2 = 0; $i2 < 42; $i2++) {
+            for ($i3 = 0; $i3 < 50; $i3++) {
+                for ($i4 = 0; $i4 < 92; $i4++) {
+                    // step 1786
+                    $a = 86 - $y;
+                    step11($i2, $i2);
+                    // step 1789
+                    $i3 = step4($y, $a);
+                }
+                // step 1792
+                $b = $a - $i3;
+                if ($b > 21) {
+                    // step 1795
+                    $i2 = $x + step9($x) + $b;
+                    // step 1797
+                    $a = 38;
+                    $x = $i2 * 81 - $y;
+                } else {
+                    // step 1801
+                    $y = $i2;
+                }
+            }
+            $y = 62 + 20 * $i2;
+        }
+        if ($x > 56) {
+            if ($y == 26) {
+                $y = 35 + $y;
+                if ($b == 98) {
+                    $a = 27;
+                    // step 1812
+                    $a = $b * $x;
+                }
+            } else {
+                $y = step9($b) * 53 * $y;
+            }
+        }
+        for ($i2 = 0; $i2 < 45; $i2++) {
+            $a = 74 - 34;
+            if ($y == 41) {
+                if ($b > 50) {
+                    // step 1823
+                    $b = 13 - $a * step1($a, $b);
+                }
+                if ($x > 76) {
+                    $x = $a * $i2;
+                    // step 1828
+                    $b = 95;
+                    $i2 = step11($y, $x) - 70;
+                } else {
+                    // step 1832
+                    $y = $x - 74;
+                    // step 1834
+                    $b = $b - 3;
+                    $i2 = $y - 86 - $x;
+                }
+                $a = 9 + 60;
+            }
+            step4($a, $a);
+            $a = $i2 - $b + $i2;
+        }
+        step7($a, $y);
+    }
+    $x = step11($y, $y) - step6($a);
+    $x = $y;
+    return 74 - 43;
+}
+
+// step18: generated
+function step18($a) {
+    $x = 63 + 90;
+    $y = 41;
+    $x = $x - 30 + $x;
+    $x = 78 * $y;
+    if ($y < 32) {
+        if ($x > 99) {
+            step1($a, $x);
+        }
+        for ($i2 = 0; $i2 < 50; $i2++) {
+            step9($a);
+        }
+        if ($x > 80) {
+            step10($a, $x);
+            $x = $x;
+            if ($y < 13) {
+                $x = $a * $a + 22;
+                for ($i4 = 0; $i4 < 84; $i4++) {
+                    // step 1869
+                    $a = 46;
+                    $i4 = $i4 + $x - 0;
+                    // step 1872
+                    $y = 99 * 20;
+                }
+                for ($i4 = 0; $i4 < 65; $i4++) {
+                    $a = $y + 50;
+                    $y = $i4 * $y;
+                }
+            } else {
+                for ($i4 = 0; $i4 < 82; $i4++) {
+                    // step 1881
+                    $y = 24;
+                }
+                $y = 49 + $y + $a;
+                if ($x == 75) {
+                    $x = $a;
+                } else {
+                    $x = step0($a) - 73;
+                }
+            }
+        }
+        $a = 52;
+    }
+    if ($y == 59) {
+        // step 1895
+        $y = step1($x, $a) * step10($x, $a) * step1($x, $x);
+        $a = $y + $a - $y;
+    }
+    step4($a, $x);
+    if ($x < 73) {
+        step0($a);
+        $a = $y;
+    }
+    $a = 33;
+    step17($a, $a);
+    return $y - 51 * 43;
+}
+
+// step19: generated
+function step19($a, $b) {
+    $x = $b * $b - $b;
+    $y = 8;
+    step16($x, $b);
+    if ($x == 48) {
+        step5($x, $b);
+        // step 1916
+        $x = 72 - $y * $y;
+        $b = $a + step10($a, $b);
+    } else {
+        // step 1920
+        $b = $b - $y - 96;
+        $a = 59 * step11($a, $x) * $y;
+    }
+    if ($b == 2) {
+        $b = 14 - $a;
+        if ($a == 89) {
+            $y = $b + 55 * 10;
+            if ($a < 88) {
+                for ($i4 = 0; $i4 < 39; $i4++) {
+                    // step 1930
+                    $a = 97 - $b + step16($b, $x);
+                    // step 1932
+                    $x = $a - $y - $a;
+                    // step 1934
+                    $a = step10($x, $y) + $i4;
+                }
+            }
+        }
+        if ($a == 28) {
+            if ($b < 87) {
+                if ($x < 12) {
+                    $x = $b + 27 * step17($x, $b);
+                    $x = $x + $x - $b;
+                } else {
+                    // step 1945
+                    $x = 79;
+                    // step 1947
+                    $a = $b * $a * $y;
+                }
+                // step 1950
+                $b = 78;
+            }
+            step3($a);
+        }
+    } else {
+        $a = step6($a) * $b - $x;
+        // step 1957
+        $y = $x + $x;
+        if ($x == 59) {
+            step7($x, $b);
+            step12($b);
+            $a = $x;
+        } else {
+            step0($a);
+            if ($y > 35) {
+                $b = 64 + 58 - $y;
+            }
+        }
+    }
+    return 35 + $b;
+}
+
+// step20: generated
+function step20($a, $b) {
+    $x = $b + $a * $b;
+    $y = 83;
+    if ($a < 8) {
+        if ($x == 12) {
+            for ($i3 = 0; $i3 < 61; $i3++) {
+                if ($b == 36) {
+                    // step 1981
+                    $b = step11($i3, $b);
+                    // step 1983
+                    $b = 44;
+                }
+            }
+            if ($a == 72) {
+                if ($b > 59) {
+                    // step 1989
+                    $b = 48;
+                    // step 1991
+                    $y = $x * 77;
+                    // step 1993
+                    $b = $y;
+                }
+            } else {
+                $b = 59 - step15($b) - 70;
+                $a = 67 * 52;
+            }
+        }
+        // step 2001
+        $y = step8($b, $x) + step9($y);
+        if ($a == 55) {
+            step11($a, $y);
+        }
+        for ($i2 = 0; $i2 < 54; $i2++) {
+            if ($y == 94) {
+                $b = step5($x, $y);
+            } else {
+                if ($a < 38) {
+                    // step 2011
+                    $b = $y;
+                }
+            }
+            if ($i2 < 5) {
+                $y = 87 * 0;
+                // step 2017
+                $x = $b - $i2;
+                if ($y == 59) {
+                    // step 2020
+                    $i2 = $i2;
+                    $y = 84 + $i2;
+                } else {
+                    // step 2024
+                    $i2 = 71 + step1($b, $x) + 97;
+                    // step 2026
+                    $i2 = 40 - $a;
+                }
+            } else {
+                if ($x == 43) {
+                    // step 2031
+                    $y = step7($b, $b) + $x * 65;
+                    $x = $b * 34 - step17($b, $x);
+                    step9($b);
+                }
+                if ($b < 80) {
+                    // step 2037
+                    $b = $i2;
+                    step13($b, $x);
+                } else {
+                    // step 2041
+                    $a = $i2;
+                }
+            }
+            $y = $i2 + $b;
+            if ($b < 65) {
+                $b = $a - 41;
+            } else {
+                // step 2049
+                $i2 = 47;
+                if ($y > 28) {
+                    $a = 52;
+                    $a = 95;
+                    // step 2054
+                    $y = step15($b);
+                }
+            }
+        }
+    }
+    $a = $a - 82 * $a;
+    if ($x == 74) {
+        if ($y > 76) {
+            // step 2063
+            $y = $y - 64 - 93;
+            for ($i3 = 0; $i3 < 66; $i3++) {
+                step11($y, $y);
+            }
+            $y = step5($b, $a) * $b + step17($a, $b);
+        } else {
+            if ($b == 39) {
+                if ($x == 51) {
+                    // step 2072
+                    $y = 90 + step3($y);
+                } else {
+                    // step 2075
+                    $x = 52 * $a;
+                }
+            }
+        }
+        if ($b == 3) {
+            // step 2081
+            $x = 31 - $y + 46;
+        }
+        if ($y > 84) {
+            if ($y == 89) {
+                for ($i4 = 0; $i4 < 40; $i4++) {
+                    // step 2087
+                    $a = $b * 4 * $x;
+                }
+            } else {
+                $b = 90;
+                // step 2092
+                $a = $y - 67;
+            }
+        } else {
+            for ($i3 = 0; $i3 < 33; $i3++) {
+                if ($a > 31) {
+                    $x = 85 - 10 - step19($x, $x);
+                    // step 2099
+                    $i3 = $x;
+                    $x = 30 + $i3;
+                } else {
+                    $a = 73;
+                    // step 2104
+                    $y = $b + step3($a);
+                    $i3 = $x;
+                }
+                $i3 = $y + $b + 5;
+            }
+            if ($b == 8) {
+                step2($y, $x);
+                $y = $b * 55;
+                if ($a > 8) {
+                    // step 2114
+                    $b = $x * 0 * step5($a, $a);
+                    // step 2116
+                    $y = $x * $b + 10;
+                    // step 2118
+                    $b = $a;
+                }
+            }
+            step18($x);
+        }
+        for ($i2 = 0; $i2 < 75; $i2++) {
+            if ($i2 > 78) {
+                // step 2126
+                $y = 51;
+            }
+            if ($a > 85) {
+                if ($y > 29) {
+                    // step 2131
+                    $x = 12 + $b;
+                }
+                $y = $b * $x;
+            }
+        }
+    } else {
+        if ($a == 98) {
+            if ($x > 35) {
+                step11($x, $y);
+            } else {
+                $a = $y - $y;
+            }
+            step4($x, $x);
+            if ($x == 31) {
+                step5($a, $x);
+            }
+        }
+        step1($b, $b);
+        $b = $a + 44;
+    }
+    return $b;
+}
+
+// step21: generated
+function step21($a) {
+    $x = $a;
+    $y = 28;
+    $x = $a + $y;
+    $y = step14($y, $y) + step5($x, $y);
+    if ($x < 67) {
+        for ($i2 = 0; $i2 < 16; $i2++) {
+            step10($y, $i2);
+            if ($x > 39) {
+                step2($a, $i2);
+                if ($y < 94) {
+                    step20($y, $x);
+                    $i2 = $y;
+                    // step 2169
+                    $a = 85 * $x;
+                }
+                if ($x > 84) {
+                    $x = 63 * $a - $y;
+                    // step 2174
+                    $i2 = step10($y, $x) + $a * $y;
+                    $a = 90 - 19 + step7($y, $y);
+                }
+            } else {
+                // step 2179
+                $a = 40 + step10($y, $x) - step2($y, $i2);
+                if ($y == 4) {
+                    step19($x, $y);
+                } else {
+                    $x = $i2 * step12($i2) - $a;
+                }
+                for ($i4 = 0; $i4 < 74; $i4++) {
+                    $y = step1($i4, $x) * $x;
+                    // step 2188
+                    $y = step18($i4);
+                    // step 2190
+                    $y = $i4 + 56;
+                }
+            }
+        }
+        $a = $x;
+    } else {
+        if ($a == 44) {
+            $y = 47;
+            $y = 4 * 75;
+        } else {
+            if ($a < 4) {
+                $y = $x * $x;
+            }
+            $y = 93 + $a + 79;
+            // step 2205
+            $a = $a - 34 * $a;
+            if ($y == 78) {
+                if ($y < 41) {
+                    $y = step6($a) * $x - step13($x, $x);
+                }
+            }
+        }
+        if ($x < 85) {
+            for ($i3 = 0; $i3 < 50; $i3++) {
+                // step 2215
+                $y = 95 * $a * $a;
+                $x = 17 - step11($y, $a) * 73;
+            }
+        } else {
+            if ($y == 48) {
+                step8($y, $y);
+                if ($y < 18) {
+                    // step 2223
+                    $a = 45 + $a;
+                }
+                if ($x > 10) {
+                    // step 2227
+                    $y = $x + 19;
+                }
+            }
+            // step 2231
+            $y = 17;
+            if ($x < 8) {
+                $y = 39 * step17($a, $y) * 58;
+            } else {
+                if ($y == 12) {
+                    // step 2237
+                    $y = 38 + 8 + $x;
+                    $y = $x - $a;
+                }
+            }
+        }
+    }
+    if ($a > 91) {
+        if ($a == 0) {
+            $a = $y * step18($x) - $a;
+            step0($a);
+        } else {
+            step4($x, $x);
+        }
+        if ($x > 61) {
+            if ($x < 20) {
+                // step 2253
+                $x = 48;
+                $x = step5($x, $x);
+            }
+            if ($y > 66) {
+                if ($y < 16) {
+                    // step 2259
+                    $y = $a + 91;
+                    // step 2261
+                    $x = 78 + $a;
+                }
+            } else {
+                step4($y, $x);
+            }
+        }
+    } else {
+        if ($y > 78) {
+            step15($y);
+            $x = 66;
+            step18($y);
+            for ($i3 = 0; $i3 < 62; $i3++) {
+                step20($x, $a);
+                // step 2275
+                $y = $y - 44;
+            }
+        }
+        $x = $a - $x;
+        $a = $y;
+        step6($a);
+    }
+    return step6($x) * 47 * 86;
+}
+
+// step22: generated
+function step22($a, $b) {
+    $x = $b - 2 + 20;
+    $y = 22;
+    step8($x, $a);
+    $y = step13($a, $x) * $b + $a;
+    $x = $y - 10;
+    if ($b < 40) {
+        if ($b > 69) {
+            // step 2295
+            $b = $a;
+        }
+        // step 2298
+        $b = 10 * step2($x, $a);
+    }
+    step19($x, $y);
+    for ($i1 = 0; $i1 < 81; $i1++) {
+        step20($a, $y);
+        $a = 78 * step5($i1, $a) + $i1;
+        for ($i2 = 0; $i2 < 4; $i2++) {
+            $a = step8($b, $i1) + step14($b, $y) * 87;
+            step10($x, $b);
+            if ($i1 == 59) {
+                step6($i1);
+                $x = $a;
+                for ($i4 = 0; $i4 < 48; $i4++) {
+                    // step 2312
+                    $i2 = $y * $a * 71;
+                    // step 2314
+                    $i2 = $y;
+                    step0($i2);
+                }
+            } else {
+                // step 2319
+                $a = $y - 33;
+                $i1 = 35;
+            }
+        }
+        step8($x, $a);
+    }
+    return 60 * 36 + $x;
+}
+
+// step23: generated
+function step23($a, $b) {
+    $x = $a + $b + $b;
+    $y = 47;
+    $y = 28 - $b + $x;
+    if ($b == 77) {
+        for ($i2 = 0; $i2 < 66; $i2++) {
+            step2($a, $i2);
+        }
+        step17($a, $a);
+        if ($b == 81) {
+            // step 2340
+            $b = $y * $b;
+            $a = $a;
+        } else {
+            $y = 77 - 61 * step22($a, $y);
+            if ($b > 10) {
+                if ($x == 74) {
+                    // step 2347
+                    $b = $x;
+                    // step 2349
+                    $b = 94;
+                } else {
+                    // step 2352
+                    $a = step19($b, $x);
+                    step1($a, $b);
+                    step22($x, $x);
+                }
+            }
+            $b = 86;
+            // step 2359
+            $x = $x + 63;
+        }
+    } else {
+        // step 2363
+        $b = $x * 96 - $y;
+    }
+    $y = $a + step8($a, $y) * $x;
+    $a = $a;
+    if ($y > 56) {
+        // step 2369
+        $b = 27 * 9 - $y;
+        $x = $y + 34;
+    } else {
+        $y = $b;
+        $a = 76 - 85;
+    }
+    for ($i1 = 0; $i1 < 36; $i1++) {
+        $i1 = 77 - $y;
+    }
+    $a = step2($y, $b);
+    return $y;
+}
+
+// step24: generated
+function step24($a) {
+    $x = 84 - $a + 10;
+    $y = 34;
+    step4($x, $a);
+    if ($a > 76) {
+        $y = 83 - 6 + $a;
+        for ($i2 = 0; $i2 < 54; $i2++) {
+            step4($a, $y);
+        }
+        $a = 34;
+        $a = 49;
+    } else {
+        // step 2396
+        $a = $x;
+    }
+    $a = $a * $a - 27;
+    if ($x == 89) {
+        $a = 63 + $a + 48;
+    }
+    if ($a < 52) {
+        $a = 36;
+        $x = $a;
+    }
+    if ($a > 14) {
+        step11($a, $y);
+        step5($a, $x);
+        $x = 47;
+        $y = $y * step12($y);
+    } else {
+        step17($y, $x);
+        for ($i2 = 0; $i2 < 60; $i2++) {
+            for ($i3 = 0; $i3 < 33; $i3++) {
+                if ($i3 > 91) {
+                    step11($i2, $y);
+                } else {
+                    $x = 58 - $y;
+                }
+            }
+            step11($y, $x);
+            // step 2423
+            $i2 = $x * $a - $a;
+        }
+    }
+    if ($x < 50) {
+        $y = $x * $a * $y;
+        // step 2429
+        $a = $y + $x;
+    } else {
+        $y = 98 + 87 * 63;
+        if ($y > 6) {
+            if ($x > 7) {
+                for ($i4 = 0; $i4 < 83; $i4++) {
+                    // step 2436
+                    $x = $y * 7 * 33;
+                    $x = $i4;
+                }
+                for ($i4 = 0; $i4 < 83; $i4++) {
+                    $y = 93 + 58 + $y;
+                }
+            } else {
+                // step 2444
+                $y = 27 - 72;
+            }
+            step23($a, $y);
+        }
+        $a = $a;
+    }
+    return step11($y, $x);
+}
+
+// step25: generated
+function step25($a, $b) {
+    $x = 79 * $a;
+    $y = 24;
+    // step 2458
+    $b = $x;
+    step9($y);
+    $y = 87 + step17($a, $a);
+    return step9($x);
+}
+
+// step26: generated
+function step26($a, $b) {
+    $x = $a * $b * 21;
+    $y = 31;
+    $x = 29;
+    step8($x, $y);
+    step21($x);
+    if ($x > 11) {
+        $b = 23;
+    }
+    return 35 * $y;
+}
+
+// step27: generated
+function step27($a) {
+    $x = $a + $a + 53;
+    $y = 44;
+    $y = 36 + 17;
+    for ($i1 = 0; $i1 < 79; $i1++) {
+        step20($x, $y);
+        $x = $y + 6;
+        if ($a == 22) {
+            // step 2487
+            $y = $y + $x;
+        } else {
+            for ($i3 = 0; $i3 < 22; $i3++) {
+                // step 2491
+                $y = 23;
+            }
+            $x = 68;
+            step5($a, $a);
+        }
+    }
+    if ($x < 47) {
+        if ($y < 94) {
+            $x = step5($x, $x);
+            if ($x == 99) {
+                if ($x < 20) {
+                    step14($x, $x);
+                }
+            } else {
+                $y = 3;
+            }
+        }
+        if ($x < 5) {
+            for ($i3 = 0; $i3 < 69; $i3++) {
+                for ($i4 = 0; $i4 < 40; $i4++) {
+                    // step 2512
+                    $i4 = step23($i4, $i4) * 31;
+                }
+            }
+            for ($i3 = 0; $i3 < 90; $i3++) {
+                $i3 = 88 - $i3;
+                // step 2518
+                $y = 78 - 41;
+                if ($y == 47) {
+                    // step 2521
+                    $x = $a * $y;
+                    step17($a, $a);
+                } else {
+                    step25($x, $x);
+                }
+            }
+            step5($y, $y);
+        } else {
+            for ($i3 = 0; $i3 < 99; $i3++) {
+                for ($i4 = 0; $i4 < 44; $i4++) {
+                    step24($a);
+                }
+                for ($i4 = 0; $i4 < 25; $i4++) {
+                    $a = 32;
+                }
+            }
+            $x = $a - $a * $y;
+            for ($i3 = 0; $i3 < 16; $i3++) {
+                if ($x == 20) {
+                    // step 2541
+                    $i3 = 5;
+                    $i3 = $a;
+                } else {
+                    // step 2545
+                    $i3 = 57 * $y;
+                }
+            }
+            if ($a < 76) {
+                $x = 95 - $a * 34;
+                $a = 83 * $a;
+            }
+        }
+        $x = 83;
+        if ($x > 59) {
+            $x = 15 + $x;
+        } else {
+            for ($i3 = 0; $i3 < 36; $i3++) {
+                if ($a < 5) {
+                    step10($a, $i3);
+                } else {
+                    // step 2562
+                    $y = $x - 53;
+                }
+                $i3 = $x;
+            }
+            // step 2567
+            $a = 88 * 34 + $y;
+            for ($i3 = 0; $i3 < 9; $i3++) {
+                if ($i3 > 13) {
+                    // step 2571
+                    $x = $a;
+                } else {
+                    // step 2574
+                    $a = $x - step1($a, $y) - step21($y);
+                    $x = 76 + $x * $x;
+                }
+            }
+            $x = 40 * $y * $a;
+        }
+    }
+    // step 2582
+    $x = 59 - $x;
+    if ($y == 94) {
+        if ($x == 45) {
+            for ($i3 = 0; $i3 < 41; $i3++) {
+                for ($i4 = 0; $i4 < 18; $i4++) {
+                    // step 2588
+                    $a = $i3 - 33 - step10($a, $i3);
+                }
+                if ($i3 > 43) {
+                    // step 2592
+                    $i3 = 83 - 11;
+                    $x = $y;
+                    // step 2595
+                    $y = 15 - $i3 - $i3;
+                }
+                step19($a, $i3);
+            }
+            step9($y);
+            $a = $y;
+        } else {
+            $x = $y - $a;
+        }
+    }
+    $x = 27;
+    for ($i1 = 0; $i1 < 67; $i1++) {
+        // step 2608
+        $a = $a;
+        for ($i2 = 0; $i2 < 72; $i2++) {
+            $x = 73 - step8($y, $a);
+            if ($i1 < 83) {
+                step8($a, $x);
+                // step 2614
+                $y = $x - $x + $i2;
+            } else {
+                if ($x > 46) {
+                    $y = $i2 * $a;
+                }
+                $a = $i1;
+                $x = $i1;
+            }
+        }
+        step22($i1, $i1);
+    }
+    return step14($x, $a) + $a;
+}
+
+// step28: generated
+function step28($a, $b) {
+    $x = $a;
+    $y = 2;
+    // step 2633
+    $x = 89 - step22($x, $a) + 83;
+    step15($a);
+    if ($y < 97) {
+        $a = 19 * $y - $b;
+        $y = $b * 0 * $b;
+        if ($x > 24) {
+            if ($x > 32) {
+                // step 2641
+                $x = $b + $y;
+            }
+            step19($b, $b);
+            $a = 97 + $a * $x;
+            $a = $b - 25;
+        } else {
+            $y = $a;
+            $x = step14($b, $y) - 73;
+        }
+        $x = 44 - 76 - $b;
+    } else {
+        step13($a, $x);
+        if ($y < 18) {
+            $y = $x;
+        }
+    }
+    $a = $x - step19($y, $b);
+    if ($x > 17) {
+        $x = 26 + 40;
+    }
+    return 27 * 90;
+}
+
+// step29: generated
+function step29($a, $b) {
+    $x = 74 + $a;
+    $y = 17;
+    step27($y);
+    $x = $y;
+    if ($a > 46) {
+        step21($b);
+    }
+    $y = step4($y, $y) * 83;
+    step28($y, $x);
+    return step12($b);
+}
+
+// step30: generated
+function step30($a) {
+    $x = 91 - $a * $a;
+    $y = 91;
+    step17($a, $x);
+    for ($i1 = 0; $i1 < 0; $i1++) {
+        // step 2685
+        $i1 = 61;
+        // step 2687
+        $i1 = $a * $x - $a;
+    }
+    if ($x < 74) {
+        for ($i2 = 0; $i2 < 53; $i2++) {
+            $i2 = $i2 - 66 + step17($a, $y);
+            $y = 91;
+        }
+        if ($y == 22) {
+            step23($y, $a);
+            if ($a == 35) {
+                if ($x < 30) {
+                    // step 2699
+                    $a = $a + $x;
+                    // step 2701
+                    $x = 96;
+                }
+                for ($i4 = 0; $i4 < 9; $i4++) {
+                    step11($i4, $i4);
+                }
+                step27($a);
+            } else {
+                for ($i4 = 0; $i4 < 41; $i4++) {
+                    // step 2710
+                    $a = 51;
+                    // step 2712
+                    $a = 37 * 23;
+                    $a = step4($i4, $x) + $y * step13($y, $x);
+                }
+            }
+            if ($a < 80) {
+                // step 2718
+                $y = $a + 19;
+                if ($x == 78) {
+                    // step 2721
+                    $x = 15 - $a - $a;
+                    // step 2723
+                    $y = $a;
+                    // step 2725
+                    $a = step29($x, $x);
+                }
+                for ($i4 = 0; $i4 < 1; $i4++) {
+                    // step 2729
+                    $x = step1($i4, $i4) * 72;
+                    // step 2731
+                    $i4 = $a + 42;
+                }
+            }
+            if ($a > 18) {
+                for ($i4 = 0; $i4 < 0; $i4++) {
+                    // step 2737
+                    $x = $y - step11($i4, $a);
+                    $y = $i4;
+                    $a = 2;
+                }
+                $a = 98 + $x * 22;
+            }
+        } else {
+            step19($y, $x);
+            $x = step15($x) + $a;
+            $a = $y;
+        }
+        if ($x > 22) {
+            $y = 73;
+            step1($y, $a);
+            $y = $a - 57;
+            for ($i3 = 0; $i3 < 86; $i3++) {
+                if ($y == 57) {
+                    $a = 13;
+                } else {
+                    $a = $i3 * 19;
+                }
+                step23($y, $x);
+                // step 2760
+                $a = 65 + 0;
+            }
+        } else {
+            step22($y, $a);
+            $a = $x * step18($y) * $x;
+        }
+    } else {
+        $a = 26 * step19($a, $y) * step10($y, $y);
+    }
+    // step 2770
+    $y = $x;
+    // step 2772
+    $y = step16($a, $x) + $a * $y;
+    if ($y == 88) {
+        if ($a == 10) {
+            $a = 20 * step4($y, $x) + 97;
+            $y = $a - 95;
+            if ($y > 79) {
+                if ($y < 28) {
+                    $x = $a * $y - $a;
+                    // step 2781
+                    $y = step19($x, $y) - $x * $x;
+                } else {
+                    // step 2784
+                    $x = $a;
+                    // step 2786
+                    $y = 52 - 21 * step16($a, $a);
+                }
+                $a = 88;
+                for ($i4 = 0; $i4 < 58; $i4++) {
+                    step28($i4, $i4);
+                    $y = $y;
+                    $i4 = $y * 45 - $x;
+                }
+            }
+            // step 2796
+            $x = 85 + 84;
+        }
+    } else {
+        if ($x == 9) {
+            // step 2801
+            $x = $x + $x;
+            // step 2803
+            $x = 35 * $a;
+            if ($a > 23) {
+                if ($y > 29) {
+                    // step 2807
+                    $a = 42 * $x;
+                } else {
+                    // step 2810
+                    $x = $x - $y;
+                }
+            }
+            for ($i3 = 0; $i3 < 2; $i3++) {
+                $y = 46;
+                step28($i3, $i3);
+                $i3 = $i3;
+            }
+        }
+        if ($a > 20) {
+            for ($i3 = 0; $i3 < 94; $i3++) {
+                for ($i4 = 0; $i4 < 46; $i4++) {
+                    // step 2823
+                    $y = 90 - $i3;
+                }
+            }
+            step16($x, $y);
+            if ($y < 61) {
+                if ($a > 13) {
+                    // step 2830
+                    $a = $x + step16($a, $x);
+                    step26($y, $x);
+                    // step 2833
+                    $x = 65 * $x;
+                }
+            }
+            $a = $y - $x;
+        }
+        $y = step11($y, $y);
+    }
+    $y = step25($y, $y) * $x;
+    if ($a == 50) {
+        for ($i2 = 0; $i2 < 80; $i2++) {
+            if ($i2 == 4) {
+                step4($x, $a);
+                $i2 = $y;
+                // step 2847
+                $x = step13($a, $y) * 70 * 24;
+            }
+            $y = $y;
+        }
+        // step 2852
+        $y = 37;
+        for ($i2 = 0; $i2 < 42; $i2++) {
+            if ($i2 < 39) {
+                if ($y > 93) {
+                    step25($a, $a);
+                    // step 2858
+                    $a = $x + 72 + step20($y, $x);
+                } else {
+                    $x = step0($a) + $y - $i2;
+                    // step 2862
+                    $i2 = 20 - $a;
+                    // step 2864
+                    $y = $a;
+                }
+                for ($i4 = 0; $i4 < 32; $i4++) {
+                    $i2 = $a;
+                }
+            }
+        }
+        step25($y, $y);
+    }
+    return 51 * step22($y, $a) + 89;
+}
+
+// step31: generated
+function step31($a, $b) {
+    $x = $b + $b;
+    $y = 29;
+    $y = 88;
+    $a = $a - step25($a, $a);
+    // step 2883
+    $b = $x - step4($y, $x);
+    $b = 92 - $a * 42;
+    for ($i1 = 0; $i1 < 99; $i1++) {
+        $i1 = 77;
+    }
+    if ($x > 92) {
+        step6($a);
+        if ($b < 45) {
+            // step 2892
+            $b = 16 + $y;
+            if ($x > 65) {
+                $b = 78 - $x;
+            }
+            if ($x < 77) {
+                $b = $a - $b;
+                $y = step13($x, $x) - $a;
+            } else {
+                step21($x);
+                // step 2902
+                $b = $y;
+            }
+            for ($i3 = 0; $i3 < 12; $i3++) {
+                step14($i3, $a);
+            }
+        } else {
+            $x = $b * 13 * 33;
+        }
+        if ($x < 46) {
+            if ($a > 42) {
+                for ($i4 = 0; $i4 < 6; $i4++) {
+                    step23($y, $y);
+                    step29($i4, $a);
+                }
+                // step 2917
+                $a = $b;
+                $x = step7($b, $b) + $a;
+            }
+            // step 2921
+            $x = step8($b, $a);
+            if ($b > 87) {
+                step1($y, $y);
+                $x = 67 + $a;
+            }
+            step8($a, $a);
+        }
+        for ($i2 = 0; $i2 < 57; $i2++) {
+            $y = step0($i2);
+        }
+    } else {
+        // step 2933
+        $x = $x + step8($x, $y);
+        $b = $a - $y + $x;
+        // step 2936
+        $a = $a;
+        $b = 35 + $a * $x;
+    }
+    return $a - 80;
+}
+
+// step32: generated
+function step32($a, $b) {
+    $x = $a + $b * $b;
+    $y = 99;
+    $b = step25($y, $x);
+    step8($y, $y);
+    if ($a > 66) {
+        for ($i2 = 0; $i2 < 12; $i2++) {
+            $y = $a * 73 + 72;
+            step22($i2, $y);
+            for ($i3 = 0; $i3 < 85; $i3++) {
+                for ($i4 = 0; $i4 < 37; $i4++) {
+                    $a = $i2 * step17($i2, $x);
+                }
+            }
+            $i2 = 2;
+        }
+    } else {
+        if ($x == 91) {
+            if ($x > 51) {
+                if ($y > 53) {
+                    // step 2964
+                    $a = $b * $b;
+                    $x = 99 * 92 * $x;
+                    $a = $x;
+                } else {
+                    // step 2969
+                    $x = $y - 84;
+                    // step 2971
+                    $b = 70;
+                    // step 2973
+                    $y = 47 * $x;
+                }
+            } else {
+                for ($i4 = 0; $i4 < 81; $i4++) {
+                    // step 2978
+                    $a = 8 - $y;
+                    $a = $b * 71;
+                    $y = 12 * step4($b, $b) * $a;
+                }
+                for ($i4 = 0; $i4 < 43; $i4++) {
+                    // step 2984
+                    $y = 45;
+                    $x = step21($a) * $y * step28($i4, $i4);
+                }
+                // step 2988
+                $x = $a * 41;
+            }
+            if ($a > 30) {
+                for ($i4 = 0; $i4 < 76; $i4++) {
+                    $a = 95 + step14($b, $a) + $x;
+                    // step 2994
+                    $x = step1($y, $b);
+                    step24($b);
+                }
+                $b = $y * $a;
+            }
+            $x = $y * $a;
+            if ($a < 40) {
+                $b = $y * 33;
+            }
+        }
+        $x = $y + $b;
+        if ($a > 20) {
+            // step 3007
+            $x = $x + 5 * $a;
+        }
+    }
+    $y = $a - 80;
+    $a = $x + step13($y, $b);
+    return $b;
+}
+
+// step33: generated
+function step33($a) {
+    $x = 92;
+    $y = 38;
+    if ($y > 78) {
+        $a = $x + $y + $y;
+    }
+    $a = 19 - $y;
+    $x = $x + $a;
+    if ($y == 21) {
+        $x = 85 - $a;
+    } else {
+        if ($y < 96) {
+            $a = 37 - $y;
+        } else {
+            $a = step31($a, $x);
+        }
+        $y = 26 - 45 + $y;
+    }
+    if ($y < 27) {
+        step3($x);
+        step15($y);
+        if ($x == 33) {
+            if ($a > 78) {
+                $y = step3($y) + $x * $x;
+                if ($y == 16) {
+                    step18($x);
+                }
+            } else {
+                if ($y == 13) {
+                    $y = $y - 21;
+                    step14($y, $a);
+                } else {
+                    $y = step6($a) * $y + 26;
+                }
+            }
+            if ($y == 45) {
+                // step 3053
+                $a = 29 - $x;
+                // step 3055
+                $y = $y + $a * $a;
+                $x = 83;
+            }
+        }
+    } else {
+        $a = 50 * $a * $x;
+        $a = $a * $y - $y;
+    }
+    if ($y > 80) {
+        step8($x, $y);
+    }
+    return $x * $x - $y;
+}
+
+// step34: generated
+function step34($a, $b) {
+    $x = $b * 45;
+    $y = 21;
+    for ($i1 = 0; $i1 < 68; $i1++) {
+        $b = step10($y, $b) - $y * $a;
+        if ($x > 59) {
+            $x = 53 + 44 + $x;
+            $x = $b;
+            if ($b < 67) {
+                if ($a > 73) {
+                    // step 3081
+                    $b = 37 * step0($x) * 5;
+                }
+                // step 3084
+                $i1 = $x;
+                step1($a, $i1);
+            } else {
+                if ($a == 0) {
+                    // step 3089
+                    $a = $b + $i1 + step2($b, $b);
+                    // step 3091
+                    $a = $b * 33;
+                    $y = 13 + $x;
+                } else {
+                    // step 3095
+                    $i1 = $b * step23($b, $b) - $y;
+                }
+                if ($a < 66) {
+                    $b = 43 - $y;
+                    // step 3100
+                    $a = 43;
+                    // step 3102
+                    $a = $b + step3($y) - $b;
+                }
+                for ($i4 = 0; $i4 < 39; $i4++) {
+                    $b = 52;
+                }
+            }
+        }
+        for ($i2 = 0; $i2 < 45; $i2++) {
+            if ($y < 6) {
+                if ($i2 < 89) {
+                    $i1 = 35 * $b;
+                    // step 3114
+                    $a = 81;
+                } else {
+                    // step 3117
+                    $a = 64 * $b;
+                    $x = $x;
+                    // step 3120
+                    $a = $x;
+                }
+            }
+            if ($x > 75) {
+                $i2 = 42;
+            } else {
+                for ($i4 = 0; $i4 < 8; $i4++) {
+                    // step 3128
+                    $a = $y * $b - 50;
+                    // step 3130
+                    $i2 = $y - 42;
+                }
+                $i2 = 98 + $x * $a;
+                $x = $b - 90 + $x;
+            }
+            $a = $b + $i2 - 47;
+        }
+    }
+    if ($a < 83) {
+        if ($y < 72) {
+            step21($a);
+            if ($b < 73) {
+                $b = $b * $b;
+            } else {
+                $x = $b * $x + $y;
+            }
+            if ($a < 52) {
+                step30($a);
+                if ($b < 21) {
+                    // step 3150
+                    $x = 27 * 1;
+                }
+                $x = $y - 70 + 79;
+            }
+            step25($a, $y);
+        } else {
+            $y = $b;
+        }
+        $a = $a + 98;
+        $a = 93;
+    } else {
+        $a = $y * $x - step20($a, $y);
+    }
+    if ($b == 90) {
+        if ($a > 14) {
+            $b = 16 + $b - step8($y, $a);
+            for ($i3 = 0; $i3 < 61; $i3++) {
+                step5($y, $a);
+                $x = $i3;
+                $a = $x;
+            }
+        }
+        for ($i2 = 0; $i2 < 56; $i2++) {
+            // step 3174
+            $y = $x + $x;
+        }
+        step23($x, $x);
+        if ($x < 11) {
+            if ($b == 17) {
+                // step 3180
+                $b = $b - step18($x);
+                if ($b < 50) {
+                    // step 3183
+                    $y = 69 + $y;
+                } else {
+                    step10($x, $x);
+                    $a = 59 - $y;
+                    // step 3188
+                    $y = step21($a);
+                }
+            } else {
+                $b = step26($y, $y) * 0;
+            }
+        }
+    }
+    $a = $a * $a;
+    if ($x < 71) {
+        if ($x > 34) {
+            // step 3199
+            $x = $y + $a * step16($y, $x);
+        }
+        if ($b == 85) {
+            $y = step22($x, $y);
+            $a = $x + 23;
+            // step 3205
+            $x = 91 * $y + 62;
+        }
+    }
+    return $x + $y;
+}
+
+// step35: generated
+function step35($a, $b) {
+    $x = $b - 45 * 12;
+    $y = 17;
+    if ($x == 90) {
+        $a = $b * step25($y, $y) + 63;
+        if ($x == 14) {
+            $y = 62 * $a * $b;
+            if ($y > 7) {
+                // step 3221
+                $x = $x + 79;
+                for ($i4 = 0; $i4 < 31; $i4++) {
+                    $y = $y + $y;
+                }
+            } else {
+                if ($b == 97) {
+                    // step 3228
+                    $a = $b + 61 - $a;
+                    $a = 8;
+                } else {
+                    // step 3232
+                    $b = $b;
+                }
+                step30($a);
+                if ($y > 38) {
+                    $y = $x * $x * 49;
+                    // step 3238
+                    $b = $x * $x * 23;
+                }
+            }
+            $y = 39 - step34($a, $y);
+            step13($y, $x);
+        }
+        // step 3245
+        $b = $y;
+    }
+    if ($x == 56) {
+        $b = $y - 13 - step10($b, $y);
+        if ($b > 68) {
+            for ($i3 = 0; $i3 < 41; $i3++) {
+                if ($b == 99) {
+                    step6($i3);
+                } else {
+                    // step 3255
+                    $y = 51;
+                    // step 3257
+                    $i3 = $y * $a * $i3;
+                    // step 3259
+                    $i3 = 51 - $b;
+                }
+            }
+            step18($b);
+            $a = 56;
+            if ($a == 91) {
+                $b = $x;
+                // step 3267
+                $y = 40;
+                $x = 7;
+            } else {
+                $b = $y;
+                // step 3272
+                $x = 31 + $y * 59;
+            }
+        } else {
+            $a = 31 - 49 + $y;
+            // step 3277
+            $x = $a;
+            $a = step26($b, $x) * $b * $x;
+            step28($y, $y);
+        }
+        for ($i2 = 0; $i2 < 48; $i2++) {
+            for ($i3 = 0; $i3 < 74; $i3++) {
+                $y = 83 - $i2 + $y;
+            }
+            for ($i3 = 0; $i3 < 40; $i3++) {
+                if ($x == 23) {
+                    $y = $y * $i2;
+                }
+                if ($i3 < 0) {
+                    $i3 = 5 * $x;
+                } else {
+                    step14($y, $a);
+                }
+            }
+            step3($x);
+        }
+    } else {
+        // step 3299
+        $a = step21($b) * $a;
+    }
+    $x = $a * step31($b, $b) * step11($y, $x);
+    return $b * step15($b) - step18($x);
+}
+
+// step36: generated
+function step36($a) {
+    $x = $a + $a;
+    $y = 79;
+    step31($a, $y);
+    // step 3311
+    $a = $a * 23 * $x;
+    $a = $x;
+    for ($i1 = 0; $i1 < 22; $i1++) {
+        step28($x, $i1);
+        if ($a < 27) {
+            if ($y == 75) {
+                for ($i4 = 0; $i4 < 4; $i4++) {
+                    $x = $i4 - $a;
+                }
+                if ($y == 93) {
+                    // step 3322
+                    $x = 97;
+                    // step 3324
+                    $a = 97 + 4 * $y;
+                }
+                if ($a < 25) {
+                    step22($y, $a);
+                } else {
+                    // step 3330
+                    $x = 86;
+                }
+            }
+            $x = 34;
+            if ($a < 44) {
+                step24($a);
+                if ($i1 > 49) {
+                    $a = $x + $i1 * step0($i1);
+                }
+            }
+            if ($i1 < 43) {
+                if ($a < 32) {
+                    // step 3343
+                    $y = 89 + $x - step21($i1);
+                    // step 3345
+                    $y = 14 + 56 - $y;
+                    $y = step18($x);
+                } else {
+                    step10($x, $x);
+                    // step 3350
+                    $i1 = 68 * $x - $a;
+                    // step 3352
+                    $x = 75 * $i1;
+                }
+            }
+        } else {
+            for ($i3 = 0; $i3 < 11; $i3++) {
+                $y = $y;
+                if ($i1 < 79) {
+                    $i3 = $x * $y + $i1;
+                    $a = $i3 * $y;
+                    // step 3362
+                    $y = 61 + 9;
+                }
+            }
+        }
+        $i1 = $a;
+        $y = $i1 - $a - step4($y, $a);
+    }
+    return $y * $x;
+}
+
+// step37: generated
+function step37($a, $b) {
+    $x = $b;
+    $y = 7;
+    for ($i1 = 0; $i1 < 32; $i1++) {
+        if ($x < 13) {
+            if ($x == 64) {
+                step1($x, $y);
+            }
+            $b = step21($i1);
+        }
+        $x = $b * $y;
+        step19($b, $i1);
+        step21($i1);
+    }
+    if ($y < 61) {
+        if ($y == 22) {
+            if ($b > 19) {
+                if ($b > 41) {
+                    step13($x, $a);
+                }
+                $a = $x + 14;
+            } else {
+                if ($y > 4) {
+                    $y = step19($y, $x);
+                    // step 3398
+                    $b = step15($y) + $b;
+                }
+            }
+            if ($a == 11) {
+                $y = 1;
+            } else {
+                if ($a < 30) {
+                    // step 3406
+                    $b = $a + 83;
+                    $b = 4 + $y;
+                }
+                $a = 32 + 77;
+                $x = $y * $b;
+            }
+            if ($x < 97) {
+                if ($x > 34) {
+                    // step 3415
+                    $x = $y;
+                } else {
+                    // step 3418
+                    $b = step26($y, $x) * 7;
+                    // step 3420
+                    $y = $a - step28($y, $b) * $b;
+                    // step 3422
+                    $b = 86 * 49 - 62;
+                }
+                if ($a == 29) {
+                    $b = step27($a);
+                }
+            }
+        }
+    } else {
+        step8($b, $x);
+        if ($b == 96) {
+            $y = $b + $y;
+            step18($x);
+            step30($b);
+            if ($a > 77) {
+                $x = 55 + $a - 86;
+            }
+        } else {
+            // step 3440
+            $x = step28($y, $y);
+        }
+        for ($i2 = 0; $i2 < 91; $i2++) {
+            if ($y < 8) {
+                if ($a > 75) {
+                    $y = $b - $i2;
+                } else {
+                    // step 3448
+                    $i2 = $y - 29 - $x;
+                    // step 3450
+                    $i2 = 36 * $a;
+                    $i2 = $x + 14;
+                }
+            }
+        }
+        if ($x == 66) {
+            for ($i3 = 0; $i3 < 23; $i3++) {
+                if ($i3 < 26) {
+                    $x = 5;
+                    $x = $x + $b;
+                } else {
+                    // step 3462
+                    $x = 93 - 15 + $b;
+                }
+                $i3 = $b - step11($y, $a) * 87;
+            }
+        } else {
+            // step 3468
+            $y = step33($b);
+            if ($a == 56) {
+                $y = 68 + step8($b, $x);
+                if ($x == 84) {
+                    // step 3473
+                    $y = 31 - $b + 39;
+                } else {
+                    $x = 98 - $x - $b;
+                }
+                if ($x > 19) {
+                    // step 3479
+                    $a = $a;
+                    $b = 77 + $a;
+                }
+            }
+        }
+    }
+    $y = 93;
+    for ($i1 = 0; $i1 < 44; $i1++) {
+        if ($y == 67) {
+            $i1 = 26;
+            if ($x > 11) {
+                if ($i1 < 88) {
+                    // step 3492
+                    $y = $i1 + 98;
+                    $x = 15;
+                    // step 3495
+                    $a = $y * 41 * 41;
+                } else {
+                    // step 3498
+                    $y = $x;
+                }
+                step4($b, $x);
+            } else {
+                // step 3503
+                $a = $i1;
+                $b = $x;
+                $y = $x * $b + $x;
+            }
+            // step 3508
+            $x = 2 + 39;
+        } else {
+            $b = $x;
+        }
+        if ($a == 70) {
+            $a = 16;
+            if ($x > 25) {
+                $y = 62;
+            } else {
+                if ($y == 58) {
+                    // step 3519
+                    $a = $y * $a * $a;
+                }
+                $i1 = $x;
+                // step 3523
+                $i1 = 97 - 58 * $i1;
+            }
+        }
+    }
+    return $a - $a - step6($b);
+}
+
+// step38: generated
+function step38($a, $b) {
+    $x = 52 - $a;
+    $y = 80;
+    if ($y > 50) {
+        if ($y == 78) {
+            $b = 84;
+            if ($a < 3) {
+                $y = $a;
+            }
+            if ($y == 31) {
+                if ($b == 83) {
+                    // step 3543
+                    $x = 69 * $x - 51;
+                } else {
+                    $a = 42 - 34 + 43;
+                    $y = 57 + $a;
+                }
+            }
+        } else {
+            if ($x > 18) {
+                if ($a < 61) {
+                    step24($y);
+                } else {
+                    $x = 60 + $b;
+                }
+            } else {
+                if ($a > 32) {
+                    step6($a);
+                } else {
+                    // step 3561
+                    $y = step5($x, $a) * $x;
+                }
+                for ($i4 = 0; $i4 < 0; $i4++) {
+                    $y = $a * $a + $x;
+                    $x = step18($a) - $a + 26;
+                    $i4 = $x;
+                }
+            }
+        }
+        for ($i2 = 0; $i2 < 75; $i2++) {
+            for ($i3 = 0; $i3 < 0; $i3++) {
+                if ($y > 27) {
+                    // step 3574
+                    $y = 0;
+                    // step 3576
+                    $i2 = $a + $x;
+                    // step 3578
+                    $a = 93 * 49 - 34;
+                } else {
+                    // step 3581
+                    $a = $y + 73;
+                }
+                $i2 = $x - $i3 + 14;
+            }
+            if ($a == 55) {
+                for ($i4 = 0; $i4 < 5; $i4++) {
+                    $i2 = 49 - $b * 41;
+                    step36($b);
+                    // step 3590
+                    $x = $x + $i4 * 67;
+                }
+                if ($y < 90) {
+                    step7($b, $x);
+                    // step 3595
+                    $a = $b;
+                    $x = $a + 86 + 23;
+                }
+                // step 3599
+                $b = 21;
+            }
+            // step 3602
+            $x = $a;
+            // step 3604
+            $y = $i2 * 5 - 69;
+        }
+        if ($b < 72) {
+            $b = 56 + $b;
+        }
+    }
+    if ($b < 91) {
+        if ($a > 59) {
+            for ($i3 = 0; $i3 < 26; $i3++) {
+                if ($x > 26) {
+                    step12($i3);
+                }
+                if ($a == 80) {
+                    $x = 61;
+                } else {
+                    // step 3620
+                    $i3 = 62;
+                }
+            }
+            $b = $a * $a * 3;
+            // step 3625
+            $b = $a - $x + $x;
+            $y = $x - 45 + 56;
+        }
+    }
+    $x = 45 + 25;
+    if ($y == 82) {
+        $y = $a - $y;
+        if ($a < 81) {
+            if ($x == 36) {
+                $b = $a * 65;
+                $x = 63;
+            }
+            $y = $b * 45 + 93;
+        }
+    } else {
+        if ($x > 22) {
+            $x = 40 - $y;
+            $y = $b * $a;
+            if ($a < 79) {
+                $a = step5($y, $a) + 91;
+                for ($i4 = 0; $i4 < 44; $i4++) {
+                    // step 3647
+                    $a = $i4 - $a;
+                    // step 3649
+                    $x = 63;
+                }
+            } else {
+                $x = $y + $a * 69;
+            }
+        }
+    }
+    return $x * $x * 80;
+}
+
+// step39: generated
+function step39($a) {
+    $x = 39 + 55;
+    $y = 23;
+    $y = $x + 25 - $x;
+    $x = 57 * 25 + 80;
+    $y = step26($y, $x);
+    // step 3667
+    $x = $y * 30 - step26($a, $a);
+    step33($x);
+    step23($a, $x);
+    if ($x > 41) {
+        if ($y > 63) {
+            if ($y > 32) {
+                if ($x < 37) {
+                    $x = $x - 22 + $a;
+                } else {
+                    // step 3677
+                    $a = 31 - $y;
+                }
+            } else {
+                if ($y < 77) {
+                    // step 3682
+                    $a = $a - step1($a, $x) * $x;
+                    $a = $a * $y;
+                    // step 3685
+                    $x = $x + $y;
+                }
+                // step 3688
+                $a = step30($y);
+            }
+        } else {
+            if ($x < 47) {
+                if ($x > 57) {
+                    step1($x, $y);
+                }
+            }
+        }
+        for ($i2 = 0; $i2 < 59; $i2++) {
+            $y = 72 * $i2;
+            $x = $a + 44;
+            for ($i3 = 0; $i3 < 32; $i3++) {
+                $y = $y;
+                $i2 = $a + $a + $i2;
+            }
+        }
+        if ($y < 90) {
+            $x = 35 + $x;
+            $x = 91 * $x + 12;
+        }
+        // step 3710
+        $x = step5($a, $x);
+    }
+    return 47;
+}
+
+// step40: generated
+function step40($a, $b) {
+    $x = $b;
+    $y = 81;
+    if ($x < 89) {
+        if ($a > 39) {
+            $a = $a - 66 + $b;
+        }
+        step31($a, $b);
+        if ($y > 54) {
+            if ($b < 3) {
+                if ($y > 75) {
+                    $b = step1($a, $b) * step32($x, $b);
+                    $y = step6($b) + step16($y, $x);
+                }
+                // step 3731
+                $b = $b * 19 * 77;
+                $y = 1;
+            } else {
+                for ($i4 = 0; $i4 < 31; $i4++) {
+                    $x = 45 * step28($b, $y) - step5($y, $y);
+                }
+            }
+            if ($b == 68) {
+                step27($y);
+                // step 3741
+                $x = $y * step32($a, $b) - 65;
+                if ($y < 7) {
+                    step29($y, $a);
+                } else {
+                    // step 3746
+                    $y = $x - 40 * $a;
+                    $x = 18 - $x;
+                }
+            } else {
+                if ($y > 47) {
+                    // step 3752
+                    $x = 30;
+                }
+            }
+        } else {
+            for ($i3 = 0; $i3 < 43; $i3++) {
+                if ($a < 38) {
+                    step7($y, $i3);
+                    $x = $i3;
+                } else {
+                    $x = step3($i3) + 75;
+                }
+            }
+        }
+    } else {
+        for ($i2 = 0; $i2 < 59; $i2++) {
+            step17($b, $b);
+            // step 3769
+            $i2 = 79;
+            if ($x > 32) {
+                $i2 = $i2 * 94;
+                step3($x);
+            } else {
+                step32($b, $x);
+            }
+            if ($y < 96) {
+                if ($a < 45) {
+                    // step 3779
+                    $a = $x + $i2 * $i2;
+                }
+                if ($b > 78) {
+                    // step 3783
+                    $y = $i2 + $x - step0($a);
+                }
+                if ($y < 67) {
+                    // step 3787
+                    $y = 89;
+                    step15($b);
+                } else {
+                    // step 3791
+                    $i2 = 16 * $i2;
+                }
+            }
+        }
+        step20($x, $b);
+        for ($i2 = 0; $i2 < 45; $i2++) {
+            $a = 30;
+            for ($i3 = 0; $i3 < 22; $i3++) {
+                // step 3800
+                $i2 = 39;
+            }
+            for ($i3 = 0; $i3 < 37; $i3++) {
+                $a = 28 + $a;
+            }
+            step0($i2);
+        }
+    }
+    for ($i1 = 0; $i1 < 91; $i1++) {
+        // step 3810
+        $x = $i1 - step12($b) - step4($a, $x);
+        for ($i2 = 0; $i2 < 11; $i2++) {
+            if ($i2 < 90) {
+                for ($i4 = 0; $i4 < 80; $i4++) {
+                    // step 3815
+                    $a = $i1;
+                    // step 3817
+                    $i1 = 67 * $i1 + $b;
+                    // step 3819
+                    $y = $a + 86;
+                }
+                // step 3822
+                $a = $a + 88 - step39($x);
+            }
+        }
+        $a = $b * $y + $x;
+        if ($x < 83) {
+            for ($i3 = 0; $i3 < 93; $i3++) {
+                for ($i4 = 0; $i4 < 99; $i4++) {
+                    // step 3830
+                    $i4 = $a;
+                }
+            }
+            step13($b, $y);
+            for ($i3 = 0; $i3 < 96; $i3++) {
+                for ($i4 = 0; $i4 < 50; $i4++) {
+                    // step 3837
+                    $i1 = step6($i3);
+                    $y = step35($x, $i1) + $b * $i4;
+                    // step 3840
+                    $x = 14 * 27 - step37($y, $x);
+                }
+            }
+        }
+    }
+    step28($y, $y);
+    step20($x, $x);
+    if ($b > 75) {
+        // step 3849
+        $x = 72 + step12($a);
+    } else {
+        $b = step12($y) - $x;
+    }
+    step34($b, $x);
+    $a = step24($x);
+    return $x + $b * $x;
+}
+
+// step41: generated
+function step41($a, $b) {
+    $x = $a * 64;
+    $y = 29;
+    $x = $y + step40($x, $y) - $y;
+    $a = $y;
+    step9($y);
+    if ($a > 48) {
+        if ($b < 44) {
+            step27($y);
+            $x = 70 + $b * $y;
+        }
+        // step 3871
+        $x = 16 - $b;
+        step40($b, $y);
+    } else {
+        $a = $x;
+        $y = $x;
+    }
+    step7($x, $y);
+    step33($a);
+    if ($y == 59) {
+        if ($a == 38) {
+            if ($x == 19) {
+                $x = step31($y, $a) + $y - $a;
+                for ($i4 = 0; $i4 < 54; $i4++) {
+                    // step 3885
+                    $i4 = $x - 10 * 37;
+                }
+                $a = $x;
+            } else {
+                // step 3890
+                $y = step22($y, $y);
+            }
+            // step 3893
+            $x = $y - step27($x) * step29($a, $b);
+        }
+    }
+    if ($b == 25) {
+        // step 3898
+        $y = 88 - 74;
+    }
+    return 97 - $x * step26($x, $b);
+}
+
+// step42: generated
+function step42($a) {
+    $x = 10 - 54;
+    $y = 37;
+    $y = 22;
+    for ($i1 = 0; $i1 < 26; $i1++) {
+        $a = step10($i1, $a);
+        $y = $a * 15;
+        $y = 2;
+        step14($i1, $a);
+    }
+    step36($x);
+    // step 3916
+    $x = $a - $x;
+    for ($i1 = 0; $i1 < 1; $i1++) {
+        step25($i1, $i1);
+        // step 3920
+        $x = 37 - step19($a, $y);
+        step15($i1);
+    }
+    // step 3924
+    $x = $x;
+    return step29($a, $y);
+}
+
+// step43: generated
+function step43($a, $b) {
+    $x = 97 * $b * $b;
+    $y = 13;
+    step32($y, $y);
+    step10($a, $y);
+    step14($x, $b);
+    if ($b > 62) {
+        if ($b == 45) {
+            step14($b, $b);
+            if ($a > 98) {
+                step22($y, $a);
+            } else {
+                for ($i4 = 0; $i4 < 29; $i4++) {
+                    $b = $y - $i4 - $x;
+                }
+            }
+            for ($i3 = 0; $i3 < 45; $i3++) {
+                $a = $x;
+            }
+            $x = 36 - 49 - 94;
+        } else {
+            if ($x < 26) {
+                for ($i4 = 0; $i4 < 20; $i4++) {
+                    // step 3953
+                    $a = 62 + 49 + $x;
+                    // step 3955
+                    $a = $b * $a;
+                    $x = 74 * $x;
+                }
+            } else {
+                if ($b < 78) {
+                    // step 3961
+                    $x = 56 * 10 + step28($x, $b);
+                }
+            }
+        }
+        $a = 70;
+        $y = step16($y, $x) + $a;
+    } else {
+        for ($i2 = 0; $i2 < 8; $i2++) {
+            $x = $a - $x;
+            for ($i3 = 0; $i3 < 95; $i3++) {
+                $i3 = 39 - $x + 12;
+                if ($y == 57) {
+                    step25($i2, $b);
+                    step27($b);
+                    // step 3976
+                    $x = 62 * 53;
+                } else {
+                    // step 3979
+                    $i3 = 82 * 5;
+                    // step 3981
+                    $x = 98 * $a;
+                }
+            }
+        }
+    }
+    $y = step18($a) + 69;
+    if ($b == 74) {
+        $x = step23($x, $b);
+    } else {
+        $a = $y;
+        // step 3992
+        $y = 79 - 0;
+        step26($b, $a);
+        step42($b);
+    }
+    $a = $y - 43;
+    return 76 + 14 * 70;
+}
+
+// step44: generated
+function step44($a, $b) {
+    $x = $a * $b * $b;
+    $y = 98;
+    step13($x, $b);
+    step22($y, $a);
+    if ($x == 25) {
+        step3($x);
+        step18($y);
+        for ($i2 = 0; $i2 < 78; $i2++) {
+            for ($i3 = 0; $i3 < 61; $i3++) {
+                $i3 = $a + $b;
+                // step 4013
+                $y = $b;
+            }
+        }
+        if ($x < 67) {
+            if ($x < 27) {
+                for ($i4 = 0; $i4 < 57; $i4++) {
+                    // step 4020
+                    $b = $a + 73 + $x;
+                }
+                step21($y);
+                step0($b);
+            }
+            if ($b > 23) {
+                $b = 39;
+            } else {
+                if ($b == 48) {
+                    step24($b);
+                    $b = 1 + $a - 19;
+                }
+                step21($a);
+            }
+        } else {
+            step1($b, $y);
+        }
+    } else {
+        for ($i2 = 0; $i2 < 76; $i2++) {
+            $a = 30;
+            if ($b < 64) {
+                $i2 = $x - 57;
+                step34($b, $a);
+            } else {
+                $y = $b - 47 * 31;
+            }
+            $i2 = step0($i2);
+            $b = 27 - $a - $y;
+        }
+        if ($y == 33) {
+            if ($b < 78) {
+                if ($a > 96) {
+                    $b = 26 - $x;
+                    // step 4054
+                    $b = $b;
+                }
+            }
+            $b = 71 + $b;
+            $a = step37($a, $x) * 3 * $b;
+            if ($x == 93) {
+                step30($b);
+                if ($a < 13) {
+                    $b = 81 + $a;
+                    // step 4064
+                    $a = 48 + 80 - step7($x, $x);
+                }
+            } else {
+                if ($b > 91) {
+                    $b = $a + step12($y);
+                    $b = $y;
+                } else {
+                    $x = 24 * $x;
+                }
+                if ($y < 37) {
+                    $b = step20($b, $x) * $a;
+                } else {
+                    // step 4077
+                    $x = $a - 14;
+                    // step 4079
+                    $y = 7 - 4;
+                    // step 4081
+                    $x = step36($x) * $b;
+                }
+                if ($b > 37) {
+                    $a = $a * $a;
+                } else {
+                    $y = $x * $a - $b;
+                }
+            }
+        }
+    }
+    return $y;
+}
+
+// step45: generated
+function step45($a) {
+    $x = 17 - 67 - $a;
+    $y = 88;
+    for ($i1 = 0; $i1 < 23; $i1++) {
+        $a = $i1 + $a * $x;
+        for ($i2 = 0; $i2 < 37; $i2++) {
+            if ($x > 47) {
+                $i1 = $a + 43 - $i1;
+            } else {
+                if ($x == 73) {
+                    // step 4106
+                    $i1 = 21;
+                    $y = 63;
+                }
+                // step 4110
+                $x = 99 - $x - $i2;
+            }
+            if ($x < 56) {
+                $y = 55 + 7;
+                if ($a == 21) {
+                    $x = $y + $x;
+                    // step 4117
+                    $i1 = 67 * $x;
+                } else {
+                    // step 4120
+                    $a = 74 - $i1 + $i2;
+                }
+                step43($i1, $i2);
+            }
+            // step 4125
+            $x = $x * 29;
+            $a = $x - step39($i2);
+        }
+    }
+    step17($x, $y);
+    if ($x > 98) {
+        if ($a > 97) {
+            $a = 15 * 60;
+            if ($x == 59) {
+                step8($x, $x);
+            } else {
+                $a = $x * step19($a, $x) - $y;
+                $y = $x;
+            }
+        }
+        if ($x > 68) {
+            if ($a < 50) {
+                step15($a);
+            } else {
+                if ($a == 87) {
+                    // step 4146
+                    $y = $a * 18 * $a;
+                    $a = $a;
+                } else {
+                    $a = $a - 83;
+                    // step 4151
+                    $a = 95;
+                }
+            }
+            $x = step32($y, $a);
+        }
+    }
+    return $x;
+}
+
+// step46: generated
+function step46($a, $b) {
+    $x = $b;
+    $y = 1;
+    for ($i1 = 0; $i1 < 75; $i1++) {
+        step41($i1, $x);
+    }
+    // step 4168
+    $a = $y - $x - $y;
+    $y = $b * 47 * $y;
+    if ($b == 34) {
+        $y = $y - $a;
+    }
+    $x = 97;
+    $a = 80 * $a + $x;
+    $b = $b - $y;
+    // step 4177
+    $b = 81 - $a - 34;
+    return step34($x, $x) + $x;
+}
+
+// step47: generated
+function step47($a, $b) {
+    $x = 98;
+    $y = 97;
+    step22($y, $b);
+    if ($a > 68) {
+        // step 4188
+        $a = 12 - $b;
+        // step 4190
+        $x = step40($y, $y);
+        $a = 86 - $a - 72;
+        step14($b, $y);
+    } else {
+        $x = $b - $a + $a;
+        // step 4196
+        $x = 1 * 74 + $x;
+        for ($i2 = 0; $i2 < 75; $i2++) {
+            step43($y, $b);
+        }
+        $x = $a;
+    }
+    if ($b < 62) {
+        // step 4204
+        $a = $x - $x - $y;
+    } else {
+        if ($b > 20) {
+            $a = $b * $a;
+            if ($x < 77) {
+                // step 4210
+                $b = $b + step29($b, $y);
+            }
+        }
+    }
+    step24($b);
+    $a = 44 - $x;
+    return $a * $a;
+}
+
+// step48: generated
+function step48($a) {
+    $x = $a - $a + $a;
+    $y = 69;
+    for ($i1 = 0; $i1 < 71; $i1++) {
+        for ($i2 = 0; $i2 < 22; $i2++) {
+            $i1 = $a + $i2;
+            $i2 = $i2 + $a + $a;
+        }
+        $y = $x;
+    }
+    $x = 27 * $a;
+    // step 4232
+    $y = $y - 19 + $a;
+    if ($y < 85) {
+        for ($i2 = 0; $i2 < 15; $i2++) {
+            // step 4236
+            $a = $a;
+            $x = $a;
+        }
+        for ($i2 = 0; $i2 < 86; $i2++) {
+            $i2 = $x + $i2;
+            $x = $y - step16($x, $x);
+            $i2 = $a - 11 - $i2;
+            $i2 = $x + step14($a, $y);
+        }
+        $a = 85 - $a;
+        for ($i2 = 0; $i2 < 0; $i2++) {
+            // step 4248
+            $i2 = $x;
+            $x = step6($y) + step14($a, $a);
+        }
+    }
+    if ($a > 11) {
+        for ($i2 = 0; $i2 < 79; $i2++) {
+            $x = step34($i2, $x) + 3;
+            if ($i2 < 11) {
+                step33($x);
+            }
+        }
+        $y = 89 * 25;
+        if ($x < 51) {
+            step2($y, $y);
+            if ($y > 98) {
+                for ($i4 = 0; $i4 < 85; $i4++) {
+                    $a = $a + $a - 47;
+                    step26($i4, $x);
+                }
+                if ($a > 93) {
+                    // step 4269
+                    $x = $a * $x + 50;
+                    step1($y, $y);
+                } else {
+                    // step 4273
+                    $y = 94;
+                    $a = 3 - $a - $a;
+                }
+                $y = step1($y, $a) * $a;
+            } else {
+                $y = $a * 17;
+            }
+            step32($y, $y);
+        } else {
+            $a = 99 * $a;
+            if ($y == 64) {
+                // step 4285
+                $x = $x - 75 - $y;
+            } else {
+                if ($a == 28) {
+                    $a = $x + 4 - $x;
+                    $x = $x - $y * $x;
+                }
+            }
+            // step 4293
+            $a = step19($y, $a);
+            for ($i3 = 0; $i3 < 37; $i3++) {
+                $i3 = $x * $x * 80;
+                // step 4297
+                $x = $a - step45($i3);
+                $i3 = $y * $a;
+            }
+        }
+        step37($a, $a);
+    } else {
+        $a = $y - 90 + step31($x, $a);
+        step16($a, $a);
+        $x = $a + $y;
+        step38($a, $y);
+    }
+    // step 4309
+    $y = $y + $x;
+    return 24 - step2($y, $x);
+}
+
+// step49: generated
+function step49($a, $b) {
+    $x = 67 - $b;
+    $y = 7;
+    $x = step26($a, $x);
+    $a = $y;
+    if ($x > 40) {
+        $y = $y - $a + 32;
+        if ($x > 3) {
+            for ($i3 = 0; $i3 < 26; $i3++) {
+                step37($i3, $i3);
+                step37($y, $y);
+                // step 4326
+                $i3 = 10;
+            }
+            if ($y == 92) {
+                step38($x, $a);
+                if ($a == 8) {
+                    // step 4332
+                    $a = $x * 95 * $y;
+                }
+            } else {
+                $a = 72 + $x;
+                for ($i4 = 0; $i4 < 67; $i4++) {
+                    step45($a);
+                    $i4 = step29($b, $b);
+                    // step 4340
+                    $y = 42;
+                }
+                // step 4343
+                $a = 43 + 60 * $x;
+            }
+            $x = 41 + $y - $x;
+        } else {
+            for ($i3 = 0; $i3 < 66; $i3++) {
+                for ($i4 = 0; $i4 < 40; $i4++) {
+                    step30($a);
+                }
+                for ($i4 = 0; $i4 < 55; $i4++) {
+                    step1($i3, $i3);
+                    // step 4354
+                    $b = $a + step40($y, $i3) - 94;
+                    $b = 60 - $b * 71;
+                }
+                $i3 = 79 - step13($y, $b) - $a;
+            }
+            // step 4360
+            $y = step32($y, $a) - step12($b) + 70;
+            // step 4362
+            $a = step39($y);
+        }
+    }
+    // step 4366
+    $y = $a;
+    $b = $x - $y + $x;
+    if ($b < 16) {
+        $x = 77 - $x;
+        if ($b == 48) {
+            $x = $a - 85 - 7;
+            for ($i3 = 0; $i3 < 58; $i3++) {
+                $x = $b - $x + $x;
+            }
+            if ($x > 91) {
+                step8($x, $a);
+                $a = $a * $b;
+            } else {
+                for ($i4 = 0; $i4 < 31; $i4++) {
+                    // step 4381
+                    $y = 16;
+                    // step 4383
+                    $x = $b;
+                }
+            }
+        } else {
+            $a = $y + 64 * 57;
+            $x = $a;
+            if ($b < 7) {
+                if ($y == 9) {
+                    $x = step22($x, $a) + step11($x, $a);
+                } else {
+                    step29($x, $x);
+                    // step 4395
+                    $y = $y;
+                    $x = step37($y, $x);
+                }
+                // step 4399
+                $b = 76 + $b;
+            }
+            $b = step8($y, $y) * $a;
+        }
+        $y = 88 + 28 - step27($b);
+    }
+    return $a + $x - 82;
+}
+
+// step50: generated
+function step50($a, $b) {
+    $x = $b - $a;
+    $y = 43;
+    for ($i1 = 0; $i1 < 83; $i1++) {
+        $y = step28($x, $y) * step33($x) * $i1;
+        $y = 76 * step8($b, $a);
+        $b = step44($a, $b) + $x - step36($b);
+    }
+    if ($b == 64) {
+        step9($a);
+        for ($i2 = 0; $i2 < 16; $i2++) {
+            for ($i3 = 0; $i3 < 24; $i3++) {
+                if ($x < 93) {
+                    // step 4423
+                    $y = $i2 + $b;
+                    $i2 = 47;
+                } else {
+                    // step 4427
+                    $b = $i3;
+                    // step 4429
+                    $a = $a;
+                    $i3 = $x - $b;
+                }
+            }
+            if ($y > 92) {
+                $x = step38($x, $x);
+            } else {
+                // step 4437
+                $b = $x + $i2 - 65;
+            }
+        }
+    }
+    step21($x);
+    $a = $a - $x;
+    if ($a < 19) {
+        // step 4445
+        $y = 95;
+        step41($b, $a);
+        for ($i2 = 0; $i2 < 28; $i2++) {
+            if ($i2 == 5) {
+                $i2 = $y - $i2;
+            } else {
+                if ($x < 72) {
+                    // step 4453
+                    $i2 = 6 * $x * step17($x, $x);
+                    // step 4455
+                    $i2 = $i2;
+                    // step 4457
+                    $i2 = step17($x, $i2) - $i2 - step16($b, $a);
+                }
+                if ($y == 34) {
+                    // step 4461
+                    $a = 92 + 83;
+                }
+                $i2 = 72;
+            }
+            step4($b, $a);
+        }
+        $b = 48;
+    } else {
+        $a = $a * 40 + $y;
+        for ($i2 = 0; $i2 < 28; $i2++) {
+            $b = $x - 74 * 95;
+            if ($i2 > 35) {
+                $x = 42;
+            } else {
+                step24($b);
+                $i2 = step17($x, $b) + 2 - 4;
+            }
+            if ($a > 74) {
+                if ($y == 87) {
+                    // step 4481
+                    $x = step13($y, $a) * $a;
+                } else {
+                    // step 4484
+                    $a = 14 - $y;
+                }
+            }
+        }
+        for ($i2 = 0; $i2 < 73; $i2++) {
+            step25($a, $i2);
+        }
+        step33($b);
+    }
+    if ($x > 51) {
+        // step 4495
+        $b = 55 + $x - 60;
+        if ($a == 12) {
+            $a = $x + $x;
+            for ($i3 = 0; $i3 < 66; $i3++) {
+                // step 4500
+                $x = 82;
+                $y = 68 * 65 * 23;
+            }
+        }
+        for ($i2 = 0; $i2 < 32; $i2++) {
+            for ($i3 = 0; $i3 < 79; $i3++) {
+                if ($a < 13) {
+                    // step 4508
+                    $y = 97 + $b;
+                } else {
+                    $x = 29;
+                }
+            }
+        }
+    } else {
+        $x = 49 * 6 - $a;
+        if ($b < 21) {
+            for ($i3 = 0; $i3 < 21; $i3++) {
+                $b = 24 * $b * 34;
+                step27($y);
+                if ($y > 74) {
+                    // step 4522
+                    $a = $a;
+                }
+            }
+            $x = 98 + $x;
+            $a = 52;
+            if ($x < 49) {
+                if ($a < 13) {
+                    // step 4530
+                    $y = $y;
+                    $y = $x;
+                } else {
+                    $y = 11 * $x;
+                    // step 4535
+                    $y = step27($x);
+                }
+            }
+        } else {
+            if ($y < 16) {
+                if ($a == 42) {
+                    step33($y);
+                    $a = $b * $y - $y;
+                    $y = 49 - $a;
+                }
+            } else {
+                step36($b);
+                if ($a < 17) {
+                    // step 4549
+                    $x = 94;
+                    step21($x);
+                }
+                for ($i4 = 0; $i4 < 14; $i4++) {
+                    step18($b);
+                    // step 4555
+                    $x = $b * $y;
+                    $x = 33;
+                }
+            }
+            for ($i3 = 0; $i3 < 81; $i3++) {
+                if ($a < 2) {
+                    $i3 = $x * $a;
+                } else {
+                    // step 4564
+                    $b = 9;
+                    // step 4566
+                    $i3 = 73 + $i3 - step15($y);
+                    step32($b, $b);
+                }
+            }
+            $y = $x - $a;
+        }
+    }
+    return $b + 53 + 59;
+}
+
+// step51: generated
+function step51($a) {
+    $x = 53;
+    $y = 78;
+    if ($y == 64) {
+        if ($y > 50) {
+            if ($y == 30) {
+                for ($i4 = 0; $i4 < 75; $i4++) {
+                    $i4 = 71;
+                }
+                for ($i4 = 0; $i4 < 76; $i4++) {
+                    $a = 90 + 60;
+                }
+            }
+            $x = 61 - 84;
+            for ($i3 = 0; $i3 < 89; $i3++) {
+                if ($a < 81) {
+                    step35($i3, $i3);
+                    $i3 = step39($x) + $y;
+                }
+                if ($y > 42) {
+                    // step 4598
+                    $x = $i3;
+                } else {
+                    $x = 56;
+                    step29($x, $a);
+                    // step 4603
+                    $x = step29($x, $i3);
+                }
+                // step 4606
+                $y = step40($y, $y);
+            }
+            step8($y, $x);
+        } else {
+            $a = 34;
+            $a = $x * $x;
+            $a = $x * $a;
+        }
+        if ($a > 68) {
+            step24($y);
+            if ($y < 43) {
+                $x = 33 * step47($a, $a);
+            }
+            for ($i3 = 0; $i3 < 92; $i3++) {
+                $y = $y;
+            }
+            $x = $y + $y;
+        } else {
+            if ($a == 44) {
+                if ($y < 32) {
+                    // step 4627
+                    $y = $y * step33($a);
+                    // step 4629
+                    $x = step15($x) * $y;
+                }
+            } else {
+                step40($a, $a);
+            }
+            $x = 63 * $y - step11($x, $a);
+            // step 4636
+            $x = 31 * $y + 13;
+        }
+        // step 4639
+        $y = $a - 76 + $x;
+        for ($i2 = 0; $i2 < 90; $i2++) {
+            if ($a > 44) {
+                step20($y, $a);
+                // step 4644
+                $y = 83 + $x;
+            }
+            $a = $y + 0;
+            step7($x, $a);
+            $a = 34 + $x;
+        }
+    } else {
+        for ($i2 = 0; $i2 < 8; $i2++) {
+            $y = 1 + step30($i2);
+        }
+        $y = 83 + $x;
+        for ($i2 = 0; $i2 < 1; $i2++) {
+            // step 4657
+            $y = $i2 - $x * 56;
+            $y = 15 * $a;
+            $i2 = $a;
+        }
+    }
+    // step 4663
+    $x = 85;
+    for ($i1 = 0; $i1 < 48; $i1++) {
+        if ($x == 26) {
+            $a = $x;
+            for ($i3 = 0; $i3 < 51; $i3++) {
+                step50($x, $i3);
+            }
+            if ($x > 63) {
+                // step 4672
+                $a = $y - $i1;
+                if ($i1 == 22) {
+                    // step 4675
+                    $a = $y + 51;
+                }
+                if ($x > 27) {
+                    // step 4679
+                    $a = $i1 * $i1;
+                }
+            } else {
+                if ($x > 63) {
+                    $i1 = 71 + 50;
+                } else {
+                    // step 4686
+                    $x = 88 - $y;
+                    // step 4688
+                    $i1 = step33($i1) - $y;
+                }
+            }
+        } else {
+            if ($i1 == 2) {
+                $a = $a + 58 + $a;
+                if ($x > 35) {
+                    // step 4696
+                    $x = 65 - 83 - $a;
+                } else {
+                    $y = $a * $i1 - $y;
+                    step24($i1);
+                }
+            }
+            for ($i3 = 0; $i3 < 62; $i3++) {
+                if ($i1 > 54) {
+                    $i1 = $a - $i3 * $y;
+                }
+                for ($i4 = 0; $i4 < 31; $i4++) {
+                    $a = $y + 35;
+                }
+                $a = 78 * step3($a) * $i3;
+            }
+            // step 4712
+            $y = 1;
+            $x = 85 + $a;
+        }
+        $x = $a;
+    }
+    for ($i1 = 0; $i1 < 20; $i1++) {
+        $x = $y + 37;
+    }
+    return 15 + 15;
+}
+
+// step52: generated
+function step52($a, $b) {
+    $x = 22;
+    $y = 91;
+    if ($b == 10) {
+        step22($a, $b);
+    }
+    if ($b < 88) {
+        $b = $x * 70;
+        for ($i2 = 0; $i2 < 67; $i2++) {
+            $b = 33 + step43($x, $a) + $x;
+            $x = 28 + 22;
+            // step 4736
+            $x = $y;
+        }
+        // step 4739
+        $x = 14;
+    }
+    // step 4742
+    $b = $b * 47;
+    if ($b < 89) {
+        if ($x < 63) {
+            step15($y);
+            if ($y == 92) {
+                if ($b == 52) {
+                    // step 4749
+                    $x = 47 * 52;
+                }
+            }
+            $a = 80 - $b * $b;
+            if ($y < 89) {
+                $a = 85 - $a;
+            } else {
+                $a = 52 - $b - 14;
+            }
+        } else {
+            if ($b == 86) {
+                for ($i4 = 0; $i4 < 34; $i4++) {
+                    step5($b, $a);
+                    // step 4763
+                    $a = 69 - 44;
+                }
+            } else {
+                // step 4767
+                $b = step26($a, $b) * 79 * $x;
+                step7($x, $x);
+            }
+            for ($i3 = 0; $i3 < 8; $i3++) {
+                $y = $i3 + $x * 36;
+                if ($i3 < 81) {
+                    // step 4774
+                    $i3 = $y * 84;
+                } else {
+                    // step 4777
+                    $y = $a * step3($a);
+                }
+            }
+            // step 4781
+            $b = $y;
+        }
+    }
+    return $a;
+}
+
+// step53: generated
+function step53($a, $b) {
+    $x = $a * $a * 25;
+    $y = 59;
+    for ($i1 = 0; $i1 < 21; $i1++) {
+        $a = $a;
+        if ($y > 99) {
+            $a = step39($x) + 61 - 45;
+            if ($a == 95) {
+                // step 4797
+                $y = 55 - 96 * 77;
+                if ($b > 91) {
+                    step35($y, $i1);
+                    // step 4801
+                    $a = $a * $i1;
+                } else {
+                    // step 4804
+                    $a = 66 + 46;
+                }
+                $y = 30;
+            } else {
+                $a = 77;
+            }
+            $i1 = step2($i1, $x) * 74;
+        } else {
+            $b = step23($b, $a) - 7 - $y;
+            if ($i1 > 21) {
+                if ($x > 69) {
+                    // step 4816
+                    $x = $a + $b;
+                    // step 4818
+                    $y = 82;
+                } else {
+                    // step 4821
+                    $b = $i1 - $b;
+                }
+            }
+            $a = $b + $b;
+        }
+        step12($x);
+        $i1 = 72;
+    }
+    $b = $y + $x * 89;
+    if ($b == 76) {
+        if ($b < 40) {
+            $y = $b * $a + $y;
+            for ($i3 = 0; $i3 < 1; $i3++) {
+                $b = 57 * 1 * $b;
+                if ($i3 > 29) {
+                    step49($y, $b);
+                }
+            }
+            if ($y < 54) {
+                step51($x);
+                step52($y, $a);
+            }
+            // step 4844
+            $x = $a;
+        }
+        $b = $x * 6;
+        if ($a > 10) {
+            if ($b == 85) {
+                for ($i4 = 0; $i4 < 6; $i4++) {
+                    step13($x, $i4);
+                    step44($x, $b);
+                    step31($x, $a);
+                }
+            } else {
+                for ($i4 = 0; $i4 < 91; $i4++) {
+                    $i4 = 40;
+                    step14($y, $y);
+                }
+                if ($b < 70) {
+                    $a = step27($a) + step31($x, $b);
+                    // step 4862
+                    $y = $y;
+                }
+                step48($a);
+            }
+            for ($i3 = 0; $i3 < 41; $i3++) {
+                $i3 = step34($i3, $x);
+            }
+            if ($x == 55) {
+                $a = 43 - step38($x, $x);
+                if ($x > 77) {
+                    $a = 33;
+                    step27($y);
+                    // step 4875
+                    $x = 56;
+                }
+                $y = $y - 8 - step38($x, $b);
+            } else {
+                $x = $x + $a * step5($x, $a);
+                for ($i4 = 0; $i4 < 38; $i4++) {
+                    // step 4882
+                    $i4 = step5($b, $y);
+                    step13($i4, $x);
+                    // step 4885
+                    $x = 94 + $x;
+                }
+            }
+        }
+        $b = step2($b, $b) - 64 - $b;
+    } else {
+        // step 4892
+        $x = 25 * step18($b) * step51($x);
+        // step 4894
+        $b = $x + $b + $b;
+        for ($i2 = 0; $i2 < 63; $i2++) {
+            // step 4897
+            $y = step31($b, $i2) - $y;
+            $i2 = $i2 + $x + $b;
+        }
+    }
+    step26($x, $y);
+    if ($a > 2) {
+        if ($x < 80) {
+            if ($b < 58) {
+                step46($x, $y);
+                for ($i4 = 0; $i4 < 51; $i4++) {
+                    $y = $y * 56;
+                    // step 4909
+                    $b = $x - $i4 * $x;
+                }
+                if ($x > 47) {
+                    // step 4913
+                    $a = 30 - $a;
+                    // step 4915
+                    $x = 75 * 31;
+                } else {
+                    // step 4918
+                    $y = $a + 27 * $y;
+                    $a = 68 + 44;
+                }
+            }
+            // step 4923
+            $y = $x * 36 - 50;
+            if ($x == 23) {
+                step3($x);
+                // step 4927
+                $x = $y - $x - 6;
+            } else {
+                // step 4930
+                $y = $x - 53 * $a;
+            }
+            if ($b == 81) {
+                $a = $a;
+                step35($a, $y);
+                step21($y);
+            }
+        } else {
+            $y = 69;
+            for ($i3 = 0; $i3 < 14; $i3++) {
+                // step 4941
+                $a = step44($b, $i3);
+                $x = 63;
+            }
+            step24($x);
+            if ($y == 0) {
+                if ($a == 79) {
+                    // step 4948
+                    $x = 59 + $x - $x;
+                } else {
+                    $a = $x + 20;
+                }
+                // step 4953
+                $y = step31($x, $b);
+                // step 4955
+                $x = $b + step4($a, $a);
+            }
+        }
+        $y = 16 - 2;
+        for ($i2 = 0; $i2 < 62; $i2++) {
+            for ($i3 = 0; $i3 < 89; $i3++) {
+                for ($i4 = 0; $i4 < 76; $i4++) {
+                    $i2 = $i3;
+                }
+                if ($b < 22) {
+                    step30($a);
+                } else {
+                    // step 4968
+                    $b = $i3 + $b - $x;
+                }
+                for ($i4 = 0; $i4 < 64; $i4++) {
+                    $i2 = 73 * $i3 + 85;
+                }
+            }
+            if ($i2 < 2) {
+                if ($x < 3) {
+                    $y = step3($y);
+                    // step 4978
+                    $b = 95 + $x + 11;
+                    step35($i2, $x);
+                }
+                if ($i2 > 75) {
+                    $x = $i2 + $i2;
+                } else {
+                    // step 4985
+                    $x = $x;
+                    // step 4987
+                    $i2 = $i2;
+                }
+                if ($x > 66) {
+                    // step 4991
+                    $x = 49 - 77 - $x;
+                    step6($a);
+                    // step 4994
+                    $i2 = step0($x) - 29 - step37($b, $x);
+                }
+            }
+            $a = 18;
+        }
+        if ($x == 84) {
+            if ($b > 94) {
+                step0($b);
+                $b = step50($b, $b) - 77;
+            } else {
+                $y = $y * $b - $a;
+            }
+            $y = 45;
+        } else {
+            // step 5009
+            $x = $x * $a;
+        }
+    }
+    step50($x, $y);
+    return $a * 66;
+}
+
+$total = 0;
+$total = $total + step49(94, 59);
+$total = $total + step50(24, 76);
+$total = $total + step51(46);
+$total = $total + step52(79, 56);
+$total = $total + step53(79, 48);
+echo $total;
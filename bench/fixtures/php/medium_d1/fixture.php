@@ -0,0 +1,822 @@
+<?php
+
+// step0: generated
+function step0($a) {
+    $x = 23 * $a;
+    $y = 27;
+    if ($y > 52) {
+        // step 7
+        $a = 98 * $y + 12;
+    } else {
+        // step 10
+        $a = $a + 12;
+        $a = 36 - $y;
+    }
+    if ($a == 33) {
+        // step 15
+        $y = 50 - $x;
+    }
+    $y = $x;
+    if ($y > 27) {
+        // step 20
+        $a = $y + 1;
+        $a = 16 - $a + $a;
+        // step 23
+        $y = 69 - $a - 82;
+    }
+    $a = $y - $y + 76;
+    $x = $x * 30 * $y;
+    for ($i1 = 0; $i1 < 39; $i1++) {
+        $x = $a + $a;
+    }
+    return $y + 78 + 22;
+}
+
+// step1: generated
+function step1($a, $b) {
+    $x = $a;
+    $y = 36;
+    if ($y < 12) {
+        $y = $b;
+        $x = 87;
+    }
+    step0($a);
+    if ($y < 91) {
+        step0($b);
+    }
+    // step 46
+    $y = $b + $a * 70;
+    $b = step0($x) - 4;
+    return $b - $x;
+}
+
+// step2: generated
+function step2($a, $b) {
+    $x = $b + 34 * $a;
+    $y = 3;
+    for ($i1 = 0; $i1 < 50; $i1++) {
+        // step 57
+        $i1 = 52 * $x - 35;
+        // step 59
+        $i1 = $i1 - $y * step0($x);
+        // step 61
+        $a = 54 + 84 + step0($x);
+        // step 63
+        $i1 = $a - step1($i1, $b);
+    }
+    if ($y == 9) {
+        step0($x);
+        // step 68
+        $a = $a - $a - 17;
+    }
+    if ($b == 28) {
+        $b = $y;
+        // step 73
+        $x = 32 * $y + $y;
+    } else {
+        // step 76
+        $b = $a + 80;
+        // step 78
+        $b = step0($b) - $x;
+        // step 80
+        $b = 42 - 83;
+    }
+    step1($x, $x);
+    step1($a, $y);
+    return step1($a, $b) + 69;
+}
+
+// step3: generated
+function step3($a) {
+    $x = 66 - $a;
+    $y = 82;
+    for ($i1 = 0; $i1 < 40; $i1++) {
+        // step 93
+        $x = $x + 81;
+    }
+    for ($i1 = 0; $i1 < 26; $i1++) {
+        $i1 = 7 - 53;
+    }
+    $y = 36 - $y - $a;
+    $y = step1($a, $y) + step2($y, $a);
+    // step 101
+    $y = $a - $x;
+    return 94 - 30;
+}
+
+// step4: generated
+function step4($a, $b) {
+    $x = 46;
+    $y = 76;
+    if ($x > 9) {
+        $y = 29 - $x;
+        // step 112
+        $b = 72 - 50;
+        $a = $y * $x;
+        // step 115
+        $a = 31 + $a + $b;
+    }
+    for ($i1 = 0; $i1 < 11; $i1++) {
+        // step 119
+        $b = $i1 - step2($y, $b) + $a;
+        $i1 = 67;
+        $y = step0($b) * $b;
+        // step 123
+        $i1 = $a;
+    }
+    $b = $x * 25;
+    return $a - 26;
+}
+
+// step5: generated
+function step5($a, $b) {
+    $x = $b * 74;
+    $y = 48;
+    $y = $x * $b;
+    // step 135
+    $a = 21 - step3($x) * 54;
+    if ($a == 11) {
+        // step 138
+        $y = 30 + $b;
+        step4($a, $x);
+        // step 141
+        $b = 77;
+    } else {
+        step0($y);
+        $y = step2($b, $a) - $a;
+    }
+    $b = $x - 81 - step1($y, $y);
+    $a = step3($a);
+    for ($i1 = 0; $i1 < 62; $i1++) {
+        // step 150
+        $x = $y * 33;
+    }
+    return $y + $x - $x;
+}
+
+// step6: generated
+function step6($a) {
+    $x = $a;
+    $y = 55;
+    $a = 32 - $x;
+    if ($x < 65) {
+        step5($x, $x);
+        $y = step2($a, $y) + $x;
+    } else {
+        step2($y, $x);
+        // step 166
+        $a = 60 * step0($x);
+        $a = $y - $y;
+    }
+    $y = step2($a, $y) + $a + step4($y, $a);
+    $y = $y * 35 + 18;
+    return 87;
+}
+
+// step7: generated
+function step7($a, $b) {
+    $x = $a * $a;
+    $y = 40;
+    for ($i1 = 0; $i1 < 65; $i1++) {
+        $x = 52 * 34;
+        $x = $a + $i1 - $x;
+        // step 182
+        $b = 64;
+    }
+    $y = step3($y) - step5($b, $b);
+    for ($i1 = 0; $i1 < 92; $i1++) {
+        step4($a, $x);
+        $y = step0($i1) - step6($b);
+    }
+    // step 190
+    $a = 12 + $y;
+    // step 192
+    $x = $b * $b - step0($a);
+    return 88 + $y;
+}
+
+// step8: generated
+function step8($a, $b) {
+    $x = $a;
+    $y = 45;
+    $y = step4($b, $b);
+    $a = 97;
+    if ($b == 69) {
+        // step 204
+        $b = $x + $b;
+    } else {
+        // step 207
+        $b = $a - $y - $x;
+        $b = $x - $a;
+    }
+    $y = 26 * 44 - $y;
+    return 98 + $b * $a;
+}
+
+// step9: generated
+function step9($a) {
+    $x = 58 * $a;
+    $y = 35;
+    $a = step1($y, $a);
+    $y = 29;
+    $a = $y;
+    // step 222
+    $x = 43 - step1($a, $y) + 63;
+    $y = $a * $x - $a;
+    return 42 * $x;
+}
+
+// step10: generated
+function step10($a, $b) {
+    $x = 73 * 46;
+    $y = 56;
+    // step 232
+    $x = step2($x, $y) + $b;
+    if ($a < 61) {
+        step5($y, $b);
+        $y = step7($y, $y);
+        // step 237
+        $x = 29;
+        // step 239
+        $b = $b * 46;
+    } else {
+        step5($a, $y);
+        step0($x);
+        // step 244
+        $x = step4($y, $a);
+        // step 246
+        $x = $x - $a + step6($a);
+    }
+    $x = 99;
+    if ($a == 77) {
+        $b = 26 - $x;
+        // step 252
+        $x = $x + $y * 85;
+        step3($x);
+        $x = 91 - 92;
+    }
+    for ($i1 = 0; $i1 < 3; $i1++) {
+        // step 258
+        $a = step1($i1, $y);
+        $x = $a * $b - step6($x);
+        // step 261
+        $b = 48 - $a * 27;
+        $a = $b - 7;
+    }
+    return 86;
+}
+
+// step11: generated
+function step11($a, $b) {
+    $x = $a * 29 + 4;
+    $y = 78;
+    for ($i1 = 0; $i1 < 46; $i1++) {
+        $y = 5 * 41 + 0;
+        // step 274
+        $i1 = 78 - 96;
+    }
+    for ($i1 = 0; $i1 < 9; $i1++) {
+        // step 278
+        $b = $a * $y;
+        // step 280
+        $i1 = 28;
+        $x = 95;
+        step0($x);
+    }
+    $x = $b;
+    return $y;
+}
+
+// step12: generated
+function step12($a) {
+    $x = $a;
+    $y = 43;
+    step5($y, $x);
+    $a = $y;
+    if ($a == 43) {
+        // step 296
+        $x = 87;
+        step1($x, $x);
+        step3($a);
+        $a = step4($x, $x) - $x - 33;
+    } else {
+        $y = $x - $x;
+        $a = step2($a, $a) - $x;
+        // step 304
+        $y = $x;
+    }
+    if ($x == 19) {
+        $y = 65 - $y + $x;
+        step7($y, $x);
+        $x = $x * 50 * step2($x, $x);
+        $a = $a + 54;
+    } else {
+        // step 313
+        $a = $a + 18 + 70;
+        $x = 63 - 82;
+    }
+    return step11($x, $x) - $a + $x;
+}
+
+// step13: generated
+function step13($a, $b) {
+    $x = $a - $b + $b;
+    $y = 58;
+    // step 324
+    $y = $x + $y - $x;
+    $b = $x;
+    $y = $x + step12($x);
+    $y = 27 * $y;
+    for ($i1 = 0; $i1 < 24; $i1++) {
+        // step 330
+        $a = 9 * 63;
+        $y = $y * step8($i1, $y);
+    }
+    return $a - 20;
+}
+
+// step14: generated
+function step14($a, $b) {
+    $x = 42 + 25 * $a;
+    $y = 34;
+    $y = 91;
+    step13($a, $y);
+    for ($i1 = 0; $i1 < 70; $i1++) {
+        $i1 = $a + 52 * step1($i1, $y);
+        // step 345
+        $a = $a * step4($i1, $y);
+        $b = step12($y);
+        // step 348
+        $a = 75 * 15 + $x;
+    }
+    for ($i1 = 0; $i1 < 72; $i1++) {
+        step8($a, $x);
+        step6($a);
+        step10($x, $y);
+        // step 355
+        $b = $a - 16 + 33;
+    }
+    for ($i1 = 0; $i1 < 79; $i1++) {
+        // step 359
+        $y = 16;
+    }
+    // step 362
+    $a = $x + $a;
+    return 15 - $y + $a;
+}
+
+// step15: generated
+function step15($a) {
+    $x = 86 + $a;
+    $y = 46;
+    step1($y, $x);
+    step3($a);
+    // step 373
+    $y = 80;
+    for ($i1 = 0; $i1 < 41; $i1++) {
+        $i1 = $y;
+    }
+    $x = 67;
+    step6($a);
+    for ($i1 = 0; $i1 < 88; $i1++) {
+        // step 381
+        $a = $i1 - 87;
+        $y = 48 - 47 * $a;
+        $i1 = step13($a, $x) - $a * step9($i1);
+    }
+    return $a + 92 - step2($a, $y);
+}
+
+// step16: generated
+function step16($a, $b) {
+    $x = $b + 1 - 0;
+    $y = 47;
+    $x = $x + step9($x);
+    $x = 66;
+    $a = $b;
+    return 35 + step4($b, $b) * 29;
+}
+
+// step17: generated
+function step17($a, $b) {
+    $x = 34 * $b * 97;
+    $y = 93;
+    // step 403
+    $y = 6 - step14($a, $a) - $y;
+    $b = $b * 69 * $a;
+    $a = 20;
+    if ($a < 55) {
+        $b = $b + $a - step6($y);
+    }
+    // step 410
+    $y = 97 * 95 * 52;
+    return 26;
+}
+
+// step18: generated
+function step18($a) {
+    $x = $a;
+    $y = 52;
+    if ($a == 12) {
+        step4($x, $x);
+        $a = step11($x, $a) - step5($y, $y);
+    }
+    if ($y < 96) {
+        // step 424
+        $x = 66 * $y - $y;
+        // step 426
+        $a = $x - 93 + $a;
+        // step 428
+        $x = $x + $y + $a;
+    } else {
+        step9($y);
+        // step 432
+        $x = 33;
+    }
+    $a = $a + $y;
+    step12($a);
+    for ($i1 = 0; $i1 < 19; $i1++) {
+        step1($x, $a);
+        // step 439
+        $y = 2;
+        // step 441
+        $i1 = $y * $x;
+        $a = step0($y);
+    }
+    for ($i1 = 0; $i1 < 21; $i1++) {
+        step1($i1, $a);
+        // step 447
+        $x = $i1 + 15 + 24;
+        // step 449
+        $i1 = $x * 5 - $i1;
+        step12($y);
+    }
+    return $y + 89;
+}
+
+// step19: generated
+function step19($a, $b) {
+    $x = $a - 61 + 47;
+    $y = 22;
+    $y = $a;
+    if ($y > 1) {
+        $b = step5($a, $y) - $y + $b;
+        // step 463
+        $x = $a + $a;
+        // step 465
+        $b = 29 * 10;
+        step15($a);
+    } else {
+        $y = 10;
+        // step 470
+        $b = 60 + $a + $y;
+        step1($y, $b);
+    }
+    if ($y == 22) {
+        // step 475
+        $a = $b * step1($y, $y) - step15($a);
+        step9($b);
+        // step 478
+        $x = 96 + $a;
+    } else {
+        step18($x);
+        // step 482
+        $b = $y + $y;
+        $b = $y;
+    }
+    if ($y < 66) {
+        step10($b, $y);
+        step6($y);
+    }
+    if ($b < 1) {
+        // step 491
+        $x = $y - 87 * 29;
+        step3($x);
+    }
+    $b = step3($a) + 43;
+    if ($a > 69) {
+        // step 497
+        $y = $y + 22;
+        step5($y, $a);
+        // step 500
+        $b = step4($x, $a) + $y + 4;
+        // step 502
+        $y = $y * $x;
+    }
+    for ($i1 = 0; $i1 < 92; $i1++) {
+        // step 506
+        $x = $i1;
+    }
+    return 6 + 30;
+}
+
+// step20: generated
+function step20($a, $b) {
+    $x = 76 * $b;
+    $y = 65;
+    step8($b, $x);
+    $x = 15;
+    for ($i1 = 0; $i1 < 60; $i1++) {
+        $x = step2($i1, $x) - $b * $b;
+        // step 520
+        $i1 = $x + $y;
+        step7($b, $i1);
+    }
+    if ($b > 62) {
+        step17($y, $y);
+        $b = step17($x, $a);
+        step5($x, $y);
+        // step 528
+        $a = 90 + 43 - $b;
+    }
+    return $b - $x;
+}
+
+// step21: generated
+function step21($a) {
+    $x = $a;
+    $y = 21;
+    // step 538
+    $y = $a;
+    // step 540
+    $y = $x + $x * $y;
+    $x = $y * 28;
+    $x = step8($x, $x) * $a;
+    if ($y < 76) {
+        $y = $x;
+        $a = step19($a, $x) - $y - step20($a, $a);
+    }
+    return $y + $a;
+}
+
+// step22: generated
+function step22($a, $b) {
+    $x = 20;
+    $y = 47;
+    $x = 67 * 43;
+    step16($b, $y);
+    step0($y);
+    $b = 99 + $y;
+    return 70;
+}
+
+// step23: generated
+function step23($a, $b) {
+    $x = 13;
+    $y = 78;
+    for ($i1 = 0; $i1 < 63; $i1++) {
+        $i1 = step0($y) - 70;
+        // step 568
+        $a = 24 + 42;
+    }
+    step22($x, $a);
+    step15($b);
+    return 15;
+}
+
+// step24: generated
+function step24($a) {
+    $x = 6 + $a + 11;
+    $y = 90;
+    if ($a < 35) {
+        // step 581
+        $x = $a - $x;
+        step14($y, $a);
+        $a = $a;
+        // step 585
+        $x = 24 - $a;
+    }
+    for ($i1 = 0; $i1 < 86; $i1++) {
+        $y = $x + $y;
+        // step 590
+        $x = step22($y, $i1) * 76 - $i1;
+    }
+    // step 593
+    $x = 35;
+    step15($y);
+    return 94 + 22 * $a;
+}
+
+// step25: generated
+function step25($a, $b) {
+    $x = $b;
+    $y = 18;
+    $a = $a;
+    $y = 66 * $x * 26;
+    if ($b == 64) {
+        // step 606
+        $a = step23($y, $y);
+        // step 608
+        $a = $y - step11($y, $x) + step4($x, $b);
+        step5($a, $y);
+        // step 611
+        $b = $x - $y;
+    } else {
+        // step 614
+        $b = $x - 84 + 31;
+        // step 616
+        $a = step8($x, $a) - $a * $x;
+        // step 618
+        $y = $a;
+        // step 620
+        $b = 57 + $x + 0;
+    }
+    if ($a > 74) {
+        // step 624
+        $b = $x;
+    } else {
+        // step 627
+        $a = $y * $x + 22;
+    }
+    $y = $b - 51;
+    if ($x < 85) {
+        $y = 77;
+        // step 633
+        $b = step1($x, $x) - 75;
+    }
+    return $b - $a + 4;
+}
+
+// step26: generated
+function step26($a, $b) {
+    $x = $a * $b - $a;
+    $y = 1;
+    $b = 82;
+    $y = 0 + 39;
+    // step 645
+    $a = step9($y) * $b * $x;
+    $a = 32;
+    if ($a > 91) {
+        // step 649
+        $x = $x - $x + $b;
+        // step 651
+        $y = $y - 39 - 24;
+        // step 653
+        $b = $y;
+        // step 655
+        $b = $x - step21($x);
+    } else {
+        // step 658
+        $x = $x + 12 * $y;
+        // step 660
+        $a = $b;
+        // step 662
+        $y = 98;
+        step18($y);
+    }
+    for ($i1 = 0; $i1 < 53; $i1++) {
+        // step 667
+        $x = step21($a) - 82 * 54;
+        // step 669
+        $b = 45 - step10($y, $i1);
+        $y = $x;
+        $x = 16;
+    }
+    $x = step0($a);
+    $b = 57;
+    return $b;
+}
+
+// step27: generated
+function step27($a) {
+    $x = 17 + 33 + 0;
+    $y = 1;
+    $a = 77 + $x + step11($a, $y);
+    $y = 36 + 44;
+    for ($i1 = 0; $i1 < 31; $i1++) {
+        $x = $y - $x + 10;
+        step26($x, $y);
+        $i1 = $a + $y;
+        // step 689
+        $a = step17($a, $x);
+    }
+    if ($a > 50) {
+        // step 693
+        $y = $y * $a * $y;
+        $x = 81 * $x;
+        step25($a, $x);
+    }
+    $a = 13 * 4;
+    if ($x > 21) {
+        // step 700
+        $a = step6($x) + $x + 86;
+    } else {
+        step7($x, $a);
+        step8($a, $x);
+    }
+    if ($y > 53) {
+        // step 707
+        $a = $x;
+        // step 709
+        $a = 56;
+        $a = step1($y, $y);
+    }
+    return $y - 9;
+}
+
+// step28: generated
+function step28($a, $b) {
+    $x = $b;
+    $y = 15;
+    // step 720
+    $y = $b;
+    step2($b, $b);
+    if ($b == 89) {
+        $x = 11 * step5($a, $b);
+        $b = $y * $y * $y;
+        $a = $b;
+        step20($b, $x);
+    }
+    return 69 - 95;
+}
+
+// step29: generated
+function step29($a, $b) {
+    $x = $b * $b;
+    $y = 35;
+    for ($i1 = 0; $i1 < 5; $i1++) {
+        // step 737
+        $x = $y;
+    }
+    // step 740
+    $a = step12($a) * 59;
+    if ($x > 24) {
+        $b = $b;
+    }
+    // step 745
+    $b = step21($a) * $b;
+    if ($x < 56) {
+        // step 748
+        $a = 22 + step0($x);
+        step8($b, $a);
+        // step 751
+        $y = 81 * 92;
+        $a = $a;
+    } else {
+        $y = $b + $a;
+        // step 756
+        $a = 7 + 75;
+    }
+    return $y * 4 * $b;
+}
+
+// step30: generated
+function step30($a) {
+    $x = $a + 35;
+    $y = 3;
+    if ($x == 88) {
+        // step 767
+        $y = $y - step10($a, $a) * $y;
+        $a = 40;
+        $x = step10($x, $y) + step11($y, $y) - 0;
+    }
+    $a = step24($x) * $y * $y;
+    for ($i1 = 0; $i1 < 41; $i1++) {
+        step20($a, $i1);
+    }
+    if ($y < 86) {
+        // step 777
+        $y = step3($y) - 99;
+        // step 779
+        $a = step15($y) - step26($a, $x);
+    }
+    $x = $y + step24($y);
+    return $a;
+}
+
+// step31: generated
+function step31($a, $b) {
+    $x = $b;
+    $y = 74;
+    step23($x, $x);
+    $b = $y;
+    if ($b == 66) {
+        $y = $y + step2($x, $x);
+        // step 794
+        $x = 99 - 49;
+        step28($b, $y);
+        // step 797
+        $y = 72 - $x + $b;
+    }
+    $y = $x - $a;
+    step13($b, $b);
+    if ($b > 50) {
+        step6($b);
+    } else {
+        // step 805
+        $x = $x;
+        $x = step26($y, $x);
+    }
+    step9($x);
+    // step 810
+    $b = 61 - $a + 70;
+    return $y * $x;
+}
+
+$total = 0;
+$total = $total + step27(4);
+$total = $total + step28(83, 39);
+$total = $total + step29(46, 21);
+$total = $total + step30(5);
+$total = $total + step31(57, 25);
+echo $total;
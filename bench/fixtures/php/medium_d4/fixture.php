@@ -0,0 +1,904 @@
+<?php
+
+// step0: generated
+function step0($a) {
+    $x = $a * $a * $a;
+    $y = 92;
+    $x = $a + $a + $y;
+    if ($y > 68) {
+        if ($x == 81) {
+            $a = $x - $x + $y;
+            if ($x < 52) {
+                if ($a < 84) {
+                    $a = 7;
+                    // step 13
+                    $x = $x - $a * $a;
+                } else {
+                    // step 16
+                    $x = 20 * $a - 41;
+                }
+                if ($a < 50) {
+                    // step 20
+                    $a = $a;
+                    $x = 74 + $y;
+                } else {
+                    $a = $a;
+                }
+            }
+            for ($i3 = 0; $i3 < 74; $i3++) {
+                $i3 = $a;
+            }
+        }
+    } else {
+        if ($a < 10) {
+            $x = 9;
+            if ($y > 36) {
+                $a = $a;
+                for ($i4 = 0; $i4 < 96; $i4++) {
+                    // step 37
+                    $a = $x + $a + $a;
+                }
+            }
+        }
+        $x = 11 + $a;
+        if ($a < 97) {
+            if ($y < 96) {
+                $y = $y + $y - $x;
+            } else {
+                $y = 7 + $a - $a;
+            }
+        } else {
+            for ($i3 = 0; $i3 < 86; $i3++) {
+                if ($x == 52) {
+                    // step 52
+                    $y = 70 + $i3;
+                    $x = 62 - $i3 + $i3;
+                }
+            }
+        }
+    }
+    $x = 11;
+    return $x;
+}
+
+// step1: generated
+function step1($a, $b) {
+    $x = $a - $b;
+    $y = 50;
+    for ($i1 = 0; $i1 < 49; $i1++) {
+        $i1 = $a - step0($b);
+    }
+    $y = $x * 66;
+    if ($b > 64) {
+        if ($x < 61) {
+            if ($a < 23) {
+                $x = step0($a) - step0($b) - 65;
+                step0($b);
+            } else {
+                if ($a > 30) {
+                    // step 78
+                    $x = 53 + $y + step0($a);
+                }
+                if ($y == 99) {
+                    // step 82
+                    $y = 73 * step0($y) - $x;
+                } else {
+                    $x = step0($a) + $b - 0;
+                    // step 86
+                    $x = step0($x);
+                    // step 88
+                    $x = $b - $y + $b;
+                }
+            }
+            if ($y < 60) {
+                step0($y);
+            } else {
+                $y = step0($y);
+            }
+            $y = 42 + 28 - $a;
+        } else {
+            for ($i3 = 0; $i3 < 44; $i3++) {
+                if ($y == 26) {
+                    $x = $i3 * 49 * $x;
+                    // step 102
+                    $y = step0($b) + $x;
+                } else {
+                    // step 105
+                    $y = $b + $x;
+                    $a = $y;
+                }
+                for ($i4 = 0; $i4 < 69; $i4++) {
+                    // step 110
+                    $x = $b + 9;
+                    // step 112
+                    $i4 = 9 - $y;
+                    step0($i3);
+                }
+                $x = step0($a);
+            }
+        }
+        // step 119
+        $x = $y + 83 + $b;
+    }
+    if ($y == 11) {
+        if ($b > 18) {
+            $y = $y * $y + step0($x);
+            if ($b > 61) {
+                for ($i4 = 0; $i4 < 57; $i4++) {
+                    // step 127
+                    $i4 = step0($i4) - 68;
+                    // step 129
+                    $y = $a - 94 - 10;
+                    // step 131
+                    $x = $y;
+                }
+            }
+            if ($x > 94) {
+                $y = 31 * step0($b);
+            } else {
+                $a = $b - $a;
+            }
+            step0($x);
+        } else {
+            $a = step0($x) - $b * $a;
+            // step 143
+            $b = $a - $a - 30;
+        }
+    }
+    $x = 21 - $x;
+    $b = step0($b);
+    if ($a > 60) {
+        $a = 20;
+        step0($x);
+        step0($a);
+    }
+    if ($a < 71) {
+        $y = $x * $y;
+    }
+    return $b * $y * 32;
+}
+
+// step2: generated
+function step2($a, $b) {
+    $x = $a - $b - 81;
+    $y = 66;
+    for ($i1 = 0; $i1 < 16; $i1++) {
+        $x = step1($i1, $x) * 82 + step1($b, $y);
+        if ($x < 65) {
+            $x = 36;
+            if ($a < 98) {
+                if ($y > 66) {
+                    // step 170
+                    $y = $a;
+                    // step 172
+                    $b = $b;
+                    $a = $i1;
+                }
+                $i1 = 19;
+            } else {
+                if ($b > 40) {
+                    // step 179
+                    $i1 = step0($b) - $y;
+                } else {
+                    // step 182
+                    $i1 = 76;
+                }
+            }
+            $b = 63;
+            step1($y, $i1);
+        }
+    }
+    if ($b > 36) {
+        $y = $y + 89;
+        $x = step0($x) * 48;
+        $a = $b + $a - 69;
+        step0($y);
+    }
+    // step 196
+    $a = $y + $y - $b;
+    if ($y == 14) {
+        // step 199
+        $x = $a;
+    }
+    if ($y < 1) {
+        $b = 65;
+        if ($b < 67) {
+            for ($i3 = 0; $i3 < 97; $i3++) {
+                $y = step1($y, $x) * 92 + $i3;
+                if ($b > 3) {
+                    step0($i3);
+                }
+                $x = $i3;
+            }
+        }
+    } else {
+        // step 214
+        $y = $b * step0($y) - step0($b);
+        $b = $b - $b;
+        step1($x, $x);
+    }
+    $x = 1 - step1($x, $x) * step0($y);
+    return $x;
+}
+
+// step3: generated
+function step3($a) {
+    $x = $a + $a;
+    $y = 83;
+    if ($x < 14) {
+        $y = 92 + $x - $x;
+        if ($a > 21) {
+            $a = step2($x, $a);
+            if ($y < 11) {
+                step1($x, $x);
+            }
+        } else {
+            $a = $a;
+        }
+        $y = 56 + $a + $x;
+    }
+    if ($y == 41) {
+        $x = $a;
+        step0($a);
+        if ($y > 1) {
+            step1($a, $x);
+            for ($i3 = 0; $i3 < 33; $i3++) {
+                $i3 = $x + step2($i3, $x) + 83;
+            }
+            if ($a > 12) {
+                if ($x == 43) {
+                    // step 249
+                    $y = 9 * $a + 89;
+                } else {
+                    // step 252
+                    $x = $x;
+                }
+            } else {
+                $x = $a + step2($x, $a);
+                $x = 52 + $x;
+            }
+        }
+    } else {
+        if ($x == 78) {
+            if ($y < 94) {
+                if ($y < 80) {
+                    // step 264
+                    $y = step0($x);
+                    // step 266
+                    $y = 19;
+                    $a = step1($x, $x);
+                } else {
+                    $y = $y * $x;
+                    $a = $x - 6;
+                    // step 272
+                    $x = $y;
+                }
+            } else {
+                if ($x > 54) {
+                    // step 277
+                    $y = $y * $y;
+                }
+            }
+            if ($a == 70) {
+                for ($i4 = 0; $i4 < 91; $i4++) {
+                    // step 283
+                    $y = step2($a, $y);
+                }
+            }
+            if ($x > 99) {
+                step0($x);
+            }
+        } else {
+            step2($y, $y);
+            // step 292
+            $x = step2($a, $y) * $y - $y;
+        }
+        $y = $a;
+        $x = $x;
+        if ($a == 68) {
+            if ($y == 50) {
+                if ($y < 56) {
+                    // step 300
+                    $a = 69 - $a + $x;
+                    $y = 1;
+                    // step 303
+                    $x = 98;
+                }
+            } else {
+                $x = $y - $y + step2($y, $x);
+            }
+            if ($x == 99) {
+                if ($a == 35) {
+                    step1($x, $x);
+                    $x = $x - $y;
+                }
+                $a = $a * $x + $x;
+            }
+            step0($x);
+        }
+    }
+    for ($i1 = 0; $i1 < 10; $i1++) {
+        $y = 36;
+        $a = step0($x);
+        if ($a < 3) {
+            step2($y, $y);
+            $y = $y + step1($y, $y);
+        }
+        $a = 98 + step2($x, $y) - $x;
+    }
+    if ($a < 9) {
+        if ($y > 5) {
+            step0($x);
+            step2($a, $a);
+        }
+    } else {
+        $x = 26 * $a + step0($y);
+        $x = 59 - $a;
+        if ($a > 7) {
+            for ($i3 = 0; $i3 < 81; $i3++) {
+                for ($i4 = 0; $i4 < 15; $i4++) {
+                    $y = 15 - $x;
+                }
+                if ($y > 68) {
+                    $i3 = step0($i3) - $i3 * 56;
+                }
+            }
+            $x = 86 * $a + 52;
+            if ($x == 23) {
+                for ($i4 = 0; $i4 < 23; $i4++) {
+                    // step 348
+                    $x = 0 * $x;
+                    step1($a, $y);
+                    // step 351
+                    $y = $a;
+                }
+            }
+            $y = 59 * $x;
+        } else {
+            $x = step2($a, $y) - $x + $a;
+            if ($y < 42) {
+                if ($x < 96) {
+                    $a = step0($a) - $y;
+                } else {
+                    step2($y, $y);
+                    // step 363
+                    $a = 84;
+                }
+            } else {
+                for ($i4 = 0; $i4 < 6; $i4++) {
+                    $x = step0($i4);
+                    // step 369
+                    $a = $y - $x;
+                    // step 371
+                    $a = step1($x, $a) * 50 - 32;
+                }
+            }
+        }
+    }
+    if ($a == 33) {
+        $a = 10 + $a * 86;
+    } else {
+        $a = $y + 36;
+    }
+    if ($y == 97) {
+        $x = $x * $x * $x;
+        if ($a == 21) {
+            step0($a);
+            $a = $x * 79;
+            if ($a < 27) {
+                if ($a < 55) {
+                    $a = $a + $x;
+                    $a = $a * 76;
+                    $x = 77 * $x - $a;
+                } else {
+                    // step 393
+                    $x = step2($a, $a);
+                }
+            }
+        } else {
+            for ($i3 = 0; $i3 < 90; $i3++) {
+                for ($i4 = 0; $i4 < 19; $i4++) {
+                    $i4 = $i3 * 0;
+                    step0($a);
+                }
+            }
+            $x = 21 + 71 * 57;
+        }
+    }
+    for ($i1 = 0; $i1 < 69; $i1++) {
+        $y = $y;
+        step2($x, $y);
+    }
+    return $y;
+}
+
+// step4: generated
+function step4($a, $b) {
+    $x = $a;
+    $y = 53;
+    for ($i1 = 0; $i1 < 53; $i1++) {
+        if ($x > 34) {
+            if ($i1 == 70) {
+                step3($y);
+                $i1 = $x + 86;
+            } else {
+                $b = 72 - 8 - 8;
+                $y = 92 + $y + $x;
+                if ($b == 71) {
+                    $i1 = $b + 60;
+                    step1($x, $b);
+                    // step 429
+                    $b = $b;
+                }
+            }
+        }
+    }
+    step0($b);
+    step2($b, $x);
+    if ($x > 24) {
+        step2($b, $a);
+        $a = 28;
+        $b = $a;
+    } else {
+        if ($b < 41) {
+            $b = 63 - 67;
+        }
+        if ($a == 82) {
+            step0($x);
+            if ($x == 63) {
+                if ($a == 98) {
+                    step2($y, $a);
+                    $b = $b * step3($a);
+                }
+            } else {
+                for ($i4 = 0; $i4 < 68; $i4++) {
+                    step0($b);
+                    // step 455
+                    $b = $b * $y * $a;
+                }
+                if ($x > 77) {
+                    // step 459
+                    $y = $b * $x;
+                } else {
+                    // step 462
+                    $x = $b * 14;
+                    // step 464
+                    $y = 28 * $x;
+                }
+            }
+            $a = $y * $y * step3($b);
+            $a = $a;
+        }
+    }
+    $x = step0($a) * $b * $b;
+    for ($i1 = 0; $i1 < 41; $i1++) {
+        for ($i2 = 0; $i2 < 99; $i2++) {
+            for ($i3 = 0; $i3 < 8; $i3++) {
+                step0($i2);
+                $b = $y;
+            }
+            $i1 = 79 - 44;
+        }
+    }
+    if ($a > 33) {
+        if ($y > 12) {
+            if ($a == 8) {
+                // step 485
+                $b = 19 * 42 + step1($x, $y);
+                $b = 5;
+            }
+            // step 489
+            $b = $y - $y;
+            // step 491
+            $b = $x;
+        } else {
+            if ($x > 6) {
+                // step 495
+                $a = $y;
+            }
+            if ($x < 82) {
+                for ($i4 = 0; $i4 < 76; $i4++) {
+                    // step 500
+                    $y = $i4;
+                    // step 502
+                    $i4 = $x + $b;
+                }
+                $y = 0 * 18 - $b;
+            } else {
+                for ($i4 = 0; $i4 < 30; $i4++) {
+                    $a = $b + $b - $a;
+                }
+            }
+            if ($a > 87) {
+                step1($y, $y);
+                if ($y == 36) {
+                    $a = $x - $b;
+                } else {
+                    // step 516
+                    $a = $a + step3($y) * $y;
+                    $b = $a;
+                    // step 519
+                    $y = $x;
+                }
+                step0($x);
+            }
+            if ($y == 61) {
+                $a = $a + $x;
+            } else {
+                $a = $a - 71 + $a;
+            }
+        }
+        $x = $x * 75 * $y;
+        // step 531
+        $x = $x - $a - 13;
+    }
+    step0($b);
+    return 71 + $x + $b;
+}
+
+// step5: generated
+function step5($a, $b) {
+    $x = $b;
+    $y = 36;
+    for ($i1 = 0; $i1 < 56; $i1++) {
+        // step 543
+        $y = $y;
+        if ($x < 54) {
+            if ($i1 > 21) {
+                if ($y > 4) {
+                    // step 548
+                    $a = $a * 16 + 50;
+                    // step 550
+                    $x = step3($i1);
+                    // step 552
+                    $a = 27 - step1($a, $i1);
+                }
+            }
+            step1($i1, $a);
+            if ($i1 < 98) {
+                if ($y > 76) {
+                    // step 559
+                    $i1 = $y - step3($a) - 60;
+                    // step 561
+                    $i1 = step3($i1) - $x + 81;
+                    $a = $i1;
+                } else {
+                    // step 565
+                    $b = 79;
+                    step1($x, $x);
+                }
+                $b = step2($x, $b);
+            }
+            if ($x < 77) {
+                if ($b == 14) {
+                    // step 573
+                    $a = $b;
+                    $b = $a - $a * $a;
+                }
+                $b = 37 * $i1 - step0($b);
+            } else {
+                for ($i4 = 0; $i4 < 5; $i4++) {
+                    step2($i4, $i4);
+                }
+                if ($a < 14) {
+                    // step 583
+                    $a = 48;
+                }
+            }
+        }
+        if ($y > 53) {
+            if ($a == 8) {
+                if ($y > 20) {
+                    // step 591
+                    $a = 80 - $a + 50;
+                    $b = $b - step4($i1, $y) * 76;
+                    $a = $x;
+                } else {
+                    step4($b, $y);
+                }
+                if ($b > 20) {
+                    $y = $x - 23 * 79;
+                    step4($a, $i1);
+                }
+                $i1 = 24 + $i1 * $b;
+            } else {
+                for ($i4 = 0; $i4 < 35; $i4++) {
+                    // step 605
+                    $y = $a;
+                }
+                $y = 72 + $i1 * 4;
+            }
+        }
+    }
+    if ($x < 38) {
+        for ($i2 = 0; $i2 < 22; $i2++) {
+            if ($i2 < 72) {
+                if ($x == 33) {
+                    // step 616
+                    $y = 15;
+                    // step 618
+                    $x = $a;
+                    // step 620
+                    $i2 = 59;
+                }
+            }
+            $b = $i2;
+        }
+        // step 626
+        $b = 56 - $y * 5;
+        // step 628
+        $y = 83;
+        $x = 94 - 57;
+    } else {
+        if ($b > 2) {
+            $y = 65 - 63;
+            $x = $y + $b;
+            $x = $a - 40;
+            $a = $y - 1;
+        }
+        if ($y < 10) {
+            // step 639
+            $b = 70;
+            if ($x == 25) {
+                if ($a == 66) {
+                    // step 643
+                    $x = step4($x, $a);
+                }
+            }
+        }
+    }
+    if ($y < 72) {
+        if ($x == 82) {
+            $y = step0($a) * $b - $x;
+            $a = 33 * 78 - 40;
+            if ($y > 28) {
+                if ($x > 35) {
+                    $y = step1($a, $x);
+                    // step 656
+                    $a = step2($a, $a) + $b * $y;
+                    // step 658
+                    $y = $y * 52 + 30;
+                } else {
+                    $b = 43 - $x - $a;
+                    // step 662
+                    $y = 99;
+                }
+            }
+        }
+        for ($i2 = 0; $i2 < 8; $i2++) {
+            // step 668
+            $b = 89;
+        }
+    } else {
+        $y = $y + $b;
+    }
+    step2($x, $b);
+    $y = 13;
+    if ($b > 75) {
+        step2($x, $y);
+        step4($b, $a);
+        // step 679
+        $b = $y + $b * step4($x, $y);
+    } else {
+        for ($i2 = 0; $i2 < 41; $i2++) {
+            if ($i2 > 64) {
+                step3($y);
+                $x = step1($y, $y) + $x - step0($b);
+                step4($i2, $i2);
+            } else {
+                $i2 = $x;
+                $y = $b + $y * 36;
+            }
+            if ($b == 3) {
+                $y = 48 + 18;
+            }
+            // step 694
+            $b = 31 - $a;
+        }
+        step2($b, $a);
+        if ($a == 43) {
+            $a = $a;
+            if ($b < 72) {
+                $y = step4($x, $y) * $y;
+            } else {
+                if ($x < 86) {
+                    // step 704
+                    $b = 38 - $x;
+                }
+                for ($i4 = 0; $i4 < 59; $i4++) {
+                    // step 708
+                    $x = step3($b) + $y;
+                    // step 710
+                    $b = $y + 43 * step2($a, $y);
+                }
+                for ($i4 = 0; $i4 < 95; $i4++) {
+                    // step 714
+                    $b = $x;
+                }
+            }
+            if ($a < 3) {
+                for ($i4 = 0; $i4 < 5; $i4++) {
+                    // step 720
+                    $x = step2($y, $b) * $a;
+                }
+                if ($x < 65) {
+                    // step 724
+                    $x = 52;
+                    // step 726
+                    $b = $a + 93 + 17;
+                    // step 728
+                    $a = $y - $y;
+                } else {
+                    // step 731
+                    $x = $y + $x;
+                }
+            } else {
+                $b = $a + 55 - $b;
+                if ($x == 89) {
+                    // step 737
+                    $b = $a;
+                    // step 739
+                    $x = $b;
+                } else {
+                    // step 742
+                    $b = $a - $b - $a;
+                }
+            }
+        } else {
+            // step 747
+            $x = $b * 58;
+            for ($i3 = 0; $i3 < 86; $i3++) {
+                $x = 7 + $y;
+            }
+        }
+        for ($i2 = 0; $i2 < 69; $i2++) {
+            step2($a, $a);
+        }
+    }
+    return 13;
+}
+
+// step6: generated
+function step6($a) {
+    $x = 44 - $a;
+    $y = 93;
+    $a = $a;
+    // step 765
+    $a = 3 - 81 * step5($y, $a);
+    $a = $a + step2($x, $y);
+    for ($i1 = 0; $i1 < 21; $i1++) {
+        // step 769
+        $i1 = 82 + $x * $y;
+        if ($i1 == 6) {
+            $x = 49;
+            $i1 = 31 - 50 * $y;
+            step5($a, $y);
+            step1($x, $y);
+        }
+        $a = $x;
+    }
+    $x = $a + 61 * $y;
+    if ($x < 75) {
+        $y = step4($x, $y) * 61;
+        step0($x);
+    }
+    return $y * 62 - 6;
+}
+
+// step7: generated
+function step7($a, $b) {
+    $x = $b;
+    $y = 78;
+    if ($x < 3) {
+        if ($y < 21) {
+            if ($a > 46) {
+                step5($x, $y);
+                step1($b, $a);
+                if ($b > 19) {
+                    // step 797
+                    $a = $x;
+                    // step 799
+                    $y = $x;
+                } else {
+                    $b = 62 * 81;
+                    $y = $a - 80 - 78;
+                    $a = $y - 24 - $b;
+                }
+            }
+            if ($b > 43) {
+                for ($i4 = 0; $i4 < 20; $i4++) {
+                    // step 809
+                    $y = step0($b) - $b * step3($i4);
+                    // step 811
+                    $y = step5($x, $x) - $i4;
+                }
+                step6($y);
+            } else {
+                $a = $y * $x * step4($y, $b);
+            }
+            step5($b, $a);
+        } else {
+            $a = step3($b) + 95;
+            if ($x < 61) {
+                step5($a, $b);
+                step1($b, $a);
+                $a = 41 - $a;
+            }
+        }
+        // step 827
+        $x = $y - $a;
+    }
+    if ($a > 44) {
+        $b = 28;
+    }
+    step1($b, $a);
+    if ($y == 77) {
+        step5($a, $x);
+        if ($b == 72) {
+            if ($y > 14) {
+                if ($a < 14) {
+                    step3($y);
+                    step1($b, $x);
+                    $x = 20;
+                }
+            }
+        }
+        // step 845
+        $x = step0($a);
+    } else {
+        $a = step3($a);
+        for ($i2 = 0; $i2 < 16; $i2++) {
+            step2($i2, $y);
+        }
+    }
+    // step 853
+    $a = $a + $x;
+    $a = 61 + 73 - $a;
+    if ($b == 17) {
+        // step 857
+        $a = step6($a);
+        $x = 30 - 44 + 41;
+        // step 860
+        $b = $b;
+        for ($i2 = 0; $i2 < 91; $i2++) {
+            if ($y == 7) {
+                $i2 = 62;
+                if ($y > 92) {
+                    step0($i2);
+                }
+                step6($a);
+            }
+            $a = $x + step1($a, $y);
+            if ($y < 51) {
+                if ($x > 52) {
+                    // step 873
+                    $i2 = 42 + $b * 96;
+                }
+            }
+        }
+    } else {
+        $b = step1($x, $b) * $x + step6($y);
+        $a = 46 + 29 * 44;
+        step6($x);
+        for ($i2 = 0; $i2 < 10; $i2++) {
+            $a = 58 - step5($b, $y) + $a;
+            step6($x);
+            $a = step5($a, $x) + $i2;
+            // step 886
+            $x = 35 * step6($x);
+        }
+    }
+    for ($i1 = 0; $i1 < 4; $i1++) {
+        // step 891
+        $x = $x * 18;
+    }
+    return $y - 0;
+}
+
+$total = 0;
+$total = $total + step3(79);
+$total = $total + step4(84, 14);
+$total = $total + step5(79, 98);
+$total = $total + step6(55);
+$total = $total + step7(94, 80);
+echo $total;
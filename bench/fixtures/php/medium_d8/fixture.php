@@ -0,0 +1,855 @@
+<?php
+
+// step0: generated
+function step0($a) {
+    $x = $a;
+    $y = 77;
+    // step 6
+    $y = $a - $x;
+    $x = $a * $y - 51;
+    $a = $x;
+    for ($i1 = 0; $i1 < 89; $i1++) {
+        for ($i2 = 0; $i2 < 54; $i2++) {
+            $y = 65 - $y;
+            $i2 = $x * 94 + 4;
+            $i1 = $i2;
+            if ($x > 41) {
+                if ($x > 42) {
+                    $i1 = 11;
+                    $i2 = 61 - 52;
+                } else {
+                    for ($i5 = 0; $i5 < 14; $i5++) {
+                        if ($x < 81) {
+                            $i5 = $i1 - $y;
+                        }
+                    }
+                    $x = $a - 45;
+                    if ($a < 43) {
+                        if ($x < 74) {
+                            if ($y < 37) {
+                                $a = $a;
+                            }
+                        }
+                        if ($x > 20) {
+                            for ($i7 = 0; $i7 < 24; $i7++) {
+                                if ($y > 80) {
+                                    $x = $i2 + $a;
+                                    // step 36
+                                    $i7 = 51 - 70;
+                                } else {
+                                    $i1 = 60;
+                                }
+                                if ($i7 == 4) {
+                                    // step 42
+                                    $i7 = $i7 - $i7;
+                                }
+                            }
+                        }
+                    } else {
+                        $y = 23;
+                    }
+                }
+            } else {
+                $x = $i1 + $a * $i2;
+            }
+        }
+    }
+    for ($i1 = 0; $i1 < 33; $i1++) {
+        for ($i2 = 0; $i2 < 91; $i2++) {
+            $i1 = $a;
+            $i2 = 13 + $i1;
+        }
+    }
+    for ($i1 = 0; $i1 < 25; $i1++) {
+        if ($y == 37) {
+            if ($a == 23) {
+                if ($x < 19) {
+                    $i1 = $a - $y;
+                    $a = $a * $i1 * $a;
+                }
+            } else {
+                // step 70
+                $i1 = 35 + $a + 16;
+                $i1 = $i1 * $y;
+                for ($i4 = 0; $i4 < 33; $i4++) {
+                    if ($y < 23) {
+                        $x = $i1;
+                        if ($a < 79) {
+                            $a = $y * 8;
+                        }
+                    } else {
+                        $i4 = 16 * $i4;
+                    }
+                }
+            }
+            $i1 = $a + 15;
+            if ($x < 65) {
+                if ($y > 93) {
+                    // step 87
+                    $y = 0;
+                }
+                $a = $x;
+                $x = $y + 76 * 30;
+            } else {
+                // step 93
+                $x = $y + 80;
+            }
+            if ($y == 36) {
+                if ($y == 19) {
+                    $i1 = $i1 * $y - $a;
+                    if ($i1 > 53) {
+                        $x = 42 - $x;
+                        $a = 18 + 54 * $y;
+                    } else {
+                        for ($i6 = 0; $i6 < 51; $i6++) {
+                            for ($i7 = 0; $i7 < 69; $i7++) {
+                                for ($i8 = 0; $i8 < 46; $i8++) {
+                                    $a = 13;
+                                }
+                            }
+                        }
+                    }
+                    $x = 98 + $y;
+                } else {
+                    if ($a > 22) {
+                        $a = 26 * $y;
+                    }
+                    // step 116
+                    $i1 = $i1 * $x;
+                    $i1 = 38 + $a;
+                }
+            } else {
+                if ($y == 15) {
+                    $i1 = 53 + $y * 0;
+                    $i1 = 31 * $a + $y;
+                    if ($y < 11) {
+                        $x = 66 - $y * $x;
+                    } else {
+                        $x = $y + $y;
+                        $y = $a;
+                    }
+                } else {
+                    if ($y == 33) {
+                        $a = $a * $x;
+                    }
+                    $x = $i1 * 13 * $y;
+                }
+                $a = $y + 44;
+            }
+        } else {
+            for ($i3 = 0; $i3 < 14; $i3++) {
+                if ($i1 == 81) {
+                    $a = $a - $i1;
+                }
+                $a = 45;
+                // step 144
+                $y = 78 * $x;
+            }
+            $i1 = 52;
+            // step 148
+            $y = $i1 - 84;
+        }
+        $y = 68;
+        for ($i2 = 0; $i2 < 25; $i2++) {
+            $x = 22 + 72 + $a;
+        }
+    }
+    if ($a > 6) {
+        if ($x > 41) {
+            if ($x == 84) {
+                if ($y == 67) {
+                    if ($a > 98) {
+                        $y = 79 * $y;
+                        if ($a < 19) {
+                            $y = 6;
+                        }
+                    }
+                }
+                if ($a > 36) {
+                    // step 168
+                    $y = 69 - $a * 91;
+                    $a = $y * $y;
+                }
+                $x = $x + $y * $y;
+            } else {
+                $x = $a;
+                if ($x == 75) {
+                    $y = $x * $x;
+                    for ($i5 = 0; $i5 < 79; $i5++) {
+                        $x = $a * 38 + 97;
+                        $i5 = 76 - $x + $i5;
+                        for ($i6 = 0; $i6 < 82; $i6++) {
+                            for ($i7 = 0; $i7 < 74; $i7++) {
+                                if ($i7 < 99) {
+                                    $a = $i5 - $i6;
+                                    $x = 70 - 72;
+                                }
+                                $x = 14 * $i6;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    $a = $y * 34;
+    return 61 * $y;
+}
+
+// step1: generated
+function step1($a, $b) {
+    $x = 39 + $b * $a;
+    $y = 54;
+    for ($i1 = 0; $i1 < 27; $i1++) {
+        if ($y == 27) {
+            // step 204
+            $x = 56 + 34;
+            if ($x == 96) {
+                if ($i1 > 42) {
+                    if ($a == 87) {
+                        if ($a < 77) {
+                            $x = $a * 66 * step0($a);
+                        } else {
+                            for ($i7 = 0; $i7 < 32; $i7++) {
+                                $b = $b - $b;
+                            }
+                        }
+                        step0($a);
+                    }
+                } else {
+                    if ($a > 79) {
+                        $y = $i1;
+                    }
+                }
+            } else {
+                // step 224
+                $b = $i1 * $y;
+            }
+            if ($x > 24) {
+                for ($i4 = 0; $i4 < 17; $i4++) {
+                    $y = $i1;
+                    if ($y == 68) {
+                        for ($i6 = 0; $i6 < 35; $i6++) {
+                            step0($i1);
+                            step0($b);
+                        }
+                    }
+                }
+                $x = 84 * 47;
+                step0($a);
+            }
+        } else {
+            $i1 = $b - step0($a);
+            $b = 82 + 14 - 40;
+            $b = $b + step0($x);
+        }
+        if ($y < 70) {
+            step0($b);
+            $a = 64;
+            $a = $y - $b + step0($i1);
+            if ($i1 < 8) {
+                step0($x);
+            } else {
+                if ($b > 86) {
+                    step0($y);
+                    if ($b == 44) {
+                        $i1 = $i1;
+                        $x = 48 + $x - 32;
+                    }
+                }
+                if ($y < 45) {
+                    // step 260
+                    $y = 82 + 71 - 58;
+                } else {
+                    $b = 82 * 1 + step0($y);
+                }
+                $a = step0($y) + 76 - $i1;
+            }
+        } else {
+            for ($i3 = 0; $i3 < 90; $i3++) {
+                // step 269
+                $a = step0($i3) - $y;
+                $i3 = 72 * 38;
+            }
+            if ($a == 85) {
+                if ($i1 == 18) {
+                    $i1 = $b * $b + step0($x);
+                    if ($i1 < 19) {
+                        $b = 81;
+                    }
+                    // step 279
+                    $i1 = $x + 37;
+                } else {
+                    if ($b == 75) {
+                        // step 283
+                        $i1 = $b * $y + $a;
+                        $y = $x * step0($i1);
+                    } else {
+                        $a = step0($b);
+                        for ($i6 = 0; $i6 < 50; $i6++) {
+                            $i1 = step0($i1) * $a + $i6;
+                        }
+                    }
+                    step0($y);
+                }
+                if ($x < 22) {
+                    $b = $a;
+                    for ($i5 = 0; $i5 < 59; $i5++) {
+                        if ($i5 > 44) {
+                            $i1 = step0($x) - step0($b);
+                        } else {
+                            $i5 = 52 * 37 + 78;
+                        }
+                        $a = step0($b) - $i5;
+                    }
+                    $b = 76;
+                } else {
+                    // step 306
+                    $x = $i1 * $y - $b;
+                    $a = $b * step0($b) + 17;
+                }
+            }
+            step0($y);
+        }
+        if ($b < 36) {
+            step0($y);
+        } else {
+            if ($y == 73) {
+                // step 317
+                $x = 43 + $x - $a;
+            } else {
+                $i1 = $b * step0($a) + $x;
+            }
+            $b = $x - $i1 + $y;
+        }
+    }
+    if ($x < 44) {
+        if ($a > 66) {
+            $y = step0($y) * $a;
+            step0($y);
+        } else {
+            step0($y);
+            $a = $y;
+        }
+        // step 333
+        $y = 73 * $x;
+    } else {
+        // step 336
+        $b = $y;
+        step0($b);
+        step0($y);
+    }
+    // step 341
+    $x = 13 + 36 + 36;
+    $x = 90 * $b;
+    if ($a < 21) {
+        if ($b == 79) {
+            for ($i3 = 0; $i3 < 29; $i3++) {
+                $i3 = 56;
+                $b = 70 - 54;
+            }
+            $y = 32;
+            // step 351
+            $a = $x;
+        } else {
+            step0($a);
+            for ($i3 = 0; $i3 < 62; $i3++) {
+                $b = $y + 49 - $i3;
+                $b = step0($x) + $b + $i3;
+            }
+        }
+        if ($x < 28) {
+            $a = $y * $x + 27;
+            if ($b < 73) {
+                if ($y > 40) {
+                    // step 364
+                    $b = $a;
+                    if ($x < 85) {
+                        step0($a);
+                        step0($x);
+                        // step 369
+                        $a = $a - $a + 95;
+                    }
+                    for ($i5 = 0; $i5 < 3; $i5++) {
+                        $a = $x - 40;
+                        for ($i6 = 0; $i6 < 27; $i6++) {
+                            // step 375
+                            $i5 = 75 * $a;
+                        }
+                        if ($x < 91) {
+                            $y = 38 - 85;
+                            if ($i5 > 29) {
+                                $x = 93 - 48 * $y;
+                                $b = $i5;
+                            } else {
+                                $x = step0($x) - $b - 47;
+                            }
+                        } else {
+                            $i5 = $y;
+                            if ($b > 19) {
+                                if ($x < 46) {
+                                    // step 390
+                                    $a = $i5 + 13 - 37;
+                                } else {
+                                    // step 393
+                                    $x = $a - $x;
+                                }
+                            } else {
+                                $i5 = $y + $x;
+                                step0($b);
+                            }
+                        }
+                    }
+                }
+                $a = 65;
+            }
+        } else {
+            $a = $b;
+        }
+        if ($x > 27) {
+            if ($a == 54) {
+                step0($a);
+                if ($x < 29) {
+                    // step 412
+                    $y = step0($b);
+                } else {
+                    $a = 57;
+                }
+                step0($b);
+            }
+        }
+        $b = $b * $y;
+    }
+    return 68 - 63 - 59;
+}
+
+// step2: generated
+function step2($a, $b) {
+    $x = 15 - 64;
+    $y = 63;
+    if ($y == 83) {
+        for ($i2 = 0; $i2 < 56; $i2++) {
+            for ($i3 = 0; $i3 < 19; $i3++) {
+                if ($i2 > 3) {
+                    if ($a > 15) {
+                        $y = 30 * step0($a);
+                        for ($i6 = 0; $i6 < 29; $i6++) {
+                            for ($i7 = 0; $i7 < 16; $i7++) {
+                                $i6 = 93 - 44 + 58;
+                            }
+                        }
+                    } else {
+                        for ($i6 = 0; $i6 < 12; $i6++) {
+                            $x = $y * 91 + step1($x, $i6);
+                        }
+                    }
+                } else {
+                    for ($i5 = 0; $i5 < 35; $i5++) {
+                        for ($i6 = 0; $i6 < 40; $i6++) {
+                            if ($i3 > 16) {
+                                $i2 = $x + 80;
+                                step1($a, $i3);
+                            } else {
+                                if ($y > 69) {
+                                    // step 453
+                                    $i6 = 57 * 60;
+                                }
+                            }
+                        }
+                        $y = $i2;
+                    }
+                    step0($b);
+                }
+            }
+            step1($a, $i2);
+            $x = $y;
+            if ($y > 83) {
+                if ($a > 81) {
+                    // step 467
+                    $a = $i2;
+                    // step 469
+                    $a = $b + $b + $b;
+                    if ($i2 == 35) {
+                        $b = $a - 97 * $b;
+                        step0($x);
+                        $x = $y * step1($y, $b);
+                    } else {
+                        for ($i6 = 0; $i6 < 20; $i6++) {
+                            // step 477
+                            $x = 9 - step1($y, $x) - $i2;
+                        }
+                        // step 480
+                        $b = $b;
+                    }
+                }
+            } else {
+                for ($i4 = 0; $i4 < 81; $i4++) {
+                    for ($i5 = 0; $i5 < 34; $i5++) {
+                        for ($i6 = 0; $i6 < 85; $i6++) {
+                            if ($i4 > 38) {
+                                // step 489
+                                $i4 = $a + $i6;
+                            }
+                        }
+                        if ($i5 == 86) {
+                            $x = $x + $b + step0($i5);
+                        } else {
+                            if ($i2 < 92) {
+                                for ($i8 = 0; $i8 < 4; $i8++) {
+                                    $i8 = $y * $i2;
+                                }
+                            } else {
+                                $i2 = 4 * $y;
+                            }
+                        }
+                        $x = 35 * $y;
+                    }
+                }
+                step0($i2);
+            }
+        }
+        step0($b);
+        if ($x > 77) {
+            if ($x < 99) {
+                if ($x > 62) {
+                    $y = $y;
+                } else {
+                    if ($a == 73) {
+                        $b = 17 + 13;
+                    } else {
+                        if ($b > 90) {
+                            if ($b == 94) {
+                                for ($i8 = 0; $i8 < 88; $i8++) {
+                                    // step 522
+                                    $x = 27 - $i8;
+                                    // step 524
+                                    $b = $b - $a;
+                                }
+                                if ($x < 68) {
+                                    step0($b);
+                                }
+                            }
+                        } else {
+                            step0($a);
+                        }
+                        $b = $a * 67;
+                    }
+                    for ($i5 = 0; $i5 < 57; $i5++) {
+                        if ($b == 42) {
+                            $a = $b - $a;
+                        }
+                        $b = $a + $a - 98;
+                    }
+                    if ($y == 91) {
+                        for ($i6 = 0; $i6 < 32; $i6++) {
+                            if ($x < 35) {
+                                for ($i8 = 0; $i8 < 63; $i8++) {
+                                    // step 546
+                                    $y = $i8 - 75 - $y;
+                                }
+                            }
+                            if ($i6 > 89) {
+                                // step 551
+                                $b = $a * 79 + 66;
+                                if ($i6 == 85) {
+                                    // step 554
+                                    $a = $a + step1($y, $a);
+                                } else {
+                                    // step 557
+                                    $a = 69;
+                                }
+                            } else {
+                                $i6 = $a;
+                            }
+                        }
+                        $a = step0($b) + $b;
+                    } else {
+                        step0($x);
+                        for ($i6 = 0; $i6 < 27; $i6++) {
+                            // step 568
+                            $i6 = step1($a, $y);
+                        }
+                        // step 571
+                        $a = 73 * $x;
+                    }
+                }
+                // step 575
+                $y = $b;
+                if ($y > 68) {
+                    if ($y > 81) {
+                        step1($a, $y);
+                    } else {
+                        if ($x == 48) {
+                            if ($y == 57) {
+                                if ($a > 30) {
+                                    $a = 66;
+                                }
+                            } else {
+                                if ($x < 41) {
+                                    $b = step1($b, $b) - 12;
+                                }
+                                $x = $x;
+                            }
+                            // step 592
+                            $y = $a - step1($y, $a);
+                        } else {
+                            if ($b == 16) {
+                                $x = $b;
+                            } else {
+                                $b = 11;
+                            }
+                        }
+                        if ($x < 49) {
+                            for ($i7 = 0; $i7 < 83; $i7++) {
+                                if ($x > 57) {
+                                    // step 604
+                                    $b = $x;
+                                } else {
+                                    $x = 18;
+                                }
+                            }
+                        } else {
+                            $b = $a;
+                        }
+                        $a = $x + 15 + $y;
+                    }
+                    $a = $y - $x;
+                } else {
+                    if ($b == 95) {
+                        if ($a < 27) {
+                            if ($b == 82) {
+                                if ($x == 95) {
+                                    // step 621
+                                    $x = step1($x, $a);
+                                }
+                                $b = step1($y, $b);
+                            }
+                            $x = step0($a) * 1 - step0($y);
+                        }
+                    } else {
+                        step0($x);
+                        if ($y == 7) {
+                            $x = $b - 25 * 19;
+                        } else {
+                            if ($a < 10) {
+                                // step 634
+                                $y = $x;
+                            } else {
+                                step0($a);
+                            }
+                        }
+                    }
+                }
+            }
+        } else {
+            if ($a > 30) {
+                $b = 8 + $a * 72;
+                $b = $a - $y * step0($x);
+                for ($i4 = 0; $i4 < 33; $i4++) {
+                    step1($a, $y);
+                }
+            }
+            step1($x, $b);
+            if ($x < 71) {
+                $x = 72;
+                if ($x > 85) {
+                    step0($b);
+                    if ($b < 46) {
+                        if ($b < 76) {
+                            for ($i7 = 0; $i7 < 40; $i7++) {
+                                step1($b, $b);
+                            }
+                            // step 661
+                            $x = $y;
+                        } else {
+                            // step 664
+                            $a = 44 + step1($b, $a);
+                            step1($b, $y);
+                        }
+                    }
+                }
+            }
+        }
+    } else {
+        if ($x == 76) {
+            step1($x, $a);
+        } else {
+            if ($x < 1) {
+                // step 677
+                $b = $y - $y;
+            } else {
+                if ($y < 39) {
+                    if ($a < 23) {
+                        for ($i6 = 0; $i6 < 88; $i6++) {
+                            if ($y > 61) {
+                                for ($i8 = 0; $i8 < 47; $i8++) {
+                                    // step 685
+                                    $i8 = 20 - step1($a, $b) - step1($b, $b);
+                                    // step 687
+                                    $y = 59 - $i6;
+                                }
+                            } else {
+                                if ($b < 80) {
+                                    // step 692
+                                    $i6 = 50 + $i6 + 58;
+                                } else {
+                                    // step 695
+                                    $i6 = $i6 + $y - $a;
+                                }
+                            }
+                        }
+                    } else {
+                        for ($i6 = 0; $i6 < 6; $i6++) {
+                            $i6 = $x * step1($b, $i6) + 17;
+                        }
+                    }
+                }
+                for ($i4 = 0; $i4 < 53; $i4++) {
+                    if ($a == 10) {
+                        step1($x, $y);
+                    } else {
+                        step0($y);
+                    }
+                }
+            }
+            if ($x < 71) {
+                $y = 91 * 44 * $x;
+            }
+            $a = 76;
+            // step 718
+            $x = 17 + $b;
+        }
+    }
+    if ($x == 28) {
+        // step 723
+        $b = $b - $b;
+        $b = $b + 35 - 92;
+        step1($y, $a);
+        if ($y > 16) {
+            step0($x);
+            // step 729
+            $a = $b + 81;
+            for ($i3 = 0; $i3 < 5; $i3++) {
+                if ($a > 87) {
+                    for ($i5 = 0; $i5 < 36; $i5++) {
+                        $b = $b;
+                        $b = $y;
+                        if ($x == 70) {
+                            if ($y < 22) {
+                                // step 738
+                                $i5 = 63;
+                            }
+                        }
+                    }
+                    // step 743
+                    $x = step0($a) - step1($y, $i3) - 11;
+                    for ($i5 = 0; $i5 < 35; $i5++) {
+                        $y = $i3 + 45;
+                        if ($x == 51) {
+                            // step 748
+                            $x = $b * 21 * 5;
+                            if ($y == 99) {
+                                // step 751
+                                $y = 97 + $b;
+                            }
+                        }
+                    }
+                }
+                if ($a > 47) {
+                    if ($b == 50) {
+                        $a = $y - 99 - 6;
+                        if ($b < 0) {
+                            if ($b > 5) {
+                                if ($a > 79) {
+                                    // step 763
+                                    $b = 69;
+                                    // step 765
+                                    $a = 31;
+                                }
+                            }
+                        } else {
+                            for ($i7 = 0; $i7 < 96; $i7++) {
+                                if ($b > 14) {
+                                    // step 772
+                                    $b = 8 + $y;
+                                }
+                            }
+                            if ($b > 68) {
+                                for ($i8 = 0; $i8 < 31; $i8++) {
+                                    // step 778
+                                    $a = step0($y) - $i3 - $y;
+                                }
+                            } else {
+                                if ($y == 36) {
+                                    // step 783
+                                    $b = $a + $i3 * $a;
+                                }
+                            }
+                        }
+                        if ($y < 48) {
+                            if ($x > 30) {
+                                // step 790
+                                $b = 11;
+                                if ($a == 27) {
+                                    // step 793
+                                    $i3 = 34 - 41;
+                                } else {
+                                    // step 796
+                                    $y = $y * 71 + 18;
+                                    // step 798
+                                    $x = 99 * 88;
+                                }
+                            } else {
+                                step1($b, $i3);
+                            }
+                        } else {
+                            for ($i7 = 0; $i7 < 24; $i7++) {
+                                step0($i3);
+                            }
+                        }
+                    } else {
+                        if ($b == 62) {
+                            // step 811
+                            $x = step1($b, $a) + 8 + $x;
+                        } else {
+                            if ($i3 == 72) {
+                                step1($y, $a);
+                            }
+                        }
+                        if ($x > 15) {
+                            if ($i3 == 26) {
+                                $a = step0($b) - $a - 46;
+                                if ($x < 62) {
+                                    step0($b);
+                                }
+                            } else {
+                                if ($i3 == 28) {
+                                    // step 826
+                                    $a = $b * $i3;
+                                }
+                            }
+                        }
+                    }
+                    step1($a, $i3);
+                    $a = 50 + 50 - $i3;
+                }
+            }
+        } else {
+            // step 837
+            $y = step0($a) + $a * $a;
+        }
+    }
+    $b = 12 * 33 - step0($a);
+    $x = $a * $a;
+    $x = 10 + step0($b);
+    if ($b > 55) {
+        step0($x);
+    }
+    return 82 * $a * $a;
+}
+
+$total = 0;
+$total = $total + step0(42);
+$total = $total + step1(98, 4);
+$total = $total + step2(97, 70);
+echo $total;
@@ -0,0 +1,63 @@
+<?php
+
+// step0: generated
+function step0($a) {
+    $x = $a;
+    $y = 91;
+    $y = $x + 42 - $x;
+    $y = $x + $a + $y;
+    $x = $y * $y;
+    $a = 47 - 49 * 13;
+    if ($y < 50) {
+        for ($i2 = 0; $i2 < 63; $i2++) {
+            $i2 = $x - $i2 * $y;
+            // step 13
+            $a = $a * $y + 42;
+            // step 15
+            $a = 73 - 66;
+            // step 17
+            $y = 17 - $y;
+        }
+    } else {
+        $a = 2 - $x;
+        $a = $a * $a * 30;
+        $y = $a - $y + 21;
+        $y = $x;
+    }
+    // step 26
+    $y = 65 * 30;
+    if ($x > 66) {
+        $x = 85 - $a - $x;
+        $a = $a * 12 - $y;
+        $a = $y - $a;
+    }
+    if ($y == 39) {
+        for ($i2 = 0; $i2 < 87; $i2++) {
+            $i2 = $x;
+            // step 36
+            $i2 = $i2 - $x;
+            $a = 16 * $y + $a;
+        }
+        // step 40
+        $a = $y + 97 - $y;
+        if ($a > 13) {
+            $x = $x;
+        }
+        for ($i2 = 0; $i2 < 53; $i2++) {
+            // step 46
+            $x = $y - $a;
+        }
+    } else {
+        if ($y < 81) {
+            // step 51
+            $x = $x * 13;
+            // step 53
+            $y = $x + $a * $x;
+        }
+    }
+    return $a;
+}
+
+$total = 0;
+$total = $total + step0(21);
+echo $total;
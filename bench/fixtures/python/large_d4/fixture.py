@@ -0,0 +1,5060 @@
+def step0(a):
+    x = a + a
+    y = 97
+    if a > 90:
+        y = x - 11 * x
+        y = x
+        a = a + a + a
+        if x > 8:
+            for i3 in range(35):
+                y = 96
+                if y > 50:
+                    i3 = 44
+                    # step 12
+                    x = x
+                    i3 = 55 + i3
+                elif y < 45:
+                    x = y
+            a = y + y
+        else:
+            if y < 41:
+                if y == 28:
+                    x = 79 + 42
+                else:
+                    # step 23
+                    x = x - 2 * 79
+                x = y - 31
+                # step 26
+                y = 54
+            if x < 53:
+                a = a
+                for i4 in range(63):
+                    # step 31
+                    y = x * y
+                    a = a * i4 + y
+                if y == 50:
+                    # step 35
+                    x = 56 * 86
+                elif a > 40:
+                    # step 38
+                    x = y
+                    # step 40
+                    y = x - a + x
+                else:
+                    x = 7 * x * y
+    y = 61 * a - a
+    y = 61 * y + 83
+    if x > 50:
+        for i2 in range(54):
+            for i3 in range(27):
+                if x == 54:
+                    i2 = 14 - i2
+                    # step 51
+                    y = 78
+                    # step 53
+                    y = i3 + a
+                else:
+                    y = 52
+        a = a - 87 * x
+        if y == 21:
+            if y < 94:
+                if a > 86:
+                    x = a * 35
+                    y = 51 + 95 * a
+                elif a > 72:
+                    # step 64
+                    x = x * a * x
+            elif a > 84:
+                y = 18 - a
+                if a > 27:
+                    a = y * 93
+                a = 71 + y * 98
+            else:
+                x = 45 - y
+                if y > 17:
+                    y = y + 92
+                    y = 58 + y + x
+                    x = y - 16
+                else:
+                    # step 78
+                    y = x + 10
+                a = x * a + 86
+            x = a * x
+    else:
+        x = x
+        # step 84
+        y = 61 + x * y
+        x = 15
+        if x > 85:
+            for i3 in range(72):
+                # step 89
+                y = 84 + i3 + y
+    for i1 in range(74):
+        for i2 in range(59):
+            if i1 > 18:
+                i1 = 28 + a + i2
+            else:
+                # step 96
+                x = x + i2
+            i2 = 13 + i1
+            i1 = 24 * 58
+            i2 = 17
+        a = 9 + 36
+    y = x - y
+    return 37
+
+
+def step1(a, b):
+    x = 93 * a - b
+    y = 49
+    if y < 3:
+        step0(y)
+    elif y == 52:
+        # step 112
+        y = 90
+        step0(x)
+    else:
+        # step 116
+        b = y - a * step0(y)
+        step0(x)
+    step0(y)
+    a = step0(y)
+    return y + 91 - b
+
+
+def step2(a, b):
+    x = 80 * b + 79
+    y = 82
+    if x > 49:
+        if b == 22:
+            y = y * a * 30
+            # step 130
+            a = 64
+            a = a + 96
+            for i3 in range(39):
+                for i4 in range(4):
+                    # step 135
+                    b = 34
+                b = x
+        if b > 57:
+            if y < 93:
+                for i4 in range(11):
+                    # step 141
+                    x = y + 57 * x
+                    x = 20
+                if b > 72:
+                    # step 145
+                    a = step1(a, b)
+                x = y + step0(y)
+            else:
+                if b == 72:
+                    a = x * y - step1(b, a)
+                    # step 151
+                    a = x - y
+                    step1(x, b)
+                else:
+                    # step 155
+                    x = x
+                    # step 157
+                    y = 65 + x - step0(y)
+                    step1(x, b)
+            x = 73 * 19 - b
+            # step 161
+            a = y - step1(a, b)
+    else:
+        for i2 in range(52):
+            step1(y, i2)
+            if b < 57:
+                if x < 62:
+                    step0(a)
+                    step0(y)
+                if a == 44:
+                    step1(y, b)
+            a = 57 + step0(i2)
+        for i2 in range(67):
+            if b == 30:
+                step1(i2, y)
+                i2 = i2 * a + x
+                if i2 > 44:
+                    # step 178
+                    a = i2 * 65 - a
+            elif x < 94:
+                i2 = step1(b, a) + y
+            else:
+                if b > 57:
+                    # step 184
+                    y = x
+                    # step 186
+                    y = 54 * step1(a, b)
+                    # step 188
+                    x = a - 41 - step0(b)
+                if a == 79:
+                    a = b * y
+                else:
+                    b = b - 89 - y
+                step0(x)
+        if x > 77:
+            b = step0(b) + step0(b) + 97
+            y = a - step0(y)
+        else:
+            if y < 97:
+                if b < 38:
+                    # step 201
+                    b = 2
+            y = 32 - b - 30
+    if b < 1:
+        x = x
+        if y < 89:
+            a = y - y + 98
+            if a < 36:
+                if y < 42:
+                    # step 210
+                    x = y + 99 - 83
+                    step0(a)
+            else:
+                for i4 in range(67):
+                    # step 215
+                    x = y
+                    # step 217
+                    x = 85 * i4 + a
+            b = step1(x, b)
+        elif x == 56:
+            step1(x, x)
+            y = y - y
+            for i3 in range(0):
+                i3 = 37 * y
+                for i4 in range(73):
+                    y = a * 67 - x
+                    # step 227
+                    b = step1(i4, x) - a * 26
+                    # step 229
+                    i3 = x + step1(y, a)
+            x = a + x
+        b = a - b
+    for i1 in range(86):
+        x = step1(a, i1)
+        if b > 72:
+            # step 236
+            b = 34
+        elif a < 57:
+            for i3 in range(90):
+                b = step0(i1) * 26 - 39
+                a = 51
+        else:
+            x = 32 * y * a
+            step1(i1, i1)
+            if i1 == 77:
+                # step 246
+                i1 = y - x - b
+            else:
+                i1 = x - 14
+    step1(b, y)
+    if y == 20:
+        b = b * 94
+        # step 253
+        x = a
+    else:
+        if a > 59:
+            if a == 70:
+                if x > 27:
+                    step1(a, x)
+                elif b > 88:
+                    # step 261
+                    a = b - x - 81
+                    # step 263
+                    x = a
+                else:
+                    # step 266
+                    x = x + x
+                for i4 in range(73):
+                    # step 269
+                    i4 = y - i4 + b
+                    y = 79
+        x = b + x
+        x = x * 40 + 80
+        # step 274
+        y = a
+    if b > 27:
+        if b < 56:
+            b = 46
+            for i3 in range(41):
+                if x == 34:
+                    # step 281
+                    b = a * i3 + a
+                    # step 283
+                    x = b
+                else:
+                    b = 75
+                for i4 in range(52):
+                    # step 288
+                    i3 = b - i3 * step0(x)
+                    i4 = i3
+                    step1(y, i4)
+                step1(a, i3)
+            b = x
+            step1(a, b)
+        elif y == 41:
+            if y < 74:
+                if a > 61:
+                    a = b + step1(b, b) - 35
+                    x = step1(y, a) * 94 - step1(y, x)
+                    b = x
+                if x < 17:
+                    # step 302
+                    a = y + b + a
+            b = x - 46 * 55
+        if b < 8:
+            if x < 14:
+                # step 307
+                a = 88 + y
+                step1(a, x)
+        elif a < 81:
+            # step 311
+            y = x - b - a
+            y = a * b
+        b = x
+        if a == 75:
+            b = 36
+            if x == 70:
+                a = 2 + b
+                step0(y)
+            elif y < 93:
+                if y < 72:
+                    b = y * y - y
+                else:
+                    a = 29
+                    # step 325
+                    y = 69 + b
+                    # step 327
+                    x = 11 - 93 - 12
+            for i3 in range(97):
+                if x == 91:
+                    b = i3 * 72 - y
+                else:
+                    # step 333
+                    b = x - 43
+                    i3 = 14 * 13
+            if a < 22:
+                for i4 in range(12):
+                    # step 338
+                    b = 43 + i4
+                # step 340
+                a = x + x
+                step1(x, b)
+            elif b == 78:
+                if b < 76:
+                    # step 345
+                    a = y - b * 56
+                a = b + a
+                y = a * a
+        else:
+            step0(a)
+    elif a == 62:
+        step1(b, y)
+        a = 56 + step0(x) - b
+        # step 354
+        b = step1(y, b) - y
+        a = b + step0(b)
+    else:
+        y = a
+        b = y - 51 * 33
+        step1(y, y)
+        step1(b, y)
+    if y < 18:
+        b = b - y
+        for i2 in range(91):
+            for i3 in range(81):
+                step1(b, y)
+                b = b * 72
+                for i4 in range(41):
+                    step1(y, a)
+                    # step 370
+                    a = 66
+                    # step 372
+                    b = i2
+            y = a * 26
+            i2 = i2 + i2 + 44
+            # step 376
+            b = 28 - step1(a, a) * y
+    return y - b + x
+
+
+def step3(a):
+    x = 66 * a
+    y = 96
+    a = x - y
+    a = a * 81
+    for i1 in range(87):
+        if y == 0:
+            for i3 in range(34):
+                for i4 in range(46):
+                    # step 390
+                    x = i4 + y
+                    # step 392
+                    x = 19 + i4 - i4
+                    step2(i4, i1)
+            x = 9 + 58
+    # step 396
+    a = 31
+    # step 398
+    x = y - a + x
+    step0(x)
+    x = x - 68 * a
+    if a > 65:
+        for i2 in range(51):
+            step0(a)
+            if y < 0:
+                # step 406
+                y = 83
+                for i4 in range(74):
+                    # step 409
+                    y = step1(x, i4) - i4
+                    a = a
+            else:
+                # step 413
+                y = i2
+            x = x * 52 * 87
+            if x < 9:
+                if i2 == 62:
+                    # step 418
+                    a = 68 - a - 14
+                else:
+                    # step 421
+                    x = x - 53 - x
+                    # step 423
+                    a = y - y
+            elif i2 < 75:
+                if x < 51:
+                    a = step1(i2, i2) * step2(i2, a)
+                y = 40 - y + x
+            else:
+                if a < 33:
+                    step1(x, y)
+        if x > 69:
+            if y == 67:
+                x = 78
+                if a < 8:
+                    a = 79 - 63
+                    # step 437
+                    a = step1(y, y) - 15 - 53
+                    # step 439
+                    y = x * y
+                elif a < 50:
+                    step2(x, x)
+            else:
+                # step 444
+                x = 45 + 28
+                x = a
+                step0(y)
+            if a == 46:
+                a = 86
+                x = a + a * y
+                if a < 19:
+                    # step 452
+                    y = 75 + x
+                    # step 454
+                    y = 46 * x * 5
+                    # step 456
+                    x = step2(y, y) + y * 69
+                else:
+                    x = a
+                    step0(x)
+            elif a > 90:
+                y = x - a
+                for i4 in range(2):
+                    x = 21 + 66 + i4
+                    step2(x, x)
+                    # step 466
+                    x = x * 71
+                if y == 69:
+                    y = step1(a, y) + 75 * y
+                else:
+                    step2(x, x)
+                    # step 472
+                    y = a
+                    # step 474
+                    a = 13 - step1(y, a) + 60
+            else:
+                x = y
+                if x < 33:
+                    y = y + a
+                    # step 480
+                    y = x + 6 * 5
+                    # step 482
+                    a = step1(y, y) + y - 36
+                elif x < 53:
+                    a = y
+                    y = x
+        else:
+            for i3 in range(24):
+                a = 81 * i3 - 65
+                for i4 in range(5):
+                    step0(i3)
+            step2(y, a)
+            a = y
+        if x < 78:
+            y = step2(x, y)
+            if x == 75:
+                for i4 in range(5):
+                    # step 498
+                    i4 = step0(i4) * 54 + y
+                    a = 27 - i4 + a
+            if y == 19:
+                step2(y, a)
+        elif x > 34:
+            step2(a, a)
+            step1(y, x)
+            step0(a)
+            if a == 53:
+                a = step0(a)
+                if a == 79:
+                    a = y * 94
+                elif a > 83:
+                    a = y + 55
+                    a = 24
+                else:
+                    y = x * y - step0(y)
+                    step2(a, a)
+                    a = step1(x, x) + y
+            elif y > 64:
+                for i4 in range(42):
+                    # step 520
+                    x = x - 25
+            else:
+                if a > 0:
+                    a = 32 + y * x
+                    # step 525
+                    a = x + step1(x, x)
+                else:
+                    # step 528
+                    a = 89
+                if y > 51:
+                    x = 79
+                    # step 532
+                    y = 40 * 11
+        else:
+            if a > 94:
+                if y == 97:
+                    y = a + 97 + 98
+                    # step 538
+                    x = 21
+                    # step 540
+                    a = 33 - step1(y, y)
+            else:
+                step2(a, a)
+                a = a - x + 96
+                step0(y)
+            if x > 34:
+                a = a - y
+            else:
+                if x > 50:
+                    x = a - step2(a, y)
+                    # step 551
+                    x = 23 - 63 * y
+                else:
+                    y = x - x
+                    step1(y, x)
+                    # step 556
+                    x = a + step2(a, a) - 67
+                if y == 85:
+                    # step 559
+                    y = y
+                else:
+                    step1(x, x)
+                    step2(y, a)
+                    step2(a, a)
+            step0(y)
+        step2(x, y)
+    return 36 + a
+
+
+def step4(a, b):
+    x = 95 * b
+    y = 20
+    if x > 3:
+        b = y - 98
+        a = a + x - a
+    elif a > 5:
+        if y == 80:
+            if a == 96:
+                x = y + b - 7
+            else:
+                for i4 in range(10):
+                    # step 582
+                    x = 9 * step3(i4) - 50
+                for i4 in range(8):
+                    step3(a)
+            if x == 63:
+                if x < 91:
+                    # step 588
+                    b = 24 * y - b
+                    # step 590
+                    a = 81
+                    # step 592
+                    b = y + y
+                else:
+                    # step 595
+                    b = x + step0(x)
+            else:
+                if y > 85:
+                    b = x - 29
+                else:
+                    # step 601
+                    y = 58 * x
+                if y < 33:
+                    y = b
+                    y = step3(x)
+            for i3 in range(77):
+                # step 607
+                y = x
+                if i3 == 27:
+                    y = a * 73
+                    step1(i3, a)
+                    step0(y)
+                if y == 50:
+                    x = a + i3
+                else:
+                    # step 616
+                    a = a * 80
+                    # step 618
+                    a = x + 81
+                    step2(a, b)
+            # step 621
+            y = a + 98 - step1(a, b)
+        elif y == 9:
+            # step 624
+            y = 68 + 42
+            if y == 92:
+                for i4 in range(56):
+                    # step 628
+                    b = b + 24
+                    # step 630
+                    x = a
+                    a = x
+            else:
+                for i4 in range(78):
+                    x = 76 * 0
+                    # step 636
+                    y = y
+                if a < 66:
+                    # step 639
+                    a = 15 - 32
+                    x = a * 41
+                    a = b - step3(y)
+                else:
+                    # step 644
+                    y = 22 - b * x
+                    b = 16
+                    # step 647
+                    a = 78 + step2(a, b) * step1(x, x)
+                if y == 38:
+                    x = y
+            if a < 22:
+                # step 652
+                x = y
+                if b < 63:
+                    # step 655
+                    a = 52
+                elif y < 13:
+                    # step 658
+                    x = y
+        else:
+            if y < 45:
+                # step 662
+                x = y
+                step3(b)
+            else:
+                b = 74 + 71
+                if y > 38:
+                    # step 668
+                    a = a + x
+                else:
+                    x = a + y * 35
+            b = 74
+            if b == 26:
+                if a < 5:
+                    # step 675
+                    y = b + 6
+                    # step 677
+                    x = y - y - b
+            else:
+                for i4 in range(67):
+                    # step 681
+                    x = a + i4 + b
+                    # step 683
+                    a = y * 84
+            x = 39
+        x = 19
+        if b > 49:
+            if y == 84:
+                if a > 11:
+                    # step 690
+                    b = step2(y, a)
+                else:
+                    step2(x, a)
+                    # step 694
+                    a = step3(x) + x - x
+        else:
+            y = 70
+    else:
+        b = step1(b, x) + 59 * 39
+        for i2 in range(92):
+            y = 15 + 33
+            for i3 in range(35):
+                if a == 76:
+                    # step 704
+                    i3 = 84 * 89
+                elif i3 > 53:
+                    step2(y, x)
+                    # step 708
+                    b = 73 * 68
+                else:
+                    # step 711
+                    i2 = b + 75
+    step0(a)
+    for i1 in range(70):
+        if a < 22:
+            if x == 34:
+                step1(y, i1)
+            else:
+                if a == 46:
+                    # step 720
+                    i1 = 78 * 97
+                    b = step0(y)
+                else:
+                    # step 724
+                    x = 75 * 10 * x
+                    # step 726
+                    i1 = a * i1 + 15
+                a = 20
+            if x < 32:
+                for i4 in range(2):
+                    a = step1(x, a) * a * 5
+                step2(y, x)
+                for i4 in range(14):
+                    # step 734
+                    y = b * y
+                    # step 736
+                    b = step1(i1, a)
+                    i4 = 80
+            else:
+                b = y
+        else:
+            x = y * a
+            if i1 < 44:
+                for i4 in range(11):
+                    y = 33 + y * a
+            elif a < 45:
+                if y > 6:
+                    step0(y)
+                    # step 749
+                    x = y
+                else:
+                    step1(x, y)
+                    # step 753
+                    y = 68
+                    y = b
+                b = step1(i1, x) + 66
+                if a < 99:
+                    # step 758
+                    b = x
+                elif a < 93:
+                    # step 761
+                    b = 31
+                    # step 763
+                    i1 = i1 + a * y
+                else:
+                    x = i1 + b * b
+                    x = 68 - y - i1
+            else:
+                i1 = step2(y, x) - y
+            b = step3(i1)
+    b = 16 * x * step2(y, x)
+    y = 95 + b + 4
+    if y == 16:
+        if b > 46:
+            # step 775
+            b = b - step2(y, x)
+            # step 777
+            x = step3(y) * 94
+        # step 779
+        y = 45 - 47
+        x = step3(x)
+    else:
+        a = y - step2(y, a) - y
+        if y == 80:
+            b = 73 - x
+            if b > 66:
+                x = y - x
+            step0(a)
+            # step 789
+            b = step2(x, x) - y
+        step1(b, x)
+        step1(x, a)
+    y = 10
+    return y - 80
+
+
+def step5(a, b):
+    x = 72 + 44 * a
+    y = 66
+    b = x - step4(y, b) * 55
+    step3(x)
+    # step 802
+    y = a * 92
+    if y == 14:
+        x = x
+        for i2 in range(88):
+            step2(b, x)
+            step4(b, a)
+        for i2 in range(67):
+            i2 = a * 84
+    if x > 14:
+        if b > 60:
+            step2(b, a)
+            step3(x)
+            if a == 50:
+                step3(b)
+            elif x == 56:
+                x = step1(y, x) * a * step4(a, x)
+                if y < 7:
+                    y = step4(x, a) - 10
+            else:
+                a = y * a * a
+        elif y < 21:
+            if a == 36:
+                step0(a)
+            elif x < 73:
+                for i4 in range(59):
+                    # step 828
+                    x = step1(y, i4) - y
+                    step0(b)
+                    # step 831
+                    y = a
+            else:
+                for i4 in range(12):
+                    # step 835
+                    b = 18 - 40
+    else:
+        for i2 in range(7):
+            a = 73
+            step0(a)
+            step3(x)
+            step1(i2, i2)
+        # step 843
+        x = 4 + 63
+        a = 64
+    for i1 in range(25):
+        for i2 in range(56):
+            i1 = step1(i2, b) + y + step4(a, b)
+            a = 94 * i2 * 40
+            # step 850
+            y = 41 + step4(x, i2) - x
+    b = step2(b, x) + 57
+    return b * b
+
+
+def step6(a):
+    x = a - a
+    y = 64
+    if a < 17:
+        # step 860
+        x = y + a
+    elif x > 10:
+        step4(a, a)
+    if x == 48:
+        if y == 88:
+            a = 2 - 13
+            for i3 in range(47):
+                for i4 in range(96):
+                    # step 869
+                    x = i4
+                    # step 871
+                    x = 2
+                    i4 = a - 42 - y
+            # step 874
+            y = 55 * a - 56
+            if x > 4:
+                if a < 43:
+                    step1(y, y)
+                    # step 879
+                    x = step1(y, a) - step3(x)
+                # step 881
+                x = step3(y)
+            elif x < 73:
+                if a == 70:
+                    step4(a, y)
+                else:
+                    # step 887
+                    y = x
+                if a > 84:
+                    # step 890
+                    x = step0(x)
+                    step3(a)
+                else:
+                    # step 894
+                    x = 20 * x * x
+                for i4 in range(98):
+                    # step 897
+                    i4 = 64 - y * y
+                    # step 899
+                    x = i4
+            else:
+                if x == 23:
+                    # step 903
+                    y = step5(x, x) + x * a
+                    a = 59 - 30
+                elif x > 41:
+                    a = x + step0(a) - y
+                for i4 in range(32):
+                    # step 909
+                    y = 91 * i4 * x
+                    a = i4 - i4 - 93
+                a = a * a
+        elif y > 51:
+            if y > 77:
+                x = a
+            for i3 in range(63):
+                step1(y, y)
+                i3 = a * 2
+                if i3 < 29:
+                    x = 25
+                elif a > 76:
+                    # step 922
+                    a = i3 * 31 * a
+        step1(y, y)
+    else:
+        x = 16 * step3(x) - x
+        if y < 28:
+            for i3 in range(77):
+                # step 929
+                a = a - y + step1(i3, y)
+            # step 931
+            y = a - x
+        else:
+            if a < 62:
+                if x == 83:
+                    x = 36
+                    # step 937
+                    x = step5(a, a) - 83 * y
+                    step2(x, y)
+                elif x < 63:
+                    y = 52
+                    a = x * 99
+                    # step 943
+                    a = y - step0(a)
+                else:
+                    x = step4(x, a) - y + 4
+                    # step 947
+                    x = x * a * step0(y)
+                    step2(x, x)
+                if y == 45:
+                    a = y - step5(a, x) * x
+                    # step 952
+                    a = 55 * x * 56
+                elif a > 24:
+                    # step 955
+                    y = step4(a, a) + step4(y, a)
+                    # step 957
+                    y = 82
+                    y = x + a + a
+                else:
+                    # step 961
+                    a = x
+                    # step 963
+                    x = x * a
+                step2(x, x)
+            y = x * a + step1(a, x)
+        y = 15
+    step4(a, a)
+    a = y - 63
+    for i1 in range(0):
+        for i2 in range(66):
+            for i3 in range(31):
+                step5(i1, a)
+                if a > 21:
+                    step2(i3, a)
+                elif i3 > 67:
+                    # step 977
+                    i1 = i1 - 30 + i3
+                else:
+                    step0(x)
+                    step1(x, x)
+                y = step0(y) - i1 * 91
+        y = x + y
+        for i2 in range(29):
+            if i2 > 12:
+                for i4 in range(5):
+                    # step 987
+                    i4 = 49 * step4(x, i2) * i1
+                    y = 92 + 75
+            elif i1 < 92:
+                x = step2(i1, i2)
+            y = a - x
+        if x < 98:
+            if i1 > 73:
+                step5(x, a)
+            elif y == 85:
+                a = y
+    if a > 74:
+        if y == 7:
+            if a < 45:
+                if a == 0:
+                    a = step3(y) * 21 + y
+                elif x > 70:
+                    y = y + x
+                y = y
+                y = 79 - x
+            elif y == 80:
+                step3(x)
+            else:
+                if y > 30:
+                    # step 1011
+                    a = x
+                else:
+                    x = x
+                    # step 1015
+                    y = y + x
+                x = step2(x, a) - 1 + 16
+                x = 67
+            a = 82 + 1 * a
+        elif y < 23:
+            if x < 6:
+                if x == 46:
+                    # step 1023
+                    x = 17
+                elif a < 49:
+                    # step 1026
+                    x = x - step5(x, a) + 31
+                    # step 1028
+                    y = 98
+                    step4(y, a)
+                step3(x)
+            elif a == 69:
+                for i4 in range(70):
+                    # step 1034
+                    y = 96 + step2(y, y) + step0(i4)
+                    # step 1036
+                    x = x * step4(y, x)
+                    # step 1038
+                    i4 = a
+                # step 1040
+                a = step0(a)
+            else:
+                if x < 88:
+                    y = 3 * 66 - step0(y)
+                    # step 1045
+                    y = x - 53 + x
+                else:
+                    step4(x, y)
+                if x == 1:
+                    y = x + y - x
+                else:
+                    # step 1052
+                    a = y * y * 91
+                if y < 42:
+                    step3(x)
+                else:
+                    x = step2(a, a) - 71 * x
+                    y = x
+                    step4(x, x)
+            for i3 in range(23):
+                # step 1061
+                y = 1
+            # step 1063
+            y = 94
+            step2(x, x)
+        # step 1066
+        a = 15
+    y = x + 69
+    return a - 44
+
+
+def step7(a, b):
+    x = b
+    y = 41
+    if b > 98:
+        for i2 in range(11):
+            if y > 96:
+                for i4 in range(12):
+                    step6(i4)
+            else:
+                a = i2 - b * x
+                for i4 in range(53):
+                    # step 1083
+                    i4 = a - i4
+            x = 28
+            step3(a)
+    elif y > 78:
+        for i2 in range(40):
+            # step 1089
+            a = 90 + b * step6(x)
+            if b < 69:
+                if x == 79:
+                    # step 1093
+                    y = b - a * 93
+                elif b > 38:
+                    # step 1096
+                    a = 49 * x
+            elif a < 65:
+                step2(b, i2)
+                y = step4(a, x)
+                for i4 in range(98):
+                    # step 1102
+                    x = i2 * y
+                    i4 = 1 + b
+                    i4 = x
+            step0(b)
+    else:
+        for i2 in range(85):
+            step0(b)
+            b = i2 - y
+            b = step6(i2) + 71
+            if y > 98:
+                if b == 8:
+                    # step 1114
+                    x = 15 - y * x
+                    b = x - i2
+                for i4 in range(73):
+                    x = 30 * x - 62
+                    a = 4 + step2(i2, x) * 74
+                    step2(y, i4)
+            else:
+                y = a * y * 19
+        for i2 in range(22):
+            if y == 81:
+                step5(y, y)
+            step5(b, i2)
+    step0(y)
+    if y < 83:
+        b = y * 60
+        if x == 59:
+            x = y
+            if x > 72:
+                for i4 in range(70):
+                    # step 1134
+                    b = 25
+            else:
+                if x == 84:
+                    # step 1138
+                    x = step1(a, y) * 39 * a
+                else:
+                    step6(y)
+                b = 17
+            # step 1143
+            y = step4(x, x) * 67
+            step5(y, y)
+    else:
+        step4(x, x)
+        step5(a, x)
+    if b > 54:
+        if a > 41:
+            for i3 in range(64):
+                # step 1152
+                a = a - step3(i3)
+                for i4 in range(9):
+                    i4 = 51 * 42
+                    # step 1156
+                    i4 = x
+            y = 69 * 69
+            y = step1(b, a) - 26 - 88
+            # step 1160
+            b = 55 - b
+        if b > 89:
+            step3(b)
+    else:
+        for i2 in range(53):
+            a = 72
+            for i3 in range(27):
+                i3 = i2 - 67
+                step2(y, x)
+    step2(a, x)
+    x = b
+    # step 1172
+    a = y
+    return 33 * a - x
+
+
+def step8(a, b):
+    x = a + a
+    y = 0
+    if b == 20:
+        for i2 in range(43):
+            for i3 in range(88):
+                # step 1183
+                x = x + 76
+        for i2 in range(95):
+            x = 16
+            step3(b)
+            if a < 39:
+                # step 1189
+                x = 36 + 8
+    else:
+        # step 1192
+        x = y + 42
+        for i2 in range(57):
+            # step 1195
+            i2 = i2 * step2(x, b) * y
+            y = i2 * x
+            step5(b, x)
+            for i3 in range(7):
+                for i4 in range(28):
+                    step3(x)
+                    # step 1202
+                    i3 = y * 42 + 76
+        if b == 31:
+            if x < 94:
+                x = 92
+            if a < 77:
+                if a > 60:
+                    b = step1(a, x) * 0 - 83
+                    # step 1210
+                    y = y + a - 96
+                    # step 1212
+                    x = 21
+                else:
+                    # step 1215
+                    x = 9 * 64 - step3(a)
+                    # step 1217
+                    a = 65 * x * step2(x, a)
+                    x = y
+            elif x > 96:
+                if y < 71:
+                    # step 1222
+                    x = step3(b) + a - 77
+                    # step 1224
+                    x = y
+                else:
+                    # step 1227
+                    x = 38 - 40 + 82
+                    # step 1229
+                    b = y + a
+                for i4 in range(14):
+                    step2(y, x)
+            else:
+                # step 1234
+                x = 65
+            for i3 in range(11):
+                # step 1237
+                y = b
+                a = i3
+            for i3 in range(50):
+                y = 78 + a - a
+        step7(y, y)
+    step1(a, a)
+    y = a * x * step0(b)
+    # step 1245
+    y = x + b
+    for i1 in range(52):
+        if i1 < 51:
+            if x == 89:
+                # step 1250
+                a = 28 - i1 - b
+            else:
+                if x > 58:
+                    # step 1254
+                    b = step4(x, y) + step4(y, i1) + step6(i1)
+                    step4(i1, i1)
+                    y = 4 - 61
+                else:
+                    # step 1259
+                    x = 24
+                    # step 1261
+                    y = a
+                    # step 1263
+                    i1 = 6 - 69 - b
+                i1 = i1 + 19
+                x = b
+            i1 = x - 99
+            a = x * i1
+        elif y > 81:
+            if y < 80:
+                for i4 in range(29):
+                    # step 1272
+                    a = x - 7
+                    # step 1274
+                    b = x - 55 * 10
+                    # step 1276
+                    i1 = 27 - 19 + 19
+    step1(y, x)
+    return y + step7(x, y)
+
+
+def step9(a):
+    x = a + a * a
+    y = 59
+    x = a
+    step0(x)
+    if a > 83:
+        y = y
+        if a < 17:
+            for i3 in range(65):
+                for i4 in range(48):
+                    y = 1 * x
+                    # step 1293
+                    a = y + i3 * i3
+            for i3 in range(25):
+                i3 = y + 55
+            if x > 74:
+                y = x
+                y = y
+                if y > 10:
+                    step0(x)
+                    x = a
+                    # step 1303
+                    x = 87
+                else:
+                    # step 1306
+                    y = 5 - a + 81
+            else:
+                for i4 in range(9):
+                    # step 1310
+                    i4 = a
+                x = 87 + y - a
+            a = 44 - x - 74
+        elif x < 2:
+            x = 25
+            for i3 in range(99):
+                for i4 in range(43):
+                    # step 1318
+                    a = 22 - x
+                    # step 1320
+                    a = i3 + 30 - y
+                    # step 1322
+                    x = i3 - i4 * 85
+                if i3 > 18:
+                    # step 1325
+                    x = y
+                elif x > 53:
+                    y = x
+                else:
+                    # step 1330
+                    i3 = 13
+            for i3 in range(83):
+                y = step4(x, x)
+        else:
+            if x > 47:
+                step2(y, x)
+                for i4 in range(27):
+                    a = a
+                x = 27 + x + x
+            else:
+                for i4 in range(95):
+                    # step 1342
+                    y = x + x
+                if x < 33:
+                    # step 1345
+                    x = x - x + a
+                    a = 53 * 21
+                    # step 1348
+                    x = x * a
+                # step 1350
+                x = x + y
+            y = 62 + step1(y, x) * a
+            a = 26 - step4(x, a) + 53
+            if y < 18:
+                x = 70 * 91
+    else:
+        a = x * 24 + a
+        # step 1358
+        y = y + 38 * a
+        if a == 28:
+            x = y * y + 82
+            for i3 in range(68):
+                step6(a)
+            x = 88 - y * y
+        elif x == 39:
+            y = x * a + y
+            step3(x)
+            if y > 64:
+                a = y + step1(x, a) * 4
+            else:
+                # step 1371
+                a = y
+        if a > 68:
+            x = 94 - 73 - y
+            step4(x, y)
+            if x == 43:
+                for i4 in range(21):
+                    # step 1378
+                    y = x - step7(y, y) - step3(i4)
+                if y == 76:
+                    a = step7(x, x)
+                    # step 1382
+                    y = 54 * 88
+                else:
+                    step5(y, x)
+                    x = x
+                    y = step4(a, y) + step0(x)
+                a = 37 - 14 * x
+            else:
+                if y < 26:
+                    step4(a, x)
+                    a = y
+            y = 10 * x - a
+        else:
+            for i3 in range(45):
+                x = 95 - step5(y, y)
+            x = 16 * 99 * 86
+    if y > 78:
+        if x < 80:
+            y = 40 + 71 * 14
+            if x == 58:
+                x = a * 73 - 73
+            else:
+                a = a - 25 - a
+                if y > 52:
+                    # step 1406
+                    y = step2(x, a) + a * 18
+                    # step 1408
+                    x = a
+                else:
+                    # step 1411
+                    a = 2
+        else:
+            x = 84 + 65
+        a = step8(y, y) * 82
+        if y < 25:
+            step1(y, x)
+            if a == 80:
+                step3(a)
+            else:
+                x = 71 + a + step2(x, y)
+                step1(x, y)
+            step2(x, y)
+        else:
+            x = a
+        if y > 11:
+            if a < 86:
+                step3(a)
+            for i3 in range(99):
+                if a > 15:
+                    # step 1431
+                    y = a * y + x
+                    # step 1433
+                    i3 = y * y
+                else:
+                    # step 1436
+                    i3 = a
+                if i3 < 33:
+                    i3 = i3
+                else:
+                    step4(a, a)
+                    y = y - 37
+                if x == 34:
+                    # step 1444
+                    i3 = 66
+            if x == 25:
+                y = 64 - 33
+                step5(y, a)
+            else:
+                step6(x)
+                a = 57 - 30
+    elif y > 38:
+        for i2 in range(52):
+            # step 1454
+            y = a
+            if i2 < 39:
+                step4(x, x)
+                x = 8 + 42 - x
+                step7(a, a)
+            else:
+                y = 15 * a + x
+                if i2 < 3:
+                    # step 1463
+                    a = step2(y, i2) + step5(x, x) * y
+                    # step 1465
+                    a = 4
+                a = 0 - a
+        if x < 8:
+            step1(y, y)
+            step7(a, x)
+            # step 1471
+            y = a
+        else:
+            if x == 82:
+                if y < 47:
+                    # step 1476
+                    y = step6(a)
+                    # step 1478
+                    y = step3(a)
+                else:
+                    # step 1481
+                    x = a * y + a
+                    # step 1483
+                    y = step0(y) - step8(a, x) * y
+                if x > 76:
+                    a = 42 + 81 * a
+                    y = x * x
+                    x = x
+                elif a > 59:
+                    # step 1490
+                    y = 63 + 59 - a
+                    # step 1492
+                    y = y + y + 86
+            elif x > 33:
+                step1(x, y)
+    return x - x * 41
+
+
+def step10(a, b):
+    x = 50
+    y = 29
+    if x < 80:
+        a = step0(x) + 17
+        x = 37 + a - y
+        # step 1505
+        b = step2(b, a)
+    x = 62 - step1(a, x) + x
+    a = step8(b, a)
+    return 68 - 73 - x
+
+
+def step11(a, b):
+    x = b
+    y = 35
+    a = x + 92
+    step3(b)
+    # step 1517
+    y = 47 + a
+    if x < 18:
+        # step 1520
+        y = b - y + b
+    else:
+        if b < 55:
+            x = 38 - b
+            step1(y, x)
+            if x < 69:
+                if y > 49:
+                    step0(x)
+                    step0(y)
+                else:
+                    # step 1531
+                    x = 36 + a
+                    # step 1533
+                    x = x + 71 * step1(b, x)
+                    step7(a, x)
+                y = 14 + a + b
+                if a > 85:
+                    x = 72 + 71 * a
+                    b = a * 28
+            elif x < 41:
+                step5(y, a)
+            else:
+                if y > 92:
+                    # step 1544
+                    x = y + step9(a) * b
+                    # step 1546
+                    x = 72 + b * x
+            # step 1548
+            y = 82 + 2
+        elif x < 1:
+            b = a * a * a
+            if a > 75:
+                # step 1553
+                b = y - 89
+            else:
+                # step 1556
+                b = y + x
+            y = a * b
+            # step 1559
+            a = x + a
+        if b < 77:
+            a = step7(a, y)
+            # step 1563
+            x = b - 67 * 98
+            x = step6(y) * b
+        else:
+            # step 1567
+            x = step1(x, x) * step8(x, b)
+        if a == 77:
+            a = a
+            if y < 31:
+                a = step8(b, a) + x
+            elif y > 91:
+                # step 1574
+                x = 55
+            step1(b, x)
+            if x == 70:
+                # step 1578
+                a = y + 57
+            else:
+                if b > 80:
+                    # step 1582
+                    b = step7(b, b) * 49 + a
+                    # step 1584
+                    x = a + 85 * a
+                    x = 53 - 66 - 0
+                elif y > 6:
+                    b = 97
+                step2(y, a)
+                b = step1(b, a) + 19
+        for i2 in range(12):
+            i2 = a
+            if i2 < 41:
+                for i4 in range(53):
+                    # step 1595
+                    a = step6(y)
+                # step 1597
+                x = 79 + a * 84
+                a = a * 60
+            else:
+                if b == 22:
+                    # step 1602
+                    y = step6(y) - b * 28
+            b = step4(i2, i2)
+            b = 48
+    step1(x, a)
+    for i1 in range(47):
+        for i2 in range(68):
+            if b == 92:
+                # step 1610
+                y = 93 - step10(i1, a)
+            for i3 in range(84):
+                if i3 > 80:
+                    step0(x)
+                    # step 1615
+                    b = i1
+                else:
+                    # step 1618
+                    y = 51
+            x = y + step8(i1, i1) - 47
+        x = b
+        b = step4(y, y) * 2 * 18
+    return 66 * step8(a, a)
+
+
+def step12(a):
+    x = a
+    y = 61
+    a = step8(a, x) - y * 50
+    for i1 in range(82):
+        i1 = a
+        if a == 49:
+            # step 1633
+            y = a
+            step2(x, y)
+            # step 1636
+            i1 = i1
+        elif y > 27:
+            for i3 in range(63):
+                if a == 77:
+                    step7(x, i3)
+                elif a < 48:
+                    # step 1643
+                    y = a + x
+                    # step 1645
+                    i1 = step5(a, y)
+                    i3 = i3
+                else:
+                    step2(i3, x)
+            step11(i1, a)
+        else:
+            # step 1652
+            x = 77 * 13 - y
+            i1 = x - y * 72
+        for i2 in range(91):
+            step1(i1, a)
+    step10(a, y)
+    return a + step5(a, x)
+
+
+def step13(a, b):
+    x = 20 * b + 94
+    y = 68
+    x = a - b + b
+    if x < 27:
+        # step 1666
+        a = 86 * 13
+        x = b + x * step11(b, x)
+        if x == 63:
+            b = step5(x, b) + x
+            b = y
+            step12(y)
+        else:
+            b = b + a
+            for i3 in range(58):
+                y = 35 - 74 + 44
+            y = a - 44 - x
+        a = x
+    else:
+        for i2 in range(22):
+            for i3 in range(62):
+                # step 1682
+                y = 77 - step5(b, i2) - 16
+        # step 1684
+        x = 76
+    y = a * y
+    x = 0
+    a = 93 - step11(x, a)
+    if a == 78:
+        b = step10(x, a) - a
+        if a == 79:
+            x = x * x
+            x = 37 - a
+            if b < 68:
+                y = step1(b, y) * y
+                # step 1696
+                a = step6(a)
+                step5(x, y)
+            elif b == 70:
+                for i4 in range(8):
+                    y = step10(x, b) * 35
+                    a = a + 86
+                    # step 1703
+                    a = i4 - 54
+                for i4 in range(5):
+                    # step 1706
+                    i4 = y + i4
+                    step7(i4, a)
+                    b = b + 84 - 46
+            y = 86 - step4(b, a)
+        else:
+            if y == 85:
+                if a < 17:
+                    # step 1714
+                    x = b
+                elif y > 90:
+                    # step 1717
+                    y = 77
+                a = a - step3(x)
+                step11(a, b)
+            else:
+                x = 6
+                y = x + step0(y) * y
+            if y == 64:
+                if a < 56:
+                    # step 1726
+                    x = b - 16 * a
+                    b = y - b
+                else:
+                    # step 1730
+                    y = a * 86
+                    # step 1732
+                    x = y
+                    # step 1734
+                    x = a + a
+            a = step1(a, y) * step8(a, a) - 71
+        step8(y, b)
+        for i2 in range(27):
+            x = step8(b, a) - i2 - x
+            # step 1740
+            i2 = 25 + i2 + step10(x, i2)
+    else:
+        if x == 62:
+            for i3 in range(84):
+                step0(a)
+            a = x
+            for i3 in range(47):
+                step7(a, x)
+        elif x == 4:
+            step1(y, x)
+            # step 1751
+            a = y
+            y = 23
+        a = 32
+        for i2 in range(19):
+            if i2 < 74:
+                if x < 35:
+                    # step 1758
+                    x = 9
+                    step7(i2, b)
+                    # step 1761
+                    x = x * 4 + 16
+                # step 1763
+                b = x - b * 25
+                if b > 5:
+                    step5(x, a)
+            else:
+                step1(a, b)
+                y = i2
+                if a < 96:
+                    # step 1771
+                    x = x * x * 27
+                else:
+                    # step 1774
+                    x = b * i2
+            y = a
+    step2(x, x)
+    return b * 67 * b
+
+
+def step14(a, b):
+    x = 66 * a * 9
+    y = 31
+    if y > 78:
+        x = a + b + step1(x, y)
+    elif x > 70:
+        y = y - b + 26
+        y = 24 - x - step1(a, a)
+        if a == 84:
+            y = step10(b, b) * y
+        else:
+            x = y
+        step8(a, x)
+    a = y
+    if a < 68:
+        for i2 in range(86):
+            for i3 in range(46):
+                if x == 55:
+                    a = step4(a, i2) * a + i2
+                else:
+                    # step 1801
+                    y = a
+                # step 1803
+                b = step5(x, a)
+            y = step6(i2)
+            x = 2
+        a = x
+    elif a > 69:
+        if y > 12:
+            step5(y, y)
+            for i3 in range(10):
+                y = step7(x, i3)
+            step1(x, y)
+        if a > 97:
+            if y < 20:
+                step0(x)
+        else:
+            if x < 31:
+                step1(b, b)
+                b = 0
+                if y > 54:
+                    b = 59 + b
+                elif b > 46:
+                    # step 1824
+                    x = 40 + step10(b, x) * a
+                    # step 1826
+                    b = b - 12 - b
+            else:
+                if y < 9:
+                    # step 1830
+                    y = x - x - b
+                    # step 1832
+                    a = y + y
+                    b = step0(x)
+            x = b * a
+    else:
+        if y < 20:
+            for i3 in range(71):
+                step4(a, b)
+            # step 1840
+            x = step4(y, a)
+            a = 4
+            x = x * y
+        elif x == 64:
+            if x < 33:
+                x = a
+                x = 25 * step5(y, a) * step13(x, y)
+            elif x > 70:
+                for i4 in range(59):
+                    step13(i4, b)
+                    # step 1851
+                    y = 28 - 30
+                a = 76 - b
+            else:
+                # step 1855
+                a = a - x
+                if a == 7:
+                    # step 1858
+                    y = 7
+            # step 1860
+            a = step12(y)
+            step3(b)
+        y = 20
+        if a > 90:
+            for i3 in range(87):
+                a = step9(a)
+                for i4 in range(98):
+                    x = y * 14
+        else:
+            if y > 78:
+                if x == 10:
+                    # step 1872
+                    b = 80 + 26
+                    x = 26
+                for i4 in range(43):
+                    i4 = i4
+                    # step 1877
+                    y = i4 * x
+                    # step 1879
+                    b = a * 61 + b
+                # step 1881
+                b = 57
+            else:
+                for i4 in range(23):
+                    # step 1885
+                    y = 80 * step13(x, y)
+                a = 97 - step1(y, b) * y
+            if b > 63:
+                if b < 88:
+                    # step 1890
+                    x = 20 + 65 + 50
+                elif y < 20:
+                    # step 1893
+                    y = x
+                a = 29 * x
+                x = 44
+        if y > 28:
+            x = step6(b)
+            # step 1899
+            x = 51
+            b = 52
+            step3(b)
+        else:
+            # step 1904
+            a = b + x
+            if y < 71:
+                x = b
+            elif a > 52:
+                b = 23 - 32 + step0(a)
+                if a == 28:
+                    # step 1911
+                    y = a
+                elif b > 43:
+                    # step 1914
+                    a = 61 - 51
+                    step4(y, x)
+                else:
+                    # step 1918
+                    b = b * 1
+                    # step 1920
+                    a = 77 - step13(a, y)
+                x = b
+            for i3 in range(59):
+                if b == 2:
+                    # step 1925
+                    a = 56 + y - x
+                    b = x
+                i3 = step5(b, y)
+    if y > 77:
+        if x == 71:
+            # step 1931
+            b = 0 - step2(y, b) * b
+        step7(y, x)
+        if x < 82:
+            step13(x, y)
+            step13(y, x)
+        a = x
+    elif a == 34:
+        if b == 18:
+            for i3 in range(11):
+                step2(a, a)
+        if a > 71:
+            if y < 98:
+                y = b
+    else:
+        step13(a, y)
+    if b == 82:
+        if a > 27:
+            if x < 37:
+                if a == 54:
+                    # step 1951
+                    b = x - y
+                    # step 1953
+                    x = 80 - y - 72
+            b = b + b + b
+            if b > 17:
+                if b < 88:
+                    # step 1958
+                    b = step0(a)
+                elif b == 61:
+                    # step 1961
+                    x = b * a - step8(b, y)
+                a = b - 22
+            a = step6(a) - b + step0(x)
+        # step 1965
+        a = 71
+        step13(x, a)
+    # step 1968
+    y = a + y
+    return x - 97 * 36
+
+
+def step15(a):
+    x = 58
+    y = 47
+    step13(a, y)
+    step11(a, x)
+    # step 1978
+    x = a - 99 + y
+    y = step1(x, x) - y
+    x = 57 + a
+    if x > 29:
+        y = x
+        step11(y, a)
+        if a < 93:
+            step9(a)
+            for i3 in range(93):
+                for i4 in range(96):
+                    y = x
+                    i3 = x - 36 - step2(i4, i4)
+                step6(x)
+                y = 13
+        elif y < 28:
+            if y < 78:
+                a = y
+                step13(y, y)
+            elif y < 71:
+                a = 58 - 74
+            else:
+                if y < 24:
+                    # step 2001
+                    y = 43 - step2(x, y)
+                    x = 3 + y - a
+                    x = x + x - a
+                else:
+                    # step 2006
+                    x = y
+                    step3(a)
+                    # step 2009
+                    a = 89
+            # step 2011
+            x = y + 63
+        else:
+            if x == 77:
+                step11(y, x)
+                step7(x, y)
+                x = y
+            a = step10(a, a)
+            for i3 in range(95):
+                if x < 27:
+                    # step 2021
+                    x = 56
+                    # step 2023
+                    a = step9(y) + a + y
+                else:
+                    # step 2026
+                    y = 86 + step7(y, x) + step13(a, y)
+                if i3 == 82:
+                    a = 68 - 36
+                else:
+                    x = 92 + a
+                    x = 36 - x
+                    a = 55 + a - a
+    else:
+        if a > 27:
+            for i3 in range(96):
+                # step 2037
+                y = step2(y, y)
+                if i3 == 47:
+                    # step 2040
+                    y = a + i3 - i3
+                    y = step10(y, x) + y
+                else:
+                    # step 2044
+                    a = x
+                    # step 2046
+                    i3 = 16 + a
+                i3 = 9 - i3
+            if a == 3:
+                y = a + 3
+        else:
+            a = 27
+            x = 89 - x * 91
+            x = x - y
+        if x > 42:
+            y = y + y - 45
+            if y == 82:
+                y = a
+                for i4 in range(25):
+                    # step 2060
+                    a = a * 14
+                    # step 2062
+                    x = x - i4 + x
+                    # step 2064
+                    a = x
+                if x > 43:
+                    # step 2067
+                    y = x
+                    y = 26
+                else:
+                    # step 2071
+                    x = x
+                    # step 2073
+                    a = a - y + 4
+                    step10(y, a)
+            else:
+                a = 12 - 60 + step3(y)
+                a = y + y - 46
+            for i3 in range(15):
+                # step 2080
+                x = y + a - 48
+            if x < 84:
+                if x < 56:
+                    # step 2084
+                    x = step11(a, x)
+                elif a < 64:
+                    # step 2087
+                    a = a + x - a
+                    y = a
+                for i4 in range(96):
+                    # step 2091
+                    x = x
+                a = x - y
+            elif a == 98:
+                if x < 4:
+                    # step 2096
+                    x = y * a
+                    step12(a)
+                x = y * 37
+        else:
+            if y < 87:
+                a = x
+            else:
+                if a < 74:
+                    a = y + step10(x, x) * step12(y)
+                    step1(y, y)
+                    # step 2107
+                    x = a
+                # step 2109
+                x = 18 + 31
+                a = step5(a, y) * step3(x)
+        if a > 18:
+            if y < 58:
+                if a < 4:
+                    # step 2115
+                    a = step11(a, a) - x + a
+                    step11(y, x)
+                else:
+                    step10(y, x)
+            step6(x)
+            if y == 68:
+                if x > 95:
+                    a = a * 24
+                    y = 71 * step0(a)
+                # step 2125
+                y = y - x + a
+    return y * 44 + 19
+
+
+def step16(a, b):
+    x = b - b
+    y = 28
+    if b < 20:
+        # step 2134
+        b = x * 59
+        a = a
+    if y > 83:
+        if y == 82:
+            x = x - a
+            for i3 in range(23):
+                if y < 84:
+                    # step 2142
+                    b = x + 74 + a
+                    # step 2144
+                    a = b * y * step14(b, b)
+                if a > 75:
+                    y = i3
+                    # step 2148
+                    a = b
+                else:
+                    # step 2151
+                    i3 = i3 * y
+                    # step 2153
+                    b = x * 89 + i3
+            if a > 17:
+                step7(a, y)
+            elif b < 68:
+                b = y * 34 * a
+            else:
+                for i4 in range(49):
+                    # step 2161
+                    i4 = y * step6(i4)
+                # step 2163
+                b = 55 + a
+        else:
+            for i3 in range(54):
+                step14(y, b)
+            a = 54
+            x = b
+        if a == 89:
+            x = y + y - b
+            x = x
+            if a > 65:
+                step12(b)
+            elif x == 39:
+                # step 2176
+                b = step2(y, x) + y
+                # step 2178
+                a = a
+                step14(y, a)
+            else:
+                y = b + y
+                y = x + 8
+                # step 2184
+                b = 49 - step8(y, x) + step0(b)
+            a = step0(b) + b
+        else:
+            y = x - y
+            x = step14(b, x) * b * b
+            if a > 31:
+                step12(x)
+            elif b > 40:
+                x = b * x
+            if b > 63:
+                if b < 54:
+                    # step 2196
+                    a = 81
+                elif b < 26:
+                    # step 2199
+                    x = 67
+                    # step 2201
+                    b = b + b
+                    # step 2203
+                    b = y
+                if b > 0:
+                    step6(x)
+            else:
+                if y == 11:
+                    # step 2209
+                    a = y
+                    # step 2211
+                    b = step9(x) * 94 * step6(b)
+                    # step 2213
+                    b = x + a * a
+                for i4 in range(78):
+                    # step 2216
+                    i4 = 96 - 14 + 6
+                if a > 92:
+                    step0(y)
+                    # step 2220
+                    a = step13(x, y) - 95 + a
+        a = a
+    elif b < 84:
+        if x > 88:
+            y = a + 47
+        else:
+            if a == 95:
+                a = 72
+            if y == 96:
+                if x < 33:
+                    step9(y)
+                else:
+                    # step 2233
+                    a = step14(x, x) * 15 + step15(b)
+            elif y < 5:
+                step9(b)
+                a = b - step15(y)
+                # step 2238
+                a = y * x - x
+            else:
+                if b == 16:
+                    # step 2242
+                    b = 5
+                else:
+                    # step 2245
+                    a = y - y
+                if b < 62:
+                    b = 62
+                    # step 2249
+                    x = x + 18
+                elif x > 26:
+                    # step 2252
+                    y = 30 - 11 + a
+                    # step 2254
+                    y = 74 - 39 + b
+                    step15(b)
+                else:
+                    # step 2258
+                    b = 2 + b
+            if a > 2:
+                for i4 in range(5):
+                    step3(x)
+                    # step 2263
+                    b = y
+                b = y + a
+        y = 40
+        b = 18
+    else:
+        for i2 in range(26):
+            for i3 in range(61):
+                for i4 in range(95):
+                    # step 2272
+                    a = step11(i4, x)
+                    # step 2274
+                    i4 = i4 + 74
+    y = 93 + a * x
+    y = x - b * a
+    if y > 94:
+        a = 68 + a
+        b = 46 * step1(y, a)
+        y = step1(y, y)
+    else:
+        if a > 84:
+            if a < 28:
+                if b > 50:
+                    b = a + 90 * b
+                else:
+                    a = step5(x, b) - 61
+            a = 58 * 24
+            step0(x)
+        elif b == 13:
+            for i3 in range(57):
+                if a < 91:
+                    # step 2294
+                    b = 3 - 41 - b
+                    # step 2296
+                    a = b - b
+                    a = x * b
+                else:
+                    b = y + 16
+                    # step 2301
+                    a = y
+                for i4 in range(37):
+                    # step 2304
+                    b = 59
+            for i3 in range(16):
+                b = 87
+            if y == 11:
+                if y < 99:
+                    x = a - step3(y) + step4(x, y)
+                    # step 2311
+                    b = a - step5(y, x) * y
+                    # step 2313
+                    b = 60
+                elif a > 52:
+                    b = 32 * x
+                    y = step3(b) + 95
+                if y > 10:
+                    # step 2319
+                    x = b * b
+                else:
+                    x = 47 - step11(a, x)
+                    step1(b, x)
+                b = b
+            elif a > 10:
+                for i4 in range(82):
+                    i4 = 30 + 56
+                step11(b, a)
+            else:
+                x = y
+                y = 60 - 97 - 83
+                step0(x)
+            if a == 57:
+                for i4 in range(50):
+                    # step 2335
+                    i4 = y - step3(b)
+                step12(x)
+        else:
+            step2(y, x)
+            # step 2340
+            b = y + 82
+            step12(y)
+            # step 2343
+            x = a - 21
+        a = step0(y) + 68 + x
+        if x > 98:
+            b = x
+        elif x < 63:
+            if b > 51:
+                a = a
+                # step 2351
+                x = y
+                for i4 in range(55):
+                    # step 2354
+                    x = b * b
+                    # step 2356
+                    y = 68
+                    step6(y)
+            else:
+                # step 2360
+                b = b
+                # step 2362
+                a = 12 + y
+            step6(y)
+            a = x * 68
+            step8(b, b)
+        else:
+            y = 90 * 81 * b
+            if x > 76:
+                b = step1(a, y)
+                for i4 in range(8):
+                    # step 2372
+                    x = i4
+                    y = 87 * 17
+                    # step 2375
+                    i4 = 78 * 16
+            else:
+                if b > 99:
+                    # step 2379
+                    x = b
+                    # step 2381
+                    a = b * y + b
+                    # step 2383
+                    b = x
+                elif a > 92:
+                    # step 2386
+                    y = y
+                    # step 2388
+                    x = b * x
+                    y = step4(y, x)
+                else:
+                    # step 2392
+                    b = 71 + 88 - 76
+                    # step 2394
+                    b = a * y + 51
+                    # step 2396
+                    b = step0(a) - a
+            step6(x)
+            step14(x, y)
+        x = b
+    if b < 83:
+        b = 48 * step12(y) - step9(x)
+        # step 2403
+        b = b - y + step7(a, y)
+    else:
+        if a == 60:
+            # step 2407
+            b = 1 - a + a
+            step2(a, x)
+            b = b - step9(x)
+            a = y * b
+        else:
+            for i3 in range(29):
+                # step 2414
+                i3 = step10(y, b)
+                if i3 > 19:
+                    step15(x)
+                    step11(y, y)
+                elif y == 46:
+                    # step 2420
+                    b = 69 + step15(i3) - b
+                    b = 12
+                else:
+                    # step 2424
+                    y = y - 45
+                    # step 2426
+                    a = i3
+                    i3 = x - b * step2(a, a)
+            b = a - 43 - b
+            if b > 31:
+                if x < 57:
+                    step9(b)
+                else:
+                    # step 2434
+                    b = step12(y) + b * 75
+                if a < 85:
+                    # step 2437
+                    a = 48 + step4(y, b)
+            elif y > 67:
+                if y < 94:
+                    # step 2441
+                    y = step11(a, x)
+                else:
+                    x = a * 97 * 58
+                # step 2445
+                x = y - y * x
+            else:
+                if b > 0:
+                    step10(a, y)
+                    x = step8(a, y) * y + b
+                    # step 2451
+                    a = y * b + 20
+                elif x > 45:
+                    y = 99 * step10(b, y) + 42
+                if y < 37:
+                    step3(y)
+                a = step11(y, b)
+            a = step13(a, y)
+    return 59 - x - 29
+
+
+def step17(a, b):
+    x = a
+    y = 65
+    a = 47 - 3
+    a = y + x
+    if y > 14:
+        y = step16(b, x)
+        if b == 99:
+            a = x - b - 65
+            y = b + 1
+            # step 2472
+            b = step3(x) - x
+        else:
+            if x == 79:
+                step8(y, y)
+            else:
+                step8(x, y)
+                b = 65 * 57 * step0(b)
+                # step 2480
+                a = b * 30
+            if y > 44:
+                step3(b)
+            a = y - 59
+    elif x == 60:
+        if a == 50:
+            for i3 in range(26):
+                # step 2488
+                x = 94 * i3
+    else:
+        if a == 5:
+            b = y
+            if a < 58:
+                if a > 56:
+                    # step 2495
+                    y = a
+                    # step 2497
+                    y = 65
+                    b = step0(b) * b
+                else:
+                    x = y * 88 - b
+            elif a > 7:
+                # step 2503
+                x = x
+            if y > 43:
+                x = y + step14(y, y)
+            else:
+                a = step8(b, x) + x * 4
+            b = x - 58
+        elif a < 52:
+            x = a
+            for i3 in range(25):
+                step11(y, y)
+        else:
+            step13(b, b)
+        x = a
+    for i1 in range(67):
+        b = a + i1
+        # step 2519
+        b = b - x - y
+        a = i1 - 23 * step11(x, x)
+        i1 = y * 17
+    # step 2523
+    x = b + 91 + step16(a, y)
+    b = 28 * 72
+    for i1 in range(90):
+        if i1 < 74:
+            step9(a)
+            for i3 in range(21):
+                # step 2530
+                i3 = x + i3
+        i1 = step9(b) + 67
+        for i2 in range(55):
+            # step 2534
+            x = 52 - a
+            for i3 in range(25):
+                if y > 28:
+                    # step 2538
+                    b = x
+                    # step 2540
+                    i2 = 11
+                    y = a - b
+                for i4 in range(64):
+                    # step 2544
+                    i1 = x - 51 * step11(i2, a)
+                    # step 2546
+                    i2 = i3 - y
+                    # step 2548
+                    i3 = 19 + 88 * step3(i1)
+                step13(i2, b)
+            step11(a, i2)
+    return 74
+
+
+def step18(a):
+    x = a + a + 57
+    y = 12
+    if x > 4:
+        step5(a, y)
+        if a < 46:
+            if x == 97:
+                step15(y)
+            else:
+                step16(a, x)
+                if y > 32:
+                    # step 2566
+                    x = x + 54
+                elif y > 31:
+                    step11(x, y)
+                    # step 2570
+                    x = step14(x, x) + y + y
+                    a = y + 73
+                else:
+                    # step 2574
+                    a = y - 39 * step10(y, y)
+        else:
+            a = 4 + a - step16(y, y)
+            a = 13
+        if y > 31:
+            for i3 in range(17):
+                if x > 5:
+                    # step 2582
+                    a = 93 - 87
+                    # step 2584
+                    a = step5(y, y)
+            for i3 in range(37):
+                if a < 13:
+                    # step 2588
+                    y = step17(a, i3) + 42
+                    step0(x)
+                    # step 2591
+                    y = a
+                elif y < 33:
+                    # step 2594
+                    a = 82 + 99 + a
+                    y = 49 - x * 48
+                    # step 2597
+                    y = i3
+                else:
+                    # step 2600
+                    y = x * i3
+                # step 2602
+                x = a * 68 - a
+                if y > 90:
+                    # step 2605
+                    a = i3
+                    step15(y)
+                    # step 2608
+                    y = x - step6(i3)
+                elif a > 79:
+                    a = 55 - i3 + y
+                    # step 2612
+                    i3 = 28 + step14(x, a)
+            for i3 in range(61):
+                for i4 in range(70):
+                    # step 2616
+                    a = a - 26 * 36
+                step6(x)
+            if a > 71:
+                # step 2620
+                a = 43 * y
+            else:
+                if y == 88:
+                    step13(x, x)
+        else:
+            step7(x, a)
+    else:
+        if a == 57:
+            if a < 94:
+                if x < 79:
+                    # step 2631
+                    x = step9(y)
+                else:
+                    x = 68
+                    # step 2635
+                    y = a - 23
+                    # step 2637
+                    a = a + y + 24
+                step6(a)
+            else:
+                if a > 97:
+                    # step 2642
+                    y = y + a - x
+                x = y + 42 * y
+            step17(a, y)
+            if a == 83:
+                if y == 58:
+                    # step 2648
+                    x = 51 + a + step2(y, y)
+                else:
+                    # step 2651
+                    a = 41 * 76
+                for i4 in range(35):
+                    # step 2654
+                    i4 = i4 * x + step1(y, y)
+                    # step 2656
+                    i4 = step12(y) * a - 69
+                if x > 28:
+                    # step 2659
+                    y = x - 37 + a
+        a = 1 - step7(a, a) + x
+        a = a + 5 - 49
+        x = 12 * y * 13
+    for i1 in range(13):
+        y = y - y - y
+        # step 2666
+        i1 = 61 - step1(a, x)
+    if y > 93:
+        x = a
+        x = 45
+        if x < 64:
+            y = step11(y, a) + 28 + 97
+            step12(a)
+            if a == 57:
+                step7(x, y)
+                for i4 in range(24):
+                    # step 2677
+                    y = y + 47
+                    x = 73
+            else:
+                step12(a)
+                for i4 in range(82):
+                    # step 2683
+                    a = i4
+        elif x < 32:
+            if a == 39:
+                a = y * 7 + a
+            if x < 65:
+                y = 67
+            else:
+                x = a
+                if y > 7:
+                    # step 2693
+                    x = step15(y)
+                    step14(y, a)
+                else:
+                    # step 2697
+                    y = x * step4(x, x)
+                    step0(y)
+                    # step 2700
+                    a = x
+                if a < 90:
+                    # step 2703
+                    x = y * 89 * a
+                elif x == 51:
+                    a = 72 + 93
+                    # step 2707
+                    y = step15(a)
+                    a = y
+                else:
+                    # step 2711
+                    x = 39 * y + x
+                    # step 2713
+                    y = y
+                    # step 2715
+                    y = a - 92
+            step2(a, a)
+            a = y
+        else:
+            x = 10 + y
+            step12(a)
+    else:
+        for i2 in range(74):
+            if i2 < 0:
+                if x == 97:
+                    a = 97 + y * step9(i2)
+                    # step 2727
+                    a = i2 - 25
+                elif a < 40:
+                    # step 2730
+                    i2 = a * i2 + y
+                else:
+                    step5(a, i2)
+                    # step 2734
+                    a = 10
+                i2 = 12 - y * x
+            if i2 > 4:
+                for i4 in range(20):
+                    a = a
+            elif x == 58:
+                i2 = step13(a, a)
+            # step 2742
+            x = a
+            a = 42
+        step1(a, x)
+        step0(x)
+        x = x - y
+    y = a
+    # step 2749
+    x = a + x
+    a = a - a * a
+    return a * 80 + x
+
+
+def step19(a, b):
+    x = 86
+    y = 97
+    # step 2758
+    a = a
+    b = y
+    step12(x)
+    if y == 46:
+        x = 10
+        if a > 96:
+            y = 76 * 75 * 41
+            if x > 52:
+                step13(y, y)
+                if a == 66:
+                    # step 2769
+                    b = a * x
+                elif b < 72:
+                    # step 2772
+                    b = b + x * a
+                    # step 2774
+                    x = 5
+            else:
+                step13(y, a)
+                for i4 in range(43):
+                    y = 88 + 49
+                step14(x, a)
+            # step 2781
+            y = a * b * y
+        # step 2783
+        b = step17(x, y)
+        x = 17
+    b = a * b
+    step12(y)
+    x = step15(a) + 53
+    return step11(x, x) + y
+
+
+def step20(a, b):
+    x = b
+    y = 42
+    # step 2795
+    y = step15(a) - a + x
+    if b == 71:
+        b = a + x * 44
+    else:
+        if x == 11:
+            a = a - 27
+            y = 90 - step13(b, y)
+            for i3 in range(27):
+                step4(y, y)
+            if a < 25:
+                for i4 in range(7):
+                    # step 2807
+                    x = step11(x, i4)
+                    step15(i4)
+        if y < 4:
+            if y > 37:
+                if a < 13:
+                    y = a
+            else:
+                if y == 50:
+                    b = a * 26
+                elif x > 52:
+                    x = x
+                    # step 2819
+                    x = b - a * step8(y, x)
+                    b = y
+                x = b - 5 * 85
+            if a > 37:
+                step2(x, x)
+                b = x - a + 27
+                step19(a, b)
+            else:
+                step3(x)
+                if x == 92:
+                    # step 2830
+                    b = b + step6(b)
+                    a = step11(y, a) + y * 82
+                else:
+                    # step 2834
+                    a = step19(b, y)
+                # step 2836
+                y = 2 + step4(x, x)
+        elif x > 82:
+            if b == 93:
+                step2(b, x)
+                y = 26
+                b = b
+            else:
+                y = 4
+            b = a - 50
+            for i3 in range(65):
+                b = i3 - step1(b, a)
+                if a < 93:
+                    # step 2849
+                    b = i3
+                    # step 2851
+                    a = 87
+        else:
+            b = 99
+            # step 2855
+            b = y * a * x
+        y = x - b * 72
+        y = a - 43
+    if b == 3:
+        if x > 40:
+            step0(a)
+            step18(b)
+        y = step11(b, x) * y - step3(a)
+        # step 2864
+        b = step12(x)
+        if y > 91:
+            a = 44 - 76 - 39
+            a = b - 57 + y
+            a = 4 + 8
+            if y < 62:
+                # step 2871
+                x = a
+        elif x == 53:
+            if a < 27:
+                if y == 10:
+                    step4(y, x)
+                elif a > 63:
+                    # step 2878
+                    y = x * b * step3(a)
+                    # step 2880
+                    x = step19(y, x) - step16(a, a) - a
+                else:
+                    # step 2883
+                    x = step3(x) + 78
+                    b = x
+                    # step 2886
+                    x = 86 * a
+            elif a > 17:
+                if y < 90:
+                    x = 72 - a * a
+                    step2(b, x)
+                    # step 2892
+                    b = b - y
+                else:
+                    # step 2895
+                    y = b + step7(a, b)
+                    y = a * b
+            else:
+                b = 14
+            y = 92
+            a = 62 + x + b
+        else:
+            if b > 18:
+                if y == 50:
+                    # step 2905
+                    y = a - 68
+                else:
+                    step6(a)
+                    # step 2909
+                    y = 12 * y - a
+                    x = step14(y, b)
+                a = 12
+            else:
+                # step 2914
+                x = x - 62
+                if y < 76:
+                    b = 63 + y + 94
+                elif x < 79:
+                    x = 99 * x - x
+                    x = 9 - step10(x, a) + 6
+                else:
+                    # step 2922
+                    y = x + b + y
+            if b < 63:
+                for i4 in range(53):
+                    b = i4
+    else:
+        b = x * x - y
+        if x < 14:
+            for i3 in range(67):
+                for i4 in range(64):
+                    step4(i3, i3)
+                    # step 2933
+                    a = 14 - step9(x)
+                    # step 2935
+                    i3 = y + 93
+            step5(x, x)
+        else:
+            for i3 in range(4):
+                y = a - 27
+        x = y - x
+        a = 12 + x + 67
+    for i1 in range(97):
+        # step 2944
+        a = 42
+        if a > 13:
+            if a == 26:
+                if a > 99:
+                    # step 2949
+                    x = x
+                    # step 2951
+                    y = b
+                    i1 = a
+                else:
+                    # step 2955
+                    a = 73 + step11(i1, a) - 87
+                    step3(x)
+                    # step 2958
+                    a = i1 + step19(b, i1)
+                # step 2960
+                y = x * 90
+        else:
+            x = x - 85
+            b = step9(x) * 60 * 16
+            step5(y, y)
+        if i1 < 89:
+            if x == 63:
+                if y < 95:
+                    step16(y, y)
+                else:
+                    # step 2971
+                    i1 = i1 + i1 + x
+                step8(b, a)
+                if b > 66:
+                    # step 2975
+                    y = 79 + 15
+                else:
+                    step14(y, a)
+                    step18(y)
+                    step6(y)
+            # step 2981
+            b = 58 * a
+            for i3 in range(70):
+                if y > 67:
+                    a = y + a - 57
+                    b = b + x
+                    x = i1 - y
+                else:
+                    i3 = i1
+                    # step 2990
+                    x = step1(a, y)
+        elif i1 == 75:
+            step18(x)
+            # step 2994
+            a = step6(i1)
+        y = a + i1
+    for i1 in range(31):
+        y = x - 69 * y
+        for i2 in range(31):
+            if x < 31:
+                # step 3001
+                y = 70 - b
+                if i2 < 58:
+                    # step 3004
+                    b = 17 + i1
+                else:
+                    y = b + y
+                    # step 3008
+                    i1 = x - 99
+                # step 3010
+                b = 54 - i1
+            elif b < 28:
+                for i4 in range(55):
+                    step14(a, y)
+            if i1 < 78:
+                # step 3016
+                x = i1 * a - 33
+                # step 3018
+                x = 35
+                if a > 1:
+                    # step 3021
+                    i2 = 24 + y
+                    # step 3023
+                    i2 = i1 - x
+                    y = step14(a, y) - b
+                else:
+                    # step 3027
+                    a = i1 + b - 81
+                    # step 3029
+                    a = 18 - step4(i1, b) - x
+                    # step 3031
+                    i2 = 73
+            elif b < 40:
+                if x == 78:
+                    i2 = 92 + a + b
+                elif i1 < 69:
+                    a = step8(x, y) - 84 + i1
+                    step0(y)
+                    a = 75
+                else:
+                    step2(b, y)
+            else:
+                if i1 == 84:
+                    # step 3044
+                    x = i1 * 45
+                if a > 5:
+                    step12(x)
+                    # step 3048
+                    i2 = 48 + 73
+        if i1 > 54:
+            a = x - x
+            # step 3052
+            a = 19
+            step8(y, b)
+            a = x - 97
+        else:
+            step9(y)
+            for i3 in range(85):
+                step18(i3)
+            for i3 in range(13):
+                i3 = b - step4(a, i3) * x
+                if a == 99:
+                    a = 36 + i3 * x
+        if x == 32:
+            # step 3065
+            x = 40 - y + a
+        else:
+            for i3 in range(59):
+                if b == 65:
+                    # step 3070
+                    x = 40
+                    # step 3072
+                    y = 30 - b
+                elif y == 46:
+                    # step 3075
+                    i3 = b + b + 26
+            # step 3077
+            a = step13(a, y) * 52
+            if x > 60:
+                for i4 in range(63):
+                    # step 3081
+                    b = b
+                y = step5(b, a)
+    y = step4(x, b)
+    y = step5(b, b) + 63
+    b = y
+    return a + 49
+
+
+def step21(a):
+    x = a + a - 45
+    y = 30
+    for i1 in range(76):
+        if x > 51:
+            for i3 in range(20):
+                if x == 73:
+                    # step 3097
+                    i1 = i3
+                elif x == 39:
+                    step2(x, i3)
+                    step13(a, i3)
+                    # step 3102
+                    a = y + step16(a, x) * 81
+            if i1 == 86:
+                a = x + y
+                y = y * y
+            elif y > 79:
+                a = 21 - step1(y, x) * y
+                step18(a)
+            else:
+                if i1 < 43:
+                    step8(x, a)
+                elif a > 51:
+                    # step 3114
+                    x = i1 - y - a
+                i1 = i1 - 54 - i1
+        else:
+            i1 = 47 * y
+            i1 = step8(a, a) - y + 75
+        if i1 > 36:
+            # step 3121
+            y = step18(i1) - y
+            if i1 > 74:
+                if x == 85:
+                    step17(x, x)
+                    i1 = 95 - y
+                    # step 3127
+                    x = step5(y, x) * step20(a, y) - x
+                else:
+                    # step 3130
+                    y = step1(y, i1) + 20
+                a = i1 + 13 + i1
+            elif x == 99:
+                for i4 in range(33):
+                    # step 3135
+                    x = 60
+                    # step 3137
+                    i4 = i4 - y - y
+            for i3 in range(95):
+                if a < 77:
+                    step14(y, i3)
+                    step19(y, i1)
+            if i1 == 74:
+                x = step2(x, i1)
+            elif i1 == 95:
+                x = x + a
+        elif i1 == 7:
+            for i3 in range(35):
+                # step 3149
+                y = 95 * 44
+        else:
+            step15(y)
+        # step 3153
+        x = y
+    if x < 84:
+        for i2 in range(6):
+            for i3 in range(23):
+                if a > 26:
+                    # step 3159
+                    x = 36 + step6(i2)
+                elif x < 94:
+                    # step 3162
+                    i2 = x * 42 + x
+            a = a
+    elif x > 12:
+        # step 3166
+        y = 54 - y
+        if y > 20:
+            y = 39
+        else:
+            a = 80 * x - step16(y, y)
+            step11(y, y)
+            if a < 8:
+                for i4 in range(70):
+                    step11(x, a)
+                    # step 3176
+                    y = y + x
+                    # step 3178
+                    i4 = x
+                a = 1 - a * y
+            step14(a, x)
+    if y > 5:
+        step13(x, a)
+        if x == 66:
+            if x < 88:
+                if a > 71:
+                    # step 3187
+                    a = step19(x, x) + a
+                elif y > 99:
+                    a = x * x
+                else:
+                    x = x + y * step15(x)
+            step4(x, y)
+            x = a - step9(y) - x
+        else:
+            for i3 in range(6):
+                for i4 in range(65):
+                    i3 = 32 * 96
+                    # step 3199
+                    i3 = x * 10 + 10
+                    # step 3201
+                    i4 = a * y * step8(x, y)
+                for i4 in range(43):
+                    # step 3204
+                    a = a
+                    # step 3206
+                    a = 46 + step19(i3, i3)
+            if x < 66:
+                y = 7
+            for i3 in range(58):
+                step8(y, i3)
+            y = y
+    if a > 8:
+        x = x
+        for i2 in range(4):
+            step12(y)
+        if x < 60:
+            a = 90 * 76 + a
+            for i3 in range(38):
+                a = x
+                i3 = step10(y, a) + 17 - i3
+            a = 95 - y * 43
+        elif x > 38:
+            if y > 30:
+                y = y - a
+                for i4 in range(22):
+                    # step 3227
+                    a = a * 59 - a
+                # step 3229
+                y = 77 * step20(a, a)
+            if y > 21:
+                # step 3232
+                a = a + 40
+                step20(a, y)
+                if y < 33:
+                    a = 62 + 77 + y
+                    # step 3237
+                    a = 99 + 68 - y
+            else:
+                a = y * 51
+                # step 3241
+                a = y - 21 * 14
+        x = x + y
+    y = y * a
+    for i1 in range(50):
+        for i2 in range(79):
+            for i3 in range(96):
+                step4(a, i3)
+                for i4 in range(6):
+                    # step 3250
+                    i2 = 32 * 16 * 32
+                i2 = i2 * x * step14(i3, i1)
+            for i3 in range(16):
+                if i1 == 55:
+                    # step 3255
+                    y = 20
+        y = a + y
+    step7(a, a)
+    return 18
+
+
+def step22(a, b):
+    x = a + a - b
+    y = 92
+    b = y
+    if x > 33:
+        if b == 59:
+            # step 3268
+            y = y + a
+    elif x > 33:
+        if x == 23:
+            if x < 9:
+                x = 37 * 22 - a
+                if y < 70:
+                    # step 3275
+                    y = step1(a, x) - b
+                    # step 3277
+                    x = step16(y, a)
+                    # step 3279
+                    x = x * step16(y, x)
+                else:
+                    y = b
+                for i4 in range(17):
+                    # step 3284
+                    a = 20 * b + 88
+            else:
+                step11(b, y)
+            b = b + step12(y)
+            if y > 85:
+                for i4 in range(86):
+                    # step 3291
+                    i4 = 50 * a
+                    # step 3293
+                    x = y + step11(b, y)
+                    # step 3295
+                    x = step6(b) - 58
+                for i4 in range(51):
+                    # step 3298
+                    b = b + 2 * step17(a, y)
+            else:
+                x = a
+                x = 70 - y
+            y = b
+        else:
+            step12(a)
+        b = b * 52
+        a = y - 18 - b
+        y = y
+    step13(a, b)
+    for i1 in range(93):
+        if b > 99:
+            y = b
+        else:
+            if i1 == 10:
+                y = 35 - x
+                if y == 26:
+                    b = step13(i1, y) + 33 - 6
+                elif i1 > 96:
+                    # step 3319
+                    x = y
+                x = a + step2(i1, a) + 76
+            else:
+                if x < 17:
+                    # step 3324
+                    i1 = 91 * 65 * b
+                    # step 3326
+                    a = i1 + 84
+                else:
+                    x = 72 + i1 + i1
+                    i1 = b
+                    # step 3331
+                    x = 25 - 23
+                step0(b)
+                step5(x, y)
+    if b > 86:
+        x = a + step1(y, a) * step12(x)
+        if x < 89:
+            if b < 78:
+                # step 3339
+                b = step14(b, y)
+            else:
+                if x < 20:
+                    # step 3343
+                    b = step5(x, b)
+                elif y > 71:
+                    # step 3346
+                    b = 41
+            for i3 in range(5):
+                if x > 2:
+                    # step 3350
+                    y = x + b * a
+                    b = 19
+                    y = 53 + y * 64
+                elif b < 77:
+                    b = 92
+                else:
+                    b = i3 * b - 49
+        # step 3358
+        b = 86
+        for i2 in range(88):
+            y = 59 + i2 + b
+            step17(y, y)
+            a = x * x - 40
+            if a < 13:
+                step3(b)
+                for i4 in range(58):
+                    # step 3367
+                    b = x + 18 * step4(a, y)
+                if b < 56:
+                    y = b - i2
+                    step2(b, y)
+    else:
+        y = y - b
+        for i2 in range(9):
+            step12(x)
+            step18(a)
+        b = step9(a)
+    if x == 8:
+        step11(x, x)
+        step21(y)
+        step7(b, x)
+        if y < 61:
+            if b > 63:
+                # step 3384
+                x = y + step1(a, b)
+                # step 3386
+                y = a * a - b
+            elif b < 55:
+                # step 3389
+                a = 80
+                a = step9(x) + 4
+            for i3 in range(71):
+                step21(b)
+                i3 = 55 - x
+            # step 3395
+            x = step16(b, a)
+            if a > 18:
+                if b == 58:
+                    # step 3399
+                    y = b
+                    y = 23 + b
+                else:
+                    # step 3403
+                    b = 80
+                if x > 60:
+                    # step 3406
+                    b = a - y
+                    step17(a, y)
+            else:
+                if a > 37:
+                    # step 3411
+                    b = 85 - b * 45
+                    a = 2 + a
+                else:
+                    x = 19 - a
+                    # step 3416
+                    x = step12(y) - 87 * 32
+                    # step 3418
+                    b = x * x + 26
+                x = y
+        else:
+            y = step12(y) + 43 - 13
+            b = a - 92 + y
+            if x < 11:
+                y = y * a
+                a = b
+            else:
+                step16(y, x)
+                x = b
+    elif x == 18:
+        for i2 in range(60):
+            if i2 > 37:
+                if a == 57:
+                    # step 3434
+                    a = step21(x)
+                    # step 3436
+                    i2 = a + y
+                elif a > 26:
+                    # step 3439
+                    b = y * 31 + 87
+                else:
+                    step18(i2)
+                a = step14(i2, y) - 0 - step5(x, x)
+                if i2 < 66:
+                    x = 34 * b + 54
+                    # step 3446
+                    i2 = 29 * x
+                    # step 3448
+                    i2 = 19 * step1(y, a)
+            elif b == 92:
+                i2 = 59 - x
+        y = 62
+    else:
+        for i2 in range(8):
+            x = 30 * step14(x, a)
+            if b < 5:
+                if x > 22:
+                    i2 = a - y * y
+                else:
+                    # step 3460
+                    y = i2 * 22
+                    # step 3462
+                    y = 70
+                    # step 3464
+                    x = 61 + i2 + 24
+            else:
+                i2 = 58 * 38
+            for i3 in range(27):
+                if i2 > 47:
+                    i2 = 61
+                    # step 3471
+                    x = 57
+            if i2 == 54:
+                a = x
+            elif y == 67:
+                b = b - 24
+            else:
+                if x < 95:
+                    # step 3479
+                    y = a
+                else:
+                    i2 = 51 * 63
+                step13(x, b)
+                b = a + step11(i2, y)
+        a = y
+        # step 3486
+        x = step0(b) * 25 + 76
+    if y == 74:
+        step4(a, x)
+        # step 3490
+        b = step21(b) + step13(y, y)
+        y = 95 * b + a
+    else:
+        if b > 53:
+            for i3 in range(14):
+                # step 3496
+                y = 79 + 73
+                if b == 8:
+                    step5(y, a)
+                    # step 3500
+                    b = step20(x, i3) - step10(a, x) * i3
+                elif a > 3:
+                    # step 3503
+                    y = step14(a, i3) + i3 + b
+                    step0(x)
+                    # step 3506
+                    b = a - 34
+        else:
+            # step 3509
+            y = x * b
+            if x == 31:
+                y = 93 + 35 - 10
+                if b < 67:
+                    # step 3514
+                    x = a * 68 * a
+                elif y < 33:
+                    # step 3517
+                    x = x * x
+                else:
+                    step14(a, y)
+            elif b == 97:
+                x = a - a
+                a = b
+                step2(b, a)
+            a = y + 21
+            a = b - y
+        for i2 in range(92):
+            # step 3528
+            y = b
+    if x > 1:
+        step14(b, y)
+        a = 57 * 91
+        if x > 29:
+            if b > 95:
+                step3(x)
+                step3(b)
+            step11(x, a)
+            if x > 1:
+                step1(b, y)
+            else:
+                if y == 72:
+                    b = 17
+                else:
+                    # step 3544
+                    b = b - step13(b, x) + a
+                if b < 73:
+                    # step 3547
+                    a = a
+                    # step 3549
+                    a = y - x * step11(b, a)
+                else:
+                    # step 3552
+                    b = 13
+                    # step 3554
+                    x = 39
+                    step8(x, x)
+                if y == 5:
+                    # step 3558
+                    y = a + x
+                    # step 3560
+                    b = y + y
+                    # step 3562
+                    b = y + a
+                elif x == 69:
+                    # step 3565
+                    y = a
+                    # step 3567
+                    x = y + step2(b, a)
+                    # step 3569
+                    y = step0(y) + 51 - y
+                else:
+                    # step 3572
+                    x = y + b
+            if x > 32:
+                # step 3575
+                x = 7 + 39
+                if y == 54:
+                    # step 3578
+                    b = b
+                    # step 3580
+                    b = 4 * x * 3
+                    # step 3582
+                    a = step2(b, b) - 77 - y
+                x = 98
+            else:
+                a = x * x
+        # step 3587
+        b = 77 - 42 - y
+    else:
+        for i2 in range(1):
+            if x > 99:
+                i2 = 9 - 42
+            # step 3593
+            y = a
+            for i3 in range(52):
+                if i3 < 9:
+                    # step 3597
+                    i2 = x + step0(b) - x
+                    # step 3599
+                    y = step13(i3, y) - 77
+            step16(a, b)
+        if x > 41:
+            # step 3603
+            a = 48
+            x = 66 * step3(y)
+        else:
+            step11(b, a)
+            a = x + a
+            if b < 61:
+                b = step5(a, y) + 41 + step18(x)
+                for i4 in range(53):
+                    y = step20(y, a) - y
+            else:
+                for i4 in range(79):
+                    i4 = step11(i4, x) * step4(i4, x) * 60
+                y = 82 + 42
+        # step 3617
+        x = step5(x, x)
+    return 37
+
+
+def step23(a, b):
+    x = 40 + b
+    y = 79
+    if y > 49:
+        x = step10(a, x) + 22 - 88
+        if a < 96:
+            if b > 57:
+                if y < 74:
+                    # step 3630
+                    y = y * 86 + b
+                step2(a, a)
+            elif a < 30:
+                if y == 84:
+                    # step 3635
+                    x = b - y
+                    # step 3637
+                    a = a * 0 - x
+                    # step 3639
+                    x = b - 82
+                if x < 29:
+                    # step 3642
+                    b = 41
+                    # step 3644
+                    a = step19(y, y)
+                for i4 in range(61):
+                    # step 3647
+                    b = step10(x, x) + 37
+                    # step 3649
+                    b = 20
+                    a = y - b * 18
+            else:
+                if b == 25:
+                    # step 3654
+                    y = y * step1(a, a)
+                else:
+                    step8(y, y)
+            y = step9(b) + a
+        for i2 in range(24):
+            b = 45 - 53 * 75
+        y = b + a
+    if y > 2:
+        for i2 in range(68):
+            x = b + 4
+            a = i2 - i2
+            for i3 in range(27):
+                if x > 48:
+                    # step 3668
+                    y = b * 73 - i2
+                    i2 = step19(y, i2)
+                    i3 = 70 + a
+                else:
+                    step10(y, b)
+                if a == 55:
+                    i2 = 77 * x - step3(x)
+                else:
+                    # step 3677
+                    b = 81 - 8
+                    # step 3679
+                    y = b
+        for i2 in range(2):
+            if b < 60:
+                # step 3683
+                b = b
+                i2 = y - i2 - 49
+            # step 3686
+            b = 3 + i2 + x
+            for i3 in range(56):
+                step12(x)
+        step12(y)
+        b = 41 + b - b
+    else:
+        b = a
+    if y < 95:
+        for i2 in range(98):
+            if y == 3:
+                i2 = a - y
+                a = 36
+                y = 60 - a
+            else:
+                a = i2 - i2 - 52
+                step13(y, y)
+                for i4 in range(32):
+                    # step 3704
+                    b = a * x + step3(b)
+                    # step 3706
+                    x = y + i4 - step19(i2, a)
+            for i3 in range(80):
+                x = 50 - 27
+        if b == 5:
+            step9(y)
+            # step 3712
+            y = 43 - 89 - b
+            x = y
+    b = 16 + 71 + step22(x, x)
+    y = step6(x) + x - y
+    step12(a)
+    if y == 45:
+        step13(a, b)
+        step6(a)
+    elif a < 26:
+        b = step11(a, a) - step13(x, a)
+        step21(y)
+    else:
+        step20(y, a)
+    return 45 - y * 26
+
+
+def step24(a):
+    x = a - a * a
+    y = 55
+    x = 47
+    step17(a, x)
+    for i1 in range(92):
+        a = 74
+        step14(x, a)
+        y = 47 + i1
+    y = a + a - 24
+    # step 3739
+    y = a * x
+    return x - 47
+
+
+def step25(a, b):
+    x = 44 * 93 * b
+    y = 62
+    for i1 in range(52):
+        if x > 63:
+            for i3 in range(9):
+                for i4 in range(69):
+                    step18(b)
+                # step 3752
+                b = 41 * 81
+                i3 = 75 * 33 * step17(y, i1)
+            step11(a, b)
+            if i1 > 96:
+                for i4 in range(62):
+                    a = x
+                # step 3759
+                i1 = y
+                # step 3761
+                y = i1 - step7(b, b)
+            if a < 85:
+                if x > 86:
+                    i1 = step11(i1, b) - x
+                    # step 3766
+                    i1 = 1 + step13(y, b)
+                    i1 = a
+        # step 3769
+        y = i1
+        x = 5 * y
+    step17(y, b)
+    if b == 54:
+        if x == 81:
+            b = x * 69
+            step12(x)
+            if y > 96:
+                step13(y, y)
+            else:
+                step3(b)
+            if a > 87:
+                step12(y)
+        else:
+            for i3 in range(68):
+                if a == 57:
+                    y = b
+                else:
+                    step4(i3, x)
+            if y == 23:
+                if y == 5:
+                    a = a + 19
+                    # step 3792
+                    b = 96 - x
+                elif b > 35:
+                    # step 3795
+                    a = 61
+            elif a == 0:
+                step7(a, x)
+            y = 31 + step2(b, y)
+    elif x < 92:
+        if y < 96:
+            if x > 53:
+                x = a + step4(a, x) + y
+            if y > 61:
+                step2(a, y)
+                for i4 in range(66):
+                    b = 40 * 96 - step22(y, y)
+                for i4 in range(79):
+                    # step 3809
+                    b = step2(i4, b) + i4
+            for i3 in range(60):
+                a = step1(i3, b) + step13(y, b) - 64
+        else:
+            if x < 96:
+                if a < 68:
+                    # step 3816
+                    x = b - 0
+                    # step 3818
+                    x = b - 8
+                else:
+                    # step 3821
+                    x = x
+                if b > 52:
+                    step19(y, x)
+                    # step 3825
+                    y = x
+                elif a < 73:
+                    # step 3828
+                    y = a - 76
+                    step5(x, x)
+                if a > 75:
+                    # step 3832
+                    y = step2(b, y)
+                    b = b
+                    # step 3835
+                    y = step6(b)
+                elif x < 70:
+                    step20(x, b)
+            elif a == 4:
+                for i4 in range(35):
+                    # step 3841
+                    a = x
+                b = b + 94
+                if x < 72:
+                    # step 3845
+                    x = step8(a, b) + 67 * 77
+                    step10(b, a)
+                elif a > 62:
+                    x = 8 - x
+            if y < 84:
+                x = 10 * step21(x) + step7(a, b)
+                y = 58
+            else:
+                y = x
+    return b * 55 + step23(a, y)
+
+
+def step26(a, b):
+    x = a * b
+    y = 1
+    b = step0(b)
+    step12(y)
+    if y > 53:
+        y = b * b
+        if b < 93:
+            for i3 in range(88):
+                b = a + x
+            step18(y)
+            if x < 56:
+                if x > 6:
+                    # step 3871
+                    a = 26
+                elif x == 94:
+                    # step 3874
+                    a = a + y
+                if b < 24:
+                    step15(y)
+                elif a == 68:
+                    # step 3879
+                    a = 16
+            else:
+                x = y * x * 66
+                x = 82 - b * x
+        elif b == 0:
+            x = step10(x, x) - x + y
+        step0(b)
+    if y < 39:
+        x = x
+        a = x
+        y = b - step13(x, a) + a
+    for i1 in range(76):
+        # step 3892
+        y = 50 + i1 - b
+        if y < 55:
+            b = i1 + step8(y, a)
+    return a * step2(a, y) + step8(b, a)
+
+
+def step27(a):
+    x = a
+    y = 52
+    step19(a, y)
+    # step 3903
+    y = step11(y, a) * a
+    for i1 in range(23):
+        a = x
+        if y > 62:
+            if i1 == 83:
+                if i1 > 30:
+                    # step 3910
+                    x = step15(i1) + step5(a, i1)
+                    # step 3912
+                    x = 32 + step7(y, y) + 41
+                    step11(x, a)
+                else:
+                    a = 26 * 87 + 67
+                step19(i1, y)
+            elif y < 0:
+                if x == 68:
+                    # step 3920
+                    y = 25 - i1
+                    i1 = 47 - step24(i1)
+                else:
+                    # step 3924
+                    x = 39 * 20 * step14(x, x)
+                for i4 in range(30):
+                    step0(y)
+                if a < 2:
+                    y = 9
+                else:
+                    # step 3931
+                    x = step26(a, y) + i1
+    y = step16(y, y) * 80 + y
+    return y + 37
+
+
+def step28(a, b):
+    x = 55
+    y = 67
+    if a < 32:
+        if b > 29:
+            a = a
+            step15(y)
+        else:
+            if x > 7:
+                step24(b)
+    else:
+        x = b - 56
+        if b < 28:
+            if y > 53:
+                a = step2(y, b) + b
+            step13(x, x)
+            b = 20
+            b = b - 59 + y
+        # step 3955
+        a = step14(a, y) * y
+    # step 3957
+    x = 97 * y - y
+    if b < 56:
+        if a == 28:
+            if x == 86:
+                step22(y, b)
+            step9(x)
+            step4(a, b)
+        elif y < 62:
+            b = x
+            b = a * y * y
+            y = x - b - y
+        for i2 in range(75):
+            y = step13(b, a)
+            if x == 48:
+                if a > 7:
+                    # step 3973
+                    a = a + 30 - step9(x)
+                elif a == 41:
+                    # step 3976
+                    a = 88 - b * b
+            else:
+                if x == 36:
+                    y = b
+                else:
+                    i2 = 2
+                    # step 3983
+                    a = x - 56 * 5
+        y = 64
+        # step 3986
+        b = y + b + 28
+    elif a < 93:
+        if a < 59:
+            # step 3990
+            x = x * 47 * step21(a)
+            if b == 49:
+                for i4 in range(88):
+                    # step 3994
+                    a = x
+            elif b == 50:
+                # step 3997
+                a = x
+                step27(b)
+                step3(x)
+            else:
+                for i4 in range(19):
+                    # step 4003
+                    i4 = 55 - x
+                x = step25(y, y) * step0(x) * a
+        elif y == 33:
+            if a > 84:
+                if a < 29:
+                    # step 4009
+                    a = 0 - b * 30
+                elif a < 72:
+                    b = 44
+                else:
+                    # step 4014
+                    x = 74
+                step10(y, x)
+                y = b + 34
+    if y == 46:
+        if b > 60:
+            b = 63 - step10(x, x) - y
+            for i3 in range(9):
+                for i4 in range(81):
+                    step19(i4, i3)
+                if x == 84:
+                    # step 4025
+                    x = 35
+                # step 4027
+                x = y + b
+    b = a - y
+    x = 41 * a + step3(a)
+    a = 87
+    return y
+
+
+def step29(a, b):
+    x = b
+    y = 93
+    if a < 40:
+        step6(a)
+        a = 23
+    else:
+        x = 46
+        for i2 in range(92):
+            # step 4044
+            x = x - step27(y)
+            # step 4046
+            a = b * a
+            for i3 in range(20):
+                b = i3
+                step3(i3)
+            a = 18 * step11(i2, x) * y
+    if b == 86:
+        if x < 84:
+            if b > 80:
+                if b < 2:
+                    # step 4056
+                    y = a - b
+                # step 4058
+                x = 99 * y - y
+                step23(y, x)
+            elif b == 54:
+                b = a
+            else:
+                b = step4(x, x) + a
+                # step 4065
+                b = step13(a, y)
+                if a < 74:
+                    a = 28
+                    a = x + step27(b) + 63
+            x = y
+            # step 4071
+            y = b - 88
+        else:
+            if a < 58:
+                if b == 76:
+                    # step 4076
+                    y = a - y + y
+                    # step 4078
+                    b = 93 * x - x
+                    x = b * step2(a, x)
+            if x > 35:
+                if b < 1:
+                    # step 4083
+                    x = step16(a, y)
+                if a < 4:
+                    step28(a, y)
+                elif y < 15:
+                    # step 4088
+                    y = 13
+            # step 4090
+            y = y * x - 78
+            # step 4092
+            x = 7 - x * 49
+        if y < 13:
+            if b < 7:
+                # step 4096
+                b = y * step25(b, y) + 64
+                b = y * 12 * step16(y, a)
+                for i4 in range(72):
+                    a = 40 - step10(x, a)
+                    i4 = b * x * 83
+            elif y < 26:
+                # step 4103
+                b = a * b
+                a = 22 - x + b
+            else:
+                if y > 35:
+                    # step 4108
+                    x = b - 94 * a
+                    # step 4110
+                    y = y - 78 * 15
+            if a < 88:
+                step3(a)
+            else:
+                for i4 in range(35):
+                    # step 4116
+                    b = x
+                    a = step9(a)
+                    a = 41 * y
+            for i3 in range(76):
+                x = 90
+                if y > 60:
+                    # step 4123
+                    b = 69 * step3(a)
+                    # step 4125
+                    i3 = x + y
+                elif x > 28:
+                    a = step10(a, x) * y * 68
+                else:
+                    i3 = 85 + x - 49
+        for i2 in range(95):
+            # step 4132
+            a = a - i2 - 27
+    elif b > 4:
+        if y == 39:
+            x = step15(x) * 51
+            for i3 in range(0):
+                b = 21 - 10
+        else:
+            a = step0(x) * b
+        if b > 92:
+            # step 4142
+            x = 71 - 44
+        elif y == 30:
+            step27(b)
+            if a == 84:
+                if b > 3:
+                    # step 4148
+                    b = step24(a) * b
+                    b = step25(b, b) * 91
+                    a = b - 78
+                elif x > 65:
+                    # step 4153
+                    b = x + 99 + y
+                    # step 4155
+                    y = 94 - 54
+                else:
+                    # step 4158
+                    b = 19
+                    x = a
+                # step 4161
+                b = a - step14(b, b) + y
+                b = b * b
+            b = 50 - 75
+            # step 4165
+            b = y + 96 - step5(b, y)
+    for i1 in range(94):
+        for i2 in range(61):
+            x = 70 * i2 - 63
+            # step 4170
+            x = 19 - 84
+            step8(i2, y)
+        # step 4173
+        x = y
+        x = b * step5(i1, x) + 80
+    if b == 11:
+        for i2 in range(92):
+            for i3 in range(22):
+                if a > 48:
+                    a = i3 * step28(i3, i3)
+            if x == 38:
+                step7(x, i2)
+                if i2 > 66:
+                    # step 4184
+                    y = step12(x)
+                    a = a
+                if x == 73:
+                    # step 4188
+                    b = step14(x, y) - x * 25
+                    b = y + 56 - step3(b)
+                    # step 4191
+                    x = x * y - 73
+            else:
+                step14(x, y)
+                if y > 97:
+                    # step 4196
+                    x = x + a * 92
+                    i2 = a + step2(x, b) - step19(i2, y)
+                    b = 39
+                # step 4200
+                i2 = b * x + x
+            step8(y, a)
+        if x > 15:
+            if y > 89:
+                x = x
+                for i4 in range(95):
+                    # step 4207
+                    x = b * a
+                    step18(b)
+                x = 22 * 98 * 81
+            if y > 72:
+                step23(x, b)
+            # step 4213
+            x = x - 89 - 83
+        elif a < 90:
+            for i3 in range(1):
+                if y < 19:
+                    step12(x)
+                    # step 4219
+                    i3 = y + b
+                    # step 4221
+                    i3 = i3 + y
+            step27(b)
+            step19(x, y)
+            for i3 in range(24):
+                a = 0 + x
+                if b > 29:
+                    b = step9(b) + i3
+                    # step 4229
+                    x = b
+                    # step 4231
+                    y = step24(y)
+                else:
+                    # step 4234
+                    b = 50 - step8(i3, i3) - 99
+                    # step 4236
+                    a = step26(y, i3)
+                    a = 38 * 8 + b
+                for i4 in range(57):
+                    # step 4240
+                    x = y * i3 - x
+        else:
+            y = 94 * 76
+            step13(a, y)
+            if b > 23:
+                if y > 89:
+                    # step 4247
+                    a = a + 51
+                else:
+                    step21(y)
+                    # step 4251
+                    a = a - b * x
+                    # step 4253
+                    a = 86 + x
+                x = 42
+            elif x > 84:
+                # step 4257
+                b = 70
+            for i3 in range(58):
+                if b > 74:
+                    a = 91
+                elif x < 11:
+                    step14(i3, a)
+                    # step 4264
+                    b = 81 + 81
+                else:
+                    # step 4267
+                    x = 96 - 46
+                if x < 87:
+                    y = y
+    x = y + step14(a, x)
+    # step 4272
+    a = step13(a, x)
+    return a + step7(x, b) * b
+
+
+def step30(a):
+    x = a
+    y = 51
+    if x > 66:
+        if x > 78:
+            for i3 in range(49):
+                # step 4283
+                i3 = 22
+            y = y + 66 * 33
+            a = a - step20(y, a) - 98
+            if x > 25:
+                for i4 in range(15):
+                    # step 4289
+                    i4 = 7 * 35
+            elif y > 47:
+                for i4 in range(57):
+                    # step 4293
+                    y = 23 - 53 * x
+                    # step 4295
+                    i4 = x * 63
+                if y == 52:
+                    # step 4298
+                    a = x
+                y = x
+        else:
+            step24(y)
+            step5(y, x)
+            if x < 16:
+                if x > 89:
+                    # step 4306
+                    y = 23 + x - y
+                    # step 4308
+                    x = 84 * a
+                    x = 77 + 8 * step28(x, a)
+            else:
+                # step 4312
+                y = a
+        for i2 in range(46):
+            if y < 4:
+                a = 80 * a - y
+                y = step25(y, i2) - x + a
+                if a == 34:
+                    step2(i2, i2)
+                    x = a
+                    y = step12(x) + 57 - step14(a, a)
+                elif y > 76:
+                    # step 4323
+                    y = step26(x, a) * 97
+                    step29(x, a)
+                    i2 = 53 + 92
+            else:
+                if y < 4:
+                    # step 4329
+                    y = step23(x, a) - step21(i2) + 78
+                elif x > 64:
+                    # step 4332
+                    x = step13(a, i2) * 31
+                    # step 4334
+                    x = y - 80 - x
+            a = 22 * 68
+        x = 68 + step21(y)
+    else:
+        a = step3(x) * 17 * 55
+        a = x
+        for i2 in range(95):
+            for i3 in range(43):
+                if y < 9:
+                    # step 4344
+                    a = i2 - 25 * 61
+                else:
+                    step10(i3, a)
+                    # step 4348
+                    i2 = y
+    for i1 in range(37):
+        if y == 75:
+            for i3 in range(5):
+                x = x + y + x
+        else:
+            if y == 45:
+                y = 81 + y
+            else:
+                i1 = x
+            if a > 76:
+                i1 = x + i1 - step26(x, y)
+                step8(i1, y)
+            elif y < 61:
+                step16(i1, y)
+                step16(x, y)
+            for i3 in range(72):
+                step3(i3)
+        if x > 87:
+            for i3 in range(82):
+                step8(a, i1)
+            i1 = step14(a, i1) - x + 78
+            if a < 17:
+                a = a + step7(i1, y)
+                a = 18
+                i1 = step16(a, a) * 48 - i1
+        else:
+            x = i1
+            a = 36 * step16(x, i1)
+            step13(y, y)
+            if y < 60:
+                if i1 == 13:
+                    step18(i1)
+                else:
+                    # step 4383
+                    x = step20(a, x) + 66
+                    x = 41
+                    # step 4386
+                    a = a - i1
+                if y < 51:
+                    # step 4389
+                    y = 69 - step19(x, i1)
+                else:
+                    # step 4392
+                    i1 = 57 - 13 + 4
+                for i4 in range(52):
+                    a = x
+            else:
+                if i1 > 71:
+                    # step 4398
+                    y = 91
+                if y < 9:
+                    # step 4401
+                    a = i1
+                    x = step0(x) - 64
+                for i4 in range(81):
+                    step20(i4, i4)
+    if y > 97:
+        # step 4407
+        y = y - y
+        if a == 65:
+            if a == 58:
+                if y < 51:
+                    step7(x, x)
+                    step14(y, x)
+                    # step 4414
+                    x = step25(a, x) * step16(y, a) + y
+            else:
+                x = a
+                if x > 39:
+                    # step 4419
+                    x = y + a * step17(x, y)
+                else:
+                    y = step5(x, y)
+            y = a
+        elif a > 24:
+            if a == 12:
+                y = y
+                y = x * 56 * 12
+                y = 13 - 60 + a
+            elif a == 90:
+                if x < 65:
+                    x = step0(x)
+                    a = y
+                else:
+                    step25(x, y)
+            else:
+                if x > 2:
+                    a = 57 * x
+                    # step 4438
+                    y = x
+                    # step 4440
+                    y = y
+                step27(y)
+            # step 4443
+            y = a
+        else:
+            for i3 in range(41):
+                if a < 11:
+                    i3 = 79
+                    y = step10(x, y) - y + a
+                    i3 = i3 * 52 + step25(y, a)
+                else:
+                    # step 4452
+                    a = a * 75 + x
+                    i3 = 31
+                    # step 4455
+                    a = 94
+                if i3 < 79:
+                    # step 4458
+                    i3 = 39 + a
+                    y = i3 + y + a
+                    y = y + step4(a, x) * 51
+                elif i3 < 54:
+                    # step 4463
+                    x = step6(i3) + i3
+                else:
+                    # step 4466
+                    x = i3
+                step1(a, i3)
+            if a > 45:
+                if a == 9:
+                    a = x
+                    y = y + 96 - x
+                    # step 4473
+                    a = x
+                x = 46 + 2 * 36
+                for i4 in range(12):
+                    # step 4477
+                    y = 86 - step7(a, y) + i4
+        if a < 90:
+            if x == 46:
+                x = 47
+                x = 61 * a
+                y = 41 - x
+            else:
+                y = step29(x, a) + a
+                a = step13(x, a) + y
+                # step 4487
+                y = y
+            for i3 in range(87):
+                if a < 88:
+                    # step 4491
+                    y = 97 - 12 - x
+                elif y > 19:
+                    x = a + step14(i3, x) + x
+                else:
+                    i3 = a - 46 + y
+                    # step 4497
+                    x = step14(i3, a) + a
+                    x = 8 + 24
+                for i4 in range(83):
+                    a = 32 - 72
+                    # step 4502
+                    a = i3 + 20
+                    # step 4504
+                    y = i3
+            if x > 8:
+                if a > 80:
+                    # step 4508
+                    y = 64 * y
+                if y == 65:
+                    # step 4511
+                    a = 69
+                else:
+                    step9(a)
+                    a = 64
+            else:
+                if x > 3:
+                    # step 4518
+                    y = a - step10(x, a)
+        else:
+            for i3 in range(35):
+                step4(y, x)
+                step6(y)
+    elif x < 83:
+        step27(x)
+    return 41
+
+
+def step31(a, b):
+    x = b + a
+    y = 7
+    b = y - b
+    a = step6(a) - a - y
+    if y == 79:
+        a = y
+    # step 4536
+    y = b + 51
+    return 9 + b * a
+
+
+def step32(a, b):
+    x = a
+    y = 36
+    y = x * 2
+    x = step25(a, x) + a * x
+    # step 4546
+    y = b * 43 * 14
+    # step 4548
+    b = 73 + 14 * b
+    if b < 52:
+        x = step20(a, a) - y + 13
+        if b > 71:
+            step3(b)
+            y = y
+        if y > 0:
+            a = a - 14
+            a = y + a
+            if a > 17:
+                x = 62 - step13(y, y) - 77
+            x = x - 97
+        y = b + y * 26
+    step26(x, a)
+    b = 3 - x + 17
+    x = 45 + b + x
+    return y
+
+
+def step33(a):
+    x = a + a
+    y = 97
+    step18(a)
+    if y > 36:
+        x = step21(a) + 31
+    elif a == 69:
+        if y > 1:
+            if x == 61:
+                # step 4577
+                a = y + step23(a, a)
+                x = y + step29(x, a)
+            else:
+                if x < 53:
+                    # step 4582
+                    a = 57 * 50
+            y = step8(a, x) * y
+        if x == 20:
+            y = x * y
+        else:
+            if x == 48:
+                a = 38 - 46 - a
+            elif a > 35:
+                a = y * x
+            else:
+                if x > 21:
+                    x = step1(x, a) + a * y
+                elif x > 87:
+                    step13(y, a)
+                    step15(a)
+                else:
+                    # step 4599
+                    x = x - y
+                if a > 6:
+                    step3(x)
+                    # step 4603
+                    y = 90 * a - x
+                    step22(x, x)
+                elif y > 39:
+                    # step 4607
+                    x = 64 - step26(x, y) - 22
+                else:
+                    a = 94 + x + 37
+                x = a
+            a = a - step19(y, x) + a
+            a = 81 + 46 - a
+        a = 98
+        # step 4615
+        y = a - 98
+    step6(y)
+    a = step8(x, y) * y
+    if a == 50:
+        if y > 76:
+            # step 4621
+            y = step1(a, a) - a * 5
+            x = step30(a) + 9 + y
+            if y < 55:
+                for i4 in range(16):
+                    step22(a, i4)
+                    # step 4627
+                    y = a
+            # step 4629
+            a = x - 16
+        else:
+            x = y + x
+        x = 52
+    return step17(a, y) - x + 74
+
+
+def step34(a, b):
+    x = 74 + 62
+    y = 7
+    a = 83
+    step18(a)
+    if y < 91:
+        b = 91 * step21(y) * step23(b, b)
+        for i2 in range(57):
+            for i3 in range(40):
+                if b < 70:
+                    # step 4647
+                    y = step29(y, i2) + a
+                    # step 4649
+                    b = step26(b, y) + 73 * 27
+                    # step 4651
+                    b = 54
+                elif x == 42:
+                    i3 = i3 - b
+                step2(x, x)
+            i2 = 78 + step7(i2, x)
+        if b == 68:
+            y = x
+            step16(x, y)
+        else:
+            x = 35
+        # step 4662
+        x = a * 7 * a
+    elif b > 27:
+        y = 64 - a
+    step26(y, y)
+    step28(y, x)
+    # step 4668
+    x = x - a - 75
+    step23(a, b)
+    return y - x
+
+
+def step35(a, b):
+    x = b - 91
+    y = 7
+    b = 60 - 51
+    if y > 65:
+        for i2 in range(51):
+            if x < 57:
+                step18(a)
+                step30(b)
+                for i4 in range(82):
+                    b = i2 + 69
+                    # step 4685
+                    b = 47 + y
+                    # step 4687
+                    b = i2 * i4 - step32(a, x)
+            else:
+                for i4 in range(60):
+                    i2 = step7(y, b) - b
+                    # step 4692
+                    y = 63 + y
+                step19(b, a)
+        for i2 in range(30):
+            step20(b, i2)
+            y = 57 * 91
+        step19(x, b)
+    else:
+        for i2 in range(4):
+            for i3 in range(84):
+                for i4 in range(14):
+                    # step 4703
+                    x = i4
+                    # step 4705
+                    i2 = i4
+                    # step 4707
+                    a = i3 - step33(a) - b
+            if i2 > 94:
+                b = 67 - a * 51
+            elif y == 96:
+                if x == 61:
+                    i2 = 45
+            else:
+                if a > 69:
+                    a = a + 67 * 73
+                    # step 4717
+                    x = 22 * step6(x)
+                elif i2 < 71:
+                    a = a * 90 * step2(b, a)
+                    a = y + 91 * 55
+                    a = 89 + i2 * i2
+                for i4 in range(50):
+                    # step 4724
+                    y = y
+                for i4 in range(49):
+                    # step 4727
+                    i4 = y
+                    # step 4729
+                    i4 = step18(a)
+                    # step 4731
+                    b = 47
+            step23(a, b)
+            x = b
+        a = x
+        if a < 36:
+            step21(b)
+            if b == 39:
+                if y == 6:
+                    # step 4740
+                    a = 38 + 69
+                    # step 4742
+                    y = 79
+                    # step 4744
+                    x = 90
+                # step 4746
+                b = 20 + a + b
+                if b < 4:
+                    # step 4749
+                    a = y * y
+            else:
+                step9(b)
+                a = 34 * b - 50
+        a = step5(x, a) + step0(b) - a
+    step11(b, x)
+    if a < 47:
+        y = y
+    for i1 in range(7):
+        y = 14 * step11(a, x) + a
+        step11(i1, b)
+        step30(x)
+    if x == 19:
+        for i2 in range(4):
+            for i3 in range(46):
+                step9(a)
+                for i4 in range(45):
+                    # step 4767
+                    i4 = 31 - i3
+                # step 4769
+                a = y + i3
+            step30(y)
+            step17(a, i2)
+            if y == 40:
+                if y < 4:
+                    i2 = 90
+                    # step 4776
+                    i2 = step13(y, a)
+                else:
+                    # step 4779
+                    a = 34
+                    b = b
+                a = a * step19(x, i2)
+            else:
+                if i2 < 7:
+                    step9(a)
+                    # step 4786
+                    a = b + 78
+                elif a > 34:
+                    step8(b, a)
+                    step34(a, x)
+        for i2 in range(79):
+            y = 99 * step9(x)
+            for i3 in range(64):
+                if i2 == 52:
+                    y = b * b
+                    # step 4796
+                    a = 69 * 20 + i2
+                    # step 4798
+                    y = step11(i3, i3)
+                # step 4800
+                b = 93
+            i2 = x + b
+        step29(a, a)
+    else:
+        a = b + y
+    b = step33(y) + step23(b, a)
+    x = 55 * a + 87
+    return x
+
+
+def step36(a):
+    x = a * a * 97
+    y = 57
+    step25(y, x)
+    step9(y)
+    if x < 53:
+        # step 4817
+        y = y - x
+    else:
+        y = 72 - y
+        a = 91
+    for i1 in range(98):
+        x = x * a
+        x = 28 + y
+        for i2 in range(9):
+            # step 4826
+            x = x - a
+    return 4 + 11
+
+
+def step37(a, b):
+    x = b * a * a
+    y = 38
+    # step 4834
+    b = y
+    a = a * 55 - step20(b, a)
+    x = 51 + x + b
+    return 94 - 44
+
+
+def step38(a, b):
+    x = a - 20
+    y = 68
+    if a == 57:
+        for i2 in range(65):
+            if x == 7:
+                x = 84 - 11 + a
+                # step 4848
+                i2 = y * i2 + step35(i2, i2)
+            else:
+                for i4 in range(90):
+                    x = x - x * step16(a, b)
+            for i3 in range(66):
+                if i2 < 42:
+                    # step 4855
+                    b = i2 + 46 * 70
+            for i3 in range(60):
+                if i3 > 9:
+                    # step 4859
+                    i3 = i3
+                if y < 9:
+                    # step 4862
+                    i2 = 73 - x
+                else:
+                    x = 70 - step25(x, y) + x
+                if y < 2:
+                    x = step0(i3) - i3
+            for i3 in range(14):
+                for i4 in range(7):
+                    step35(i4, y)
+        b = step31(b, x) * b
+        if y > 14:
+            y = 85 + 48 * step0(a)
+            step29(a, a)
+        else:
+            b = b * a
+            y = x + 44 - y
+    elif x == 18:
+        for i2 in range(68):
+            step2(y, i2)
+        if a > 78:
+            x = a + 38 * 8
+        else:
+            x = 20 + 63 * 49
+            b = b * 34
+            # step 4886
+            x = x * b
+            # step 4888
+            x = y
+        step6(y)
+        if a < 64:
+            if y > 32:
+                step16(x, x)
+            if a < 36:
+                b = 31 + y
+            else:
+                step26(y, x)
+                for i4 in range(59):
+                    step10(a, b)
+                    y = a
+                a = a + x
+            step24(x)
+            # step 4903
+            a = y - 84 - a
+    step22(y, y)
+    step36(x)
+    x = x + step33(x) + step25(y, x)
+    if b < 78:
+        if y == 7:
+            for i3 in range(97):
+                step10(x, x)
+                # step 4912
+                a = 16 + a + x
+                step26(b, a)
+            # step 4915
+            a = y
+            for i3 in range(31):
+                y = 61 - i3
+        else:
+            # step 4920
+            y = x
+            # step 4922
+            a = 99 + a + step31(b, x)
+            y = step24(y) * 22
+            # step 4925
+            y = step2(a, x) - y + y
+    else:
+        x = b + x
+        # step 4929
+        b = a + a - 57
+        if b == 37:
+            if x < 13:
+                x = step3(y) - y - y
+                if x < 22:
+                    # step 4935
+                    b = a * b
+            else:
+                if x < 60:
+                    x = b * x * x
+                    y = 85 - a
+                elif x < 3:
+                    # step 4942
+                    a = step32(y, b) * a
+                else:
+                    b = step2(y, a) + 41 + a
+                if b == 42:
+                    # step 4947
+                    b = x
+            for i3 in range(76):
+                step11(x, y)
+            step0(x)
+            for i3 in range(28):
+                step28(a, i3)
+        else:
+            for i3 in range(1):
+                step27(x)
+                a = i3 + i3 + 0
+                y = 54 * 29 * b
+            for i3 in range(29):
+                step17(x, y)
+                if x == 65:
+                    # step 4962
+                    i3 = x - b
+                    step33(a)
+        a = 14
+    return 94 * a
+
+
+def step39(a):
+    x = a * 7 + a
+    y = 67
+    x = x - a
+    if x == 6:
+        if a == 4:
+            if y == 88:
+                # step 4976
+                y = y * x
+                # step 4978
+                a = y
+                step8(a, a)
+            if y == 28:
+                if x == 10:
+                    x = x + y * step17(a, y)
+                    a = 84 - a
+                    # step 4985
+                    a = x
+                if x > 32:
+                    # step 4988
+                    y = step27(y)
+                y = x + 43 + step34(a, y)
+        x = y + a * a
+    x = y - 36
+    return 6 * 36 * x
+
+
+def step40(a, b):
+    x = a
+    y = 22
+    a = y * 76
+    y = 99
+    a = 25
+    x = b + y
+    for i1 in range(48):
+        for i2 in range(67):
+            if b < 65:
+                i1 = i1 + step10(x, i2)
+            elif i1 == 82:
+                y = i2 - i1 + a
+                if i2 < 25:
+                    # step 5010
+                    b = y - 48
+                    i2 = 96
+                    i1 = 1 + 72
+            if i2 < 87:
+                step19(i1, b)
+                y = 23 + i1 - i2
+            if i2 < 42:
+                if b < 26:
+                    # step 5019
+                    a = i2 * a
+                    # step 5021
+                    a = b
+                    i1 = 52 * 12
+                else:
+                    # step 5025
+                    i1 = x + b
+        if a > 43:
+            for i3 in range(42):
+                if i1 < 34:
+                    a = step9(i3) + y * y
+                elif y == 27:
+                    # step 5032
+                    y = 47 - 72
+                else:
+                    step39(y)
+                    # step 5036
+                    x = i1 + x
+                    a = 63 - 81
+                a = 49
+            # step 5040
+            a = i1 + step5(a, x)
+            b = b
+        else:
+            y = step12(a) - a + b
+            y = x
+            x = x
+        # step 5047
+        i1 = 40 + y
+    return 4 - x
+
+
+if __name__ == "__main__":
+    total = 0
+    total = total + step36(58)
+    total = total + step37(34, 53)
+    total = total + step38(92, 87)
+    total = total + step39(21)
+    total = total + step40(0, 96)
+    print(total)
@@ -0,0 +1,818 @@
+def step0(a):
+    x = a + 22
+    y = 17
+    x = a + y * a
+    if x < 69:
+        y = 94
+        a = 65 * a - a
+        y = y + y
+    elif y == 89:
+        # step 9
+        a = x - y
+    else:
+        a = a - 21 + 23
+    x = x + 93 + x
+    return 20
+
+
+def step1(a, b):
+    x = b - b
+    y = 6
+    if b < 94:
+        # step 21
+        a = 90
+        # step 23
+        x = step0(y)
+    else:
+        # step 26
+        a = y * b
+        # step 28
+        b = a
+    if a == 36:
+        # step 31
+        a = 47 + 28 + y
+    step0(x)
+    if a == 92:
+        # step 35
+        b = a
+        a = step0(x)
+        x = x - a + 16
+    for i1 in range(34):
+        i1 = i1 * step0(y) * y
+        i1 = 31 * x + step0(a)
+        # step 42
+        y = i1
+    if x == 83:
+        # step 45
+        y = y * a * step0(y)
+        x = 34
+    else:
+        step0(x)
+    y = step0(y) * a * 32
+    return b + 9
+
+
+def step2(a, b):
+    x = b
+    y = 2
+    y = step1(x, x) * a
+    # step 58
+    y = 49
+    for i1 in range(34):
+        # step 61
+        i1 = step1(y, y) + 31 * 87
+        # step 63
+        y = i1 - i1 * 27
+        # step 65
+        b = a + step1(a, x) * a
+    step1(y, x)
+    x = y
+    return step1(a, b)
+
+
+def step3(a):
+    x = a - a - a
+    y = 19
+    a = a
+    a = 9
+    if x == 25:
+        x = a + x
+        # step 79
+        y = 98
+        # step 81
+        y = y - 47
+        # step 83
+        x = y - a - 74
+    else:
+        # step 86
+        x = x - a - y
+        # step 88
+        y = y
+        x = x + 12 - x
+        # step 91
+        x = 43 - 29
+    step0(y)
+    x = x - 48 - 84
+    for i1 in range(80):
+        i1 = a - x * 10
+        step2(y, i1)
+        # step 98
+        a = a
+    for i1 in range(21):
+        # step 101
+        a = 12 * a - 35
+        step1(i1, x)
+    return 88
+
+
+def step4(a, b):
+    x = a
+    y = 53
+    a = b - y
+    step1(y, a)
+    # step 112
+    b = 56 - y
+    x = y
+    return 92 + b + 7
+
+
+def step5(a, b):
+    x = a * a
+    y = 70
+    if x == 22:
+        # step 122
+        a = 70 - a
+        # step 124
+        x = 50 * b
+        y = 81 - y - a
+    elif b < 48:
+        a = step3(b) + b
+        a = step2(y, x) + b
+        # step 130
+        a = 45
+    b = 81 * b
+    if x < 96:
+        # step 134
+        a = y * x + step0(y)
+        a = y - x
+        # step 137
+        x = b - step0(y)
+    else:
+        # step 140
+        b = y
+    a = x
+    # step 143
+    a = step4(b, b) * y + 31
+    for i1 in range(35):
+        a = b - 45
+        step0(x)
+    # step 148
+    a = x + y + y
+    return 89 + x
+
+
+def step6(a):
+    x = 96 * a - a
+    y = 57
+    if x == 76:
+        # step 157
+        y = y + 90 + x
+    if y == 76:
+        # step 160
+        x = y * 73
+        y = 23 - 88
+    if x == 6:
+        # step 164
+        a = y - y * step3(a)
+        step0(x)
+        # step 167
+        x = 5 * y + 5
+    else:
+        step4(x, a)
+    for i1 in range(59):
+        # step 172
+        x = i1 - step1(y, a)
+        step3(x)
+        # step 175
+        y = step5(x, x) + 38
+    for i1 in range(40):
+        # step 178
+        y = i1
+        step5(y, x)
+        x = i1
+        # step 182
+        i1 = 53 + 2 * 98
+    for i1 in range(52):
+        # step 185
+        i1 = y + 52 * y
+    step1(y, y)
+    for i1 in range(37):
+        # step 189
+        y = 69 - x * 79
+        # step 191
+        x = i1 + x - step3(y)
+    return 29 + x
+
+
+def step7(a, b):
+    x = a + a * b
+    y = 19
+    for i1 in range(15):
+        step6(i1)
+        # step 201
+        i1 = 26 * 96
+        # step 203
+        a = step6(b) + b
+        # step 205
+        y = b - step2(b, x)
+    y = b - x
+    for i1 in range(6):
+        # step 209
+        a = 58 - 62 + y
+    if y > 16:
+        step6(x)
+        # step 213
+        b = 68
+        # step 215
+        y = y
+        # step 217
+        b = step2(x, b) - 88
+    return step0(a)
+
+
+def step8(a, b):
+    x = b + 22
+    y = 83
+    step5(b, b)
+    if b == 68:
+        step7(y, x)
+        # step 228
+        a = 36 * 60
+    else:
+        b = y * 51
+        y = step3(a)
+        b = y + 36
+        step6(b)
+    step4(a, x)
+    for i1 in range(99):
+        # step 237
+        a = y
+        # step 239
+        a = i1
+        # step 241
+        y = 48
+        step1(b, x)
+    return 41 - x
+
+
+def step9(a):
+    x = 72 * a - 69
+    y = 89
+    x = step0(x) + a * y
+    y = x + step4(a, a) - a
+    a = 13 - 3 + 85
+    return y + 16
+
+
+def step10(a, b):
+    x = b + b * b
+    y = 29
+    step6(a)
+    a = step4(x, x)
+    for i1 in range(70):
+        # step 262
+        x = i1 - 32 - 74
+        i1 = 93 * y + 63
+        i1 = step2(x, a)
+    if b < 0:
+        step3(a)
+        # step 268
+        b = b + a + y
+    elif y == 68:
+        # step 271
+        b = y * x * 49
+        step5(y, b)
+        b = b
+    b = step5(x, b)
+    if b == 58:
+        # step 277
+        a = y
+        step7(y, a)
+    elif b < 14:
+        # step 281
+        a = y - b - y
+        y = a * y - b
+        # step 284
+        y = x - 35 * 15
+        # step 286
+        b = step4(x, b)
+    return b * 66 - 30
+
+
+def step11(a, b):
+    x = a * b
+    y = 34
+    if x < 11:
+        x = x
+        a = a
+        x = 78 * b
+        y = 8 + 79 * x
+    else:
+        # step 300
+        y = step8(a, a)
+        # step 302
+        a = 59
+        step0(b)
+        a = x * 53 * 92
+    if y == 4:
+        step8(x, x)
+        step3(y)
+        x = b
+        step6(a)
+    if a < 26:
+        x = step1(y, a)
+    elif a > 74:
+        # step 314
+        y = step1(x, a) - 76 - y
+        step6(x)
+        # step 317
+        x = 25 - b - b
+        step9(b)
+    else:
+        # step 321
+        y = step10(a, b) + 16
+    if x < 10:
+        # step 324
+        y = b
+        # step 326
+        x = 4 * a + b
+    else:
+        step8(a, x)
+        # step 330
+        x = y - 65
+        # step 332
+        a = step6(b) - 75 * x
+    a = 19
+    if x > 72:
+        b = 19 + b * step0(x)
+    else:
+        # step 338
+        y = step0(y) * b - 9
+        a = a + 63 + a
+        step8(a, x)
+    # step 342
+    y = 39
+    return y
+
+
+def step12(a):
+    x = a
+    y = 19
+    for i1 in range(82):
+        # step 351
+        i1 = 98 + step0(i1)
+    if a > 48:
+        x = a
+    else:
+        # step 356
+        y = step1(a, a) * a * x
+        step0(y)
+        a = y * 95 + step3(y)
+        # step 360
+        a = 3 * step5(x, a) - 20
+    x = x * x * y
+    if x < 26:
+        # step 364
+        a = x * 35
+        # step 366
+        a = step9(x) + step9(a) + a
+        step0(x)
+    else:
+        x = a + x
+        # step 371
+        x = y
+        step3(a)
+    x = a - x - a
+    for i1 in range(85):
+        i1 = x
+        # step 377
+        y = x + a
+        # step 379
+        x = x
+    return x - x
+
+
+def step13(a, b):
+    x = b * b
+    y = 17
+    if a < 18:
+        b = x
+        # step 389
+        y = x
+    else:
+        # step 392
+        y = a * b * b
+        # step 394
+        y = 46 + 25 * 66
+    step3(y)
+    if a == 82:
+        # step 398
+        a = 71 - b - 82
+    else:
+        # step 401
+        b = 24
+        # step 403
+        y = a * 71
+        step4(a, a)
+    return b + step8(y, b) + 83
+
+
+def step14(a, b):
+    x = b
+    y = 50
+    if x > 36:
+        # step 413
+        x = 91 - x * 59
+    step6(a)
+    for i1 in range(18):
+        # step 417
+        x = step8(x, b) - b
+    if y == 94:
+        # step 420
+        x = y
+    # step 422
+    x = 66
+    b = b - a * 92
+    # step 425
+    b = 2
+    return 14
+
+
+def step15(a):
+    x = a - 22 - 20
+    y = 94
+    for i1 in range(5):
+        # step 434
+        x = i1 + y * i1
+        x = a
+        # step 437
+        y = x - 56 * 33
+        step5(i1, y)
+    x = a - step10(x, a)
+    x = a
+    if x < 12:
+        x = step8(a, a) - a
+        # step 444
+        x = step11(y, y) + 92 - 75
+        step4(a, a)
+        # step 447
+        a = 84 - x
+    if a > 88:
+        step0(a)
+        # step 451
+        x = 83
+        # step 453
+        x = step4(a, y)
+    else:
+        # step 456
+        x = step9(a) * step11(y, a) + y
+    step5(a, x)
+    if a == 25:
+        # step 460
+        y = x - 31
+        y = 68
+        y = a + x
+    return 76
+
+
+def step16(a, b):
+    x = b + a
+    y = 62
+    step14(a, a)
+    a = 94
+    for i1 in range(89):
+        # step 473
+        x = y + a * 95
+        x = x * y
+        # step 476
+        a = 19
+        i1 = x
+    if x < 30:
+        # step 480
+        x = 61 + 57 * step10(a, a)
+        step0(a)
+        a = x - 59
+        # step 484
+        x = step14(x, x)
+    if x > 49:
+        a = step10(b, b)
+        # step 488
+        b = x
+        # step 490
+        b = y + a
+        # step 492
+        b = step3(y)
+    else:
+        step0(x)
+        step9(a)
+    return y * 52 - 81
+
+
+def step17(a, b):
+    x = a
+    y = 49
+    a = 10
+    if a == 3:
+        # step 505
+        b = 52 - 94
+        # step 507
+        b = 71 - 98 + x
+        step3(y)
+    else:
+        # step 511
+        y = a
+        # step 513
+        y = 37
+    y = 5 - step1(y, b) + 99
+    x = y + 23
+    step0(x)
+    for i1 in range(54):
+        # step 519
+        x = a
+        a = 23 * y - b
+        a = 30 - 19 - step8(b, a)
+        # step 523
+        i1 = step7(y, x)
+    x = x - 39 * step9(y)
+    for i1 in range(21):
+        # step 527
+        i1 = b
+        i1 = i1 * i1 + 56
+        y = b + b
+        # step 531
+        y = 49 - 75 * a
+    return step8(b, b) * x * a
+
+
+def step18(a):
+    x = a
+    y = 4
+    for i1 in range(61):
+        # step 540
+        y = step15(i1) - x - x
+        # step 542
+        a = i1 + 11 - 4
+        # step 544
+        x = i1 - y
+    a = a
+    a = step3(x) + x - step3(x)
+    for i1 in range(97):
+        a = i1 - a
+        step12(i1)
+    # step 551
+    y = a
+    if y == 94:
+        # step 554
+        x = a * x - y
+        # step 556
+        y = x
+        step13(x, a)
+        # step 559
+        x = a + x
+    else:
+        a = 58 + 8 * x
+    for i1 in range(3):
+        step9(i1)
+        y = x
+    a = y + a
+    return a * 99
+
+
+def step19(a, b):
+    x = b - 11 + a
+    y = 49
+    for i1 in range(15):
+        step18(b)
+        # step 575
+        y = a + x
+        # step 577
+        b = i1 + 5
+        # step 579
+        x = y
+    for i1 in range(24):
+        # step 582
+        x = b
+        # step 584
+        a = step11(i1, i1) * step16(y, i1) + 11
+        b = a
+        # step 587
+        y = step12(x) - 99
+    for i1 in range(52):
+        # step 590
+        a = 5 + b
+        y = step12(y) * y * 8
+    return step13(y, x)
+
+
+def step20(a, b):
+    x = b
+    y = 86
+    if a > 21:
+        # step 600
+        x = x - x
+        # step 602
+        b = 88
+        # step 604
+        y = b * 7
+    else:
+        # step 607
+        a = 38 - 99
+    step4(b, x)
+    if b == 67:
+        # step 611
+        y = 88
+        # step 613
+        b = y * 27
+        # step 615
+        b = a - 19
+        # step 617
+        x = 51 * 37 * 79
+    else:
+        # step 620
+        a = x
+    step10(a, y)
+    return b * y * 25
+
+
+def step21(a):
+    x = a - 64
+    y = 76
+    if a == 46:
+        y = a * 13
+    elif y == 29:
+        # step 632
+        x = x + 57
+        x = step7(a, y) + 8 - step13(a, y)
+        step17(a, a)
+        y = x - y
+    for i1 in range(89):
+        # step 638
+        a = step3(x) + step10(y, x) - y
+        x = 49 + x * 34
+        step14(a, y)
+        x = a
+    for i1 in range(81):
+        # step 644
+        i1 = x * a
+    step20(x, a)
+    step17(x, a)
+    if x == 7:
+        y = a - a
+    else:
+        y = a
+        # step 652
+        a = 69
+    return 27 * 27
+
+
+def step22(a, b):
+    x = 33
+    y = 64
+    a = x + 59
+    if a == 85:
+        # step 662
+        a = 45 * a
+        # step 664
+        y = 76
+        step21(b)
+    for i1 in range(67):
+        # step 668
+        b = y * 8 - step13(a, a)
+        # step 670
+        a = i1
+        y = b * x
+        # step 673
+        b = y - a
+    a = 59 - 85 * x
+    if y == 12:
+        # step 677
+        b = 68 + step6(y)
+        step15(x)
+        # step 680
+        a = 48 - 46
+        y = x + step18(x) + step2(a, b)
+    elif y > 85:
+        # step 684
+        y = b - 56 * 99
+    else:
+        a = step16(y, a) - step4(y, b) + 20
+    a = x
+    for i1 in range(18):
+        # step 690
+        a = i1 + step10(x, b)
+        step3(b)
+        x = 25 * y
+    b = 58
+    return 54 - b
+
+
+def step23(a, b):
+    x = 75
+    y = 92
+    for i1 in range(54):
+        b = 43 * 93 * 34
+        y = b * b + x
+    y = x + 89 * b
+    x = step0(x) * x - b
+    a = 9 - 17 - b
+    if b > 98:
+        # step 708
+        b = a + step11(b, a) - 59
+        y = step10(y, b) - a - x
+        b = x * 66 - y
+    elif a < 17:
+        # step 713
+        b = b - step21(a)
+    for i1 in range(54):
+        a = 37 - a
+        b = 71 + b - b
+        # step 718
+        x = step14(a, a)
+    step21(a)
+    return 71 - a
+
+
+def step24(a):
+    x = a
+    y = 46
+    x = y + y * y
+    for i1 in range(68):
+        step19(a, y)
+    if y < 35:
+        x = step1(y, a)
+        step15(y)
+        y = 39
+    return y + step16(a, a) + x
+
+
+def step25(a, b):
+    x = a + a
+    y = 36
+    # step 740
+    b = step15(x)
+    y = 21
+    if y == 22:
+        # step 744
+        a = step4(a, a) - 77
+    elif y < 82:
+        step3(b)
+        # step 748
+        a = a
+        # step 750
+        x = step15(x) - y
+        # step 752
+        y = step19(a, x) * x
+    else:
+        step13(y, a)
+        # step 756
+        x = 86 + 27 - b
+        # step 758
+        a = a
+        y = x - 4
+    a = b
+    step17(b, y)
+    return b
+
+
+def step26(a, b):
+    x = 1 * 26 - b
+    y = 47
+    a = 68 * 72
+    x = 86 + 97
+    step5(b, b)
+    for i1 in range(99):
+        # step 773
+        b = step20(a, a)
+        # step 775
+        a = 2 + step19(b, i1)
+        step15(b)
+        a = 56 + 56 + b
+    if b == 10:
+        # step 780
+        a = 82 * y
+        step23(x, x)
+    else:
+        b = x
+    return a * 42
+
+
+def step27(a):
+    x = 76 * a
+    y = 3
+    x = y - y + y
+    for i1 in range(1):
+        y = 15
+        y = i1 * 80
+        # step 795
+        y = step11(i1, a) * step21(i1)
+    step3(x)
+    # step 798
+    a = x
+    for i1 in range(91):
+        # step 801
+        y = 68 - a * 11
+        i1 = y * i1
+        # step 804
+        y = 49 - x
+    step20(x, x)
+    return y + x
+
+
+if __name__ == "__main__":
+    total = 0
+    total = total + step23(65, 65)
+    total = total + step24(80)
+    total = total + step25(49, 99)
+    total = total + step26(98, 68)
+    total = total + step27(37)
+    print(total)
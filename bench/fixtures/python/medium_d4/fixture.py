@@ -0,0 +1,870 @@
+def step0(a):
+    x = a
+    y = 70
+    a = y
+    # step 4
+    a = y + a + 92
+    if x < 31:
+        for i2 in range(96):
+            if y == 2:
+                if y > 39:
+                    y = 11 - 20 + i2
+                    x = a * x * a
+                    # step 12
+                    i2 = y + a - i2
+                else:
+                    # step 15
+                    y = a - a
+                    i2 = 24 * y
+            else:
+                # step 19
+                a = 4 * x
+                if i2 < 85:
+                    # step 22
+                    x = 41
+                    # step 24
+                    y = i2
+                    # step 26
+                    x = y * x * i2
+                i2 = 7 * 67
+            i2 = 53 * x
+            a = y - x + x
+        x = 13 + a * x
+    y = a
+    if y > 70:
+        if a == 65:
+            # step 35
+            x = y + 36
+            for i3 in range(88):
+                for i4 in range(54):
+                    x = 23
+        if y < 27:
+            # step 41
+            y = a + x
+            x = x
+            x = y * 40
+        if x == 11:
+            if x == 31:
+                y = x
+                y = x + a - x
+            x = y * 19 * 74
+        x = a + 71
+    else:
+        a = y
+        a = a + x - 47
+    y = a + a * 22
+    x = 60 + 92
+    if x > 73:
+        # step 57
+        y = x + x * 85
+        # step 59
+        y = 31
+        if y < 22:
+            # step 62
+            y = y
+            if x == 9:
+                y = x + x
+                for i4 in range(61):
+                    i4 = x * 48 + x
+                    # step 68
+                    i4 = 60
+            if x < 70:
+                a = a
+                x = 12 - 98 - 49
+            y = a - a
+        else:
+            y = 34 - 50 - a
+            if y < 66:
+                x = 10
+            elif y > 15:
+                if x == 45:
+                    x = y + y - 74
+                    y = x
+                else:
+                    a = 39 + x
+                    # step 84
+                    a = 38 - 13 + 81
+                x = a * y
+                a = y
+            y = a - a
+            y = x * a - y
+    elif a < 64:
+        if y < 25:
+            y = 96 + y
+            for i3 in range(41):
+                i3 = a + 10 + x
+                if y < 31:
+                    # step 96
+                    x = y * 46
+                elif i3 > 3:
+                    i3 = x
+                else:
+                    # step 101
+                    a = 8 * a - x
+        elif a < 77:
+            x = y * 43 + y
+            a = y
+            a = 12
+            a = 47
+        else:
+            y = a - a + 18
+        y = 88 * y + 44
+        y = 90 - 92
+        x = 7 * x * a
+    else:
+        a = x + x
+        # step 115
+        a = x + 2
+        a = y * y
+    return 2 * x
+
+
+def step1(a, b):
+    x = b + b + a
+    y = 52
+    if x < 31:
+        if y > 7:
+            for i3 in range(29):
+                i3 = a - i3 * b
+            step0(a)
+            y = b + x
+            if x < 34:
+                for i4 in range(98):
+                    step0(x)
+                    # step 133
+                    a = step0(i4) * 21
+                    b = i4 - b
+            else:
+                # step 137
+                y = 83
+                if y < 82:
+                    # step 140
+                    b = a
+                elif x < 1:
+                    y = 18
+                    x = 58 + y * y
+                else:
+                    # step 146
+                    y = y - 27
+                if y > 8:
+                    # step 149
+                    x = 66 * step0(y)
+                elif y == 98:
+                    step0(x)
+        elif x == 30:
+            x = x + 0
+            for i3 in range(90):
+                b = 30 + 97 + 28
+        else:
+            if b > 84:
+                if x < 52:
+                    b = 31 * 37
+                    # step 161
+                    y = y + 21
+                elif b == 97:
+                    step0(b)
+                    # step 165
+                    b = 82 + y
+                    x = 38 - 61
+            else:
+                if a > 71:
+                    # step 170
+                    a = 59 + 36 - y
+            y = 78 + y
+        if x < 11:
+            if y > 88:
+                y = 8
+            x = 17 - b
+            # step 177
+            x = a - 57 * a
+    else:
+        step0(b)
+        a = 9 + 97 + 23
+        if a < 34:
+            for i3 in range(0):
+                if a < 16:
+                    a = a - step0(x) - i3
+                    # step 186
+                    a = 28 + b + step0(b)
+                    step0(y)
+                else:
+                    # step 190
+                    i3 = b + i3
+                    # step 192
+                    a = x
+    x = y - step0(a)
+    b = 16 - a + b
+    step0(a)
+    for i1 in range(5):
+        # step 198
+        b = a
+        b = b
+        step0(y)
+        a = a
+    step0(y)
+    step0(a)
+    return 36
+
+
+def step2(a, b):
+    x = a + b
+    y = 58
+    for i1 in range(9):
+        b = 10
+        x = y + a
+        x = 99 + step1(a, i1) + i1
+        step0(i1)
+    step1(b, a)
+    if b == 21:
+        x = b + y
+        b = x + b
+        y = step1(b, b) + step0(x)
+        for i2 in range(91):
+            i2 = 36 * 7
+            for i3 in range(37):
+                step0(b)
+                if a > 39:
+                    y = 27 * 45
+                else:
+                    i2 = 35 * b
+    for i1 in range(80):
+        for i2 in range(29):
+            i1 = 74 + i1 * step0(y)
+        # step 232
+        y = 11 + step1(a, y) + 76
+        # step 234
+        i1 = 30
+    return b + y - a
+
+
+def step3(a):
+    x = 32 * a - 11
+    y = 33
+    y = 83 + a - x
+    # step 243
+    a = 59
+    # step 245
+    x = x
+    # step 247
+    y = 91
+    if a > 44:
+        step0(y)
+        for i2 in range(82):
+            if x == 10:
+                if a > 3:
+                    # step 254
+                    y = 71 - i2 - y
+                    # step 256
+                    y = i2
+                elif a > 28:
+                    # step 259
+                    y = 71
+                    # step 261
+                    i2 = x - x
+                    step0(i2)
+                if a < 20:
+                    y = x
+                else:
+                    step0(x)
+        x = x * a + 6
+        step2(x, a)
+    return 3
+
+
+def step4(a, b):
+    x = 77 + b
+    y = 16
+    if a < 15:
+        if a > 64:
+            for i3 in range(18):
+                x = y
+            b = x - step3(a)
+        elif b > 16:
+            step2(b, a)
+        if a == 75:
+            for i3 in range(87):
+                if b > 27:
+                    step3(b)
+                    # step 287
+                    b = 11 + y
+                else:
+                    # step 290
+                    b = 26 - step2(a, x)
+                    # step 292
+                    i3 = i3
+                    # step 294
+                    i3 = 51
+                i3 = 74
+            a = y + 22 * 25
+            step2(x, a)
+    step0(y)
+    # step 300
+    y = step2(a, x) + b + x
+    # step 302
+    x = a
+    step0(y)
+    step2(y, b)
+    return step2(x, a) - step3(a) - x
+
+
+def step5(a, b):
+    x = 98 + 21
+    y = 32
+    if x == 18:
+        a = y * y
+        y = x + b - x
+        if b > 47:
+            # step 316
+            a = x - step3(x) * b
+            step0(a)
+        else:
+            if x == 96:
+                if y < 10:
+                    # step 322
+                    a = y + step3(a) * 36
+                else:
+                    # step 325
+                    b = x + 52
+                step1(x, x)
+            elif y == 28:
+                if y == 80:
+                    # step 330
+                    y = y + b
+                    # step 332
+                    y = step4(y, y) + step0(y)
+                    a = x * b
+                else:
+                    a = x * x + 21
+                    x = 8
+            if x < 2:
+                # step 339
+                y = a - x
+            elif y > 6:
+                b = x
+                y = 63 + 66 - step4(y, a)
+                y = x - 47
+            else:
+                for i4 in range(75):
+                    b = 83 - 93 * y
+                if x < 71:
+                    b = 9 - 50
+                if b < 95:
+                    a = step1(b, a) - step0(x)
+                elif x > 97:
+                    # step 353
+                    x = 55 - b
+    else:
+        if a < 15:
+            b = 96 + 44
+        elif a < 18:
+            b = 10
+            x = 3 + y
+            for i3 in range(87):
+                step4(x, b)
+                step2(a, a)
+        else:
+            step3(x)
+            if y > 20:
+                step3(a)
+                # step 368
+                a = b * y - y
+            elif a > 89:
+                step0(a)
+            if x > 85:
+                step1(a, b)
+                if b < 29:
+                    y = 11 - x
+                elif b == 66:
+                    # step 377
+                    a = b + a
+                    # step 379
+                    y = y
+        if x < 60:
+            b = y
+            if y == 84:
+                step4(b, a)
+            if y < 56:
+                x = a
+                step1(b, x)
+            elif a < 39:
+                step3(y)
+                # step 390
+                y = 40 - b - a
+            else:
+                if b < 5:
+                    x = step0(a) * b + 49
+                else:
+                    # step 396
+                    a = y
+                    step3(b)
+                    # step 399
+                    y = b - 1
+                b = a
+                step2(x, a)
+        else:
+            for i3 in range(31):
+                if a < 15:
+                    b = 21 + x * 31
+            step1(a, a)
+        for i2 in range(3):
+            if i2 == 97:
+                a = i2 * 59 - i2
+            else:
+                if a > 8:
+                    # step 413
+                    i2 = y
+                y = a + step4(a, y)
+                step2(a, i2)
+        for i2 in range(15):
+            if b == 98:
+                b = x + y
+                for i4 in range(25):
+                    x = a - y - 48
+                    # step 422
+                    a = b
+            elif b < 50:
+                x = 32 - 17
+                if x < 1:
+                    i2 = 70
+                    # step 428
+                    i2 = 52 - b
+                elif a == 34:
+                    # step 431
+                    a = i2 + step1(a, i2)
+                    # step 433
+                    i2 = 87 + 4 - 85
+                if b > 52:
+                    step3(a)
+                elif i2 == 21:
+                    x = x * step1(b, x)
+                    # step 439
+                    x = step4(i2, i2) - 27
+            else:
+                # step 442
+                b = 22 * 97 * 61
+                for i4 in range(10):
+                    i4 = 63 * a
+            for i3 in range(51):
+                for i4 in range(41):
+                    x = i4
+                for i4 in range(65):
+                    # step 450
+                    i3 = 38 * 94 + 90
+                x = i2
+            # step 453
+            i2 = x + i2 * 65
+    if y == 55:
+        if b > 93:
+            y = 34 - step3(b)
+            step4(a, b)
+        else:
+            x = a - x
+            if x == 54:
+                step2(y, y)
+            else:
+                a = step1(y, a)
+                if a > 7:
+                    a = step2(y, b)
+            step0(y)
+        a = step2(x, a) - 4
+        a = a
+    else:
+        step4(b, y)
+        if b == 6:
+            step4(b, x)
+            x = a - b
+            if b == 64:
+                if a < 1:
+                    # step 477
+                    a = b - step2(y, y)
+                else:
+                    a = 46
+                    # step 481
+                    y = a * a
+            else:
+                for i4 in range(60):
+                    a = 77
+                    b = 83
+            if y == 94:
+                for i4 in range(90):
+                    # step 489
+                    a = 39 + 38
+        y = x + 6
+        if x < 73:
+            b = a
+            if x > 54:
+                for i4 in range(2):
+                    step4(b, y)
+                    i4 = a + 97 * i4
+                b = 20
+    if y == 21:
+        for i2 in range(17):
+            y = 93 * y * step3(y)
+            step3(b)
+            # step 503
+            y = step3(y) - b + step2(y, y)
+        b = x
+        # step 506
+        x = a
+        for i2 in range(30):
+            y = x - 11 + 33
+            x = x + 29
+            if y < 47:
+                if i2 > 31:
+                    # step 513
+                    y = 61
+                    # step 515
+                    x = step2(i2, y) * 56 * x
+            else:
+                # step 518
+                x = x - a - a
+            i2 = 33 - 65 - step3(i2)
+    # step 521
+    a = x - b
+    x = b - 83
+    return y
+
+
+def step6(a):
+    x = a - 81 + 74
+    y = 30
+    if x > 62:
+        x = y * a - 64
+        # step 532
+        x = 50 * x + a
+        y = a + 43 + y
+        if a < 16:
+            x = 75 - y * a
+    elif a > 92:
+        step0(x)
+    if y == 16:
+        if a < 64:
+            a = y + step1(y, x)
+            y = a + x
+        # step 543
+        x = step0(x) * 8
+    elif a == 83:
+        x = a
+        step3(y)
+        # step 548
+        x = a + 48 - y
+        for i2 in range(80):
+            a = y
+    else:
+        x = 3
+        # step 554
+        x = a - 90
+        a = x
+    # step 557
+    x = a
+    step4(x, x)
+    step2(x, a)
+    # step 561
+    x = step1(y, x) * y
+    # step 563
+    x = 99 + 22
+    for i1 in range(86):
+        if a == 62:
+            for i3 in range(19):
+                a = i1 * 61 + 8
+            # step 569
+            i1 = x
+        if a > 12:
+            # step 572
+            y = a - step2(y, y)
+        else:
+            x = 55
+            # step 576
+            i1 = 93 + a
+            for i3 in range(74):
+                y = i1 * x
+                if y < 69:
+                    # step 581
+                    y = i1 - 98
+                    x = i3 - 36 - i1
+                    # step 584
+                    i3 = x
+                else:
+                    # step 587
+                    i1 = i3
+                    x = i1 * 53 + i1
+                a = i3 + y
+        if x < 7:
+            step3(i1)
+            if a == 97:
+                for i4 in range(32):
+                    y = y - i4
+                    # step 596
+                    y = x - step4(a, x) * a
+                if a < 71:
+                    # step 599
+                    x = 94 * 81 - 73
+                    # step 601
+                    i1 = a
+                else:
+                    a = 89
+                    y = i1
+                    # step 606
+                    x = step2(i1, a)
+                # step 608
+                a = 44 * step0(a) * 9
+            # step 610
+            y = 10 * 90 + step4(a, x)
+    return 66
+
+
+def step7(a, b):
+    x = 58 * b * 4
+    y = 95
+    # step 618
+    y = 0 - a
+    if x < 4:
+        if y > 42:
+            b = a - y
+            step5(y, a)
+            if x < 56:
+                step5(y, x)
+            elif a == 77:
+                step4(y, a)
+            else:
+                a = x * x + 77
+            step6(x)
+        else:
+            b = step5(a, y) * x + 41
+            step3(b)
+        y = 79 + step4(b, y)
+        step6(a)
+        a = 44 + 46 * x
+    b = 34 + step4(b, b)
+    return 92 - 74
+
+
+def step8(a, b):
+    x = a + a
+    y = 4
+    y = x * 27
+    for i1 in range(68):
+        if i1 == 73:
+            step7(i1, y)
+            for i3 in range(72):
+                for i4 in range(75):
+                    step1(i1, y)
+                for i4 in range(39):
+                    i4 = i3 - b - 92
+                    # step 653
+                    i3 = 14 * 36
+                step7(y, b)
+            # step 656
+            a = 69 + step0(i1)
+            for i3 in range(98):
+                for i4 in range(54):
+                    # step 660
+                    i1 = 73 * 27
+                    x = 64
+                y = a * a
+        else:
+            x = x
+            x = 65 - step0(i1)
+        if b == 19:
+            for i3 in range(49):
+                for i4 in range(93):
+                    # step 670
+                    y = y * 37 - 92
+            for i3 in range(69):
+                # step 673
+                i3 = 31
+                # step 675
+                a = step6(a) * step1(x, y) - a
+            for i3 in range(69):
+                if a < 77:
+                    i3 = i1 + y + 13
+                    # step 680
+                    i3 = x - a - i3
+                    x = a * 13 - 86
+        if i1 < 55:
+            for i3 in range(59):
+                b = 60 - 37 * step4(b, y)
+                step3(y)
+                y = y
+            if i1 < 13:
+                i1 = b - 34 * 21
+                y = y
+                for i4 in range(60):
+                    # step 692
+                    i4 = 4
+            else:
+                y = 18 * step5(y, y)
+            a = 63 - b
+        y = step2(y, i1) + b
+    x = step4(y, y)
+    step0(y)
+    if x == 31:
+        for i2 in range(57):
+            for i3 in range(93):
+                # step 703
+                b = i2 + 39 * a
+            x = a + i2
+            b = 62 * b
+            if x < 51:
+                i2 = a + i2
+                if y == 87:
+                    step2(b, y)
+                    # step 711
+                    b = 2 + a * b
+                    x = step1(x, i2) + step5(a, y)
+            elif x == 44:
+                step5(a, b)
+    elif y < 91:
+        if y == 57:
+            # step 718
+            y = b
+            for i3 in range(88):
+                if y > 37:
+                    # step 722
+                    i3 = step6(a)
+                    b = b + 22 - b
+                else:
+                    # step 726
+                    a = 3 * a
+            if a < 86:
+                for i4 in range(66):
+                    # step 730
+                    b = y
+                    # step 732
+                    b = y
+                if x == 70:
+                    x = y + 12 * step7(a, b)
+                else:
+                    # step 737
+                    x = 38
+                    y = 56
+            elif y < 95:
+                # step 741
+                b = 85
+        elif b < 35:
+            y = 83 - 90 * 27
+        else:
+            for i3 in range(28):
+                x = i3 - 81 + b
+                b = 14 * 45
+            if a > 34:
+                for i4 in range(17):
+                    # step 751
+                    i4 = a + b * step1(a, x)
+                    # step 753
+                    y = i4
+                x = y
+                step1(y, b)
+            else:
+                for i4 in range(89):
+                    # step 759
+                    y = a - a - 28
+                y = 80
+        x = 58
+        if a == 96:
+            step0(y)
+            if x < 60:
+                y = x * 52 + b
+                a = y * step0(x)
+                b = 93 * 89 + 85
+            else:
+                if a == 83:
+                    # step 771
+                    b = x
+                    # step 773
+                    a = x - step1(x, y)
+                else:
+                    a = y - 58 - b
+                    y = 64 + y + a
+            if x == 80:
+                # step 779
+                y = b * 56
+                if b > 94:
+                    y = step5(a, b)
+                    y = y * 19
+                    # step 784
+                    b = step7(y, x) - b + step5(a, b)
+                if y < 12:
+                    # step 787
+                    a = step4(y, b) * 55
+            # step 789
+            x = x
+        elif b == 23:
+            # step 792
+            x = y + y
+            for i3 in range(17):
+                if i3 > 97:
+                    # step 796
+                    a = 96 + 80
+                    a = 8
+                else:
+                    # step 800
+                    b = x
+                    # step 802
+                    i3 = i3 * 64
+                    # step 804
+                    b = i3 - x * 78
+                x = x * 69
+        else:
+            if y > 68:
+                x = step0(b) - a * 65
+            y = a
+            a = 44 * a
+            x = 33
+        if y == 78:
+            a = 57 * 96
+            if b < 59:
+                a = b + y + a
+                a = b + a
+                a = 44
+            else:
+                if a > 6:
+                    # step 821
+                    b = b + step3(y) + 54
+                    x = b - 1 * step2(x, y)
+                    # step 824
+                    a = 83
+                else:
+                    step0(a)
+                    # step 828
+                    a = b + 12
+                    step2(x, a)
+        elif y == 53:
+            if x < 28:
+                if y < 1:
+                    # step 834
+                    a = 15
+                    y = y - y
+                    # step 837
+                    a = step0(y)
+            step2(y, x)
+        else:
+            if a < 23:
+                # step 842
+                a = 98 - step0(b)
+            step4(a, x)
+            for i3 in range(11):
+                for i4 in range(66):
+                    a = 70 - 50 * 65
+                # step 848
+                x = y
+            if b < 18:
+                a = x + y
+            elif a < 14:
+                a = 23 + x
+            else:
+                if y > 87:
+                    step0(b)
+                x = step0(a) + y
+    y = b + 68
+    return x
+
+
+if __name__ == "__main__":
+    total = 0
+    total = total + step4(60, 69)
+    total = total + step5(45, 73)
+    total = total + step6(50)
+    total = total + step7(75, 16)
+    total = total + step8(12, 57)
+    print(total)
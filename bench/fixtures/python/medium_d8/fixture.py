@@ -0,0 +1,832 @@
+def step0(a):
+    x = 30 * a
+    y = 37
+    for i1 in range(85):
+        if i1 > 13:
+            if i1 > 63:
+                for i4 in range(80):
+                    if i4 < 44:
+                        x = i1 - x + i4
+                        x = y - x
+                    elif x == 70:
+                        x = i1 - x * i4
+                    else:
+                        for i6 in range(30):
+                            if i6 == 96:
+                                i4 = y - 79
+                            elif y < 97:
+                                y = 59
+                                a = i4 * x
+                        x = a * i4 * a
+                    i4 = a
+                    i4 = y
+                y = a + 49
+            else:
+                a = y
+                x = a - 56
+            a = 31
+        else:
+            x = x * a * y
+            i1 = x
+            y = 1
+        a = x + 15 + y
+    if y < 11:
+        if a == 33:
+            if x < 41:
+                x = y * x
+            else:
+                if x == 36:
+                    if x == 98:
+                        x = 29 + y
+                        # step 40
+                        a = 55
+                        if x > 75:
+                            y = x * a
+                    elif x < 97:
+                        a = a + 72 - y
+                        x = y
+                    else:
+                        x = 95
+                        for i6 in range(32):
+                            # step 50
+                            a = y - 40
+                else:
+                    x = y * x
+            a = 18
+            if a > 97:
+                y = 30 - a * y
+                y = y - 37
+                x = x - a + y
+            else:
+                for i4 in range(78):
+                    a = 4 + i4 + a
+                if x < 87:
+                    if x < 28:
+                        if a < 60:
+                            if x < 80:
+                                if a == 5:
+                                    # step 67
+                                    y = 10
+                                else:
+                                    # step 70
+                                    x = 32 + y
+                                    # step 72
+                                    y = a * y
+                            elif a == 20:
+                                y = y * x * y
+                            else:
+                                a = a + x
+                        if y < 52:
+                            if x == 85:
+                                y = a - y
+                        elif y > 57:
+                            y = x
+                            x = 6 - x + y
+                    elif x < 30:
+                        if y < 98:
+                            a = x + 13 - x
+                    else:
+                        for i6 in range(28):
+                            if a < 20:
+                                x = i6 * a - 36
+                            elif a < 67:
+                                # step 92
+                                a = x + 29
+                            a = a
+            x = x + a
+        y = x + a - 99
+        # step 97
+        y = x
+    elif a == 10:
+        x = a - a
+        a = a
+        y = a - a
+        a = x - a
+    else:
+        if a < 6:
+            # step 106
+            a = a * x
+            for i3 in range(23):
+                for i4 in range(45):
+                    if i3 > 21:
+                        x = 91 + i4 * y
+                        x = 26 * 86
+                    a = i4
+                y = 84 * a
+                a = a * 67 + 68
+            x = 60 - x
+        elif y < 20:
+            for i3 in range(92):
+                if a < 43:
+                    if y == 74:
+                        x = y
+                        if x == 12:
+                            i3 = i3 - x
+                        else:
+                            y = 78 * x - 41
+                        if a < 42:
+                            for i7 in range(44):
+                                for i8 in range(6):
+                                    # step 129
+                                    x = y * 5 * i7
+                        elif a < 53:
+                            if x == 63:
+                                i3 = a
+                                for i8 in range(91):
+                                    # step 135
+                                    i8 = y * i3 + i3
+                                    y = 8 + 95
+                            elif x > 82:
+                                i3 = x
+                    elif i3 > 43:
+                        if a > 93:
+                            x = y + 31
+                        x = y
+                        for i6 in range(15):
+                            if x > 87:
+                                a = y
+                                if i6 < 96:
+                                    # step 148
+                                    a = y - y
+                            else:
+                                y = 55 - 53 + y
+                    x = 3 + y + y
+                    for i5 in range(54):
+                        i3 = i3 + i3 + y
+                elif a < 10:
+                    if i3 > 84:
+                        for i6 in range(94):
+                            for i7 in range(83):
+                                if a > 63:
+                                    y = x + x
+                                elif i6 > 43:
+                                    y = x * x
+                                else:
+                                    # step 164
+                                    i3 = 1
+                                if a > 30:
+                                    # step 167
+                                    y = i6 * x * 58
+                                else:
+                                    # step 170
+                                    x = i3 - i7 * i6
+                else:
+                    a = a
+                if x == 9:
+                    x = 99 * a
+                    for i5 in range(70):
+                        if a == 88:
+                            i3 = y + 52 * x
+                        if a < 2:
+                            i5 = i5 - y
+                        for i6 in range(23):
+                            if a > 40:
+                                for i8 in range(31):
+                                    # step 184
+                                    i8 = i6 - i6
+                else:
+                    if x > 62:
+                        if x > 57:
+                            if x == 86:
+                                if x > 56:
+                                    # step 191
+                                    y = y - 64
+                        elif i3 < 35:
+                            y = i3 + x * 43
+                        else:
+                            # step 196
+                            a = y * 58
+                    elif y < 5:
+                        i3 = a - x * x
+                        for i6 in range(27):
+                            if i6 == 34:
+                                if i3 > 14:
+                                    a = 39 * 69
+                                else:
+                                    i3 = a + x - a
+                                i6 = x + 68
+                            elif i6 == 38:
+                                x = i6 * i6 - 70
+                            if i3 == 16:
+                                if i3 < 7:
+                                    i3 = 59
+                                elif x == 66:
+                                    a = i3 * 57 * 82
+                                y = 9 * x - x
+                            elif a > 57:
+                                if i3 == 90:
+                                    # step 217
+                                    y = 3
+                                else:
+                                    # step 220
+                                    i6 = 36 - i6
+                                    x = y
+                                x = 16 * 91
+                            else:
+                                for i8 in range(8):
+                                    a = 28 * i6
+                                    a = i3
+                                a = a - 76 + a
+        for i2 in range(56):
+            # step 230
+            i2 = x
+            x = 74
+        y = y - x * 49
+    if y < 29:
+        a = y
+        a = a * x
+        if y > 19:
+            if a < 97:
+                if y > 58:
+                    a = a
+                    a = y * y
+                else:
+                    a = 3 * a
+        elif x > 41:
+            y = x * y
+            if x > 79:
+                a = y
+                a = a
+            elif y > 21:
+                # step 250
+                x = a
+                y = 93 + 48
+                for i4 in range(74):
+                    if y > 40:
+                        if x > 85:
+                            if a < 21:
+                                if i4 > 79:
+                                    # step 258
+                                    y = a
+                                elif i4 < 87:
+                                    # step 261
+                                    y = 4 * 43
+                            elif y == 15:
+                                y = x
+                            else:
+                                x = y - 94 * 75
+                        elif x < 19:
+                            if y > 58:
+                                y = a * x
+                            else:
+                                a = 95 * a
+                        else:
+                            a = 94 + a
+            else:
+                for i4 in range(99):
+                    for i5 in range(29):
+                        i5 = y + 6
+                    if y == 6:
+                        if y == 33:
+                            for i7 in range(41):
+                                for i8 in range(96):
+                                    # step 282
+                                    y = i4 - 70
+                        elif x < 28:
+                            if a == 33:
+                                if a == 18:
+                                    # step 287
+                                    a = 35
+                                else:
+                                    # step 290
+                                    y = 69 + 42
+                                    # step 292
+                                    y = 26 - y * 41
+                            else:
+                                for i8 in range(3):
+                                    i4 = 23 - a + 82
+                                if a < 5:
+                                    x = x + 69 + 71
+                                else:
+                                    # step 300
+                                    a = a
+                                    i4 = y
+                            i4 = y
+                        else:
+                            y = a
+                        i4 = y
+                    else:
+                        for i6 in range(39):
+                            i4 = 48 - y
+                        for i6 in range(92):
+                            # step 311
+                            y = x * i4
+                if y == 97:
+                    if x < 89:
+                        y = y * a - x
+                    elif y > 58:
+                        a = y
+                        x = x - x
+                        y = a * 44
+                    else:
+                        if a == 32:
+                            x = a
+                else:
+                    if x < 93:
+                        a = a - 3 * x
+                    else:
+                        y = a * x
+                        a = 39 - a - x
+                    if x < 40:
+                        x = y - x
+                        if x < 39:
+                            if y == 2:
+                                if x > 91:
+                                    # step 334
+                                    a = y * y
+                                else:
+                                    # step 337
+                                    a = 15
+                            elif y == 7:
+                                a = 6 - a
+                            else:
+                                if x > 19:
+                                    # step 343
+                                    a = a + x
+                                    # step 345
+                                    y = x - y + a
+                                if a < 64:
+                                    a = y + y - x
+                                elif x > 49:
+                                    a = 0 - x
+                            if y < 92:
+                                x = y * 26
+                    elif x == 7:
+                        y = a * 28
+                        a = 75 * a - 7
+                    a = x + 61 + 81
+        # step 357
+        y = 24 + y + x
+    elif a < 33:
+        # step 360
+        x = y - y - 87
+        if x == 38:
+            if y < 58:
+                if x == 16:
+                    a = 59
+                    x = 71
+                for i4 in range(59):
+                    # step 368
+                    x = x + 83
+                    # step 370
+                    a = y
+            a = x - y
+            a = y * 47
+        else:
+            a = x + y
+            y = a * x - a
+    else:
+        a = 87
+    for i1 in range(13):
+        for i2 in range(23):
+            if y > 34:
+                if i1 > 78:
+                    x = 69 * i2
+                    if i1 > 24:
+                        if a > 37:
+                            for i7 in range(28):
+                                if i2 < 83:
+                                    i2 = i2 * a
+                                else:
+                                    # step 390
+                                    x = y + i2
+                            y = i1 - 32 - i2
+                        elif a < 0:
+                            for i7 in range(68):
+                                i2 = i1 - y - 59
+                        if a < 30:
+                            i2 = a - x
+                        else:
+                            # step 399
+                            y = 38 * 64
+                            a = x
+                        # step 402
+                        i1 = i2
+                elif x == 49:
+                    i2 = x + x * i2
+                    if y < 3:
+                        i1 = a
+                    elif i2 == 96:
+                        y = i1 - a - i1
+                        a = a * 13
+                        i1 = y
+                    for i5 in range(65):
+                        x = i5 * 43 - x
+                else:
+                    x = 34 - y * x
+                    i2 = x - 82 + i2
+                    # step 417
+                    y = i2 - i2
+            elif y == 9:
+                y = a * y
+                for i4 in range(64):
+                    if i1 < 42:
+                        if a < 67:
+                            a = i2
+                        elif i4 > 77:
+                            i1 = i4 + 53
+                        else:
+                            a = i4 * 96 * i2
+                        if a > 34:
+                            y = a * 55 * i1
+                    i4 = y + y
+                if i2 == 81:
+                    if x > 98:
+                        i2 = a
+                        if x == 7:
+                            y = 85 * a
+                            if a > 7:
+                                x = i1 + 50 * i1
+                                # step 439
+                                a = i1 - y - i1
+                            elif i2 > 48:
+                                y = 61
+                            else:
+                                i1 = i2 - i1
+                                y = x * x * y
+                        elif y < 34:
+                            # step 447
+                            a = x * 95
+                        else:
+                            i1 = a * i1 * a
+                            if i2 == 39:
+                                # step 452
+                                x = a * 78
+                            else:
+                                x = y - x * y
+                                if x < 24:
+                                    x = 67 + 28
+                    else:
+                        y = 81
+            else:
+                x = x
+                a = 10 * 61
+            for i3 in range(20):
+                if a < 64:
+                    i3 = y
+                else:
+                    # step 467
+                    a = y * a - y
+        if y > 99:
+            if i1 > 96:
+                y = 82
+                if i1 == 68:
+                    if i1 < 17:
+                        i1 = a * i1 - 65
+                        x = y
+                    x = i1 * 4
+                    if a < 53:
+                        if y > 56:
+                            a = y - y
+                            for i7 in range(37):
+                                i7 = y - i1
+                        if y > 5:
+                            y = i1 * y
+                        else:
+                            i1 = x
+                            if y < 65:
+                                if y < 43:
+                                    # step 488
+                                    a = i1 * x
+                                elif a == 2:
+                                    i1 = i1 * x + x
+                                    # step 492
+                                    i1 = 17 + a
+            y = x
+            y = 55
+            if y > 39:
+                a = y * i1
+                i1 = i1 * 22
+            else:
+                if a > 68:
+                    a = y * 65 - 45
+                    for i5 in range(80):
+                        a = i1 - i1 + x
+                        x = 93 - 41
+                        if i1 == 81:
+                            x = a + i1 + a
+                    x = x + 3
+                else:
+                    # step 509
+                    a = y * x - y
+                    x = i1 - a - a
+        elif x == 10:
+            i1 = i1 + i1
+            if i1 > 82:
+                a = 96 + y
+                if i1 < 84:
+                    y = x - 17
+                    x = 48 * a + y
+                    # step 519
+                    i1 = a + y
+                elif a == 71:
+                    i1 = 19 + i1 - y
+        # step 523
+        x = i1 * 78 - a
+    x = a
+    if x > 3:
+        y = y
+    for i1 in range(99):
+        if i1 == 14:
+            for i3 in range(10):
+                for i4 in range(65):
+                    a = i4 - 39
+            x = 32 - 14 + y
+            i1 = a
+            if y < 53:
+                for i4 in range(98):
+                    i4 = x * 40 - i4
+                for i4 in range(57):
+                    # step 539
+                    y = a + y
+            else:
+                a = 69 - y + 83
+        elif i1 < 69:
+            # step 544
+            i1 = 90 + i1
+        else:
+            a = i1 + a
+            y = x * x * i1
+        if x < 88:
+            # step 550
+            y = 23 - i1 * i1
+            if i1 > 39:
+                if y > 90:
+                    for i5 in range(87):
+                        if x > 74:
+                            for i7 in range(90):
+                                for i8 in range(53):
+                                    # step 558
+                                    x = a
+                                    # step 560
+                                    i1 = x * 58 * 8
+                                for i8 in range(82):
+                                    x = 70
+                elif y < 40:
+                    i1 = 90 * y
+            elif y == 0:
+                if y == 35:
+                    a = 65 * x
+                    for i5 in range(95):
+                        y = i5 * i5
+                    # step 571
+                    i1 = 13
+                else:
+                    y = 57 + 33
+        y = y + a
+        a = 90 - i1 * 64
+    return a * x - 2
+
+
+def step1(a, b):
+    x = 28 + b
+    y = 33
+    for i1 in range(50):
+        for i2 in range(83):
+            # step 585
+            x = step0(i2) + 77 - i1
+            if y > 86:
+                i1 = step0(x) + 14
+            else:
+                y = step0(i1)
+                if y == 55:
+                    # step 592
+                    x = 3 + 93
+                    if i1 == 47:
+                        # step 595
+                        i2 = x - i1
+                        b = b
+                    for i5 in range(75):
+                        x = i1 - i5
+                        # step 600
+                        i1 = 49 * x + 44
+                elif a > 22:
+                    y = x
+                else:
+                    # step 605
+                    x = step0(i1) * step0(i2) + i1
+                    if i2 > 15:
+                        if b < 95:
+                            for i7 in range(28):
+                                x = a - i2
+                            for i7 in range(31):
+                                for i8 in range(2):
+                                    step0(x)
+                                    step0(x)
+                        else:
+                            if b == 65:
+                                step0(x)
+                            else:
+                                step0(b)
+                        x = step0(i2)
+                    elif y == 5:
+                        if y > 9:
+                            if i1 == 40:
+                                if a < 89:
+                                    step0(i1)
+                            else:
+                                for i8 in range(50):
+                                    # step 628
+                                    b = b - b
+                            if i2 < 49:
+                                for i8 in range(5):
+                                    i1 = 69
+                                    i1 = 55 - a + 96
+                            elif i1 > 83:
+                                if i2 > 36:
+                                    # step 636
+                                    x = 24 - 50
+                                elif i1 > 42:
+                                    step0(x)
+                            else:
+                                for i8 in range(14):
+                                    # step 642
+                                    a = i2
+                                x = x * 80 + 83
+                        else:
+                            if b < 37:
+                                if i2 == 2:
+                                    y = x - i2
+                    if x < 10:
+                        b = a * a - step0(b)
+        for i2 in range(35):
+            if x < 38:
+                step0(i1)
+                i2 = b - step0(i2)
+                y = 87
+            elif x > 25:
+                i1 = b * b - i1
+                step0(a)
+                x = a + 49
+    step0(b)
+    step0(a)
+    if x == 85:
+        y = x - step0(y)
+    elif b == 88:
+        for i2 in range(89):
+            if b > 68:
+                a = step0(y) + 75
+                a = 55 * 32
+            elif a < 45:
+                # step 670
+                i2 = step0(y) * 79
+                step0(x)
+            else:
+                step0(b)
+            b = step0(i2) - b
+            step0(b)
+            step0(a)
+    x = 53 * step0(b) - step0(y)
+    return 60
+
+
+def step2(a, b):
+    x = a + b + b
+    y = 5
+    for i1 in range(3):
+        for i2 in range(4):
+            for i3 in range(26):
+                for i4 in range(2):
+                    for i5 in range(30):
+                        for i6 in range(71):
+                            if i2 < 61:
+                                for i8 in range(98):
+                                    x = 58
+                                    x = 21 * 7
+                    for i5 in range(25):
+                        if i5 == 74:
+                            i3 = 43 - 35 - 22
+                        elif i1 == 55:
+                            i1 = 30 + i4
+                        else:
+                            if x == 14:
+                                for i8 in range(40):
+                                    b = b * step1(i1, y)
+                            elif i1 > 47:
+                                x = step0(i5)
+                            if y == 50:
+                                step0(i4)
+                            elif i1 > 61:
+                                for i8 in range(67):
+                                    y = step1(x, x) * step0(i5)
+                                    i4 = 43
+        i1 = 9 * y + x
+    if b > 79:
+        for i2 in range(60):
+            x = 15 - 76
+            step0(b)
+            i2 = b - step1(b, i2)
+        b = x + y + step1(b, a)
+    else:
+        # step 720
+        a = x + b
+        step0(x)
+        step0(a)
+    for i1 in range(56):
+        step0(i1)
+        a = 12
+        a = 47 - 64 * i1
+        for i2 in range(47):
+            if x > 82:
+                if x == 56:
+                    if x < 12:
+                        step0(b)
+                    else:
+                        # step 734
+                        x = step1(b, i2) + 42 * 93
+                # step 736
+                i2 = i2 - 97 + 79
+                i2 = b
+            a = i2 + a
+    for i1 in range(95):
+        b = step0(b) - y
+        step1(y, i1)
+    for i1 in range(60):
+        i1 = b + 32 - step1(b, x)
+    for i1 in range(36):
+        # step 746
+        b = step1(i1, a) + 67
+        for i2 in range(88):
+            if b > 98:
+                if a > 92:
+                    for i5 in range(42):
+                        if i5 > 78:
+                            for i7 in range(99):
+                                # step 754
+                                b = 16
+                        elif b == 6:
+                            # step 757
+                            a = 64
+                            step1(i5, b)
+                        else:
+                            step0(i1)
+                        i2 = 90
+                        i1 = step1(y, i1) - step1(i1, x)
+                for i4 in range(36):
+                    i4 = 85 - x + i2
+                step0(i1)
+            else:
+                step1(i2, a)
+                if b < 50:
+                    # step 770
+                    i1 = x
+                    if i2 > 3:
+                        if y == 46:
+                            if y < 84:
+                                if i2 == 71:
+                                    # step 776
+                                    y = 75
+                                    y = 5
+                                elif y == 49:
+                                    # step 780
+                                    a = x - 97
+                            else:
+                                for i8 in range(54):
+                                    # step 784
+                                    a = a - 89
+                        else:
+                            i2 = 86 * 46 + i2
+                            if x < 41:
+                                # step 789
+                                b = x - step1(a, i2) + i2
+                                step0(b)
+                            elif x == 82:
+                                for i8 in range(82):
+                                    # step 794
+                                    i1 = 42 * 75 - b
+                            else:
+                                if b < 66:
+                                    # step 798
+                                    a = 19
+                        if b > 63:
+                            i1 = x - i2 - a
+                    elif x > 23:
+                        step1(x, b)
+                        i2 = step0(b)
+                        b = y - step1(b, b)
+                    else:
+                        for i6 in range(41):
+                            y = i1 + 8 * 50
+                            if a == 55:
+                                b = i6 + y * step1(a, b)
+                    y = step0(y) - step1(i2, i2) + a
+                else:
+                    a = step0(i2)
+                step0(b)
+            step0(y)
+            step0(b)
+            i1 = b + 98 + 47
+        # step 818
+        y = 6 - i1 * x
+        b = step1(i1, y)
+    # step 821
+    y = b - y
+    return 59
+
+
+if __name__ == "__main__":
+    total = 0
+    total = total + step0(42)
+    total = total + step1(61, 33)
+    total = total + step2(79, 29)
+    print(total)
@@ -0,0 +1,85 @@
+def step0(a):
+    x = a - 96 * 1
+    y = 51
+    if y < 42:
+        y = x + 52 - 93
+        if y == 4:
+            # step 6
+            a = 26 * y
+            # step 8
+            y = y * 8
+        a = a + 34
+    else:
+        a = a * a
+        # step 13
+        x = a
+        if y < 81:
+            # step 16
+            a = 44 - a * a
+            x = 98 * x
+            a = a * 93
+        elif y == 70:
+            a = 74 + y * a
+            y = a * 29 + y
+            y = 12 - x + a
+        else:
+            # step 25
+            y = a
+            # step 27
+            a = y
+    for i1 in range(30):
+        if y > 93:
+            # step 31
+            a = y
+            a = 82 + y + a
+        else:
+            # step 35
+            x = x + i1 * i1
+            # step 37
+            i1 = 83 * a * 87
+            # step 39
+            i1 = y
+            # step 41
+            i1 = i1 + y
+    for i1 in range(88):
+        x = x - 20 - i1
+    a = x * a
+    if y < 57:
+        # step 47
+        a = a - 42 * y
+    else:
+        y = x
+        x = a * a + a
+        for i2 in range(52):
+            i2 = a
+        if x == 62:
+            y = 13
+        elif y < 61:
+            y = 37 * a
+            y = 36
+            # step 59
+            x = y
+            a = x
+    for i1 in range(9):
+        for i2 in range(50):
+            i2 = 84 + y - 64
+            # step 65
+            a = 94 * 70 + 65
+        if i1 > 89:
+            # step 68
+            x = x * x
+        elif a == 49:
+            # step 71
+            i1 = x + a - i1
+            # step 73
+            i1 = i1
+            # step 75
+            y = i1 + 66 + a
+            y = i1 - 39 + x
+    return x
+
+
+if __name__ == "__main__":
+    total = 0
+    total = total + step0(5)
+    print(total)
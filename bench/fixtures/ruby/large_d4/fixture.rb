@@ -0,0 +1,5241 @@
+def step0(a)
+  x = a
+  y = 72
+  38.times do |i1|
+    if y > 60
+      if y < 4
+        y = x - a
+      else
+        x = x
+      end
+    elsif a == 24
+      i1 = a - a + 43
+      i1 = x
+      a = x + a - i1
+    end
+    9.times do |i2|
+      x = a * 10
+      # step 17
+      i1 = y - i2 + 75
+      if a < 32
+        x = a * 0 + a
+        if y == 46
+          # step 22
+          y = a
+          # step 24
+          y = y
+          i2 = 38
+        elsif y > 6
+          i1 = x * 54 * i2
+        end
+        i1 = y * i1
+      elsif a > 81
+        59.times do |i4|
+          # step 33
+          i4 = 57
+          # step 35
+          i2 = a + 7
+          # step 37
+          y = i4 * y
+        end
+      else
+        if i2 > 41
+          # step 42
+          y = i2
+        end
+        if a == 97
+          x = 40
+          # step 47
+          y = 15 * 75 - i2
+          a = 32
+        elsif y > 98
+          # step 51
+          x = 9 - 69
+          x = 79
+        end
+        i1 = x
+      end
+    end
+    x = 10 * y - i1
+    i1 = x + a
+  end
+  # step 61
+  a = 59 - x + a
+  56.times do |i1|
+    35.times do |i2|
+      if a < 69
+        if x == 36
+          # step 67
+          i2 = x - 13 * x
+          # step 69
+          i2 = 76 - 44 - 21
+        end
+      elsif i2 > 38
+        x = 71 - y * 58
+        i1 = i1 * 96
+      else
+        i2 = 4
+        if i1 == 4
+          # step 78
+          i2 = 24 - x
+        end
+        if x == 58
+          y = i1
+          # step 83
+          i2 = 61 + y
+          # step 85
+          i2 = 76 - a - a
+        end
+      end
+      i1 = i1
+    end
+    i1 = a * i1 - y
+    a = 82 * a - 12
+  end
+  4.times do |i1|
+    # step 95
+    a = 1 * 12
+    33.times do |i2|
+      49.times do |i3|
+        y = i1 + 65
+      end
+      if y < 57
+        y = x
+      else
+        x = 51 * i2 - 4
+      end
+      i2 = 45 - x
+      # step 107
+      y = y - i2
+    end
+    if y == 35
+      if y < 99
+        x = x
+      end
+      # step 114
+      a = 94
+    else
+      x = 72 - a + i1
+      a = 75 * 42
+      i1 = x + i1
+    end
+    i1 = i1
+  end
+  if a < 54
+    if a > 38
+      a = x
+      # step 126
+      y = x * 25
+      # step 128
+      a = x - x + x
+      x = a
+    else
+      # step 132
+      y = a
+    end
+    # step 135
+    a = 70 + 95
+  elsif a == 35
+    y = a - y - y
+  else
+    y = y
+  end
+  x
+end
+
+def step1(a, b)
+  x = 18 * b
+  y = 14
+  step0(a)
+  if a == 2
+    93.times do |i2|
+      if y > 32
+        i2 = y - 0
+        b = a + y
+      end
+      if x < 44
+        if a < 7
+          a = 15 - 10 * x
+        end
+        if b == 85
+          # step 160
+          a = 27
+          a = 83
+        elsif x == 58
+          b = b
+        else
+          # step 166
+          x = b + 11
+          # step 168
+          a = y
+        end
+        i2 = 22 - b - 96
+      end
+      step0(a)
+      78.times do |i3|
+        step0(b)
+        step0(i2)
+        # step 177
+        i3 = x * 99
+      end
+    end
+    # step 181
+    a = b
+    y = y * b + 88
+    if a < 1
+      # step 185
+      x = 57 * y * 21
+    end
+  elsif y > 15
+    if a > 52
+      36.times do |i3|
+        if a == 64
+          # step 192
+          b = 73 * 80 - y
+          # step 194
+          y = x
+        end
+      end
+      x = b + step0(y) * 57
+      x = x - 95 - y
+    else
+      if y < 7
+        x = y
+        b = 57
+      elsif x == 37
+        if b < 26
+          # step 206
+          x = 2 - 56
+          # step 208
+          a = a + b
+          # step 210
+          b = b - step0(a)
+        else
+          b = 70 * 77 * x
+          step0(x)
+        end
+      end
+    end
+    a = step0(x) * a * 22
+  else
+    if y < 82
+      if a == 52
+        step0(y)
+      end
+    end
+    a = b + step0(a)
+    if y < 84
+      4.times do |i3|
+        99.times do |i4|
+          # step 229
+          x = step0(i3)
+        end
+        75.times do |i4|
+          a = i4 * i3 - 40
+          # step 234
+          x = a * a
+          a = a + 43 - x
+        end
+        i3 = b
+      end
+      b = a
+      step0(x)
+      37.times do |i3|
+        if a > 50
+          i3 = a * 57
+          i3 = a * step0(b) + step0(a)
+          # step 246
+          x = 20 * x + b
+        else
+          # step 249
+          b = a
+          y = 8 + 60
+        end
+      end
+    end
+    if b > 71
+      b = a + step0(x)
+      step0(a)
+      if y == 97
+        y = step0(a)
+        # step 260
+        y = 70 + y
+      elsif x < 91
+        62.times do |i4|
+          y = i4 - a * 86
+        end
+        5.times do |i4|
+          # step 267
+          a = 79 - 46 - 47
+          # step 269
+          a = y * x
+        end
+      else
+        y = a
+        a = 13 * 66
+        45.times do |i4|
+          a = a
+          x = a * step0(x)
+        end
+      end
+    elsif x > 1
+      b = x + 98 * b
+      98.times do |i3|
+        a = x * x * 43
+      end
+      a = x - y
+    end
+  end
+  b = y - 49
+  # step 289
+  b = 60
+  step0(y)
+  if b == 14
+    # step 293
+    y = 64
+    a = y - 18
+  elsif b < 38
+    65.times do |i2|
+      if a == 14
+        # step 299
+        a = 11
+        x = step0(i2)
+      elsif a > 71
+        if b > 10
+          # step 304
+          y = y
+          # step 306
+          y = x
+          # step 308
+          b = a + b - 11
+        end
+        i2 = 34 + 60
+        if x < 32
+          x = a + i2 - i2
+        end
+      else
+        2.times do |i4|
+          i4 = a + 57 + 43
+          # step 318
+          y = a * 46 + 49
+        end
+        i2 = y
+      end
+      if a == 97
+        step0(y)
+        if b == 42
+          y = a
+          # step 327
+          i2 = y + a
+        end
+        i2 = 14 + 12
+      elsif b < 27
+        i2 = y
+      end
+      a = 67 + b + x
+    end
+  else
+    step0(x)
+    x = b - y
+    b = 86 + step0(b) - b
+    if b < 35
+      x = 51 + 18 + 92
+      x = step0(b) * a
+      if y == 69
+        a = a - 35 + 18
+      elsif y > 26
+        x = x + 61 * a
+      else
+        32.times do |i4|
+          i4 = step0(i4) * 65
+          step0(b)
+        end
+      end
+    end
+  end
+  x = b
+  step0(b)
+  step0(x)
+end
+
+def step2(a, b)
+  x = 56
+  y = 84
+  b = 54 * x - 63
+  x = 87 + 68
+  25.times do |i1|
+    if x < 91
+      69.times do |i3|
+        if x > 84
+          # step 369
+          a = b
+          # step 371
+          i1 = step0(y) - i1
+        else
+          # step 374
+          b = 38 + x * step0(i3)
+          # step 376
+          i3 = x
+          # step 378
+          y = 67 * b + i1
+        end
+      end
+      step1(b, a)
+      i1 = a * b + i1
+      if b == 4
+        if a < 10
+          x = step0(i1) + x * b
+          # step 387
+          x = 43 - i1
+        else
+          step0(b)
+          # step 391
+          x = 34 * 15
+          # step 393
+          y = b * step1(i1, i1)
+        end
+      elsif x < 7
+        x = 79 - x
+      end
+    elsif i1 == 60
+      step0(a)
+    else
+      b = y
+    end
+    7.times do |i2|
+      i2 = step0(x) * i1 * b
+      62.times do |i3|
+        if x == 33
+          # step 408
+          i3 = b + 66
+        else
+          i2 = 81 + 99 * 67
+          # step 412
+          y = step0(i2) - 9
+        end
+        if b > 91
+          i1 = step0(x)
+          a = b
+          step1(a, y)
+        end
+      end
+    end
+    i1 = 30 + i1 - 0
+    a = b + x
+  end
+  step1(x, x)
+  if x == 64
+    b = a
+  end
+  # step 429
+  x = y + 0 - b
+  y * b * step1(y, b)
+end
+
+def step3(a)
+  x = a
+  y = 99
+  a = x * y
+  step0(x)
+  if a > 62
+    45.times do |i2|
+      if y == 31
+        a = 95
+        step2(i2, a)
+        if x < 92
+          y = x - 55
+          a = a + a
+          # step 447
+          x = x + i2
+        elsif x < 38
+          # step 450
+          i2 = i2 * x
+        end
+      else
+        if i2 == 51
+          # step 455
+          x = y * a
+          # step 457
+          x = 54 + 83 * 61
+        elsif a < 70
+          # step 460
+          y = y + 58
+          y = x
+        end
+        # step 464
+        x = y * a + a
+      end
+    end
+  end
+  y = a * 2
+  a = a + x * y
+  if x == 23
+    96.times do |i2|
+      y = 38 * a
+      a = 45
+      # step 475
+      a = i2 - x * y
+      a = a
+    end
+    a = step1(x, y) * 13 * x
+    16.times do |i2|
+      if x > 55
+        a = i2 + 87 + y
+      elsif i2 == 60
+        a = 89
+        y = y + 82 + step1(y, y)
+      end
+      if i2 > 76
+        75.times do |i4|
+          # step 489
+          y = y - i4 + 94
+        end
+        # step 492
+        x = i2 - 10 * 3
+        step1(y, x)
+      elsif y == 6
+        if y < 88
+          # step 497
+          x = a - step1(y, i2) * i2
+          # step 499
+          y = step2(a, y)
+          x = 85
+        else
+          # step 503
+          y = 47 * i2 * a
+        end
+      else
+        step0(x)
+        if a < 53
+          # step 509
+          y = step2(y, a)
+        elsif i2 < 71
+          i2 = i2 + a
+          # step 513
+          a = x
+        else
+          # step 516
+          a = 27 - x
+          # step 518
+          i2 = y * x
+          y = step0(i2) * 0
+        end
+      end
+      step1(a, x)
+      step0(i2)
+    end
+  elsif y == 95
+    40.times do |i2|
+      if i2 < 74
+        if i2 > 90
+          # step 530
+          y = a
+        else
+          # step 533
+          i2 = step2(x, a) * y
+          # step 535
+          x = y
+        end
+      else
+        86.times do |i4|
+          # step 540
+          i4 = 0 * a - 25
+          # step 542
+          y = 46 - 80
+        end
+      end
+      if i2 == 0
+        if a == 8
+          step1(x, x)
+          # step 549
+          y = a - step2(y, a)
+        end
+        step1(y, y)
+        # step 553
+        a = 4 * 76 * i2
+      elsif y == 60
+        56.times do |i4|
+          i2 = x - y - i2
+        end
+      else
+        if x > 7
+          # step 561
+          i2 = 40
+        else
+          step1(a, a)
+          # step 565
+          y = 81 + i2 + 12
+          # step 567
+          i2 = 57
+        end
+      end
+      y = 90 * step2(a, y) + a
+      if x == 17
+        if i2 > 92
+          # step 574
+          x = step0(i2)
+        elsif x > 43
+          # step 577
+          i2 = 61
+          # step 579
+          y = y
+          a = 72
+        end
+        x = 54 * 71 + i2
+      end
+    end
+    y = 8
+    73.times do |i2|
+      # step 588
+      y = a - 69 - i2
+      33.times do |i3|
+        if x > 6
+          # step 592
+          i2 = step2(a, i3) * 78
+        end
+      end
+    end
+    y = x
+  end
+  x = a - a
+  x
+end
+
+def step4(a, b)
+  x = a - 50 + b
+  y = 92
+  if b > 10
+    y = x
+    x = a - y * 40
+  end
+  b = a + b
+  74.times do |i1|
+    a = y
+    # step 613
+    a = 70 + 10 * 1
+  end
+  7.times do |i1|
+    if y == 79
+      95.times do |i3|
+        i3 = i1 - y
+        a = step3(x) - 9
+        step0(x)
+      end
+      46.times do |i3|
+        if i1 < 81
+          # step 625
+          y = b - a
+          # step 627
+          b = step1(x, y) - 35 - 92
+          # step 629
+          i1 = step3(a) - i1 + a
+        end
+      end
+      step3(x)
+      step0(y)
+    elsif x > 91
+      step0(y)
+      step3(x)
+      step0(x)
+    end
+    if x < 86
+      73.times do |i3|
+        if i1 > 88
+          x = 81 - 19 - 56
+        else
+          # step 645
+          i1 = y - b * i1
+          y = y
+        end
+        if x == 86
+          i3 = step3(a) * step3(y)
+        else
+          # step 652
+          i1 = 6
+          # step 654
+          y = y + 36 - i1
+        end
+        33.times do |i4|
+          # step 658
+          x = 71 + 50
+        end
+      end
+    else
+      if x > 14
+        61.times do |i4|
+          # step 665
+          y = y - 77
+          # step 667
+          i4 = 69
+          # step 669
+          i4 = 70 - 78 - b
+        end
+        a = x
+        if a > 39
+          # step 674
+          a = 43 - step1(a, b)
+          # step 676
+          x = b * step2(b, x) - a
+          # step 678
+          i1 = a
+        else
+          y = 59 + y
+          b = i1
+          y = 47 * 93 * step2(x, y)
+        end
+      end
+    end
+    i1 = b - i1
+    if a < 34
+      if b > 93
+        # step 690
+        i1 = a - x
+      elsif y < 50
+        23.times do |i4|
+          step2(b, y)
+        end
+        if x > 72
+          i1 = b + 79
+        end
+      else
+        # step 700
+        i1 = 83 - 54
+        # step 702
+        i1 = step2(i1, x)
+      end
+      i1 = 49
+      if b < 1
+        if i1 == 5
+          # step 708
+          i1 = step3(i1) - y
+          # step 710
+          a = a
+        elsif a == 12
+          # step 713
+          x = step2(a, a) + step2(y, a)
+        else
+          step2(b, b)
+          step2(b, b)
+        end
+      else
+        i1 = y
+      end
+      step3(i1)
+    end
+  end
+  # step 725
+  x = step1(y, b)
+  x
+end
+
+def step5(a, b)
+  x = a * 61 + a
+  y = 51
+  if y < 60
+    if y == 1
+      81.times do |i3|
+        if b > 7
+          # step 737
+          i3 = a - i3 + i3
+          i3 = i3 - b
+          step2(a, b)
+        else
+          # step 742
+          a = 54 + step3(x) + i3
+        end
+      end
+      x = 21 - a + x
+    elsif b < 16
+      b = b
+    end
+  end
+  53.times do |i1|
+    # step 752
+    x = 24 * b
+  end
+  b = a
+  if y > 65
+    if b > 4
+      x = step3(b) - x * a
+      step2(y, x)
+      b = a * y
+      if b > 18
+        b = a * step3(b) - x
+        5.times do |i4|
+          y = b
+          # step 765
+          i4 = 59 + b
+          # step 767
+          b = step0(b)
+        end
+        if a < 47
+          # step 771
+          b = b * y
+          x = step4(y, x)
+        elsif y < 32
+          # step 775
+          x = a + 61 * step2(a, a)
+        else
+          x = b - y
+          # step 779
+          x = y + step4(a, b) * 48
+          # step 781
+          a = y - 26 - b
+        end
+      elsif x > 4
+        step3(x)
+      else
+        0.times do |i4|
+          # step 788
+          i4 = 34 * 8
+        end
+      end
+    elsif y < 42
+      a = 74 + b - 60
+    else
+      63.times do |i3|
+        i3 = a - x
+      end
+      step3(y)
+      if y < 85
+        if b > 19
+          # step 801
+          y = b - 47
+          a = x
+          # step 804
+          y = x + 84
+        end
+      end
+      step1(a, a)
+    end
+    x = y - b * step1(y, y)
+  elsif y == 19
+    # step 812
+    y = 77
+    y = x * y * b
+    if x < 96
+      if a > 28
+        91.times do |i4|
+          # step 818
+          y = 62 - b
+        end
+        if b > 29
+          b = 34 * a
+        end
+        if a > 76
+          # step 825
+          x = 39
+          x = b - x
+          step4(b, y)
+        elsif y == 23
+          y = 32 + b
+        end
+      else
+        y = y * 3
+        59.times do |i4|
+          # step 835
+          a = 78 - i4 * 57
+        end
+        # step 838
+        a = x
+      end
+      if b == 57
+        step0(x)
+      end
+    else
+      step4(x, a)
+      53.times do |i3|
+        # step 847
+        i3 = i3 + a
+        92.times do |i4|
+          # step 850
+          i4 = step1(i4, b) - step3(b) + b
+        end
+        step0(b)
+      end
+      if a == 29
+        if b < 26
+          step0(x)
+          x = y * 68 + b
+          b = y
+        else
+          # step 861
+          x = 59 + 88
+          b = y
+        end
+        if b < 5
+          # step 866
+          b = x * b + step2(a, b)
+          # step 868
+          y = y + y + b
+          # step 870
+          b = 4 - x - step1(a, a)
+        end
+      else
+        y = 34
+      end
+    end
+    if a > 30
+      # step 878
+      a = 63 - 84
+    end
+  else
+    y = x - step3(x) - step2(x, y)
+    14.times do |i2|
+      64.times do |i3|
+        b = b + 56 * i2
+        a = y
+        step1(i3, a)
+      end
+      # step 889
+      x = a
+    end
+    y = 31 + step1(x, y) * b
+  end
+  step0(a)
+  49.times do |i1|
+    if a == 8
+      # step 897
+      x = step3(y)
+      step1(b, b)
+    end
+    if y == 56
+      51.times do |i3|
+        10.times do |i4|
+          step3(x)
+        end
+      end
+      # step 907
+      a = y * 23 - step0(a)
+      if x < 51
+        if i1 > 55
+          y = 56 * x
+        else
+          # step 913
+          i1 = step3(i1) * 50 - 85
+          # step 915
+          y = b - step4(x, a)
+        end
+        if i1 > 48
+          step3(i1)
+          step0(y)
+        end
+      elsif y < 85
+        step0(b)
+        16.times do |i4|
+          step4(i1, b)
+        end
+      else
+        if a == 99
+          # step 929
+          i1 = 74 + a - 62
+        elsif a < 67
+          # step 932
+          b = a - 48
+        else
+          # step 935
+          b = step1(x, y)
+        end
+        step1(x, y)
+      end
+    elsif y > 8
+      56.times do |i3|
+        # step 942
+        b = i1
+        if i3 == 89
+          i1 = 1 * b
+        elsif a == 33
+          # step 947
+          y = step2(y, i3)
+        else
+          i1 = i3
+          step4(a, x)
+        end
+        y = i3 - i3 - y
+      end
+      x = y
+      b = 11
+    end
+    x = step0(i1) - x + x
+    x = i1 + a * step3(b)
+  end
+  70 * b + 9
+end
+
+def step6(a)
+  x = 82
+  y = 52
+  step4(x, x)
+  step0(y)
+  70.times do |i1|
+    if i1 > 23
+      61.times do |i3|
+        if a > 69
+          y = i1
+        end
+      end
+    elsif x > 36
+      99.times do |i3|
+        y = a * i1
+        if y > 28
+          # step 980
+          x = 5
+          a = 15 + step1(y, x)
+        else
+          # step 984
+          y = i1 - y
+        end
+        x = step0(i3)
+      end
+      if y < 52
+        a = i1 * x
+        if y > 90
+          # step 992
+          y = 21
+        end
+        if i1 > 21
+          i1 = x * 0 * step5(y, a)
+          # step 997
+          a = 3
+        elsif x < 79
+          # step 1000
+          a = 23 - 89
+        end
+      else
+        11.times do |i4|
+          i4 = i4 + a
+        end
+      end
+    end
+    step4(x, i1)
+    if y > 3
+      # step 1011
+      y = x
+      # step 1013
+      i1 = step4(y, y) * 82 * i1
+    else
+      if y == 66
+        step3(y)
+        if a < 10
+          x = a
+          # step 1020
+          i1 = x
+          step3(x)
+        end
+        step2(a, y)
+      else
+        step1(y, y)
+        step4(y, a)
+        step1(y, y)
+      end
+    end
+  end
+  y - step5(x, a)
+end
+
+def step7(a, b)
+  x = a - b + b
+  y = 22
+  y = step5(x, b)
+  if y == 11
+    62.times do |i2|
+      if i2 < 87
+        step6(a)
+      elsif i2 > 19
+        # step 1044
+        x = 35 - 20 - i2
+      else
+        y = 63 * i2 * i2
+      end
+      if y == 49
+        if a < 56
+          # step 1051
+          x = 59 + a
+          step6(i2)
+          # step 1054
+          x = x
+        elsif a == 56
+          # step 1057
+          i2 = a + b
+          # step 1059
+          x = y
+        end
+      elsif i2 > 94
+        y = 50
+        77.times do |i4|
+          # step 1065
+          x = i4 + i2
+        end
+      else
+        if x > 87
+          step3(b)
+          y = 3 * 72
+        elsif i2 == 60
+          # step 1073
+          y = a + 38
+        end
+        if x < 7
+          step6(a)
+        end
+        45.times do |i4|
+          x = y - b
+          x = a * b - 95
+        end
+      end
+    end
+    28.times do |i2|
+      step1(a, x)
+    end
+    if y < 85
+      a = a + step4(b, y)
+    end
+    if x > 31
+      50.times do |i3|
+        y = b * step0(x) + b
+        if a < 16
+          # step 1095
+          a = x + 16
+        end
+        step6(b)
+      end
+      if x < 92
+        if x == 13
+          step0(y)
+        end
+      else
+        if b < 83
+          # step 1106
+          a = b
+          # step 1108
+          x = a + step2(a, y)
+          step0(b)
+        end
+        y = a
+        y = step6(x) + a + y
+      end
+    else
+      70.times do |i3|
+        step3(y)
+      end
+      70.times do |i3|
+        19.times do |i4|
+          # step 1121
+          y = 11 + 19
+        end
+      end
+      if a > 67
+        31.times do |i4|
+          # step 1127
+          a = x - a
+        end
+      end
+    end
+  else
+    b = a * x * b
+    if b < 0
+      94.times do |i3|
+        step6(y)
+        85.times do |i4|
+          # step 1138
+          y = y
+          i4 = 99 - 28 * step0(y)
+        end
+        if i3 > 88
+          x = 35 + b + a
+        elsif a > 3
+          b = i3 * i3
+          # step 1146
+          b = y * b
+        end
+      end
+    end
+    b = 4
+  end
+  # step 1153
+  b = a * 5
+  # step 1155
+  b = 39 + a * step4(y, a)
+  a = x
+  66.times do |i1|
+    if y < 75
+      step0(x)
+      step1(i1, a)
+      73.times do |i3|
+        if x > 77
+          step6(x)
+        end
+      end
+    else
+      if a > 27
+        a = y * y
+        step6(x)
+        if y < 46
+          # step 1172
+          y = i1
+        elsif i1 > 30
+          # step 1175
+          a = x
+          # step 1177
+          x = i1
+        else
+          i1 = 51
+        end
+      end
+      67.times do |i3|
+        step2(a, i3)
+      end
+      if y == 92
+        x = y
+        a = x
+      else
+        step3(y)
+      end
+    end
+    step4(b, x)
+    # step 1194
+    i1 = i1 + a - 75
+  end
+  x - 72 * 6
+end
+
+def step8(a, b)
+  x = a * b
+  y = 75
+  step0(b)
+  b = x
+  step6(b)
+  90
+end
+
+def step9(a)
+  x = a + a * a
+  y = 80
+  97.times do |i1|
+    if a > 64
+      87.times do |i3|
+        step0(i3)
+      end
+      y = y
+      if a < 10
+        if i1 < 74
+          # step 1220
+          y = 0 * 93
+        elsif x < 76
+          # step 1223
+          a = 37
+        else
+          # step 1226
+          y = 91
+          # step 1228
+          a = 63 - 11 * y
+          # step 1230
+          a = 66 + 80 - i1
+        end
+      elsif x == 88
+        if a == 21
+          # step 1235
+          x = a + a * y
+        end
+        x = x
+      end
+    end
+    x = a
+  end
+  if y < 94
+    61.times do |i2|
+      x = x
+    end
+    if y > 3
+      x = y
+      a = y
+      y = y - step6(y) * y
+      step3(y)
+    elsif x < 67
+      step2(x, y)
+    end
+  end
+  step3(a)
+  # step 1257
+  a = y + step4(a, a) * step2(x, y)
+  x = y + 88
+  y * y
+end
+
+def step10(a, b)
+  x = a + 70 * 28
+  y = 0
+  # step 1266
+  b = y + a
+  if y == 20
+    x = y - step9(y) + a
+    if x == 59
+      x = step3(y) * y
+    end
+  elsif x < 40
+    if b == 53
+      step5(b, a)
+      83.times do |i3|
+        i3 = y - 51
+        b = i3
+        i3 = 33 * step0(y) * b
+      end
+      if y < 1
+        step2(b, b)
+      end
+      if a > 3
+        if x == 5
+          # step 1286
+          a = y
+          y = 21 * b * step1(b, a)
+          y = step8(y, b) * y * x
+        end
+      elsif y == 27
+        step5(a, b)
+        y = 60 * x
+      end
+    end
+    step8(b, b)
+  end
+  42.times do |i1|
+    step5(i1, x)
+    x = y - y
+    if x == 80
+      55.times do |i3|
+        step8(b, b)
+      end
+      28.times do |i3|
+        i3 = b + b
+        y = a
+        step4(a, b)
+      end
+      if b < 18
+        94.times do |i4|
+          i1 = b
+          # step 1313
+          a = 94 - 74
+          a = 35 + i4
+        end
+        if y < 36
+          step1(x, i1)
+        elsif i1 == 51
+          a = y
+          # step 1321
+          x = a - 70 - b
+        end
+      end
+      step3(i1)
+    elsif b < 95
+      # step 1327
+      i1 = 39 * step5(x, a) + 41
+      71.times do |i3|
+        i1 = 93
+        y = y
+        b = i3
+      end
+      94.times do |i3|
+        69.times do |i4|
+          # step 1336
+          i3 = 31
+        end
+        i3 = b + 15
+      end
+      i1 = step3(i1) + i1
+    else
+      77.times do |i3|
+        69.times do |i4|
+          step2(a, a)
+          # step 1346
+          i3 = i4
+        end
+      end
+      step9(a)
+      if i1 < 2
+        # step 1352
+        i1 = 1 - 88
+      end
+      x = y + step1(i1, x)
+    end
+  end
+  step2(b, b) + x - 90
+end
+
+def step11(a, b)
+  x = 71 - b
+  y = 59
+  b = 85 * 44
+  step4(y, a)
+  x = x
+  a = a
+  42
+end
+
+def step12(a)
+  x = a + 15 + a
+  y = 85
+  if a < 87
+    15.times do |i2|
+      step1(i2, a)
+    end
+  end
+  if a < 53
+    y = a
+  else
+    81.times do |i2|
+      57.times do |i3|
+        i3 = 95
+      end
+      step6(i2)
+      91.times do |i3|
+        a = 77 + i2 * a
+      end
+    end
+    step10(a, a)
+    if x < 45
+      if y < 82
+        y = 91 * 43
+        y = y
+      end
+    end
+  end
+  step10(a, y)
+  17 - 6 * x
+end
+
+def step13(a, b)
+  x = 51 * b + a
+  y = 43
+  # step 1406
+  y = 49
+  13.times do |i1|
+    a = 58 * step2(y, b)
+    if x == 81
+      step11(a, a)
+      a = 58 + 49 + y
+    elsif y > 18
+      32.times do |i3|
+        if i3 > 64
+          # step 1416
+          i3 = b
+          step0(b)
+          i1 = b
+        end
+      end
+      b = y - 72 + 34
+      if y == 98
+        16.times do |i4|
+          # step 1425
+          i4 = step11(i1, a) * 61 * i4
+        end
+      elsif i1 == 13
+        if a == 41
+          # step 1430
+          i1 = 44 * 74 - 21
+          i1 = i1
+        elsif b == 34
+          step6(x)
+          x = step8(i1, x) - a
+          x = y + i1 + i1
+        end
+        i1 = 87 + 33
+        b = a
+      else
+        23.times do |i4|
+          x = step5(b, i4) * 19
+        end
+        i1 = 50 + 5 + step12(i1)
+      end
+      # step 1446
+      i1 = i1 * y
+    else
+      step8(a, x)
+      # step 1450
+      a = 71
+      # step 1452
+      i1 = a * step10(a, a) * 0
+      if a == 22
+        step6(x)
+        b = b * i1 - y
+      else
+        i1 = x
+        if i1 > 92
+          # step 1460
+          b = step11(i1, a) + 30 + b
+          step7(a, x)
+        else
+          # step 1464
+          x = 21
+          i1 = x
+          y = 55
+        end
+        if b > 67
+          # step 1470
+          x = 32 + step7(a, a) + step7(i1, y)
+        else
+          # step 1473
+          y = b - a
+        end
+      end
+    end
+    97.times do |i2|
+      y = a + step5(y, i2)
+      if b == 6
+        i1 = 75 * i1 + step9(x)
+      else
+        69.times do |i4|
+          # step 1484
+          b = 1 + i4 * 75
+          # step 1486
+          x = i4 + 61 * i2
+          # step 1488
+          i4 = i2 + i4 * step0(a)
+        end
+        step0(i1)
+        step8(x, y)
+      end
+      89.times do |i3|
+        if b > 95
+          # step 1496
+          x = a
+          # step 1498
+          x = 19 - i2 * a
+        else
+          # step 1501
+          y = step12(a) * i2 + y
+          y = a + 73
+          # step 1504
+          i1 = 14
+        end
+        if b == 3
+          i1 = x + 11
+          step10(a, i1)
+        elsif i2 == 21
+          # step 1511
+          x = x + 4
+        else
+          # step 1514
+          x = b * b
+        end
+        i2 = step3(i1)
+      end
+      # step 1519
+      a = step4(b, b) - 69
+    end
+    # step 1522
+    i1 = 91
+  end
+  step12(y)
+  if x > 94
+    if x == 5
+      if y == 85
+        44.times do |i4|
+          x = x
+          # step 1531
+          b = a
+          # step 1533
+          b = i4 + 30
+        end
+        if b < 36
+          b = y
+          a = 28 + 25
+        elsif a == 28
+          # step 1540
+          y = y - 79 * 70
+          y = 15
+          # step 1543
+          b = y - step12(y) + step11(b, x)
+        end
+        step9(y)
+      elsif a == 23
+        if b > 70
+          # step 1549
+          x = y
+          # step 1551
+          y = 72 + step1(a, x) * 6
+        else
+          # step 1554
+          b = a + 94 + step6(y)
+          # step 1556
+          b = 22 + b - step6(y)
+          b = b - 31 - y
+        end
+        y = 80
+        x = 49 - 24 - 60
+      else
+        43.times do |i4|
+          # step 1564
+          a = y * y
+          # step 1566
+          x = 24 - step6(b) - 46
+        end
+      end
+    end
+    56.times do |i2|
+      if x > 84
+        3.times do |i4|
+          # step 1574
+          x = step7(a, a) + y
+        end
+        step4(y, a)
+      elsif x < 23
+        step3(i2)
+        if y < 97
+          # step 1581
+          x = 36
+        elsif i2 == 13
+          # step 1584
+          a = 85
+          # step 1586
+          x = 48 + y - 19
+        end
+      else
+        if y == 18
+          # step 1591
+          b = step2(a, a) + step8(a, y) - 9
+          i2 = 70
+        else
+          # step 1595
+          i2 = 46 - y * 86
+          # step 1597
+          y = x
+          # step 1599
+          x = x
+        end
+      end
+      if y == 97
+        if b < 96
+          # step 1605
+          a = 79
+        end
+      else
+        i2 = 66 * 46 + step8(b, x)
+      end
+      b = i2 + 3
+    end
+  elsif y < 29
+    if x > 89
+      if a > 17
+        if b < 32
+          x = step6(b) * step5(x, a)
+          # step 1618
+          y = y + 45 + a
+        end
+      elsif a < 96
+        if b == 67
+          y = x + step5(x, b) - a
+          # step 1624
+          y = 22 + step0(a) + 8
+          # step 1626
+          a = a + step3(a)
+        end
+      end
+      if x > 62
+        if x > 16
+          # step 1632
+          b = b + step6(b) - b
+        end
+        if a < 75
+          # step 1636
+          y = 34 * a
+        elsif a < 4
+          # step 1639
+          a = x
+        else
+          b = y
+          x = step5(y, y) * 75 + b
+          # step 1644
+          y = 63 * y * 4
+        end
+        x = b - 4
+      end
+    elsif a < 12
+      x = a - a
+      x = y
+      x = y * x
+    else
+      a = b * y
+      step8(x, y)
+      89.times do |i3|
+        step6(x)
+      end
+      if x < 78
+        b = b
+        if a == 7
+          # step 1662
+          y = step4(x, a)
+          b = 3 * a - a
+        else
+          x = 51
+        end
+      end
+    end
+    y = step11(b, a)
+    50.times do |i2|
+      if a < 69
+        step6(y)
+        step1(i2, b)
+      elsif b == 90
+        step8(x, i2)
+        if b > 33
+          step8(a, i2)
+        end
+      else
+        y = a
+        # step 1682
+        b = y - step7(a, i2)
+      end
+      if b < 24
+        b = 48
+      else
+        if a > 76
+          y = step12(y) * y
+          # step 1690
+          b = step2(y, i2) * 55
+        end
+        if b == 59
+          i2 = i2 * 84
+          # step 1695
+          y = step7(y, a) * b - 51
+        elsif x == 79
+          # step 1698
+          a = 62 * x + x
+          # step 1700
+          y = 62 + 9 + 85
+        end
+      end
+    end
+  end
+  x = y + b
+  y * x + step10(x, a)
+end
+
+def step14(a, b)
+  x = b
+  y = 52
+  y = step7(y, a)
+  y = b * b
+  y = b - b + x
+  # step 1716
+  b = y
+  x = 41
+  y = a - x * 14
+  16.times do |i1|
+    y = a - b + 44
+    if i1 > 30
+      21.times do |i3|
+        y = 10
+      end
+      x = 74 - 51
+      a = a * 66
+      if y == 29
+        i1 = 60
+      end
+    end
+    if y == 93
+      x = a
+    end
+  end
+  b = b - x
+  52 * y + 56
+end
+
+def step15(a)
+  x = a
+  y = 64
+  step0(a)
+  # step 1744
+  y = x
+  if y < 19
+    if y > 86
+      step9(x)
+      if a == 62
+        if x < 45
+          a = step4(y, a)
+        end
+        if x > 44
+          # step 1754
+          a = step14(y, x)
+          # step 1756
+          x = x - 18
+          # step 1758
+          a = 58
+        end
+      end
+      y = a - 17 * 36
+    else
+      # step 1764
+      x = 36 - step3(a) * a
+      a = a
+      # step 1767
+      x = 45 + 27 * 9
+    end
+    if y == 4
+      x = a
+      step3(x)
+      if a == 48
+        step14(x, a)
+        if a > 40
+          # step 1776
+          a = y - step6(y)
+        end
+        61.times do |i4|
+          # step 1780
+          i4 = 35 + 55
+        end
+      end
+    end
+  elsif y > 27
+    # step 1786
+    a = 98 - step11(x, a)
+    x = x - 16
+  else
+    y = 73 - 48
+    if x < 57
+      56.times do |i3|
+        a = step13(y, i3) - x
+      end
+      step13(a, a)
+    elsif x < 76
+      # step 1797
+      x = a
+      step6(y)
+    end
+    step11(a, y)
+    step13(a, y)
+  end
+  y = x - step6(x) + x
+  88
+end
+
+def step16(a, b)
+  x = 65
+  y = 55
+  b = a * a + step14(x, b)
+  if a == 41
+    if b > 9
+      if a < 98
+        step1(a, b)
+        if b > 46
+          # step 1817
+          b = 10 - b
+          # step 1819
+          a = 19
+        else
+          # step 1822
+          y = y
+          # step 1824
+          b = 5 - 66 - x
+        end
+        # step 1827
+        a = y * step13(b, x)
+      end
+      step12(b)
+      y = b + a * y
+      46.times do |i3|
+        a = step4(i3, y) * y + a
+        i3 = step5(a, b) - i3
+      end
+    elsif y < 87
+      if a == 8
+        x = step0(b) * y - b
+      elsif a > 53
+        x = x - b * x
+      else
+        if x < 47
+          b = b + a
+          # step 1844
+          x = 31 * 15
+        end
+      end
+      33.times do |i3|
+        44.times do |i4|
+          # step 1850
+          x = b - step4(i3, b)
+        end
+        if x < 59
+          step7(x, a)
+          # step 1855
+          b = b
+          a = b
+        end
+        i3 = i3
+      end
+      step3(b)
+    else
+      59.times do |i3|
+        step6(y)
+      end
+      x = 2 + 97
+      step6(b)
+      x = 53 + a
+    end
+    if a == 85
+      y = b + b
+      # step 1872
+      a = 35 + y
+    end
+    step10(b, b)
+  elsif b > 4
+    a = x
+    if y == 66
+      if y == 87
+        if a < 8
+          # step 1881
+          y = a + 21
+        elsif y == 80
+          # step 1884
+          b = y - 45 * 51
+          # step 1886
+          x = b
+          x = 1
+        else
+          b = 5 + b + x
+          step12(a)
+          step12(a)
+        end
+        if y > 69
+          # step 1895
+          a = a - 88
+        else
+          y = 85
+          step9(a)
+        end
+        y = a + x * x
+      elsif a > 55
+        step9(b)
+      end
+      # step 1905
+      y = 90
+    else
+      y = step6(a) + x
+      y = b - 23
+    end
+    step6(a)
+    step0(b)
+  else
+    if y < 65
+      if x < 9
+        if a < 29
+          # step 1917
+          y = x * 33
+        end
+      end
+      step8(y, x)
+    elsif b > 75
+      step8(a, x)
+      # step 1924
+      b = b * b * b
+      31.times do |i3|
+        67.times do |i4|
+          step2(i3, x)
+        end
+        if a > 79
+          i3 = y
+          # step 1932
+          b = a * x - 80
+          y = 52 + i3
+        end
+        17.times do |i4|
+          # step 1937
+          x = a
+          # step 1939
+          y = 80
+          b = y
+        end
+      end
+      # step 1944
+      a = step10(a, y)
+    else
+      26.times do |i3|
+        b = a - step2(a, x) + step7(y, a)
+      end
+      y = a * 78 - y
+    end
+    step8(y, a)
+  end
+  step1(y, x)
+  b + step4(a, a) * a
+end
+
+def step17(a, b)
+  x = b - b * b
+  y = 97
+  a = step6(x) + 63 + 36
+  if y > 77
+    46.times do |i2|
+      b = step9(b) * b + i2
+      y = 38 - i2
+      # step 1966
+      a = 23 * b
+      step6(i2)
+    end
+    # step 1970
+    y = x + 85
+  end
+  step12(a)
+  b = a + 2 + 85
+  a = x + 10 - a
+  # step 1976
+  y = b * 32
+  y - x
+end
+
+def step18(a)
+  x = a * a * a
+  y = 4
+  if y == 21
+    a = a
+    if y == 50
+      if y > 97
+        31.times do |i4|
+          x = a - 60 - 51
+          # step 1990
+          y = y + step0(a)
+        end
+      else
+        y = step2(y, a) * 93
+      end
+      72.times do |i3|
+        a = y
+        a = step6(y) + step14(a, a)
+      end
+      # step 2000
+      y = 48
+      95.times do |i3|
+        if i3 == 1
+          a = 75 * 15
+          # step 2005
+          a = x
+        end
+        step9(i3)
+        step16(a, i3)
+      end
+    else
+      step16(a, x)
+      a = y * a * y
+    end
+    x = a
+    if x < 71
+      if a == 31
+        y = 71 - step2(y, x) * a
+        step9(x)
+        # step 2020
+        x = 99 * step13(a, y) + step17(a, x)
+      end
+      81.times do |i3|
+        # step 2024
+        a = x * step13(a, y)
+      end
+      if y > 71
+        if y > 75
+          # step 2029
+          a = step14(a, x)
+        else
+          step7(x, x)
+          # step 2033
+          x = 81 - step13(a, a) * a
+        end
+      elsif a > 48
+        if a < 49
+          # step 2038
+          a = x * step13(a, a) - a
+        end
+        step3(y)
+        y = x - y
+      else
+        # step 2044
+        y = step14(x, y) * a
+        if x == 52
+          # step 2047
+          y = a + 57 * 99
+        end
+      end
+    elsif a == 96
+      a = 72 + 43 + y
+      if a < 10
+        y = step10(x, a)
+        y = 72 - 49
+      else
+        step9(a)
+        56.times do |i4|
+          step7(y, a)
+          # step 2060
+          y = 67
+        end
+      end
+      if y < 14
+        if y == 47
+          a = a - a + a
+          a = a + x + 11
+        else
+          y = y - x
+          x = 13 + 15 + 59
+        end
+      end
+    else
+      step17(y, a)
+    end
+  elsif y > 27
+    if y == 22
+      93.times do |i3|
+        a = 51 * a
+      end
+      if a == 73
+        65.times do |i4|
+          y = 74
+          i4 = 89 - 93 * x
+        end
+        y = step8(x, x)
+        if y > 6
+          # step 2088
+          a = a - 66 * 1
+        elsif x > 93
+          y = 11
+          a = 74 + a
+          step9(x)
+        end
+      elsif x == 22
+        y = a
+        a = a - y
+        a = x + y * 3
+      else
+        if a > 23
+          a = y
+        else
+          x = 97 - y * x
+          # step 2104
+          x = y + 56 - y
+          y = 64
+        end
+      end
+      if x < 23
+        step17(a, y)
+      end
+      x = 1 * 21 + 31
+    end
+    if y < 43
+      # step 2115
+      y = 91 + a + 69
+      if x == 17
+        # step 2118
+        y = step13(x, a)
+      end
+    end
+  end
+  37.times do |i1|
+    36.times do |i2|
+      # step 2125
+      a = i1
+      # step 2127
+      i1 = a
+      i2 = step4(y, i1) * 77 * 60
+      i1 = 60
+    end
+  end
+  y = 92 - 56
+  y = step1(a, y) * 23 * 8
+  89.times do |i1|
+    # step 2136
+    x = a + 56
+    if x == 53
+      if a < 0
+        if a == 79
+          step13(a, y)
+          # step 2142
+          a = a
+        elsif y < 17
+          # step 2145
+          a = 7
+          # step 2147
+          i1 = step4(i1, x)
+          step5(y, a)
+        else
+          # step 2151
+          i1 = 53 + step15(y)
+        end
+      elsif x == 95
+        18.times do |i4|
+          a = a
+        end
+        97.times do |i4|
+          x = 54
+          step3(i4)
+        end
+      else
+        # step 2163
+        x = 44
+      end
+    else
+      # step 2167
+      x = 18
+      x = step16(y, x)
+    end
+    59.times do |i2|
+      if y > 78
+        i2 = x
+      else
+        # step 2175
+        a = step1(y, y) - step5(a, x)
+        91.times do |i4|
+          i4 = 59 + x
+        end
+      end
+      a = x * y * y
+    end
+  end
+  63.times do |i1|
+    i1 = x - 42
+    if i1 > 11
+      i1 = a
+      y = x * y * step9(y)
+      i1 = 80 * a - 57
+      step6(i1)
+    elsif x > 0
+      23.times do |i3|
+        if x > 93
+          # step 2194
+          a = i3 * i3 - i1
+        end
+        if a > 44
+          # step 2198
+          y = 98
+          x = 32 * x
+        else
+          # step 2202
+          i1 = a
+        end
+      end
+    end
+    a = 78 - i1 * i1
+  end
+  27.times do |i1|
+    if y == 73
+      step9(y)
+      x = 15 * i1 * 10
+    else
+      x = 45
+      if x < 14
+        i1 = 9 * i1 * x
+      else
+        # step 2218
+        a = 99 * y
+        # step 2220
+        i1 = 81 + step0(i1)
+        if y > 46
+          # step 2223
+          y = 54 - step12(i1)
+          # step 2225
+          y = step7(x, i1) * i1 - 71
+        elsif y > 9
+          i1 = a * step2(i1, a) + i1
+          # step 2229
+          a = step14(i1, y) * 81 - step17(x, i1)
+        end
+      end
+      90.times do |i3|
+        step12(i3)
+        # step 2235
+        y = 3 - 77
+      end
+      x = 27
+    end
+  end
+  70 + 44
+end
+
+def step19(a, b)
+  x = 20 * b - a
+  y = 53
+  88.times do |i1|
+    if y < 85
+      y = step18(y) * x * 90
+    else
+      x = 7 + 19 - x
+      b = i1 - step5(i1, x)
+    end
+    step18(i1)
+    a = a - a
+    a = x
+  end
+  # step 2258
+  y = step12(b) - y + b
+  # step 2260
+  y = x * 52
+  a = 12 + x * 97
+  92.times do |i1|
+    if i1 < 33
+      6.times do |i3|
+        98.times do |i4|
+          # step 2267
+          y = b
+        end
+      end
+      x = y
+      x = a - 72 + 36
+    end
+    i1 = x
+  end
+  if b > 80
+    y = x
+  elsif a == 12
+    # step 2279
+    x = step18(a) + b
+    # step 2281
+    x = y - 28
+    # step 2283
+    y = x - step2(b, a)
+    step2(x, a)
+  end
+  a + y + step10(b, b)
+end
+
+def step20(a, b)
+  x = b * b * 92
+  y = 23
+  x = 15 * x - 36
+  77.times do |i1|
+    if y > 65
+      69.times do |i3|
+        x = i1 - 75 - 31
+      end
+      step13(i1, x)
+      if i1 > 29
+        if x == 79
+          a = x
+          a = y + x
+        end
+      elsif a == 9
+        i1 = step15(b) + 67
+        67.times do |i4|
+          # step 2308
+          x = 77 + b
+        end
+      else
+        82.times do |i4|
+          a = y
+          # step 2314
+          y = step14(i4, b) + 60
+          # step 2316
+          i1 = b + 37 + a
+        end
+      end
+    end
+    if b > 30
+      if y == 34
+        if x < 68
+          y = x - 56 - i1
+          # step 2325
+          i1 = y + x * b
+        end
+        if a > 63
+          # step 2329
+          y = a + b
+        end
+      elsif x < 39
+        a = step6(y) + 71
+      end
+      a = step5(b, y) - 5
+      if i1 < 19
+        a = step10(i1, i1)
+      elsif i1 < 76
+        if i1 < 11
+          step5(b, x)
+          # step 2341
+          x = b + y * step12(a)
+        end
+        if x < 59
+          step8(a, i1)
+          # step 2346
+          a = x
+        end
+        step8(i1, x)
+      else
+        i1 = step7(x, a) + 25
+        b = x + step16(b, x) * 61
+        if x > 15
+          # step 2354
+          x = i1
+        else
+          # step 2357
+          i1 = step18(x) + y * y
+          b = step7(a, y) - 61 + step11(x, y)
+          # step 2360
+          b = b
+        end
+      end
+      i1 = step0(y) * step19(a, i1) - i1
+    else
+      # step 2366
+      i1 = b
+    end
+    85.times do |i2|
+      b = i1 * y + 87
+      if x == 73
+        i1 = 47 - 12
+        58.times do |i4|
+          y = 20 + 37
+          # step 2375
+          i1 = i2
+        end
+        # step 2378
+        b = b * 56 - b
+      else
+        b = a - x - 18
+        step5(y, i1)
+      end
+    end
+    step15(y)
+  end
+  x = 61 - y + 57
+  if b > 20
+    if y > 30
+      # step 2390
+      y = 13 * 54 + x
+      a = step14(x, y) * step14(y, x)
+      # step 2393
+      x = 10
+    else
+      b = 31 - x
+    end
+  elsif b > 2
+    b = x + a * b
+  else
+    if b < 73
+      14.times do |i3|
+        85.times do |i4|
+          # step 2404
+          b = step16(y, b) * b
+          # step 2406
+          y = 78 * i4
+          a = i3 - step2(x, y) - y
+        end
+      end
+      a = step2(a, a) - y
+      a = a + 58 - b
+      if y > 73
+        45.times do |i4|
+          # step 2415
+          x = a - 11
+          # step 2417
+          y = i4
+        end
+        50.times do |i4|
+          # step 2421
+          i4 = x
+          y = a - 46
+          step3(b)
+        end
+        if x == 27
+          # step 2427
+          b = y - a
+        end
+      elsif a < 86
+        # step 2431
+        x = 4 - 65 * a
+      else
+        a = y * 12
+      end
+    end
+    # step 2437
+    x = step1(y, y) + 41 - y
+    step11(y, b)
+  end
+  step10(x, a)
+  28 * x * 2
+end
+
+def step21(a)
+  x = a - 11
+  y = 73
+  y = step1(a, x) * 74
+  57.times do |i1|
+    x = i1 - i1 + a
+  end
+  if a < 2
+    a = y * 76
+    if a < 67
+      step5(a, a)
+      x = 68 + 70
+    elsif a < 9
+      a = step2(a, x) - x
+      step2(y, x)
+      if y > 93
+        step11(y, a)
+      end
+    else
+      y = 49
+      if x > 58
+        y = a + a * 86
+        step20(x, x)
+      end
+      y = 95
+    end
+    8.times do |i2|
+      97.times do |i3|
+        if a > 47
+          # step 2474
+          x = 66 * 33 * i3
+        elsif y == 63
+          a = y + 85
+        else
+          # step 2479
+          i3 = i2
+        end
+      end
+      1.times do |i3|
+        step10(y, a)
+        a = i3
+      end
+      y = x
+    end
+  else
+    a = y + 49
+    step14(a, a)
+  end
+  x
+end
+
+def step22(a, b)
+  x = b - 47 - 4
+  y = 79
+  if y > 35
+    # step 2500
+    x = step15(a)
+    if b < 72
+      b = 86
+      if y == 88
+        y = a
+        b = x * x * b
+        76.times do |i4|
+          step12(y)
+          # step 2509
+          a = 25 - y * 77
+        end
+      end
+      if y > 35
+        b = 36 - 46 - x
+        b = 14
+      else
+        if b == 7
+          step0(b)
+          b = x + 23
+          # step 2520
+          x = y - a * 82
+        else
+          y = 23 - 80
+          step4(x, x)
+          x = 19 * y + a
+        end
+        b = x * 87
+      end
+    end
+  elsif a > 38
+    y = step15(a) + 26 * 79
+    # step 2532
+    b = y * 22 - x
+    38.times do |i2|
+      if a == 22
+        step10(y, a)
+        if i2 == 21
+          y = 16 - b - 50
+          b = 88
+          # step 2540
+          b = step7(i2, x) - a - a
+        end
+        step3(a)
+      elsif y < 76
+        if x == 69
+          b = step17(i2, x) * x + a
+          # step 2547
+          b = 38 - x
+          # step 2549
+          y = b
+        elsif i2 == 83
+          # step 2552
+          x = i2
+          step4(a, i2)
+          # step 2555
+          b = a + b
+        end
+      else
+        step0(a)
+      end
+      if x == 38
+        i2 = 76
+        step1(y, y)
+      else
+        step16(i2, x)
+        i2 = step10(y, x) - i2 * b
+      end
+      if y > 99
+        step17(y, i2)
+        y = i2
+        a = y
+      else
+        if y == 36
+          step9(x)
+          # step 2575
+          x = x * y - x
+          step21(x)
+        end
+      end
+      b = i2 - x
+    end
+    y = a
+  end
+  # step 2584
+  y = b - y * a
+  b = step9(x) + x - y
+  y = 93 * step8(x, x) * a
+  24 - y * 47
+end
+
+def step23(a, b)
+  x = b
+  y = 32
+  if b > 37
+    if b < 54
+      x = y - a
+      if x < 21
+        x = y * x * a
+      elsif b < 2
+        if b < 76
+          a = x - 3 + 18
+          # step 2602
+          b = x
+          step7(x, b)
+        end
+        step6(y)
+        step5(a, b)
+      end
+      if y > 70
+        step19(b, b)
+        if x == 53
+          step2(b, b)
+          # step 2613
+          b = b * a
+        end
+        a = x
+      else
+        if a == 8
+          # step 2619
+          y = 14 * y
+        end
+      end
+    else
+      66.times do |i3|
+        y = y
+        step13(x, y)
+        i3 = 29
+      end
+      if y == 56
+        # step 2630
+        b = 67
+      end
+      95.times do |i3|
+        b = i3 * step10(x, a) + x
+      end
+    end
+    if b == 27
+      if x == 14
+        22.times do |i4|
+          x = step15(x) + a * x
+        end
+        80.times do |i4|
+          # step 2643
+          x = i4 * step3(a)
+          x = b - a * y
+          b = i4
+        end
+      else
+        b = 95
+        step8(y, a)
+      end
+      36.times do |i3|
+        if i3 > 17
+          # step 2654
+          a = step6(a)
+        end
+        x = 15 + a
+        # step 2658
+        y = step2(y, x) * step19(b, i3)
+      end
+      b = b * x * b
+    end
+    # step 2663
+    y = 20 - b - b
+  else
+    x = b - x * 55
+    step3(y)
+    a = 64 * 55 * 51
+  end
+  if x > 1
+    91.times do |i2|
+      step11(y, b)
+      4.times do |i3|
+        57.times do |i4|
+          x = 8 * x * 23
+        end
+      end
+      i2 = y + a
+    end
+  else
+    15.times do |i2|
+      x = i2
+    end
+    step14(x, x)
+    # step 2685
+    y = x + x
+    if a < 91
+      if x == 46
+        y = b - step1(x, b) + 78
+      else
+        51.times do |i4|
+          # step 2692
+          a = 30
+          # step 2694
+          x = b - a * i4
+          # step 2696
+          b = 46 * a + 91
+        end
+      end
+      # step 2700
+      y = b * x * 59
+    else
+      step0(b)
+      x = x - 97 + step16(b, x)
+    end
+  end
+  if y == 80
+    x = b
+  end
+  if b < 70
+    53.times do |i2|
+      x = x + x - i2
+      x = step16(b, y) - 18
+    end
+    57.times do |i2|
+      if y < 72
+        # step 2717
+        y = i2 - step3(x)
+      elsif x == 88
+        if b < 15
+          # step 2721
+          x = i2 + b
+        elsif x < 71
+          b = 11 - x
+        end
+      end
+    end
+    a = y * b * 58
+    if a < 21
+      52.times do |i3|
+        if i3 == 49
+          step9(b)
+          step1(x, a)
+        elsif i3 == 63
+          # step 2735
+          a = 9 * 97 * step5(x, a)
+          # step 2737
+          b = 88
+          # step 2739
+          x = step8(a, i3)
+        end
+        x = 50 * step17(i3, b) + x
+      end
+      40.times do |i3|
+        step3(i3)
+      end
+      if x < 3
+        y = b
+      else
+        step16(y, b)
+        34.times do |i4|
+          # step 2752
+          i4 = x - x - x
+          # step 2754
+          x = b + a - b
+        end
+        if b > 28
+          # step 2758
+          y = a
+        else
+          # step 2761
+          b = b + a
+          y = b
+        end
+      end
+    elsif x == 56
+      0.times do |i3|
+        # step 2768
+        b = y - 89 + b
+      end
+      70.times do |i3|
+        a = 55 + y
+        if b > 75
+          # step 2774
+          b = b + 41
+          i3 = step18(y)
+        else
+          a = i3 + x * 85
+          # step 2779
+          b = i3 - i3
+        end
+      end
+    else
+      # step 2784
+      a = a
+      91.times do |i3|
+        if x == 44
+          i3 = 95 * x * 9
+        else
+          x = y + 53
+          # step 2791
+          a = step8(y, b) + y
+        end
+        x = a * b
+      end
+    end
+  else
+    27.times do |i2|
+      if x > 1
+        if x > 85
+          step0(y)
+        elsif x < 48
+          b = a + step8(a, x)
+          x = step7(b, x)
+          # step 2805
+          y = 29
+        else
+          a = y + i2
+        end
+      end
+      71.times do |i3|
+        step17(i2, a)
+      end
+      # step 2814
+      y = b + step6(y)
+    end
+    # step 2817
+    a = 48
+    if b < 22
+      y = x
+      if y == 88
+        if b < 72
+          # step 2823
+          x = 38 * a * 98
+          a = x
+        elsif b > 82
+          b = 87
+          # step 2828
+          x = 20 - step21(b)
+        else
+          a = 6 - 40
+          # step 2832
+          a = 3 * x
+        end
+      elsif x == 26
+        a = b
+      end
+      if y == 89
+        y = 3 - b
+      else
+        y = x + b
+        y = step11(a, b) + b
+        step3(x)
+      end
+    elsif y == 84
+      # step 2846
+      y = 75 + x
+    end
+    step13(a, x)
+  end
+  83.times do |i1|
+    4.times do |i2|
+      if a < 48
+        i2 = 7
+        a = x
+      else
+        y = i1 + 10
+      end
+    end
+  end
+  if a < 35
+    if b > 86
+      y = 56 * 14
+    else
+      b = x
+      42.times do |i3|
+        x = 64 - a - 84
+        y = x + 76
+        # step 2869
+        a = a - a + b
+      end
+    end
+  elsif x == 8
+    x = b * x
+    y = step3(a)
+  else
+    y = y + step17(x, x)
+  end
+  # step 2879
+  x = a * step11(y, y)
+  step15(b)
+  step21(x) + step10(x, b)
+end
+
+def step24(a)
+  x = 99
+  y = 86
+  y = a + 14 + y
+  44.times do |i1|
+    71.times do |i2|
+      step21(y)
+    end
+    i1 = 28
+    # step 2894
+    i1 = 68 + i1
+  end
+  x = 16 * y * step21(a)
+  if y > 51
+    # step 2899
+    x = y
+  end
+  # step 2902
+  a = a - a * 66
+  41 * y
+end
+
+def step25(a, b)
+  x = a + 92
+  y = 36
+  if x == 89
+    b = step21(y)
+    if y > 59
+      41.times do |i3|
+        if b < 54
+          # step 2915
+          x = b
+          step8(x, b)
+        end
+        if i3 == 32
+          # step 2920
+          b = b + 74 * y
+        end
+        if x < 76
+          b = y
+        elsif b < 48
+          a = x * x
+          # step 2927
+          x = 91 - 41 + a
+        else
+          # step 2930
+          b = x
+        end
+      end
+      96.times do |i3|
+        if y == 0
+          step3(y)
+        else
+          a = 0
+          # step 2939
+          a = 68 + i3
+        end
+        if x < 0
+          step8(b, y)
+          i3 = 83 - 10 * 52
+          y = step8(a, x) * b
+        else
+          # step 2947
+          a = 27 * 0
+          # step 2949
+          a = 57 + y
+        end
+      end
+    elsif b < 69
+      if a > 1
+        # step 2955
+        y = b - step4(y, a)
+        step4(x, x)
+        step2(b, b)
+      end
+      # step 2960
+      b = y + x + 96
+      34.times do |i3|
+        if a < 14
+          # step 2964
+          i3 = b
+        elsif y == 42
+          # step 2967
+          y = x
+        else
+          x = step24(b)
+          y = x * y * x
+        end
+      end
+    else
+      if y < 97
+        98.times do |i4|
+          y = i4
+          # step 2978
+          b = b - a
+          # step 2980
+          y = 73
+        end
+      else
+        if x > 71
+          # step 2985
+          x = a + y * a
+        elsif x > 42
+          # step 2988
+          y = a - 27 * b
+          # step 2990
+          a = b - y
+          b = 23 - step2(a, y)
+        else
+          # step 2994
+          x = b * 83 - step10(b, a)
+        end
+        b = 52
+        a = b * y
+      end
+    end
+    step6(b)
+  elsif b < 22
+    y = x * step4(x, y) * y
+    step2(b, y)
+    73.times do |i2|
+      # step 3006
+      x = y - 23
+    end
+  end
+  step13(a, b)
+  b = x + b - y
+  a = 3 * b
+  step9(y)
+  if b > 58
+    # step 3015
+    b = y
+  end
+  23.times do |i1|
+    y = a
+  end
+  # step 3021
+  x = 17 + step19(b, x) * b
+  53 * y
+end
+
+def step26(a, b)
+  x = b - a
+  y = 99
+  79.times do |i1|
+    # step 3030
+    x = step7(i1, b) + 60
+    i1 = 36
+    83.times do |i2|
+      step9(x)
+      y = 96 * i1
+    end
+    b = y * i1
+  end
+  if x == 26
+    if x < 34
+      x = step10(a, a)
+      # step 3042
+      y = 48
+      y = b
+      x = y - y
+    elsif b > 76
+      97.times do |i3|
+        if b > 69
+          # step 3049
+          b = i3 * i3
+          # step 3051
+          b = a + b - a
+        end
+        b = i3 - 84 * 41
+        if y < 92
+          # step 3056
+          x = step6(y)
+          # step 3058
+          i3 = y - 75
+        else
+          step18(b)
+          # step 3062
+          b = i3 - a
+          a = a - a
+        end
+      end
+    end
+    a = x - 91
+  elsif x < 12
+    b = 5 - 5 * step9(y)
+    a = step19(a, a) * step2(b, y)
+  else
+    b = x * x
+  end
+  if a < 33
+    # step 3076
+    a = y
+    if b > 7
+      # step 3079
+      x = a + y - a
+      if y > 83
+        a = b
+        a = 60 + b
+      elsif a < 44
+        b = b - y
+        if b < 80
+          # step 3087
+          a = a + step24(a) * b
+          # step 3089
+          b = y + a - 23
+        else
+          step24(y)
+          # step 3093
+          a = x * a
+          x = a + 76
+        end
+      end
+      49.times do |i3|
+        61.times do |i4|
+          # step 3100
+          y = a
+          x = i3 * 5
+        end
+      end
+      b = b * 38 * 34
+    end
+  else
+    if a > 38
+      if x > 98
+        if b == 12
+          # step 3111
+          b = 86
+          a = 82 * 45 + 78
+          # step 3114
+          y = step21(x)
+        elsif a < 60
+          # step 3117
+          y = 53
+        end
+      end
+      32.times do |i3|
+        step7(i3, i3)
+      end
+    elsif x > 68
+      step18(a)
+    end
+    12.times do |i2|
+      b = a
+    end
+    x = 79 - b
+    if a == 46
+      y = b + x
+      # step 3133
+      b = y * 43 * x
+      y = 94 - 7
+      if y < 94
+        step14(a, x)
+        17.times do |i4|
+          # step 3139
+          a = a * 15 + step11(x, a)
+        end
+        if x > 23
+          # step 3143
+          a = 97 + x + 40
+        end
+      else
+        step12(x)
+      end
+    elsif x < 76
+      step15(y)
+      step6(y)
+      if b > 39
+        step1(y, x)
+      end
+    else
+      step11(x, x)
+    end
+  end
+  x = b - b * 32
+  b = 19 - 76 - 66
+  step15(y)
+  94 + step4(b, b)
+end
+
+def step27(a)
+  x = a - a
+  y = 61
+  if a < 73
+    # step 3169
+    x = a - a
+    a = 61 * a
+    step13(y, y)
+    if x > 16
+      if y < 43
+        y = x - y * y
+      end
+      94.times do |i3|
+        if a == 89
+          # step 3179
+          y = i3
+          # step 3181
+          a = 81 + x + 3
+          x = step6(i3) + i3 + i3
+        end
+      end
+      if y == 10
+        step7(a, x)
+      elsif a == 75
+        if a > 79
+          a = 20 - y * x
+          # step 3191
+          y = y - 47 * step24(x)
+          # step 3193
+          y = a
+        else
+          y = 31 * a
+          x = x
+          step1(y, x)
+        end
+        if a == 35
+          x = y
+          # step 3202
+          a = x * 1 - x
+        elsif a < 32
+          y = x * y + y
+          # step 3206
+          x = 6
+        end
+        y = x + x
+      end
+      x = x * x - 72
+    end
+  end
+  a = step3(y)
+  if y == 72
+    # step 3216
+    x = x + y * 14
+  end
+  step12(x)
+  if y < 3
+    if a == 23
+      step25(x, y)
+      x = a + 26
+    end
+    7.times do |i2|
+      if y < 57
+        y = step23(x, i2) - x * 49
+      end
+      # step 3229
+      x = y - 50
+      if i2 < 30
+        81.times do |i4|
+          # step 3233
+          x = step4(y, y) - x
+          i2 = step13(y, i4) - a
+        end
+        a = y - a
+        15.times do |i4|
+          i4 = step8(i2, a)
+          y = a
+          # step 3241
+          i2 = x + x
+        end
+      elsif i2 < 26
+        if i2 == 74
+          i2 = 46
+        else
+          # step 3248
+          a = step21(x) - x
+        end
+        if y == 35
+          # step 3252
+          i2 = step17(a, x) - a + y
+          # step 3254
+          i2 = i2 + step14(a, x)
+          a = a + a + step25(a, i2)
+        elsif x == 82
+          # step 3258
+          i2 = 40 + 44 - x
+          y = i2 + 49
+          # step 3261
+          i2 = y - step21(x) - 73
+        end
+      else
+        if a > 83
+          # step 3266
+          x = 90 * 41
+          i2 = a
+          x = 15 + 10
+        else
+          step10(a, i2)
+        end
+        # step 3273
+        y = a
+        y = 96 + 7 * i2
+      end
+    end
+    44.times do |i2|
+      if x < 15
+        if a > 13
+          # step 3281
+          a = y + y
+          # step 3283
+          a = step6(a) * 24 * step3(x)
+          i2 = y * x + a
+        elsif i2 == 89
+          # step 3287
+          y = a
+          # step 3289
+          x = x + x + 92
+          i2 = 89 * y
+        else
+          # step 3293
+          a = step0(a) * step25(a, a) - 19
+          step8(x, a)
+          # step 3296
+          x = 5
+        end
+        step7(x, y)
+      end
+      if i2 > 64
+        i2 = step12(i2) + y
+        if x < 18
+          step4(i2, y)
+          # step 3305
+          a = y - 64 * 21
+        elsif x > 52
+          step16(i2, y)
+        end
+        89.times do |i4|
+          # step 3311
+          i4 = 61 * i4 - i4
+          # step 3313
+          y = 65 + a + step19(i4, x)
+          step14(a, i4)
+        end
+      end
+      a = step17(i2, i2) - 26 + 40
+    end
+    if y < 79
+      89.times do |i3|
+        46.times do |i4|
+          # step 3323
+          a = 61 - y
+          # step 3325
+          i4 = 84 + 1
+          step13(i3, x)
+        end
+        if y < 64
+          y = i3 - 16 * step21(a)
+          x = a
+        else
+          i3 = a - 6 - i3
+        end
+        # step 3335
+        a = 69 * x
+      end
+      if x == 72
+        if a > 67
+          y = step12(y) - 38
+          # step 3341
+          x = x - a - a
+          y = x * 27 * step2(x, x)
+        elsif a > 70
+          y = step25(a, x)
+          # step 3346
+          y = y
+        end
+        y = 9 * step11(x, x)
+      end
+      x = 97 * y + 91
+    end
+  else
+    if x > 19
+      if y > 24
+        a = y * y
+      elsif y == 47
+        a = 9 * x
+      end
+      if a == 31
+        y = 56 * a
+      elsif y == 68
+        x = 14
+        step14(x, x)
+      end
+    end
+    if x < 23
+      if a > 37
+        y = a + step8(x, x)
+      end
+      if y > 31
+        # step 3372
+        x = step21(a) + step5(x, x) - step3(a)
+        if y < 37
+          step24(y)
+          # step 3376
+          x = x
+          # step 3378
+          a = x
+        else
+          a = step5(x, a) + 54 * 2
+        end
+      else
+        x = x + x
+        if a == 86
+          x = 72 - 92
+        else
+          step1(x, y)
+          # step 3389
+          a = y
+        end
+        x = x - 1 - y
+      end
+      if y == 8
+        if a > 80
+          step14(y, a)
+          # step 3397
+          y = x
+          a = step26(x, a) - 82
+        end
+      elsif a > 60
+        a = 54
+      else
+        if y > 55
+          # step 3405
+          y = 93 * step8(x, x)
+        end
+        a = a
+      end
+    else
+      # step 3411
+      a = 78
+    end
+  end
+  step18(a)
+  x
+end
+
+def step28(a, b)
+  x = b * 58 * 69
+  y = 99
+  63.times do |i1|
+    # step 3423
+    i1 = b * b + a
+    if y < 35
+      step10(b, x)
+      x = a
+    elsif b > 21
+      a = 17 * 58
+      44.times do |i3|
+        i3 = b
+      end
+    else
+      step16(y, i1)
+      50.times do |i3|
+        16.times do |i4|
+          # step 3437
+          i3 = 26 - y
+        end
+        x = i3 + i1 * i3
+      end
+      a = 77 - 80
+    end
+  end
+  y = step14(y, b) + y - a
+  23.times do |i1|
+    i1 = 34
+    if x == 84
+      if i1 == 19
+        if i1 == 83
+          y = i1 - 14 - b
+          a = 33 * 56 - a
+          # step 3453
+          y = y
+        end
+      end
+      if y < 86
+        # step 3458
+        y = y - a + 23
+      end
+    end
+    # step 3462
+    a = x + step13(i1, x) + y
+  end
+  b = b * step14(b, y) + 11
+  b = a + 83
+  a = 59 + 99
+  13.times do |i1|
+    x = 68
+    17.times do |i2|
+      x = b
+      if x < 93
+        # step 3473
+        y = 34 - i2
+        if i2 < 36
+          step1(x, x)
+          step23(a, x)
+          # step 3478
+          b = a * x
+        elsif i2 > 50
+          step4(i2, x)
+          # step 3482
+          b = i1
+          x = 52
+        end
+        # step 3486
+        b = 44
+      end
+      step5(i1, b)
+    end
+  end
+  x + y - 11
+end
+
+def step29(a, b)
+  x = b + b * 11
+  y = 53
+  b = y
+  step1(y, x)
+  if y > 17
+    y = 72 - 22
+    if b > 83
+      if y == 88
+        y = 4 + a * a
+        step3(y)
+        step21(y)
+      elsif a == 73
+        y = step20(b, x)
+        step18(x)
+      else
+        y = 20 * y
+      end
+    elsif a == 18
+      if a > 83
+        a = 40 - 96
+      end
+      x = y - step9(y) * 68
+    else
+      68.times do |i3|
+        i3 = step22(x, a) * b
+      end
+      y = a * y
+    end
+    if b == 37
+      b = 27 - 60
+      if y < 74
+        if x == 52
+          b = step14(a, y) * a
+        end
+        y = step4(a, b) * y - 85
+      else
+        x = y * a
+      end
+      a = y * 13
+    elsif a > 68
+      15.times do |i3|
+        33.times do |i4|
+          # step 3538
+          y = y + i4
+        end
+        if x < 55
+          # step 3542
+          x = 14 + 36 - step12(y)
+          step7(b, x)
+          x = 45 + i3
+        end
+        74.times do |i4|
+          # step 3548
+          b = 29
+          a = 86 + 97 - y
+        end
+      end
+    else
+      b = 62 + 67 + y
+      if b == 83
+        if y > 30
+          # step 3557
+          a = b + step28(x, a)
+          # step 3559
+          b = 65 * y + a
+        else
+          a = 15
+        end
+        if x < 75
+          step27(x)
+        elsif a == 82
+          x = 1
+          x = y + x
+          # step 3569
+          a = b
+        end
+      else
+        # step 3573
+        a = 23
+      end
+      90.times do |i3|
+        1.times do |i4|
+          # step 3578
+          b = 25
+        end
+      end
+    end
+  elsif x > 54
+    69.times do |i2|
+      x = 9
+      i2 = 38 * y - 96
+      step18(i2)
+      if i2 < 86
+        y = 65 * 10
+      end
+    end
+    31.times do |i2|
+      # step 3593
+      a = a + a * 38
+      if y > 49
+        i2 = a * 56 - 85
+        if a > 78
+          # step 3598
+          a = 8
+        else
+          i2 = 50 * b
+          # step 3602
+          y = 29 * a
+          b = 91 + step3(i2) + y
+        end
+        b = 63
+      end
+      i2 = a
+      y = x
+    end
+    b = 59 * 82 - y
+  end
+  a = x
+  if x < 10
+    if b < 27
+      if y > 19
+        # step 3617
+        b = step19(b, y)
+        a = step28(y, x) - step3(x) * x
+      end
+      if x > 28
+        b = step27(x) + 10 * b
+        if x == 16
+          b = 80 * 8 * y
+          # step 3625
+          b = b * b + x
+        else
+          a = y
+          # step 3629
+          y = x - a - a
+        end
+      end
+      # step 3633
+      y = b
+    elsif y == 59
+      if a > 66
+        x = 83 + 60
+        if a > 94
+          # step 3639
+          a = a
+          step4(a, a)
+        elsif y > 84
+          b = y
+        end
+        y = y * step0(b)
+      end
+      step8(x, b)
+    else
+      if b == 68
+        if y > 49
+          # step 3651
+          x = a
+          x = 36
+          a = 65
+        elsif y > 46
+          x = step27(x) - 73
+          a = x
+        end
+      else
+        # step 3660
+        a = x * y
+      end
+      # step 3663
+      b = step12(x) + step4(b, b)
+      if x == 97
+        a = 12 + 60
+      end
+    end
+    if y == 38
+      51.times do |i3|
+        45.times do |i4|
+          step24(a)
+          # step 3673
+          i4 = x - 97 - i4
+        end
+        99.times do |i4|
+          y = i4
+        end
+        95.times do |i4|
+          a = b * 70
+        end
+      end
+      13.times do |i3|
+        step21(a)
+        if b < 54
+          # step 3686
+          a = 51
+          # step 3688
+          y = a * x * 69
+        end
+      end
+      if a == 0
+        96.times do |i4|
+          # step 3694
+          x = 30 * x
+          step27(b)
+          # step 3697
+          a = 22 + y
+        end
+        x = a + a - step4(a, a)
+        36.times do |i4|
+          # step 3702
+          x = 81 * 18 * x
+          # step 3704
+          i4 = 0 * 22 + step14(b, x)
+        end
+      end
+      if b > 82
+        step22(y, b)
+      elsif x > 85
+        step23(x, b)
+        95.times do |i4|
+          step24(a)
+        end
+      end
+    else
+      86.times do |i3|
+        11.times do |i4|
+          a = step2(x, b) - step4(i4, b)
+          # step 3720
+          i4 = i3 + step18(b) + b
+          # step 3722
+          i3 = step7(i3, y)
+        end
+      end
+      if a > 27
+        if x > 8
+          # step 3728
+          x = 47 + b - a
+        end
+      end
+      x = 99 + y - 1
+      if x < 38
+        step22(a, b)
+      elsif y == 2
+        y = y
+      else
+        if y == 18
+          # step 3739
+          y = step12(a) - 50 - 88
+          # step 3741
+          a = 91 * b * 0
+        elsif b == 14
+          # step 3744
+          a = 36
+          # step 3746
+          a = y + 42
+        end
+        step3(a)
+      end
+    end
+    # step 3752
+    x = 62
+    if b > 42
+      step15(a)
+    end
+  end
+  if b > 58
+    step13(y, b)
+    # step 3760
+    a = 3 + 18 + 55
+  elsif x < 56
+    step24(x)
+    if a < 86
+      if a > 9
+        b = x
+        # step 3767
+        x = b * x * b
+      end
+      step18(a)
+      step5(b, y)
+    elsif x > 93
+      step9(a)
+      41.times do |i3|
+        step3(b)
+        y = a * 72 * 55
+      end
+      y = a - y + step11(y, x)
+    end
+  else
+    y = x
+    # step 3782
+    b = y - x + b
+  end
+  x
+end
+
+def step30(a)
+  x = a + a
+  y = 38
+  if a == 72
+    step11(x, x)
+    76.times do |i2|
+      x = 3
+    end
+  else
+    15.times do |i2|
+      91.times do |i3|
+        if y == 73
+          i3 = i3 + 8
+        end
+      end
+    end
+    52.times do |i2|
+      if a < 50
+        if i2 == 74
+          a = y - step0(a) + y
+        end
+      end
+    end
+  end
+  25.times do |i1|
+    49.times do |i2|
+      a = x * y * 21
+    end
+  end
+  a = step14(a, a) * y
+  if a > 28
+    step5(a, x)
+    # step 3820
+    y = x
+    # step 3822
+    x = y
+    94.times do |i2|
+      if a > 49
+        if y < 59
+          # step 3827
+          x = 19 - x
+        elsif y > 27
+          step13(i2, x)
+        end
+      else
+        50.times do |i4|
+          step9(i4)
+          # step 3835
+          i4 = step3(y) + step18(i4)
+        end
+      end
+    end
+  end
+  a = x
+  x = x - step18(x)
+  if a > 44
+    x = x + a - 58
+  else
+    if a > 28
+      a = step21(y) * 30
+      x = a * step16(a, y) - step23(x, x)
+      step10(y, a)
+      step5(y, x)
+    else
+      x = step18(a) * 44 * a
+      # step 3853
+      x = y + step6(y) * 77
+      a = x * 70
+    end
+  end
+  step2(a, a) - 28 * 74
+end
+
+def step31(a, b)
+  x = a - b
+  y = 83
+  if y > 56
+    # step 3865
+    x = a * y * 11
+    y = y
+  end
+  b = step11(y, b)
+  61.times do |i1|
+    x = a
+    if x > 84
+      34.times do |i3|
+        i3 = 93 * step16(a, i1)
+      end
+    else
+      if b < 25
+        34.times do |i4|
+          i4 = i4
+        end
+        92.times do |i4|
+          # step 3882
+          x = 75 + step26(i1, a) + 48
+        end
+        a = b - step27(y)
+      end
+    end
+    x = x + a
+  end
+  x = 55
+  b - x * x
+end
+
+def step32(a, b)
+  x = 35 + 66
+  y = 17
+  if a > 73
+    y = 69 + 93
+    y = x * y - 53
+    b = step17(a, a)
+    x = 29 + x
+  end
+  if x > 7
+    y = a - x
+    if x > 40
+      x = x * step13(y, a) + x
+      x = step16(a, b) + step30(b)
+    end
+  else
+    a = y + y * x
+    if b < 11
+      9.times do |i3|
+        i3 = 64
+        if a == 54
+          step13(b, y)
+        end
+      end
+      if x > 89
+        b = step23(b, y) - y
+      elsif y > 71
+        a = step21(a) * 30 + b
+        # step 3922
+        y = a + b
+      end
+      b = 37 - x
+      15.times do |i3|
+        step10(b, y)
+        a = y
+      end
+    end
+  end
+  # step 3932
+  y = 51 - y - 22
+  b = 20 * 81 * y
+  step5(b, x)
+  b = b + step15(x) + b
+  x = a + b + 61
+  step18(y)
+  b + step18(a)
+end
+
+def step33(a)
+  x = a * a
+  y = 44
+  8.times do |i1|
+    # step 3946
+    a = step32(i1, x) + x
+    i1 = 61
+    y = 6 + step4(y, y)
+  end
+  if y < 46
+    if a < 47
+      60.times do |i3|
+        if i3 > 14
+          # step 3955
+          y = 51 + x
+        else
+          # step 3958
+          x = a + 3 - step15(y)
+        end
+      end
+      if y < 69
+        a = a - step15(y) - x
+      end
+    end
+    # step 3966
+    x = step26(y, y) * a
+    x = 78 * step30(a) + step15(a)
+  end
+  # step 3970
+  a = x + y - a
+  9 * 18 + y
+end
+
+def step34(a, b)
+  x = a
+  y = 24
+  if b < 92
+    y = 96
+    if b == 85
+      b = 99 + y
+      if a == 13
+        if b == 83
+          # step 3984
+          y = b - a + x
+          a = y - x
+        else
+          # step 3988
+          b = x - b
+        end
+        b = b * a * y
+      else
+        y = x - 48
+        step18(b)
+      end
+      x = a
+      if y < 60
+        # step 3998
+        b = 11 - a + step4(a, y)
+      end
+    end
+    step22(a, y)
+  elsif x < 61
+    47.times do |i2|
+      45.times do |i3|
+        72.times do |i4|
+          # step 4007
+          b = 49
+          # step 4009
+          i4 = 25 * i4
+        end
+        if y > 45
+          b = i2
+        elsif b > 98
+          # step 4015
+          i3 = i2
+        else
+          # step 4018
+          a = step33(b)
+        end
+        step17(x, y)
+      end
+      # step 4023
+      a = 53
+    end
+    y = a * 88
+    4.times do |i2|
+      if a == 37
+        # step 4029
+        x = i2 + step1(b, y)
+      end
+      x = y - x
+      step26(x, i2)
+    end
+  else
+    x = y + 0
+    a = x - a
+  end
+  if x < 25
+    y = x
+    if a < 4
+      38.times do |i3|
+        a = 75 - step19(b, y)
+        step2(x, i3)
+        step31(y, y)
+      end
+      step19(b, a)
+    else
+      y = step1(x, x) * y
+      if y < 75
+        step7(b, x)
+      end
+      if a < 78
+        if b == 33
+          step8(x, b)
+          # step 4056
+          y = 82 + x
+        end
+        a = step17(a, y) - a * step3(y)
+        x = step13(a, b)
+      else
+        if y < 86
+          step6(b)
+        elsif a > 72
+          # step 4065
+          y = b
+          # step 4067
+          y = a - y * step11(x, b)
+        else
+          x = b - b - a
+          a = y
+          y = x * 33 - 42
+        end
+        step33(a)
+        if b < 79
+          step18(b)
+          # step 4077
+          b = a - b
+        else
+          y = step32(a, x) * 28 * b
+          b = step1(x, a) - a - 24
+          # step 4082
+          b = 9 * x
+        end
+      end
+    end
+    y = a + 23
+  elsif y > 30
+    step24(x)
+    if y > 4
+      30.times do |i3|
+        if i3 < 47
+          b = step33(b)
+          # step 4094
+          a = 88 + y + i3
+        elsif y < 41
+          y = i3
+          # step 4098
+          y = 66 - step33(i3) - 93
+          # step 4100
+          i3 = 38 - 41 * 91
+        end
+        if x == 57
+          y = i3
+          x = y - step26(a, x)
+        elsif a < 83
+          # step 4107
+          b = 15
+          # step 4109
+          x = b - 37
+        end
+      end
+      step21(y)
+      # step 4114
+      x = x * y * b
+      if y > 80
+        52.times do |i4|
+          # step 4118
+          i4 = 66 - 23 + y
+          x = 77 * 5
+          step27(x)
+        end
+        step3(b)
+      elsif x == 78
+        # step 4125
+        a = 23 - 84
+      end
+    else
+      # step 4129
+      x = x
+      a = 30 * y * 1
+    end
+    if y == 20
+      10.times do |i3|
+        32.times do |i4|
+          # step 4136
+          i4 = step21(y) - x
+          # step 4138
+          x = 77 + step11(a, i3)
+        end
+      end
+      x = step24(y)
+    end
+  else
+    if b < 78
+      # step 4146
+      x = y + 56
+      step13(x, b)
+      y = a + y
+    else
+      x = a
+      if x == 56
+        if x == 64
+          x = 3 + y - 85
+        elsif x > 52
+          # step 4156
+          a = y + a * b
+          # step 4158
+          y = 6 + 47
+          y = x * 85 * 90
+        end
+        if x == 82
+          b = y
+        else
+          b = step3(x) + y + a
+        end
+      end
+      if y == 83
+        29.times do |i4|
+          # step 4170
+          b = 43
+          step0(b)
+          # step 4173
+          b = b
+        end
+        # step 4176
+        b = 51 * b
+        step30(x)
+      else
+        b = step17(y, y) + a
+      end
+    end
+    9.times do |i2|
+      28.times do |i3|
+        # step 4185
+        i2 = step29(i3, a) - 38 + b
+      end
+      b = a
+      if y < 65
+        if x < 16
+          # step 4191
+          y = step1(a, x) + 95
+        else
+          a = b + 98
+        end
+        y = 71
+        86.times do |i4|
+          step4(i2, x)
+        end
+      elsif x > 53
+        y = x
+      else
+        78.times do |i4|
+          a = 65 + 60 * y
+          # step 4205
+          a = 22 + 34
+          # step 4207
+          b = a * step33(b) - 59
+        end
+      end
+      if b > 41
+        if a > 60
+          step33(i2)
+        elsif b > 78
+          step23(a, b)
+        else
+          b = 71 + 23 - step18(b)
+        end
+        a = i2 * 39 * step27(x)
+      else
+        80.times do |i4|
+          # step 4222
+          i4 = 71 - a
+          # step 4224
+          x = step10(a, x) * i4 - i4
+        end
+      end
+    end
+  end
+  if x < 41
+    y = a + step11(b, x) - step30(x)
+    if y < 22
+      b = step12(a) + x
+    else
+      if b < 2
+        if x == 81
+          # step 4237
+          x = 23 + step0(x)
+        else
+          # step 4240
+          y = 74
+        end
+        if b < 13
+          a = y
+        end
+        65.times do |i4|
+          # step 4247
+          x = x * 56
+          # step 4249
+          i4 = 20 + 50 + a
+        end
+      end
+      step17(b, y)
+      step25(y, a)
+      step6(y)
+    end
+    70.times do |i2|
+      step18(y)
+      96.times do |i3|
+        y = a
+        a = 30 * b
+      end
+    end
+  elsif b < 38
+    # step 4265
+    y = y
+  else
+    82.times do |i2|
+      if a > 30
+        step12(x)
+      else
+        x = a * step16(a, x)
+      end
+      if y > 22
+        if x < 13
+          # step 4276
+          x = x * y * 34
+        end
+        a = step10(x, b) - i2 * 97
+      else
+        x = y
+      end
+      b = 15 * step32(y, i2) * x
+      5.times do |i3|
+        i2 = 69 - step10(a, x) + x
+      end
+    end
+    # step 4288
+    x = 66 + 93
+    # step 4290
+    x = a + 38 + a
+  end
+  step16(b, x)
+  31 * 49 * a
+end
+
+def step35(a, b)
+  x = 9
+  y = 16
+  b = a * step23(a, b) * step11(b, y)
+  y = 29
+  y = x + b + b
+  b = step11(b, x)
+  if a == 75
+    step34(a, y)
+    if y == 29
+      y = step3(y)
+      step5(y, x)
+      x = a * a
+      y = b
+    else
+      step12(a)
+      68.times do |i3|
+        y = i3 - 28
+      end
+      b = y + b
+      57.times do |i3|
+        step2(x, x)
+      end
+    end
+  elsif x == 82
+    if b < 59
+      step24(x)
+    end
+    step23(a, y)
+    b = y + b - b
+  end
+  y - step32(x, b) + 78
+end
+
+def step36(a)
+  x = 43 * 10
+  y = 19
+  if x < 71
+    82.times do |i2|
+      # step 4336
+      x = 10 - step14(y, i2)
+      y = a * 49
+      y = 38 + 7 - y
+      i2 = a - x - x
+    end
+  elsif x < 5
+    x = step22(a, a) - 36 - x
+    step24(y)
+    if x > 26
+      step29(x, y)
+      if x < 62
+        # step 4348
+        y = y
+      elsif y == 76
+        # step 4351
+        x = 66 + x
+        # step 4353
+        y = x
+        14.times do |i4|
+          # step 4356
+          x = a - i4 - 80
+          step8(i4, y)
+        end
+      else
+        a = y
+        50.times do |i4|
+          # step 4363
+          a = x + 6 + y
+          step15(a)
+        end
+      end
+    end
+    y = step19(x, x)
+  else
+    step12(y)
+  end
+  step10(y, a)
+  x = 25
+  step28(a, x)
+  18.times do |i1|
+    if i1 > 42
+      step9(i1)
+      # step 4379
+      y = 44 + a
+      10.times do |i3|
+        if a == 62
+          # step 4383
+          a = 22
+          # step 4385
+          i1 = i3 + step22(i3, x)
+        end
+        i1 = step6(i3) - y - 41
+        if x > 16
+          # step 4390
+          i3 = step31(x, y) + i3
+          # step 4392
+          i1 = a
+        end
+      end
+    end
+    if i1 < 42
+      if a > 72
+        a = y * a
+      elsif a < 26
+        step2(y, x)
+        if x < 79
+          i1 = 75
+          y = y - x + x
+        elsif y > 91
+          step29(y, y)
+        end
+        a = 46
+      else
+        y = i1 * 80 - 27
+        if y == 99
+          x = 64
+        end
+      end
+    else
+      step1(x, a)
+      88.times do |i3|
+        a = a * i3
+      end
+    end
+    if i1 == 36
+      i1 = x + step18(x)
+      94.times do |i3|
+        i1 = i3
+      end
+    end
+  end
+  y = x + 2
+  y = y
+  y = a
+  y - step28(y, a)
+end
+
+def step37(a, b)
+  x = 0 * 77
+  y = 83
+  b = step29(y, x) - 18 + y
+  88.times do |i1|
+    # step 4439
+    y = x
+  end
+  step0(b)
+  a = y
+  step26(b, x)
+  if a > 44
+    step21(a)
+    y = 83 * 35
+  end
+  if b > 70
+    if y > 99
+      # step 4451
+      y = y + y * b
+    elsif a > 27
+      37.times do |i3|
+        if i3 < 77
+          a = x
+          # step 4457
+          x = a - 29 * 30
+        end
+      end
+      y = a
+      4.times do |i3|
+        if x == 93
+          # step 4464
+          i3 = 68 + b - 29
+        end
+      end
+    end
+    x = y
+    b = y
+    # step 4471
+    b = step35(a, a)
+  end
+  b
+end
+
+def step38(a, b)
+  x = 4
+  y = 97
+  if a < 16
+    step25(x, b)
+  end
+  if y == 47
+    if b > 38
+      if b == 42
+        b = 13 - a + 67
+        if y > 64
+          # step 4488
+          x = b - 94
+          # step 4490
+          a = x * y
+          step28(b, b)
+        elsif a < 17
+          b = 48 * 16
+        end
+        x = step6(a) + a - a
+      else
+        if y > 63
+          # step 4499
+          b = 84 - 51 * 52
+        end
+        18.times do |i4|
+          step23(a, b)
+        end
+      end
+    end
+  end
+  # step 4508
+  a = 92
+  # step 4510
+  b = step37(x, b)
+  55.times do |i1|
+    if b < 58
+      i1 = y * step36(x) * x
+      i1 = step14(x, i1) * 8
+    else
+      x = step20(b, a)
+    end
+    # step 4519
+    y = 47 + 64 + 31
+    29.times do |i2|
+      i2 = step17(y, y) * i1 + 67
+      a = 62 - 73 + y
+      if y > 79
+        if a < 10
+          b = 74
+        elsif a == 51
+          # step 4528
+          b = x + step27(i1)
+          # step 4530
+          i1 = i2
+        else
+          # step 4533
+          i1 = a - 19
+        end
+      else
+        if i2 > 60
+          # step 4538
+          x = x
+          # step 4540
+          a = step19(a, i1) - 19
+        else
+          step32(a, i1)
+        end
+      end
+      a = i1 * 91
+    end
+  end
+  if b > 21
+    y = 49 + 42
+    step29(a, b)
+    if y > 1
+      step34(b, y)
+      67.times do |i3|
+        x = b - x - x
+      end
+    end
+  elsif b < 79
+    if b > 11
+      49.times do |i3|
+        # step 4561
+        b = i3 + 65
+        if b < 23
+          i3 = 24
+        else
+          # step 4566
+          x = y
+        end
+        46.times do |i4|
+          step31(x, y)
+        end
+      end
+      if y < 69
+        # step 4574
+        a = x
+      else
+        29.times do |i4|
+          i4 = y * x + x
+          x = i4 - 86 - i4
+        end
+        # step 4581
+        x = y
+        # step 4583
+        b = step31(x, a) + b
+      end
+    end
+    # step 4587
+    y = x - 9
+  else
+    if x > 84
+      b = a * x
+      if b < 18
+        a = 22 * y
+        if a == 87
+          step13(y, a)
+          # step 4596
+          a = x
+          # step 4598
+          a = 65
+        elsif x == 20
+          # step 4601
+          b = 66
+        end
+        if a == 81
+          step34(b, x)
+          # step 4606
+          y = b + b
+        end
+      end
+      if x == 66
+        if b > 53
+          a = 69 - 87
+          y = 41
+        end
+      else
+        a = step28(b, a)
+        if b > 13
+          # step 4618
+          b = 53 + b - 6
+        else
+          # step 4621
+          a = 63 * y
+          # step 4623
+          b = step2(b, y)
+          # step 4625
+          x = x
+        end
+        x = 84 - 57 + 54
+      end
+    else
+      # step 4631
+      y = 45 - 7
+      2.times do |i3|
+        # step 4634
+        a = b
+        i3 = b
+        if x > 86
+          b = 76 - y + b
+        elsif y > 96
+          # step 4640
+          i3 = x
+        else
+          y = a
+          # step 4644
+          y = 28
+          # step 4646
+          y = x - x
+        end
+      end
+      step13(a, b)
+      b = b * step8(b, b) * y
+    end
+    x = 74 + step28(y, x) + step34(x, y)
+    x = 53 + 51 + y
+    if x > 75
+      if x == 64
+        97.times do |i4|
+          # step 4658
+          x = a * 97 - 4
+          # step 4660
+          b = i4 - step27(a)
+          # step 4662
+          y = i4
+        end
+      elsif x == 33
+        37.times do |i4|
+          # step 4667
+          i4 = x - x
+        end
+      end
+      1.times do |i3|
+        x = a
+      end
+      step17(b, a)
+    elsif a < 29
+      if b > 26
+        98.times do |i4|
+          # step 4678
+          x = 63 + y * 23
+          # step 4680
+          b = y
+          # step 4682
+          a = x + step2(i4, i4) * 18
+        end
+        if y < 43
+          y = 12 * x - step33(a)
+          step6(y)
+        else
+          # step 4689
+          b = 27 + x
+          # step 4691
+          x = 30
+          step7(y, b)
+        end
+      end
+      if y < 53
+        step21(y)
+        step3(b)
+        b = step37(y, b)
+      end
+    end
+  end
+  47.times do |i1|
+    step12(a)
+    if x < 71
+      y = b
+      # step 4707
+      b = b
+    elsif y < 18
+      step37(x, y)
+      a = 5 - step33(x)
+      i1 = 24 + 58
+      27.times do |i3|
+        if i1 == 59
+          step30(b)
+          # step 4716
+          b = 53 - 22
+        else
+          b = y - 41
+        end
+        # step 4721
+        x = 40 * 32
+        step11(x, i3)
+      end
+    end
+  end
+  if a < 25
+    if b == 63
+      b = b * step23(y, y)
+      step1(b, a)
+      if x == 72
+        step14(x, a)
+      else
+        y = 91
+      end
+    end
+    b = 12
+  end
+  step25(x, x)
+end
+
+def step39(a)
+  x = 57 * 62
+  y = 93
+  x = x
+  if x < 37
+    # step 4747
+    x = step29(x, x)
+    # step 4749
+    a = x - x + x
+    69.times do |i2|
+      7.times do |i3|
+        a = 40 * 29
+        # step 4754
+        i3 = i3 + y * i3
+      end
+      if a == 69
+        step27(x)
+        x = 35 - step32(i2, i2)
+      else
+        71.times do |i4|
+          i2 = x * a - x
+          # step 4763
+          x = 2 + 92
+        end
+      end
+      a = x
+      if y > 4
+        y = i2
+        if x < 75
+          y = step7(y, i2)
+        end
+        step37(y, x)
+      elsif a > 60
+        if i2 < 33
+          y = x + 93
+          a = 63 - step26(i2, i2) * a
+          # step 4778
+          i2 = step12(y)
+        end
+        if x > 62
+          # step 4782
+          i2 = x * x
+        else
+          a = a - step9(y) * y
+        end
+        y = 73 * a
+      else
+        x = y
+        if a > 11
+          # step 4791
+          i2 = a
+          # step 4793
+          y = i2 * y - step25(y, y)
+        else
+          # step 4796
+          y = 97 * step27(y) - i2
+          i2 = 43 - step27(a)
+          step4(i2, y)
+        end
+        y = x * step21(i2)
+      end
+    end
+    step5(a, y)
+  end
+  if y < 28
+    42.times do |i2|
+      y = y * y
+      step12(y)
+      i2 = i2
+      if i2 < 61
+        a = 7 * a + a
+      elsif i2 == 79
+        x = step34(x, a) * 19
+        # step 4815
+        y = x
+        if x == 37
+          # step 4818
+          y = y
+        end
+      end
+    end
+    if y > 67
+      step2(a, y)
+      step23(y, y)
+    end
+  end
+  if x == 16
+    a = x
+    a = a * 0
+  end
+  if y == 62
+    a = a * 21
+    # step 4834
+    x = a * y + a
+  elsif a < 61
+    if x == 39
+      if y > 21
+        93.times do |i4|
+          # step 4840
+          x = 64 + 0 + step12(i4)
+          # step 4842
+          a = i4
+        end
+      else
+        22.times do |i4|
+          i4 = y - i4 * step38(a, x)
+          # step 4848
+          a = 22 - step17(y, a)
+        end
+      end
+      x = 5 + 43
+      x = step21(x) + 90 - y
+    elsif x > 2
+      if a > 48
+        if a == 50
+          # step 4857
+          a = 46
+        end
+        x = a * 95 + x
+      else
+        y = 73 * a
+      end
+    else
+      if a > 13
+        if x < 15
+          x = x - 47 - y
+        elsif y == 44
+          a = 9 * 17 + 56
+        else
+          a = 25 * a + y
+        end
+        if x < 92
+          # step 4874
+          x = a + step3(a) + step25(a, x)
+        end
+      elsif a < 18
+        if y > 66
+          a = a + step5(y, x) + x
+        elsif y == 90
+          # step 4881
+          x = a * a
+        end
+        if y == 18
+          # step 4885
+          a = y
+        else
+          y = 85 - x
+          # step 4889
+          a = 55 + step37(y, a)
+          step15(a)
+        end
+      end
+      if y < 91
+        if x > 47
+          # step 4896
+          y = x + a
+          # step 4898
+          y = x * y * a
+          # step 4900
+          y = step5(a, y) + a + a
+        end
+        a = 62 + 50 + step2(y, a)
+      end
+      y = step37(x, a)
+      if y == 87
+        if x == 82
+          # step 4908
+          x = a
+        else
+          # step 4911
+          y = step25(y, x) - 21 * a
+          # step 4913
+          x = 62 * 26 + step26(x, a)
+        end
+      else
+        if y < 73
+          a = x + y + x
+          y = 26
+        else
+          # step 4921
+          y = a
+          a = y
+        end
+      end
+    end
+    53.times do |i2|
+      step10(i2, x)
+      1.times do |i3|
+        step27(i3)
+        i2 = 50 * 39
+      end
+    end
+    95.times do |i2|
+      x = 83 + step23(x, x)
+      i2 = y + 59
+    end
+  else
+    x = 48
+  end
+  if x < 66
+    if y > 70
+      x = 48 + 51 * a
+    else
+      3.times do |i3|
+        x = y
+        step14(i3, x)
+        x = 55 - 4
+      end
+    end
+  elsif x < 39
+    if x == 37
+      a = x - a * a
+      # step 4954
+      a = 64
+      # step 4956
+      y = 85 + step13(a, x)
+    else
+      step2(y, x)
+    end
+  end
+  y - y
+end
+
+def step40(a, b)
+  x = 9 - b + b
+  y = 4
+  if y < 94
+    a = step25(x, y) * y - y
+    56.times do |i2|
+      # step 4971
+      i2 = step15(i2) * 30
+      if a == 60
+        a = a
+      else
+        step34(y, b)
+      end
+    end
+    b = b * y
+    b = 91
+  end
+  step12(a)
+  # step 4983
+  y = b * y
+  step5(y, x)
+  step12(y)
+end
+
+def step41(a, b)
+  x = 77 - b + b
+  y = 74
+  step35(x, x)
+  99.times do |i1|
+    if a < 69
+      if b < 10
+        y = step33(y) + x - a
+        if y > 52
+          # step 4998
+          a = a
+        elsif y == 47
+          # step 5001
+          b = a * step17(a, x) + step23(b, b)
+        else
+          # step 5004
+          i1 = y + x
+          # step 5006
+          y = 99 * 50
+        end
+        if b == 28
+          # step 5010
+          i1 = 75
+          i1 = x
+          step39(a)
+        end
+      else
+        # step 5016
+        b = 91 - 25
+        if a == 84
+          # step 5019
+          b = a - b
+          # step 5021
+          y = 68 * b + i1
+        elsif b == 29
+          x = i1 * i1
+        end
+      end
+    elsif i1 > 69
+      i1 = 65 + a - y
+      x = y + y - 11
+      if i1 == 99
+        if a == 1
+          # step 5032
+          a = a + b - 6
+          step14(a, b)
+        end
+        step5(y, y)
+        if i1 > 37
+          # step 5038
+          b = i1 - 91
+        elsif b < 39
+          step19(y, x)
+          # step 5042
+          a = step22(y, i1) - b + 8
+          i1 = 69
+        else
+          a = 16
+        end
+      elsif y == 17
+        i1 = step10(b, b) - i1 + y
+        if a < 42
+          a = 52 - b
+        elsif b < 74
+          # step 5053
+          i1 = 39 + i1 - 28
+          # step 5055
+          a = x + x + step32(b, i1)
+        end
+      end
+    else
+      step39(a)
+      89.times do |i3|
+        if i1 > 53
+          # step 5063
+          b = a + x * 67
+          # step 5065
+          i3 = 21 + 86 * i1
+          y = x - 44
+        else
+          # step 5069
+          i1 = 50 - i3
+          i3 = i1
+        end
+        if x < 71
+          a = 38 * i1
+          # step 5075
+          i3 = 56 + 67 - 31
+        else
+          b = 28
+          b = y + 15 * 38
+          # step 5080
+          b = x - 71
+        end
+      end
+    end
+    # step 5085
+    b = x
+    # step 5087
+    a = 82
+    step5(i1, i1)
+  end
+  b = a * x - step18(y)
+  if b == 85
+    if x > 41
+      # step 5094
+      x = b
+      step4(y, b)
+      step34(x, x)
+    else
+      if x < 49
+        # step 5100
+        y = x - x
+      end
+      # step 5103
+      b = y
+      y = b
+      y = 86
+    end
+    if a > 51
+      y = a + y
+      if y > 8
+        x = 26
+      elsif y == 94
+        65.times do |i4|
+          # step 5114
+          b = step24(x) - step18(a)
+          step30(i4)
+        end
+        a = step18(y) * 91
+      else
+        y = 34 * 94
+      end
+    else
+      step37(a, a)
+      step29(x, a)
+    end
+  else
+    if a < 83
+      34.times do |i3|
+        if y < 57
+          # step 5130
+          x = a + i3 - 50
+          # step 5132
+          i3 = b * 54 - x
+          # step 5134
+          i3 = x + a - step36(b)
+        elsif b > 80
+          i3 = i3 + x
+          # step 5138
+          a = 76 * 2 - x
+        else
+          # step 5141
+          y = 11
+        end
+        b = b + 79 - 86
+        if b < 72
+          x = a
+        end
+      end
+      step10(x, x)
+      67.times do |i3|
+        if a == 18
+          x = 51 - a + 3
+        else
+          # step 5154
+          a = b
+        end
+      end
+    else
+      step1(a, a)
+    end
+    # step 5161
+    b = y + y + 48
+    x = step27(y) - b - 95
+    if y == 85
+      b = 88 * y
+      if a < 68
+        b = y - x + b
+      elsif a > 26
+        if x > 47
+          # step 5170
+          y = 22 * y - y
+        end
+        57.times do |i4|
+          # step 5174
+          x = i4 * 28
+          # step 5176
+          i4 = 39 * step9(b) + a
+          b = step25(y, b)
+        end
+        # step 5180
+        a = 32 - x + 25
+      else
+        b = a
+      end
+    else
+      if a < 32
+        if y < 28
+          # step 5188
+          x = x
+        else
+          y = 87 + 77 - 1
+          # step 5192
+          b = y
+        end
+        if y > 4
+          # step 5196
+          b = 76 - a - 40
+        else
+          # step 5199
+          b = a - 68
+        end
+        if x > 81
+          # step 5203
+          b = 93
+        end
+      else
+        # step 5207
+        a = 88 - a
+      end
+      if x < 66
+        x = 87 + 2
+        66.times do |i4|
+          # step 5213
+          y = 24 + step21(x)
+          # step 5215
+          b = step15(b) + step26(x, x)
+          # step 5217
+          x = step6(x) - 79 * y
+        end
+        85.times do |i4|
+          y = 96
+        end
+      else
+        b = b
+      end
+      # step 5226
+      b = b * 93
+      y = 97 * 4
+    end
+  end
+  y + a
+end
+
+total = 0
+total = total + step37(62, 59)
+total = total + step38(50, 70)
+total = total + step39(72)
+total = total + step40(28, 64)
+total = total + step41(21, 15)
+puts total
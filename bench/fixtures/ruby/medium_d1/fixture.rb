@@ -0,0 +1,826 @@
+def step0(a)
+  x = 51
+  y = 89
+  a = x - x + 32
+  x = 97 + y
+  # step 5
+  x = x + 97 - x
+  y
+end
+
+def step1(a, b)
+  x = b + a + b
+  y = 3
+  if a > 75
+    # step 14
+    x = 40 * step0(b) + y
+    # step 16
+    x = step0(a)
+    # step 18
+    x = b
+  else
+    # step 21
+    b = 36
+  end
+  39.times do |i1|
+    # step 25
+    a = 0 - 93
+    # step 27
+    y = step0(a) + x
+  end
+  x = b
+  99.times do |i1|
+    y = y + 37 - i1
+    step0(a)
+    b = a * 98 - 54
+    x = 68 * 98 - 35
+  end
+  52
+end
+
+def step2(a, b)
+  x = b
+  y = 53
+  x = 43 + step0(x) + x
+  if x > 21
+    # step 45
+    b = 81 + step0(y)
+    b = y * 1
+  else
+    y = a
+    # step 50
+    y = y * b * a
+  end
+  if x < 47
+    step1(b, x)
+  else
+    y = a * 37
+  end
+  step1(y, x)
+  45.times do |i1|
+    # step 60
+    x = x
+    # step 62
+    i1 = x
+    b = 96 - x - b
+    # step 65
+    a = 12 - b - 18
+  end
+  y = 91 - a * 3
+  step0(b)
+  if y == 79
+    # step 71
+    a = step0(a) + x - 76
+    # step 73
+    a = 23 + b
+    a = y + step1(a, b)
+  elsif x < 33
+    b = a * x + 40
+    step0(x)
+    # step 79
+    a = 0 - 77 + b
+    a = x - 98 + 31
+  end
+  y - step1(y, b) * 88
+end
+
+def step3(a)
+  x = 87 + a
+  y = 58
+  89.times do |i1|
+    # step 90
+    x = step0(x) + 88
+  end
+  step1(a, y)
+  a = 90 * x + 92
+  29 + a
+end
+
+def step4(a, b)
+  x = b + b
+  y = 48
+  41.times do |i1|
+    # step 102
+    b = i1
+    # step 104
+    y = b + i1
+    # step 106
+    y = i1 * 31 - step3(a)
+    # step 108
+    b = 46 - 92
+  end
+  a = b
+  # step 112
+  x = 16 - 41 + 16
+  step1(b, b)
+  if b > 19
+    step0(x)
+    # step 117
+    x = a + a + y
+    # step 119
+    y = step2(a, y) * b
+    b = 63
+  else
+    # step 123
+    y = step2(b, b)
+    # step 125
+    a = x + b * 67
+  end
+  7 + 84 * step1(a, y)
+end
+
+def step5(a, b)
+  x = 32 + b
+  y = 78
+  x = y
+  if b == 19
+    y = 64 - y
+    step0(y)
+  end
+  if b < 42
+    # step 140
+    b = step4(x, y) * step0(y)
+    # step 142
+    y = b + b * y
+    a = a * y + x
+  elsif x > 47
+    # step 146
+    a = 84 - 48 - step0(y)
+    step0(x)
+    step1(b, b)
+  else
+    x = a * a
+    # step 152
+    a = y - y - y
+  end
+  78.times do |i1|
+    step4(i1, y)
+  end
+  if x == 5
+    x = 79 - y
+    # step 160
+    x = b * y
+  else
+    step0(y)
+  end
+  40.times do |i1|
+    # step 166
+    a = a - x
+    # step 168
+    x = i1
+  end
+  if b > 70
+    # step 172
+    b = b * x - 79
+    # step 174
+    b = 79 * a
+    # step 176
+    b = 61
+  end
+  88 * step0(a)
+end
+
+def step6(a)
+  x = 90 * a
+  y = 94
+  a = step1(x, a)
+  if y > 46
+    x = y * x + 22
+    step2(y, x)
+    y = x - x * 64
+    # step 190
+    a = 74 + x - x
+  else
+    # step 193
+    x = 25 - 45 - a
+  end
+  y = 5 * 20
+  step5(a, y)
+  step3(x)
+  x = 87 - y - 71
+  if x == 62
+    y = a
+    y = step5(x, a) + step4(y, y)
+  end
+  if a < 36
+    x = a
+    # step 206
+    a = a - 32
+    y = y
+  elsif a == 5
+    # step 210
+    x = step4(y, a)
+    y = x + step1(a, a) * y
+    step5(x, a)
+    # step 214
+    y = y
+  end
+  step0(a)
+end
+
+def step7(a, b)
+  x = 41
+  y = 66
+  x = 85
+  b = y
+  if x == 22
+    # step 226
+    b = y
+  end
+  # step 229
+  y = x + x - step5(y, b)
+  b * x
+end
+
+def step8(a, b)
+  x = b - 21
+  y = 52
+  if b < 28
+    # step 238
+    y = y
+    # step 240
+    y = 15
+    a = step7(a, b)
+    b = x
+  elsif y < 83
+    # step 245
+    y = y + x
+    # step 247
+    y = 49 - step7(y, b) + b
+  end
+  if b < 10
+    step2(y, y)
+    # step 252
+    b = 58
+  elsif y == 65
+    y = x
+  end
+  if x < 31
+    # step 258
+    a = step1(y, y)
+    # step 260
+    y = 26
+    y = 98 + step7(y, x)
+  end
+  # step 264
+  x = b
+  b = step5(y, b)
+  14 + a + step1(b, b)
+end
+
+def step9(a)
+  x = 49 - a + 10
+  y = 24
+  y = step2(y, x) * 89
+  a = x - 80 * y
+  step5(x, x)
+  step6(a)
+  if x > 93
+    x = 87
+    step8(y, a)
+  end
+  41 + step6(a)
+end
+
+def step10(a, b)
+  x = 98 * 26
+  y = 37
+  if b < 19
+    # step 288
+    a = b
+    # step 290
+    b = 13
+    step0(b)
+  end
+  54.times do |i1|
+    b = 63
+    # step 296
+    y = step6(x) - 39
+  end
+  # step 299
+  x = x
+  # step 301
+  a = 59
+  step2(y, y)
+  53.times do |i1|
+    a = y * x - y
+    a = x + b + step5(a, a)
+  end
+  77
+end
+
+def step11(a, b)
+  x = 91
+  y = 10
+  step10(a, x)
+  # step 315
+  x = x * b - a
+  28.times do |i1|
+    # step 318
+    i1 = b - step2(x, y) * x
+    step4(a, i1)
+  end
+  step8(b, a)
+  65
+end
+
+def step12(a)
+  x = a * a
+  y = 41
+  a = 65 * a + a
+  if x < 72
+    a = step6(x) + 54
+    # step 332
+    a = step6(y) - x
+  elsif a < 42
+    # step 335
+    a = step0(x)
+    # step 337
+    a = y
+  end
+  if y < 49
+    # step 341
+    a = a
+    a = step1(x, y)
+    step3(y)
+  elsif x < 0
+    x = x - x - step3(x)
+  else
+    y = 92 + a - a
+    # step 349
+    x = 1 - y
+    # step 351
+    x = y
+    # step 353
+    y = step5(x, x) + step10(y, x)
+  end
+  a = y * y
+  21 - 37
+end
+
+def step13(a, b)
+  x = 21 + a + a
+  y = 29
+  a = 10 + 86
+  50.times do |i1|
+    x = i1 - step2(b, b)
+  end
+  46.times do |i1|
+    step10(b, x)
+    # step 369
+    b = 28 + 45
+    # step 371
+    a = a
+    # step 373
+    b = a
+  end
+  # step 376
+  y = 15
+  x = a + b
+  if b < 48
+    # step 380
+    y = step9(x) - 0
+    # step 382
+    a = step3(x) * x + y
+    step1(a, x)
+    a = y + b * 30
+  end
+  if x == 49
+    a = 69
+  end
+  99 + x + step10(a, a)
+end
+
+def step14(a, b)
+  x = 76
+  y = 57
+  a = x * 69
+  x = 57
+  if y < 23
+    # step 399
+    x = b + 17
+  end
+  a = 48
+  if y == 83
+    # step 404
+    y = 18
+    # step 406
+    x = b + 11
+  else
+    # step 409
+    y = x
+    step12(y)
+  end
+  # step 413
+  y = b - y
+  a = 17
+  y + 42
+end
+
+def step15(a)
+  x = a
+  y = 3
+  44.times do |i1|
+    # step 423
+    y = 4
+  end
+  if y == 2
+    # step 427
+    x = 46 - y * step6(x)
+    y = 52 + a
+    y = a
+  elsif y < 89
+    y = a
+    # step 433
+    x = x + a + x
+  end
+  if x > 93
+    y = a
+    step12(x)
+    x = a
+  else
+    y = 26 * y - y
+    # step 442
+    a = x * 0
+    step4(y, y)
+    step0(x)
+  end
+  y = a + a
+  step9(y)
+  41 + 42 + y
+end
+
+def step16(a, b)
+  x = a * b
+  y = 36
+  5.times do |i1|
+    step5(b, a)
+    # step 457
+    i1 = 29 + y + x
+    # step 459
+    y = 76 * a + x
+  end
+  if y == 29
+    step10(x, a)
+    b = step2(a, x)
+    # step 465
+    a = x - y + x
+    y = 28
+  else
+    # step 469
+    b = b * 0
+    y = 6 * x
+  end
+  x = y + 44 + a
+  14.times do |i1|
+    # step 475
+    x = 5
+  end
+  b = a
+  if b > 51
+    # step 480
+    x = 10
+  else
+    # step 483
+    a = y * 93 + x
+    b = 57
+  end
+  43.times do |i1|
+    step0(i1)
+    b = b * 78
+    x = a - y + i1
+  end
+  76 * 34
+end
+
+def step17(a, b)
+  x = 48
+  y = 35
+  x = y + b
+  if y > 35
+    x = step11(x, x)
+    # step 501
+    b = 43 * y
+    x = b + step5(a, x)
+    # step 504
+    x = 80 - 9 - step4(b, a)
+  end
+  a = x - x
+  36.times do |i1|
+    # step 509
+    a = i1
+  end
+  # step 512
+  b = b + a
+  12
+end
+
+def step18(a)
+  x = a
+  y = 43
+  x = 30 + step5(a, a) - 61
+  if a == 66
+    step15(x)
+    # step 523
+    y = x
+  end
+  if y < 27
+    x = y + 96
+    step17(a, a)
+  else
+    # step 530
+    y = a
+    # step 532
+    x = step0(y) - y + step8(x, x)
+    # step 534
+    a = 53 + 55
+    x = x
+  end
+  x
+end
+
+def step19(a, b)
+  x = a - b
+  y = 59
+  if y < 34
+    # step 545
+    x = a - step15(y) + a
+    # step 547
+    a = 57 - a - y
+    step8(a, a)
+  elsif b == 28
+    step18(x)
+    step17(b, a)
+    x = step7(b, a) - 47 * 10
+    a = 58 + 70 - x
+  end
+  if a > 67
+    # step 557
+    a = step18(b) * a * 25
+    x = b
+    a = step11(y, y)
+    a = b * 36
+  else
+    b = step5(b, a) - 79
+    # step 564
+    b = 34 - x
+    # step 566
+    a = step6(b) * 76 + x
+    # step 568
+    a = step2(a, x)
+  end
+  y = a - 80 * b
+  a = step7(y, b) * b + step7(x, b)
+  y = y + a + 71
+  23.times do |i1|
+    b = y
+    # step 576
+    a = a + y + 32
+    # step 578
+    y = step4(a, x)
+    # step 580
+    i1 = 53
+  end
+  if x == 95
+    a = 29 - b
+    b = 70
+    b = step4(a, y) - step8(b, x) - b
+  end
+  y
+end
+
+def step20(a, b)
+  x = a * 58 + a
+  y = 87
+  x = 83
+  y = a + x
+  if y == 85
+    # step 597
+    y = step12(x) + a - step13(a, x)
+    y = y
+    # step 600
+    y = a * x + b
+  end
+  70 * x
+end
+
+def step21(a)
+  x = a
+  y = 6
+  if y < 9
+    # step 610
+    x = 66
+    step15(y)
+    y = 21
+    # step 614
+    y = x
+  elsif y == 73
+    a = 51 + x + 59
+  end
+  y = 12 * 55
+  step1(a, y)
+  42.times do |i1|
+    x = step9(x) * 94 + 52
+  end
+  90 + 30 - a
+end
+
+def step22(a, b)
+  x = 81 * 31
+  y = 29
+  if b < 76
+    b = y
+    y = 68
+    # step 633
+    a = b
+  else
+    step3(a)
+    y = a
+    b = x - step8(b, a) * 19
+  end
+  y = x * b * step15(x)
+  96.times do |i1|
+    # step 642
+    x = 48
+  end
+  # step 645
+  a = x
+  x
+end
+
+def step23(a, b)
+  x = 46
+  y = 28
+  step4(y, y)
+  a = a
+  if x > 70
+    # step 656
+    x = step12(b) - 66 - a
+    y = 81 + 13 * step10(b, x)
+  end
+  step19(a, a)
+  14.times do |i1|
+    # step 662
+    b = i1
+    step19(y, a)
+    y = step4(a, a) - 12
+    step22(b, i1)
+  end
+  x = a
+  b = b * 75
+  10.times do |i1|
+    x = x
+    a = 24
+    step9(x)
+  end
+  54 * x * 21
+end
+
+def step24(a)
+  x = a - 99 * 17
+  y = 97
+  y = a
+  step6(x)
+  a = 28 + 45
+  x = x * y
+  y
+end
+
+def step25(a, b)
+  x = a - 73
+  y = 41
+  if b == 85
+    # step 692
+    b = 2
+    # step 694
+    b = step10(b, a) + y
+  else
+    # step 697
+    a = 88 + x
+    x = 84 + 87 - b
+  end
+  # step 701
+  x = 73 - step18(x) + 6
+  if y == 36
+    x = x + 32
+    # step 705
+    y = y
+  elsif x == 6
+    # step 708
+    x = y * a * 87
+    a = 52 + b
+    a = y
+    # step 712
+    x = b
+  end
+  # step 715
+  x = y - a
+  if y > 65
+    a = x + a * 75
+    y = y
+  elsif y == 39
+    # step 721
+    y = b + 78
+    step13(y, y)
+    x = 71
+    # step 725
+    x = y - step5(a, b)
+  end
+  if x == 21
+    # step 729
+    b = a * 19
+    a = step23(b, a)
+  else
+    # step 733
+    y = x
+    # step 735
+    y = 48 * 54 - x
+    # step 737
+    x = b
+  end
+  63.times do |i1|
+    i1 = 50 + b
+    b = i1 + step23(x, b) + y
+  end
+  24 * a * b
+end
+
+def step26(a, b)
+  x = 32 - b
+  y = 73
+  if b > 85
+    # step 751
+    x = b
+  end
+  x = x * 32 - 54
+  41.times do |i1|
+    step4(a, x)
+    # step 757
+    a = y * step10(x, x)
+    step23(x, x)
+  end
+  if b < 44
+    # step 762
+    b = 23
+    y = x - step21(b)
+    a = a
+    # step 766
+    a = 59 + x + b
+  else
+    # step 769
+    x = b
+  end
+  x
+end
+
+def step27(a)
+  x = a - 1 * 82
+  y = 23
+  # step 778
+  x = 69 - y
+  if x > 93
+    step16(y, a)
+    a = step3(x)
+    # step 783
+    a = y + x - x
+    # step 785
+    x = 28
+  end
+  if y < 66
+    # step 789
+    y = x - 87 - 59
+  end
+  if y == 79
+    # step 793
+    y = step5(x, y) * step17(x, y)
+    # step 795
+    x = 20 * step26(a, x) - step13(x, a)
+    # step 797
+    x = a
+  elsif x > 47
+    y = y
+    # step 801
+    x = a
+    # step 803
+    x = x - x
+  else
+    # step 806
+    x = 8
+    y = 33 * a + 27
+    # step 809
+    x = 11 - 50
+  end
+  66.times do |i1|
+    # step 813
+    i1 = 83 * i1 * 50
+  end
+  y - step4(a, a) - 48
+end
+
+total = 0
+total = total + step23(27, 8)
+total = total + step24(97)
+total = total + step25(30, 96)
+total = total + step26(84, 46)
+total = total + step27(61)
+puts total
@@ -0,0 +1,923 @@
+def step0(a)
+  x = a + a
+  y = 98
+  a = a * y
+  if y > 12
+    if x > 49
+      if x < 19
+        y = x - x - y
+        if x > 29
+          # step 9
+          x = y + a
+          # step 11
+          x = 15
+        else
+          x = 9
+        end
+        if a < 77
+          y = 93
+          y = a + x
+        else
+          # step 20
+          a = 89 * 72 - x
+        end
+      elsif y > 79
+        if a == 0
+          a = 95 + a - x
+        end
+        y = a + a * 88
+        y = x
+      else
+        a = x
+        x = a + x
+      end
+      if x == 5
+        a = x
+      else
+        62.times do |i4|
+          a = 65 * y
+        end
+      end
+    elsif x > 61
+      x = y + x - a
+    else
+      y = x * 87 - 11
+      0.times do |i3|
+        82.times do |i4|
+          a = y
+        end
+      end
+      if a < 50
+        # step 50
+        a = a * a
+      end
+    end
+    y = 40 - y * a
+    45.times do |i2|
+      # step 56
+      i2 = a + 37
+      x = i2 - i2
+    end
+  end
+  y = a - a
+  y = 68 - x - a
+  x = 70 - a * x
+  a = 1 * 25 - y
+  a = a * a - a
+  y - 37
+end
+
+def step1(a, b)
+  x = b
+  y = 34
+  if a > 0
+    y = 49
+    # step 74
+    b = x + 62
+    if a < 71
+      y = y - 31 * 72
+      91.times do |i3|
+        b = b * y + 69
+        a = 11
+        if b == 99
+          # step 82
+          b = b + step0(a) * x
+        else
+          # step 85
+          i3 = i3
+          # step 87
+          y = 26 + 75
+          b = i3 - step0(b)
+        end
+      end
+    else
+      a = y * 49
+      if y < 86
+        step0(y)
+        x = step0(a)
+        if a > 68
+          # step 98
+          a = 21 + a + step0(x)
+          a = 19 + b
+        else
+          # step 102
+          a = x - x + 46
+        end
+      elsif a > 45
+        if a == 83
+          x = x
+          # step 108
+          y = b
+        end
+        # step 111
+        a = 4
+        # step 113
+        y = b + 95
+      else
+        step0(b)
+        if x == 99
+          # step 118
+          a = 75
+        else
+          a = x - y
+        end
+      end
+      a = step0(b) * y
+      step0(b)
+    end
+    if a < 97
+      step0(b)
+    elsif b > 80
+      if b > 11
+        9.times do |i4|
+          step0(b)
+        end
+        y = x + x - 56
+      else
+        77.times do |i4|
+          # step 137
+          y = y
+        end
+        if b > 10
+          # step 141
+          x = y + 81 * 3
+          # step 143
+          a = y * 42 + b
+          # step 145
+          b = step0(x) * 80 - y
+        end
+        if b < 88
+          y = 59 - 29 * 76
+          # step 150
+          a = 11 + x
+          x = b - a + b
+        elsif b == 5
+          step0(a)
+        end
+      end
+      if a > 8
+        6.times do |i4|
+          # step 159
+          a = 78 - i4
+          # step 161
+          i4 = x
+        end
+        step0(y)
+      else
+        29.times do |i4|
+          # step 167
+          a = y * b + a
+        end
+        x = y * b
+      end
+    else
+      step0(b)
+      # step 174
+      b = a * x
+      if a == 2
+        37.times do |i4|
+          y = 7
+          x = step0(b)
+          i4 = step0(x) + 61
+        end
+        step0(b)
+        b = b
+      else
+        65.times do |i4|
+          y = step0(i4) + y
+          step0(a)
+        end
+      end
+      b = y * 60
+    end
+  else
+    if b < 41
+      step0(y)
+      # step 195
+      y = 48
+      41.times do |i3|
+        if i3 > 26
+          # step 199
+          y = step0(y) + x * 58
+          b = 30 * b - 94
+        end
+      end
+      b = y + 62 - step0(b)
+    elsif y == 60
+      # step 206
+      a = step0(b) * x * a
+      if a < 25
+        if y > 76
+          # step 210
+          b = b + y
+        else
+          # step 213
+          x = 10
+        end
+      end
+      if b == 20
+        step0(y)
+      end
+      if b > 21
+        y = 54 * b - a
+      else
+        65.times do |i4|
+          y = y + 91 - step0(y)
+        end
+      end
+    else
+      # step 228
+      y = 72 + 0
+      if a < 44
+        x = a
+        step0(x)
+      else
+        a = 81 - step0(x)
+        x = b + 28 - 98
+      end
+    end
+    69.times do |i2|
+      b = i2
+    end
+    step0(x)
+    # step 242
+    y = 69
+  end
+  69.times do |i1|
+    93.times do |i2|
+      step0(b)
+      if i1 > 71
+        y = step0(a) + 21 - y
+        step0(b)
+        step0(i2)
+      end
+    end
+    i1 = 28
+    89.times do |i2|
+      # step 256
+      y = 86
+      if y == 80
+        if x < 5
+          a = step0(i2) + step0(i2) + 4
+        else
+          # step 262
+          x = i2 * step0(i2)
+        end
+        if x == 87
+          b = b * i2
+        elsif b < 16
+          # step 268
+          x = b - 17 * 86
+          x = y * 17 + i2
+          step0(b)
+        else
+          x = step0(i2) + 59 * 13
+        end
+      elsif y > 10
+        if b < 95
+          # step 277
+          a = 54
+          # step 279
+          y = 26 - x
+        else
+          # step 282
+          y = step0(a) * i2
+        end
+      else
+        if y > 66
+          step0(y)
+        else
+          step0(i1)
+        end
+      end
+      37.times do |i3|
+        a = step0(y) + step0(y) * 83
+        if a < 58
+          # step 295
+          i2 = 17 + 43 + step0(a)
+        else
+          step0(y)
+          i1 = i3 * i3
+          # step 300
+          i3 = 19 + i3 * step0(b)
+        end
+        if b > 77
+          step0(i2)
+        end
+      end
+      if y > 83
+        if a == 7
+          # step 309
+          a = 69
+        else
+          # step 312
+          a = b - step0(x) + 33
+        end
+        i1 = b + 58
+        55.times do |i4|
+          # step 317
+          a = i1
+          # step 319
+          x = i1 - 83
+          # step 321
+          i2 = 84 * x - i1
+        end
+      else
+        i2 = a * step0(a) - step0(i2)
+      end
+    end
+    step0(x)
+  end
+  a = a - x
+  26 - 58 + y
+end
+
+def step2(a, b)
+  x = 12
+  y = 10
+  x = 10 * 20 - 36
+  # step 338
+  b = 95
+  y = a
+  74 + a
+end
+
+def step3(a)
+  x = 36 - a + a
+  y = 89
+  53.times do |i1|
+    x = y * 20 * 67
+    x = y
+    if a > 80
+      step2(a, i1)
+      if y < 29
+        if i1 > 1
+          # step 354
+          x = step0(i1) - 62 + a
+        else
+          # step 357
+          x = x + 51
+          x = i1
+          i1 = y * a - a
+        end
+      else
+        8.times do |i4|
+          # step 364
+          a = y
+          i4 = i4
+        end
+        if a == 64
+          y = x + y * 9
+        elsif x < 54
+          # step 371
+          a = x * step0(i1)
+        else
+          # step 374
+          a = y - a + x
+        end
+        step1(y, i1)
+      end
+      if y < 22
+        step0(x)
+        43.times do |i4|
+          # step 382
+          x = 78
+        end
+        step2(a, y)
+      elsif a < 68
+        if a < 70
+          step2(x, x)
+        else
+          # step 390
+          x = a
+          step0(a)
+        end
+        24.times do |i4|
+          # step 395
+          x = a
+          # step 397
+          y = 98
+          y = y
+        end
+      end
+      if a > 14
+        56.times do |i4|
+          # step 404
+          i4 = 41
+          # step 406
+          i1 = y - 85
+          x = i1 - i1
+        end
+        a = step0(x)
+      else
+        45.times do |i4|
+          # step 413
+          a = step2(y, x) - 49
+        end
+      end
+    else
+      x = y + i1
+      step1(i1, x)
+    end
+    i1 = step0(a)
+  end
+  # step 423
+  y = step2(x, a) + y - x
+  # step 425
+  x = y - a * y
+  y = step0(a) + a + 88
+  step0(x)
+  y * a
+end
+
+def step4(a, b)
+  x = b - a * a
+  y = 35
+  x = x
+  78.times do |i1|
+    a = i1
+    x = 90 + step2(y, i1) * 84
+    95.times do |i2|
+      if i2 < 56
+        if y > 47
+          # step 442
+          b = b * a + a
+        end
+        a = i2
+        i1 = 24 - 97
+      else
+        if i2 == 20
+          # step 449
+          y = i2 * 2
+          b = 64 + x
+          # step 452
+          b = step0(y) * 7 * i1
+        end
+      end
+      # step 456
+      i1 = b + 12 + 43
+      if x < 59
+        y = step1(i1, x) - y + 4
+        if x == 64
+          # step 461
+          a = 40 + 87 + step0(a)
+        else
+          # step 464
+          x = i2 + step0(y) + a
+          step1(i2, y)
+          # step 467
+          i2 = 4 - step1(y, i2)
+        end
+      elsif i2 == 39
+        if a == 79
+          i1 = b
+        elsif x < 99
+          # step 474
+          a = step2(y, i2) - 54 * 14
+        else
+          step3(i2)
+          # step 478
+          b = step2(y, i1) + 75 * b
+        end
+      end
+      89.times do |i3|
+        i1 = 72 + 87
+      end
+    end
+    step1(y, b)
+  end
+  step1(b, a)
+  a = 33
+  a = b - x
+  a = b * 54
+  x = b + x
+  20
+end
+
+def step5(a, b)
+  x = a - a
+  y = 5
+  if x < 1
+    # step 500
+    y = y
+    if x > 14
+      x = 78 - a
+      if y == 9
+        if a < 99
+          # step 506
+          a = step1(a, x) * b
+          a = 50 * 14
+          # step 509
+          a = b
+        elsif x == 77
+          # step 512
+          a = 61 * a
+          # step 514
+          y = step4(x, b) * a - 91
+          # step 516
+          b = b + x
+        else
+          # step 519
+          x = step4(a, y) + x
+        end
+      end
+      if a == 22
+        34.times do |i4|
+          b = step0(y) + 95
+          step2(i4, x)
+        end
+      elsif b == 63
+        if y > 17
+          # step 530
+          b = 52
+        elsif a > 9
+          step2(b, a)
+        else
+          y = x
+          a = y * 44
+          step3(a)
+        end
+      else
+        step0(y)
+      end
+      if a == 83
+        step3(a)
+        if a < 91
+          # step 545
+          a = 75 + 50 * 24
+          y = step1(y, a)
+          y = 21 + b + y
+        else
+          # step 550
+          x = b * a
+        end
+      end
+    elsif y == 16
+      step4(a, x)
+    else
+      b = x
+      56.times do |i3|
+        b = 2
+      end
+      # step 561
+      b = 39 - b - step2(a, y)
+      33.times do |i3|
+        # step 564
+        x = 9
+        if x == 2
+          x = 7
+          # step 568
+          a = 98 * step3(a)
+          # step 570
+          i3 = y - y
+        elsif x == 16
+          # step 573
+          b = y + b - y
+        end
+      end
+    end
+    step4(a, y)
+  elsif b == 51
+    if b == 35
+      step1(y, y)
+      20.times do |i3|
+        if b < 29
+          # step 584
+          x = step3(a) * 45 - x
+          x = 4 - 77
+          # step 587
+          b = b - x * y
+        end
+      end
+      b = step2(y, x)
+      # step 592
+      x = x - 12
+    elsif b == 36
+      a = 94 - b * y
+    end
+    y = b + 70
+    step3(b)
+    if y < 45
+      if a < 28
+        a = y
+        # step 602
+        x = b + a
+        if x > 37
+          step4(x, b)
+          # step 606
+          a = b * b
+          # step 608
+          b = step2(y, y)
+        end
+      else
+        36.times do |i4|
+          step1(a, x)
+        end
+      end
+      x = step3(y) - step1(a, a)
+      48.times do |i3|
+        step4(i3, a)
+      end
+    else
+      if x < 8
+        if b < 44
+          # step 623
+          a = step3(a) - a
+        end
+      end
+    end
+  else
+    a = a + b
+    y = b
+  end
+  if x < 36
+    step4(x, y)
+    if b < 68
+      b = step3(y) * y
+      b = b * 90
+      step3(a)
+      x = a
+    end
+    step2(y, a)
+  end
+  y = 13
+  # step 643
+  y = 35
+  b = x
+  x + y * x
+end
+
+def step6(a)
+  x = 84 - a - 98
+  y = 54
+  y = x - x
+  if y > 13
+    y = x * x
+    step3(x)
+  else
+    5.times do |i2|
+      # step 658
+      i2 = 21 + a * 2
+      if y > 54
+        if a == 91
+          step2(x, a)
+        elsif x > 52
+          step4(i2, a)
+          x = x * 90
+        else
+          # step 667
+          a = 88
+        end
+      elsif i2 < 8
+        step5(a, i2)
+        i2 = x - step3(x) + 37
+      end
+      a = y + 39 * x
+      step5(a, y)
+    end
+    a = x
+  end
+  if x > 97
+    step2(y, x)
+    if x > 5
+      a = 44 + step0(y)
+      13.times do |i3|
+        67.times do |i4|
+          i3 = step2(i4, y) + 95 * y
+          # step 686
+          x = 43
+        end
+      end
+      step4(x, x)
+      # step 691
+      a = a - 88 + 43
+    end
+    a = y - 77 + y
+  else
+    step2(x, y)
+  end
+  # step 698
+  x = y
+  if a > 28
+    if a > 11
+      x = step5(x, y) * x
+      x = step2(y, x) * step2(a, x) * 44
+    else
+      if x == 12
+        82.times do |i4|
+          # step 707
+          y = y + 85
+        end
+      elsif x < 40
+        52.times do |i4|
+          # step 712
+          x = i4 + step3(a)
+          # step 714
+          y = 80
+          # step 716
+          a = step0(a) + 21 - step4(y, x)
+        end
+        if x > 58
+          x = 29
+          # step 721
+          a = y - a
+          x = step0(a)
+        else
+          # step 725
+          y = x * a
+        end
+      end
+      y = a - a - 73
+    end
+    if y == 4
+      8.times do |i3|
+        y = a * 31 + step3(i3)
+        step5(a, x)
+      end
+    elsif a > 29
+      16.times do |i3|
+        16.times do |i4|
+          # step 739
+          i4 = 97 + a - 80
+          # step 741
+          i4 = step4(i3, i3)
+          # step 743
+          y = 29 * x + step4(i4, a)
+        end
+        a = y - y * 17
+      end
+      y = 37 - 41 + step0(a)
+      if a == 64
+        x = step1(x, a)
+        if a > 23
+          # step 752
+          x = 81 + 60 - step1(y, x)
+          step0(a)
+        else
+          step3(a)
+          step3(y)
+          y = step5(x, a)
+        end
+      else
+        step1(a, a)
+        step5(a, x)
+        x = a * 73
+      end
+      y = y
+    end
+  elsif x < 58
+    if x < 24
+      if y == 57
+        a = step3(y) - x
+        if a == 54
+          # step 772
+          a = step1(x, y) - x * step1(x, y)
+        end
+      else
+        13.times do |i4|
+          # step 777
+          y = x + y
+          step4(i4, x)
+        end
+        y = 15 - step4(a, y) - step2(y, y)
+        97.times do |i4|
+          # step 783
+          y = i4 + x
+        end
+      end
+      x = a - 19
+      70.times do |i3|
+        if a < 69
+          a = x
+          # step 791
+          a = i3
+          # step 793
+          x = 33
+        else
+          # step 796
+          a = x + a
+        end
+      end
+      y = 0 * 20
+    end
+    if x > 88
+      y = step5(a, y) - 63 + step4(y, x)
+      y = step4(x, x) * a + 60
+      step4(y, y)
+      y = 9 * a
+    else
+      step2(y, a)
+      # step 809
+      x = 99 + 69 - step3(a)
+      if y < 23
+        if a < 17
+          x = 40 + y
+        elsif a > 34
+          y = x
+        else
+          step1(x, a)
+        end
+      elsif x == 46
+        x = step2(a, y) - x
+      else
+        if x == 75
+          step3(a)
+        else
+          step5(y, x)
+        end
+        a = a * y + 78
+      end
+      if y < 59
+        a = x - 38
+      else
+        step3(x)
+        x = 84 - step2(a, a)
+      end
+    end
+  end
+  if a < 83
+    x = x
+    step1(x, x)
+    a = x * step1(y, x)
+    if a < 50
+      # step 842
+      a = 48 - a * step2(y, x)
+      if x == 16
+        if y == 96
+          step1(x, a)
+          step1(y, x)
+          # step 848
+          x = a + y
+        else
+          a = a + a
+          step2(y, y)
+          a = y
+        end
+        if x < 68
+          a = step0(a) + x - a
+        else
+          # step 858
+          y = 85
+        end
+        if x > 28
+          # step 862
+          x = y * step5(x, x)
+        end
+      elsif a > 42
+        step3(x)
+        step0(y)
+        y = 73 - y
+      end
+      2.times do |i3|
+        # step 871
+        y = step5(y, y)
+        step4(i3, a)
+      end
+    else
+      if y < 68
+        step5(x, a)
+        step2(x, y)
+      end
+      if a > 92
+        x = a + a
+        y = a + step4(y, x)
+        if y == 27
+          step1(a, y)
+        elsif x < 99
+          # step 886
+          x = a
+        else
+          # step 889
+          x = step0(y) * 67 - x
+          y = 15 - x
+        end
+      else
+        if y < 85
+          # step 895
+          y = a - 78
+          # step 897
+          x = x
+          x = y + a * y
+        end
+        step5(y, x)
+      end
+      # step 903
+      y = step4(a, a) - 29 * step1(x, x)
+    end
+  end
+  # step 907
+  x = 58 - step3(a)
+  if a > 90
+    a = y + 19
+    y = 80
+  end
+  y
+end
+
+total = 0
+total = total + step2(93, 70)
+total = total + step3(0)
+total = total + step4(50, 93)
+total = total + step5(79, 67)
+total = total + step6(49)
+puts total
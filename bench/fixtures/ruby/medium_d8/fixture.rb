@@ -0,0 +1,1441 @@
+def step0(a)
+  x = 91 + a * a
+  y = 76
+  if x == 10
+    y = 58 + y + a
+    31.times do |i2|
+      a = x * 18 + y
+      if y < 62
+        a = y
+      end
+      # step 10
+      a = a
+    end
+    y = 39 * 84
+    if x > 48
+      if y == 15
+        a = y
+      else
+        y = x + y
+      end
+      # step 20
+      y = a
+      y = 99 * 34 * x
+      if a < 47
+        if a > 99
+          # step 25
+          y = x * 88
+          # step 27
+          x = a * a - x
+        else
+          if a < 62
+            # step 31
+            x = y * 22 - y
+            53.times do |i6|
+              if i6 < 49
+                if x < 11
+                  y = x * x + x
+                else
+                  # step 38
+                  x = 25 - i6 + i6
+                end
+              else
+                if y > 1
+                  # step 43
+                  a = 25 + 62
+                else
+                  x = a - 3 * y
+                end
+                y = a + 47 * 6
+              end
+              31.times do |i7|
+                if i7 == 84
+                  # step 52
+                  i6 = a * 38 + 58
+                  # step 54
+                  a = y
+                end
+              end
+            end
+            73.times do |i6|
+              y = a - x
+            end
+          else
+            x = x - 92 + 47
+            a = 58
+            if x < 30
+              # step 66
+              y = a - x
+            end
+          end
+          y = 62
+          y = x * y * y
+        end
+      end
+    else
+      if x < 13
+        # step 76
+        a = x
+        a = y + y
+        a = 95 + y - y
+      elsif a == 51
+        a = y
+      else
+        x = 83 + 69 - y
+        62.times do |i4|
+          a = x + a * x
+          if a < 5
+            i4 = x + i4
+            if y < 72
+              31.times do |i7|
+                i7 = i7 + i7 * 32
+                x = i4 - y
+              end
+            else
+              i4 = 69
+            end
+          else
+            if y > 96
+              a = 72
+            elsif a > 78
+              38.times do |i7|
+                y = a * a
+              end
+              i4 = 5 + y
+            else
+              53.times do |i7|
+                if a == 61
+                  # step 107
+                  a = 11 + 82
+                elsif x == 66
+                  # step 110
+                  i7 = 9 * i4 - y
+                  # step 112
+                  y = x
+                else
+                  # step 115
+                  a = i7 * 86 - y
+                end
+                a = i7
+              end
+            end
+          end
+        end
+      end
+    end
+  elsif y < 95
+    # step 126
+    x = 91 + y
+    if x == 7
+      a = 48 + y
+      if y > 23
+        a = y * y * a
+        if x > 6
+          if y == 69
+            44.times do |i6|
+              y = 54
+            end
+            if x == 37
+              x = 89
+            else
+              95.times do |i7|
+                a = 37 - x
+              end
+              a = 43
+            end
+            if a > 58
+              if y > 29
+                y = a
+              elsif x > 10
+                a = y * 95 + 47
+              end
+              y = x - y + 0
+            end
+          end
+        elsif a > 47
+          # step 155
+          x = x * x - y
+          66.times do |i5|
+            if a < 15
+              x = a + x - a
+            else
+              a = x
+            end
+            i5 = 2 - y + 76
+          end
+          if y > 69
+            if x > 37
+              # step 167
+              a = 6
+            end
+            y = 25 + 22 - 2
+            if y > 55
+              if y > 46
+                28.times do |i8|
+                  # step 174
+                  x = a
+                end
+              end
+            elsif y == 32
+              22.times do |i7|
+                if a == 39
+                  # step 181
+                  x = y + x * i7
+                end
+              end
+            end
+          else
+            if y > 7
+              y = 67 + a
+            end
+            # step 190
+            a = a + x - 66
+            if a > 21
+              if y < 1
+                if x == 73
+                  a = a - y
+                else
+                  a = 25
+                  # step 198
+                  x = 78 + 47 * 98
+                end
+              else
+                y = a + a
+              end
+              28.times do |i7|
+                if x == 83
+                  # step 206
+                  x = 49 * 99
+                end
+              end
+            elsif x > 9
+              y = y - a
+            end
+          end
+        else
+          # step 215
+          a = x * 90
+        end
+      end
+      y = 91 * a + 98
+      a = x - x * 27
+    end
+  else
+    y = 65 * 75 + x
+    x = 49
+    if x == 35
+      if y < 45
+        x = y
+      end
+      21.times do |i3|
+        a = a + 24 * x
+      end
+    else
+      if y < 6
+        y = 33
+        # step 235
+        y = a + a * a
+      else
+        # step 238
+        a = y - y
+      end
+      y = 2 - x - x
+      # step 242
+      y = 37 * a * x
+      if x < 43
+        a = 98 + x
+        x = 3 * 56 + x
+        if y < 95
+          y = x + 78
+          x = 53
+        elsif a == 95
+          a = a * x * 27
+          if y == 32
+            30.times do |i6|
+              i6 = y + i6 * a
+            end
+          elsif y < 5
+            # step 257
+            x = x - y + a
+            21.times do |i6|
+              i6 = a - 32 - i6
+            end
+            x = 68
+          else
+            a = y
+            if y < 13
+              45.times do |i7|
+                if i7 == 43
+                  # step 268
+                  a = x - a
+                else
+                  # step 271
+                  y = y
+                end
+              end
+            else
+              # step 276
+              a = a
+            end
+          end
+        else
+          x = a + y * 8
+          a = 21
+          8.times do |i5|
+            y = y
+            if i5 == 61
+              61.times do |i7|
+                if a > 29
+                  # step 288
+                  x = y - x * x
+                else
+                  # step 291
+                  y = 34
+                  i5 = a
+                end
+              end
+            elsif x < 94
+              if a == 48
+                if a > 42
+                  # step 299
+                  i5 = x + a
+                  # step 301
+                  x = y + y - x
+                end
+                if x > 84
+                  i5 = y
+                elsif i5 < 83
+                  # step 307
+                  i5 = 38
+                end
+              end
+            else
+              x = a
+            end
+          end
+        end
+      end
+    end
+    if y == 80
+      y = x * a + 84
+      if x > 3
+        36.times do |i4|
+          if x == 85
+            if y == 6
+              i4 = a
+            elsif y < 34
+              98.times do |i7|
+                if y < 23
+                  # step 328
+                  a = y - i7 + 20
+                  a = x - 42 * 50
+                end
+              end
+            else
+              if i4 == 83
+                y = 77 - 98 - y
+              end
+              x = a
+            end
+            # step 339
+            i4 = i4 * x
+          else
+            if x > 22
+              if a < 35
+                if i4 < 56
+                  # step 345
+                  y = 25
+                end
+              else
+                i4 = 58 * x * x
+                if i4 > 80
+                  # step 351
+                  x = a - x
+                elsif i4 > 85
+                  y = i4
+                end
+              end
+            else
+              # step 358
+              a = 75 + i4
+            end
+            a = a * a * a
+            64.times do |i6|
+              a = 59 - 75
+            end
+          end
+          x = i4 + a + 82
+          i4 = 20 + a + y
+        end
+        x = 43 * 15
+        x = a - 70 - a
+      else
+        if y == 12
+          if x > 69
+            y = 40 + 88
+          end
+          88.times do |i5|
+            72.times do |i6|
+              i5 = a + 67 * 19
+            end
+            i5 = 71
+          end
+          a = 39 + a
+        end
+      end
+      # step 385
+      y = x
+    end
+  end
+  if x == 68
+    # step 390
+    x = a + x + 97
+    if x > 38
+      if x == 39
+        x = 18 - 32 * 41
+        y = x * x * a
+      end
+    else
+      44.times do |i3|
+        if a < 61
+          if x < 17
+            41.times do |i6|
+              if y == 72
+                0.times do |i8|
+                  i8 = a - i8
+                end
+                if i6 < 45
+                  x = x + x
+                elsif a > 86
+                  i3 = y
+                end
+              end
+            end
+            3.times do |i6|
+              if i3 < 50
+                if a == 75
+                  # step 416
+                  i3 = x * 6
+                elsif i3 > 58
+                  i6 = i6 + 53
+                end
+                # step 421
+                i3 = 74
+              else
+                a = i6 - a * y
+              end
+            end
+            x = 36 * a * x
+          else
+            x = y * 43 + a
+            if x == 19
+              85.times do |i7|
+                # step 432
+                y = a
+                y = i3 - x
+              end
+            else
+              y = a - 85 - x
+            end
+          end
+          a = i3
+        elsif a > 87
+          # step 442
+          i3 = a - a
+          96.times do |i5|
+            13.times do |i6|
+              y = i5 + 54
+            end
+            a = i3 + 19
+          end
+          i3 = a - a + a
+        end
+        y = y
+        y = i3 - y
+      end
+    end
+    if a < 52
+      if a > 41
+        a = 52 * y
+      end
+      y = y
+      if y == 51
+        if a == 33
+          if x < 12
+            y = x - x
+            if y > 88
+              if a == 70
+                a = a
+              else
+                87.times do |i8|
+                  x = i8 + y
+                  a = a
+                end
+              end
+              60.times do |i7|
+                # step 475
+                x = 83
+              end
+            end
+          else
+            x = y
+            x = x * 59 + x
+            if x > 19
+              y = 53 - a + y
+            else
+              x = y
+            end
+          end
+          if y > 1
+            if x < 57
+              if x > 70
+                43.times do |i8|
+                  y = x
+                  # step 493
+                  x = a - x
+                end
+                if y < 89
+                  a = a * y
+                end
+              else
+                a = x
+              end
+            elsif a > 68
+              x = 21 - x * 86
+            end
+            # step 505
+            y = a + 74
+            31.times do |i6|
+              20.times do |i7|
+                i7 = 97
+              end
+            end
+          else
+            if y == 54
+              a = a - 51 - 14
+            else
+              x = x - x
+              y = 10 - 46 + 17
+            end
+            y = a - y * a
+            75.times do |i6|
+              # step 521
+              a = x + 64
+            end
+          end
+          # step 525
+          a = a
+        else
+          y = x
+          53.times do |i5|
+            i5 = a
+            y = 61 + i5 + 98
+            x = x - y - x
+          end
+        end
+        x = x * a
+        if x > 89
+          96.times do |i5|
+            x = i5
+            80.times do |i6|
+              i5 = 2 * y
+              if y == 22
+                x = 76
+              end
+            end
+          end
+        elsif y == 91
+          a = x + 36 * y
+          x = a - 73
+          y = x + 65 - x
+        else
+          y = y * y + a
+          if y == 94
+            # step 553
+            x = y
+            if y == 64
+              x = y
+              if a == 14
+                y = 4 + a * a
+              else
+                y = a
+              end
+            else
+              a = 21 * 44 * y
+            end
+            if a > 1
+              # step 566
+              a = 63
+            elsif y > 3
+              if y < 78
+                # step 570
+                y = y - x
+              else
+                a = 16 + y - y
+              end
+            end
+          else
+            y = x - a
+            x = 70 + y
+          end
+          # step 580
+          a = 15 - a - x
+        end
+      else
+        if y > 95
+          if y > 2
+            if x < 44
+              if x == 7
+                if a == 60
+                  y = y - y + y
+                  # step 590
+                  x = y * a - y
+                end
+              end
+            else
+              x = a
+            end
+            a = a - 47 + 42
+            # step 598
+            y = 29 + y
+          elsif x > 81
+            if x > 89
+              # step 602
+              x = y
+            elsif a < 86
+              y = 12
+            else
+              y = x
+            end
+            # step 609
+            y = 10 * x
+            95.times do |i6|
+              if a == 60
+                if a > 24
+                  # step 614
+                  i6 = y - a
+                end
+              elsif x > 2
+                x = y
+              else
+                i6 = y + 45
+                11.times do |i8|
+                  y = 35
+                  # step 623
+                  x = a + i6
+                end
+              end
+            end
+          else
+            # step 629
+            a = y * x
+          end
+          a = x + y - a
+        elsif y < 45
+          if y == 43
+            59.times do |i6|
+              a = 86
+              a = 76 + 92
+            end
+          elsif a < 58
+            x = a - y * y
+          else
+            # step 642
+            x = y - y
+          end
+          x = a * 14
+          x = y
+        else
+          y = 28 - a
+        end
+      end
+      47.times do |i3|
+        if a > 38
+          if i3 > 41
+            y = y * 34
+            a = a
+            x = 18
+          end
+          if x > 49
+            if y == 94
+              a = 39 + x
+            end
+          elsif x > 65
+            if x == 25
+              a = a
+              94.times do |i7|
+                if x == 98
+                  # step 667
+                  i7 = 88
+                else
+                  a = i3
+                end
+              end
+            else
+              a = a - y
+            end
+          end
+        else
+          if i3 > 87
+            a = x
+          end
+        end
+      end
+    elsif a == 11
+      # step 684
+      x = y + 55 + x
+      x = x * a
+      62.times do |i3|
+        if i3 > 2
+          if x > 96
+            i3 = y - i3
+            i3 = x
+            a = a
+          elsif i3 < 39
+            y = y
+            y = 64
+          else
+            42.times do |i6|
+              if i6 > 92
+                y = x * x * 87
+              else
+                93.times do |i8|
+                  # step 702
+                  x = 49 * x
+                end
+              end
+            end
+          end
+          a = x
+        elsif y < 50
+          if i3 == 14
+            if i3 > 92
+              if y < 86
+                y = i3 - i3 - i3
+              else
+                a = a - x
+              end
+            end
+            a = 82 * i3
+          elsif i3 > 5
+            # step 720
+            i3 = i3
+            if x == 0
+              i3 = a * i3
+            end
+          else
+            x = i3 + x
+          end
+          y = i3 - y
+          73.times do |i5|
+            75.times do |i6|
+              a = 30
+            end
+            i3 = i5 * a - i5
+          end
+        end
+      end
+      # step 737
+      x = y + y
+    else
+      a = a
+    end
+  else
+    a = 83
+    a = y - x
+  end
+  if a == 53
+    y = x - 71
+    a = a * 42
+  elsif y < 58
+    y = y * a
+    if x > 61
+      if x == 99
+        y = 58 + y * y
+        x = 65 * a
+      else
+        y = y - a - x
+      end
+      28.times do |i3|
+        86.times do |i4|
+          y = a
+          x = i4 * i3 * x
+        end
+        a = i3
+      end
+      if a == 6
+        a = 45
+      elsif x < 76
+        if x < 33
+          x = a + 74
+          y = y
+          y = 62 - a
+        elsif x < 55
+          x = 27 - y - x
+          if y > 0
+            if x == 8
+              y = a * 13 - a
+              y = 97 + a
+            else
+              if a > 80
+                if x < 9
+                  # step 781
+                  y = x * 11
+                  y = 48 * 50 + a
+                elsif y > 77
+                  # step 785
+                  x = y - y + 68
+                  # step 787
+                  x = 49 + 73 * a
+                end
+              end
+              if x == 86
+                y = y + x
+              else
+                if a < 93
+                  # step 795
+                  y = 44 - x - 27
+                  x = 28 - y
+                end
+              end
+            end
+          elsif y == 29
+            a = x
+            45.times do |i6|
+              if x > 55
+                43.times do |i8|
+                  # step 806
+                  i8 = a * 34 - y
+                end
+                # step 809
+                a = 58
+              elsif y > 48
+                90.times do |i8|
+                  # step 813
+                  y = 97
+                  # step 815
+                  i8 = 40 + i8 * i6
+                end
+              else
+                # step 819
+                a = i6 + a
+                a = a * 91 + 78
+              end
+            end
+          end
+          if y == 16
+            x = 27 * 26 - 93
+            x = 28 - 76 + a
+            if x < 50
+              if y > 77
+                y = x - a * 36
+                a = x * a + 47
+              end
+            elsif a < 7
+              77.times do |i7|
+                a = 63 - x
+              end
+            else
+              4.times do |i7|
+                97.times do |i8|
+                  # step 840
+                  i7 = i7 + i7 - y
+                end
+              end
+            end
+          else
+            # step 846
+            x = a
+          end
+        else
+          x = x + 72 + x
+        end
+        a = 68 - x
+      else
+        x = x - 5 * 14
+      end
+    elsif a == 67
+      if a > 72
+        if a == 73
+          x = 84 + x - a
+          if a < 14
+            x = y
+            if y == 98
+              y = y + 65
+            end
+            a = 43 - x
+          else
+            44.times do |i6|
+              i6 = x - y + 16
+            end
+            if y == 68
+              y = 96 + x
+            else
+              x = 35
+              if a == 51
+                # step 875
+                y = x - x + y
+              elsif a < 60
+                a = y * x + y
+              else
+                43.times do |i8|
+                  # step 881
+                  i8 = 30
+                end
+              end
+            end
+          end
+          # step 887
+          a = y
+        elsif a > 21
+          # step 890
+          a = x * x + x
+        end
+        y = x * y * y
+        67.times do |i4|
+          y = 50 - 53
+        end
+      end
+    else
+      # step 899
+      y = 68 + 6
+      64.times do |i3|
+        # step 902
+        i3 = 54
+      end
+      a = y * y + x
+      if a < 17
+        a = y - y - 26
+      elsif y < 14
+        x = 21
+      end
+    end
+    if y < 67
+      y = 69 + 38
+      if y > 17
+        x = a * 82
+        if y > 1
+          x = y - y + x
+          4.times do |i5|
+            a = 74 + y - 63
+          end
+        end
+        a = 25 - x + y
+      else
+        x = 81 * y
+      end
+    elsif a > 60
+      y = x + 31
+      # step 928
+      x = 14 * a
+      if y == 45
+        if a == 34
+          a = y
+        elsif a < 6
+          9.times do |i5|
+            # step 935
+            y = x * i5
+            # step 937
+            x = a + i5
+          end
+          # step 940
+          y = 11 * y
+        else
+          y = x * x - 76
+          if y > 12
+            x = a * 32
+          elsif x < 11
+            y = x + 15 - 91
+            x = x
+            y = 94
+          else
+            a = y + a + 59
+            y = 9 + 52
+          end
+        end
+      elsif y < 71
+        37.times do |i4|
+          a = i4
+          30.times do |i5|
+            44.times do |i6|
+              y = x * y - i4
+            end
+          end
+          if a > 98
+            if a < 70
+              if x > 75
+                x = 81 + i4 + 55
+              else
+                if y > 40
+                  # step 969
+                  a = 80 * x
+                else
+                  # step 972
+                  x = a
+                end
+              end
+            else
+              if y == 5
+                y = 66
+                # step 979
+                a = y - i4
+              else
+                a = i4
+                y = x
+              end
+            end
+            if y > 31
+              if i4 == 85
+                x = i4
+                y = a
+              elsif i4 < 62
+                41.times do |i8|
+                  i8 = x + 64 - 77
+                  a = a - 72
+                end
+              else
+                y = 89
+              end
+            else
+              if a < 3
+                i4 = i4
+              else
+                if x == 21
+                  # step 1003
+                  x = a + i4
+                elsif x == 56
+                  i4 = 24
+                else
+                  a = 85
+                end
+                # step 1010
+                x = y * 85 - x
+              end
+            end
+          end
+        end
+      else
+        if y == 43
+          14.times do |i5|
+            if a < 63
+              a = y
+            elsif y < 65
+              if y < 59
+                y = x
+                y = a
+              else
+                if x < 11
+                  a = y - x + 36
+                  i5 = i5
+                else
+                  # step 1030
+                  a = 99 + y
+                end
+              end
+            end
+          end
+          x = 34
+          # step 1037
+          a = 23 + a
+        end
+        50.times do |i4|
+          x = 54
+          x = y * 88 + 82
+        end
+        41.times do |i4|
+          y = a + i4 * 88
+          i4 = a - x
+          a = i4 + a - x
+        end
+      end
+    end
+  else
+    if a == 17
+      y = a * a * y
+      a = 68
+      4.times do |i3|
+        if x == 53
+          i3 = 87 * 7
+        else
+          # step 1059
+          a = 86
+        end
+      end
+      if x > 74
+        # step 1064
+        a = y - 57
+      else
+        if x > 90
+          86.times do |i5|
+            if a < 98
+              87.times do |i7|
+                i5 = a * y
+              end
+              if x == 34
+                91.times do |i8|
+                  i8 = y + 27 * i8
+                end
+              end
+            end
+            y = x
+            # step 1080
+            i5 = x - y + 71
+          end
+          # step 1083
+          a = a - x * a
+        end
+      end
+    elsif x > 0
+      y = x * 82
+    else
+      70.times do |i3|
+        66.times do |i4|
+          y = i3 - y
+        end
+        90.times do |i4|
+          x = i4 - x - y
+          69.times do |i5|
+            a = a
+          end
+          i4 = y
+        end
+        if i3 > 76
+          y = x
+        end
+      end
+      # step 1105
+      a = 87
+    end
+  end
+  if a == 35
+    # step 1110
+    a = a
+    77.times do |i2|
+      if x == 37
+        # step 1114
+        x = 50 - y * 40
+        68.times do |i4|
+          i4 = 39 + i2 + a
+        end
+      else
+        94.times do |i4|
+          if i2 == 51
+            x = 70 - a
+            if y > 3
+              if a == 60
+                # step 1125
+                i2 = i4 + a
+              end
+            else
+              if y < 60
+                # step 1130
+                y = i2 + a
+              elsif i2 == 15
+                # step 1133
+                i4 = 31 * i2 * y
+                a = a * 63 + a
+              else
+                y = 84 + y * 59
+              end
+            end
+            y = 14
+          else
+            if i4 < 77
+              if i4 < 31
+                i4 = i2 + i4
+              end
+              y = 56
+            else
+              # step 1148
+              y = a + x
+            end
+          end
+        end
+      end
+      90.times do |i3|
+        if i3 < 11
+          72.times do |i5|
+            a = 18
+          end
+        end
+        a = 14 * a
+      end
+      if a < 95
+        a = i2 + x * i2
+        y = 41 * 53
+        a = 53 + a
+      elsif i2 < 65
+        y = 2 * 82
+        i2 = 32 - i2 + x
+      end
+    end
+    if y < 8
+      if x > 50
+        # step 1173
+        x = x - 75 * a
+        y = 82 * 44
+      end
+    else
+      a = a
+      a = a + x * 24
+      if x == 40
+        97.times do |i4|
+          i4 = y - 10 + y
+          if y > 5
+            y = y + x - a
+            if a == 81
+              i4 = 71 - 45 + a
+            else
+              x = x
+            end
+            # step 1190
+            i4 = x
+          else
+            i4 = i4
+          end
+        end
+        31.times do |i4|
+          i4 = i4 + y
+        end
+      elsif a > 74
+        10.times do |i4|
+          a = y - 28 + x
+          # step 1202
+          x = 95 - i4
+        end
+      end
+      if x > 28
+        y = y
+        if x == 1
+          x = y + x * a
+        end
+        # step 1211
+        x = y + x * a
+      elsif a < 35
+        if x < 28
+          x = x
+        end
+        y = x * 32 + x
+        if x < 13
+          if y < 97
+            55.times do |i6|
+              a = 5 - 4
+              if y > 53
+                y = 53 - 3 - x
+              end
+            end
+            a = x - x + a
+            if a == 49
+              a = y
+            else
+              34.times do |i7|
+                if y == 46
+                  # step 1232
+                  x = i7
+                  # step 1234
+                  a = y
+                end
+                21.times do |i8|
+                  # step 1238
+                  y = x
+                end
+              end
+            end
+          elsif y == 57
+            # step 1244
+            y = y + x
+          end
+        end
+      end
+    end
+  elsif y < 6
+    x = x * a * 2
+    if a < 95
+      if y > 81
+        if y > 48
+          33.times do |i5|
+            59.times do |i6|
+              if i6 < 72
+                i6 = x
+              else
+                if i6 > 93
+                  # step 1261
+                  x = 6 * y
+                  # step 1263
+                  i6 = i6 + 16
+                elsif a == 38
+                  # step 1266
+                  i5 = 96 - 92
+                else
+                  i5 = y * y
+                end
+              end
+            end
+            if y > 11
+              if a > 5
+                if x < 50
+                  a = 92 - a + 78
+                else
+                  a = a
+                end
+              elsif x == 48
+                if a > 81
+                  y = x + i5
+                else
+                  # step 1284
+                  y = a
+                end
+                x = 43 - x * 67
+              end
+              45.times do |i7|
+                x = x * 32
+                if y == 5
+                  y = 25 + x + i5
+                else
+                  i7 = 62 + a
+                  # step 1295
+                  a = i5 + y
+                end
+              end
+            elsif y < 48
+              # step 1300
+              a = 4 - 7
+            end
+            y = 10 * i5 + y
+          end
+        elsif y < 13
+          x = a * y
+          x = 41 + x
+          75.times do |i5|
+            # step 1309
+            i5 = 45 - y
+            92.times do |i6|
+              31.times do |i7|
+                if x == 97
+                  # step 1314
+                  i5 = 54
+                  # step 1316
+                  y = i5 + a + y
+                end
+              end
+            end
+            a = 15 - 76
+          end
+        else
+          # step 1324
+          a = 46
+        end
+        if y < 38
+          a = 81 + 87
+          a = 41 + x
+        end
+        if y > 73
+          # step 1332
+          y = y * a * x
+        end
+      elsif y == 90
+        # step 1336
+        y = y + a - x
+        49.times do |i4|
+          x = y
+          # step 1340
+          i4 = i4 + i4
+          y = 42 * y
+        end
+        y = x - x + 70
+      else
+        if y > 99
+          53.times do |i5|
+            y = 57 + 67 + 80
+          end
+        else
+          y = y * x
+        end
+      end
+      if y < 70
+        # step 1355
+        x = y
+      end
+    end
+    # step 1359
+    y = x
+  else
+    x = y - y - a
+    42.times do |i2|
+      y = a * i2
+      i2 = y + 4 - i2
+      35.times do |i3|
+        if x < 8
+          if y == 26
+            i3 = y + 43 * 27
+          else
+            if a == 25
+              y = a * i3 - 61
+            else
+              if a > 15
+                x = x
+              end
+              y = y + 80 + i2
+            end
+          end
+        elsif y > 26
+          if a > 96
+            a = i2 * y - a
+            86.times do |i6|
+              i3 = a - y
+            end
+            a = i3 * i3 * 97
+          elsif i3 < 73
+            if a < 20
+              i2 = x
+            end
+          end
+          # step 1392
+          i3 = i3 * x + a
+        else
+          if y == 48
+            46.times do |i6|
+              # step 1397
+              i6 = i2 - 15 + y
+            end
+          elsif i2 < 4
+            y = x - a
+            i2 = x
+          end
+        end
+        if i3 == 25
+          x = 3 + a
+          i2 = x
+          x = x * a - y
+        elsif a == 78
+          a = 3 + i2 + 63
+        end
+        y = i2 + i2
+      end
+      # step 1414
+      a = 96
+    end
+    if x > 2
+      x = x * y * y
+      y = 15
+      y = a
+    end
+    8.times do |i2|
+      if a < 25
+        y = a
+      else
+        y = x * i2
+      end
+      a = 54
+      i2 = i2
+      # step 1430
+      i2 = y
+    end
+  end
+  x = 70 + y + x
+  y
+end
+
+total = 0
+total = total + step0(22)
+puts total
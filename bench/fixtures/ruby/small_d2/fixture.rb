@@ -0,0 +1,112 @@
+def step0(a)
+  x = 3 * a
+  y = 68
+  if y < 65
+    x = 63
+    if a > 51
+      # step 6
+      a = a + a - 54
+      a = x
+    end
+  end
+  if x > 80
+    # step 12
+    y = x - 53 + 84
+    # step 14
+    y = 35 * 37 - 36
+    45.times do |i2|
+      x = i2 - 91 + i2
+      # step 18
+      y = i2 + 68 * y
+      i2 = a + 25
+    end
+    if y > 58
+      y = a - a
+      # step 24
+      a = a * a + y
+      a = y + 61 * 42
+    end
+  end
+  y = y
+  if y == 73
+    if a > 80
+      # step 32
+      a = x + 46 * y
+      a = 36 * x + 35
+    else
+      # step 36
+      a = 12 + 25
+      # step 38
+      x = x - 16
+      # step 40
+      x = y + y
+      y = x
+    end
+  end
+  a = 25 + a
+  y
+end
+
+def step1(a, b)
+  x = a + 39
+  y = 96
+  a = 98 * step0(x) * step0(a)
+  step0(x)
+  if y > 98
+    20.times do |i2|
+      # step 56
+      y = b
+      # step 58
+      a = 8 - 70
+      # step 60
+      x = 11 - 23 - y
+    end
+  else
+    if b == 14
+      a = a + y
+    else
+      # step 67
+      x = 82 + a + b
+      b = 91
+      # step 70
+      b = b - 11 * 97
+      x = b
+    end
+    b = 53
+    x = 69 - x * 47
+    1.times do |i2|
+      # step 77
+      i2 = x * y - step0(a)
+      # step 79
+      x = 7 + b
+      step0(x)
+      # step 82
+      x = y * i2
+    end
+  end
+  if y < 69
+    x = 77 + x
+  else
+    # step 89
+    b = 72 - 97 - y
+  end
+  if y == 46
+    if a < 43
+      # step 94
+      a = 54 * 30
+    end
+    68.times do |i2|
+      i2 = 80
+    end
+    # step 100
+    x = step0(y) + step0(x) - step0(y)
+  end
+  step0(x)
+  step0(b)
+  y
+end
+
+total = 0
+total = total + step0(19)
+total = total + step1(65, 45)
+puts total
@@ -0,0 +1,630 @@
+#!/usr/bin/env python3
+"""
+벤치마크용 합성 소스 fixture를 언어별로 생성한다 (결과물은 커밋한다).
+모든 언어가 같은 배치 bench/fixtures/<lang>/<크기>_d<깊이>/<Fixture|fixture>.<확장자>를 쓴다
+(Java는 public 클래스 이름과 파일 이름이 같아야 하므로 변형마다 디렉토리로 나눈다).
+
+각 언어 문법의 주요 노드(함수 정의, 대입, 호출, 조건문, 반복문, 반환, 주석)를 조합해
+크기(small/medium/large)와 최대 중첩 깊이가 다른 파일을 만든다.
+시드가 (언어, 크기, 깊이)로 고정되어 있어 같은 스크립트는 항상 같은 바이트를 만든다.
+생성 후 bench/fixtures/manifest.json에 줄 수/바이트/sha256과 커서 위치(벤치마크용)를 기록한다.
+
+사용법: python3 bench/generate_fixtures.py [--check]
+  --check: 다시 생성하지 않고 커밋된 fixture가 스크립트 출력과 같은지만 확인 (다르면 종료 코드 1)
+"""
+
+import hashlib
+import json
+import os
+import random
+import sys
+
+# ============================================================
+# 설정
+# ============================================================
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+FIXTURE_DIR = os.path.join(BENCH_DIR, "fixtures")
+
+# (이름, 목표 줄 수, 최대 중첩 깊이)
+VARIANTS = [
+    ("small", 60, 2),
+    ("medium", 800, 1),
+    ("medium", 800, 4),
+    ("medium", 800, 8),
+    ("large", 5000, 4),
+]
+
+# 파일 하나당 벤치마크 커서 위치 수
+POSITIONS_PER_FIXTURE = 4
+
+
+# ============================================================
+# 공통 생성기
+# ============================================================
+class Emitter:
+    """언어 공통 문장 생성 흐름. 언어별 하위 클래스가 문법 조각만 정의한다."""
+
+    ext = ""
+    indent_unit = "    "
+    base_depth = 0  # 함수 정의의 들여쓰기 깊이 (Java는 클래스 안이라 1)
+
+    def __init__(self, rng, max_depth):
+        self.rng = rng
+        self.max_depth = max_depth
+        self.lines = []
+        self.statement_lines = []  # (줄 번호, 열, 깊이) — 커서 위치 후보
+        self.functions = []        # 지금까지 정의한 (이름, 인자 수)
+
+    # --- 언어별 조각 (하위 클래스) ---
+    def prologue(self): return []
+    def epilogue(self): pass  # self.emit으로 파일 끝에 바로 쓴다
+    def comment(self, text): raise NotImplementedError
+    def function(self, name, params, depth): raise NotImplementedError
+
+    # --- 공통 ---
+    def emit(self, depth, text, statement=False):
+        indent = self.indent_unit * depth
+        if statement:
+            self.statement_lines.append((len(self.lines), len(indent), depth))
+        self.lines.append(indent + text)
+
+    def var(self, scope):
+        return self.rng.choice(scope)
+
+    def number(self):
+        return str(self.rng.randint(0, 99))
+
+    def expr(self, scope, calls=True):
+        """산술식: 변수/숫자를 1~3개 연산자로 잇고, 가끔 앞서 정의한 함수 호출을 섞는다."""
+        parts = [self.operand(scope, calls)]
+        for _ in range(self.rng.randint(0, 2)):
+            parts.append(self.rng.choice(["+", "-", "*"]))
+            parts.append(self.operand(scope, calls))
+        return " ".join(parts)
+
+    def operand(self, scope, calls):
+        roll = self.rng.random()
+        if calls and self.functions and roll < 0.15:
+            name, arity = self.rng.choice(self.functions)
+            return self.call_expr(name, [self.var(scope) for _ in range(arity)])
+        if roll < 0.65:
+            return self.var(scope)
+        return self.number()
+
+    def condition(self, scope):
+        return f"{self.var(scope)} {self.rng.choice(['<', '>', '=='])} {self.number()}"
+
+    def block(self, depth, scope, count):
+        """count개 문장. depth가 max_depth보다 작으면 조건/반복 블록을 섞는다."""
+        for _ in range(count):
+            roll = self.rng.random()
+            nesting = depth - self.base_depth - 1  # 함수 본문 = 0
+            if nesting < self.max_depth and roll < 0.3:
+                self.conditional(depth, scope)
+            elif nesting < self.max_depth and roll < 0.45:
+                self.loop(depth, scope)
+            elif roll < 0.55:
+                # 주석만 있는 블록은 Python 등에서 문법 오류이므로 문장을 하나 붙인다
+                self.emit(depth, self.comment(f"step {len(self.lines)}"))
+                self.assign(depth, scope)
+            elif roll < 0.7 and self.functions:
+                name, arity = self.rng.choice(self.functions)
+                self.call_statement(depth, name, [self.var(scope) for _ in range(arity)])
+            else:
+                self.assign(depth, scope)
+
+    def nested_count(self, depth):
+        # 깊어질수록 짧게 (깊은 fixture도 전체 크기는 목표에 가깝게)
+        return max(1, self.rng.randint(1, 4) - depth // 3)
+
+    def generate(self, target_lines):
+        self.lines.extend(self.prologue())
+        index = 0
+        while len(self.lines) < target_lines:
+            name = f"step{index}"
+            params = ["a", "b"] if index % 3 else ["a"]
+            self.function(name, params, 0)
+            self.functions.append((name, len(params)))
+            index += 1
+        self.epilogue()
+        return "\n".join(self.lines) + "\n"
+
+
+# ============================================================
+# 언어별 조각
+# ============================================================
+class CFamily(Emitter):
+    """C/C++/Java/JavaScript/PHP: 중괄호 블록"""
+
+    declare = "int "
+    return_type = "int "
+    param_type = "int "
+    print_call = "printf(\"%d\\n\", {})"
+
+    def comment(self, text):
+        return f"// {text}"
+
+    def v(self, name):
+        return name
+
+    def call_expr(self, name, args):
+        return f"{name}({', '.join(self.v(a) for a in args)})"
+
+    def expr(self, scope, calls=True):
+        parts = [self.operand(scope, calls)]
+        for _ in range(self.rng.randint(0, 2)):
+            parts.append(self.rng.choice(["+", "-", "*"]))
+            parts.append(self.operand(scope, calls))
+        return " ".join(self.v(p) if p in scope else p for p in parts)
+
+    def condition(self, scope):
+        return f"{self.v(self.var(scope))} {self.rng.choice(['<', '>', '=='])} {self.number()}"
+
+    def assign(self, depth, scope):
+        self.emit(depth, f"{self.v(self.var(scope))} = {self.expr(scope)};", statement=True)
+
+    def call_statement(self, depth, name, args):
+        self.emit(depth, f"{self.call_expr(name, args)};", statement=True)
+
+    def conditional(self, depth, scope):
+        self.emit(depth, f"if ({self.condition(scope)}) {{", statement=True)
+        self.block(depth + 1, scope, self.nested_count(depth))
+        if self.rng.random() < 0.5:
+            self.emit(depth, "} else {")
+            self.block(depth + 1, scope, self.nested_count(depth))
+        self.emit(depth, "}")
+
+    def loop_header(self, counter, bound):
+        return f"for (int {counter} = 0; {counter} < {bound}; {counter}++) {{"
+
+    def loop(self, depth, scope):
+        counter = f"i{depth}"
+        self.emit(depth, self.loop_header(self.v(counter), self.number()), statement=True)
+        self.block(depth + 1, scope + [counter], self.nested_count(depth))
+        self.emit(depth, "}")
+
+    def signature(self, name, params):
+        args = ", ".join(self.param_type + self.v(p) for p in params)
+        return f"{self.return_type}{name}({args}) {{"
+
+    def function(self, name, params, depth):
+        self.emit(depth, self.comment(f"{name}: generated"))
+        self.emit(depth, self.signature(name, params), statement=True)
+        scope = list(params) + ["x", "y"]
+        self.emit(depth + 1, f"{self.declare}{self.v('x')} = {self.expr(params, calls=False)};", statement=True)
+        self.emit(depth + 1, f"{self.declare}{self.v('y')} = {self.number()};", statement=True)
+        self.block(depth + 1, scope, self.rng.randint(3, 8))
+        self.emit(depth + 1, f"return {self.expr(scope)};", statement=True)
+        self.emit(depth, "}")
+        self.emit(depth, "")
+
+    def main_body(self, depth):
+        self.emit(depth, f"{self.declare}{self.v('total')} = 0;")
+        for name, arity in self.functions[-5:]:
+            args = ", ".join(self.number() for _ in range(arity))
+            self.emit(depth, f"{self.v('total')} = {self.v('total')} + {name}({args});", statement=True)
+        self.emit(depth, self.print_call.format(self.v("total")) + ";", statement=True)
+
+
+class CEmitter(CFamily):
+    ext = ".c"
+
+    def prologue(self):
+        return ["#include <stdio.h>", ""]
+
+    def epilogue(self):
+        self.emit(0, "int main(void) {")
+        self.main_body(1)
+        self.emit(1, "return 0;")
+        self.emit(0, "}")
+
+
+class CppEmitter(CFamily):
+    ext = ".cpp"
+    declare = "auto "
+    print_call = "std::cout << {} << std::endl"
+
+    def prologue(self):
+        return ["#include <iostream>", "#include <vector>", "", "namespace fixture {", ""]
+
+    def loop(self, depth, scope):
+        if self.rng.random() < 0.5:
+            return super().loop(depth, scope)
+        counter = f"v{depth}"
+        self.emit(depth, f"for (int {counter} : std::vector<int>{{{self.number()}, {self.number()}}}) {{", statement=True)
+        self.block(depth + 1, scope + [counter], self.nested_count(depth))
+        self.emit(depth, "}")
+
+    def epilogue(self):
+        self.emit(0, "}  // namespace fixture")
+        self.emit(0, "")
+        self.emit(0, "int main() {")
+        self.emit(1, "using namespace fixture;")
+        self.main_body(1)
+        self.emit(1, "return 0;")
+        self.emit(0, "}")
+
+
+class JavaEmitter(CFamily):
+    ext = ".java"
+    base_depth = 1
+    return_type = "static int "
+    print_call = "System.out.println({})"
+
+    def prologue(self):
+        return ["public class Fixture {", ""]
+
+    def function(self, name, params, depth):
+        super().function(name, params, depth + 1)
+
+    def epilogue(self):
+        self.emit(1, "public static void main(String[] args) {")
+        self.main_body(2)
+        self.emit(1, "}")
+        self.emit(0, "}")
+
+
+class JavaScriptEmitter(CFamily):
+    ext = ".js"
+    declare = "let "
+    return_type = "function "
+    param_type = ""
+    print_call = "console.log({})"
+
+    def loop_header(self, counter, bound):
+        return f"for (let {counter} = 0; {counter} < {bound}; {counter}++) {{"
+
+    def condition(self, scope):
+        return f"{self.var(scope)} {self.rng.choice(['<', '>', '==='])} {self.number()}"
+
+    def epilogue(self):
+        self.main_body(0)
+
+
+class PhpEmitter(CFamily):
+    ext = ".php"
+    declare = ""
+    return_type = "function "
+    param_type = ""
+    print_call = "echo {}"
+
+    def v(self, name):
+        return "$" + name
+
+    def prologue(self):
+        return ["<?php", ""]
+
+    def loop_header(self, counter, bound):
+        return f"for ({counter} = 0; {counter} < {bound}; {counter}++) {{"
+
+    def epilogue(self):
+        self.main_body(0)
+
+
+class PythonEmitter(Emitter):
+    ext = ".py"
+
+    def comment(self, text):
+        return f"# {text}"
+
+    def call_expr(self, name, args):
+        return f"{name}({', '.join(args)})"
+
+    def assign(self, depth, scope):
+        self.emit(depth, f"{self.var(scope)} = {self.expr(scope)}", statement=True)
+
+    def call_statement(self, depth, name, args):
+        self.emit(depth, self.call_expr(name, args), statement=True)
+
+    def conditional(self, depth, scope):
+        self.emit(depth, f"if {self.condition(scope)}:", statement=True)
+        self.block(depth + 1, scope, self.nested_count(depth))
+        if self.rng.random() < 0.3:
+            self.emit(depth, f"elif {self.condition(scope)}:")
+            self.block(depth + 1, scope, self.nested_count(depth))
+        if self.rng.random() < 0.5:
+            self.emit(depth, "else:")
+            self.block(depth + 1, scope, self.nested_count(depth))
+
+    def loop(self, depth, scope):
+        counter = f"i{depth}"
+        self.emit(depth, f"for {counter} in range({self.number()}):", statement=True)
+        self.block(depth + 1, scope + [counter], self.nested_count(depth))
+
+    def function(self, name, params, depth):
+        self.emit(depth, f"def {name}({', '.join(params)}):", statement=True)
+        scope = list(params) + ["x", "y"]
+        self.emit(depth + 1, f"x = {self.expr(params, calls=False)}", statement=True)
+        self.emit(depth + 1, f"y = {self.number()}", statement=True)
+        self.block(depth + 1, scope, self.rng.randint(3, 8))
+        self.emit(depth + 1, f"return {self.expr(scope)}", statement=True)
+        self.emit(depth, "")
+        self.emit(depth, "")
+
+    def epilogue(self):
+        self.emit(0, 'if __name__ == "__main__":')
+        self.emit(1, "total = 0")
+        for name, arity in self.functions[-5:]:
+            args = ", ".join(self.number() for _ in range(arity))
+            self.emit(1, f"total = total + {name}({args})", statement=True)
+        self.emit(1, "print(total)", statement=True)
+
+
+class RubyEmitter(Emitter):
+    ext = ".rb"
+    indent_unit = "  "
+
+    def comment(self, text):
+        return f"# {text}"
+
+    def call_expr(self, name, args):
+        return f"{name}({', '.join(args)})"
+
+    def assign(self, depth, scope):
+        self.emit(depth, f"{self.var(scope)} = {self.expr(scope)}", statement=True)
+
+    def call_statement(self, depth, name, args):
+        self.emit(depth, self.call_expr(name, args), statement=True)
+
+    def conditional(self, depth, scope):
+        self.emit(depth, f"if {self.condition(scope)}", statement=True)
+        self.block(depth + 1, scope, self.nested_count(depth))
+        if self.rng.random() < 0.3:
+            self.emit(depth, f"elsif {self.condition(scope)}")
+            self.block(depth + 1, scope, self.nested_count(depth))
+        if self.rng.random() < 0.5:
+            self.emit(depth, "else")
+            self.block(depth + 1, scope, self.nested_count(depth))
+        self.emit(depth, "end")
+
+    def loop(self, depth, scope):
+        counter = f"i{depth}"
+        self.emit(depth, f"{self.number()}.times do |{counter}|", statement=True)
+        self.block(depth + 1, scope + [counter], self.nested_count(depth))
+        self.emit(depth, "end")
+
+    def function(self, name, params, depth):
+        self.emit(depth, f"def {name}({', '.join(params)})", statement=True)
+        scope = list(params) + ["x", "y"]
+        self.emit(depth + 1, f"x = {self.expr(params, calls=False)}", statement=True)
+        self.emit(depth + 1, f"y = {self.number()}", statement=True)
+        self.block(depth + 1, scope, self.rng.randint(3, 8))
+        self.emit(depth + 1, f"{self.expr(scope)}", statement=True)
+        self.emit(depth, "end")
+        self.emit(depth, "")
+
+    def epilogue(self):
+        self.emit(0, "total = 0")
+        for name, arity in self.functions[-5:]:
+            args = ", ".join(self.number() for _ in range(arity))
+            self.emit(0, f"total = total + {name}({args})", statement=True)
+        self.emit(0, "puts total", statement=True)
+
+
+class SmallBasicEmitter(Emitter):
+    """Small Basic: Sub은 인자/반환값이 없고 최상위에만 올 수 있으므로 전역 변수로 주고받는다"""
+
+    ext = ".sb"
+    indent_unit = "  "
+
+    def comment(self, text):
+        return f"' {text}"
+
+    def call_expr(self, name, args):
+        # Sub은 식이 될 수 없으므로 결과 변수로 대신한다
+        return f"{name}_result"
+
+    def operand(self, scope, calls):
+        roll = self.rng.random()
+        if calls and self.functions and roll < 0.15:
+            name, _ = self.rng.choice(self.functions)
+            return f"{name}_result"
+        if roll < 0.65:
+            return self.var(scope)
+        return self.number()
+
+    def condition(self, scope):
+        return f"{self.var(scope)} {self.rng.choice(['<', '>', '='])} {self.number()}"
+
+    def assign(self, depth, scope):
+        self.emit(depth, f"{self.var(scope)} = {self.expr(scope)}", statement=True)
+
+    def call_statement(self, depth, name, args):
+        if self.rng.random() < 0.5:
+            self.emit(depth, f"{name}()", statement=True)
+        else:
+            self.emit(depth, f"TextWindow.WriteLine({self.var(args) if args else name + '_result'})", statement=True)
+
+    def conditional(self, depth, scope):
+        self.emit(depth, f"If {self.condition(scope)} Then", statement=True)
+        self.block(depth + 1, scope, self.nested_count(depth))
+        if self.rng.random() < 0.3:
+            self.emit(depth, f"ElseIf {self.condition(scope)} Then")
+            self.block(depth + 1, scope, self.nested_count(depth))
+        if self.rng.random() < 0.5:
+            self.emit(depth, "Else")
+            self.block(depth + 1, scope, self.nested_count(depth))
+        self.emit(depth, "EndIf")
+
+    def loop(self, depth, scope):
+        counter = f"i{depth}"
+        if self.rng.random() < 0.7:
+            self.emit(depth, f"For {counter} = 1 To {self.number()}", statement=True)
+            self.block(depth + 1, scope + [counter], self.nested_count(depth))
+            self.emit(depth, "EndFor")
+        else:
+            self.emit(depth, f"While {self.condition(scope)}", statement=True)
+            self.block(depth + 1, scope, self.nested_count(depth))
+            self.emit(depth, "EndWhile")
+
+    def function(self, name, params, depth):
+        self.emit(depth, f"Sub {name}", statement=True)
+        scope = ["a", "b", "x", "y"]
+        self.emit(depth + 1, f"x = {self.expr(['a', 'b'], calls=False)}", statement=True)
+        self.emit(depth + 1, f"y = {self.number()}", statement=True)
+        self.block(depth + 1, scope, self.rng.randint(3, 8))
+        self.emit(depth + 1, f"{name}_result = {self.expr(scope)}", statement=True)
+        self.emit(depth, "EndSub")
+        self.emit(depth, "")
+
+    def prologue(self):
+        return ["' generated fixture", "a = 1", "b = 2", ""]
+
+    def epilogue(self):
+        for name, _ in self.functions[-5:]:
+            self.emit(0, f"{name}()", statement=True)
+        self.emit(0, f"TextWindow.WriteLine({self.functions[-1][0]}_result)", statement=True)
+
+
+class HaskellEmitter(Emitter):
+    """Haskell: 문장 대신 식 중첩 (let/if/case)"""
+
+    ext = ".hs"
+    indent_unit = "  "
+
+    def comment(self, text):
+        return f"-- {text}"
+
+    def call_expr(self, name, args):
+        return f"({name} {' '.join(args)})"
+
+    def condition(self, scope):
+        return f"{self.var(scope)} {self.rng.choice(['<', '>', '=='])} {self.number()}"
+
+    def body(self, depth, scope, level):
+        """depth: 들여쓰기, level: 남은 중첩 단계"""
+        roll = self.rng.random()
+        if level == 0 or roll < 0.25:
+            self.emit(depth, self.expr(scope), statement=True)
+        elif roll < 0.5:
+            name = f"v{len(scope)}"
+            self.emit(depth, f"let {name} = {self.expr(scope)}", statement=True)
+            self.emit(depth, "in")
+            self.body(depth + 1, scope + [name], level - 1)
+        elif roll < 0.75:
+            self.emit(depth, f"if {self.condition(scope)}", statement=True)
+            self.emit(depth + 1, "then")
+            self.body(depth + 2, scope, level - 1)
+            self.emit(depth + 1, "else")
+            self.body(depth + 2, scope, level - 1)
+        else:
+            self.emit(depth, f"case {self.var(scope)} `mod` 3 of", statement=True)
+            self.emit(depth + 1, "0 ->")
+            self.body(depth + 2, scope, level - 1)
+            self.emit(depth + 1, "_ ->")
+            self.body(depth + 2, scope, level - 1)
+
+    def function(self, name, params, depth):
+        self.emit(depth, self.comment(f"{name}: generated"))
+        self.emit(depth, f"{name} :: {' -> '.join(['Int'] * (len(params) + 1))}", statement=True)
+        self.emit(depth, f"{name} {' '.join(params)} =")
+        self.body(depth + 1, list(params), self.max_depth + 1)
+        self.emit(depth, "")
+
+    def prologue(self):
+        return ["module Main where", ""]
+
+    def epilogue(self):
+        self.emit(0, "main :: IO ()")
+        self.emit(0, "main = do")
+        for name, arity in self.functions[-5:]:
+            args = " ".join(self.number() for _ in range(arity))
+            self.emit(1, f"print ({name} {args})", statement=True)
+
+
+# resources/<lang> 디렉토리 이름 → (생성기, 파일 이름 (확장자 제외))
+LANGUAGES = {
+    "c": (CEmitter, "fixture"),
+    "cpp": (CppEmitter, "fixture"),
+    "haskell": (HaskellEmitter, "Fixture"),
+    "java": (JavaEmitter, "Fixture"),
+    "javascript": (JavaScriptEmitter, "fixture"),
+    "php": (PhpEmitter, "fixture"),
+    "python": (PythonEmitter, "fixture"),
+    "ruby": (RubyEmitter, "fixture"),
+    "smallbasic": (SmallBasicEmitter, "fixture"),
+}
+
+
+# ============================================================
+# 생성 / 확인
+# ============================================================
+def pick_positions(statement_lines, count):
+    """문장 시작 위치를 파일 전체에 고르게 + 가장 깊은 위치 하나"""
+    if not statement_lines:
+        return []
+    deepest = max(statement_lines, key=lambda s: s[2])
+    step = max(1, len(statement_lines) // count)
+    chosen = [statement_lines[i] for i in range(step // 2, len(statement_lines), step)][:count - 1]
+    chosen.append(deepest)
+    return sorted({(line, column) for line, column, _ in chosen})
+
+
+def build_fixtures():
+    """{상대 경로: 내용}, manifest 항목 목록"""
+    files = {}
+    entries = []
+    for lang, (emitter_class, basename) in LANGUAGES.items():
+        for size, target_lines, depth in VARIANTS:
+            # 문자열 시드는 Python 버전/실행과 무관하게 같은 난수열을 만든다
+            rng = random.Random(f"{lang}-{size}-{depth}")
+            emitter = emitter_class(rng, depth)
+            text = emitter.generate(target_lines)
+            rel = f"{lang}/{size}_d{depth}/{basename}{emitter_class.ext}"
+            data = text.encode("utf-8")
+            files[rel] = data
+            entries.append({
+                "languageId": lang,
+                "file": rel,
+                "size": size,
+                "depth": depth,
+                "lines": text.count("\n"),
+                "bytes": len(data),
+                "sha256": hashlib.sha256(data).hexdigest(),
+                "positions": [list(p) for p in pick_positions(emitter.statement_lines, POSITIONS_PER_FIXTURE)],
+            })
+    return files, entries
+
+
+def manifest_bytes(entries):
+    manifest = {
+        "generator": "bench/generate_fixtures.py",
+        "variants": [{"size": s, "targetLines": n, "depth": d} for s, n, d in VARIANTS],
+        "fixtures": entries,
+    }
+    return (json.dumps(manifest, indent=2) + "\n").encode("utf-8")
+
+
+def main():
+    check = "--check" in sys.argv[1:]
+    files, entries = build_fixtures()
+    files["manifest.json"] = manifest_bytes(entries)
+
+    mismatched = []
+    for rel, data in files.items():
+        path = os.path.join(FIXTURE_DIR, rel)
+        if check:
+            try:
+                with open(path, "rb") as f:
+                    if f.read() != data:
+                        mismatched.append(rel)
+            except OSError:
+                mismatched.append(rel)
+            continue
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(path, "wb") as f:
+            f.write(data)
+
+    if check:
+        for rel in mismatched:
+            print(f"  [DIFF] {rel}")
+        print(f"  {len(files) - len(mismatched)}/{len(files)}개 일치")
+        return 1 if mismatched else 0
+
+    total = sum(len(d) for d in files.values())
+    print(f"  -> {len(entries)}개 fixture 생성 완료 ({total // 1024}KB): {FIXTURE_DIR}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,7 +1,42 @@
 {
   "targets": [
     {
-      "target_name": "c_parser_addon",
+      "target_name": "c_grammar_objects",
+      "type": "none",
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "actions": [
+              {
+                "action_name": "compile_c_grammar",
+                "inputs": [
+                  "generate_build_config.py",
+                  "native/src/generated/lang_constants.h",
+                  "../tree-sitter-c/src/parser.c",
+                  "../tree-sitter/lib/src/lib.c"
+                ],
+                "outputs": [
+                  "<(PRODUCT_DIR)/grammar_c/tree_sitter_lib.o",
+                  "<(PRODUCT_DIR)/grammar_c/parser.o"
+                ],
+                "action": [
+                  "python3",
+                  "generate_build_config.py",
+                  "--grammar-objects",
+                  "c",
+                  "<(PRODUCT_DIR)/grammar_c",
+                  "<(CONFIGURATION_NAME)"
+                ]
+              }
+            ]
+          }
+        ]
+      ]
+    },
+    {
+      "target_name": "c_engine",
+      "type": "static_library",
       "cflags!": [
         "-fno-exceptions"
       ],
@@ -9,20 +44,80 @@
         "-fno-exceptions"
       ],
       "sources": [
-        "native/src/addon.cc",
-        "../tree-sitter/lib/src/lib.c",
-        "../tree-sitter-c/src/parser.c"
+        "native/src/candidate_db.cc",
+        "native/src/cce_engine.cc",
+        "native/src/conversion_worker.cc",
+        "native/src/document_session.cc",
+        "native/src/engine.cc",
+        "native/src/engine_stats.cc",
+        "native/src/engine_tuning.cc",
+        "native/src/identifier_index.cc",
+        "native/src/line_index.cc",
+        "native/src/memory_budget.cc",
+        "native/src/outline.cc",
+        "native/src/recovery_limit.cc",
+        "native/src/redact.cc",
+        "native/src/semantic_tokens.cc",
+        "native/src/symbol_classes.cc",
+        "native/src/token_model.cc",
+        "native/src/token_stream.cc",
+        "native/src/lr_simulator.cc"
       ],
       "include_dirs": [
-        "<!@(node -p \"require('node-addon-api').include\")",
+        "native/include",
+        "native/src",
         "../tree-sitter/lib/include",
         "../tree-sitter/lib/src",
         "../tree-sitter-c/src"
       ],
       "defines": [
-        "NAPI_DISABLE_CPP_EXCEPTIONS",
         "LANG_C"
       ],
+      "direct_dependent_settings": {
+        "include_dirs": [
+          "native/include",
+          "native/src",
+          "../tree-sitter/lib/include",
+          "../tree-sitter/lib/src",
+          "../tree-sitter-c/src"
+        ],
+        "defines": [
+          "LANG_C"
+        ]
+      },
+      "conditions": [
+        [
+          "OS=='win'",
+          {
+            "sources": [
+              "../tree-sitter/lib/src/lib.c",
+              "../tree-sitter-c/src/parser.c"
+            ]
+          },
+          {
+            "dependencies": [
+              "c_grammar_objects"
+            ],
+            "link_settings": {
+              "libraries": [
+                "<(PRODUCT_DIR)/grammar_c/tree_sitter_lib.o",
+                "<(PRODUCT_DIR)/grammar_c/parser.o"
+              ]
+            }
+          }
+        ],
+        [
+          "OS!='win'",
+          {
+            "cflags": [
+              "-fPIC"
+            ],
+            "cflags_cc": [
+              "-fPIC"
+            ]
+          }
+        ]
+      ],
       "msvs_settings": {
         "VCCLCompilerTool": {
           "ExceptionHandling": 1
@@ -30,7 +125,44 @@
       }
     },
     {
-      "target_name": "cpp_parser_addon",
+      "target_name": "cpp_grammar_objects",
+      "type": "none",
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "actions": [
+              {
+                "action_name": "compile_cpp_grammar",
+                "inputs": [
+                  "generate_build_config.py",
+                  "native/src/generated/lang_constants.h",
+                  "../tree-sitter-cpp/src/parser.c",
+                  "../tree-sitter-cpp/src/scanner.c",
+                  "../tree-sitter/lib/src/lib.c"
+                ],
+                "outputs": [
+                  "<(PRODUCT_DIR)/grammar_cpp/tree_sitter_lib.o",
+                  "<(PRODUCT_DIR)/grammar_cpp/parser.o",
+                  "<(PRODUCT_DIR)/grammar_cpp/scanner.o"
+                ],
+                "action": [
+                  "python3",
+                  "generate_build_config.py",
+                  "--grammar-objects",
+                  "cpp",
+                  "<(PRODUCT_DIR)/grammar_cpp",
+                  "<(CONFIGURATION_NAME)"
+                ]
+              }
+            ]
+          }
+        ]
+      ]
+    },
+    {
+      "target_name": "cpp_engine",
+      "type": "static_library",
       "cflags!": [
         "-fno-exceptions"
       ],
@@ -38,21 +170,82 @@
         "-fno-exceptions"
       ],
       "sources": [
-        "native/src/addon.cc",
-        "../tree-sitter/lib/src/lib.c",
-        "../tree-sitter-cpp/src/parser.c",
-        "../tree-sitter-cpp/src/scanner.c"
+        "native/src/candidate_db.cc",
+        "native/src/cce_engine.cc",
+        "native/src/conversion_worker.cc",
+        "native/src/document_session.cc",
+        "native/src/engine.cc",
+        "native/src/engine_stats.cc",
+        "native/src/engine_tuning.cc",
+        "native/src/identifier_index.cc",
+        "native/src/line_index.cc",
+        "native/src/memory_budget.cc",
+        "native/src/outline.cc",
+        "native/src/recovery_limit.cc",
+        "native/src/redact.cc",
+        "native/src/semantic_tokens.cc",
+        "native/src/symbol_classes.cc",
+        "native/src/token_model.cc",
+        "native/src/token_stream.cc",
+        "native/src/lr_simulator.cc"
       ],
       "include_dirs": [
-        "<!@(node -p \"require('node-addon-api').include\")",
+        "native/include",
+        "native/src",
         "../tree-sitter/lib/include",
         "../tree-sitter/lib/src",
         "../tree-sitter-cpp/src"
       ],
       "defines": [
-        "NAPI_DISABLE_CPP_EXCEPTIONS",
         "LANG_CPP"
       ],
+      "direct_dependent_settings": {
+        "include_dirs": [
+          "native/include",
+          "native/src",
+          "../tree-sitter/lib/include",
+          "../tree-sitter/lib/src",
+          "../tree-sitter-cpp/src"
+        ],
+        "defines": [
+          "LANG_CPP"
+        ]
+      },
+      "conditions": [
+        [
+          "OS=='win'",
+          {
+            "sources": [
+              "../tree-sitter/lib/src/lib.c",
+              "../tree-sitter-cpp/src/parser.c",
+              "../tree-sitter-cpp/src/scanner.c"
+            ]
+          },
+          {
+            "dependencies": [
+              "cpp_grammar_objects"
+            ],
+            "link_settings": {
+              "libraries": [
+                "<(PRODUCT_DIR)/grammar_cpp/tree_sitter_lib.o",
+                "<(PRODUCT_DIR)/grammar_cpp/parser.o",
+                "<(PRODUCT_DIR)/grammar_cpp/scanner.o"
+              ]
+            }
+          }
+        ],
+        [
+          "OS!='win'",
+          {
+            "cflags": [
+              "-fPIC"
+            ],
+            "cflags_cc": [
+              "-fPIC"
+            ]
+          }
+        ]
+      ],
       "msvs_settings": {
         "VCCLCompilerTool": {
           "ExceptionHandling": 1
@@ -60,7 +253,44 @@
       }
     },
     {
-      "target_name": "haskell_parser_addon",
+      "target_name": "haskell_grammar_objects",
+      "type": "none",
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "actions": [
+              {
+                "action_name": "compile_haskell_grammar",
+                "inputs": [
+                  "generate_build_config.py",
+                  "native/src/generated/lang_constants.h",
+                  "../tree-sitter-haskell/src/parser.c",
+                  "../tree-sitter-haskell/src/scanner.c",
+                  "../tree-sitter/lib/src/lib.c"
+                ],
+                "outputs": [
+                  "<(PRODUCT_DIR)/grammar_haskell/tree_sitter_lib.o",
+                  "<(PRODUCT_DIR)/grammar_haskell/parser.o",
+                  "<(PRODUCT_DIR)/grammar_haskell/scanner.o"
+                ],
+                "action": [
+                  "python3",
+                  "generate_build_config.py",
+                  "--grammar-objects",
+                  "haskell",
+                  "<(PRODUCT_DIR)/grammar_haskell",
+                  "<(CONFIGURATION_NAME)"
+                ]
+              }
+            ]
+          }
+        ]
+      ]
+    },
+    {
+      "target_name": "haskell_engine",
+      "type": "static_library",
       "cflags!": [
         "-fno-exceptions"
       ],
@@ -68,21 +298,82 @@
         "-fno-exceptions"
       ],
       "sources": [
-        "native/src/addon.cc",
-        "../tree-sitter/lib/src/lib.c",
-        "../tree-sitter-haskell/src/parser.c",
-        "../tree-sitter-haskell/src/scanner.c"
+        "native/src/candidate_db.cc",
+        "native/src/cce_engine.cc",
+        "native/src/conversion_worker.cc",
+        "native/src/document_session.cc",
+        "native/src/engine.cc",
+        "native/src/engine_stats.cc",
+        "native/src/engine_tuning.cc",
+        "native/src/identifier_index.cc",
+        "native/src/line_index.cc",
+        "native/src/memory_budget.cc",
+        "native/src/outline.cc",
+        "native/src/recovery_limit.cc",
+        "native/src/redact.cc",
+        "native/src/semantic_tokens.cc",
+        "native/src/symbol_classes.cc",
+        "native/src/token_model.cc",
+        "native/src/token_stream.cc",
+        "native/src/lr_simulator.cc"
       ],
       "include_dirs": [
-        "<!@(node -p \"require('node-addon-api').include\")",
+        "native/include",
+        "native/src",
         "../tree-sitter/lib/include",
         "../tree-sitter/lib/src",
         "../tree-sitter-haskell/src"
       ],
       "defines": [
-        "NAPI_DISABLE_CPP_EXCEPTIONS",
         "LANG_HASKELL"
       ],
+      "direct_dependent_settings": {
+        "include_dirs": [
+          "native/include",
+          "native/src",
+          "../tree-sitter/lib/include",
+          "../tree-sitter/lib/src",
+          "../tree-sitter-haskell/src"
+        ],
+        "defines": [
+          "LANG_HASKELL"
+        ]
+      },
+      "conditions": [
+        [
+          "OS=='win'",
+          {
+            "sources": [
+              "../tree-sitter/lib/src/lib.c",
+              "../tree-sitter-haskell/src/parser.c",
+              "../tree-sitter-haskell/src/scanner.c"
+            ]
+          },
+          {
+            "dependencies": [
+              "haskell_grammar_objects"
+            ],
+            "link_settings": {
+              "libraries": [
+                "<(PRODUCT_DIR)/grammar_haskell/tree_sitter_lib.o",
+                "<(PRODUCT_DIR)/grammar_haskell/parser.o",
+                "<(PRODUCT_DIR)/grammar_haskell/scanner.o"
+              ]
+            }
+          }
+        ],
+        [
+          "OS!='win'",
+          {
+            "cflags": [
+              "-fPIC"
+            ],
+            "cflags_cc": [
+              "-fPIC"
+            ]
+          }
+        ]
+      ],
       "msvs_settings": {
         "VCCLCompilerTool": {
           "ExceptionHandling": 1
@@ -90,7 +381,42 @@
       }
     },
     {
-      "target_name": "java_parser_addon",
+      "target_name": "java_grammar_objects",
+      "type": "none",
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "actions": [
+              {
+                "action_name": "compile_java_grammar",
+                "inputs": [
+                  "generate_build_config.py",
+                  "native/src/generated/lang_constants.h",
+                  "../tree-sitter-java/src/parser.c",
+                  "../tree-sitter/lib/src/lib.c"
+                ],
+                "outputs": [
+                  "<(PRODUCT_DIR)/grammar_java/tree_sitter_lib.o",
+                  "<(PRODUCT_DIR)/grammar_java/parser.o"
+                ],
+                "action": [
+                  "python3",
+                  "generate_build_config.py",
+                  "--grammar-objects",
+                  "java",
+                  "<(PRODUCT_DIR)/grammar_java",
+                  "<(CONFIGURATION_NAME)"
+                ]
+              }
+            ]
+          }
+        ]
+      ]
+    },
+    {
+      "target_name": "java_engine",
+      "type": "static_library",
       "cflags!": [
         "-fno-exceptions"
       ],
@@ -98,20 +424,80 @@
         "-fno-exceptions"
       ],
       "sources": [
-        "native/src/addon.cc",
-        "../tree-sitter/lib/src/lib.c",
-        "../tree-sitter-java/src/parser.c"
+        "native/src/candidate_db.cc",
+        "native/src/cce_engine.cc",
+        "native/src/conversion_worker.cc",
+        "native/src/document_session.cc",
+        "native/src/engine.cc",
+        "native/src/engine_stats.cc",
+        "native/src/engine_tuning.cc",
+        "native/src/identifier_index.cc",
+        "native/src/line_index.cc",
+        "native/src/memory_budget.cc",
+        "native/src/outline.cc",
+        "native/src/recovery_limit.cc",
+        "native/src/redact.cc",
+        "native/src/semantic_tokens.cc",
+        "native/src/symbol_classes.cc",
+        "native/src/token_model.cc",
+        "native/src/token_stream.cc",
+        "native/src/lr_simulator.cc"
       ],
       "include_dirs": [
-        "<!@(node -p \"require('node-addon-api').include\")",
+        "native/include",
+        "native/src",
         "../tree-sitter/lib/include",
         "../tree-sitter/lib/src",
         "../tree-sitter-java/src"
       ],
       "defines": [
-        "NAPI_DISABLE_CPP_EXCEPTIONS",
         "LANG_JAVA"
       ],
+      "direct_dependent_settings": {
+        "include_dirs": [
+          "native/include",
+          "native/src",
+          "../tree-sitter/lib/include",
+          "../tree-sitter/lib/src",
+          "../tree-sitter-java/src"
+        ],
+        "defines": [
+          "LANG_JAVA"
+        ]
+      },
+      "conditions": [
+        [
+          "OS=='win'",
+          {
+            "sources": [
+              "../tree-sitter/lib/src/lib.c",
+              "../tree-sitter-java/src/parser.c"
+            ]
+          },
+          {
+            "dependencies": [
+              "java_grammar_objects"
+            ],
+            "link_settings": {
+              "libraries": [
+                "<(PRODUCT_DIR)/grammar_java/tree_sitter_lib.o",
+                "<(PRODUCT_DIR)/grammar_java/parser.o"
+              ]
+            }
+          }
+        ],
+        [
+          "OS!='win'",
+          {
+            "cflags": [
+              "-fPIC"
+            ],
+            "cflags_cc": [
+              "-fPIC"
+            ]
+          }
+        ]
+      ],
       "msvs_settings": {
         "VCCLCompilerTool": {
           "ExceptionHandling": 1
@@ -119,7 +505,44 @@
       }
     },
     {
-      "target_name": "javascript_parser_addon",
+      "target_name": "javascript_grammar_objects",
+      "type": "none",
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "actions": [
+              {
+                "action_name": "compile_javascript_grammar",
+                "inputs": [
+                  "generate_build_config.py",
+                  "native/src/generated/lang_constants.h",
+                  "../tree-sitter-javascript/src/parser.c",
+                  "../tree-sitter-javascript/src/scanner.c",
+                  "../tree-sitter/lib/src/lib.c"
+                ],
+                "outputs": [
+                  "<(PRODUCT_DIR)/grammar_javascript/tree_sitter_lib.o",
+                  "<(PRODUCT_DIR)/grammar_javascript/parser.o",
+                  "<(PRODUCT_DIR)/grammar_javascript/scanner.o"
+                ],
+                "action": [
+                  "python3",
+                  "generate_build_config.py",
+                  "--grammar-objects",
+                  "javascript",
+                  "<(PRODUCT_DIR)/grammar_javascript",
+                  "<(CONFIGURATION_NAME)"
+                ]
+              }
+            ]
+          }
+        ]
+      ]
+    },
+    {
+      "target_name": "javascript_engine",
+      "type": "static_library",
       "cflags!": [
         "-fno-exceptions"
       ],
@@ -127,21 +550,82 @@
         "-fno-exceptions"
       ],
       "sources": [
-        "native/src/addon.cc",
-        "../tree-sitter/lib/src/lib.c",
-        "../tree-sitter-javascript/src/parser.c",
-        "../tree-sitter-javascript/src/scanner.c"
+        "native/src/candidate_db.cc",
+        "native/src/cce_engine.cc",
+        "native/src/conversion_worker.cc",
+        "native/src/document_session.cc",
+        "native/src/engine.cc",
+        "native/src/engine_stats.cc",
+        "native/src/engine_tuning.cc",
+        "native/src/identifier_index.cc",
+        "native/src/line_index.cc",
+        "native/src/memory_budget.cc",
+        "native/src/outline.cc",
+        "native/src/recovery_limit.cc",
+        "native/src/redact.cc",
+        "native/src/semantic_tokens.cc",
+        "native/src/symbol_classes.cc",
+        "native/src/token_model.cc",
+        "native/src/token_stream.cc",
+        "native/src/lr_simulator.cc"
       ],
       "include_dirs": [
-        "<!@(node -p \"require('node-addon-api').include\")",
+        "native/include",
+        "native/src",
         "../tree-sitter/lib/include",
         "../tree-sitter/lib/src",
         "../tree-sitter-javascript/src"
       ],
       "defines": [
-        "NAPI_DISABLE_CPP_EXCEPTIONS",
         "LANG_JAVASCRIPT"
       ],
+      "direct_dependent_settings": {
+        "include_dirs": [
+          "native/include",
+          "native/src",
+          "../tree-sitter/lib/include",
+          "../tree-sitter/lib/src",
+          "../tree-sitter-javascript/src"
+        ],
+        "defines": [
+          "LANG_JAVASCRIPT"
+        ]
+      },
+      "conditions": [
+        [
+          "OS=='win'",
+          {
+            "sources": [
+              "../tree-sitter/lib/src/lib.c",
+              "../tree-sitter-javascript/src/parser.c",
+              "../tree-sitter-javascript/src/scanner.c"
+            ]
+          },
+          {
+            "dependencies": [
+              "javascript_grammar_objects"
+            ],
+            "link_settings": {
+              "libraries": [
+                "<(PRODUCT_DIR)/grammar_javascript/tree_sitter_lib.o",
+                "<(PRODUCT_DIR)/grammar_javascript/parser.o",
+                "<(PRODUCT_DIR)/grammar_javascript/scanner.o"
+              ]
+            }
+          }
+        ],
+        [
+          "OS!='win'",
+          {
+            "cflags": [
+              "-fPIC"
+            ],
+            "cflags_cc": [
+              "-fPIC"
+            ]
+          }
+        ]
+      ],
       "msvs_settings": {
         "VCCLCompilerTool": {
           "ExceptionHandling": 1
@@ -149,7 +633,44 @@
       }
     },
     {
-      "target_name": "php_parser_addon",
+      "target_name": "php_grammar_objects",
+      "type": "none",
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "actions": [
+              {
+                "action_name": "compile_php_grammar",
+                "inputs": [
+                  "generate_build_config.py",
+                  "native/src/generated/lang_constants.h",
+                  "../tree-sitter-php/php/src/parser.c",
+                  "../tree-sitter-php/php/src/scanner.c",
+                  "../tree-sitter/lib/src/lib.c"
+                ],
+                "outputs": [
+                  "<(PRODUCT_DIR)/grammar_php/tree_sitter_lib.o",
+                  "<(PRODUCT_DIR)/grammar_php/parser.o",
+                  "<(PRODUCT_DIR)/grammar_php/scanner.o"
+                ],
+                "action": [
+                  "python3",
+                  "generate_build_config.py",
+                  "--grammar-objects",
+                  "php",
+                  "<(PRODUCT_DIR)/grammar_php",
+                  "<(CONFIGURATION_NAME)"
+                ]
+              }
+            ]
+          }
+        ]
+      ]
+    },
+    {
+      "target_name": "php_engine",
+      "type": "static_library",
       "cflags!": [
         "-fno-exceptions"
       ],
@@ -157,21 +678,82 @@
         "-fno-exceptions"
       ],
       "sources": [
-        "native/src/addon.cc",
-        "../tree-sitter/lib/src/lib.c",
-        "../tree-sitter-php/php/src/parser.c",
-        "../tree-sitter-php/php/src/scanner.c"
+        "native/src/candidate_db.cc",
+        "native/src/cce_engine.cc",
+        "native/src/conversion_worker.cc",
+        "native/src/document_session.cc",
+        "native/src/engine.cc",
+        "native/src/engine_stats.cc",
+        "native/src/engine_tuning.cc",
+        "native/src/identifier_index.cc",
+        "native/src/line_index.cc",
+        "native/src/memory_budget.cc",
+        "native/src/outline.cc",
+        "native/src/recovery_limit.cc",
+        "native/src/redact.cc",
+        "native/src/semantic_tokens.cc",
+        "native/src/symbol_classes.cc",
+        "native/src/token_model.cc",
+        "native/src/token_stream.cc",
+        "native/src/lr_simulator.cc"
       ],
       "include_dirs": [
-        "<!@(node -p \"require('node-addon-api').include\")",
+        "native/include",
+        "native/src",
         "../tree-sitter/lib/include",
         "../tree-sitter/lib/src",
         "../tree-sitter-php/php/src"
       ],
       "defines": [
-        "NAPI_DISABLE_CPP_EXCEPTIONS",
         "LANG_PHP"
       ],
+      "direct_dependent_settings": {
+        "include_dirs": [
+          "native/include",
+          "native/src",
+          "../tree-sitter/lib/include",
+          "../tree-sitter/lib/src",
+          "../tree-sitter-php/php/src"
+        ],
+        "defines": [
+          "LANG_PHP"
+        ]
+      },
+      "conditions": [
+        [
+          "OS=='win'",
+          {
+            "sources": [
+              "../tree-sitter/lib/src/lib.c",
+              "../tree-sitter-php/php/src/parser.c",
+              "../tree-sitter-php/php/src/scanner.c"
+            ]
+          },
+          {
+            "dependencies": [
+              "php_grammar_objects"
+            ],
+            "link_settings": {
+              "libraries": [
+                "<(PRODUCT_DIR)/grammar_php/tree_sitter_lib.o",
+                "<(PRODUCT_DIR)/grammar_php/parser.o",
+                "<(PRODUCT_DIR)/grammar_php/scanner.o"
+              ]
+            }
+          }
+        ],
+        [
+          "OS!='win'",
+          {
+            "cflags": [
+              "-fPIC"
+            ],
+            "cflags_cc": [
+              "-fPIC"
+            ]
+          }
+        ]
+      ],
       "msvs_settings": {
         "VCCLCompilerTool": {
           "ExceptionHandling": 1
@@ -179,7 +761,44 @@
       }
     },
     {
-      "target_name": "python_parser_addon",
+      "target_name": "python_grammar_objects",
+      "type": "none",
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "actions": [
+              {
+                "action_name": "compile_python_grammar",
+                "inputs": [
+                  "generate_build_config.py",
+                  "native/src/generated/lang_constants.h",
+                  "../tree-sitter-python/src/parser.c",
+                  "../tree-sitter-python/src/scanner.c",
+                  "../tree-sitter/lib/src/lib.c"
+                ],
+                "outputs": [
+                  "<(PRODUCT_DIR)/grammar_python/tree_sitter_lib.o",
+                  "<(PRODUCT_DIR)/grammar_python/parser.o",
+                  "<(PRODUCT_DIR)/grammar_python/scanner.o"
+                ],
+                "action": [
+                  "python3",
+                  "generate_build_config.py",
+                  "--grammar-objects",
+                  "python",
+                  "<(PRODUCT_DIR)/grammar_python",
+                  "<(CONFIGURATION_NAME)"
+                ]
+              }
+            ]
+          }
+        ]
+      ]
+    },
+    {
+      "target_name": "python_engine",
+      "type": "static_library",
       "cflags!": [
         "-fno-exceptions"
       ],
@@ -187,21 +806,82 @@
         "-fno-exceptions"
       ],
       "sources": [
-        "native/src/addon.cc",
-        "../tree-sitter/lib/src/lib.c",
-        "../tree-sitter-python/src/parser.c",
-        "../tree-sitter-python/src/scanner.c"
+        "native/src/candidate_db.cc",
+        "native/src/cce_engine.cc",
+        "native/src/conversion_worker.cc",
+        "native/src/document_session.cc",
+        "native/src/engine.cc",
+        "native/src/engine_stats.cc",
+        "native/src/engine_tuning.cc",
+        "native/src/identifier_index.cc",
+        "native/src/line_index.cc",
+        "native/src/memory_budget.cc",
+        "native/src/outline.cc",
+        "native/src/recovery_limit.cc",
+        "native/src/redact.cc",
+        "native/src/semantic_tokens.cc",
+        "native/src/symbol_classes.cc",
+        "native/src/token_model.cc",
+        "native/src/token_stream.cc",
+        "native/src/lr_simulator.cc"
       ],
       "include_dirs": [
-        "<!@(node -p \"require('node-addon-api').include\")",
+        "native/include",
+        "native/src",
         "../tree-sitter/lib/include",
         "../tree-sitter/lib/src",
         "../tree-sitter-python/src"
       ],
       "defines": [
-        "NAPI_DISABLE_CPP_EXCEPTIONS",
         "LANG_PYTHON"
       ],
+      "direct_dependent_settings": {
+        "include_dirs": [
+          "native/include",
+          "native/src",
+          "../tree-sitter/lib/include",
+          "../tree-sitter/lib/src",
+          "../tree-sitter-python/src"
+        ],
+        "defines": [
+          "LANG_PYTHON"
+        ]
+      },
+      "conditions": [
+        [
+          "OS=='win'",
+          {
+            "sources": [
+              "../tree-sitter/lib/src/lib.c",
+              "../tree-sitter-python/src/parser.c",
+              "../tree-sitter-python/src/scanner.c"
+            ]
+          },
+          {
+            "dependencies": [
+              "python_grammar_objects"
+            ],
+            "link_settings": {
+              "libraries": [
+                "<(PRODUCT_DIR)/grammar_python/tree_sitter_lib.o",
+                "<(PRODUCT_DIR)/grammar_python/parser.o",
+                "<(PRODUCT_DIR)/grammar_python/scanner.o"
+              ]
+            }
+          }
+        ],
+        [
+          "OS!='win'",
+          {
+            "cflags": [
+              "-fPIC"
+            ],
+            "cflags_cc": [
+              "-fPIC"
+            ]
+          }
+        ]
+      ],
       "msvs_settings": {
         "VCCLCompilerTool": {
           "ExceptionHandling": 1
@@ -209,7 +889,44 @@
       }
     },
     {
-      "target_name": "ruby_parser_addon",
+      "target_name": "ruby_grammar_objects",
+      "type": "none",
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "actions": [
+              {
+                "action_name": "compile_ruby_grammar",
+                "inputs": [
+                  "generate_build_config.py",
+                  "native/src/generated/lang_constants.h",
+                  "../tree-sitter-ruby/src/parser.c",
+                  "../tree-sitter-ruby/src/scanner.c",
+                  "../tree-sitter/lib/src/lib.c"
+                ],
+                "outputs": [
+                  "<(PRODUCT_DIR)/grammar_ruby/tree_sitter_lib.o",
+                  "<(PRODUCT_DIR)/grammar_ruby/parser.o",
+                  "<(PRODUCT_DIR)/grammar_ruby/scanner.o"
+                ],
+                "action": [
+                  "python3",
+                  "generate_build_config.py",
+                  "--grammar-objects",
+                  "ruby",
+                  "<(PRODUCT_DIR)/grammar_ruby",
+                  "<(CONFIGURATION_NAME)"
+                ]
+              }
+            ]
+          }
+        ]
+      ]
+    },
+    {
+      "target_name": "ruby_engine",
+      "type": "static_library",
       "cflags!": [
         "-fno-exceptions"
       ],
@@ -217,21 +934,82 @@
         "-fno-exceptions"
       ],
       "sources": [
-        "native/src/addon.cc",
-        "../tree-sitter/lib/src/lib.c",
-        "../tree-sitter-ruby/src/parser.c",
-        "../tree-sitter-ruby/src/scanner.c"
+        "native/src/candidate_db.cc",
+        "native/src/cce_engine.cc",
+        "native/src/conversion_worker.cc",
+        "native/src/document_session.cc",
+        "native/src/engine.cc",
+        "native/src/engine_stats.cc",
+        "native/src/engine_tuning.cc",
+        "native/src/identifier_index.cc",
+        "native/src/line_index.cc",
+        "native/src/memory_budget.cc",
+        "native/src/outline.cc",
+        "native/src/recovery_limit.cc",
+        "native/src/redact.cc",
+        "native/src/semantic_tokens.cc",
+        "native/src/symbol_classes.cc",
+        "native/src/token_model.cc",
+        "native/src/token_stream.cc",
+        "native/src/lr_simulator.cc"
       ],
       "include_dirs": [
-        "<!@(node -p \"require('node-addon-api').include\")",
+        "native/include",
+        "native/src",
         "../tree-sitter/lib/include",
         "../tree-sitter/lib/src",
         "../tree-sitter-ruby/src"
       ],
       "defines": [
-        "NAPI_DISABLE_CPP_EXCEPTIONS",
         "LANG_RUBY"
       ],
+      "direct_dependent_settings": {
+        "include_dirs": [
+          "native/include",
+          "native/src",
+          "../tree-sitter/lib/include",
+          "../tree-sitter/lib/src",
+          "../tree-sitter-ruby/src"
+        ],
+        "defines": [
+          "LANG_RUBY"
+        ]
+      },
+      "conditions": [
+        [
+          "OS=='win'",
+          {
+            "sources": [
+              "../tree-sitter/lib/src/lib.c",
+              "../tree-sitter-ruby/src/parser.c",
+              "../tree-sitter-ruby/src/scanner.c"
+            ]
+          },
+          {
+            "dependencies": [
+              "ruby_grammar_objects"
+            ],
+            "link_settings": {
+              "libraries": [
+                "<(PRODUCT_DIR)/grammar_ruby/tree_sitter_lib.o",
+                "<(PRODUCT_DIR)/grammar_ruby/parser.o",
+                "<(PRODUCT_DIR)/grammar_ruby/scanner.o"
+              ]
+            }
+          }
+        ],
+        [
+          "OS!='win'",
+          {
+            "cflags": [
+              "-fPIC"
+            ],
+            "cflags_cc": [
+              "-fPIC"
+            ]
+          }
+        ]
+      ],
       "msvs_settings": {
         "VCCLCompilerTool": {
           "ExceptionHandling": 1
@@ -239,7 +1017,42 @@
       }
     },
     {
-      "target_name": "sb_parser_addon",
+      "target_name": "smallbasic_grammar_objects",
+      "type": "none",
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "actions": [
+              {
+                "action_name": "compile_smallbasic_grammar",
+                "inputs": [
+                  "generate_build_config.py",
+                  "native/src/generated/lang_constants.h",
+                  "../tree-sitter-smallbasic/src/parser.c",
+                  "../tree-sitter/lib/src/lib.c"
+                ],
+                "outputs": [
+                  "<(PRODUCT_DIR)/grammar_smallbasic/tree_sitter_lib.o",
+                  "<(PRODUCT_DIR)/grammar_smallbasic/parser.o"
+                ],
+                "action": [
+                  "python3",
+                  "generate_build_config.py",
+                  "--grammar-objects",
+                  "smallbasic",
+                  "<(PRODUCT_DIR)/grammar_smallbasic",
+                  "<(CONFIGURATION_NAME)"
+                ]
+              }
+            ]
+          }
+        ]
+      ]
+    },
+    {
+      "target_name": "smallbasic_engine",
+      "type": "static_library",
       "cflags!": [
         "-fno-exceptions"
       ],
@@ -247,20 +1060,1727 @@
         "-fno-exceptions"
       ],
       "sources": [
-        "native/src/addon.cc",
-        "../tree-sitter/lib/src/lib.c",
-        "../tree-sitter-smallbasic/src/parser.c"
+        "native/src/candidate_db.cc",
+        "native/src/cce_engine.cc",
+        "native/src/conversion_worker.cc",
+        "native/src/document_session.cc",
+        "native/src/engine.cc",
+        "native/src/engine_stats.cc",
+        "native/src/engine_tuning.cc",
+        "native/src/identifier_index.cc",
+        "native/src/line_index.cc",
+        "native/src/memory_budget.cc",
+        "native/src/outline.cc",
+        "native/src/recovery_limit.cc",
+        "native/src/redact.cc",
+        "native/src/semantic_tokens.cc",
+        "native/src/symbol_classes.cc",
+        "native/src/token_model.cc",
+        "native/src/token_stream.cc",
+        "native/src/lr_simulator.cc"
       ],
       "include_dirs": [
-        "<!@(node -p \"require('node-addon-api').include\")",
+        "native/include",
+        "native/src",
         "../tree-sitter/lib/include",
         "../tree-sitter/lib/src",
         "../tree-sitter-smallbasic/src"
       ],
       "defines": [
-        "NAPI_DISABLE_CPP_EXCEPTIONS",
         "LANG_SMALLBASIC"
       ],
+      "direct_dependent_settings": {
+        "include_dirs": [
+          "native/include",
+          "native/src",
+          "../tree-sitter/lib/include",
+          "../tree-sitter/lib/src",
+          "../tree-sitter-smallbasic/src"
+        ],
+        "defines": [
+          "LANG_SMALLBASIC"
+        ]
+      },
+      "conditions": [
+        [
+          "OS=='win'",
+          {
+            "sources": [
+              "../tree-sitter/lib/src/lib.c",
+              "../tree-sitter-smallbasic/src/parser.c"
+            ]
+          },
+          {
+            "dependencies": [
+              "smallbasic_grammar_objects"
+            ],
+            "link_settings": {
+              "libraries": [
+                "<(PRODUCT_DIR)/grammar_smallbasic/tree_sitter_lib.o",
+                "<(PRODUCT_DIR)/grammar_smallbasic/parser.o"
+              ]
+            }
+          }
+        ],
+        [
+          "OS!='win'",
+          {
+            "cflags": [
+              "-fPIC"
+            ],
+            "cflags_cc": [
+              "-fPIC"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "c_parser_addon",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/src/addon.cc"
+      ],
+      "dependencies": [
+        "c_engine"
+      ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "defines": [
+        "NAPI_DISABLE_CPP_EXCEPTIONS"
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "cpp_parser_addon",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/src/addon.cc"
+      ],
+      "dependencies": [
+        "cpp_engine"
+      ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "defines": [
+        "NAPI_DISABLE_CPP_EXCEPTIONS"
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "haskell_parser_addon",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/src/addon.cc"
+      ],
+      "dependencies": [
+        "haskell_engine"
+      ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "defines": [
+        "NAPI_DISABLE_CPP_EXCEPTIONS"
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "java_parser_addon",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/src/addon.cc"
+      ],
+      "dependencies": [
+        "java_engine"
+      ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "defines": [
+        "NAPI_DISABLE_CPP_EXCEPTIONS"
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "javascript_parser_addon",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/src/addon.cc"
+      ],
+      "dependencies": [
+        "javascript_engine"
+      ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "defines": [
+        "NAPI_DISABLE_CPP_EXCEPTIONS"
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "php_parser_addon",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/src/addon.cc"
+      ],
+      "dependencies": [
+        "php_engine"
+      ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "defines": [
+        "NAPI_DISABLE_CPP_EXCEPTIONS"
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "python_parser_addon",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/src/addon.cc"
+      ],
+      "dependencies": [
+        "python_engine"
+      ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "defines": [
+        "NAPI_DISABLE_CPP_EXCEPTIONS"
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "ruby_parser_addon",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/src/addon.cc"
+      ],
+      "dependencies": [
+        "ruby_engine"
+      ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "defines": [
+        "NAPI_DISABLE_CPP_EXCEPTIONS"
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "sb_parser_addon",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/src/addon.cc"
+      ],
+      "dependencies": [
+        "smallbasic_engine"
+      ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "defines": [
+        "NAPI_DISABLE_CPP_EXCEPTIONS"
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "c_collect_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/collect_candidates.cc",
+        "native/src/action_trace.cc"
+      ],
+      "dependencies": [
+        "c_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "c_train_token_model",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/train_token_model.cc"
+      ],
+      "dependencies": [
+        "c_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "c_difftest",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/difftest.cc"
+      ],
+      "dependencies": [
+        "c_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "c_engine_bench",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/engine_bench.cc"
+      ],
+      "dependencies": [
+        "c_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "c_prune_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/prune_candidates.cc",
+        "native/src/candidate_check.cc"
+      ],
+      "dependencies": [
+        "c_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "cpp_collect_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/collect_candidates.cc",
+        "native/src/action_trace.cc"
+      ],
+      "dependencies": [
+        "cpp_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "cpp_train_token_model",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/train_token_model.cc"
+      ],
+      "dependencies": [
+        "cpp_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "cpp_difftest",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/difftest.cc"
+      ],
+      "dependencies": [
+        "cpp_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "cpp_engine_bench",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/engine_bench.cc"
+      ],
+      "dependencies": [
+        "cpp_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "cpp_prune_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/prune_candidates.cc",
+        "native/src/candidate_check.cc"
+      ],
+      "dependencies": [
+        "cpp_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "haskell_collect_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/collect_candidates.cc",
+        "native/src/action_trace.cc"
+      ],
+      "dependencies": [
+        "haskell_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "haskell_train_token_model",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/train_token_model.cc"
+      ],
+      "dependencies": [
+        "haskell_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "haskell_difftest",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/difftest.cc"
+      ],
+      "dependencies": [
+        "haskell_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "haskell_engine_bench",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/engine_bench.cc"
+      ],
+      "dependencies": [
+        "haskell_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "haskell_prune_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/prune_candidates.cc",
+        "native/src/candidate_check.cc"
+      ],
+      "dependencies": [
+        "haskell_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "java_collect_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/collect_candidates.cc",
+        "native/src/action_trace.cc"
+      ],
+      "dependencies": [
+        "java_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "java_train_token_model",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/train_token_model.cc"
+      ],
+      "dependencies": [
+        "java_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "java_difftest",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/difftest.cc"
+      ],
+      "dependencies": [
+        "java_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "java_engine_bench",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/engine_bench.cc"
+      ],
+      "dependencies": [
+        "java_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "java_prune_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/prune_candidates.cc",
+        "native/src/candidate_check.cc"
+      ],
+      "dependencies": [
+        "java_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "javascript_collect_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/collect_candidates.cc",
+        "native/src/action_trace.cc"
+      ],
+      "dependencies": [
+        "javascript_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "javascript_train_token_model",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/train_token_model.cc"
+      ],
+      "dependencies": [
+        "javascript_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "javascript_difftest",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/difftest.cc"
+      ],
+      "dependencies": [
+        "javascript_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "javascript_engine_bench",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/engine_bench.cc"
+      ],
+      "dependencies": [
+        "javascript_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "javascript_prune_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/prune_candidates.cc",
+        "native/src/candidate_check.cc"
+      ],
+      "dependencies": [
+        "javascript_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "php_collect_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/collect_candidates.cc",
+        "native/src/action_trace.cc"
+      ],
+      "dependencies": [
+        "php_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "php_train_token_model",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/train_token_model.cc"
+      ],
+      "dependencies": [
+        "php_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "php_difftest",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/difftest.cc"
+      ],
+      "dependencies": [
+        "php_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "php_engine_bench",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/engine_bench.cc"
+      ],
+      "dependencies": [
+        "php_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "php_prune_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/prune_candidates.cc",
+        "native/src/candidate_check.cc"
+      ],
+      "dependencies": [
+        "php_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "python_collect_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/collect_candidates.cc",
+        "native/src/action_trace.cc"
+      ],
+      "dependencies": [
+        "python_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "python_train_token_model",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/train_token_model.cc"
+      ],
+      "dependencies": [
+        "python_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "python_difftest",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/difftest.cc"
+      ],
+      "dependencies": [
+        "python_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "python_engine_bench",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/engine_bench.cc"
+      ],
+      "dependencies": [
+        "python_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "python_prune_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/prune_candidates.cc",
+        "native/src/candidate_check.cc"
+      ],
+      "dependencies": [
+        "python_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "ruby_collect_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/collect_candidates.cc",
+        "native/src/action_trace.cc"
+      ],
+      "dependencies": [
+        "ruby_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "ruby_train_token_model",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/train_token_model.cc"
+      ],
+      "dependencies": [
+        "ruby_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "ruby_difftest",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/difftest.cc"
+      ],
+      "dependencies": [
+        "ruby_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "ruby_engine_bench",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/engine_bench.cc"
+      ],
+      "dependencies": [
+        "ruby_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "ruby_prune_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/prune_candidates.cc",
+        "native/src/candidate_check.cc"
+      ],
+      "dependencies": [
+        "ruby_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "smallbasic_collect_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/collect_candidates.cc",
+        "native/src/action_trace.cc"
+      ],
+      "dependencies": [
+        "smallbasic_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "smallbasic_train_token_model",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/train_token_model.cc"
+      ],
+      "dependencies": [
+        "smallbasic_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "smallbasic_difftest",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/difftest.cc"
+      ],
+      "dependencies": [
+        "smallbasic_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "smallbasic_engine_bench",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/engine_bench.cc"
+      ],
+      "dependencies": [
+        "smallbasic_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "ExceptionHandling": 1
+        }
+      }
+    },
+    {
+      "target_name": "smallbasic_prune_candidates",
+      "type": "executable",
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions"
+      ],
+      "sources": [
+        "native/tools/prune_candidates.cc",
+        "native/src/candidate_check.cc"
+      ],
+      "dependencies": [
+        "smallbasic_engine"
+      ],
+      "conditions": [
+        [
+          "OS!='win'",
+          {
+            "ldflags": [
+              "-pthread"
+            ]
+          }
+        ]
+      ],
       "msvs_settings": {
         "VCCLCompilerTool": {
           "ExceptionHandling": 1
@@ -1,15 +1,28 @@
 #!/usr/bin/env python3
 """
-binding.gyp와 addon.cc의 언어별 설정을 자동 생성한다.
+binding.gyp와 native/src/lang_select.h의 언어별 설정, native/src/generated/lang_constants.h를 자동 생성한다.
 resources/ 디렉토리에 존재하는 언어를 기반으로,
 실제 tree-sitter-{lang} 소스가 존재하는 언어만 생성한다.
 
+문법(parser.c/scanner.c)과 Tree-sitter 런타임(lib.c)은 node-gyp가 직접 컴파일하지 않는다 (Windows 제외).
+빌드 중에 {lang}_grammar_objects 타겟이 이 스크립트를 --grammar-objects 모드로 불러, 소스/헤더 내용 +
+컴파일러 + 플래그의 해시를 키로 하는 로컬 캐시(.grammar_cache/)에서 오브젝트를 꺼내고 없을 때만 컴파일한다.
+그래서 node-gyp rebuild로 build/를 지워도 바뀐 단위만 다시 컴파일된다. 플래그는 빌드 구성(Release/Debug)별로
+다르고, 캐시는 오래 안 쓴 항목부터 지워 크기 상한을 지킨다.
+
 사용법: python3 generate_build_config.py
+        python3 generate_build_config.py --grammar-objects <lang> <출력 디렉토리> [<구성>]   (binding.gyp 액션용)
 """
 
+import hashlib
 import json
 import os
 import re
+import shutil
+import subprocess
+import sys
+import time
+from concurrent.futures import ThreadPoolExecutor
 
 # ============================================================
 # 설정
@@ -28,12 +41,97 @@ PARSER_PATH_OVERRIDES = {
     "typescript": "typescript/src",
 }
 
+# 고정 크기 LR 스택 용량 (컨버전 상태 경로 / 제약 디코딩 스택 최대 깊이)
+# = 중첩 깊이 × 가장 긴 생성 규칙 길이(MAX_ALIAS_SEQUENCE_LENGTH). 중첩 한 단계가 스택에 쌓는 상태는
+# 그 규칙의 길이를 넘지 않는다. 재귀 때문에 깊이만은 문법에서 정해지지 않으므로 기본값을 쓰고,
+# 깊게 중첩되는 문법만 늘린다
+STATE_PATH_NESTING_DEPTH = 32
+STATE_PATH_NESTING_DEPTH_OVERRIDES = {}
+
+# parser.c에서 읽어 lang_constants.h로 내보내는 #define (이름 → C++ 상수 이름)
+PARSER_CONSTANTS = {
+    "STATE_COUNT": "kStateCount",
+    "LARGE_STATE_COUNT": "kLargeStateCount",
+    "SYMBOL_COUNT": "kGrammarSymbolCount",
+    "ALIAS_COUNT": "kAliasCount",
+    "TOKEN_COUNT": "kTokenCount",
+    "EXTERNAL_TOKEN_COUNT": "kExternalTokenCount",
+    "FIELD_COUNT": "kFieldCount",
+    "MAX_ALIAS_SEQUENCE_LENGTH": "kMaxAliasSequenceLength",
+    "PRODUCTION_ID_COUNT": "kProductionIdCount",
+}
+
+# 언어별 엔진 정적 라이브러리 {lang}_engine (native/src/engine.h + C ABI native/include/cce_engine.h)
+# addon과 CLI 도구는 이 라이브러리에 링크한다
+ENGINE_SOURCES = [
+    "native/src/candidate_db.cc",
+    "native/src/cce_engine.cc",
+    "native/src/conversion_worker.cc",
+    "native/src/document_session.cc",
+    "native/src/engine.cc",
+    "native/src/engine_stats.cc",
+    "native/src/engine_tuning.cc",
+    "native/src/identifier_index.cc",
+    "native/src/line_index.cc",
+    "native/src/memory_budget.cc",
+    "native/src/outline.cc",
+    "native/src/recovery_limit.cc",
+    "native/src/redact.cc",
+    "native/src/semantic_tokens.cc",
+    "native/src/symbol_classes.cc",
+    "native/src/token_model.cc",
+    "native/src/token_stream.cc",
+    "native/src/lr_simulator.cc",
+]
+
+# 문법 오브젝트 캐시 (.gitignore). 언제 지워도 된다 (다음 빌드에서 다시 채움)
+GRAMMAR_CACHE_DIR = os.environ.get("CCE_GRAMMAR_CACHE_DIR", os.path.join(EXT_DIR, ".grammar_cache"))
+# 캐시 키 형식이 바뀌면 올린다
+GRAMMAR_CACHE_FORMAT = "1"
+# 빌드 구성별 C 플래그. node-gyp의 Release/Debug 플래그와 맞춘다 (addon/.so에 링크되므로 -fPIC).
+# 문법/런타임은 외부 코드라 경고는 끈다
+GRAMMAR_CFLAGS = {
+    "Release": ["-O3", "-fPIC", "-std=gnu11", "-w"],
+    "Debug": ["-O0", "-g", "-fPIC", "-std=gnu11", "-w"],
+}
+# 캐시 상한. 넘으면 마지막으로 쓴 시각이 오래된 오브젝트부터 지운다 (기한이 지난 것은 크기와 상관없이)
+GRAMMAR_CACHE_MAX_BYTES = int(os.environ.get("CCE_GRAMMAR_CACHE_MAX_MB", "512")) * 1024 * 1024
+GRAMMAR_CACHE_MAX_AGE_DAYS = 30
+
+# addon 타겟 소스 (N-API 바인딩만, 나머지는 {lang}_engine)
+ADDON_SOURCES = [
+    "native/src/addon.cc",
+]
+
+# addon과 함께 언어별로 빌드하는 CLI 도구 (native/tools/)
+# 타겟 이름: {lang}_{tool}
+TOOLS = {
+    "collect_candidates": [
+        "native/tools/collect_candidates.cc",
+        "native/src/action_trace.cc",
+    ],
+    "train_token_model": [
+        "native/tools/train_token_model.cc",
+    ],
+    "difftest": [
+        "native/tools/difftest.cc",
+    ],
+    "engine_bench": [
+        "native/tools/engine_bench.cc",
+    ],
+    "prune_candidates": [
+        "native/tools/prune_candidates.cc",
+        "native/src/candidate_check.cc",
+    ],
+}
+
 
 # ============================================================
 # 언어 탐색
 # ============================================================
-def discover_languages():
+def discover_languages(verbose=True):
     languages = []
+    log = print if verbose else (lambda *args, **kwargs: None)
 
     for lang in sorted(os.listdir(RESOURCES_DIR)):
         lang_res = os.path.join(RESOURCES_DIR, lang)
@@ -44,27 +142,36 @@ def discover_languages():
 
         ts_dir = os.path.join(os.path.dirname(EXT_DIR), f"tree-sitter-{lang}")
         if not os.path.isdir(ts_dir):
-            print(f"  [SKIP] {lang}: tree-sitter-{lang} 디렉토리 없음")
+            log(f"  [SKIP] {lang}: tree-sitter-{lang} 디렉토리 없음")
             continue
 
         sub = PARSER_PATH_OVERRIDES.get(lang, "src")
         parser_c = os.path.join(ts_dir, sub, "parser.c")
         if not os.path.exists(parser_c):
-            print(f"  [SKIP] {lang}: {parser_c} 없음")
+            log(f"  [SKIP] {lang}: {parser_c} 없음")
             continue
 
         scanner_c = os.path.join(ts_dir, sub, "scanner.c")
         has_scanner = os.path.exists(scanner_c)
 
         func_name = None
+        constants = {}
         with open(parser_c, "r", errors="replace") as f:
             for line in f:
+                m = re.match(r"#define\s+(\w+)\s+(\d+)\s*$", line)
+                if m and m.group(1) in PARSER_CONSTANTS:
+                    constants[m.group(1)] = int(m.group(2))
+                    continue
                 m = re.search(r"TSLanguage\s*\*\s*(tree_sitter_\w+)", line)
                 if m:
                     func_name = m.group(1)
                     break
         if not func_name:
-            print(f"  [SKIP] {lang}: tree_sitter_* 함수를 찾을 수 없음")
+            log(f"  [SKIP] {lang}: tree_sitter_* 함수를 찾을 수 없음")
+            continue
+        missing = [name for name in PARSER_CONSTANTS if name not in constants]
+        if missing:
+            log(f"  [SKIP] {lang}: parser.c에 {', '.join(missing)} 정의 없음")
             continue
 
         rel_sub = f"../tree-sitter-{lang}/{sub}"
@@ -79,9 +186,10 @@ def discover_languages():
             "rel_parser": f"{rel_sub}/parser.c",
             "rel_scanner": f"{rel_sub}/scanner.c" if has_scanner else None,
             "rel_include": rel_sub,
+            "constants": constants,
         })
         status = "+ scanner" if has_scanner else ""
-        print(f"  [OK] {lang}: {addon_name} ({func_name}) {status}")
+        log(f"  [OK] {lang}: {addon_name} ({func_name}) {status}")
 
     return languages
 
@@ -89,34 +197,148 @@ def discover_languages():
 # ============================================================
 # binding.gyp 생성
 # ============================================================
+def grammar_sources(info):
+    sources = ["../tree-sitter/lib/src/lib.c", info["rel_parser"]]
+    if info["rel_scanner"]:
+        sources.append(info["rel_scanner"])
+    return sources
+
+
+def grammar_object_names(info):
+    # grammar_sources와 같은 순서
+    names = ["tree_sitter_lib.o", "parser.o"]
+    if info["rel_scanner"]:
+        names.append("scanner.o")
+    return names
+
+
+def grammar_objects_target_name(info):
+    return f"{info['lang']}_grammar_objects"
+
+
+def grammar_object_inputs(info):
+    # 액션 입력 = 캐시 키에 들어가는 파일 전부 (lib.c가 include한 .c, include 경로/소스 디렉토리의 헤더).
+    # 하나라도 바뀌면 액션이 다시 돌아 캐시 키를 새로 계산한다. 헤더가 새로 생기면 이 스크립트를 다시 돌린다
+    include_dirs = [os.path.normpath(os.path.join(EXT_DIR, d)) for d in tree_sitter_include_dirs(info)]
+    files = set()
+    for source in grammar_sources(info):
+        path = os.path.normpath(os.path.join(EXT_DIR, source))
+        if os.path.exists(path):
+            files.update(unit_dependencies(path, include_dirs))
+        else:
+            files.add(path)
+    # lang_constants.h도 넣는다 (액션이 parser.c와 맞는지 확인한다)
+    return ["generate_build_config.py", "native/src/generated/lang_constants.h"] + sorted(os.path.relpath(f, EXT_DIR).replace(os.sep, "/") for f in files)
+
+
+def grammar_objects_target(info):
+    # 출력 이름은 고정이고 내용만 캐시에서 바뀌므로 binding.gyp를 다시 만들 필요가 없다
+    out_dir = f"<(PRODUCT_DIR)/grammar_{info['lang']}"
+    return {
+        "target_name": grammar_objects_target_name(info),
+        "type": "none",
+        "conditions": [
+            ["OS!='win'", {
+                "actions": [{
+                    "action_name": f"compile_{info['lang']}_grammar",
+                    "inputs": grammar_object_inputs(info),
+                    "outputs": [f"{out_dir}/{name}" for name in grammar_object_names(info)],
+                    "action": ["python3", "generate_build_config.py", "--grammar-objects", info["lang"], out_dir,
+                               "<(CONFIGURATION_NAME)"],
+                }],
+            }],
+        ],
+    }
+
+
+def tree_sitter_include_dirs(info):
+    return [
+        "../tree-sitter/lib/include",
+        "../tree-sitter/lib/src",
+        info["rel_include"],
+    ]
+
+
+def engine_target_name(info):
+    return f"{info['lang']}_engine"
+
+
+def engine_target(info):
+    # 문법(parser.c/scanner.c)과 Tree-sitter 런타임까지 포함한다.
+    # include 경로와 LANG_* 매크로는 direct_dependent_settings로 링크하는 타겟에 전달된다.
+    include_dirs = ["native/include", "native/src"] + tree_sitter_include_dirs(info)
+    return {
+        "target_name": engine_target_name(info),
+        "type": "static_library",
+        "cflags!": ["-fno-exceptions"],
+        "cflags_cc!": ["-fno-exceptions"],
+        "sources": ENGINE_SOURCES,
+        "include_dirs": include_dirs,
+        "defines": [info["macro_name"]],
+        "direct_dependent_settings": {
+            "include_dirs": include_dirs,
+            "defines": [info["macro_name"]],
+        },
+        "conditions": [
+            # Windows(MSVC)는 문법을 직접 컴파일한다. 나머지는 캐시된 오브젝트를 링크하는 쪽에 넘긴다
+            ["OS=='win'", {"sources": grammar_sources(info)}, {
+                "dependencies": [grammar_objects_target_name(info)],
+                "link_settings": {
+                    "libraries": [f"<(PRODUCT_DIR)/grammar_{info['lang']}/{name}" for name in grammar_object_names(info)],
+                },
+            }],
+            # addon(.node 공유 객체)에 링크되므로 위치 독립 코드로 빌드
+            ["OS!='win'", {"cflags": ["-fPIC"], "cflags_cc": ["-fPIC"]}],
+        ],
+        "msvs_settings": {
+            "VCCLCompilerTool": {"ExceptionHandling": 1}
+        },
+    }
+
+
+def tool_target(info, tool, tool_sources):
+    return {
+        "target_name": f"{info['lang']}_{tool}",
+        "type": "executable",
+        "cflags!": ["-fno-exceptions"],
+        "cflags_cc!": ["-fno-exceptions"],
+        "sources": tool_sources,
+        "dependencies": [engine_target_name(info)],
+        "conditions": [
+            ["OS!='win'", {"ldflags": ["-pthread"]}],
+        ],
+        "msvs_settings": {
+            "VCCLCompilerTool": {"ExceptionHandling": 1}
+        },
+    }
+
+
 def generate_binding_gyp(languages):
     targets = []
     for info in languages:
-        sources = [
-            "native/src/addon.cc",
-            "../tree-sitter/lib/src/lib.c",
-            info["rel_parser"],
-        ]
-        if info["rel_scanner"]:
-            sources.append(info["rel_scanner"])
+        targets.append(grammar_objects_target(info))
+        targets.append(engine_target(info))
 
+    for info in languages:
         targets.append({
             "target_name": info["addon_name"],
             "cflags!": ["-fno-exceptions"],
             "cflags_cc!": ["-fno-exceptions"],
-            "sources": sources,
+            "sources": ADDON_SOURCES,
+            "dependencies": [engine_target_name(info)],
             "include_dirs": [
                 "<!@(node -p \"require('node-addon-api').include\")",
-                "../tree-sitter/lib/include",
-                "../tree-sitter/lib/src",
-                info["rel_include"],
             ],
-            "defines": ["NAPI_DISABLE_CPP_EXCEPTIONS", info["macro_name"]],
+            "defines": ["NAPI_DISABLE_CPP_EXCEPTIONS"],
             "msvs_settings": {
                 "VCCLCompilerTool": {"ExceptionHandling": 1}
             },
         })
 
+    for info in languages:
+        for tool, tool_sources in TOOLS.items():
+            targets.append(tool_target(info, tool, tool_sources))
+
     out_path = os.path.join(EXT_DIR, "binding.gyp")
     with open(out_path, "w") as f:
         json.dump({"targets": targets}, f, indent=2)
@@ -125,17 +347,17 @@ def generate_binding_gyp(languages):
 
 
 # ============================================================
-# addon.cc 언어 분기 생성
+# lang_select.h 언어 분기 생성
 # ============================================================
 def generate_addon_lang_block(languages):
-    addon_path = os.path.join(EXT_DIR, "native", "src", "addon.cc")
-    with open(addon_path, "r") as f:
+    header_path = os.path.join(EXT_DIR, "native", "src", "lang_select.h")
+    with open(header_path, "r") as f:
         content = f.read()
 
     pattern = r"// 언어 정의 함수.*?#endif"
     match = re.search(pattern, content, re.DOTALL)
     if not match:
-        print("  [ERROR] addon.cc에서 언어 정의 블록을 찾을 수 없음")
+        print("  [ERROR] lang_select.h에서 언어 정의 블록을 찾을 수 없음")
         return
 
     lines = ["// 언어 정의 함수 — generate_build_config.py에 의해 자동 생성됨"]
@@ -151,26 +373,226 @@ def generate_addon_lang_block(languages):
     new_block = "\n".join(lines)
     content = content[:match.start()] + new_block + content[match.end():]
 
-    with open(addon_path, "w") as f:
+    with open(header_path, "w") as f:
         f.write(content)
-    print(f"  -> addon.cc 언어 블록 생성 완료 ({len(languages)}개 언어)")
+    print(f"  -> lang_select.h 언어 블록 생성 완료 ({len(languages)}개 언어)")
+
+
+# ============================================================
+# generated/lang_constants.h 생성 (.gitignore, 빌드 전에 매번 생성)
+# ============================================================
+def lang_constants_lines(info):
+    lines = [f'constexpr const char *kLanguageName = "{info["lang"]}";']
+    for define, name in PARSER_CONSTANTS.items():
+        lines.append(f'constexpr uint32_t {name} = {info["constants"][define]};')
+    depth = STATE_PATH_NESTING_DEPTH_OVERRIDES.get(info["lang"], STATE_PATH_NESTING_DEPTH)
+    lines.append(f'constexpr uint32_t kMaxNestingDepth = {depth};')
+    return lines
+
+
+def check_lang_constants(info):
+    """generated/lang_constants.h의 이 언어 블록이 지금 parser.c의 #define과 같은지 (다르면 오류 메시지)"""
+    path = os.path.join(EXT_DIR, "native", "src", "generated", "lang_constants.h")
+    try:
+        with open(path, "r") as f:
+            generated = f.read()
+    except OSError:
+        return f"{path} 없음"
+    block = f'defined({info["macro_name"]})\n' + "\n".join(lang_constants_lines(info)) + "\n"
+    if block not in generated:
+        return f"generated/lang_constants.h가 {info['rel_parser']}와 다름 (parser.c를 다시 생성했으면 이 스크립트를 다시 실행)"
+    return None
+
+
+def generate_lang_constants(languages):
+    out_dir = os.path.join(EXT_DIR, "native", "src", "generated")
+    os.makedirs(out_dir, exist_ok=True)
+
+    lines = [
+        "/**",
+        " * @file lang_constants.h",
+        " * @brief 언어별 문법 상수 — generate_build_config.py가 parser.c의 #define에서 생성 (직접 편집 금지)",
+        " *",
+        " * LANG_* 매크로로 빌드 타겟의 언어를 고르며, 컴파일 시점에 테이블/스택 크기를 정하는 데 쓴다.",
+        " * parser.c를 다시 생성했으면 이 파일도 다시 만들어야 한다 (빌드 중 문법 오브젝트 액션이 확인하고,",
+        " * addon 초기화 때 런타임 값과 다르면 로드를 실패시킨다).",
+        " */",
+        "",
+        "#pragma once",
+        "",
+        "#include <cstdint>",
+        "",
+        "namespace lang_constants {",
+        "",
+    ]
+    for i, info in enumerate(languages):
+        directive = "#if" if i == 0 else "#elif"
+        lines.append(f'{directive} defined({info["macro_name"]})')
+        lines += lang_constants_lines(info)
+    lines.append('#else')
+    lines.append('#error "언어 정의 없음: generate_build_config.py를 실행하세요."')
+    lines.append('#endif')
+    lines += [
+        "",
+        "// ts_language_symbol_count()와 같은 값 (별칭 심볼 포함)",
+        "constexpr uint32_t kSymbolCount = kGrammarSymbolCount + kAliasCount;",
+        "// 고정 크기 상태 경로/LR 스택 용량 (중첩 한 단계 = 가장 긴 생성 규칙만큼의 상태)",
+        "constexpr uint32_t kMaxStatePath = kMaxNestingDepth * kMaxAliasSequenceLength;",
+        "",
+        "}  // namespace lang_constants",
+        "",
+    ]
+
+    out_path = os.path.join(out_dir, "lang_constants.h")
+    with open(out_path, "w") as f:
+        f.write("\n".join(lines))
+    print(f"  -> generated/lang_constants.h 생성 완료 ({len(languages)}개 언어)")
+
+
+# ============================================================
+# 문법 오브젝트 캐시 (--grammar-objects, binding.gyp 액션에서 호출)
+# ============================================================
+_compiler_ids = {}
+
+
+def compiler_identity(compiler):
+    # 같은 이름이라도 버전이 바뀌면 다른 키가 되도록 --version 출력을 키에 넣는다
+    if compiler not in _compiler_ids:
+        try:
+            out = subprocess.run([compiler, "--version"], capture_output=True, text=True).stdout
+        except OSError:
+            out = ""
+        _compiler_ids[compiler] = f"{compiler}\n{out}"
+    return _compiler_ids[compiler]
+
+
+def unit_dependencies(source, include_dirs):
+    # 소스 + 따옴표로 include한 .c (lib.c는 런타임 전체를 한 단위로 묶는다) + include 경로/소스 디렉토리의 헤더
+    files = {source}
+    with open(source, "r", errors="replace") as f:
+        for m in re.finditer(r'#include\s+"([^"]+\.c)"', f.read()):
+            included = os.path.normpath(os.path.join(os.path.dirname(source), m.group(1)))
+            if os.path.exists(included):
+                files.add(included)
+    for root_dir in [os.path.dirname(source)] + include_dirs:
+        for dirpath, _, names in os.walk(root_dir):
+            files.update(os.path.join(dirpath, n) for n in names if n.endswith(".h"))
+    return sorted(files)
+
+
+def unit_key(source, include_dirs, compiler, flags):
+    h = hashlib.sha256()
+    h.update(f"{GRAMMAR_CACHE_FORMAT}\n{compiler_identity(compiler)}\n{' '.join(flags)}\n".encode())
+    for path in unit_dependencies(source, include_dirs):
+        h.update(os.path.relpath(path, os.path.dirname(EXT_DIR)).encode() + b"\0")
+        with open(path, "rb") as f:
+            h.update(hashlib.sha256(f.read()).digest())
+    return h.hexdigest()
+
+
+def cached_object(source, include_dirs, config):
+    """캐시에서 오브젝트 경로를 돌려준다 (없으면 컴파일해서 넣는다). 반환: (경로, 새로 컴파일했는지)"""
+    compiler = os.environ.get("CC", "cc")
+    flags = GRAMMAR_CFLAGS[config] + [f"-I{d}" for d in include_dirs]
+    key = unit_key(source, include_dirs, compiler, flags)
+    path = os.path.join(GRAMMAR_CACHE_DIR, key[:2], f"{key}.o")
+    if os.path.exists(path):
+        os.utime(path)  # 마지막 사용 시각 (prune_grammar_cache가 본다)
+        return path, False
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    # 여러 언어 액션이 같은 단위(lib.c)를 동시에 컴파일해도 마지막 rename만 남는다
+    tmp = f"{path}.{os.getpid()}.tmp"
+    proc = subprocess.run([compiler, "-c", source, "-o", tmp] + flags, capture_output=True, text=True)
+    if proc.returncode != 0:
+        sys.stderr.write(proc.stderr)
+        raise RuntimeError(f"컴파일 실패: {source}")
+    os.replace(tmp, path)
+    return path, True
+
+
+def prune_grammar_cache(keep):
+    """기한이 지난 오브젝트와 상한을 넘는 오브젝트를 오래 안 쓴 것부터 지운다. keep(이번 빌드 결과)은 남긴다"""
+    entries = []
+    for dirpath, _, names in os.walk(GRAMMAR_CACHE_DIR):
+        for name in names:
+            path = os.path.join(dirpath, name)
+            try:
+                st = os.stat(path)
+            except OSError:
+                continue  # 다른 언어 액션이 동시에 지웠다
+            entries.append((st.st_mtime, st.st_size, path))
+    entries.sort()
+    total = sum(size for _, size, _ in entries)
+    expire = time.time() - GRAMMAR_CACHE_MAX_AGE_DAYS * 86400
+    removed = 0
+    for mtime, size, path in entries:
+        if path in keep:
+            continue
+        # .tmp는 컴파일 중일 수 있으므로 기한이 지난 것만
+        if mtime >= expire and (total <= GRAMMAR_CACHE_MAX_BYTES or path.endswith(".tmp")):
+            continue
+        try:
+            os.remove(path)
+        except OSError:
+            continue
+        total -= size
+        removed += 1
+    return removed
+
+
+def build_grammar_objects(lang, out_dir, config):
+    if config not in GRAMMAR_CFLAGS:
+        print(f"  [ERROR] 알 수 없는 빌드 구성: {config} ({', '.join(GRAMMAR_CFLAGS)})", file=sys.stderr)
+        return 1
+    info = next((l for l in discover_languages(verbose=False) if l["lang"] == lang), None)
+    if not info:
+        print(f"  [ERROR] {lang}: 문법을 찾을 수 없음", file=sys.stderr)
+        return 1
+    # 상수가 어긋난 채로 링크하면 고정 크기 테이블(LrSimulator 등)이 범위 밖을 읽는다. 빌드를 멈춘다
+    mismatch = check_lang_constants(info)
+    if mismatch:
+        print(f"  [ERROR] {lang}: {mismatch}", file=sys.stderr)
+        return 1
+    include_dirs = [os.path.normpath(os.path.join(EXT_DIR, d)) for d in tree_sitter_include_dirs(info)]
+    sources = [os.path.normpath(os.path.join(EXT_DIR, s)) for s in grammar_sources(info)]
+    os.makedirs(out_dir, exist_ok=True)
+    with ThreadPoolExecutor(max_workers=os.cpu_count() or 1) as pool:
+        results = list(pool.map(lambda src: cached_object(src, include_dirs, config), sources))
+    for (path, _), name in zip(results, grammar_object_names(info)):
+        shutil.copyfile(path, os.path.join(out_dir, name))
+    compiled = sum(1 for _, fresh in results if fresh)
+    removed = prune_grammar_cache({path for path, _ in results})
+    print(f"  [Info] {lang} 문법 오브젝트 ({config}): {len(results) - compiled}개 캐시, {compiled}개 컴파일, "
+          f"캐시 정리 {removed}개")
+    return 0
 
 
 # ============================================================
 # main
 # ============================================================
 if __name__ == "__main__":
-    print("[1/3] 언어 탐색...")
+    if len(sys.argv) in (4, 5) and sys.argv[1] == "--grammar-objects":
+        try:
+            config = sys.argv[4] if len(sys.argv) == 5 else "Release"
+            sys.exit(build_grammar_objects(sys.argv[2], sys.argv[3], config))
+        except RuntimeError as e:
+            print(f"  [ERROR] {e}", file=sys.stderr)
+            sys.exit(1)
+
+    print("[1/4] 언어 탐색...")
     languages = discover_languages()
 
     if not languages:
         print("  지원 가능한 언어를 찾지 못했습니다.")
         exit(1)
 
-    print(f"\n[2/3] binding.gyp 생성...")
+    print(f"\n[2/4] binding.gyp 생성...")
     generate_binding_gyp(languages)
 
-    print(f"\n[3/3] addon.cc 언어 블록 생성...")
+    print(f"\n[3/4] lang_select.h 언어 블록 생성...")
     generate_addon_lang_block(languages)
 
+    print(f"\n[4/4] generated/lang_constants.h 생성...")
+    generate_lang_constants(languages)
+
     print(f"\n완료. node-gyp rebuild를 실행하세요.")
@@ -0,0 +1,275 @@
+/**
+ * @file cce_engine.h
+ * @brief 자동완성 엔진 C ABI (Node 없이 C/C++/Python/Rust 등에서 링크)
+ *
+ * 언어별 정적 라이브러리 <lang>_engine (binding.gyp)에 들어 있다. 라이브러리 하나 = 문법 하나.
+ * 구현은 native/src/engine.h이고, N-API addon(native/src/addon.cc)도 이 함수들만 불러 값을 변환한다.
+ *
+ * 규칙
+ *   - 문자열 입력은 UTF-8 (포인터 + 바이트 길이), 편집 오프셋만 VS Code와 같은 UTF-16 단위
+ *   - 출력 버퍼는 호출측이 준비한다. 반환값이 capacity보다 크면 잘린 것이므로 더 큰 버퍼로 다시 부른다
+ *   - 실패는 음수/0으로 알리고, 이유는 cce_last_error()
+ *     C++ 예외(할당 실패 등)는 경계를 넘기지 않고 같은 실패 값 + cce_last_error로 바꾼다.
+ *     반환값이 없는 함수(cce_open_document 등)는 실패를 cce_last_error로만 남긴다 (세션이 없으면 이후 호출이 실패한다)
+ *   - 가변 길이 결과(문자열, 배열)는 엔진이 가진 저장소를 가리킨다. 유효 기간은 함수마다 적어 둔다
+ *     (대개 같은 함수의 다음 호출 또는 그 문서의 다음 편집/축출 전까지). 필요하면 호출측이 복사한다
+ *   - 엔진 하나는 한 스레드에서만 쓴다 (스레드마다 cce_engine_new). 예외: 컨버전 워커의 doorbell은
+ *     워커 스레드에서 불린다
+ * 호환되지 않는 변경이 생기면 CCE_ABI_VERSION을 올린다.
+ */
+
+#ifndef CCE_ENGINE_H_
+#define CCE_ENGINE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CCE_ABI_VERSION 1
+
+typedef struct CceEngine CceEngine;
+
+// 식별자 슬롯 분류 (native/src/symbol_classes.h의 SymbolClass와 같은 값)
+#define CCE_KIND_IDENTIFIER 1
+#define CCE_KIND_MEMBER 2
+#define CCE_KIND_LITERAL 3
+
+typedef struct {
+    const char *key;   // 다음 cce_rank_candidates 호출 또는 cce_engine_delete 전까지 유효
+    uint64_t value;
+} CceCandidate;
+
+typedef struct {
+    uint64_t engine_bytes;       // 이 엔진 세션의 트리/파서 할당 + session_bytes (예산과 비교하는 값)
+    uint64_t tree_sitter_bytes;  // 프로세스 전체 Tree-sitter 할당 (다른 엔진 포함)
+    uint64_t tree_sitter_peak_bytes;
+    uint64_t session_bytes;
+    uint64_t budget_bytes;
+    uint32_t sessions;
+    uint32_t resident_sessions;
+    uint64_t evictions;
+    uint64_t rebuilds;
+} CceMemoryStats;
+
+typedef struct {
+    uint32_t max_versions;
+    uint32_t max_cost;
+    uint32_t lookahead_bytes;
+} CceTuning;
+
+typedef struct {
+    const char *symbol;
+    const char *text;  // 식별자/멤버/익명 토큰만, 나머지는 NULL (심볼 범주만)
+} CceOutlineToken;
+
+typedef struct {
+    uint32_t line;
+    uint32_t depth;
+    int signature;
+    const CceOutlineToken *tokens;
+    uint32_t token_count;
+} CceOutlineLine;
+
+// 시맨틱 토큰 (VS Code 상대 인코딩, 토큰당 uint32 5개)
+typedef struct {
+    uint32_t result_id;
+    int is_delta;           // 0이면 data가 전체, 1이면 [start, start + delete_count)를 data로 바꾸는 edit 한 건
+    uint32_t start;
+    uint32_t delete_count;
+    const uint32_t *data;
+    uint32_t length;
+} CceSemanticTokens;
+
+// 세션 단말 토큰열의 열들 (native/src/token_stream.h, flags 비트도 같다)
+typedef struct {
+    const uint16_t *symbols;
+    const uint32_t *starts;
+    const uint32_t *lengths;
+    const uint8_t *flags;
+    uint32_t count;
+} CceTokenColumns;
+
+typedef struct {
+    const char *text;  // 다음 cce_query_identifiers 호출 전까지 유효
+    uint32_t kind;     // CCE_KIND_*
+    double score;
+} CceIdentifier;
+
+typedef struct {
+    const char *const *tokens;  // 다음 cce_propose_tokens 호출 전까지 유효
+    uint32_t count;
+    double log_prob;
+} CceTokenProposal;
+
+typedef struct {
+    const char *symbol;
+    const char *text;  // 익명 심볼(이름이 곧 텍스트)만, 나머지는 NULL
+} CceAllowedTerminal;
+
+typedef struct {
+    int accepted;
+    int complete;
+    const CceAllowedTerminal *allowed;  // 다음 cce_decode_* 호출 전까지 유효
+    uint32_t allowed_count;
+} CceDecodeStep;
+
+typedef struct {
+    const char *candidates;  // 필수
+    const char *tuning;      // NULL이면 튜닝 프로파일 없음
+    int has_recovery_limit;  // 0이 아니면 max_versions/max_cost를 튜닝보다 우선
+    uint32_t max_versions;
+    uint32_t max_cost;
+} CceWorkerOptions;
+
+// 워커가 링에 쓴 뒤 소비자가 잠들어 있으면 워커 스레드에서 부른다
+typedef void (*CceDoorbell)(void *user);
+
+// 링크된 라이브러리의 ABI 버전 (헤더의 CCE_ABI_VERSION과 비교)
+uint32_t cce_abi_version(void);
+// 라이브러리에 들어 있는 언어 (예: "smallbasic")
+const char *cce_language_name(void);
+// 링크된 문법이 생성된 상수(generated/lang_constants.h)와 맞는지. 0이면 엔진을 쓰면 안 된다
+int cce_grammar_matches(void);
+
+CceEngine *cce_engine_new(void);
+void cce_engine_delete(CceEngine *engine);
+
+// 마지막 실패 이유 (없으면 빈 문자열). 엔진이 살아 있는 동안 유효
+const char *cce_last_error(const CceEngine *engine);
+
+// ---------------------------------------------------------------------------
+// 컨버전: 커서의 파서 상태 경로 (mode 0: 커서에서 자름, 2: 전체 소스 + lookahead)
+// 반환: 경로 길이 (states에는 최대 capacity개), 실패 시 -1
+// ---------------------------------------------------------------------------
+int32_t cce_convert(CceEngine *engine, const char *source, size_t length, uint32_t byte_offset,
+                    uint32_t mode, uint16_t *states, uint32_t capacity);
+
+// 오류 복구 상한 (둘 다 0이면 끔). 걸리면 첫 오류 직전까지의 경로를 돌려준다 (그 컨버전도 걸리면 빈 경로)
+void cce_set_recovery_limit(CceEngine *engine, uint32_t max_versions, uint32_t max_cost);
+// 모드 2에서 커서 뒤로 파서에 넘길 바이트 수 (0이면 문서 끝까지, 기본)
+void cce_set_lookahead_bytes(CceEngine *engine, uint32_t bytes);
+// 튜닝 프로파일 (resources/<lang>/tuning.json)로 복구 상한과 lookahead 창 설정. 반환: 1 성공, 0 실패
+int cce_load_tuning(CceEngine *engine, const char *path);
+// 마지막으로 읽은 튜닝 프로파일 값
+void cce_tuning(const CceEngine *engine, CceTuning *out);
+// logged_actions.txt / 컨버전 결과 stdout 덤프 (디버깅용, 기본은 꺼짐). 켜면 cce_convert마다 파싱이 한 번 더 돈다
+void cce_set_debug_dump(CceEngine *engine, int enabled);
+
+// ---------------------------------------------------------------------------
+// 후보 DB (resources/<lang>/candidates.json). 반환: 1 성공, 0 실패
+// 순위: 반환값은 전체 후보 수, out에는 상위 capacity개. DB가 없으면 -1
+// ---------------------------------------------------------------------------
+int cce_load_candidates(CceEngine *engine, const char *path);
+int32_t cce_rank_candidates(CceEngine *engine, const uint16_t *states, uint32_t count,
+                            CceCandidate *out, uint32_t capacity);
+
+// ---------------------------------------------------------------------------
+// 문서 세션 (보존 트리 + 증분 파싱)
+// ---------------------------------------------------------------------------
+void cce_open_document(CceEngine *engine, const char *uri, const char *text, size_t length, int64_t version);
+// 편집 한 건 적용 후 version 갱신. 세션이 없으면 0
+int cce_edit_document(CceEngine *engine, const char *uri, int64_t version, uint32_t offset_utf16,
+                      uint32_t length_utf16, const char *text, size_t length);
+void cce_close_document(CceEngine *engine, const char *uri);
+// 편집 없이 version만 갱신. 세션이 없으면 0
+int cce_set_document_version(CceEngine *engine, const char *uri, int64_t version);
+// 세션이 없거나 버전이 다르면 -1 (호출측은 cce_convert로 대체)
+int32_t cce_convert_document(CceEngine *engine, const char *uri, int64_t version, uint32_t byte_offset,
+                             uint32_t mode, uint16_t *states, uint32_t capacity);
+
+// 아래 조회는 세션이 없거나 버전이 다르면 0 / -1 / NULL을 돌려준다 (호출측이 세션 없이 대체)
+// 줄/열(UTF-16) ↔ UTF-8 바이트 (세션 줄 색인, O(log n))
+int cce_position_to_byte(CceEngine *engine, const char *uri, int64_t version, uint32_t line, uint32_t character,
+                         uint32_t *byte_offset);
+int cce_byte_to_position(CceEngine *engine, const char *uri, int64_t version, uint32_t byte_offset,
+                         uint32_t *line, uint32_t *character);
+// 토큰 범주만 남긴 소스 (바이트 길이/토큰 경계는 원본과 같다). 다음 cce_redact_document 호출 전까지 유효
+const char *cce_redact_document(CceEngine *engine, const char *uri, int64_t version, size_t *length);
+// [0, end_byte)의 줄 단위 구조 요약. 반환: 줄 수. *lines는 다음 cce_document_outline 호출 전까지 유효
+int32_t cce_document_outline(CceEngine *engine, const char *uri, int64_t version, uint32_t end_byte,
+                             const CceOutlineLine **lines);
+// [start_byte, end_byte)와 겹치는 단말 토큰. 반환: 1 / 0. 열은 그 문서의 다음 편집/축출 전까지 유효
+int cce_document_tokens(CceEngine *engine, const char *uri, int64_t version, uint32_t start_byte,
+                        uint32_t end_byte, CceTokenColumns *out);
+
+// ---------------------------------------------------------------------------
+// 시맨틱 토큰 (보존 트리 기반, resultId는 세션별 스냅샷 번호). 반환: 1 / 0
+// data는 그 문서의 다음 편집/축출 전까지 유효
+// ---------------------------------------------------------------------------
+const char *cce_semantic_token_type(uint32_t index);      // 범위 밖이면 NULL
+const char *cce_semantic_token_modifier(uint32_t index);  // 범위 밖이면 NULL
+int cce_semantic_tokens(CceEngine *engine, const char *uri, int64_t version, CceSemanticTokens *out);
+// previous_id가 마지막 스냅샷이 아니면 전체(is_delta = 0)를 채운다
+int cce_semantic_tokens_delta(CceEngine *engine, const char *uri, int64_t version, uint32_t previous_id,
+                              CceSemanticTokens *out);
+
+// ---------------------------------------------------------------------------
+// 식별자 슬롯 후보 (최근성/스코프/거리 순). kind는 CCE_KIND_*
+// include_workspace면 다른 열린 문서의 색인도 낮은 가중치로 합친다. 반환: 후보 수 (out에는 최대 capacity개)
+// ---------------------------------------------------------------------------
+int32_t cce_query_identifiers(CceEngine *engine, const char *uri, uint32_t byte_offset, uint32_t kind,
+                              uint32_t limit, int include_workspace, CceIdentifier *out, uint32_t capacity);
+
+// ---------------------------------------------------------------------------
+// 토큰 모델 (resources/<lang>/token_model.bin, 메모리 매핑). 반환: 1 성공, 0 실패
+// propose: 구조 후보 key의 슬롯을 채운 토큰열. states(커서의 상태 경로, NULL 가능)가 있으면
+// 파싱 테이블이 받는 토큰만 쓴다. 반환: 1 제안, 0 채울 수 없는 슬롯 (호출측이 원격 모델로), -1 오류
+// ---------------------------------------------------------------------------
+int cce_load_token_model(CceEngine *engine, const char *path);
+int cce_propose_tokens(CceEngine *engine, const char *uri, uint32_t byte_offset, const char *raw_key,
+                       int include_workspace, const uint16_t *states, uint32_t state_count,
+                       CceTokenProposal *out);
+
+// ---------------------------------------------------------------------------
+// 제약 디코딩 (커서의 상태 경로 위에서 단말을 하나씩 먹인다)
+// begin: uri(NULL 가능)가 있으면 feed_text가 그 세션의 커서 앞 텍스트를 쓴다. 반환: 핸들 (실패 시 0)
+// feed_*/state: 핸들이 없으면 0. 거부되면 out->accepted = 0이고 상태는 그대로다
+// ---------------------------------------------------------------------------
+uint32_t cce_decode_begin(CceEngine *engine, const uint16_t *states, uint32_t count, const char *uri,
+                          uint32_t byte_offset);
+int cce_decode_feed_terminal(CceEngine *engine, uint32_t handle, const char *symbol, CceDecodeStep *out);
+int cce_decode_feed_text(CceEngine *engine, uint32_t handle, const char *text, size_t length, CceDecodeStep *out);
+int cce_decode_state(CceEngine *engine, uint32_t handle, CceDecodeStep *out);
+void cce_decode_end(CceEngine *engine, uint32_t handle);
+
+// ---------------------------------------------------------------------------
+// 컨버전 워커: 백그라운드 스레드가 자기 엔진으로 컨버전 + 후보 순위를 계산해 결과 링(src/resultRing.ts와
+// 같은 레이아웃)에 쓴다. 엔진의 문서 세션과는 상태를 공유하지 않는다. 엔진마다 하나 (start는 기존 워커를 멈춘다)
+// start 반환: 후보 key 수 (링에는 key ID만 실린다), 실패 시 -1. ring은 워커가 멈출 때까지 유효해야 한다
+// submit 반환: 요청 ID (워커가 없으면 0)
+// ---------------------------------------------------------------------------
+int32_t cce_worker_start(CceEngine *engine, void *ring, size_t ring_bytes, const CceWorkerOptions *options,
+                         CceDoorbell doorbell, void *user);
+const char *cce_worker_key(const CceEngine *engine, uint32_t id);  // 범위 밖이면 NULL
+uint32_t cce_worker_submit(CceEngine *engine, const char *source, size_t length, uint32_t byte_offset,
+                           uint32_t mode);
+// 낡은 요청 취소: 큐에 있으면 버리고, 진행 중이면 결과를 게시하지 않는다. 반환: 1 취소함, 0 이미 끝났거나 없음
+int32_t cce_worker_cancel(CceEngine *engine, uint32_t id);
+// 남은 요청을 버리고 스레드를 join한다. 이후 doorbell은 불리지 않는다
+void cce_worker_stop(CceEngine *engine);
+
+// ---------------------------------------------------------------------------
+// 메모리 예산 (0이면 무제한). trim 반환: 축출한 세션 수
+// ---------------------------------------------------------------------------
+void cce_set_memory_budget(CceEngine *engine, uint64_t bytes);
+uint32_t cce_trim_memory(CceEngine *engine, uint64_t target_bytes);
+void cce_memory_stats(const CceEngine *engine, CceMemoryStats *out);
+
+// ---------------------------------------------------------------------------
+// 카운터 (프로세스 전체 누적, 엔진별 아님). 반환: 카운터 수 (values에는 최대 capacity개)
+// ---------------------------------------------------------------------------
+uint32_t cce_get_stats(uint64_t *values, uint32_t capacity);
+const char *cce_stat_name(uint32_t index);  // 범위 밖이면 NULL
+void cce_reset_stats(void);
+// 상세 카운터(렉싱 토큰, shift/reduce, 오류 복구). 켜면 파서에 로거가 붙어 느려진다
+void cce_set_stats_detail(int enabled);
+int cce_stats_detail(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // CCE_ENGINE_H_
@@ -0,0 +1,165 @@
+/**
+ * @file action_trace.cc
+ * @brief ActionTracer 구현 — Tree-sitter 파서 로그 해석
+ */
+
+#include "action_trace.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+// 로그의 심볼 이름은 LOG_LOOKAHEAD에서 \n, \t 등이 이스케이프되어 있다
+std::string Unescape(const char *begin, const char *end) {
+    std::string out;
+    out.reserve(end - begin);
+    for (const char *p = begin; p < end; p++) {
+        if (*p == '\\' && p + 1 < end) {
+            p++;
+            switch (*p) {
+                case 'n': out += '\n'; break;
+                case 't': out += '\t'; break;
+                case 'r': out += '\r'; break;
+                case 'v': out += '\v'; break;
+                default: out += *p; break;
+            }
+        } else {
+            out += *p;
+        }
+    }
+    return out;
+}
+
+// "...sym:NAME, <suffix>" 에서 NAME 구간을 찾는다.
+// 심볼 이름 자체에 ", "가 들어갈 수 있으므로 suffix는 마지막 출현 위치로 자른다.
+bool SliceSymbol(const char *message, const char *suffix, const char **begin, const char **end) {
+    const char *sym = std::strstr(message, "sym:");
+    if (!sym) return false;
+    sym += 4;
+    const char *last = nullptr;
+    for (const char *p = std::strstr(sym, suffix); p; p = std::strstr(p + 1, suffix)) {
+        last = p;
+    }
+    if (!last) return false;
+    *begin = sym;
+    *end = last;
+    return true;
+}
+
+bool StartsWith(const char *s, const char *prefix) {
+    return std::strncmp(s, prefix, std::strlen(prefix)) == 0;
+}
+
+}  // namespace
+
+ActionTracer::ActionTracer(const TSLanguage *language) : language_(language) {
+    const uint32_t count = ts_language_symbol_count(language);
+    for (uint32_t i = 0; i < count; i++) {
+        const char *name = ts_language_symbol_name(language, static_cast<TSSymbol>(i));
+        if (name) symbols_by_name_[name].push_back(static_cast<TSSymbol>(i));
+    }
+    Reset();
+}
+
+void ActionTracer::Attach(TSParser *parser) {
+    TSLogger logger;
+    logger.payload = this;
+    logger.log = &ActionTracer::Log;
+    ts_parser_set_logger(parser, logger);
+}
+
+void ActionTracer::Detach(TSParser *parser) {
+    TSLogger logger;
+    logger.payload = nullptr;
+    logger.log = nullptr;
+    ts_parser_set_logger(parser, logger);
+}
+
+void ActionTracer::Reset() {
+    stack_.clear();
+    stack_.push_back({1, ""});  // Tree-sitter 파싱 시작 상태
+    lookahead_.clear();
+    broken_ = false;
+}
+
+void ActionTracer::Log(void *payload, TSLogType type, const char *message) {
+    if (type != TSLogTypeParse) return;
+    static_cast<ActionTracer *>(payload)->Handle(message);
+}
+
+void ActionTracer::Handle(const char *message) {
+    if (broken_) return;
+
+    if (StartsWith(message, "process version:")) {
+        unsigned version = 0, version_count = 0;
+        int state = 0;
+        if (std::sscanf(message, "process version:%u, version_count:%u, state:%d",
+                        &version, &version_count, &state) == 3) {
+            // 스택이 갈라지거나 재구성한 상태가 실제와 다르면 더 이상 따라가지 않는다
+            if (version_count > 1 || stack_.back().state != static_cast<TSStateId>(state)) {
+                broken_ = true;
+            }
+        }
+    } else if (StartsWith(message, "lexed_lookahead")) {
+        const char *begin, *end;
+        if (SliceSymbol(message, ", size:", &begin, &end)) {
+            lookahead_ = Unescape(begin, end);
+        }
+    } else if (StartsWith(message, "shift_extra")) {
+        // extra(주석 등)는 reduce의 child_count에 포함되지 않으므로 스택에 올리지 않는다
+    } else if (StartsWith(message, "shift")) {
+        HandleShift(message);
+    } else if (StartsWith(message, "reduce")) {
+        HandleReduce(message);
+    } else if (StartsWith(message, "detect_error") || StartsWith(message, "recover") ||
+               StartsWith(message, "skip_token") || StartsWith(message, "handle_error")) {
+        broken_ = true;
+    }
+}
+
+void ActionTracer::HandleShift(const char *message) {
+    unsigned state = 0;
+    if (std::sscanf(message, "shift state:%u", &state) != 1) return;
+    shifts_++;
+    stack_.push_back({static_cast<TSStateId>(state), lookahead_});
+}
+
+void ActionTracer::HandleReduce(const char *message) {
+    const char *begin, *end;
+    if (!SliceSymbol(message, ", child_count:", &begin, &end)) return;
+    const std::string lhs = Unescape(begin, end);
+    const uint32_t count = static_cast<uint32_t>(std::strtoul(end + std::strlen(", child_count:"), nullptr, 10));
+    reduces_++;
+
+    if (count >= stack_.size()) {
+        broken_ = true;
+        return;
+    }
+
+    const size_t first = stack_.size() - count;
+    const TSStateId state_before = stack_[first - 1].state;
+    if (handler_ && count > 0) {
+        handler_(ProductionEvent{lhs, stack_.data() + first, count, state_before});
+    }
+
+    stack_.resize(first);
+    const TSStateId next = GotoState(state_before, lhs);
+    if (next == 0) {
+        broken_ = true;
+        return;
+    }
+    stack_.push_back({next, lhs});
+}
+
+// 같은 이름의 심볼이 여럿일 수 있으므로(alias 등) goto가 정의된 첫 심볼을 택한다
+TSStateId ActionTracer::GotoState(TSStateId state, const std::string &symbol) const {
+    auto it = symbols_by_name_.find(symbol);
+    if (it == symbols_by_name_.end()) return 0;
+    for (TSSymbol id : it->second) {
+        TSStateId next = ts_language_next_state(language_, state, id);
+        if (next != 0) return next;
+    }
+    return 0;
+}
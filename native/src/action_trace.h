@@ -0,0 +1,73 @@
+/**
+ * @file action_trace.h
+ * @brief 파서 로그(shift/reduce)를 따라가며 LR 스택을 재구성하는 트레이서
+ *
+ * Tree-sitter 파서에 TSLogger로 붙어서 "shift state:N", "reduce sym:X, child_count:K"
+ * 메시지를 해석한다. reduce가 일어날 때마다 해당 생성규칙의 오른쪽 심볼들과
+ * 각 심볼 직전의 파싱 상태를 ProductionEvent로 넘겨준다.
+ *
+ * 후보 수집 관점에서 생성규칙 X -> Y1 .. Yn 은
+ *     state_before(Yi) 에서 "Yi .. Yn" 이 뒤따를 수 있다
+ * 는 관측 n개로 바뀐다 (candidates.json의 key 형식과 같다).
+ *
+ * 스택 버전이 둘 이상으로 갈라지거나(GLR) 오류 복구가 시작되면 이후 로그는
+ * 신뢰할 수 없으므로 broken() 상태로 전환하고 이벤트를 더 내보내지 않는다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tree_sitter/api.h"
+
+class ActionTracer {
+public:
+    struct Frame {
+        TSStateId state;     // 이 심볼을 push한 뒤의 상태
+        std::string symbol;  // 심볼 이름 (ts_language_symbol_name 기준)
+    };
+
+    struct ProductionEvent {
+        const std::string &lhs;
+        const Frame *rhs;         // 오른쪽 심볼들 (rhs[0] .. rhs[count-1])
+        uint32_t count;
+        TSStateId state_before;   // rhs[0] 직전 상태. rhs[i] 직전 상태는 rhs[i-1].state
+    };
+
+    using ProductionHandler = std::function<void(const ProductionEvent &)>;
+
+    explicit ActionTracer(const TSLanguage *language);
+
+    // parser의 로거를 이 트레이서로 교체 / 해제
+    void Attach(TSParser *parser);
+    static void Detach(TSParser *parser);
+
+    // 새 파싱 전에 호출 (스택을 시작 상태 1로 초기화)
+    void Reset();
+
+    void OnProduction(ProductionHandler handler) { handler_ = std::move(handler); }
+
+    bool broken() const { return broken_; }
+    uint64_t shift_count() const { return shifts_; }
+    uint64_t reduce_count() const { return reduces_; }
+
+private:
+    static void Log(void *payload, TSLogType type, const char *message);
+    void Handle(const char *message);
+    void HandleShift(const char *message);
+    void HandleReduce(const char *message);
+    TSStateId GotoState(TSStateId state, const std::string &symbol) const;
+
+    const TSLanguage *language_;
+    std::unordered_map<std::string, std::vector<TSSymbol>> symbols_by_name_;
+    std::vector<Frame> stack_;
+    std::string lookahead_;
+    ProductionHandler handler_;
+    bool broken_ = false;
+    uint64_t shifts_ = 0;
+    uint64_t reduces_ = 0;
+};
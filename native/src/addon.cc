@@ -3,6 +3,10 @@
  * @brief SmallBasic 파서와 상호작용하기 위한 Node.js Native Addon (N-API)
  * * VS Code Extension(JS/TS)에서 소스 코드를 받아 Tree-sitter의 내부 파싱 상태(State ID)를 반환한다.
  * 이 State ID는 구조적 자동완성 후보를 조회하는 키로 사용된다.
+ *
+ * 엔진 로직(세션, 컨버전, 토큰 모델, 제약 디코딩, 컨버전 워커 ...)은 모두 {lang}_engine 라이브러리에 있고,
+ * 이 파일은 C ABI(native/include/cce_engine.h)만 불러 N-API 값과 변환한다.
+ * N-API에 묶인 상태(워커 doorbell의 스레드 안전 함수, 링 버퍼 참조)만 여기서 가진다.
  */
 
 #include <napi.h>
@@ -10,60 +14,68 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "cce_engine.h"
+
+// =============================================================================
+// [Engine] 이 addon = 한 언어분 엔진 하나 (메인 스레드 전용)
+// - 세션 키: 문서 URI 문자열
+// - TS 쪽 DocumentSync가 open/change/close 이벤트를 그대로 전달한다
+// - 언어(addon) 간 예산 배분은 TS 쪽 MemoryBudget이 setMemoryBudget/trimMemory로 한다
+// =============================================================================
+static CceEngine *GetEngine() {
+    static CceEngine *engine = cce_engine_new();
+    return engine;
+}
+
+static void LogEngineError(const char *what, const std::string &detail) {
+    std::cerr << "[Error] " << what << ": " << detail << " (" << cce_last_error(GetEngine()) << ")" << std::endl;
+}
+
+// =============================================================================
+// [Helpers]
+// =============================================================================
+static Napi::Array StatePathToArray(Napi::Env env, const uint16_t *states, uint32_t count) {
+    Napi::Array js_array = Napi::Array::New(env, count);
+    for (uint32_t i = 0; i < count; i++) {
+        js_array.Set(i, states[i]);
+    }
+    return js_array;
+}
+
+static std::vector<uint16_t> ArrayToStatePath(const Napi::Array &array) {
+    std::vector<uint16_t> states(array.Length());
+    for (uint32_t i = 0; i < array.Length(); i++) {
+        states[i] = static_cast<uint16_t>(array.Get(i).As<Napi::Number>().Uint32Value());
+    }
+    return states;
+}
 
-// binding.gyp의 include_dirs 설정을 통해 참조되는 Tree-sitter API 헤더
-#include "tree_sitter/api.h"
-
-// =============================================================================
-// [External Declarations]
-// C 언어로 작성된 Tree-sitter 파서 및 내부 함수들을 링크하기 위한 선언
-// =============================================================================
-
-// 언어 정의 함수 — generate_build_config.py에 의해 자동 생성됨
-#if defined(LANG_C)
-    extern "C" TSLanguage *tree_sitter_c();
-    #define GET_LANGUAGE() tree_sitter_c()
-#elif defined(LANG_CPP)
-    extern "C" TSLanguage *tree_sitter_cpp();
-    #define GET_LANGUAGE() tree_sitter_cpp()
-#elif defined(LANG_HASKELL)
-    extern "C" TSLanguage *tree_sitter_haskell();
-    #define GET_LANGUAGE() tree_sitter_haskell()
-#elif defined(LANG_JAVA)
-    extern "C" TSLanguage *tree_sitter_java();
-    #define GET_LANGUAGE() tree_sitter_java()
-#elif defined(LANG_JAVASCRIPT)
-    extern "C" TSLanguage *tree_sitter_javascript();
-    #define GET_LANGUAGE() tree_sitter_javascript()
-#elif defined(LANG_PHP)
-    extern "C" TSLanguage *tree_sitter_php();
-    #define GET_LANGUAGE() tree_sitter_php()
-#elif defined(LANG_PYTHON)
-    extern "C" TSLanguage *tree_sitter_python();
-    #define GET_LANGUAGE() tree_sitter_python()
-#elif defined(LANG_RUBY)
-    extern "C" TSLanguage *tree_sitter_ruby();
-    #define GET_LANGUAGE() tree_sitter_ruby()
-#elif defined(LANG_SMALLBASIC)
-    extern "C" TSLanguage *tree_sitter_smallbasic();
-    #define GET_LANGUAGE() tree_sitter_smallbasic()
-#else
-    #error "언어 정의 없음: generate_build_config.py를 실행하세요."
-#endif
-
-// 커스텀 파서 로직 함수 (lib/src/parser.c에 구현됨)
-extern "C" {
-    // 1. 컨버전 로직 실행 (모드 0: 잘린 소스)
-    TSStatePath ts_parser_parse_string_for_conversion(TSParser *self, const TSTree *old_tree, const char *string, uint32_t length);
-
-    // 1-b. 컨버전 로직 실행 (모드 2: 전체 소스 + 커서 위치, 렉서 lookahead 활용)
-    TSStatePath ts_parser_parse_string_for_conversion_with_lookahead(TSParser *self, const TSTree *old_tree, const char *string, uint32_t full_length, uint32_t cursor_byte);
-
-    // 2. 컨버전 결과 출력 (파일 or 화면)
-    void ts_parser_write_conversion_result(TSParser *self, TSStatePath *path, FILE *fp);
-
-    // 3. 로그 덤프
-    void ts_parser_write_logged_actions(TSParser *self, const char *filename);
+static Napi::Uint32Array ToUint32Array(Napi::Env env, const uint32_t *data, size_t length) {
+    Napi::Uint32Array array = Napi::Uint32Array::New(env, length);
+    std::copy(data, data + length, array.Data());
+    return array;
+}
+
+// 상태 경로 버퍼 (반환 길이가 용량보다 크면 늘려서 다시 부른다)
+static std::vector<uint16_t> &StateBuffer() {
+    static std::vector<uint16_t> buffer(1024);
+    return buffer;
+}
+
+template <typename F>
+static Napi::Value ConvertToArray(Napi::Env env, F &&convert) {
+    std::vector<uint16_t> &buffer = StateBuffer();
+    int32_t count = convert(buffer.data(), static_cast<uint32_t>(buffer.size()));
+    if (count > static_cast<int32_t>(buffer.size())) {
+        buffer.resize(static_cast<size_t>(count));
+        count = convert(buffer.data(), static_cast<uint32_t>(buffer.size()));
+    }
+    if (count < 0) return env.Null();
+    return StatePathToArray(env, buffer.data(), static_cast<uint32_t>(count));
 }
 
 // =============================================================================
@@ -95,50 +107,823 @@ Napi::Value GetConversionResult(const Napi::CallbackInfo& info) {
         ? info[2].As<Napi::Number>().Uint32Value()
         : 0;
 
-    // 3. Tree-sitter 파서 초기화
-    TSLanguage *language = GET_LANGUAGE();
-    TSParser *parser = ts_parser_new();
-    ts_parser_set_language(parser, language);
-
-    // 4. 바이트 오프셋으로 파싱 길이 결정 (FindByteOffsetForPosition 불필요)
-    size_t effective_length = byte_offset;
-    if (effective_length > source_code.length()) effective_length = source_code.length();
-
-    TSTree *tree = ts_parser_parse_string(
-        parser, NULL, source_code.c_str(), static_cast<uint32_t>(effective_length)
-    );
-
-    // [로그 덤프] logged_actions.txt 저장
-    ts_parser_write_logged_actions(parser, "logged_actions.txt");
-
-    // 6. 컨버전 로직 적용 (모드별 분기)
-    TSStatePath path;
-    if (mode == 2) {
-        // 모드 2: 전체 소스 전달 + 커서 위치 별도 (렉서 lookahead 활용)
-        path = ts_parser_parse_string_for_conversion_with_lookahead(
-            parser, NULL, source_code.c_str(),
-            static_cast<uint32_t>(source_code.length()),
-            static_cast<uint32_t>(effective_length)
-        );
+    // 3. 엔진의 스크래치 파서로 컨버전 (모드 0: 커서에서 자름, 모드 2: 전체 소스 + lookahead)
+    Napi::Value result = ConvertToArray(env, [&](uint16_t *states, uint32_t capacity) {
+        return cce_convert(GetEngine(), source_code.data(), source_code.size(), byte_offset, mode, states, capacity);
+    });
+    return result.IsNull() ? Napi::Array::New(env, 0) : result;
+}
+
+// =============================================================================
+// [Document Sessions] 열린 문서별 보존 트리 + 식별자 색인
+// =============================================================================
+/**
+ * @brief 문서 세션 생성 (이미 있으면 전체 텍스트로 교체)
+ *
+ * Signature: openDocument(uri: string, text: string, version: number) -> void
+ */
+Napi::Value OpenDocument(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Args: uri, text, version").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const std::string uri = info[0].As<Napi::String>().Utf8Value();
+    const std::string text = info[1].As<Napi::String>().Utf8Value();
+    cce_open_document(GetEngine(), uri.c_str(), text.data(), text.size(), info[2].As<Napi::Number>().Int64Value());
+    return env.Undefined();
+}
+
+/**
+ * @brief VS Code contentChanges를 순서대로 적용
+ *
+ * Signature: editDocument(uri: string, version: number,
+ *                         changes: { offset: number, length: number, text: string }[]) -> boolean
+ * @param offset, length: UTF-16 단위 (TextDocumentContentChangeEvent.rangeOffset / rangeLength)
+ * @return 세션이 없으면 false (호출측이 openDocument로 다시 동기화)
+ */
+Napi::Value EditDocument(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 3 || !info[2].IsArray()) {
+        Napi::TypeError::New(env, "Args: uri, version, changes[]").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const std::string uri = info[0].As<Napi::String>().Utf8Value();
+    const int64_t version = info[1].As<Napi::Number>().Int64Value();
+    Napi::Array changes = info[2].As<Napi::Array>();
+    if (changes.Length() == 0) {
+        return Napi::Boolean::New(env, cce_set_document_version(GetEngine(), uri.c_str(), version) != 0);
+    }
+    for (uint32_t i = 0; i < changes.Length(); i++) {
+        Napi::Object change = changes.Get(i).As<Napi::Object>();
+        const std::string text = change.Get("text").As<Napi::String>().Utf8Value();
+        if (!cce_edit_document(GetEngine(), uri.c_str(), version,
+                               change.Get("offset").As<Napi::Number>().Uint32Value(),
+                               change.Get("length").As<Napi::Number>().Uint32Value(),
+                               text.data(), text.size())) {
+            return Napi::Boolean::New(env, false);
+        }
+    }
+    return Napi::Boolean::New(env, true);
+}
+
+/**
+ * Signature: closeDocument(uri: string) -> void
+ */
+Napi::Value CloseDocument(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Args: uri").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    cce_close_document(GetEngine(), info[0].As<Napi::String>().Utf8Value().c_str());
+    return env.Undefined();
+}
+
+/**
+ * @brief 보존 트리를 재사용하는 컨버전
+ *
+ * Signature: getDocumentConversionResult(uri: string, version: number, byteOffset: number, mode?: 0|2)
+ *            -> number[] | null
+ * @return 세션이 없거나 버전이 다르면 null (호출측은 getConversionResult로 대체)
+ */
+Napi::Value GetDocumentConversionResult(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Args: uri, version, byteOffset, [mode]").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const std::string uri = info[0].As<Napi::String>().Utf8Value();
+    const int64_t version = info[1].As<Napi::Number>().Int64Value();
+    const uint32_t byte_offset = info[2].As<Napi::Number>().Uint32Value();
+    const uint32_t mode = (info.Length() >= 4 && info[3].IsNumber())
+        ? info[3].As<Napi::Number>().Uint32Value()
+        : 0;
+    return ConvertToArray(env, [&](uint16_t *states, uint32_t capacity) {
+        return cce_convert_document(GetEngine(), uri.c_str(), version, byte_offset, mode, states, capacity);
+    });
+}
+
+/**
+ * @brief 줄/열(UTF-16) → UTF-8 바이트 오프셋 (세션의 줄 색인, O(log n))
+ *
+ * Signature: positionToByte(uri: string, version: number, line: number, character: number) -> number | null
+ * @return 세션이 없거나 버전이 다르면 null (호출측은 Buffer.byteLength로 대체)
+ */
+Napi::Value PositionToByte(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 4) {
+        Napi::TypeError::New(env, "Args: uri, version, line, character").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    uint32_t byte = 0;
+    if (!cce_position_to_byte(GetEngine(), info[0].As<Napi::String>().Utf8Value().c_str(),
+                              info[1].As<Napi::Number>().Int64Value(), info[2].As<Napi::Number>().Uint32Value(),
+                              info[3].As<Napi::Number>().Uint32Value(), &byte)) {
+        return env.Null();
+    }
+    return Napi::Number::New(env, byte);
+}
+
+/**
+ * @brief UTF-8 바이트 오프셋 → 줄/열(UTF-16)
+ *
+ * Signature: byteToPosition(uri: string, version: number, byteOffset: number)
+ *            -> { line: number, character: number } | null
+ */
+Napi::Value ByteToPosition(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Args: uri, version, byteOffset").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    uint32_t line = 0, character = 0;
+    if (!cce_byte_to_position(GetEngine(), info[0].As<Napi::String>().Utf8Value().c_str(),
+                              info[1].As<Napi::Number>().Int64Value(), info[2].As<Napi::Number>().Uint32Value(),
+                              &line, &character)) {
+        return env.Null();
+    }
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("line", line);
+    result.Set("character", character);
+    return result;
+}
+
+/**
+ * @brief 토큰 범주만 남긴 소스 (느린 요청 재현 번들용, native/src/redact.h)
+ *
+ * Signature: redactSource(uri: string, version: number) -> string | null
+ * 바이트 길이와 토큰 경계가 원본과 같아 같은 오프셋으로 다시 컨버전할 수 있다. 세션이 없거나 버전이 다르면 null.
+ */
+Napi::Value RedactSourceExport(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Args: uri, version").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    size_t length = 0;
+    const char *redacted = cce_redact_document(GetEngine(), info[0].As<Napi::String>().Utf8Value().c_str(),
+                                               info[1].As<Napi::Number>().Int64Value(), &length);
+    if (!redacted) return env.Null();
+    return Napi::String::New(env, redacted, length);
+}
+
+/**
+ * @brief 커서 앞 [0, endByte)의 줄 단위 구조 요약 (먼 문맥 프롬프트 압축용, src/promptCompression.ts)
+ *
+ * Signature: documentOutline(uri: string, version: number, endByte: number)
+ *            -> { line: number, depth: number, signature: boolean,
+ *                 tokens: { symbol: string, text?: string }[] }[] | null
+ * text는 식별자/멤버/익명 토큰에만 있다. 세션이 없거나 버전이 다르면 null.
+ */
+Napi::Value DocumentOutline(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Args: uri, version, endByte").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const CceOutlineLine *lines = nullptr;
+    const int32_t count = cce_document_outline(GetEngine(), info[0].As<Napi::String>().Utf8Value().c_str(),
+                                               info[1].As<Napi::Number>().Int64Value(),
+                                               info[2].As<Napi::Number>().Uint32Value(), &lines);
+    if (count < 0) return env.Null();
+
+    Napi::Array result = Napi::Array::New(env, static_cast<size_t>(count));
+    for (int32_t i = 0; i < count; i++) {
+        const CceOutlineLine &line = lines[i];
+        Napi::Array tokens = Napi::Array::New(env, line.token_count);
+        for (uint32_t j = 0; j < line.token_count; j++) {
+            Napi::Object token = Napi::Object::New(env);
+            token.Set("symbol", line.tokens[j].symbol);
+            if (line.tokens[j].text) token.Set("text", line.tokens[j].text);
+            tokens.Set(j, token);
+        }
+        Napi::Object item = Napi::Object::New(env);
+        item.Set("line", line.line);
+        item.Set("depth", line.depth);
+        item.Set("signature", line.signature != 0);
+        item.Set("tokens", tokens);
+        result.Set(static_cast<uint32_t>(i), item);
+    }
+    return result;
+}
+
+// =============================================================================
+// [Semantic Tokens] 보존 트리 기반 하이라이트 (src/semanticTokens.ts)
+// - 결과는 VS Code 상대 인코딩 Uint32Array, resultId는 세션별 스냅샷 번호
+// =============================================================================
+/**
+ * Signature: semanticTokensLegend() -> { tokenTypes: string[], tokenModifiers: string[] }
+ */
+Napi::Value SemanticTokensLegend(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::Array types = Napi::Array::New(env);
+    for (uint32_t i = 0; const char *name = cce_semantic_token_type(i); i++) types.Set(i, name);
+    Napi::Array modifiers = Napi::Array::New(env);
+    for (uint32_t i = 0; const char *name = cce_semantic_token_modifier(i); i++) modifiers.Set(i, name);
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("tokenTypes", types);
+    result.Set("tokenModifiers", modifiers);
+    return result;
+}
+
+/**
+ * @brief 문서 전체 시맨틱 토큰
+ *
+ * Signature: semanticTokens(uri: string, version: number) -> { resultId: string, data: Uint32Array } | null
+ * @return 세션이 없거나 버전이 다르면 null
+ */
+Napi::Value SemanticTokensFull(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Args: uri, version").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    CceSemanticTokens tokens;
+    if (!cce_semantic_tokens(GetEngine(), info[0].As<Napi::String>().Utf8Value().c_str(),
+                             info[1].As<Napi::Number>().Int64Value(), &tokens)) {
+        return env.Null();
+    }
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("data", ToUint32Array(env, tokens.data, tokens.length));
+    result.Set("resultId", std::to_string(tokens.result_id));
+    return result;
+}
+
+/**
+ * @brief 마지막으로 보낸 결과 이후의 변경분
+ *
+ * Signature: semanticTokensDelta(uri: string, version: number, previousResultId: string)
+ *            -> { resultId: string, edits: { start: number, deleteCount: number, data: Uint32Array }[] }
+ *             | { resultId: string, data: Uint32Array } | null
+ * previousResultId가 마지막 스냅샷이 아니면 전체(data)를 돌려준다.
+ */
+Napi::Value SemanticTokensDelta(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Args: uri, version, previousResultId").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const std::string previous = info[2].ToString().Utf8Value();
+    CceSemanticTokens tokens;
+    if (!cce_semantic_tokens_delta(GetEngine(), info[0].As<Napi::String>().Utf8Value().c_str(),
+                                   info[1].As<Napi::Number>().Int64Value(),
+                                   static_cast<uint32_t>(std::strtoul(previous.c_str(), nullptr, 10)), &tokens)) {
+        return env.Null();
+    }
+    Napi::Object result = Napi::Object::New(env);
+    if (tokens.is_delta) {
+        Napi::Array edits = Napi::Array::New(env);
+        if (tokens.delete_count > 0 || tokens.length > 0) {
+            Napi::Object edit = Napi::Object::New(env);
+            edit.Set("start", tokens.start);
+            edit.Set("deleteCount", tokens.delete_count);
+            edit.Set("data", ToUint32Array(env, tokens.data, tokens.length));
+            edits.Set(0u, edit);
+        }
+        result.Set("edits", edits);
     } else {
-        // 모드 0 (기본): 커서 위치까지 잘라서 전달
-        path = ts_parser_parse_string_for_conversion(
-            parser, NULL, source_code.c_str(), static_cast<uint32_t>(effective_length)
-        );
+        result.Set("data", ToUint32Array(env, tokens.data, tokens.length));
     }
-    ts_parser_write_conversion_result(parser, &path, stdout);
-    
-    Napi::Array js_array = Napi::Array::New(env, path.count);
-    for (uint32_t i = 0; i < path.count; i++) {
-        // 구조체 내부의 states를 저장
-        js_array.Set(i, path.states[i]);
+    result.Set("resultId", std::to_string(tokens.result_id));
+    return result;
+}
+
+/**
+ * @brief 세션이 유지하는 단말 토큰열 (열마다 typed array 하나)
+ *
+ * Signature: documentTokens(uri: string, version: number, startByte?: number, endByte?: number)
+ *            -> { symbols: Uint16Array, starts: Uint32Array, lengths: Uint32Array, flags: Uint8Array } | null
+ * [startByte, endByte)와 겹치는 토큰만 (생략하면 문서 전체). symbols는 별칭 전 문법 심볼, flags의 1은 extra(주석 등).
+ * @return 세션이 없거나 버전이 다르면 null
+ */
+Napi::Value DocumentTokens(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Args: uri, version, [startByte], [endByte]").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const uint32_t start = (info.Length() >= 3 && info[2].IsNumber()) ? info[2].As<Napi::Number>().Uint32Value() : 0;
+    const uint32_t end = (info.Length() >= 4 && info[3].IsNumber()) ? info[3].As<Napi::Number>().Uint32Value() : UINT32_MAX;
+    CceTokenColumns tokens;
+    if (!cce_document_tokens(GetEngine(), info[0].As<Napi::String>().Utf8Value().c_str(),
+                             info[1].As<Napi::Number>().Int64Value(), start, end, &tokens)) {
+        return env.Null();
     }
 
-    // 7. 메모리 해제
-    if (tree) ts_tree_delete(tree);
-    ts_parser_delete(parser);
+    Napi::Uint16Array symbols = Napi::Uint16Array::New(env, tokens.count);
+    std::copy(tokens.symbols, tokens.symbols + tokens.count, symbols.Data());
+    Napi::Uint8Array flags = Napi::Uint8Array::New(env, tokens.count);
+    std::copy(tokens.flags, tokens.flags + tokens.count, flags.Data());
 
-    return js_array;
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("symbols", symbols);
+    result.Set("starts", ToUint32Array(env, tokens.starts, tokens.count));
+    result.Set("lengths", ToUint32Array(env, tokens.lengths, tokens.count));
+    result.Set("flags", flags);
+    return result;
+}
+
+static uint32_t ParseSlotKind(const std::string &kind) {
+    if (kind == "member") return CCE_KIND_MEMBER;
+    if (kind == "literal") return CCE_KIND_LITERAL;
+    return CCE_KIND_IDENTIFIER;
+}
+
+static const char *SlotKindName(uint32_t kind) {
+    switch (kind) {
+        case CCE_KIND_MEMBER: return "member";
+        case CCE_KIND_LITERAL: return "literal";
+        default: return "identifier";
+    }
+}
+
+/**
+ * @brief 식별자 슬롯 채우기용 후보 조회 (최근성/스코프/거리 순)
+ *
+ * Signature: queryIdentifiers(uri: string, byteOffset: number, kind: "identifier"|"member"|"literal",
+ *                             limit?: number, includeWorkspace?: boolean)
+ *            -> { text: string, kind: string, score: number }[]
+ * includeWorkspace가 true면 같은 언어로 열린 다른 문서의 색인도 낮은 가중치로 합친다.
+ */
+Napi::Value QueryIdentifiers(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Args: uri, byteOffset, kind, [limit], [includeWorkspace]").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const std::string uri = info[0].As<Napi::String>().Utf8Value();
+    const uint32_t limit = (info.Length() >= 4 && info[3].IsNumber()) ? info[3].As<Napi::Number>().Uint32Value() : 10;
+    const bool include_workspace = info.Length() >= 5 && info[4].ToBoolean().Value();
+
+    std::vector<CceIdentifier> found(limit);
+    const int32_t count = cce_query_identifiers(GetEngine(), uri.c_str(), info[1].As<Napi::Number>().Uint32Value(),
+                                                ParseSlotKind(info[2].As<Napi::String>().Utf8Value()), limit,
+                                                include_workspace, found.data(), limit);
+    const uint32_t copied = count > 0 ? std::min(static_cast<uint32_t>(count), limit) : 0;
+
+    Napi::Array result = Napi::Array::New(env, copied);
+    for (uint32_t i = 0; i < copied; i++) {
+        Napi::Object item = Napi::Object::New(env);
+        item.Set("text", found[i].text);
+        item.Set("kind", SlotKindName(found[i].kind));
+        item.Set("score", found[i].score);
+        result.Set(i, item);
+    }
+    return result;
+}
+
+/**
+ * @brief 메모리 예산 설정 (이 addon = 한 언어분)
+ *
+ * Signature: setMemoryBudget(bytes: number) -> void
+ * 0이면 무제한. 넘으면 즉시, 그리고 이후 세션 접근마다 LRU 세션을 축출한다.
+ */
+Napi::Value SetMemoryBudget(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Args: bytes").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    cce_set_memory_budget(GetEngine(), static_cast<uint64_t>(info[0].As<Napi::Number>().DoubleValue()));
+    return env.Undefined();
+}
+
+/**
+ * @brief targetBytes 이하가 될 때까지 LRU 세션 축출 (0이면 모든 세션의 트리를 버린다)
+ *
+ * Signature: trimMemory(targetBytes: number) -> { evicted: number, engineBytes: number }
+ */
+Napi::Value TrimMemory(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Args: targetBytes").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const uint32_t evicted = cce_trim_memory(GetEngine(), static_cast<uint64_t>(info[0].As<Napi::Number>().DoubleValue()));
+    CceMemoryStats stats{};
+    cce_memory_stats(GetEngine(), &stats);
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("evicted", evicted);
+    result.Set("engineBytes", static_cast<double>(stats.engine_bytes));
+    return result;
+}
+
+/**
+ * Signature: memoryStats() -> { engineBytes, treeSitterBytes, treeSitterPeakBytes, sessionBytes,
+ *                               budgetBytes, sessions, residentSessions, evictions, rebuilds }
+ */
+Napi::Value MemoryStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    CceMemoryStats stats{};
+    cce_memory_stats(GetEngine(), &stats);
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("engineBytes", static_cast<double>(stats.engine_bytes));
+    result.Set("treeSitterBytes", static_cast<double>(stats.tree_sitter_bytes));
+    result.Set("treeSitterPeakBytes", static_cast<double>(stats.tree_sitter_peak_bytes));
+    result.Set("sessionBytes", static_cast<double>(stats.session_bytes));
+    result.Set("budgetBytes", static_cast<double>(stats.budget_bytes));
+    result.Set("sessions", stats.sessions);
+    result.Set("residentSessions", stats.resident_sessions);
+    result.Set("evictions", static_cast<double>(stats.evictions));
+    result.Set("rebuilds", static_cast<double>(stats.rebuilds));
+    return result;
+}
+
+// =============================================================================
+// [Stats] 요청 카운터 (native/src/engine_stats.h) — TS 쪽 src/engineStats.ts가 요청 전후 차이로 집계
+// =============================================================================
+/**
+ * Signature: getStats() -> { detail: boolean, conversions: number, parses: number, bytesParsed: number, ... }
+ * 모든 스레드 누적 (statePathMax만 최대). 항목 이름은 native/src/engine_stats.cc의 kStatNames.
+ */
+Napi::Value GetStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<uint64_t> values(cce_get_stats(nullptr, 0));
+    cce_get_stats(values.data(), static_cast<uint32_t>(values.size()));
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("detail", cce_stats_detail() != 0);
+    for (uint32_t i = 0; i < values.size(); i++) {
+        result.Set(cce_stat_name(i), static_cast<double>(values[i]));
+    }
+    return result;
+}
+
+/**
+ * Signature: resetStats() -> void
+ */
+Napi::Value ResetStatsExport(const Napi::CallbackInfo& info) {
+    cce_reset_stats();
+    return info.Env().Undefined();
+}
+
+/**
+ * @brief 상세 카운터(렉싱 토큰, shift/reduce, 오류 복구) 켜기/끄기 — 파서에 로거가 붙어 느려진다
+ *
+ * Signature: setStatsDetail(enabled: boolean) -> void
+ */
+Napi::Value SetStatsDetailExport(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Args: enabled").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    cce_set_stats_detail(info[0].ToBoolean().Value());
+    return env.Undefined();
+}
+
+/**
+ * @brief 컨버전 파싱의 오류 복구 상한 (native/src/recovery_limit.h)
+ *
+ * Signature: setRecoveryLimit(maxVersions: number, maxCost: number) -> void
+ * 둘 다 0이면 끈다. 상한에 걸리면 첫 오류 직전까지의 경로를 돌려주고 recoveryCapped 카운터가 증가한다.
+ */
+Napi::Value SetRecoveryLimit(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Args: maxVersions, maxCost").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    cce_set_recovery_limit(GetEngine(), info[0].As<Napi::Number>().Uint32Value(),
+                           info[1].As<Napi::Number>().Uint32Value());
+    return env.Undefined();
+}
+
+/**
+ * @brief 모드 2 컨버전의 lookahead 창 (커서 뒤로 파서에 넘길 바이트 수)
+ *
+ * Signature: setLookaheadBytes(bytes: number) -> void
+ * 0이면 문서 끝까지 넘긴다 (기본).
+ */
+Napi::Value SetLookaheadBytes(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Args: bytes").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    cce_set_lookahead_bytes(GetEngine(), info[0].As<Napi::Number>().Uint32Value());
+    return env.Undefined();
+}
+
+/**
+ * @brief 언어별 튜닝 프로파일 적용 (resources/<lang>/tuning.json, native/src/engine_tuning.h)
+ *
+ * Signature: loadTuning(path: string) -> { maxVersions: number, maxCost: number, lookaheadBytes: number } | null
+ * 복구 상한과 lookahead 창을 프로파일 값으로 바꾸고 그 값을 돌려준다. 읽기 실패면 null (기존 값 유지)
+ */
+Napi::Value LoadTuning(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Args: path").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const std::string path = info[0].As<Napi::String>().Utf8Value();
+    if (!cce_load_tuning(GetEngine(), path.c_str())) {
+        LogEngineError("Tuning profile load failed", path);
+        return env.Null();
+    }
+    CceTuning tuning{};
+    cce_tuning(GetEngine(), &tuning);
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("maxVersions", Napi::Number::New(env, tuning.max_versions));
+    result.Set("maxCost", Napi::Number::New(env, tuning.max_cost));
+    result.Set("lookaheadBytes", Napi::Number::New(env, tuning.lookahead_bytes));
+    return result;
+}
+
+// =============================================================================
+// [Conversion Worker] 백그라운드 컨버전 + SharedArrayBuffer 결과 링 (cce_worker_*)
+// - 워커는 자기 엔진을 쓰므로 위의 문서 세션과 상태를 공유하지 않는다
+// - doorbell: 워커가 링에 쓴 뒤 소비자가 잠들어 있으면 메인 스레드에서 JS 콜백(Atomics.notify)을 부른다
+//   (V8의 waitAsync 대기자는 JS의 Atomics.notify로만 깨어나므로 스레드 안전 함수로 감싼다)
+// =============================================================================
+struct WorkerBinding {
+    bool running = false;
+    Napi::ThreadSafeFunction doorbell;
+    Napi::ObjectReference ring;  // 워커가 쓰는 동안 SharedArrayBuffer가 수거되지 않게
+};
+static WorkerBinding g_worker;
+
+static void RingDoorbell(void *user) {
+    static_cast<Napi::ThreadSafeFunction *>(user)->NonBlockingCall();
+}
+
+static void StopConversionWorker() {
+    if (!g_worker.running) return;
+    cce_worker_stop(GetEngine());  // 스레드 join (이후 doorbell은 불리지 않는다)
+    g_worker.doorbell.Release();
+    g_worker.ring.Reset();
+    g_worker.running = false;
+}
+
+/**
+ * @brief 워커 시작 (이미 있으면 멈추고 새로 시작)
+ *
+ * Signature: startConversionWorker(ring: Int32Array, options: { candidates: string, tuning?: string,
+ *                                  maxVersions?: number, maxCost?: number }, doorbell: () => void) -> string[] | null
+ * ring은 src/resultRing.ts가 헤더를 채운 SharedArrayBuffer 뷰. 반환값은 후보 key ID → key 문자열 표
+ * (링에는 ID만 실린다). 링 헤더가 틀리거나 DB를 읽지 못하면 null.
+ */
+Napi::Value StartConversionWorker(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 3 || !info[0].IsTypedArray() || !info[1].IsObject() || !info[2].IsFunction()) {
+        Napi::TypeError::New(env, "Args: ring (Int32Array), options, doorbell").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    StopConversionWorker();
+
+    Napi::Int32Array ring = info[0].As<Napi::Int32Array>();
+    Napi::Object options = info[1].As<Napi::Object>();
+    const std::string candidates = options.Get("candidates").IsString()
+        ? options.Get("candidates").As<Napi::String>().Utf8Value() : std::string();
+    const bool has_tuning = options.Get("tuning").IsString();
+    const std::string tuning = has_tuning ? options.Get("tuning").As<Napi::String>().Utf8Value() : std::string();
+
+    CceWorkerOptions worker_options{};
+    worker_options.candidates = candidates.c_str();
+    worker_options.tuning = has_tuning ? tuning.c_str() : nullptr;
+    worker_options.has_recovery_limit = options.Get("maxVersions").IsNumber();
+    if (worker_options.has_recovery_limit) {
+        worker_options.max_versions = options.Get("maxVersions").As<Napi::Number>().Uint32Value();
+        worker_options.max_cost = options.Get("maxCost").IsNumber() ? options.Get("maxCost").As<Napi::Number>().Uint32Value() : 0;
+    }
+
+    g_worker.doorbell = Napi::ThreadSafeFunction::New(env, info[2].As<Napi::Function>(), "cceConversionDoorbell", 0, 1);
+    g_worker.doorbell.Unref(env);  // 워커가 있어도 확장 호스트 종료를 막지 않는다
+    const int32_t key_count = cce_worker_start(GetEngine(), ring.Data(), ring.ByteLength(), &worker_options,
+                                               RingDoorbell, &g_worker.doorbell);
+    if (key_count < 0) {
+        LogEngineError("Conversion worker not started", candidates);
+        g_worker.doorbell.Release();
+        return env.Null();
+    }
+    g_worker.ring = Napi::Persistent(info[0].As<Napi::Object>());
+    g_worker.running = true;
+
+    Napi::Array keys = Napi::Array::New(env, static_cast<size_t>(key_count));
+    for (uint32_t i = 0; i < static_cast<uint32_t>(key_count); i++) {
+        keys.Set(i, Napi::String::New(env, cce_worker_key(GetEngine(), i)));
+    }
+    return keys;
+}
+
+/**
+ * @brief 워커에 컨버전 요청 (소스를 복사해 큐에 넣고 바로 반환)
+ *
+ * Signature: submitConversion(sourceCode: string, byteOffset: number, mode?: 0|2) -> number
+ * 반환값은 결과 링 레코드의 요청 ID. 워커가 없으면 0.
+ */
+Napi::Value SubmitConversion(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Args: sourceCode, byteOffset, [mode]").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (!g_worker.running) return Napi::Number::New(env, 0);
+    const uint32_t mode = (info.Length() >= 3 && info[2].IsNumber()) ? info[2].As<Napi::Number>().Uint32Value() : 0;
+    const std::string source = info[0].As<Napi::String>().Utf8Value();
+    const uint32_t id = cce_worker_submit(GetEngine(), source.data(), source.size(),
+                                          info[1].As<Napi::Number>().Uint32Value(), mode);
+    return Napi::Number::New(env, id);
+}
+
+/**
+ * @brief 낡은 요청 취소 (큐에서 빼거나, 진행 중이면 결과를 링에 쓰지 않는다)
+ *
+ * Signature: cancelConversion(id: number) -> boolean
+ */
+Napi::Value CancelConversion(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1 || !info[0].IsNumber()) {
+        Napi::TypeError::New(env, "Args: id").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (!g_worker.running) return Napi::Boolean::New(env, false);
+    return Napi::Boolean::New(env, cce_worker_cancel(GetEngine(), info[0].As<Napi::Number>().Uint32Value()) == 1);
+}
+
+/**
+ * Signature: stopConversionWorker() -> void
+ */
+Napi::Value StopConversionWorkerExport(const Napi::CallbackInfo& info) {
+    StopConversionWorker();
+    return info.Env().Undefined();
+}
+
+// =============================================================================
+// [Token Model] 구조 후보 → 구체 토큰열 (LLM 없이)
+// - 파일 모델: resources/<lang>/token_model.bin (<lang>_train_token_model로 생성, 메모리 매핑)
+// - 오버레이: 열린 문서 세션의 단말 토큰 빈도
+// =============================================================================
+/**
+ * @brief 토큰 모델 파일을 메모리 매핑 (이미 열려 있으면 교체)
+ *
+ * Signature: loadTokenModel(path: string) -> boolean
+ */
+Napi::Value LoadTokenModel(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Args: path").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const std::string path = info[0].As<Napi::String>().Utf8Value();
+    const bool ok = cce_load_token_model(GetEngine(), path.c_str()) != 0;
+    if (!ok) LogEngineError("Token model load failed", path);
+    return Napi::Boolean::New(env, ok);
+}
+
+/**
+ * @brief 구조 후보의 슬롯을 토큰 모델로 채운 구체 토큰열
+ *
+ * Signature: proposeTokens(uri: string, byteOffset: number, rawKey: string, includeWorkspace?: boolean,
+ *                          statePath?: number[]) -> { tokens: string[], logProb: number } | null
+ * 커서 직전 토큰 2개를 컨텍스트로 쓰고, 채울 수 없는 슬롯이 있으면 null (호출측이 원격 모델로 넘김)
+ * statePath(커서의 컨버전 결과)를 주면 파싱 테이블이 받아들이는 토큰만 제안한다.
+ */
+Napi::Value ProposeTokens(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Args: uri, byteOffset, rawKey, [includeWorkspace], [statePath]").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const std::string uri = info[0].As<Napi::String>().Utf8Value();
+    const std::string raw_key = info[2].As<Napi::String>().Utf8Value();
+    const bool include_workspace = info.Length() >= 4 && info[3].ToBoolean().Value();
+    std::vector<uint16_t> states;
+    if (info.Length() >= 5 && info[4].IsArray()) states = ArrayToStatePath(info[4].As<Napi::Array>());
+
+    CceTokenProposal proposal{};
+    const int found = cce_propose_tokens(GetEngine(), uri.c_str(), info[1].As<Napi::Number>().Uint32Value(),
+                                         raw_key.c_str(), include_workspace, states.empty() ? nullptr : states.data(),
+                                         static_cast<uint32_t>(states.size()), &proposal);
+    if (found <= 0) return env.Null();
+
+    Napi::Array tokens = Napi::Array::New(env, proposal.count);
+    for (uint32_t i = 0; i < proposal.count; i++) {
+        tokens.Set(i, proposal.tokens[i]);
+    }
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("tokens", tokens);
+    result.Set("logProb", proposal.log_prob);
+    return result;
+}
+
+// =============================================================================
+// [Constrained Decoding] 커서의 파싱 스택 위에서 "토큰 하나 먹이고 → 다음 허용 단말" 반복 (cce_decode_*)
+// - 로컬 생성 모델(또는 TS 쪽 MockBackend)이 생성 도중 문법에 맞지 않는 토큰을 마스킹하고,
+//   complete가 되면 일찍 멈출 수 있게 한다
+// - 핸들 단위로 상태를 보관한다 (endConstrainedDecode로 해제)
+// =============================================================================
+// { accepted, complete, allowed: { symbol: string, text?: string }[] }
+static Napi::Object DecodeStepToObject(Napi::Env env, const CceDecodeStep &step) {
+    Napi::Array list = Napi::Array::New(env, step.allowed_count);
+    for (uint32_t i = 0; i < step.allowed_count; i++) {
+        Napi::Object item = Napi::Object::New(env);
+        item.Set("symbol", step.allowed[i].symbol);
+        if (step.allowed[i].text) item.Set("text", step.allowed[i].text);
+        list.Set(i, item);
+    }
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("accepted", step.accepted != 0);
+    result.Set("complete", step.complete != 0);
+    result.Set("allowed", list);
+    return result;
+}
+
+/**
+ * @brief 제약 디코딩 시작
+ *
+ * Signature: beginConstrainedDecode(statePath: number[], uri?: string, byteOffset?: number) -> number
+ * @param statePath getConversionResult / getDocumentConversionResult 결과 (스택 아래 → 위)
+ * @param uri, byteOffset feedText를 쓰려면 필요 (문서 세션에서 커서 앞 텍스트를 가져온다)
+ * @return 핸들
+ */
+Napi::Value BeginConstrainedDecode(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1 || !info[0].IsArray()) {
+        Napi::TypeError::New(env, "Args: statePath[], [uri], [byteOffset]").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const std::vector<uint16_t> states = ArrayToStatePath(info[0].As<Napi::Array>());
+    std::string uri;
+    uint32_t byte_offset = 0;
+    if (info.Length() >= 3 && info[1].IsString()) {
+        uri = info[1].As<Napi::String>().Utf8Value();
+        byte_offset = info[2].As<Napi::Number>().Uint32Value();
+    }
+    const uint32_t handle = cce_decode_begin(GetEngine(), states.data(), static_cast<uint32_t>(states.size()),
+                                             uri.empty() ? nullptr : uri.c_str(), byte_offset);
+    return Napi::Number::New(env, handle);
+}
+
+/**
+ * @brief 단말 하나를 먹인다 (심볼 이름 기준, 같은 이름이 여럿이면 받아들여지는 쪽)
+ *
+ * Signature: feedTerminal(handle: number, symbol: string)
+ *            -> { accepted: boolean, complete: boolean, allowed: { symbol: string, text?: string }[] }
+ * 거부되면 accepted = false이고 상태는 그대로다.
+ */
+Napi::Value FeedTerminal(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Args: handle, symbol").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    CceDecodeStep step{};
+    if (!cce_decode_feed_terminal(GetEngine(), info[0].As<Napi::Number>().Uint32Value(),
+                                  info[1].As<Napi::String>().Utf8Value().c_str(), &step)) {
+        return env.Null();
+    }
+    return DecodeStepToObject(env, step);
+}
+
+/**
+ * @brief 생성된 텍스트 조각을 먹인다
+ *
+ * Signature: feedText(handle: number, text: string) -> feedTerminal과 같은 형식
+ * 커서 앞 텍스트 + 지금까지 생성된 텍스트를 보존 트리 재사용으로 다시 파싱해 단말열을 얻고,
+ * 시작 스택에서 처음부터 다시 먹인다 (마지막 토큰이 아직 덜 생성된 경우도 자연스럽게 처리).
+ * 하나라도 거부되면 이번 조각은 버리고 accepted = false.
+ */
+Napi::Value FeedText(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Args: handle, text").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const std::string text = info[1].As<Napi::String>().Utf8Value();
+    CceDecodeStep step{};
+    if (!cce_decode_feed_text(GetEngine(), info[0].As<Napi::Number>().Uint32Value(), text.data(), text.size(), &step)) {
+        return env.Null();
+    }
+    return DecodeStepToObject(env, step);
+}
+
+/**
+ * Signature: constrainedState(handle: number) -> feedTerminal과 같은 형식 (accepted = true)
+ */
+Napi::Value ConstrainedState(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Args: handle").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    CceDecodeStep step{};
+    if (!cce_decode_state(GetEngine(), info[0].As<Napi::Number>().Uint32Value(), &step)) return env.Null();
+    return DecodeStepToObject(env, step);
+}
+
+/**
+ * Signature: endConstrainedDecode(handle: number) -> void
+ */
+Napi::Value EndConstrainedDecode(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Args: handle").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    cce_decode_end(GetEngine(), info[0].As<Napi::Number>().Uint32Value());
+    return env.Undefined();
 }
 
 // =============================================================================
@@ -146,9 +931,62 @@ Napi::Value GetConversionResult(const Napi::CallbackInfo& info) {
 // =============================================================================
 
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
+    // 고정 크기 테이블(SymbolClassifier, LrSimulator)은 생성된 상수로 크기를 정하므로 parser.c와 어긋나면
+    // 범위 밖을 읽는다. 로드 자체를 실패시켜 확장이 이 언어를 addon 없이 다루게 한다
+    if (!cce_grammar_matches()) {
+        Napi::Error::New(env, "generated/lang_constants.h does not match the linked grammar; "
+                              "rerun generate_build_config.py and rebuild")
+            .ThrowAsJavaScriptException();
+        return exports;
+    }
+    // cce_engine_new가 Tree-sitter 계수 할당자를 먼저 설치한다 (파서/트리를 만들기 전)
+    if (!GetEngine()) {
+        Napi::Error::New(env, "cce_engine_new failed").ThrowAsJavaScriptException();
+        return exports;
+    }
+    // 확장 디버깅용 덤프(logged_actions.txt, 컨버전 결과 stdout)는 CCE_DEBUG_DUMP=1일 때만 켠다
+    // (컨버전마다 파싱이 한 번 더 돌고 파일/stdout에 쓰므로 지연과 카운터가 부풀려진다)
+    const char *debug_dump = std::getenv("CCE_DEBUG_DUMP");
+    if (debug_dump && std::strcmp(debug_dump, "1") == 0) cce_set_debug_dump(GetEngine(), 1);
+    // 환경이 내려가기 전에 컨버전 워커 스레드를 멈춘다 (링/doorbell 참조가 환경에 묶여 있음)
+    napi_add_env_cleanup_hook(env, [](void *) { StopConversionWorker(); }, nullptr);
+
     // JS에서 'getConversionResult'라는 이름으로 함수를 노출
     exports.Set(Napi::String::New(env, "getConversionResult"), Napi::Function::New(env, GetConversionResult));
+    exports.Set(Napi::String::New(env, "openDocument"), Napi::Function::New(env, OpenDocument));
+    exports.Set(Napi::String::New(env, "editDocument"), Napi::Function::New(env, EditDocument));
+    exports.Set(Napi::String::New(env, "closeDocument"), Napi::Function::New(env, CloseDocument));
+    exports.Set(Napi::String::New(env, "getDocumentConversionResult"), Napi::Function::New(env, GetDocumentConversionResult));
+    exports.Set(Napi::String::New(env, "positionToByte"), Napi::Function::New(env, PositionToByte));
+    exports.Set(Napi::String::New(env, "byteToPosition"), Napi::Function::New(env, ByteToPosition));
+    exports.Set(Napi::String::New(env, "documentOutline"), Napi::Function::New(env, DocumentOutline));
+    exports.Set(Napi::String::New(env, "redactSource"), Napi::Function::New(env, RedactSourceExport));
+    exports.Set(Napi::String::New(env, "semanticTokensLegend"), Napi::Function::New(env, SemanticTokensLegend));
+    exports.Set(Napi::String::New(env, "semanticTokens"), Napi::Function::New(env, SemanticTokensFull));
+    exports.Set(Napi::String::New(env, "semanticTokensDelta"), Napi::Function::New(env, SemanticTokensDelta));
+    exports.Set(Napi::String::New(env, "documentTokens"), Napi::Function::New(env, DocumentTokens));
+    exports.Set(Napi::String::New(env, "getStats"), Napi::Function::New(env, GetStats));
+    exports.Set(Napi::String::New(env, "resetStats"), Napi::Function::New(env, ResetStatsExport));
+    exports.Set(Napi::String::New(env, "setStatsDetail"), Napi::Function::New(env, SetStatsDetailExport));
+    exports.Set(Napi::String::New(env, "setRecoveryLimit"), Napi::Function::New(env, SetRecoveryLimit));
+    exports.Set(Napi::String::New(env, "setLookaheadBytes"), Napi::Function::New(env, SetLookaheadBytes));
+    exports.Set(Napi::String::New(env, "loadTuning"), Napi::Function::New(env, LoadTuning));
+    exports.Set(Napi::String::New(env, "setMemoryBudget"), Napi::Function::New(env, SetMemoryBudget));
+    exports.Set(Napi::String::New(env, "trimMemory"), Napi::Function::New(env, TrimMemory));
+    exports.Set(Napi::String::New(env, "memoryStats"), Napi::Function::New(env, MemoryStats));
+    exports.Set(Napi::String::New(env, "queryIdentifiers"), Napi::Function::New(env, QueryIdentifiers));
+    exports.Set(Napi::String::New(env, "loadTokenModel"), Napi::Function::New(env, LoadTokenModel));
+    exports.Set(Napi::String::New(env, "proposeTokens"), Napi::Function::New(env, ProposeTokens));
+    exports.Set(Napi::String::New(env, "beginConstrainedDecode"), Napi::Function::New(env, BeginConstrainedDecode));
+    exports.Set(Napi::String::New(env, "feedTerminal"), Napi::Function::New(env, FeedTerminal));
+    exports.Set(Napi::String::New(env, "feedText"), Napi::Function::New(env, FeedText));
+    exports.Set(Napi::String::New(env, "constrainedState"), Napi::Function::New(env, ConstrainedState));
+    exports.Set(Napi::String::New(env, "endConstrainedDecode"), Napi::Function::New(env, EndConstrainedDecode));
+    exports.Set(Napi::String::New(env, "startConversionWorker"), Napi::Function::New(env, StartConversionWorker));
+    exports.Set(Napi::String::New(env, "submitConversion"), Napi::Function::New(env, SubmitConversion));
+    exports.Set(Napi::String::New(env, "cancelConversion"), Napi::Function::New(env, CancelConversion));
+    exports.Set(Napi::String::New(env, "stopConversionWorker"), Napi::Function::New(env, StopConversionWorkerExport));
     return exports;
 }
 
-NODE_API_MODULE(sb_parser_addon, Init)
\ No newline at end of file
+NODE_API_MODULE(sb_parser_addon, Init)
@@ -0,0 +1,77 @@
+/**
+ * @file candidate_check.cc
+ * @brief CandidateChecker 구현 — ts_language_next_state / ts_language_table_entry 기반
+ */
+
+#include "candidate_check.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "parse_table.h"
+
+CandidateChecker::CandidateChecker(const TSLanguage *language) : language_(language) {
+    const uint32_t count = ts_language_symbol_count(language);
+    for (uint32_t i = 0; i < count; i++) {
+        const char *name = ts_language_symbol_name(language, static_cast<TSSymbol>(i));
+        if (name) symbols_by_name_[name].push_back(static_cast<TSSymbol>(i));
+    }
+}
+
+CandidateChecker::Verdict CandidateChecker::Check(TSStateId state, const std::string &key) const {
+    std::vector<TSStateId> current = {state};
+    std::vector<TSStateId> next;
+    std::istringstream words(key);
+    std::string word;
+    uint32_t length = 0;
+    while (words >> word) {
+        auto it = symbols_by_name_.find(word);
+        if (it == symbols_by_name_.end()) return Verdict::UnknownSymbol;
+        next.clear();
+        for (TSStateId from : current) {
+            for (TSSymbol symbol : it->second) {
+                // 단말이면 shift 대상 상태, 비단말이면 goto (extra 단말은 상태가 그대로)
+                const TSStateId to = ts_language_next_state(language_, from, symbol);
+                if (to != 0 && std::find(next.begin(), next.end(), to) == next.end()) next.push_back(to);
+            }
+        }
+        if (next.empty()) return Verdict::Unreachable;
+        current.swap(next);
+        length++;
+    }
+    if (length == 0) return Verdict::UnknownSymbol;
+
+    for (TSStateId end : current) {
+        if (MaxReduce(end) >= length) return Verdict::Valid;
+    }
+    return Verdict::Unclosed;
+}
+
+uint32_t CandidateChecker::MaxReduce(TSStateId state) const {
+    auto cached = max_reduce_.find(state);
+    if (cached != max_reduce_.end()) return cached->second;
+
+    uint32_t longest = 0;
+    const uint32_t token_count = language_->token_count;
+    for (uint32_t t = 0; t < token_count; t++) {
+        TableEntry entry;
+        ts_language_table_entry(language_, state, static_cast<TSSymbol>(t), &entry);
+        for (uint32_t i = 0; i < entry.action_count; i++) {
+            if (entry.actions[i].type == TSParseActionTypeReduce) {
+                longest = std::max<uint32_t>(longest, entry.actions[i].reduce.child_count);
+            }
+        }
+    }
+    max_reduce_.emplace(state, longest);
+    return longest;
+}
+
+const char *CandidateChecker::Name(Verdict verdict) {
+    switch (verdict) {
+        case Verdict::Valid: return "valid";
+        case Verdict::UnknownSymbol: return "unknown_symbol";
+        case Verdict::Unreachable: return "unreachable";
+        case Verdict::Unclosed: return "unclosed";
+    }
+    return "?";
+}
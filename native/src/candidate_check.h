@@ -0,0 +1,42 @@
+/**
+ * @file candidate_check.h
+ * @brief 파싱 테이블로 후보(state, key)가 실제로 나올 수 있는지 정적으로 확인
+ *
+ * candidates.json의 key는 생성규칙 X -> Y1 .. Yn의 접미사 "Yi .. Yn"이고, state는 Yi 직전 상태다
+ * (action_trace.h). 그러면 state에서 Yi .. Yn을 차례로 goto(단말은 shift)할 수 있어야 하고,
+ * 마지막 상태에는 길이 n-i+1 이상인 reduce가 있어야 한다. 테이블 병합(GLR)이나 수집 잡음으로 들어온
+ * 후보는 이 검사에 걸린다.
+ *   - UnknownSymbol: key에 이 문법에 없는 심볼 이름이 있다 (다른 문법 버전으로 모은 DB 등)
+ *   - Unreachable:   goto가 중간에 끊긴다 → 이 상태 뒤에 절대 나올 수 없다
+ *   - Unclosed:      끝까지 가지만 닫는 reduce가 없다 → 충돌 칸(GLR) 처리에 따라 오탐일 수 있어 표시만 한다
+ * 같은 이름의 심볼이 여럿이면(alias 등) 가능한 상태를 모두 따라간다.
+ * 상태별 최대 reduce 길이를 캐시하므로 인스턴스 하나는 한 스레드에서만 쓴다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tree_sitter/api.h"
+
+class CandidateChecker {
+public:
+    enum class Verdict { Valid, UnknownSymbol, Unreachable, Unclosed };
+
+    explicit CandidateChecker(const TSLanguage *language);
+
+    Verdict Check(TSStateId state, const std::string &key) const;
+
+    static const char *Name(Verdict verdict);
+
+private:
+    // state의 reduce 중 가장 긴 자식 수 (어떤 lookahead로든, 없으면 0)
+    uint32_t MaxReduce(TSStateId state) const;
+
+    const TSLanguage *language_;
+    std::unordered_map<std::string, std::vector<TSSymbol>> symbols_by_name_;
+    mutable std::unordered_map<TSStateId, uint32_t> max_reduce_;
+};
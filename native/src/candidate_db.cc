@@ -0,0 +1,157 @@
+/**
+ * @file candidate_db.cc
+ * @brief CandidateDb 구현 — candidates.json 읽기 (json_reader.h)
+ *
+ * 형식: { "<state>": [ { "key": "<문법 심볼 나열>", "value": <빈도> }, ... ], ... }
+ * 후보 객체의 다른 필드는 건너뛴다.
+ */
+
+#include "candidate_db.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "json_reader.h"
+
+bool CandidateDb::Load(const std::string &path, std::string &error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    return Parse(ss.str(), error);
+}
+
+uint32_t CandidateDb::Intern(const std::string &key) {
+    auto it = key_ids_.find(key);
+    if (it != key_ids_.end()) return it->second;
+    const uint32_t id = static_cast<uint32_t>(keys_.size());
+    keys_.push_back(key);
+    key_ids_.emplace(key, id);
+    return id;
+}
+
+bool CandidateDb::Parse(const std::string &json, std::string &error) {
+    offsets_.assign(kStates + 1, 0);
+    entries_.clear();
+    state_count_ = 0;
+    keys_.clear();
+    key_ids_.clear();
+
+    // 파일의 상태 순서는 자유라 (상태, 후보) 쌍으로 모은 뒤 상태별로 나눠 담는다 (상태 안 순서는 유지)
+    struct Pending {
+        uint32_t state;
+        Entry entry;
+    };
+    std::vector<Pending> pending;
+
+    JsonReader reader(json);
+    auto fail = [&](const char *what) {
+        error = std::string(what) + " at byte " + std::to_string(reader.offset());
+        return false;
+    };
+
+    if (!reader.Consume('{')) return fail("expected '{'");
+    if (reader.Consume('}')) return true;
+
+    std::string state_name, field, key;
+    do {
+        if (!reader.String(state_name) || !reader.Consume(':')) return fail("expected state key");
+        const unsigned long state = std::strtoul(state_name.c_str(), nullptr, 10);
+        if (state >= kStates) return fail("state out of range for this grammar");
+
+        if (!reader.Consume('[')) return fail("expected '['");
+        if (!reader.Consume(']')) {
+            do {
+                if (!reader.Consume('{')) return fail("expected candidate object");
+                key.clear();
+                uint64_t value = 0;
+                if (!reader.Peek('}')) {
+                    do {
+                        if (!reader.String(field) || !reader.Consume(':')) return fail("expected field");
+                        if (field == "key") {
+                            if (!reader.String(key)) return fail("expected key string");
+                        } else if (field == "value") {
+                            if (!reader.Number(value)) return fail("expected value number");
+                        } else if (!reader.Skip()) {
+                            return fail("bad value");
+                        }
+                    } while (reader.Consume(','));
+                }
+                if (!reader.Consume('}')) return fail("expected '}'");
+                pending.push_back({static_cast<uint32_t>(state), {Intern(key), value}});
+            } while (reader.Consume(','));
+            if (!reader.Consume(']')) return fail("expected ']'");
+        }
+    } while (reader.Consume(','));
+    if (!reader.Consume('}')) return fail("expected '}'");
+
+    for (const Pending &p : pending) offsets_[p.state + 1]++;
+    for (uint32_t s = 0; s < kStates; s++) {
+        if (offsets_[s + 1] != 0) state_count_++;
+        offsets_[s + 1] += offsets_[s];
+    }
+    entries_.resize(pending.size());
+    std::vector<uint32_t> fill(offsets_.begin(), offsets_.end() - 1);
+    for (const Pending &p : pending) entries_[fill[p.state]++] = p.entry;
+    return true;
+}
+
+void CandidateDb::Rank(const TSStateId *states, uint32_t count, std::vector<RankedCandidate> &out) const {
+    std::vector<RankedId> ids;
+    RankIds(states, count, ids);
+    out.clear();
+    out.reserve(ids.size());
+    for (const RankedId &id : ids) out.push_back({keys_[id.key], id.value});
+}
+
+void CandidateDb::RankIds(const TSStateId *states, uint32_t count, std::vector<RankedId> &out) const {
+    out.clear();
+    if (offsets_.empty()) return;
+
+    // key id → out 인덱스 + 1 (0 = 아직 없음). 스레드마다 한 번 키 수만큼 잡아 두고,
+    // 호출이 끝날 때 쓴 칸만 되돌려 다음 호출이 그대로 쓴다 (difftest 작업 스레드/변환 워커가 동시에 부른다)
+    thread_local std::vector<uint32_t> slot;
+    if (slot.size() < keys_.size()) slot.resize(keys_.size(), 0);
+
+    for (uint32_t i = 0; i < count; i++) {
+        const TSStateId state = states[i];
+        if (state >= kStates) continue;  // ERROR 상태 등
+        for (uint32_t e = offsets_[state]; e < offsets_[state + 1]; e++) {
+            const Entry &entry = entries_[e];
+            uint32_t &index = slot[entry.key];
+            if (index == 0) {
+                out.push_back({entry.key, entry.value});
+                index = static_cast<uint32_t>(out.size());
+            } else {
+                out[index - 1].value += entry.value;
+            }
+        }
+    }
+    for (const RankedId &id : out) slot[id.key] = 0;
+
+    std::stable_sort(out.begin(), out.end(), [](const RankedId &a, const RankedId &b) {
+        return a.value > b.value;
+    });
+}
+
+std::vector<TSStateId> CandidateDb::States() const {
+    std::vector<TSStateId> out;
+    out.reserve(state_count_);
+    for (uint32_t s = 0; s + 1 < offsets_.size(); s++) {
+        if (offsets_[s + 1] != offsets_[s]) out.push_back(static_cast<TSStateId>(s));
+    }
+    return out;
+}
+
+void CandidateDb::Entries(TSStateId state, std::vector<RankedCandidate> &out) const {
+    out.clear();
+    if (state + 1u >= offsets_.size()) return;
+    for (uint32_t e = offsets_[state]; e < offsets_[state + 1]; e++) {
+        out.push_back({keys_[entries_[e].key], entries_[e].value});
+    }
+}
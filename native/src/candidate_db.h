@@ -0,0 +1,68 @@
+/**
+ * @file candidate_db.h
+ * @brief resources/<lang>/candidates.json 읽기 + 상태 경로 → 순위 후보 (native 측)
+ *
+ * 확장의 CompletionService.lookupDB와 같은 규칙으로 순위를 매긴다.
+ *   - 상태 경로 순서대로 각 상태의 후보를 모으고, 같은 key는 value를 합산 (처음 나온 순서 유지)
+ *   - value 내림차순 안정 정렬
+ * CLI 도구(difftest, prune_candidates 등)가 확장 없이 후보 결과를 비교/가공할 때 쓴다.
+ *
+ * 상태 → 후보 표는 빌드 타겟 문법의 상태 수(lang_constants::kStateCount)로 인덱싱하는 평탄한 배열
+ * (offsets_ + entries_)이라 순위 경로에 해시 조회가 없다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "generated/lang_constants.h"
+#include "tree_sitter/api.h"
+
+struct RankedCandidate {
+    std::string key;
+    uint64_t value;
+};
+
+// key를 문자열 대신 DB 안의 ID로 (key(id)로 되찾는다). 스레드 간 고정 레이아웃 전달용
+struct RankedId {
+    uint32_t key;
+    uint64_t value;
+};
+
+class CandidateDb {
+public:
+    bool Load(const std::string &path, std::string &error);
+    bool Parse(const std::string &json, std::string &error);
+
+    void Rank(const TSStateId *states, uint32_t count, std::vector<RankedCandidate> &out) const;
+    void RankIds(const TSStateId *states, uint32_t count, std::vector<RankedId> &out) const;
+
+    const std::string &key(uint32_t id) const { return keys_[id]; }
+    size_t key_count() const { return keys_.size(); }
+
+    // 후보가 있는 상태 ID (오름차순) / 한 상태의 후보 (파일 순서 그대로, 합산·정렬 없음). DB 가공 도구용
+    std::vector<TSStateId> States() const;
+    void Entries(TSStateId state, std::vector<RankedCandidate> &out) const;
+
+    size_t state_count() const { return state_count_; }
+
+private:
+    struct Entry {
+        uint32_t key;  // keys_ 인덱스
+        uint64_t value;
+    };
+
+    static constexpr uint32_t kStates = lang_constants::kStateCount;
+
+    uint32_t Intern(const std::string &key);
+
+    // 상태 s의 후보 = entries_[offsets_[s], offsets_[s + 1]) (파일 순서). offsets_ 크기는 kStates + 1
+    std::vector<uint32_t> offsets_;
+    std::vector<Entry> entries_;
+    size_t state_count_ = 0;
+    std::vector<std::string> keys_;
+    std::unordered_map<std::string, uint32_t> key_ids_;
+};
@@ -0,0 +1,584 @@
+/**
+ * @file cce_engine.cc
+ * @brief C ABI (native/include/cce_engine.h) → Engine 얇은 래퍼
+ *
+ * C++ 예외는 ABI 경계를 넘기지 않는다 (할당 실패 등은 cce_last_error로 알린다).
+ */
+
+#include "cce_engine.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "conversion_worker.h"
+#include "engine.h"
+#include "engine_stats.h"
+#include "lang_select.h"
+#include "lr_simulator.h"
+#include "memory_budget.h"
+#include "outline.h"
+#include "redact.h"
+#include "semantic_tokens.h"
+#include "generated/lang_constants.h"
+
+struct CceEngine {
+    Engine engine{GET_LANGUAGE()};
+    std::string last_error;
+    std::vector<RankedCandidate> ranked;  // cce_rank_candidates 결과 (key 포인터의 수명)
+
+    // 가변 길이 결과의 저장소 (각 함수의 다음 호출 전까지 유효)
+    std::string redacted;
+    std::vector<OutlineLine> outline;
+    std::vector<CceOutlineToken> outline_tokens;
+    std::vector<CceOutlineLine> outline_lines;
+    std::vector<IdentifierSuggestion> identifiers;
+    TokenProposal proposal;
+    std::vector<const char *> proposal_tokens;
+    Engine::DecodeStep decode_step;
+    std::vector<CceAllowedTerminal> allowed;
+
+    // 마지막에 선언해 가장 먼저 소멸시킨다 (스레드 join 후 나머지 해제)
+    std::unique_ptr<ConversionWorker> worker;
+};
+
+// 본문의 C++ 예외(할당 실패 등)를 잡아 last_error에 남기고 failure를 돌려준다
+template <typename R, typename F>
+static R Guarded(CceEngine *engine, R failure, F &&body) noexcept {
+    try {
+        return body();
+    } catch (const std::exception &e) {
+        try {
+            engine->last_error = e.what();
+        } catch (...) {
+        }
+    } catch (...) {
+        try {
+            engine->last_error = "unknown C++ exception";
+        } catch (...) {
+        }
+    }
+    return failure;
+}
+
+// 세션이 있고 버전이 같을 때만 (아니면 nullptr)
+static DocumentSession *CurrentSession(CceEngine *engine, const char *uri, int64_t version) {
+    DocumentSession *session = engine->engine.Find(uri);
+    return session && session->version() == version ? session : nullptr;
+}
+
+static void FillDecodeStep(CceEngine *engine, CceDecodeStep *out) {
+    const TSLanguage *language = engine->engine.language();
+    const Engine::DecodeStep &step = engine->decode_step;
+    engine->allowed.clear();
+    for (TSSymbol symbol : step.allowed) {
+        const char *name = ts_language_symbol_name(language, symbol);
+        // 익명 심볼은 이름이 곧 텍스트
+        const bool anonymous = ts_language_symbol_type(language, symbol) == TSSymbolTypeAnonymous;
+        engine->allowed.push_back({name, anonymous ? name : nullptr});
+    }
+    out->accepted = step.accepted;
+    out->complete = step.complete;
+    out->allowed = engine->allowed.data();
+    out->allowed_count = static_cast<uint32_t>(engine->allowed.size());
+}
+
+static void FillSemanticTokens(SemanticTokens &tokens, CceSemanticTokens *out) {
+    out->is_delta = 0;
+    out->start = 0;
+    out->delete_count = 0;
+    out->data = tokens.data().data();
+    out->length = static_cast<uint32_t>(tokens.data().size());
+}
+
+static int32_t CopyStatePath(const TSStatePath &path, uint16_t *states, uint32_t capacity) {
+    const uint32_t copied = std::min(path.count, capacity);
+    for (uint32_t i = 0; i < copied; i++) states[i] = path.states[i];
+    return static_cast<int32_t>(path.count);
+}
+
+extern "C" {
+
+uint32_t cce_abi_version(void) {
+    return CCE_ABI_VERSION;
+}
+
+const char *cce_language_name(void) {
+    return lang_constants::kLanguageName;
+}
+
+int cce_grammar_matches(void) {
+    return LrSimulator::MatchesLanguage(GET_LANGUAGE()) ? 1 : 0;
+}
+
+CceEngine *cce_engine_new(void) {
+    // 파서/트리를 만들기 전에 설치해야 메모리 예산이 Tree-sitter 할당을 센다 (여러 번 불러도 한 번만 설치)
+    InstallCountingAllocator();
+    try {
+        return new CceEngine();
+    } catch (const std::exception &) {
+        return nullptr;
+    }
+}
+
+void cce_engine_delete(CceEngine *engine) {
+    delete engine;
+}
+
+const char *cce_last_error(const CceEngine *engine) {
+    return engine ? engine->last_error.c_str() : "null engine";
+}
+
+int32_t cce_convert(CceEngine *engine, const char *source, size_t length, uint32_t byte_offset,
+                    uint32_t mode, uint16_t *states, uint32_t capacity) {
+    if (!engine || (!source && length > 0)) return -1;
+    return Guarded(engine, int32_t(-1), [&] {
+        const TSStatePath path = engine->engine.ConvertSource(std::string(source, length), byte_offset, mode);
+        return CopyStatePath(path, states, capacity);
+    });
+}
+
+void cce_set_recovery_limit(CceEngine *engine, uint32_t max_versions, uint32_t max_cost) {
+    if (!engine) return;
+    RecoveryLimit limit;
+    limit.max_versions = max_versions;
+    limit.max_cost = max_cost;
+    engine->engine.set_recovery_limit(limit);
+}
+
+void cce_set_lookahead_bytes(CceEngine *engine, uint32_t bytes) {
+    if (engine) engine->engine.set_lookahead_bytes(bytes);
+}
+
+int cce_load_tuning(CceEngine *engine, const char *path) {
+    if (!engine || !path) return 0;
+    return Guarded(engine, 0, [&] {
+        std::string error;
+        if (!engine->engine.LoadTuning(path, error)) {
+            engine->last_error = error;
+            return 0;
+        }
+        return 1;
+    });
+}
+
+void cce_tuning(const CceEngine *engine, CceTuning *out) {
+    if (!engine || !out) return;
+    const EngineTuning &tuning = engine->engine.tuning();
+    out->max_versions = tuning.recovery.max_versions;
+    out->max_cost = tuning.recovery.max_cost;
+    out->lookahead_bytes = tuning.lookahead_bytes;
+}
+
+void cce_set_debug_dump(CceEngine *engine, int enabled) {
+    if (engine) engine->engine.set_debug_dump(enabled != 0);
+}
+
+int cce_load_candidates(CceEngine *engine, const char *path) {
+    if (!engine || !path) return 0;
+    return Guarded(engine, 0, [&] {
+        std::string error;
+        if (!engine->engine.LoadCandidates(path, error)) {
+            engine->last_error = error;
+            return 0;
+        }
+        return 1;
+    });
+}
+
+int32_t cce_rank_candidates(CceEngine *engine, const uint16_t *states, uint32_t count,
+                            CceCandidate *out, uint32_t capacity) {
+    if (!engine) return -1;
+    if (!engine->engine.has_candidates()) {
+        engine->last_error = "candidates not loaded";
+        return -1;
+    }
+    return Guarded(engine, int32_t(-1), [&] {
+        engine->engine.RankCandidates(states, count, engine->ranked);
+        const uint32_t total = static_cast<uint32_t>(engine->ranked.size());
+        const uint32_t copied = std::min(total, capacity);
+        for (uint32_t i = 0; i < copied; i++) {
+            out[i].key = engine->ranked[i].key.c_str();
+            out[i].value = engine->ranked[i].value;
+        }
+        return static_cast<int32_t>(total);
+    });
+}
+
+void cce_open_document(CceEngine *engine, const char *uri, const char *text, size_t length, int64_t version) {
+    if (!engine || !uri) return;
+    Guarded(engine, 0, [&] {
+        engine->engine.Open(uri, std::string(text ? text : "", text ? length : 0), version);
+        return 1;
+    });
+}
+
+int cce_edit_document(CceEngine *engine, const char *uri, int64_t version, uint32_t offset_utf16,
+                      uint32_t length_utf16, const char *text, size_t length) {
+    if (!engine || !uri) return 0;
+    return Guarded(engine, 0, [&] {
+        if (!engine->engine.Edit(uri, offset_utf16, length_utf16, std::string(text ? text : "", text ? length : 0))) {
+            return 0;
+        }
+        engine->engine.SetVersion(uri, version);
+        return 1;
+    });
+}
+
+void cce_close_document(CceEngine *engine, const char *uri) {
+    if (!engine || !uri) return;
+    Guarded(engine, 0, [&] {
+        engine->engine.Close(uri);
+        return 1;
+    });
+}
+
+int cce_set_document_version(CceEngine *engine, const char *uri, int64_t version) {
+    if (!engine || !uri) return 0;
+    return Guarded(engine, 0, [&] { return engine->engine.SetVersion(uri, version) ? 1 : 0; });
+}
+
+int32_t cce_convert_document(CceEngine *engine, const char *uri, int64_t version, uint32_t byte_offset,
+                             uint32_t mode, uint16_t *states, uint32_t capacity) {
+    if (!engine || !uri) return -1;
+    return Guarded(engine, int32_t(-1), [&] {
+        TSStatePath path;
+        if (!engine->engine.ConvertDocument(uri, version, byte_offset, mode, path)) return int32_t(-1);
+        return CopyStatePath(path, states, capacity);
+    });
+}
+
+int cce_position_to_byte(CceEngine *engine, const char *uri, int64_t version, uint32_t line, uint32_t character,
+                         uint32_t *byte_offset) {
+    if (!engine || !uri || !byte_offset) return 0;
+    return Guarded(engine, 0, [&] {
+        DocumentSession *session = CurrentSession(engine, uri, version);
+        if (!session) return 0;
+        *byte_offset = session->lines().ByteForPosition(session->text(), line, character);
+        return 1;
+    });
+}
+
+int cce_byte_to_position(CceEngine *engine, const char *uri, int64_t version, uint32_t byte_offset,
+                         uint32_t *line, uint32_t *character) {
+    if (!engine || !uri || !line || !character) return 0;
+    return Guarded(engine, 0, [&] {
+        DocumentSession *session = CurrentSession(engine, uri, version);
+        if (!session) return 0;
+        const LineIndex::Position position = session->lines().PositionForByte(session->text(), byte_offset);
+        *line = position.line;
+        *character = position.character;
+        return 1;
+    });
+}
+
+const char *cce_redact_document(CceEngine *engine, const char *uri, int64_t version, size_t *length) {
+    if (!engine || !uri) return nullptr;
+    return Guarded(engine, static_cast<const char *>(nullptr), [&]() -> const char * {
+        DocumentSession *session = CurrentSession(engine, uri, version);
+        if (!session) return nullptr;
+        engine->engine.Touch(session, true);
+        engine->redacted = RedactSource(session->tree(), session->text(), engine->engine.classifier());
+        if (length) *length = engine->redacted.size();
+        return engine->redacted.c_str();
+    });
+}
+
+int32_t cce_document_outline(CceEngine *engine, const char *uri, int64_t version, uint32_t end_byte,
+                             const CceOutlineLine **lines) {
+    if (!engine || !uri || !lines) return -1;
+    return Guarded(engine, int32_t(-1), [&] {
+        DocumentSession *session = CurrentSession(engine, uri, version);
+        if (!session) return int32_t(-1);
+        engine->engine.Touch(session, true);
+        BuildOutline(session->tree(), session->text(), end_byte, engine->engine.classifier(), engine->outline);
+
+        // 토큰을 먼저 모두 넣은 뒤 줄이 가리키게 한다 (push_back 중 재할당으로 포인터가 바뀌지 않도록)
+        const TSLanguage *language = engine->engine.language();
+        engine->outline_tokens.clear();
+        engine->outline_lines.clear();
+        for (const OutlineLine &line : engine->outline) {
+            for (const OutlineToken &token : line.tokens) {
+                engine->outline_tokens.push_back({ts_language_symbol_name(language, token.symbol),
+                                                  token.text.empty() ? nullptr : token.text.c_str()});
+            }
+        }
+        size_t next = 0;
+        for (const OutlineLine &line : engine->outline) {
+            engine->outline_lines.push_back({line.row, line.depth, line.signature ? 1 : 0,
+                                             engine->outline_tokens.data() + next,
+                                             static_cast<uint32_t>(line.tokens.size())});
+            next += line.tokens.size();
+        }
+        *lines = engine->outline_lines.data();
+        return static_cast<int32_t>(engine->outline_lines.size());
+    });
+}
+
+int cce_document_tokens(CceEngine *engine, const char *uri, int64_t version, uint32_t start_byte,
+                        uint32_t end_byte, CceTokenColumns *out) {
+    if (!engine || !uri || !out) return 0;
+    return Guarded(engine, 0, [&] {
+        DocumentSession *session = CurrentSession(engine, uri, version);
+        if (!session) return 0;
+        engine->engine.Touch(session, true);
+        const TokenStream &tokens = session->tokens();
+        size_t first = 0, last = 0;
+        tokens.Range(start_byte, end_byte, first, last);
+        out->symbols = tokens.symbols() + first;
+        out->starts = tokens.starts() + first;
+        out->lengths = tokens.lengths() + first;
+        out->flags = tokens.flags() + first;
+        out->count = static_cast<uint32_t>(last - first);
+        return 1;
+    });
+}
+
+const char *cce_semantic_token_type(uint32_t index) {
+    return index < SemanticTokens::kTypeCount ? SemanticTokens::kTypeNames[index] : nullptr;
+}
+
+const char *cce_semantic_token_modifier(uint32_t index) {
+    constexpr uint32_t kCount = sizeof(SemanticTokens::kModifierNames) / sizeof(SemanticTokens::kModifierNames[0]);
+    return index < kCount ? SemanticTokens::kModifierNames[index] : nullptr;
+}
+
+int cce_semantic_tokens(CceEngine *engine, const char *uri, int64_t version, CceSemanticTokens *out) {
+    if (!engine || !uri || !out) return 0;
+    return Guarded(engine, 0, [&] {
+        DocumentSession *session = CurrentSession(engine, uri, version);
+        if (!session) return 0;
+        engine->engine.Touch(session, true);
+        SemanticTokens &tokens = session->semantic_tokens();
+        FillSemanticTokens(tokens, out);
+        out->result_id = tokens.Snapshot();
+        return 1;
+    });
+}
+
+int cce_semantic_tokens_delta(CceEngine *engine, const char *uri, int64_t version, uint32_t previous_id,
+                              CceSemanticTokens *out) {
+    if (!engine || !uri || !out) return 0;
+    return Guarded(engine, 0, [&] {
+        DocumentSession *session = CurrentSession(engine, uri, version);
+        if (!session) return 0;
+        engine->engine.Touch(session, true);
+        SemanticTokens &tokens = session->semantic_tokens();
+        SemanticTokens::Delta delta;
+        if (tokens.DeltaSince(previous_id, delta)) {
+            out->is_delta = 1;
+            out->start = delta.start;
+            out->delete_count = delta.delete_count;
+            out->data = delta.data;
+            out->length = delta.length;
+        } else {
+            FillSemanticTokens(tokens, out);
+        }
+        out->result_id = tokens.Snapshot();
+        return 1;
+    });
+}
+
+int32_t cce_query_identifiers(CceEngine *engine, const char *uri, uint32_t byte_offset, uint32_t kind,
+                              uint32_t limit, int include_workspace, CceIdentifier *out, uint32_t capacity) {
+    if (!engine || !uri) return -1;
+    if (kind < CCE_KIND_IDENTIFIER || kind > CCE_KIND_LITERAL) {
+        engine->last_error = "unknown identifier kind";
+        return -1;
+    }
+    return Guarded(engine, int32_t(-1), [&] {
+        engine->identifiers = engine->engine.QueryIdentifiers(uri, byte_offset, static_cast<SymbolClass>(kind),
+                                                              limit, include_workspace != 0);
+        const uint32_t total = static_cast<uint32_t>(engine->identifiers.size());
+        const uint32_t copied = std::min(total, capacity);
+        for (uint32_t i = 0; i < copied; i++) {
+            out[i].text = engine->identifiers[i].text.c_str();
+            out[i].kind = static_cast<uint32_t>(engine->identifiers[i].kind);
+            out[i].score = engine->identifiers[i].score;
+        }
+        return static_cast<int32_t>(total);
+    });
+}
+
+int cce_load_token_model(CceEngine *engine, const char *path) {
+    if (!engine || !path) return 0;
+    return Guarded(engine, 0, [&] {
+        std::string error;
+        if (!engine->engine.LoadTokenModel(path, error)) {
+            engine->last_error = error;
+            return 0;
+        }
+        return 1;
+    });
+}
+
+int cce_propose_tokens(CceEngine *engine, const char *uri, uint32_t byte_offset, const char *raw_key,
+                       int include_workspace, const uint16_t *states, uint32_t state_count,
+                       CceTokenProposal *out) {
+    if (!engine || !uri || !raw_key || !out) return -1;
+    return Guarded(engine, -1, [&] {
+        engine->proposal = TokenProposal();
+        if (!engine->engine.ProposeTokens(uri, byte_offset, raw_key, include_workspace != 0, states,
+                                          states ? state_count : 0, engine->proposal)) {
+            return 0;
+        }
+        engine->proposal_tokens.clear();
+        for (const std::string &token : engine->proposal.tokens) engine->proposal_tokens.push_back(token.c_str());
+        out->tokens = engine->proposal_tokens.data();
+        out->count = static_cast<uint32_t>(engine->proposal_tokens.size());
+        out->log_prob = engine->proposal.log_prob;
+        return 1;
+    });
+}
+
+uint32_t cce_decode_begin(CceEngine *engine, const uint16_t *states, uint32_t count, const char *uri,
+                          uint32_t byte_offset) {
+    if (!engine || (!states && count > 0)) return 0;
+    return Guarded(engine, 0u, [&] {
+        return engine->engine.BeginDecode(states, count, uri ? uri : "", byte_offset);
+    });
+}
+
+int cce_decode_feed_terminal(CceEngine *engine, uint32_t handle, const char *symbol, CceDecodeStep *out) {
+    if (!engine || !symbol || !out) return 0;
+    return Guarded(engine, 0, [&] {
+        if (!engine->engine.FeedTerminal(handle, symbol, engine->decode_step)) return 0;
+        FillDecodeStep(engine, out);
+        return 1;
+    });
+}
+
+int cce_decode_feed_text(CceEngine *engine, uint32_t handle, const char *text, size_t length, CceDecodeStep *out) {
+    if (!engine || (!text && length > 0) || !out) return 0;
+    return Guarded(engine, 0, [&] {
+        if (!engine->engine.FeedText(handle, std::string(text ? text : "", text ? length : 0), engine->decode_step)) {
+            return 0;
+        }
+        FillDecodeStep(engine, out);
+        return 1;
+    });
+}
+
+int cce_decode_state(CceEngine *engine, uint32_t handle, CceDecodeStep *out) {
+    if (!engine || !out) return 0;
+    return Guarded(engine, 0, [&] {
+        if (!engine->engine.DecodeState(handle, engine->decode_step)) return 0;
+        FillDecodeStep(engine, out);
+        return 1;
+    });
+}
+
+void cce_decode_end(CceEngine *engine, uint32_t handle) {
+    if (engine) engine->engine.EndDecode(handle);
+}
+
+int32_t cce_worker_start(CceEngine *engine, void *ring, size_t ring_bytes, const CceWorkerOptions *options,
+                         CceDoorbell doorbell, void *user) {
+    if (!engine) return -1;
+    if (!ring || !options || !options->candidates || !doorbell) {
+        engine->last_error = "worker needs a ring, a candidates path and a doorbell";
+        return -1;
+    }
+    cce_worker_stop(engine);
+    return Guarded(engine, int32_t(-1), [&] {
+        auto worker = std::make_unique<ConversionWorker>(GET_LANGUAGE(), ring, ring_bytes,
+                                                         [doorbell, user]() { doorbell(user); });
+        std::string error;
+        bool ok = worker->ring_attached();
+        if (!ok) error = "bad ring header";
+        if (ok && options->tuning) ok = worker->LoadTuning(options->tuning, error);
+        if (ok && options->has_recovery_limit) {
+            RecoveryLimit limit;
+            limit.max_versions = options->max_versions;
+            limit.max_cost = options->max_cost;
+            worker->SetRecoveryLimit(limit);
+        }
+        if (ok) ok = worker->LoadCandidates(options->candidates, error);
+        if (!ok) {
+            engine->last_error = error;
+            return int32_t(-1);
+        }
+        const int32_t keys = static_cast<int32_t>(worker->candidates().key_count());
+        worker->Start();
+        engine->worker = std::move(worker);
+        return keys;
+    });
+}
+
+const char *cce_worker_key(const CceEngine *engine, uint32_t id) {
+    if (!engine || !engine->worker || id >= engine->worker->candidates().key_count()) return nullptr;
+    return engine->worker->candidates().key(id).c_str();
+}
+
+uint32_t cce_worker_submit(CceEngine *engine, const char *source, size_t length, uint32_t byte_offset,
+                           uint32_t mode) {
+    if (!engine || !engine->worker || (!source && length > 0)) return 0;
+    return Guarded(engine, 0u, [&] {
+        return engine->worker->Submit(std::string(source ? source : "", source ? length : 0), byte_offset, mode);
+    });
+}
+
+int32_t cce_worker_cancel(CceEngine *engine, uint32_t id) {
+    if (!engine || !engine->worker) return 0;
+    return Guarded(engine, int32_t(0), [&] { return engine->worker->Cancel(id) ? 1 : 0; });
+}
+
+void cce_worker_stop(CceEngine *engine) {
+    if (engine) engine->worker.reset();  // 스레드 join
+}
+
+void cce_set_memory_budget(CceEngine *engine, uint64_t bytes) {
+    if (!engine) return;
+    Guarded(engine, 0, [&] {
+        engine->engine.SetMemoryBudget(static_cast<size_t>(bytes));
+        return 1;
+    });
+}
+
+uint32_t cce_trim_memory(CceEngine *engine, uint64_t target_bytes) {
+    if (!engine) return 0;
+    return Guarded(engine, 0u, [&] { return engine->engine.EvictUntil(static_cast<size_t>(target_bytes)); });
+}
+
+void cce_memory_stats(const CceEngine *engine, CceMemoryStats *out) {
+    if (!engine || !out) return;
+    const Engine::MemoryStats stats = engine->engine.memory_stats();
+    out->engine_bytes = stats.engine_bytes;
+    out->tree_sitter_bytes = stats.tree_sitter_bytes;
+    out->tree_sitter_peak_bytes = stats.tree_sitter_peak_bytes;
+    out->session_bytes = stats.session_bytes;
+    out->budget_bytes = stats.budget_bytes;
+    out->sessions = stats.sessions;
+    out->resident_sessions = stats.resident_sessions;
+    out->evictions = stats.evictions;
+    out->rebuilds = stats.rebuilds;
+}
+
+uint32_t cce_get_stats(uint64_t *values, uint32_t capacity) {
+    constexpr uint32_t kCount = static_cast<uint32_t>(Stat::kCount);
+    uint64_t snapshot[kCount];
+    SnapshotStats(snapshot);
+    std::copy(snapshot, snapshot + std::min(kCount, capacity), values);
+    return kCount;
+}
+
+const char *cce_stat_name(uint32_t index) {
+    return index < static_cast<uint32_t>(Stat::kCount) ? kStatNames[index] : nullptr;
+}
+
+void cce_reset_stats(void) {
+    ResetStats();
+}
+
+void cce_set_stats_detail(int enabled) {
+    SetStatsDetail(enabled != 0);
+}
+
+int cce_stats_detail(void) {
+    return StatsDetail() ? 1 : 0;
+}
+
+}  // extern "C"
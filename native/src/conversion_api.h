@@ -0,0 +1,27 @@
+/**
+ * @file conversion_api.h
+ * @brief Tree-sitter 포크(Candidate_Collection)의 컨버전 API 선언
+ *
+ * addon, 문서 세션, native/tools/의 CLI가 함께 사용한다.
+ */
+
+#pragma once
+
+#include <cstdio>
+
+#include "tree_sitter/api.h"
+
+// 커스텀 파서 로직 함수 (lib/src/parser.c에 구현됨)
+extern "C" {
+    // 1. 컨버전 로직 실행 (모드 0: 잘린 소스)
+    TSStatePath ts_parser_parse_string_for_conversion(TSParser *self, const TSTree *old_tree, const char *string, uint32_t length);
+
+    // 1-b. 컨버전 로직 실행 (모드 2: 전체 소스 + 커서 위치, 렉서 lookahead 활용)
+    TSStatePath ts_parser_parse_string_for_conversion_with_lookahead(TSParser *self, const TSTree *old_tree, const char *string, uint32_t full_length, uint32_t cursor_byte);
+
+    // 2. 컨버전 결과 출력 (파일 or 화면)
+    void ts_parser_write_conversion_result(TSParser *self, TSStatePath *path, FILE *fp);
+
+    // 3. 로그 덤프
+    void ts_parser_write_logged_actions(TSParser *self, const char *filename);
+}
@@ -0,0 +1,123 @@
+/**
+ * @file conversion_worker.cc
+ * @brief ConversionWorker 구현
+ */
+
+#include "conversion_worker.h"
+
+#include <chrono>
+#include <iostream>
+#include <utility>
+
+ConversionWorker::ConversionWorker(const TSLanguage *language, void *ring, size_t ring_bytes,
+                                   std::function<void()> doorbell)
+    : engine_(language), doorbell_(std::move(doorbell)) {
+    ring_.Attach(ring, ring_bytes);
+}
+
+ConversionWorker::~ConversionWorker() {
+    Stop();
+}
+
+bool ConversionWorker::LoadCandidates(const std::string &path, std::string &error) {
+    return engine_.LoadCandidates(path, error);
+}
+
+bool ConversionWorker::LoadTuning(const std::string &path, std::string &error) {
+    return engine_.LoadTuning(path, error);
+}
+
+void ConversionWorker::SetRecoveryLimit(const RecoveryLimit &limit) {
+    engine_.set_recovery_limit(limit);
+}
+
+void ConversionWorker::Start() {
+    if (thread_.joinable() || !ring_.attached()) return;
+    stopping_ = false;
+    thread_ = std::thread(&ConversionWorker::Run, this);
+}
+
+uint32_t ConversionWorker::Submit(std::string source, uint32_t byte_offset, uint32_t mode) {
+    uint32_t id;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        id = next_id_++;
+        if (next_id_ == 0) next_id_ = 1;
+        queue_.push_back({id, std::move(source), byte_offset, mode});
+    }
+    cv_.notify_one();
+    return id;
+}
+
+bool ConversionWorker::Cancel(uint32_t id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = queue_.begin(); it != queue_.end(); ++it) {
+        if (it->id == id) {
+            queue_.erase(it);
+            return true;
+        }
+    }
+    if (id != 0 && id == running_id_) {
+        running_cancelled_ = true;
+        return true;
+    }
+    return false;
+}
+
+void ConversionWorker::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        queue_.clear();
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) thread_.join();
+}
+
+void ConversionWorker::Run() {
+    std::vector<RankedId> ranked;
+    for (;;) {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (stopping_) return;
+            request = std::move(queue_.front());
+            queue_.pop_front();
+            running_id_ = request.id;
+            running_cancelled_ = false;
+        }
+        const TSStatePath path = engine_.ConvertSource(request.source, request.byte_offset, request.mode);
+        {
+            // 파싱 중에 취소됐으면 순위 계산과 게시를 건너뛴다
+            std::lock_guard<std::mutex> lock(mutex_);
+            running_id_ = 0;
+            if (running_cancelled_) continue;
+        }
+        engine_.candidates().RankIds(path.states, path.count, ranked);
+        Publish(request.id, path, ranked);
+    }
+}
+
+void ConversionWorker::Publish(uint32_t id, const TSStatePath &path, const std::vector<RankedId> &ranked) {
+    // 경로만으로 레코드 상한을 넘으면 영영 쓸 수 없다: 경로/후보 없이 오류 상태만 보낸다 (JS는 동기 경로로 대체)
+    const bool fits = ring_.FitsPath(path.count);
+    const int32_t status = fits ? ResultRingWriter::kStatusOk : ResultRingWriter::kStatusTooLarge;
+    const uint32_t state_count = fits ? path.count : 0;
+    const uint32_t count = fits ? std::min<uint32_t>(static_cast<uint32_t>(ranked.size()), ring_.MaxCandidates(path.count)) : 0;
+    if (!fits) {
+        std::cerr << "[Warning] Conversion worker: state path of " << path.count << " states exceeds the result ring record limit\n";
+    }
+    // 소비자가 밀리면 50us부터 1ms까지 늘려 가며 기다린다
+    auto backoff = std::chrono::microseconds(50);
+    bool doorbell = false;
+    while (!ring_.TryWrite(id, status, path.states, state_count, ranked.data(), count, doorbell)) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopping_) return;
+        }
+        std::this_thread::sleep_for(backoff);
+        backoff = std::min(backoff * 2, std::chrono::microseconds(1000));
+    }
+    if (doorbell && doorbell_) doorbell_();
+}
@@ -0,0 +1,77 @@
+/**
+ * @file conversion_worker.h
+ * @brief 백그라운드 컨버전 스레드 — 요청 큐 → 자기 Engine으로 파싱/순위 → 결과 링(result_ring.h)
+ *
+ * 확장 스레드는 Submit으로 소스 사본을 넘기고 바로 돌아온다. 워커는 자기 Engine(스크래치 파서 +
+ * 후보 DB)으로 컨버전과 후보 순위를 계산해 상태 경로와 후보 key ID를 SharedArrayBuffer 링에 쓴다.
+ * 결과는 postMessage 직렬화 없이 JS가 링에서 바로 읽는다 (src/resultRing.ts).
+ *
+ * 소비자가 잠들어 있으면 doorbell을 울린다. V8의 Atomics.waitAsync 대기자는 JS의 Atomics.notify로만
+ * 깨어나므로, addon은 doorbell을 스레드 안전 함수로 감싸 메인 스레드에서 notify를 부르게 한다.
+ * 링이 가득 차면 워커는 소비자가 비울 때까지 잠깐씩 쉬며 기다린다 (결과를 버리지 않는다).
+ * 낡은 요청은 Cancel로 취소한다: 큐에 있으면 빼고, 진행 중이면 컨버전이 끝난 뒤 순위 계산과 게시를 건너뛴다.
+ * Engine 인스턴스가 따로라서 메인 스레드의 문서 세션/엔진과 공유하는 상태는 없다.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "engine.h"
+#include "result_ring.h"
+
+class ConversionWorker {
+public:
+    // ring: JS SharedArrayBuffer 메모리 (이 객체가 살아 있는 동안 유효해야 한다)
+    ConversionWorker(const TSLanguage *language, void *ring, size_t ring_bytes, std::function<void()> doorbell);
+    ~ConversionWorker();
+
+    ConversionWorker(const ConversionWorker &) = delete;
+    ConversionWorker &operator=(const ConversionWorker &) = delete;
+
+    // Start 전에만 부른다 (워커 Engine 설정)
+    bool LoadCandidates(const std::string &path, std::string &error);
+    bool LoadTuning(const std::string &path, std::string &error);
+    void SetRecoveryLimit(const RecoveryLimit &limit);
+
+    bool ring_attached() const { return ring_.attached(); }
+    const CandidateDb &candidates() const { return engine_.candidates(); }
+
+    void Start();
+    // 요청 ID (1부터 증가)를 돌려준다
+    uint32_t Submit(std::string source, uint32_t byte_offset, uint32_t mode);
+    // 큐에 있거나 진행 중인 요청이면 취소하고 true (그 ID의 레코드는 링에 오지 않는다)
+    bool Cancel(uint32_t id);
+    // 남은 요청은 버리고 진행 중인 요청이 끝나면 스레드를 멈춘다
+    void Stop();
+
+private:
+    struct Request {
+        uint32_t id;
+        std::string source;
+        uint32_t byte_offset;
+        uint32_t mode;
+    };
+
+    void Run();
+    void Publish(uint32_t id, const TSStatePath &path, const std::vector<RankedId> &ranked);
+
+    Engine engine_;
+    ResultRingWriter ring_;
+    std::function<void()> doorbell_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Request> queue_;
+    uint32_t next_id_ = 1;
+    uint32_t running_id_ = 0;        // 진행 중인 요청 (없으면 0)
+    bool running_cancelled_ = false;
+    bool stopping_ = false;
+    std::thread thread_;
+};
@@ -0,0 +1,236 @@
+/**
+ * @file document_session.cc
+ * @brief DocumentSession 구현
+ */
+
+#include "document_session.h"
+
+#include "conversion_api.h"
+#include "engine_stats.h"
+#include "engine_tuning.h"
+#include "memory_budget.h"
+#include "recovery_limit.h"
+
+namespace {
+
+// 세션 작업 동안 이 스레드의 Tree-sitter 순할당을 세션 몫에 더한다
+class OwnedBytesScope {
+public:
+    explicit OwnedBytesScope(int64_t &owned) : owned_(owned), start_(TreeSitterThreadNetBytes()) {}
+    ~OwnedBytesScope() { owned_ += TreeSitterThreadNetBytes() - start_; }
+
+    OwnedBytesScope(const OwnedBytesScope &) = delete;
+    OwnedBytesScope &operator=(const OwnedBytesScope &) = delete;
+
+private:
+    int64_t &owned_;
+    int64_t start_;
+};
+
+}  // namespace
+
+DocumentSession::DocumentSession(const TSLanguage *language, const SymbolClassifier &classifier,
+                                 std::string text, int64_t version)
+    : language_(language),
+      version_(version),
+      tokens_(classifier),
+      identifiers_(classifier),
+      semantic_(classifier) {
+    Replace(std::move(text));
+}
+
+DocumentSession::~DocumentSession() {
+    Evict();
+}
+
+void DocumentSession::Replace(std::string text) {
+    text_ = std::move(text);
+    lines_.Build(text_);
+    Reparse();
+}
+
+void DocumentSession::Reparse() {
+    OwnedBytesScope owned(tree_sitter_bytes_);
+    if (!parser_) {
+        parser_ = ts_parser_new();
+        conversion_parser_ = ts_parser_new();
+        ts_parser_set_language(parser_, language_);
+        ts_parser_set_language(conversion_parser_, language_);
+    }
+    if (tree_) ts_tree_delete(tree_);
+    SyncStatsLogger(parser_);
+    CountStat(Stat::Parses);
+    CountStat(Stat::BytesParsed, text_.size());
+    tree_ = ts_parser_parse_string(parser_, NULL, text_.c_str(), static_cast<uint32_t>(text_.size()));
+    tokens_.Rebuild(tree_);
+    identifiers_.Rebuild(tokens_, text_);
+    if (semantic_.enabled()) semantic_.Rebuild(tree_, text_, lines_);
+    token_counts_dirty_ = true;
+}
+
+void DocumentSession::Evict() {
+    if (tree_) ts_tree_delete(tree_);
+    tree_ = nullptr;
+    if (parser_) {
+        ts_parser_delete(parser_);
+        ts_parser_delete(conversion_parser_);
+        parser_ = nullptr;
+        conversion_parser_ = nullptr;
+    }
+    tokens_.Clear();
+    identifiers_.Clear();
+    semantic_.Clear();
+    token_counts_ = TokenCounts();  // 용량까지 반환
+    token_counts_dirty_ = true;
+    tree_sitter_bytes_ = 0;  // 트리/파서를 모두 해제했다
+}
+
+void DocumentSession::EnsureResident() {
+    if (!tree_) Reparse();
+}
+
+size_t DocumentSession::MemoryBytes() const {
+    return text_.capacity() + lines_.MemoryBytes() + tokens_.MemoryBytes() + identifiers_.MemoryBytes() + token_counts_.MemoryBytes() +
+           semantic_.MemoryBytes();
+}
+
+void DocumentSession::ApplyEdit(uint32_t start_utf16, uint32_t old_length_utf16, const std::string &new_text) {
+    const uint32_t start_byte = lines_.ByteForUtf16(text_, start_utf16);
+    const uint32_t old_end_byte = lines_.ByteForUtf16(text_, start_utf16 + old_length_utf16);
+
+    TSInputEdit edit;
+    edit.start_byte = start_byte;
+    edit.old_end_byte = old_end_byte;
+    edit.new_end_byte = start_byte + static_cast<uint32_t>(new_text.size());
+    edit.start_point = lines_.PointForByte(start_byte);
+    edit.old_end_point = lines_.PointForByte(old_end_byte);
+
+    text_.replace(start_byte, old_end_byte - start_byte, new_text);
+    lines_.ApplyEdit(text_, start_byte, old_end_byte, edit.new_end_byte);
+    edit.new_end_point = lines_.PointForByte(edit.new_end_byte);
+
+    if (!tree_) return;  // 축출됨: 다음 EnsureResident에서 전체 파싱
+
+    OwnedBytesScope owned(tree_sitter_bytes_);
+    ts_tree_edit(tree_, &edit);
+    SyncStatsLogger(parser_);
+    CountStat(Stat::Parses);
+    CountStat(Stat::BytesParsed, text_.size());
+    TSTree *new_tree = ts_parser_parse_string(parser_, tree_, text_.c_str(), static_cast<uint32_t>(text_.size()));
+
+    uint32_t range_count = 0;
+    TSRange *ranges = new_tree ? ts_tree_get_changed_ranges(tree_, new_tree, &range_count) : nullptr;
+    tokens_.Update(edit, ranges, range_count, new_tree);
+    identifiers_.Update(edit, ranges, range_count, tokens_, text_);
+    semantic_.Update(edit, ranges, range_count, new_tree, text_, lines_);
+    TreeSitterFree(ranges);
+
+    ts_tree_delete(tree_);
+    tree_ = new_tree;
+    token_counts_dirty_ = true;
+}
+
+const TokenCounts &DocumentSession::token_counts() {
+    EnsureResident();
+    if (token_counts_dirty_) {
+        std::vector<TokenRef> tokens;
+        tokens_.Refs(text_, tokens);
+        token_counts_.Clear();
+        token_counts_.AddSequence(tokens);
+        token_counts_dirty_ = false;
+    }
+    return token_counts_;
+}
+
+SemanticTokens &DocumentSession::semantic_tokens() {
+    EnsureResident();
+    if (!semantic_.enabled()) semantic_.Rebuild(tree_, text_, lines_);
+    return semantic_;
+}
+
+TSTree *DocumentSession::ParseWithInsertion(uint32_t byte_offset, const std::string &inserted,
+                                           std::string &source) {
+    EnsureResident();
+    const uint32_t length = static_cast<uint32_t>(text_.size());
+    if (byte_offset > length) byte_offset = length;
+    source.assign(text_, 0, byte_offset);
+    source += inserted;
+
+    TSTree *hint = nullptr;
+    if (tree_) {
+        hint = ts_tree_copy(tree_);
+        TSInputEdit edit;
+        edit.start_byte = byte_offset;
+        edit.old_end_byte = length;
+        edit.new_end_byte = static_cast<uint32_t>(source.size());
+        edit.start_point = lines_.PointForByte(byte_offset);
+        edit.old_end_point = lines_.PointForByte(length);
+        edit.new_end_point = edit.start_point;
+        for (char c : inserted) {
+            if (c == '\n') {
+                edit.new_end_point.row++;
+                edit.new_end_point.column = 0;
+            } else {
+                edit.new_end_point.column++;
+            }
+        }
+        ts_tree_edit(hint, &edit);
+    }
+    SyncStatsLogger(conversion_parser_);
+    CountStat(Stat::Parses);
+    CountStat(Stat::BytesParsed, source.size());
+    TSTree *tree = ts_parser_parse_string(conversion_parser_, hint, source.c_str(), static_cast<uint32_t>(source.size()));
+    if (hint) ts_tree_delete(hint);
+    return tree;
+}
+
+TSStatePath DocumentSession::Convert(uint32_t byte_offset, uint32_t mode, const RecoveryLimit &limit,
+                                     uint32_t lookahead_bytes) {
+    EnsureResident();
+    OwnedBytesScope owned(tree_sitter_bytes_);  // conversion_parser_ 스택 등
+    const uint32_t length = static_cast<uint32_t>(text_.size());
+    if (byte_offset > length) byte_offset = length;
+    // 모드 0은 커서에서, 모드 2는 lookahead 창 끝에서 자른다
+    const uint32_t end = mode == 2 ? LookaheadEnd(byte_offset, length, lookahead_bytes) : byte_offset;
+    SyncStatsLogger(conversion_parser_);
+    CountStat(Stat::Parses);
+    CountStat(Stat::BytesParsed, end);
+
+    // 자른 뒤쪽을 지운 것으로 편집한 트리 사본을 재사용 힌트로 넘긴다
+    TSTree *cut_tree = nullptr;
+    if (tree_ && end < length) {
+        cut_tree = ts_tree_copy(tree_);
+        TSInputEdit cut;
+        cut.start_byte = end;
+        cut.old_end_byte = length;
+        cut.new_end_byte = end;
+        cut.start_point = lines_.PointForByte(end);
+        cut.old_end_point = lines_.PointForByte(length);
+        cut.new_end_point = cut.start_point;
+        ts_tree_edit(cut_tree, &cut);
+    }
+    TSTree *hint = end < length ? cut_tree : tree_;
+
+    RecoveryGuard guard(conversion_parser_, limit);
+    TSStatePath path;
+    if (mode == 2) {
+        path = ts_parser_parse_string_for_conversion_with_lookahead(
+            conversion_parser_, hint, text_.c_str(), end, byte_offset);
+    } else {
+        path = ts_parser_parse_string_for_conversion(conversion_parser_, hint, text_.c_str(), byte_offset);
+    }
+    if (cut_tree) ts_tree_delete(cut_tree);
+
+    if (guard.Finish()) {
+        // 복구 상한: 첫 오류 직전까지의 정상 접두사로 다시 컨버전 (Engine::ConvertSource와 같이
+        // 같은 상한 아래에서. 또 걸리면 빈 경로)
+        const uint32_t fallback = guard.FallbackByte(text_, byte_offset);
+        CountStat(Stat::Parses);
+        CountStat(Stat::BytesParsed, fallback);
+        RecoveryGuard retry(conversion_parser_, limit);
+        path = ts_parser_parse_string_for_conversion(conversion_parser_, NULL, text_.c_str(), fallback);
+        if (retry.Finish()) path.count = 0;
+    }
+    CountStatePath(path.count);
+    return path;
+}
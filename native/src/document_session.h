@@ -0,0 +1,102 @@
+/**
+ * @file document_session.h
+ * @brief 열린 문서별 파싱 세션 (텍스트 + 보존 트리 + 줄 색인 + 토큰열 + 식별자 색인 + 시맨틱 토큰)
+ *
+ * VS Code의 contentChanges를 그대로 받아(UTF-16 오프셋 기준) 텍스트와 트리를 증분 갱신한다.
+ * 컨버전 파싱은 보존 트리를 old_tree로 넘겨 재사용한다.
+ *   - 모드 0: 트리 사본에서 커서 이후를 삭제하는 편집을 적용한 뒤 잘린 소스로 컨버전
+ *   - 모드 2: 최신 트리를 그대로 old_tree로 사용
+ *
+ * 메모리 예산을 넘으면 addon이 오래 안 쓴 세션을 Evict()한다. 텍스트와 줄 색인은 남기고
+ * 트리/파서/토큰열/식별자 색인/토큰 빈도만 버리며, 트리가 필요한 호출에서 전체 파싱으로 다시 만든다.
+ * 축출된 동안의 편집은 텍스트에만 적용한다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "tree_sitter/api.h"
+#include "identifier_index.h"
+#include "line_index.h"
+#include "recovery_limit.h"
+#include "semantic_tokens.h"
+#include "symbol_classes.h"
+#include "token_model.h"
+#include "token_stream.h"
+
+class DocumentSession {
+public:
+    DocumentSession(const TSLanguage *language, const SymbolClassifier &classifier,
+                    std::string text, int64_t version);
+    ~DocumentSession();
+
+    DocumentSession(const DocumentSession &) = delete;
+    DocumentSession &operator=(const DocumentSession &) = delete;
+
+    // VS Code TextDocumentContentChangeEvent 한 건 적용 (rangeOffset, rangeLength는 UTF-16 단위)
+    void ApplyEdit(uint32_t start_utf16, uint32_t old_length_utf16, const std::string &new_text);
+
+    // 전체 텍스트 교체 (동기화가 어긋났을 때)
+    void Replace(std::string text);
+
+    void set_version(int64_t version) { version_ = version; }
+    int64_t version() const { return version_; }
+
+    // 트리 등 재생성 가능한 상태를 버린다 / 필요하면 다시 만든다
+    void Evict();
+    void EnsureResident();
+    bool resident() const { return tree_ != nullptr; }
+
+    // 텍스트/줄 색인/토큰열/식별자 색인/토큰 빈도의 대략적인 바이트 수 (트리와 파서는 tree_sitter_bytes)
+    size_t MemoryBytes() const;
+    // 이 세션의 트리/파서가 가진 Tree-sitter 할당 (세션 작업 중 이 스레드의 순할당 누계, 축출하면 0)
+    size_t tree_sitter_bytes() const { return tree_sitter_bytes_ > 0 ? static_cast<size_t>(tree_sitter_bytes_) : 0; }
+
+    // LRU 축출 순서용 (addon이 접근할 때마다 갱신)
+    void set_last_used(uint64_t tick) { last_used_ = tick; }
+    uint64_t last_used() const { return last_used_; }
+
+    // 커서 위치의 상태 경로. 반환된 path는 다음 Convert 호출 전까지 유효하다.
+    // limit이 켜져 있으면 오류 복구가 상한을 넘을 때 첫 오류 직전까지의 경로로 대체한다.
+    // lookahead_bytes: 모드 2에서 커서 뒤로 넘길 바이트 수 (0이면 문서 끝까지)
+    TSStatePath Convert(uint32_t byte_offset, uint32_t mode, const RecoveryLimit &limit = RecoveryLimit(),
+                        uint32_t lookahead_bytes = 0);
+
+    // 커서 위치에 inserted를 넣고 그 뒤를 지운 텍스트를 보존 트리 재사용으로 파싱한다.
+    // source에 파싱한 텍스트를 돌려주며, 반환된 트리는 호출측이 해제한다.
+    TSTree *ParseWithInsertion(uint32_t byte_offset, const std::string &inserted, std::string &source);
+
+    const std::string &text() const { return text_; }
+    // 축출된 세션이면 nullptr / 빈 색인 (필요하면 EnsureResident 먼저)
+    const TSTree *tree() const { return tree_; }
+    const IdentifierIndex &identifiers() const { return identifiers_; }
+    const LineIndex &lines() const { return lines_; }
+    // 단말 토큰열 (편집마다 변경 구간만 갈아 끼운다). 트리를 다시 훑는 대신 이것을 쓴다
+    const TokenStream &tokens() const { return tokens_; }
+
+    // 워크스페이스 토큰 모델 오버레이 (편집 후 첫 조회 때 다시 센다)
+    const TokenCounts &token_counts();
+
+    // 시맨틱 토큰 (첫 조회 때 전체 수집, 이후 편집마다 변경 구간만 갱신)
+    SemanticTokens &semantic_tokens();
+
+private:
+    void Reparse();
+
+    const TSLanguage *language_;
+    TSParser *parser_ = nullptr;             // 증분 파싱용
+    TSParser *conversion_parser_ = nullptr;  // 컨버전 전용 (증분 파서 상태를 건드리지 않도록 분리)
+    TSTree *tree_ = nullptr;
+    std::string text_;
+    LineIndex lines_;
+    int64_t version_;
+    TokenStream tokens_;
+    IdentifierIndex identifiers_;
+    TokenCounts token_counts_;
+    SemanticTokens semantic_;
+    bool token_counts_dirty_ = true;
+    uint64_t last_used_ = 0;
+    int64_t tree_sitter_bytes_ = 0;
+};
@@ -0,0 +1,439 @@
+/**
+ * @file engine.cc
+ * @brief Engine 구현
+ */
+
+#include "engine.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "conversion_api.h"
+#include "engine_stats.h"
+#include "memory_budget.h"
+
+Engine::Engine(const TSLanguage *language) : language_(language), classifier_(language) {}
+
+Engine::~Engine() {
+    sessions_.clear();
+    if (scratch_parser_) ts_parser_delete(scratch_parser_);
+}
+
+// =============================================================================
+// [Conversion]
+// =============================================================================
+TSStatePath Engine::ConvertSource(const std::string &source, uint32_t byte_offset, uint32_t mode) {
+    if (!scratch_parser_) {
+        scratch_parser_ = ts_parser_new();
+        ts_parser_set_language(scratch_parser_, language_);
+    } else {
+        ts_parser_reset(scratch_parser_);
+    }
+    TSParser *parser = scratch_parser_;
+    SyncStatsLogger(parser);
+
+    // 바이트 오프셋으로 파싱 길이 결정
+    const uint32_t length = static_cast<uint32_t>(source.size());
+    const uint32_t effective_length = byte_offset < length ? byte_offset : length;
+    const uint32_t lookahead_end = LookaheadEnd(effective_length, length, lookahead_bytes_);
+
+    if (debug_dump_) {
+        // [로그 덤프] logged_actions.txt 저장용 일반 파싱 (트리는 쓰지 않으므로 덤프를 끄면 생략)
+        RecoveryGuard guard(parser, recovery_limit_);
+        CountStat(Stat::Parses);
+        CountStat(Stat::BytesParsed, effective_length);
+        TSTree *tree = ts_parser_parse_string(parser, NULL, source.c_str(), effective_length);
+        ts_parser_write_logged_actions(parser, "logged_actions.txt");
+        if (tree) ts_tree_delete(tree);
+    }
+
+    CountStat(Stat::Parses);
+    CountStat(Stat::BytesParsed, mode == 2 ? lookahead_end : effective_length);
+    RecoveryGuard guard(parser, recovery_limit_);
+    TSStatePath path;
+    if (mode == 2) {
+        // 모드 2: 전체 소스(또는 lookahead 창까지) 전달 + 커서 위치 별도 (렉서 lookahead 활용)
+        path = ts_parser_parse_string_for_conversion_with_lookahead(
+            parser, NULL, source.c_str(), lookahead_end, effective_length);
+    } else {
+        // 모드 0 (기본): 커서 위치까지 잘라서 전달
+        path = ts_parser_parse_string_for_conversion(parser, NULL, source.c_str(), effective_length);
+    }
+    if (guard.Finish()) {
+        // 복구 상한: 첫 오류 직전까지의 정상 접두사로 다시 컨버전. 접두사도 문장 중간에서 끝나므로
+        // 복구가 다시 돌 수 있어 같은 상한을 건다. 또 걸리면 후보 없이 빈 경로
+        const uint32_t fallback = guard.FallbackByte(source, effective_length);
+        CountStat(Stat::Parses);
+        CountStat(Stat::BytesParsed, fallback);
+        RecoveryGuard retry(parser, recovery_limit_);
+        path = ts_parser_parse_string_for_conversion(parser, NULL, source.c_str(), fallback);
+        if (retry.Finish()) path.count = 0;
+    }
+    if (debug_dump_) ts_parser_write_conversion_result(parser, &path, stdout);
+    CountStatePath(path.count);
+    return path;
+}
+
+bool Engine::ConvertDocument(const std::string &uri, int64_t version, uint32_t byte_offset, uint32_t mode,
+                             TSStatePath &path) {
+    DocumentSession *session = Find(uri);
+    if (!session || session->version() != version) {
+        CountStat(Stat::SessionMisses);
+        return false;
+    }
+    CountStat(Stat::SessionHits);
+    Touch(session, true);
+    path = session->Convert(byte_offset, mode, recovery_limit_, lookahead_bytes_);
+    return true;
+}
+
+// =============================================================================
+// [Document Sessions]
+// =============================================================================
+DocumentSession *Engine::Open(const std::string &uri, std::string text, int64_t version) {
+    DocumentSession *session = Find(uri);
+    if (session) {
+        session->Replace(std::move(text));
+        session->set_version(version);
+    } else {
+        auto created = std::make_unique<DocumentSession>(language_, classifier_, std::move(text), version);
+        session = created.get();
+        sessions_[uri] = std::move(created);
+    }
+    Touch(session, false);
+    return session;
+}
+
+DocumentSession *Engine::Find(const std::string &uri) {
+    auto it = sessions_.find(uri);
+    return it == sessions_.end() ? nullptr : it->second.get();
+}
+
+bool Engine::Edit(const std::string &uri, uint32_t offset_utf16, uint32_t length_utf16, const std::string &text) {
+    DocumentSession *session = Find(uri);
+    if (!session) return false;
+    session->ApplyEdit(offset_utf16, length_utf16, text);
+    return true;
+}
+
+bool Engine::SetVersion(const std::string &uri, int64_t version) {
+    DocumentSession *session = Find(uri);
+    if (!session) return false;
+    session->set_version(version);
+    Touch(session, false);
+    return true;
+}
+
+void Engine::Close(const std::string &uri) {
+    sessions_.erase(uri);
+}
+
+void Engine::Touch(DocumentSession *session, bool need_tree) {
+    session->set_last_used(++session_clock_);
+    if (need_tree && !session->resident()) {
+        session->EnsureResident();
+        rebuilds_++;
+        CountStat(Stat::SessionRebuilds);
+    }
+    if (budget_bytes_ > 0) EvictUntil(budget_bytes_, session);
+}
+
+// =============================================================================
+// [Memory Budget]
+// - 예산을 넘으면 가장 오래 안 쓴 세션부터 Evict (텍스트는 남고, 다음 조회 때 다시 파싱)
+// - 예산과 비교하는 값은 이 엔진의 세션이 가진 것만이다 (세션별 Tree-sitter 할당 + 색인 추정치).
+//   프로세스 합계(TreeSitterAllocatedBytes)에는 다른 엔진/컨버전 워커/스크래치 파서처럼 축출로 줄지 않는
+//   몫이 섞여 있어, 예산이 그보다 작으면 Touch마다 모든 세션을 비우고 다시 파싱하게 된다.
+// - 언어 간 예산 배분은 호출측(확장의 MemoryBudget)이 SetMemoryBudget/EvictUntil로 한다
+// =============================================================================
+size_t Engine::EngineBytes() const {
+    size_t bytes = 0;
+    for (const auto &kv : sessions_) bytes += kv.second->tree_sitter_bytes() + kv.second->MemoryBytes();
+    return bytes;
+}
+
+void Engine::SetMemoryBudget(size_t bytes) {
+    budget_bytes_ = bytes;
+    if (budget_bytes_ > 0) EvictUntil(budget_bytes_);
+}
+
+uint32_t Engine::EvictUntil(size_t target, const DocumentSession *keep) {
+    // 합계는 한 번만 재고, 비울 때마다 그 세션이 줄인 만큼만 뺀다 (세션 수에 선형 + 정렬)
+    size_t bytes = EngineBytes();
+    if (bytes <= target) return 0;
+
+    std::vector<DocumentSession *> victims;
+    for (const auto &kv : sessions_) {
+        DocumentSession *candidate = kv.second.get();
+        if (candidate != keep && candidate->resident()) victims.push_back(candidate);
+    }
+    std::sort(victims.begin(), victims.end(), [](const DocumentSession *a, const DocumentSession *b) {
+        return a->last_used() < b->last_used();
+    });
+
+    uint32_t evicted = 0;
+    for (DocumentSession *victim : victims) {
+        if (bytes <= target) break;
+        const size_t before = victim->tree_sitter_bytes() + victim->MemoryBytes();
+        victim->Evict();
+        const size_t after = victim->tree_sitter_bytes() + victim->MemoryBytes();
+        bytes -= before > after ? before - after : 0;
+        evicted++;
+    }
+    evictions_ += evicted;
+    return evicted;
+}
+
+Engine::MemoryStats Engine::memory_stats() const {
+    MemoryStats stats{};
+    for (const auto &kv : sessions_) {
+        stats.session_bytes += kv.second->MemoryBytes();
+        stats.engine_bytes += kv.second->tree_sitter_bytes() + kv.second->MemoryBytes();
+        if (kv.second->resident()) stats.resident_sessions++;
+    }
+    stats.tree_sitter_bytes = TreeSitterAllocatedBytes();
+    stats.tree_sitter_peak_bytes = TreeSitterPeakBytes();
+    stats.budget_bytes = budget_bytes_;
+    stats.sessions = static_cast<uint32_t>(sessions_.size());
+    stats.evictions = evictions_;
+    stats.rebuilds = rebuilds_;
+    return stats;
+}
+
+// =============================================================================
+// [Candidates]
+// =============================================================================
+bool Engine::LoadTuning(const std::string &path, std::string &error) {
+    EngineTuning tuning;
+    if (!LoadEngineTuning(path, tuning, error)) return false;
+    tuning_ = tuning;
+    recovery_limit_ = tuning.recovery;
+    lookahead_bytes_ = tuning.lookahead_bytes;
+    return true;
+}
+
+bool Engine::LoadCandidates(const std::string &path, std::string &error) {
+    CandidateDb db;
+    if (!db.Load(path, error)) return false;
+    candidates_ = std::move(db);
+    has_candidates_ = true;
+    return true;
+}
+
+void Engine::RankCandidates(const TSStateId *states, uint32_t count, std::vector<RankedCandidate> &out) const {
+    out.clear();
+    if (has_candidates_) candidates_.Rank(states, count, out);
+}
+
+// =============================================================================
+// [Identifiers]
+// =============================================================================
+std::vector<IdentifierSuggestion> Engine::QueryIdentifiers(const std::string &uri, uint32_t byte_offset,
+                                                           SymbolClass kind, size_t limit, bool include_workspace) {
+    std::vector<IdentifierSuggestion> merged;
+    if (DocumentSession *session = Find(uri)) {
+        Touch(session, true);
+        merged = session->identifiers().Query(session->tree(), byte_offset, kind, limit);
+    }
+    if (!include_workspace) return merged;
+
+    // 다른 문서의 이름은 커서 위치와 무관하므로 점수를 절반으로 낮춰 합친다
+    // (축출된 문서는 색인이 비어 있으므로 다시 파싱하지 않고 건너뛴다)
+    std::unordered_map<std::string, size_t> seen;
+    for (size_t i = 0; i < merged.size(); i++) seen[merged[i].text] = i;
+    for (const auto &kv : sessions_) {
+        if (kv.first == uri) continue;
+        for (auto &s : kv.second->identifiers().Query(nullptr, UINT32_MAX, kind, limit)) {
+            s.score *= 0.5;
+            auto it = seen.find(s.text);
+            if (it == seen.end()) {
+                seen[s.text] = merged.size();
+                merged.push_back(std::move(s));
+            } else if (merged[it->second].score < s.score) {
+                merged[it->second].score = s.score;
+            }
+        }
+    }
+    std::sort(merged.begin(), merged.end(), [](const IdentifierSuggestion &a, const IdentifierSuggestion &b) {
+        return a.score > b.score;
+    });
+    if (merged.size() > limit) merged.resize(limit);
+    return merged;
+}
+
+// =============================================================================
+// [Token Model] 구조 후보 → 구체 토큰열 (LLM 없이)
+// =============================================================================
+bool Engine::LoadTokenModel(const std::string &path, std::string &error) {
+    return token_model_.Open(path, ts_language_symbol_count(language_), error);
+}
+
+const Engine::SlotSymbols &Engine::slot_symbols() {
+    if (!slot_symbols_) {
+        auto table = std::make_unique<SlotSymbols>();
+        const uint32_t count = ts_language_symbol_count(language_);
+        for (uint32_t i = 0; i < count; i++) {
+            const TSSymbol symbol = static_cast<TSSymbol>(i);
+            table->by_name[ts_language_symbol_name(language_, symbol)].push_back(symbol);
+            const SymbolClass kind = classifier_.Classify(symbol);
+            if (kind == SymbolClass::Identifier || kind == SymbolClass::Literal) table->expansion.push_back(symbol);
+        }
+        slot_symbols_ = std::move(table);
+    }
+    return *slot_symbols_;
+}
+
+// 익명 심볼(기호/키워드)은 이름이 곧 텍스트이므로 고정 토큰, 나머지는 슬롯
+bool Engine::BuildTokenSlots(const std::string &raw_key, std::vector<TokenSlot> &slots) {
+    const SlotSymbols &table = slot_symbols();
+    size_t pos = 0;
+    while (pos < raw_key.size()) {
+        const size_t end = std::min(raw_key.find(' ', pos), raw_key.size());
+        const std::string name = raw_key.substr(pos, end - pos);
+        pos = end + 1;
+        if (name.empty()) continue;
+
+        auto it = table.by_name.find(name);
+        if (it == table.by_name.end()) return false;
+        TokenSlot slot;
+        for (TSSymbol symbol : it->second) {
+            if (ts_language_symbol_type(language_, symbol) == TSSymbolTypeAnonymous) {
+                slot.fixed_text = name;
+                slot.symbols.push_back(symbol);
+            }
+        }
+        if (slot.fixed_text.empty()) {
+            slot.symbols = it->second;
+            slot.expansion = table.expansion;
+        }
+        slots.push_back(std::move(slot));
+    }
+    return !slots.empty();
+}
+
+bool Engine::ProposeTokens(const std::string &uri, uint32_t byte_offset, const std::string &raw_key,
+                           bool include_workspace, const TSStateId *states, uint32_t state_count,
+                           TokenProposal &out) {
+    std::vector<TokenSlot> slots;
+    if (!BuildTokenSlots(raw_key, slots)) return false;
+
+    std::vector<TokenRef> context;
+    std::vector<const TokenCounts *> overlays;
+    if (DocumentSession *session = Find(uri)) {
+        Touch(session, true);
+        session->tokens().Preceding(session->text(), byte_offset, 2, context);
+        overlays.push_back(&session->token_counts());
+    }
+    if (include_workspace) {
+        for (const auto &kv : sessions_) {
+            // 축출된 문서는 오버레이에서 뺀다 (token_counts()가 다시 파싱하지 않도록)
+            if (kv.first != uri && kv.second->resident()) overlays.push_back(&kv.second->token_counts());
+        }
+    }
+
+    std::unique_ptr<LrSimulator> constraint;
+    if (states && state_count > 0) {
+        constraint = std::make_unique<LrSimulator>(language_);
+        constraint->Reset(states, state_count);
+    }
+
+    TokenProposer proposer(&token_model_, std::move(overlays));
+    return proposer.Propose(context, slots, 4, out, constraint.get());
+}
+
+// =============================================================================
+// [Constrained Decoding]
+// - 로컬 생성 모델(또는 TS 쪽 MockBackend)이 생성 도중 문법에 맞지 않는 토큰을 마스킹하고,
+//   complete가 되면 일찍 멈출 수 있게 한다
+// =============================================================================
+uint32_t Engine::BeginDecode(const TSStateId *states, uint32_t count, const std::string &uri,
+                             uint32_t byte_offset) {
+    auto decode = std::make_unique<ConstrainedDecode>(language_);
+    decode->initial.assign(states, states + count);
+    decode->uri = uri;
+    decode->byte_offset = byte_offset;
+    decode->lr.Reset(decode->initial.data(), static_cast<uint32_t>(decode->initial.size()));
+
+    const uint32_t handle = next_decoder_++;
+    decoders_[handle] = std::move(decode);
+    return handle;
+}
+
+Engine::ConstrainedDecode *Engine::FindDecode(uint32_t handle) {
+    auto it = decoders_.find(handle);
+    return it == decoders_.end() ? nullptr : it->second.get();
+}
+
+void Engine::FillStep(const ConstrainedDecode &decode, bool accepted, DecodeStep &step) const {
+    step.accepted = accepted;
+    step.complete = decode.lr.Allowed(step.allowed);
+}
+
+// 심볼 이름 기준 (같은 이름이 여럿이면 받아들여지는 쪽)
+bool Engine::FeedTerminal(uint32_t handle, const std::string &symbol_name, DecodeStep &step) {
+    ConstrainedDecode *decode = FindDecode(handle);
+    if (!decode) return false;
+
+    bool accepted = false;
+    const SlotSymbols &table = slot_symbols();
+    auto it = table.by_name.find(symbol_name);
+    if (it != table.by_name.end()) {
+        for (TSSymbol symbol : it->second) {
+            if (symbol < decode->lr.token_count() && decode->lr.Feed(symbol)) {
+                accepted = true;
+                break;
+            }
+        }
+    }
+    FillStep(*decode, accepted, step);
+    return true;
+}
+
+// 보존 트리 재사용으로 다시 파싱해 단말열을 얻고 시작 스택에서 처음부터 먹인다
+// (마지막 토큰이 아직 덜 생성된 경우도 자연스럽게 처리). 하나라도 거부되면 이번 조각은 버린다
+bool Engine::FeedText(uint32_t handle, const std::string &text, DecodeStep &step) {
+    ConstrainedDecode *decode = FindDecode(handle);
+    if (!decode) return false;
+    DocumentSession *session = decode->uri.empty() ? nullptr : Find(decode->uri);
+    if (!session) {
+        FillStep(*decode, false, step);
+        return true;
+    }
+    Touch(session, true);
+
+    const std::string generated = decode->generated + text;
+    std::string source;
+    TSTree *tree = session->ParseWithInsertion(decode->byte_offset, generated, source);
+    std::vector<TokenRef> leaves;
+    CollectLeafTokens(tree, source, leaves);
+
+    LrSimulator lr = decode->lr;
+    lr.Reset(decode->initial.data(), static_cast<uint32_t>(decode->initial.size()));
+    bool accepted = true;
+    for (const TokenRef &leaf : leaves) {
+        if (static_cast<uint32_t>(leaf.text - source.data()) < decode->byte_offset) continue;
+        if (!lr.Feed(leaf.symbol)) {
+            accepted = false;
+            break;
+        }
+    }
+    if (tree) ts_tree_delete(tree);
+
+    if (accepted) {
+        decode->generated = generated;
+        decode->lr = std::move(lr);
+    }
+    FillStep(*decode, accepted, step);
+    return true;
+}
+
+bool Engine::DecodeState(uint32_t handle, DecodeStep &step) {
+    ConstrainedDecode *decode = FindDecode(handle);
+    if (!decode) return false;
+    FillStep(*decode, true, step);
+    return true;
+}
+
+void Engine::EndDecode(uint32_t handle) {
+    decoders_.erase(handle);
+}
@@ -0,0 +1,183 @@
+/**
+ * @file engine.h
+ * @brief 자동완성 엔진 코어 (언어 하나분: 파서, 문서 세션, 컨버전, 후보 순위, 메모리 예산)
+ *
+ * C ABI(native/include/cce_engine.h → cce_engine.cc)와 CLI 도구가 같은 구현을 쓰도록 addon에 있던 로직을
+ * 옮긴 것이다. N-API addon(addon.cc)은 C ABI만 부르며 값 변환만 한다. Node 없이 벤치마크/프로파일링할 수 있다.
+ *
+ * 언어는 빌드 타겟마다 하나다 (LANG_* → GET_LANGUAGE, generated/lang_constants.h의 고정 크기 테이블).
+ * 스레드 안전하지 않다: 인스턴스 하나는 한 스레드에서만 쓴다 (여러 스레드면 스레드마다 Engine).
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tree_sitter/api.h"
+#include "candidate_db.h"
+#include "document_session.h"
+#include "engine_tuning.h"
+#include "identifier_index.h"
+#include "lr_simulator.h"
+#include "recovery_limit.h"
+#include "symbol_classes.h"
+#include "token_model.h"
+
+class Engine {
+public:
+    struct MemoryStats {
+        size_t engine_bytes;          // 세션이 가진 Tree-sitter 할당 + session_bytes (예산 비교 대상)
+        size_t tree_sitter_bytes;     // 프로세스 전체 (다른 엔진/워커 포함, 보고용)
+        size_t tree_sitter_peak_bytes;
+        size_t session_bytes;
+        size_t budget_bytes;          // 0이면 무제한
+        uint32_t sessions;
+        uint32_t resident_sessions;
+        uint64_t evictions;
+        uint64_t rebuilds;
+    };
+
+    explicit Engine(const TSLanguage *language);
+    ~Engine();
+
+    Engine(const Engine &) = delete;
+    Engine &operator=(const Engine &) = delete;
+
+    const TSLanguage *language() const { return language_; }
+    const SymbolClassifier &classifier() const { return classifier_; }
+
+    // ---------------------------------------------------------------------
+    // 컨버전 (모드 0: 커서에서 자름, 모드 2: 전체 소스 + 커서 lookahead)
+    // 반환된 path는 같은 종류의 다음 호출 전까지 유효하다.
+    // ---------------------------------------------------------------------
+    TSStatePath ConvertSource(const std::string &source, uint32_t byte_offset, uint32_t mode);
+    // 세션이 없거나 버전이 다르면 false (호출측은 ConvertSource로 대체)
+    bool ConvertDocument(const std::string &uri, int64_t version, uint32_t byte_offset, uint32_t mode,
+                         TSStatePath &path);
+
+    // logged_actions.txt / stdout 덤프 (디버깅용, 기본 꺼짐. 켜면 ConvertSource마다 파싱이 한 번 더 돈다)
+    void set_debug_dump(bool enabled) { debug_dump_ = enabled; }
+
+    // 컨버전 파싱의 오류 복구 상한 (recovery_limit.h, 기본은 꺼짐)
+    void set_recovery_limit(const RecoveryLimit &limit) { recovery_limit_ = limit; }
+    const RecoveryLimit &recovery_limit() const { return recovery_limit_; }
+    // 모드 2에서 커서 뒤로 넘길 바이트 수 (0이면 문서 끝까지, 기본)
+    void set_lookahead_bytes(uint32_t bytes) { lookahead_bytes_ = bytes; }
+    uint32_t lookahead_bytes() const { return lookahead_bytes_; }
+
+    // 튜닝 프로파일(engine_tuning.h)을 읽어 복구 상한과 lookahead 창에 적용. 실패하면 그대로 둔다
+    bool LoadTuning(const std::string &path, std::string &error);
+    const EngineTuning &tuning() const { return tuning_; }
+
+    // ---------------------------------------------------------------------
+    // 문서 세션 (키: URI)
+    // ---------------------------------------------------------------------
+    DocumentSession *Open(const std::string &uri, std::string text, int64_t version);
+    DocumentSession *Find(const std::string &uri);
+    // VS Code contentChanges 한 건 (UTF-16 단위). 세션이 없으면 false
+    bool Edit(const std::string &uri, uint32_t offset_utf16, uint32_t length_utf16, const std::string &text);
+    bool SetVersion(const std::string &uri, int64_t version);
+    void Close(const std::string &uri);
+    const std::unordered_map<std::string, std::unique_ptr<DocumentSession>> &sessions() const { return sessions_; }
+
+    // 접근 시각 갱신. need_tree면 축출된 세션을 다시 파싱하고, 예산을 넘으면 다른 세션을 축출한다.
+    void Touch(DocumentSession *session, bool need_tree);
+
+    // ---------------------------------------------------------------------
+    // 메모리 예산 (Tree-sitter 할당 + 세션 텍스트/색인 추정치, LRU 축출)
+    // ---------------------------------------------------------------------
+    void SetMemoryBudget(size_t bytes);
+    // target 이하가 될 때까지 LRU 순으로 축출 (keep은 제외). 반환: 축출한 세션 수
+    uint32_t EvictUntil(size_t target, const DocumentSession *keep = nullptr);
+    size_t EngineBytes() const;
+    MemoryStats memory_stats() const;
+
+    // ---------------------------------------------------------------------
+    // 후보 DB (resources/<lang>/candidates.json, CompletionService.lookupDB와 같은 순위)
+    // ---------------------------------------------------------------------
+    bool LoadCandidates(const std::string &path, std::string &error);
+    bool has_candidates() const { return has_candidates_; }
+    void RankCandidates(const TSStateId *states, uint32_t count, std::vector<RankedCandidate> &out) const;
+    const CandidateDb &candidates() const { return candidates_; }
+
+    // ---------------------------------------------------------------------
+    // 식별자 슬롯 후보 (최근성/스코프/거리 순)
+    // include_workspace면 다른 세션의 색인도 점수를 절반으로 낮춰 합친다 (축출된 세션은 건너뛴다)
+    // ---------------------------------------------------------------------
+    std::vector<IdentifierSuggestion> QueryIdentifiers(const std::string &uri, uint32_t byte_offset,
+                                                       SymbolClass kind, size_t limit, bool include_workspace);
+
+    // ---------------------------------------------------------------------
+    // 토큰 모델 (resources/<lang>/token_model.bin, 메모리 매핑) + 열린 문서 빈도 오버레이
+    // ---------------------------------------------------------------------
+    bool LoadTokenModel(const std::string &path, std::string &error);
+    // 구조 후보 key("ID = Expr")의 슬롯을 채운 토큰열. 채울 수 없는 슬롯이 있으면 false.
+    // 커서 직전 토큰 2개가 컨텍스트이고, states(커서의 상태 경로)가 있으면 파싱 테이블이 받는 토큰만 쓴다
+    bool ProposeTokens(const std::string &uri, uint32_t byte_offset, const std::string &raw_key,
+                       bool include_workspace, const TSStateId *states, uint32_t state_count,
+                       TokenProposal &out);
+
+    // ---------------------------------------------------------------------
+    // 제약 디코딩: 커서의 파싱 스택 위에서 "토큰 하나 먹이고 → 다음 허용 단말" 반복 (핸들 단위)
+    // ---------------------------------------------------------------------
+    struct DecodeStep {
+        bool accepted = false;
+        bool complete = false;
+        std::vector<TSSymbol> allowed;  // 받아들일 수 있는 단말 (심볼 ID 오름차순)
+    };
+    // uri가 비어 있지 않으면 FeedText가 그 세션에서 커서 앞 텍스트를 가져온다. 반환: 핸들 (1부터)
+    uint32_t BeginDecode(const TSStateId *states, uint32_t count, const std::string &uri, uint32_t byte_offset);
+    // 핸들이 없으면 false. 거부되면 step.accepted = false이고 상태는 그대로다
+    bool FeedTerminal(uint32_t handle, const std::string &symbol_name, DecodeStep &step);
+    // 커서 앞 텍스트 + 지금까지 생성된 텍스트 + text를 다시 파싱해 시작 스택에서 처음부터 먹인다
+    bool FeedText(uint32_t handle, const std::string &text, DecodeStep &step);
+    bool DecodeState(uint32_t handle, DecodeStep &step);
+    void EndDecode(uint32_t handle);
+
+private:
+    // DB key 토큰 이름 → 심볼 ID 목록, 비단말 슬롯을 펼칠 식별자/리터럴 심볼 (처음 쓸 때 만든다)
+    struct SlotSymbols {
+        std::unordered_map<std::string, std::vector<TSSymbol>> by_name;
+        std::vector<TSSymbol> expansion;
+    };
+    struct ConstrainedDecode {
+        explicit ConstrainedDecode(const TSLanguage *language) : lr(language) {}
+        std::string uri;
+        uint32_t byte_offset = 0;
+        std::vector<TSStateId> initial;
+        std::string generated;  // FeedText로 누적된 텍스트
+        LrSimulator lr;
+    };
+
+    const SlotSymbols &slot_symbols();
+    bool BuildTokenSlots(const std::string &raw_key, std::vector<TokenSlot> &slots);
+    ConstrainedDecode *FindDecode(uint32_t handle);
+    void FillStep(const ConstrainedDecode &decode, bool accepted, DecodeStep &step) const;
+
+    const TSLanguage *language_;
+    SymbolClassifier classifier_;
+    TSParser *scratch_parser_ = nullptr;  // ConvertSource 전용 (호출마다 만들지 않는다)
+    bool debug_dump_ = false;
+    RecoveryLimit recovery_limit_;
+    uint32_t lookahead_bytes_ = 0;
+    EngineTuning tuning_;
+
+    std::unordered_map<std::string, std::unique_ptr<DocumentSession>> sessions_;
+    size_t budget_bytes_ = 0;
+    uint64_t session_clock_ = 0;
+    uint64_t evictions_ = 0;
+    uint64_t rebuilds_ = 0;
+
+    CandidateDb candidates_;
+    bool has_candidates_ = false;
+
+    TokenModel token_model_;
+    std::unique_ptr<SlotSymbols> slot_symbols_;
+    std::unordered_map<uint32_t, std::unique_ptr<ConstrainedDecode>> decoders_;
+    uint32_t next_decoder_ = 1;
+};
@@ -0,0 +1,126 @@
+/**
+ * @file engine_stats.cc
+ * @brief 스레드별 카운터 등록/합산과 계수 로거
+ */
+
+#include "engine_stats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+const char *const kStatNames[static_cast<uint32_t>(Stat::kCount)] = {
+    "conversions", "parses", "bytesParsed", "tokensLexed", "parseActions", "recoverySteps",
+    "recoveryCapped", "statePathStates", "statePathMax", "allocations", "allocatedBytes",
+    "sessionHits", "sessionMisses", "sessionRebuilds",
+};
+
+namespace {
+
+constexpr uint32_t kCount = static_cast<uint32_t>(Stat::kCount);
+
+struct ThreadCounters {
+    std::atomic<uint64_t> values[kCount] = {};
+};
+
+std::mutex g_mutex;
+std::vector<ThreadCounters *> g_threads;
+uint64_t g_retired[kCount] = {};  // 종료된 스레드 누적
+std::atomic<bool> g_detail{false};
+
+void Merge(uint64_t into[kCount], uint32_t i, uint64_t value) {
+    if (i == static_cast<uint32_t>(Stat::StatePathMax)) {
+        into[i] = std::max(into[i], value);
+    } else {
+        into[i] += value;
+    }
+}
+
+struct Registration {
+    ThreadCounters counters;
+    Registration() {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        g_threads.push_back(&counters);
+    }
+    ~Registration() {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        for (uint32_t i = 0; i < kCount; i++) Merge(g_retired, i, counters.values[i].load(std::memory_order_relaxed));
+        g_threads.erase(std::find(g_threads.begin(), g_threads.end(), &counters));
+    }
+};
+
+ThreadCounters &Local() {
+    thread_local Registration registration;
+    return registration.counters;
+}
+
+bool StartsWith(const char *s, const char *prefix) {
+    return std::strncmp(s, prefix, std::strlen(prefix)) == 0;
+}
+
+void StatsLog(void *, TSLogType type, const char *message) {
+    if (type != TSLogTypeParse) return;
+    if (StartsWith(message, "lexed_lookahead")) {
+        CountStat(Stat::TokensLexed);
+    } else if (StartsWith(message, "shift") || StartsWith(message, "reduce")) {
+        CountStat(Stat::ParseActions);
+    } else if (StartsWith(message, "recover") || StartsWith(message, "skip_token") ||
+               StartsWith(message, "detect_error")) {
+        CountStat(Stat::RecoverySteps);
+    }
+}
+
+}  // namespace
+
+void CountStat(Stat stat, uint64_t amount) {
+    // 이 스레드만 쓰므로 load + store로 충분 (lock 접두 명령 없음)
+    std::atomic<uint64_t> &value = Local().values[static_cast<uint32_t>(stat)];
+    value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+void MaxStat(Stat stat, uint64_t candidate) {
+    std::atomic<uint64_t> &value = Local().values[static_cast<uint32_t>(stat)];
+    if (candidate > value.load(std::memory_order_relaxed)) value.store(candidate, std::memory_order_relaxed);
+}
+
+void CountStatePath(uint32_t length) {
+    CountStat(Stat::Conversions);
+    CountStat(Stat::StatePathStates, length);
+    MaxStat(Stat::StatePathMax, length);
+}
+
+void SnapshotStats(uint64_t out[kCount]) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    std::copy(g_retired, g_retired + kCount, out);
+    for (const ThreadCounters *counters : g_threads) {
+        for (uint32_t i = 0; i < kCount; i++) Merge(out, i, counters->values[i].load(std::memory_order_relaxed));
+    }
+}
+
+void ResetStats() {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    std::fill(g_retired, g_retired + kCount, 0);
+    for (ThreadCounters *counters : g_threads) {
+        for (auto &value : counters->values) value.store(0, std::memory_order_relaxed);
+    }
+}
+
+void SetStatsDetail(bool enabled) {
+    g_detail.store(enabled, std::memory_order_relaxed);
+}
+
+bool StatsDetail() {
+    return g_detail.load(std::memory_order_relaxed);
+}
+
+void SyncStatsLogger(TSParser *parser) {
+    if (!parser) return;
+    const TSLogger current = ts_parser_logger(parser);
+    if (StatsDetail()) {
+        if (!current.log) ts_parser_set_logger(parser, {nullptr, StatsLog});
+    } else if (current.log == StatsLog) {
+        ts_parser_set_logger(parser, {nullptr, nullptr});
+    }
+}
@@ -0,0 +1,53 @@
+/**
+ * @file engine_stats.h
+ * @brief 요청 단위 엔진 카운터 (스레드별 누적, getStats/resetStats로 노출)
+ *
+ * 각 스레드가 자기 카운터만 증가시키므로(단일 writer, relaxed) 핫패스에 잠금이 없다.
+ * 조회(SnapshotStats)는 등록된 모든 스레드 + 종료된 스레드 누적을 합친다.
+ *
+ * 항상 세는 값: 컨버전 요청, 파싱 횟수/입력 바이트, 상태 경로 길이, Tree-sitter 할당, 세션 캐시 결과,
+ *               복구 상한 발동
+ * 상세 모드(SetStatsDetail)에서만 세는 값: 렉싱된 토큰, shift/reduce, 오류 복구 단계
+ *   → 파서에 로거를 붙여야 하므로(Tree-sitter가 메시지를 포맷한다) 기본은 꺼 둔다.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "tree_sitter/api.h"
+
+enum class Stat : uint32_t {
+    Conversions,      // 상태 경로 요청
+    Parses,           // Tree-sitter 파싱 호출 (증분/컨버전 포함)
+    BytesParsed,      // 파서에 넘긴 입력 바이트
+    TokensLexed,      // 상세
+    ParseActions,     // 상세: shift + reduce
+    RecoverySteps,    // 상세: 오류 복구/토큰 건너뛰기
+    RecoveryCapped,   // 복구 상한(RecoveryLimit)에 걸려 정상 접두사로 다시 컨버전
+    StatePathStates,  // 상태 경로 길이 합
+    StatePathMax,     // 상태 경로 최대 길이
+    Allocations,      // Tree-sitter 할당 호출 (계수 할당자 설치 시)
+    AllocatedBytes,
+    SessionHits,      // 같은 버전의 세션으로 응답
+    SessionMisses,    // 세션 없음/버전 불일치
+    SessionRebuilds,  // 축출된 세션 재파싱
+    kCount
+};
+
+extern const char *const kStatNames[static_cast<uint32_t>(Stat::kCount)];
+
+void CountStat(Stat stat, uint64_t amount = 1);
+void MaxStat(Stat stat, uint64_t value);
+
+// 상태 경로 하나를 기록 (Conversions, StatePathStates, StatePathMax)
+void CountStatePath(uint32_t length);
+
+// 모든 스레드 합 (StatePathMax는 최대)
+void SnapshotStats(uint64_t out[static_cast<uint32_t>(Stat::kCount)]);
+void ResetStats();
+
+void SetStatsDetail(bool enabled);
+bool StatsDetail();
+// 상세 모드에 맞춰 파서의 계수 로거를 붙이거나 뗀다 (다른 로거가 붙어 있으면 건드리지 않는다)
+void SyncStatsLogger(TSParser *parser);
@@ -0,0 +1,78 @@
+/**
+ * @file engine_tuning.cc
+ * @brief tuning.json 읽기 (json_reader.h)
+ *
+ * 형식: { "recoveryLimit": { "maxVersions": N, "maxCost": N }, "lookaheadBytes": N, ... }
+ */
+
+#include "engine_tuning.h"
+
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "json_reader.h"
+
+namespace {
+
+uint32_t Clamp32(uint64_t value) {
+    return value > std::numeric_limits<uint32_t>::max() ? std::numeric_limits<uint32_t>::max()
+                                                        : static_cast<uint32_t>(value);
+}
+
+}  // namespace
+
+bool LoadEngineTuning(const std::string &path, EngineTuning &out, std::string &error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    return ParseEngineTuning(ss.str(), out, error);
+}
+
+bool ParseEngineTuning(const std::string &json, EngineTuning &out, std::string &error) {
+    JsonReader reader(json);
+    auto fail = [&](const char *what) {
+        error = std::string(what) + " at byte " + std::to_string(reader.offset());
+        return false;
+    };
+
+    EngineTuning tuning;
+    std::string field, limit_field;
+    uint64_t value = 0;
+    if (!reader.Consume('{')) return fail("expected '{'");
+    if (!reader.Peek('}')) {
+        do {
+            if (!reader.String(field) || !reader.Consume(':')) return fail("expected field");
+            if (field == "lookaheadBytes") {
+                if (!reader.Number(value)) return fail("expected lookaheadBytes number");
+                tuning.lookahead_bytes = Clamp32(value);
+            } else if (field == "recoveryLimit") {
+                if (!reader.Consume('{')) return fail("expected recoveryLimit object");
+                if (!reader.Peek('}')) {
+                    do {
+                        if (!reader.String(limit_field) || !reader.Consume(':')) return fail("expected field");
+                        if (limit_field == "maxVersions") {
+                            if (!reader.Number(value)) return fail("expected maxVersions number");
+                            tuning.recovery.max_versions = Clamp32(value);
+                        } else if (limit_field == "maxCost") {
+                            if (!reader.Number(value)) return fail("expected maxCost number");
+                            tuning.recovery.max_cost = Clamp32(value);
+                        } else if (!reader.Skip()) {
+                            return fail("bad value");
+                        }
+                    } while (reader.Consume(','));
+                }
+                if (!reader.Consume('}')) return fail("expected '}'");
+            } else if (!reader.Skip()) {
+                return fail("bad value");
+            }
+        } while (reader.Consume(','));
+    }
+    if (!reader.Consume('}')) return fail("expected '}'");
+    out = tuning;
+    return true;
+}
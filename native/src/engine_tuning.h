@@ -0,0 +1,31 @@
+/**
+ * @file engine_tuning.h
+ * @brief 언어별 엔진 튜닝 프로파일 (resources/<lang>/tuning.json, bench/autotune.py가 생성)
+ *
+ * 문법마다 상태 수, 외부 스캐너 비용, 깨진 코드에서의 복구 양상이 달라 하나의 기본값이 맞지 않는다.
+ * 프로파일이 정하는 값
+ *   - recoveryLimit.maxVersions / maxCost: 컨버전 오류 복구 상한 (recovery_limit.h)
+ *   - lookaheadBytes: 모드 2에서 커서 뒤로 파서에 넘길 바이트 수 (0이면 문서 끝까지)
+ * 없는 필드는 기본값(모두 끔)이고, 모르는 필드(measured 등 측정 기록)는 건너뛴다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "recovery_limit.h"
+
+struct EngineTuning {
+    RecoveryLimit recovery;
+    uint32_t lookahead_bytes = 0;
+};
+
+// 모드 2 파싱 끝 바이트: 커서 + lookahead 창 (창이 0이거나 문서 끝을 넘으면 문서 끝)
+inline uint32_t LookaheadEnd(uint32_t cursor, uint32_t length, uint32_t lookahead_bytes) {
+    if (lookahead_bytes == 0 || length - cursor <= lookahead_bytes) return length;
+    return cursor + lookahead_bytes;
+}
+
+bool LoadEngineTuning(const std::string &path, EngineTuning &out, std::string &error);
+bool ParseEngineTuning(const std::string &json, EngineTuning &out, std::string &error);
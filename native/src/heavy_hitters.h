@@ -0,0 +1,106 @@
+/**
+ * @file heavy_hitters.h
+ * @brief 유한 메모리 빈도 스케치 (Misra-Gries heavy-hitter summary)
+ *
+ * 대용량 코퍼스에서 (state, candidate) 빈도를 정확한 해시맵 대신 상태별로 고정 크기
+ * 요약에 누적한다. 카운터 수가 k일 때 항목의 실제 빈도 f와 추정치 c 사이에는
+ *     c <= f <= c + decremented()  이고  decremented() <= N / (k + 1)
+ * 가 성립한다 (N = 해당 스케치에 들어온 총 빈도).
+ * 두 요약의 병합(Merge)도 같은 오차 한계를 유지한다 (Agarwal et al., Mergeable Summaries).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+template <typename Key, typename Hash = std::hash<Key>>
+class HeavyHitterSketch {
+public:
+    struct Entry {
+        Key key;
+        uint64_t count;  // 하한 추정치 (실제 빈도 이하)
+    };
+
+    explicit HeavyHitterSketch(size_t capacity = 256)
+        : capacity_(capacity == 0 ? 1 : capacity) {
+        counters_.reserve(capacity_ + 1);
+    }
+
+    // 항목 하나를 weight만큼 관측
+    void Offer(const Key &key, uint64_t weight = 1) {
+        total_ += weight;
+        auto it = counters_.find(key);
+        if (it != counters_.end()) {
+            it->second += weight;
+            return;
+        }
+        counters_.emplace(key, weight);
+        if (counters_.size() > capacity_) {
+            Shrink();
+        }
+    }
+
+    // 다른 스레드의 요약을 합친다. 합산 후 (k+1)번째 큰 값을 모두에서 빼고 0 이하는 버린다.
+    void Merge(const HeavyHitterSketch &other) {
+        total_ += other.total_;
+        decremented_ += other.decremented_;
+        for (const auto &kv : other.counters_) {
+            counters_[kv.first] += kv.second;
+        }
+        if (counters_.size() > capacity_) {
+            Shrink();
+        }
+    }
+
+    // 빈도 내림차순 상위 n개 (동률은 키 순서로 안정화)
+    std::vector<Entry> Top(size_t n) const {
+        std::vector<Entry> out;
+        out.reserve(counters_.size());
+        for (const auto &kv : counters_) {
+            out.push_back({kv.first, kv.second});
+        }
+        std::sort(out.begin(), out.end(), [](const Entry &a, const Entry &b) {
+            return a.count != b.count ? a.count > b.count : a.key < b.key;
+        });
+        if (out.size() > n) out.resize(n);
+        return out;
+    }
+
+    uint64_t total() const { return total_; }
+    size_t capacity() const { return capacity_; }
+    size_t size() const { return counters_.size(); }
+
+    // 모든 추정치에 공통으로 적용되는 과소추정 상한 (c <= f <= c + decremented)
+    uint64_t decremented() const { return decremented_; }
+
+private:
+    // capacity_를 넘으면 (capacity_+1)번째 큰 값만큼 일괄 감소.
+    // 감소량은 매번 새로 들어온 빈도가 지불하므로 분할상환 O(1)이다.
+    void Shrink() {
+        std::vector<uint64_t> values;
+        values.reserve(counters_.size());
+        for (const auto &kv : counters_) values.push_back(kv.second);
+        std::nth_element(values.begin(), values.begin() + capacity_, values.end(),
+                         std::greater<uint64_t>());
+        const uint64_t cut = values[capacity_];
+
+        decremented_ += cut;
+        for (auto it = counters_.begin(); it != counters_.end();) {
+            if (it->second <= cut) {
+                it = counters_.erase(it);
+            } else {
+                it->second -= cut;
+                ++it;
+            }
+        }
+    }
+
+    size_t capacity_;
+    uint64_t total_ = 0;
+    uint64_t decremented_ = 0;
+    std::unordered_map<Key, uint64_t, Hash> counters_;
+};
@@ -0,0 +1,263 @@
+/**
+ * @file identifier_index.cc
+ * @brief IdentifierIndex 구현
+ */
+
+#include "identifier_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// 조회 때 커서 앞뒤로 거리 항을 정확히 구하는 창. 창 밖의 거리 항(2 / (1 + d/512))은 0.06 미만이라 0으로 둔다
+constexpr uint32_t kNearWindow = 16 * 1024;
+// 스코프 항을 보는 범위 (클래스처럼 큰 스코프도 커서 주변만 본다)
+constexpr uint32_t kScopeWindow = 64 * 1024;
+
+// 분류 구간의 두 번째 이후 토큰
+bool InsideRun(uint8_t flags) {
+    return TokenStream::Class(flags) != SymbolClass::Other && !(flags & TokenStream::kClassStart);
+}
+
+bool KindMatches(SymbolClass wanted, SymbolClass actual) {
+    if (wanted == SymbolClass::Identifier) {
+        return actual == SymbolClass::Identifier || actual == SymbolClass::Member;
+    }
+    return wanted == actual;
+}
+
+}  // namespace
+
+uint32_t IdentifierIndex::Intern(const std::string &name) {
+    auto it = name_ids_.find(name);
+    if (it != name_ids_.end()) return it->second;
+    const uint32_t id = static_cast<uint32_t>(names_.size());
+    names_.push_back(name);
+    name_ids_.emplace(name, id);
+    return id;
+}
+
+// [start, end)와 겹치는 토큰을 감싼 분류 구간을 통째로 읽는다 (구간 밖으로 걸친 것은 앞뒤로 넓혀서).
+// 분류 구간 하나 = 분류 노드 하나 (예: string 리터럴은 따옴표까지 한 출현)
+std::pair<uint32_t, uint32_t> IdentifierIndex::Collect(const TokenStream &tokens, uint32_t start, uint32_t end,
+                                                       const std::string &text, std::vector<Occurrence> &out) {
+    size_t first, last;
+    tokens.Range(start, end, first, last);
+    const uint8_t *flags = tokens.flags();
+    // 구간 앞에 걸친 분류 구간은 그 첫 토큰부터
+    while (first < last && first > 0 && InsideRun(flags[first])) first--;
+
+    std::pair<uint32_t, uint32_t> covered(start, end);
+    for (size_t i = first; i < last;) {
+        const SymbolClass kind = TokenStream::Class(flags[i]);
+        if (kind == SymbolClass::Other || !(flags[i] & TokenStream::kClassStart)) {
+            i++;
+            continue;
+        }
+        // 뒤에 걸친 분류 구간도 끝까지 읽는다
+        size_t j = i + 1;
+        while (j < tokens.size() && InsideRun(flags[j])) j++;
+        const uint32_t run_start = tokens.starts()[i];
+        const uint32_t run_end = tokens.starts()[j - 1] + tokens.lengths()[j - 1];
+        if (run_end <= text.size()) {
+            const uint32_t id = Intern(text.substr(run_start, run_end - run_start));
+            out.push_back({run_start, run_end, id, kind, ++clock_});
+        }
+        covered.first = std::min(covered.first, run_start);
+        covered.second = std::max(covered.second, run_end);
+        i = j;
+    }
+    return covered;
+}
+
+void IdentifierIndex::Add(const Occurrence &occ) {
+    std::vector<NameStat> &stats = stats_[static_cast<size_t>(occ.kind)];
+    if (stats.size() <= occ.name_id) stats.resize(names_.size());
+    NameStat &s = stats[occ.name_id];
+    s.count++;
+    s.last_seq = std::max(s.last_seq, occ.seq);
+}
+
+void IdentifierIndex::Remove(const Occurrence &occ) {
+    NameStat &s = stats_[static_cast<size_t>(occ.kind)][occ.name_id];
+    if (--s.count == 0) s.last_seq = 0;
+}
+
+void IdentifierIndex::Rebuild(const TokenStream &tokens, const std::string &text) {
+    occurrences_.clear();
+    for (auto &stats : stats_) stats.clear();
+    Collect(tokens, 0, std::numeric_limits<uint32_t>::max(), text, occurrences_);
+    for (const Occurrence &occ : occurrences_) Add(occ);
+}
+
+void IdentifierIndex::Clear() {
+    std::vector<Occurrence>().swap(occurrences_);
+    std::vector<std::string>().swap(names_);
+    std::unordered_map<std::string, uint32_t>().swap(name_ids_);
+    for (auto &stats : stats_) std::vector<NameStat>().swap(stats);
+}
+
+size_t IdentifierIndex::MemoryBytes() const {
+    size_t bytes = occurrences_.capacity() * sizeof(Occurrence);
+    for (const auto &stats : stats_) bytes += stats.capacity() * sizeof(NameStat);
+    for (const std::string &name : names_) bytes += sizeof(std::string) + name.capacity();
+    bytes += name_ids_.size() * (sizeof(std::string) + sizeof(uint32_t) + 2 * sizeof(void *));
+    return bytes;
+}
+
+void IdentifierIndex::Update(const TSInputEdit &edit, const TSRange *ranges, uint32_t range_count,
+                             const TokenStream &tokens, const std::string &text) {
+    if (tokens.size() == 0) {  // 트리가 없으면 토큰열도 비어 있다
+        occurrences_.clear();
+        for (auto &stats : stats_) stats.clear();
+        return;
+    }
+
+    // 1) 편집 구간과 겹친 출현은 버리고, 뒤쪽 출현은 바이트 차이만큼 이동
+    const int64_t delta = static_cast<int64_t>(edit.new_end_byte) - static_cast<int64_t>(edit.old_end_byte);
+    size_t write = 0;
+    for (size_t read = 0; read < occurrences_.size(); read++) {
+        Occurrence occ = occurrences_[read];
+        if (occ.end_byte <= edit.start_byte) {
+            // 편집 앞쪽: 그대로
+        } else if (occ.start_byte >= edit.old_end_byte) {
+            occ.start_byte = static_cast<uint32_t>(occ.start_byte + delta);
+            occ.end_byte = static_cast<uint32_t>(occ.end_byte + delta);
+        } else {
+            Remove(occ);
+            continue;
+        }
+        occurrences_[write++] = occ;
+    }
+    occurrences_.resize(write);
+
+    // 2) 다시 수집할 구간: 편집 구간 + 변경 구간. 인접 토큰이 합쳐지는 경우를 위해 1바이트씩 넓힌다.
+    std::vector<std::pair<uint32_t, uint32_t>> dirty;
+    dirty.emplace_back(edit.start_byte, edit.new_end_byte);
+    for (uint32_t i = 0; i < range_count; i++) {
+        dirty.emplace_back(ranges[i].start_byte, ranges[i].end_byte);
+    }
+    for (auto &d : dirty) {
+        d.first = d.first > 0 ? d.first - 1 : 0;
+        d.second = d.second + 1;
+    }
+    std::sort(dirty.begin(), dirty.end());
+    std::vector<std::pair<uint32_t, uint32_t>> merged;
+    for (const auto &d : dirty) {
+        if (!merged.empty() && d.first <= merged.back().second) {
+            merged.back().second = std::max(merged.back().second, d.second);
+        } else {
+            merged.push_back(d);
+        }
+    }
+
+    // 출현끼리는 겹치지 않으므로 start/end 모두 정렬되어 있고, 구간과 겹치는 출현은 연속 구간이다
+    std::vector<Occurrence> fresh;
+    for (const auto &range : merged) {
+        fresh.clear();
+        const std::pair<uint32_t, uint32_t> covered = Collect(tokens, range.first, range.second, text, fresh);
+
+        // 다시 읽은 분류 구간이 덮는 범위와 겹치는 출현만 교체 (경계에 걸친 출현도 새것으로)
+        auto first = std::lower_bound(occurrences_.begin(), occurrences_.end(), covered.first,
+            [](const Occurrence &o, uint32_t v) { return o.end_byte <= v; });
+        auto last = std::lower_bound(first, occurrences_.end(), covered.second,
+            [](const Occurrence &o, uint32_t v) { return o.start_byte < v; });
+        const size_t at = static_cast<size_t>(first - occurrences_.begin());
+        for (auto it = first; it != last; ++it) Remove(*it);
+        for (const Occurrence &occ : fresh) Add(occ);
+        occurrences_.erase(first, last);
+        occurrences_.insert(occurrences_.begin() + at, fresh.begin(), fresh.end());
+    }
+}
+
+std::vector<IdentifierSuggestion> IdentifierIndex::Query(const TSTree *tree, uint32_t byte_offset,
+                                                         SymbolClass kind, size_t limit) const {
+    // 커서를 감싸는 가장 안쪽 스코프(함수/메서드/클래스)
+    uint32_t scope_start = 0;
+    uint32_t scope_end = 0;
+    if (tree) {
+        TSNode node = ts_node_descendant_for_byte_range(ts_tree_root_node(tree), byte_offset, byte_offset);
+        while (!ts_node_is_null(node)) {
+            if (classifier_.IsScope(ts_node_symbol(node))) {
+                scope_start = ts_node_start_byte(node);
+                scope_end = ts_node_end_byte(node);
+                break;
+            }
+            node = ts_node_parent(node);
+        }
+    }
+
+    // 1) 커서 주변 출현만 훑어 거리/스코프 항을 구한다 (출현은 start_byte 오름차순)
+    struct Local {
+        uint32_t nearest = std::numeric_limits<uint32_t>::max();
+        bool in_scope = false;
+        uint32_t under_cursor = 0;  // 커서 위치에서 입력 중인 단어 자신 (빈도에서 뺀다)
+    };
+    std::unordered_map<uint32_t, Local> local;
+    auto before = [byte_offset](uint32_t n) { return byte_offset - std::min(byte_offset, n); };
+    auto after = [byte_offset](uint32_t n) { return byte_offset + std::min(UINT32_MAX - byte_offset, n); };
+    uint32_t lo = before(kNearWindow);
+    uint32_t hi = after(kNearWindow);
+    if (scope_end > scope_start) {
+        lo = std::min(lo, std::max(scope_start, before(kScopeWindow)));
+        hi = std::max(hi, std::min(scope_end, after(kScopeWindow)));
+    }
+    auto it = std::lower_bound(occurrences_.begin(), occurrences_.end(), lo,
+        [](const Occurrence &o, uint32_t v) { return o.end_byte <= v; });
+    for (; it != occurrences_.end() && it->start_byte < hi; ++it) {
+        const Occurrence &occ = *it;
+        if (!KindMatches(kind, occ.kind)) continue;
+        Local &l = local[occ.name_id];
+        if (occ.start_byte <= byte_offset && byte_offset <= occ.end_byte) {
+            l.under_cursor++;
+            continue;
+        }
+        const uint32_t distance = occ.start_byte > byte_offset ? occ.start_byte - byte_offset
+                                                               : byte_offset - occ.end_byte;
+        if (distance <= kNearWindow) l.nearest = std::min(l.nearest, distance);
+        l.in_scope = l.in_scope || (scope_end > scope_start && occ.start_byte >= scope_start &&
+                                    occ.end_byte <= scope_end);
+    }
+
+    // 2) 이름별 집계 (Identifier 조회는 Member 집계도 합친다)
+    struct Stat {
+        uint32_t count = 0;
+        uint64_t last_seq = 0;
+        SymbolClass kind = SymbolClass::Other;
+    };
+    auto stat_of = [&](uint32_t id) {
+        Stat s;
+        for (SymbolClass k : {SymbolClass::Identifier, SymbolClass::Member, SymbolClass::Literal}) {
+            if (!KindMatches(kind, k)) continue;
+            const std::vector<NameStat> &stats = stats_[static_cast<size_t>(k)];
+            if (id >= stats.size() || stats[id].count == 0) continue;
+            if (s.count == 0) s.kind = k;
+            s.count += stats[id].count;
+            s.last_seq = std::max(s.last_seq, stats[id].last_seq);
+        }
+        return s;
+    };
+
+    // 점수 = 빈도(로그) + 최근성 + 같은 스코프 + 커서와의 거리
+    std::vector<IdentifierSuggestion> out;
+    const double clock = clock_ > 0 ? static_cast<double>(clock_) : 1.0;
+    for (uint32_t id = 0; id < names_.size(); id++) {
+        Stat s = stat_of(id);
+        auto l = local.find(id);
+        const Local near = l != local.end() ? l->second : Local();
+        s.count -= std::min(s.count, near.under_cursor);
+        if (s.count == 0) continue;
+        const double score = std::log2(1.0 + s.count)
+            + 2.0 * (static_cast<double>(s.last_seq) / clock)
+            + (near.in_scope ? 1.5 : 0.0)
+            + (near.nearest <= kNearWindow ? 2.0 / (1.0 + near.nearest / 512.0) : 0.0);
+        out.push_back({names_[id], s.kind, score});
+    }
+    std::sort(out.begin(), out.end(), [](const IdentifierSuggestion &a, const IdentifierSuggestion &b) {
+        return a.score != b.score ? a.score > b.score : a.text < b.text;
+    });
+    if (out.size() > limit) out.resize(limit);
+    return out;
+}
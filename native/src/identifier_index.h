@@ -0,0 +1,89 @@
+/**
+ * @file identifier_index.h
+ * @brief 문서별 식별자/멤버/리터럴 색인 (세션 토큰열에서 증분 갱신)
+ *
+ * 구조 후보의 ID, identifier 같은 슬롯을 LLM 호출 없이 채우기 위한 색인이다.
+ * 출현은 세션 TokenStream의 분류 구간(kClassStart부터 같은 분류가 이어지는 토큰들)이므로 트리를 따로
+ * 훑지 않는다. 출현 위치를 시작 바이트 순으로 보관하고, 편집 시에는 (토큰열을 먼저 갱신한 뒤)
+ *   1) 편집 지점 뒤의 출현을 바이트 차이만큼 이동
+ *   2) 편집 구간 + ts_tree_get_changed_ranges 구간과 겹치는 분류 구간만 토큰열에서 다시 읽기
+ * 하므로 갱신 비용은 변경 범위에 비례한다.
+ *
+ * 다시 수집된 출현에는 새 시퀀스 번호를 붙여 "최근에 편집된 이름"을 우선한다.
+ *
+ * 조회가 출현 전체를 훑지 않도록 (분류, 이름)별 출현 수와 마지막 수집 시점을 출현을 넣고 뺄 때 함께
+ * 갱신한다. 조회는 이 집계(서로 다른 이름 수에 비례)와, 커서 주변 창 안의 출현(거리/스코프 항)만 본다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tree_sitter/api.h"
+#include "symbol_classes.h"
+#include "token_stream.h"
+
+struct IdentifierSuggestion {
+    std::string text;
+    SymbolClass kind;
+    double score;
+};
+
+class IdentifierIndex {
+public:
+    explicit IdentifierIndex(const SymbolClassifier &classifier) : classifier_(classifier) {}
+
+    // 토큰열 전체에서 다시 수집
+    void Rebuild(const TokenStream &tokens, const std::string &text);
+
+    // edit은 이미 적용된 편집, ranges는 새 트리 기준 변경 구간, tokens는 이미 갱신된 토큰열
+    void Update(const TSInputEdit &edit, const TSRange *ranges, uint32_t range_count,
+                const TokenStream &tokens, const std::string &text);
+
+    // byte_offset 위치에서 kind 슬롯을 채울 후보를 점수순으로 반환.
+    // kind == Identifier 이면 Member도 함께 본다.
+    std::vector<IdentifierSuggestion> Query(const TSTree *tree, uint32_t byte_offset,
+                                            SymbolClass kind, size_t limit) const;
+
+    size_t size() const { return occurrences_.size(); }
+
+    // 저장 공간까지 반환 (세션 축출)
+    void Clear();
+    // 대략적인 바이트 수 (해시 노드는 항목당 고정 비용으로 근사)
+    size_t MemoryBytes() const;
+
+private:
+    struct Occurrence {
+        uint32_t start_byte;
+        uint32_t end_byte;
+        uint32_t name_id;
+        SymbolClass kind;
+        uint64_t seq;  // 수집 시점 (클수록 최근)
+    };
+
+    // (분류, 이름)별 집계. last_seq는 이름이 남아 있는 동안 줄지 않는다 (지워진 출현의 수집 시점도 "최근 편집"으로 친다)
+    struct NameStat {
+        uint32_t count = 0;
+        uint64_t last_seq = 0;
+    };
+    static constexpr size_t kKinds = 4;  // SymbolClass 값 (Other는 쓰지 않음)
+
+    void Add(const Occurrence &occ);
+    void Remove(const Occurrence &occ);
+
+    // [start, end)와 겹치는 분류 구간. 반환: 읽은 구간이 덮는 바이트 범위 (start, end보다 넓을 수 있음)
+    std::pair<uint32_t, uint32_t> Collect(const TokenStream &tokens, uint32_t start, uint32_t end,
+                                          const std::string &text, std::vector<Occurrence> &out);
+    uint32_t Intern(const std::string &name);
+
+    const SymbolClassifier &classifier_;
+    std::vector<Occurrence> occurrences_;  // start_byte 오름차순
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, uint32_t> name_ids_;
+    std::vector<NameStat> stats_[kKinds];  // [kind][name_id]
+    uint64_t clock_ = 0;
+};
@@ -0,0 +1,148 @@
+/**
+ * @file json_reader.h
+ * @brief 리소스 JSON(candidates.json, tuning.json) 전용 최소 JSON 리더
+ *
+ * 값을 순서대로 꺼내는 커서일 뿐 DOM은 만들지 않는다. 관심 없는 값은 Skip()으로 건너뛴다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+class JsonReader {
+public:
+    explicit JsonReader(const std::string &text)
+        : p_(text.data()), begin_(text.data()), end_(text.data() + text.size()) {}
+
+    bool Consume(char c) {
+        SkipSpace();
+        if (p_ < end_ && *p_ == c) {
+            p_++;
+            return true;
+        }
+        return false;
+    }
+
+    bool Peek(char c) {
+        SkipSpace();
+        return p_ < end_ && *p_ == c;
+    }
+
+    bool String(std::string &out) {
+        out.clear();
+        if (!Consume('"')) return false;
+        while (p_ < end_ && *p_ != '"') {
+            char c = *p_++;
+            if (c != '\\') {
+                out.push_back(c);
+                continue;
+            }
+            if (p_ >= end_) return false;
+            c = *p_++;
+            switch (c) {
+                case 'n': out.push_back('\n'); break;
+                case 't': out.push_back('\t'); break;
+                case 'r': out.push_back('\r'); break;
+                case 'b': out.push_back('\b'); break;
+                case 'f': out.push_back('\f'); break;
+                case 'u': {
+                    uint32_t code = 0;
+                    if (!Hex4(code)) return false;
+                    // 서로게이트 쌍
+                    if (code >= 0xD800 && code < 0xDC00 && end_ - p_ >= 6 && p_[0] == '\\' && p_[1] == 'u') {
+                        p_ += 2;
+                        uint32_t low = 0;
+                        if (!Hex4(low)) return false;
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    AppendUtf8(code, out);
+                    break;
+                }
+                default: out.push_back(c); break;  // \" \\ \/
+            }
+        }
+        return Consume('"');
+    }
+
+    bool Number(uint64_t &out) {
+        SkipSpace();
+        char *stop = nullptr;
+        const double value = std::strtod(p_, &stop);
+        if (stop == p_) return false;
+        p_ = stop;
+        out = value > 0 ? static_cast<uint64_t>(value) : 0;
+        return true;
+    }
+
+    // 관심 없는 값 건너뛰기
+    bool Skip() {
+        SkipSpace();
+        if (p_ >= end_) return false;
+        if (*p_ == '"') {
+            std::string ignored;
+            return String(ignored);
+        }
+        if (*p_ == '{' || *p_ == '[') {
+            const char close = *p_ == '{' ? '}' : ']';
+            p_++;
+            if (Consume(close)) return true;
+            do {
+                if (close == '}') {
+                    std::string ignored;
+                    if (!String(ignored) || !Consume(':')) return false;
+                }
+                if (!Skip()) return false;
+            } while (Consume(','));
+            return Consume(close);
+        }
+        while (p_ < end_ && *p_ != ',' && *p_ != '}' && *p_ != ']' && !IsSpace(*p_)) p_++;
+        return true;
+    }
+
+    size_t offset() const { return static_cast<size_t>(p_ - begin_); }
+
+private:
+    static bool IsSpace(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+    void SkipSpace() {
+        while (p_ < end_ && IsSpace(*p_)) p_++;
+    }
+
+    bool Hex4(uint32_t &out) {
+        if (end_ - p_ < 4) return false;
+        out = 0;
+        for (int i = 0; i < 4; i++) {
+            const char c = *p_++;
+            out <<= 4;
+            if (c >= '0' && c <= '9') out |= c - '0';
+            else if (c >= 'a' && c <= 'f') out |= c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F') out |= c - 'A' + 10;
+            else return false;
+        }
+        return true;
+    }
+
+    static void AppendUtf8(uint32_t code, std::string &out) {
+        if (code < 0x80) {
+            out.push_back(static_cast<char>(code));
+        } else if (code < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else if (code < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+    }
+
+    const char *p_;
+    const char *begin_;
+    const char *end_;
+};
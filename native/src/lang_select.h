@@ -0,0 +1,43 @@
+/**
+ * @file lang_select.h
+ * @brief 빌드 타겟별 언어 선택 (LANG_* 매크로 → tree_sitter_<lang>() 바인딩)
+ *
+ * addon과 native/tools/의 CLI가 같은 블록을 공유한다.
+ * 아래 블록은 generate_build_config.py가 다시 생성하므로 직접 편집하지 않는다.
+ */
+
+#pragma once
+
+#include "tree_sitter/api.h"
+
+// 언어 정의 함수 — generate_build_config.py에 의해 자동 생성됨
+#if defined(LANG_C)
+    extern "C" TSLanguage *tree_sitter_c();
+    #define GET_LANGUAGE() tree_sitter_c()
+#elif defined(LANG_CPP)
+    extern "C" TSLanguage *tree_sitter_cpp();
+    #define GET_LANGUAGE() tree_sitter_cpp()
+#elif defined(LANG_HASKELL)
+    extern "C" TSLanguage *tree_sitter_haskell();
+    #define GET_LANGUAGE() tree_sitter_haskell()
+#elif defined(LANG_JAVA)
+    extern "C" TSLanguage *tree_sitter_java();
+    #define GET_LANGUAGE() tree_sitter_java()
+#elif defined(LANG_JAVASCRIPT)
+    extern "C" TSLanguage *tree_sitter_javascript();
+    #define GET_LANGUAGE() tree_sitter_javascript()
+#elif defined(LANG_PHP)
+    extern "C" TSLanguage *tree_sitter_php();
+    #define GET_LANGUAGE() tree_sitter_php()
+#elif defined(LANG_PYTHON)
+    extern "C" TSLanguage *tree_sitter_python();
+    #define GET_LANGUAGE() tree_sitter_python()
+#elif defined(LANG_RUBY)
+    extern "C" TSLanguage *tree_sitter_ruby();
+    #define GET_LANGUAGE() tree_sitter_ruby()
+#elif defined(LANG_SMALLBASIC)
+    extern "C" TSLanguage *tree_sitter_smallbasic();
+    #define GET_LANGUAGE() tree_sitter_smallbasic()
+#else
+    #error "언어 정의 없음: generate_build_config.py를 실행하세요."
+#endif
@@ -0,0 +1,273 @@
+/**
+ * @file line_index.cc
+ * @brief LineIndex 구현 — SIMD 청크 스캔 + 이진 탐색 변환
+ */
+
+#include "line_index.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LINE_INDEX_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define LINE_INDEX_NEON 1
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+
+// =============================================================================
+// [비트 연산] 16비트 마스크용
+// =============================================================================
+inline uint32_t PopCount(uint32_t x) {
+#ifdef _MSC_VER
+    return __popcnt(x);
+#else
+    return static_cast<uint32_t>(__builtin_popcount(x));
+#endif
+}
+
+inline uint32_t LowestBit(uint32_t x) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, x);
+    return index;
+#else
+    return static_cast<uint32_t>(__builtin_ctz(x));
+#endif
+}
+
+// =============================================================================
+// [청크 마스크] 16바이트마다 바이트 i의 성질을 비트 i로
+// =============================================================================
+struct ChunkMasks {
+    uint32_t newline;       // '\n'
+    uint32_t high;          // >= 0x80 (ASCII 아님)
+    uint32_t continuation;  // 10xxxxxx: UTF-16 유닛을 만들지 않음
+    uint32_t lead4;         // 11110xxx: 서로게이트 쌍 → UTF-16 유닛 2개
+};
+
+constexpr uint32_t kChunk = 16;
+
+#if defined(LINE_INDEX_SSE2)
+inline ChunkMasks ScanChunk(const unsigned char *p) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    ChunkMasks m;
+    m.newline = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))));
+    m.high = static_cast<uint32_t>(_mm_movemask_epi8(v));
+    // 부호 있는 비교: 0x80..0xBF = -128..-65, 0xF0..0xFF = -16..-1
+    m.continuation = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8(-64))));
+    m.lead4 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(v, _mm_set1_epi8(-17)))) & m.high;
+    return m;
+}
+#elif defined(LINE_INDEX_NEON)
+inline uint32_t MoveMask(uint8x16_t v) {
+    static const uint8_t kBits[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t masked = vandq_u8(v, vld1q_u8(kBits));
+    return static_cast<uint32_t>(vaddv_u8(vget_low_u8(masked))) |
+           (static_cast<uint32_t>(vaddv_u8(vget_high_u8(masked))) << 8);
+}
+
+inline ChunkMasks ScanChunk(const unsigned char *p) {
+    const uint8x16_t v = vld1q_u8(p);
+    ChunkMasks m;
+    m.newline = MoveMask(vceqq_u8(v, vdupq_n_u8('\n')));
+    m.high = MoveMask(vcgeq_u8(v, vdupq_n_u8(0x80)));
+    m.continuation = MoveMask(vceqq_u8(vandq_u8(v, vdupq_n_u8(0xC0)), vdupq_n_u8(0x80)));
+    m.lead4 = MoveMask(vcgeq_u8(v, vdupq_n_u8(0xF0)));
+    return m;
+}
+#else
+inline ChunkMasks ScanChunk(const unsigned char *p) {
+    ChunkMasks m = {0, 0, 0, 0};
+    for (uint32_t i = 0; i < kChunk; i++) {
+        const unsigned char c = p[i];
+        if (c == '\n') m.newline |= 1u << i;
+        if (c >= 0x80) m.high |= 1u << i;
+        if ((c & 0xC0) == 0x80) m.continuation |= 1u << i;
+        if (c >= 0xF0) m.lead4 |= 1u << i;
+    }
+    return m;
+}
+#endif
+
+inline uint32_t Utf8Length(unsigned char c) {
+    if (c < 0x80) return 1;
+    if ((c >> 5) == 0x6) return 2;
+    if ((c >> 4) == 0xE) return 3;
+    return 4;
+}
+
+struct ScanState {
+    uint32_t units;  // 지금까지의 UTF-16 오프셋
+    bool ascii;      // 현재 줄이 지금까지 ASCII뿐인지
+};
+
+struct LineEntries {
+    std::vector<uint32_t> starts;
+    std::vector<uint32_t> utf16;
+    std::vector<uint8_t> ascii;  // 개행으로 끝난 줄마다 하나
+};
+
+// [begin, end)를 훑으며 개행마다 (다음 줄 시작, 그 UTF-16 오프셋, 끝난 줄의 ASCII 여부)를 덧붙인다
+ScanState Scan(const unsigned char *data, uint32_t begin, uint32_t end, ScanState state, LineEntries &out) {
+    uint32_t i = begin;
+    for (; i + kChunk <= end; i += kChunk) {
+        const ChunkMasks m = ScanChunk(data + i);
+        uint32_t newlines = m.newline;
+        uint32_t from = 0;  // 청크 안에서 현재 줄이 시작하는 비트
+        while (newlines) {
+            const uint32_t bit = LowestBit(newlines);
+            const uint32_t segment = ((bit == 31 ? 0xFFFFFFFFu : (2u << bit) - 1)) & ~((1u << from) - 1);
+            state.units += (bit + 1 - from) - PopCount(m.continuation & segment) + PopCount(m.lead4 & segment);
+            state.ascii = state.ascii && !(m.high & segment);
+            out.ascii.push_back(state.ascii ? 1 : 0);
+            out.starts.push_back(i + bit + 1);
+            out.utf16.push_back(state.units);
+            state.ascii = true;
+            from = bit + 1;
+            newlines &= newlines - 1;
+        }
+        const uint32_t rest = 0xFFFFu & ~((1u << from) - 1);
+        state.units += (kChunk - from) - PopCount(m.continuation & rest) + PopCount(m.lead4 & rest);
+        state.ascii = state.ascii && !(m.high & rest);
+    }
+    for (; i < end; i++) {
+        const unsigned char c = data[i];
+        if ((c & 0xC0) != 0x80) state.units += c >= 0xF0 ? 2 : 1;
+        if (c >= 0x80) state.ascii = false;
+        if (c == '\n') {
+            out.ascii.push_back(state.ascii ? 1 : 0);
+            out.starts.push_back(i + 1);
+            out.utf16.push_back(state.units);
+            state.ascii = true;
+        }
+    }
+    return state;
+}
+
+}  // namespace
+
+// =============================================================================
+// [구축 / 갱신]
+// =============================================================================
+void LineIndex::Build(const std::string &text) {
+    LineEntries entries;
+    entries.starts.push_back(0);
+    entries.utf16.push_back(0);
+    const ScanState state = Scan(reinterpret_cast<const unsigned char *>(text.data()), 0,
+                                 static_cast<uint32_t>(text.size()), {0, true}, entries);
+    entries.ascii.push_back(state.ascii ? 1 : 0);
+    line_starts_ = std::move(entries.starts);
+    utf16_starts_ = std::move(entries.utf16);
+    ascii_ = std::move(entries.ascii);
+}
+
+void LineIndex::ApplyEdit(const std::string &text, uint32_t start, uint32_t old_end, uint32_t new_end) {
+    if (line_starts_.empty()) {
+        Build(text);
+        return;
+    }
+    const int64_t delta = static_cast<int64_t>(new_end) - static_cast<int64_t>(old_end);
+    const uint32_t first = LineOf(start);
+
+    // 개행이 [start, old_end) 안에 있던 줄 시작 (start, old_end]는 사라지고,
+    // old_end 뒤에서 시작하는 첫 줄부터는 내용이 그대로다
+    const size_t tail = static_cast<size_t>(
+        std::upper_bound(line_starts_.begin(), line_starts_.end(), old_end) - line_starts_.begin());
+    const bool has_tail = tail < line_starts_.size();
+    const uint32_t scan_end = has_tail ? static_cast<uint32_t>(line_starts_[tail] + delta)
+                                       : static_cast<uint32_t>(text.size());
+
+    LineEntries entries;
+    const ScanState state = Scan(reinterpret_cast<const unsigned char *>(text.data()), line_starts_[first],
+                                 scan_end, {utf16_starts_[first], true}, entries);
+    if (!has_tail) entries.ascii.push_back(state.ascii ? 1 : 0);
+
+    // has_tail이면 entries의 마지막 항목이 바뀌지 않은 첫 줄(tail)을 다시 만든 것
+    const int64_t delta16 = has_tail
+        ? static_cast<int64_t>(entries.utf16.back()) - static_cast<int64_t>(utf16_starts_[tail])
+        : 0;
+    const size_t replace_end = has_tail ? tail + 1 : line_starts_.size();
+
+    line_starts_.erase(line_starts_.begin() + first + 1, line_starts_.begin() + replace_end);
+    line_starts_.insert(line_starts_.begin() + first + 1, entries.starts.begin(), entries.starts.end());
+    utf16_starts_.erase(utf16_starts_.begin() + first + 1, utf16_starts_.begin() + replace_end);
+    utf16_starts_.insert(utf16_starts_.begin() + first + 1, entries.utf16.begin(), entries.utf16.end());
+    ascii_.erase(ascii_.begin() + first, ascii_.begin() + (has_tail ? tail : ascii_.size()));
+    ascii_.insert(ascii_.begin() + first, entries.ascii.begin(), entries.ascii.end());
+
+    for (size_t i = first + 1 + entries.starts.size(); i < line_starts_.size(); i++) {
+        line_starts_[i] = static_cast<uint32_t>(line_starts_[i] + delta);
+        utf16_starts_[i] = static_cast<uint32_t>(utf16_starts_[i] + delta16);
+    }
+}
+
+// =============================================================================
+// [변환]
+// =============================================================================
+uint32_t LineIndex::LineOf(uint32_t byte) const {
+    auto it = std::upper_bound(line_starts_.begin(), line_starts_.end(), byte);
+    return it == line_starts_.begin() ? 0 : static_cast<uint32_t>(it - line_starts_.begin() - 1);
+}
+
+// 줄 끝 (개행 문자 위치, 마지막 줄은 텍스트 끝)
+uint32_t LineIndex::LineEnd(const std::string &text, uint32_t line) const {
+    return line + 1 < line_starts_.size() ? line_starts_[line + 1] - 1 : static_cast<uint32_t>(text.size());
+}
+
+TSPoint LineIndex::PointForByte(uint32_t byte) const {
+    if (line_starts_.empty()) return {0, byte};
+    const uint32_t line = LineOf(byte);
+    return {line, byte - line_starts_[line]};
+}
+
+uint32_t LineIndex::Utf16ForByte(const std::string &text, uint32_t byte) const {
+    if (line_starts_.empty()) return 0;
+    byte = std::min<uint32_t>(byte, static_cast<uint32_t>(text.size()));
+    const uint32_t line = LineOf(byte);
+    uint32_t units = utf16_starts_[line];
+    if (ascii_[line]) return units + (byte - line_starts_[line]);
+    for (uint32_t i = line_starts_[line]; i < byte; i++) {
+        const unsigned char c = static_cast<unsigned char>(text[i]);
+        if ((c & 0xC0) != 0x80) units += c >= 0xF0 ? 2 : 1;
+    }
+    return units;
+}
+
+uint32_t LineIndex::ByteForUtf16(const std::string &text, uint32_t utf16_offset) const {
+    if (line_starts_.empty()) return 0;
+    auto it = std::upper_bound(utf16_starts_.begin(), utf16_starts_.end(), utf16_offset);
+    const uint32_t line = it == utf16_starts_.begin() ? 0 : static_cast<uint32_t>(it - utf16_starts_.begin() - 1);
+    const uint32_t line_end = line + 1 < line_starts_.size() ? line_starts_[line + 1] : static_cast<uint32_t>(text.size());
+    const uint32_t wanted = utf16_offset - utf16_starts_[line];
+    if (ascii_[line]) return std::min(line_starts_[line] + wanted, line_end);
+
+    uint32_t i = line_starts_[line];
+    uint32_t units = 0;
+    while (i < line_end && units < wanted) {
+        const uint32_t length = Utf8Length(static_cast<unsigned char>(text[i]));
+        units += length == 4 ? 2 : 1;
+        i += length;
+    }
+    return std::min(i, line_end);
+}
+
+uint32_t LineIndex::ByteForPosition(const std::string &text, uint32_t line, uint32_t character) const {
+    if (line_starts_.empty()) return 0;
+    if (line >= line_starts_.size()) return static_cast<uint32_t>(text.size());
+    const uint32_t line_end = LineEnd(text, line);
+    if (ascii_[line]) return std::min(line_starts_[line] + character, line_end);
+    return std::min(ByteForUtf16(text, utf16_starts_[line] + character), line_end);
+}
+
+LineIndex::Position LineIndex::PositionForByte(const std::string &text, uint32_t byte) const {
+    if (line_starts_.empty()) return {0, 0};
+    const uint32_t line = LineOf(std::min<uint32_t>(byte, static_cast<uint32_t>(text.size())));
+    return {line, Utf16ForByte(text, byte) - utf16_starts_[line]};
+}
@@ -0,0 +1,56 @@
+/**
+ * @file line_index.h
+ * @brief 문서별 줄 시작 색인 (바이트 ↔ 줄/열, UTF-16 ↔ UTF-8 변환)
+ *
+ * 줄마다 (시작 바이트, 시작 UTF-16 오프셋, ASCII 전용 여부)를 보관한다.
+ *   - 변환은 이진 탐색 O(log n). ASCII 전용 줄은 산술로 끝나고,
+ *     아닌 줄만 그 줄 안에서 UTF-8을 훑는다.
+ *   - 구축/갱신 스캔은 16바이트 단위 SIMD(SSE2 / AArch64 NEON, 없으면 스칼라)로
+ *     개행, 연속 바이트(10xxxxxx), 4바이트 선두(11110xxx) 마스크를 한 번에 만든다.
+ *   - 편집 시에는 편집이 걸친 줄만 다시 훑고 뒤쪽 줄은 바이트/UTF-16 차이만큼 이동한다.
+ *
+ * VS Code의 Position.character와 rangeOffset은 UTF-16 단위,
+ * Tree-sitter의 TSPoint.column은 바이트 단위다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tree_sitter/api.h"
+
+class LineIndex {
+public:
+    struct Position {
+        uint32_t line;
+        uint32_t character;  // UTF-16 단위
+    };
+
+    void Build(const std::string &text);
+
+    // text는 편집이 이미 적용된 전체 텍스트. [start, old_end) 바이트가 [start, new_end)로 바뀌었다.
+    void ApplyEdit(const std::string &text, uint32_t start, uint32_t old_end, uint32_t new_end);
+
+    uint32_t line_count() const { return static_cast<uint32_t>(line_starts_.size()); }
+    uint32_t LineOf(uint32_t byte) const;
+
+    TSPoint PointForByte(uint32_t byte) const;
+    uint32_t ByteForUtf16(const std::string &text, uint32_t utf16_offset) const;
+    uint32_t Utf16ForByte(const std::string &text, uint32_t byte) const;
+    uint32_t ByteForPosition(const std::string &text, uint32_t line, uint32_t character) const;
+    Position PositionForByte(const std::string &text, uint32_t byte) const;
+
+    size_t MemoryBytes() const {
+        return line_starts_.capacity() * sizeof(uint32_t) + utf16_starts_.capacity() * sizeof(uint32_t) +
+               ascii_.capacity();
+    }
+
+private:
+    uint32_t LineEnd(const std::string &text, uint32_t line) const;
+
+    std::vector<uint32_t> line_starts_;   // 바이트
+    std::vector<uint32_t> utf16_starts_;  // UTF-16 코드 유닛
+    std::vector<uint8_t> ascii_;          // 줄 전체가 ASCII면 1
+};
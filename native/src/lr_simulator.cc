@@ -0,0 +1,104 @@
+/**
+ * @file lr_simulator.cc
+ * @brief LrSimulator 구현 — ts_language_table_entry / ts_language_next_state 기반
+ */
+
+#include "lr_simulator.h"
+
+#include "parse_table.h"
+
+namespace {
+
+// 한 lookahead에 대해 연쇄 reduce가 이보다 길면 테이블 이상으로 보고 거부
+constexpr int kMaxReduceChain = 512;
+
+}  // namespace
+
+LrSimulator::LrSimulator(const TSLanguage *language) : language_(language) {}
+
+bool LrSimulator::MatchesLanguage(const TSLanguage *language) {
+    // token_count는 공개 API가 없어 parser.h의 구조체에서 읽는다
+    return ts_language_state_count(language) == lang_constants::kStateCount &&
+           ts_language_symbol_count(language) == lang_constants::kSymbolCount &&
+           language->token_count == lang_constants::kTokenCount;
+}
+
+void LrSimulator::Reset(const TSStateId *states, uint32_t count) {
+    stack_.Assign(states, count);
+    base_depth_ = stack_.size();
+    fed_ = 0;
+}
+
+LrSimulator::Outcome LrSimulator::Step(StateStack &stack, TSSymbol terminal, size_t &min_depth) const {
+    for (int guard = 0; guard < kMaxReduceChain && !stack.empty(); guard++) {
+        TableEntry entry;
+        ts_language_table_entry(language_, stack.back(), terminal, &entry);
+        if (entry.action_count == 0) return Outcome::Rejected;
+
+        const TSParseAction *action = &entry.actions[0];
+        for (uint32_t i = 0; i < entry.action_count; i++) {
+            if (entry.actions[i].type == TSParseActionTypeShift) {
+                action = &entry.actions[i];
+                break;
+            }
+        }
+
+        switch (action->type) {
+            case TSParseActionTypeShift:
+                // extra 토큰(주석 등)은 스택에 쌓이지 않는다
+                if (!action->shift.extra && !stack.Push(action->shift.state)) return Outcome::Rejected;
+                return Outcome::Shifted;
+            case TSParseActionTypeReduce: {
+                const uint32_t count = action->reduce.child_count;
+                if (count >= stack.size()) return Outcome::Rejected;
+                stack.Pop(count);
+                if (stack.size() < min_depth) min_depth = stack.size();
+                const TSStateId next = ts_language_next_state(language_, stack.back(), action->reduce.symbol);
+                if (next == 0) return Outcome::Rejected;
+                if (!stack.Push(next)) return Outcome::Rejected;  // 빈 reduce(child_count 0)는 한 칸 늘어난다
+                break;
+            }
+            case TSParseActionTypeAccept:
+                return Outcome::Accepted;
+            default:
+                return Outcome::Rejected;
+        }
+    }
+    return Outcome::Rejected;
+}
+
+bool LrSimulator::Feed(TSSymbol terminal) {
+    StateStack next = stack_;
+    size_t min_depth = next.size();
+    if (Step(next, terminal, min_depth) != Outcome::Shifted) return false;
+    stack_ = next;
+    fed_++;
+    return true;
+}
+
+bool LrSimulator::Accepts(TSSymbol terminal) const {
+    StateStack scratch = stack_;
+    size_t min_depth = scratch.size();
+    return Step(scratch, terminal, min_depth) != Outcome::Rejected;
+}
+
+bool LrSimulator::Allowed(std::vector<TSSymbol> &out) const {
+    out.clear();
+    if (stack_.empty()) return false;
+    bool complete = false;
+    StateStack scratch;
+    for (uint32_t t = 0; t < token_count(); t++) {
+        const TSSymbol terminal = static_cast<TSSymbol>(t);
+        TableEntry entry;
+        ts_language_table_entry(language_, stack_.back(), terminal, &entry);
+        if (entry.action_count == 0) continue;
+
+        scratch = stack_;
+        size_t min_depth = scratch.size();
+        const Outcome outcome = Step(scratch, terminal, min_depth);
+        if (outcome == Outcome::Rejected) continue;
+        out.push_back(terminal);
+        if (outcome == Outcome::Accepted || min_depth < base_depth_) complete = true;
+    }
+    return complete && fed_ > 0;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file lr_simulator.h
+ * @brief 컨버전 상태 경로 위에서 단말을 하나씩 먹이며 LR 스택을 흉내내는 시뮬레이터
+ *
+ * 제약 디코딩용이다. 커서 위치의 상태 경로(스택 아래 → 위)를 시작점으로,
+ *   - Feed(t):        lookahead t로 reduce들을 적용한 뒤 shift (거부되면 스택 불변)
+ *   - Allowed():      지금 받아들일 수 있는 단말 목록
+ *   - complete:       단말을 하나 이상 먹인 뒤, 어떤 lookahead로든 시작 높이 아래까지
+ *                     reduce되면(커서가 속한 생성규칙이 닫힐 수 있으면) true
+ * 를 제공한다. 충돌 칸(GLR)은 shift를 우선하고 없으면 첫 reduce를 따른다.
+ *
+ * 스택은 문법별 고정 용량(lang_constants::kMaxStatePath) 배열이라 복사(빔 분기, Accepts/Allowed의
+ * 시험 적용)에 힙 할당이 없다. 시작 경로가 용량보다 길면 위쪽(커서 가까운) 상태만 남기고,
+ * shift가 용량을 넘으면 거부한다.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "tree_sitter/api.h"
+#include "generated/lang_constants.h"
+
+// 고정 용량 LR 스택 (스택 아래 → 위)
+class StateStack {
+public:
+    static constexpr uint32_t kCapacity = lang_constants::kMaxStatePath;
+
+    // 용량을 넘으면 위쪽 kCapacity개만 남긴다
+    void Assign(const TSStateId *states, uint32_t count) {
+        if (count > kCapacity) {
+            states += count - kCapacity;
+            count = kCapacity;
+        }
+        std::copy(states, states + count, states_);
+        size_ = count;
+    }
+    bool Push(TSStateId state) {
+        if (size_ == kCapacity) return false;
+        states_[size_++] = state;
+        return true;
+    }
+    void Pop(uint32_t count) { size_ -= count; }
+    TSStateId back() const { return states_[size_ - 1]; }
+    uint32_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    TSStateId states_[kCapacity];
+    uint32_t size_ = 0;
+};
+
+class LrSimulator {
+public:
+    explicit LrSimulator(const TSLanguage *language);
+
+    // 링크된 문법이 생성된 상수(상태/심볼/단말 수)와 같은지. 다르면 token_count()로 도는 루프와
+    // 고정 크기 테이블이 문법 테이블 밖을 읽으므로 시뮬레이터를 만들면 안 된다
+    static bool MatchesLanguage(const TSLanguage *language);
+
+    void Reset(const TSStateId *states, uint32_t count);
+
+    bool Feed(TSSymbol terminal);
+    bool Accepts(TSSymbol terminal) const;
+
+    // out: 받아들일 수 있는 단말 (심볼 ID 오름차순). 반환값: complete
+    bool Allowed(std::vector<TSSymbol> &out) const;
+
+    static constexpr uint32_t token_count() { return lang_constants::kTokenCount; }
+    size_t depth() const { return stack_.size(); }
+    uint32_t fed() const { return fed_; }
+    bool empty() const { return stack_.empty(); }
+
+private:
+    enum class Outcome { Rejected, Shifted, Accepted };
+
+    // stack을 제자리에서 갱신. min_depth는 reduce로 내려간 가장 낮은 높이.
+    Outcome Step(StateStack &stack, TSSymbol terminal, size_t &min_depth) const;
+
+    const TSLanguage *language_;
+    StateStack stack_;
+    size_t base_depth_ = 0;
+    uint32_t fed_ = 0;
+};
@@ -0,0 +1,109 @@
+/**
+ * @file memory_budget.cc
+ * @brief 크기 헤더를 붙이는 계수 할당자
+ */
+
+#include "memory_budget.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+
+#include "engine_stats.h"
+#include "tree_sitter/api.h"
+
+namespace {
+
+// 헤더 뒤의 사용자 영역 정렬을 malloc과 같게 유지
+constexpr size_t kHeader = alignof(std::max_align_t) > sizeof(size_t) ? alignof(std::max_align_t) : sizeof(size_t);
+
+std::atomic<size_t> g_allocated{0};
+std::atomic<size_t> g_peak{0};
+std::atomic<bool> g_installed{false};
+std::once_flag g_install_once;  // C ABI/파이썬 바인딩은 여러 스레드가 동시에 엔진을 만든다
+thread_local int64_t t_net = 0;
+
+void Grow(size_t bytes) {
+    CountStat(Stat::Allocations);
+    CountStat(Stat::AllocatedBytes, bytes);
+    t_net += static_cast<int64_t>(bytes);
+    const size_t now = g_allocated.fetch_add(bytes) + bytes;
+    size_t peak = g_peak.load();
+    while (now > peak && !g_peak.compare_exchange_weak(peak, now)) {}
+}
+
+void Shrink(size_t bytes) {
+    t_net -= static_cast<int64_t>(bytes);
+    g_allocated.fetch_sub(bytes);
+}
+
+void *Wrap(void *base, size_t size) {
+    if (!base) return nullptr;
+    *static_cast<size_t *>(base) = size;
+    return static_cast<char *>(base) + kHeader;
+}
+
+void *Base(void *ptr) {
+    return static_cast<char *>(ptr) - kHeader;
+}
+
+void *CountingMalloc(size_t size) {
+    void *ptr = Wrap(std::malloc(kHeader + size), size);
+    if (ptr) Grow(size);
+    return ptr;
+}
+
+void *CountingCalloc(size_t count, size_t size) {
+    const size_t total = count * size;
+    if (size != 0 && total / size != count) return nullptr;
+    void *ptr = Wrap(std::calloc(1, kHeader + total), total);
+    if (ptr) Grow(total);
+    return ptr;
+}
+
+void CountingFree(void *ptr) {
+    if (!ptr) return;
+    void *base = Base(ptr);
+    Shrink(*static_cast<size_t *>(base));
+    std::free(base);
+}
+
+void *CountingRealloc(void *ptr, size_t size) {
+    if (!ptr) return CountingMalloc(size);
+    void *base = Base(ptr);
+    const size_t old_size = *static_cast<size_t *>(base);
+    void *grown = std::realloc(base, kHeader + size);
+    if (!grown) return nullptr;
+    Shrink(old_size);
+    Grow(size);
+    return Wrap(grown, size);
+}
+
+}  // namespace
+
+void InstallCountingAllocator() {
+    std::call_once(g_install_once, [] {
+        ts_set_allocator(CountingMalloc, CountingCalloc, CountingRealloc, CountingFree);
+        g_installed = true;
+    });
+}
+
+size_t TreeSitterAllocatedBytes() {
+    return g_allocated.load();
+}
+
+size_t TreeSitterPeakBytes() {
+    return g_peak.load();
+}
+
+int64_t TreeSitterThreadNetBytes() {
+    return t_net;
+}
+
+void TreeSitterFree(void *ptr) {
+    if (g_installed) {
+        CountingFree(ptr);
+    } else {
+        std::free(ptr);
+    }
+}
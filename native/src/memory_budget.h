@@ -0,0 +1,26 @@
+/**
+ * @file memory_budget.h
+ * @brief Tree-sitter 할당량 계수 (ts_set_allocator) — 메모리 예산/축출 판단용
+ *
+ * addon 초기화 때 InstallCountingAllocator()를 한 번 호출하면 이후 Tree-sitter의 모든
+ * 할당(트리, 파서 스택, 변경 구간 배열 ...)이 크기 헤더와 함께 계수된다.
+ * Tree-sitter가 돌려준 버퍼(ts_tree_get_changed_ranges 등)는 반드시 TreeSitterFree로 해제한다.
+ * 설치하지 않은 도구(difftest 등)에서는 TreeSitterFree가 std::free와 같다.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+void InstallCountingAllocator();
+
+// 현재 살아 있는 Tree-sitter 할당 바이트 / 설치 이후 최대치 (설치 전이면 0)
+size_t TreeSitterAllocatedBytes();
+size_t TreeSitterPeakBytes();
+
+// 이 스레드가 할당한 바이트 - 해제한 바이트 누계. 작업 전후 차이로 할당을 세션 등에 귀속시킨다
+// (프로세스 합계에는 다른 엔진/워커 스레드/스크래치 파서가 섞여 있어 축출 판단에 쓸 수 없다)
+int64_t TreeSitterThreadNetBytes();
+
+void TreeSitterFree(void *ptr);
@@ -0,0 +1,74 @@
+/**
+ * @file outline.cc
+ * @brief BuildOutline 구현 — 트리 커서 DFS 한 번
+ */
+
+#include "outline.h"
+
+#include <algorithm>
+
+namespace {
+
+constexpr uint32_t kMaxIdentifierText = 64;
+constexpr uint32_t kMaxKeywordText = 16;
+
+OutlineLine &LineFor(std::vector<OutlineLine> &out, uint32_t row, uint32_t depth) {
+    if (out.empty() || out.back().row != row) out.push_back({row, depth, false, {}});
+    return out.back();
+}
+
+}  // namespace
+
+void BuildOutline(const TSTree *tree, const std::string &source, uint32_t end_byte,
+                  const SymbolClassifier &classifier, std::vector<OutlineLine> &out) {
+    out.clear();
+    if (!tree) return;
+    if (end_byte > source.size()) end_byte = static_cast<uint32_t>(source.size());
+
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    std::vector<bool> scope_stack;  // 내려간 조상마다 스코프 노드인지
+    uint32_t depth = 0;
+
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        if (ts_node_start_byte(node) >= end_byte) break;  // 이후 노드는 모두 범위 밖
+
+        const bool skip = ts_node_is_extra(node) || ts_node_is_missing(node);
+        const TSSymbol symbol = ts_node_grammar_symbol(node);
+        const bool scope = !skip && ts_node_is_named(node) && classifier.IsScope(symbol);
+        if (scope) LineFor(out, ts_node_start_point(node).row, depth).signature = true;
+
+        if (!skip && ts_tree_cursor_goto_first_child(&cursor)) {
+            scope_stack.push_back(scope);
+            if (scope) depth++;
+            continue;
+        }
+
+        if (!skip) {
+            const uint32_t start = ts_node_start_byte(node);
+            const uint32_t length = ts_node_end_byte(node) - start;
+            OutlineToken token = {symbol, {}};
+            if (!ts_node_is_named(node)) {
+                if (length <= kMaxKeywordText) token.text.assign(source, start, length);
+            } else {
+                const SymbolClass kind = classifier.Classify(symbol);
+                if (kind == SymbolClass::Identifier || kind == SymbolClass::Member) {
+                    token.text.assign(source, start, std::min(length, kMaxIdentifierText));
+                }
+            }
+            LineFor(out, ts_node_start_point(node).row, depth).tokens.push_back(std::move(token));
+        }
+
+        bool done = false;
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                done = true;
+                break;
+            }
+            if (scope_stack.back()) depth--;
+            scope_stack.pop_back();
+        }
+        if (done) break;
+    }
+    ts_tree_cursor_delete(&cursor);
+}
@@ -0,0 +1,35 @@
+/**
+ * @file outline.h
+ * @brief 커서에서 먼 코드의 구조 요약 (프롬프트 압축용)
+ *
+ * [0, end_byte)의 소스를 줄 단위 단말 토큰열로 만든다.
+ *   - 스코프 노드(함수/메서드/클래스 ...)가 시작되는 줄은 signature로 표시 → 호출측이 원문 한 줄을 유지
+ *   - 각 줄의 depth는 감싸는 스코프 노드 수 → 호출측이 본문을 생략할 수 있다
+ *   - 토큰 텍스트는 식별자/멤버와 익명 토큰(키워드, 구두점)만 유지하고,
+ *     리터럴 등 나머지는 심볼 이름만 남긴다 (TokenMapper로 범주 이름으로 바꿈)
+ * extra 노드(주석 등)는 버린다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tree_sitter/api.h"
+#include "symbol_classes.h"
+
+struct OutlineToken {
+    TSSymbol symbol;
+    std::string text;  // 비어 있으면 심볼 범주만 (리터럴 등)
+};
+
+struct OutlineLine {
+    uint32_t row;
+    uint32_t depth;
+    bool signature;
+    std::vector<OutlineToken> tokens;
+};
+
+void BuildOutline(const TSTree *tree, const std::string &source, uint32_t end_byte,
+                  const SymbolClassifier &classifier, std::vector<OutlineLine> &out);
@@ -0,0 +1,23 @@
+/**
+ * @file parse_table.h
+ * @brief Tree-sitter 내부 파싱 테이블 접근 선언 (lib/src/language.h)
+ *
+ * 공개 API에는 상태별 액션 목록이 없으므로, addon과 함께 링크되는 lib.c의
+ * 내부 함수를 직접 선언해서 쓴다. 구조체 레이아웃은 포크의 language.h와 같아야 한다.
+ */
+
+#pragma once
+
+#include "tree_sitter/api.h"
+#include "tree_sitter/parser.h"  // TSParseAction, struct TSLanguage (token_count)
+
+extern "C" {
+    typedef struct {
+        const TSParseAction *actions;
+        uint32_t action_count;
+        bool is_reusable;
+    } TableEntry;
+
+    // 단말 심볼(symbol < token_count)에 대한 (state, symbol) 칸의 액션 목록
+    void ts_language_table_entry(const TSLanguage *self, TSStateId state, TSSymbol symbol, TableEntry *result);
+}
@@ -0,0 +1,92 @@
+/**
+ * @file recovery_limit.cc
+ * @brief RecoveryGuard 구현 (Tree-sitter 파서 로그 메시지 해석)
+ */
+
+#include "recovery_limit.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include "engine_stats.h"
+
+namespace {
+
+// Tree-sitter lib/src/error_costs.h와 같은 가중치
+constexpr uint64_t kCostPerRecovery = 500;
+constexpr uint64_t kCostPerSkippedTree = 100;
+constexpr uint64_t kCostPerMissingTree = 110;
+
+bool StartsWith(const char *s, const char *prefix) {
+    return std::strncmp(s, prefix, std::strlen(prefix)) == 0;
+}
+
+}  // namespace
+
+RecoveryGuard::RecoveryGuard(TSParser *parser, const RecoveryLimit &limit)
+    : parser_(parser), limit_(limit) {
+    if (!parser_ || !limit_.enabled()) return;
+    previous_ = ts_parser_logger(parser_);
+    ts_parser_set_logger(parser_, {this, Log});
+    ts_parser_set_cancellation_flag(parser_, &cancel_flag_);
+    active_ = true;
+}
+
+RecoveryGuard::~RecoveryGuard() {
+    Finish();
+}
+
+bool RecoveryGuard::Finish() {
+    if (!active_) return false;
+    active_ = false;
+    ts_parser_set_logger(parser_, previous_);
+    ts_parser_set_cancellation_flag(parser_, nullptr);
+    if (!triggered_) return false;
+    // 취소된 파싱은 이어서 재개하도록 상태가 남아 있으므로 버린다
+    ts_parser_reset(parser_);
+    CountStat(Stat::RecoveryCapped);
+    return true;
+}
+
+void RecoveryGuard::Log(void *payload, TSLogType type, const char *message) {
+    static_cast<RecoveryGuard *>(payload)->Observe(type, message);
+}
+
+void RecoveryGuard::Observe(TSLogType type, const char *message) {
+    if (previous_.log) previous_.log(previous_.payload, type, message);
+    if (type != TSLogTypeParse || triggered_) return;
+
+    unsigned version = 0, version_count = 0, row = 0, column = 0;
+    int state = 0;
+    if (std::sscanf(message, "process version:%u, version_count:%u, state:%d, row:%u, col:%u",
+                    &version, &version_count, &state, &row, &column) == 5) {
+        // 오류 전이고 스택이 하나뿐이면 그 위치까지는 복구 없이 파싱된 것
+        if (!error_seen_ && version_count == 1) {
+            clean_row_ = row;
+            clean_column_ = column;
+        }
+        if (limit_.max_versions > 0 && version_count > limit_.max_versions) triggered_ = true;
+    } else if (StartsWith(message, "detect_error")) {
+        error_seen_ = true;
+    } else if (StartsWith(message, "recover_to_previous") || StartsWith(message, "recover_eof")) {
+        cost_ += kCostPerRecovery;
+    } else if (StartsWith(message, "skip_token") || StartsWith(message, "skip_unrecognized_character")) {
+        cost_ += kCostPerSkippedTree;
+    } else if (StartsWith(message, "recover_with_missing")) {
+        cost_ += kCostPerMissingTree;
+    }
+    if (limit_.max_cost > 0 && cost_ > limit_.max_cost) triggered_ = true;
+    if (triggered_) cancel_flag_ = 1;
+}
+
+uint32_t RecoveryGuard::FallbackByte(const std::string &source, uint32_t cursor) const {
+    // TSPoint.column은 바이트 단위
+    size_t offset = 0;
+    for (uint32_t line = 0; line < clean_row_; line++) {
+        const size_t newline = source.find('\n', offset);
+        if (newline == std::string::npos) return cursor;
+        offset = newline + 1;
+    }
+    offset += clean_column_;
+    return offset < cursor ? static_cast<uint32_t>(offset) : cursor;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file recovery_limit.h
+ * @brief 컨버전 파싱의 오류 복구 상한 (GLR 버전 수 / 복구 비용)
+ *
+ * 모드 0은 커서에서 소스를 자르므로 파서가 미완성 문장을 보고 오류 복구를 자주 돈다.
+ * 복구 비용은 코드가 깨진 정도에 따라 크게 달라져 지연 시간 꼬리를 만든다.
+ *
+ * RecoveryGuard는 컨버전 한 번 동안 파서 로거로 진행 상황을 지켜보다가
+ *   - 동시에 살아 있는 스택 버전 수가 max_versions를 넘거나
+ *   - 누적 복구 비용(Tree-sitter error_costs.h 가중치)이 max_cost를 넘으면
+ * 취소 플래그로 파싱을 멈춘다. 호출측은 첫 오류 직전까지 정상으로 진행한 위치(가장 나은 스택)에서
+ * 소스를 잘라 다시 컨버전한다. 그 접두사도 문장 중간에서 끝나 복구가 다시 돌 수 있으므로 다시 컨버전할
+ * 때도 같은 상한의 가드를 걸고, 또 걸리면 빈 상태 경로(후보 없음)를 돌려준다.
+ *
+ * 로거가 붙는 동안은 파서가 메시지를 포맷하므로 상한을 켰을 때만 설치한다 (기본은 꺼짐).
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "tree_sitter/api.h"
+
+struct RecoveryLimit {
+    uint32_t max_versions = 0;  // 0이면 제한 없음 (Tree-sitter 자체 상한은 6)
+    uint32_t max_cost = 0;      // 0이면 제한 없음 (복구 1회 = 500, 건너뛴 토큰 = 100, 누락 토큰 = 110)
+
+    bool enabled() const { return max_versions > 0 || max_cost > 0; }
+};
+
+class RecoveryGuard {
+public:
+    // limit이 꺼져 있으면 아무것도 하지 않는다
+    RecoveryGuard(TSParser *parser, const RecoveryLimit &limit);
+    ~RecoveryGuard();
+
+    RecoveryGuard(const RecoveryGuard &) = delete;
+    RecoveryGuard &operator=(const RecoveryGuard &) = delete;
+
+    // 로거/취소 플래그를 원래대로 돌린다. 상한에 걸렸으면 파서를 reset하고 true (RecoveryCapped 카운트)
+    bool Finish();
+
+    // 첫 오류 직전 정상 위치의 바이트 오프셋 (source 기준, cursor를 넘지 않음). 없으면 0
+    uint32_t FallbackByte(const std::string &source, uint32_t cursor) const;
+
+private:
+    static void Log(void *payload, TSLogType type, const char *message);
+    void Observe(TSLogType type, const char *message);
+
+    TSParser *parser_;
+    RecoveryLimit limit_;
+    TSLogger previous_{nullptr, nullptr};
+    size_t cancel_flag_ = 0;
+    bool active_ = false;
+    bool triggered_ = false;
+
+    bool error_seen_ = false;
+    uint64_t cost_ = 0;
+    uint32_t clean_row_ = 0;
+    uint32_t clean_column_ = 0;
+};
@@ -0,0 +1,86 @@
+/**
+ * @file redact.cc
+ * @brief RedactSource 구현 — 트리 커서 DFS 한 번, 가린 노드의 자식은 내려가지 않는다
+ */
+
+#include "redact.h"
+
+#include <algorithm>
+
+namespace {
+
+bool IsAlnum(unsigned char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+void MaskIdentifier(std::string &out, uint32_t start, uint32_t end) {
+    std::fill(out.begin() + start, out.begin() + end, 'x');
+}
+
+void MaskQuotedLiteral(std::string &out, uint32_t start, uint32_t end) {
+    if (end - start < 2) return;
+    const char quote = out[start];
+    if (quote != '"' && quote != '\'' && quote != '`') return;
+    for (uint32_t i = start + 1; i + 1 < end; i++) {
+        const unsigned char c = static_cast<unsigned char>(out[i]);
+        if (c == '\\') {
+            i++;  // 이스케이프 문자는 범주(\n, \t, \x..)를 바꾸므로 그대로
+            continue;
+        }
+        if (IsAlnum(c) || c >= 0x80) out[i] = 'x';
+    }
+}
+
+void BlankComment(std::string &out, uint32_t start, uint32_t end) {
+    for (uint32_t i = start; i < end; i++) {
+        if (out[i] != '\n' && out[i] != '\r') out[i] = ' ';
+    }
+}
+
+}  // namespace
+
+std::string RedactSource(const TSTree *tree, const std::string &source, const SymbolClassifier &classifier) {
+    std::string out = source;
+    if (!tree) return out;
+    const uint32_t size = static_cast<uint32_t>(out.size());
+
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        const uint32_t start = std::min(ts_node_start_byte(node), size);
+        const uint32_t end = std::min(ts_node_end_byte(node), size);
+
+        bool masked = true;
+        if (ts_node_is_missing(node) || !ts_node_is_named(node)) {
+            masked = false;
+        } else if (ts_node_is_extra(node) && ts_node_child_count(node) == 0) {
+            BlankComment(out, start, end);
+        } else {
+            switch (classifier.Classify(ts_node_symbol(node))) {
+            case SymbolClass::Identifier:
+            case SymbolClass::Member:
+                masked = ts_node_child_count(node) == 0;
+                if (masked) MaskIdentifier(out, start, end);
+                break;
+            case SymbolClass::Literal:
+                MaskQuotedLiteral(out, start, end);
+                break;
+            default:
+                masked = false;
+                break;
+            }
+        }
+
+        if (!masked && ts_tree_cursor_goto_first_child(&cursor)) continue;
+        bool done = false;
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                done = true;
+                break;
+            }
+        }
+        if (done) break;
+    }
+    ts_tree_cursor_delete(&cursor);
+    return out;
+}
@@ -0,0 +1,21 @@
+/**
+ * @file redact.h
+ * @brief 소스를 토큰 범주만 남기고 가리기 (느린 요청 재현 번들용, src/reproBundle.ts)
+ *
+ * 같은 문법으로 다시 파싱했을 때 같은 구조(상태 경로)가 나오도록 바이트 길이와 토큰 경계를 유지한다.
+ *   - 식별자/멤버: 모든 바이트를 'x'로
+ *   - 문자열 등 따옴표로 시작하는 리터럴: 양 끝과 역슬래시/개행은 두고 영숫자·비ASCII 바이트를 'x'로
+ *     (숫자/불리언처럼 따옴표가 없는 리터럴은 형태가 곧 범주라 그대로 둔다)
+ *   - 주석(named extra): 개행만 남기고 공백으로
+ *   - 키워드/구두점(익명 노드)은 그대로
+ * 결과의 바이트 오프셋은 원본과 같으므로 커서 오프셋을 그대로 쓸 수 있다.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "tree_sitter/api.h"
+#include "symbol_classes.h"
+
+std::string RedactSource(const TSTree *tree, const std::string &source, const SymbolClassifier &classifier);
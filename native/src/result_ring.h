@@ -0,0 +1,129 @@
+/**
+ * @file result_ring.h
+ * @brief 워커 스레드 → JS 메인 스레드 단일 생산자/단일 소비자(SPSC) 결과 링 (SharedArrayBuffer 위)
+ *
+ * 메모리는 JS가 만든 SharedArrayBuffer(Int32Array 뷰)이고, 네이티브 워커(ConversionWorker)가 쓰고
+ * 확장의 src/resultRing.ts가 읽는다. 잠금 없이 위치 두 개(쓰기/읽기, 각자 한 쪽만 증가)만 원자적으로 주고받는다.
+ * 레이아웃은 src/resultRing.ts와 같아야 한다 (모두 native endian, 4바이트 정렬).
+ *
+ *   헤더 (바이트 오프셋)
+ *     0   magic (kMagic)           4   데이터 용량 C (2의 거듭제곱)
+ *     64  쓰기 위치 (u32, 단조 증가) 128 읽기 위치 (u32, 단조 증가)   132 소비자 대기 플래그
+ *     192 생산자가 공간을 기다린 횟수 (통계)
+ *   데이터: kDataOffset부터 C바이트. 위치 p의 레코드는 kDataOffset + (p & (C - 1))에 있다.
+ *   레코드 (u32 단어)
+ *     [0] 전체 바이트 수 (헤더 포함, 4의 배수)   [1] 요청 ID   [2] 상태 (0 정상, 음수 오류: kStatus*)
+ *     [3] 상태 경로 길이 n   [4] 후보 수 m
+ *     u16 상태 × n (4바이트로 패딩), (u32 key ID, u32 value) × m  (value는 u32로 포화)
+ *   레코드가 데이터 끝을 넘으면 그 자리에 0 한 단어(되감기 표시)를 쓰고 처음부터 쓴다.
+ *
+ * 쓰기/읽기 위치는 쓰고 나서 release로 올리고 acquire로 읽는다. 소비자가 잠들기 전 대기 플래그를 세우면
+ * 생산자는 위치를 올린 뒤 플래그를 확인해 doorbell을 울린다 (둘 다 seq_cst, 놓치는 깨움 없음).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#include "candidate_db.h"
+#include "tree_sitter/api.h"
+
+class ResultRingWriter {
+public:
+    static constexpr uint32_t kMagic = 0x52454343;  // "CCER"
+    static constexpr size_t kWriteSlot = 64 / 4;
+    static constexpr size_t kReadSlot = 128 / 4;
+    static constexpr size_t kWaitingSlot = 132 / 4;
+    static constexpr size_t kStallSlot = 192 / 4;
+    static constexpr size_t kDataOffset = 256;
+    static constexpr uint32_t kRecordHeaderBytes = 5 * 4;
+
+    static constexpr int32_t kStatusOk = 0;
+    static constexpr int32_t kStatusTooLarge = -1;  // 상태 경로만으로 레코드 상한(링의 절반)을 넘음 (경로/후보 없이 보냄)
+
+    static_assert(sizeof(std::atomic<int32_t>) == sizeof(int32_t) && std::atomic<int32_t>::is_always_lock_free,
+                  "SharedArrayBuffer 슬롯을 std::atomic<int32_t>로 본다");
+
+    // memory: Int32Array 뷰의 시작 (헤더 포함 bytes 바이트). 용량/매직이 맞지 않으면 false
+    bool Attach(void *memory, size_t bytes) {
+        if (!memory || bytes <= kDataOffset) return false;
+        words_ = static_cast<int32_t *>(memory);
+        const uint32_t capacity = static_cast<uint32_t>(words_[1]);
+        if (static_cast<uint32_t>(words_[0]) != kMagic || capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+            kDataOffset + capacity > bytes) {
+            words_ = nullptr;
+            return false;
+        }
+        capacity_ = capacity;
+        data_ = static_cast<uint8_t *>(memory) + kDataOffset;
+        return true;
+    }
+
+    bool attached() const { return words_ != nullptr; }
+
+    // 상태 경로가 n일 때 후보 없이도 레코드 상한(링의 절반)에 들어가는지
+    bool FitsPath(uint32_t state_count) const {
+        return static_cast<uint64_t>(kRecordHeaderBytes) + Align4(state_count * 2) <= capacity_ / 2;
+    }
+
+    // 한 레코드에 들어갈 수 있는 최대 후보 수 (상태 경로가 n일 때, 링의 절반을 넘지 않게)
+    uint32_t MaxCandidates(uint32_t state_count) const {
+        const uint32_t fixed = kRecordHeaderBytes + Align4(state_count * 2);
+        const uint32_t half = capacity_ / 2;
+        return half > fixed ? (half - fixed) / 8 : 0;
+    }
+
+    // 공간이 없으면 false (아무것도 쓰지 않음). 호출측이 잠시 기다렸다가 다시 시도한다
+    bool TryWrite(uint32_t request_id, int32_t status, const TSStateId *states, uint32_t state_count,
+                  const RankedId *candidates, uint32_t candidate_count, bool &ring_doorbell) {
+        ring_doorbell = false;
+        const uint32_t size = kRecordHeaderBytes + Align4(state_count * 2) + candidate_count * 8;
+        const uint32_t write = static_cast<uint32_t>(Slot(kWriteSlot).load(std::memory_order_relaxed));
+        const uint32_t read = static_cast<uint32_t>(Slot(kReadSlot).load(std::memory_order_acquire));
+        const uint32_t offset = write & (capacity_ - 1);
+        const uint32_t contiguous = capacity_ - offset;
+        const uint32_t needed = size + (contiguous < size ? contiguous : 0);
+        if (capacity_ - (write - read) < needed) {
+            Slot(kStallSlot).fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        uint32_t at = offset;
+        uint32_t next = write;
+        if (contiguous < size) {
+            PutWord(at, 0);  // 되감기 표시
+            next += contiguous;
+            at = 0;
+        }
+        const uint32_t header[5] = {size, request_id, static_cast<uint32_t>(status), state_count, candidate_count};
+        std::memcpy(data_ + at, header, sizeof(header));
+        uint8_t *p = data_ + at + kRecordHeaderBytes;
+        std::memcpy(p, states, state_count * sizeof(TSStateId));
+        p += Align4(state_count * 2);
+        for (uint32_t i = 0; i < candidate_count; i++) {
+            const uint32_t pair[2] = {candidates[i].key,
+                                      static_cast<uint32_t>(std::min<uint64_t>(candidates[i].value, UINT32_MAX))};
+            std::memcpy(p + i * 8, pair, sizeof(pair));
+        }
+
+        Slot(kWriteSlot).store(static_cast<int32_t>(next + size), std::memory_order_seq_cst);
+        ring_doorbell = Slot(kWaitingSlot).exchange(0, std::memory_order_seq_cst) != 0;
+        return true;
+    }
+
+private:
+    static uint32_t Align4(uint32_t n) { return (n + 3) & ~3u; }
+
+    std::atomic<int32_t> &Slot(size_t index) const {
+        return *reinterpret_cast<std::atomic<int32_t> *>(words_ + index);
+    }
+
+    void PutWord(uint32_t at, uint32_t value) { std::memcpy(data_ + at, &value, sizeof(value)); }
+
+    int32_t *words_ = nullptr;
+    uint8_t *data_ = nullptr;
+    uint32_t capacity_ = 0;
+};
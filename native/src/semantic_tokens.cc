@@ -0,0 +1,320 @@
+/**
+ * @file semantic_tokens.cc
+ * @brief SemanticTokens 구현
+ */
+
+#include "semantic_tokens.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <limits>
+
+const char *const SemanticTokens::kTypeNames[kTypeCount] = {
+    "namespace", "function", "method", "property", "variable", "label",
+    "keyword", "string", "number", "comment", "operator",
+};
+
+const char *const SemanticTokens::kModifierNames[2] = {"declaration", "defaultLibrary"};
+
+namespace {
+
+bool Intersects(uint32_t a_start, uint32_t a_end, uint32_t b_start, uint32_t b_end) {
+    return a_end > b_start && a_start < b_end;
+}
+
+bool IsWordChar(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool IsSpace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+// 첫 줄에서 자른 끝
+uint32_t ClipToLine(const std::string &text, uint32_t start, uint32_t end) {
+    for (uint32_t i = start; i < end; i++) {
+        if (text[i] == '\n' || text[i] == '\r') return i;
+    }
+    return end;
+}
+
+char NextChar(const std::string &text, uint32_t pos) {
+    while (pos < text.size() && IsSpace(text[pos])) pos++;
+    return pos < text.size() ? text[pos] : '\0';
+}
+
+char PrevChar(const std::string &text, uint32_t pos) {
+    while (pos > 0 && IsSpace(text[pos - 1])) pos--;
+    return pos > 0 ? text[pos - 1] : '\0';
+}
+
+// pos 앞의 단어 (공백 건너뜀, 소문자)
+std::string PrevWord(const std::string &text, uint32_t pos) {
+    while (pos > 0 && IsSpace(text[pos - 1])) pos--;
+    uint32_t begin = pos;
+    while (begin > 0 && IsWordChar(text[begin - 1])) begin--;
+    std::string word = text.substr(begin, pos - begin);
+    for (char &c : word) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return word;
+}
+
+bool AllOf(const std::string &text, uint32_t start, uint32_t end, bool (*pred)(char)) {
+    if (start >= end) return false;
+    for (uint32_t i = start; i < end; i++) {
+        if (!pred(text[i])) return false;
+    }
+    return true;
+}
+
+bool IsOperatorChar(char c) {
+    return c != '\0' && std::strchr("+-*/%<>=!&|^~", c) != nullptr;
+}
+
+}  // namespace
+
+bool SemanticTokens::ClassifyLeaf(TSNode node, const std::string &text, Token &token) const {
+    const uint32_t start = token.start_byte;
+    const uint32_t end = token.end_byte;
+    token.modifiers = 0;
+
+    std::string type_name = ts_node_type(node);
+    for (char &c : type_name) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    if (ts_node_is_extra(node) || type_name.find("comment") != std::string::npos) {
+        token.type = Comment;
+        return true;
+    }
+
+    if (!ts_node_is_named(node)) {
+        if (AllOf(text, start, end, IsWordChar)) {
+            token.type = Keyword;
+            return true;
+        }
+        if (AllOf(text, start, end, IsOperatorChar)) {
+            token.type = Operator;
+            return true;
+        }
+        return false;
+    }
+
+    switch (classifier_.Classify(ts_node_symbol(node))) {
+    case SymbolClass::Literal: {
+        const char first = start < text.size() ? text[start] : '\0';
+        if (first == '"' || first == '\'') {
+            token.type = String;
+        } else if (std::isdigit(static_cast<unsigned char>(first)) || first == '.' || first == '-') {
+            token.type = Number;
+        } else {
+            token.type = Keyword;  // true/false/nil ...
+        }
+        return true;
+    }
+    case SymbolClass::Identifier:
+    case SymbolClass::Member: {
+        const char prev = PrevChar(text, start);
+        const char next = NextChar(text, ts_node_end_byte(node));
+        const std::string prev_word = PrevWord(text, start);
+        if (prev == '.') {
+            token.type = next == '(' ? Method : Property;
+            token.modifiers = DefaultLibrary;
+        } else if (next == '.') {
+            token.type = Namespace;
+            token.modifiers = DefaultLibrary;
+        } else if (prev_word == "sub") {
+            token.type = Function;
+            token.modifiers = Declaration;
+        } else if (prev_word == "goto") {
+            token.type = Label;
+        } else if (next == ':') {
+            token.type = Label;
+            token.modifiers = Declaration;
+        } else if (next == '(') {
+            token.type = Function;
+        } else {
+            token.type = Variable;
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+// [start, end)와 겹치는 보이는 단말을 소스 순서로 모으고,
+// 단말 사이 빈틈(숨은 토큰 자리)의 단어를 키워드로 채운다.
+void SemanticTokens::Collect(const TSTree *tree, const std::string &text, uint32_t start, uint32_t end,
+                             std::vector<Token> &out) const {
+    struct Leaf {
+        Token token;
+        uint32_t cover_end;  // 자르기 전 끝 (빈틈 계산용)
+        bool typed;
+    };
+    std::vector<Leaf> leaves;
+
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    bool done = false;
+    while (!done) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        const uint32_t node_start = ts_node_start_byte(node);
+        const uint32_t node_end = std::min<uint32_t>(ts_node_end_byte(node), static_cast<uint32_t>(text.size()));
+
+        if (Intersects(node_start, node_end, start, end) && !ts_node_is_missing(node)) {
+            const bool literal = ts_node_is_named(node) &&
+                classifier_.Classify(ts_node_symbol(node)) == SymbolClass::Literal;
+            if (!literal && ts_tree_cursor_goto_first_child_for_byte(&cursor, start) >= 0) continue;
+            // 구간 앞에서 시작한 여러 줄 단말은 앞 구간 소유
+            if (node_start >= start) {
+                Leaf leaf = {{node_start, ClipToLine(text, node_start, node_end), 0, 0}, node_end, false};
+                leaf.typed = leaf.token.end_byte > node_start && ClassifyLeaf(node, text, leaf.token);
+                leaves.push_back(leaf);
+            }
+        }
+
+        // 다음 형제로. 형제가 구간을 벗어나면 부모로 올라간다.
+        for (;;) {
+            if (ts_tree_cursor_goto_next_sibling(&cursor)) {
+                if (ts_node_start_byte(ts_tree_cursor_current_node(&cursor)) < end) break;
+            }
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                done = true;
+                break;
+            }
+        }
+    }
+    ts_tree_cursor_delete(&cursor);
+
+    auto scan_gap = [&](uint32_t from, uint32_t to) {
+        to = std::min<uint32_t>(to, static_cast<uint32_t>(text.size()));
+        for (uint32_t i = from; i < to;) {
+            if (!std::isalpha(static_cast<unsigned char>(text[i])) && text[i] != '_') {
+                i++;
+                continue;
+            }
+            uint32_t j = i;
+            while (j < to && IsWordChar(text[j])) j++;
+            out.push_back({i, j, Keyword, 0});
+            i = j;
+        }
+    };
+
+    uint32_t pos = start;
+    for (const Leaf &leaf : leaves) {
+        if (leaf.token.start_byte > pos) scan_gap(pos, leaf.token.start_byte);
+        if (leaf.typed) out.push_back(leaf.token);
+        pos = std::max(pos, leaf.cover_end);
+    }
+    if (pos < end) scan_gap(pos, end);
+}
+
+void SemanticTokens::Encode(size_t from, size_t to, const std::string &text, const LineIndex &lines) {
+    LineIndex::Position prev = {0, 0};
+    if (from > 0) prev = lines.PositionForByte(text, tokens_[from - 1].start_byte);
+    for (size_t i = from; i < to; i++) {
+        const Token &token = tokens_[i];
+        const LineIndex::Position pos = lines.PositionForByte(text, token.start_byte);
+        const LineIndex::Position end = lines.PositionForByte(text, token.end_byte);
+        uint32_t *out = &data_[5 * i];
+        out[0] = pos.line - prev.line;
+        out[1] = pos.line == prev.line ? pos.character - prev.character : pos.character;
+        out[2] = end.character - pos.character;
+        out[3] = token.type;
+        out[4] = token.modifiers;
+        prev = pos;
+    }
+}
+
+void SemanticTokens::MarkDirty(size_t begin, size_t end, size_t old_size) {
+    dirty_begin_ = std::min(dirty_begin_, begin);
+    dirty_tail_ = std::min(dirty_tail_, old_size - end);
+}
+
+void SemanticTokens::Rebuild(const TSTree *tree, const std::string &text, const LineIndex &lines) {
+    enabled_ = true;
+    tokens_.clear();
+    if (tree) Collect(tree, text, 0, std::numeric_limits<uint32_t>::max(), tokens_);
+    data_.assign(5 * tokens_.size(), 0);
+    Encode(0, tokens_.size(), text, lines);
+    dirty_begin_ = 0;
+    dirty_tail_ = 0;
+}
+
+void SemanticTokens::Update(const TSInputEdit &edit, const TSRange *ranges, uint32_t range_count,
+                            const TSTree *tree, const std::string &text, const LineIndex &lines) {
+    if (!enabled_) return;
+    if (!tree) {
+        Rebuild(nullptr, text, lines);
+        return;
+    }
+
+    // 1. 다시 분류할 범위 (새 좌표): 편집 구간 ∪ 변경 구간을 줄 경계로 넓힌다.
+    //    토큰은 한 줄 안에 있으므로 경계에 걸치는 토큰이 없다.
+    const uint32_t size = static_cast<uint32_t>(text.size());
+    uint32_t lo = edit.start_byte;
+    uint32_t hi = edit.new_end_byte;
+    for (uint32_t i = 0; i < range_count; i++) {
+        lo = std::min(lo, ranges[i].start_byte);
+        hi = std::max(hi, ranges[i].end_byte);
+    }
+    hi = std::min(hi, size);
+    lo = lines.ByteForPosition(text, lines.LineOf(std::min(lo, hi)), 0);
+    const uint32_t last_line = lines.LineOf(hi);
+    hi = last_line + 1 < lines.line_count() ? lines.ByteForPosition(text, last_line + 1, 0) : size;
+
+    // 2. 옛 좌표의 같은 범위에 있던 토큰 [i, j). hi는 편집 끝 이후이므로 delta만큼 되돌린다.
+    const int64_t delta = static_cast<int64_t>(edit.new_end_byte) - static_cast<int64_t>(edit.old_end_byte);
+    const uint32_t hi_old = static_cast<uint32_t>(static_cast<int64_t>(hi) - delta);
+    const size_t i = std::partition_point(tokens_.begin(), tokens_.end(),
+                                          [&](const Token &t) { return t.end_byte <= lo; }) - tokens_.begin();
+    const size_t j = std::partition_point(tokens_.begin() + i, tokens_.end(),
+                                          [&](const Token &t) { return t.start_byte < hi_old; }) - tokens_.begin();
+
+    // 3. 뒤쪽 토큰 바이트 이동 (상대 인코딩은 그대로)
+    for (size_t k = j; k < tokens_.size(); k++) {
+        tokens_[k].start_byte = static_cast<uint32_t>(tokens_[k].start_byte + delta);
+        tokens_[k].end_byte = static_cast<uint32_t>(tokens_[k].end_byte + delta);
+    }
+
+    // 4. 범위만 다시 수집해서 교체
+    std::vector<Token> fresh;
+    Collect(tree, text, lo, hi, fresh);
+    const size_t old_size = data_.size();
+    tokens_.erase(tokens_.begin() + i, tokens_.begin() + j);
+    tokens_.insert(tokens_.begin() + i, fresh.begin(), fresh.end());
+    data_.erase(data_.begin() + 5 * i, data_.begin() + 5 * j);
+    data_.insert(data_.begin() + 5 * i, 5 * fresh.size(), 0);
+    Encode(i, i + fresh.size(), text, lines);
+    MarkDirty(5 * i, 5 * j, old_size);
+
+    // 5. 구간 바로 뒤 토큰은 앞 토큰이 바뀌었으므로 다시 인코딩
+    const size_t next = i + fresh.size();
+    if (next < tokens_.size()) {
+        Encode(next, next + 1, text, lines);
+        MarkDirty(5 * next, 5 * next + 5, data_.size());
+    }
+}
+
+void SemanticTokens::Clear() {
+    const size_t old_size = data_.size();
+    std::vector<Token>().swap(tokens_);
+    std::vector<uint32_t>().swap(data_);
+    MarkDirty(0, old_size, old_size);
+}
+
+uint32_t SemanticTokens::Snapshot() {
+    if (++result_id_ == 0) result_id_ = 1;
+    snapshot_size_ = data_.size();
+    dirty_begin_ = data_.size();
+    dirty_tail_ = data_.size();
+    return result_id_;
+}
+
+bool SemanticTokens::DeltaSince(uint32_t previous, Delta &out) const {
+    if (result_id_ == 0 || previous != result_id_) return false;
+    const size_t start = std::min({dirty_begin_, snapshot_size_, data_.size()});
+    const size_t tail = std::min({dirty_tail_, snapshot_size_ - start, data_.size() - start});
+    out.start = static_cast<uint32_t>(start);
+    out.delete_count = static_cast<uint32_t>(snapshot_size_ - start - tail);
+    out.data = data_.data() + start;
+    out.length = static_cast<uint32_t>(data_.size() - tail - start);
+    return true;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file semantic_tokens.h
+ * @brief 보존 트리 기반 시맨틱 토큰 (VS Code DocumentSemanticTokensProvider용, delta 지원)
+ *
+ * 토큰을 VS Code 상대 인코딩(deltaLine, deltaStart, length, type, modifiers) 그대로 보관하고,
+ * 편집 시에는 편집 구간 + ts_tree_get_changed_ranges 구간을 줄 경계로 넓힌 범위만 다시 분류한다.
+ * 상대 인코딩이므로 구간 뒤 토큰은 첫 토큰 하나만 다시 인코딩하면 된다 (줄이 밀려도 그대로).
+ * 마지막으로 보낸 스냅샷 이후 바뀐 구간을 추적해 delta를 한 건의 edit으로 돌려준다.
+ *
+ * 분류 규칙 (문법 심볼 이름 + 주변 텍스트, Small Basic 기준):
+ *   - 주석(extra), 문자열/숫자 리터럴
+ *   - 식별자: 뒤에 "."이면 객체(namespace), 앞에 "."이면 메서드/프로퍼티, "Sub" 뒤면 함수 선언,
+ *            뒤에 "("이면 함수, 뒤에 ":"나 "Goto" 뒤면 레이블, 나머지는 변수
+ *   - 키워드: 보이는 익명 토큰 중 영문자 토큰, 그리고 트리에 보이지 않는 숨은 토큰
+ *            (Small Basic의 While/EndIf 등은 정규식 보조 토큰이라 노드가 없다) 자리의 단어
+ *   - 연산자 기호
+ * 토큰은 한 줄을 넘지 않게 첫 줄에서 자른다.
+ * 처음 조회될 때까지는 아무 것도 유지하지 않는다 (Small Basic 외 언어 세션에는 비용 없음).
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tree_sitter/api.h"
+#include "line_index.h"
+#include "symbol_classes.h"
+
+class SemanticTokens {
+public:
+    enum Type : uint32_t {
+        Namespace, Function, Method, Property, Variable, Label,
+        Keyword, String, Number, Comment, Operator,
+        kTypeCount
+    };
+    enum Modifier : uint32_t {
+        Declaration = 1u << 0,
+        DefaultLibrary = 1u << 1,
+    };
+    static const char *const kTypeNames[kTypeCount];
+    static const char *const kModifierNames[2];
+
+    // 스냅샷 이후 바뀐 구간 (VS Code SemanticTokensEdit 한 건)
+    struct Delta {
+        uint32_t start;
+        uint32_t delete_count;
+        const uint32_t *data;
+        uint32_t length;
+    };
+
+    explicit SemanticTokens(const SymbolClassifier &classifier) : classifier_(classifier) {}
+
+    bool enabled() const { return enabled_; }
+
+    // 전체 다시 수집 (첫 조회 시 활성화)
+    void Rebuild(const TSTree *tree, const std::string &text, const LineIndex &lines);
+
+    // edit은 이미 적용된 편집, ranges는 새 트리 기준 변경 구간, lines는 편집 반영 후 색인
+    void Update(const TSInputEdit &edit, const TSRange *ranges, uint32_t range_count,
+                const TSTree *tree, const std::string &text, const LineIndex &lines);
+
+    // 저장 공간 반환 (세션 축출). 활성 상태는 유지해서 다시 파싱할 때 Rebuild된다.
+    void Clear();
+
+    const std::vector<uint32_t> &data() const { return data_; }
+
+    // 현재 data를 보낸 것으로 기록하고 새 result id를 돌려준다
+    uint32_t Snapshot();
+    // previous가 마지막 스냅샷이면 out에 변경 구간을 채운다. 아니면 false (전체를 보내야 함)
+    bool DeltaSince(uint32_t previous, Delta &out) const;
+
+    size_t MemoryBytes() const {
+        return tokens_.capacity() * sizeof(Token) + data_.capacity() * sizeof(uint32_t);
+    }
+
+private:
+    struct Token {
+        uint32_t start_byte;
+        uint32_t end_byte;  // 첫 줄에서 자른 끝
+        uint32_t type;
+        uint32_t modifiers;
+    };
+
+    void Collect(const TSTree *tree, const std::string &text, uint32_t start, uint32_t end,
+                 std::vector<Token> &out) const;
+    bool ClassifyLeaf(TSNode node, const std::string &text, Token &token) const;
+    // tokens_[from, to)를 data_[5 * from, ...)에 인코딩 (data_ 크기는 호출측이 맞춘다)
+    void Encode(size_t from, size_t to, const std::string &text, const LineIndex &lines);
+    // data_의 [begin, end)를 old_size 크기일 때 바꿨음을 기록
+    void MarkDirty(size_t begin, size_t end, size_t old_size);
+
+    const SymbolClassifier &classifier_;
+    bool enabled_ = false;
+    std::vector<Token> tokens_;    // start_byte 오름차순, 겹치지 않음
+    std::vector<uint32_t> data_;   // tokens_와 같은 순서, 토큰당 5개
+
+    uint32_t result_id_ = 0;       // 0이면 스냅샷 없음
+    size_t snapshot_size_ = 0;
+    size_t dirty_begin_ = 0;       // 스냅샷 이후 바뀐 첫 위치
+    size_t dirty_tail_ = 0;        // 스냅샷 이후 그대로인 끝부분 길이
+};
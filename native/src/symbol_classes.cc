@@ -0,0 +1,68 @@
+/**
+ * @file symbol_classes.cc
+ * @brief SymbolClassifier 구현 — 심볼 이름 규칙 기반 분류
+ */
+
+#include "symbol_classes.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace {
+
+bool EndsWith(const std::string &s, const char *suffix) {
+    const size_t n = std::strlen(suffix);
+    return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+bool Contains(const std::string &s, const char *part) {
+    return s.find(part) != std::string::npos;
+}
+
+bool IsOneOf(const std::string &s, std::initializer_list<const char *> names) {
+    for (const char *n : names) {
+        if (s == n) return true;
+    }
+    return false;
+}
+
+SymbolClass ClassifyName(const std::string &name) {
+    if (IsOneOf(name, {"field_identifier", "property_identifier", "shorthand_property_identifier",
+                       "private_property_identifier", "method_identifier"})) {
+        return SymbolClass::Member;
+    }
+    if (IsOneOf(name, {"ID", "identifier", "name", "constant", "variable", "constructor",
+                       "instance_variable", "class_variable", "global_variable"}) ||
+        EndsWith(name, "_identifier")) {
+        return SymbolClass::Identifier;
+    }
+    if (IsOneOf(name, {"STR", "NUM", "string", "number", "integer", "float", "char", "true", "false",
+                       "null", "nil", "none", "encapsed_string", "template_string", "heredoc"}) ||
+        EndsWith(name, "_literal")) {
+        return SymbolClass::Literal;
+    }
+    return SymbolClass::Other;
+}
+
+bool IsScopeName(const std::string &name) {
+    return Contains(name, "function") || Contains(name, "method") || Contains(name, "class") ||
+           Contains(name, "lambda") || Contains(name, "closure");
+}
+
+}  // namespace
+
+SymbolClassifier::SymbolClassifier(const TSLanguage *language) {
+    const uint32_t count = std::min<uint32_t>(ts_language_symbol_count(language), kSize);
+    for (uint32_t i = 0; i < count; i++) {
+        const TSSymbol symbol = static_cast<TSSymbol>(i);
+        const char *raw = ts_language_symbol_name(language, symbol);
+        if (!raw) continue;
+        const std::string name(raw);
+        // 익명 토큰("(", "if" 등)은 식별자/리터럴 슬롯이 아니다
+        if (ts_language_symbol_type(language, symbol) == TSSymbolTypeRegular) {
+            classes_[i] = ClassifyName(name);
+            scopes_[i] = IsScopeName(name);
+        }
+    }
+}
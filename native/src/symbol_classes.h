@@ -0,0 +1,45 @@
+/**
+ * @file symbol_classes.h
+ * @brief 문법 심볼을 식별자/멤버/리터럴/스코프로 분류하는 테이블
+ *
+ * 언어마다 심볼 이름이 다르므로(ID, identifier, field_identifier, STR, string_literal ...)
+ * 이름 규칙으로 한 번 분류해 두고, 이후에는 심볼 ID로 O(1) 조회한다.
+ * 테이블 크기는 빌드 타겟 문법의 심볼 수(lang_constants::kSymbolCount)로 컴파일 시점에 정해진다.
+ */
+
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+
+#include "tree_sitter/api.h"
+#include "generated/lang_constants.h"
+
+enum class SymbolClass : uint8_t {
+    Other = 0,
+    Identifier = 1,  // 변수/함수/타입 이름
+    Member = 2,      // 필드/프로퍼티 이름 (. 뒤에 오는 이름)
+    Literal = 3,     // 문자열/숫자/불리언 등
+};
+
+class SymbolClassifier {
+public:
+    explicit SymbolClassifier(const TSLanguage *language);
+
+    // 범위 밖은 ERROR 노드(ts_builtin_sym_error = 65535)뿐이다
+    SymbolClass Classify(TSSymbol symbol) const {
+        return symbol < kSize ? classes_[symbol] : SymbolClass::Other;
+    }
+
+    // 함수/메서드/클래스처럼 식별자 스코프를 이루는 노드인지
+    bool IsScope(TSSymbol symbol) const {
+        return symbol < kSize && scopes_[symbol];
+    }
+
+private:
+    static constexpr uint32_t kSize = lang_constants::kSymbolCount;
+
+    std::array<SymbolClass, kSize> classes_{};
+    std::bitset<kSize> scopes_;
+};
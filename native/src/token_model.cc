@@ -0,0 +1,601 @@
+/**
+ * @file token_model.cc
+ * @brief 토큰 n-gram 모델 구현 (수집, 학습 테이블, 메모리 매핑 로더, 빔 탐색 제안)
+ */
+
+#include "token_model.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <optional>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// =============================================================================
+// [파일 형식]
+// =============================================================================
+namespace token_file {
+
+constexpr char kMagic[8] = {'C', 'C', 'E', 'T', 'K', 'M', '0', '1'};
+
+struct Header {
+    char magic[8];
+    uint32_t symbol_count;
+    uint32_t vocab_count;
+    uint32_t context_count;
+    uint32_t successor_count;
+    uint32_t string_bytes;
+    uint32_t reserved;
+    uint64_t total_tokens;
+};
+
+struct VocabEntry {
+    uint32_t text_offset;
+    uint16_t text_length;
+    uint16_t symbol;
+};
+
+struct ContextEntry {
+    uint64_t hash;
+    uint32_t first;   // successors 배열 시작 인덱스
+    uint32_t count;   // 저장된 successor 수 (상위 K개)
+    uint32_t total;   // 가지치기 전 전체 빈도 (확률의 분모)
+    uint32_t reserved;
+};
+
+struct SuccessorEntry {
+    uint32_t token;
+    uint32_t count;
+};
+
+static_assert(sizeof(Header) == 40, "token model header layout");
+static_assert(sizeof(VocabEntry) == 8, "token model vocab layout");
+static_assert(sizeof(ContextEntry) == 24, "token model context layout");
+static_assert(sizeof(SuccessorEntry) == 8, "token model successor layout");
+
+}  // namespace token_file
+
+using namespace token_file;
+
+// =============================================================================
+// [컨텍스트 해시] FNV-1a, 종류 태그로 trigram/bigram/symbol 키가 겹치지 않게 한다
+// =============================================================================
+namespace {
+
+constexpr uint64_t kFnvOffset = 1469598103934665603ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+uint64_t Mix(uint64_t h, const void *data, size_t length) {
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < length; i++) {
+        h ^= p[i];
+        h *= kFnvPrime;
+    }
+    return h;
+}
+
+uint64_t MixToken(uint64_t h, const TokenRef &token) {
+    const uint32_t length = token.length > kMaxTokenText ? 0 : token.length;
+    h = Mix(h, &token.symbol, sizeof(token.symbol));
+    h = Mix(h, &length, sizeof(length));
+    return Mix(h, token.text, length);
+}
+
+}  // namespace
+
+namespace token_context {
+
+uint64_t Trigram(const TokenRef &prev2, const TokenRef &prev1) {
+    const char tag = 3;
+    return MixToken(MixToken(Mix(kFnvOffset, &tag, 1), prev2), prev1);
+}
+
+uint64_t Bigram(const TokenRef &prev1) {
+    const char tag = 2;
+    return MixToken(Mix(kFnvOffset, &tag, 1), prev1);
+}
+
+uint64_t Symbol(TSSymbol symbol) {
+    const char tag = 1;
+    return Mix(Mix(kFnvOffset, &tag, 1), &symbol, sizeof(symbol));
+}
+
+}  // namespace token_context
+
+// =============================================================================
+// [단말 토큰 수집]
+// =============================================================================
+namespace {
+
+bool MakeToken(TSNode node, const std::string &source, TokenRef &out) {
+    if (ts_node_is_null(node) || ts_node_is_extra(node) || ts_node_is_missing(node) || ts_node_is_error(node)) {
+        return false;
+    }
+    const uint32_t start = ts_node_start_byte(node);
+    const uint32_t end = ts_node_end_byte(node);
+    if (end <= start || end > source.size()) return false;
+    out = {ts_node_grammar_symbol(node), source.data() + start, end - start};
+    return true;
+}
+
+TSNode LastLeaf(TSNode node) {
+    for (uint32_t count = ts_node_child_count(node); count > 0; count = ts_node_child_count(node)) {
+        node = ts_node_child(node, count - 1);
+    }
+    return node;
+}
+
+// 소스 순서상 바로 앞의 단말 (없으면 null 노드)
+TSNode PrevLeaf(TSNode node) {
+    for (;;) {
+        TSNode prev = ts_node_prev_sibling(node);
+        if (!ts_node_is_null(prev)) return LastLeaf(prev);
+        node = ts_node_parent(node);
+        if (ts_node_is_null(node)) return node;
+    }
+}
+
+}  // namespace
+
+void CollectLeafTokens(const TSTree *tree, const std::string &source, std::vector<TokenRef> &out) {
+    out.clear();
+    if (!tree) return;
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        const bool skip = ts_node_is_extra(node) || ts_node_is_missing(node);
+        if (!skip && ts_tree_cursor_goto_first_child(&cursor)) continue;
+
+        TokenRef token;
+        if (!skip && MakeToken(node, source, token)) out.push_back(token);
+
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return;
+            }
+        }
+    }
+}
+
+void PrecedingLeafTokens(const TSTree *tree, const std::string &source, uint32_t byte_offset,
+                         size_t n, std::vector<TokenRef> &out) {
+    out.clear();
+    if (!tree || byte_offset == 0) return;
+
+    // 커서를 덮는 가장 깊은 노드까지 내려간 뒤, 그 앞의 단말에서 역방향으로 걷는다
+    TSNode node = ts_tree_root_node(tree);
+    TSTreeCursor cursor = ts_tree_cursor_new(node);
+    TSNode before;
+    for (;;) {
+        if (ts_node_child_count(node) == 0) {
+            before = ts_node_end_byte(node) <= byte_offset ? node : PrevLeaf(node);
+            break;
+        }
+        if (ts_tree_cursor_goto_first_child_for_byte(&cursor, byte_offset) < 0) {
+            before = LastLeaf(node);  // 모든 자식이 커서 이전에서 끝남
+            break;
+        }
+        TSNode child = ts_tree_cursor_current_node(&cursor);
+        if (ts_node_start_byte(child) < byte_offset) {
+            node = child;
+            continue;
+        }
+        before = PrevLeaf(child);
+        break;
+    }
+    ts_tree_cursor_delete(&cursor);
+
+    TokenRef token;
+    while (!ts_node_is_null(before) && out.size() < n) {
+        if (MakeToken(before, source, token)) out.push_back(token);
+        before = PrevLeaf(before);
+    }
+}
+
+// =============================================================================
+// [TokenCounts] 메모리 내 빈도 테이블
+// =============================================================================
+uint32_t TokenCounts::Intern(const TokenRef &token) {
+    const uint32_t length = token.length > kMaxTokenText ? 0 : token.length;
+    std::string key(reinterpret_cast<const char *>(&token.symbol), sizeof(token.symbol));
+    key.append(token.text, length);
+    auto it = vocab_ids_.find(key);
+    if (it != vocab_ids_.end()) return it->second;
+    const uint32_t id = static_cast<uint32_t>(vocab_.size());
+    vocab_.push_back({token.symbol, std::string(token.text, length)});
+    vocab_ids_.emplace(std::move(key), id);
+    return id;
+}
+
+void TokenCounts::AddSequence(const std::vector<TokenRef> &tokens) {
+    for (size_t i = 0; i < tokens.size(); i++) {
+        const uint32_t id = Intern(tokens[i]);
+        contexts_[token_context::Symbol(tokens[i].symbol)][id]++;
+        if (i >= 1) contexts_[token_context::Bigram(tokens[i - 1])][id]++;
+        if (i >= 2) contexts_[token_context::Trigram(tokens[i - 2], tokens[i - 1])][id]++;
+    }
+    total_tokens_ += tokens.size();
+}
+
+void TokenCounts::Merge(const TokenCounts &other) {
+    std::vector<uint32_t> remap(other.vocab_.size());
+    for (size_t i = 0; i < other.vocab_.size(); i++) {
+        const Vocab &v = other.vocab_[i];
+        remap[i] = Intern({v.symbol, v.text.data(), static_cast<uint32_t>(v.text.size())});
+    }
+    for (const auto &ctx : other.contexts_) {
+        Successors &mine = contexts_[ctx.first];
+        for (const auto &s : ctx.second) mine[remap[s.first]] += s.second;
+    }
+    total_tokens_ += other.total_tokens_;
+}
+
+void TokenCounts::Clear() {
+    vocab_.clear();
+    vocab_ids_.clear();
+    contexts_.clear();
+    total_tokens_ = 0;
+}
+
+size_t TokenCounts::MemoryBytes() const {
+    constexpr size_t kNode = 2 * sizeof(void *);
+    size_t bytes = vocab_.capacity() * sizeof(Vocab);
+    for (const Vocab &v : vocab_) bytes += v.text.capacity();
+    bytes += vocab_ids_.size() * (sizeof(std::string) + sizeof(uint32_t) + kNode);
+    for (const auto &kv : contexts_) {
+        bytes += sizeof(kv) + kNode + kv.second.size() * (2 * sizeof(uint32_t) + kNode);
+    }
+    return bytes;
+}
+
+bool TokenCounts::Write(const std::string &path, uint32_t symbol_count, uint32_t min_count,
+                        uint32_t max_successors, uint32_t max_symbol_successors) const {
+    std::unordered_map<uint64_t, bool> symbol_contexts;
+    for (const Vocab &v : vocab_) symbol_contexts[token_context::Symbol(v.symbol)] = true;
+
+    struct PendingContext {
+        uint64_t hash;
+        uint32_t total;
+        std::vector<std::pair<uint32_t, uint32_t>> successors;  // (vocab id, count)
+    };
+    std::vector<PendingContext> pending;
+    std::vector<uint32_t> final_ids(vocab_.size(), UINT32_MAX);
+    uint32_t vocab_count = 0;
+
+    for (const auto &ctx : contexts_) {
+        const bool is_symbol = symbol_contexts.count(ctx.first) > 0;
+        uint64_t total = 0;
+        for (const auto &s : ctx.second) total += s.second;
+        if (!is_symbol && total < min_count) continue;
+
+        PendingContext pc{ctx.first, static_cast<uint32_t>(std::min<uint64_t>(total, UINT32_MAX)), {}};
+        for (const auto &s : ctx.second) {
+            if (!vocab_[s.first].text.empty()) pc.successors.emplace_back(s.first, s.second);
+        }
+        std::sort(pc.successors.begin(), pc.successors.end(), [](const auto &a, const auto &b) {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+        });
+        const size_t keep = is_symbol ? max_symbol_successors : max_successors;
+        if (pc.successors.size() > keep) pc.successors.resize(keep);
+        if (pc.successors.empty()) continue;
+        for (auto &s : pc.successors) {
+            if (final_ids[s.first] == UINT32_MAX) final_ids[s.first] = vocab_count++;
+            s.first = final_ids[s.first];
+        }
+        pending.push_back(std::move(pc));
+    }
+    std::sort(pending.begin(), pending.end(),
+              [](const PendingContext &a, const PendingContext &b) { return a.hash < b.hash; });
+
+    std::vector<VocabEntry> vocab(vocab_count);
+    std::string strings;
+    for (size_t i = 0; i < vocab_.size(); i++) {
+        if (final_ids[i] == UINT32_MAX) continue;
+        vocab[final_ids[i]] = {static_cast<uint32_t>(strings.size()),
+                               static_cast<uint16_t>(vocab_[i].text.size()), vocab_[i].symbol};
+        strings += vocab_[i].text;
+    }
+
+    std::vector<ContextEntry> contexts;
+    std::vector<SuccessorEntry> successors;
+    contexts.reserve(pending.size());
+    for (const PendingContext &pc : pending) {
+        contexts.push_back({pc.hash, static_cast<uint32_t>(successors.size()),
+                            static_cast<uint32_t>(pc.successors.size()), pc.total, 0});
+        for (const auto &s : pc.successors) successors.push_back({s.first, s.second});
+    }
+
+    Header header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.symbol_count = symbol_count;
+    header.vocab_count = vocab_count;
+    header.context_count = static_cast<uint32_t>(contexts.size());
+    header.successor_count = static_cast<uint32_t>(successors.size());
+    header.string_bytes = static_cast<uint32_t>(strings.size());
+    header.reserved = 0;
+    header.total_tokens = total_tokens_;
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return false;
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(vocab.data()), vocab.size() * sizeof(VocabEntry));
+    out.write(reinterpret_cast<const char *>(contexts.data()), contexts.size() * sizeof(ContextEntry));
+    out.write(reinterpret_cast<const char *>(successors.data()), successors.size() * sizeof(SuccessorEntry));
+    out.write(strings.data(), strings.size());
+    return static_cast<bool>(out);
+}
+
+// =============================================================================
+// [TokenModel] 메모리 매핑 로더
+// =============================================================================
+TokenModel::~TokenModel() {
+    Close();
+}
+
+void TokenModel::Close() {
+    if (!base_) return;
+#ifdef _WIN32
+    UnmapViewOfFile(base_);
+    CloseHandle(static_cast<HANDLE>(mapping_));
+    CloseHandle(static_cast<HANDLE>(file_));
+    mapping_ = nullptr;
+    file_ = nullptr;
+#else
+    munmap(const_cast<unsigned char *>(base_), size_);
+#endif
+    base_ = nullptr;
+    size_ = 0;
+    header_ = nullptr;
+}
+
+bool TokenModel::Open(const std::string &path, uint32_t expected_symbol_count, std::string &error) {
+    Close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) { error = "cannot open " + path; return false; }
+    LARGE_INTEGER file_size;
+    GetFileSizeEx(file, &file_size);
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    const void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        error = "cannot map " + path;
+        return false;
+    }
+    file_ = file;
+    mapping_ = mapping;
+    base_ = static_cast<const unsigned char *>(view);
+    size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) { error = "cannot open " + path; return false; }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        error = "cannot stat " + path;
+        return false;
+    }
+    void *view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) { error = "cannot map " + path; return false; }
+    base_ = static_cast<const unsigned char *>(view);
+    size_ = static_cast<size_t>(st.st_size);
+#endif
+
+    header_ = reinterpret_cast<const Header *>(base_);
+    if (!Validate(expected_symbol_count, error)) {
+        Close();
+        return false;
+    }
+    vocab_ = reinterpret_cast<const VocabEntry *>(base_ + sizeof(Header));
+    contexts_ = reinterpret_cast<const ContextEntry *>(vocab_ + header_->vocab_count);
+    successors_ = reinterpret_cast<const SuccessorEntry *>(contexts_ + header_->context_count);
+    strings_ = reinterpret_cast<const char *>(successors_ + header_->successor_count);
+    return true;
+}
+
+// 헤더와 섹션 표만 본다 (첫 페이지만 읽음). 항목 안의 참조는 Lookup이 읽을 때 검사한다
+bool TokenModel::Validate(uint32_t expected_symbol_count, std::string &error) const {
+    if (size_ < sizeof(Header) || std::memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0) {
+        error = "bad magic";
+        return false;
+    }
+    if (header_->symbol_count != expected_symbol_count) {
+        error = "symbol count mismatch (model built for a different grammar)";
+        return false;
+    }
+    const uint64_t expected = sizeof(Header) + uint64_t{header_->vocab_count} * sizeof(VocabEntry) +
+                              uint64_t{header_->context_count} * sizeof(ContextEntry) +
+                              uint64_t{header_->successor_count} * sizeof(SuccessorEntry) + header_->string_bytes;
+    if (size_ < expected) {
+        error = "truncated file";
+        return false;
+    }
+    return true;
+}
+
+uint32_t TokenModel::Lookup(uint64_t context, std::vector<Successor> &out) const {
+    out.clear();
+    if (!header_) return 0;
+    const ContextEntry *end = contexts_ + header_->context_count;
+    const ContextEntry *it = std::lower_bound(contexts_, end, context,
+                                              [](const ContextEntry &e, uint64_t h) { return e.hash < h; });
+    if (it == end || it->hash != context) return 0;
+    // 파일은 열 때 전체를 검사하지 않으므로 읽는 항목만 섹션 범위를 확인한다
+    if (static_cast<uint64_t>(it->first) + it->count > header_->successor_count) return 0;
+    for (uint32_t i = 0; i < it->count; i++) {
+        const SuccessorEntry &s = successors_[it->first + i];
+        if (s.token >= header_->vocab_count) continue;
+        const VocabEntry &v = vocab_[s.token];
+        if (static_cast<uint64_t>(v.text_offset) + v.text_length > header_->string_bytes ||
+            v.symbol >= header_->symbol_count) {
+            continue;
+        }
+        out.push_back({v.symbol, strings_ + v.text_offset, v.text_length, s.count});
+    }
+    return it->total;
+}
+
+// =============================================================================
+// [TokenProposer] 빔 탐색
+// - 점수: 컨텍스트별 p = (c_model + λ·c_overlay) / (t_model + λ·t_overlay)
+//         trigram 1.0, bigram 0.4, symbol 0.16 가중치 중 최댓값 (stupid backoff)
+// =============================================================================
+void TokenProposer::Score(uint64_t context, double weight, const std::vector<TSSymbol> &allowed,
+                          std::vector<Candidate> &out) const {
+    auto is_allowed = [&](TSSymbol symbol) {
+        return std::find(allowed.begin(), allowed.end(), symbol) != allowed.end();
+    };
+
+    // 모델과 오버레이의 같은 (심볼, 텍스트)는 scratch_에 모아 정렬한 뒤 이웃끼리 합친다
+    scratch_.clear();
+    double total = 0;
+    if (model_ && model_->is_open()) {
+        total += model_->Lookup(context, successors_);
+        for (const auto &s : successors_) {
+            if (s.length > 0 && is_allowed(s.symbol)) {
+                scratch_.push_back({s.symbol, std::string_view(s.text, s.length), static_cast<double>(s.count)});
+            }
+        }
+    }
+    for (const TokenCounts *overlay : overlays_) {
+        const TokenCounts::Successors *successors = overlay->Find(context);
+        if (!successors) continue;
+        for (const auto &s : *successors) {
+            total += overlay_weight_ * s.second;
+            const TokenCounts::Vocab &v = overlay->vocab(s.first);
+            if (!v.text.empty() && is_allowed(v.symbol)) {
+                scratch_.push_back({v.symbol, v.text, overlay_weight_ * s.second});
+            }
+        }
+    }
+    if (total <= 0) return;
+
+    std::sort(scratch_.begin(), scratch_.end(), [](const Candidate &a, const Candidate &b) {
+        return a.symbol != b.symbol ? a.symbol < b.symbol : a.text < b.text;
+    });
+    for (size_t i = 0; i < scratch_.size();) {
+        Candidate c = scratch_[i];
+        for (i++; i < scratch_.size() && scratch_[i].symbol == c.symbol && scratch_[i].text == c.text; i++) {
+            c.prob += scratch_[i].prob;
+        }
+        c.prob = weight * c.prob / total;
+        auto it = std::find_if(out.begin(), out.end(), [&](const Candidate &o) {
+            return o.symbol == c.symbol && o.text == c.text;
+        });
+        if (it == out.end()) {
+            out.push_back(c);
+        } else if (it->prob < c.prob) {
+            it->prob = c.prob;
+        }
+    }
+}
+
+bool TokenProposer::SeenAsLeaf(const std::vector<TSSymbol> &symbols) const {
+    for (TSSymbol symbol : symbols) {
+        const uint64_t context = token_context::Symbol(symbol);
+        if (model_ && model_->is_open() && model_->Lookup(context, successors_) > 0) return true;
+        for (const TokenCounts *overlay : overlays_) {
+            if (overlay->Find(context)) return true;
+        }
+    }
+    return false;
+}
+
+bool TokenProposer::Propose(const std::vector<TokenRef> &context, const std::vector<TokenSlot> &slots,
+                            size_t beam_width, TokenProposal &out, const LrSimulator *constraint) const {
+    struct Beam {
+        TSSymbol symbols[2] = {0, 0};  // [0] = 직전 토큰, [1] = 그 앞
+        std::string texts[2];
+        int depth = 0;                 // 유효한 직전 토큰 수 (0..2)
+        TokenProposal proposal;
+        std::optional<LrSimulator> lr; // 제약이 있으면 빔마다 파싱 스택을 따로 진행
+
+        void Push(TSSymbol symbol, std::string_view text) {
+            symbols[1] = symbols[0];
+            texts[1] = std::move(texts[0]);
+            symbols[0] = symbol;
+            texts[0].assign(text.data(), text.size());
+            depth = std::min(depth + 1, 2);
+        }
+        TokenRef Ref(int i) const {
+            return {symbols[i], texts[i].data(), static_cast<uint32_t>(texts[i].size())};
+        }
+    };
+
+    beam_width = std::max<size_t>(1, beam_width);
+    std::vector<Beam> beams(1);
+    for (size_t i = std::min<size_t>(context.size(), 2); i-- > 0;) {
+        beams[0].Push(context[i].symbol, std::string_view(context[i].text, context[i].length));
+    }
+    if (constraint) beams[0].lr = *constraint;
+
+    std::vector<Candidate> candidates;
+    for (const TokenSlot &slot : slots) {
+        if (!slot.fixed_text.empty()) {
+            // 같은 이름의 익명 심볼이 여럿이면 파서가 받아들이는 쪽을 쓴다
+            std::vector<Beam> next;
+            for (Beam &beam : beams) {
+                TSSymbol symbol = slot.symbols.empty() ? 0 : slot.symbols[0];
+                if (beam.lr) {
+                    auto it = std::find_if(slot.symbols.begin(), slot.symbols.end(),
+                                           [&](TSSymbol s) { return beam.lr->Accepts(s); });
+                    if (it == slot.symbols.end()) continue;
+                    symbol = *it;
+                    beam.lr->Feed(symbol);
+                }
+                beam.proposal.tokens.push_back(slot.fixed_text);
+                beam.Push(symbol, slot.fixed_text);
+                next.push_back(std::move(beam));
+            }
+            if (next.empty()) return false;
+            beams = std::move(next);
+            continue;
+        }
+
+        const std::vector<TSSymbol> &allowed = SeenAsLeaf(slot.symbols) ? slot.symbols : slot.expansion;
+        std::vector<Beam> next;
+        for (const Beam &beam : beams) {
+            candidates.clear();
+            if (beam.depth >= 2) Score(token_context::Trigram(beam.Ref(1), beam.Ref(0)), 1.0, allowed, candidates);
+            if (beam.depth >= 1) Score(token_context::Bigram(beam.Ref(0)), 0.4, allowed, candidates);
+            for (TSSymbol symbol : allowed) Score(token_context::Symbol(symbol), 0.16, allowed, candidates);
+
+            std::sort(candidates.begin(), candidates.end(),
+                      [](const Candidate &a, const Candidate &b) { return a.prob > b.prob; });
+            size_t taken = 0;
+            for (const Candidate &c : candidates) {
+                if (taken == beam_width) break;
+                if (beam.lr && !beam.lr->Accepts(c.symbol)) continue;  // 문법상 올 수 없는 토큰은 마스킹
+                Beam expanded = beam;
+                if (expanded.lr) expanded.lr->Feed(c.symbol);
+                expanded.proposal.tokens.emplace_back(c.text);
+                expanded.proposal.log_prob += std::log(c.prob);
+                expanded.Push(c.symbol, c.text);
+                next.push_back(std::move(expanded));
+                taken++;
+            }
+        }
+        if (next.empty()) return false;
+        std::sort(next.begin(), next.end(), [](const Beam &a, const Beam &b) {
+            return a.proposal.log_prob > b.proposal.log_prob;
+        });
+        if (next.size() > beam_width) next.resize(beam_width);
+        beams = std::move(next);
+    }
+
+    out = std::move(beams[0].proposal);
+    return true;
+}
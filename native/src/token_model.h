@@ -0,0 +1,189 @@
+/**
+ * @file token_model.h
+ * @brief 트리 단말 토큰열 위의 n-gram 빈도 모델 (메모리 매핑 파일 + 워크스페이스 오버레이)
+ *
+ * 구조 후보("ID = Expr")의 슬롯을 구체 토큰으로 채울 때 LLM 대신 쓰는 경량 모델이다.
+ * 토큰은 (문법 심볼, 텍스트) 쌍이고, 컨텍스트는 세 종류를 해시 키로 구분한다.
+ *   - 직전 토큰 2개 (trigram), 직전 토큰 1개 (bigram)
+ *   - 대상 심볼 자체 (해당 심볼의 빈도 상위 텍스트, 항상 존재하는 최후 백오프)
+ *
+ * 파일 형식 (리틀엔디언, 모든 섹션 8바이트 정렬):
+ *   Header
+ *   VocabEntry[vocab_count]          (text_offset, text_length, symbol)
+ *   ContextEntry[context_count]      hash 오름차순 → 이진 탐색
+ *   Successor[successor_count]       컨텍스트별로 빈도 내림차순
+ *   char strings[string_bytes]
+ * 파일은 읽기 전용으로 매핑해서 그대로 쓴다. 열 때는 헤더와 섹션 표(개수 × 항목 크기가 파일 안인지)만
+ * 확인해 페이지를 건드리지 않고, 항목 안의 오프셋/인덱스는 조회(Lookup)가 읽는 항목만 그때 검사한다
+ * (범위를 벗어난 항목은 없는 것으로 친다).
+ *
+ * 심볼 ID는 같은 빌드의 문법 기준이므로 헤더의 symbol_count로 짝이 맞는지 확인한다.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tree_sitter/api.h"
+#include "lr_simulator.h"
+
+// 이보다 긴 토큰(긴 문자열 리터럴 등)은 텍스트 없이 심볼로만 취급한다
+constexpr size_t kMaxTokenText = 48;
+
+struct TokenRef {
+    TSSymbol symbol;
+    const char *text;
+    uint32_t length;
+};
+
+// 트리의 단말 노드를 소스 순서대로 수집 (extra/missing 제외, 심볼은 별칭 전 문법 심볼)
+void CollectLeafTokens(const TSTree *tree, const std::string &source, std::vector<TokenRef> &out);
+
+// byte_offset 이전에서 끝나는 단말 토큰을 가까운 것부터 최대 n개 (out[0]이 가장 가까움)
+void PrecedingLeafTokens(const TSTree *tree, const std::string &source, uint32_t byte_offset,
+                         size_t n, std::vector<TokenRef> &out);
+
+namespace token_file {
+struct Header;
+struct VocabEntry;
+struct ContextEntry;
+struct SuccessorEntry;
+}  // namespace token_file
+
+namespace token_context {
+uint64_t Trigram(const TokenRef &prev2, const TokenRef &prev1);
+uint64_t Bigram(const TokenRef &prev1);
+uint64_t Symbol(TSSymbol symbol);
+}  // namespace token_context
+
+// =============================================================================
+// 메모리 내 빈도 테이블 — 학습 도구와 워크스페이스 오버레이가 함께 쓴다
+// =============================================================================
+class TokenCounts {
+public:
+    struct Vocab {
+        TSSymbol symbol;
+        std::string text;
+    };
+    using Successors = std::unordered_map<uint32_t, uint32_t>;  // vocab id → count
+
+    void AddSequence(const std::vector<TokenRef> &tokens);
+    void Merge(const TokenCounts &other);
+    void Clear();
+
+    const Successors *Find(uint64_t context) const {
+        auto it = contexts_.find(context);
+        return it == contexts_.end() ? nullptr : &it->second;
+    }
+    const Vocab &vocab(uint32_t id) const { return vocab_[id]; }
+    uint64_t total_tokens() const { return total_tokens_; }
+    size_t context_count() const { return contexts_.size(); }
+    // 대략적인 바이트 수 (해시 노드는 항목당 고정 비용으로 근사)
+    size_t MemoryBytes() const;
+
+    // n-gram 컨텍스트는 총 빈도 min_count 미만을 버리고, 컨텍스트마다 상위 successor만 남긴다
+    bool Write(const std::string &path, uint32_t symbol_count, uint32_t min_count,
+               uint32_t max_successors, uint32_t max_symbol_successors) const;
+
+private:
+    uint32_t Intern(const TokenRef &token);
+
+    std::vector<Vocab> vocab_;
+    std::unordered_map<std::string, uint32_t> vocab_ids_;  // symbol(2바이트) + text
+    std::unordered_map<uint64_t, Successors> contexts_;
+    uint64_t total_tokens_ = 0;
+};
+
+// =============================================================================
+// 메모리 매핑된 읽기 전용 모델
+// =============================================================================
+class TokenModel {
+public:
+    struct Successor {
+        TSSymbol symbol;
+        const char *text;
+        uint32_t length;
+        uint32_t count;
+    };
+
+    TokenModel() = default;
+    ~TokenModel();
+    TokenModel(const TokenModel &) = delete;
+    TokenModel &operator=(const TokenModel &) = delete;
+
+    bool Open(const std::string &path, uint32_t expected_symbol_count, std::string &error);
+    void Close();
+    bool is_open() const { return base_ != nullptr; }
+
+    // 컨텍스트의 successor를 빈도 내림차순으로 돌려준다. 없으면 total = 0.
+    uint32_t Lookup(uint64_t context, std::vector<Successor> &out) const;
+
+private:
+    bool Validate(uint32_t expected_symbol_count, std::string &error) const;
+
+    const unsigned char *base_ = nullptr;
+    size_t size_ = 0;
+    const token_file::Header *header_ = nullptr;
+    const token_file::VocabEntry *vocab_ = nullptr;
+    const token_file::ContextEntry *contexts_ = nullptr;
+    const token_file::SuccessorEntry *successors_ = nullptr;
+    const char *strings_ = nullptr;
+#ifdef _WIN32
+    void *file_ = nullptr;
+    void *mapping_ = nullptr;
+#endif
+};
+
+// =============================================================================
+// 구조 후보 → 구체 토큰열 제안 (빔 탐색)
+// =============================================================================
+struct TokenSlot {
+    std::string fixed_text;         // 비어 있지 않으면 그대로 출력 (익명 토큰: "=", "(" ...)
+    std::vector<TSSymbol> symbols;  // 허용 단말 심볼. 고정 토큰이면 symbols[0]이 그 토큰의 심볼
+    // symbols가 단말로 관측된 적이 없으면(Expr 같은 비단말) 한 토큰으로 펼칠 대체 심볼
+    std::vector<TSSymbol> expansion;
+};
+
+struct TokenProposal {
+    std::vector<std::string> tokens;
+    double log_prob = 0;
+};
+
+class TokenProposer {
+public:
+    // overlays는 워크스페이스(열린 문서) 빈도. 파일 모델보다 overlay_weight배 무겁게 센다.
+    TokenProposer(const TokenModel *model, std::vector<const TokenCounts *> overlays,
+                  double overlay_weight = 4.0)
+        : model_(model), overlays_(std::move(overlays)), overlay_weight_(overlay_weight) {}
+
+    // context[0]이 커서에 가장 가까운 토큰. 채울 수 없는 슬롯이 있으면 false.
+    // constraint가 있으면 그 파싱 스택이 받아들이지 않는 토큰은 후보에서 뺀다.
+    bool Propose(const std::vector<TokenRef> &context, const std::vector<TokenSlot> &slots,
+                 size_t beam_width, TokenProposal &out, const LrSimulator *constraint = nullptr) const;
+
+private:
+    // text는 매핑된 모델 파일이나 오버레이 어휘를 가리킨다 (Propose 동안 살아 있음)
+    struct Candidate {
+        TSSymbol symbol;
+        std::string_view text;
+        double prob;
+    };
+
+    void Score(uint64_t context, double weight, const std::vector<TSSymbol> &allowed,
+               std::vector<Candidate> &out) const;
+    bool SeenAsLeaf(const std::vector<TSSymbol> &symbols) const;
+
+    const TokenModel *model_;
+    std::vector<const TokenCounts *> overlays_;
+    double overlay_weight_;
+
+    // Score/SeenAsLeaf가 호출마다 다시 쓰는 작업 버퍼 (한 번 커진 뒤로는 할당하지 않는다)
+    mutable std::vector<TokenModel::Successor> successors_;
+    mutable std::vector<Candidate> scratch_;
+};
@@ -0,0 +1,223 @@
+/**
+ * @file token_stream.cc
+ * @brief TokenStream 구현
+ */
+
+#include "token_stream.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace {
+
+bool Intersects(uint32_t a_start, uint32_t a_end, uint32_t b_start, uint32_t b_end) {
+    return a_end > b_start && a_start < b_end;
+}
+
+// column[first, last)를 fresh로 바꾼다. 길이가 같은 부분은 제자리에 덮어써서 뒤쪽을 옮기지 않는다
+template <typename T>
+void SpliceColumn(std::vector<T> &column, size_t first, size_t last, const std::vector<T> &fresh) {
+    const size_t overwrite = std::min(last - first, fresh.size());
+    std::copy(fresh.begin(), fresh.begin() + overwrite, column.begin() + first);
+    if (fresh.size() > overwrite) {
+        column.insert(column.begin() + last, fresh.begin() + overwrite, fresh.end());
+    } else {
+        column.erase(column.begin() + first + overwrite, column.begin() + last);
+    }
+}
+
+}  // namespace
+
+// [start, end)와 겹치는 노드만 내려가며 단말을 수집한다. extra는 통째로 한 토큰.
+// 분류 노드 안에서는 그 분류를 플래그에 싣는다 (호출측이 구간을 분류 노드 경계로 넓혀 둔다)
+void TokenStream::Collect(TSNode root, uint32_t start, uint32_t end, Columns &out) const {
+    constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+    uint32_t depth = 0;
+    uint32_t class_depth = kNone;  // 들어가 있는 분류 노드의 깊이
+    uint8_t class_flags = 0;       // 그 분류 (+ 아직 첫 토큰을 내보내지 않았으면 kClassStart)
+
+    TSTreeCursor cursor = ts_tree_cursor_new(root);
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        const uint32_t node_start = ts_node_start_byte(node);
+        const uint32_t node_end = ts_node_end_byte(node);
+
+        if (Intersects(node_start, node_end, start, end) && !ts_node_is_missing(node)) {
+            if (class_depth == kNone && ts_node_is_named(node)) {
+                const SymbolClass kind = classifier_.Classify(ts_node_symbol(node));
+                if (kind != SymbolClass::Other) {
+                    class_depth = depth;
+                    class_flags = static_cast<uint8_t>(kClassStart | (static_cast<uint8_t>(kind) << kClassShift));
+                }
+            }
+            const bool extra = ts_node_is_extra(node);
+            if (extra || ts_node_child_count(node) == 0) {
+                if (node_end > node_start && !ts_node_is_error(node)) {
+                    out.symbols.push_back(ts_node_grammar_symbol(node));
+                    out.starts.push_back(node_start);
+                    out.lengths.push_back(node_end - node_start);
+                    out.flags.push_back(static_cast<uint8_t>((extra ? kExtra : 0) | class_flags));
+                    class_flags &= static_cast<uint8_t>(~kClassStart);
+                }
+            } else if (ts_tree_cursor_goto_first_child_for_byte(&cursor, start) >= 0) {
+                depth++;
+                continue;
+            }
+        }
+
+        // 다음 형제로. 형제가 구간을 벗어나면 부모로 올라간다. 분류 노드를 벗어나면 분류를 내린다.
+        for (;;) {
+            if (class_depth == depth) {
+                class_depth = kNone;
+                class_flags = 0;
+            }
+            if (ts_tree_cursor_goto_next_sibling(&cursor)) {
+                if (ts_node_start_byte(ts_tree_cursor_current_node(&cursor)) < end) break;
+            }
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return;
+            }
+            depth--;
+        }
+    }
+}
+
+void TokenStream::ExtendToClassified(TSNode root, uint32_t byte, uint32_t &start, uint32_t &end) const {
+    TSNode outer = {};
+    bool found = false;
+    for (TSNode node = ts_node_descendant_for_byte_range(root, byte, byte); !ts_node_is_null(node);
+         node = ts_node_parent(node)) {
+        if (ts_node_is_named(node) && !ts_node_is_missing(node) &&
+            classifier_.Classify(ts_node_symbol(node)) != SymbolClass::Other) {
+            outer = node;
+            found = true;
+        }
+    }
+    if (!found) return;
+    start = std::min(start, ts_node_start_byte(outer));
+    end = std::max(end, ts_node_end_byte(outer));
+}
+
+void TokenStream::Rebuild(const TSTree *tree) {
+    tokens_.clear();
+    if (!tree) return;
+    Collect(ts_tree_root_node(tree), 0, std::numeric_limits<uint32_t>::max(), tokens_);
+}
+
+void TokenStream::Clear() {
+    tokens_ = Columns();  // 용량까지 반환
+}
+
+size_t TokenStream::FirstEndingAfter(uint32_t byte) const {
+    size_t lo = 0, hi = size();
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (tokens_.starts[mid] + tokens_.lengths[mid] <= byte) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+void TokenStream::Range(uint32_t start, uint32_t end, size_t &first, size_t &last) const {
+    first = FirstEndingAfter(start);
+    last = static_cast<size_t>(
+        std::lower_bound(tokens_.starts.begin() + first, tokens_.starts.end(), end) - tokens_.starts.begin());
+}
+
+void TokenStream::Splice(size_t first, size_t last, const Columns &fresh) {
+    SpliceColumn(tokens_.symbols, first, last, fresh.symbols);
+    SpliceColumn(tokens_.starts, first, last, fresh.starts);
+    SpliceColumn(tokens_.lengths, first, last, fresh.lengths);
+    SpliceColumn(tokens_.flags, first, last, fresh.flags);
+}
+
+void TokenStream::Update(const TSInputEdit &edit, const TSRange *ranges, uint32_t range_count,
+                         const TSTree *tree) {
+    if (!tree) {
+        tokens_.clear();
+        return;
+    }
+
+    // 1) 편집 구간과 겹친 토큰 [overlap_first, overlap_last)는 편집 시작 위치의 빈 토큰으로 접고
+    //    (정렬이 유지되어 이진 탐색이 그대로 맞는다), 뒤쪽 토큰은 시작 바이트만 차이만큼 이동. 열은 옮기지 않는다
+    const size_t overlap_first = FirstEndingAfter(edit.start_byte);
+    const size_t overlap_last = static_cast<size_t>(
+        std::lower_bound(tokens_.starts.begin() + overlap_first, tokens_.starts.end(), edit.old_end_byte) -
+        tokens_.starts.begin());
+    for (size_t i = overlap_first; i < overlap_last; i++) {
+        tokens_.starts[i] = edit.start_byte;
+        tokens_.lengths[i] = 0;
+    }
+    const uint32_t delta = edit.new_end_byte - edit.old_end_byte;  // 음수면 모듈러 덧셈으로 같은 결과
+    for (size_t i = overlap_last; i < tokens_.starts.size(); i++) tokens_.starts[i] += delta;
+
+    // 2) 다시 수집할 구간: 편집 구간 + 변경 구간. 인접 토큰이 합쳐지는 경우를 위해 1바이트씩 넓힌다.
+    std::vector<std::pair<uint32_t, uint32_t>> dirty;
+    dirty.emplace_back(edit.start_byte, edit.new_end_byte);
+    for (uint32_t i = 0; i < range_count; i++) {
+        dirty.emplace_back(ranges[i].start_byte, ranges[i].end_byte);
+    }
+    const TSNode root = ts_tree_root_node(tree);
+    for (auto &d : dirty) {
+        d.first = d.first > 0 ? d.first - 1 : 0;
+        d.second = d.second + 1;
+        // 경계에 걸친 분류 노드는 통째로 (kClassStart가 구간 밖 토큰에 남지 않도록)
+        ExtendToClassified(root, d.first, d.first, d.second);
+        ExtendToClassified(root, d.second - 1, d.first, d.second);
+    }
+    std::sort(dirty.begin(), dirty.end());
+    std::vector<std::pair<uint32_t, uint32_t>> merged;
+    for (const auto &d : dirty) {
+        if (!merged.empty() && d.first <= merged.back().second) {
+            merged.back().second = std::max(merged.back().second, d.second);
+        } else {
+            merged.push_back(d);
+        }
+    }
+
+    // 3) 구간마다 한 번만 Splice. 뒤쪽 구간부터 바꿔서 앞쪽 인덱스(접어 둔 토큰 포함)가 그대로 유효하다.
+    //    토큰 수가 같으면(대부분의 타이핑) 제자리 덮어쓰기로 끝나 뒤쪽 열이 움직이지 않는다
+    Columns fresh;
+    for (auto range = merged.rbegin(); range != merged.rend(); ++range) {
+        size_t from, to;
+        Range(range->first, range->second, from, to);
+        if (range->first <= edit.start_byte && edit.start_byte < range->second) {
+            // 편집 구간을 담은 구간: 접어 둔 토큰은 길이가 0이라 구간 시작이 0일 때 Range에서 빠질 수 있다
+            from = std::min(from, overlap_first);
+            to = std::max(to, overlap_last);
+        }
+        fresh.clear();
+        Collect(root, range->first, range->second, fresh);
+        // 구간 경계에 걸친 토큰은 이미 남아 있을 수 있으므로 겹치는 것만 교체
+        Splice(from, to, fresh);
+    }
+}
+
+// 세션 텍스트 안에 있는 extra 아닌 토큰 (토큰열이 텍스트보다 앞서 있으면 건너뛴다)
+bool TokenStream::Usable(size_t i, const std::string &text) const {
+    return !(tokens_.flags[i] & kExtra) && tokens_.starts[i] + tokens_.lengths[i] <= text.size();
+}
+
+void TokenStream::Refs(const std::string &text, std::vector<TokenRef> &out) const {
+    out.clear();
+    out.reserve(size());
+    for (size_t i = 0; i < size(); i++) {
+        if (!Usable(i, text)) continue;
+        out.push_back({tokens_.symbols[i], text.data() + tokens_.starts[i], tokens_.lengths[i]});
+    }
+}
+
+void TokenStream::Preceding(const std::string &text, uint32_t byte_offset, size_t n,
+                            std::vector<TokenRef> &out) const {
+    out.clear();
+    for (size_t i = FirstEndingAfter(byte_offset); i > 0 && out.size() < n; i--) {
+        const size_t k = i - 1;
+        if (!Usable(k, text)) continue;
+        out.push_back({tokens_.symbols[k], text.data() + tokens_.starts[k], tokens_.lengths[k]});
+    }
+}
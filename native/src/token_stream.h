@@ -0,0 +1,103 @@
+/**
+ * @file token_stream.h
+ * @brief 문서별 단말 토큰열 (struct-of-arrays, 보존 트리에서 증분 갱신)
+ *
+ * 토큰 빈도 오버레이, 커서 앞 문맥, JS 쪽 소비자(documentTokens)가 각자 트리를 다시 훑지 않도록
+ * 세션이 토큰열 하나를 유지한다. 열은 (문법 심볼, 시작 바이트, 길이, 플래그) 네 개의 배열로 나눠
+ * 한 열만 훑는 조회(위치 이진 탐색, 심볼 필터)가 캐시에 촘촘히 들어가고 JS로 열째 복사할 수 있다.
+ *
+ * 토큰 정의는 CollectLeafTokens(token_model.h)와 같다: 트리 단말, 별칭 전 문법 심볼,
+ * missing/ERROR/빈 단말 제외. 주석 등 extra는 내려가지 않고 통째로 한 토큰으로 넣되 kExtra로 표시한다.
+ *
+ * 플래그에는 토큰을 감싸는 가장 바깥 분류 노드(SymbolClassifier, 별칭 적용 심볼)의 분류도 넣는다.
+ * 분류 노드의 첫 토큰에 kClassStart가 붙으므로, kClassStart부터 같은 분류가 이어지는 토큰들이
+ * 그 노드 하나(식별자, 문자열 리터럴 전체 등)다. IdentifierIndex는 트리 대신 이 구간을 읽는다.
+ *
+ * 편집 시
+ *   1) 편집 구간과 겹친 토큰은 그 자리에서 빈 토큰으로 접고, 뒤쪽 토큰의 시작 바이트를 차이만큼 이동
+ *   2) 편집 구간 + ts_tree_get_changed_ranges 구간(1바이트씩 넓힘, 걸친 분류 노드 전체까지)을 합친 뒤
+ *   3) 합친 구간마다 트리에서 다시 수집한 토큰으로 한 번만 교체 (접어 둔 토큰도 이때 바뀐다)
+ * 교체는 길이가 같은 부분을 제자리에 덮어쓰므로, 토큰 수가 그대로인 편집은 시작 바이트 열 하나만
+ * 훑는다. 갱신 비용은 변경 범위와 뒤쪽 토큰 수에 비례한다.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tree_sitter/api.h"
+#include "symbol_classes.h"
+#include "token_model.h"
+
+class TokenStream {
+public:
+    enum Flag : uint8_t {
+        kExtra = 1u << 0,       // 주석 등 (문법 토큰열에는 없는 토큰)
+        kClassStart = 1u << 1,  // 분류 노드의 첫 토큰
+        kClassShift = 2,        // 비트 2-3: 감싸는 분류 노드의 SymbolClass (Other면 0)
+        kClassMask = 3u << kClassShift,
+    };
+
+    static SymbolClass Class(uint8_t flags) { return static_cast<SymbolClass>((flags & kClassMask) >> kClassShift); }
+
+    explicit TokenStream(const SymbolClassifier &classifier) : classifier_(classifier) {}
+
+    // 트리 전체에서 다시 수집
+    void Rebuild(const TSTree *tree);
+
+    // edit은 이미 적용된 편집, ranges는 새 트리 기준 변경 구간
+    void Update(const TSInputEdit &edit, const TSRange *ranges, uint32_t range_count, const TSTree *tree);
+
+    // 저장 공간까지 반환 (세션 축출)
+    void Clear();
+
+    size_t size() const { return tokens_.starts.size(); }
+    const TSSymbol *symbols() const { return tokens_.symbols.data(); }
+    const uint32_t *starts() const { return tokens_.starts.data(); }
+    const uint32_t *lengths() const { return tokens_.lengths.data(); }
+    const uint8_t *flags() const { return tokens_.flags.data(); }
+
+    // [start, end) 바이트와 겹치는 토큰의 인덱스 구간 [first, last)
+    void Range(uint32_t start, uint32_t end, size_t &first, size_t &last) const;
+
+    // extra를 뺀 토큰 전체 (CollectLeafTokens와 같은 결과, text는 세션 텍스트)
+    void Refs(const std::string &text, std::vector<TokenRef> &out) const;
+    // byte_offset 이전에서 끝나는 extra 아닌 토큰을 가까운 것부터 최대 n개 (PrecedingLeafTokens와 같은 결과)
+    void Preceding(const std::string &text, uint32_t byte_offset, size_t n, std::vector<TokenRef> &out) const;
+
+    size_t MemoryBytes() const {
+        return tokens_.symbols.capacity() * sizeof(TSSymbol) + tokens_.starts.capacity() * sizeof(uint32_t) +
+               tokens_.lengths.capacity() * sizeof(uint32_t) + tokens_.flags.capacity();
+    }
+
+private:
+    struct Columns {
+        std::vector<TSSymbol> symbols;
+        std::vector<uint32_t> starts;   // 오름차순, 토큰끼리 겹치지 않음
+        std::vector<uint32_t> lengths;
+        std::vector<uint8_t> flags;
+
+        void clear() {
+            symbols.clear();
+            starts.clear();
+            lengths.clear();
+            flags.clear();
+        }
+    };
+
+    void Collect(TSNode root, uint32_t start, uint32_t end, Columns &out) const;
+    // byte를 감싸는 가장 바깥 분류 노드의 구간으로 [start, end)를 넓힌다 (없으면 그대로)
+    void ExtendToClassified(TSNode root, uint32_t byte, uint32_t &start, uint32_t &end) const;
+    // byte 이후에서 끝나는 첫 토큰 (끝 바이트도 오름차순)
+    size_t FirstEndingAfter(uint32_t byte) const;
+    // [first, last)를 fresh로 바꾼다 (네 열 모두)
+    void Splice(size_t first, size_t last, const Columns &fresh);
+    // Refs/Preceding이 내보내는 토큰인지 (extra 아님, text 범위 안)
+    bool Usable(size_t i, const std::string &text) const;
+
+    const SymbolClassifier &classifier_;
+    Columns tokens_;
+};
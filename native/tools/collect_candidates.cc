@@ -0,0 +1,274 @@
+/**
+ * @file collect_candidates.cc
+ * @brief 스트리밍 구조 후보 수집기 (유한 메모리, 멀티스레드)
+ *
+ * 코퍼스의 각 파일을 파싱하면서 ActionTracer로 reduce된 생성규칙을 관측하고,
+ * (state, 후보 토큰열) 빈도를 상태별 HeavyHitterSketch에 누적한다.
+ * 스레드마다 독립된 스케치를 쓰고 마지막에 병합하므로 락이 없다.
+ *
+ * 컨버전 파싱(ts_parser_parse_string_for_conversion)을 쓰지 않는 이유:
+ *   - 컨버전은 커서 하나에서 멈춘 스택(상태 경로)만 돌려주고 reduce된 생성규칙은 알려 주지 않는다.
+ *     파일의 모든 위치를 보려면 토큰마다 접두사를 다시 파싱해야 한다 (파일 길이의 제곱).
+ *   - 트레이서는 일반 파싱 한 번의 shift/reduce 로그로 같은 LR 스택을 재구성한다. 스택은 접두사만으로
+ *     정해지므로(결정적 LR), 커서 c에서의 컨버전 경로에 있는 상태 s는 트레이서 스택에서도 c 시점에 s이고,
+ *     s 위에 나중에 쌓여 reduce된 심볼열 "Yi .. Yn"이 바로 그 s에 기록된다. 런타임은 경로의 상태마다
+ *     후보를 조회하므로 수집 키와 조회 키가 같은 상태를 가리킨다. 커서 위치의 lookahead로 일어나는
+ *     reduce는 경로 맨 위 몇 칸만 바꾸는데, 트레이서는 reduce 전후의 모든 직전 상태에 관측을 남긴다.
+ *   - 둘이 갈라지는 것은 GLR 분기와 오류 복구뿐이다. 트레이서는 이때 broken()이 되어 그 파일의
+ *     나머지 관측을 버리고(통계의 broken files), 컨버전 경로 자체의 정확성은 <lang>_difftest가 확인한다.
+ *
+ * 출력은 resources/<lang>/candidates.json과 같은 형식이며,
+ * 상태별 오차 한계는 별도의 bounds 파일에 기록한다:
+ *     value <= 실제 빈도 <= value + error   (error <= total / (capacity + 1))
+ *
+ * 사용법:
+ *   <lang>_collect_candidates [--threads N] [--epsilon E | --capacity K] [--top T]
+ *                             [--ext .py ...] [--out candidates.json] [--bounds FILE]
+ *                             <file|dir> ...
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "tree_sitter/api.h"
+#include "lang_select.h"
+#include "action_trace.h"
+#include "heavy_hitters.h"
+#include "corpus.h"
+
+using StateSketches = std::unordered_map<TSStateId, HeavyHitterSketch<std::string>>;
+
+struct Options {
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t capacity = 256;
+    size_t top = 200;
+    std::vector<std::string> extensions;
+    std::string out_path = "candidates.json";
+    std::string bounds_path;
+    std::vector<std::string> inputs;
+};
+
+// =============================================================================
+// [수집] 스레드별 워커
+// =============================================================================
+// 반복 규칙의 균형 트리 생성규칙(X_repeat -> X_repeat X_repeat)은 후보로 의미가 없다
+static bool IsRepeatBalancing(const ActionTracer::ProductionEvent &ev) {
+    return ev.count == 2 && ev.rhs[0].symbol == ev.lhs && ev.rhs[1].symbol == ev.lhs &&
+           ev.lhs.find("_repeat") != std::string::npos;
+}
+
+static void CollectWorker(const std::vector<std::string> &files, std::atomic<size_t> &next,
+                          size_t capacity, StateSketches &sketches, std::atomic<size_t> &broken_files) {
+    const TSLanguage *language = GET_LANGUAGE();
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, language);
+
+    ActionTracer tracer(language);
+    tracer.Attach(parser);
+
+    std::string key;
+    tracer.OnProduction([&](const ActionTracer::ProductionEvent &ev) {
+        if (IsRepeatBalancing(ev)) return;
+        // 뒤에서부터 접미사를 만들어 가며 각 위치의 직전 상태에 관측을 기록
+        key.clear();
+        for (uint32_t i = ev.count; i-- > 0;) {
+            key = key.empty() ? ev.rhs[i].symbol : ev.rhs[i].symbol + " " + key;
+            const TSStateId before = i == 0 ? ev.state_before : ev.rhs[i - 1].state;
+            auto it = sketches.find(before);
+            if (it == sketches.end()) {
+                it = sketches.emplace(before, HeavyHitterSketch<std::string>(capacity)).first;
+            }
+            it->second.Offer(key);
+        }
+    });
+
+    std::string source;
+    for (size_t i = next++; i < files.size(); i = next++) {
+        if (!ReadCorpusFile(files[i], source)) {
+            std::cerr << "[Warning] 읽기 실패: " << files[i] << "\n";
+            continue;
+        }
+        tracer.Reset();
+        TSTree *tree = ts_parser_parse_string(parser, NULL, source.c_str(),
+                                              static_cast<uint32_t>(source.size()));
+        if (tracer.broken()) broken_files++;
+        if (tree) ts_tree_delete(tree);
+    }
+
+    ActionTracer::Detach(parser);
+    ts_parser_delete(parser);
+}
+
+// =============================================================================
+// [출력] candidates.json 형식 + 오차 한계
+// =============================================================================
+static void WriteJsonString(std::ostream &out, const std::string &s) {
+    out << '"';
+    for (unsigned char c : s) {
+        switch (c) {
+            case '"': out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\r': out << "\\r"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out << buf;
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+static bool WriteCandidates(const std::string &path, const std::map<TSStateId, const HeavyHitterSketch<std::string> *> &states,
+                            size_t top) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return false;
+    out << "{\n";
+    bool first_state = true;
+    for (const auto &kv : states) {
+        auto entries = kv.second->Top(top);
+        if (entries.empty()) continue;
+        out << (first_state ? "" : ",\n") << "  \"" << kv.first << "\": [";
+        first_state = false;
+        for (size_t i = 0; i < entries.size(); i++) {
+            out << (i ? ", " : "") << "{\"key\": ";
+            WriteJsonString(out, entries[i].key);
+            out << ", \"value\": " << entries[i].count << "}";
+        }
+        out << "]";
+    }
+    out << "\n}\n";
+    return static_cast<bool>(out);
+}
+
+static bool WriteBounds(const std::string &path, const std::map<TSStateId, const HeavyHitterSketch<std::string> *> &states,
+                        size_t capacity) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return false;
+    out << "{\n  \"capacity\": " << capacity << ",\n  \"states\": {";
+    bool first = true;
+    for (const auto &kv : states) {
+        out << (first ? "\n" : ",\n") << "    \"" << kv.first << "\": {\"total\": " << kv.second->total()
+            << ", \"error\": " << kv.second->decremented() << "}";
+        first = false;
+    }
+    out << "\n  }\n}\n";
+    return static_cast<bool>(out);
+}
+
+// =============================================================================
+// [main]
+// =============================================================================
+static void PrintUsage(const char *argv0) {
+    std::cerr << "Usage: " << argv0
+              << " [--threads N] [--epsilon E | --capacity K] [--top T] [--ext .x ...]"
+                 " [--out FILE] [--bounds FILE] <file|dir> ...\n";
+}
+
+int main(int argc, char **argv) {
+    Options opt;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char *v = nullptr;
+        if (arg == "--threads" && (v = value())) {
+            opt.threads = std::max(1, std::atoi(v));
+        } else if (arg == "--epsilon" && (v = value())) {
+            // 오차 한계 eps * N 을 보장하는 최소 카운터 수: k + 1 >= 1 / eps
+            const double eps = std::atof(v);
+            if (eps <= 0 || eps >= 1) { std::cerr << "--epsilon은 (0, 1) 범위여야 합니다\n"; return 1; }
+            opt.capacity = static_cast<size_t>(std::ceil(1.0 / eps)) - 1;
+        } else if (arg == "--capacity" && (v = value())) {
+            opt.capacity = static_cast<size_t>(std::max(1, std::atoi(v)));
+        } else if (arg == "--top" && (v = value())) {
+            opt.top = static_cast<size_t>(std::max(1, std::atoi(v)));
+        } else if (arg == "--ext" && (v = value())) {
+            opt.extensions.push_back(v);
+        } else if (arg == "--out" && (v = value())) {
+            opt.out_path = v;
+        } else if (arg == "--bounds" && (v = value())) {
+            opt.bounds_path = v;
+        } else if (arg == "-h" || arg == "--help") {
+            PrintUsage(argv[0]);
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            PrintUsage(argv[0]);
+            return 1;
+        } else {
+            opt.inputs.push_back(arg);
+        }
+    }
+    if (opt.inputs.empty()) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+    if (opt.bounds_path.empty()) opt.bounds_path = opt.out_path + ".bounds.json";
+
+    const std::vector<std::string> files = ListCorpusFiles(opt.inputs, opt.extensions);
+    std::cerr << "[Info] files=" << files.size() << " threads=" << opt.threads
+              << " capacity=" << opt.capacity << "\n";
+
+    std::vector<StateSketches> per_thread(opt.threads);
+    std::vector<std::thread> workers;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> broken_files{0};
+    for (unsigned t = 0; t < opt.threads; t++) {
+        workers.emplace_back(CollectWorker, std::cref(files), std::ref(next), opt.capacity,
+                             std::ref(per_thread[t]), std::ref(broken_files));
+    }
+    for (auto &w : workers) w.join();
+
+    // 스레드별 요약 병합 (Misra-Gries 병합은 오차 한계를 보존)
+    StateSketches &merged = per_thread[0];
+    for (unsigned t = 1; t < opt.threads; t++) {
+        for (auto &kv : per_thread[t]) {
+            auto it = merged.find(kv.first);
+            if (it == merged.end()) {
+                merged.emplace(kv.first, std::move(kv.second));
+            } else {
+                it->second.Merge(kv.second);
+            }
+        }
+        per_thread[t].clear();
+    }
+
+    std::map<TSStateId, const HeavyHitterSketch<std::string> *> ordered;
+    uint64_t worst_error = 0, worst_total = 0;
+    for (const auto &kv : merged) {
+        ordered[kv.first] = &kv.second;
+        if (kv.second.decremented() > worst_error) {
+            worst_error = kv.second.decremented();
+            worst_total = kv.second.total();
+        }
+    }
+
+    if (!WriteCandidates(opt.out_path, ordered, opt.top)) {
+        std::cerr << "[Error] 출력 실패: " << opt.out_path << "\n";
+        return 1;
+    }
+    if (!WriteBounds(opt.bounds_path, ordered, opt.capacity)) {
+        std::cerr << "[Error] 출력 실패: " << opt.bounds_path << "\n";
+        return 1;
+    }
+
+    std::cerr << "[Info] states=" << ordered.size() << " files_with_errors=" << broken_files.load()
+              << " max_error=" << worst_error << "/" << worst_total << "\n"
+              << "[Info] -> " << opt.out_path << ", " << opt.bounds_path << "\n";
+    return 0;
+}
@@ -0,0 +1,53 @@
+/**
+ * @file corpus.h
+ * @brief native/tools/ CLI들이 공유하는 코퍼스 입력 유틸리티
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 파일/디렉토리 인자를 재귀적으로 펼쳐 정렬된 파일 목록으로 만든다 (extensions가 비면 전부)
+inline std::vector<std::string> ListCorpusFiles(const std::vector<std::string> &inputs,
+                                                const std::vector<std::string> &extensions) {
+    namespace fs = std::filesystem;
+    auto matches = [&](const fs::path &p) {
+        if (extensions.empty()) return true;
+        return std::find(extensions.begin(), extensions.end(), p.extension().string()) != extensions.end();
+    };
+
+    std::vector<std::string> files;
+    for (const auto &input : inputs) {
+        std::error_code ec;
+        if (fs::is_directory(input, ec)) {
+            for (auto it = fs::recursive_directory_iterator(input, ec);
+                 it != fs::recursive_directory_iterator(); it.increment(ec)) {
+                if (ec) break;
+                if (it->is_regular_file(ec) && matches(it->path())) {
+                    files.push_back(it->path().string());
+                }
+            }
+        } else if (fs::is_regular_file(input, ec)) {
+            files.push_back(input);
+        } else {
+            std::cerr << "[Warning] 입력을 찾을 수 없음: " << input << "\n";
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+inline bool ReadCorpusFile(const std::string &path, std::string &out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    out = ss.str();
+    return true;
+}
@@ -0,0 +1,565 @@
+/**
+ * @file difftest.cc
+ * @brief 최적화된 파싱 경로 ↔ 처음부터 파싱한 기준 경로 차분 테스트
+ *
+ * 코퍼스의 각 파일에 대해 DocumentSession(보존 트리 + 증분 편집 + 줄 색인)을 열고,
+ * 결정적 난수 편집 스크립트를 적용하면서 매 단계 무작위 커서 위치에서
+ *   - 세션 텍스트 == 기준 텍스트 (편집 동기화)
+ *   - 세션 토큰열(변경 구간만 갈아 끼운 것) == 같은 트리에서 처음부터 수집한 토큰열
+ *   - session.Convert(cursor, mode) == 새 파서의 ts_parser_parse_string_for_conversion(NULL 트리)
+ *   - 두 상태 경로로 매긴 후보 순위 상위 K개 (--db가 있을 때)
+ * 를 비교한다. 어긋나면 편집 스크립트와 원본 텍스트를 줄여 최소 재현 파일을 남긴다.
+ *
+ * 재현 파일: <out>/repro_<n>.txt (모드/커서/편집 목록) + repro_<n>.base (시작 텍스트)
+ *   <lang>_difftest --replay <out>/repro_<n>.txt 로 다시 확인한다.
+ *
+ * 사용법:
+ *   <lang>_difftest [--threads N] [--edits E] [--cursors C] [--seed S] [--mode 0|2|all]
+ *                   [--db candidates.json] [--top K] [--ext .py ...] [--out difftest_repro]
+ *                   <file|dir> ...
+ *   <lang>_difftest [--db candidates.json] --replay repro_0.txt
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tree_sitter/api.h"
+#include "lang_select.h"
+#include "conversion_api.h"
+#include "candidate_db.h"
+#include "document_session.h"
+#include "symbol_classes.h"
+#include "token_stream.h"
+#include "corpus.h"
+
+struct Options {
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    uint32_t edits = 32;    // 파일당 편집 수
+    uint32_t cursors = 4;   // 편집마다 비교할 커서 수 (편집 끝 위치 + 무작위)
+    uint32_t seed = 1;
+    std::vector<uint32_t> modes = {0};
+    std::string db_path;
+    size_t top = 10;
+    size_t max_reports = 20;
+    std::vector<std::string> extensions;
+    std::string out_dir = "difftest_repro";
+    std::string replay_path;
+    std::vector<std::string> inputs;
+};
+
+// 바이트 단위 편집: 그 시점 텍스트의 [start, old_end)를 text로 바꾼다
+struct Edit {
+    uint32_t start;
+    uint32_t old_end;
+    std::string text;
+};
+
+struct Scenario {
+    std::string source_path;
+    std::string base;
+    std::vector<Edit> edits;
+    uint32_t cursor = 0;
+    uint32_t mode = 0;
+};
+
+// =============================================================================
+// [비교] 최적화 경로 vs 기준 경로
+// =============================================================================
+static const SymbolClassifier &Classifier() {
+    static const SymbolClassifier classifier(GET_LANGUAGE());
+    return classifier;
+}
+
+static std::vector<TSStateId> CopyPath(const TSStatePath &path) {
+    return std::vector<TSStateId>(path.states, path.states + path.count);
+}
+
+static std::string PathString(const std::vector<TSStateId> &states) {
+    std::string out = "[";
+    for (size_t i = 0; i < states.size(); i++) {
+        if (i) out += ",";
+        out += std::to_string(states[i]);
+    }
+    return out + "]";
+}
+
+static uint32_t SnapToBoundary(const std::string &text, uint32_t byte) {
+    if (byte > text.size()) byte = static_cast<uint32_t>(text.size());
+    while (byte < text.size() && (static_cast<unsigned char>(text[byte]) & 0xC0) == 0x80) byte++;
+    return byte;
+}
+
+class Checker {
+public:
+    Checker(const CandidateDb *db, size_t top)
+        : reference_(ts_parser_new()), db_(db), top_(top), fresh_tokens_(Classifier()) {
+        ts_parser_set_language(reference_, GET_LANGUAGE());
+    }
+    ~Checker() { ts_parser_delete(reference_); }
+
+    Checker(const Checker &) = delete;
+    Checker &operator=(const Checker &) = delete;
+
+    // 어긋나면 detail에 설명을 채우고 true
+    bool Diverges(DocumentSession &session, const std::string &expected_text, uint32_t cursor, uint32_t mode,
+                  std::string *detail) {
+        if (session.text() != expected_text) {
+            if (detail) *detail = "session text out of sync with edit script";
+            return true;
+        }
+        const TSPoint point = session.lines().PointForByte(cursor);
+        LineIndex fresh;
+        fresh.Build(expected_text);
+        const TSPoint expected_point = fresh.PointForByte(cursor);
+        if (point.row != expected_point.row || point.column != expected_point.column) {
+            if (detail) {
+                *detail = "line index: (" + std::to_string(point.row) + "," + std::to_string(point.column) +
+                          ") expected (" + std::to_string(expected_point.row) + "," +
+                          std::to_string(expected_point.column) + ")";
+            }
+            return true;
+        }
+
+        if (!SameTokens(session, detail)) return true;
+
+        const std::vector<TSStateId> optimized = CopyPath(session.Convert(cursor, mode));
+        const uint32_t length = static_cast<uint32_t>(expected_text.size());
+        const std::vector<TSStateId> reference = CopyPath(mode == 2
+            ? ts_parser_parse_string_for_conversion_with_lookahead(reference_, NULL, expected_text.c_str(),
+                                                                   length, cursor)
+            : ts_parser_parse_string_for_conversion(reference_, NULL, expected_text.c_str(), cursor));
+        if (optimized == reference) return false;
+
+        if (detail) {
+            *detail = "state path " + PathString(optimized) + " expected " + PathString(reference);
+            if (db_) {
+                db_->Rank(optimized.data(), static_cast<uint32_t>(optimized.size()), optimized_rank_);
+                db_->Rank(reference.data(), static_cast<uint32_t>(reference.size()), reference_rank_);
+                *detail += SameTop() ? "\n  top candidates: identical" : "\n  top candidates: DIFFERENT";
+                for (size_t i = 0; i < top_ && (i < optimized_rank_.size() || i < reference_rank_.size()); i++) {
+                    *detail += "\n  #" + std::to_string(i + 1) + " " +
+                               (i < optimized_rank_.size() ? optimized_rank_[i].key : "-") + " | " +
+                               (i < reference_rank_.size() ? reference_rank_[i].key : "-");
+                }
+            }
+        }
+        return true;
+    }
+
+    // 처음부터 재생: 시작 텍스트로 세션을 열고 편집을 적용한 뒤 비교
+    bool Replay(const Scenario &scenario, std::string *detail) {
+        DocumentSession session(GET_LANGUAGE(), Classifier(), scenario.base, 0);
+        std::string expected = scenario.base;
+        for (const Edit &edit : scenario.edits) {
+            if (edit.start > edit.old_end || edit.old_end > expected.size()) {
+                if (detail) *detail = "edit out of range";
+                return false;
+            }
+            Apply(session, expected, edit);
+        }
+        return Diverges(session, expected, std::min<uint32_t>(scenario.cursor, static_cast<uint32_t>(expected.size())),
+                        scenario.mode, detail);
+    }
+
+    static void Apply(DocumentSession &session, std::string &expected, const Edit &edit) {
+        const LineIndex &lines = session.lines();
+        const uint32_t start16 = lines.Utf16ForByte(session.text(), edit.start);
+        const uint32_t end16 = lines.Utf16ForByte(session.text(), edit.old_end);
+        session.ApplyEdit(start16, end16 - start16, edit.text);
+        expected.replace(edit.start, edit.old_end - edit.start, edit.text);
+    }
+
+private:
+    bool SameTokens(const DocumentSession &session, std::string *detail) {
+        const TokenStream &tokens = session.tokens();
+        fresh_tokens_.Rebuild(session.tree());
+        const size_t n = std::min(tokens.size(), fresh_tokens_.size());
+        size_t i = 0;
+        while (i < n && tokens.symbols()[i] == fresh_tokens_.symbols()[i] &&
+               tokens.starts()[i] == fresh_tokens_.starts()[i] && tokens.lengths()[i] == fresh_tokens_.lengths()[i] &&
+               tokens.flags()[i] == fresh_tokens_.flags()[i]) {
+            i++;
+        }
+        if (i == n && tokens.size() == fresh_tokens_.size()) return true;
+        if (detail) {
+            auto describe = [](const TokenStream &t, size_t k) {
+                if (k >= t.size()) return std::string("-");
+                return std::to_string(t.symbols()[k]) + "@" + std::to_string(t.starts()[k]) + "+" +
+                       std::to_string(t.lengths()[k]);
+            };
+            *detail = "token stream #" + std::to_string(i) + ": " + describe(tokens, i) + " expected " +
+                      describe(fresh_tokens_, i) + " (" + std::to_string(tokens.size()) + " vs " +
+                      std::to_string(fresh_tokens_.size()) + " tokens)";
+        }
+        return false;
+    }
+
+    bool SameTop() const {
+        const size_t n = std::min(top_, std::max(optimized_rank_.size(), reference_rank_.size()));
+        for (size_t i = 0; i < n; i++) {
+            if (i >= optimized_rank_.size() || i >= reference_rank_.size()) return false;
+            if (optimized_rank_[i].key != reference_rank_[i].key) return false;
+        }
+        return true;
+    }
+
+    TSParser *reference_;
+    const CandidateDb *db_;
+    size_t top_;
+    std::vector<RankedCandidate> optimized_rank_;
+    std::vector<RankedCandidate> reference_rank_;
+    TokenStream fresh_tokens_;
+};
+
+// =============================================================================
+// [최소화] 편집 스크립트 → 원본 텍스트 순서로 줄인다
+// =============================================================================
+static void MinimizeEdits(Checker &checker, Scenario &scenario) {
+    // ddmin: 덩어리 단위로 편집을 빼 보고 여전히 어긋나면 확정
+    for (size_t chunk = std::max<size_t>(1, scenario.edits.size() / 2); chunk >= 1; chunk /= 2) {
+        for (size_t i = 0; i < scenario.edits.size();) {
+            Scenario trial = scenario;
+            const size_t end = std::min(trial.edits.size(), i + chunk);
+            trial.edits.erase(trial.edits.begin() + i, trial.edits.begin() + end);
+            if (checker.Replay(trial, nullptr)) {
+                scenario = std::move(trial);
+            } else {
+                i += chunk;
+            }
+        }
+        if (chunk == 1) break;
+    }
+
+    // 마지막 편집만 남기고 앞의 편집들은 시작 텍스트에 접어 넣는다 (보존 트리가 한 번만 편집되는 형태)
+    if (scenario.edits.size() > 1) {
+        Scenario trial = scenario;
+        for (size_t i = 0; i + 1 < trial.edits.size(); i++) {
+            const Edit &edit = trial.edits[i];
+            trial.base.replace(edit.start, edit.old_end - edit.start, edit.text);
+        }
+        trial.edits.erase(trial.edits.begin(), trial.edits.end() - 1);
+        if (checker.Replay(trial, nullptr)) scenario = std::move(trial);
+    }
+}
+
+// 편집이 하나 이하일 때만: 편집/커서와 겹치지 않는 줄 덩어리를 시작 텍스트에서 지운다
+static void MinimizeBase(Checker &checker, Scenario &scenario, size_t max_attempts) {
+    if (scenario.edits.size() > 1) return;
+
+    auto line_starts = [](const std::string &text) {
+        std::vector<uint32_t> starts = {0};
+        for (uint32_t i = 0; i < text.size(); i++) {
+            if (text[i] == '\n') starts.push_back(i + 1);
+        }
+        starts.push_back(static_cast<uint32_t>(text.size()));
+        return starts;
+    };
+
+    size_t attempts = 0;
+    std::vector<uint32_t> starts = line_starts(scenario.base);
+    for (size_t chunk = std::max<size_t>(1, (starts.size() - 1) / 2); chunk >= 1 && attempts < max_attempts; chunk /= 2) {
+        for (size_t line = 0; line + 1 < starts.size() && attempts < max_attempts;) {
+            const uint32_t from = starts[line];
+            const uint32_t to = starts[std::min(starts.size() - 1, line + chunk)];
+            const uint32_t removed = to - from;
+
+            Scenario trial = scenario;
+            bool ok = true;
+            if (!trial.edits.empty()) {
+                Edit &edit = trial.edits[0];
+                // 커서는 편집 뒤 텍스트 기준이므로 지울 구간도 편집 뒤 위치로 옮겨서 비교한다
+                uint32_t shifted_from = from;
+                if (to <= edit.start) {
+                    edit.start -= removed;
+                    edit.old_end -= removed;
+                } else if (from >= edit.old_end) {
+                    shifted_from = static_cast<uint32_t>(from - edit.old_end + edit.start + edit.text.size());
+                } else {
+                    ok = false;
+                }
+                if (trial.cursor >= shifted_from + removed) trial.cursor -= removed;
+                else if (trial.cursor >= shifted_from) ok = false;
+            } else if (trial.cursor >= to) {
+                trial.cursor -= removed;
+            } else if (trial.cursor >= from) {
+                ok = false;
+            }
+
+            if (ok) {
+                trial.base.erase(from, removed);
+                attempts++;
+                if (checker.Replay(trial, nullptr)) {
+                    scenario = std::move(trial);
+                    starts = line_starts(scenario.base);
+                    continue;
+                }
+            }
+            line += chunk;
+        }
+        if (chunk == 1) break;
+    }
+}
+
+// =============================================================================
+// [재현 파일]
+// =============================================================================
+static bool WriteScenario(const std::string &path, const Scenario &scenario, const std::string &detail) {
+    std::ofstream base(path.substr(0, path.size() - 4) + ".base", std::ios::binary);
+    std::ofstream out(path, std::ios::binary);
+    if (!base || !out) return false;
+    base << scenario.base;
+    out << "# difftest reproducer\n"
+        << "# source: " << scenario.source_path << "\n";
+    std::istringstream lines(detail);
+    for (std::string line; std::getline(lines, line);) out << "# " << line << "\n";
+    out << "mode " << scenario.mode << "\n"
+        << "cursor " << scenario.cursor << "\n";
+    for (const Edit &edit : scenario.edits) {
+        out << "edit " << edit.start << " " << edit.old_end << " " << edit.text.size() << "\n"
+            << edit.text << "\n";
+    }
+    return true;
+}
+
+static bool ReadScenario(const std::string &path, Scenario &scenario) {
+    std::string text;
+    if (!ReadCorpusFile(path, text) || path.size() < 4) return false;
+    if (!ReadCorpusFile(path.substr(0, path.size() - 4) + ".base", scenario.base)) return false;
+    scenario.source_path = path;
+
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t eol = text.find('\n', pos);
+        if (eol == std::string::npos) eol = text.size();
+        std::istringstream line(text.substr(pos, eol - pos));
+        pos = eol + 1;
+
+        std::string word;
+        line >> word;
+        if (word == "mode") {
+            line >> scenario.mode;
+        } else if (word == "cursor") {
+            line >> scenario.cursor;
+        } else if (word == "edit") {
+            Edit edit;
+            size_t length = 0;
+            if (!(line >> edit.start >> edit.old_end >> length) || pos + length > text.size()) return false;
+            edit.text = text.substr(pos, length);
+            pos += length + 1;
+            scenario.edits.push_back(std::move(edit));
+        }
+    }
+    return true;
+}
+
+// =============================================================================
+// [실행] 파일별 편집 스크립트
+// =============================================================================
+struct Report {
+    Scenario scenario;
+    std::string detail;
+};
+
+static Edit RandomEdit(const std::string &text, std::mt19937 &rng) {
+    const uint32_t size = static_cast<uint32_t>(text.size());
+    Edit edit;
+    edit.start = SnapToBoundary(text, size ? rng() % (size + 1) : 0);
+    const uint32_t kind = rng() % 3;  // 0: 삽입, 1: 삭제, 2: 교체
+    edit.old_end = kind == 0 ? edit.start : SnapToBoundary(text, edit.start + rng() % 32);
+    if (kind != 1) {
+        // 같은 파일의 다른 조각을 붙여 넣어 문법적으로 그럴듯한 입력을 만든다
+        if (size == 0) {
+            edit.text = "x\n";
+        } else {
+            const uint32_t from = SnapToBoundary(text, rng() % size);
+            const uint32_t to = SnapToBoundary(text, from + 1 + rng() % 24);
+            edit.text = text.substr(from, to - from);
+        }
+    }
+    return edit;
+}
+
+static void DiffWorker(const Options &opt, const CandidateDb *db, const std::vector<std::string> &files,
+                       std::atomic<size_t> &next, std::atomic<size_t> &checks, std::mutex &report_mutex,
+                       std::vector<Report> &reports) {
+    Checker checker(db, opt.top);
+    std::string source;
+    std::string detail;
+    for (size_t i = next++; i < files.size(); i = next++) {
+        if (!ReadCorpusFile(files[i], source)) {
+            std::cerr << "[Warning] 읽기 실패: " << files[i] << "\n";
+            continue;
+        }
+        // 파일마다 시드를 고정해 스레드 수와 무관하게 같은 스크립트를 만든다
+        std::mt19937 rng(opt.seed ^ static_cast<uint32_t>(std::hash<std::string>()(files[i])));
+
+        for (uint32_t mode : opt.modes) {
+            DocumentSession session(GET_LANGUAGE(), Classifier(), source, 0);
+            std::string expected = source;
+            Scenario scenario;
+            scenario.source_path = files[i];
+            scenario.base = source;
+            scenario.mode = mode;
+
+            bool reported = false;
+            for (uint32_t step = 0; step <= opt.edits && !reported; step++) {
+                if (step > 0) {
+                    Edit edit = RandomEdit(expected, rng);
+                    const uint32_t edit_end = edit.start + static_cast<uint32_t>(edit.text.size());
+                    Checker::Apply(session, expected, edit);
+                    scenario.edits.push_back(std::move(edit));
+                    scenario.cursor = edit_end;
+                } else {
+                    scenario.cursor = static_cast<uint32_t>(expected.size());
+                }
+
+                for (uint32_t c = 0; c < opt.cursors && !reported; c++) {
+                    if (c > 0) {
+                        scenario.cursor = SnapToBoundary(expected, rng() % (expected.size() + 1));
+                    }
+                    checks++;
+                    if (!checker.Diverges(session, expected, scenario.cursor, mode, &detail)) continue;
+
+                    reported = true;
+                    Scenario minimized = scenario;
+                    if (checker.Replay(minimized, nullptr)) {
+                        MinimizeEdits(checker, minimized);
+                        MinimizeBase(checker, minimized, 4000);
+                        checker.Replay(minimized, &detail);
+                    } else {
+                        detail += "\n  (not reproducible by replay: depends on earlier conversions in the session)";
+                    }
+                    std::lock_guard<std::mutex> lock(report_mutex);
+                    reports.push_back({std::move(minimized), detail});
+                }
+            }
+        }
+    }
+}
+
+static void PrintUsage(const char *argv0) {
+    std::cerr << "Usage: " << argv0
+              << " [--threads N] [--edits E] [--cursors C] [--seed S] [--mode 0|2|all] [--db FILE]"
+                 " [--top K] [--ext .x ...] [--out DIR] <file|dir> ...\n"
+              << "       " << argv0 << " [--db FILE] --replay repro.txt\n";
+}
+
+int main(int argc, char **argv) {
+    Options opt;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char *v = nullptr;
+        if (arg == "--threads" && (v = value())) {
+            opt.threads = std::max(1, std::atoi(v));
+        } else if (arg == "--edits" && (v = value())) {
+            opt.edits = static_cast<uint32_t>(std::max(0, std::atoi(v)));
+        } else if (arg == "--cursors" && (v = value())) {
+            opt.cursors = static_cast<uint32_t>(std::max(1, std::atoi(v)));
+        } else if (arg == "--seed" && (v = value())) {
+            opt.seed = static_cast<uint32_t>(std::strtoul(v, nullptr, 10));
+        } else if (arg == "--mode" && (v = value())) {
+            const std::string mode = v;
+            if (mode == "all") opt.modes = {0, 2};
+            else opt.modes = {static_cast<uint32_t>(std::atoi(v))};
+        } else if (arg == "--db" && (v = value())) {
+            opt.db_path = v;
+        } else if (arg == "--top" && (v = value())) {
+            opt.top = static_cast<size_t>(std::max(1, std::atoi(v)));
+        } else if (arg == "--ext" && (v = value())) {
+            opt.extensions.push_back(v);
+        } else if (arg == "--out" && (v = value())) {
+            opt.out_dir = v;
+        } else if (arg == "--replay" && (v = value())) {
+            opt.replay_path = v;
+        } else if (arg == "-h" || arg == "--help") {
+            PrintUsage(argv[0]);
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            PrintUsage(argv[0]);
+            return 1;
+        } else {
+            opt.inputs.push_back(arg);
+        }
+    }
+    if (opt.inputs.empty() && opt.replay_path.empty()) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    CandidateDb db;
+    if (!opt.db_path.empty()) {
+        std::string error;
+        if (!db.Load(opt.db_path, error)) {
+            std::cerr << "[Error] DB 로드 실패: " << error << "\n";
+            return 1;
+        }
+    }
+    const CandidateDb *db_ptr = opt.db_path.empty() ? nullptr : &db;
+
+    if (!opt.replay_path.empty()) {
+        Scenario scenario;
+        if (!ReadScenario(opt.replay_path, scenario)) {
+            std::cerr << "[Error] 재현 파일을 읽을 수 없음: " << opt.replay_path << "\n";
+            return 1;
+        }
+        Checker checker(db_ptr, opt.top);
+        std::string detail;
+        if (!checker.Replay(scenario, &detail)) {
+            std::cerr << "[Info] no divergence (" << scenario.edits.size() << " edits, cursor "
+                      << scenario.cursor << ", mode " << scenario.mode << ")\n";
+            return 0;
+        }
+        std::cerr << "[Error] divergence: " << detail << "\n";
+        return 1;
+    }
+
+    const std::vector<std::string> files = ListCorpusFiles(opt.inputs, opt.extensions);
+    std::cerr << "[Info] files=" << files.size() << " threads=" << opt.threads << " edits=" << opt.edits
+              << " cursors=" << opt.cursors << " seed=" << opt.seed << "\n";
+
+    std::vector<std::thread> workers;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> checks{0};
+    std::mutex report_mutex;
+    std::vector<Report> reports;
+    for (unsigned t = 0; t < opt.threads; t++) {
+        workers.emplace_back(DiffWorker, std::cref(opt), db_ptr, std::cref(files), std::ref(next),
+                             std::ref(checks), std::ref(report_mutex), std::ref(reports));
+    }
+    for (auto &w : workers) w.join();
+
+    std::cerr << "[Info] checks=" << checks.load() << " divergences=" << reports.size() << "\n";
+    if (reports.empty()) return 0;
+
+    // 스레드 순서와 무관하게 같은 출력이 되도록 정렬
+    std::sort(reports.begin(), reports.end(), [](const Report &a, const Report &b) {
+        if (a.scenario.source_path != b.scenario.source_path) return a.scenario.source_path < b.scenario.source_path;
+        return a.scenario.mode < b.scenario.mode;
+    });
+    std::error_code ec;
+    std::filesystem::create_directories(opt.out_dir, ec);
+    for (size_t i = 0; i < reports.size() && i < opt.max_reports; i++) {
+        const Report &report = reports[i];
+        const std::string path = opt.out_dir + "/repro_" + std::to_string(i) + ".txt";
+        std::cerr << "[Error] " << report.scenario.source_path << " (mode " << report.scenario.mode << ", "
+                  << report.scenario.edits.size() << " edits, " << report.scenario.base.size() << " bytes)\n  "
+                  << report.detail << "\n";
+        if (WriteScenario(path, report.scenario, report.detail)) {
+            std::cerr << "  -> " << path << "\n";
+        } else {
+            std::cerr << "[Warning] 재현 파일 기록 실패: " << path << "\n";
+        }
+    }
+    return 1;
+}
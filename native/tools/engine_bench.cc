@@ -0,0 +1,544 @@
+/**
+ * @file engine_bench.cc
+ * @brief C ABI(native/include/cce_engine.h)만으로 엔진 지연 시간 측정 (Node/VS Code 없이)
+ *
+ * bench/fixtures/manifest.json에서 이 라이브러리 언어의 fixture와 커서 위치를 읽어
+ *   - convert:  cce_convert (매번 처음부터 파싱)
+ *   - document: cce_open_document 후 cce_convert_document (보존 트리)
+ *   - rank:     --db가 있으면 document 경로로 cce_rank_candidates
+ * 를 반복하고 fixture별/전체 p50/p95/p99/최대(us)를 출력한다. perf/valgrind 등 프로파일러를 바로 붙일 수 있다.
+ *
+ * --fuzz N이면 위치마다 커서 앞부분을 결정적으로 깨뜨린 변형 N개(여는 괄호/따옴표 삽입, 구간 삭제,
+ * 줄 조각 복제)를 만들어 오류 복구가 도는 컨버전을 복구 상한 없이(fuzz) / --recovery 상한으로(fuzz+cap)
+ * 각각 재고, 상한 발동 횟수(recoveryCapped)를 함께 출력한다.
+ *
+ * --lookahead BYTES(모드 2)면 커서 뒤로 그만큼만 파서에 넘기고, 위치마다 창 없이 얻은 상태 경로와
+ * 다른 경우를 센다 (bench/autotune.py가 언어별 창 크기를 고를 때 쓴다).
+ *
+ * --replay DIR이면 fixture 대신 확장이 저장한 느린 요청 재현 번들(src/reproBundle.ts)을 돌린다.
+ * DIR은 번들 하나(bundle.json + source.txt) 또는 번들들이 든 repro/ 디렉터리. 번들에 적힌 모드/오프셋/
+ * 복구 상한으로 cce_convert를 재고, 기록된 상태 경로와 같은지 알려 준다 (다른 언어 번들은 건너뜀).
+ *
+ * 사용법:
+ *   <lang>_engine_bench [--manifest bench/fixtures/manifest.json] [--iterations N] [--mode 0|2]
+ *                       [--db resources/<lang>/candidates.json] [--warmup N]
+ *                       [--fuzz N] [--seed S] [--recovery VERSIONS:COST] [--lookahead BYTES]
+ *   <lang>_engine_bench --replay <globalStorage>/repro [--iterations N] [--warmup N]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cce_engine.h"
+
+struct Options {
+    std::string manifest_path = "bench/fixtures/manifest.json";
+    uint32_t iterations = 20;  // 위치당 반복 수
+    uint32_t warmup = 2;
+    uint32_t mode = 0;
+    std::string db_path;
+    uint32_t fuzz = 0;          // 위치당 깨진 변형 수
+    uint32_t seed = 1;
+    uint32_t max_versions = 2;  // --recovery
+    uint32_t max_cost = 1500;
+    uint32_t lookahead = 0;     // 모드 2 lookahead 창 (0이면 문서 끝까지)
+    std::string replay_path;
+};
+
+struct Fixture {
+    std::string file;                                   // manifest 기준 상대 경로
+    std::vector<std::pair<uint32_t, uint32_t>> positions;  // (줄, 열) 0부터
+};
+
+// =============================================================================
+// [Manifest] generate_fixtures.py / reproBundle.ts가 쓰는 고정 형식만 읽는다 (범용 JSON 파서 아님)
+// =============================================================================
+static bool ReadFile(const std::string &path, std::string &out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    out = ss.str();
+    return true;
+}
+
+static bool StringField(const std::string &json, size_t from, size_t until, const char *name, std::string &out) {
+    const std::string needle = std::string("\"") + name + "\": \"";
+    const size_t at = json.find(needle, from);
+    if (at == std::string::npos || at >= until) return false;
+    const size_t begin = at + needle.size();
+    const size_t end = json.find('"', begin);
+    if (end == std::string::npos) return false;
+    out = json.substr(begin, end - begin);
+    return true;
+}
+
+static bool NumberField(const std::string &json, const char *name, double &out) {
+    const std::string needle = std::string("\"") + name + "\": ";
+    const size_t at = json.find(needle);
+    if (at == std::string::npos) return false;
+    const char *begin = json.c_str() + at + needle.size();
+    char *end = nullptr;
+    out = std::strtod(begin, &end);
+    return end != begin;
+}
+
+// "name": [...] 안의 음이 아닌 정수를 중첩과 상관없이 순서대로
+static std::vector<uint32_t> NumberList(const std::string &json, size_t from, size_t until, const char *name) {
+    std::vector<uint32_t> numbers;
+    const std::string needle = std::string("\"") + name + "\": [";
+    const size_t list = json.find(needle, from);
+    if (list == std::string::npos || list >= until) return numbers;
+    size_t i = list + needle.size();
+    int depth = 1;
+    while (i < until && depth > 0) {
+        const char c = json[i];
+        if (c == '[') depth++;
+        else if (c == ']') depth--;
+        if (c >= '0' && c <= '9') {
+            char *end = nullptr;
+            numbers.push_back(static_cast<uint32_t>(std::strtoul(json.c_str() + i, &end, 10)));
+            i = static_cast<size_t>(end - json.c_str());
+            continue;
+        }
+        i++;
+    }
+    return numbers;
+}
+
+static std::vector<Fixture> LoadManifest(const std::string &json, const std::string &language) {
+    std::vector<Fixture> fixtures;
+    const std::string key = "\"languageId\": \"";
+    size_t at = json.find(key);
+    while (at != std::string::npos) {
+        const size_t next = json.find(key, at + key.size());
+        const size_t until = next == std::string::npos ? json.size() : next;
+
+        std::string language_id;
+        Fixture fixture;
+        if (StringField(json, at, until, "languageId", language_id) && language_id == language &&
+            StringField(json, at, until, "file", fixture.file)) {
+            // [[line, column], ...] — 숫자를 순서대로 두 개씩 묶는다
+            const std::vector<uint32_t> numbers = NumberList(json, at, until, "positions");
+            for (size_t n = 0; n + 1 < numbers.size(); n += 2) {
+                fixture.positions.emplace_back(numbers[n], numbers[n + 1]);
+            }
+            fixtures.push_back(std::move(fixture));
+        }
+        at = next;
+    }
+    return fixtures;
+}
+
+// fixture는 ASCII라 열 = 바이트
+static uint32_t ByteOffset(const std::string &text, uint32_t line, uint32_t column) {
+    size_t offset = 0;
+    for (uint32_t l = 0; l < line && offset < text.size(); l++) {
+        const size_t newline = text.find('\n', offset);
+        if (newline == std::string::npos) return static_cast<uint32_t>(text.size());
+        offset = newline + 1;
+    }
+    return static_cast<uint32_t>(std::min(offset + column, text.size()));
+}
+
+// =============================================================================
+// [Fuzz] 커서 앞 [0, cursor)만 바꾼다 (커서는 변형 후 위치로 옮긴다)
+// =============================================================================
+struct Mutant {
+    std::string text;
+    uint32_t cursor;
+};
+
+static Mutant Mutate(const std::string &text, uint32_t cursor, std::mt19937 &rng) {
+    static const char *const kOpeners[] = {"(", "[", "{", "\"", "'", "(((", "if ", "= "};
+    Mutant m{text, cursor};
+    const uint32_t edits = 1 + rng() % 3;
+    for (uint32_t e = 0; e < edits && m.cursor > 0; e++) {
+        const uint32_t at = rng() % m.cursor;
+        switch (rng() % 3) {
+        case 0: {
+            const std::string opener = kOpeners[rng() % (sizeof(kOpeners) / sizeof(kOpeners[0]))];
+            m.text.insert(at, opener);
+            m.cursor += static_cast<uint32_t>(opener.size());
+            break;
+        }
+        case 1: {
+            const uint32_t length = std::min<uint32_t>(1 + rng() % 20, m.cursor - at);
+            m.text.erase(at, length);
+            m.cursor -= length;
+            break;
+        }
+        default: {
+            // at이 든 줄의 앞부분을 at에 한 번 더 (닫히지 않은 구조가 겹친다)
+            const size_t line_start = at == 0 ? 0 : m.text.rfind('\n', at - 1) + 1;
+            const std::string fragment = m.text.substr(line_start, at - line_start);
+            m.text.insert(at, fragment);
+            m.cursor += static_cast<uint32_t>(fragment.size());
+            break;
+        }
+        }
+    }
+    return m;
+}
+
+static uint64_t StatValue(const char *name) {
+    std::vector<uint64_t> values(64);
+    const uint32_t count = std::min<uint32_t>(cce_get_stats(values.data(), 64), 64);
+    for (uint32_t i = 0; i < count; i++) {
+        if (std::strcmp(cce_stat_name(i), name) == 0) return values[i];
+    }
+    return 0;
+}
+
+// 경로 전체를 states에 받는다. 용량보다 길면 키워서 한 번 더 (python/cce_module.cc와 같은 방식)
+static int32_t ConvertFull(CceEngine *engine, const std::string &text, uint32_t offset, uint32_t mode,
+                           std::vector<uint16_t> &states) {
+    int32_t count = cce_convert(engine, text.data(), text.size(), offset, mode, states.data(),
+                                static_cast<uint32_t>(states.size()));
+    if (count > static_cast<int32_t>(states.size())) {
+        states.resize(static_cast<size_t>(count));
+        count = cce_convert(engine, text.data(), text.size(), offset, mode, states.data(),
+                            static_cast<uint32_t>(states.size()));
+    }
+    return count;
+}
+
+// =============================================================================
+// [Timing]
+// =============================================================================
+struct Samples {
+    std::vector<double> us;
+
+    // us가 정렬된 상태에서 부른다
+    double Percentile(double p) const {
+        if (us.empty()) return 0;
+        const size_t index = static_cast<size_t>(p * (us.size() - 1) + 0.5);
+        return us[std::min(index, us.size() - 1)];
+    }
+
+    void Append(const Samples &other) { us.insert(us.end(), other.us.begin(), other.us.end()); }
+};
+
+template <typename Fn>
+static void Measure(Samples &samples, const Fn &fn) {
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    const auto end = std::chrono::steady_clock::now();
+    samples.us.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+}
+
+static void PrintRow(const std::string &label, const char *phase, Samples &samples) {
+    if (samples.us.empty()) return;
+    std::sort(samples.us.begin(), samples.us.end());
+    std::printf("%-44s %-9s n=%-6zu p50=%9.1f p95=%9.1f p99=%9.1f max=%9.1f\n", label.c_str(), phase,
+                samples.us.size(), samples.Percentile(0.50), samples.Percentile(0.95), samples.Percentile(0.99),
+                samples.us.back());
+}
+
+static void PrintUsage(const char *argv0) {
+    std::cerr << "Usage: " << argv0
+              << " [--manifest FILE] [--iterations N] [--warmup N] [--mode 0|2] [--db candidates.json]"
+                 " [--fuzz N] [--seed S] [--recovery VERSIONS:COST] [--lookahead BYTES] [--replay BUNDLE_DIR]\n";
+}
+
+// =============================================================================
+// [Replay] 재현 번들 (bundle.json의 statePath는 요청 당시 경로)
+// =============================================================================
+static std::vector<std::filesystem::path> FindBundles(const std::string &path) {
+    namespace fs = std::filesystem;
+    std::vector<fs::path> bundles;
+    std::error_code ec;
+    if (fs::exists(fs::path(path) / "bundle.json", ec)) {
+        bundles.emplace_back(path);
+        return bundles;
+    }
+    for (const auto &entry : fs::directory_iterator(path, ec)) {
+        if (entry.is_directory(ec) && fs::exists(entry.path() / "bundle.json", ec)) bundles.push_back(entry.path());
+    }
+    std::sort(bundles.begin(), bundles.end());
+    return bundles;
+}
+
+static int Replay(CceEngine *engine, const Options &opt, const std::string &language) {
+    const std::vector<std::filesystem::path> bundles = FindBundles(opt.replay_path);
+    if (bundles.empty()) {
+        std::cerr << "[Error] 재현 번들 없음: " << opt.replay_path << "\n";
+        return 1;
+    }
+
+    std::vector<uint16_t> states(4096);
+    Samples all;
+    size_t replayed = 0, mismatched = 0;
+    for (const auto &dir : bundles) {
+        const std::string name = dir.filename().string();
+        std::string json, language_id, source_file, text;
+        if (!ReadFile((dir / "bundle.json").string(), json) || !StringField(json, 0, json.size(), "languageId", language_id)) {
+            std::cerr << "[Warning] bundle.json 읽기 실패: " << name << "\n";
+            continue;
+        }
+        if (language_id != language) continue;
+        if (!StringField(json, 0, json.size(), "sourceFile", source_file) ||
+            !ReadFile((dir / source_file).string(), text)) {
+            std::cerr << "[Warning] 소스 없는 번들 건너뜀: " << name << "\n";
+            continue;
+        }
+        double mode = 0, byte_offset = 0, max_versions = 0, max_cost = 0, lookahead = 0;
+        double recorded_convert = -1, recorded_total = -1;
+        NumberField(json, "mode", mode);
+        NumberField(json, "byteOffset", byte_offset);
+        NumberField(json, "maxVersions", max_versions);
+        NumberField(json, "maxCost", max_cost);
+        NumberField(json, "lookaheadBytes", lookahead);
+        NumberField(json, "convert", recorded_convert);
+        NumberField(json, "totalMs", recorded_total);
+        const std::vector<uint32_t> recorded = NumberList(json, 0, json.size(), "statePath");
+        states.resize(std::max(states.size(), recorded.size()));
+        const uint32_t offset = std::min(static_cast<uint32_t>(byte_offset), static_cast<uint32_t>(text.size()));
+
+        cce_set_recovery_limit(engine, static_cast<uint32_t>(max_versions), static_cast<uint32_t>(max_cost));
+        cce_set_lookahead_bytes(engine, static_cast<uint32_t>(lookahead));
+        Samples samples;
+        int32_t count = -1;
+        for (uint32_t round = 0; round < opt.warmup + opt.iterations; round++) {
+            Samples scratch;
+            Measure(round >= opt.warmup ? samples : scratch, [&] {
+                count = cce_convert(engine, text.data(), text.size(), offset, static_cast<uint32_t>(mode),
+                                    states.data(), static_cast<uint32_t>(states.size()));
+            });
+        }
+        // 기록보다 긴 경로는 잘려서 왔으므로 키워서 다시 받는다 (비교는 잘리지 않은 경로로)
+        if (count > static_cast<int32_t>(states.size())) {
+            count = ConvertFull(engine, text, offset, static_cast<uint32_t>(mode), states);
+        }
+        cce_set_recovery_limit(engine, 0, 0);
+        cce_set_lookahead_bytes(engine, 0);
+
+        const bool same = count >= 0 && static_cast<size_t>(count) == recorded.size() &&
+                          std::equal(recorded.begin(), recorded.end(), states.begin());
+        if (!same) mismatched++;
+        replayed++;
+        std::cerr << "[Info] " << name << ": recorded convert=" << recorded_convert << "ms total=" << recorded_total
+                  << "ms, state path " << (same ? "matches" : "differs") << "\n";
+        PrintRow(name, "replay", samples);
+        all.Append(samples);
+    }
+
+    PrintRow("(all)", "replay", all);
+    std::cerr << "[Stats] replayed " << replayed << "/" << bundles.size() << " bundles, state path mismatches "
+              << mismatched << "\n";
+    return replayed > 0 ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+    Options opt;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char *v = nullptr;
+        if (arg == "--manifest" && (v = value())) {
+            opt.manifest_path = v;
+        } else if (arg == "--iterations" && (v = value())) {
+            opt.iterations = static_cast<uint32_t>(std::max(1, std::atoi(v)));
+        } else if (arg == "--warmup" && (v = value())) {
+            opt.warmup = static_cast<uint32_t>(std::max(0, std::atoi(v)));
+        } else if (arg == "--mode" && (v = value())) {
+            opt.mode = static_cast<uint32_t>(std::atoi(v)) == 2 ? 2 : 0;
+        } else if (arg == "--db" && (v = value())) {
+            opt.db_path = v;
+        } else if (arg == "--fuzz" && (v = value())) {
+            opt.fuzz = static_cast<uint32_t>(std::max(0, std::atoi(v)));
+        } else if (arg == "--seed" && (v = value())) {
+            opt.seed = static_cast<uint32_t>(std::strtoul(v, nullptr, 10));
+        } else if (arg == "--recovery" && (v = value())) {
+            unsigned versions = 0, cost = 0;
+            if (std::sscanf(v, "%u:%u", &versions, &cost) != 2) {
+                PrintUsage(argv[0]);
+                return 1;
+            }
+            opt.max_versions = versions;
+            opt.max_cost = cost;
+        } else if (arg == "--lookahead" && (v = value())) {
+            opt.lookahead = static_cast<uint32_t>(std::max(0, std::atoi(v)));
+        } else if (arg == "--replay" && (v = value())) {
+            opt.replay_path = v;
+        } else if (arg == "-h" || arg == "--help") {
+            PrintUsage(argv[0]);
+            return 0;
+        } else {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (cce_abi_version() != CCE_ABI_VERSION) {
+        std::cerr << "[Error] ABI version mismatch: library " << cce_abi_version() << ", header "
+                  << CCE_ABI_VERSION << "\n";
+        return 1;
+    }
+    const std::string language = cce_language_name();
+
+    if (!opt.replay_path.empty()) {
+        CceEngine *engine = cce_engine_new();
+        if (!engine) {
+            std::cerr << "[Error] 엔진 생성 실패\n";
+            return 1;
+        }
+        const int status = Replay(engine, opt, language);
+        cce_engine_delete(engine);
+        return status;
+    }
+
+    std::string manifest;
+    if (!ReadFile(opt.manifest_path, manifest)) {
+        std::cerr << "[Error] manifest 읽기 실패: " << opt.manifest_path << "\n";
+        return 1;
+    }
+    const std::vector<Fixture> fixtures = LoadManifest(manifest, language);
+    if (fixtures.empty()) {
+        std::cerr << "[Error] " << language << " fixture 없음 (bench/generate_fixtures.py 실행)\n";
+        return 1;
+    }
+    const size_t slash = opt.manifest_path.find_last_of("/\\");
+    const std::string root = slash == std::string::npos ? "" : opt.manifest_path.substr(0, slash + 1);
+
+    CceEngine *engine = cce_engine_new();
+    if (!engine) {
+        std::cerr << "[Error] 엔진 생성 실패\n";
+        return 1;
+    }
+    if (!opt.db_path.empty() && !cce_load_candidates(engine, opt.db_path.c_str())) {
+        std::cerr << "[Error] " << opt.db_path << ": " << cce_last_error(engine) << "\n";
+        cce_engine_delete(engine);
+        return 1;
+    }
+
+    std::cerr << "[Info] language=" << language << " fixtures=" << fixtures.size()
+              << " iterations=" << opt.iterations << " mode=" << opt.mode << " lookahead=" << opt.lookahead << "\n";
+
+    std::vector<uint16_t> states(4096);
+    std::vector<uint16_t> reference(4096);
+    std::vector<CceCandidate> ranked(64);
+    Samples all_convert, all_document, all_rank, all_fuzz, all_capped;
+    uint64_t capped = 0;
+    size_t lookahead_checked = 0, lookahead_mismatches = 0;
+    for (size_t f = 0; f < fixtures.size(); f++) {
+        const Fixture &fixture = fixtures[f];
+        std::string text;
+        if (!ReadFile(root + fixture.file, text)) {
+            std::cerr << "[Warning] 읽기 실패: " << root + fixture.file << "\n";
+            continue;
+        }
+        std::vector<uint32_t> offsets;
+        for (const auto &p : fixture.positions) offsets.push_back(ByteOffset(text, p.first, p.second));
+
+        // lookahead 창: 창 없이 얻은 경로와 같은지 위치마다 한 번 확인
+        if (opt.mode == 2 && opt.lookahead > 0) {
+            cce_set_lookahead_bytes(engine, 0);
+            for (uint32_t offset : offsets) {
+                const int32_t full = ConvertFull(engine, text, offset, opt.mode, reference);
+                cce_set_lookahead_bytes(engine, opt.lookahead);
+                const int32_t windowed = ConvertFull(engine, text, offset, opt.mode, states);
+                cce_set_lookahead_bytes(engine, 0);
+                const size_t n = static_cast<size_t>(std::max(full, 0));
+                if (full != windowed || !std::equal(reference.begin(), reference.begin() + n, states.begin())) {
+                    lookahead_mismatches++;
+                }
+                lookahead_checked++;
+            }
+            cce_set_lookahead_bytes(engine, opt.lookahead);
+        }
+
+        const std::string uri = "bench://" + fixture.file;
+        cce_open_document(engine, uri.c_str(), text.data(), text.size(), 1);
+
+        Samples convert, document, rank;
+        for (uint32_t round = 0; round < opt.warmup + opt.iterations; round++) {
+            const bool record = round >= opt.warmup;
+            for (uint32_t offset : offsets) {
+                Samples scratch;
+                Samples &c = record ? convert : scratch;
+                Measure(c, [&] {
+                    cce_convert(engine, text.data(), text.size(), offset, opt.mode, states.data(),
+                                static_cast<uint32_t>(states.size()));
+                });
+                int32_t count = -1;
+                Samples &d = record ? document : scratch;
+                Measure(d, [&] {
+                    count = cce_convert_document(engine, uri.c_str(), 1, offset, opt.mode, states.data(),
+                                                 static_cast<uint32_t>(states.size()));
+                });
+                if (opt.db_path.empty() || count < 0) continue;
+                const uint32_t path_length = std::min(static_cast<uint32_t>(count), static_cast<uint32_t>(states.size()));
+                Samples &r = record ? rank : scratch;
+                Measure(r, [&] {
+                    cce_rank_candidates(engine, states.data(), path_length, ranked.data(),
+                                        static_cast<uint32_t>(ranked.size()));
+                });
+            }
+        }
+        cce_close_document(engine, uri.c_str());
+
+        // 깨진 접두사: 같은 변형을 상한 없이 / 상한으로 번갈아 잰다 (순서 편향 방지)
+        Samples fuzz, fuzz_capped;
+        for (size_t p = 0; p < offsets.size() && opt.fuzz > 0; p++) {
+            std::mt19937 rng(opt.seed * 1000003u + static_cast<uint32_t>(f * 1009 + p));
+            for (uint32_t n = 0; n < opt.fuzz; n++) {
+                const Mutant m = Mutate(text, offsets[p], rng);
+                for (uint32_t round = 0; round < opt.iterations; round++) {
+                    for (int pass = 0; pass < 2; pass++) {
+                        const bool cap = (pass + round) % 2 == 1;
+                        cce_set_recovery_limit(engine, cap ? opt.max_versions : 0, cap ? opt.max_cost : 0);
+                        const uint64_t before = cap ? StatValue("recoveryCapped") : 0;
+                        Measure(cap ? fuzz_capped : fuzz, [&] {
+                            cce_convert(engine, m.text.data(), m.text.size(), m.cursor, opt.mode, states.data(),
+                                        static_cast<uint32_t>(states.size()));
+                        });
+                        if (cap) capped += StatValue("recoveryCapped") - before;
+                    }
+                }
+            }
+        }
+        cce_set_recovery_limit(engine, 0, 0);
+
+        PrintRow(fixture.file, "convert", convert);
+        PrintRow(fixture.file, "document", document);
+        PrintRow(fixture.file, "rank", rank);
+        PrintRow(fixture.file, "fuzz", fuzz);
+        PrintRow(fixture.file, "fuzz+cap", fuzz_capped);
+        all_convert.Append(convert);
+        all_document.Append(document);
+        all_rank.Append(rank);
+        all_fuzz.Append(fuzz);
+        all_capped.Append(fuzz_capped);
+    }
+
+    PrintRow("(all)", "convert", all_convert);
+    PrintRow("(all)", "document", all_document);
+    PrintRow("(all)", "rank", all_rank);
+    PrintRow("(all)", "fuzz", all_fuzz);
+    PrintRow("(all)", "fuzz+cap", all_capped);
+    if (lookahead_checked > 0) {
+        std::cerr << "[Stats] lookahead " << opt.lookahead << " bytes: state path mismatches " << lookahead_mismatches
+                  << "/" << lookahead_checked << " positions\n";
+    }
+    if (opt.fuzz > 0) {
+        std::cerr << "[Stats] recovery limit " << opt.max_versions << ":" << opt.max_cost << " capped "
+                  << capped << "/" << all_capped.us.size() << " fuzz conversions\n";
+    }
+
+    CceMemoryStats memory;
+    cce_memory_stats(engine, &memory);
+    std::cerr << "[Stats] tree_sitter_peak_bytes=" << memory.tree_sitter_peak_bytes << "\n";
+    cce_engine_delete(engine);
+    return 0;
+}
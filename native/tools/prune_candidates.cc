@@ -0,0 +1,201 @@
+/**
+ * @file prune_candidates.cc
+ * @brief 후보 DB 정적 정리 — 파싱 테이블로 나올 수 없는 (state, key)를 걸러낸다
+ *
+ * candidates.json의 각 후보를 CandidateChecker(candidate_check.h)로 state에서 시뮬레이션해
+ *   - unknown_symbol / unreachable: 삭제
+ *   - unclosed: 기본은 남기고 보고서에만 표시 (--strict면 삭제)
+ * 한다. 후보가 모두 지워진 상태는 DB에서 빠진다. <lang>_collect_candidates 다음 단계로 돌리며,
+ * 문법(parser.c)이 바뀌면 다시 수집/정리해야 한다.
+ *
+ * 보고서(<out>.prune.json): 삭제/표시한 후보와 사유, 상태별 개수. bounds 파일의 total/error는
+ * 후보를 지워도 그대로 유효하다.
+ *
+ * 사용법:
+ *   <lang>_prune_candidates --db resources/<lang>/candidates.json [--out FILE] [--report FILE]
+ *                           [--strict] [--dry-run]
+ *   --out을 생략하면 --db를 덮어쓴다.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "tree_sitter/api.h"
+#include "lang_select.h"
+#include "candidate_check.h"
+#include "candidate_db.h"
+
+struct Options {
+    std::string db_path;
+    std::string out_path;
+    std::string report_path;
+    bool strict = false;
+    bool dry_run = false;
+};
+
+struct Finding {
+    TSStateId state;
+    RankedCandidate candidate;
+    CandidateChecker::Verdict verdict;
+    bool dropped;
+};
+
+// =============================================================================
+// [출력] candidates.json 형식 + 보고서
+// =============================================================================
+static void WriteJsonString(std::ostream &out, const std::string &s) {
+    out << '"';
+    for (unsigned char c : s) {
+        switch (c) {
+            case '"': out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\r': out << "\\r"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out << buf;
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+// <lang>_collect_candidates와 같은 배치 (상태 오름차순, 상태 안에서는 원래 순서)
+static bool WriteCandidates(const std::string &path,
+                            const std::vector<std::pair<TSStateId, std::vector<RankedCandidate>>> &states) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return false;
+    out << "{\n";
+    bool first_state = true;
+    for (const auto &kv : states) {
+        if (kv.second.empty()) continue;
+        out << (first_state ? "" : ",\n") << "  \"" << kv.first << "\": [";
+        first_state = false;
+        for (size_t i = 0; i < kv.second.size(); i++) {
+            out << (i ? ", " : "") << "{\"key\": ";
+            WriteJsonString(out, kv.second[i].key);
+            out << ", \"value\": " << kv.second[i].value << "}";
+        }
+        out << "]";
+    }
+    out << "\n}\n";
+    return static_cast<bool>(out);
+}
+
+static bool WriteReport(const std::string &path, const Options &opt, size_t checked,
+                        const std::vector<Finding> &findings) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return false;
+    out << "{\n  \"db\": ";
+    WriteJsonString(out, opt.db_path);
+    out << ",\n  \"strict\": " << (opt.strict ? "true" : "false") << ",\n  \"checked\": " << checked
+        << ",\n  \"findings\": [";
+    for (size_t i = 0; i < findings.size(); i++) {
+        const Finding &f = findings[i];
+        out << (i ? ",\n" : "\n") << "    {\"state\": " << f.state << ", \"key\": ";
+        WriteJsonString(out, f.candidate.key);
+        out << ", \"value\": " << f.candidate.value << ", \"reason\": \"" << CandidateChecker::Name(f.verdict)
+            << "\", \"dropped\": " << (f.dropped ? "true" : "false") << "}";
+    }
+    out << (findings.empty() ? "]\n}\n" : "\n  ]\n}\n");
+    return static_cast<bool>(out);
+}
+
+// =============================================================================
+// [main]
+// =============================================================================
+static void PrintUsage(const char *argv0) {
+    std::cerr << "Usage: " << argv0 << " --db candidates.json [--out FILE] [--report FILE] [--strict] [--dry-run]\n";
+}
+
+int main(int argc, char **argv) {
+    Options opt;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char *v = nullptr;
+        if (arg == "--db" && (v = value())) {
+            opt.db_path = v;
+        } else if (arg == "--out" && (v = value())) {
+            opt.out_path = v;
+        } else if (arg == "--report" && (v = value())) {
+            opt.report_path = v;
+        } else if (arg == "--strict") {
+            opt.strict = true;
+        } else if (arg == "--dry-run") {
+            opt.dry_run = true;
+        } else if (arg == "-h" || arg == "--help") {
+            PrintUsage(argv[0]);
+            return 0;
+        } else {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (opt.db_path.empty()) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+    if (opt.out_path.empty()) opt.out_path = opt.db_path;
+    if (opt.report_path.empty()) opt.report_path = opt.out_path + ".prune.json";
+
+    CandidateDb db;
+    std::string error;
+    if (!db.Load(opt.db_path, error)) {
+        std::cerr << "[Error] DB 로드 실패: " << error << "\n";
+        return 1;
+    }
+
+    const CandidateChecker checker(GET_LANGUAGE());
+    std::vector<std::pair<TSStateId, std::vector<RankedCandidate>>> kept;
+    std::vector<Finding> findings;
+    std::vector<RankedCandidate> entries;
+    size_t checked = 0, dropped = 0;
+    size_t counts[4] = {};
+    for (TSStateId state : db.States()) {
+        db.Entries(state, entries);
+        kept.emplace_back(state, std::vector<RankedCandidate>());
+        for (RankedCandidate &candidate : entries) {
+            checked++;
+            const CandidateChecker::Verdict verdict = checker.Check(state, candidate.key);
+            counts[static_cast<int>(verdict)]++;
+            if (verdict == CandidateChecker::Verdict::Valid) {
+                kept.back().second.push_back(std::move(candidate));
+                continue;
+            }
+            const bool drop = verdict != CandidateChecker::Verdict::Unclosed || opt.strict;
+            findings.push_back({state, candidate, verdict, drop});
+            if (drop) {
+                dropped++;
+            } else {
+                kept.back().second.push_back(std::move(candidate));
+            }
+        }
+    }
+
+    using V = CandidateChecker::Verdict;
+    std::cerr << "[Stats] checked " << checked << " candidates in " << db.state_count() << " states: "
+              << counts[static_cast<int>(V::UnknownSymbol)] << " unknown symbol, "
+              << counts[static_cast<int>(V::Unreachable)] << " unreachable, "
+              << counts[static_cast<int>(V::Unclosed)] << " unclosed (dropped " << dropped << ")\n";
+    if (opt.dry_run) return 0;
+
+    if (!WriteCandidates(opt.out_path, kept)) {
+        std::cerr << "[Error] 출력 실패: " << opt.out_path << "\n";
+        return 1;
+    }
+    if (!WriteReport(opt.report_path, opt, checked, findings)) {
+        std::cerr << "[Error] 출력 실패: " << opt.report_path << "\n";
+        return 1;
+    }
+    std::cerr << "[Info] " << opt.out_path << " (report " << opt.report_path << ")\n";
+    return 0;
+}
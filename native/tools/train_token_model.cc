@@ -0,0 +1,127 @@
+/**
+ * @file train_token_model.cc
+ * @brief 코퍼스의 단말 토큰열로 n-gram 토큰 모델(token_model.bin)을 학습
+ *
+ * 각 파일을 파싱해 트리의 단말 토큰(문법 심볼 + 텍스트)을 순서대로 모으고,
+ * 스레드별 TokenCounts에 trigram/bigram/심볼별 빈도를 누적한 뒤 병합해서
+ * 메모리 매핑용 바이너리로 기록한다 (형식은 native/src/token_model.h 참고).
+ *
+ * 사용법:
+ *   <lang>_train_token_model [--threads N] [--min-count C] [--top K] [--symbol-top K]
+ *                            [--ext .py ...] [--out token_model.bin] <file|dir> ...
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tree_sitter/api.h"
+#include "lang_select.h"
+#include "token_model.h"
+#include "corpus.h"
+
+struct Options {
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    uint32_t min_count = 2;    // n-gram 컨텍스트 최소 총 빈도
+    uint32_t top = 16;         // n-gram 컨텍스트당 successor 수
+    uint32_t symbol_top = 64;  // 심볼 컨텍스트당 successor 수 (슬롯 백오프용이라 넉넉히)
+    std::vector<std::string> extensions;
+    std::string out_path = "token_model.bin";
+    std::vector<std::string> inputs;
+};
+
+static void TrainWorker(const std::vector<std::string> &files, std::atomic<size_t> &next,
+                        TokenCounts &counts, std::atomic<size_t> &error_files) {
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, GET_LANGUAGE());
+
+    std::string source;
+    std::vector<TokenRef> tokens;
+    for (size_t i = next++; i < files.size(); i = next++) {
+        if (!ReadCorpusFile(files[i], source)) {
+            std::cerr << "[Warning] 읽기 실패: " << files[i] << "\n";
+            continue;
+        }
+        TSTree *tree = ts_parser_parse_string(parser, NULL, source.c_str(), static_cast<uint32_t>(source.size()));
+        if (!tree) continue;
+        if (ts_node_has_error(ts_tree_root_node(tree))) error_files++;
+        CollectLeafTokens(tree, source, tokens);
+        counts.AddSequence(tokens);
+        ts_tree_delete(tree);
+    }
+    ts_parser_delete(parser);
+}
+
+static void PrintUsage(const char *argv0) {
+    std::cerr << "Usage: " << argv0
+              << " [--threads N] [--min-count C] [--top K] [--symbol-top K] [--ext .x ...]"
+                 " [--out FILE] <file|dir> ...\n";
+}
+
+int main(int argc, char **argv) {
+    Options opt;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char *v = nullptr;
+        if (arg == "--threads" && (v = value())) {
+            opt.threads = std::max(1, std::atoi(v));
+        } else if (arg == "--min-count" && (v = value())) {
+            opt.min_count = static_cast<uint32_t>(std::max(1, std::atoi(v)));
+        } else if (arg == "--top" && (v = value())) {
+            opt.top = static_cast<uint32_t>(std::max(1, std::atoi(v)));
+        } else if (arg == "--symbol-top" && (v = value())) {
+            opt.symbol_top = static_cast<uint32_t>(std::max(1, std::atoi(v)));
+        } else if (arg == "--ext" && (v = value())) {
+            opt.extensions.push_back(v);
+        } else if (arg == "--out" && (v = value())) {
+            opt.out_path = v;
+        } else if (arg == "-h" || arg == "--help") {
+            PrintUsage(argv[0]);
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            PrintUsage(argv[0]);
+            return 1;
+        } else {
+            opt.inputs.push_back(arg);
+        }
+    }
+    if (opt.inputs.empty()) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    const std::vector<std::string> files = ListCorpusFiles(opt.inputs, opt.extensions);
+    std::cerr << "[Info] files=" << files.size() << " threads=" << opt.threads << "\n";
+
+    std::vector<TokenCounts> per_thread(opt.threads);
+    std::vector<std::thread> workers;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> error_files{0};
+    for (unsigned t = 0; t < opt.threads; t++) {
+        workers.emplace_back(TrainWorker, std::cref(files), std::ref(next), std::ref(per_thread[t]),
+                             std::ref(error_files));
+    }
+    for (auto &w : workers) w.join();
+
+    TokenCounts &merged = per_thread[0];
+    for (unsigned t = 1; t < opt.threads; t++) {
+        merged.Merge(per_thread[t]);
+        per_thread[t].Clear();
+    }
+
+    const uint32_t symbol_count = ts_language_symbol_count(GET_LANGUAGE());
+    if (!merged.Write(opt.out_path, symbol_count, opt.min_count, opt.top, opt.symbol_top)) {
+        std::cerr << "[Error] 출력 실패: " << opt.out_path << "\n";
+        return 1;
+    }
+
+    std::cerr << "[Info] tokens=" << merged.total_tokens() << " contexts=" << merged.context_count()
+              << " files_with_errors=" << error_files.load() << "\n"
+              << "[Info] -> " << opt.out_path << "\n";
+    return 0;
+}
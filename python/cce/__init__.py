@@ -0,0 +1,85 @@
+"""
+자동완성 엔진(native/include/cce_engine.h) 파이썬 바인딩.
+
+언어마다 확장 모듈 cce._<lang>이 하나씩 있다 (python/setup.py가 빌드된 <lang>_engine 라이브러리로 만든다).
+
+    import cce
+    python = cce.load("python")
+    paths = python.convert_batch(sources, byte_offsets, mode=0)
+    paths[3]                 # 항목 3의 상태 경로 (memoryview, uint16)
+    states, offsets = paths.to_numpy()   # numpy가 있으면 복사 없이
+
+오프셋은 UTF-8 바이트 단위다 (str 소스는 UTF-8로 변환해 파싱한다). utf8_offset()으로 문자 오프셋을 바꾼다.
+파싱은 GIL 없이 threads개(0이면 코어 수) 스레드에서 돈다.
+"""
+
+import importlib
+import os
+
+__all__ = ["Language", "StatePaths", "available", "load", "utf8_offset"]
+
+
+class StatePaths:
+    """convert_batch 결과: 모든 경로를 이어 붙인 states(uint16)와 경계 offsets(uint64, 길이 n + 1)."""
+
+    def __init__(self, states, offsets):
+        self._states_bytes = states
+        self._offsets_bytes = offsets
+        self.states = memoryview(states).cast("H")
+        self.offsets = memoryview(offsets).cast("Q")
+
+    def __len__(self):
+        return len(self.offsets) - 1
+
+    def __getitem__(self, index):
+        if index < 0:
+            index += len(self)
+        if not 0 <= index < len(self):
+            raise IndexError(index)
+        return self.states[self.offsets[index]:self.offsets[index + 1]]
+
+    def lengths(self):
+        return [self.offsets[i + 1] - self.offsets[i] for i in range(len(self))]
+
+    def to_numpy(self):
+        import numpy as np
+        return (np.frombuffer(self._states_bytes, dtype=np.uint16),
+                np.frombuffer(self._offsets_bytes, dtype=np.uint64))
+
+
+class Language:
+    def __init__(self, module):
+        self._module = module
+        self.name = module.language()
+
+    def convert_batch(self, sources, offsets, mode=0, threads=0, recovery=None, tuning=None):
+        """(source, byte offset) 쌍마다 커서의 파서 상태 경로.
+
+        mode: 0(커서에서 자름) 또는 2(전체 소스 + lookahead)
+        recovery: (max_versions, max_cost) 오류 복구 상한
+        tuning: resources/<lang>/tuning.json 경로 (bench/autotune.py)
+        """
+        states, bounds = self._module.convert_batch(sources, offsets, mode, threads, recovery, tuning)
+        return StatePaths(states, bounds)
+
+    def __repr__(self):
+        return f"cce.Language({self.name!r})"
+
+
+def load(language):
+    return Language(importlib.import_module(f"cce._{language}"))
+
+
+def available():
+    """빌드되어 설치된 언어 목록."""
+    package_dir = os.path.dirname(os.path.abspath(__file__))
+    names = set()
+    for entry in os.listdir(package_dir):
+        if entry.startswith("_") and not entry.startswith("__") and entry.endswith((".so", ".pyd")):
+            names.add(entry[1:].split(".")[0])
+    return sorted(names)
+
+
+def utf8_offset(source, char_offset):
+    """str의 문자 오프셋 → UTF-8 바이트 오프셋."""
+    return len(source[:char_offset].encode("utf-8"))
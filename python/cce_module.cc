@@ -0,0 +1,253 @@
+/**
+ * @file cce_module.cc
+ * @brief 엔진 C ABI(native/include/cce_engine.h)의 CPython 확장 — 언어별 모듈 cce._<lang>
+ *
+ * 연구용 대량 평가를 VS Code 없이 돌리기 위한 배치 API다. 라이브러리 하나 = 문법 하나라서
+ * python/setup.py가 빌드된 <lang>_engine 정적 라이브러리마다 이 파일을 CCE_MODULE=_<lang>로 한 번씩 컴파일한다.
+ *
+ *   convert_batch(sources, offsets, mode=0, threads=0, recovery=None, tuning=None) -> (states, offsets)
+ *     - sources: str(UTF-8로 변환) 또는 bytes 시퀀스, offsets: 같은 길이의 UTF-8 바이트 오프셋 시퀀스
+ *     - states: 모든 상태 경로를 이어 붙인 uint16 배열 (bytes, native endian)
+ *     - offsets: 항목 i의 경로가 states[offsets[i]:offsets[i + 1]]인 uint64 배열 (bytes, 길이 n + 1)
+ *     항목마다 파이썬 객체를 만들지 않는다 (cce 패키지가 memoryview/numpy로 감싼다).
+ *   파싱하는 동안 GIL을 놓고 threads개(0이면 코어 수) 스레드가 각자 엔진을 만들어 나눠 처리한다
+ *   (엔진 하나는 한 스레드에서만 쓴다는 ABI 규칙).
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cce_engine.h"
+
+#ifndef CCE_MODULE
+#error "CCE_MODULE(예: _python)을 정의해야 한다 (python/setup.py)"
+#endif
+
+#define CCE_STR_(x) #x
+#define CCE_STR(x) CCE_STR_(x)
+#define CCE_CAT_(a, b) a##b
+#define CCE_CAT(a, b) CCE_CAT_(a, b)
+
+namespace {
+
+constexpr uint32_t kInitialCapacity = 1024;
+
+struct BatchOptions {
+    uint32_t mode = 0;
+    bool has_recovery = false;
+    uint32_t max_versions = 0;
+    uint32_t max_cost = 0;
+    std::string tuning_path;
+};
+
+struct BatchItem {
+    const char *source;
+    size_t length;
+    uint32_t offset;
+};
+
+// 워커 스레드 하나: 엔진 하나로 next가 가리키는 항목을 차례로 가져가 처리
+void RunWorker(const BatchOptions &opt, const std::vector<BatchItem> &items, std::vector<std::vector<uint16_t>> &paths,
+               std::atomic<size_t> &next, std::atomic<bool> &failed, std::string &error) {
+    CceEngine *engine = cce_engine_new();
+    if (!engine) {
+        if (!failed.exchange(true)) error = "cce_engine_new failed";
+        return;
+    }
+    if (!opt.tuning_path.empty() && !cce_load_tuning(engine, opt.tuning_path.c_str())) {
+        if (!failed.exchange(true)) error = std::string("tuning: ") + cce_last_error(engine);
+        cce_engine_delete(engine);
+        return;
+    }
+    if (opt.has_recovery) cce_set_recovery_limit(engine, opt.max_versions, opt.max_cost);
+
+    std::vector<uint16_t> buffer(kInitialCapacity);
+    for (size_t i = next++; i < items.size() && !failed; i = next++) {
+        const BatchItem &item = items[i];
+        int32_t count = cce_convert(engine, item.source, item.length, item.offset, opt.mode, buffer.data(),
+                                    static_cast<uint32_t>(buffer.size()));
+        if (count > static_cast<int32_t>(buffer.size())) {
+            buffer.resize(static_cast<size_t>(count));
+            count = cce_convert(engine, item.source, item.length, item.offset, opt.mode, buffer.data(),
+                                static_cast<uint32_t>(buffer.size()));
+        }
+        if (count < 0) {
+            if (!failed.exchange(true)) error = "item " + std::to_string(i) + ": " + cce_last_error(engine);
+            break;
+        }
+        paths[i].assign(buffer.begin(), buffer.begin() + count);
+    }
+    cce_engine_delete(engine);
+}
+
+// =============================================================================
+// [Python API]
+// =============================================================================
+PyObject *ConvertBatch(PyObject *, PyObject *args, PyObject *kwargs) {
+    static const char *kKeywords[] = {"sources", "offsets", "mode", "threads", "recovery", "tuning", nullptr};
+    PyObject *sources_arg = nullptr;
+    PyObject *offsets_arg = nullptr;
+    unsigned int mode = 0;
+    int threads = 0;
+    PyObject *recovery = Py_None;
+    PyObject *tuning = Py_None;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|IiOO", const_cast<char **>(kKeywords), &sources_arg,
+                                     &offsets_arg, &mode, &threads, &recovery, &tuning)) {
+        return nullptr;
+    }
+
+    BatchOptions opt;
+    opt.mode = mode == 2 ? 2 : 0;
+    if (recovery != Py_None) {
+        unsigned int versions = 0, cost = 0;
+        if (!PyArg_ParseTuple(recovery, "II;recovery must be (max_versions, max_cost)", &versions, &cost)) {
+            return nullptr;
+        }
+        opt.has_recovery = true;
+        opt.max_versions = versions;
+        opt.max_cost = cost;
+    }
+    if (tuning != Py_None) {
+        PyObject *path = PyOS_FSPath(tuning);
+        if (!path) return nullptr;
+        PyObject *encoded = nullptr;
+        if (!PyUnicode_FSConverter(path, &encoded)) {
+            Py_DECREF(path);
+            return nullptr;
+        }
+        opt.tuning_path = PyBytes_AS_STRING(encoded);
+        Py_DECREF(encoded);
+        Py_DECREF(path);
+    }
+
+    // 튜플 사본이 항목 참조를 쥐고 있으므로 GIL을 놓은 동안 원본 리스트가 바뀌어도 포인터는 유효하다
+    PyObject *sources = PySequence_Tuple(sources_arg);
+    if (!sources) return nullptr;
+    PyObject *offsets = PySequence_Fast(offsets_arg, "offsets must be a sequence");
+    if (!offsets) {
+        Py_DECREF(sources);
+        return nullptr;
+    }
+    const Py_ssize_t count = PyTuple_GET_SIZE(sources);
+    if (PySequence_Fast_GET_SIZE(offsets) != count) {
+        PyErr_SetString(PyExc_ValueError, "sources and offsets must have the same length");
+        Py_DECREF(sources);
+        Py_DECREF(offsets);
+        return nullptr;
+    }
+
+    std::vector<BatchItem> items(static_cast<size_t>(count));
+    for (Py_ssize_t i = 0; i < count; i++) {
+        PyObject *source = PyTuple_GET_ITEM(sources, i);
+        BatchItem &item = items[static_cast<size_t>(i)];
+        Py_ssize_t length = 0;
+        if (PyUnicode_Check(source)) {
+            item.source = PyUnicode_AsUTF8AndSize(source, &length);
+        } else if (PyBytes_Check(source)) {
+            char *data = nullptr;
+            item.source = PyBytes_AsStringAndSize(source, &data, &length) == 0 ? data : nullptr;
+        } else {
+            PyErr_Format(PyExc_TypeError, "sources[%zd] must be str or bytes", i);
+            item.source = nullptr;
+        }
+        const unsigned long long offset =
+            item.source ? PyLong_AsUnsignedLongLong(PySequence_Fast_GET_ITEM(offsets, i)) : 0;
+        if (!item.source || PyErr_Occurred()) {
+            Py_DECREF(sources);
+            Py_DECREF(offsets);
+            return nullptr;
+        }
+        item.length = static_cast<size_t>(length);
+        item.offset = static_cast<uint32_t>(std::min<unsigned long long>(offset, UINT32_MAX));
+    }
+    Py_DECREF(offsets);
+
+    size_t workers = threads > 0 ? static_cast<size_t>(threads) : std::thread::hardware_concurrency();
+    workers = std::max<size_t>(1, std::min(workers, items.size()));
+
+    std::vector<std::vector<uint16_t>> paths(items.size());
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::string error;
+    Py_BEGIN_ALLOW_THREADS
+    if (workers == 1) {
+        RunWorker(opt, items, paths, next, failed, error);
+    } else {
+        std::vector<std::thread> pool;
+        pool.reserve(workers);
+        for (size_t t = 0; t < workers; t++) {
+            pool.emplace_back(RunWorker, std::cref(opt), std::cref(items), std::ref(paths), std::ref(next),
+                              std::ref(failed), std::ref(error));
+        }
+        for (std::thread &thread : pool) thread.join();
+    }
+    Py_END_ALLOW_THREADS
+    Py_DECREF(sources);
+
+    if (failed) {
+        PyErr_SetString(PyExc_RuntimeError, error.c_str());
+        return nullptr;
+    }
+
+    size_t total = 0;
+    for (const auto &path : paths) total += path.size();
+    PyObject *states_out = PyBytes_FromStringAndSize(nullptr, static_cast<Py_ssize_t>(total * sizeof(uint16_t)));
+    PyObject *offsets_out =
+        PyBytes_FromStringAndSize(nullptr, static_cast<Py_ssize_t>((paths.size() + 1) * sizeof(uint64_t)));
+    if (!states_out || !offsets_out) {
+        Py_XDECREF(states_out);
+        Py_XDECREF(offsets_out);
+        return nullptr;
+    }
+    char *state_bytes = PyBytes_AS_STRING(states_out);
+    char *offset_bytes = PyBytes_AS_STRING(offsets_out);
+    uint64_t position = 0;
+    for (size_t i = 0; i < paths.size(); i++) {
+        std::memcpy(offset_bytes + i * sizeof(uint64_t), &position, sizeof(uint64_t));
+        std::memcpy(state_bytes + position * sizeof(uint16_t), paths[i].data(), paths[i].size() * sizeof(uint16_t));
+        position += paths[i].size();
+    }
+    std::memcpy(offset_bytes + paths.size() * sizeof(uint64_t), &position, sizeof(uint64_t));
+    return Py_BuildValue("(NN)", states_out, offsets_out);
+}
+
+PyObject *Language(PyObject *, PyObject *) {
+    return PyUnicode_FromString(cce_language_name());
+}
+
+PyObject *AbiVersion(PyObject *, PyObject *) {
+    return PyLong_FromUnsignedLong(cce_abi_version());
+}
+
+PyMethodDef kMethods[] = {
+    {"convert_batch", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(ConvertBatch)),
+     METH_VARARGS | METH_KEYWORDS,
+     "convert_batch(sources, offsets, mode=0, threads=0, recovery=None, tuning=None) -> (states, offsets)"},
+    {"language", Language, METH_NOARGS, "language() -> str"},
+    {"abi_version", AbiVersion, METH_NOARGS, "abi_version() -> int"},
+    {nullptr, nullptr, 0, nullptr},
+};
+
+PyModuleDef kModule = {
+    PyModuleDef_HEAD_INIT, "cce." CCE_STR(CCE_MODULE), "Completion engine C ABI bindings (one grammar per module)",
+    -1, kMethods, nullptr, nullptr, nullptr, nullptr,
+};
+
+}  // namespace
+
+PyMODINIT_FUNC CCE_CAT(PyInit_, CCE_MODULE)(void) {
+    if (cce_abi_version() != CCE_ABI_VERSION) {
+        PyErr_Format(PyExc_ImportError, "cce ABI version mismatch: library %u, header %d", cce_abi_version(),
+                     CCE_ABI_VERSION);
+        return nullptr;
+    }
+    return PyModule_Create(&kModule);
+}
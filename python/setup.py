@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+"""
+cce 파이썬 패키지 빌드 (엔진 C ABI 바인딩, python/cce_module.cc).
+
+먼저 저장소 루트에서 npx node-gyp rebuild로 언어별 정적 라이브러리 <lang>_engine을 만든 뒤
+    cd python && pip install .
+빌드된 라이브러리가 있는 언어마다 확장 모듈 cce._<lang>을 만든다 (없는 언어는 건너뜀).
+CCE_BUILD_DIR로 node-gyp 출력 디렉터리를 바꿀 수 있다 (기본: ../build/Release).
+Windows 외에는 문법/런타임이 라이브러리가 아니라 grammar_<lang>/*.o(문법 오브젝트 캐시)에 있어 함께 링크한다.
+"""
+
+import glob
+import os
+import sys
+
+from setuptools import Extension, setup
+
+PYTHON_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.dirname(PYTHON_DIR)
+BUILD_DIR = os.environ.get("CCE_BUILD_DIR", os.path.join(ROOT_DIR, "build", "Release"))
+
+# node-gyp 생성기별 정적 라이브러리 위치 (make / xcode / msvs)
+LIBRARY_PATTERNS = [
+    os.path.join("obj.target", "{lang}_engine.a"),
+    "lib{lang}_engine.a",
+    "{lang}_engine.lib",
+]
+
+
+def engine_library(lang):
+    for pattern in LIBRARY_PATTERNS:
+        path = os.path.join(BUILD_DIR, pattern.format(lang=lang))
+        if os.path.exists(path):
+            return path
+    return None
+
+
+def grammar_objects(lang):
+    return sorted(glob.glob(os.path.join(BUILD_DIR, f"grammar_{lang}", "*.o")))
+
+
+def extensions():
+    msvc = sys.platform == "win32"
+    modules = []
+    for lang in sorted(os.listdir(os.path.join(ROOT_DIR, "resources"))):
+        library = engine_library(lang)
+        if not library:
+            continue
+        modules.append(Extension(
+            f"cce._{lang}",
+            sources=["cce_module.cc"],
+            include_dirs=[os.path.join(ROOT_DIR, "native", "include")],
+            define_macros=[("CCE_MODULE", f"_{lang}")],
+            extra_objects=[library] + grammar_objects(lang),
+            extra_compile_args=["/std:c++17", "/EHsc"] if msvc else ["-std=c++17"],
+            extra_link_args=[] if msvc else ["-pthread"],
+            language="c++",
+        ))
+    if not modules:
+        print(f"[Warning] {BUILD_DIR}에 <lang>_engine 라이브러리가 없습니다 (npx node-gyp rebuild 먼저)", file=sys.stderr)
+    return modules
+
+
+setup(
+    name="cce",
+    version="0.1.0",
+    description="Completion engine C ABI bindings (state paths for research evaluation)",
+    packages=["cce"],
+    ext_modules=extensions(),
+    python_requires=">=3.8",
+)
@@ -5,15 +5,19 @@
  * 언어별로 분리된 Native Parser Addon, JSON DB, TokenMapper를 조율
  * 1. Native C++ Parser (Addon): 커서 위치의 파싱 상태(State ID) 분석
  * 2. JSON Database: 파싱 상태에 따른 구조적 후보군(Structural Candidates) 조회
- * 3. OpenAI LLM: 구조적 후보를 바탕으로 코드 생성
+ * 3. Text Backend: 구조적 후보를 코드로 생성 (로컬 토큰 모델 → OpenAI LLM 순, completionBackends.ts)
  */
 
 import * as vscode from "vscode";
 import * as fs from "fs";
-import OpenAI from "openai";
 import * as path from "path";
 import { TokenMapper } from "./mapLoader";
-import { SYSTEM_ROLE, generateCompletionPrompt } from "./prompts";
+import { EngineTuning, ParserAddon, SlotKind, loadParserAddon } from "./addonLoader";
+import { fillStructuralSlots } from "./slotFiller";
+import { CompletionBackend, FallbackBackend, OpenAIBackend, TokenModelBackend } from "./completionBackends";
+import { CompressedContext, DEFAULT_PROMPT_BUDGET, compressContext } from "./promptCompression";
+import { generateAuditPrompt } from "./prompts";
+import { ConversionWorker } from "./resultRing";
 
 // 구조적 후보 데이터 인터페이스 (DB 저장 형태)
 interface CandidateData {
@@ -34,10 +38,29 @@ export interface LanguageConfig {
   displayName: string;       // LLM 프롬프트에 사용할 언어 이름, e.g., "Small Basic"
 }
 
+export interface ReproSnapshot {
+    languageId: string;
+    mode: number;
+    byteOffset: number;
+    documentUri: string | undefined;
+    documentVersion: number | undefined;
+    fullText: string;
+    statePath: number[];
+    recoveryLimit: { maxVersions: number; maxCost: number };
+    lookaheadBytes: number;
+    phases: Record<string, number>;
+}
+
 export class CompletionService {
-    private parserAddon: any;
+    private parserAddon: ParserAddon | undefined;
     private fullText: string;
     private byteOffset: number;
+    private charOffset: number | undefined;  // byteOffset과 같은 위치의 UTF-16 오프셋 (fullText 인덱스)
+    private documentUri: string | undefined;
+    private documentVersion: number | undefined;
+    private statePath: number[] = [];  // 마지막 getStructCandidates의 상태 경로 (제약 디코딩 시작점)
+    private lastMode = 0;
+    private phases: Record<string, number> = {};  // 마지막 getStructCandidates의 단계별 시간 (ms, 재현 번들용)
     private languageId: string;
     private config: LanguageConfig;
     private extensionPath: string;
@@ -46,8 +69,12 @@ export class CompletionService {
     // 언어 ID를 키로 하는 정적 캐시 (여러 인스턴스 간 DB 공유)
     private static dbCache: Map<string, CandidateDB> = new Map();
     private static mapperCache: Map<string, TokenMapper> = new Map();
-
-    private openai: OpenAI | undefined;
+    private static tokenModelTried: Set<string> = new Set();
+    private static recoveryLimits: Map<ParserAddon, string> = new Map();  // addon에 마지막으로 건 "versions:cost"
+    private static tunings: Map<string, EngineTuning | null> = new Map();  // resources/<lang>/tuning.json (없으면 null)
+    private static dbBytes: Map<string, number> = new Map();  // 원본 JSON 크기 (파싱된 객체 메모리의 하한 추정, 메모리 예산용)
+    // completion.parseOnWorker: 언어별 네이티브 컨버전 워커와 시작할 때 건 복구 상한 "versions:cost" (null이면 시작 실패)
+    private static workers: Map<string, { worker: ConversionWorker | null; limit: string }> = new Map();
 
     // =========================================================================
     // [생성자] 서비스 초기화 및 리소스 로딩
@@ -57,35 +84,20 @@ export class CompletionService {
         languageId: string,
         config: LanguageConfig,
         fullText: string,
-        byteOffset: number
+        byteOffset: number,
+        documentUri?: string,
+        documentVersion?: number,
+        charOffset?: number
     ) {
         this.fullText = fullText;
         this.byteOffset = byteOffset;
+        this.charOffset = charOffset;
+        this.documentUri = documentUri;
+        this.documentVersion = documentVersion;
         this.languageId = languageId;
         this.config = config;
         this.extensionPath = extensionPath;
 
-        // OpenAI API Key 로딩 (secrets.json)
-        let apiKey = "";
-        try {
-            const secretPath = path.join(extensionPath, 'secrets.json');
-            if (fs.existsSync(secretPath)) {
-                const secretData = fs.readFileSync(secretPath, 'utf8');
-                const secrets = JSON.parse(secretData);
-                apiKey = secrets.apiKey;
-                console.log("[Info] Loaded API Key from secrets.json");
-            } else {
-                console.error(`[Error] secrets.json not found at: ${secretPath}`);
-            }
-        } catch (err) {
-            console.error("[Error] Failed to read secrets.json:", err);
-        }
-        if (!apiKey) {
-            vscode.window.showErrorMessage("API Key가 없습니다. 프로젝트 루트에 secrets.json을 생성하고 키를 넣어주세요.");
-        } else {
-            this.openai = new OpenAI({ apiKey });
-        }
-
         // TokenMapper 로딩 (언어별 캐시)
         if (!CompletionService.mapperCache.has(languageId)) {
             const mappingPath = path.join(extensionPath, 'resources', languageId, config.tokenMapFile);
@@ -101,14 +113,17 @@ export class CompletionService {
             }
         }
 
-        // Native C++ Addon 로딩
-        const addonPath = path.join(extensionPath, 'build', 'Release', `${config.addonName}.node`);
-        try {
-            this.parserAddon = require(addonPath);
-            console.log(`[Info] Addon loaded: ${config.addonName}`);
-        } catch (e) {
-            console.error(`[Error] Addon 로딩 실패! 경로: ${addonPath}`, e);
+        // Native C++ Addon 로딩 (DocumentSync와 같은 인스턴스 공유)
+        this.parserAddon = loadParserAddon(extensionPath, config.addonName);
+        if (!this.parserAddon) {
             vscode.window.showErrorMessage(`파서 모듈을 찾을 수 없습니다: ${config.addonName}.node`);
+        } else {
+            if (!CompletionService.tokenModelTried.has(languageId)) {
+                this.loadTokenModel(extensionPath);
+            }
+            if (!CompletionService.tunings.has(languageId)) {
+                this.loadTuning(extensionPath);
+            }
         }
 
         // 구조적 후보 DB 로딩 (언어별 캐시)
@@ -127,6 +142,7 @@ export class CompletionService {
             if (fs.existsSync(jsonPath)) {
                 const rawData = fs.readFileSync(jsonPath, 'utf8');
                 CompletionService.dbCache.set(this.languageId, JSON.parse(rawData));
+                CompletionService.dbBytes.set(this.languageId, Buffer.byteLength(rawData, 'utf8'));
                 console.log(`[Info] Candidate DB loaded for "${this.languageId}"`);
             } else {
                 console.error(`[Error] Candidate JSON not found at: ${jsonPath}`);
@@ -137,12 +153,48 @@ export class CompletionService {
         }
     }
 
+    // 메모리 예산(memoryBudget.ts)용: 로드된 언어별 DB 크기 추정치 / 해제 (다음 생성자에서 다시 로드)
+    public static cachedDbBytes(languageId: string): number {
+        return CompletionService.dbCache.has(languageId) ? (CompletionService.dbBytes.get(languageId) ?? 0) : 0;
+    }
+
+    public static releaseLanguage(languageId: string) {
+        CompletionService.dbCache.delete(languageId);
+        CompletionService.mapperCache.delete(languageId);
+        CompletionService.dbBytes.delete(languageId);
+        CompletionService.workers.get(languageId)?.worker?.dispose();
+        CompletionService.workers.delete(languageId);
+    }
+
+    // 토큰 모델(resources/<lang>/token_model.bin)은 선택 사항. 없으면 열린 문서 빈도만으로 동작
+    private loadTokenModel(extensionPath: string) {
+        CompletionService.tokenModelTried.add(this.languageId);
+        const modelPath = path.join(extensionPath, 'resources', this.languageId, 'token_model.bin');
+        if (!fs.existsSync(modelPath) || !this.parserAddon?.loadTokenModel) { return; }
+        if (this.parserAddon.loadTokenModel(modelPath)) {
+            console.log(`[Info] Token model mapped for "${this.languageId}"`);
+        }
+    }
+
+    // 튜닝 프로파일(resources/<lang>/tuning.json, bench/autotune.py)은 선택 사항. addon이 읽어 복구 상한/lookahead 창에 바로 적용
+    private loadTuning(extensionPath: string) {
+        const tuningPath = path.join(extensionPath, 'resources', this.languageId, 'tuning.json');
+        let tuning: EngineTuning | null = null;
+        if (fs.existsSync(tuningPath) && this.parserAddon?.loadTuning) {
+            tuning = this.parserAddon.loadTuning(tuningPath);
+            if (tuning) {
+                console.log(`[Info] Tuning profile loaded for "${this.languageId}": recovery ${tuning.maxVersions}:${tuning.maxCost}, lookahead ${tuning.lookaheadBytes}`);
+            }
+        }
+        CompletionService.tunings.set(this.languageId, tuning);
+    }
+
     // * 파서 상태들(states)에 매핑되는 구조적 후보들을 조회하고 합침
     // * 여러 State에서 공통적으로 등장하는 후보는 빈도수(value)를 합산
     // * 최종적으로 빈도수 높은 순서대로 정렬하여 반환
-    public lookupDB(states: number[]): { finalResult: any[], stateLines: string[] } {
+    // * verbose가 false면 콘솔 로그를 남기지 않음 (키 입력마다 호출되는 인라인 경로)
+    public lookupDB(states: number[], verbose = true): { finalResult: any[], stateLines: string[] } {
         const db = CompletionService.dbCache.get(this.languageId);
-        const mapper = CompletionService.mapperCache.get(this.languageId);
         const stateLines: string[] = [];
 
         if (!db) {
@@ -157,7 +209,7 @@ export class CompletionService {
             if (db[stateKey]) {
                 const candidates = db[stateKey];
                 const msg = `State ${state}: Found ${candidates.length} candidates`;
-                console.log(msg);
+                if (verbose) { console.log(msg); }
                 stateLines.push(msg);
                 candidates.forEach((item) => {
                     if (mergedMap.has(item.key)) {
@@ -168,7 +220,7 @@ export class CompletionService {
                 });
             } else {
                 const msg = `No state ${state} in DB`;
-                console.log(msg);
+                if (verbose) { console.log(msg); }
                 stateLines.push(msg);
             }
         }
@@ -176,23 +228,30 @@ export class CompletionService {
         const result = Array.from(mergedMap.values());
         result.sort((a, b) => b.value - a.value);
 
-        const finalResult = result.map((item, index) => {
+        const finalResult = this.toFinalResult(result);
+
+        if (verbose && finalResult.length > 0) {
+            console.log("[lookupDB] Final Merged Result:", JSON.stringify(finalResult, null, 2));
+        } else if (verbose) {
+            console.log("[lookupDB] No candidates found.");
+        }
+        return { finalResult, stateLines };
+    }
+
+    // value 내림차순으로 정렬된 (raw key, value) → 완성 항목 (사람이 읽는 key, 순위 sortText)
+    private toFinalResult(ranked: { key: string; value: number }[]): any[] {
+        const mapper = CompletionService.mapperCache.get(this.languageId);
+        return ranked.map((item, index) => {
             const readableKey = mapper
                 ? this.convertKeyToReadable(item.key, mapper)
                 : item.key;
             return {
                 key: readableKey,
+                rawKey: item.key,
                 value: item.value,
                 sortText: (index + 1).toString().padStart(3, "0")
             };
         });
-
-        if (finalResult.length > 0) {
-            console.log("[lookupDB] Final Merged Result:", JSON.stringify(finalResult, null, 2));
-        } else {
-            console.log("[lookupDB] No candidates found.");
-        }
-        return { finalResult, stateLines };
     }
 
     // helper
@@ -208,6 +267,27 @@ export class CompletionService {
         }
     }
 
+    /**
+     * 문서 앞부분 [0, charOffset)의 소스.
+     * 같은 버전이면 생성 시 받은 fullText를 잘라 쓰고 (getText(Range) 재호출 없음),
+     * 버전이 다르면 undefined를 돌려 호출측이 문서에서 다시 읽게 한다.
+     */
+    public contextBefore(documentVersion: number, charOffset: number): string | undefined {
+        if (this.documentVersion !== documentVersion) { return undefined; }
+        return this.fullText.substring(0, charOffset);
+    }
+
+    // 생성 시점 커서 직전까지의 소스
+    private contextBeforeCursor(): string {
+        if (this.charOffset !== undefined) {
+            return this.fullText.substring(0, this.charOffset);
+        }
+        // byteOffset은 UTF-8 바이트 단위이므로 Buffer로 자른 뒤 다시 문자열로 디코드
+        return Buffer.from(this.fullText, "utf8")
+            .slice(0, this.byteOffset)
+            .toString("utf8");
+    }
+
     public onDataReceived(callback: (data: any) => void) {
         this.dataReceivedCallback = callback;
     }
@@ -215,22 +295,125 @@ export class CompletionService {
     // =========================================================================
     // [Core Logic 1] Structural Candidates
     // =========================================================================
-    public getStructCandidates() {
+    // 문서 세션(보존 트리)이 같은 버전이면 재사용하고, 아니면 전체 소스로 파싱
+    private parseStatePath(mode: number): number[] {
+        const addon = this.parserAddon!;
+        this.applyRecoveryLimit(addon);
+        if (this.documentUri !== undefined && this.documentVersion !== undefined && addon.getDocumentConversionResult) {
+            const states = addon.getDocumentConversionResult(this.documentUri, this.documentVersion, this.byteOffset, mode);
+            if (states) { return states; }
+            console.log("[Info] Document session missing or stale, parsing from source");
+        }
+        return addon.getConversionResult(this.fullText, this.byteOffset, mode);
+    }
+
+    // completion.recoveryLimit.* 를 addon에 반영 (바뀌었을 때만). 둘 다 0이면 언어별 튜닝 프로파일 값
+    private applyRecoveryLimit(addon: ParserAddon) {
+        if (!addon.setRecoveryLimit) { return; }
+        const { maxVersions, maxCost } = this.effectiveRecoveryLimit();
+        const key = `${maxVersions}:${maxCost}`;
+        if (CompletionService.recoveryLimits.get(addon) === key) { return; }
+        addon.setRecoveryLimit(maxVersions, maxCost);
+        CompletionService.recoveryLimits.set(addon, key);
+    }
+
+    private effectiveRecoveryLimit(): { maxVersions: number; maxCost: number } {
+        const cfg = vscode.workspace.getConfiguration('completion');
+        const maxVersions = Math.max(0, cfg.get<number>('recoveryLimit.maxVersions', 0));
+        const maxCost = Math.max(0, cfg.get<number>('recoveryLimit.maxCost', 0));
+        const tuning = CompletionService.tunings.get(this.languageId);
+        if (maxVersions === 0 && maxCost === 0 && tuning) {
+            return { maxVersions: tuning.maxVersions, maxCost: tuning.maxCost };
+        }
+        return { maxVersions, maxCost };
+    }
+
+    // 워커 경로(completion.parseOnWorker)면 후보를 넘길 때 끝나는 Promise, 아니면 undefined (동기 완료)
+    // signal이 취소되면 네이티브 컨버전을 시작하지 않고, 워커에 넘긴 작업도 취소한다 (후보 전달 없음)
+    public getStructCandidates(signal?: AbortSignal): Promise<void> | undefined {
+        this.phases = {};
         try {
             const mode = vscode.workspace.getConfiguration('completion').get<number>('parsingMode', 0);
+            this.lastMode = mode;
             const headerLine = `[${this.config.displayName}] Requesting Parse: byteOffset ${this.byteOffset}, mode=${mode}`;
             console.log(headerLine);
-            const states = this.parserAddon.getConversionResult(this.fullText, this.byteOffset, mode);
+            if (!this.parserAddon || signal?.aborted) { return; }
+            const worker = this.conversionWorker();
+            if (worker) {
+                return this.structCandidatesOnWorker(worker, mode, headerLine, signal);
+            }
+            const states = this.timePhase("convert", () => this.parseStatePath(mode));
+            const { finalResult, stateLines } = this.timePhase("lookup", () => this.lookupDB(states));
+            this.deliverStructCandidates(headerLine, states, stateLines, finalResult);
+        } catch (e) {
+            console.error("Parser Error:", e);
+        }
+    }
+
+    // completion.parseOnWorker: 컨버전과 후보 순위를 네이티브 워커에서 계산하고 결과 링으로 받는다
+    // (문서 세션 대신 소스 사본을 파싱. 워커가 없거나 멈추면 동기 경로)
+    private async structCandidatesOnWorker(worker: ConversionWorker, mode: number, headerLine: string, signal?: AbortSignal) {
+        try {
+            const start = performance.now();
+            const result = await worker.convert(this.fullText, this.byteOffset, mode, signal);
+            this.phases.convert = performance.now() - start;
+            // 취소된 요청은 동기 경로로 다시 파싱하지 않는다
+            if (signal?.aborted) { return; }
+            if (!result) {
+                console.warn("[Warning] Conversion worker unavailable, parsing on the extension thread");
+                const states = this.parseStatePath(mode);
+                const { finalResult, stateLines } = this.lookupDB(states);
+                this.deliverStructCandidates(headerLine, states, stateLines, finalResult);
+                return;
+            }
+            const stateLines = [`[Worker] ${result.candidates.length} candidates for ${result.statePath.length} states`];
+            const finalResult = this.timePhase("lookup", () => this.toFinalResult(result.candidates));
+            this.deliverStructCandidates(headerLine, result.statePath, stateLines, finalResult);
+        } catch (e) {
+            console.error("Parser Error:", e);
+        }
+    }
+
+    // 언어별 워커 (설정이 꺼져 있으면 undefined). 복구 상한이 바뀌면 다시 시작한다
+    private conversionWorker(): ConversionWorker | undefined {
+        if (!vscode.workspace.getConfiguration('completion').get<boolean>('parseOnWorker', false)) { return undefined; }
+        const { maxVersions, maxCost } = this.effectiveRecoveryLimit();
+        const limit = `${maxVersions}:${maxCost}`;
+        const entry = CompletionService.workers.get(this.languageId);
+        if (entry && entry.limit === limit) { return entry.worker ?? undefined; }
+        entry?.worker?.dispose();
+
+        const resources = path.join(this.extensionPath, 'resources', this.languageId);
+        const tuningPath = path.join(resources, 'tuning.json');
+        const worker = ConversionWorker.start(this.parserAddon!, {
+            candidates: path.join(resources, this.config.candidatesFile),
+            tuning: fs.existsSync(tuningPath) ? tuningPath : undefined,
+            maxVersions,
+            maxCost,
+        }) ?? null;
+        CompletionService.workers.set(this.languageId, { worker, limit });
+        if (worker) {
+            console.log(`[Info] Conversion worker started for "${this.languageId}"`);
+        } else {
+            console.warn(`[Warning] Conversion worker not available for "${this.languageId}"`);
+        }
+        return worker ?? undefined;
+    }
+
+    private deliverStructCandidates(headerLine: string, states: number[], stateLines: string[], finalResult: any[]) {
+        try {
+            this.statePath = states;
             const pathLine = `Parsed State Path: ${JSON.stringify(states)}`;
             console.log(pathLine);
-
-            const { finalResult, stateLines } = this.lookupDB(states);
+            const dumpStart = performance.now();
 
             // ============================================================
             // [Debug Dump] Ctrl+Space 결과를 임시 파일로 저장
             // - last_completion_dump.txt
-            // - last_completion_prompt.txt
+            // - last_completion_prompt.txt (completion.auditPrompt를 켰을 때만)
             // 두 파일 모두 매 호출마다 덮어쓰기. .gitignore 등록됨.
+            // 문법상 나올 수 없는 후보는 빌드 때 <lang>_prune_candidates가 DB에서 지우므로
+            // LLM 판정 프롬프트는 기본으로 만들지 않는다.
             // ============================================================
 
             // --- (1) last_completion_dump.txt ---
@@ -249,77 +432,131 @@ export class CompletionService {
             }
 
             // --- (2) last_completion_prompt.txt ---
-            // byteOffset은 UTF-8 바이트 단위이므로 Buffer로 자른 뒤 다시 문자열로 디코드
-            const sourceUpToCursor = Buffer.from(this.fullText, "utf8")
-                .slice(0, this.byteOffset)
-                .toString("utf8");
-            const promptLines = [
-                `당신은 ${this.config.displayName} 문법 전문가입니다.`,
-                `아래는 특정 커서 위치에서의 자동완성 구조 후보 목록입니다.`,
-                ``,
-                `[커서 직전까지의 소스 코드 (커서 위치는 <<<커서>>>로 표시)]`,
-                sourceUpToCursor + "<<<커서>>>",
-                ``,
-                `[파서 State Path] ${JSON.stringify(states)}`,
-                `[State별 DB 조회 결과]`,
-                ...stateLines,
-                ``,
-                `[후보 목록 (sortText : key)]`,
-                ...finalResult.map(item => `${item.sortText} : ${item.key}`),
-                ``,
-                `[작업]`,
-                `각 후보가 커서 위치 직후에 문법적으로 나타날 수 있는지 판정하세요.`,
-                ``,
-                `출력 형식 (각 줄에 하나):`,
-                `  sortText | 판정 (valid|suspect|unknown) | 한 줄 사유`,
-                `- valid → 사유 생략 가능`,
-                `- suspect / unknown → 사유 필수`,
-                `- 확신이 없으면 "unknown"으로 표시. "suspect"는 근거를 댈 수 있을 때만.`
-            ];
-            const promptPath = path.join(this.extensionPath, "last_completion_prompt.txt");
-            try {
-                fs.writeFileSync(promptPath, promptLines.join("\n") + "\n", "utf8");
-            } catch (e) {
-                console.error("[Prompt] Failed to write prompt file:", e);
+            if (vscode.workspace.getConfiguration('completion').get<boolean>('auditPrompt', false)) {
+                this.writeAuditPrompt(states, stateLines, finalResult);
             }
 
             // ============================================================
             // [Debug Dump End]
             // ============================================================
+            this.phases.dump = performance.now() - dumpStart;
 
             if (this.dataReceivedCallback) {
-                this.dataReceivedCallback(finalResult);
+                this.timePhase("deliver", () => this.dataReceivedCallback!(finalResult));
             }
         } catch (e) {
             console.error("Parser Error:", e);
         }
     }
 
+    private writeAuditPrompt(states: number[], stateLines: string[], finalResult: any[]) {
+        const prompt = generateAuditPrompt(this.config.displayName, this.contextBeforeCursor(), states, stateLines, finalResult);
+        const promptPath = path.join(this.extensionPath, "last_completion_prompt.txt");
+        try {
+            fs.writeFileSync(promptPath, prompt + "\n", "utf8");
+        } catch (e) {
+            console.error("[Prompt] Failed to write prompt file:", e);
+        }
+    }
+
+    private timePhase<T>(name: string, fn: () => T): T {
+        const start = performance.now();
+        try {
+            return fn();
+        } finally {
+            this.phases[name] = performance.now() - start;
+        }
+    }
+
+    // 마지막 getStructCandidates 요청을 재현하는 데 필요한 입력과 단계별 시간 (느린 요청 번들용)
+    public reproSnapshot(): ReproSnapshot {
+        return {
+            languageId: this.languageId,
+            mode: this.lastMode,
+            byteOffset: this.byteOffset,
+            documentUri: this.documentUri,
+            documentVersion: this.documentVersion,
+            fullText: this.fullText,
+            statePath: [...this.statePath],
+            recoveryLimit: this.effectiveRecoveryLimit(),
+            lookaheadBytes: CompletionService.tunings.get(this.languageId)?.lookaheadBytes ?? 0,
+            phases: { ...this.phases },
+        };
+    }
+
     // =========================================================================
-    // [Core Logic 2] Textual Candidates (LLM)
+    // [Core Logic 1.2] Inline Fast Path
+    // - 인라인 고스트 텍스트용: 같은 버전의 문서 세션만 쓰고, 전체 소스 파싱/덤프 파일은 생략
+    // - 세션이 없거나 낡았으면 undefined → 다음 키 입력(새 버전)에서 다시 시도
     // =========================================================================
-    public async getTextCandidate(structCandidate: string, fullContext: string): Promise<string> {
-        try {
-            const prompt = generateCompletionPrompt(fullContext, structCandidate, this.config.displayName);
-            console.log(`[LLM Prompt] ${prompt}`);
-
-            if (!this.openai) { return ""; }
-
-            const chat_completion = await this.openai.chat.completions.create({
-                model: "gpt-3.5-turbo",
-                messages: [
-                    { role: "system", content: SYSTEM_ROLE },
-                    { role: "user", content: prompt }
-                ]
-            });
-
-            const response = chat_completion.choices[0].message.content?.trim() || "";
-            console.log(`[LLM Response] ${response}`);
-            return response;
-
-        } catch (error) {
-            console.error("[LLM Error]", error);
-            return "";
+    public inlineCandidates(): any[] | undefined {
+        const addon = this.parserAddon;
+        if (!addon?.getDocumentConversionResult || this.documentUri === undefined || this.documentVersion === undefined) {
+            return undefined;
+        }
+        const mode = vscode.workspace.getConfiguration('completion').get<number>('parsingMode', 0);
+        const states = addon.getDocumentConversionResult(this.documentUri, this.documentVersion, this.byteOffset, mode);
+        if (!states) { return undefined; }
+        this.statePath = states;
+        return this.lookupDB(states, false).finalResult;
+    }
+
+    // =========================================================================
+    // [Core Logic 1.5] Local Slot Filling
+    // - 식별자/리터럴 슬롯만 있는 후보는 문서 색인으로 바로 코드로 만든다 (LLM 미사용)
+    // - 비단말(Expr 등)이 섞여 있으면 null → 호출측이 LLM으로 넘김
+    // =========================================================================
+    public fillSlotsLocally(rawKey: string): string | null {
+        const mapper = CompletionService.mapperCache.get(this.languageId);
+        const addon = this.parserAddon;
+        if (!mapper || !addon?.queryIdentifiers || this.documentUri === undefined) { return null; }
+
+        const includeWorkspace = vscode.workspace.getConfiguration('completion').get<boolean>('workspaceIdentifiers', false);
+        const uri = this.documentUri;
+        return fillStructuralSlots(rawKey, mapper, (kind: SlotKind, count: number) =>
+            addon.queryIdentifiers(uri, this.byteOffset, kind, count, includeWorkspace).map(s => s.text)
+        );
+    }
+
+    // =========================================================================
+    // [Core Logic 2] Textual Candidates
+    // - completion.textBackend: auto(로컬 → 원격) | local | remote
+    // =========================================================================
+    private createTextBackend(): CompletionBackend {
+        const setting = vscode.workspace.getConfiguration('completion').get<string>('textBackend', 'auto');
+        const includeWorkspace = vscode.workspace.getConfiguration('completion').get<boolean>('workspaceIdentifiers', false);
+        const backends: CompletionBackend[] = [];
+        if (setting !== "remote" && this.parserAddon && this.documentUri !== undefined) {
+            backends.push(new TokenModelBackend(this.parserAddon, this.documentUri, this.byteOffset, includeWorkspace, this.statePath));
+        }
+        if (setting !== "local") {
+            backends.push(new OpenAIBackend(this.extensionPath, this.config.displayName));
         }
+        return new FallbackBackend(backends);
+    }
+
+    // 원격 LLM 프롬프트용: 먼 문맥을 구조 요약으로 바꿔 completion.promptTokenBudget 안에 맞춘다
+    private compressForPrompt(fullContext: string): CompressedContext {
+        const maxTokens = vscode.workspace.getConfiguration('completion').get<number>('promptTokenBudget', DEFAULT_PROMPT_BUDGET.maxTokens);
+        const outline = this.parserAddon?.documentOutline && this.documentUri !== undefined && this.documentVersion !== undefined
+            ? this.parserAddon.documentOutline(this.documentUri, this.documentVersion, this.byteOffset)
+            : null;
+        const compressed = compressContext(fullContext, outline, CompletionService.mapperCache.get(this.languageId),
+            { ...DEFAULT_PROMPT_BUDGET, maxTokens });
+        if (compressed.summary) {
+            console.log(`[Prompt] compressed context ${compressed.originalTokens} -> ${compressed.compressedTokens} tokens (verbatim from line ${compressed.verbatimFromLine + 1})`);
+        }
+        return compressed;
+    }
+
+    public async getTextCandidate(structCandidate: string, fullContext: string, rawKey?: string, signal?: AbortSignal): Promise<string> {
+        const compressed = this.compressForPrompt(fullContext);
+        return this.createTextBackend().complete({
+            structuralHint: structCandidate,
+            rawKey,
+            fullContext: compressed.verbatim,
+            contextSummary: compressed.summary || undefined,
+            signal,
+        });
     }
 }
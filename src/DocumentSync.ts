@@ -0,0 +1,92 @@
+/**
+ * @file DocumentSync.ts
+ * @brief 열린 문서를 언어별 addon의 문서 세션과 동기화
+ *
+ * open/change/close 이벤트를 그대로 addon에 전달한다.
+ * addon은 세션마다 텍스트와 트리를 보존하고 contentChanges만큼 증분 갱신하므로,
+ * Ctrl+Space 시점에는 전체 재파싱 없이 보존 트리와 식별자 색인을 바로 쓸 수 있다.
+ * 커서 위치의 바이트 오프셋도 세션의 줄 색인으로 구한다 (byteOffsetAt).
+ */
+
+import * as vscode from "vscode";
+import { LanguageConfig } from "./CompletionService";
+import { ParserAddon, loadParserAddon } from "./addonLoader";
+
+/**
+ * 커서 위치의 UTF-8 바이트 오프셋.
+ * 동기화된 세션이 있으면 줄 색인 조회(O(log n))로 끝나고,
+ * 없으면 커서 앞 텍스트를 잘라 Buffer.byteLength로 센다.
+ */
+export function byteOffsetAt(addon: ParserAddon | undefined, document: vscode.TextDocument, position: vscode.Position): number {
+    if (addon?.positionToByte) {
+        const byte = addon.positionToByte(document.uri.toString(), document.version, position.line, position.character);
+        if (byte !== null) { return byte; }
+    }
+    const textBeforeCursor = document.getText(new vscode.Range(new vscode.Position(0, 0), position));
+    return Buffer.byteLength(textBeforeCursor, 'utf8');
+}
+
+export class DocumentSync implements vscode.Disposable {
+    private disposables: vscode.Disposable[] = [];
+
+    constructor(
+        private extensionPath: string,
+        private configs: Record<string, LanguageConfig>
+    ) {
+        vscode.workspace.textDocuments.forEach((document) => this.open(document));
+        this.disposables.push(
+            vscode.workspace.onDidOpenTextDocument((document) => this.open(document)),
+            vscode.workspace.onDidChangeTextDocument((event) => this.change(event)),
+            vscode.workspace.onDidCloseTextDocument((document) => this.close(document))
+        );
+    }
+
+    private addonFor(document: vscode.TextDocument): ParserAddon | undefined {
+        const config = this.configs[document.languageId];
+        if (!config) { return undefined; }
+        return loadParserAddon(this.extensionPath, config.addonName);
+    }
+
+    private open(document: vscode.TextDocument) {
+        const addon = this.addonFor(document);
+        if (!addon?.openDocument) { return; }
+        try {
+            addon.openDocument(document.uri.toString(), document.getText(), document.version);
+        } catch (e) {
+            console.error(`[DocumentSync] openDocument failed: ${document.uri.toString()}`, e);
+        }
+    }
+
+    private change(event: vscode.TextDocumentChangeEvent) {
+        if (event.contentChanges.length === 0) { return; }
+        const addon = this.addonFor(event.document);
+        if (!addon?.editDocument) { return; }
+
+        const uri = event.document.uri.toString();
+        const changes = event.contentChanges.map((c) => ({
+            offset: c.rangeOffset,
+            length: c.rangeLength,
+            text: c.text,
+        }));
+        try {
+            // 세션이 없으면(로딩 전에 열린 문서 등) 전체 텍스트로 다시 연다
+            if (!addon.editDocument(uri, event.document.version, changes)) {
+                this.open(event.document);
+            }
+        } catch (e) {
+            console.error(`[DocumentSync] editDocument failed: ${uri}`, e);
+            this.open(event.document);
+        }
+    }
+
+    private close(document: vscode.TextDocument) {
+        const addon = this.addonFor(document);
+        if (!addon?.closeDocument) { return; }
+        addon.closeDocument(document.uri.toString());
+    }
+
+    dispose() {
+        this.disposables.forEach((d) => d.dispose());
+        this.disposables = [];
+    }
+}
@@ -0,0 +1,190 @@
+/**
+ * @file addonLoader.ts
+ * @brief 언어별 Native Parser Addon 로딩 및 인터페이스 정의
+ *
+ * CompletionService(요청 단위)와 DocumentSync(문서 수명 단위)가 같은 addon 인스턴스를 공유한다.
+ */
+
+import * as path from "path";
+
+// VS Code TextDocumentContentChangeEvent를 addon에 넘기는 형식 (UTF-16 단위)
+export interface AddonTextChange {
+    offset: number;
+    length: number;
+    text: string;
+}
+
+export type SlotKind = "identifier" | "member" | "literal";
+
+export interface TokenProposal {
+    tokens: string[];
+    logProb: number;
+}
+
+// 제약 디코딩 한 단계의 결과 (text는 익명 토큰처럼 텍스트가 정해진 단말에만 있음)
+export interface AllowedTerminal {
+    symbol: string;
+    text?: string;
+}
+
+export interface ConstrainedStep {
+    accepted: boolean;
+    complete: boolean;
+    allowed: AllowedTerminal[];
+}
+
+export interface LinePosition {
+    line: number;
+    character: number;  // UTF-16 단위 (vscode.Position과 동일)
+}
+
+// documentOutline 한 줄 (text는 식별자/멤버/익명 토큰에만 있음)
+export interface OutlineLine {
+    line: number;
+    depth: number;       // 감싸는 함수/클래스 등 스코프 노드 수
+    signature: boolean;  // 스코프 노드가 시작되는 줄
+    tokens: { symbol: string; text?: string }[];
+}
+
+// memoryStats 결과 (바이트 단위)
+export interface EngineMemoryStats {
+    engineBytes: number;          // 세션이 가진 트리/파서 할당 + sessionBytes (예산과 비교하는 값, 축출하면 준다)
+    treeSitterBytes: number;      // 계수 할당자로 잰 트리/파서 할당 (프로세스 전체, 워커/스크래치 파서 포함)
+    treeSitterPeakBytes: number;
+    sessionBytes: number;         // 세션 텍스트/줄 색인/식별자 색인/토큰 빈도 추정치
+    budgetBytes: number;          // 0이면 무제한
+    sessions: number;
+    residentSessions: number;     // 트리를 보존 중인 세션 (나머지는 축출됨)
+    evictions: number;
+    rebuilds: number;
+}
+
+// getStats 결과 (프로세스 누적, statePathMax만 최대값). 상세 항목은 setStatsDetail(true)일 때만 증가
+export interface EngineStats {
+    detail: boolean;
+    conversions: number;
+    parses: number;
+    bytesParsed: number;
+    tokensLexed: number;       // 상세
+    parseActions: number;      // 상세: shift + reduce
+    recoverySteps: number;     // 상세
+    recoveryCapped: number;    // 복구 상한에 걸려 첫 오류 직전 경로로 대체한 파싱
+    statePathStates: number;
+    statePathMax: number;
+    allocations: number;       // Tree-sitter 할당 호출
+    allocatedBytes: number;
+    sessionHits: number;
+    sessionMisses: number;
+    sessionRebuilds: number;
+}
+
+// loadTuning 결과 (resources/<lang>/tuning.json에서 엔진에 적용된 값)
+export interface EngineTuning {
+    maxVersions: number;
+    maxCost: number;
+    lookaheadBytes: number;  // 0이면 문서 끝까지
+}
+
+export interface IdentifierSuggestion {
+    text: string;
+    kind: SlotKind;
+    score: number;
+}
+
+// native/src/addon.cc에서 export하는 함수들
+export interface ConversionWorkerOptions {
+    candidates: string;    // resources/<lang>/candidates.json
+    tuning?: string;       // resources/<lang>/tuning.json
+    maxVersions?: number;  // setRecoveryLimit과 같은 값 (tuning보다 나중에 적용)
+    maxCost?: number;
+}
+
+export interface ParserAddon {
+    getConversionResult(sourceCode: string, byteOffset: number, mode?: number): number[];
+
+    // [Document Sessions] 보존 트리 + 식별자 색인
+    openDocument(uri: string, text: string, version: number): void;
+    editDocument(uri: string, version: number, changes: AddonTextChange[]): boolean;
+    closeDocument(uri: string): void;
+    getDocumentConversionResult(uri: string, version: number, byteOffset: number, mode?: number): number[] | null;
+    // 세션의 줄 색인으로 변환 (세션이 없거나 버전이 다르면 null)
+    positionToByte(uri: string, version: number, line: number, character: number): number | null;
+    byteToPosition(uri: string, version: number, byteOffset: number): LinePosition | null;
+    documentOutline(uri: string, version: number, endByte: number): OutlineLine[] | null;
+    // 식별자/리터럴 내용/주석을 'x'·공백으로 가린 소스 (바이트 길이·토큰 범주 보존, 재현 번들용)
+    redactSource(uri: string, version: number): string | null;
+    queryIdentifiers(uri: string, byteOffset: number, kind: SlotKind, limit?: number, includeWorkspace?: boolean): IdentifierSuggestion[];
+
+    // [Semantic Tokens] VS Code 상대 인코딩, delta는 마지막 결과 이후 변경분 (resultId가 다르면 data 전체)
+    semanticTokensLegend(): { tokenTypes: string[]; tokenModifiers: string[] };
+    semanticTokens(uri: string, version: number): { resultId: string; data: Uint32Array } | null;
+    semanticTokensDelta(uri: string, version: number, previousResultId: string):
+        | { resultId: string; edits: { start: number; deleteCount: number; data: Uint32Array }[] }
+        | { resultId: string; data: Uint32Array }
+        | null;
+
+    // [Token Stream] 세션 단말 토큰열 ([startByte, endByte)와 겹치는 것만). 세션이 없거나 버전이 다르면 null
+    // flags: 1 extra, 2 분류 노드의 첫 토큰, 비트 2-3 감싸는 분류 노드의 SymbolClass (src/tokenContext.ts)
+    documentTokens(uri: string, version: number, startByte?: number, endByte?: number):
+        { symbols: Uint16Array; starts: Uint32Array; lengths: Uint32Array; flags: Uint8Array } | null;
+
+    // [Memory Budget] 예산을 넘으면 오래 안 쓴 세션의 트리/색인을 버린다 (다음 조회 때 다시 파싱)
+    setMemoryBudget(bytes: number): void;
+    trimMemory(targetBytes: number): { evicted: number; engineBytes: number };
+    memoryStats(): EngineMemoryStats;
+
+    // [Stats] 요청 카운터 (src/engineStats.ts가 요청 전후 차이로 집계)
+    getStats(): EngineStats;
+    resetStats(): void;
+    setStatsDetail(enabled: boolean): void;
+    // 컨버전 오류 복구 상한 (둘 다 0이면 끔, completion.recoveryLimit.*)
+    setRecoveryLimit(maxVersions: number, maxCost: number): void;
+    // 모드 2에서 커서 뒤로 파서에 넘길 바이트 수 (0이면 문서 끝까지)
+    setLookaheadBytes(bytes: number): void;
+    // resources/<lang>/tuning.json 적용 (복구 상한 + lookahead 창). 실패하면 null
+    loadTuning(path: string): EngineTuning | null;
+
+    // [Token Model] 메모리 매핑 n-gram 모델 + 열린 문서 빈도
+    loadTokenModel(path: string): boolean;
+    proposeTokens(uri: string, byteOffset: number, rawKey: string, includeWorkspace?: boolean, statePath?: number[]): TokenProposal | null;
+
+    // [Constrained Decoding] 커서 파싱 스택 위에서 토큰을 하나씩 먹이며 허용 단말 조회
+    beginConstrainedDecode(statePath: number[], uri?: string, byteOffset?: number): number;
+    feedTerminal(handle: number, symbol: string): ConstrainedStep | null;
+    feedText(handle: number, text: string): ConstrainedStep | null;
+    constrainedState(handle: number): ConstrainedStep | null;
+    endConstrainedDecode(handle: number): void;
+
+    // [Conversion Worker] 네이티브 스레드 컨버전, 결과는 SharedArrayBuffer 링으로 (src/resultRing.ts)
+    // 반환값은 후보 key ID → key 표, 링 헤더가 틀리거나 DB를 못 읽으면 null
+    startConversionWorker(ring: Int32Array, options: ConversionWorkerOptions, doorbell: () => void): string[] | null;
+    submitConversion(sourceCode: string, byteOffset: number, mode?: number): number;
+    // 낡은 요청 취소 (큐에서 빼거나 진행 중이면 결과를 링에 쓰지 않음). 이미 끝났으면 false
+    cancelConversion(id: number): boolean;
+    stopConversionWorker(): void;
+}
+
+// addon 이름을 키로 하는 캐시 (require 실패도 기록해서 매번 재시도하지 않음)
+const addonCache: Map<string, ParserAddon | null> = new Map();
+
+export function loadParserAddon(extensionPath: string, addonName: string): ParserAddon | undefined {
+    if (addonCache.has(addonName)) {
+        return addonCache.get(addonName) ?? undefined;
+    }
+    const addonPath = path.join(extensionPath, 'build', 'Release', `${addonName}.node`);
+    try {
+        const addon = require(addonPath) as ParserAddon;
+        addonCache.set(addonName, addon);
+        console.log(`[Info] Addon loaded: ${addonName}`);
+        return addon;
+    } catch (e) {
+        console.error(`[Error] Addon 로딩 실패! 경로: ${addonPath}`, e);
+        addonCache.set(addonName, null);
+        return undefined;
+    }
+}
+
+// 이미 로드된 addon만 (메모리 보고/축출이 addon을 새로 로드하지 않도록)
+export function peekParserAddon(addonName: string): ParserAddon | undefined {
+    return addonCache.get(addonName) ?? undefined;
+}
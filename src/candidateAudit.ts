@@ -0,0 +1,257 @@
+/**
+ * @file candidateAudit.ts
+ * @brief 구조 후보 타당성 판정 배치 파이프라인 (src/tools/auditCandidates.ts, 테스트에서 사용)
+ *
+ * 코퍼스의 여러 커서 위치(상태 경로 + 후보 목록)마다 generateAuditPrompt 프롬프트를 만들어
+ * AuditBackend로 동시에 보내고, 응답("sortText | valid|suspect|unknown | 사유")을 모아 상태별 통계를 낸다.
+ *   - 판정 단위는 (상태 경로, 후보 raw key)다. 후보는 상태 경로만으로 정해지므로 같은 경로의
+ *     다른 위치에서는 다시 묻지 않고(진행 중인 요청도 공유), 이미 판정된 후보는 프롬프트에서 뺀다.
+ *   - AuditCache에 있는 판정은 요청 없이 쓴다. 응답이 없거나 형식이 틀린 후보는 캐시하지 않는다
+ *     (다음 실행에서 다시 묻는다).
+ *   - 상태별 통계: 판정된 (경로, 후보)마다 그 후보를 DB에 가진 경로 상의 상태들에 판정을 더한다.
+ * vscode 모듈을 쓰지 않으므로 확장 밖(node)에서 돌릴 수 있다.
+ */
+
+import * as fs from "fs";
+import * as path from "path";
+import { generateAuditPrompt } from "./prompts";
+
+export type AuditVerdict = "valid" | "suspect" | "unknown";
+
+export interface AuditLabel {
+    verdict: AuditVerdict;
+    reason: string;
+}
+
+export interface AuditCandidate {
+    sortText: string;  // 위치 안에서의 순위 ("001" ..)
+    key: string;       // 사람이 읽는 형태 (프롬프트용)
+    rawKey: string;    // DB 원본 key (판정 단위)
+    states: number[];  // 이 key를 DB에 가진 경로 상의 상태
+}
+
+export interface AuditPosition {
+    id: string;                // 보고용 (file:line 등)
+    languageName: string;
+    sourceUpToCursor: string;
+    statePath: number[];
+    stateLines: string[];
+    candidates: AuditCandidate[];
+}
+
+export interface AuditBackend {
+    readonly name: string;
+    // 프롬프트 하나 → 응답 원문 (실패하면 throw 또는 빈 문자열)
+    audit(prompt: string): Promise<string>;
+}
+
+export interface StateAuditStats {
+    state: number;
+    valid: number;
+    suspect: number;
+    unknown: number;
+    suspectKeys: { key: string; reason: string; statePath: number[] }[];
+}
+
+export interface AuditReport {
+    backend: string;
+    positions: number;
+    judgments: number;   // 판정을 얻은 서로 다른 (상태 경로, 후보) 수
+    requests: number;    // 실제로 보낸 프롬프트 수
+    failedRequests: number;
+    cacheHits: number;   // 캐시로 끝난 판정
+    sharedHits: number;  // 같은 실행의 다른 위치에서 이미 물은 판정
+    unanswered: number;  // 응답에 없거나 형식이 틀린 판정
+    states: StateAuditStats[];
+}
+
+export interface AuditOptions {
+    concurrency: number;
+    cache?: AuditCache;
+    onProgress?: (done: number, total: number) => void;
+}
+
+// =============================================================================
+// [응답 해석]
+// =============================================================================
+const VERDICTS = new Set<string>(["valid", "suspect", "unknown"]);
+
+// "001 | valid", "002 | suspect | 사유" → sortText별 판정. 다른 줄은 무시
+export function parseAuditResponse(text: string): Map<string, AuditLabel> {
+    const labels = new Map<string, AuditLabel>();
+    for (const line of text.split("\n")) {
+        const parts = line.split("|").map(p => p.trim());
+        if (parts.length < 2) { continue; }
+        const sortText = parts[0].replace(/^[-*\s`]+/, "");
+        const verdict = parts[1].toLowerCase();
+        if (!sortText || !VERDICTS.has(verdict)) { continue; }
+        labels.set(sortText, { verdict: verdict as AuditVerdict, reason: parts.slice(2).join(" | ") });
+    }
+    return labels;
+}
+
+export function auditKey(backend: string, statePath: number[], rawKey: string): string {
+    return `${backend}|${statePath.join(",")}|${rawKey}`;
+}
+
+// =============================================================================
+// [캐시] 판정 결과 JSON 파일 (키: auditKey)
+// =============================================================================
+const CACHE_FORMAT_VERSION = 1;
+
+export class AuditCache {
+    private entries = new Map<string, AuditLabel>();
+    private dirty = false;
+
+    constructor(private file?: string) {
+        if (!file || !fs.existsSync(file)) { return; }
+        try {
+            const data = JSON.parse(fs.readFileSync(file, "utf8"));
+            if (data.formatVersion !== CACHE_FORMAT_VERSION) {
+                console.warn(`[Warning] Audit cache format ${data.formatVersion} ignored: ${file}`);
+                return;
+            }
+            for (const [key, label] of Object.entries<AuditLabel>(data.entries ?? {})) {
+                this.entries.set(key, label);
+            }
+        } catch (e) {
+            console.error("[Error] Failed to read audit cache:", e);
+        }
+    }
+
+    get size(): number {
+        return this.entries.size;
+    }
+
+    get(key: string): AuditLabel | undefined {
+        return this.entries.get(key);
+    }
+
+    set(key: string, label: AuditLabel) {
+        this.entries.set(key, label);
+        this.dirty = true;
+    }
+
+    save() {
+        if (!this.file || !this.dirty) { return; }
+        fs.mkdirSync(path.dirname(this.file), { recursive: true });
+        const data = { formatVersion: CACHE_FORMAT_VERSION, entries: Object.fromEntries(this.entries) };
+        fs.writeFileSync(this.file, JSON.stringify(data) + "\n", "utf8");
+        this.dirty = false;
+    }
+}
+
+// =============================================================================
+// [실행]
+// =============================================================================
+// 동시에 최대 n개. 끝난 요청의 자리를 대기열 첫 요청에 바로 넘겨서 n을 넘지 않는다
+function createLimiter(n: number) {
+    let active = 0;
+    const waiting: (() => void)[] = [];
+    return async <T>(fn: () => Promise<T>): Promise<T> => {
+        if (active < n) {
+            active++;
+        } else {
+            await new Promise<void>(resolve => waiting.push(resolve));
+        }
+        try {
+            return await fn();
+        } finally {
+            const next = waiting.shift();
+            if (next) { next(); } else { active--; }
+        }
+    };
+}
+
+interface Judgment {
+    statePath: number[];
+    candidate: AuditCandidate;
+    label: Promise<AuditLabel | undefined>;
+}
+
+export async function runAudit(positions: AuditPosition[], backend: AuditBackend, options: AuditOptions): Promise<AuditReport> {
+    const limit = createLimiter(Math.max(1, options.concurrency));
+    const judgments = new Map<string, Judgment>();
+    const report: AuditReport = {
+        backend: backend.name,
+        positions: positions.length,
+        judgments: 0,
+        requests: 0,
+        failedRequests: 0,
+        cacheHits: 0,
+        sharedHits: 0,
+        unanswered: 0,
+        states: [],
+    };
+
+    let done = 0;
+    const pending: Promise<void>[] = [];
+    for (const position of positions) {
+        const ask: AuditCandidate[] = [];
+        for (const candidate of position.candidates) {
+            const key = auditKey(backend.name, position.statePath, candidate.rawKey);
+            if (judgments.has(key)) {
+                report.sharedHits++;
+                continue;
+            }
+            const cached = options.cache?.get(key);
+            if (cached) {
+                report.cacheHits++;
+                judgments.set(key, { statePath: position.statePath, candidate, label: Promise.resolve(cached) });
+            } else {
+                ask.push(candidate);
+            }
+        }
+        if (ask.length === 0) {
+            options.onProgress?.(++done, positions.length);
+            continue;
+        }
+
+        const prompt = generateAuditPrompt(
+            position.languageName, position.sourceUpToCursor, position.statePath, position.stateLines, ask
+        );
+        const response = limit(async () => {
+            report.requests++;
+            try {
+                return parseAuditResponse(await backend.audit(prompt));
+            } catch (e) {
+                report.failedRequests++;
+                console.error(`[Error] Audit request failed (${position.id}):`, e);
+                return new Map<string, AuditLabel>();
+            }
+        });
+        for (const candidate of ask) {
+            const key = auditKey(backend.name, position.statePath, candidate.rawKey);
+            const label = response.then(labels => labels.get(candidate.sortText));
+            judgments.set(key, { statePath: position.statePath, candidate, label });
+            pending.push(label.then(result => {
+                if (result) { options.cache?.set(key, result); } else { report.unanswered++; }
+            }));
+        }
+        pending.push(response.then(() => { options.onProgress?.(++done, positions.length); }));
+    }
+    await Promise.all(pending);
+
+    // 상태별 집계
+    const byState = new Map<number, StateAuditStats>();
+    for (const judgment of judgments.values()) {
+        const label = await judgment.label;
+        if (!label) { continue; }
+        report.judgments++;
+        for (const state of judgment.candidate.states) {
+            let stats = byState.get(state);
+            if (!stats) {
+                stats = { state, valid: 0, suspect: 0, unknown: 0, suspectKeys: [] };
+                byState.set(state, stats);
+            }
+            stats[label.verdict]++;
+            if (label.verdict === "suspect") {
+                stats.suspectKeys.push({ key: judgment.candidate.rawKey, reason: label.reason, statePath: judgment.statePath });
+            }
+        }
+    }
+    // suspect 비율이 높은 상태부터
+    const suspectShare = (s: StateAuditStats) => s.suspect / Math.max(1, s.valid + s.suspect + s.unknown);
+    report.states = Array.from(byState.values()).sort((a, b) => suspectShare(b) - suspectShare(a) || a.state - b.state);
+    return report;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file candidateCache.ts
+ * @brief (문서 URI, 줄, 접두사 앵커)별 최근 후보 캐시 — 인라인 고스트 텍스트 빠른 경로용
+ *
+ * Ctrl+Space 경로(구조 후보)와 generateCode(코드 후보), 인라인 provider의 비동기 갱신이 계산한 결과를
+ * 후보가 시작하는 자리(앵커: 줄, 열, 그 앞의 줄 내용)에 남겨 둔다. 키에 문서 버전을 넣지 않으므로
+ * 앵커 뒤로 타이핑이 이어지는 동안은 같은 항목이 조회되고, 인라인 provider는 타이핑한 텍스트가
+ * 상위 후보의 접두사인 동안 다시 파싱하지 않고 그 후보를 그대로 보여 준다.
+ * 줄마다 가장 최근 앵커의 항목 하나만 두고, 전체 크기는 LRU로 제한한다.
+ */
+
+// 자동완성 후보의 공통 shape
+// - 구조 후보 key: 구조 패턴 (예: "ID = Expr"), rawKey: DB 원본 key (슬롯 채우기용)
+// - 코드 후보 key: 실제 코드 텍스트
+export type CompletionCandidate = {
+    key: string;
+    rawKey?: string;  // DB 원본 key (슬롯 채우기용, 구조 후보만)
+    value: number;    // 빈도수
+    sortText: string; // 정렬 순위
+};
+
+// 후보가 시작하는 자리. prefix(줄에서 character 앞부분)가 바뀌면 다른 자리로 본다
+export interface CandidateAnchor {
+    uri: string;
+    line: number;
+    character: number;  // UTF-16 열
+    prefix: string;
+}
+
+export interface CachedCandidates {
+    anchor: CandidateAnchor;
+    structural: CompletionCandidate[];
+    textual: CompletionCandidate[];
+    inlineText?: string | null;  // 고스트 텍스트로 보여 줄 코드 (null: 계산했지만 없음, undefined: 아직 계산 안 함)
+}
+
+export interface InlineHit {
+    entry: CachedCandidates;
+    typed: string;  // 앵커부터 커서까지 타이핑한 텍스트 (inlineText의 접두사)
+}
+
+export class CandidateCache {
+    private entries = new Map<string, CachedCandidates>();
+
+    constructor(private readonly capacity = 32) {}
+
+    static key(uri: string, line: number): string {
+        return `${uri}@${line}`;
+    }
+
+    private static sameAnchor(a: CandidateAnchor, b: CandidateAnchor): boolean {
+        return a.character === b.character && a.prefix === b.prefix;
+    }
+
+    private touch(key: string, entry: CachedCandidates) {
+        // 최근 사용 순서 갱신
+        this.entries.delete(key);
+        this.entries.set(key, entry);
+    }
+
+    // 앵커가 정확히 같은 항목
+    get(anchor: CandidateAnchor): CachedCandidates | undefined {
+        const key = CandidateCache.key(anchor.uri, anchor.line);
+        const entry = this.entries.get(key);
+        if (!entry || !CandidateCache.sameAnchor(entry.anchor, anchor)) { return undefined; }
+        this.touch(key, entry);
+        return entry;
+    }
+
+    // 커서 줄의 최근 항목 중 앵커 앞 내용이 그대로이고, 앵커부터 커서까지 타이핑한 텍스트가
+    // 고스트 텍스트의 접두사인 것 (문서 버전과 무관)
+    lookupInline(uri: string, line: number, lineText: string, character: number): InlineHit | undefined {
+        const key = CandidateCache.key(uri, line);
+        const entry = this.entries.get(key);
+        if (!entry?.inlineText || entry.anchor.character > character) { return undefined; }
+        if (!lineText.startsWith(entry.anchor.prefix)) { return undefined; }
+        const typed = lineText.slice(entry.anchor.character, character);
+        if (!entry.inlineText.startsWith(typed)) { return undefined; }
+        this.touch(key, entry);
+        return { entry, typed };
+    }
+
+    // 같은 앵커의 항목이 있으면 주어진 필드만 덮어쓰고, 아니면 그 줄의 항목을 새 앵커로 바꾼다
+    update(anchor: CandidateAnchor, patch: Partial<Omit<CachedCandidates, "anchor">>): CachedCandidates {
+        const key = CandidateCache.key(anchor.uri, anchor.line);
+        const previous = this.entries.get(key);
+        const base = previous && CandidateCache.sameAnchor(previous.anchor, anchor) ? previous : undefined;
+        const entry: CachedCandidates = { structural: [], textual: [], ...base, ...patch, anchor };
+        this.touch(key, entry);
+        while (this.entries.size > this.capacity) {
+            this.entries.delete(this.entries.keys().next().value as string);
+        }
+        return entry;
+    }
+
+    // 문서를 닫으면 그 문서의 항목을 모두 버린다
+    clear(uri?: string) {
+        if (uri === undefined) {
+            this.entries.clear();
+            return;
+        }
+        const prefix = `${uri}@`;
+        for (const key of [...this.entries.keys()]) {
+            if (key.startsWith(prefix)) { this.entries.delete(key); }
+        }
+    }
+}
@@ -0,0 +1,152 @@
+/**
+ * @file completionBackends.ts
+ * @brief 구조 후보 → 실제 코드 텍스트 생성 백엔드
+ *
+ * 1. TokenModelBackend: addon의 n-gram 토큰 모델 (메모리 매핑 파일 + 열린 문서 빈도), 수 마이크로초
+ * 2. OpenAIBackend:     원격 LLM, 로컬 모델이 슬롯을 채우지 못했을 때만 사용
+ * FallbackBackend가 순서대로 시도하고 처음으로 비어 있지 않은 결과를 쓴다.
+ */
+
+import * as vscode from "vscode";
+import * as fs from "fs";
+import * as path from "path";
+import OpenAI from "openai";
+import { SYSTEM_ROLE, generateCompletionPrompt, generateCompletionPromptWithSummary } from "./prompts";
+import { ParserAddon } from "./addonLoader";
+import { joinTokens } from "./slotFiller";
+
+export interface TextCompletionRequest {
+    structuralHint: string;  // 사람이 읽는 형태 (예: "ID = Expr")
+    rawKey?: string;         // DB 원본 key (토큰 모델은 이것만 사용)
+    fullContext: string;     // 커서 직전까지의 소스 (contextSummary가 있으면 그 뒤의 원문 부분만)
+    contextSummary?: string; // 먼 문맥의 구조 요약 (src/promptCompression.ts)
+    signal?: AbortSignal;    // 요청이 낡으면 중단 (src/requestGuard.ts)
+}
+
+export interface CompletionBackend {
+    readonly name: string;
+    // 생성 실패는 빈 문자열
+    complete(request: TextCompletionRequest): Promise<string>;
+}
+
+// =============================================================================
+// [Local] n-gram 토큰 모델
+// =============================================================================
+export class TokenModelBackend implements CompletionBackend {
+    readonly name = "token-model";
+
+    constructor(
+        private addon: ParserAddon,
+        private documentUri: string,
+        private byteOffset: number,
+        private includeWorkspace: boolean,
+        private statePath?: number[]  // 있으면 파싱 테이블이 받아들이는 토큰만 제안 (제약 디코딩)
+    ) {}
+
+    async complete(request: TextCompletionRequest): Promise<string> {
+        if (!request.rawKey || !this.addon.proposeTokens || request.signal?.aborted) { return ""; }
+        const proposal = this.addon.proposeTokens(
+            this.documentUri, this.byteOffset, request.rawKey, this.includeWorkspace, this.statePath
+        );
+        if (!proposal) { return ""; }
+        console.log(`[TokenModel] ${request.rawKey} -> ${JSON.stringify(proposal.tokens)} (logProb ${proposal.logProb.toFixed(2)})`);
+        return joinTokens(proposal.tokens);
+    }
+}
+
+// =============================================================================
+// [Remote] OpenAI
+// - secrets.json은 처음 필요할 때 한 번만 읽는다 (로컬 모델로 끝나면 읽지 않음)
+// =============================================================================
+const openaiClients: Map<string, OpenAI | null> = new Map();
+
+function loadOpenAIClient(extensionPath: string): OpenAI | undefined {
+    if (openaiClients.has(extensionPath)) {
+        return openaiClients.get(extensionPath) ?? undefined;
+    }
+
+    let apiKey = "";
+    try {
+        const secretPath = path.join(extensionPath, 'secrets.json');
+        if (fs.existsSync(secretPath)) {
+            const secretData = fs.readFileSync(secretPath, 'utf8');
+            const secrets = JSON.parse(secretData);
+            apiKey = secrets.apiKey;
+            console.log("[Info] Loaded API Key from secrets.json");
+        } else {
+            console.error(`[Error] secrets.json not found at: ${secretPath}`);
+        }
+    } catch (err) {
+        console.error("[Error] Failed to read secrets.json:", err);
+    }
+
+    if (!apiKey) {
+        vscode.window.showErrorMessage("API Key가 없습니다. 프로젝트 루트에 secrets.json을 생성하고 키를 넣어주세요.");
+        openaiClients.set(extensionPath, null);
+        return undefined;
+    }
+    const client = new OpenAI({ apiKey });
+    openaiClients.set(extensionPath, client);
+    return client;
+}
+
+export class OpenAIBackend implements CompletionBackend {
+    readonly name = "openai";
+
+    constructor(private extensionPath: string, private displayName: string) {}
+
+    async complete(request: TextCompletionRequest): Promise<string> {
+        try {
+            const prompt = request.contextSummary
+                ? generateCompletionPromptWithSummary(request.contextSummary, request.fullContext, request.structuralHint, this.displayName)
+                : generateCompletionPrompt(request.fullContext, request.structuralHint, this.displayName);
+            console.log(`[LLM Prompt] ${prompt}`);
+
+            const openai = loadOpenAIClient(this.extensionPath);
+            if (!openai) { return ""; }
+
+            const chat_completion = await openai.chat.completions.create({
+                model: "gpt-3.5-turbo",
+                messages: [
+                    { role: "system", content: SYSTEM_ROLE },
+                    { role: "user", content: prompt }
+                ]
+            }, { signal: request.signal });
+
+            const response = chat_completion.choices[0].message.content?.trim() || "";
+            console.log(`[LLM Response] ${response}`);
+            return response;
+
+        } catch (error) {
+            if (request.signal?.aborted) {
+                console.log("[LLM] Request cancelled");
+                return "";
+            }
+            console.error("[LLM Error]", error);
+            return "";
+        }
+    }
+}
+
+// =============================================================================
+// [Chain] 앞에서부터 시도
+// =============================================================================
+export class FallbackBackend implements CompletionBackend {
+    readonly name: string;
+
+    constructor(private backends: CompletionBackend[]) {
+        this.name = backends.map(b => b.name).join(" -> ");
+    }
+
+    async complete(request: TextCompletionRequest): Promise<string> {
+        for (const backend of this.backends) {
+            if (request.signal?.aborted) { return ""; }
+            const text = await backend.complete(request);
+            if (text) {
+                console.log(`[Backend] ${backend.name} answered: ${request.structuralHint}`);
+                return text;
+            }
+        }
+        return "";
+    }
+}
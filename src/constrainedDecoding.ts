@@ -0,0 +1,115 @@
+/**
+ * @file constrainedDecoding.ts
+ * @brief 파싱 상태 기반 제약 디코딩 훅 + 이를 쓰는 in-process mock 백엔드
+ *
+ * 생성 후 refineLLMResponse로 문자열을 다듬는 대신, 생성 도중에
+ *   feed(토큰) → 다음에 허용되는 단말 목록 / 구조 완료 여부
+ * 를 addon에 물어서 문법에 맞지 않는 이어쓰기를 마스킹하고, complete가 되면 일찍 멈춘다.
+ * vscode에 의존하지 않으므로 테스트와 CLI 도구에서도 쓸 수 있다.
+ */
+
+import { ConstrainedStep, ParserAddon } from "./addonLoader";
+import { CompletionBackend, TextCompletionRequest } from "./completionBackends";
+import { joinTokens, slotKindOf } from "./slotFiller";
+
+export class ConstrainedDecoder {
+    private constructor(private addon: ParserAddon, private handle: number) {}
+
+    // statePath: 커서 위치의 컨버전 결과. feedText를 쓰려면 uri/byteOffset도 필요 (문서 세션 기준)
+    static begin(addon: ParserAddon, statePath: number[], uri?: string, byteOffset?: number): ConstrainedDecoder | undefined {
+        if (!addon.beginConstrainedDecode || statePath.length === 0) { return undefined; }
+        return new ConstrainedDecoder(addon, addon.beginConstrainedDecode(statePath, uri, byteOffset));
+    }
+
+    state(): ConstrainedStep {
+        return this.addon.constrainedState(this.handle) ?? { accepted: false, complete: false, allowed: [] };
+    }
+
+    feedTerminal(symbol: string): ConstrainedStep {
+        return this.addon.feedTerminal(this.handle, symbol) ?? { accepted: false, complete: false, allowed: [] };
+    }
+
+    feedText(text: string): ConstrainedStep {
+        return this.addon.feedText(this.handle, text) ?? { accepted: false, complete: false, allowed: [] };
+    }
+
+    dispose() {
+        this.addon.endConstrainedDecode(this.handle);
+    }
+}
+
+// 텍스트가 정해지지 않은 단말의 자리표시 텍스트 (mock 전용)
+function placeholderFor(symbol: string): string | undefined {
+    const kind = slotKindOf(symbol);
+    if (kind === "identifier" || kind === "member") { return "x"; }
+    if (kind === "literal") { return /STR|string|char/i.test(symbol) ? '""' : "0"; }
+    return undefined;
+}
+
+/**
+ * 구조 후보의 토큰을 순서대로 따라가되, 매 단계 허용 단말 안에서만 고르는 결정적 생성기.
+ * 비단말 슬롯(Expr 등)은 다음 힌트 토큰이 허용될 때까지 자리표시 토큰으로 채우고,
+ * 처음으로 complete가 되는 토큰에서 멈춘다.
+ * 실제 로컬 모델 백엔드가 같은 훅을 쓰는 방식의 기준 구현이자 테스트용 백엔드다.
+ */
+export class MockBackend implements CompletionBackend {
+    readonly name = "mock";
+
+    constructor(
+        private addon: ParserAddon,
+        private statePath: number[],
+        private maxTokens: number = 16
+    ) {}
+
+    async complete(request: TextCompletionRequest): Promise<string> {
+        if (!request.rawKey) { return ""; }
+        const decoder = ConstrainedDecoder.begin(this.addon, this.statePath);
+        if (!decoder) { return ""; }
+
+        try {
+            const hint = request.rawKey.split(" ").filter(t => t.length > 0);
+            const out: string[] = [];
+            let step = decoder.state();
+            let i = 0;
+            let filled = 0;  // 현재 비단말 슬롯에 채운 토큰 수
+
+            while (i < hint.length && out.length < this.maxTokens) {
+                const exact = step.allowed.find(a => a.symbol === hint[i]);
+                if (exact) {
+                    step = decoder.feedTerminal(exact.symbol);
+                    if (!step.accepted) { return ""; }
+                    out.push(exact.text ?? placeholderFor(exact.symbol) ?? exact.symbol);
+                    if (step.complete) { break; }  // 구조가 완성되면 남은 힌트는 버린다
+                    i++;
+                    filled = 0;
+                    continue;
+                }
+
+                // 비단말 슬롯을 이미 채웠고 다음 힌트(또는 구조 완료)로 넘어갈 수 있으면 넘어간다
+                const nextReady = i + 1 < hint.length
+                    ? step.allowed.some(a => a.symbol === hint[i + 1])
+                    : step.complete;
+                if (filled > 0 && nextReady) {
+                    i++;
+                    filled = 0;
+                    continue;
+                }
+
+                const filler = step.allowed.find(a => a.text === undefined && placeholderFor(a.symbol) !== undefined);
+                if (!filler) { return ""; }
+                step = decoder.feedTerminal(filler.symbol);
+                if (!step.accepted) { return ""; }
+                out.push(placeholderFor(filler.symbol)!);
+                if (step.complete) { break; }
+                filled++;
+            }
+
+            if (step.complete) {
+                console.log(`[Mock] structure complete after ${out.length} tokens`);
+            }
+            return joinTokens(out);
+        } finally {
+            decoder.dispose();
+        }
+    }
+}
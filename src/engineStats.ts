@@ -0,0 +1,173 @@
+/**
+ * @file engineStats.ts
+ * @brief 요청 단위 엔진 카운터 집계 (addon getStats 전후 차이 + 경과 시간)
+ *
+ * addon 카운터는 프로세스 누적값이라, 요청 하나를 감싸 전후 스냅샷 차이를 그 요청의 비용으로 본다.
+ * (extension host는 단일 스레드라 요청이 겹치지 않는다. statePathMax는 누적 최대라 차이 대신 그대로 둔다.)
+ *   - 언어별 요청 수 / 총·최대 시간 / 카운터 합
+ *   - completion.slowRequestMs를 넘은 요청은 카운터와 함께 [Stats] 로그로 남기고 최근 것만 보관
+ * completion.statsDetail을 켜면 렉싱 토큰·shift/reduce·오류 복구도 센다 (파서 로거 때문에 느려짐).
+ */
+
+import * as vscode from "vscode";
+import { EngineStats, ParserAddon } from "./addonLoader";
+
+const RECENT_SLOW_LIMIT = 20;
+
+// 요청 하나의 카운터 차이 (detail 제외 숫자 항목만)
+export type StatsDelta = Partial<Record<Exclude<keyof EngineStats, "detail">, number>>;
+
+export interface SlowRequest {
+    languageId: string;
+    label: string;
+    ms: number;
+    at: number;     // Date.now()
+    stats: StatsDelta;
+}
+
+export interface LanguageStats {
+    languageId: string;
+    requests: number;
+    totalMs: number;
+    maxMs: number;
+    totals: StatsDelta;
+}
+
+export interface EngineStatsReport {
+    detail: boolean;
+    slowRequestMs: number;
+    languages: LanguageStats[];
+    recentSlow: SlowRequest[];
+}
+
+export class EngineStatsTracker implements vscode.Disposable {
+    private languages = new Map<string, LanguageStats>();
+    private recentSlow: SlowRequest[] = [];
+    private addons = new Set<ParserAddon>();
+    private disposables: vscode.Disposable[] = [];
+
+    constructor() {
+        this.disposables.push(
+            vscode.workspace.onDidChangeConfiguration((event) => {
+                if (event.affectsConfiguration('completion.statsDetail')) {
+                    this.addons.forEach((addon) => addon.setStatsDetail(this.detail));
+                }
+            })
+        );
+    }
+
+    get detail(): boolean {
+        return vscode.workspace.getConfiguration('completion').get<boolean>('statsDetail', false);
+    }
+
+    get slowRequestMs(): number {
+        return vscode.workspace.getConfiguration('completion').get<number>('slowRequestMs', 50);
+    }
+
+    // fn 실행 전후 addon 카운터 차이를 languageId 요청으로 기록 (fn의 예외는 그대로 전달)
+    // fn이 Promise를 돌려주면(completion.parseOnWorker) 끝날 때까지 기다렸다가 기록한다.
+    // 워커 스레드의 카운터도 getStats 합계에 들어가므로 차이는 그 요청의 비용이 된다
+    // (그동안 다른 요청이 돌면 그 비용도 섞인다).
+    // onSlow: 느린 요청 기준을 넘었을 때 호출 (재현 번들 저장 등)
+    measure<T>(languageId: string, addon: ParserAddon | undefined, label: string, fn: () => T,
+               onSlow?: (ms: number, stats: StatsDelta) => void): T {
+        if (!addon?.getStats) { return fn(); }
+        if (!this.addons.has(addon)) {
+            this.addons.add(addon);
+            addon.setStatsDetail(this.detail);
+        }
+        const before = addon.getStats();
+        const start = performance.now();
+        const finish = () => {
+            const ms = performance.now() - start;
+            const stats = diff(before, addon.getStats());
+            if (this.record(languageId, label, ms, stats) && onSlow) { onSlow(ms, stats); }
+        };
+        let result: T;
+        try {
+            result = fn();
+        } catch (e) {
+            finish();
+            throw e;
+        }
+        if (result instanceof Promise) {
+            return result.finally(finish) as unknown as T;
+        }
+        finish();
+        return result;
+    }
+
+    report(): EngineStatsReport {
+        return {
+            detail: this.detail,
+            slowRequestMs: this.slowRequestMs,
+            languages: [...this.languages.values()].map((l) => ({ ...l, totals: { ...l.totals } })),
+            recentSlow: [...this.recentSlow],
+        };
+    }
+
+    // addon 누적 카운터까지 모두 0으로
+    reset() {
+        this.languages.clear();
+        this.recentSlow = [];
+        this.addons.forEach((addon) => addon.resetStats());
+    }
+
+    // 사람이 읽는 요약 (extension.showEngineStats 명령)
+    static format(report: EngineStatsReport): string[] {
+        const lines = [`상세 카운터 ${report.detail ? "켜짐" : "꺼짐"}, 느린 요청 기준 ${report.slowRequestMs}ms`];
+        for (const l of report.languages) {
+            const avg = l.requests > 0 ? l.totalMs / l.requests : 0;
+            lines.push(
+                `${l.languageId}: 요청 ${l.requests}회, 평균 ${avg.toFixed(1)}ms, 최대 ${l.maxMs.toFixed(1)}ms, ` +
+                formatDelta(l.totals)
+            );
+        }
+        if (report.recentSlow.length > 0) {
+            lines.push(`최근 느린 요청 ${report.recentSlow.length}건`);
+        }
+        return lines;
+    }
+
+    // 반환: 느린 요청이었는지
+    private record(languageId: string, label: string, ms: number, stats: StatsDelta): boolean {
+        let entry = this.languages.get(languageId);
+        if (!entry) {
+            entry = { languageId, requests: 0, totalMs: 0, maxMs: 0, totals: {} };
+            this.languages.set(languageId, entry);
+        }
+        entry.requests++;
+        entry.totalMs += ms;
+        entry.maxMs = Math.max(entry.maxMs, ms);
+        for (const [name, value] of Object.entries(stats) as [keyof StatsDelta, number][]) {
+            entry.totals[name] = name === "statePathMax"
+                ? Math.max(entry.totals[name] ?? 0, value)
+                : (entry.totals[name] ?? 0) + value;
+        }
+
+        if (ms < this.slowRequestMs) { return false; }
+        console.log(`[Stats] Slow ${label} (${languageId}): ${ms.toFixed(1)}ms, ${formatDelta(stats)}`);
+        this.recentSlow.push({ languageId, label, ms, at: Date.now(), stats });
+        if (this.recentSlow.length > RECENT_SLOW_LIMIT) { this.recentSlow.shift(); }
+        return true;
+    }
+
+    dispose() {
+        this.disposables.forEach((d) => d.dispose());
+    }
+}
+
+function diff(before: EngineStats, after: EngineStats): StatsDelta {
+    const delta: StatsDelta = {};
+    for (const name of Object.keys(after) as (keyof EngineStats)[]) {
+        if (name === "detail") { continue; }
+        const value = name === "statePathMax" ? after[name] : after[name] - (before[name] ?? 0);
+        if (value > 0) { delta[name] = value; }
+    }
+    return delta;
+}
+
+function formatDelta(stats: StatsDelta): string {
+    const parts = Object.entries(stats).map(([name, value]) => `${name}=${value}`);
+    return parts.length > 0 ? parts.join(" ") : "카운터 변화 없음";
+}
@@ -2,10 +2,22 @@
 // VS Code 확장 프로그램의 메인 진입점 (다중 언어 지원)
 // Step 1. [Ctrl+Space] -> 'extension.triggerParsing': 파싱 → 구조적 후보 도출
 // Step 2. [Callback]   -> structuralCandidatesData 갱신 → triggerSuggest (등록된 provider가 즉시 응답)
+// 각 요청은 (uri, version, offset, id)로 태그되어, 결과가 도착했을 때 문서가 바뀌었으면 버린다 (src/requestGuard.ts)
+// (선택) completion.inlineSuggestions: 타이핑 중 캐시/세션의 상위 후보를 고스트 텍스트로 바로 표시
 import * as vscode from "vscode";
 import * as fs from "fs";
 import * as path from "path";
+import { performance } from "perf_hooks";
 import { CompletionService, LanguageConfig } from "./CompletionService";
+import { DocumentSync, byteOffsetAt } from "./DocumentSync";
+import { ParserAddon, loadParserAddon } from "./addonLoader";
+import { CandidateAnchor, CandidateCache, CompletionCandidate } from "./candidateCache";
+import { MemoryBudget, MemoryReport } from "./memoryBudget";
+import { EngineStatsReport, EngineStatsTracker } from "./engineStats";
+import { ReproRecorder } from "./reproBundle";
+import { SemanticTokensProvider } from "./semanticTokens";
+import { RequestGuard, RequestGuardStats, RequestTag } from "./requestGuard";
+import { cursorInCommentOrLiteral } from "./tokenContext";
 
 // =============================================================================
 // [언어 설정 맵] resources/ 디렉토리를 스캔하여 자동 생성
@@ -42,17 +54,16 @@ function discoverLanguages(extensionPath: string) {
   console.log(`[Info] Discovered languages: ${SUPPORTED_LANGUAGES.join(", ")}`);
 }
 
-// 자동완성 후보의 공통 shape
 // - structuralCandidatesData[].key: 구조 패턴 (예: "[ID, =, STR]")
 // - textualCandidatesData[].key:    LLM이 생성한 실제 코드 텍스트
-type CompletionCandidate = {
-  key: string;
-  value: number;    // 빈도수
-  sortText: string; // 정렬 순위
-};
-
 let structuralCandidatesData: CompletionCandidate[] = [];
 let textualCandidatesData: CompletionCandidate[] = [];
+// 위 데이터를 만든 요청의 태그 (다른 문서의 provider 호출에는 응답하지 않는다)
+let structuralCandidatesTag: RequestTag | undefined;
+let textualCandidatesTag: RequestTag | undefined;
+
+// (uri, 줄, 접두사 앵커)별 최근 후보 — 인라인 provider가 재파싱 없이 꺼내 쓴다
+const candidateCache = new CandidateCache();
 
 let currentCompletionService: CompletionService | undefined;
 
@@ -62,13 +73,74 @@ let currentCompletionService: CompletionService | undefined;
 let structuralCandidatesReady = false;
 let llmCandidatesReady = false;
 
-export function activate(context: vscode.ExtensionContext) {
+// 구조 후보 provider가 항목을 돌려준 시점 (src/test/latency 벤치마크가 구독)
+export interface StructuralDelivery {
+  uri: string;
+  version: number;
+  line: number;
+  character: number;
+  itemCount: number;
+  deliveredAt: number;  // performance.now() — 같은 extension host 안에서 비교
+}
+
+// activate()의 반환값 (vscode.extensions.getExtension(...).exports)
+export interface ExtensionApi {
+  onStructuralItemsDelivered: vscode.Event<StructuralDelivery>;
+  hasParser(languageId: string): boolean;
+  memoryReport(): MemoryReport;
+  engineStats(): EngineStatsReport;
+  requestStats(): RequestGuardStats;
+}
+
+export function activate(context: vscode.ExtensionContext): ExtensionApi {
   console.log("Running the VSC Extension");
   discoverLanguages(context.extensionPath);
 
+  // 열린 문서를 addon 세션과 동기화 (보존 트리 + 식별자 색인)
+  const documentSync = new DocumentSync(context.extensionPath, LANGUAGE_CONFIGS);
+  // completion.memoryBudgetMB: 언어별 addon 세션 트리 + 후보 DB 전체 예산 (LRU 축출)
+  const memoryBudget = new MemoryBudget(LANGUAGE_CONFIGS);
+  // 요청 단위 엔진 카운터 (completion.statsDetail, completion.slowRequestMs)
+  const engineStats = new EngineStatsTracker();
+  // 느린 구조 요청 재현 번들 (completion.reproBundles, engine_bench --replay 입력)
+  const reproRecorder = new ReproRecorder(context.globalStorageUri);
+  // 낡은 구조/코드 후보 결과 차단 + 진행 중인 LLM 호출 취소
+  const requestGuard = new RequestGuard();
+  const structuralDelivered = new vscode.EventEmitter<StructuralDelivery>();
+
+  function notifyDelivered(document: vscode.TextDocument, position: vscode.Position, itemCount: number) {
+    structuralDelivered.fire({
+      uri: document.uri.toString(),
+      version: document.version,
+      line: position.line,
+      character: position.character,
+      itemCount,
+      deliveredAt: performance.now(),
+    });
+  }
+
   // =============================================================================
   // [Helper Functions]
   // =============================================================================
+  // 결과가 도착한 시점의 커서 오프셋 (document가 활성 편집기가 아니면 -1 → 낡은 결과로 처리)
+  function cursorOffset(document: vscode.TextDocument): number {
+    const editor = vscode.window.activeTextEditor;
+    return editor && editor.document === document ? document.offsetAt(editor.selection.active) : -1;
+  }
+
+  // 후보가 시작하는 자리: 커서 앞까지 친 단어가 text의 접두사면 그 단어의 시작, 아니면 커서
+  function candidateAnchor(document: vscode.TextDocument, position: vscode.Position, text?: string | null): CandidateAnchor {
+    const wordRange = document.getWordRangeAtPosition(position);
+    const typed = wordRange ? document.getText(new vscode.Range(wordRange.start, position)) : "";
+    const character = wordRange && typed && text?.startsWith(typed) ? wordRange.start.character : position.character;
+    return {
+      uri: document.uri.toString(),
+      line: position.line,
+      character,
+      prefix: document.lineAt(position.line).text.slice(0, character),
+    };
+  }
+
   function normalizeCode(text: string): string {
     return text
       .replace(/\s*\(\s*/g, "(")
@@ -120,7 +192,7 @@ export function activate(context: vscode.ExtensionContext) {
         document: vscode.TextDocument,
         position: vscode.Position
       ): Promise<vscode.CompletionItem[] | undefined> {
-        if (!structuralCandidatesReady) {
+        if (!structuralCandidatesReady || structuralCandidatesTag?.uri !== document.uri.toString()) {
           return undefined;
         }
 
@@ -139,11 +211,12 @@ export function activate(context: vscode.ExtensionContext) {
           placeholder.filterText = matchAllFilter;
           placeholder.range = insertRange;
           placeholder.sortText = "000";
+          notifyDelivered(document, position, 0);
           return [placeholder];
         }
 
         const topCandidates = structuralCandidatesData;
-        return topCandidates.map(({ key, value, sortText }) => {
+        const items = topCandidates.map(({ key, value, sortText }) => {
           // DB key는 공백으로 구분된 토큰 나열 형식이므로 그대로 표시
           const cleanKey = key;
 
@@ -158,6 +231,8 @@ export function activate(context: vscode.ExtensionContext) {
             .appendMarkdown(`**Frequency:** ${value}\n\n`);
           return item;
         });
+        notifyDelivered(document, position, items.length);
+        return items;
       }
     }
   );
@@ -173,7 +248,7 @@ export function activate(context: vscode.ExtensionContext) {
         document: vscode.TextDocument,
         position: vscode.Position
       ): Promise<vscode.CompletionItem[] | undefined> {
-        if (!llmCandidatesReady) {
+        if (!llmCandidatesReady || textualCandidatesTag?.uri !== document.uri.toString()) {
           return undefined;
         }
 
@@ -199,6 +274,106 @@ export function activate(context: vscode.ExtensionContext) {
     }
   );
 
+  // =============================================================================
+  // [인라인 Provider] completion.inlineSuggestions가 켜져 있을 때만 응답
+  // - 커서 줄에 캐시된 후보가 있고 그 앵커부터 타이핑한 텍스트가 후보의 접두사인 동안은 그대로 고스트 텍스트로
+  //   (문서 버전이 바뀌어도 다시 조회하지 않는다)
+  // - 없으면 빈 응답을 돌려주고 갱신을 따로 예약한다: 문서 세션으로 구조 후보를 조회하고, 식별자/리터럴 슬롯만 있는
+  //   상위 후보를 로컬로 채워 캐시에 넣은 뒤 커서가 그대로면 인라인 제안을 다시 요청한다
+  // - LLM 호출, triggerSuggest, 전체 소스 복사 없음 → 세션이 낡았으면 아무것도 보여 주지 않는다
+  // =============================================================================
+  function firstLocalFill(service: CompletionService, candidates: CompletionCandidate[]): string | null {
+    for (const { rawKey } of candidates.slice(0, 3)) {
+      const text = rawKey ? service.fillSlotsLocally(rawKey) : null;
+      if (text) { return text; }
+    }
+    return null;
+  }
+
+  // 예약된 갱신 (uri@version@offset). 같은 자리의 provider 호출이 겹쳐도 한 번만 조회한다
+  const pendingInlineRefresh = new Set<string>();
+
+  function scheduleInlineRefresh(
+    document: vscode.TextDocument,
+    position: vscode.Position,
+    config: LanguageConfig,
+    addon: ParserAddon
+  ) {
+    const uri = document.uri.toString();
+    const version = document.version;
+    const charOffset = document.offsetAt(position);
+    const pending = `${uri}@${version}@${charOffset}`;
+    if (pendingInlineRefresh.has(pending)) { return; }
+    pendingInlineRefresh.add(pending);
+
+    setTimeout(() => {
+      pendingInlineRefresh.delete(pending);
+      // 그 사이 편집/이동했으면 새 위치의 provider 호출이 다시 예약한다
+      if (document.isClosed || document.version !== version || cursorOffset(document) !== charOffset) { return; }
+
+      // 세션만 사용하므로 fullText는 넘기지 않는다
+      const service = new CompletionService(
+        context.extensionPath,
+        document.languageId,
+        config,
+        "",
+        byteOffsetAt(addon, document, position),
+        uri,
+        version,
+        charOffset
+      );
+      // Ctrl+Space가 같은 자리에서 구한 구조 후보가 있으면 다시 조회하지 않는다
+      const cached = candidateCache.get(candidateAnchor(document, position));
+      const structural = cached?.structural.length
+        ? cached.structural
+        : engineStats.measure(document.languageId, addon, "inline", () => service.inlineCandidates());
+      if (!structural) { return; }
+      const inlineText = firstLocalFill(service, structural);
+      candidateCache.update(candidateAnchor(document, position, inlineText), { structural, inlineText });
+      if (inlineText) { void vscode.commands.executeCommand("editor.action.inlineSuggest.trigger"); }
+    }, 0);
+  }
+
+  const inlineProvider = vscode.languages.registerInlineCompletionItemProvider(
+    SUPPORTED_LANGUAGES,
+    {
+      provideInlineCompletionItems(
+        document: vscode.TextDocument,
+        position: vscode.Position
+      ): vscode.InlineCompletionItem[] | undefined {
+        if (!vscode.workspace.getConfiguration('completion').get<boolean>('inlineSuggestions', false)) {
+          return undefined;
+        }
+        const config = LANGUAGE_CONFIGS[document.languageId];
+        const addon = config ? loadParserAddon(context.extensionPath, config.addonName) : undefined;
+        if (!config || !addon) { return undefined; }
+
+        memoryBudget.touch(document.languageId);
+        const uri = document.uri.toString();
+        const byteOffset = byteOffsetAt(addon, document, position);
+        // 주석/문자열 안에서는 구조 후보를 띄우지 않는다 (세션 토큰열에서 커서 주변 토큰만 본다)
+        const lineText = document.lineAt(position.line).text;
+        const atLineEnd = position.character === lineText.length;
+        if (cursorInCommentOrLiteral(addon, uri, document.version, byteOffset, atLineEnd)) { return undefined; }
+
+        const hit = candidateCache.lookupInline(uri, position.line, lineText, position.character);
+        if (!hit) {
+          scheduleInlineRefresh(document, position, config, addon);
+          return undefined;
+        }
+        const inlineText = hit.entry.inlineText!;
+        if (hit.typed === inlineText) { return undefined; }
+        // 앵커부터 덮어써야 이미 타이핑한 부분 뒤로 고스트 텍스트가 표시된다
+        const start = new vscode.Position(position.line, hit.entry.anchor.character);
+        return [new vscode.InlineCompletionItem(inlineText, new vscode.Range(start, position))];
+      }
+    }
+  );
+
+  const closeListener = vscode.workspace.onDidCloseTextDocument((document) => {
+    candidateCache.clear(document.uri.toString());
+  });
+
   // =============================================================================
   // [Step 1.5] previewStructures — 플래그 세우고 triggerSuggest만 호출
   // Provider 재등록 없음 → IPC 타이밍 문제 없음
@@ -227,23 +402,38 @@ export function activate(context: vscode.ExtensionContext) {
 
       const position = activeEditor.selection.active;
       const document = activeEditor.document;
+      if (structuralCandidatesTag?.uri !== document.uri.toString()) {
+        console.log("[Guard] Structural candidates belong to another document, skipping generateCode");
+        return;
+      }
+      const ticket = requestGuard.begin("textual", document, document.offsetAt(position));
       const lineContext = document.lineAt(position).text.slice(0, position.character);
       const normalizedLineContext = normalizeCode(lineContext);
-      const fullContext = document.getText(new vscode.Range(new vscode.Position(0, 0), position));
+      const fullContext = currentCompletionService.contextBefore(document.version, document.offsetAt(position))
+        ?? document.getText(new vscode.Range(new vscode.Position(0, 0), position));
       const normalizedFullContext = normalizeCode(fullContext);
 
       const topCandidates = structuralCandidatesData.slice(0, 3);
       const results: CompletionCandidate[] = [];
 
-      for (const { key, value, sortText } of topCandidates) {
+      for (const { key, rawKey, value, sortText } of topCandidates) {
+        if (ticket.cancelled) { break; }
+        // 식별자/리터럴 슬롯만 있는 후보는 문서 색인으로 바로 채운다 (LLM 왕복 생략)
+        const localText = rawKey ? currentCompletionService.fillSlotsLocally(rawKey) : null;
+        if (localText) {
+          console.log(`[Local Fill] ${rawKey} -> ${localText}`);
+          results.push({ key: localText, value, sortText });
+          continue;
+        }
+
         const cleanKey = key
           .replace(/^\[|\]$/g, "")
           .replace(/,/g, " ")
           .replace(/\s+/g, " ")
           .trim();
 
-        console.log(`[Processing LLM Candidate] Hint: ${cleanKey}`);
-        const responseText = await currentCompletionService.getTextCandidate(cleanKey, fullContext);
+        console.log(`[Processing Text Candidate] Hint: ${cleanKey}`);
+        const responseText = await currentCompletionService.getTextCandidate(cleanKey, fullContext, rawKey, ticket.signal);
         if (!responseText) { continue; }
 
         const finalText = refineLLMResponse(responseText, normalizedFullContext, normalizedLineContext, cleanKey);
@@ -253,7 +443,15 @@ export function activate(context: vscode.ExtensionContext) {
         results.push({ key: finalText, value, sortText });
       }
 
+      // LLM 대기 중 문서가 편집/이동됐거나 더 새 요청이 시작됐으면 버린다
+      if (!requestGuard.accept(ticket, document, cursorOffset(document))) { return; }
+
       textualCandidatesData = results;
+      textualCandidatesTag = ticket.tag;
+      candidateCache.update(
+        candidateAnchor(document, position, results[0]?.key),
+        { textual: results, inlineText: results[0]?.key ?? null }
+      );
       structuralCandidatesReady = false;
       llmCandidatesReady = true;
       vscode.commands.executeCommand("editor.action.triggerSuggest");
@@ -283,6 +481,8 @@ export function activate(context: vscode.ExtensionContext) {
           }
 
           console.log(`[Info] Triggering parsing for language: "${languageId}" (${config.displayName})`);
+          memoryBudget.touch(languageId);
+          const addon = loadParserAddon(context.extensionPath, config.addonName);
 
           // 다음 파싱 전까지 이전 결과 비활성화
           structuralCandidatesReady = false;
@@ -292,11 +492,11 @@ export function activate(context: vscode.ExtensionContext) {
           const cursorPosition = activeEditor.selection.active;
           const fullText = document.getText();
 
-          // 바이트 오프셋 계산: VS Code의 offsetAt()은 문자 단위이므로
-          // Buffer.byteLength로 UTF-8 바이트 오프셋으로 변환
+          // 바이트 오프셋 계산: VS Code의 offsetAt()은 UTF-16 단위이므로
+          // 문서 세션의 줄 색인으로 UTF-8 바이트 오프셋을 구한다 (세션이 없으면 Buffer.byteLength)
           const charOffset = document.offsetAt(cursorPosition);
-          const textBeforeCursor = fullText.substring(0, charOffset);
-          const byteOffset = Buffer.byteLength(textBeforeCursor, 'utf8');
+          const byteOffset = byteOffsetAt(addon, document, cursorPosition);
+          const ticket = requestGuard.begin("structural", document, charOffset);
 
           console.log(`[triggerParsing] Constructing CompletionService at byteOffset=${byteOffset}, charOffset=${charOffset}`);
           const completionService = new CompletionService(
@@ -304,14 +504,20 @@ export function activate(context: vscode.ExtensionContext) {
               languageId,
               config,
               fullText,
-              byteOffset
+              byteOffset,
+              document.uri.toString(),
+              document.version,
+              charOffset
           );
           currentCompletionService = completionService;
           console.log("[triggerParsing] Constructor returned, registering callback");
 
           completionService.onDataReceived((data: any) => {
               console.log(`[triggerParsing] onDataReceived fired with ${Array.isArray(data) ? data.length : "non-array"} items`);
+              if (!requestGuard.accept(ticket, document, cursorOffset(document))) { return; }
               structuralCandidatesData = data;
+              structuralCandidatesTag = ticket.tag;
+              candidateCache.update(candidateAnchor(document, cursorPosition), { structural: data });
               vscode.commands.executeCommand("extension.previewStructures").then(
                   () => console.log("[triggerParsing] previewStructures command done"),
                   (err) => console.error("[triggerParsing] previewStructures command failed", err)
@@ -320,7 +526,9 @@ export function activate(context: vscode.ExtensionContext) {
 
           console.log("[triggerParsing] About to call getStructCandidates");
           try {
-              completionService.getStructCandidates();
+              // 워커 경로면 measure가 후보 전달까지 기다렸다가 기록/재현 번들을 남긴다
+              void engineStats.measure(languageId, addon, "structural", () => completionService.getStructCandidates(ticket.signal),
+                  (ms, stats) => reproRecorder.record(completionService.reproSnapshot(), addon, "structural", ms, stats));
               console.log("[triggerParsing] getStructCandidates returned");
           } catch (e) {
               console.error("[triggerParsing] getStructCandidates threw:", e);
@@ -342,14 +550,92 @@ export function activate(context: vscode.ExtensionContext) {
     }
   );
 
+  // =============================================================================
+  // [Semantic Tokens] Small Basic: 정규식 문법(tmLanguage) 위에 보존 트리 기반 하이라이트
+  // =============================================================================
+  const sbConfig = LANGUAGE_CONFIGS["smallbasic"];
+  const sbAddon = sbConfig ? loadParserAddon(context.extensionPath, sbConfig.addonName) : undefined;
+  if (sbAddon?.semanticTokensLegend) {
+    const semanticProvider = new SemanticTokensProvider(sbAddon);
+    context.subscriptions.push(
+      vscode.languages.registerDocumentSemanticTokensProvider({ language: "smallbasic" }, semanticProvider, semanticProvider.legend)
+    );
+  }
+
+  // =============================================================================
+  // [Memory] 예산 상태 보고
+  // =============================================================================
+  const showMemoryUsageCommand = vscode.commands.registerCommand(
+    "extension.showMemoryUsage",
+    () => {
+      const lines = MemoryBudget.format(memoryBudget.report());
+      lines.forEach((line) => console.log(`[Memory] ${line}`));
+      vscode.window.showInformationMessage(lines.join(" | "));
+    }
+  );
+
+  // =============================================================================
+  // [Stats] 요청 카운터 보고 / 초기화
+  // =============================================================================
+  const showEngineStatsCommand = vscode.commands.registerCommand(
+    "extension.showEngineStats",
+    () => {
+      const lines = [...EngineStatsTracker.format(engineStats.report()), RequestGuard.format(requestGuard.stats())];
+      lines.forEach((line) => console.log(`[Stats] ${line}`));
+      vscode.window.showInformationMessage(lines.join(" | "));
+    }
+  );
+
+  const resetEngineStatsCommand = vscode.commands.registerCommand(
+    "extension.resetEngineStats",
+    () => {
+      engineStats.reset();
+      requestGuard.resetStats();
+    }
+  );
+
+  const openReproBundlesCommand = vscode.commands.registerCommand(
+    "extension.openReproBundles",
+    async () => {
+      const dir = reproRecorder.directory;
+      if (!fs.existsSync(dir)) {
+        vscode.window.showInformationMessage(`저장된 재현 번들이 없습니다 (completion.reproBundles: ${reproRecorder.mode})`);
+        return;
+      }
+      await vscode.commands.executeCommand("revealFileInOS", vscode.Uri.file(dir));
+    }
+  );
+
   context.subscriptions.push(
+    documentSync,
+    memoryBudget,
+    engineStats,
+    requestGuard,
+    structuralDelivered,
     structuralProvider,
     llmProvider,
+    inlineProvider,
+    closeListener,
     generateCodeCommand,
     previewStructuresCommand,
     triggerParsingCommand,
-    toggleParsingModeCommand
+    toggleParsingModeCommand,
+    showMemoryUsageCommand,
+    showEngineStatsCommand,
+    resetEngineStatsCommand,
+    openReproBundlesCommand
   );
+
+  return {
+    onStructuralItemsDelivered: structuralDelivered.event,
+    hasParser: (languageId: string) => {
+      const config = LANGUAGE_CONFIGS[languageId];
+      return !!config && loadParserAddon(context.extensionPath, config.addonName) !== undefined;
+    },
+    memoryReport: () => memoryBudget.report(),
+    engineStats: () => engineStats.report(),
+    requestStats: () => requestGuard.stats(),
+  };
 }
 
 export function deactivate() {}
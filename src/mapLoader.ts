@@ -49,6 +49,23 @@ export class TokenMapper {
         return tokenName;
     }
 
+    // =========================================================================
+    // [구체 텍스트] 토큰이 항상 같은 텍스트로 나타나면 그 텍스트를 반환
+    // - STRING 토큰 ("=", "(") 과 키워드 패턴 ([Ww][Hh][Ii][Ll][Ee] -> While)
+    // - 식별자/리터럴/비단말처럼 텍스트가 정해지지 않은 토큰은 undefined
+    // =========================================================================
+    public getConcreteText(tokenName: string): string | undefined {
+        const info = this.mapping[tokenName];
+        if (!info) return undefined;
+        if (info.type === 'STRING') return info.content;
+        if (info.type === 'PATTERN' && this.isGeneratedName(tokenName)) {
+            const cleaned = this.cleanRegex(info.content, tokenName);
+            if (cleaned === "<CR>") return "\n";
+            return cleaned !== tokenName ? cleaned : undefined;
+        }
+        return undefined;
+    }
+
     // =========================================================================
     // [Helper Functions]
     // =========================================================================
@@ -0,0 +1,189 @@
+/**
+ * @file memoryBudget.ts
+ * @brief 엔진 전체(언어별 addon + 후보 DB) 메모리 예산과 LRU 축출
+ *
+ * completion.memoryBudgetMB 하나로 모든 언어를 묶는다 (0이면 무제한).
+ *   - addon: 계수 할당자로 잰 Tree-sitter 할당 + 세션 텍스트/색인 추정치 (memoryStats)
+ *     각 addon에도 같은 예산을 걸어 두어, 한 언어가 혼자 넘으면 편집/조회 시점에 바로 축출된다.
+ *   - 후보 DB/TokenMapper: 원본 JSON 크기로 추정
+ * 문서 변경 후 잠시 뒤 전체 합계를 보고, 넘으면
+ *   1) 열린 문서가 없는 언어의 DB를 오래 안 쓴 순으로 해제
+ *   2) 오래 안 쓴 언어부터 addon.trimMemory로 세션 트리 축출 (텍스트는 남음)
+ *   3) 그래도 넘으면 열린 언어의 DB도 해제
+ * 축출/해제된 상태는 다음 조회 때 다시 만들어진다 (세션 재파싱, DB 재로드).
+ * 오래(IDLE_UNLOAD_MS) 쓰지 않고 열린 문서도 없는 언어는 예산과 무관하게 비운다.
+ * Node에서 addon(.node) 자체는 내릴 수 없으므로, 문법을 "내린다"는 것은 그 언어의 트리/파서/DB를 모두 비우는 것이다.
+ */
+
+import * as vscode from "vscode";
+import { CompletionService, LanguageConfig } from "./CompletionService";
+import { EngineMemoryStats, peekParserAddon } from "./addonLoader";
+
+const ENFORCE_DELAY_MS = 1000;
+const IDLE_CHECK_MS = 60 * 1000;
+const IDLE_UNLOAD_MS = 10 * 60 * 1000;
+const MB = 1024 * 1024;
+
+export interface LanguageMemory {
+    languageId: string;
+    engine?: EngineMemoryStats;  // addon이 로드되지 않았으면 없음
+    dbBytes: number;
+    openDocuments: number;
+    lastUsed: number;            // Date.now(), 쓴 적 없으면 0
+}
+
+export interface MemoryReport {
+    budgetBytes: number;         // 0이면 무제한
+    totalBytes: number;
+    languages: LanguageMemory[];
+}
+
+export class MemoryBudget implements vscode.Disposable {
+    private disposables: vscode.Disposable[] = [];
+    private lastUsed = new Map<string, number>();
+    private budgeted = new Set<string>();  // 현재 예산을 setMemoryBudget으로 건 addon
+    private enforceTimer: NodeJS.Timeout | undefined;
+    private idleTimer: NodeJS.Timeout;
+
+    constructor(private configs: Record<string, LanguageConfig>) {
+        this.disposables.push(
+            vscode.workspace.onDidChangeConfiguration((event) => {
+                if (event.affectsConfiguration('completion.memoryBudgetMB')) { this.applyBudget(); }
+            }),
+            vscode.workspace.onDidOpenTextDocument(() => this.schedule()),
+            vscode.workspace.onDidChangeTextDocument(() => this.schedule())
+        );
+        this.idleTimer = setInterval(() => this.unloadIdle(), IDLE_CHECK_MS);
+    }
+
+    get budgetBytes(): number {
+        const mb = vscode.workspace.getConfiguration('completion').get<number>('memoryBudgetMB', 256);
+        return Math.max(0, mb) * MB;
+    }
+
+    // 언어를 사용했음을 기록 (축출 순서) + 새로 로드된 addon에 예산 적용
+    touch(languageId: string) {
+        this.lastUsed.set(languageId, Date.now());
+        const config = this.configs[languageId];
+        const addon = config ? peekParserAddon(config.addonName) : undefined;
+        if (addon?.setMemoryBudget && !this.budgeted.has(config.addonName)) {
+            addon.setMemoryBudget(this.budgetBytes);
+            this.budgeted.add(config.addonName);
+        }
+        this.schedule();
+    }
+
+    report(): MemoryReport {
+        const languages: LanguageMemory[] = [];
+        let totalBytes = 0;
+        for (const [languageId, config] of Object.entries(this.configs)) {
+            const addon = peekParserAddon(config.addonName);
+            const engine = addon?.memoryStats ? addon.memoryStats() : undefined;
+            const dbBytes = CompletionService.cachedDbBytes(languageId);
+            if (!engine && dbBytes === 0) { continue; }
+            languages.push({
+                languageId,
+                engine,
+                dbBytes,
+                openDocuments: vscode.workspace.textDocuments.filter(d => d.languageId === languageId).length,
+                lastUsed: this.lastUsed.get(languageId) ?? 0,
+            });
+            totalBytes += (engine?.engineBytes ?? 0) + dbBytes;
+        }
+        return { budgetBytes: this.budgetBytes, totalBytes, languages };
+    }
+
+    enforce(): MemoryReport {
+        const before = this.report();
+        let over = before.budgetBytes > 0 ? before.totalBytes - before.budgetBytes : 0;
+        if (over <= 0) { return before; }
+
+        const byAge = [...before.languages].sort((a, b) => a.lastUsed - b.lastUsed);
+        const releaseDb = (lang: LanguageMemory) => {
+            if (over <= 0 || lang.dbBytes === 0) { return; }
+            CompletionService.releaseLanguage(lang.languageId);
+            over -= lang.dbBytes;
+            console.log(`[Info] Memory budget: released candidate DB for "${lang.languageId}"`);
+        };
+
+        // 1) 열린 문서가 없는 언어의 DB
+        byAge.filter(l => l.openDocuments === 0).forEach(releaseDb);
+
+        // 2) 오래 안 쓴 언어부터 세션 트리 축출
+        for (const lang of byAge) {
+            const addon = peekParserAddon(this.configs[lang.languageId].addonName);
+            if (over <= 0 || !lang.engine || !addon?.trimMemory) { continue; }
+            const result = addon.trimMemory(Math.max(0, lang.engine.engineBytes - over));
+            over -= lang.engine.engineBytes - result.engineBytes;
+            if (result.evicted > 0) {
+                console.log(`[Info] Memory budget: evicted ${result.evicted} document tree(s) for "${lang.languageId}"`);
+            }
+        }
+
+        // 3) 열린 언어의 DB
+        byAge.filter(l => l.openDocuments > 0).forEach(releaseDb);
+
+        const after = this.report();
+        if (after.totalBytes > after.budgetBytes) {
+            console.warn(`[Warning] Memory budget exceeded after eviction: ${formatMB(after.totalBytes)} / ${formatMB(after.budgetBytes)}`);
+        }
+        return after;
+    }
+
+    // 사람이 읽는 요약 (extension.showMemoryUsage 명령)
+    static format(report: MemoryReport): string[] {
+        const budget = report.budgetBytes > 0 ? formatMB(report.budgetBytes) : "무제한";
+        const lines = [`전체 ${formatMB(report.totalBytes)} / 예산 ${budget}`];
+        for (const l of report.languages) {
+            const e = l.engine;
+            const engine = e
+                ? `엔진 ${formatMB(e.engineBytes)} (트리 ${formatMB(e.treeSitterBytes)}, 최대 ${formatMB(e.treeSitterPeakBytes)}), ` +
+                  `세션 ${e.residentSessions}/${e.sessions} 보존, 축출 ${e.evictions}회, 재파싱 ${e.rebuilds}회`
+                : "엔진 미로드";
+            lines.push(`${l.languageId}: ${engine}, DB ${formatMB(l.dbBytes)}, 열린 문서 ${l.openDocuments}`);
+        }
+        return lines;
+    }
+
+    private applyBudget() {
+        this.budgeted.clear();
+        for (const config of Object.values(this.configs)) {
+            const addon = peekParserAddon(config.addonName);
+            if (!addon?.setMemoryBudget) { continue; }
+            addon.setMemoryBudget(this.budgetBytes);
+            this.budgeted.add(config.addonName);
+        }
+        this.schedule();
+    }
+
+    private schedule() {
+        if (this.enforceTimer) { return; }
+        this.enforceTimer = setTimeout(() => {
+            this.enforceTimer = undefined;
+            this.enforce();
+        }, ENFORCE_DELAY_MS);
+    }
+
+    private unloadIdle() {
+        const now = Date.now();
+        for (const lang of this.report().languages) {
+            if (lang.openDocuments > 0 || now - lang.lastUsed < IDLE_UNLOAD_MS) { continue; }
+            const addon = peekParserAddon(this.configs[lang.languageId].addonName);
+            const hasTrees = (lang.engine?.residentSessions ?? 0) > 0 && !!addon?.trimMemory;
+            if (!hasTrees && lang.dbBytes === 0) { continue; }
+            if (hasTrees) { addon!.trimMemory(0); }
+            if (lang.dbBytes > 0) { CompletionService.releaseLanguage(lang.languageId); }
+            console.log(`[Info] Unloaded idle language state: "${lang.languageId}"`);
+        }
+    }
+
+    dispose() {
+        if (this.enforceTimer) { clearTimeout(this.enforceTimer); }
+        clearInterval(this.idleTimer);
+        this.disposables.forEach((d) => d.dispose());
+    }
+}
+
+function formatMB(bytes: number): string {
+    return `${(bytes / MB).toFixed(1)}MB`;
+}
@@ -0,0 +1,209 @@
+/**
+ * @file promptCompression.ts
+ * @brief 커서에서 먼 문맥을 구조 요약으로 바꿔 LLM 프롬프트 토큰 수를 예산 안에 맞춘다
+ *
+ * 커서 직전 코드는 원문 그대로 두고, 그보다 앞은 addon의 documentOutline(트리 기반 줄 요약)으로 대체한다.
+ *   - 함수/클래스 등 스코프가 시작되는 줄: 원문 한 줄 (시그니처)
+ *   - 스코프 안의 나머지 줄: "..."로 생략
+ *   - 최상위 문장: 토큰 범주열 (식별자는 이름 유지, 리터럴 등은 TokenMapper 이름)
+ * 예산이 부족하면 깊은 시그니처 → 최상위 토큰열 → 오래된 요약 줄 순으로 버리고,
+ * 원문 구간만으로도 넘치면 요약 없이 원문을 커서에서 먼 쪽부터 줄여 항상 예산 안에 맞춘다.
+ * vscode에 의존하지 않으므로 오프라인 평가(src/tools/evalPromptCompression.ts)에서도 쓴다.
+ */
+
+import { OutlineLine } from "./addonLoader";
+import { TokenMapper } from "./mapLoader";
+
+export interface PromptBudget {
+    maxTokens: number;  // 문맥(요약 + 원문) 전체 토큰 예산 (estimateTokens 기준)
+    nearLines: number;  // 원문으로 두는 커서 직전 줄 수 (이 줄만으로 예산을 넘으면 먼 줄부터 줄인다)
+}
+
+export const DEFAULT_PROMPT_BUDGET: PromptBudget = { maxTokens: 1500, nearLines: 40 };
+
+// 원문에 쓰는 예산 비율 (나머지는 요약)
+const NEAR_SHARE = 0.6;
+const MAX_SIGNATURE_CHARS = 160;
+
+export interface CompressedContext {
+    summary: string;       // 비어 있으면 압축하지 않음
+    verbatim: string;      // 커서 직전 원문
+    verbatimFromLine: number;
+    originalTokens: number;
+    compressedTokens: number;
+}
+
+/**
+ * OpenAI BPE 토큰 수 근사: ASCII 코드는 약 4자당 1토큰, 비ASCII 문자는 글자당 1토큰.
+ * 예산 판정과 오프라인 비교에 같은 함수를 쓰므로 상대 비교에는 충분하다.
+ */
+export function estimateTokens(text: string): number {
+    let ascii = 0;
+    let other = 0;
+    for (let i = 0; i < text.length; i++) {
+        if (text.charCodeAt(i) < 128) { ascii++; } else { other++; }
+    }
+    return Math.ceil(ascii / 4) + other;
+}
+
+// estimateTokens를 줄 단위로 더하고 빼기 위한 문자 수 (줄을 "\n"으로 이을 때 개행은 ASCII 한 글자)
+interface CharCount {
+    ascii: number;
+    other: number;
+}
+
+function countChars(text: string): CharCount {
+    let ascii = 0;
+    for (let i = 0; i < text.length; i++) {
+        if (text.charCodeAt(i) < 128) { ascii++; }
+    }
+    return { ascii, other: text.length - ascii };
+}
+
+function tokensOf(count: CharCount): number {
+    return Math.ceil(count.ascii / 4) + count.other;
+}
+
+// 줄 하나(와 이어 붙이는 개행)를 더하거나(sign = 1) 뺀 문자 수
+function withLine(count: CharCount, line: string, newline: boolean, sign: 1 | -1): CharCount {
+    const c = countChars(line);
+    return {
+        ascii: count.ascii + sign * (c.ascii + (newline ? 1 : 0)),
+        other: count.other + sign * c.other,
+    };
+}
+
+function indent(depth: number): string {
+    return "  ".repeat(depth);
+}
+
+function tokenStream(line: OutlineLine, mapper: TokenMapper | undefined): string {
+    return line.tokens
+        .map(t => t.text ?? (mapper ? mapper.getHumanReadableName(t.symbol) : t.symbol))
+        .join(" ");
+}
+
+// maxDepth 이하의 시그니처만 남기고, withStreams가 false면 최상위 토큰열도 버린다
+function summarize(
+    lines: string[],
+    outline: OutlineLine[],
+    endLine: number,
+    mapper: TokenMapper | undefined,
+    maxDepth: number,
+    withStreams: boolean
+): string[] {
+    const out: string[] = [];
+    let lastStream = "";
+    let repeat = 0;
+    let elided = false;
+
+    const flushRepeat = () => {
+        if (repeat > 1) { out[out.length - 1] += `  (x${repeat})`; }
+        repeat = 0;
+        lastStream = "";
+    };
+
+    for (const line of outline) {
+        if (line.line >= endLine) { break; }
+        if (line.signature && line.depth <= maxDepth) {
+            flushRepeat();
+            const source = (lines[line.line] ?? "").trim();
+            out.push(indent(line.depth) + source.slice(0, MAX_SIGNATURE_CHARS));
+            elided = false;
+        } else if (line.depth === 0 && !line.signature) {
+            if (!withStreams) { continue; }
+            const stream = tokenStream(line, mapper);
+            if (stream === lastStream) {
+                repeat++;
+                continue;
+            }
+            flushRepeat();
+            out.push(stream);
+            lastStream = stream;
+            repeat = 1;
+            elided = false;
+        } else if (!elided) {
+            flushRepeat();
+            out.push(indent(Math.min(line.depth, maxDepth + 1)) + "...");
+            elided = true;
+        }
+    }
+    flushRepeat();
+    return out;
+}
+
+export function compressContext(
+    fullContext: string,
+    outline: OutlineLine[] | null | undefined,
+    mapper: TokenMapper | undefined,
+    budget: PromptBudget = DEFAULT_PROMPT_BUDGET
+): CompressedContext {
+    const originalTokens = estimateTokens(fullContext);
+    const uncompressed: CompressedContext = {
+        summary: "",
+        verbatim: fullContext,
+        verbatimFromLine: 0,
+        originalTokens,
+        compressedTokens: originalTokens,
+    };
+    if (!outline || budget.maxTokens <= 0 || originalTokens <= budget.maxTokens) { return uncompressed; }
+
+    const lines = fullContext.split("\n");
+
+    // 1. 원문 구간: 최소 nearLines줄, 원문 예산 안에서 위로 넓힌다.
+    //    nearLines줄만으로 전체 예산을 넘으면 커서에서 먼 줄부터 줄인다 (마지막 한 줄은 앞부분을 자른다)
+    let start = Math.max(0, lines.length - budget.nearLines);
+    let near = countChars(lines.slice(start).join("\n"));
+    let verbatim: string | undefined;
+    if (tokensOf(near) > budget.maxTokens) {
+        while (start < lines.length - 1 && tokensOf(near) > budget.maxTokens) {
+            near = withLine(near, lines[start], true, -1);
+            start++;
+        }
+        if (tokensOf(near) > budget.maxTokens) {
+            const last = lines[start];
+            let from = last.length;
+            let tail: CharCount = { ascii: 0, other: 0 };
+            while (from > 0) {
+                const next = withLine(tail, last[from - 1], false, 1);
+                if (tokensOf(next) > budget.maxTokens) { break; }
+                tail = next;
+                from--;
+            }
+            verbatim = last.slice(from);
+            near = tail;
+        }
+    } else {
+        while (start > 0) {
+            const next = withLine(near, lines[start - 1], true, 1);
+            if (tokensOf(next) > budget.maxTokens * NEAR_SHARE) { break; }
+            near = next;
+            start--;
+        }
+    }
+    if (start === 0) { return uncompressed; }
+    const nearTokens = tokensOf(near);
+
+    // 2. 요약: 예산에 맞을 때까지 단계적으로 줄인다
+    const summaryBudget = Math.max(0, budget.maxTokens - nearTokens);
+    let summary: string[] = [];
+    for (const [maxDepth, withStreams] of [[2, true], [1, true], [0, true], [1, false], [0, false]] as [number, boolean][]) {
+        summary = summarize(lines, outline, start, mapper, maxDepth, withStreams);
+        if (estimateTokens(summary.join("\n")) <= summaryBudget) { break; }
+    }
+    // 그래도 넘치면 오래된 줄부터 버린다
+    let summaryCount = countChars(summary.join("\n"));
+    while (summary.length > 0 && tokensOf(summaryCount) > summaryBudget) {
+        summaryCount = withLine(summaryCount, summary.shift()!, summary.length > 0, -1);
+    }
+
+    verbatim ??= lines.slice(start).join("\n");
+    const summaryText = summary.join("\n");
+    return {
+        summary: summaryText,
+        verbatim,
+        verbatimFromLine: start,
+        originalTokens,
+        compressedTokens: estimateTokens(summaryText) + estimateTokens(verbatim),
+    };
+}
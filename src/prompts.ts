@@ -111,4 +111,54 @@ export function generateCompletionPrompt(fullContext: string, structCandidate: s
 This is the incomplete ${languageName} code: ${fullContext}  '${structCandidate}'
 Complete the '${structCandidate}' part of the code in ${languageName}.
 Just show your answer in place of '${structCandidate}'`;
-}
\ No newline at end of file
+}
+
+// 먼 문맥을 구조 요약으로 압축한 경우 (src/promptCompression.ts)
+export function generateCompletionPromptWithSummary(
+    contextSummary: string,
+    nearContext: string,
+    structCandidate: string,
+    languageName: string
+): string {
+    return `
+Outline of the earlier part of this ${languageName} file (signatures verbatim, bodies elided as "...", other lines as token categories):
+${contextSummary}
+
+This is the incomplete ${languageName} code that follows: ${nearContext}  '${structCandidate}'
+Complete the '${structCandidate}' part of the code in ${languageName}.
+Just show your answer in place of '${structCandidate}'`;
+}
+
+// 구조 후보의 문법적 타당성 판정 (completion.auditPrompt 덤프, src/tools/auditCandidates.ts 배치)
+// 응답 형식은 src/candidateAudit.ts의 parseAuditResponse가 읽는다
+export function generateAuditPrompt(
+    languageName: string,
+    sourceUpToCursor: string,
+    states: number[],
+    stateLines: string[],
+    candidates: { sortText: string; key: string }[]
+): string {
+    return [
+        `당신은 ${languageName} 문법 전문가입니다.`,
+        `아래는 특정 커서 위치에서의 자동완성 구조 후보 목록입니다.`,
+        ``,
+        `[커서 직전까지의 소스 코드 (커서 위치는 <<<커서>>>로 표시)]`,
+        sourceUpToCursor + "<<<커서>>>",
+        ``,
+        `[파서 State Path] ${JSON.stringify(states)}`,
+        `[State별 DB 조회 결과]`,
+        ...stateLines,
+        ``,
+        `[후보 목록 (sortText : key)]`,
+        ...candidates.map(item => `${item.sortText} : ${item.key}`),
+        ``,
+        `[작업]`,
+        `각 후보가 커서 위치 직후에 문법적으로 나타날 수 있는지 판정하세요.`,
+        ``,
+        `출력 형식 (각 줄에 하나):`,
+        `  sortText | 판정 (valid|suspect|unknown) | 한 줄 사유`,
+        `- valid → 사유 생략 가능`,
+        `- suspect / unknown → 사유 필수`,
+        `- 확신이 없으면 "unknown"으로 표시. "suspect"는 근거를 댈 수 있을 때만.`
+    ].join("\n");
+}
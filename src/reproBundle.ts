@@ -0,0 +1,115 @@
+/**
+ * @file reproBundle.ts
+ * @brief 느린 요청 재현 번들 저장 (engine_bench --replay 입력)
+ *
+ * completion.slowRequestMs를 넘은 구조 후보 요청을 globalStorage/repro/<시각>-<언어>-<라벨>/ 에 남긴다.
+ *   - bundle.json: 언어, 모드, 바이트 오프셋, 복구 상한/lookahead 창(튜닝 프로파일 반영), 상태 경로,
+ *     단계별 시간(convert/lookup/dump/deliver), 카운터
+ *   - source.txt: 요청 당시 소스 (UTF-8 그대로)
+ * completion.reproBundles
+ *   - "off": 저장 안 함 (기본값)
+ *   - "source": 소스 원문
+ *   - "redacted": addon.redactSource로 식별자/리터럴/주석을 가린 소스 (바이트 길이와 토큰 범주는 같아서
+ *     오프셋/상태 경로가 그대로 재현된다). 세션이 없어 가릴 수 없으면 소스 없이 저장
+ * 번들은 최근 MAX_BUNDLES개만 남긴다.
+ */
+
+import * as vscode from "vscode";
+import * as fs from "fs";
+import * as path from "path";
+import { ParserAddon } from "./addonLoader";
+import { ReproSnapshot } from "./CompletionService";
+import { StatsDelta } from "./engineStats";
+
+const FORMAT_VERSION = 1;
+const MAX_BUNDLES = 50;
+
+type ReproMode = "off" | "source" | "redacted";
+
+export class ReproRecorder {
+    private readonly root: string;
+
+    constructor(globalStorageUri: vscode.Uri) {
+        this.root = path.join(globalStorageUri.fsPath, "repro");
+    }
+
+    get mode(): ReproMode {
+        return vscode.workspace.getConfiguration('completion').get<ReproMode>('reproBundles', "off");
+    }
+
+    get directory(): string {
+        return this.root;
+    }
+
+    // 번들 디렉터리 경로를 돌려준다 (꺼져 있거나 쓰기 실패면 undefined)
+    record(snapshot: ReproSnapshot, addon: ParserAddon | undefined, label: string, ms: number, stats: StatsDelta): string | undefined {
+        const mode = this.mode;
+        if (mode === "off") { return undefined; }
+
+        let source: string | null = snapshot.fullText;
+        if (mode === "redacted") {
+            source = null;
+            if (addon?.redactSource && snapshot.documentUri !== undefined && snapshot.documentVersion !== undefined) {
+                source = addon.redactSource(snapshot.documentUri, snapshot.documentVersion);
+            }
+            if (source === null) {
+                console.warn(`[Warning] Repro bundle: cannot redact ${snapshot.languageId} source (no session), saving without source`);
+            }
+        }
+
+        const createdAt = new Date();
+        const dir = path.join(this.root, `${stamp(createdAt)}-${snapshot.languageId}-${label}`);
+        const bundle = {
+            formatVersion: FORMAT_VERSION,
+            createdAt: createdAt.toISOString(),
+            languageId: snapshot.languageId,
+            label,
+            mode: snapshot.mode,
+            byteOffset: snapshot.byteOffset,
+            recoveryLimit: snapshot.recoveryLimit,
+            lookaheadBytes: snapshot.lookaheadBytes,
+            redacted: mode === "redacted",
+            sourceFile: source !== null ? "source.txt" : null,
+            statePath: snapshot.statePath,
+            totalMs: ms,
+            phases: snapshot.phases,
+            stats,
+        };
+
+        try {
+            fs.mkdirSync(dir, { recursive: true });
+            if (source !== null) {
+                fs.writeFileSync(path.join(dir, "source.txt"), source, "utf8");
+            }
+            fs.writeFileSync(path.join(dir, "bundle.json"), JSON.stringify(bundle, null, 2) + "\n", "utf8");
+        } catch (e) {
+            console.error("[Error] Failed to write repro bundle:", e);
+            return undefined;
+        }
+        console.log(`[Stats] Repro bundle saved: ${dir}`);
+        this.prune();
+        return dir;
+    }
+
+    // 이름이 시각으로 시작하므로 정렬 순서 = 생성 순서
+    private prune() {
+        try {
+            const entries = fs.readdirSync(this.root, { withFileTypes: true })
+                .filter((e) => e.isDirectory())
+                .map((e) => e.name)
+                .sort();
+            for (const name of entries.slice(0, Math.max(0, entries.length - MAX_BUNDLES))) {
+                fs.rmSync(path.join(this.root, name), { recursive: true, force: true });
+            }
+        } catch (e) {
+            console.error("[Error] Failed to prune repro bundles:", e);
+        }
+    }
+}
+
+// 20261018-153045-123 (로컬 시각, 디렉터리 이름용)
+function stamp(date: Date): string {
+    const pad = (n: number, width = 2) => String(n).padStart(width, "0");
+    return `${date.getFullYear()}${pad(date.getMonth() + 1)}${pad(date.getDate())}-` +
+        `${pad(date.getHours())}${pad(date.getMinutes())}${pad(date.getSeconds())}-${pad(date.getMilliseconds(), 3)}`;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file requestGuard.ts
+ * @brief 비동기 파이프라인의 낡은 결과 차단 (문서 URI, 버전, 오프셋, 요청 ID 태그)
+ *
+ * 요청마다 RequestTicket을 발급하고, 결과를 반영하기 직전에 accept()로 확인한다.
+ *   - 같은 채널(structural / textual)에 새 요청이 오면 이전 요청은 취소 (AbortSignal → LLM 호출 중단,
+ *     컨버전 워커에 넘긴 작업 취소, 아직 시작하지 않은 네이티브 컨버전/슬롯 채우기/토큰 모델 호출 생략)
+ *   - 구조 요청은 그 결과에 기대는 코드 생성 요청도 함께 취소
+ *   - 요청 중인 문서가 편집되거나 다른 편집기로 넘어가면 취소
+ *   - 결과가 도착했을 때 요청 ID가 최신이 아니거나 문서 버전/커서 오프셋이 달라졌으면 버림
+ * discarded(끝까지 돌았지만 버린 결과)와 cancelled(도중에 멈춘 요청) 수는 디바운스/추측 실행 튜닝용으로 남긴다.
+ */
+
+import * as vscode from "vscode";
+
+export type RequestChannel = "structural" | "textual";
+
+export interface RequestTag {
+    uri: string;
+    version: number;
+    offset: number;  // UTF-16 (document.offsetAt)
+    id: number;
+}
+
+export interface RequestGuardStats {
+    started: number;
+    accepted: number;
+    discarded: number;
+    cancelled: number;
+}
+
+export class RequestTicket {
+    private controller = new AbortController();
+
+    constructor(readonly channel: RequestChannel, readonly tag: RequestTag) {}
+
+    get signal(): AbortSignal { return this.controller.signal; }
+    get cancelled(): boolean { return this.controller.signal.aborted; }
+
+    // RequestGuard만 호출한다 (처음 한 번만 true)
+    cancel(): boolean {
+        if (this.controller.signal.aborted) { return false; }
+        this.controller.abort();
+        return true;
+    }
+}
+
+export class RequestGuard implements vscode.Disposable {
+    private nextId = 1;
+    private current = new Map<RequestChannel, RequestTicket>();
+    private counters: RequestGuardStats = { started: 0, accepted: 0, discarded: 0, cancelled: 0 };
+    private disposables: vscode.Disposable[] = [];
+
+    constructor() {
+        this.disposables.push(
+            vscode.workspace.onDidChangeTextDocument((event) => {
+                if (event.contentChanges.length === 0) { return; }
+                const uri = event.document.uri.toString();
+                for (const ticket of this.current.values()) {
+                    if (ticket.tag.uri === uri && ticket.tag.version !== event.document.version) {
+                        this.cancel(ticket, "document changed");
+                    }
+                }
+            }),
+            vscode.window.onDidChangeActiveTextEditor((editor) => {
+                const uri = editor?.document.uri.toString();
+                for (const ticket of this.current.values()) {
+                    if (ticket.tag.uri !== uri) { this.cancel(ticket, "editor changed"); }
+                }
+            })
+        );
+    }
+
+    // 새 요청 태그 발급 (같은 채널의 이전 요청은 취소)
+    begin(channel: RequestChannel, document: vscode.TextDocument, offset: number): RequestTicket {
+        const previous = this.current.get(channel);
+        if (previous) { this.cancel(previous, "superseded"); }
+        if (channel === "structural") {
+            const dependent = this.current.get("textual");
+            if (dependent) { this.cancel(dependent, "structural request restarted"); }
+        }
+
+        const ticket = new RequestTicket(channel, {
+            uri: document.uri.toString(),
+            version: document.version,
+            offset,
+            id: this.nextId++,
+        });
+        this.current.set(channel, ticket);
+        this.counters.started++;
+        return ticket;
+    }
+
+    // 결과를 반영해도 되는지: 최신 요청이고, 문서/버전/오프셋이 요청 시점과 같아야 한다
+    accept(ticket: RequestTicket, document: vscode.TextDocument, offset: number): boolean {
+        const tag = ticket.tag;
+        const fresh = !ticket.cancelled &&
+            this.current.get(ticket.channel) === ticket &&
+            document.uri.toString() === tag.uri &&
+            document.version === tag.version &&
+            offset === tag.offset;
+        if (this.current.get(ticket.channel) === ticket) { this.current.delete(ticket.channel); }
+
+        if (fresh) {
+            this.counters.accepted++;
+            return true;
+        }
+        if (ticket.cancelled) {
+            // 취소된 뒤에 도착한 결과는 cancelled로 이미 셌다
+            console.log(`[Guard] Dropped ${ticket.channel} #${tag.id} (cancelled)`);
+        } else {
+            this.counters.discarded++;
+            console.log(`[Guard] Discarded stale ${ticket.channel} #${tag.id} ` +
+                `(v${tag.version}@${tag.offset} -> v${document.version}@${offset})`);
+        }
+        return false;
+    }
+
+    stats(): RequestGuardStats {
+        return { ...this.counters };
+    }
+
+    resetStats() {
+        this.counters = { started: 0, accepted: 0, discarded: 0, cancelled: 0 };
+    }
+
+    static format(stats: RequestGuardStats): string {
+        return `요청 ${stats.started}건: 반영 ${stats.accepted}, 낡은 결과 버림 ${stats.discarded}, 취소 ${stats.cancelled}`;
+    }
+
+    private cancel(ticket: RequestTicket, reason: string) {
+        if (this.current.get(ticket.channel) === ticket) { this.current.delete(ticket.channel); }
+        if (!ticket.cancel()) { return; }
+        this.counters.cancelled++;
+        console.log(`[Guard] Cancelled ${ticket.channel} #${ticket.tag.id} (${reason})`);
+    }
+
+    dispose() {
+        for (const ticket of this.current.values()) { ticket.cancel(); }
+        this.current.clear();
+        this.disposables.forEach((d) => d.dispose());
+    }
+}
@@ -0,0 +1,189 @@
+/**
+ * @file resultRing.ts
+ * @brief 네이티브 컨버전 워커 → 확장 스레드 결과 링 (SharedArrayBuffer, 단일 생산자/단일 소비자)
+ *
+ * 레이아웃은 native/src/result_ring.h와 같다. 워커가 상태 경로와 후보 key ID/value를 고정 이진 형식으로
+ * 쓰고, 여기서는 위치 두 개만 Atomics로 주고받으며 읽는다 (postMessage 직렬화/복사 없음).
+ * 비어 있으면 대기 플래그를 세우고 Atomics.waitAsync로 기다린다. 워커는 플래그가 서 있을 때만
+ * doorbell(addon의 스레드 안전 함수 → 메인 스레드에서 notify)을 울리므로, 결과가 계속 들어오는 동안은
+ * 스레드 간 깨움 비용이 없다.
+ * vscode 모듈을 쓰지 않는다.
+ */
+
+import { ConversionWorkerOptions, ParserAddon } from "./addonLoader";
+
+export const RING_MAGIC = 0x52454343;
+const CAPACITY_SLOT = 1;
+const WRITE_SLOT = 64 / 4;
+const READ_SLOT = 128 / 4;
+const WAITING_SLOT = 132 / 4;
+const STALL_SLOT = 192 / 4;
+const DATA_OFFSET = 256;
+const RECORD_HEADER_BYTES = 5 * 4;
+
+// 한 레코드는 링의 절반까지 (워커가 후보 수를 자른다). 256 KiB면 후보 1.6만 개
+export const DEFAULT_RING_CAPACITY = 1 << 18;
+
+export interface RingRecord {
+    id: number;
+    status: number;          // 0 정상, 음수 오류 (-1: 상태 경로가 레코드 상한을 넘어 경로/후보 없이 옴)
+    states: Uint16Array;     // 상태 경로
+    candidates: Uint32Array; // (key ID, value) 쌍, value 내림차순
+}
+
+// Atomics.waitAsync는 ES2024 lib에만 타입이 있다 (Node 16+에 있음)
+type WaitAsync = (typed: Int32Array, index: number, value: number) =>
+    { async: false; value: "not-equal" | "timed-out" } | { async: true; value: Promise<"ok" | "timed-out"> };
+
+export class ResultRing {
+    readonly words: Int32Array;
+    private readonly u32: Uint32Array;
+    private readonly capacity: number;
+
+    private constructor(readonly buffer: SharedArrayBuffer) {
+        this.words = new Int32Array(buffer);
+        this.u32 = new Uint32Array(buffer);
+        this.capacity = this.u32[CAPACITY_SLOT];
+    }
+
+    // capacity: 데이터 영역 바이트 수 (2의 거듭제곱으로 올림)
+    static create(capacity = DEFAULT_RING_CAPACITY): ResultRing {
+        let size = 1024;
+        while (size < capacity) { size *= 2; }
+        const buffer = new SharedArrayBuffer(DATA_OFFSET + size);
+        const header = new Uint32Array(buffer);
+        header[0] = RING_MAGIC;
+        header[CAPACITY_SLOT] = size;
+        return new ResultRing(buffer);
+    }
+
+    // 워커가 링이 가득 차서 기다린 횟수 (소비가 밀리는지 보는 용도)
+    get stalls(): number {
+        return Atomics.load(this.words, STALL_SLOT);
+    }
+
+    // 다음 레코드를 복사해서 꺼낸다 (없으면 undefined). 꺼낸 자리는 바로 워커에 돌려준다
+    tryRead(): RingRecord | undefined {
+        const write = Atomics.load(this.words, WRITE_SLOT) >>> 0;
+        let read = Atomics.load(this.words, READ_SLOT) >>> 0;
+        if (read === write) { return undefined; }
+
+        let at = read & (this.capacity - 1);
+        let size = this.u32[(DATA_OFFSET + at) >> 2];
+        if (size === 0) {
+            // 되감기 표시: 남은 꼬리를 건너뛰고 처음부터
+            read = (read + this.capacity - at) >>> 0;
+            at = 0;
+            size = this.u32[DATA_OFFSET >> 2];
+        }
+        const base = (DATA_OFFSET + at) >> 2;
+        const stateCount = this.u32[base + 3];
+        const candidateCount = this.u32[base + 4];
+        const statesAt = DATA_OFFSET + at + RECORD_HEADER_BYTES;
+        const candidatesAt = statesAt + ((stateCount * 2 + 3) & ~3);
+        const record: RingRecord = {
+            id: this.u32[base + 1],
+            status: this.words[base + 2],
+            states: new Uint16Array(this.buffer, statesAt, stateCount).slice(),
+            candidates: new Uint32Array(this.buffer, candidatesAt, candidateCount * 2).slice(),
+        };
+        Atomics.store(this.words, READ_SLOT, (read + size) | 0);
+        return record;
+    }
+
+    async next(): Promise<RingRecord> {
+        for (;;) {
+            const record = this.tryRead();
+            if (record) { return record; }
+            // 플래그를 세운 뒤 쓰기 위치를 다시 본다 (워커는 위치를 올린 뒤 플래그를 본다)
+            Atomics.store(this.words, WAITING_SLOT, 1);
+            const write = Atomics.load(this.words, WRITE_SLOT);
+            if (write !== Atomics.load(this.words, READ_SLOT)) {
+                Atomics.store(this.words, WAITING_SLOT, 0);
+                continue;
+            }
+            const result = ((Atomics as any).waitAsync as WaitAsync)(this.words, WRITE_SLOT, write);
+            if (result.async) { await result.value; }
+        }
+    }
+
+    // doorbell: 워커 스레드 대신 메인 스레드에서 waitAsync 대기자를 깨운다
+    notify() {
+        Atomics.notify(this.words, WRITE_SLOT);
+    }
+}
+
+export interface WorkerConversion {
+    statePath: number[];
+    candidates: { key: string; value: number }[];  // value 내림차순 (lookupDB 합산과 같은 순서)
+}
+
+// =============================================================================
+// [ConversionWorker] addon의 네이티브 워커 + 결과 링 (언어별 하나)
+// =============================================================================
+export class ConversionWorker {
+    private pending = new Map<number, (result: WorkerConversion | undefined) => void>();
+    private pumping = false;
+    private disposed = false;
+
+    private constructor(private addon: ParserAddon, readonly ring: ResultRing, private keys: string[]) {}
+
+    // addon에 워커가 없거나 DB를 못 읽으면 undefined (호출측은 동기 경로로)
+    static start(addon: ParserAddon, options: ConversionWorkerOptions, capacity = DEFAULT_RING_CAPACITY): ConversionWorker | undefined {
+        if (!addon.startConversionWorker) { return undefined; }
+        const ring = ResultRing.create(capacity);
+        const keys = addon.startConversionWorker(ring.words, options, () => ring.notify());
+        return keys ? new ConversionWorker(addon, ring, keys) : undefined;
+    }
+
+    // 소스 사본으로 컨버전 + 후보 순위. 워커가 멈추거나 signal로 취소되면 undefined
+    // (취소하면 큐에 남은 작업은 버리고, 진행 중인 작업은 결과를 링에 쓰지 않는다)
+    convert(sourceCode: string, byteOffset: number, mode: number, signal?: AbortSignal): Promise<WorkerConversion | undefined> {
+        if (this.disposed || signal?.aborted) { return Promise.resolve(undefined); }
+        const id = this.addon.submitConversion(sourceCode, byteOffset, mode);
+        if (id === 0) { return Promise.resolve(undefined); }
+        const result = new Promise<WorkerConversion | undefined>(resolve => {
+            this.pending.set(id, resolve);
+            signal?.addEventListener("abort", () => {
+                if (!this.pending.delete(id)) { return; }
+                this.addon.cancelConversion(id);
+                resolve(undefined);
+            }, { once: true });
+        });
+        void this.pump();
+        return result;
+    }
+
+    dispose() {
+        if (this.disposed) { return; }
+        this.disposed = true;
+        this.addon.stopConversionWorker();
+        for (const resolve of this.pending.values()) { resolve(undefined); }
+        this.pending.clear();
+    }
+
+    // 기다리는 요청이 있는 동안만 링을 읽는다
+    private async pump() {
+        if (this.pumping) { return; }
+        this.pumping = true;
+        try {
+            while (this.pending.size > 0) {
+                const record = await this.ring.next();
+                const resolve = this.pending.get(record.id);
+                if (!resolve) { continue; }
+                this.pending.delete(record.id);
+                resolve(record.status < 0 ? undefined : this.decode(record));
+            }
+        } finally {
+            this.pumping = false;
+        }
+    }
+
+    private decode(record: RingRecord): WorkerConversion {
+        const candidates: { key: string; value: number }[] = [];
+        for (let i = 0; i < record.candidates.length; i += 2) {
+            candidates.push({ key: this.keys[record.candidates[i]], value: record.candidates[i + 1] });
+        }
+        return { statePath: Array.from(record.states), candidates };
+    }
+}
@@ -0,0 +1,52 @@
+/**
+ * @file semanticTokens.ts
+ * @brief Small Basic 시맨틱 토큰 provider (sb_parser_addon의 보존 트리 기반, delta 지원)
+ *
+ * 분류와 증분 갱신은 addon이 한다 (native/src/semantic_tokens.*).
+ * 편집 후에는 변경 구간만 다시 분류되고, delta 요청에는 바뀐 부분 한 건만 돌려준다.
+ * 세션이 문서 버전을 따라오지 못했으면(로딩 전에 열린 문서 등) 전체 텍스트로 다시 열고 한 번 더 묻는다.
+ */
+
+import * as vscode from "vscode";
+import { ParserAddon } from "./addonLoader";
+
+export class SemanticTokensProvider implements vscode.DocumentSemanticTokensProvider {
+    readonly legend: vscode.SemanticTokensLegend;
+
+    constructor(private addon: ParserAddon) {
+        const { tokenTypes, tokenModifiers } = addon.semanticTokensLegend();
+        this.legend = new vscode.SemanticTokensLegend(tokenTypes, tokenModifiers);
+    }
+
+    private resync(document: vscode.TextDocument) {
+        this.addon.openDocument(document.uri.toString(), document.getText(), document.version);
+    }
+
+    provideDocumentSemanticTokens(document: vscode.TextDocument): vscode.SemanticTokens | undefined {
+        const uri = document.uri.toString();
+        let result = this.addon.semanticTokens(uri, document.version);
+        if (!result) {
+            this.resync(document);
+            result = this.addon.semanticTokens(uri, document.version);
+        }
+        return result ? new vscode.SemanticTokens(result.data, result.resultId) : undefined;
+    }
+
+    provideDocumentSemanticTokensEdits(
+        document: vscode.TextDocument,
+        previousResultId: string
+    ): vscode.SemanticTokens | vscode.SemanticTokensEdits | undefined {
+        const result = this.addon.semanticTokensDelta(document.uri.toString(), document.version, previousResultId);
+        if (!result) {
+            // 다시 열면 이전 결과와 이어지지 않으므로 전체로 보낸다
+            return this.provideDocumentSemanticTokens(document);
+        }
+        if ("data" in result) {
+            return new vscode.SemanticTokens(result.data, result.resultId);
+        }
+        return new vscode.SemanticTokensEdits(
+            result.edits.map((e) => new vscode.SemanticTokensEdit(e.start, e.deleteCount, e.data)),
+            result.resultId
+        );
+    }
+}
@@ -0,0 +1,83 @@
+/**
+ * @file slotFiller.ts
+ * @brief 구조 후보의 식별자/리터럴 슬롯을 문서 색인으로 채워 LLM 호출 없이 코드로 만든다
+ *
+ * 예: "ID = Expr"        → Expr 비단말이 있으므로 채울 수 없음 (LLM으로 넘김)
+ *     "ID . ID ( )"      → "total.Add()"   (ID 슬롯 2개를 서로 다른 이름으로)
+ *     "$ name"           → "$count"
+ */
+
+import { TokenMapper } from "./mapLoader";
+import { SlotKind } from "./addonLoader";
+
+// 원본 DB 토큰 이름 → 슬롯 종류 (native/src/symbol_classes.cc의 분류와 같은 규칙)
+export function slotKindOf(token: string): SlotKind | undefined {
+    if (/^(field_identifier|property_identifier|shorthand_property_identifier|private_property_identifier|method_identifier)$/.test(token)) {
+        return "member";
+    }
+    if (/^(ID|identifier|name|constant|variable|constructor|instance_variable|class_variable|global_variable|\w+_identifier)$/.test(token)) {
+        return "identifier";
+    }
+    if (/^(STR|NUM|string|number|integer|float|char|\w+_literal)$/.test(token)) {
+        return "literal";
+    }
+    return undefined;
+}
+
+// 토큰 사이 공백 규칙: 여는 괄호/점/$ 뒤, 닫는 괄호/구분자 앞은 붙인다
+export function joinTokens(tokens: string[]): string {
+    let out = "";
+    for (const token of tokens) {
+        if (out.length === 0) {
+            out = token;
+            continue;
+        }
+        const prev = out[out.length - 1];
+        const glueAfter = /[(\[.$\n]/.test(prev);
+        const glueBefore = /^[)\],.;:(\[]/.test(token) || token === "\n";
+        out += (glueAfter || glueBefore) ? token : " " + token;
+    }
+    return out;
+}
+
+/**
+ * @param rawKey   DB 원본 key (공백 구분 토큰열)
+ * @param mapper   언어별 TokenMapper (키워드/기호의 구체 텍스트)
+ * @param lookup   (kind, count) → 점수순 이름 목록
+ * @return 모든 슬롯을 채웠으면 코드 텍스트, 하나라도 못 채우면 null
+ */
+export function fillStructuralSlots(
+    rawKey: string,
+    mapper: TokenMapper,
+    lookup: (kind: SlotKind, count: number) => string[]
+): string | null {
+    const tokens = rawKey.split(" ").filter(t => t.length > 0);
+    const slots = tokens.map(slotKindOf);
+
+    // 같은 종류의 슬롯이 여러 개면 서로 다른 이름을 순서대로 배정
+    const needed = new Map<SlotKind, number>();
+    slots.forEach(kind => { if (kind) { needed.set(kind, (needed.get(kind) ?? 0) + 1); } });
+    const pools = new Map<SlotKind, string[]>();
+    for (const [kind, count] of needed) {
+        const names = lookup(kind, count);
+        if (names.length === 0) { return null; }
+        pools.set(kind, names);
+    }
+
+    const used = new Map<SlotKind, number>();
+    const out: string[] = [];
+    for (let i = 0; i < tokens.length; i++) {
+        const kind = slots[i];
+        if (kind) {
+            const pool = pools.get(kind)!;
+            const n = used.get(kind) ?? 0;
+            used.set(kind, n + 1);
+            out.push(pool[Math.min(n, pool.length - 1)]);
+            continue;
+        }
+        const concrete = mapper.getConcreteText(tokens[i]);
+        if (concrete === undefined) { return null; }  // 비단말 등 텍스트가 정해지지 않은 토큰
+        out.push(concrete);
+    }
+    return joinTokens(out);
+}
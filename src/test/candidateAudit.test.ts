@@ -0,0 +1,125 @@
+/**
+ * @file candidateAudit.test.ts
+ * @brief 후보 판정 배치 파이프라인(src/candidateAudit.ts) — LLM 대신 MockBackend
+ *
+ * 동시 요청 상한, (상태 경로, 후보) 중복 제거, 캐시 재사용, 응답 해석, 상태별 집계를 확인한다.
+ */
+
+import * as assert from 'assert';
+import * as fs from 'fs';
+import * as os from 'os';
+import * as path from 'path';
+import { AuditBackend, AuditCache, AuditPosition, parseAuditResponse, runAudit } from '../candidateAudit';
+
+// 프롬프트의 "[후보 목록]" 줄을 읽어 key에 "bad"가 있으면 suspect, 나머지는 valid로 답한다
+class MockBackend implements AuditBackend {
+	readonly name = 'mock';
+	prompts: string[] = [];
+	active = 0;
+	maxActive = 0;
+
+	constructor(private delayMs = 5, private skip = new Set<string>()) {}
+
+	async audit(prompt: string): Promise<string> {
+		this.prompts.push(prompt);
+		this.active++;
+		this.maxActive = Math.max(this.maxActive, this.active);
+		await new Promise((resolve) => setTimeout(resolve, this.delayMs));
+		this.active--;
+		const lines: string[] = [];
+		for (const m of prompt.matchAll(/^(\d{3}) : (.*)$/gm)) {
+			if (this.skip.has(m[2])) { continue; }
+			lines.push(m[2].includes('bad') ? `${m[1]} | suspect | no such production` : `${m[1]} | valid`);
+		}
+		return lines.join('\n');
+	}
+}
+
+function position(id: string, statePath: number[], keys: string[]): AuditPosition {
+	return {
+		id,
+		languageName: 'Python',
+		sourceUpToCursor: `# ${id}\n`,
+		statePath,
+		stateLines: [],
+		candidates: keys.map((key, i) => ({
+			sortText: (i + 1).toString().padStart(3, '0'),
+			key,
+			rawKey: key,
+			states: [statePath[statePath.length - 1]],
+		})),
+	};
+}
+
+suite('Candidate Audit Pipeline', () => {
+	test('parses verdict lines and ignores the rest', () => {
+		const labels = parseAuditResponse('판정:\n001 | valid\n- 002 | Suspect | 사유 | 계속\n003 | maybe\nfoo');
+		assert.deepStrictEqual(labels.get('001'), { verdict: 'valid', reason: '' });
+		assert.deepStrictEqual(labels.get('002'), { verdict: 'suspect', reason: '사유 | 계속' });
+		assert.strictEqual(labels.has('003'), false);
+	});
+
+	test('respects the concurrency limit', async () => {
+		const backend = new MockBackend(10);
+		const positions = Array.from({ length: 20 }, (_, i) => position(`p${i}`, [1, 100 + i], ['a', 'b']));
+		const report = await runAudit(positions, backend, { concurrency: 3 });
+		assert.strictEqual(report.requests, 20);
+		assert.strictEqual(backend.maxActive, 3);
+		assert.strictEqual(report.judgments, 40);
+	});
+
+	test('dedups by (state path, candidate) within a run', async () => {
+		const backend = new MockBackend();
+		const report = await runAudit([
+			position('x', [1, 7], ['a', 'bad b']),
+			position('y', [1, 7], ['a', 'bad b']),  // 같은 경로: 묻지 않음
+			position('z', [1, 8], ['a']),           // 다른 경로: 다시 묻는다
+		], backend, { concurrency: 4 });
+		assert.strictEqual(report.requests, 2);
+		assert.strictEqual(report.sharedHits, 2);
+		assert.strictEqual(report.judgments, 3);
+
+		const state7 = report.states.find((s) => s.state === 7)!;
+		assert.deepStrictEqual([state7.valid, state7.suspect, state7.unknown], [1, 1, 0]);
+		assert.strictEqual(state7.suspectKeys[0].key, 'bad b');
+		assert.strictEqual(report.states[0].state, 7, 'suspect 비율이 높은 상태가 먼저');
+	});
+
+	test('reuses cached judgments and only asks for new candidates', async () => {
+		const dir = fs.mkdtempSync(path.join(os.tmpdir(), 'audit-'));
+		const file = path.join(dir, 'cache.json');
+		try {
+			const first = new MockBackend();
+			const cache = new AuditCache(file);
+			await runAudit([position('x', [1, 7], ['a', 'b'])], first, { concurrency: 2, cache });
+			cache.save();
+
+			const second = new MockBackend();
+			const report = await runAudit([position('x', [1, 7], ['a', 'b', 'c'])], second, {
+				concurrency: 2,
+				cache: new AuditCache(file),
+			});
+			assert.strictEqual(report.cacheHits, 2);
+			assert.strictEqual(second.prompts.length, 1);
+			assert.ok(second.prompts[0].includes('003 : c'), '새 후보만 프롬프트에 들어간다');
+			assert.ok(!second.prompts[0].includes(' : a'));
+			assert.strictEqual(report.judgments, 3);
+		} finally {
+			fs.rmSync(dir, { recursive: true, force: true });
+		}
+	});
+
+	test('does not cache unanswered candidates or failed requests', async () => {
+		const cache = new AuditCache();
+		const partial = new MockBackend(1, new Set(['b']));
+		const report = await runAudit([position('x', [1, 7], ['a', 'b'])], partial, { concurrency: 1, cache });
+		assert.strictEqual(report.unanswered, 1);
+		assert.strictEqual(cache.size, 1);
+
+		const failing: AuditBackend = { name: 'mock', audit: async () => { throw new Error('down'); } };
+		const failed = await runAudit([position('y', [1, 9], ['a'])], failing, { concurrency: 1, cache });
+		assert.strictEqual(failed.failedRequests, 1);
+		assert.strictEqual(failed.unanswered, 1);
+		assert.strictEqual(cache.size, 1);
+	});
+});
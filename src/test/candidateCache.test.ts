@@ -0,0 +1,55 @@
+/**
+ * @file candidateCache.test.ts
+ * @brief 인라인 후보 캐시(src/candidateCache.ts)의 앵커 조회
+ *
+ * 문서 버전과 무관하게 앵커 뒤로 타이핑한 텍스트가 후보의 접두사인 동안만 같은 항목을 돌려주는지 확인한다.
+ */
+
+import * as assert from 'assert';
+import { CandidateAnchor, CandidateCache } from '../candidateCache';
+
+const URI = 'file:///a.sb';
+
+function anchor(line: number, lineText: string, character: number): CandidateAnchor {
+	return { uri: URI, line, character, prefix: lineText.slice(0, character) };
+}
+
+suite('CandidateCache', () => {
+	test('타이핑한 텍스트가 후보의 접두사인 동안 같은 후보를 돌려준다', () => {
+		const cache = new CandidateCache();
+		cache.update(anchor(3, '  ', 2), { inlineText: 'count = 0' });
+
+		for (const typed of ['', 'c', 'cou', 'count =']) {
+			const hit = cache.lookupInline(URI, 3, '  ' + typed, 2 + typed.length);
+			assert.ok(hit, typed);
+			assert.strictEqual(hit.typed, typed);
+			assert.strictEqual(hit.entry.inlineText, 'count = 0');
+		}
+		assert.strictEqual(cache.lookupInline(URI, 3, '  cx', 4), undefined);
+		assert.strictEqual(cache.lookupInline(URI, 4, '  c', 3), undefined);
+	});
+
+	test('앵커 앞 내용이 바뀌면 조회되지 않는다', () => {
+		const cache = new CandidateCache();
+		cache.update(anchor(0, 'x = ', 4), { inlineText: 'foo(1)' });
+
+		assert.ok(cache.lookupInline(URI, 0, 'x = fo', 6));
+		assert.strictEqual(cache.lookupInline(URI, 0, 'y = fo', 6), undefined);
+		assert.strictEqual(cache.lookupInline(URI, 0, 'x =', 3), undefined);
+	});
+
+	test('같은 앵커는 필드를 합치고, 다른 앵커는 그 줄의 항목을 바꾼다', () => {
+		const cache = new CandidateCache();
+		const structural = [{ key: 'ID = Expr', rawKey: 'ID = Expr', value: 3, sortText: '001' }];
+		cache.update(anchor(1, 'ab', 2), { structural });
+		const merged = cache.update(anchor(1, 'ab', 2), { inlineText: 'x = 1' });
+		assert.deepStrictEqual(merged.structural, structural);
+
+		cache.update(anchor(1, 'ab', 0), { inlineText: 'abc' });
+		assert.strictEqual(cache.get(anchor(1, 'ab', 2)), undefined);
+		assert.strictEqual(cache.lookupInline(URI, 1, 'ab', 2)?.entry.inlineText, 'abc');
+
+		cache.clear(URI);
+		assert.strictEqual(cache.get(anchor(1, 'ab', 0)), undefined);
+	});
+});
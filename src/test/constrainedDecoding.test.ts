@@ -0,0 +1,55 @@
+/**
+ * @file constrainedDecoding.test.ts
+ * @brief 제약 디코딩 mock 백엔드(src/constrainedDecoding.ts) — addon 대신 작은 문법 흉내
+ *
+ * 문장 하나(ID = NUM ;)가 끝나면 complete가 되지만 다음 문장의 ID도 허용하는 상태를 흉내 내어,
+ * 생성이 처음 complete가 되는 토큰에서 멈추는지 확인한다.
+ */
+
+import * as assert from 'assert';
+import { ConstrainedStep, ParserAddon } from '../addonLoader';
+import { MockBackend } from '../constrainedDecoding';
+import { joinTokens } from '../slotFiller';
+
+const STATEMENT = ['ID', '=', 'NUM', ';'];
+
+class FakeAddon {
+	fed: string[] = [];
+	private position = 0;
+	private ended = false;
+
+	beginConstrainedDecode(): number { return 1; }
+
+	constrainedState(): ConstrainedStep {
+		return this.step(true);
+	}
+
+	feedTerminal(_handle: number, symbol: string): ConstrainedStep {
+		assert.ok(!this.ended, 'feedTerminal after endConstrainedDecode');
+		this.fed.push(symbol);
+		const accepted = symbol === STATEMENT[this.position];
+		if (accepted) { this.position = (this.position + 1) % STATEMENT.length; }
+		return this.step(accepted);
+	}
+
+	endConstrainedDecode(): void { this.ended = true; }
+
+	private step(accepted: boolean): ConstrainedStep {
+		const complete = this.fed.length > 0 && this.position === 0;
+		return { accepted, complete, allowed: [{ symbol: STATEMENT[this.position], text: this.textOf(STATEMENT[this.position]) }] };
+	}
+
+	private textOf(symbol: string): string | undefined {
+		return symbol === 'ID' || symbol === 'NUM' ? undefined : symbol;
+	}
+}
+
+suite('Constrained Decoding', () => {
+	test('mock generation stops at the first complete state', async () => {
+		const addon = new FakeAddon();
+		const backend = new MockBackend(addon as unknown as ParserAddon, [1]);
+		const text = await backend.complete({ structuralHint: '', fullContext: '', rawKey: 'ID = NUM ; ID = NUM ;' });
+		assert.deepStrictEqual(addon.fed, STATEMENT);
+		assert.strictEqual(text, joinTokens(['x', '=', '0', ';']));
+	});
+});
@@ -0,0 +1,167 @@
+/**
+ * @file latency.bench.ts
+ * @brief Ctrl+Space → 구조 후보 항목 전달까지의 종단 지연 (실제 extension host)
+ *
+ * 다른 성능 측정(engine_bench, autotune)과 같은 입력인 bench/fixtures의 생성 fixture를 열고
+ * manifest.json의 커서 위치마다 extension.triggerParsing을 실행해서,
+ * 구조 후보 provider가 항목을 돌려줄 때까지의 시간을 잰다.
+ * triggerParsing → onDataReceived → previewStructures → triggerSuggest → provider 호출의
+ * executeCommand 두 번과 suggest 위젯 왕복이 모두 포함된다.
+ *
+ * 실행: npm run bench:latency  (.vscode-test.mjs의 "latency" 설정)
+ *       LATENCY_FIXTURES=medium_d4 npm run bench:latency → 그 크기/깊이의 fixture만
+ * 결과: 콘솔 표 + bench/out/latency.json (커밋하지 않는 출력 디렉토리)
+ */
+
+import * as assert from 'assert';
+import * as fs from 'fs';
+import * as path from 'path';
+import { performance } from 'perf_hooks';
+import * as vscode from 'vscode';
+import { ExtensionApi, StructuralDelivery } from '../../extension';
+
+interface FixtureEntry {
+	languageId: string;
+	file: string;  // manifest 기준 상대 경로
+	size: string;
+	depth: number;
+	positions: [number, number][];
+}
+
+interface FixtureManifest {
+	fixtures: FixtureEntry[];
+}
+
+interface LatencyResult {
+	languageId: string;
+	fixture: string;  // "<size>_d<depth>"
+	samples: number;
+	commandMs: { p50: number; p95: number; max: number };   // triggerParsing 반환까지 (파싱 + DB 조회)
+	deliveredMs: { p50: number; p95: number; max: number }; // provider 항목 전달까지
+}
+
+const FIXTURE_DIR = path.resolve(__dirname, '../../../bench/fixtures');
+const OUTPUT_DIR = path.resolve(__dirname, '../../../bench/out');
+
+const ITERATIONS = 5;
+const WARMUP = 1;
+const TIMEOUT_MS = 10000;
+
+function variantOf(fixture: FixtureEntry): string {
+	return `${fixture.size}_d${fixture.depth}`;
+}
+
+// 기본은 manifest의 모든 fixture. LATENCY_FIXTURES가 있으면 그 크기/깊이(예: "large_d4")만
+function loadFixtures(): FixtureEntry[] {
+	const manifest: FixtureManifest = JSON.parse(fs.readFileSync(path.join(FIXTURE_DIR, 'manifest.json'), 'utf8'));
+	const variant = process.env.LATENCY_FIXTURES;
+	const fixtures = variant ? manifest.fixtures.filter((f) => variantOf(f) === variant) : manifest.fixtures;
+	assert.ok(fixtures.length > 0, `no generated fixtures for LATENCY_FIXTURES=${variant}`);
+	return fixtures;
+}
+
+function percentile(sorted: number[], p: number): number {
+	if (sorted.length === 0) { return NaN; }
+	const index = Math.min(sorted.length - 1, Math.ceil((p / 100) * sorted.length) - 1);
+	return sorted[Math.max(0, index)];
+}
+
+function summarize(samples: number[]) {
+	const sorted = [...samples].sort((a, b) => a - b);
+	return {
+		p50: percentile(sorted, 50),
+		p95: percentile(sorted, 95),
+		max: sorted[sorted.length - 1] ?? NaN,
+	};
+}
+
+function waitForDelivery(api: ExtensionApi, uri: string, timeoutMs: number): Promise<StructuralDelivery> {
+	return new Promise((resolve, reject) => {
+		const timer = setTimeout(() => {
+			subscription.dispose();
+			reject(new Error(`no structural items within ${timeoutMs}ms: ${uri}`));
+		}, timeoutMs);
+		const subscription = api.onStructuralItemsDelivered((delivery) => {
+			if (delivery.uri !== uri) { return; }
+			clearTimeout(timer);
+			subscription.dispose();
+			resolve(delivery);
+		});
+	});
+}
+
+suite('Latency: keypress → structural suggest items', function () {
+	const fixtures = loadFixtures();
+	const results: LatencyResult[] = [];
+	let api: ExtensionApi;
+
+	suiteSetup(async function () {
+		const extension = vscode.extensions.all.find((e) => e.packageJSON?.name === 'sb');
+		assert.ok(extension, 'extension under test not found');
+		api = await extension.activate() as ExtensionApi;
+		assert.ok(api?.onStructuralItemsDelivered, 'activate() did not return the extension API');
+	});
+
+	suiteTeardown(function () {
+		if (results.length === 0) { return; }
+		console.log('\n[Latency] languageId | fixture | n | command p50/p95/max | delivered p50/p95/max (ms)');
+		for (const r of results) {
+			const fmt = (s: { p50: number; p95: number; max: number }) =>
+				`${s.p50.toFixed(1)}/${s.p95.toFixed(1)}/${s.max.toFixed(1)}`;
+			console.log(`[Latency] ${r.languageId} | ${r.fixture} | ${r.samples} | ${fmt(r.commandMs)} | ${fmt(r.deliveredMs)}`);
+		}
+		fs.mkdirSync(OUTPUT_DIR, { recursive: true });
+		fs.writeFileSync(path.join(OUTPUT_DIR, 'latency.json'), JSON.stringify({
+			vscode: vscode.version,
+			platform: process.platform,
+			date: new Date().toISOString(),
+			results,
+		}, null, 2) + '\n', 'utf8');
+	});
+
+	for (const fixture of fixtures) {
+		test(`${fixture.languageId} (${fixture.file})`, async function () {
+			if (!api.hasParser(fixture.languageId)) {
+				console.log(`[Latency] skip ${fixture.languageId}: parser addon not built`);
+				this.skip();
+			}
+
+			let document = await vscode.workspace.openTextDocument(path.join(FIXTURE_DIR, fixture.file));
+			if (document.languageId !== fixture.languageId) {
+				document = await vscode.languages.setTextDocumentLanguage(document, fixture.languageId);
+			}
+			const editor = await vscode.window.showTextDocument(document);
+			const uri = editor.document.uri.toString();
+
+			const commandMs: number[] = [];
+			const deliveredMs: number[] = [];
+			for (const [line, character] of fixture.positions) {
+				const position = new vscode.Position(line, character);
+				for (let i = 0; i < WARMUP + ITERATIONS; i++) {
+					await vscode.commands.executeCommand('hideSuggestWidget');
+					editor.selection = new vscode.Selection(position, position);
+
+					const delivered = waitForDelivery(api, uri, TIMEOUT_MS);
+					const start = performance.now();
+					await vscode.commands.executeCommand('extension.triggerParsing');
+					const commandDone = performance.now();
+					const delivery = await delivered;
+
+					if (i < WARMUP) { continue; }
+					commandMs.push(commandDone - start);
+					deliveredMs.push(delivery.deliveredAt - start);
+				}
+			}
+			await vscode.commands.executeCommand('hideSuggestWidget');
+			await vscode.commands.executeCommand('workbench.action.closeActiveEditor');
+
+			results.push({
+				languageId: fixture.languageId,
+				fixture: variantOf(fixture),
+				samples: deliveredMs.length,
+				commandMs: summarize(commandMs),
+				deliveredMs: summarize(deliveredMs),
+			});
+		});
+	}
+});
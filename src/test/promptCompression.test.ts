@@ -0,0 +1,62 @@
+/**
+ * @file promptCompression.test.ts
+ * @brief 문맥 압축(src/promptCompression.ts)의 예산 계산
+ *
+ * 결과가 항상 예산 안인지, 요약 줄을 필요 이상으로 버리지 않는지 확인한다.
+ */
+
+import * as assert from 'assert';
+import { OutlineLine } from '../addonLoader';
+import { compressContext, estimateTokens } from '../promptCompression';
+
+// 줄마다 최상위 문장 하나 (signature면 요약이 원문 줄을 그대로 쓴다)
+function topLevel(count: number, signature = false): OutlineLine[] {
+	const outline: OutlineLine[] = [];
+	for (let line = 0; line < count; line++) {
+		outline.push({ line, depth: 0, signature, tokens: [{ symbol: 'id', text: `v${line}` }] });
+	}
+	return outline;
+}
+
+function total(result: { summary: string; verbatim: string }): number {
+	return estimateTokens(result.summary) + estimateTokens(result.verbatim);
+}
+
+suite('compressContext', () => {
+	test('원문 구간만으로 예산을 넘으면 먼 줄부터 줄여 예산을 지킨다', () => {
+		const lines = Array.from({ length: 60 }, (_, i) => `value_${i} = compute(value_${i - 1}, ${i});`);
+		const source = lines.join('\n');
+		const budget = { maxTokens: 100, nearLines: 40 };
+		const result = compressContext(source, topLevel(lines.length), undefined, budget);
+
+		assert.ok(total(result) <= budget.maxTokens, `${total(result)} > ${budget.maxTokens}`);
+		assert.strictEqual(result.compressedTokens, total(result));
+		assert.ok(source.endsWith(result.verbatim));
+		assert.ok(result.verbatimFromLine > lines.length - budget.nearLines);
+		assert.strictEqual(result.verbatim, lines.slice(result.verbatimFromLine).join('\n'));
+	});
+
+	test('커서 줄 하나도 예산을 넘으면 그 줄의 앞부분을 자른다', () => {
+		const source = 'short\n' + 'x'.repeat(400);
+		const result = compressContext(source, topLevel(2), undefined, { maxTokens: 20, nearLines: 40 });
+
+		assert.ok(total(result) <= 20);
+		assert.strictEqual(result.summary, '');
+		assert.strictEqual(result.verbatimFromLine, 1);
+		assert.strictEqual(result.verbatim, 'x'.repeat(80));
+	});
+
+	test('요약은 예산이 허락하는 만큼 남긴다', () => {
+		const lines = Array.from({ length: 200 }, (_, i) => `v${i} = ${i};`);
+		const budget = { maxTokens: 300, nearLines: 10 };
+		const result = compressContext(lines.join('\n'), topLevel(lines.length, true), undefined, budget);
+		const summary = result.summary.split('\n');
+
+		assert.ok(total(result) <= budget.maxTokens);
+		assert.strictEqual(summary[summary.length - 1], lines[result.verbatimFromLine - 1]);
+		// 버린 줄 하나를 되돌리면 예산을 넘어야 한다 (개행을 줄마다 한 토큰으로 세면 더 많이 버린다)
+		const dropped = lines[result.verbatimFromLine - summary.length - 1];
+		const restored = [dropped, ...summary].join('\n');
+		assert.ok(estimateTokens(restored) + estimateTokens(result.verbatim) > budget.maxTokens);
+	});
+});
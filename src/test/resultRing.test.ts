@@ -0,0 +1,115 @@
+/**
+ * @file resultRing.test.ts
+ * @brief 결과 링 소비자(src/resultRing.ts) — 네이티브 워커 대신 같은 레이아웃으로 쓰는 생산자
+ *
+ * native/src/result_ring.h의 TryWrite와 같은 규칙으로 레코드를 쓰고, 읽기/되감기/대기 깨움을 확인한다.
+ */
+
+import * as assert from 'assert';
+import { ParserAddon } from '../addonLoader';
+import { ConversionWorker, ResultRing } from '../resultRing';
+
+const WRITE_SLOT = 16;
+const READ_SLOT = 32;
+const WAITING_SLOT = 33;
+const DATA_OFFSET = 256;
+
+// 공간이 없으면 false. doorbell이 필요하면 ring.notify()까지
+function write(ring: ResultRing, id: number, states: number[], candidates: number[]): boolean {
+	const words = ring.words;
+	const u32 = new Uint32Array(ring.buffer);
+	const capacity = u32[1];
+	const size = 20 + ((states.length * 2 + 3) & ~3) + candidates.length * 4;
+	const pos = Atomics.load(words, WRITE_SLOT) >>> 0;
+	const read = Atomics.load(words, READ_SLOT) >>> 0;
+	const offset = pos & (capacity - 1);
+	const contiguous = capacity - offset;
+	const needed = size + (contiguous < size ? contiguous : 0);
+	if (capacity - ((pos - read) >>> 0) < needed) { return false; }
+	let at = offset;
+	let next = pos;
+	if (contiguous < size) {
+		u32[(DATA_OFFSET + at) >> 2] = 0;
+		next += contiguous;
+		at = 0;
+	}
+	const base = (DATA_OFFSET + at) >> 2;
+	u32.set([size, id, 0, states.length, candidates.length / 2], base);
+	new Uint16Array(ring.buffer, DATA_OFFSET + at + 20, states.length).set(states);
+	u32.set(candidates, base + 5 + (((states.length * 2 + 3) & ~3) >> 2));
+	Atomics.store(words, WRITE_SLOT, (next + size) | 0);
+	if (Atomics.exchange(words, WAITING_SLOT, 0) !== 0) { ring.notify(); }
+	return true;
+}
+
+suite('Result Ring', () => {
+	test('reads records in order and frees their space', () => {
+		const ring = ResultRing.create(1024);
+		assert.ok(write(ring, 1, [1, 7], [3, 90, 0, 10]));
+		assert.ok(write(ring, 2, [1, 2, 9], []));
+		const first = ring.tryRead()!;
+		assert.strictEqual(first.id, 1);
+		assert.deepStrictEqual(Array.from(first.states), [1, 7]);
+		assert.deepStrictEqual(Array.from(first.candidates), [3, 90, 0, 10]);
+		assert.deepStrictEqual(Array.from(ring.tryRead()!.states), [1, 2, 9]);
+		assert.strictEqual(ring.tryRead(), undefined);
+		assert.strictEqual(Atomics.load(ring.words, READ_SLOT), Atomics.load(ring.words, WRITE_SLOT));
+	});
+
+	test('follows the wrap marker and refuses writes when full', () => {
+		const ring = ResultRing.create(1024);
+		const big = Array.from({ length: 2 * 100 }, (_, i) => i);  // 레코드 820바이트
+		let id = 0;
+		for (let round = 0; round < 5; round++) {
+			assert.ok(write(ring, ++id, [round], big));
+			assert.strictEqual(write(ring, 999, [round], big), false, '읽기 전에는 두 번째 레코드가 들어가지 않는다');
+			const record = ring.tryRead()!;
+			assert.strictEqual(record.id, id);
+			assert.deepStrictEqual(Array.from(record.states), [round]);
+			assert.strictEqual(record.candidates[199], 199);
+		}
+	});
+
+	test('next() waits until the producer writes', async () => {
+		const ring = ResultRing.create(1024);
+		const pending = ring.next();
+		await new Promise((resolve) => setTimeout(resolve, 5));
+		assert.strictEqual(Atomics.load(ring.words, WAITING_SLOT), 1);
+		assert.ok(write(ring, 42, [5], [1, 1]));
+		const record = await pending;
+		assert.strictEqual(record.id, 42);
+		assert.strictEqual(Atomics.load(ring.words, WAITING_SLOT), 0);
+	});
+
+	test('cancelling a conversion drops the native job and resolves undefined', async () => {
+		// 워커 대신 제출 ID만 매기고 취소 요청을 기록하는 addon
+		let ring: Int32Array | undefined;
+		const cancelled: number[] = [];
+		let nextId = 1;
+		const addon = {
+			startConversionWorker: (words: Int32Array) => { ring = words; return ['ID', 'ID = Expr']; },
+			submitConversion: () => nextId++,
+			cancelConversion: (id: number) => { cancelled.push(id); return true; },
+			stopConversionWorker: () => {},
+		} as unknown as ParserAddon;
+		const worker = ConversionWorker.start(addon, { candidates: 'candidates.json' }, 1024)!;
+		assert.ok(ring);
+
+		const stale = new AbortController();
+		const first = worker.convert('x = ', 4, 0, stale.signal);
+		const second = worker.convert('x = 1', 5, 0);
+		stale.abort();
+		assert.strictEqual(await first, undefined);
+		assert.deepStrictEqual(cancelled, [1]);
+
+		assert.ok(write(worker.ring, 2, [3], [1, 7, 0, 2]));
+		const result = await second;
+		assert.deepStrictEqual(result?.candidates, [{ key: 'ID = Expr', value: 7 }, { key: 'ID', value: 2 }]);
+
+		const aborted = new AbortController();
+		aborted.abort();
+		assert.strictEqual(await worker.convert('x', 1, 0, aborted.signal), undefined);
+		assert.strictEqual(nextId, 3, '이미 취소된 요청은 제출하지 않는다');
+		worker.dispose();
+	});
+});
@@ -0,0 +1,53 @@
+/**
+ * @file tokenContext.ts
+ * @brief 세션 토큰열(addon의 documentTokens)로 커서가 주석/리터럴 안인지 판단한다
+ *
+ * 커서 앞뒤 1바이트와 겹치는 토큰(보통 2개)만 받아 보므로 트리를 훑거나 텍스트를 다시 토큰화하지 않는다.
+ * 플래그 비트는 native/src/token_stream.h의 TokenStream::Flag와 같다.
+ * vscode 모듈을 쓰지 않는다.
+ */
+
+import { ParserAddon } from "./addonLoader";
+
+export const TOKEN_EXTRA = 1 << 0;        // 주석 등
+export const TOKEN_CLASS_START = 1 << 1;  // 분류 노드의 첫 토큰
+const CLASS_SHIFT = 2;
+const CLASS_MASK = 3 << CLASS_SHIFT;
+const CLASS_LITERAL = 3;                  // SymbolClass::Literal
+
+type DocumentTokens = NonNullable<ReturnType<ParserAddon["documentTokens"]>>;
+
+// atLineEnd: 커서 뒤가 줄 끝이면 true (주석 토큰이 커서에서 끝나면 줄 주석으로 본다)
+export function isInCommentOrLiteral(tokens: DocumentTokens, byteOffset: number, atLineEnd: boolean): boolean {
+    for (let k = 0; k < tokens.starts.length; k++) {
+        const start = tokens.starts[k];
+        const end = start + tokens.lengths[k];
+        const flags = tokens.flags[k];
+        const literal = ((flags & CLASS_MASK) >> CLASS_SHIFT) === CLASS_LITERAL;
+        if ((flags & TOKEN_EXTRA) || literal) {
+            if (start < byteOffset && byteOffset < end) { return true; }
+        }
+        if ((flags & TOKEN_EXTRA) && end === byteOffset && atLineEnd) { return true; }
+        // 같은 리터럴의 두 토큰 사이 (예: 여는 따옴표 뒤)
+        if (literal && end === byteOffset && k + 1 < tokens.starts.length) {
+            const next = tokens.flags[k + 1];
+            if (tokens.starts[k + 1] === byteOffset && ((next & CLASS_MASK) >> CLASS_SHIFT) === CLASS_LITERAL &&
+                !(next & TOKEN_CLASS_START)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// 세션이 없거나 버전이 다르면 false (판단하지 않고 제안을 막지 않는다)
+export function cursorInCommentOrLiteral(
+    addon: ParserAddon,
+    uri: string,
+    version: number,
+    byteOffset: number,
+    atLineEnd: boolean
+): boolean {
+    const tokens = addon.documentTokens(uri, version, Math.max(0, byteOffset - 1), byteOffset + 1);
+    return tokens ? isInCommentOrLiteral(tokens, byteOffset, atLineEnd) : false;
+}
@@ -0,0 +1,199 @@
+/**
+ * @file auditCandidates.ts
+ * @brief 구조 후보 타당성 판정 배치 도구 (completion.auditPrompt 프롬프트를 코퍼스 규모로)
+ *
+ * 파일마다 여러 커서 지점(파일 길이의 1/N, 2/N, ... 줄의 시작)에서 상태 경로와 DB 후보(상위 --top개)를 구하고,
+ * src/candidateAudit.ts의 runAudit으로 LLM에 동시에(--concurrency) 판정을 요청한다.
+ * (상태 경로, 후보) 단위로 중복을 없애고 --cache 파일에 판정을 남겨, 다시 돌리면 새 후보만 묻는다.
+ * 결과는 상태별 valid/suspect/unknown 개수와 suspect 후보 목록(--json)으로 낸다.
+ * 문법이나 DB를 바꿔 상태 번호가 달라지면 캐시를 지운다.
+ *
+ * 사용법 (npm run compile 후, addon 빌드 필요):
+ *   node out/tools/auditCandidates.js --lang python [--points 8] [--top 20] [--mode 0]
+ *        [--concurrency 8] [--limit N] [--cache audit_cache/python.json] [--json report.json]
+ *        [--ext .py ...] <file|dir> ...
+ */
+
+import * as fs from "fs";
+import * as path from "path";
+import OpenAI from "openai";
+import { loadParserAddon } from "../addonLoader";
+import { TokenMapper } from "../mapLoader";
+import { AuditBackend, AuditCache, AuditCandidate, AuditPosition, runAudit } from "../candidateAudit";
+
+const ROOT = path.resolve(__dirname, "..", "..");
+
+type CandidateDb = Record<string, { key: string; value: number }[]>;
+
+function parseArgs(argv: string[]) {
+    const opts = {
+        lang: "",
+        points: 8,
+        top: 20,
+        mode: 0,
+        concurrency: 8,
+        limit: 0,
+        cache: "",
+        json: "",
+        extensions: [] as string[],
+        inputs: [] as string[],
+    };
+    for (let i = 0; i < argv.length; i++) {
+        const arg = argv[i];
+        const next = () => argv[++i];
+        if (arg === "--lang") { opts.lang = next(); }
+        else if (arg === "--points") { opts.points = Math.max(1, Number(next())); }
+        else if (arg === "--top") { opts.top = Math.max(1, Number(next())); }
+        else if (arg === "--mode") { opts.mode = Number(next()) === 2 ? 2 : 0; }
+        else if (arg === "--concurrency") { opts.concurrency = Math.max(1, Number(next())); }
+        else if (arg === "--limit") { opts.limit = Math.max(0, Number(next())); }
+        else if (arg === "--cache") { opts.cache = next(); }
+        else if (arg === "--json") { opts.json = next(); }
+        else if (arg === "--ext") { opts.extensions.push(next()); }
+        else { opts.inputs.push(arg); }
+    }
+    if (!opts.cache && opts.lang) { opts.cache = path.join(ROOT, "audit_cache", `${opts.lang}.json`); }
+    return opts;
+}
+
+function listFiles(inputs: string[], extensions: string[]): string[] {
+    const files: string[] = [];
+    const visit = (p: string) => {
+        const stat = fs.statSync(p);
+        if (stat.isDirectory()) {
+            for (const name of fs.readdirSync(p).sort()) { visit(path.join(p, name)); }
+        } else if (extensions.length === 0 || extensions.includes(path.extname(p))) {
+            files.push(p);
+        }
+    };
+    inputs.forEach(visit);
+    return files;
+}
+
+// CompletionService.lookupDB와 같은 규칙 (경로 순서대로 합산, value 내림차순) + 후보별 출처 상태
+function lookupCandidates(db: CandidateDb, states: number[], mapper: TokenMapper | undefined, top: number) {
+    const merged = new Map<string, { rawKey: string; value: number; states: number[] }>();
+    const stateLines: string[] = [];
+    for (const state of states) {
+        const entries = db[state.toString()];
+        if (!entries) {
+            stateLines.push(`No state ${state} in DB`);
+            continue;
+        }
+        stateLines.push(`State ${state}: Found ${entries.length} candidates`);
+        for (const entry of entries) {
+            const found = merged.get(entry.key);
+            if (found) {
+                found.value += entry.value;
+                if (!found.states.includes(state)) { found.states.push(state); }
+            } else {
+                merged.set(entry.key, { rawKey: entry.key, value: entry.value, states: [state] });
+            }
+        }
+    }
+    const readable = (key: string) => mapper
+        ? key.split(" ").filter(t => t.length > 0).map(t => mapper.getHumanReadableName(t)).join(" ")
+        : key;
+    const candidates: AuditCandidate[] = Array.from(merged.values())
+        .sort((a, b) => b.value - a.value)
+        .slice(0, top)
+        .map((item, index) => ({
+            sortText: (index + 1).toString().padStart(3, "0"),
+            key: readable(item.rawKey),
+            rawKey: item.rawKey,
+            states: item.states,
+        }));
+    return { candidates, stateLines };
+}
+
+class OpenAIAuditBackend implements AuditBackend {
+    readonly name = "openai:gpt-3.5-turbo";
+
+    constructor(private client: OpenAI) {}
+
+    async audit(prompt: string): Promise<string> {
+        const completion = await this.client.chat.completions.create({
+            model: "gpt-3.5-turbo",
+            temperature: 0,
+            messages: [{ role: "user", content: prompt }]
+        });
+        return completion.choices[0].message.content ?? "";
+    }
+}
+
+async function main() {
+    const opts = parseArgs(process.argv.slice(2));
+    if (!opts.lang || opts.inputs.length === 0) {
+        console.error("Usage: auditCandidates --lang <lang> [--points N] [--top N] [--mode 0|2] [--concurrency N] [--limit N] [--cache FILE] [--json FILE] [--ext .x ...] <file|dir> ...");
+        process.exit(1);
+    }
+
+    const addonName = opts.lang === "smallbasic" ? "sb_parser_addon" : `${opts.lang}_parser_addon`;
+    const addon = loadParserAddon(ROOT, addonName);
+    if (!addon?.getDocumentConversionResult) {
+        console.error(`[Error] addon with document sessions not found: ${addonName}`);
+        process.exit(1);
+    }
+    const db: CandidateDb = JSON.parse(fs.readFileSync(path.join(ROOT, "resources", opts.lang, "candidates.json"), "utf8"));
+    const mappingPath = path.join(ROOT, "resources", opts.lang, "token_mapping.json");
+    const mapper = fs.existsSync(mappingPath) ? new TokenMapper(mappingPath) : undefined;
+    const displayName = opts.lang.charAt(0).toUpperCase() + opts.lang.slice(1);
+    const tuningPath = path.join(ROOT, "resources", opts.lang, "tuning.json");
+    if (addon.loadTuning && fs.existsSync(tuningPath)) { addon.loadTuning(tuningPath); }
+
+    const positions: AuditPosition[] = [];
+    for (const file of listFiles(opts.inputs, opts.extensions)) {
+        const text = fs.readFileSync(file, "utf8");
+        const uri = `file://${path.resolve(file)}`;
+        addon.openDocument(uri, text, 1);
+        const lines = text.split("\n");
+        for (let k = 1; k <= opts.points; k++) {
+            const line = Math.floor(((lines.length - 1) * k) / opts.points);
+            const context = lines.slice(0, line).join("\n") + (line > 0 ? "\n" : "");
+            const byteOffset = Buffer.byteLength(context, "utf8");
+            const statePath = addon.getDocumentConversionResult(uri, 1, byteOffset, opts.mode);
+            if (!statePath || statePath.length === 0) { continue; }
+            const { candidates, stateLines } = lookupCandidates(db, statePath, mapper, opts.top);
+            if (candidates.length === 0) { continue; }
+            positions.push({ id: `${file}:${line + 1}`, languageName: displayName, sourceUpToCursor: context, statePath, stateLines, candidates });
+        }
+        addon.closeDocument(uri);
+        if (opts.limit > 0 && positions.length >= opts.limit) { break; }
+    }
+    if (opts.limit > 0) { positions.splice(opts.limit); }
+
+    const secrets = JSON.parse(fs.readFileSync(path.join(ROOT, "secrets.json"), "utf8"));
+    const backend = new OpenAIAuditBackend(new OpenAI({ apiKey: secrets.apiKey }));
+    const cache = new AuditCache(opts.cache);
+    console.log(`[Info] positions=${positions.length} cache=${cache.size} entries concurrency=${opts.concurrency}`);
+
+    let lastLogged = 0;
+    const report = await runAudit(positions, backend, {
+        concurrency: opts.concurrency,
+        cache,
+        onProgress: (done, total) => {
+            if (done - lastLogged >= 100 || done === total) {
+                lastLogged = done;
+                console.log(`[Info] ${done}/${total} positions`);
+                cache.save();
+            }
+        },
+    });
+    cache.save();
+
+    console.log("state | valid | suspect | unknown | suspect share");
+    for (const s of report.states) {
+        const total = s.valid + s.suspect + s.unknown;
+        console.log(`${s.state} | ${s.valid} | ${s.suspect} | ${s.unknown} | ${(s.suspect / Math.max(1, total) * 100).toFixed(1)}%`);
+    }
+    console.log(`\n[Summary] positions=${report.positions} judgments=${report.judgments} requests=${report.requests} (failed ${report.failedRequests}) cache hits=${report.cacheHits} shared=${report.sharedHits} unanswered=${report.unanswered}`);
+
+    if (opts.json) {
+        fs.writeFileSync(opts.json, JSON.stringify(report, null, 2) + "\n", "utf8");
+    }
+}
+
+main().catch((e) => {
+    console.error("[Error]", e);
+    process.exit(1);
+});
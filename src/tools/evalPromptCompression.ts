@@ -0,0 +1,164 @@
+/**
+ * @file evalPromptCompression.ts
+ * @brief 프롬프트 압축 오프라인 평가: generateCompletionPrompt(원문 전체) vs 구조 요약 프롬프트
+ *
+ * 파일마다 여러 커서 지점(파일 길이의 1/N, 2/N, ... 지점)에서 두 프롬프트의 토큰 수를 비교하고,
+ * 입력 토큰당 처리 시간(--ms-per-1k)으로 절약되는 지연을 추정한다.
+ * --live N을 주면 secrets.json의 키로 실제 요청을 보내 앞의 N개 지점의 응답 시간을 직접 잰다.
+ *
+ * 사용법 (npm run compile 후, addon 빌드 필요):
+ *   node out/tools/evalPromptCompression.js --lang python [--budget 1500] [--points 4]
+ *        [--hint "ID = Expr"] [--ms-per-1k 30] [--live N] [--json out.json] <file> ...
+ */
+
+import * as fs from "fs";
+import * as path from "path";
+import { performance } from "perf_hooks";
+import OpenAI from "openai";
+import { loadParserAddon } from "../addonLoader";
+import { TokenMapper } from "../mapLoader";
+import { SYSTEM_ROLE, generateCompletionPrompt, generateCompletionPromptWithSummary } from "../prompts";
+import { DEFAULT_PROMPT_BUDGET, compressContext, estimateTokens } from "../promptCompression";
+
+interface Sample {
+    file: string;
+    line: number;
+    rawTokens: number;
+    compressedTokens: number;
+    rawPrompt: string;
+    compressedPrompt: string;
+    rawMs?: number;
+    compressedMs?: number;
+}
+
+const ROOT = path.resolve(__dirname, "..", "..");
+
+function parseArgs(argv: string[]) {
+    const opts = {
+        lang: "",
+        budget: DEFAULT_PROMPT_BUDGET.maxTokens,
+        points: 4,
+        hint: "ID = Expr",
+        msPer1k: 30,
+        live: 0,
+        json: "",
+        files: [] as string[],
+    };
+    for (let i = 0; i < argv.length; i++) {
+        const arg = argv[i];
+        const next = () => argv[++i];
+        if (arg === "--lang") { opts.lang = next(); }
+        else if (arg === "--budget") { opts.budget = Number(next()); }
+        else if (arg === "--points") { opts.points = Math.max(1, Number(next())); }
+        else if (arg === "--hint") { opts.hint = next(); }
+        else if (arg === "--ms-per-1k") { opts.msPer1k = Number(next()); }
+        else if (arg === "--live") { opts.live = Number(next()); }
+        else if (arg === "--json") { opts.json = next(); }
+        else { opts.files.push(arg); }
+    }
+    return opts;
+}
+
+async function timeRequest(client: OpenAI, prompt: string): Promise<number> {
+    const start = performance.now();
+    await client.chat.completions.create({
+        model: "gpt-3.5-turbo",
+        max_tokens: 32,
+        messages: [
+            { role: "system", content: SYSTEM_ROLE },
+            { role: "user", content: prompt }
+        ]
+    });
+    return performance.now() - start;
+}
+
+async function main() {
+    const opts = parseArgs(process.argv.slice(2));
+    if (!opts.lang || opts.files.length === 0) {
+        console.error("Usage: evalPromptCompression --lang <lang> [--budget N] [--points N] [--hint H] [--ms-per-1k MS] [--live N] [--json FILE] <file> ...");
+        process.exit(1);
+    }
+
+    const addonName = opts.lang === "smallbasic" ? "sb_parser_addon" : `${opts.lang}_parser_addon`;
+    const addon = loadParserAddon(ROOT, addonName);
+    if (!addon?.documentOutline) {
+        console.error(`[Error] addon with documentOutline not found: ${addonName}`);
+        process.exit(1);
+    }
+    const mappingPath = path.join(ROOT, "resources", opts.lang, "token_mapping.json");
+    const mapper = fs.existsSync(mappingPath) ? new TokenMapper(mappingPath) : undefined;
+    const displayName = opts.lang.charAt(0).toUpperCase() + opts.lang.slice(1);
+    const budget = { ...DEFAULT_PROMPT_BUDGET, maxTokens: opts.budget };
+    const systemTokens = estimateTokens(SYSTEM_ROLE);
+
+    const samples: Sample[] = [];
+    for (const file of opts.files) {
+        const text = fs.readFileSync(file, "utf8");
+        const uri = `file://${path.resolve(file)}`;
+        addon.openDocument(uri, text, 1);
+        const lines = text.split("\n");
+        for (let k = 1; k <= opts.points; k++) {
+            const line = Math.floor((lines.length * k) / opts.points);
+            const context = lines.slice(0, line).join("\n");
+            const outline = addon.documentOutline(uri, 1, Buffer.byteLength(context, "utf8"));
+            const compressed = compressContext(context, outline, mapper, budget);
+
+            const rawPrompt = generateCompletionPrompt(context, opts.hint, displayName);
+            const compressedPrompt = compressed.summary
+                ? generateCompletionPromptWithSummary(compressed.summary, compressed.verbatim, opts.hint, displayName)
+                : generateCompletionPrompt(compressed.verbatim, opts.hint, displayName);
+            samples.push({
+                file,
+                line,
+                rawTokens: systemTokens + estimateTokens(rawPrompt),
+                compressedTokens: systemTokens + estimateTokens(compressedPrompt),
+                rawPrompt,
+                compressedPrompt,
+            });
+        }
+        addon.closeDocument(uri);
+    }
+
+    if (opts.live > 0) {
+        const secrets = JSON.parse(fs.readFileSync(path.join(ROOT, "secrets.json"), "utf8"));
+        const client = new OpenAI({ apiKey: secrets.apiKey });
+        for (const sample of samples.slice(0, opts.live)) {
+            sample.rawMs = await timeRequest(client, sample.rawPrompt);
+            sample.compressedMs = await timeRequest(client, sample.compressedPrompt);
+        }
+    }
+
+    console.log("file:line | raw tokens | compressed tokens | ratio | est. saved ms | live raw/compressed ms");
+    let rawTotal = 0;
+    let compressedTotal = 0;
+    for (const s of samples) {
+        rawTotal += s.rawTokens;
+        compressedTotal += s.compressedTokens;
+        const saved = ((s.rawTokens - s.compressedTokens) * opts.msPer1k) / 1000;
+        const live = s.rawMs !== undefined ? `${s.rawMs.toFixed(0)}/${s.compressedMs!.toFixed(0)}` : "-";
+        console.log(`${path.basename(s.file)}:${s.line} | ${s.rawTokens} | ${s.compressedTokens} | ${(s.compressedTokens / s.rawTokens).toFixed(2)} | ${saved.toFixed(1)} | ${live}`);
+    }
+    const liveSamples = samples.filter(s => s.rawMs !== undefined);
+    console.log(`\n[Summary] samples=${samples.length} budget=${opts.budget} tokens ${rawTotal} -> ${compressedTotal} (${((1 - compressedTotal / Math.max(1, rawTotal)) * 100).toFixed(1)}% fewer)`);
+    console.log(`[Summary] estimated prefill saving: ${(((rawTotal - compressedTotal) * opts.msPer1k) / 1000 / Math.max(1, samples.length)).toFixed(1)} ms/request at ${opts.msPer1k} ms per 1k input tokens`);
+    if (liveSamples.length > 0) {
+        const mean = (xs: number[]) => xs.reduce((a, b) => a + b, 0) / xs.length;
+        console.log(`[Summary] live mean latency: raw ${mean(liveSamples.map(s => s.rawMs!)).toFixed(0)} ms, compressed ${mean(liveSamples.map(s => s.compressedMs!)).toFixed(0)} ms (n=${liveSamples.length})`);
+    }
+
+    if (opts.json) {
+        fs.writeFileSync(opts.json, JSON.stringify(samples.map(s => ({
+            file: s.file,
+            line: s.line,
+            rawTokens: s.rawTokens,
+            compressedTokens: s.compressedTokens,
+            rawMs: s.rawMs,
+            compressedMs: s.compressedMs,
+        })), null, 2) + "\n", "utf8");
+    }
+}
+
+main().catch((e) => {
+    console.error("[Error]", e);
+    process.exit(1);
+});